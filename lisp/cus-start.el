@@ -87,6 +87,11 @@ minibuffer-prompt-properties--setter
 	     (gc-cons-threshold alloc integer)
 	     (gc-cons-percentage alloc float)
 	     (garbage-collection-messages alloc boolean)
+	     (gc-idle-collect-after-pause
+	      alloc (choice (const :tag "Never collect early" nil)
+			    (number :tag "Seconds"))
+	      "27.1")
+	     (gc-release-memory alloc boolean "27.1")
 	     ;; buffer.c
 	     (cursor-type display ,cursor-type-types)
 	     (mode-line-format mode-line sexp) ;Hard to do right.
@@ -475,6 +480,9 @@ minibuffer-prompt-properties--setter
              (ns-use-srgb-colorspace ns boolean "24.4")
 	     ;; process.c
 	     (delete-exited-processes processes-basics boolean)
+	     ;; profiler.c
+	     (profiler-log-size profiler integer "27.1")
+	     (profiler-max-stack-depth profiler integer "27.1")
 	     ;; syntax.c
 	     (parse-sexp-ignore-comments editing-basics boolean)
 	     (words-include-escapes editing-basics boolean)
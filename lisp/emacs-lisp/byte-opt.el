@@ -1298,10 +1298,22 @@ disassemble-offset
 	 (+ (aref bytes bytedecomp-ptr)
 	    (progn (setq bytedecomp-ptr (1+ bytedecomp-ptr))
 		   (ash (aref bytes bytedecomp-ptr) 8))))
-	((and (>= bytedecomp-op byte-listN)
-	      (<= bytedecomp-op byte-discardN))
+	((or (and (>= bytedecomp-op byte-listN)
+	          (<= bytedecomp-op byte-discardN))
+             (memq bytedecomp-op (eval-when-compile
+                                   (list byte-varref-car-safe
+                                         byte-stack-ref-cdr
+                                         byte-constant-call1
+                                         byte-constant-call2
+                                         byte-tail-call))))
 	 (setq bytedecomp-ptr (1+ bytedecomp-ptr)) ;Offset in next byte.
-	 (aref bytes bytedecomp-ptr))))
+	 (aref bytes bytedecomp-ptr))
+	((eq bytedecomp-op byte-dup-goto-if-nil)
+	 ;; Offset in next 2 bytes.
+	 (setq bytedecomp-ptr (1+ bytedecomp-ptr))
+	 (+ (aref bytes bytedecomp-ptr)
+	    (progn (setq bytedecomp-ptr (1+ bytedecomp-ptr))
+		   (ash (aref bytes bytedecomp-ptr) 8))))))
 
 (defvar byte-compile-tag-number)
 
@@ -1348,11 +1360,16 @@ byte-decompile-bytecode-1
                               new)))))
 	    ((cond ((eq bytedecomp-op 'byte-constant2)
 		    (setq bytedecomp-op 'byte-constant) t)
-		   ((memq bytedecomp-op byte-constref-ops)))
+		   ((memq bytedecomp-op byte-constref-ops))
+		   ((memq bytedecomp-op '(byte-varref-car-safe
+					  byte-constant-call1
+					  byte-constant-call2))))
 	     (setq tmp (if (>= offset (length constvec))
 			   (list 'out-of-range offset)
 			 (aref constvec offset))
-		   offset (if (eq bytedecomp-op 'byte-constant)
+		   offset (if (memq bytedecomp-op '(byte-constant
+						    byte-constant-call1
+						    byte-constant-call2))
 			      (byte-compile-get-constant tmp)
 			    (or (assq tmp byte-compile-variables)
                                 (let ((new (list tmp)))
@@ -1361,6 +1378,9 @@ byte-decompile-bytecode-1
                    last-constant tmp))
 	    ((eq bytedecomp-op 'byte-stack-set2)
 	     (setq bytedecomp-op 'byte-stack-set))
+	    ((and make-spliceable (eq bytedecomp-op 'byte-tail-call))
+	     ;; The `byte-return' after it is about to become a goto.
+	     (setq bytedecomp-op 'byte-call))
 	    ((and (eq bytedecomp-op 'byte-discardN) (>= offset #x80))
 	     ;; The top bit of the operand for byte-discardN is a flag,
 	     ;; saying whether the top-of-stack is preserved.  In
@@ -1396,8 +1416,28 @@ byte-decompile-bytecode-1
                         ;; once.
                         do (setf (nth 2 el) last-constant) and return nil))))
       ;; lap = ( [ (pc . (op . arg)) ]* )
-      (push (cons optr (cons bytedecomp-op (or offset 0)))
-            lap)
+      (setq tmp (and make-spliceable
+                     (cdr (assq bytedecomp-op byte-fused-ops))))
+      (cond
+       ((and make-spliceable (eq bytedecomp-op 'byte-stack-rest))
+        ;; Spliced code gets its &rest list from the caller.
+        nil)
+       ((null tmp)
+        (push (cons optr (cons bytedecomp-op (or offset 0)))
+              lap))
+       (t
+        ;; Split fused instructions into the pairs they stand for, so
+        ;; that the optimizer can work on the result.
+        (push (cons optr (cons (car tmp)
+                               (if (eq (car tmp) 'byte-dup) 0 offset)))
+              lap)
+        (push (cons nil (cons (cdr tmp)
+                              (pcase bytedecomp-op
+                                ('byte-dup-goto-if-nil offset)
+                                ('byte-constant-call1 1)
+                                ('byte-constant-call2 2)
+                                (_ 0))))
+              lap)))
       (setq bytedecomp-ptr (1+ bytedecomp-ptr)))
     (let ((rest lap))
       (while rest
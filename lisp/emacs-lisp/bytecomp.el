@@ -233,6 +233,31 @@ byte-compile-cond-use-jump-table
   :group 'bytecomp
   :type 'boolean)
 
+(defcustom byte-compile-fuse-instructions t
+  "If non-nil, combine common pairs of instructions into one.
+Also mark the functions whose &rest list may be allocated on the stack.
+This makes the compiled code smaller and faster, but it cannot be
+run by Emacs versions before 27."
+  :version "27.1"
+  :group 'bytecomp
+  :type 'boolean)
+
+(defcustom byte-compile-tail-calls nil
+  "If non-nil, compile calls in tail position as tail calls.
+This applies to functions that use lexical binding.  A tail call to
+another such function reuses the stack frame of the caller, so that
+self- and mutually recursive functions can recur without limit;
+in exchange, backtraces do not show the callers that were replaced.
+The compiled code cannot be run by Emacs versions before 27.
+
+To enable this option for the functions of one file, make it a
+file-local variable in that file.
+For example, add  -*-byte-compile-tail-calls: t;-*- on the first line."
+  :version "27.1"
+  :group 'bytecomp
+  :type 'boolean)
+;;;###autoload(put 'byte-compile-tail-calls 'safe-local-variable 'booleanp)
+
 (defvar byte-compile-dynamic nil
   "If non-nil, compile function bodies so they load lazily.
 They are hidden in comments in the compiled file,
@@ -769,7 +794,27 @@ byte-discardN-preserve-tos
  "to take a hash table and a value from the stack, and jump to the address
 the value maps to, if any.")
 
-;; unused: 182-191
+;; These ops are new to v27.  Each does the work of the pair of ops it
+;; is named after; see `byte-compile-fuse-lapcode'.
+(byte-defop 184  1 byte-varref-car-safe) ; Variable in following one byte.
+(byte-defop 185  1 byte-stack-ref-cdr)	; Stack offset in following one byte.
+(byte-defop 186  0 byte-dup-goto-if-nil)
+(byte-defop 187  0 byte-constant-call1)	; Constant in following one byte.
+(byte-defop 188 -1 byte-constant-call2)	; Constant in following one byte.
+
+
+;; Like `byte-call', but always followed by `byte-return'; the
+;; interpreter may then run the function called in the caller's frame.
+;; See `byte-compile-fuse-lapcode'.  New to v27.
+(byte-defop 189 nil byte-tail-call)	; Number of args in following byte.
+
+;; Does nothing.  As the first instruction of a function, it says that
+;; the function's &rest list does not escape, so that the interpreter
+;; may allocate it on the stack; see `byte-compile--rest-escapes-p'.
+;; New to v27.
+(byte-defop 190  0 byte-stack-rest)
+
+;; unused: 191
 
 (byte-defop 192  1 byte-constant	"for reference to a constant")
 ;; codes 193-255 are consumed by byte-constant.
@@ -779,7 +824,8 @@ byte-constant-limit
 (defconst byte-goto-ops '(byte-goto byte-goto-if-nil byte-goto-if-not-nil
 			  byte-goto-if-nil-else-pop
 			  byte-goto-if-not-nil-else-pop
-                          byte-pushcatch byte-pushconditioncase)
+                          byte-pushcatch byte-pushconditioncase
+                          byte-dup-goto-if-nil)
   "List of byte-codes whose offset is a pc.")
 
 (defconst byte-goto-always-pop-ops '(byte-goto-if-nil byte-goto-if-not-nil))
@@ -838,14 +884,81 @@ byte-compile-push-bytecode-const2
   `(byte-compile-push-bytecodes ,opcode (logand ,const2 255) (ash ,const2 -8)
 				,bytes ,pc))
 
-(defun byte-compile-lapcode (lap)
-  "Turns lapcode into bytecode.  The lapcode is destroyed."
+(defconst byte-fused-ops
+  '((byte-varref-car-safe byte-varref . byte-car-safe)
+    (byte-stack-ref-cdr byte-stack-ref . byte-cdr)
+    (byte-dup-goto-if-nil byte-dup . byte-goto-if-nil)
+    (byte-constant-call1 byte-constant . byte-call)
+    (byte-constant-call2 byte-constant . byte-call))
+  "Alist of fused byte-codes and the pairs of byte-codes they replace.")
+
+(defun byte-compile--return-follows-p (lap)
+  "Return non-nil if LAP starts with `byte-return', possibly after tags."
+  (while (eq (car (car lap)) 'TAG)
+    (setq lap (cdr lap)))
+  (eq (car (car lap)) 'byte-return))
+
+(defun byte-compile-fuse-lapcode (lap &optional tail-calls)
+  "Replace pairs of instructions in LAP with fused instructions.
+Do so only if `byte-compile-fuse-instructions' is non-nil.
+If TAIL-CALLS is non-nil, also turn each `byte-call' that is
+followed by `byte-return', possibly after tags, into a
+`byte-tail-call'.
+The constants and variables in LAP must already have been given
+their index in the constants vector.  LAP is modified destructively."
+  (let ((rest lap))
+    (while (cdr rest)
+      (let* ((this (car rest))
+             (next (nth 1 rest))
+             (pair (cons (car this) (car next)))
+             ;; All fused ops but `byte-dup-goto-if-nil' carry the
+             ;; operand of THIS in one byte.
+             (off (if (consp (cdr this)) (cdr (cdr this)) (cdr this)))
+             (fused
+              (cond
+               ((and tail-calls
+                     (eq (car this) 'byte-call)
+                     (< off 256)
+                     (byte-compile--return-follows-p (cdr rest)))
+                ;; The `byte-return' stays, for the cases where the
+                ;; interpreter makes an ordinary call after all.
+                (setcar this 'byte-tail-call)
+                nil)
+               ((not byte-compile-fuse-instructions)
+                nil)
+               ((equal pair '(byte-dup . byte-goto-if-nil))
+                (setq off (cdr next))
+                'byte-dup-goto-if-nil)
+               ((not (and (natnump off) (< off 256)))
+                nil)
+               ((equal pair '(byte-constant . byte-call))
+                ;; Leave tail calls alone.
+                (unless (and tail-calls
+                             (byte-compile--return-follows-p
+                              (nthcdr 2 rest)))
+                  (cdr (assq (cdr next) '((1 . byte-constant-call1)
+                                          (2 . byte-constant-call2))))))
+               ((member pair '((byte-varref . byte-car-safe)
+                               (byte-stack-ref . byte-cdr)))
+                (car (rassoc pair byte-fused-ops))))))
+        (when fused
+          (setcar this fused)
+          (setcdr this off)
+          (setcdr rest (nthcdr 2 rest))))
+      (setq rest (cdr rest))))
+  lap)
+
+(defun byte-compile-lapcode (lap &optional tail-calls)
+  "Turns lapcode into bytecode.  The lapcode is destroyed.
+If TAIL-CALLS is non-nil, calls just before a return become tail calls."
   ;; Lapcode modifications: changes the ID of a tag to be the tag's PC.
   (let ((pc 0)			; Program counter
 	op off			; Operation & offset
 	opcode			; numeric value of OP
 	(bytes '())		; Put the output bytes here
 	(patchlist nil))        ; List of gotos to patch
+    (when (or byte-compile-fuse-instructions tail-calls)
+      (setq lap (byte-compile-fuse-lapcode lap tail-calls)))
     (dolist (lap-entry lap)
       (setq op (car lap-entry)
 	    off (cdr lap-entry))
@@ -885,8 +998,10 @@ byte-compile-lapcode
                ;; offset is too large for the normal version.
                (byte-compile-push-bytecode-const2 byte-stack-set2 off
                                                   bytes pc))
-              ((and (>= opcode byte-listN)
-                    (< opcode byte-discardN))
+              ((or (and (>= opcode byte-listN)
+                        (< opcode byte-discardN))
+                   (assq op byte-fused-ops)
+                   (eq op 'byte-tail-call))
                ;; These insns all put their operand into one extra byte.
                (byte-compile-push-bytecodes opcode off bytes pc))
               ((= opcode byte-discardN)
@@ -2125,12 +2240,14 @@ byte-compile-insert-header
 Call from the source buffer."
   (let ((dynamic-docstrings byte-compile-dynamic-docstrings)
 	(dynamic byte-compile-dynamic)
-	(optimize byte-optimize))
+	(optimize byte-optimize)
+	(fuse (or byte-compile-fuse-instructions byte-compile-tail-calls)))
     (with-current-buffer outbuffer
       (goto-char (point-min))
       ;; The magic number of .elc files is ";ELC", or 0x3B454C43.  After
-      ;; that is the file-format version number (18, 19, 20, or 23) as a
-      ;; byte, followed by some nulls.  The primary motivation for doing
+      ;; that is the file-format version number (18, 19, 20, 23 or 27) as
+      ;; a byte, followed by some nulls.  Version 27 marks files that may
+      ;; use fused instructions or tail calls.  The primary motivation for doing
       ;; this is to get some binary characters up in the first line of
       ;; the file so that `diff' will simply say "Binary files differ"
       ;; instead of actually doing a diff of two .elc files.  An extra
@@ -2138,7 +2255,7 @@ byte-compile-insert-header
       ;; 0	string		;ELC		GNU Emacs Lisp compiled file,
       ;; >4	byte		x		version %d
       (insert
-       ";ELC" 23 "\000\000\000\n"
+       ";ELC" (if fuse 27 23) "\000\000\000\n"
        ";;; Compiled\n"
        ";;; in Emacs version " emacs-version "\n"
        ";;; with"
@@ -2796,6 +2913,176 @@ byte-compile-make-args-desc
               (ash nonrest 8)
               (ash rest 7)))))
 
+(defconst byte-compile--rest-list-ops
+  '((car 1 0) (car-safe 1 0) (length 1 0) (null 1 0) (not 1 0)
+    (consp 1 0) (listp 1 0) (eq 2 0 1) (nth 2 1) (elt 2 0) (assq 2 1))
+  "Functions whose instructions examine a list without keeping it.
+Each element has the form (FUNCTION NARGS . POSITIONS): in a call to
+FUNCTION with NARGS arguments, the arguments at the zero-based
+POSITIONS may be lists that must not escape.")
+
+(defconst byte-compile--rest-tail-ops
+  '((cdr 1 0) (cdr-safe 1 0) (nthcdr 2 1) (memq 2 1) (member 2 1))
+  "Functions whose instructions return a tail of a list argument.
+The elements have the same form as in `byte-compile--rest-list-ops'.")
+
+(defun byte-compile--rest-mentions-p (form vars)
+  "Return non-nil if FORM contains one of the symbols in VARS."
+  (cond
+   ((symbolp form) (memq form vars))
+   ((consp form)
+    (or (byte-compile--rest-mentions-p (car form) vars)
+        (byte-compile--rest-mentions-p (cdr form) vars)))))
+
+(defun byte-compile--rest-value-p (form vars)
+  "Return non-nil if the value of FORM may be a list held in VARS.
+FORM is one that `byte-compile--rest-walk' accepted."
+  (cond
+   ((symbolp form) (memq form vars))
+   ((atom form) nil)
+   (t
+    (let ((head (car form))
+          (args (cdr form)))
+      (pcase head
+        ((or 'quote 'function 'while) nil)
+        ((or 'progn 'inline 'save-excursion 'save-restriction
+             'save-current-buffer 'and)
+         (byte-compile--rest-value-p (car (last args)) vars))
+        ((or 'prog1 'unwind-protect)
+         (byte-compile--rest-value-p (car args) vars))
+        ('if
+         (or (byte-compile--rest-value-p (nth 1 args) vars)
+             (byte-compile--rest-value-p (car (last (nthcdr 2 args))) vars)))
+        ('or
+         (let ((value nil))
+           (dolist (arg args value)
+             (when (byte-compile--rest-value-p arg vars)
+               (setq value t)))))
+        (_
+         (let ((op (assq head byte-compile--rest-tail-ops)))
+           (cond
+            ((and op (= (length args) (nth 1 op)))
+             (byte-compile--rest-value-p (nth (nth 2 op) args) vars))
+            ((or op
+                 (assq head byte-compile--rest-list-ops)
+                 (and (symbolp head)
+                      (fboundp head)
+                      (not (special-form-p head))
+                      (not (macrop head))))
+             ;; The walk found that no list in VARS is passed to an
+             ;; ordinary function.
+             nil)
+            (t
+             (byte-compile--rest-mentions-p form vars))))))))))
+
+(defun byte-compile--rest-walk-body (body vars escape)
+  "Call `byte-compile--rest-walk' on the forms of BODY.
+The value of the last form escapes if ESCAPE is non-nil."
+  (while body
+    (byte-compile--rest-walk (car body) vars (and (null (cdr body)) escape))
+    (setq body (cdr body))))
+
+(defun byte-compile--rest-walk (form vars escape)
+  "Throw to `escape' if a list held in one of VARS may escape FORM.
+VARS are the lexical variables that may hold the list or a tail of it.
+The value of FORM escapes if ESCAPE is non-nil."
+  (cond
+   ((symbolp form)
+    (when (and escape (memq form vars))
+      (throw 'escape t)))
+   ((atom form))
+   (t
+    (let ((head (car form))
+          (args (cdr form)))
+      (pcase head
+        ('quote nil)
+        ((or 'progn 'inline 'save-excursion 'save-restriction
+             'save-current-buffer)
+         (byte-compile--rest-walk-body args vars escape))
+        ((or 'prog1 'unwind-protect)
+         (byte-compile--rest-walk (car args) vars escape)
+         (byte-compile--rest-walk-body (cdr args) vars nil))
+        ('if
+         (byte-compile--rest-walk (car args) vars nil)
+         (byte-compile--rest-walk (nth 1 args) vars escape)
+         (byte-compile--rest-walk-body (nthcdr 2 args) vars escape))
+        ('cond
+         (dolist (clause args)
+           (byte-compile--rest-walk (car clause) vars
+                                    (and escape (null (cdr clause))))
+           (byte-compile--rest-walk-body (cdr clause) vars escape)))
+        ('and (byte-compile--rest-walk-body args vars escape))
+        ('or
+         (dolist (arg args)
+           (byte-compile--rest-walk arg vars escape)))
+        ('while (byte-compile--rest-walk-body args vars nil))
+        ('catch
+         (byte-compile--rest-walk (car args) vars t)
+         (byte-compile--rest-walk-body (cdr args) vars escape))
+        ('condition-case
+         (byte-compile--rest-walk (nth 1 args) vars escape)
+         (dolist (handler (nthcdr 2 args))
+           (byte-compile--rest-walk-body (cdr handler) vars escape)))
+        ('setq
+         (while args
+           (let ((var (pop args)))
+             ;; A variable that may hold the list can be set to a
+             ;; tail of it; the value of `setq' is that of its last
+             ;; assignment.
+             (byte-compile--rest-walk (pop args) vars
+                                      (or (not (memq var vars))
+                                          (and escape (null args)))))))
+        ((or 'let 'let*)
+         (let ((inner vars))
+           (dolist (binding (car args))
+             (let ((var (if (consp binding) (car binding) binding))
+                   (val (car-safe (cdr-safe binding)))
+                   (scope (if (eq head 'let*) inner vars)))
+               (if (byte-compile-not-lexical-var-p var)
+                   (byte-compile--rest-walk val scope t)
+                 (byte-compile--rest-walk val scope nil)
+                 (when (byte-compile--rest-value-p val scope)
+                   (push var inner)))))
+           (byte-compile--rest-walk-body (cdr args) inner escape)))
+        (_
+         (let ((op (or (assq head byte-compile--rest-list-ops)
+                       (assq head byte-compile--rest-tail-ops))))
+           (cond
+            ((and op (= (length args) (nth 1 op)))
+             (let ((tail (memq op byte-compile--rest-tail-ops))
+                   (i 0))
+               (dolist (arg args)
+                 (byte-compile--rest-walk
+                  arg vars (or (not (memq i (nthcdr 2 op)))
+                               (and tail escape)))
+                 (setq i (1+ i)))))
+            ((and (symbolp head)
+                  (fboundp head)
+                  (not (special-form-p head))
+                  (not (macrop head)))
+             ;; A call of some other function.
+             (dolist (arg args)
+               (byte-compile--rest-walk arg vars t)))
+            ((byte-compile--rest-mentions-p form vars)
+             (throw 'escape t))))))))))
+
+(defun byte-compile--rest-escapes-p (arglist body)
+  "Return non-nil if the &rest list in ARGLIST may escape BODY.
+ARGLIST and BODY are those of a function that uses lexical binding,
+after macroexpansion and closure conversion.  The list does not
+escape if it, and the tails of it that the function keeps in
+variables, are only examined by instructions such as `car' and
+`length'.  The interpreter may then allocate it on the stack."
+  (let ((var (cadr (memq '&rest arglist))))
+    (or (byte-compile-not-lexical-var-p var)
+        (catch 'escape
+          (byte-compile--rest-walk-body body (list var) t)
+          nil))))
+
+(defvar byte-compile--rest-on-stack nil
+  "Non-nil if the &rest list of the function being compiled can be
+allocated on the stack.")
+
 
 (defun byte-compile-lambda (fun &optional add-lambda reserved-csts)
   "Byte-compile a lambda-expression and return a valid function.
@@ -2856,16 +3143,21 @@ byte-compile-lambda
 	     (byte-compile-warn "malformed interactive spec: %s"
 				(prin1-to-string int)))))
     ;; Process the body.
-    (let ((compiled
-           (byte-compile-top-level (cons 'progn body) nil 'lambda
-                                   ;; If doing lexical binding, push a new
-                                   ;; lexical environment containing just the
-                                   ;; args (since lambda expressions should be
-                                   ;; closed by now).
-                                   (and lexical-binding
-                                        (byte-compile-make-lambda-lexenv
-                                         arglistvars))
-                                   reserved-csts)))
+    (let* ((byte-compile--rest-on-stack
+            (and byte-compile-fuse-instructions
+                 lexical-binding
+                 (memq '&rest arglist)
+                 (not (byte-compile--rest-escapes-p arglist body))))
+           (compiled
+            (byte-compile-top-level (cons 'progn body) nil 'lambda
+                                    ;; If doing lexical binding, push a new
+                                    ;; lexical environment containing just the
+                                    ;; args (since lambda expressions should be
+                                    ;; closed by now).
+                                    (and lexical-binding
+                                         (byte-compile-make-lambda-lexenv
+                                          arglistvars))
+                                    reserved-csts)))
       ;; Build the actual byte-coded function.
       (cl-assert (eq 'byte-code (car-safe compiled)))
       (apply #'make-byte-code
@@ -3040,7 +3332,14 @@ byte-compile-out-toplevel
 	      (setq rest (cdr rest)))
 	    rest))
       (let ((byte-compile-vector (byte-compile-constants-vector)))
-	(list 'byte-code (byte-compile-lapcode byte-compile-output)
+	(list 'byte-code
+              (byte-compile-lapcode
+               (if (and byte-compile--rest-on-stack (eq output-type 'lambda))
+                   (cons '(byte-stack-rest) byte-compile-output)
+                 byte-compile-output)
+               (and byte-compile-tail-calls
+                    lexical-binding
+                    (eq output-type 'lambda)))
 	      byte-compile-vector byte-compile-maxdepth)))
      ;; it's a trivial function
      ((cdr body) (cons 'progn (nreverse body)))
@@ -5169,16 +5468,21 @@ batch-byte-recompile-directory
 ;;; report metering (see the hacks in bytecode.c)
 
 (defvar byte-code-meter)
+(defvar byte-code-function-meter)
 (defun byte-compile-report-ops ()
-  (or (boundp 'byte-metering-on)
-      (error "You must build Emacs with -DBYTE_CODE_METER to use this"))
+  "Report the byte-code usage recorded while `byte-metering-on' was set.
+List how often each opcode was executed, and which functions
+executed the most instructions."
+  (interactive)
+  (or byte-code-meter
+      (error "Set `byte-metering-on' to collect byte-code statistics"))
   (with-output-to-temp-buffer "*Meter*"
     (set-buffer "*Meter*")
     (let ((i 0) n op off)
       (while (< i 256)
 	(setq n (aref (aref byte-code-meter 0) i)
 	      off nil)
-	(if t				;(not (zerop n))
+	(if (not (zerop n))
 	    (progn
 	      (setq op i)
 	      (setq off nil)
@@ -5194,8 +5498,21 @@ byte-compile-report-ops
 	      (if off (insert " [" (int-to-string off) "]"))
 	      (indent-to 40)
 	      (insert (int-to-string n) "\n")))
-	(setq i (1+ i))))))
-
+	(setq i (1+ i))))
+    (when (and (hash-table-p byte-code-function-meter)
+               (> (hash-table-count byte-code-function-meter) 0))
+      (let (counts)
+        (maphash (lambda (fun n) (push (cons fun n) counts))
+                 byte-code-function-meter)
+        (insert "\nInstructions executed by each function:\n\n")
+        (dolist (count (sort counts (lambda (a b) (> (cdr a) (cdr b)))))
+          (insert (if (symbolp (car count))
+                      (symbol-name (car count))
+                    (let ((print-length 3) (print-level 2))
+                      (prin1-to-string (car count)))))
+          (indent-to 40)
+          (insert (int-to-string (cdr count)) "\n"))))))
+
 ;; To avoid "lisp nesting exceeds max-lisp-eval-depth" when bytecomp compiles
 ;; itself, compile some of its most used recursive functions (at load time).
 ;;
@@ -65,6 +65,7 @@ cl--typeof-types
     (bool-vector array sequence atom)
     (frame atom) (hash-table atom) (terminal atom)
     (thread atom) (mutex atom) (condvar atom)
+    (string-builder atom)
     (font-spec atom) (font-entity atom) (font-object atom)
     (vector array sequence atom)
     (user-ptr atom)
@@ -211,14 +211,18 @@ disassemble-1
 	  (insert " ")
 	  (cond ((memq op byte-goto-ops)
 		 (insert (int-to-string (nth 1 arg))))
-		((memq op '(byte-call byte-unbind
+		((memq op '(byte-call byte-tail-call byte-unbind
 			    byte-listN byte-concatN byte-insertN
 			    byte-stack-ref byte-stack-set byte-stack-set2
 			    byte-discardN byte-discardN-preserve-tos))
 		 (insert (int-to-string arg)))
-		((memq op '(byte-varref byte-varset byte-varbind))
+		((memq op '(byte-varref byte-varset byte-varbind
+			    byte-varref-car-safe))
 		 (prin1 (car arg) (current-buffer)))
-		((memq op '(byte-constant byte-constant2))
+		((eq op 'byte-stack-ref-cdr)
+		 (insert (int-to-string arg)))
+		((memq op '(byte-constant byte-constant2
+			    byte-constant-call1 byte-constant-call2))
 		 ;; it's a constant
 		 (setq arg (car arg))
                  ;; if the succeeding op is byte-switch, display the jump table
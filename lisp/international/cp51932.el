@@ -0,0 +1,472 @@
+;;; cp51932.el -- translation table for CP51932
+;;; Automatically generated from CP932-2BYTE.map
+(let ((map
+       '(;JISEXT<->UNICODE
+	 (#x2D21 . #x2460)
+	 (#x2D22 . #x2461)
+	 (#x2D23 . #x2462)
+	 (#x2D24 . #x2463)
+	 (#x2D25 . #x2464)
+	 (#x2D26 . #x2465)
+	 (#x2D27 . #x2466)
+	 (#x2D28 . #x2467)
+	 (#x2D29 . #x2468)
+	 (#x2D2A . #x2469)
+	 (#x2D2B . #x246A)
+	 (#x2D2C . #x246B)
+	 (#x2D2D . #x246C)
+	 (#x2D2E . #x246D)
+	 (#x2D2F . #x246E)
+	 (#x2D30 . #x246F)
+	 (#x2D31 . #x2470)
+	 (#x2D32 . #x2471)
+	 (#x2D33 . #x2472)
+	 (#x2D34 . #x2473)
+	 (#x2D35 . #x2160)
+	 (#x2D36 . #x2161)
+	 (#x2D37 . #x2162)
+	 (#x2D38 . #x2163)
+	 (#x2D39 . #x2164)
+	 (#x2D3A . #x2165)
+	 (#x2D3B . #x2166)
+	 (#x2D3C . #x2167)
+	 (#x2D3D . #x2168)
+	 (#x2D3E . #x2169)
+	 (#x2D40 . #x3349)
+	 (#x2D41 . #x3314)
+	 (#x2D42 . #x3322)
+	 (#x2D43 . #x334D)
+	 (#x2D44 . #x3318)
+	 (#x2D45 . #x3327)
+	 (#x2D46 . #x3303)
+	 (#x2D47 . #x3336)
+	 (#x2D48 . #x3351)
+	 (#x2D49 . #x3357)
+	 (#x2D4A . #x330D)
+	 (#x2D4B . #x3326)
+	 (#x2D4C . #x3323)
+	 (#x2D4D . #x332B)
+	 (#x2D4E . #x334A)
+	 (#x2D4F . #x333B)
+	 (#x2D50 . #x339C)
+	 (#x2D51 . #x339D)
+	 (#x2D52 . #x339E)
+	 (#x2D53 . #x338E)
+	 (#x2D54 . #x338F)
+	 (#x2D55 . #x33C4)
+	 (#x2D56 . #x33A1)
+	 (#x2D5F . #x337B)
+	 (#x2D60 . #x301D)
+	 (#x2D61 . #x301F)
+	 (#x2D62 . #x2116)
+	 (#x2D63 . #x33CD)
+	 (#x2D64 . #x2121)
+	 (#x2D65 . #x32A4)
+	 (#x2D66 . #x32A5)
+	 (#x2D67 . #x32A6)
+	 (#x2D68 . #x32A7)
+	 (#x2D69 . #x32A8)
+	 (#x2D6A . #x3231)
+	 (#x2D6B . #x3232)
+	 (#x2D6C . #x3239)
+	 (#x2D6D . #x337E)
+	 (#x2D6E . #x337D)
+	 (#x2D6F . #x337C)
+	 (#x2D70 . #x2252)
+	 (#x2D71 . #x2261)
+	 (#x2D72 . #x222B)
+	 (#x2D73 . #x222E)
+	 (#x2D74 . #x2211)
+	 (#x2D75 . #x221A)
+	 (#x2D76 . #x22A5)
+	 (#x2D77 . #x2220)
+	 (#x2D78 . #x221F)
+	 (#x2D79 . #x22BF)
+	 (#x2D7A . #x2235)
+	 (#x2D7B . #x2229)
+	 (#x2D7C . #x222A)
+	 (#x7921 . #x7E8A)
+	 (#x7922 . #x891C)
+	 (#x7923 . #x9348)
+	 (#x7924 . #x9288)
+	 (#x7925 . #x84DC)
+	 (#x7926 . #x4FC9)
+	 (#x7927 . #x70BB)
+	 (#x7928 . #x6631)
+	 (#x7929 . #x68C8)
+	 (#x792A . #x92F9)
+	 (#x792B . #x66FB)
+	 (#x792C . #x5F45)
+	 (#x792D . #x4E28)
+	 (#x792E . #x4EE1)
+	 (#x792F . #x4EFC)
+	 (#x7930 . #x4F00)
+	 (#x7931 . #x4F03)
+	 (#x7932 . #x4F39)
+	 (#x7933 . #x4F56)
+	 (#x7934 . #x4F92)
+	 (#x7935 . #x4F8A)
+	 (#x7936 . #x4F9A)
+	 (#x7937 . #x4F94)
+	 (#x7938 . #x4FCD)
+	 (#x7939 . #x5040)
+	 (#x793A . #x5022)
+	 (#x793B . #x4FFF)
+	 (#x793C . #x501E)
+	 (#x793D . #x5046)
+	 (#x793E . #x5070)
+	 (#x793F . #x5042)
+	 (#x7940 . #x5094)
+	 (#x7941 . #x50F4)
+	 (#x7942 . #x50D8)
+	 (#x7943 . #x514A)
+	 (#x7944 . #x5164)
+	 (#x7945 . #x519D)
+	 (#x7946 . #x51BE)
+	 (#x7947 . #x51EC)
+	 (#x7948 . #x5215)
+	 (#x7949 . #x529C)
+	 (#x794A . #x52A6)
+	 (#x794B . #x52C0)
+	 (#x794C . #x52DB)
+	 (#x794D . #x5300)
+	 (#x794E . #x5307)
+	 (#x794F . #x5324)
+	 (#x7950 . #x5372)
+	 (#x7951 . #x5393)
+	 (#x7952 . #x53B2)
+	 (#x7953 . #x53DD)
+	 (#x7954 . #xFA0E)
+	 (#x7955 . #x549C)
+	 (#x7956 . #x548A)
+	 (#x7957 . #x54A9)
+	 (#x7958 . #x54FF)
+	 (#x7959 . #x5586)
+	 (#x795A . #x5759)
+	 (#x795B . #x5765)
+	 (#x795C . #x57AC)
+	 (#x795D . #x57C8)
+	 (#x795E . #x57C7)
+	 (#x795F . #xFA0F)
+	 (#x7960 . #xFA10)
+	 (#x7961 . #x589E)
+	 (#x7962 . #x58B2)
+	 (#x7963 . #x590B)
+	 (#x7964 . #x5953)
+	 (#x7965 . #x595B)
+	 (#x7966 . #x595D)
+	 (#x7967 . #x5963)
+	 (#x7968 . #x59A4)
+	 (#x7969 . #x59BA)
+	 (#x796A . #x5B56)
+	 (#x796B . #x5BC0)
+	 (#x796C . #x752F)
+	 (#x796D . #x5BD8)
+	 (#x796E . #x5BEC)
+	 (#x796F . #x5C1E)
+	 (#x7970 . #x5CA6)
+	 (#x7971 . #x5CBA)
+	 (#x7972 . #x5CF5)
+	 (#x7973 . #x5D27)
+	 (#x7974 . #x5D53)
+	 (#x7975 . #xFA11)
+	 (#x7976 . #x5D42)
+	 (#x7977 . #x5D6D)
+	 (#x7978 . #x5DB8)
+	 (#x7979 . #x5DB9)
+	 (#x797A . #x5DD0)
+	 (#x797B . #x5F21)
+	 (#x797C . #x5F34)
+	 (#x797D . #x5F67)
+	 (#x797E . #x5FB7)
+	 (#x7A21 . #x5FDE)
+	 (#x7A22 . #x605D)
+	 (#x7A23 . #x6085)
+	 (#x7A24 . #x608A)
+	 (#x7A25 . #x60DE)
+	 (#x7A26 . #x60D5)
+	 (#x7A27 . #x6120)
+	 (#x7A28 . #x60F2)
+	 (#x7A29 . #x6111)
+	 (#x7A2A . #x6137)
+	 (#x7A2B . #x6130)
+	 (#x7A2C . #x6198)
+	 (#x7A2D . #x6213)
+	 (#x7A2E . #x62A6)
+	 (#x7A2F . #x63F5)
+	 (#x7A30 . #x6460)
+	 (#x7A31 . #x649D)
+	 (#x7A32 . #x64CE)
+	 (#x7A33 . #x654E)
+	 (#x7A34 . #x6600)
+	 (#x7A35 . #x6615)
+	 (#x7A36 . #x663B)
+	 (#x7A37 . #x6609)
+	 (#x7A38 . #x662E)
+	 (#x7A39 . #x661E)
+	 (#x7A3A . #x6624)
+	 (#x7A3B . #x6665)
+	 (#x7A3C . #x6657)
+	 (#x7A3D . #x6659)
+	 (#x7A3E . #xFA12)
+	 (#x7A3F . #x6673)
+	 (#x7A40 . #x6699)
+	 (#x7A41 . #x66A0)
+	 (#x7A42 . #x66B2)
+	 (#x7A43 . #x66BF)
+	 (#x7A44 . #x66FA)
+	 (#x7A45 . #x670E)
+	 (#x7A46 . #xF929)
+	 (#x7A47 . #x6766)
+	 (#x7A48 . #x67BB)
+	 (#x7A49 . #x6852)
+	 (#x7A4A . #x67C0)
+	 (#x7A4B . #x6801)
+	 (#x7A4C . #x6844)
+	 (#x7A4D . #x68CF)
+	 (#x7A4E . #xFA13)
+	 (#x7A4F . #x6968)
+	 (#x7A50 . #xFA14)
+	 (#x7A51 . #x6998)
+	 (#x7A52 . #x69E2)
+	 (#x7A53 . #x6A30)
+	 (#x7A54 . #x6A6B)
+	 (#x7A55 . #x6A46)
+	 (#x7A56 . #x6A73)
+	 (#x7A57 . #x6A7E)
+	 (#x7A58 . #x6AE2)
+	 (#x7A59 . #x6AE4)
+	 (#x7A5A . #x6BD6)
+	 (#x7A5B . #x6C3F)
+	 (#x7A5C . #x6C5C)
+	 (#x7A5D . #x6C86)
+	 (#x7A5E . #x6C6F)
+	 (#x7A5F . #x6CDA)
+	 (#x7A60 . #x6D04)
+	 (#x7A61 . #x6D87)
+	 (#x7A62 . #x6D6F)
+	 (#x7A63 . #x6D96)
+	 (#x7A64 . #x6DAC)
+	 (#x7A65 . #x6DCF)
+	 (#x7A66 . #x6DF8)
+	 (#x7A67 . #x6DF2)
+	 (#x7A68 . #x6DFC)
+	 (#x7A69 . #x6E39)
+	 (#x7A6A . #x6E5C)
+	 (#x7A6B . #x6E27)
+	 (#x7A6C . #x6E3C)
+	 (#x7A6D . #x6EBF)
+	 (#x7A6E . #x6F88)
+	 (#x7A6F . #x6FB5)
+	 (#x7A70 . #x6FF5)
+	 (#x7A71 . #x7005)
+	 (#x7A72 . #x7007)
+	 (#x7A73 . #x7028)
+	 (#x7A74 . #x7085)
+	 (#x7A75 . #x70AB)
+	 (#x7A76 . #x710F)
+	 (#x7A77 . #x7104)
+	 (#x7A78 . #x715C)
+	 (#x7A79 . #x7146)
+	 (#x7A7A . #x7147)
+	 (#x7A7B . #xFA15)
+	 (#x7A7C . #x71C1)
+	 (#x7A7D . #x71FE)
+	 (#x7A7E . #x72B1)
+	 (#x7B21 . #x72BE)
+	 (#x7B22 . #x7324)
+	 (#x7B23 . #xFA16)
+	 (#x7B24 . #x7377)
+	 (#x7B25 . #x73BD)
+	 (#x7B26 . #x73C9)
+	 (#x7B27 . #x73D6)
+	 (#x7B28 . #x73E3)
+	 (#x7B29 . #x73D2)
+	 (#x7B2A . #x7407)
+	 (#x7B2B . #x73F5)
+	 (#x7B2C . #x7426)
+	 (#x7B2D . #x742A)
+	 (#x7B2E . #x7429)
+	 (#x7B2F . #x742E)
+	 (#x7B30 . #x7462)
+	 (#x7B31 . #x7489)
+	 (#x7B32 . #x749F)
+	 (#x7B33 . #x7501)
+	 (#x7B34 . #x756F)
+	 (#x7B35 . #x7682)
+	 (#x7B36 . #x769C)
+	 (#x7B37 . #x769E)
+	 (#x7B38 . #x769B)
+	 (#x7B39 . #x76A6)
+	 (#x7B3A . #xFA17)
+	 (#x7B3B . #x7746)
+	 (#x7B3C . #x52AF)
+	 (#x7B3D . #x7821)
+	 (#x7B3E . #x784E)
+	 (#x7B3F . #x7864)
+	 (#x7B40 . #x787A)
+	 (#x7B41 . #x7930)
+	 (#x7B42 . #xFA18)
+	 (#x7B43 . #xFA19)
+	 (#x7B44 . #xFA1A)
+	 (#x7B45 . #x7994)
+	 (#x7B46 . #xFA1B)
+	 (#x7B47 . #x799B)
+	 (#x7B48 . #x7AD1)
+	 (#x7B49 . #x7AE7)
+	 (#x7B4A . #xFA1C)
+	 (#x7B4B . #x7AEB)
+	 (#x7B4C . #x7B9E)
+	 (#x7B4D . #xFA1D)
+	 (#x7B4E . #x7D48)
+	 (#x7B4F . #x7D5C)
+	 (#x7B50 . #x7DB7)
+	 (#x7B51 . #x7DA0)
+	 (#x7B52 . #x7DD6)
+	 (#x7B53 . #x7E52)
+	 (#x7B54 . #x7F47)
+	 (#x7B55 . #x7FA1)
+	 (#x7B56 . #xFA1E)
+	 (#x7B57 . #x8301)
+	 (#x7B58 . #x8362)
+	 (#x7B59 . #x837F)
+	 (#x7B5A . #x83C7)
+	 (#x7B5B . #x83F6)
+	 (#x7B5C . #x8448)
+	 (#x7B5D . #x84B4)
+	 (#x7B5E . #x8553)
+	 (#x7B5F . #x8559)
+	 (#x7B60 . #x856B)
+	 (#x7B61 . #xFA1F)
+	 (#x7B62 . #x85B0)
+	 (#x7B63 . #xFA20)
+	 (#x7B64 . #xFA21)
+	 (#x7B65 . #x8807)
+	 (#x7B66 . #x88F5)
+	 (#x7B67 . #x8A12)
+	 (#x7B68 . #x8A37)
+	 (#x7B69 . #x8A79)
+	 (#x7B6A . #x8AA7)
+	 (#x7B6B . #x8ABE)
+	 (#x7B6C . #x8ADF)
+	 (#x7B6D . #xFA22)
+	 (#x7B6E . #x8AF6)
+	 (#x7B6F . #x8B53)
+	 (#x7B70 . #x8B7F)
+	 (#x7B71 . #x8CF0)
+	 (#x7B72 . #x8CF4)
+	 (#x7B73 . #x8D12)
+	 (#x7B74 . #x8D76)
+	 (#x7B75 . #xFA23)
+	 (#x7B76 . #x8ECF)
+	 (#x7B77 . #xFA24)
+	 (#x7B78 . #xFA25)
+	 (#x7B79 . #x9067)
+	 (#x7B7A . #x90DE)
+	 (#x7B7B . #xFA26)
+	 (#x7B7C . #x9115)
+	 (#x7B7D . #x9127)
+	 (#x7B7E . #x91DA)
+	 (#x7C21 . #x91D7)
+	 (#x7C22 . #x91DE)
+	 (#x7C23 . #x91ED)
+	 (#x7C24 . #x91EE)
+	 (#x7C25 . #x91E4)
+	 (#x7C26 . #x91E5)
+	 (#x7C27 . #x9206)
+	 (#x7C28 . #x9210)
+	 (#x7C29 . #x920A)
+	 (#x7C2A . #x923A)
+	 (#x7C2B . #x9240)
+	 (#x7C2C . #x923C)
+	 (#x7C2D . #x924E)
+	 (#x7C2E . #x9259)
+	 (#x7C2F . #x9251)
+	 (#x7C30 . #x9239)
+	 (#x7C31 . #x9267)
+	 (#x7C32 . #x92A7)
+	 (#x7C33 . #x9277)
+	 (#x7C34 . #x9278)
+	 (#x7C35 . #x92E7)
+	 (#x7C36 . #x92D7)
+	 (#x7C37 . #x92D9)
+	 (#x7C38 . #x92D0)
+	 (#x7C39 . #xFA27)
+	 (#x7C3A . #x92D5)
+	 (#x7C3B . #x92E0)
+	 (#x7C3C . #x92D3)
+	 (#x7C3D . #x9325)
+	 (#x7C3E . #x9321)
+	 (#x7C3F . #x92FB)
+	 (#x7C40 . #xFA28)
+	 (#x7C41 . #x931E)
+	 (#x7C42 . #x92FF)
+	 (#x7C43 . #x931D)
+	 (#x7C44 . #x9302)
+	 (#x7C45 . #x9370)
+	 (#x7C46 . #x9357)
+	 (#x7C47 . #x93A4)
+	 (#x7C48 . #x93C6)
+	 (#x7C49 . #x93DE)
+	 (#x7C4A . #x93F8)
+	 (#x7C4B . #x9431)
+	 (#x7C4C . #x9445)
+	 (#x7C4D . #x9448)
+	 (#x7C4E . #x9592)
+	 (#x7C4F . #xF9DC)
+	 (#x7C50 . #xFA29)
+	 (#x7C51 . #x969D)
+	 (#x7C52 . #x96AF)
+	 (#x7C53 . #x9733)
+	 (#x7C54 . #x973B)
+	 (#x7C55 . #x9743)
+	 (#x7C56 . #x974D)
+	 (#x7C57 . #x974F)
+	 (#x7C58 . #x9751)
+	 (#x7C59 . #x9755)
+	 (#x7C5A . #x9857)
+	 (#x7C5B . #x9865)
+	 (#x7C5C . #xFA2A)
+	 (#x7C5D . #xFA2B)
+	 (#x7C5E . #x9927)
+	 (#x7C5F . #xFA2C)
+	 (#x7C60 . #x999E)
+	 (#x7C61 . #x9A4E)
+	 (#x7C62 . #x9AD9)
+	 (#x7C63 . #x9ADC)
+	 (#x7C64 . #x9B75)
+	 (#x7C65 . #x9B72)
+	 (#x7C66 . #x9B8F)
+	 (#x7C67 . #x9BB1)
+	 (#x7C68 . #x9BBB)
+	 (#x7C69 . #x9C00)
+	 (#x7C6A . #x9D70)
+	 (#x7C6B . #x9D6B)
+	 (#x7C6C . #xFA2D)
+	 (#x7C6D . #x9E19)
+	 (#x7C6E . #x9ED1)
+	 (#x7C71 . #x2170)
+	 (#x7C72 . #x2171)
+	 (#x7C73 . #x2172)
+	 (#x7C74 . #x2173)
+	 (#x7C75 . #x2174)
+	 (#x7C76 . #x2175)
+	 (#x7C77 . #x2176)
+	 (#x7C78 . #x2177)
+	 (#x7C79 . #x2178)
+	 (#x7C7A . #x2179)
+	 (#x7C7B . #xFFE2)
+	 (#x7C7C . #xFFE4)
+	 (#x7C7D . #xFF07)
+	 (#x7C7E . #xFF02))))
+  (mapc #'(lambda (x)
+	    (setcar x (decode-char 'japanese-jisx0208 (car x))))
+	map)
+  (define-translation-table 'cp51932-decode map)
+  (mapc #'(lambda (x)
+	    (let ((tmp (car x)))
+	      (setcar x (cdr x)) (setcdr x tmp)))
+	map)
+  (define-translation-table 'cp51932-encode map))
+
+(provide 'cp51932)
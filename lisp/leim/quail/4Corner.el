@@ -0,0 +1,6711 @@
+;; Quail package `chinese-4corner
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: 4Corner.tit
+
+;; # -*- coding: cn-big5 -*-
+;; # HANZI input table for cxterm
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 2
+;; ENCODE:	BIG5
+;; AUTOSELECT:	NO
+;; PROMPT:	|X::\040
+;; #
+;; COMMENT
+;; COMMENT Copyright (c) 2001 Christian Wittern <chris@ccbs.ntu.edu.tw>
+;; COMMENT
+;; COMMENT Permission to copy and distribute both modified and
+;; COMMENT unmodified versions is granted without royalty provided this
+;; COMMENT notice is preserved.
+;; COMMENT
+;; COMMENT	Authors: Dr. Urs App, Christian Wittern (Kyoto Univ, Japan)
+;; COMMENT
+;; COMMENT Input:  |X (Τ@[X)
+;; # define keys
+;; VALIDINPUTKEY:	0123456789
+;; WILDCARDKEY:	*
+;; WILDCHARKEY:	?
+;; SELECTKEY:	1\040
+;; SELECTKEY:	2
+;; SELECTKEY:	3
+;; SELECTKEY:	4
+;; SELECTKEY:	5
+;; SELECTKEY:	6
+;; SELECTKEY:	7
+;; SELECTKEY:	8
+;; SELECTKEY:	9
+;; SELECTKEY:	0
+;; BACKSPACE:	\010\177
+;; DELETEALL:	\015\025
+;; MOVERIGHT:	.>
+;; MOVELEFT:	,<
+;; REPEATKEY:	\020\022
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-4corner" "Chinese-BIG5" "|"
+ t
+"|X::
+
+
+ Copyright (c) 2001 Christian Wittern <chris@ccbs.ntu.edu.tw>
+
+ Permission to copy and distribute both modified and
+ unmodified versions is granted without royalty provided this
+ notice is preserved.
+
+	Authors: Dr. Urs App, Christian Wittern (Kyoto Univ, Japan)
+
+ Input:  |X (Τ@[X)
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   ("." . quail-next-translation)
+   (">" . quail-next-translation)
+   ("," . quail-prev-translation)
+   ("<" . quail-prev-translation))
+ nil nil nil nil)
+
+(quail-define-rules
+("00104" "D")
+("00106" "ܳ")
+("00107" "Ъ")
+("00108" "")
+("00109" "")
+("00111" "gjptθ")
+("00112" "ڳ")
+("00113" "")
+("00114" "вڵnt")
+("00116" "n")
+("00117" "ͯjƽEL")
+("00118" "k")
+("00120" "g")
+("00121" "o")
+("00122" "lo")
+("00123" "x")
+("00127" "fhŽCab~ç~֢֣ڱڴwK")
+("00128" "")
+("00129" "گ")
+("00131" "i")
+("00132" "¡o")
+("00133" "km")
+("00134" "ekp")
+("00136" "}֡")
+("00137" "")
+("00141" "}")
+("00142" "")
+("00144" "")
+("00146" "`v")
+("00147" "̯hmGIڰuJ")
+("00148" "pN")
+("00149" "")
+("00151" "~}G")
+("00157" "ڶ")
+("00160" "m֤")
+("00161" "DڲP")
+("00162" "FO")
+("00164" "")
+("00166" "M")
+("00167" "H")
+("00169" "l")
+("00172" "")
+("00175" "i")
+("00177" "")
+("00181" "èr")
+("00182" "|")
+("00186" "")
+("00187" "")
+("00189" "Ϸ")
+("00191" "lq")
+("00193" "s")
+("00194" "")
+("00196" "")
+("00199" "")
+("00201" "F")
+("00207" "")
+("00210" "")
+("00211" "ȳey")
+("00212" "x")
+("00213" "R]ι]_")
+("00214" "yоη_s")
+("00216" "^gv")
+("00217" "GfýĹ")
+("00220" "Z")
+("00221" "r")
+("00222" "ǫ۹")
+("00223" "ԻN~c")
+("00224" "N")
+("00227" "襫w|ҮuǰӱeYǹGIqtN^")
+("00230" "")
+("00231" "Uu")
+("00232" "d")
+("00236" "f")
+("00237" "fhGI")
+("00240" "p")
+("00241" "xeζq")
+("00242" "")
+("00244" "εF")
+("00246" "K")
+("00247" "]״\HoyuwG`")
+("00248" "t")
+("00251" "")
+("00252" "r")
+("00253" "")
+("00256" "w")
+("00259" "s")
+("00260" "[")
+("00261" "ivHp")
+("00262" "a")
+("00264" "")
+("00266" "s")
+("00267" "")
+("00271" "")
+("00280" "z")
+("00281" "")
+("00282" "t")
+("00286" "s")
+("00293" "r")
+("00294" "ɳSκo")
+("00298" "J")
+("00330" "")
+("00331" "")
+("00332" "i")
+("00334" "x")
+("00336" "N")
+("00337" "")
+("00400" "")
+("00401" "")
+("00403" "v")
+("00404" "kc")
+("00406" "")
+("00407" "")
+("00408" "")
+("00414" "")
+("00430" "")
+("00441" "ä|G")
+("00443" "")
+("00503" "o")
+("00601" "G")
+("00602" "")
+("00603" "b")
+("00604" "[")
+("00614" "")
+("00617" "")
+("00622" "")
+("00627" "X~")
+("00631" "")
+("00632" "M")
+("00637" "")
+("00647" "")
+("00648" "")
+("00661" "")
+("00682" "")
+("00696" "")
+("00710" "`l")
+("00714" "@")
+("00717" "|")
+("00732" "ȦsIOϻqnsvwv")
+("00747" "")
+("00772" "")
+("00800" "")
+("00802" "")
+("00806" "[t")
+("00901" "[")
+("00903" "")
+("00904" "A")
+("00906" "")
+("00914" "")
+("01104" "b")
+("01136" "P")
+("01160" "")
+("01186" "Ÿ")
+("01211" "s")
+("01217" "i")
+("01247" "V")
+("01286" "C")
+("01327" "")
+("01401" "Ť")
+("01486" "")
+("01601" "B")
+("01610" "RI")
+("01611" "FKC")
+("01614" "")
+("01616" "")
+("01617" "")
+("01618" "z")
+("01620" "qF")
+("01632" "J")
+("01640" "PXY")
+("01641" "M")
+("01646" "")
+("01647" "")
+("01649" "")
+("01660" "")
+("01661" "ڻy")
+("01666" "")
+("01691" "")
+("01696" "")
+("01732" "ŧ")
+("01801" "")
+("01886" "")
+("01903" "")
+("02114" "")
+("02127" "")
+("02157" "E")
+("02200" "оi")
+("02227" "i")
+("02422" "")
+("02427" "ݽ")
+("02600" "VE")
+("02613" "K")
+("02614" "U")
+("02617" "")
+("02618" "")
+("02621" "`")
+("02627" "@")
+("02631" "D")
+("02634" "")
+("02637" "")
+("02640" "C")
+("02641" "")
+("02644" "")
+("02647" "")
+("02653" "")
+("02657" "")
+("02661" "")
+("02663" "")
+("02664" "")
+("02669" "B")
+("02670" "S")
+("02677" "")
+("02710" "{")
+("02800" "")
+("02921" "s")
+("03134" "")
+("03147" "")
+("03327" "l")
+("03440" "y")
+("03534" "")
+("03600" "r")
+("03611" "")
+("03614" "")
+("03616" "~")
+("03617" "")
+("03627" "")
+("03632" "N")
+("03634" "M")
+("03640" "")
+("03647" "")
+("03650" "ۻ|@r")
+("03653" "")
+("03660" "")
+("03669" "Z")
+("03694" "")
+("03806" "I")
+("03914" "N")
+("04127" "")
+("04132" "A")
+("04147" "R")
+("04281" "Q")
+("04400" "")
+("04600" "pQ")
+("04610" "_")
+("04611" "M")
+("04612" "Y")
+("04614" "N")
+("04617" "")
+("04627" "[P")
+("04631" "x@")
+("04634" "")
+("04635" "")
+("04637" "[")
+("04640" "O")
+("04641" "GN")
+("04647" "G@OQ")
+("04654" "")
+("04656" "")
+("04660" "")
+("04661" "׻")
+("04664" "")
+("04670" "")
+("04681" "")
+("04686" "Ūg")
+("04689" "")
+("04690" "")
+("04694" "ѿ")
+("04698" "")
+("04727" "")
+("04827" "")
+("04927" "")
+("05104" "")
+("05127" "t")
+("05196" "")
+("05331" "")
+("05417" "E")
+("05496" "")
+("05617" "")
+("05627" "")
+("05630" "Z")
+("05632" "")
+("05633" "")
+("05637" "")
+("05644" "")
+("05657" "")
+("05661" "")
+("05686" "")
+("05690" "L")
+("05694" "")
+("05696" "")
+("06127" "")
+("06240" "")
+("06446" "")
+("06456" "")
+("06610" "T")
+("06614" "A")
+("06627" "ֿ")
+("06630" "")
+("06640" "")
+("06641" "Ķ")
+("06647" "")
+("06656" "A")
+("06660" "W")
+("06681" "~")
+("06686" "")
+("06694" "ķ")
+("06910" "")
+("07104" "")
+("07110" "")
+("07111" "k")
+("07120" "")
+("07127" "")
+("07137" "")
+("07141" "M")
+("07147" "g")
+("07227" "R˧˨Kx")
+("07233" "I")
+("07247" "i")
+("07282" "c")
+("07327" "")
+("07338" "")
+("07420" "")
+("07427" "Lhw")
+("07486" "B")
+("07610" "TA")
+("07611" "O")
+("07612" "")
+("07616" "")
+("07617" "O")
+("07620" "߽HJJ")
+("07622" "")
+("07627" "wN")
+("07631" "L")
+("07632" "{")
+("07637" "")
+("07640" "")
+("07641" "")
+("07647" "]X")
+("07654" "X")
+("07656" "")
+("07661" "ĸ")
+("07662" "@Q")
+("07664" "")
+("07668" "")
+("07672" "")
+("07677" "")
+("07680" "a")
+("07681" "P")
+("07682" "")
+("07720" "c")
+("07727" "Q")
+("07747" "]")
+("07771" "")
+("07820" "{")
+("07882" "")
+("07927" "")
+("08211" "")
+("08212" "I")
+("08213" "}~")
+("08214" "")
+("08217" "")
+("08221" "Y")
+("08227" "Mݾ")
+("08232" "")
+("08233" "")
+("08234" "")
+("08237" "ը")
+("08240" "")
+("08247" "")
+("08266" "J")
+("08269" "")
+("08281" "ۺXO")
+("08291" "")
+("08327" "")
+("08334" "v")
+("08432" "")
+("08440" "Ĵ")
+("08447" "")
+("08504" "")
+("08611" "B")
+("08614" "")
+("08616" "")
+("08617" "W")
+("08621" "")
+("08622" "E")
+("08627" "V")
+("08631" "")
+("08632" "^")
+("08637" "")
+("08640" "\w")
+("08646" "")
+("08651" "")
+("08653" "ĳ")
+("08657" "")
+("08661" "C")
+("08667" "")
+("08686" "")
+("08732" "j")
+("09259" "")
+("09620" "")
+("09627" "")
+("09631" "m")
+("09639" "")
+("09650" "")
+("09689" "")
+("09720" "")
+("10000" "@")
+("10100" "Gu")
+("10101" "Tn")
+("10103" "â")
+("10104" "ܫEɧX")
+("10106" "徵")
+("10107" "Ȫ")
+("10108" "ŨFI")
+("10109" "A")
+("10111" "P")
+("10112" "W")
+("10113" "[H")
+("10114" "")
+("10118" "")
+("10121" "")
+("10123" "D")
+("10127" "")
+("10131" "h")
+("10132" "Ss")
+("10136" "C")
+("10140" "")
+("10146" "")
+("10148" "ҫ")
+("10153" "n")
+("10161" "Lڦ")
+("10164" "S")
+("10167" "")
+("10177" "")
+("10181" "")
+("10196" "~")
+("10200" "B")
+("10201" "H")
+("10207" "")
+("10210" "aJ")
+("10211" "E")
+("10212" "")
+("10213" "w")
+("10214" "Nŵy")
+("10217" "O")
+("10220" "F")
+("10221" "Q")
+("10223" "Ŵ")
+("10227" "ӨBǰݾ]EPܧܨ")
+("10230" "U")
+("10232" "E_x")
+("10240" "")
+("10242" "}")
+("10247" "L~")
+("10248" "o")
+("10261" "")
+("10264" "q")
+("10282" "U")
+("10296" "L")
+("10307" "s")
+("10327" "j")
+("10331" "c")
+("10332" "~")
+("10333" "")
+("10336" "ش")
+("10394" "")
+("10400" "_z")
+("10401" "^")
+("10404" "AnK")
+("10406" "Q")
+("10407" "")
+("10409" "")
+("10410" "^")
+("10414" "ܦ")
+("10427" "z")
+("10430" "")
+("10432" "R")
+("10439" "ʱ")
+("10440" "")
+("10441" "¿")
+("10447" "Ae")
+("10482" "")
+("10503" "")
+("10506" "")
+("10507" "`")
+("10527" "Q")
+("10530" "")
+("10600" "ۦʦ註")
+("10601" "^")
+("10602" "{")
+("10603" "p")
+("10609" "_")
+("10613" "")
+("10614" "Pa")
+("10617" "Q")
+("10618" "")
+("10620" "i")
+("10621" "")
+("10627" "SGN")
+("10631" "G")
+("10632" "C")
+("10636" "")
+("10641" "RY")
+("10647" "J")
+("10648" "HK")
+("10661" "U[")
+("10662" "")
+("10667" "")
+("10669" "")
+("10686" "q")
+("10694" "")
+("10712" "r")
+("10716" "q")
+("10717" "")
+("10727" "M")
+("10731" "ᶳ")
+("10772" "")
+("10774" "")
+("10777" "h")
+("10801" "|")
+("10806" "^v")
+("10900" "")
+("10901" "ܲ")
+("10904" "ߵ")
+("10922" "~")
+("10963" "")
+("10994" "M")
+("11101" "")
+("11107" "")
+("11110" "_lhPү")
+("11111" "DnBڪ")
+("11114" "ZU")
+("11116" "æ")
+("11117" "[oRX")
+("11120" "E")
+("11121" "Ҳ")
+("11127" "A")
+("11131" "l")
+("11132" "Z")
+("11136" "")
+("11140" "higҭ")
+("11149" "")
+("11160" "")
+("11161" "l޺")
+("11163" "{")
+("11186" "zVY")
+("11194" "")
+("11207" "^")
+("11211" "Ry")
+("11213" "")
+("11216" "XL")
+("11217" "")
+("11223" "")
+("11227" "IB")
+("11232" "iR")
+("11240" "")
+("11286" "wxQ")
+("11296" "")
+("11331" "d")
+("11400" "")
+("11406" "i")
+("11417" "")
+("11420" "ͪ")
+("11427" "F")
+("11431" "")
+("11440" "E")
+("11441" "")
+("11486" "ܬܬ[")
+("11500" "")
+("11502" "w")
+("11506" "")
+("11601" "٩")
+("11610" "{|")
+("11611" "q")
+("11612" "{")
+("11613" "")
+("11614" "")
+("11616" "XP")
+("11617" "~")
+("11620" "")
+("11627" "Xr}]")
+("11632" "")
+("11640" "z")
+("11646" "w^")
+("11649" "y")
+("11660" "zִڷ_")
+("11662" "W")
+("11681" "")
+("11686" "Y")
+("11691" "O")
+("11694" "")
+("11711" "\")
+("11717" "]")
+("11732" "pK")
+("11786" "F")
+("11801" "")
+("11809" "{X")
+("11904" "")
+("11986" "N")
+("12100" "|k")
+("12104" "")
+("12108" "n")
+("12110" "s")
+("12113" "Ұ")
+("12114" "A")
+("12127" "qv޷")
+("12134" "\")
+("12141" "p")
+("12147" "y޶")
+("12153" "Y")
+("12157" "ڥ")
+("12163" "")
+("12164" "")
+("12169" "d")
+("12172" "p")
+("12194" "t")
+("12200" "ަCɽA")
+("12214" "")
+("12217" "")
+("12222" "S")
+("12230" "D")
+("12232" "")
+("12234" "")
+("12240" "s")
+("12247" "oq")
+("12264" "")
+("12277" "")
+("12327" "")
+("12330" "P")
+("12333" "")
+("12336" "q")
+("12400" "ZD")
+("12401" "ʩ")
+("12404" "u")
+("12407" "")
+("12410" "")
+("12413" "")
+("12414" "")
+("12422" "")
+("12427" "M")
+("12430" "t")
+("12493" "]")
+("12600" "ƲS")
+("12603" "ʦ")
+("12614" "~")
+("12617" "")
+("12618" "E")
+("12621" "H")
+("12627" "u")
+("12630" "")
+("12631" "H")
+("12634" "_")
+("12635" "")
+("12637" "")
+("12640" "")
+("12643" "t")
+("12646" "")
+("12647" "")
+("12653" "F")
+("12657" "")
+("12669" "")
+("12670" "")
+("12686" "~")
+("12689" "")
+("12694" "pt")
+("12732" "")
+("12747" "W")
+("12900" "")
+("12922" "")
+("12930" "]")
+("13100" "")
+("13112" "{")
+("13116" "ޱ")
+("13121" "")
+("13132" "wy")
+("13134" "")
+("13140" "Z")
+("13150" "¾xVv޲")
+("13153" "~")
+("13160" "")
+("13168" "")
+("13177" "_")
+("13186" "@")
+("13191" "z")
+("13214" "")
+("13232" "޸")
+("13236" "j")
+("13250" "W")
+("13253" "")
+("13260" "p")
+("13282" "")
+("13286" "l")
+("13291" "")
+("13410" "")
+("13450" "t")
+("13491" "")
+("13601" "")
+("13611" "Q]")
+("13612" "J")
+("13617" "")
+("13622" "")
+("13627" "r")
+("13634" "_")
+("13640" "")
+("13647" "")
+("13650" "")
+("13653" "\")
+("13661" "")
+("13681" "")
+("13686" "")
+("13760" "")
+("14111" "ҹ")
+("14112" "")
+("14114" "^@")
+("14117" "G")
+("14121" "a")
+("14127" "\lҵw")
+("14131" "Wť")
+("14132" "g")
+("14134" "")
+("14141" "")
+("14147" "aҶC")
+("14156" "޳")
+("14161" "G")
+("14170" "")
+("14181" "XҬ")
+("14186" "X")
+("14190" "Y")
+("14194" "")
+("14200" "@")
+("14212" "")
+("14214" "")
+("14216" "")
+("14218" "E")
+("14227" "Q")
+("14240" "r")
+("14247" "")
+("14260" "")
+("14261" "")
+("14286" "vZF")
+("14288" "")
+("14420" "D")
+("14600" "@")
+("14610" "")
+("14611" "")
+("14612" "A")
+("14614" "Tֺ")
+("14617" "WWM")
+("14621" "")
+("14627" "o")
+("14631" "|I")
+("14632" "")
+("14634" "")
+("14635" "")
+("14638" "")
+("14640" "")
+("14642" "")
+("14647" "}")
+("14653" "z")
+("14660" "^")
+("14661" "žLֳ")
+("14670" "o")
+("14681" "¦")
+("14686" "D")
+("14690" "_")
+("14691" "}")
+("14694" "")
+("14740" "")
+("14904" "U")
+("15100" "f")
+("15106" "e")
+("15107" "Ҵ")
+("15117" "E")
+("15127" "u")
+("15130" "i")
+("15143" "")
+("15153" "}")
+("15157" "")
+("15181" "ک")
+("15190" "]")
+("15194" "")
+("15207" "Y")
+("15213" "k")
+("15230" "o")
+("15232" "")
+("15236" "")
+("15281" "")
+("15290" "")
+("15400" "")
+("15417" "")
+("15447" "C")
+("15501" "d")
+("15600" "")
+("15606" "~")
+("15607" "ֵ")
+("15617" "")
+("15618" "Ŀ")
+("15627" "")
+("15630" "")
+("15632" "")
+("15643" "j")
+("15657" "R")
+("15681" "K")
+("15686" "l")
+("15690" "")
+("15694" "")
+("15733" "")
+("16100" "Ҹ")
+("16104" "t")
+("16110" "{D")
+("16111" "b")
+("16113" "")
+("16114" "zm")
+("16115" "޼")
+("16127" "n޴")
+("16130" "o")
+("16132" "޾")
+("16140" "")
+("16141" "ڧ")
+("16144" "")
+("16150" "")
+("16160" "ڨv")
+("16180" "t")
+("16181" "u")
+("16194" "j")
+("16196" "[")
+("16217" "g")
+("16232" "t")
+("16234" "h")
+("16247" "")
+("16254" "")
+("16256" "u")
+("16286" "f")
+("16300" "j")
+("16600" "")
+("16601" "")
+("16610" "xS")
+("16613" "")
+("16614" "s")
+("16617" "")
+("16627" "")
+("16632" "")
+("16640" "O")
+("16641" "")
+("16646" "")
+("16648" "o")
+("16660" "{")
+("16681" "")
+("16693" "")
+("16713" "")
+("16810" "C")
+("17103" "")
+("17104" "o")
+("17105" "")
+("17107" "s")
+("17108" "")
+("17109" "")
+("17110" "\")
+("17112" "")
+("17113" "")
+("17118" "f")
+("17120" "NNЪjұҷڤ")
+("17122" "")
+("17127" "CzxHMTлRc")
+("17132" "ڣ޵")
+("17134" "޽")
+("17135" "k")
+("17136" "DJۼi")
+("17140" "lҺڢ")
+("17146" "g")
+("17147" "ã")
+("17148" "F")
+("17156" "")
+("17162" "")
+("17164" "_ڡi")
+("17167" "s޻")
+("17172" "")
+("17180" "h")
+("17181" "B")
+("17182" "")
+("17194" "`")
+("17202" "")
+("17207" "F}")
+("17210" "e")
+("17212" "")
+("17214" "C")
+("17217" "")
+("17220" "MM")
+("17222" "E")
+("17227" "DiE]~dŰZ˫oXjm{Af^_")
+("17232" "ӻEɡV")
+("17247" "Ϊ\")
+("17262" "p")
+("17327" "k")
+("17331" "Үm")
+("17332" "Աv")
+("17334" "^")
+("17336" "O")
+("17346" "M")
+("17400" "Sen")
+("17404" "|")
+("17407" "lm")
+("17408" "A")
+("17412" "U")
+("17413" "")
+("17420" "b")
+("17427" "iRSUd")
+("17438" "p")
+("17440" "")
+("17441" "")
+("17442" "")
+("17447" "")
+("17461" "")
+("17482" "")
+("17502" "")
+("17506" "d~")
+("17507" "")
+("17510" "P")
+("17527" "ݨ")
+("17602" "l")
+("17607" "g")
+("17610" "R")
+("17612" "ַ")
+("17617" "t")
+("17620" "quMNsֻa`")
+("17622" "R")
+("17627" "pz")
+("17632" "LVֶ^")
+("17640" "")
+("17647" "͡]")
+("17650" "")
+("17660" "U")
+("17664" "Tָ")
+("17681" "ê")
+("17682" "q")
+("17686" "y")
+("17694" "")
+("17710" "A")
+("17714" "A")
+("17717" "vwί")
+("17727" "U")
+("17801" "lr")
+("17902" "")
+("17904" "X")
+("17910" "")
+("17920" "")
+("17927" "")
+("18104" "ب")
+("18109" "")
+("18111" "")
+("18120" "k")
+("18121" "޹")
+("18122" "")
+("18127" "jhk")
+("18133" "g")
+("18136" "")
+("18137" "²")
+("18140" "𪴬FPmmu")
+("18150" "ҳ")
+("18161" "һ")
+("18162" "r")
+("18166" "en")
+("18167" "")
+("18181" "o")
+("18222" "f")
+("18227" "ȼd")
+("18240" "")
+("18281" "")
+("18286" "")
+("18327" "E")
+("18334" "ww")
+("18404" "ظ")
+("18440" "t")
+("18604" "")
+("18610" "")
+("18611" "R`")
+("18612" "I")
+("18617" "}")
+("18620" "")
+("18627" "")
+("18632" "")
+("18637" "")
+("18640" "Z")
+("18651" "s")
+("18653" "\")
+("18666" "")
+("18694" "")
+("18727" "R")
+("18732" "K")
+("18740" "")
+("18904" "")
+("19111" "Ү")
+("19159" "Z")
+("19166" "h")
+("19180" "")
+("19186" "")
+("19189" "|")
+("19227" "z")
+("19616" "")
+("19620" "")
+("19627" "v")
+("19639" "")
+("19659" "C")
+("19666" "]")
+("19693" "")
+("19732" "u")
+("20027" "")
+("20101" "")
+("20104" "Ы")
+("20111" "")
+("20114" "")
+("20127" "u")
+("20132" "")
+("20136" "Q")
+("20202" "L")
+("20211" "")
+("20212" "^")
+("20214" "APA")
+("20216" "V")
+("20217" "r")
+("20218" "")
+("20221" "")
+("20222" "ˤ")
+("20223" "")
+("20227" "ϨqĳķKm")
+("20231" "")
+("20232" "̰fH")
+("20236" "")
+("20240" "")
+("20241" "")
+("20246" "ܴ")
+("20247" "R")
+("20248" "˳")
+("20252" "")
+("20261" "H`")
+("20282" "˴")
+("20296" "")
+("20307" "F")
+("20314" "")
+("20316" "")
+("20317" "")
+("20327" "")
+("20331" "J")
+("20333" "")
+("20339" "x")
+("20341" "")
+("20344" "")
+("20346" "")
+("20347" "")
+("20348" "B")
+("20396" "H")
+("20400" "d")
+("20401" "G")
+("20404" "e")
+("20407" "u")
+("20409" "G")
+("20414" "")
+("20417" "")
+("20423" "")
+("20427" "")
+("20430" "ԮO")
+("20432" "")
+("20447" "")
+("20500" "")
+("20501" "l")
+("20507" "")
+("20514" "Y")
+("20527" "")
+("20531" "n")
+("20547" "i")
+("20552" "S")
+("20601" "")
+("20603" "]")
+("20604" "ެ")
+("20609" "f")
+("20614" "o")
+("20627" "")
+("20631" "p")
+("20648" "")
+("20714" "Gu")
+("20715" "")
+("20716" "")
+("20721" "")
+("20722" "")
+("20727" "")
+("20731" "h")
+("20732" "\")
+("20746" "")
+("20747" "")
+("20767" "N")
+("20777" "")
+("20782" "y")
+("20901" "")
+("20903" "t")
+("20904" "ݪ")
+("20907" "")
+("20909" "")
+("20913" "")
+("20914" "X")
+("20916" "")
+("20923" "")
+("20927" "Zl")
+("20931" "")
+("20932" "")
+("20935" "")
+("20936" "")
+("20940" "")
+("20943" "")
+("20947" "b")
+("20948" "c")
+("20953" "d")
+("20982" "")
+("20986" "")
+("20996" "x")
+("21047" "")
+("21086" "")
+("21100" "W")
+("21101" "")
+("21103" "l")
+("21104" "ʯ")
+("21106" "[")
+("21109" "")
+("21110" "")
+("21111" "")
+("21117" "")
+("21136" "n")
+("21140" "")
+("21160" "H")
+("21186" "")
+("21190" "")
+("21209" "B")
+("21210" "fg˽")
+("21211" "h֮|re^@")
+("21212" "Rܹ")
+("21214" "O˻")
+("21216" "ܺ")
+("21217" "c\_Zf")
+("21219" "`")
+("21220" "")
+("21221" "Ы")
+("21227" "֭ǸþSXIIܵCr")
+("21231" "dɴa{")
+("21232" "WI")
+("21236" "{")
+("21240" "@M˹")
+("21241" "B")
+("21244" "P")
+("21246" "K")
+("21247" "u")
+("21249" "[|")
+("21253" "")
+("21260" "հξ")
+("21261" "")
+("21266" "M")
+("21269" "")
+("21277" "X")
+("21281" "p")
+("21286" "ɻWZF`s")
+("21290" "ɸ")
+("21291" "ܸ")
+("21294" "[")
+("21299" "")
+("21310" "")
+("21311" "")
+("21314" "j")
+("21317" "t~\")
+("21319" "w")
+("21320" "}")
+("21327" "ly")
+("21331" "Ah")
+("21332" "^")
+("21333" "")
+("21336" "r")
+("21344" "")
+("21346" "")
+("21347" "")
+("21361" "k")
+("21374" "")
+("21382" "")
+("21391" "")
+("21394" "m")
+("21404" "Y")
+("21406" "I")
+("21407" "O")
+("21410" "ii")
+("21417" "F")
+("21420" "S")
+("21427" "")
+("21447" "")
+("21486" "ZG")
+("21510" "")
+("21511" "^")
+("21527" "r")
+("21550" "")
+("21561" "\")
+("21600" "er")
+("21601" "ҸŸIְֹY")
+("21608" "")
+("21610" "֦")
+("21611" "W")
+("21617" "ҿH")
+("21647" "")
+("21710" "h")
+("21711" "")
+("21714" "{")
+("21716" "zB")
+("21717" "]C")
+("21719" "_")
+("21727" "vΩ")
+("21732" "ױ")
+("21740" "")
+("21746" "»")
+("21761" "m")
+("21771" "")
+("21772" "")
+("21786" "")
+("21801" "uc")
+("21806" "sE")
+("21886" "Ab")
+("21901" "")
+("21903" "")
+("21904" "N")
+("21909" "K")
+("21910" "")
+("21911" "gnr")
+("21912" "")
+("21913" "")
+("21914" "E")
+("21917" "B")
+("21919" "")
+("21920" "ͩ")
+("21921" "")
+("21927" "y")
+("21931" "")
+("21934" "")
+("21940" "")
+("21943" "")
+("21946" "X")
+("21947" "")
+("21949" "")
+("21953" "©")
+("21960" "q")
+("21961" "")
+("21966" "D")
+("21981" "")
+("21986" "o")
+("21990" "R")
+("21991" "e")
+("21996" "")
+("22000" "t")
+("22010" "IN")
+("22027" "")
+("22100" "")
+("22104" "΢")
+("22108" "Zl")
+("22109" "qC")
+("22127" "ܽ")
+("22136" "EZEF")
+("22147" "")
+("22153" "i")
+("22163" "N")
+("22182" "k")
+("22187" "r")
+("22200" "FҨW˰@b˶Яk")
+("22202" "")
+("22207" "s")
+("22210" "")
+("22211" "")
+("22212" "C")
+("22213" "R")
+("22214" "VZ[\")
+("22216" "")
+("22217" "P")
+("22221" "ɻ")
+("22222" "W")
+("22227" "BY[^Cv~YegrsCL")
+("22228" "")
+("22230" "")
+("22234" "]c")
+("22236" "")
+("22239" "ܾ")
+("22240" "aCw")
+("22241" "")
+("22243" "")
+("22244" "")
+("22247" "īRW")
+("22248" "")
+("22253" "QX")
+("22257" "")
+("22264" "`")
+("22269" "")
+("22270" "P")
+("22282" "k")
+("22286" "")
+("22289" "")
+("22291" "ܿ")
+("22293" "Y")
+("22294" "U")
+("22300" "B")
+("22310" "")
+("22313" "o")
+("22314" "")
+("22317" "")
+("22327" "}`")
+("22331" "ѡ")
+("22336" "")
+("22339" "a")
+("22347" "[[")
+("22363" "")
+("22369" "]")
+("22386" "")
+("22393" "X")
+("22394" "qx")
+("22400" "")
+("22401" "")
+("22404" "B")
+("22407" "pK")
+("22408" "A")
+("22410" "")
+("22413" "")
+("22417" "")
+("22427" "έ")
+("22441" "")
+("22447" "Jj\ߦ")
+("22448" "I")
+("22470" "Q")
+("22481" "")
+("22500" "p")
+("22502" "w|")
+("22504" "p")
+("22514" "")
+("22516" "q")
+("22521" "")
+("22527" "fZ")
+("22540" "")
+("22550" "T")
+("22600" "r")
+("22601" "Τj")
+("22602" "g")
+("22603" "")
+("22604" "Σ")
+("22607" "D")
+("22609" "ů")
+("22610" "G")
+("22614" "")
+("22618" "J")
+("22621" "e")
+("22633" "Q")
+("22640" "")
+("22646" "")
+("22653" "B")
+("22669" "x")
+("22694" "q")
+("22700" "S")
+("22711" "XJ")
+("22712" "Ρ")
+("22714" "")
+("22717" "o")
+("22718" "j")
+("22721" "_")
+("22727" "Tii")
+("22732" "sq")
+("22734" "")
+("22737" "ά")
+("22741" "h")
+("22747" "")
+("22757" "W")
+("22760" "@")
+("22761" "")
+("22764" "")
+("22769" "g")
+("22770" "sBc")
+("22772" "Xr")
+("22782" "O")
+("22791" "O")
+("22793" "")
+("22800" "")
+("22801" "")
+("22806" "")
+("22809" "a")
+("22811" "h")
+("22827" "")
+("22886" "q")
+("22900" "QȳѶJU")
+("22901" "R")
+("22903" "")
+("22904" "e")
+("22906" "l")
+("22910" "K")
+("22913" "~")
+("22914" "ؽxͤQ")
+("22922" "ma")
+("22927" "^t")
+("22930" "p")
+("22931" "")
+("22937" "í")
+("22938" "]")
+("22940" "")
+("22941" "^")
+("22944" "ko")
+("22946" "")
+("22947" "wfG")
+("22953" "")
+("22957" "")
+("22963" "")
+("22969" "º")
+("22970" "")
+("22977" "ҽ_")
+("22993" "")
+("22994" "b")
+("23000" "R")
+("23053" "f")
+("23115" "")
+("23134" "")
+("23200" "~ɳ")
+("23202" "")
+("23210" "")
+("23211" "")
+("23212" "")
+("23214" "ɬ˲")
+("23215" "")
+("23221" "")
+("23227" "")
+("23232" "G")
+("23234" "Sm")
+("23240" "N")
+("23242" "")
+("23244" "")
+("23247" "T")
+("23250" "ϫXN")
+("23253" "Y")
+("23260" "d")
+("23268" "Q")
+("23277" "")
+("23286" "")
+("23290" "Z")
+("23291" "O")
+("23300" "t")
+("23311" "ks")
+("23314" "{")
+("23327" "b")
+("23331" "L")
+("23332" "")
+("23333" "M")
+("23336" "")
+("23347" "")
+("23350" "u")
+("23360" "|")
+("23368" "")
+("23411" "")
+("23427" "K")
+("23430" "o")
+("23440" "")
+("23486" "")
+("23500" "")
+("23504" "Ͻ")
+("23506" "J")
+("23512" "]")
+("23547" "~~")
+("23550" "")
+("23561" "")
+("23600" "x")
+("23603" "c")
+("23611" "p")
+("23650" "ڸ")
+("23711" "S[")
+("23713" "A")
+("23715" "C")
+("23727" "l")
+("23732" "U")
+("23734" "")
+("23744" "Φ")
+("23747" "m")
+("23750" "oήE")
+("23768" "M")
+("23772" "")
+("23782" "\")
+("23806" "U")
+("23809" "ϱ")
+("23900" "")
+("23903" "")
+("23904" "Vc")
+("23911" "d")
+("23912" "w")
+("23914" "Z")
+("23921" "")
+("23922" "h")
+("23927" "sH")
+("23932" "[[")
+("23934" "St")
+("23936" "f")
+("23941" "")
+("23942" "")
+("23944" "")
+("23947" "")
+("23950" "p´k")
+("23960" "")
+("23961" "]Y")
+("23971" "R")
+("23977" "")
+("23981" "")
+("23986" "i}")
+("23991" "")
+("24086" "|")
+("24094" "")
+("24111" "a")
+("24127" "")
+("24141" "")
+("24147" "[")
+("24153" "G")
+("24200" "Ig[")
+("24210" "ƥK")
+("24211" "йN`")
+("24212" "Lj")
+("24214" "ζR")
+("24216" "ȭ")
+("24217" "g")
+("24218" "")
+("24221" "NZ")
+("24227" "GݭoR˺")
+("24231" "]")
+("24234" "")
+("24235" "c")
+("24236" "w")
+("24238" "L")
+("24240" "")
+("24241" "ͫݭƾ__")
+("24247" "ɫt")
+("24256" "")
+("24260" "x")
+("24261" "ɹ˸")
+("24264" "")
+("24266" "ܷ")
+("24281" "Ѯ{Y")
+("24286" "")
+("24290" "Z")
+("24291" "")
+("24294" "O")
+("24296" "")
+("24298" "t")
+("24300" "{")
+("24311" "^")
+("24314" "D")
+("24327" "C")
+("24330" "")
+("24331" "v")
+("24332" "")
+("24337" "")
+("24339" "n")
+("24341" "")
+("24343" "w")
+("24347" "")
+("24360" "~")
+("24361" "_j")
+("24366" "")
+("24370" "")
+("24381" "")
+("24394" "k")
+("24398" "")
+("24400" "")
+("24417" "")
+("24427" "")
+("24430" "N")
+("24431" "Z")
+("24432" "")
+("24440" "T")
+("24447" "rK|")
+("24481" "X")
+("24494" "G")
+("24500" "ި")
+("24510" "d")
+("24512" "ej")
+("24521" "Q")
+("24527" "Bp")
+("24541" "S")
+("24560" "")
+("24561" "_")
+("24586" "}")
+("24601" "i")
+("24616" "V")
+("24627" "WnD")
+("24647" "`")
+("24661" "q")
+("24670" "")
+("24711" "Ψ@f")
+("24713" "")
+("24714" "")
+("24716" "")
+("24717" "")
+("24721" "T")
+("24727" "ӱ\k_")
+("24732" "")
+("24738" "l")
+("24741" "")
+("24744" "")
+("24747" "i")
+("24760" "^")
+("24767" "")
+("24781" "h")
+("24786" "")
+("24798" "")
+("24806" "f")
+("24809" "Y")
+("24900" "LY")
+("24911" "¶")
+("24912" "P")
+("24914" "")
+("24916" "")
+("24917" "")
+("24921" "")
+("24927" "ǵ}]")
+("24931" "")
+("24932" "T")
+("24934" "")
+("24947" "WìZ")
+("24956" "nyI")
+("24960" "")
+("24961" "¨")
+("24970" "")
+("24981" "{")
+("24986" "")
+("24990" "j")
+("24994" "")
+("24996" "·")
+("25000" "")
+("25030" "")
+("25060" "ϻ")
+("25100" "")
+("25110" "")
+("25200" "M")
+("25206" "")
+("25207" "")
+("25217" "ɶ")
+("25219" "y")
+("25227" "򩻭ɵ")
+("25230" "H^bܶ")
+("25232" "˷")
+("25236" "D")
+("25240" "")
+("25243" "")
+("25244" "ܼ")
+("25247" "U")
+("25253" "")
+("25261" "")
+("25263" "b")
+("25281" "")
+("25286" "")
+("25290" "")
+("25293" "W")
+("25294" "")
+("25296" "H")
+("25299" "V")
+("25317" "")
+("25318" "")
+("25327" "JY")
+("25330" "ſ")
+("25343" "")
+("25344" "r")
+("25363" "s")
+("25386" "")
+("25390" "us")
+("25406" "q")
+("25407" "w")
+("25432" "")
+("25444" "")
+("25460" "T")
+("25466" "")
+("25500" "[")
+("25510" "")
+("25527" "Ϻ")
+("25544" "ޥ")
+("25601" "")
+("25681" "j")
+("25706" "")
+("25714" "")
+("25721" "")
+("25730" "b")
+("25732" "Χ`")
+("25744" "")
+("25760" "")
+("25781" "")
+("25794" "P")
+("25796" "")
+("25900" "")
+("25904" "")
+("25906" "")
+("25916" "p")
+("25917" "K")
+("25927" "¸f")
+("25930" "")
+("25932" "ª")
+("25933" "Jn")
+("25937" "")
+("25943" "")
+("25944" "\h")
+("25960" "V")
+("25981" "g")
+("25986" "nZrr@")
+("25990" "")
+("25993" "")
+("25996" "mY")
+("26000" "զۧw")
+("26032" "")
+("26040" "P")
+("26104" "ӳ")
+("26110" "")
+("26127" "c")
+("26200" "Bޭ˿")
+("26207" "f")
+("26210" "Ի")
+("26211" "")
+("26213" "")
+("26214" "Za]")
+("26217" "")
+("26227" "ĲUZ")
+("26230" "T")
+("26232" "uI")
+("26233" "")
+("26234" "")
+("26237" "ɭ")
+("26240" "")
+("26241" "od")
+("26246" "G")
+("26247" "ܻ")
+("26248" "k")
+("26256" "")
+("26260" "Qw")
+("26280" "h")
+("26281" "PV")
+("26293" "")
+("26294" "O")
+("26300" "y")
+("26311" "")
+("26314" "Uv")
+("26322" "")
+("26327" "sm")
+("26330" "")
+("26332" "{")
+("26333" "`")
+("26340" "")
+("26347" "")
+("26350" "x")
+("26360" "I")
+("26381" "l")
+("26394" "")
+("26400" "q")
+("26401" "A")
+("26403" "o")
+("26410" "")
+("26411" "J")
+("26413" "Q")
+("26430" "")
+("26446" "")
+("26450" "U")
+("26460" "H")
+("26501" "")
+("26511" "p")
+("26532" "o")
+("26534" "ާ")
+("26610" "")
+("26613" "z")
+("26617" "")
+("26653" "")
+("26660" "")
+("26700" "j")
+("26710" "s")
+("26711" "mb")
+("26713" "B")
+("26714" "")
+("26727" "")
+("26740" "")
+("26741" "a")
+("26750" "a")
+("26780" "")
+("26781" "")
+("26794" "Q")
+("26801" "d")
+("26809" "s")
+("26880" "S")
+("26900" "MӸi@@")
+("26904" "")
+("26911" "l")
+("26913" "")
+("26914" "{B")
+("26916" "÷")
+("26917" "")
+("26922" "p")
+("26927" "hm")
+("26930" "`")
+("26932" "u")
+("26940" "s")
+("26941" "zrö")
+("26943" "")
+("26944" "")
+("26947" "^gw")
+("26956" "s")
+("26960" "e")
+("26986" "")
+("26993" "]")
+("26994" "\")
+("27027" "")
+("27062" "Ϲ")
+("27100" "")
+("27101" "W")
+("27104" "Qh")
+("27107" "L")
+("27108" "S")
+("27109" "Ek")
+("27110" "")
+("27115" "")
+("27117" "t")
+("27120" "è")
+("27127" "lk")
+("27132" "")
+("27136" "۽ln")
+("27200" "i")
+("27207" "h")
+("27210" "Sɯug")
+("27212" "MSp")
+("27213" "_")
+("27214" "Q")
+("27216" "")
+("27217" "")
+("27220" "ťQfVFm̰\sɺF˾˾ϷPD")
+("27222" "")
+("27227" "׫M]`QɹZ[\oL\j")
+("27231" "")
+("27232" "ܲH͹˼˼tν")
+("27233" "c")
+("27234" "J԰L")
+("27236" "W")
+("27240" "ɷ")
+("27241" "R")
+("27242" "N")
+("27247" "JЫIﰲũ")
+("27252" "")
+("27253" "w")
+("27256" "U")
+("27257" "")
+("27261" "")
+("27262" "I")
+("27264" "и@")
+("27272" "\d")
+("27281" "")
+("27282" "")
+("27286" "^")
+("27290" "A")
+("27292" "A")
+("27294" "")
+("27303" "V")
+("27310" "ܯ")
+("27312" "jt")
+("27314" "")
+("27316" "")
+("27317" "")
+("27320" "cVKnt")
+("27327" "QpQVZk")
+("27331" "")
+("27332" "_")
+("27333" "")
+("27334" "o")
+("27336" "")
+("27337" "ϲ")
+("27339" "z")
+("27340" "")
+("27346" "X")
+("27362" "")
+("27364" "p")
+("27367" "")
+("27372" "")
+("27381" "[")
+("27382" "d")
+("27391" "")
+("27394" "q")
+("27400" "")
+("27404" "S")
+("27407" "")
+("27413" "")
+("27414" "ߤ")
+("27416" "K")
+("27417" "Sr")
+("27420" "Vqͱc")
+("27427" "Q")
+("27430" "")
+("27440" "")
+("27442" "U")
+("27447" "뿴")
+("27449" "U")
+("27450" "^")
+("27454" "Yߧ")
+("27463" "")
+("27481" "")
+("27482" "")
+("27502" "")
+("27504" "ʰ")
+("27520" "`k")
+("27527" "Z")
+("27547" "ަ")
+("27550" "ϼ")
+("27581" "l")
+("27600" "W")
+("27601" "YT")
+("27602" "")
+("27603" "|")
+("27604" "U")
+("27611" "")
+("27620" "yl½бb")
+("27627" "I[но~~s")
+("27640" "")
+("27682" "d")
+("27710" "`")
+("27711" "")
+("27712" "]|")
+("27714" "S")
+("27716" "t`[")
+("27717" "")
+("27720" "ĤۦIWcc}")
+("27722" "")
+("27727" "qmcTi")
+("27732" "\Wix")
+("27740" "")
+("27747" "")
+("27752" "c")
+("27754" "p")
+("27762" "U")
+("27764" "Ϊ")
+("27767" "n")
+("27770" "Υ")
+("27772" "Uj")
+("27781" "")
+("27782" "")
+("27800" "[")
+("27802" "")
+("27806" "t")
+("27809" "b")
+("27827" "f")
+("27901" "m")
+("27903" "")
+("27904" "JnT")
+("27910" "")
+("27911" "")
+("27912" "")
+("27913" "")
+("27914" "")
+("27915" "")
+("27916" "_")
+("27917" "÷")
+("27920" "Yp")
+("27922" "r[V")
+("27927" "jмFq}q")
+("27932" "t")
+("27933" "")
+("27934" "_")
+("27937" "")
+("27940" "i")
+("27947" "źv\")
+("27950" "")
+("27952" "")
+("27954" "")
+("27962" "")
+("27963" "")
+("27964" "")
+("27982" "")
+("27991" "")
+("27994" "")
+("28100" "H")
+("28107" "s")
+("28140" "")
+("28200" "T")
+("28211" "@T")
+("28214" "")
+("28216" "")
+("28217" "h")
+("28220" "ɲ")
+("28221" "ޤ}")
+("28222" "")
+("28227" "ۭ۲ɰv")
+("28232" "ɱ")
+("28237" "DS")
+("28240" "˶ƷLxɮu")
+("28241" "")
+("28246" "")
+("28247" "_")
+("28251" "˫}")
+("28253" "")
+("28255" "|")
+("28257" "V")
+("28261" "a")
+("28264" "")
+("28266" "")
+("28267" "")
+("28268" "U")
+("28270" "i")
+("28281" "q")
+("28286" "")
+("28293" "l")
+("28294" "}")
+("28311" "z")
+("28316" "")
+("28327" "")
+("28332" "")
+("28334" "yٷg")
+("28337" "")
+("28338" "")
+("28340" "a")
+("28346" "W")
+("28347" "n")
+("28351" "A")
+("28353" "z")
+("28361" "u")
+("28364" "")
+("28366" "")
+("28394" "")
+("28401" "q")
+("28411" "V")
+("28412" "")
+("28413" "")
+("28417" "ĥ")
+("28437" "W")
+("28453" "")
+("28460" "")
+("28461" "F")
+("28467" "")
+("28468" "")
+("28494" "ߨ")
+("28514" "ҡ")
+("28540" "")
+("28547" "")
+("28553" "")
+("28601" "")
+("28604" "S")
+("28610" "")
+("28627" "")
+("28637" "")
+("28640" "Q")
+("28641" "֥")
+("28647" "L")
+("28686" "P")
+("28711" "D")
+("28716" "")
+("28717" "zg")
+("28720" "")
+("28721" "")
+("28727" "d")
+("28732" "")
+("28737" "")
+("28740" "")
+("28741" "")
+("28746" "d")
+("28753" "^")
+("28761" "Ϋ")
+("28766" "e")
+("28767" "V")
+("28768" "n")
+("28781" "")
+("28786" "d")
+("28801" "a")
+("28808" "q")
+("28809" "Z")
+("28911" "")
+("28912" "")
+("28914" "")
+("28916" "|l")
+("28917" "~")
+("28920" "X")
+("28921" "")
+("28922" "")
+("28927" "ɺWAW")
+("28932" "Z")
+("28933" "`")
+("28934" "")
+("28937" "")
+("28940" "oúo")
+("28941" "")
+("28946" "m")
+("28947" "")
+("28961" "µ")
+("28964" "q")
+("28966" "¹ø")
+("28968" "b")
+("28981" "a")
+("28994" "")
+("29111" "")
+("29136" "")
+("29211" "")
+("29212" "i")
+("29227" "NձuU")
+("29231" "l")
+("29238" "")
+("29250" "ϸ")
+("29259" "")
+("29262" "f")
+("29266" "")
+("29280" "Z")
+("29286" "v")
+("29289" "")
+("29320" "")
+("29327" "")
+("29338" "T")
+("29359" "")
+("29361" "Z")
+("29380" "")
+("29404" "")
+("29427" "ߥ")
+("29466" "")
+("29502" "y")
+("29512" "h")
+("29689" "")
+("29717" "")
+("29718" "")
+("29727" "kc")
+("29759" "b")
+("29766" "D")
+("29789" "VV")
+("29794" "")
+("29911" "")
+("29912" "e")
+("29919" "~")
+("29920" "zK")
+("29927" "y`")
+("29933" "")
+("29950" "")
+("29959" "v")
+("29980" "")
+("29989" "d")
+("30101" "")
+("30104" "ǲ")
+("30106" "")
+("30107" "y")
+("30109" "")
+("30110" "")
+("30111" "u")
+("30112" "N")
+("30113" "w")
+("30114" "`aڼyA")
+("30115" "s")
+("30116" "G")
+("30117" "Ys")
+("30118" "_")
+("30121" "")
+("30123" "")
+("30124" "")
+("30127" "vwKRME")
+("30130" "X")
+("30131" "N")
+("30132" "uDtf[")
+("30136" "e")
+("30137" "")
+("30140" "Z")
+("30141" "")
+("30146" "s")
+("30147" "EGH")
+("30148" "fm")
+("30153" "C")
+("30161" "e")
+("30163" "G")
+("30167" "F")
+("30177" "")
+("30181" "")
+("30186" "")
+("30191" "")
+("30194" "O")
+("30196" "D")
+("30201" "r")
+("30202" "")
+("30207" "ͥ")
+("30211" "vd")
+("30212" "{")
+("30213" "")
+("30214" "FK")
+("30216" "e")
+("30221" "L")
+("30227" "Ъӫɫd۽aڬ]zq")
+("30232" "îafšѰ״J")
+("30234" "")
+("30241" "")
+("30247" "̲")
+("30248" "¬")
+("30253" "h")
+("30261" "J")
+("30272" "]")
+("30277" "")
+("30289" "Q")
+("30294" "")
+("30295" "K")
+("30301" "i")
+("30302" "A")
+("30303" "HB")
+("30304" "R")
+("30306" "o")
+("30307" "")
+("30327" "g")
+("30331" "`")
+("30332" "W")
+("30336" "")
+("30339" "")
+("30342" "u")
+("30401" "t_ͦ")
+("30404" "wb~")
+("30407" "r")
+("30408" "B")
+("30417" "ss")
+("30427" "J")
+("30430" "")
+("30432" "ʼ@K")
+("30447" "")
+("30481" "")
+("30502" "cS")
+("30516" "s")
+("30558" "")
+("30601" "`XJ")
+("30602" "z")
+("30604" "")
+("30606" "cI")
+("30607" "~g")
+("30608" "e")
+("30609" "f")
+("30621" "H")
+("30711" "")
+("30712" "")
+("30714" "vʽ")
+("30715" "")
+("30717" "_«Hf")
+("30727" "")
+("30732" "}r")
+("30773" "K")
+("30777" "xD")
+("30801" "wI")
+("30802" "")
+("30806" "G껫_uu")
+("30901" "v")
+("30904" "׸^^")
+("30906" "d")
+("30927" "")
+("30947" "I")
+("30948" "")
+("30982" "")
+("31107" "֧")
+("31110" "]T]uC")
+("31111" "Jwxo]")
+("31114" "LP@ϣhAR_")
+("31116" "xx")
+("31117" "[yɼHI")
+("31118" "M")
+("31120" "Ūe")
+("31121" "O")
+("31127" "è\jϥNbizQ")
+("31129" "A")
+("31131" "NX")
+("31132" "g")
+("31134" "")
+("31136" "o")
+("31137" "")
+("31140" "|LT")
+("31141" "")
+("31143" "P")
+("31146" "N")
+("31147" "Z")
+("31149" "")
+("31150" "")
+("31153" "")
+("31160" "gsBKs")
+("31161" "Oa")
+("31162" "f")
+("31166" "")
+("31168" "")
+("31172" "[")
+("31181" "")
+("31186" "Huxd")
+("31191" "}")
+("31194" "")
+("31196" "")
+("31210" "")
+("31211" "qRH")
+("31212" "s")
+("31214" "")
+("31218" "")
+("31227" "")
+("31232" "")
+("31240" "Ь")
+("31243" "")
+("31246" "")
+("31260" "")
+("31266" "")
+("31281" "w")
+("31286" "վfUH")
+("31301" "rwE")
+("31302" "")
+("31303" "vQ")
+("31304" "NN")
+("31306" "iGж")
+("31308" "")
+("31309" "")
+("31332" "")
+("31336" "")
+("31391" "t")
+("31486" "")
+("31686" "B")
+("31886" "E")
+("31904" "")
+("32000" "{")
+("32022" "h")
+("32100" "w{RWs@Y")
+("32104" "P")
+("32109" "t")
+("32110" "W")
+("32112" "ϭ")
+("32113" "")
+("32114" "]F")
+("32116" "")
+("32118" "")
+("32119" "U")
+("32121" "^X@B")
+("32122" "")
+("32123" "a")
+("32127" "KWX")
+("32130" "Bl@")
+("32132" "")
+("32133" "K")
+("32134" "U")
+("32136" "V")
+("32137" "x|V")
+("32140" "|Y")
+("32141" "CA")
+("32144" "g")
+("32146" "a")
+("32147" "BEO")
+("32157" "b")
+("32160" "d")
+("32161" "Ϭ")
+("32163" "")
+("32164" "")
+("32169" "")
+("32170" "")
+("32177" "M")
+("32189" "E")
+("32191" "h")
+("32194" "eE")
+("32200" "B")
+("32213" "ֽ")
+("32214" "M")
+("32217" "")
+("32221" "")
+("32222" "m")
+("32227" "ܰ")
+("32234" "")
+("32240" "鯭N׾")
+("32247" "C")
+("32253" "")
+("32300" "")
+("32301" "k}")
+("32302" "uz")
+("32303" "")
+("32304" "j")
+("32306" "mP")
+("32307" "˦")
+("32309" "")
+("32413" "")
+("32600" "")
+("32700" "")
+("32904" "_~")
+("32947" "")
+("33000" "ߥ")
+("33100" "Gc")
+("33111" "bVF")
+("33112" "")
+("33114" "Onp")
+("33116" "")
+("33117" "")
+("33121" "F")
+("33122" "")
+("33127" "m")
+("33132" "aGC")
+("33134" "\Q{]`")
+("33136" "e")
+("33141" "")
+("33142" "")
+("33143" "L")
+("33144" "}")
+("33147" "Cko")
+("33150" "Ϩibg")
+("33152" "H")
+("33153" "Lq")
+("33160" "Mv")
+("33168" "")
+("33169" "n")
+("33173" "m")
+("33181" "")
+("33186" "t")
+("33187" "")
+("33191" "F")
+("33194" "_")
+("33200" "o")
+("33211" "ײ")
+("33222" "xx")
+("33227" "")
+("33234" "")
+("33244" "׷")
+("33247" "")
+("33250" "")
+("33268" "y")
+("33282" "׳")
+("33300" "k")
+("33302" "M")
+("33303" "")
+("33304" "")
+("33306" "")
+("33307" "M")
+("33309" "z")
+("33330" "")
+("33850" "")
+("33903" "u")
+("33904" "d")
+("34000" "")
+("34027" "")
+("34100" "Ĺ@U")
+("34109" "")
+("34110" "")
+("34111" "~C")
+("34112" "H")
+("34113" "y")
+("34114" "q`")
+("34116" "T")
+("34117" "nɣT")
+("34121" "")
+("34122" "")
+("34127" "c񺡺tɤUOrϢWBB")
+("34130" "OR")
+("34131" "ka")
+("34132" "_Ca")
+("34134" "z~")
+("34135" "V")
+("34138" "H")
+("34140" "")
+("34141" "c")
+("34143" "")
+("34144" "")
+("34147" "i[tJQ")
+("34153" "")
+("34154" "]")
+("34156" "")
+("34160" "fZU")
+("34161" "EϡP")
+("34164" "")
+("34170" "")
+("34181" "xN")
+("34186" "pC")
+("34189" "Ϥ")
+("34190" "NO")
+("34191" "")
+("34193" "M")
+("34194" "Y")
+("34196" "")
+("34198" "")
+("34200" "")
+("34210" "")
+("34211" "")
+("34212" "͢Э")
+("34216" "")
+("34227" "I")
+("34231" "׶J")
+("34236" "K")
+("34238" "")
+("34241" "ë")
+("34247" "QA")
+("34252" "K")
+("34253" "")
+("34256" "")
+("34260" "")
+("34261" "")
+("34264" "u")
+("34265" "H")
+("34281" "R")
+("34286" "I")
+("34291" "")
+("34294" "")
+("34301" "fO")
+("34302" "P")
+("34303" "")
+("34304" "FH")
+("34306" "y")
+("34307" "г")
+("34309" "")
+("34330" "")
+("34332" "V")
+("34404" "C")
+("34547" "")
+("34601" "")
+("34904" "Vm")
+("35100" "M")
+("35104" "س")
+("35106" "RE")
+("35107" "z")
+("35110" "N")
+("35116" "E")
+("35117" "ŨPS")
+("35118" "C")
+("35127" "KmMcFh")
+("35130" "MtI")
+("35132" "@p^")
+("35133" "Y")
+("35134" "")
+("35136" "g")
+("35138" "b")
+("35143" "w")
+("35144" "YQ~")
+("35147" "")
+("35160" "oϦ")
+("35161" "F")
+("35163" "P")
+("35166" "")
+("35181" "")
+("35186" "{")
+("35190" "jzx")
+("35194" "Lf")
+("35196" "P")
+("35200" "")
+("35206" "")
+("35218" "§")
+("35230" "׺r")
+("35232" "")
+("35237" "L")
+("35244" "")
+("35256" "")
+("35257" "׹")
+("35260" "S")
+("35290" "־")
+("35292" "")
+("35300" "s")
+("35301" "")
+("35303" "e")
+("35305" "")
+("35306" "}D")
+("35307" "")
+("35308" "")
+("35309" "t")
+("35332" "")
+("36010" "")
+("36100" "QrsyUSJvwϧeT\")
+("36103" "f")
+("36104" "")
+("36107" "")
+("36110" "pb\")
+("36111" "VS")
+("36112" "L")
+("36113" "Z")
+("36114" "@IGVT")
+("36116" "")
+("36117" "J")
+("36121" "`")
+("36127" "BB")
+("36131" "H")
+("36132" "JrD")
+("36133" "")
+("36134" "d@")
+("36141" "AS")
+("36143" "\")
+("36144" "_")
+("36146" "IW")
+("36147" "")
+("36154" "}")
+("36160" "@`")
+("36180" "S")
+("36181" "UA[")
+("36182" "")
+("36186" "el")
+("36193" "")
+("36194" "")
+("36196" "Z")
+("36200" "")
+("36202" "׽")
+("36210" "RŨ")
+("36211" "")
+("36214" "")
+("36217" "p")
+("36227" "|")
+("36230" "@")
+("36232" "J")
+("36236" "u")
+("36240" "t")
+("36241" "")
+("36246" "")
+("36256" "I")
+("36260" "")
+("36281" "")
+("36294" "r")
+("36300" "{j")
+("36301" "xN")
+("36302" "JK~")
+("36303" "")
+("36304" "")
+("36809" "S")
+("37027" "")
+("37104" "")
+("37107" "s")
+("37109" "w")
+("37110" "ĦƨIqϩI")
+("37111" "dc")
+("37112" "ƪwϪ")
+("37113" "d")
+("37114" "L")
+("37116" "Z")
+("37117" "IF")
+("37120" "}}^򷹼iPWGfDEHG^i")
+("37122" "{")
+("37127" "Fķƺ|ErD")
+("37132" "GM")
+("37134" "AD")
+("37136" "R")
+("37140" "Q|")
+("37146" "")
+("37147" "SV{YX`")
+("37148" "Z")
+("37152" "")
+("37154" "z")
+("37156" "")
+("37157" "ϫ")
+("3716" "")
+("37161" "F]")
+("37162" "hy")
+("37164" "C")
+("37167" "DK")
+("37172" "")
+("37177" "")
+("37180" "H")
+("37181" "^")
+("37182" "")
+("37186" "")
+("37191" "")
+("37193" "")
+("37194" "`D")
+("37210" "")
+("37212" "Tֿ")
+("37214" "a")
+("37217" "")
+("37220" "쯨vּͣ׼")
+("37227" "º׾r]")
+("37232" "SB")
+("37233" "")
+("37234" "")
+("37240" "Ю")
+("37246" "")
+("37247" "@")
+("37250" "A")
+("37254" "")
+("37256" "")
+("37261" "")
+("37262" "׸")
+("37264" "")
+("37267" "")
+("37294" "{")
+("37300" "˥")
+("37301" "hд")
+("37302" "~qgL")
+("37303" "hO")
+("37304" "{BI")
+("37305" "")
+("37306" "|")
+("37307" "l")
+("37308" "")
+("37327" "}")
+("37331" "")
+("37338" "")
+("37401" "u")
+("37404" "")
+("37413" "")
+("37427" "vw")
+("37506" "x")
+("37527" "y")
+("37608" "t")
+("37627" "")
+("37717" "")
+("37720" "")
+("37727" "")
+("37732" "")
+("37782" "")
+("37800" "")
+("37806" "")
+("37827" "")
+("37904" "")
+("37927" "")
+("38100" "ɢ")
+("38104" "")
+("38112" "OK")
+("38116" "X")
+("38117" "TKgy")
+("38118" "")
+("38119" "hX")
+("38121" "")
+("38122" "B")
+("38127" "NW_v[jRe")
+("38131" "JK")
+("38132" "Sy")
+("38133" "J[")
+("38134" "~")
+("38135" "")
+("38137" "~I")
+("38140" "Ek\[WqvAJTR")
+("38141" "n")
+("38146" "J")
+("38147" "Q")
+("38151" "v")
+("38157" "_")
+("38160" "u")
+("38161" "V")
+("38164" "G")
+("38166" "W")
+("38167" "a")
+("38168" "D")
+("38181" "x")
+("38186" "F")
+("38193" "c")
+("38194" "\Q")
+("38211" "")
+("38212" "׻")
+("38216" "")
+("38217" "İ")
+("38221" "")
+("38222" "׿")
+("38227" "")
+("38231" "")
+("38232" "")
+("38233" "^")
+("38247" "")
+("38251" "")
+("38261" "")
+("38266" "_")
+("38268" "")
+("38286" "")
+("38290" "@")
+("38301" "е")
+("38302" "O")
+("38303" "eE")
+("38304" "fCCS")
+("38305" "n")
+("38306" "D}")
+("38309" "~")
+("38320" "")
+("38340" "v")
+("38343" "")
+("38507" "F")
+("38604" "")
+("38668" "")
+("38903" "v")
+("39111" "")
+("39113" "")
+("39114" "")
+("39120" "F")
+("39127" "IL")
+("39132" "P")
+("39150" "d")
+("39151" "")
+("39162" "")
+("39166" "@]")
+("39180" "G")
+("39181" "\")
+("39189" "H")
+("39193" "U^")
+("39212" "")
+("39250" "׵")
+("39266" "")
+("39289" "")
+("39302" "p")
+("39305" "")
+("39308" "|")
+("39309" "g")
+("39336" "T")
+("39404" "P")
+("39502" "f")
+("39601" "")
+("39732" "")
+("40000" "Q@")
+("40010" "q")
+("40011" "")
+("40014" "L")
+("40016" "а")
+("40017" "E")
+("40027" "O")
+("40030" "j")
+("40034" "n")
+("40036" "]")
+("40038" "")
+("40047" "")
+("40100" "gh")
+("40104" "cO")
+("40107" "dr")
+("40108" "_")
+("40111" "c")
+("40114" "]Q")
+("40116" "Ҿ")
+("40117" "|")
+("40118" "U")
+("40123" "j")
+("40127" "{Va")
+("40132" "[")
+("40136" "")
+("40141" "S")
+("40146" "`")
+("40147" "Tԭ")
+("40148" "Խ")
+("40161" "~")
+("40167" "")
+("40182" "")
+("40186" "R")
+("40194" "I")
+("40200" "~")
+("40207" "ja")
+("40211" "")
+("40212" "U")
+("40214" "bclw")
+("40216" "J")
+("40217" "f")
+("40222" "")
+("40227" "yקƪԫnNɨD")
+("40232" "m")
+("40240" "")
+("40246" "")
+("40247" "֦s")
+("40248" "`")
+("40261" "Ҥ")
+("40267" "")
+("40281" "x")
+("40286" "n")
+("40300" "o")
+("40331" "Ө}")
+("40334" "v")
+("40336" "Qe")
+("40339" "N")
+("40341" "x")
+("40400" "k")
+("40401" "ddU")
+("40403" "")
+("40407" "䧸B")
+("40414" "D")
+("40416" "Q")
+("40421" "@")
+("40427" "nqqx")
+("40431" "X")
+("40432" "]Ky")
+("40434" "")
+("40437" "wZ")
+("40440" "c")
+("40441" "ʹ")
+("40444" "b")
+("40446" "k")
+("40447" "")
+("40448" "")
+("40461" "^")
+("40496" "")
+("40501" "O")
+("40503" "ߣ")
+("40506" "")
+("40514" "")
+("40518" "")
+("40547" "B")
+("40557" "H")
+("40600" "jk")
+("40601" "N߶޾")
+("40604" "")
+("40609" "H")
+("40621" "_")
+("40641" "")
+("40710" "CP")
+("40716" "a")
+("40717" "")
+("40727" "C")
+("40731" "hM")
+("40732" "K")
+("40801" "u")
+("40803" "M")
+("40806" "N")
+("40814" "")
+("40900" "")
+("40901" "`U")
+("40903" "")
+("40904" "")
+("40908" "")
+("40913" "")
+("40914" "W")
+("40916" "")
+("40917" "C")
+("40918" "X")
+("40921" "")
+("40922" "")
+("40923" "")
+("40927" "D]`")
+("40931" "")
+("40932" "T")
+("40934" "")
+("40936" "")
+("40940" "o")
+("40941" "")
+("40944" "٬")
+("40946" "")
+("40947" "M")
+("40948" "")
+("40961" "٫")
+("40967" "")
+("40982" "")
+("40991" "")
+("40994" "")
+("40996" "")
+("41011" "ʿ")
+("41017" "ӷ")
+("41027" "c")
+("41086" "UNZ")
+("41110" "}")
+("41111" "c")
+("41112" "}")
+("41114" "Sء")
+("41116" "")
+("41117" "Vi")
+("41119" "")
+("41120" "Vn")
+("41127" "d")
+("41132" "K")
+("41134" "أ")
+("41140" "f")
+("41146" "G")
+("41147" "")
+("41149" "W")
+("41160" "")
+("41166" "ت")
+("41181" "")
+("41190" "")
+("41191" "d")
+("41194" "")
+("41214" "gҥ")
+("41216" "")
+("41217" "bګ")
+("41219" "_")
+("41220" "x")
+("41227" "dnn")
+("41232" "b")
+("41240" "bu")
+("41246" "")
+("41247" "")
+("41253" "[")
+("41260" "")
+("41266" "T")
+("41286" "VOOr")
+("41291" "]")
+("41296" "ޫ")
+("41327" "")
+("41410" "")
+("41411" "ʺM[")
+("41414" "")
+("41416" "d|")
+("41417" "VN")
+("41420" "M")
+("41427" "l")
+("41431" "ʳn")
+("41432" "W")
+("41440" "lC")
+("41443" "@")
+("41446" "")
+("41447" "")
+("41449" "q")
+("41460" "ض")
+("41463" "\")
+("41486" "")
+("41491" "")
+("41496" "")
+("41512" "ܪ")
+("41516" "ŷ")
+("41531" "H")
+("41532" "C")
+("41540" "ܩ")
+("41546" "@")
+("41647" "s")
+("41669" "")
+("41686" "e")
+("41804" "")
+("41910" "JB")
+("41911" "ISSU")
+("41912" "")
+("41914" "Pղ")
+("41916" "ټEY")
+("41917" "@ٲV")
+("41918" "^d")
+("41919" "B")
+("41920" "_")
+("41921" "")
+("41923" "ٸ")
+("41927" "`Y")
+("41931" "V")
+("41932" "մ")
+("41940" "")
+("41941" "ձ")
+("41946" "")
+("41947" "OHN")
+("41953" "H")
+("41960" "C[")
+("41961" "﷢]")
+("41962" "D")
+("41963" "")
+("41966" "")
+("41969" "յ")
+("41981" "")
+("41982" "")
+("41986" "b")
+("41989" "")
+("41990" "M")
+("41991" "F")
+("41996" "[")
+("42000" "")
+("42011" "")
+("42012" "ʾ")
+("42013" "C")
+("42027" "Z")
+("42037" "")
+("42100" "`")
+("42110" "Yܲ")
+("42111" "")
+("42113" "U")
+("42114" "ئدg")
+("42118" "")
+("42121" "")
+("42122" "^")
+("42127" "X]")
+("42131" "")
+("42135" "N")
+("42136" "׬")
+("42140" "ʪ")
+("42141" "\Ժ")
+("42147" "N")
+("42149" "M")
+("42157" "")
+("42161" "")
+("42169" "\")
+("42172" "B")
+("42194" "")
+("42200" "Ҫd")
+("42210" "g")
+("42213" "")
+("42214" "g")
+("42216" "y")
+("42217" "y")
+("42221" "Ҧ")
+("42227" "")
+("42230" "}")
+("42231" "e")
+("42234" "{")
+("42241" "g")
+("42247" "w")
+("42257" "u")
+("42269" "n")
+("42277" "[")
+("42293" "ެެc")
+("42300" "k")
+("42332" "I")
+("42400" "d")
+("42411" "")
+("42413" "")
+("42414" "")
+("42421" "ʻ")
+("42427" "bصؾ")
+("42430" "޿")
+("42433" "")
+("42434" "Y")
+("42441" "a")
+("42444" "c")
+("42447" "DT")
+("42461" "l")
+("42464" "Bb")
+("42469" "`")
+("42470" "")
+("42477" "E")
+("42480" "")
+("42494" "Q")
+("42500" "")
+("42508" "h")
+("42521" "")
+("42530" "")
+("42563" "")
+("42577" "")
+("42594" "")
+("42600" "")
+("42602" "")
+("42621" "|")
+("42717" "r")
+("42800" "vd")
+("42801" "f`")
+("42802" "N")
+("42804" "")
+("42806" "a")
+("42807" "")
+("42821" "")
+("42900" "b")
+("42903" "")
+("42910" "")
+("42913" "")
+("42914" "")
+("42917" "S")
+("42918" "N")
+("42921" "R")
+("42922" "l")
+("42927" "պ")
+("42930" "T")
+("42934" "P")
+("42937" "_")
+("42940" "k")
+("42941" "l")
+("42944" "ս")
+("42947" "վK")
+("42950" "")
+("42953" "")
+("42960" "")
+("42964" "")
+("42969" "")
+("42972" "O")
+("42977" "O")
+("42986" "W")
+("42993" "_")
+("42994" "RZ")
+("43000" "|")
+("43010" "")
+("43017" "")
+("43030" "")
+("43040" "ɥ")
+("43046" "")
+("43100" "")
+("43107" "ڹ")
+("43111" "@R")
+("43114" "Q")
+("43122" "^")
+("43127" "H")
+("43130" "Y")
+("43132" "DJ")
+("43134" "J")
+("43144" "P")
+("43150" "جT۴")
+("43168" "")
+("43210" "e")
+("43221" "")
+("43222" "")
+("43227" "hx")
+("43232" "TX")
+("43234" "")
+("43236" "")
+("43242" "")
+("43246" "ު")
+("43247" "mҩҩ")
+("43250" "Im^H")
+("43253" "F")
+("43282" "\")
+("43300" "")
+("43327" "b")
+("43331" "ο")
+("43333" "x")
+("43400" "L")
+("43405" "")
+("43412" "`")
+("43416" "")
+("43421" "")
+("43432" "Q")
+("43434" "]n")
+("43442" "m")
+("43450" "Zue[C")
+("43460" "l")
+("43468" "")
+("43469" "T")
+("43477" "")
+("43481" "")
+("43486" "")
+("43491" "")
+("43511" "")
+("43544" "b")
+("43547" "")
+("43550" "")
+("43650" "vs")
+("43732" "")
+("43750" "`")
+("43800" "uL")
+("43805" "V")
+("43806" "")
+("43850" "")
+("43900" "")
+("43911" "^٪")
+("43916" "")
+("43917" "X")
+("43921" "f")
+("43922" "")
+("43927" "")
+("43932" "հ")
+("43933" "")
+("43934" "y")
+("43940" "I@")
+("43941" "W")
+("43942" "F")
+("43944" "")
+("43947" "Y")
+("43950" "ٵ")
+("43953" "")
+("43964" "")
+("43968" "_")
+("43977" "")
+("43981" "")
+("43982" "W")
+("43985" "")
+("43986" "b")
+("43991" "")
+("43996" "")
+("44000" "{m")
+("44017" "ͼ")
+("44027" "")
+("44043" "{")
+("44100" "")
+("44101" "")
+("44104" "zxӢԱԻkjcK")
+("44106" "{")
+("44107" "\uۦ")
+("44108" "k^bG")
+("44109" "С~")
+("44110" "")
+("44111" "sӥK")
+("44112" "aSYۭ")
+("44113" "")
+("44114" "X")
+("44116" "Բ")
+("44117" "z^ۧZ")
+("44120" "q")
+("44121" "]")
+("44127" "KԻZӡ]wح߼Ze}J")
+("44129" "")
+("44131" "")
+("44132" "a")
+("44133" "")
+("44134" "f")
+("44136" "ӵۻy")
+("44140" "߱")
+("44141" "")
+("44146" "")
+("44147" "YԹh")
+("44149" "")
+("44153" "DH")
+("44160" "")
+("44161" "")
+("44162" "ۨ")
+("44164" "ߪF")
+("44169" "ÿ")
+("44170" "X")
+("44171" "V")
+("44180" "w")
+("44182" "t")
+("44186" "X")
+("44191" "")
+("44194" "Ħآ")
+("44201" "RK߬")
+("44202" "dx")
+("44207" "Ҹө")
+("44210" "Y")
+("44211" "SʹoӤnxS")
+("44212" "b`߭J")
+("44213" "`rb")
+("44214" "zӳ{ܥMVRqF")
+("44215" "p")
+("44216" "Aj")
+("44217" "ĪɦˢͳxhzJ")
+("44218" "Y")
+("44220" "~߿")
+("44221" "Ӯa߰")
+("44222" "T")
+("44223" "")
+("44224" "g")
+("44227" "ڪa@׸UVcõUĩLNͺ;~ҧӦӴivvۡۢۯN`tw\\EFLRC")
+("44228" "")
+("44230" "a")
+("44231" "yB")
+("44232" "X}\wN")
+("44233" "")
+("44234" "fӬ۩T")
+("44236" "")
+("44237" "")
+("44238" "U")
+("44240" "{c")
+("44241" "߾")
+("44242" "")
+("44243" "")
+("44247" "踵nͿPI")
+("44248" "WO")
+("44250" "ӶA")
+("44252" "HN")
+("44253" "Zӫuߺ߻BG")
+("44256" "W")
+("44257" "")
+("44260" "`E")
+("44261" "_ĨϿӭOL")
+("44264" "")
+("44267" "")
+("44281" "uv|")
+("44282" "")
+("44286" "ī}S@")
+("44289" "")
+("44294" "Ӫs")
+("44296" "y}")
+("44301" "")
+("44302" "fH")
+("44303" "]Фb")
+("44304" "ET")
+("44307" "ۭdS")
+("44308" "")
+("44320" "")
+("44327" "Z߯YrMm")
+("44330" "l")
+("44331" "]PZk")
+("44332" "e")
+("44333" "}۰")
+("44334" "")
+("44336" "NSe")
+("44338" "")
+("44339" "")
+("44341" "ߩ")
+("44343" "]")
+("44346" "C")
+("44347" "r{")
+("44351" "")
+("44360" "")
+("44394" "Ĭq")
+("44400" "")
+("44401" "Ͳlz")
+("44402" "ˡ")
+("44403" "")
+("44404" "ֵӰha߳߷o")
+("44406" "g|G")
+("44407" "ߪFٽ^~͹go")
+("44408" "t")
+("44409" "m")
+("44410" "X")
+("44411" "hy")
+("44412" "oc")
+("44413" "L")
+("44414" "\K")
+("44417" "M")
+("44421" "")
+("44427" "kҸUʴfnxߴW")
+("44430" "ͽM")
+("44431" "")
+("44432" "C")
+("44433" "߫Y")
+("44434" "r{")
+("44441" "ӱDU")
+("44443" "Q")
+("44444" "")
+("44446" "ۮ")
+("44447" "nU")
+("44448" "")
+("44453" "v")
+("44454" "_")
+("44456" "")
+("44460" "hX")
+("44461" "cR")
+("44464" "ؽۣ")
+("44465" "^")
+("44470" "F")
+("44481" "")
+("44486" "\")
+("44491" "ط")
+("44493" "^")
+("44494" "C")
+("44496" "V")
+("44500" "sީ")
+("44502" "k")
+("44503" "ѱf{")
+("44504" "n")
+("44506" "}")
+("44507" "ͷУ")
+("44510" "u")
+("44514" "ca")
+("44517" "ˣ")
+("44518" "i")
+("44521" "^")
+("44527" "ip")
+("44529" "a")
+("44530" "ܭ^͸y")
+("44532" "w")
+("44534" "Ŷ")
+("44535" "`")
+("44541" "")
+("44547" "nO")
+("44553" "mp")
+("44554" "q")
+("44557" "\")
+("44560" "۬")
+("44561" "")
+("44564" "߲")
+("44586" "")
+("44594" "")
+("44600" "̭]`tvfjl")
+("44601" "ϵss}ӯ_ۥi")
+("44602" "qۤ{")
+("44603" "aW")
+("44604" "WY¢Ө߮")
+("44606" "u߶P")
+("44607" "ad")
+("44608" "T")
+("44609" "c")
+("44611" "")
+("44614" "p")
+("44617" "")
+("44621" "V")
+("44626" "")
+("44627" "e޸ħAQy}O")
+("44631" "")
+("44634" "")
+("44641" "")
+("44647" "rQ")
+("44661" "")
+("44662" "")
+("44664" "")
+("44666" "G")
+("44694" "k")
+("44695" "s")
+("44700" "r")
+("44710" "~")
+("44711" "ѬͶt߸")
+("44712" "]cӲd")
+("44714" "͵ͻ߽")
+("44716" "_")
+("44717" "@ݫѭU_}")
+("44722" "{")
+("44727" "gɵ帯|Х")
+("44731" "")
+("44732" "bӣ[R")
+("44735" "")
+("44741" "")
+("44747" "Тk")
+("44748" "ӧ")
+("44757" "A")
+("44770" "ܥ")
+("44772" "r")
+("44773" "L")
+("44777" "_y")
+("44781" "")
+("44800" "")
+("44801" "@䷡Ļ_gmK")
+("44802" "вu")
+("44806" "_PD")
+("44808" "Lo")
+("44809" "Ie")
+("44811" "x")
+("44814" "I")
+("44817" "")
+("44820" "")
+("44827" "C")
+("44847" "r")
+("44848" "")
+("44886" "V")
+("44900" "UkSu")
+("44901" "T[")
+("44902" "|")
+("44903" "mQE")
+("44904" "Y[ٵ渭IX")
+("44906" "۪ߵ")
+("44908" "|")
+("44910" "")
+("44911" "")
+("44912" "ED")
+("44914" "ۺeiv")
+("44916" "P")
+("44917" "ĭAET")
+("44920" "l")
+("44921" "~o")
+("44927" "ⷣbzbJW")
+("44930" "A")
+("44932" "cpD")
+("44933" "y")
+("44934" "")
+("44941" "hM`U")
+("44942" "")
+("44947" "KDqU")
+("44948" "")
+("44954" "")
+("44958" "")
+("44960" "\߹L")
+("44961" "ٶCG")
+("44964" "")
+("44970" "a")
+("44981" "\\G")
+("44982" "\")
+("44986" "p")
+("44989" "")
+("44990" "L")
+("44991" "[")
+("44992" "@")
+("44993" "W")
+("44994" "۫")
+("44998" "ٷ")
+("45044" "y")
+("45104" "")
+("45106" "[")
+("45107" "Z")
+("45117" "ʭ԰")
+("45127" "Կ")
+("45130" "")
+("45132" "Դ")
+("45136" "h")
+("45138" "")
+("45143" "WW")
+("45144" "\")
+("45153" "Ծ")
+("45196" "ة")
+("45206" "d")
+("45210" "d")
+("45218" "")
+("45227" "qa")
+("45230" "o")
+("45236" "\")
+("45243" "")
+("45286" "")
+("45294" "ް")
+("45327" "")
+("45331" "z")
+("45400" "ʲ")
+("45406" "P")
+("45410" "m")
+("45413" "U")
+("45416" "T")
+("45417" "")
+("45427" "\")
+("45430" "G")
+("45432" "D")
+("45443" "m")
+("45447" "I")
+("45457" "")
+("45460" "o")
+("45463" "")
+("45481" "")
+("45486" "^")
+("45490" "fEg")
+("45493" "B")
+("45494" "A")
+("45496" "_")
+("45502" "")
+("45530" "")
+("45544" "K")
+("45557" "")
+("45590" "")
+("45601" "")
+("45802" "")
+("45803" "")
+("45806" "")
+("45809" "`")
+("45900" "")
+("45903" "")
+("45906" "]")
+("45917" "")
+("45927" "UGջ")
+("45930" "KP")
+("45932" "")
+("45933" "")
+("45934" "")
+("45943" "")
+("45944" "ϼ")
+("45947" "c")
+("45953" "")
+("45956" "")
+("45957" "I")
+("45960" "c")
+("45963" "")
+("45966" "")
+("45971" "")
+("45977" "")
+("45986" "")
+("45990" "")
+("45992" "")
+("45993" "Z")
+("45994" "dQ")
+("45996" "ɷ")
+("46000" "[")
+("46010" "")
+("46100" "")
+("46110" "Z")
+("46111" "")
+("46113" "")
+("46114" "ILر")
+("46117" "")
+("46127" "Էؤإخ")
+("46128" "")
+("46140" "")
+("46141" "L")
+("46147" "[")
+("46148" "")
+("46156" "M")
+("46181" "")
+("46186" "")
+("46194" "")
+("46200" "")
+("46210" "[cc")
+("46211" "Ec")
+("46214" "WVz")
+("46227" "XWδt")
+("46232" "T]")
+("46240" "f")
+("46247" "")
+("46248" "")
+("46250" "")
+("46256" "o")
+("46260" "sU")
+("46280" "V")
+("46294" "tk")
+("46296" "q")
+("46310" "E")
+("46327" "r")
+("46330" "Q")
+("46400" "p")
+("46410" "Hb")
+("46411" "B")
+("46413" "")
+("46414" "[")
+("46417" "")
+("46427" "Sػؼ}")
+("46430" "@E")
+("46432" "S")
+("46440" "A")
+("46447" "p")
+("46448" "")
+("46456" "`")
+("46460" "@ع")
+("46481" "T\غz")
+("46493" "")
+("46494" "ؿ[")
+("46502" "Ѳ")
+("46510" "")
+("46517" "")
+("46527" "T{r")
+("46533" "P")
+("46540" "@")
+("46543" "")
+("46621" "")
+("46656" "")
+("46714" "j")
+("46727" "")
+("46732" "P")
+("46801" "")
+("46804" "")
+("46806" "P")
+("46809" "")
+("46810" "S")
+("46900" "f۱E")
+("46903" "")
+("46904" "[")
+("46910" "hM\")
+("46911" "aI")
+("46913" "i")
+("46914" "չռ")
+("46927" "bַfJ^Q")
+("46930" "")
+("46932" "")
+("46940" "")
+("46941" "췪")
+("46943" "R")
+("46944" "")
+("46947" "")
+("46950" "j")
+("46956" "")
+("46960" "O")
+("46980" "L")
+("46981" "ټ")
+("46993" "")
+("46994" "")
+("47012" "L")
+("47027" "}˩")
+("47109" "u")
+("47110" "ذ")
+("47111" "")
+("47112" "V")
+("47113" "")
+("47117" "e")
+("47118" "L")
+("47120" "TԶԸ")
+("47127" "иOUWԵb")
+("47132" "")
+("47134" "M")
+("47136" "m")
+("47138" "t")
+("47140" "~")
+("47147" "V")
+("47150" "")
+("47153" "U")
+("47160" "")
+("47167" "ث")
+("47172" "Գ")
+("47177" "Թ")
+("47180" "")
+("47181" "")
+("47182" "")
+("47191" "Ԯ")
+("47194" "W")
+("47207" "")
+("47210" "|v")
+("47211" "b")
+("47212" "ǯp¼")
+("47214" "")
+("47215" "c")
+("47217" "re")
+("47220" "pp")
+("47227" "b|sz|z[`")
+("47232" "uS")
+("47234" "Uo")
+("47241" "")
+("47242" "T")
+("47247" "rbޮ}")
+("47250" "")
+("47252" "^")
+("47261" "l")
+("47271" "o")
+("47272" "ޭ")
+("47280" "Y")
+("47282" "w")
+("47286" "á")
+("47294" "qq")
+("47298" "H")
+("47317" "]")
+("47327" "qqй\")
+("47334" "")
+("47347" "i")
+("47401" "n")
+("47402" "")
+("47404" "v")
+("47407" "V")
+("47410" "jrt")
+("47411" "g")
+("47412" "i")
+("47414" "U")
+("47415" "")
+("47416" "Y")
+("47417" "m")
+("47418" "]")
+("47420" "q¼_Josܫ")
+("47422" "o")
+("47427" "VRBEjn|")
+("47436" "")
+("47440" "k")
+("47447" "nA")
+("47450" "i")
+("47462" "OqF")
+("47467" "A")
+("47472" "")
+("47480" "")
+("47486" "")
+("47492" "p")
+("47494" "")
+("47502" "")
+("47510" "")
+("47512" "")
+("47516" "V")
+("47517" "v")
+("47520" "|")
+("47526" "V")
+("47527" "T]Jr")
+("47532" "}")
+("47547" "")
+("47552" "")
+("47562" "")
+("47582" "")
+("47594" "")
+("47601" "kM")
+("47602" "")
+("47609" "")
+("47620" "J")
+("47627" "lNYy|")
+("47647" "L")
+("47682" "")
+("47712" "A")
+("47714" "")
+("47720" "T")
+("47727" "O")
+("47731" "X")
+("47732" "")
+("47774" "j")
+("47782" "")
+("47801" "_T")
+("47802" "be")
+("47806" "W")
+("47808" "^")
+("47809" "c")
+("47820" "")
+("47827" "o")
+("47882" "")
+("47910" "GH")
+("47911" "F")
+("47912" "R")
+("47913" "")
+("47914" "g")
+("47915" "")
+("47917" "I")
+("47920" "@ehݮqZոٻپ")
+("47922" "V")
+("47927" "};նJLc")
+("47932" "ھ^X")
+("47933" "`")
+("47934" "")
+("47936" "")
+("47937" "lٿ")
+("47940" "]CEٴ")
+("47947" "\շٺB")
+("47950" "")
+("47952" "")
+("47953" "")
+("47954" "")
+("47961" "")
+("47962" "h")
+("47963" "r")
+("47964" "ٹ")
+("47967" "")
+("47972" "o")
+("47980" "@")
+("47982" "")
+("47986" "")
+("47994" "")
+("48011" "")
+("48012" "")
+("48016" "P")
+("48046" "")
+("48107" "y")
+("48117" "Y")
+("48121" "ز")
+("48127" "ʫʮ")
+("48136" "g")
+("48137" "A")
+("48140" "J")
+("48146" "JS")
+("48147" "[")
+("48151" "R")
+("48161" "\R")
+("48166" "W")
+("48216" "t")
+("48217" "D")
+("48227" "en")
+("48231" "p")
+("48240" "δ~_")
+("48241" "ΰ")
+("48261" "Sα")
+("48264" "i")
+("48266" "a")
+("48267" "ޯ")
+("48286" "`")
+("48294" "Ҩ")
+("48327" "")
+("48334" "")
+("48336" "")
+("48340" "j")
+("48400" "q")
+("48401" "m")
+("48414" "t")
+("48417" "")
+("48420" "ʶ")
+("48421" "")
+("48427" "XʵʷR")
+("48431" "a")
+("48432" "ʸ")
+("48435" "")
+("48437" "")
+("48440" "йWV")
+("48441" "F")
+("48446" "")
+("48450" "p")
+("48461" "kZ")
+("48481" "z")
+("48486" "W")
+("48494" "m")
+("48502" "")
+("48516" "")
+("48527" "")
+("48561" "")
+("48601" "ĵ")
+("48640" "Gq")
+("48717" "R")
+("48801" "V")
+("48802" "X")
+("48806" "")
+("48900" "")
+("48904" "")
+("48911" "gA")
+("48912" "Qٮ")
+("48914" "")
+("48916" "Vտ")
+("48917" "e")
+("48921" "")
+("48927" "a")
+("48931" "U")
+("48932" "Q")
+("48933" "٭")
+("48935" "")
+("48936" "C")
+("48937" "V")
+("48940" "ST")
+("48941" "")
+("48946" "")
+("48947" "")
+("48953" "")
+("48957" "")
+("48961" "")
+("48962" "")
+("48964" "")
+("48966" "")
+("48967" "j")
+("48981" "")
+("48982" "B")
+("48986" "")
+("48994" "")
+("49111" "[")
+("49112" "ԯ")
+("49150" "")
+("49189" "ԼG")
+("49220" "ң")
+("49227" "s")
+("49280" "f")
+("49327" "~")
+("49338" "R")
+("49412" "")
+("49420" "")
+("49427" "")
+("49450" "r")
+("49489" "")
+("49527" "TA")
+("49580" "")
+("49720" "K")
+("49802" "")
+("49911" "")
+("49914" "")
+("49917" "")
+("49920" "W")
+("49927" "ٯ")
+("49931" "")
+("49941" "")
+("49950" "")
+("49959" "")
+("49977" "")
+("49980" "")
+("49989" "ٰ")
+("49996" "")
+("50000" "V")
+("50006" "vӦOꨮ")
+("50007" "֨")
+("50011" "F")
+("50012" "̳")
+("50014" "ֱuK")
+("50016" "")
+("50017" "YD")
+("50018" "")
+("50021" "W")
+("50023" "")
+("50027" "dKV{")
+("50030" "ҥ")
+("50032" "ic")
+("50037" "T[")
+("50041" "")
+("50043" "L")
+("50044" "")
+("50047" "")
+("50048" "j")
+("50061" "hhi")
+("50063" "z")
+("50067" "e")
+("50082" "t")
+("50086" "X")
+("50094" "K")
+("50096" "G")
+("50106" "޵e")
+("50107" "دs")
+("50110" "j")
+("50111" "\")
+("50114" "E")
+("50116" "")
+("50117" "ӹ")
+("50121" "")
+("50123" "")
+("50127" "YZ")
+("50131" "")
+("50132" "Į}")
+("50134" "\")
+("50136" "")
+("50137" "[")
+("50140" "A")
+("50143" "")
+("50146" "")
+("50147" "")
+("50148" "")
+("50167" "]")
+("50227" "C`H]")
+("50230" "")
+("50327" "m")
+("50333" "f")
+("50336" "w")
+("50337" "y")
+("50343" "M")
+("50404" "d")
+("50430" "")
+("50503" "^")
+("50507" "r")
+("50556" "F")
+("50557" "T")
+("50600" "")
+("50601" "")
+("50603" "K")
+("50717" "")
+("50727" "n")
+("50732" "J")
+("50777" "")
+("50801" "s")
+("50806" "dQ")
+("50900" "")
+("50902" "")
+("50903" "")
+("50904" "S")
+("50906" "FZ")
+("50917" "")
+("50927" "")
+("50993" "A")
+("51010" "c")
+("51011" "ƻlbݶH")
+("51012" "mX")
+("51014" "]E")
+("51016" "")
+("51017" "oGGG")
+("51020" "a")
+("51021" "")
+("51027" "vݦw")
+("51031" "")
+("51032" "գ")
+("51034" "")
+("51036" "")
+("51040" "aݣ")
+("51041" "")
+("51046" "")
+("51047" "Zp")
+("51049" "")
+("51060" "ݩ")
+("51061" "{ݨݨ")
+("51063" "")
+("51066" "\")
+("51082" "ݢ")
+("51086" "^")
+("51090" "")
+("51091" "")
+("51094" "ݹ")
+("51109" "j")
+("51110" "iӼ")
+("51111" "ӻM")
+("51112" "")
+("51114" "")
+("51117" "O")
+("51119" "ׯ")
+("51120" "H")
+("51127" "į׮k")
+("51132" "")
+("51134" "")
+("51140" "HЦ")
+("51146" "")
+("51150" "")
+("51160" "ף۾")
+("51161" "")
+("51166" "")
+("51186" "")
+("51191" "_")
+("51194" "")
+("51196" "`")
+("51286" "P")
+("51486" "")
+("51786" "y")
+("51931" "")
+("51932" "ٳ")
+("51943" "")
+("51947" "")
+("51986" "")
+("52000" "El")
+("52010" "")
+("52013" "D")
+("52014" "Ro")
+("52016" "")
+("52018" "")
+("52020" "r")
+("52021" "ټ")
+("52027" "")
+("52030" "I")
+("52031" "")
+("52032" "")
+("52033" "m")
+("52034" "}")
+("52040" "E")
+("52041" "}")
+("52043" "ѻѻ")
+("52044" "{")
+("52047" "´Ѽѽ")
+("52057" "")
+("52063" "")
+("52064" "Ap")
+("52069" "Z")
+("52072" "n")
+("52077" "ݰ")
+("52093" "ݻ")
+("52094" "He")
+("52100" "CĹ۶")
+("52104" "")
+("52109" "")
+("52111" "L")
+("52114" "Ч")
+("52115" "")
+("52116" "")
+("52117" "l")
+("52118" "c")
+("52121" "h^")
+("52122" "")
+("52127" "")
+("52130" "ת")
+("52131" "ש")
+("52135" "e")
+("52136" "")
+("52139" "")
+("52140" "ר")
+("52141" "")
+("52143" "")
+("52144" "")
+("52147" "")
+("52153" "")
+("52164" "")
+("52169" "")
+("52257" "R")
+("52300" "")
+("52332" "Q[")
+("52414" "")
+("52502" "ݷ")
+("52601" "}")
+("52602" "ծ")
+("52732" "")
+("52801" "E")
+("52900" "f")
+("52904" "")
+("52914" "")
+("52947" "")
+("52994" "ٽ")
+("53000" "౾")
+("53010" "")
+("53011" "cѳd")
+("53012" "g")
+("53014" "")
+("53016" "U")
+("53017" "")
+("53021" "")
+("53022" "U")
+("53027" "zqݵ")
+("53032" "ѵC")
+("53033" "")
+("53034" "")
+("53035" "")
+("53036" "B")
+("53040" "")
+("53042" "i")
+("53044" "")
+("53047" "")
+("53050" "nݩM")
+("53053" "J")
+("53060" "L")
+("53061" "ݡ")
+("53081" "~N")
+("53086" "")
+("53091" "")
+("53100" "{")
+("53107" "")
+("53111" "D")
+("53112" "d")
+("53114" "p")
+("53116" "")
+("53127" "")
+("53132" "")
+("53143" "")
+("53144" "ס")
+("53150" "ۿ")
+("53161" "[")
+("53186" "X")
+("53200" "w±")
+("53227" "j")
+("53281" "Q")
+("53330" "bP")
+("53342" "i")
+("53400" "")
+("53503" "̱")
+("53700" "|")
+("53801" "")
+("53940" "")
+("53950" "")
+("53960" "A")
+("54000" "̹DX")
+("54011" "_")
+("54012" "")
+("54014" "E|")
+("54016" "")
+("54017" "y̴ݤݤ")
+("54021" "q")
+("54027" "}̷kݲ")
+("54030" "")
+("54031" "̶")
+("54032" "")
+("54034" "N")
+("54038" "ճ")
+("54041" "")
+("54047" "ީѴٱI")
+("54060" "y")
+("54061" "fѿݥ")
+("54064" "")
+("54070" "̵")
+("54081" "դݧv")
+("54086" "V")
+("54089" "")
+("54091" "")
+("54092" "")
+("54094" "gg`")
+("54096" "W")
+("54100" "Bק")
+("54111" "")
+("54114" "`")
+("54117" "v")
+("54127" "׫aN")
+("54132" "")
+("54134" "")
+("54135" "")
+("54138" "")
+("54143" "")
+("54147" "ӽװ")
+("54153" "B")
+("54160" "G@")
+("54161" "۵")
+("54170" "F")
+("54181" "")
+("54186" "")
+("54190" "Ӿ")
+("54194" "")
+("54196" "")
+("54267" "]")
+("54500" "")
+("54827" "")
+("54911" "")
+("54927" "q")
+("54961" "")
+("55000" "d")
+("55006" "˱̽")
+("55010" "")
+("55017" "")
+("55027" "բH")
+("55030" "ߧc̸̿BI")
+("55032" "ա")
+("55034" "~")
+("55043" "")
+("55044" "OOa")
+("55047" "p")
+("55053" "[")
+("55057" "̾")
+("55060" "b")
+("55081" "w")
+("55086" "")
+("55090" "")
+("55094" "")
+("55096" "z")
+("55100" "F")
+("55104" "")
+("55108" "T")
+("55127" "f")
+("55130" "Ӻצ")
+("55132" "۳")
+("55133" "")
+("55144" "")
+("55157" "פ")
+("55160" "ץ")
+("55174" "k")
+("55181" "")
+("55190" "")
+("55191" "^")
+("55196" "")
+("55232" "A")
+("55327" "")
+("55337" "z")
+("55506" "")
+("55557" "")
+("55600" "")
+("55603" "")
+("55606" "")
+("55801" "")
+("55806" "O")
+("55900" "")
+("55904" "")
+("55944" "")
+("55957" "")
+("55992" "")
+("56000" "箹QF")
+("56010" "WA")
+("56011" "@@\ե")
+("56014" "h")
+("56017" "Ѻݯ")
+("56027" "䮽Zݭ")
+("56030" "lݮ")
+("56032" "m")
+("56034" "")
+("56040" "y")
+("56041" "´ܿ")
+("56044" "L")
+("56046" "")
+("56047" "")
+("56050" "")
+("56056" "")
+("56060" "d")
+("56064" "")
+("56080" "@")
+("56081" "")
+("56086" "l")
+("56093" "")
+("56094" "զK")
+("56100" "j")
+("56110" "")
+("56113" "j")
+("56114" "")
+("56116" "")
+("56117" "d")
+("56127" "i")
+("56130" "ge")
+("56131" "")
+("56132" "")
+("56134" "i")
+("56140" "")
+("56141" "")
+("56144" "")
+("56147" "n")
+("56156" "")
+("56160" "A")
+("56181" "")
+("56193" "")
+("56194" "")
+("56210" "")
+("56404" "t")
+("56510" "z")
+("56900" "N@")
+("56904" "")
+("56914" "")
+("56927" "")
+("57010" "̼")
+("57011" "̻")
+("57012" "")
+("57013" "@ee")
+("57014" "")
+("57015" "")
+("57016" "")
+("57017" "xXN")
+("57020" "bűǽddѹ|nC}LM")
+("57022" "G")
+("57027" "oY˪Ѷѷ^cݫݬݱݱݳ")
+("57032" "dݪ")
+("57034" "[[")
+("57035" "")
+("57036" "k")
+("57037" "ݴݴ")
+("57040" "z")
+("57041" "")
+("57046" "")
+("57047" "׷hjsssX")
+("57050" "")
+("57053" "")
+("57054" "")
+("57056" "")
+("57061" "")
+("57062" "ۺP")
+("57063" "")
+("57064" "ux")
+("57067" "Ѹe")
+("57072" "")
+("57077" "t")
+("57080" "")
+("57081" "")
+("57082" "ȳn")
+("57094" "|ݺ")
+("57104" "O")
+("57110" "I")
+("57112" "۹")
+("57114" "")
+("57117" "gA~")
+("57120" "mЩ׭")
+("57122" "b")
+("57127" "bhdZ")
+("57132" "۸")
+("57133" "a")
+("57136" "۷")
+("57137" "ӿ")
+("57146" "")
+("57147" "c")
+("57154" "")
+("57157" "ۺ")
+("57161" "")
+("57162" "ע")
+("57164" "")
+("57167" "")
+("57172" "")
+("57177" "")
+("57180" "")
+("57181" "")
+("57182" "")
+("57186" "")
+("57194" "")
+("57217" "")
+("57227" "BWe")
+("57232" "^")
+("57327" "l")
+("57332" "|")
+("57427" "")
+("57432" "")
+("57502" "")
+("57504" "")
+("57527" "L")
+("57647" "j")
+("57772" "j")
+("57903" "ô")
+("57904" "@")
+("57917" "")
+("57927" "{")
+("57932" "")
+("57947" "T")
+("57977" "")
+("57982" "")
+("58000" "")
+("58011" "b")
+("58012" "i")
+("58014" "Cyp")
+("58016" "Ѿ")
+("58017" "k~W")
+("58020" "")
+("58021" "Yg")
+("58022" "̺H")
+("58027" "")
+("58031" "")
+("58032" "")
+("58036" "_")
+("58037" "Fݸ")
+("58040" "JM]")
+("58041" "u")
+("58046" "f")
+("58047" "")
+("58053" "")
+("58057" "")
+("58060" "j")
+("58061" "B")
+("58064" "e")
+("58067" "m")
+("58068" "g")
+("58081" "")
+("58086" "߾")
+("58091" "")
+("58093" "")
+("58101" "")
+("58109" "l")
+("58111" "K")
+("58116" "")
+("58117" "Ш")
+("58120" "")
+("58121" "")
+("58127" "o")
+("58132" "G")
+("58137" "M")
+("58140" "")
+("58141" "۲")
+("58147" "")
+("58151" "۱")
+("58153" "")
+("58161" "")
+("58181" "")
+("58194" "")
+("58214" "")
+("58227" "}")
+("58232" "")
+("58240" "")
+("58244" "u")
+("58247" "}")
+("58251" "")
+("58327" "")
+("58334" "")
+("58401" "m")
+("58430" "v")
+("58440" "")
+("58502" "")
+("58601" "")
+("58917" "F")
+("58940" "")
+("59012" "")
+("59020" "")
+("59027" "f")
+("59031" "")
+("59050" "")
+("59052" "")
+("59059" "")
+("59066" "")
+("59080" "")
+("59089" "l")
+("59112" "l")
+("59114" "")
+("59127" "")
+("59166" "")
+("59194" "")
+("59920" "f")
+("60000" "fI")
+("60010" "pv")
+("60014" "߸F٤")
+("60017" "\g")
+("60018" "")
+("60022" "i")
+("60023" "")
+("60027" "ڹw")
+("60031" "@")
+("60032" "tzW")
+("60036" "")
+("60040" "z")
+("60044" "s")
+("60046" "}")
+("60047" "th")
+("60048" "ruu٢")
+("60061" "tf")
+("60082" "y")
+("60086" "mvt")
+("60094" "")
+("60096" "")
+("60100" "ꥹ")
+("60101" "\")
+("60104" "ePqS[")
+("60107" "|_")
+("60108" "R")
+("60111" "o")
+("60113" "")
+("60114" "C^")
+("60123" "E")
+("60127" "帾")
+("60130" "h")
+("60132" "")
+("60137" "")
+("60141" "")
+("60144" "")
+("60147" "̿")
+("60148" "")
+("60153" "g")
+("60161" "")
+("60210" "S|")
+("60211" "̽}ʧʩ")
+("60221" "q")
+("60223" "")
+("60227" "QzGEʨu]ԫԬխ|d")
+("60228" "")
+("60232" "I`")
+("60240" "")
+("60253" "")
+("60281" "")
+("60307" "")
+("60327" "|")
+("60330" "䮦")
+("60331" "")
+("60332" "M")
+("60336" "z")
+("60343" "")
+("60361" "f")
+("60396" "")
+("60400" "Ц")
+("60401" "HH")
+("60404" "")
+("60406" "n")
+("60407" "_@")
+("60416" "")
+("60417" "")
+("60427" "tk")
+("60430" "]")
+("60433" "Ͼ")
+("60436" "")
+("60440" "@")
+("60447" "k")
+("60500" "")
+("60504" "")
+("60506" "w")
+("60507" "")
+("60521" "D")
+("60527" "")
+("60600" "^f_")
+("60601" "FH|")
+("60602" "")
+("60604" "T˴p")
+("60606" "")
+("60620" "@")
+("60641" "")
+("60660" "~")
+("60711" "i")
+("60712" "")
+("60716" "mj")
+("60717" "ayy")
+("60727" "T")
+("60731" "")
+("60732" "G")
+("60747" "^")
+("60770" "")
+("60772" "")
+("60776" "w")
+("60800" "u}")
+("60801" "O")
+("60806" "RI")
+("60809" "R")
+("60817" "")
+("60848" "")
+("60861" "")
+("60882" "")
+("60886" "S")
+("60901" "M")
+("60903" "")
+("60904" "bxGXTkk")
+("60906" "")
+("60914" "ù")
+("60993" "")
+("60994" "i")
+("61010" "sxM")
+("61011" "زVVP")
+("61012" "c")
+("61014" "ԩR")
+("61016" "Ϲü")
+("61017" "׼N")
+("61019" "A")
+("61020" "mnm")
+("61027" "ٶܼL}yHK")
+("61031" "")
+("61032" "־")
+("61034" "@")
+("61040" "Srwx֬")
+("61041" "")
+("61043" "")
+("61044" "m")
+("61046" "C~E{")
+("61047" "")
+("61049" "")
+("61050" "A")
+("61053" "A")
+("61060" "{y")
+("61061" "n")
+("61072" "")
+("61077" "l")
+("61081" "Q")
+("61086" "")
+("61087" "")
+("61090" "}")
+("61091" "gI")
+("61094" "")
+("61110" "kl")
+("61111" "FF")
+("61114" "k")
+("61117" "Z")
+("61121" "c")
+("61127" "U")
+("61131" "_")
+("61132" "")
+("61140" "]")
+("61141" "\")
+("61146" "@")
+("61147" "")
+("61160" "s")
+("61166" "")
+("61181" "C")
+("61182" "")
+("61186" "")
+("61211" "")
+("61286" "E")
+("61314" "")
+("61360" "I")
+("61386" "")
+("61532" "[")
+("61732" "Ź")
+("61801" "")
+("61808" "D")
+("61809" "ޣ")
+("61832" "")
+("61846" "J")
+("61847" "c")
+("61860" "K")
+("61947" "u")
+("61986" "V")
+("62000" "E|")
+("62010" "q")
+("62013" "B")
+("62014" "\Q")
+("62017" "")
+("62018" "")
+("62021" "vR")
+("62027" "kH")
+("62030" "K")
+("62031" "ԡ{")
+("62032" "[֯")
+("62034" "")
+("62035" "P")
+("62036" "")
+("62037" "ww")
+("62040" "")
+("62043" "B")
+("62046" "Z")
+("62047" "xC")
+("62049" "I")
+("62052" "")
+("62053" "T")
+("62057" "C")
+("62064" "E")
+("62072" "F")
+("62077" "")
+("62094" "BԪ")
+("62110" "X")
+("62113" "")
+("62114" "k")
+("62116" "a")
+("62118" "")
+("62127" "T")
+("62131" "")
+("62134" "")
+("62143" "B")
+("62144" "A")
+("62147" "Q")
+("62163" "")
+("62169" "S")
+("62170" "b")
+("62177" "")
+("62186" "Ů")
+("62194" "`")
+("62200" "O")
+("62214" "")
+("62327" "")
+("62372" "J")
+("62441" "")
+("62614" "A")
+("62715" "")
+("62800" "h")
+("62837" "S")
+("62840" "")
+("62900" "")
+("62914" "M")
+("62922" "v")
+("62993" "")
+("63000" "")
+("63007" "")
+("63010" "m")
+("63011" "թں")
+("63012" "١")
+("63014" "\")
+("63016" "ٷy")
+("63021" "{")
+("63027" "ժ")
+("63032" "")
+("63034" "pʭ")
+("63047" "լڭ")
+("63050" "@NN")
+("63060" "")
+("63061" "M")
+("63064" "")
+("63073" "G")
+("63081" "r")
+("63086" "y")
+("63091" "")
+("63111" "Y")
+("63112" "")
+("63114" "")
+("63117" "O")
+("63132" "W")
+("63136" "")
+("63144" "[")
+("63147" "_")
+("63150" "au")
+("63153" "")
+("63160" "`")
+("63161" "")
+("63234" "m")
+("63312" "")
+("63322" "v")
+("63334" "q")
+("63340" "")
+("63550" "")
+("63634" "~")
+("63821" "J")
+("63822" "")
+("63832" "S")
+("63840" "")
+("63842" "")
+("63850" "B")
+("63853" "")
+("63860" "M")
+("63889" "H")
+("64000" "sTJʢR")
+("64010" "wR")
+("64011" "L")
+("64012" "")
+("64013" "x")
+("64014" "z֪")
+("64016" "{{٣")
+("64017" "߽OO")
+("64018" "O")
+("64021" "")
+("64027" "{oD便fM")
+("64030" "y")
+("64031" "~`mQ")
+("64032" "év")
+("64034" "MK~")
+("64036" "")
+("64038" "@")
+("64040" "u")
+("64041" "åԦz")
+("64047" "sq")
+("64054" "M")
+("64056" "z")
+("64060" "B@zp")
+("64061" "ݼHD")
+("64064" "o")
+("64067" "")
+("64070" "")
+("64081" "ԧ")
+("64086" "Q")
+("64090" "")
+("64091" "")
+("64093" "")
+("64094" "")
+("64096" "IIA")
+("64098" "Ԩ")
+("64100" "")
+("64111" "n")
+("64114" "i")
+("64116" "")
+("64117" "")
+("64121" "")
+("64127" "@")
+("64135" "ľ")
+("64141" "Cj")
+("64147" "_ZD")
+("64160" "")
+("64161" "P")
+("64164" "")
+("64166" "")
+("64181" "Y")
+("64186" "p")
+("64194" "")
+("64311" "")
+("64312" "")
+("64316" "")
+("64327" "K")
+("64361" "\")
+("64370" "")
+("64381" "")
+("64386" "u")
+("64627" "m")
+("64800" "]")
+("64805" "")
+("64812" "")
+("64827" "Ը")
+("64863" "")
+("64886" "ū")
+("65000" "ʡ")
+("65006" "D")
+("65017" "ʤ")
+("65027" "S")
+("65030" "MwU|")
+("65032" "x֫")
+("65043" "")
+("65044" "ƹy")
+("65047" "")
+("65053" "w")
+("65066" "")
+("65068" "")
+("65071" "J")
+("65081" "xx٧")
+("65086" "B~")
+("65090" "NC")
+("65093" "")
+("65096" "")
+("65106" "m")
+("65130" "l^")
+("65162" "")
+("65177" "")
+("65181" "")
+("65186" "|R")
+("65194" "")
+("65806" "U")
+("65810" "")
+("65817" "R")
+("65857" "")
+("65863" "")
+("65881" "")
+("66000" "@|ԵtO")
+("66010" "իڽx")
+("66014" "oot")
+("66017" "")
+("66027" "ܳz{q٦ڿBzv")
+("66030" "")
+("66031" "K")
+("66032" "n")
+("66033" "")
+("66034" "")
+("66040" "D")
+("66041" "Aھ")
+("66043" "")
+("66044" "X")
+("66046" "")
+("66047" "D")
+("66048" "")
+("66050" "E")
+("66054" "")
+("66056" "C")
+("66060" "")
+("66064" "")
+("66080" "")
+("66081" "")
+("66086" "G")
+("66094" "T")
+("66096" "")
+("66100" "")
+("66104" "")
+("66114" "Q")
+("66127" "Ľ")
+("66132" "h")
+("66147" "")
+("66150" "")
+("66181" "b")
+("66194" "ļ")
+("66207" "K")
+("66210" "F")
+("66214" "£")
+("66217" "G")
+("66248" "Y")
+("66320" "v")
+("66402" "z")
+("66404" "")
+("66407" "w")
+("66427" "")
+("66430" "")
+("66506" "")
+("66601" "Q")
+("66660" "P")
+("66661" "")
+("66663" "")
+("66668" "")
+("66717" "we")
+("66772" "Ģ")
+("66810" "")
+("66827" "")
+("66860" "")
+("66880" "T")
+("67000" "")
+("67010" "C")
+("67011" "O")
+("67012" "H")
+("67013" "@")
+("67014" "`")
+("67015" "|")
+("67016" "")
+("67017" "aEԢ٨")
+("67020" "nopkAΰްJʣ@FO֭}")
+("67022" "")
+("67027" "ʻfGGFֲֲj{S|")
+("67032" "")
+("67033" "N")
+("67034" "")
+("67040" "L")
+("67046" "@")
+("67047" "lvvu")
+("67048" "")
+("67050" "")
+("67056" "u")
+("67061" "¤")
+("67062" "L֮")
+("67063" "P")
+("67064" "")
+("67072" "")
+("67077" "}")
+("67080" "\P")
+("67081" "A")
+("67082" "jF")
+("67086" "")
+("67087" "`")
+("67094" "")
+("67101" "")
+("67104" "")
+("67107" "")
+("67110" "")
+("67111" "")
+("67112" "]")
+("67114" "D")
+("67117" "")
+("67120" "nB")
+("67122" "")
+("67127" "rŭo\")
+("67131" "[")
+("67132" "")
+("67140" "\")
+("67147" "")
+("67160" "")
+("67164" "")
+("67180" "")
+("67194" "")
+("67220" "")
+("67227" "kYW")
+("67327" "O")
+("67332" "r")
+("67336" "")
+("67361" "d")
+("67382" "")
+("67427" "xVog")
+("67527" "nX")
+("67532" "")
+("67627" "|")
+("67720" "")
+("67727" "")
+("67782" "")
+("67820" "")
+("67827" "h")
+("67852" "")
+("67861" "ĺ")
+("67864" "")
+("67894" "")
+("67927" "")
+("68000" "z")
+("68011" "QQv")
+("68012" "ݿ")
+("68014" "")
+("68017" "Yy")
+("68018" "")
+("68020" "ʥ")
+("68021" "")
+("68022" "")
+("68027" "hu߶侲ڻ")
+("68031" "F")
+("68032" "")
+("68033" "ԥ")
+("68034" "")
+("68035" "֨")
+("68037" "S")
+("68040" "˹~C")
+("68046" "u")
+("68050" "D")
+("68051" "ֱ")
+("68053" "f")
+("68057" "")
+("68061" "")
+("68062" "")
+("68064" "ԣs")
+("68066" "DU")
+("68067" "")
+("68081" "")
+("68086" "¥TE")
+("68094" "Gڮ")
+("68100" "w")
+("68111" "")
+("68114" "p")
+("68117" "")
+("68121" "")
+("68122" "")
+("68127" "F")
+("68132" "E")
+("68140" "")
+("68141" "g")
+("68146" "")
+("68147" "")
+("68151" "V")
+("68157" "^")
+("68161" "q")
+("68166" "O")
+("68167" "")
+("68181" "")
+("68327" "r")
+("68346" "")
+("68440" "")
+("68681" "z")
+("68817" "")
+("68837" "")
+("68840" "")
+("68866" "")
+("68891" "")
+("69012" "")
+("69014" "e")
+("69020" "n")
+("69027" "GGڼ")
+("69031" "")
+("69039" "N")
+("69050" "`")
+("69059" "sz")
+("69061" "|")
+("69066" "")
+("69080" "{Y")
+("69086" "")
+("69089" "٥")
+("69094" "}֩")
+("69112" "")
+("69114" "A")
+("69127" "]")
+("69150" "")
+("69159" "P")
+("69180" "")
+("69227" "J")
+("69889" "")
+("70103" "z")
+("70104" "")
+("70114" "")
+("70214" "JsO")
+("70215" "")
+("70216" "")
+("70217" "»ͬ")
+("70223" "")
+("70227" "ջHAuPm")
+("70231" "")
+("70232" "V")
+("70236" "r")
+("70240" "")
+("70243" "")
+("70246" "")
+("70247" "")
+("70248" "Qj")
+("70261" "r")
+("70282" "ej")
+("70294" "")
+("70314" "n")
+("70316" "S")
+("70327" "")
+("70332" "")
+("70334" "")
+("70340" "")
+("70341" "X")
+("70346" "")
+("70348" "a")
+("70382" "b")
+("70404" "X")
+("70502" "")
+("70601" "Ĵ")
+("70641" "@")
+("70711" "~")
+("70717" "I")
+("70732" "")
+("70740" "")
+("70801" "")
+("70903" "")
+("70904" "")
+("71104" "ا")
+("71136" "k")
+("71200" "D")
+("71210" "zV˭˯l")
+("71211" "̾guHI")
+("71212" "̭ˮ")
+("71213" "Lu")
+("71214" "\lp")
+("71216" "")
+("71217" "ĤӸ")
+("71218" "")
+("71219" "F")
+("71220" "")
+("71221" "nF")
+("71227" "jJFk}")
+("71232" "b")
+("71234" "}")
+("71237" "")
+("71240" "x")
+("71241" "")
+("71242" "t")
+("71244" "y")
+("71246" "d")
+("71247" "Ϩp")
+("71250" "")
+("71256" "")
+("71260" "")
+("71261" "׶V")
+("71263" "F")
+("71266" "t")
+("71269" "")
+("71274" "")
+("71280" "")
+("71281" "e")
+("71282" "")
+("71286" "@ŬI")
+("71289" "")
+("71291" "")
+("71294" "d")
+("71296" "")
+("71311" "z")
+("71314" "d")
+("71316" "X")
+("71317" "j")
+("71319" "")
+("71327" "n")
+("71331" "|}")
+("71336" "p")
+("71339" "@")
+("71340" "b")
+("71343" "d")
+("71344" "")
+("71346" "z")
+("71349" "")
+("71362" "")
+("71381" "k")
+("71391" "Y")
+("71396" "")
+("71404" "")
+("71442" "")
+("71506" "")
+("71586" "")
+("71601" "")
+("71603" "B")
+("71647" "ݼ")
+("71710" "C")
+("71711" "ǦJlo")
+("71712" "`Kа")
+("71714" "JE")
+("71715" "X")
+("71716" "rΰ")
+("71717" "ڿ^")
+("71718" "")
+("71732" "")
+("71747" "")
+("71761" "")
+("71786" "[")
+("72031" "")
+("72100" "Bm")
+("72101" "C")
+("72104" "f")
+("72109" "")
+("72111" "h")
+("72121" "")
+("72147" "K")
+("72200" "G蹻jl")
+("72201" "")
+("72202" "")
+("72210" "X")
+("72211" "")
+("72212" "gܭ")
+("72213" "m")
+("72214" "~^ܣߡD")
+("72215" "")
+("72216" "h")
+("72217" "gþ")
+("72218" "")
+("72221" "ͯg")
+("72222" "nx")
+("72227" "e")
+("72230" "g")
+("72231" "")
+("72232" "T")
+("72237" "i")
+("72240" "O")
+("72241" "M")
+("72243" "J")
+("72244" "N")
+("72247" "z")
+("72261" "Z")
+("72263" "")
+("72264" "~")
+("72269" "")
+("72272" "")
+("72277" "\")
+("72286" "Ž")
+("72294" "p")
+("72300" "")
+("72313" "f")
+("72314" "")
+("72327" "ź")
+("72334" "c\")
+("72391" "]")
+("72400" "Rɿ")
+("72407" "n")
+("72412" "")
+("72422" "")
+("72447" "v")
+("72557" "w")
+("72601" "g")
+("72602" "q")
+("72603" "")
+("72604" "o")
+("72606" "V")
+("72627" "G")
+("72700" "n")
+("72712" "")
+("72713" "{")
+("72714" "")
+("72716" "c|")
+("72722" "I")
+("72732" "U")
+("72734" "D{")
+("72740" "")
+("72747" "")
+("72772" "")
+("72801" "Lh")
+("72806" "K")
+("72900" "")
+("72901" "O")
+("72904" "A")
+("72922" "g")
+("72932" "P")
+("73210" "˰")
+("73211" "|E")
+("73212" "")
+("73214" "")
+("73216" "b")
+("73227" "}")
+("73232" "G")
+("73236" "C")
+("73240" "")
+("73242" "Kf")
+("73244" "i")
+("73247" "ZկO")
+("73250" "ѯ|")
+("73260" "L")
+("73264" "")
+("73286" "")
+("73300" "")
+("73310" "")
+("73311" "m")
+("73312" "\")
+("73322" "|")
+("73327" "Fb")
+("73332" "Y")
+("73347" "@")
+("73350" "cZR")
+("73360" "")
+("73386" "")
+("73734" "")
+("74104" "Z")
+("74109" "D")
+("74127" "U")
+("74200" "yLb")
+("74210" "{")
+("74211" "")
+("74214" "")
+("74216" "")
+("74219" "s")
+("74221" "H")
+("74227" "د㶦yɪͰvm")
+("74231" "X")
+("74232" "нHa")
+("74234" "")
+("74235" "")
+("74238" "EF")
+("74241" "ż")
+("74247" "ϫ@䳮~")
+("74248" "")
+("74253" "Ŧ")
+("74260" "uG")
+("74261" "K")
+("74281" "~")
+("74286" "\")
+("74294" "u")
+("74300" "t")
+("74311" "Żg")
+("74312" "")
+("74314" "x")
+("74321" "M")
+("74330" "")
+("74331" "v")
+("74338" "o")
+("74340" "")
+("74346" "Z")
+("74354" "~")
+("74381" "")
+("74398" "")
+("74400" "{")
+("74447" "t")
+("74500" "t")
+("74713" "z")
+("74727" "")
+("74732" "")
+("74741" "")
+("74771" "m")
+("74796" "v")
+("74809" "")
+("75043" "@")
+("75200" "[")
+("75206" "}")
+("75210" "`")
+("75212" "W")
+("75217" "w")
+("75218" "")
+("75227" "Wd")
+("75230" "]f")
+("75232" "w")
+("75233" "Ҽ")
+("75234" "s")
+("75240" "x")
+("75244" "\")
+("75246" "B")
+("75281" "")
+("75286" "")
+("75290" "")
+("75293" "")
+("75296" "j")
+("75306" "p")
+("75327" "{")
+("75337" "")
+("75344" "")
+("75360" "")
+("75361" "")
+("75396" "[")
+("75707" "v")
+("75711" "")
+("75716" "^")
+("75727" "")
+("75730" "x")
+("75786" "")
+("76140" "")
+("76200" "cA")
+("76210" "")
+("76211" "")
+("76212" "GG")
+("76213" "")
+("76214" "{IE")
+("76217" "")
+("76218" "")
+("76227" "zx")
+("76230" "|")
+("76232" "~y")
+("76233" "")
+("76240" "")
+("76250" "K")
+("76280" "Y")
+("76281" "")
+("76286" "k")
+("76294" "N")
+("76300" "oe")
+("76311" "")
+("76313" "`")
+("76314" "")
+("76327" "`")
+("76330" "{")
+("76341" "_")
+("76344" "[z")
+("76347" "")
+("76356" "")
+("76381" "")
+("76393" "[")
+("76394" "")
+("76718" "")
+("76734" "")
+("76808" "")
+("76810" "y")
+("77100" "B")
+("77101" "E")
+("77103" "bo")
+("77104" "|KPNPx")
+("77107" "d")
+("77108" "m")
+("77109" "D")
+("77114" "")
+("77117" "")
+("77127" "kl")
+("77136" "")
+("77147" "")
+("77148" "E")
+("77153" "H")
+("77164" "")
+("77207" "r")
+("77210" "LZg٪Ļ")
+("77211" "ͱQz")
+("77212" "ϭMS")
+("77213" "")
+("77214" "ζBܡwM")
+("77216" "\ıu")
+("77217" "ΰ±PuɩN")
+("77220" "ΦPPBɯۯݳ}IjtaJ{")
+("77221" "")
+("77222" "")
+("77227" "hǶxvP]JxγкпSyߢpq")
+("77230" "ҽ")
+("77231" "")
+("77232" "in{O")
+("77233" "LF")
+("77234" "O")
+("77237" "ص")
+("77241" "j")
+("77244" "")
+("77247" "AѮjGiM|")
+("77251" "R")
+("77253" "")
+("77254" "")
+("77261" "x")
+("77264" "~ޱOfL")
+("77266" "h")
+("77267" "Z")
+("77272" "}")
+("77277" "")
+("77280" "")
+("77281" "")
+("77282" "Y˵e")
+("77286" "")
+("77287" "Y")
+("77291" "")
+("77294" "a")
+("77296" "")
+("77304" "k")
+("77310" "")
+("77320" "si")
+("77327" "W^_}a")
+("77330" "")
+("77331" "w")
+("77332" "J")
+("77334" "")
+("77336" "M")
+("77337" "e")
+("77340" "")
+("77347" "]^|")
+("77362" "ay")
+("77364" "d")
+("77394" "")
+("77400" "{")
+("77401" "DFG")
+("77404" "vJ")
+("77407" "_L")
+("77409" "")
+("77427" "")
+("77430" "")
+("77431" "")
+("77440" "U")
+("77441" "}")
+("77442" "")
+("77447" "qp")
+("77482" "")
+("77500" "")
+("77502" "|R")
+("77506" "hY")
+("77508" "|")
+("77516" "w")
+("77527" "P")
+("77600" "")
+("77601" "A[A")
+("77602" "d")
+("77604" "G")
+("77605" "N")
+("77606" "[Km")
+("77607" "ݶ")
+("77621" "")
+("77627" "")
+("77641" "P")
+("77666" "")
+("77682" "Y")
+("77712" "")
+("77713" "")
+("77714" "{")
+("77716" "I")
+("77717" "xڹ")
+("77720" "fLYZ")
+("77727" "n")
+("77732" "l")
+("77747" "")
+("77750" "`")
+("77752" "")
+("77770" "W")
+("77771" "")
+("77772" "f")
+("77777" "YF")
+("77782" "")
+("77801" "SPi")
+("77806" "eTdF")
+("77807" "ذ{")
+("77809" "yebl")
+("77817" "x")
+("77827" "Z")
+("77882" "j")
+("77903" "")
+("77904" "~n")
+("77906" "")
+("77927" "p")
+("77947" "")
+("78104" "Y")
+("78107" "QS")
+("78109" "ų")
+("78211" "_")
+("78212" "^e")
+("78214" "L")
+("78216" "")
+("78217" "iYvv")
+("78221" "ܢ")
+("78222" "e")
+("78227" "ͭK")
+("78231" "")
+("78232" "P")
+("78233" "G")
+("78234" "")
+("78237" "")
+("78240" "ͮ")
+("78241" "k")
+("78247" "")
+("78257" "Q")
+("78265" "")
+("78266" "z")
+("78286" "Iy")
+("78294" "")
+("78314" "h")
+("78316" "a")
+("78321" "")
+("78322" "")
+("78334" "]")
+("78336" "")
+("78337" "")
+("78340" "")
+("78341" "c")
+("78364" "")
+("78366" "y")
+("78391" "b")
+("78604" "")
+("78700" "")
+("78727" "")
+("78740" "")
+("78766" "{")
+("78820" "")
+("78904" "")
+("79211" "")
+("79214" "")
+("79227" "c")
+("79232" "")
+("79236" "f")
+("79244" "")
+("79250" "D")
+("79259" "")
+("79261" "")
+("79286" "")
+("79293" "")
+("79296" "")
+("79359" "x")
+("80000" "HJK")
+("80017" "a")
+("80101" "i")
+("80102" "")
+("80104" "ʬ")
+("80107" "֯qu")
+("80109" "y")
+("80111" "p")
+("80113" "")
+("80114" "@")
+("80115" "")
+("80116" "")
+("80117" "Brp")
+("80119" "")
+("80123" "l")
+("80127" "εOb`")
+("80131" "")
+("80132" "b^vn")
+("80136" "D^")
+("80137" "Io")
+("80141" "Nh")
+("80147" "")
+("80148" "ǻ")
+("80167" "_")
+("80182" "rC")
+("80191" "")
+("80194" "B")
+("80200" "X")
+("80207" "XRR")
+("80211" "Eʮt")
+("80214" "ܤ")
+("80215" "")
+("80216" "I")
+("80217" "^~J")
+("80220" "")
+("80221" "\e")
+("80227" "̨ڰͫ")
+("80232" "")
+("80237" "")
+("80251" "R")
+("80253" "")
+("80307" "O")
+("80317" "yl")
+("80331" "~̵L")
+("80332" "U")
+("80333" "O")
+("80337" "o")
+("80339" "S")
+("80346" "L")
+("80400" "Ȥ")
+("80404" "")
+("80407" "`")
+("80408" "")
+("80414" "n")
+("80427" "V")
+("80430" "ڳ")
+("80431" "")
+("80441" "}")
+("80442" "")
+("80446" "λ")
+("80500" "~")
+("80501" "")
+("80502" "")
+("80507" "C")
+("80510" "t")
+("80513" "")
+("80517" "ûk")
+("80527" "")
+("80530" "üü")
+("80547" "")
+("80553" "q")
+("80601" "X")
+("80602" "t")
+("80604" "")
+("80605" "")
+("80606" "|{")
+("80607" "")
+("80608" "")
+("80617" "D")
+("80627" "R")
+("80661" "L")
+("80717" "^Iv")
+("80732" "iY")
+("80748" "")
+("80770" "jw")
+("80772" "Χj")
+("80779" "rS")
+("80806" "gh")
+("80807" "N")
+("80809" "Z")
+("80817" "")
+("80886" "")
+("80900" "t")
+("80901" "e")
+("80904" "E")
+("80914" "")
+("80917" "")
+("80921" "")
+("80994" "")
+("81110" "")
+("81111" "f{")
+("81112" "")
+("81113" "")
+("81114" "~")
+("81116" "c")
+("81117" "dD")
+("81118" "e")
+("81120" "v")
+("81127" "t@Vfhn")
+("81131" "")
+("81132" "z_")
+("81136" "J")
+("81140" "ez")
+("81141" "h")
+("81143" "U")
+("81146" "")
+("81147" "ztd")
+("81149" "|g")
+("81153" "h")
+("81160" "s")
+("81161" "f")
+("81162" "J")
+("81163" "")
+("81177" "")
+("81186" "H")
+("81191" "")
+("81217" "Ҿ")
+("81261" "")
+("81286" "{~")
+("81317" "q")
+("81386" "")
+("81417" "x~")
+("81418" "u")
+("81461" "Ԥ")
+("81486" "")
+("81511" "m")
+("81527" "")
+("81596" "")
+("81611" "D")
+("81617" "p")
+("81647" "")
+("81686" "gX")
+("81710" "")
+("81714" "")
+("81716" "")
+("81718" "")
+("81720" "H")
+("81721" "T")
+("81734" "N")
+("81740" "")
+("81747" "")
+("81749" "")
+("81753" "w")
+("81764" "")
+("81786" "|")
+("81886" "t")
+("82100" "hx~")
+("82110" "m")
+("82113" "")
+("82114" "i")
+("82116" "N")
+("82118" "Z")
+("82121" "l")
+("82122" "")
+("82127" "r")
+("82130" "")
+("82132" "")
+("82135" "")
+("82141" "o")
+("82143" "n")
+("82147" "i")
+("82153" "")
+("82160" "E")
+("82161" "")
+("82163" "^")
+("82164" "yB")
+("82169" "")
+("82186" "K")
+("82194" "")
+("82200" "c")
+("82211" "")
+("82214" "@")
+("82294" "")
+("82336" "")
+("82400" "")
+("82427" "B")
+("82434" "")
+("82444" "G")
+("82540" "")
+("82569" "y")
+("82589" "")
+("82600" "мD")
+("82700" "ɾ")
+("82714" "O")
+("82734" "ܮ")
+("82744" "k^^")
+("82753" "")
+("82800" "C")
+("83100" "zcc")
+("83110" "u")
+("83111" "u")
+("83112" "k")
+("83116" "")
+("83122" "t")
+("83127" "Q")
+("83132" "bcgS")
+("83134" "")
+("83136" "f")
+("83140" "i")
+("83142" "W")
+("83144" "")
+("83147" "}")
+("83150" "KrDdT")
+("83153" "")
+("83160" "")
+("83168" "")
+("83177" "")
+("83181" "V")
+("83186" "mg")
+("83191" "")
+("83199" "")
+("83511" "l")
+("83521" "")
+("83547" "n")
+("83550" "A")
+("83611" "")
+("83627" "E")
+("83634" "")
+("83650" "U")
+("83700" "")
+("83727" "")
+("83742" "")
+("83747" "")
+("83750" "j")
+("83753" "^")
+("83760" "~")
+("83777" "]")
+("84100" "wCop")
+("84110" "Al")
+("84111" "{")
+("84112" "q")
+("84114" "Lu")
+("84117" "Deo")
+("84121" "B")
+("84127" "uZRS}")
+("84130" "g")
+("84131" "x")
+("84132" "rd")
+("84134" "hb")
+("84138" "h")
+("84140" "Y")
+("84141" "ű")
+("84142" "R")
+("84144" "")
+("84147" "ewii")
+("84153" "t")
+("84154" "")
+("84156" "")
+("84160" "W")
+("84161" "pXC")
+("84162" "")
+("84170" "X")
+("84181" "")
+("84186" "pc")
+("84190" "")
+("84193" "c")
+("84194" "g")
+("84196" "")
+("84198" "")
+("84586" "x")
+("84632" "")
+("84681" "R")
+("84711" "")
+("84714" "D")
+("84717" "")
+("84718" "T")
+("84727" "a")
+("84732" "w")
+("84734" "")
+("84740" "")
+("84747" "")
+("84749" "")
+("84761" "U")
+("84786" "V")
+("84900" "")
+("85110" "")
+("85117" "w")
+("85127" "")
+("85130" "yi")
+("85132" "")
+("85133" "")
+("85140" "")
+("85143" "q")
+("85144" "")
+("85160" "\")
+("85174" "b")
+("85181" "")
+("85186" "")
+("85190" "")
+("85196" "y")
+("85532" "B")
+("85717" "")
+("85730" "")
+("85736" "k")
+("85786" "X")
+("85796" "")
+("86100" "`fDs")
+("86110" "|")
+("86111" "C]g")
+("86114" "Yrs")
+("86127" "ANmY")
+("86130" "i")
+("86132" "`")
+("86134" "k")
+("86140" "")
+("86141" "ZM")
+("86144" "r")
+("86147" "")
+("86150" "[")
+("86160" "T")
+("86180" "X")
+("86181" "")
+("86193" "")
+("86194" "d")
+("86210" "")
+("86400" "")
+("86411" "x")
+("86527" "~")
+("86600" "")
+("86711" "_")
+("86713" "J")
+("86714" "R")
+("86727" "OP")
+("86732" "")
+("86747" "C")
+("87091" "")
+("87104" "")
+("87110" "")
+("87111" "")
+("87112" "^")
+("87113" "U")
+("87114" "")
+("87115" "s")
+("87117" "j")
+("87120" "xv_gɿv@AaS")
+("87122" "e")
+("87127" "BCv")
+("87132" "ȿAeM")
+("87133" "")
+("87134" "")
+("87136" "m")
+("87137" "")
+("87140" "")
+("87142" "")
+("87147" "Bkj\j")
+("87150" "")
+("87152" "")
+("87154" "W")
+("87160" "")
+("87162" "")
+("87164" "̿")
+("87177" "")
+("87181" "")
+("87182" "ܾ")
+("87194" "b")
+("87227" "ˬˬ\")
+("87280" "")
+("87282" "p")
+("87320" "")
+("87327" "oYbi")
+("87332" "")
+("87338" "")
+("87417" "[")
+("87420" "")
+("87427" "Gзx")
+("87450" "")
+("87520" "")
+("87547" "a")
+("87610" "")
+("87620" "o")
+("87622" "")
+("87627" "FTU")
+("87682" "")
+("87710" "")
+("87712" "")
+("87713" "a")
+("87720" "}M")
+("87731" "Q")
+("87734" "S")
+("87747" "II]")
+("87752" "L")
+("87762" "H")
+("87777" "`")
+("87781" "W")
+("87782" "")
+("87810" "[")
+("87882" "K")
+("87904" "T")
+("87914" "@")
+("88100" "")
+("88101" "O")
+("88104" "ƽhiC")
+("88106" "")
+("88107" "xwd")
+("88108" "bh")
+("88111" "")
+("88112" "`")
+("88113" "")
+("88114" ";V")
+("88116" "U")
+("88117" "Ų[")
+("88120" "U")
+("88123" "U")
+("88127" "xaOx_GCa")
+("88132" "n")
+("88133" "a")
+("88134" "")
+("88135" "")
+("88137" "aT")
+("88140" "")
+("88141" "")
+("88146" "ï")
+("88147" "")
+("88153" "")
+("88157" "q")
+("88160" "]")
+("88161" "")
+("88162" "")
+("88163" "N")
+("88164" "")
+("88167" "")
+("88168" "s")
+("88169" "")
+("88171" "")
+("88181" "ak")
+("88186" "j")
+("88192" "@")
+("88202" "")
+("88207" "H")
+("88211" "ŢFFO")
+("88212" "")
+("88214" "")
+("88215" "")
+("88216" "c")
+("88217" "Wm")
+("88220" "")
+("88221" "bX")
+("88223" "")
+("88227" "ĵgt­²CJKRjk")
+("88232" "fE")
+("88233" "P")
+("88234" "½jL")
+("88237" "î")
+("88240" "է")
+("88243" "")
+("88246" "l")
+("88247" "D[")
+("88248" "N")
+("88253" "eN")
+("88261" "ò")
+("88281" "")
+("88293" "Q")
+("88294" "")
+("88302" "")
+("88303" "")
+("88304" "O")
+("88306" "")
+("88311" "")
+("88323" "\")
+("88327" "w")
+("88340" "v")
+("88341" "")
+("88343" "")
+("88401" "MQ")
+("88404" "M")
+("88406" "e")
+("88407" "Y")
+("88408" "B\")
+("88414" "X")
+("88427" "ͧbG")
+("88432" "V")
+("88438" "I")
+("88441" "@")
+("88442" "c")
+("88446" "")
+("88447" "")
+("88448" "")
+("88463" "")
+("88486" "")
+("88500" "")
+("88502" "")
+("88503" "")
+("88504" "")
+("88506" "°")
+("88507" "")
+("88512" "dT")
+("88521" "")
+("88527" "b")
+("88537" "")
+("88540" "")
+("88541" "")
+("88557" "")
+("88561" "")
+("88562" "ó")
+("88563" "")
+("88575" "")
+("88582" "P")
+("88586" "")
+("88600" "")
+("88601" "¯¯R")
+("88602" "")
+("88603" "òǺY")
+("88604" "")
+("88606" "L")
+("88608" "f")
+("88621" "")
+("88623" "Z")
+("88627" "")
+("88629" "")
+("88640" "D")
+("88641" "w")
+("88662" "P")
+("88710" "B")
+("88711" "{A")
+("88712" "")
+("88713" "")
+("88715" "")
+("88716" "")
+("88717" "")
+("88721" "")
+("88727" "`z")
+("88732" "uyG")
+("88741" "")
+("88747" "")
+("88777" "")
+("88782" "_")
+("88794" "l")
+("88801" "Qi")
+("88806" "®±")
+("88840" "")
+("88847" "ð")
+("88886" "ñ")
+("88901" "")
+("88902" "")
+("88903" "cġ")
+("88904" "vPh")
+("88906" "g")
+("88908" "]")
+("88914" "Y")
+("88920" "S")
+("88927" "")
+("88934" "_")
+("88940" "")
+("88961" "y")
+("88963" "c")
+("88986" "ţ")
+("88994" "S")
+("89111" "")
+("89112" "")
+("89114" "")
+("89116" "f")
+("89120" "r")
+("89127" "P")
+("89131" "")
+("89150" "")
+("89159" "")
+("89166" "L")
+("89180" "d")
+("89186" "")
+("89189" "")
+("89194" "wm")
+("89789" "\")
+("89794" "Y")
+("90000" "p")
+("90010" "")
+("90014" "")
+("90023" "")
+("90027" "H")
+("90030" "")
+("90031" "")
+("90032" "BZ|J")
+("90036" "")
+("90046" "")
+("90047" "")
+("90048" "|")
+("90061" "}")
+("90063" "f")
+("90086" "")
+("90094" "")
+("90096" "a")
+("90104" "")
+("90200" "")
+("90211" "")
+("90214" "")
+("90216" "")
+("90227" "v|`βA")
+("90232" "")
+("90240" "g")
+("90300" "\")
+("90331" "")
+("90336" "")
+("90427" "H")
+("90430" "y")
+("90500" "bҢ")
+("90502" "x")
+("90506" "")
+("90601" "")
+("90602" "")
+("90603" "")
+("90606" "")
+("90712" "")
+("90717" "")
+("90727" "μ")
+("90732" "n")
+("90772" "")
+("90800" "")
+("90801" "T|")
+("90806" "")
+("90809" "")
+("90811" "j")
+("90814" "Ϯ")
+("90817" "")
+("90827" "i")
+("90831" "Nj")
+("90832" "")
+("90836" "]")
+("90841" "T")
+("90843" "Y")
+("90847" "a")
+("90848" "X")
+("90861" "H")
+("90867" "")
+("90882" "q")
+("90886" "i")
+("90889" "]")
+("90903" "")
+("90904" "̴P")
+("90918" "")
+("90932" "R")
+("90948" "")
+("90967" "}")
+("91011" "^")
+("91013" "g")
+("91014" "nL")
+("91016" "")
+("91017" "")
+("91019" "̮")
+("91027" "}")
+("91032" "y")
+("91034" "")
+("91041" "")
+("91046" "")
+("91047" "")
+("91049" "{")
+("91060" "̣M")
+("91061" "")
+("91066" "A")
+("91086" "p")
+("91090" "")
+("91091" "")
+("91094" "X")
+("91217" "o")
+("91486" "")
+("91547" "q")
+("91586" "")
+("91686" "X")
+("91810" "^")
+("91811" "ϳL")
+("91814" "")
+("91816" "je")
+("91817" "l")
+("91821" "x")
+("91827" "w")
+("91832" "R")
+("91846" "ZH")
+("91860" "l")
+("91861" "QbJ")
+("91886" "J")
+("91891" "d")
+("91917" "")
+("91927" "z")
+("91932" "^")
+("91946" "e")
+("91947" "I")
+("91960" "")
+("91963" "")
+("91986" "")
+("92000" "l")
+("92013" "")
+("92014" "")
+("92018" "_")
+("92021" "F")
+("92022" "~")
+("92027" "m")
+("92033" "b")
+("92034" "q")
+("92040" "")
+("92047" "HP")
+("92063" "o")
+("92064" "_")
+("92070" "")
+("92077" "m")
+("92086" "")
+("92200" "d`")
+("92210" "ܱ")
+("92500" "P")
+("92502" "x")
+("92800" "")
+("92813" "l")
+("92814" "ޡ")
+("92817" "h")
+("92818" "O")
+("92821" "Q")
+("92822" "S")
+("92827" "t~V")
+("92831" "t")
+("92841" "X[")
+("92846" "")
+("92847" "Na")
+("92861" "x")
+("92869" "O")
+("92894" "{")
+("92900" "L")
+("92914" "N")
+("92917" "")
+("92940" "I")
+("93000" "z")
+("93011" "T")
+("93012" "{")
+("93014" "{")
+("93016" "J")
+("93021" "")
+("93022" "G")
+("93027" "G")
+("93032" "Ѣ")
+("93034" "`")
+("93035" "")
+("93047" "Ѫn")
+("93050" "b̡ѣ")
+("93060" "")
+("93064" "K")
+("93077" "V")
+("93091" "UU")
+("93094" "")
+("93136" "")
+("93800" "s")
+("93811" "J_`")
+("93814" "p")
+("93827" "P")
+("93832" "H")
+("93833" "U")
+("93847" "MM")
+("93850" "Krx")
+("93868" "")
+("93922" "X")
+("93936" "")
+("93942" "")
+("93991" "")
+("94000" "")
+("94011" "WB}")
+("94012" "")
+("94014" "")
+("94027" "ƴkE̫ѩj")
+("94030" "")
+("94031" "")
+("94032" "h")
+("94034" "c")
+("94036" "")
+("94041" "")
+("94047" "")
+("94056" "C")
+("94060" "|")
+("94061" "Ѯ")
+("94062" "j")
+("94067" "")
+("94081" "VA")
+("94086" "")
+("94089" "")
+("94090" "Y")
+("94094" "D")
+("94096" "")
+("94104" "O")
+("94800" "S")
+("94811" "Nvp")
+("94814" "ky")
+("94817" "")
+("94822" "")
+("94827" "Nmt`")
+("94835" "}")
+("94841" "")
+("94854" "M")
+("94856" "w")
+("94881" "M")
+("94886" "I_")
+("94890" "V")
+("94894" "o")
+("94896" "R")
+("94900" "ͨG")
+("94927" "")
+("94934" "U")
+("94936" "W")
+("94944" "F")
+("95006" "")
+("95010" "")
+("95017" "")
+("95027" "̱")
+("95030" "̨֩")
+("95032" "")
+("95033" "")
+("95036" "")
+("95043" "")
+("95044" "")
+("95047" "~")
+("95060" "̦")
+("95086" "")
+("95093" "h")
+("95096" "")
+("95817" "u_W")
+("95827" "S")
+("95830" "Pϴ")
+("95840" "v")
+("95844" "n")
+("95856" "m")
+("95896" "")
+("95900" "H")
+("95927" "")
+("95966" "V")
+("95990" "")
+("96000" "̧Ѩ")
+("96010" "̤")
+("96011" "c")
+("96013" "\")
+("96014" "iqѧѭ")
+("96017" "Yѥ")
+("96027" "hjtѦ")
+("96030" "p")
+("96032" "O")
+("96041" "}")
+("96047" "C")
+("96054" "g")
+("96056" "")
+("96081" "N")
+("96094" "]{")
+("96096" "")
+("96810" "ϯ")
+("96811" "O")
+("96812" "ϰ")
+("96814" "m")
+("96815" "z")
+("96817" "")
+("96818" "")
+("96827" "Tc|")
+("96830" "")
+("96832" "۷z")
+("96840" "d")
+("96841" "k\")
+("96847" "r")
+("96856" "L")
+("96860" "{")
+("96881" "U")
+("96886" "")
+("96894" "")
+("96900" "{")
+("96910" "V")
+("96914" "³U")
+("96934" "")
+("96940" "a")
+("96964" "")
+("96994" "_")
+("97010" "̥")
+("97011" "")
+("97012" "̯")
+("97014" "l")
+("97015" "")
+("97016" "ѫ")
+("97017" "z")
+("97020" "𱦱{{̪")
+("97022" "")
+("97027" "Ѥk|")
+("97032" "뱫")
+("97034" "")
+("97036" "i")
+("97040" "̬")
+("97046" "")
+("97047" "~[F")
+("97052" "@")
+("97061" "~")
+("97062" "̢")
+("97064" "")
+("97072" "l")
+("97080" "o")
+("97082" "")
+("97086" "Di")
+("97136" "o")
+("97214" "ģ")
+("97220" "z")
+("97227" "F")
+("97256" "")
+("97301" "D")
+("97327" "")
+("97330" "x")
+("97336" "ž")
+("97434" "u")
+("97717" "J")
+("97727" "")
+("97810" "w")
+("97812" "")
+("97814" "")
+("97815" "U")
+("97818" "m")
+("97820" "`TAuTj")
+("97827" "KoR")
+("97832" "k")
+("97833" "ϵ")
+("97834" "")
+("97846" "K")
+("97847" "")
+("97850" "k")
+("97854" "l")
+("97862" "f")
+("97864" "O")
+("97867" "q")
+("97877" "K")
+("97880" "\")
+("97882" "")
+("97894" "n")
+("97910" "E")
+("97915" "M")
+("97917" "J")
+("97920" "kO")
+("97927" "")
+("97936" "")
+("97940" "")
+("97947" "")
+("97994" "")
+("98011" "̩")
+("98014" "")
+("98016" "")
+("98017" "Z")
+("98019" "d")
+("98021" "r")
+("98027" "eE")
+("98031" "")
+("98032" "")
+("98037" "̰g")
+("98040" "")
+("98041" "")
+("98047" "p")
+("98055" "")
+("98061" "")
+("98066" "")
+("98067" "[")
+("98086" "")
+("98092" "")
+("98094" "Ѭ")
+("98211" "")
+("98227" "")
+("98240" "ʹ")
+("98336" "ž")
+("98404" "s")
+("98444" "")
+("98604" "h")
+("98710" "")
+("98811" "")
+("98814" "y")
+("98816" "")
+("98817" "")
+("98827" "϶I")
+("98832" "X")
+("98833" "")
+("98840" "L")
+("98846" "Q")
+("98851" "L")
+("98853" "^k")
+("98857" "W")
+("98861" "zu")
+("98862" "U")
+("98866" "")
+("98868" "V")
+("98917" "D")
+("98921" "")
+("98927" "")
+("98931" "|")
+("98940" "")
+("98964" "")
+("99011" "")
+("99012" "W")
+("99027" "\")
+("99031" "")
+("99050" "̭")
+("99059" "")
+("99080" "s")
+("99089" "X")
+("99094" "")
+("99103" "")
+("99104" "")
+("99109" "j")
+("99136" "")
+("99216" "{")
+("99227" "")
+("99232" "l")
+("99327" "a")
+("99404" "")
+("99407" "")
+("99417" "r")
+("99427" "")
+("99441" "H")
+("99502" "")
+("99601" "")
+("99606" "")
+("99717" "")
+("99732" "t")
+("99772" "")
+("99809" "")
+("99820" "")
+("99831" "")
+("99859" "M")
+("99880" "ޢ")
+("99889" "W")
+("99901" "")
+("99903" "")
+("99904" "a")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: chinese-big5-unix
+;; End:
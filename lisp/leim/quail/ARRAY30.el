@@ -0,0 +1,13240 @@
+;; Quail package `chinese-array30
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: ARRAY30.tit
+
+;; # -*- coding: cn-big5 -*-
+;; ##############################################################
+;; # CJk, CXTERM MοJkƪ.
+;; #  CXTERM ϥΫe, бz tit2cit Nഫ .cit 榡C
+;; # .cit version 2
+;; ##############################################################
+;; ENCODE: BIG5
+;; AUTOSELECT:    NO
+;; PROMPT: iCj\040
+;; #
+;; COMMENT Copyright (c) 1997 by  William Yeh <is80001@cis.nctu.edu.tw>
+;; COMMENT
+;; COMMENT Permission to copy and distribute both modified and unmodified
+;; COMMENT versions is granted without royalty provided this notice is preserved.
+;; COMMENT
+;; COMMENT Constructed by William Yeh (í  is80001@cis.nctu.edu.tw)
+;; COMMENT Finished on Mar 12, 1994.
+;; COMMENT
+;; COMMENT In Taipei (ETen) Big5 coding (e.g., used with taipei15, taipei20)
+;; COMMENT oɮפ]]AiCjSŸJC
+;; COMMENT Ȥѡueɡv\, pGzݭn, ЦۦK[bɫ᭱C
+;; COMMENT
+;; COMMENT                        CƦC
+;; COMMENT
+;; COMMENT          1   2   3   4   5   6   7   8   9   0
+;; COMMENT                                               
+;; COMMENT         zw{zw{zw{zw{zw{zw{zw{zw{zw{zw{
+;; COMMENT rxxxxxxxxxxxxxxxxxxxx
+;; COMMENT         |w}|w}|w}|w}|w}|w}|w}|w}|w}|w}
+;; COMMENT     0    zw{zw{zw{zw{zw{zw{zw{zw{zw{zw{
+;; COMMENT  C 1 2xߢxxxxӢxxxxxxxxxxעxxݢxxޢx
+;; COMMENT     3 4  |w}|w}|w}|w}|w}|w}|w}|w}|w}|w}
+;; COMMENT           zw{zw{zw{zw{zw{zw{zw{zw{zw{zw{
+;; COMMENT    C - xϢxxxxҢxxԢxxբxx֢xxآxx٢xxڢxxFx
+;; COMMENT       5   |w}|w}|w}|w}|w}|w}|w}|w}|w}|w}
+;; COMMENT            zw{zw{zw{zw{zw{zw{zw{zw{zw{zw{
+;; COMMENT    C 6 7xxxxxѢxxxxТxxܢxxۢxxAxxDxxx
+;; COMMENT       8 9  |w}|w}|w}|w}|w}|w}|w}|w}|w}|w}
+;; COMMENT                       zwwwwwwwwwwwwwwwwwww{
+;; COMMENT      զr         x                Space Bar             x
+;; COMMENT                       |wwwwwwwwwwwwwwwwwww}
+;; COMMENT
+;; # define keys
+;; VALIDINPUTKEY:  \040./;,1234567890abcdefghijklmnopqrstuvwxyz
+;; SELECTKEY:      1
+;; SELECTKEY:      2
+;; SELECTKEY:      3
+;; SELECTKEY:      4
+;; SELECTKEY:      5
+;; SELECTKEY:      6
+;; SELECTKEY:      7
+;; SELECTKEY:      8
+;; SELECTKEY:      9
+;; SELECTKEY:      0
+;; BACKSPACE:      \010\177
+;; DELETEALL:      \015\025
+;; MOVERIGHT:      >
+;; MOVELEFT:       <
+;; REPEATKEY:      \020\022
+;; # KEYPROMPT(\040): @
+;; KEYPROMPT(.): 9v
+;; KEYPROMPT(/): 0v
+;; KEYPROMPT(;): 0-
+;; KEYPROMPT(,): 8v
+;; KEYPROMPT(a): 1-
+;; KEYPROMPT(b): 5v
+;; KEYPROMPT(c): 3v
+;; KEYPROMPT(d): 3-
+;; KEYPROMPT(e): 3^
+;; KEYPROMPT(f): 4-
+;; KEYPROMPT(g): 5-
+;; KEYPROMPT(h): 6-
+;; KEYPROMPT(i): 8^
+;; KEYPROMPT(j): 7-
+;; KEYPROMPT(k): 8-
+;; KEYPROMPT(l): 9-
+;; KEYPROMPT(m): 7v
+;; KEYPROMPT(n): 6v
+;; KEYPROMPT(o): 9^
+;; KEYPROMPT(p): 0^
+;; KEYPROMPT(q): 1^
+;; KEYPROMPT(r): 4^
+;; KEYPROMPT(s): 2-
+;; KEYPROMPT(t): 5^
+;; KEYPROMPT(u): 7^
+;; KEYPROMPT(v): 4v
+;; KEYPROMPT(w): 2^
+;; KEYPROMPT(x): 2v
+;; KEYPROMPT(y): 6^
+;; KEYPROMPT(z): 1v
+;; #
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-array30" "Chinese-BIG5" ""
+ '(   (122 . "1v")
+   (121 . "6^")
+   (120 . "2v")
+   (119 . "2^")
+   (118 . "4v")
+   (117 . "7^")
+   (116 . "5^")
+   (115 . "2-")
+   (114 . "4^")
+   (113 . "1^")
+   (112 . "0^")
+   (111 . "9^")
+   (110 . "6v")
+   (109 . "7v")
+   (108 . "9-")
+   (107 . "8-")
+   (106 . "7-")
+   (105 . "8^")
+   (104 . "6-")
+   (103 . "5-")
+   (102 . "4-")
+   (101 . "3^")
+   (100 . "3-")
+   (99 . "3v")
+   (98 . "5v")
+   (97 . "1-")
+   (44 . "8v")
+   (59 . "0-")
+   (47 . "0v")
+   (46 . "9v")
+)"iCj
+
+ Copyright (c) 1997 by  William Yeh <is80001@cis.nctu.edu.tw>
+
+ Permission to copy and distribute both modified and unmodified
+ versions is granted without royalty provided this notice is preserved.
+
+ Constructed by William Yeh (í  is80001@cis.nctu.edu.tw)
+ Finished on Mar 12, 1994.
+
+ In Taipei (ETen) Big5 coding (e.g., used with taipei15, taipei20)
+ oɮפ]]AiCjSŸJC
+ Ȥѡueɡv\, pGzݭn, ЦۦK[bɫ᭱C
+
+                        CƦC
+
+          1   2   3   4   5   6   7   8   9   0
+                                               
+         zw{zw{zw{zw{zw{zw{zw{zw{zw{zw{
+ rxxxxxxxxxxxxxxxxxxxx
+         |w}|w}|w}|w}|w}|w}|w}|w}|w}|w}
+     0    zw{zw{zw{zw{zw{zw{zw{zw{zw{zw{
+  C 1 2xߢxxxxӢxxxxxxxxxxעxxݢxxޢx
+     3 4  |w}|w}|w}|w}|w}|w}|w}|w}|w}|w}
+           zw{zw{zw{zw{zw{zw{zw{zw{zw{zw{
+    C - xϢxxxxҢxxԢxxբxx֢xxآxx٢xxڢxxFx
+       5   |w}|w}|w}|w}|w}|w}|w}|w}|w}|w}
+            zw{zw{zw{zw{zw{zw{zw{zw{zw{zw{
+    C 6 7xxxxxѢxxxxТxxܢxxۢxxAxxDxxx
+       8 9  |w}|w}|w}|w}|w}|w}|w}|w}|w}|w}
+                       zwwwwwwwwwwwwwwwwwww{
+      զr         x                Space Bar             x
+                       |wwwwwwwwwwwwwwwwwww}
+
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   (">" . quail-next-translation)
+   ("<" . quail-prev-translation))
+ nil nil nil nil)
+
+(quail-define-rules
+("w1" "ABCDEFGHIJKLMNOPQRSTUVWXYZ[\")
+("w2" "]^_``bcdefghijklmnopqrstuvwxyz{|}~")
+("w3" "¡áġšơǡȡɡʡˡ̡͡")
+("w4" "ϡСѡҡӡԡա֡סء١ڡۡܡݡޡߡ")
+("w5" "@AB")
+("w6" "CDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`a")
+("w7" "bcdefghijklmnopqrstuvwxyz{|}~")
+("w8" "ơƢƣƤƥƦƧƨƩƪƫƬƭƮƯưƱƲƳƴƵƶƷƸƹƺƻƼƽƾ¢âĢŢƢǢȢɢʢˢ̢͢")
+("w9" "DEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrs")
+("w0" "tuvwxyz{|}~@")
+(".1" "C")
+(",1" "A")
+(";2" "G")
+(";3" "F")
+("/3" "H")
+("/4" "y")
+("/5" "z")
+("/6" "D")
+("/7" "V")
+("/8" "")
+("/9" "")
+("/0" "K")
+("d3" "I")
+("d4" "u")
+("d5" "v")
+("d6" "B")
+("d7" "")
+("d8" "")
+("d9" "]")
+("d0" "^")
+("t " "")
+("a " "@")
+("s " "A")
+("ad " "B")
+("q " "C")
+("lg " "D")
+("ls " "E")
+("gd " "F")
+("aa " "G")
+("k " "H")
+("ssss" "I")
+("k " "JK")
+("ssss" "L")
+("j " "M")
+("ga " "N")
+("b " "O")
+("ls " "P")
+("f " "Q")
+("c " "R")
+("b " "S")
+("aaa " "T")
+("ac " "U")
+("zk " "V")
+("ea " "W")
+("kd " "X")
+("lsh " "Y")
+("sh " "Z")
+("jk " "[")
+("lx " "\")
+("gds " "]")
+("os " "^")
+("af " "_")
+("ys " "`")
+("as " "a")
+("jh " "b")
+("lh " "c")
+("lf " "d")
+("bh " "e")
+("; " "f")
+("r " "gh")
+("m " "i")
+("z " "j")
+("w " "k")
+("gf " "lm")
+("gdk " "n")
+("fh " "o")
+("c " "p")
+("zs " "q")
+("bbbb" "r")
+("d " "s")
+("ed " "t")
+("q " "u")
+("ts " "vwx")
+("jd " "y")
+("af " "z")
+("ffff" "{")
+("ax " "|")
+("tg " "}")
+("fl " "~")
+("gr " "")
+("aeg " "")
+("z " "")
+(";d " "")
+("ffff" "")
+("jy " "")
+("n " "")
+("tl " "")
+("bgd " "")
+("aax " "")
+("fd " "")
+("aw " "")
+("at " "")
+("ys " "")
+("kaa " "")
+("kf " "")
+("kad " "")
+("kc " "")
+("kls " "")
+("klg " "")
+("ig " "")
+("ke " "")
+("zk " "")
+("aas " "")
+("xs " "")
+("jk " "")
+("yk " "")
+("ig " "")
+("kx " "")
+("js " "")
+(".d " "")
+("kj " "")
+("qj " "")
+(".e " "")
+("laa " "")
+("lx " "")
+("l. " "")
+("kq " "")
+("qk " "")
+("of " "")
+("lf " "")
+("fd " "")
+("yc " "")
+("zgs " "")
+("zb " "")
+("lb " "")
+("zb " "")
+("ar " "")
+("az " "")
+("z " "")
+("zh " "")
+("lz " "")
+("gfs " "")
+("cl " "")
+("zsh " "")
+("bk " "")
+("ads " "")
+("tds " "")
+("xg " "")
+("r " "")
+("tgd " "ݤ")
+("n " "")
+("ax " "")
+("g " "")
+("o " "")
+("os " "")
+("fb " "")
+("y. " "")
+("hf " "")
+("o " "")
+("h " "")
+("p " "")
+("u " "")
+("v " "")
+("jk " "")
+("e " "")
+("am " "")
+("sf " "")
+("qq " "")
+("lq " "")
+("oas " "")
+("c " "")
+(", " "")
+(".dk " "")
+("k. " "")
+(".. " "")
+("d " "")
+("qdl " "")
+("of " "")
+("zh " "")
+("ar " "")
+("ajk " "")
+("rs " "@")
+("za " "A")
+("ua " "B")
+("oa " "C")
+("yr " "D")
+("oe " "E")
+("ln " "F")
+("li " "G")
+("xk " "H")
+("kfh " "I")
+("kgf " "J")
+("kr " "K")
+("kgds" "L")
+("kzk " "M")
+("kax " "N")
+("ib " "O")
+("kd " "P")
+("kjh " "Q")
+("zs " "R")
+(";s " "S")
+("jr " "T")
+("jf " "U")
+(".h " "V")
+("da " "W")
+("dd " "X")
+("da " "Y")
+("afe " "Z")
+("b; " "[")
+("qb " "\")
+("lts " "]")
+("l.h " "^")
+("eq " "_")
+("qjd " "`")
+("klf " "a")
+("i " "b")
+("ff " "c")
+("eac " "d")
+("e; " "e")
+("odj " "f")
+(".ags" "g")
+("rx " "h")
+("qd " "i")
+("f; " "j")
+("z; " "k")
+("j; " "l")
+(";ad " "m")
+(";j " "no")
+(";ga " "p")
+("gq " "q")
+("q; " "r")
+(";sd " "s")
+(";b " "t")
+(";k " "u")
+(";. " "v")
+(";q " "w")
+("x; " "x")
+("l; " "y")
+(";k " "z")
+(";b " "{")
+("/ " "|")
+("pk " "}")
+("mc " "~")
+("jz " "")
+("oz " "")
+("wb " "")
+("wlg " "")
+("lggf" "")
+("nq " "")
+("bq " "")
+("qt " "")
+("qag " "")
+("zq " "")
+("yjd " "")
+("zjd " "")
+("ai " "")
+("xb " "")
+("xf " "")
+("tgx " "")
+("tge " "")
+("nl " "")
+("zx " "")
+("oad " "")
+("olg " "")
+("ok " "")
+("oc " "")
+("oh " "")
+("pa " "")
+("vh " "")
+("va " "")
+("av " "")
+("va " "")
+("vs " "")
+("ae " "")
+("sz " "")
+("tsas" "")
+("oasa" "")
+("hb " "")
+("cf " "")
+("cad " "")
+("cgs " "")
+(".gs " "")
+("yx " "")
+("arh " "")
+(".xk " "")
+("qh " "")
+("ra " "")
+("or " "")
+("jf " "")
+("jq " "")
+("p " "")
+("pf " "")
+("pd " "ҥ")
+("gc " "")
+("lp " "")
+("tb " "")
+("u " "")
+("j " "")
+("bgdl" "")
+("oz " "")
+("g " "")
+("aac " "")
+("lv " "")
+("nk " "")
+("y " "")
+("gca " "")
+("arx " "")
+("oal " "")
+("oah " "")
+("e;s " "")
+("ama " "")
+("yk. " "")
+("yc " "")
+("yxk " "")
+("kh " "")
+("kys " "")
+("k, " "")
+("ktl " "")
+("kz " "")
+("kat " "")
+("kax " "")
+("kv " "")
+("kzh " "")
+("k;d " "")
+("kof " "")
+("kar " "")
+("koj " "")
+("kqq " "")
+("kkj " "")
+("ke " "")
+("klb " "")
+("cas " "")
+(".ds " "")
+("s, " "")
+("os " "")
+("ir " "")
+("rk " "@")
+("ajr " "A")
+("kc " "B")
+("ame " "C")
+("afe " "D")
+("axe " "E")
+("l.e " "F")
+("ue " "G")
+("clb " "H")
+("l.d " "I")
+("qar " "J")
+("qo " "K")
+("oj " "L")
+("jzgs" "M")
+("r; " "N")
+("q. " "O")
+("jq " "P")
+(";jd " "Q")
+(";r " "R")
+(";af " "S")
+(";fh " "T")
+(".; " "U")
+("lj; " "V")
+("m; " "W")
+("i; " "X")
+(";os " "Y")
+(".q " "Z")
+(";x " "[")
+(";lq " "\")
+("pz " "]")
+("p; " "^")
+("pgf " "_")
+("red " "`")
+("rgds" "a")
+("zdr " "b")
+("rr " "c")
+("raag" "d")
+("rts " "e")
+("raf " "f")
+("sam " "g")
+("mm " "h")
+("ztg " "i")
+("zaag" "j")
+("ysw " "k")
+("waf " "l")
+("wts " "m")
+("wgf " "n")
+("wgds" "o")
+("w; " "p")
+("wlh " "q")
+("ngf " "r")
+("zdgf" "s")
+("naf " "t")
+("nfh " "u")
+("nlq " "v")
+("nw " "w")
+("rfh " "x")
+("cz " "y")
+("dos " "z")
+("adad" "{")
+("jdsh" "|")
+("if " "}")
+("oq " "~")
+("aqx " "")
+("tggs" "")
+("nys " "")
+("nfh " "")
+("afx " "")
+("zax " "")
+("zhx " "")
+("zgx " "")
+("o; " "")
+("oq " "")
+("olq " "")
+("sd. " "")
+("pf " "")
+("qp " "")
+("lp " "")
+("lsp " "")
+("pf " "")
+("px " "")
+("zu " "")
+("vag " "")
+("vc " "")
+("ov " "")
+("sv " "")
+("aajk" "")
+("eq " "")
+("amq " "")
+("olg " "")
+("cw " "")
+("caf " "")
+("cq " "")
+("cgds" "")
+("cm " "")
+("cd " "")
+("caag" "")
+("csf " "")
+("clsh" "")
+("csh " "")
+("z, " "")
+("xof " "")
+("ofq " "")
+("alp " "")
+("l " "")
+(", " "")
+("xxxx" "")
+("ofd " "")
+("if " "")
+("bb " "")
+("rlq " "")
+("rlag" "")
+("alje" "")
+("fk " "")
+("ae " "")
+("tf " "")
+("jkk " "")
+("ub " "")
+("us " "")
+("qdtd" "")
+("lj " "")
+("axr " "")
+("o " "")
+("af; " "")
+("mq " "")
+("lm " "")
+("tx " "")
+("jtds" "")
+("f. " "")
+("/ " "")
+("lu " "")
+(".aad" "")
+("ylx " "")
+("a/ " "")
+("tlf " "")
+(";;d " "")
+("y;gd" "")
+("ky " "")
+("kyr " "")
+("knad" "")
+("knq " "")
+("kaaw" "")
+("ki " "")
+("ktge" "")
+("kqd " "")
+("kf; " "")
+("kzq " "")
+("kz; " "")
+("kb; " "")
+("kgq " "")
+("kpd " "")
+("kp " "")
+("ke; " "")
+("kxk " "")
+("kpa " "")
+("kjf " "")
+("koe " "@")
+("kjc " "A")
+("klp " "B")
+("koaa" "C")
+("kib " "D")
+("iv " "E")
+("kl; " "F")
+("kzjd" "G")
+("koz " "H")
+("k;s " "I")
+("f;s " "J")
+("j;s " "K")
+("oak " "L")
+("kx; " "M")
+("kib " "N")
+(";le " "O")
+("ie " "P")
+("lve " "Q")
+("jfe " "R")
+("ltse" "S")
+("rxb " "T")
+("uab " "U")
+("wbb " "V")
+("l;b " "W")
+("qpd " "X")
+("bj " "Y")
+("ohdh" "Z")
+("y.; " "[")
+(";ys " "\")
+("az; " "]")
+("at; " "^")
+("z; " "_")
+(";bk " "`")
+(";tds" "a")
+(";v " "b")
+(";zgs" "c")
+(";gz " "d")
+(";lr " "e")
+(";l; " "f")
+("tl; " "g")
+(";kj " "h")
+("o; " "i")
+(";jk " "j")
+(";l. " "k")
+(";lb " "l")
+(";xs " "m")
+(";cl " "n")
+(";jk " "o")
+(";zh " "p")
+(";gfs" "q")
+(";qdl" "r")
+(";fb " "s")
+("ig; " "t")
+(";ig " "u")
+(";o " "v")
+("lp.h" "w")
+("pv " "x")
+("pads" "y")
+("pl. " "z")
+("rh " "{")
+("rys " "|")
+("re " "}")
+("rjy " "~")
+("rlaa" "")
+("rjk " "")
+("rlb " "")
+("kkr " "")
+("rz " "")
+("ro " "")
+("xr " "")
+("zkk " "")
+("xw " "")
+("wg " "")
+("wh " "")
+("wgr " "")
+("wqq " "")
+("wcl " "")
+("wlz " "")
+("waf " "")
+("wbgd" "")
+("wfb " "")
+("war " "")
+(".w " "")
+("rlgf" "")
+("gf. " "")
+(".gf " "")
+("fjgf" "")
+("naas" "")
+("nv " "")
+("nzx " "")
+("zske" "")
+("bg; " "")
+("bqq " "")
+("bc " "")
+("blq " "")
+("dfb " "")
+("dig " "")
+("kjd " "")
+("dlb " "")
+("qkk " "")
+(".zjd" "")
+("nbgd" "")
+("nqq " "")
+("nv " "")
+("lrb " "")
+("arf " "")
+("ktgl" "")
+("jy. " "")
+("af. " "")
+(".h " "")
+(".sb " "")
+("ysn " "")
+("tsn " "")
+("rn " "")
+("jhn " "")
+("njs " "")
+("ntk " "")
+("ngr " "")
+("nkx " "")
+("afx " "")
+("lox " "")
+("ocl " "")
+("oys " "")
+("ohf " "")
+("ofb " "")
+("oz " "")
+("otk " "")
+("ogr " "")
+("otds" "")
+("ozgs" "")
+("oax " "")
+("oqq " "")
+("ozb " "")
+("obgd" "")
+("oe " "")
+("oo " "")
+("okj " "")
+("osb " "")
+("o.dk" "")
+("ooj " "")
+("oy. " "")
+("ts. " "")
+("q. " "")
+("kd. " "")
+("paf " "")
+("ap. " "")
+("v; " "")
+("vgf " "")
+("v; " "")
+("vfl " "")
+("vfh " "")
+("vr " "")
+("vzk " "")
+("vts " "")
+("v. " "")
+("vaf " "")
+("vq " "")
+("vlh " "@")
+("ysv " "A")
+("ec " "B")
+("osz " "C")
+("f,h " "D")
+("qc " "E")
+("ccl " "F")
+("cn " "G")
+("cjs " "HI")
+("caas" "J")
+("cajd" "K")
+("car " "L")
+("ctk " "M")
+("cv " "N")
+("czh " "O")
+("cads" "P")
+("cp " "Q")
+("c;d " "R")
+("clb " "S")
+("co " "T")
+("clz " "U")
+("clb " "V")
+("ckj " "W")
+("cyc " "X")
+("cys " "Y")
+("cy. " "Z")
+("caw " "[")
+("cadg" "\")
+("cqq " "]")
+("co " "^")
+(",r " "_")
+(",lh " "`")
+("w, " "a")
+("jk, " "b")
+("nof " "c")
+("ofr " "d")
+("ofgs" "e")
+("., " "f")
+(".ar " "g")
+("arjk" "h")
+("bjf " "i")
+("qh " "j")
+("pb " "k")
+("lp " "l")
+("lpq " "m")
+("jad " "n")
+("xoz " "o")
+("lvx " "p")
+("lvlg" "q")
+("lvs " "r")
+("nkls" "s")
+("lx " "t")
+("jkaf" "u")
+("cu " "v")
+("ysu " "w")
+("uaf " "x")
+("ufh " "y")
+("uq " "z")
+("ur " "{")
+("zu " "|")
+("htx " "}")
+("fys " "~")
+("faf " "")
+("flh " "")
+("js " "")
+("j " "")
+("y " "")
+("kk; " "")
+("qi " "")
+("a. " "")
+("m " "")
+("rc " "")
+(";c " "")
+(". " "")
+("q " "")
+("yf " "")
+("zaax" "")
+("afn " "")
+("gdsn" "")
+("sfn " "")
+("osn " "")
+("wn " "")
+(";tds" "")
+("aft " "")
+("qdlt" "")
+("ft " "")
+("gft " "")
+("ap " "")
+("l, " "")
+("pr " "")
+("th " "")
+("taas" "")
+("tfd " "")
+("tzb " "")
+("tys " "")
+("ica " "")
+("lfeq" "")
+(".gfs" "")
+("qtd " "")
+("eqaa" "")
+("aea " "")
+("y;gf" "")
+("y;c " "")
+("kif " "")
+("kylx" "")
+("krfh" "")
+("krr " "")
+("kq. " "")
+("krlq" "")
+("krk " "")
+("kame" "")
+("vkk " "")
+("k;o " "")
+("kalp" "")
+("kif " "")
+("kmm " "")
+("ksad" "")
+("ks, " "")
+("ijf " "")
+("kku " "")
+("kov " "")
+("kzu " "")
+("kir " "")
+("j;sh" "")
+("os " "")
+("das " "")
+("ajdk" "")
+("uak " "")
+("rak " "")
+("jrk " "")
+("kame" "")
+("gcd " "")
+("yxke" "")
+("izj " "")
+("bjde" "")
+("vje " "")
+("axre" "")
+("lf;e" "")
+("oaje" "")
+("sve " "")
+("yxkb" "")
+("qarb" "")
+("ykkf" "")
+("fbbb" "")
+("epf " "")
+("lplf" "")
+("rrc " "")
+("izgs" "")
+("oaej" "")
+("luj " "")
+("aeb " "")
+("eacb" "")
+(".jb " "")
+(";av " "")
+(";qd " "")
+(";b; " "@")
+(";za " "A")
+(";f; " "B")
+(";ua " "C")
+(";pd " "DE")
+(";dd " "F")
+(";;s " "G")
+(";lts" "H")
+(";li " "I")
+(";kfh" "J")
+(";.xk" "K")
+(";wb " "L")
+("lv; " "M")
+(";.h " "N")
+(";bq " "O")
+("jr; " "P")
+(";oe " "Q")
+("i;j " "R")
+(".k; " "S")
+("pf; " "T")
+("ry " "U")
+("rqd " "V")
+("rai " "W")
+("rra " "X")
+("rtb " "Y")
+("rpa " "Z")
+("rpd " "[")
+("roh " "\")
+("ykmk" "]")
+("zf " "^")
+("zqd " "_")
+("zaac" "`")
+("zps " "a")
+("zff " "b")
+("yw " "c")
+("atdw" "d")
+("lvw " "e")
+("wav " "f")
+("wbq " "g")
+("wf; " "h")
+("wsz " "i")
+("wua " "j")
+("wjf " "k")
+("wx; " "l")
+("wor " "m")
+("wlgl" "n")
+("wpf " "o")
+("wjc " "p")
+("wxk " "q")
+("wi " "r")
+("gfu " "s")
+("gf.k" "t")
+("lvgf" "u")
+("naac" "v")
+("nac " "w")
+("ne " "x")
+("nua " "y")
+("npf " "z")
+("nmgs" "{")
+("cj; " "|")
+("bdd " "}")
+("bf; " "~")
+("brd " "")
+("dtss" "")
+("jid " "")
+("dzaf" "")
+("dg " "")
+("dpf " "")
+("kaxd" "")
+("oad " "")
+("nkjd" "")
+("tjjd" "")
+("jde;" "")
+("jdlp" "")
+("lpjd" "")
+("wbjd" "")
+("rif " "")
+("ntk " "")
+("ne; " "")
+("nkfh" "")
+("noaa" "")
+("nlts" "")
+("leb " "")
+("tgyx" "")
+("tg.k" "")
+("wbtg" "")
+(".yr " "")
+(".ae " "")
+(".tge" "")
+(".tb " "")
+("azc " "")
+(";dn " "")
+("l.n " "")
+("ign " "")
+("kjn " "")
+("njz " "")
+("nae " "")
+("nrx " "")
+("nvh " "")
+("nzjd" "")
+("nbr " "")
+("nlp " "")
+("nx; " "")
+("nor " "")
+("nbq " "")
+("ntge" "")
+("npa " "")
+("qax " "")
+("xax " "")
+("gh " "")
+("gzh " "")
+("go " "")
+("gfgk" "")
+("oy " "")
+("oi " "")
+("oyr " "")
+("otss" "")
+("otge" "")
+("ova " "")
+("oqt " "")
+("oj; " "")
+("otb " "")
+("og " "")
+("oz.h" "")
+("ozsb" "")
+("oe; " "")
+("oai " "")
+("opf " "")
+("opd " "")
+("o;j " "")
+("odd " "")
+("osz " "")
+("olp " "")
+("ooaa" "")
+("oxf " "")
+("olts" "")
+("ol; " "")
+("oogs" "")
+("oxb " "")
+("ooh " "")
+("ox; " "")
+("oib " "")
+("h. " "")
+("k.o " "")
+("hkh " "")
+("par " "")
+("rp " "")
+("pl. " "")
+("pp " "")
+("pqq " "")
+("poj " "")
+("pu " "")
+("plaa" "")
+("oasp" "")
+("po " "")
+("paz " "")
+("plf " "@")
+("ujb " "A")
+("uu " "B")
+("vys " "C")
+("vh " "D")
+("vjs " "E")
+("vp " "F")
+("pv " "G")
+("vp " "H")
+("vtds" "I")
+("vqq " "J")
+("vfb " "K")
+("vv " "L")
+("vz " "M")
+("v, " "N")
+("vzb " "O")
+("var " "P")
+("vkx " "Q")
+("vo " "R")
+("vof " "S")
+("v. " "T")
+("vhf " "U")
+("vbgd" "V")
+("vcl " "W")
+("pv " "X")
+("ojk " "Y")
+("aaex" "Z")
+("efb " "[")
+("amlb" "\")
+("ysts" "]")
+("okj " "^")
+("cy " "_")
+("cyr " "`")
+("chb " "a")
+("cnq " "b")
+("cnl " "c")
+("cbq " "d")
+("cqd " "e")
+("cf; " "f")
+("ce; " "g")
+("cj; " "h")
+("ctb " "i")
+("cva " "j")
+("crx " "k")
+("ctgx" "l")
+("ctge" "m")
+("crs " "n")
+("cpf " "o")
+("c;s " "p")
+("cua " "q")
+("c/ " "r")
+("cpk " "s")
+("cjz " "t")
+("ck; " "u")
+("cx; " "v")
+("clts" "w")
+("cln " "x")
+("clp " "y")
+("cav " "z")
+("ctss" "{")
+("coaa" "|")
+("codj" "}")
+("cib " "~")
+(",ys " "")
+(",, " "")
+(",cl " "")
+(",jk " "")
+("m, " "")
+(".dks" "")
+(".td " "")
+("k.ts" "")
+("dzb " "")
+("of. " "")
+("ofl." "")
+("xzh " "")
+(".pd " "")
+(".ua " "")
+(".l; " "")
+("..xk" "")
+("aras" "")
+("arar" "")
+("ary." "")
+("ar. " "")
+("aru " "")
+("ped " "")
+("hd " "")
+("hos " "")
+("hjk " "")
+("lplh" "")
+("afu " "")
+("ysj " "")
+("fua " "")
+("oz; " "")
+("gm " "")
+("yhr " "")
+("yhts" "")
+("yht " "")
+("lvt " "")
+("lvd " "")
+("nkq " "")
+("nktg" "")
+("laa " "")
+("xsd " "")
+("jiys" "")
+("irs " "")
+("dfaf" "")
+("rlp " "")
+("uajd" "")
+("utds" "")
+("ufb " "")
+("uzx " "")
+("usb " "")
+("uads" "")
+("gu " "")
+(".zu " "")
+("uh " "")
+("eu " "")
+("qdtk" "")
+("ok " "")
+("if; " "")
+("fh " "")
+("fn " "")
+("fz " "")
+("ftds" "")
+("fqdl" "")
+("fsb " "")
+("fo " "")
+("fkq " "")
+("fkj " "")
+("fke " "")
+("fn " "")
+("faax" "")
+("fz " "")
+("ffb " "")
+("fajd" "")
+("fe " "")
+("es " "")
+("sa/ " "")
+("ykj " "")
+("rlx " "")
+("qs " "")
+("ojn " "")
+("zbn " "")
+("on " "")
+("j;t " "")
+("oast" "")
+("oat " "")
+("eqt " "")
+(".v " "")
+("i " "")
+("qx " "")
+("e " "")
+("lef " "")
+("tnq " "")
+("tqd " "")
+("tua " "")
+("tkfh" "")
+("ttb " "@")
+("ky " "A")
+("z " "B")
+("ru " "C")
+("ee " "D")
+("ag;a" "E")
+("y;jd" "F")
+("y;js" "G")
+("ky " "H")
+("ktjb" "I")
+("ktoz" "J")
+("kap." "K")
+("kzkk" "L")
+("kbjf" "M")
+("kcu " "N")
+("k;v " "O")
+("k;c " "P")
+("k;l;" "Q")
+("k.gf" "R")
+("kxoz" "S")
+("kxk." "T")
+("kkk;" "U")
+("kosz" "V")
+("klve" "W")
+("klox" "X")
+("klx " "Y")
+("kpr " "Z")
+("kkua" "[")
+("iue " "\")
+("kbg;" "]")
+("yk;s" "^")
+("pj " "_")
+("pfu " "`")
+("jaah" "a")
+(".vhe" "b")
+("ktge" "c")
+("cue " "d")
+("iue " "e")
+("v;e " "f")
+("f;se" "g")
+("me " "h")
+("bjfb" "i")
+("j;sb" "j")
+("fjgb" "k")
+("awqb" "l")
+("lqh " "m")
+("fjif" "n")
+("kk;j" "o")
+("zpgf" "p")
+("izb " "q")
+(";yk." "r")
+("y;lx" "s")
+("aaj;" "t")
+(";f. " "u")
+("r;x " "v")
+("zqx " "w")
+(";ztg" "x")
+(";yxk" "y")
+(";rr " "z")
+(";a/ " "{")
+(";pz " "|")
+(";, " "}")
+(";;; " "~")
+(";rk " "")
+(";i; " "")
+(";.; " "")
+("bk;k" "")
+(";lj " "")
+(";kv " "")
+(";if " "")
+(";ame" "")
+(";ktl" "")
+("pzu " "")
+("of " "")
+("afer" "")
+("rtx " "")
+("rapa" "")
+("r.q " "")
+("rzgx" "")
+("rzag" "")
+("ryxk" "")
+("ycz " "")
+("fjz " "")
+("zaz " "")
+("zrr " "")
+("jjkz" "")
+("irw " "")
+("wif " "")
+("aajw" "")
+("wyk." "")
+("wztg" "")
+("wrr " "")
+("wrlq" "")
+("waxr" "")
+("ws, " "")
+("www " "")
+("zawx" "")
+("wpz " "")
+("gfyk" "")
+("napa" "")
+("nqdd" "")
+("naxr" "")
+("n.; " "")
+("nzu " "")
+("rrfh" "")
+("b, " "")
+("bif " "")
+("bamq" "")
+("baxr" "")
+("drfh" "")
+("djq " "")
+("rkts" "")
+("ykjd" "")
+("lejd" "")
+("ycjd" "")
+("dxxd" "")
+("nif " "")
+("nrb " "")
+("tfb " "")
+("ycf " "")
+("tgae" "")
+("n. " "")
+(".tx " "")
+(".rfh" "")
+(".p; " "")
+(".tf " "")
+(".lp " "")
+(".x. " "")
+(".if " "")
+("wbn " "")
+("pn " "")
+("x;n " "")
+("jtn " "")
+("oen " "")
+("mgsn" "")
+("ncas" "")
+("ni; " "")
+("ntx " "")
+("nz, " "")
+("nama" "")
+("nrfh" "")
+("naf;" "")
+("njq " "")
+("n.; " "")
+("nlu " "")
+("gjf " "")
+("oaf " "")
+("onks" "")
+("onw " "")
+("oif " "")
+("oaqx" "")
+("orfh" "")
+("or; " "")
+("opx " "")
+("oqp " "")
+("ork " "")
+("orlg" "")
+("ogca" "@")
+("olf;" "A")
+("oi; " "B")
+("oir " "C")
+("os, " "D")
+("orr " "E")
+("ae. " "F")
+("f;. " "G")
+("go " "H")
+("hogs" "I")
+("bqs " "J")
+("zp " "K")
+("pj; " "L")
+("pjz " "M")
+("pav " "N")
+("pac " "O")
+("por " "P")
+("poe " "Q")
+("py " "R")
+("pib " "S")
+("plks" "T")
+("vyjd" "U")
+("clsv" "V")
+("vyr " "W")
+("bgdv" "X")
+("rav " "Y")
+("v/ " "Z")
+("b;v " "[")
+("vf; " "\")
+("vjf " "]")
+("vqjk" "^")
+("vqd " "_")
+("vajk" "`")
+("vra " "a")
+("v;j " "b")
+("vpf " "c")
+("vpa " "d")
+("vl; " "e")
+("vlp " "f")
+("voe " "g")
+("vodj" "h")
+("vai " "i")
+("vpd " "j")
+("voaa" "k")
+("voh " "l")
+("cqv " "m")
+("zae " "n")
+("amjz" "o")
+("amx;" "p")
+("osb " "q")
+("rsz " "r")
+("pqq " "s")
+("otge" "t")
+("lpc " "u")
+("cif " "v")
+("cadd" "w")
+("crk " "x")
+("czo " "y")
+("ctf " "z")
+("came" "{")
+("cae " "|")
+("cjq " "}")
+("cos " "~")
+("clf;" "")
+("ci; " "")
+("c.ok" "")
+("cl.d" "")
+("c.; " "")
+("gc " "")
+("capa" "")
+("czu " "")
+("ccas" "")
+("cpx " "")
+("cs, " "")
+("clp " "")
+("clj " "")
+("clu " "")
+(",yx " "")
+("hlg," "")
+(",ajk" "")
+(",qt " "")
+(",j; " "")
+("dz, " "")
+(",oe " "")
+(",lts" "")
+(",j; " "")
+(".azb" "")
+("ofor" "")
+("off;" "")
+("ofoa" "")
+(".nfh" "")
+(".tx " "")
+(".yk." "")
+("are;" "")
+("arjf" "")
+("artb" "")
+("arib" "")
+("ark." "")
+("arlp" "")
+("arkx" "")
+("rqk " "")
+("zjf " "")
+("pax " "")
+("pke " "")
+("pzh " "")
+("p. " "")
+("hsb " "")
+("htds" "")
+("hke " "")
+("h, " "")
+("hzsh" "")
+("baz " "")
+("qqlp" "")
+("lpar" "")
+("lpzb" "")
+("lgbu" "")
+("kju " "")
+("zu " "")
+(";du " "")
+("clj " "")
+("jads" "")
+("vj " "")
+("bj " "")
+("lzj " "")
+(".fj " "")
+("jkj " "")
+("jcl " "")
+("bgdg" "")
+("gcl " "")
+("gaf " "")
+("gqj " "")
+("gjk " "")
+("yhaz" "")
+("yhe " "")
+("yho " "")
+("yhos" "")
+("l;m " "")
+("pm " "")
+("lvhf" "")
+("lvcl" "")
+("lv, " "")
+("nkql" "")
+("nkzh" "")
+("laf " "")
+(",gf " "")
+("xfh " "")
+("xq " "")
+("xts " "")
+("xjh " "")
+("xos " "")
+("xlh " "")
+("xaf " "")
+("ofdq" "")
+("irz " "")
+("bbf " "")
+("rlqq" "")
+("aljh" "@")
+("aljw" "A")
+("dale" "B")
+("aet " "C")
+("ui " "D")
+("gcu " "E")
+("uza " "F")
+("pu " "G")
+("pfu " "H")
+("equ " "I")
+("f;u " "J")
+("upd " "K")
+("ux; " "L")
+("ults" "M")
+("dxus" "N")
+("uoaa" "O")
+("axr." "P")
+("lmd " "Q")
+("fnad" "R")
+("fcgs" "S")
+("fbgl" "T")
+("fqt " "U")
+("fqd " "V")
+("ff; " "W")
+("fb; " "X")
+("fz; " "Y")
+("fzx " "Z")
+("fva " "[")
+("fjr " "\")
+("fp " "]")
+("fjz " "^")
+("fdd " "_")
+("fj " "`")
+("fx; " "a")
+("fmgs" "b")
+("flts" "c")
+("fib " "d")
+("fl; " "e")
+("fva " "f")
+("fodj" "g")
+("eqa " "h")
+("/q " "i")
+("/ys " "j")
+("as/ " "k")
+(".cad" "l")
+("yk. " "m")
+("a/w " "n")
+("jb " "o")
+("yf " "p")
+("yad " "q")
+("yc " "r")
+("em " "s")
+("jm " "t")
+("rcc " "u")
+("rcsd" "v")
+("sk " "w")
+("jq " "x")
+("qls " "y")
+("vhn " "z")
+("b;n " "{")
+("j;n " "|")
+("pfn " "}")
+("j;n " "~")
+("ozn " "")
+("lpn " "")
+("ogdn" "")
+("x;n " "")
+("yk.t" "")
+("hbt " "")
+("zut " "")
+("i;t " "")
+("ip " "")
+("apad" "")
+("op " "")
+("ea " "")
+("ttx " "")
+("tajs" "")
+("talp" "")
+("t.q " "")
+("alpe" "")
+("rf " "")
+("t;q " "")
+("eea " "")
+("yp " "")
+("alm " "")
+("x " "")
+("skld" "")
+("itx " "")
+("ilj " "")
+("lvp " "")
+("lveq" "")
+("y;jq" "")
+("kne " "")
+("ky; " "")
+("kh. " "")
+("knkh" "")
+("kizs" "")
+("knkq" "")
+("kzf " "")
+("kru " "")
+("krif" "")
+("kajk" "")
+("kfua" "")
+("krp " "")
+("kzqd" "")
+("kaxe" "")
+("ke " "")
+("kzps" "")
+("kqx " "")
+("kbdd" "")
+("kbf;" "")
+("kuak" "")
+("kpp " "")
+("kpf;" "")
+("kdtz" "")
+("kcj;" "")
+("kee " "")
+("kd.." "")
+("klvw" "")
+("kos " "")
+("klpf" "")
+("kijf" "")
+("itl;" "")
+("itc " "")
+("jj;h" "")
+("jpyk" "")
+("ja.h" "")
+("kvp " "")
+("krk." "")
+("kky " "")
+("kjr;" "")
+("y;e " "")
+("nmge" "")
+("pl.e" "")
+("jide" "")
+("wce " "")
+("qee " "")
+("odbj" "")
+("zlpc" "")
+("zrp " "")
+("odb " "")
+(";cu " "")
+("ntd;" "")
+(";y " "")
+(";zu " "")
+(";y;d" "")
+("qdqd" "")
+("oo; " "")
+(";xk." "")
+(";qh " "")
+(";at;" "")
+(";pr " "")
+(";;zh" "")
+(";m " "")
+(";xoz" "")
+(";rlf" "")
+(";gft" "")
+(";lox" "@")
+(";bj " "A")
+("zaa;" "B")
+(";ap." "C")
+(";.zd" "D")
+("pqh " "E")
+("pat;" "F")
+("rap." "G")
+("rqh " "H")
+("rpr " "I")
+("rxoz" "J")
+("rzu " "K")
+("alj." "L")
+("zz " "M")
+("xrz " "N")
+(".xz " "O")
+("cclw" "P")
+("whtx" "Q")
+("wgft" "R")
+("w;u " "S")
+("w;gz" "T")
+("wblq" "U")
+("wqdd" "V")
+("wzax" "W")
+("wktl" "X")
+("wj;s" "Y")
+("wlox" "Z")
+("wpr " "[")
+("wpfg" "\")
+("gflx" "]")
+("blqf" "^")
+("nyf " "_")
+("nr; " "`")
+("na. " "a")
+("npw " "b")
+("n;l;" "c")
+("ncu " "d")
+("nkk;" "e")
+("nzax" "f")
+(".fh " "g")
+("bcu " "h")
+("brx " "i")
+("b.fb" "j")
+("dcu " "k")
+("dzkk" "l")
+("dxk." "m")
+("dkk;" "n")
+("dlox" "o")
+("d.f " "p")
+("ld " "q")
+("drjk" "r")
+("djs " "s")
+("irlq" "t")
+("nrjd" "u")
+("lead" "v")
+("nq " "w")
+("nlrb" "x")
+("nkkr" "y")
+("tgkk" "z")
+(".rc " "{")
+(".awq" "|")
+(".iv " "}")
+("irn " "~")
+("aajn" "")
+("aen " "")
+("qshn" "")
+("w;n " "")
+("rkc " "")
+("pzn " "")
+("ljn " "")
+("ncu " "")
+("nat;" "")
+("nv; " "")
+("npaf" "")
+("nosz" "")
+("nktl" "")
+("nk;s" "")
+("nfjf" "")
+("gbb " "")
+("izo " "")
+("fjo " "")
+("i;o " "")
+("ocu " "")
+("ozkk" "")
+("ozax" "")
+("oqh " "")
+("oat;" "")
+("opv " "")
+("opr " "")
+("o;c " "")
+("olrb" "")
+("o;u " "")
+("oj;s" "")
+("ogft" "")
+("okkr" "")
+("oxoz" "")
+("opaf" "")
+("o;le" "")
+("yk.." "")
+(",. " "")
+(",hf " "")
+("ykjh" "")
+("hook" "")
+("prfh" "")
+("axxp" "")
+("pnw " "")
+("pcas" "")
+("pa/ " "")
+("plj;" "")
+("papa" "")
+("ps, " "")
+("trp " "")
+("idu " "")
+("uiz " "")
+("hbu " "")
+("vyk." "")
+("vyxk" "")
+("nwv " "")
+("vqar" "")
+("vapa" "")
+("vtx " "")
+("vrr " "")
+("vr; " "")
+("vbb " "")
+("vzo " "")
+("a/v " "")
+("epv " "")
+("bbbv" "")
+("rvx " "")
+("eqv " "")
+("vjq " "")
+("mqv " "")
+("v.; " "")
+("vs, " "")
+("vov " "")
+("vjzs" "")
+("vir " "")
+("vmm " "")
+("v.ad" "")
+("amov" "")
+("amlp" "")
+(".tgb" "")
+("o, " "")
+("oif " "")
+("onw " "")
+("oyxk" "")
+("opz " "")
+("zc " "")
+("chtx" "")
+("cktl" "")
+("ccu " "")
+("cawq" "")
+("cqh " "")
+("ctjb" "")
+("cosz" "")
+("coo " "")
+("c;u " "")
+("cpr " "@")
+("cec " "A")
+("c.gf" "B")
+("cxk." "C")
+("ckk;" "D")
+("co; " "E")
+("cbjf" "F")
+("cjhn" "G")
+("czkk" "H")
+("cpr " "I")
+("c;ts" "J")
+("cdig" "K")
+(",if " "L")
+(",rk " "M")
+(",rlg" "N")
+(",.; " "O")
+("ame," "P")
+("l, " "Q")
+("k.mm" "R")
+("ofrh" "S")
+(".htx" "T")
+(".zkk" "U")
+(".m " "V")
+(".pr " "W")
+(".;u " "X")
+("yxyx" "Y")
+("arhr" "Z")
+("arzo" "[")
+("arsd" "\")
+("arov" "]")
+("arrr" "^")
+("ar.;" "_")
+("pi " "`")
+("ypjk" "a")
+("yxp " "b")
+("xzp " "c")
+("ohjp" "d")
+("hoz " "e")
+("hajk" "f")
+("hae " "g")
+("htb " "h")
+("hra " "i")
+("hua " "j")
+("h.h " "k")
+("hk. " "l")
+("hb; " "m")
+("hpa " "n")
+("lpzf" "o")
+("tbls" "p")
+("iku " "q")
+("rxu " "r")
+("jzu " "s")
+("jyx " "t")
+("fuak" "u")
+("jtss" "v")
+("jln " "w")
+("ozqt" "x")
+("gai " "y")
+("ge; " "z")
+("gqjd" "{")
+("grx " "|")
+("gtb " "}")
+("gpd " "~")
+("goaa" "")
+("gln " "")
+("gua " "")
+("goe " "")
+("glts" "")
+("yhnl" "")
+("yhz;" "")
+("yhgq" "")
+("ddac" "")
+("yhua" "")
+("yhpd" "")
+("yh;s" "")
+("yhoa" "")
+("yhoe" "")
+("lvai" "")
+("lvva" "")
+("lvjz" "")
+("lvua" "")
+("zlv " "")
+("lvoz" "")
+("lvnl" "")
+("nkoe" "")
+("nkxb" "")
+("ye; " "")
+("ltds" "")
+("llz " "")
+(",kj " "")
+("xh " "")
+("xcl " "")
+("xy. " "")
+("y.x " "")
+("rx " "")
+("fjx " "")
+("xads" "")
+("xgr " "")
+("xqq " "")
+("xlb " "")
+("xaax" "")
+("xjk " "")
+("xoas" "")
+("xkj " "")
+("ofdk" "")
+("/f; " "")
+("ir, " "")
+("fbbb" "")
+("kxbb" "")
+("rlqp" "")
+("fkax" "")
+("fkfd" "")
+("fkts" "")
+("fklq" "")
+("aejs" "")
+("ae, " "")
+("ucas" "")
+("uqp " "")
+("uztg" "")
+("bbbu" "")
+("upz " "")
+("ujq " "")
+("ujzs" "")
+("ul.d" "")
+("u.; " "")
+("u.ok" "")
+("xuqq" "")
+("k,u " "")
+("uif " "")
+("uzag" "")
+("ljzh" "")
+("ljv " "")
+(".o " "")
+("af;s" "")
+("lmys" "")
+("lmh " "")
+("lmzb" "")
+("lmsb" "")
+("ldld" "")
+("fcys" "")
+("fyso" "")
+("fbbb" "")
+("fafe" "")
+("fae " "")
+("fzdf" "")
+("fpf " "")
+("fpz " "")
+("fp; " "")
+("fkar" "")
+("fxx " "")
+("fw; " "")
+("fkv " "")
+("fm; " "")
+("flp " "")
+("fov " "")
+("faak" "")
+("fir " "")
+("ey. " "@")
+("/y. " "A")
+("/hf " "B")
+("/tgd" "C")
+("bhh/" "D")
+("da/ " "E")
+("/f " "F")
+("/kx " "G")
+("/qdl" "H")
+("yplx" "I")
+("y;dx" "J")
+("r;lx" "K")
+("yktk" "L")
+("ykar" "M")
+("ykos" "N")
+("yts " "O")
+("yaf " "P")
+("yfh " "Q")
+("yq " "R")
+("yd " "S")
+("ysf " "T")
+("ylq " "U")
+("yed " "V")
+("yos " "W")
+("yaf " "X")
+("ygds" "Y")
+("dqi " "Z")
+(".fl " "[")
+(".lh " "\")
+("mfl " "]")
+("qm " "^")
+("rcts" "_")
+(".tg " "`")
+("qaf " "a")
+("qjh " "b")
+("qas " "c")
+("zaah" "d")
+("izn " "e")
+("idn " "f")
+(",n " "g")
+("txn " "h")
+("a/n " "i")
+("p;n " "j")
+("s,n " "k")
+("len " "l")
+(".qn " "m")
+("ifn " "n")
+("w;ts" "o")
+("tl;t" "p")
+("rct " "q")
+(";lrt" "r")
+("cap " "s")
+("apts" "t")
+("aplh" "u")
+("iad " "v")
+("if " "w")
+("ie " "x")
+("k.ai" "y")
+("ic " "z")
+("ek " "{")
+("tnas" "|")
+("tq " "}")
+("trc " "~")
+("tqqr" "")
+("tzkk" "")
+("tiv " "")
+("tawq" "")
+("tlfr" "")
+("kyb " "")
+("ibs " "")
+("g, " "")
+("mu " "")
+("y;j;" "")
+("e " "")
+("qjid" "")
+("ox " "")
+("fpfs" "")
+("k.kp" "")
+("khl," "")
+("ky;d" "")
+("ketb" "")
+("kqpw" "")
+("kfz;" "")
+("kf;." "")
+("kt;q" "")
+("ktfb" "")
+("kpm " "")
+("kpax" "")
+("kqqp" "")
+("kem " "")
+("kme " "")
+("kiue" "")
+("kgjf" "")
+("kd.h" "")
+("ky;x" "")
+("kale" "")
+("lpos" "")
+("pj;s" "")
+("slpr" "")
+("iuej" "")
+("qpe " "")
+("rfb " "")
+("bgdb" "")
+("rqkb" "")
+("opb " "")
+("lqp " "")
+("zaas" "")
+("pacq" "")
+("qfz;" "")
+("q;;;" "")
+("qgjf" "")
+("xxx." "")
+("p/b " "")
+("ykj;" "")
+(";olp" "")
+(";oy " "")
+(";a.h" "")
+(";aea" "")
+(";ee " "")
+(";eu " "")
+(";tqd" "")
+(";pp " "")
+(";,, " "")
+("e; " "")
+(";lod" "")
+(";ky " "")
+(";lpf" "")
+(";ign" "")
+("ky; " "")
+(";bbb" "")
+(";es " "")
+(";oaj" "")
+(";gzh" "")
+(";jr;" "")
+(";jo " "")
+("pizs" "")
+("pqax" "")
+("prif" "")
+("rqax" "")
+("qdtr" "")
+("aear" "")
+("rky " "")
+("rlef" "")
+("rlpf" "")
+("rakr" "")
+("cj;r" "")
+("rrlp" "")
+("rifh" "")
+("ry; " "")
+("mml;" "")
+("zrlp" "")
+("aebw" "")
+("p;dw" "")
+("wnms" "")
+("wtjd" "")
+("vvw " "")
+("wtqd" "")
+("wpp " "@")
+("wlpf" "A")
+("woap" "B")
+("ctbw" "C")
+("wrlx" "D")
+("y;gh" "E")
+("naab" "F")
+("napk" "G")
+("nzqd" "H")
+("neab" "I")
+("nkap" "J")
+("nnld" "K")
+("baah" "L")
+("zfh " "M")
+("xmfh" "N")
+("brlp" "O")
+("b.rs" "P")
+("bee " "Q")
+("dnac" "R")
+("dnkq" "S")
+("dzqd" "T")
+("dbdd" "U")
+("dzrr" "V")
+("d.td" "W")
+("dpqq" "X")
+("duu " "Y")
+("dky " "Z")
+("dijf" "[")
+("d.zu" "\")
+("dvkx" "]")
+("djid" "^")
+("wpv " "_")
+("cj;d" "`")
+("rjjd" "a")
+("jdqx" "b")
+("jdky" "c")
+("ntc " "d")
+("ntjf" "e")
+("nr, " "f")
+("nzps" "g")
+("nok " "h")
+("tgqx" "i")
+("tgx/" "j")
+("fft " "k")
+("vv. " "l")
+(".v. " "m")
+("jr;." "n")
+(".pah" "o")
+(".ec " "p")
+(".kkc" "q")
+(".ee " "r")
+(".oaj" "s")
+(".vkk" "t")
+(".cj;" "u")
+("bjfn" "v")
+(";;dn" "w")
+("l,n " "x")
+("kd.n" "y")
+("kjcn" "z")
+("nnms" "{")
+("nykf" "|")
+("nne;" "}")
+("natw" "~")
+("nru " "")
+("nrif" "")
+("nqx " "")
+("nrp " "")
+("nepf" "")
+("njis" "")
+("npl." "")
+("njr;" "")
+("nky " "")
+("nlvf" "")
+("nl.n" "")
+("ny;f" "")
+("zeax" "")
+("aljx" "")
+("g;ts" "")
+("oy;c" "")
+("onkq" "")
+("oizs" "")
+("oykk" "")
+("ojkv" "")
+("oyw " "")
+("oatc" "")
+("ozf " "")
+("obdd" "")
+("orp " "")
+("ozrr" "")
+("ozps" "")
+("oepf" "")
+("otjd" "")
+("orrc" "")
+("oe " "")
+("oky " "")
+("oijf" "")
+("o.jb" "")
+("o.td" "")
+("o.v " "")
+("ol, " "")
+("oee " "")
+("olod" "")
+("oojk" "")
+("oign" "")
+("ogzh" "")
+("oif;" "")
+("ozac" "")
+(",. " "")
+("rh. " "")
+("f,h." "")
+("rlg." "")
+("m. " "")
+("g;. " "")
+("osz." "")
+("iv. " "")
+("v;. " "")
+("at;." "")
+("ivhf" "")
+("jhf " "")
+("qo " "")
+("hooz" "")
+("hogc" "")
+("hoor" "")
+("hobq" "")
+("trpa" "")
+("pj;s" "")
+("pat;" "")
+("pzax" "")
+("posz" "")
+("p.zd" "")
+("qp " "")
+("puab" "")
+("ysmr" "")
+("cjhv" "")
+("vktl" "")
+("vcu " "")
+("vyf " "")
+("vvsh" "")
+("vpaf" "")
+("vbjf" "")
+("vpv " "")
+("vat;" "")
+("vap." "")
+("vafx" "")
+("vlrb" "")
+("zrv " "")
+("vxk." "")
+("vft " "")
+("vosz" "")
+("v.as" "")
+("kd.v" "")
+("lvev" "")
+("lv " "")
+("vnas" "")
+("vf,h" "")
+("kk;k" "")
+(".vhb" "")
+("y;jq" "@")
+("lqfh" "A")
+("oawq" "B")
+("cleb" "C")
+("cy;c" "D")
+("cy;f" "E")
+("cnac" "F")
+("cykk" "G")
+("c,, " "H")
+("ccj;" "I")
+("chkh" "J")
+("cazc" "K")
+("caxx" "L")
+("cru " "M")
+("crak" "N")
+("cvv " "O")
+("czrr" "P")
+("ceab" "Q")
+("cbje" "R")
+("cvkx" "S")
+("czps" "T")
+("cpf;" "U")
+("cpqq" "V")
+("ce " "W")
+("cvo " "X")
+("catw" "Y")
+("crlp" "Z")
+("cgcd" "[")
+("cgzh" "\")
+("c.lr" "]")
+("clod" "^")
+("cijf" "_")
+("cjkv" "`")
+("cky " "a")
+("c.td" "b")
+("c.zu" "c")
+("cwp " "d")
+("cy; " "e")
+("cykf" "f")
+("ca.h" "g")
+("ci " "h")
+("y;g," "i")
+("aea," "j")
+(",paf" "k")
+(",.f " "l")
+(",.zd" "m")
+("z..." "n")
+("yxjf" "o")
+("lvef" "p")
+(".ru " "q")
+(".gfu" "r")
+(".pp " "s")
+(".pv " "t")
+("..td" "u")
+("yx,f" "v")
+("arhx" "w")
+("arqt" "x")
+("arfh" "y")
+("arpr" "z")
+("arjs" "{")
+("arle" "|")
+("zaak" "}")
+("ifqh" "~")
+("aajh" "")
+("af;a" "")
+("nor " "")
+("p.; " "")
+("prr " "")
+("pff " "")
+("prk " "")
+("gezo" "")
+("hrfh" "")
+("htx " "")
+("heq " "")
+("hir " "")
+("hztg" "")
+("lpy." "")
+("z,u " "")
+("i;u " "")
+("zgxu" "")
+("izj " "")
+("/kkk" "")
+("jtx " "")
+("jqar" "")
+("jxof" "")
+("js, " "")
+("gzo " "")
+("gov " "")
+("gafe" "")
+("yhif" "")
+("a/ac" "")
+("maac" "")
+("lvmm" "")
+("nkar" "")
+("nks," "")
+("ly " "")
+("lva " "")
+("lpf " "")
+("ltgl" "")
+("lkfh" "")
+("lor " "")
+("lx; " "")
+("loe " "")
+(",y " "")
+(",ua " "")
+(",lp " "")
+("xi " "")
+("xyx " "")
+("xzs " "")
+("vsx " "")
+("xj; " "")
+("xtge" "")
+("xdd " "")
+("xp " "")
+("xpd " "")
+("xua " "")
+("px " "")
+("x.h " "")
+("xrs " "")
+("xz.h" "")
+("ofda" "")
+("irlr" "")
+("ifib" "")
+("bby " "")
+("ibbb" "")
+("bblp" "")
+("fke " "")
+("aeoj" "")
+("aeib" "")
+("uqh " "")
+("ufjf" "")
+("zaau" "")
+("uk;s" "")
+("kd.u" "")
+("uqi " "")
+("uzax" "")
+("zo " "")
+("lmnq" "")
+("lmyx" "")
+("lmlp" "")
+("lmk;" "")
+("fccl" "")
+("fnas" "")
+("fyf " "")
+("ffjf" "")
+("fzkk" "")
+("fawq" "")
+("fzhf" "")
+("fpz " "")
+("f;l;" "")
+("fxr " "")
+("fosz" "")
+("flve" "")
+("flvg" "")
+("fkqd" "")
+("f., " "")
+("fiv " "")
+("fqh " "@")
+("fjs " "A")
+("e.s " "B")
+("es. " "C")
+("/nq " "D")
+("/yr " "E")
+("/ra " "F")
+("/f; " "G")
+("/qd " "H")
+("/ua " "I")
+("gc/ " "J")
+("/oe " "K")
+("/oa " "L")
+("/ib " "M")
+(".vhd" "N")
+("yk;x" "O")
+("b;yx" "P")
+("yktb" "Q")
+("ykpa" "R")
+("ykpf" "S")
+("ykls" "T")
+("kaxx" "U")
+(".js " "V")
+("zjs " "W")
+("yh " "X")
+("yqdl" "Y")
+("ytk " "Z")
+("yjk " "[")
+("yof " "\")
+("ysb " "]")
+("ykx " "^")
+("ykq " "_")
+("yo " "`")
+("qifb" "a")
+("ua. " "b")
+("mzb " "c")
+("rm " "d")
+("sfm " "e")
+("kqm " "f")
+("igm " "g")
+("kjm " "h")
+("rcjb" "i")
+("rc. " "j")
+("se " "k")
+("sz " "l")
+("qzgs" "m")
+("qjk " "n")
+("yn " "o")
+("cun " "p")
+("bjfn" "q")
+("qin " "r")
+("qn " "s")
+("v;n " "t")
+("oon " "u")
+("a.n " "v")
+("awqn" "w")
+(";lrn" "x")
+("o;n " "y")
+("lvln" "z")
+(".fn " "{")
+(".,n " "|")
+(".arn" "}")
+("ivn " "~")
+("y;t " "")
+("y;gt" "")
+("rlpt" "")
+("ap.d" "")
+("prbd" "")
+("ibh " "")
+("i; " "")
+("ilh " "")
+("ied " "")
+("iq " "")
+("ish " "")
+("efl " "")
+("ty; " "")
+("trk." "")
+("tvp " "")
+("trkr" "")
+("titx" "")
+("tlpf" "")
+("tlod" "")
+("tjo " "")
+("taeb" "")
+("cky " "")
+("zt " "")
+("zaag" "")
+("ypf " "")
+("yps " "")
+("adam" "")
+("qalm" "")
+("u, " "")
+("l, " "")
+("ep.h" "")
+("yqq " "")
+("fkkm" "")
+("nvv " "")
+("kna." "")
+("kykh" "")
+("kqhh" "")
+("krlf" "")
+("kmqv" "")
+("kox " "")
+("kit;" "")
+("kkkf" "")
+("kyk." "")
+("paeb" "")
+("dqis" "")
+("nr;e" "")
+("dqie" "")
+("itle" "")
+("lvee" "")
+(",,jb" "")
+("uizb" "")
+(";mb " "")
+("fqhh" "")
+("zidk" "")
+("ykj;" "")
+(";n.;" "")
+(";naa" "")
+(";ykd" "")
+(";zqx" "")
+(";pls" "")
+(";dae" "")
+(";pax" "")
+("r;i;" "")
+("f;;x" "")
+(";bar" "")
+(";v;e" "")
+(";rsv" "")
+(";fjf" "")
+(";vpa" "")
+(";;pf" "")
+(";pu " "")
+(";of " "")
+(";xlh" "")
+(";jjz" "")
+(";iue" "")
+("lz;;" "")
+(";zpr" "")
+(";lv," "")
+(";ktz" "")
+(";fjz" "")
+(";w. " "")
+("pt;q" "")
+("rrrs" "")
+("rrqk" "")
+("rpa." "")
+("rpac" "")
+("rqpw" "")
+("rifb" "")
+("k;vr" "")
+("rm; " "")
+("rktz" "")
+("vqi " "")
+("vea " "")
+("ipz " "")
+("wy;d" "@")
+("wbj " "A")
+("wgcu" "B")
+("wrav" "C")
+("w.ab" "D")
+("wm; " "E")
+("ixxf" "F")
+("bgff" "G")
+("nrkh" "H")
+("nqp " "I")
+("npm " "J")
+("nxav" "K")
+("ipfh" "L")
+("tq;h" "M")
+("y;ch" "N")
+("drak" "O")
+("dx " "P")
+("dzax" "Q")
+("lvzd" "R")
+("tstk" "S")
+("jdqp" "T")
+("jdpj" "U")
+("jdem" "V")
+("jdtq" "W")
+("xxzx" "X")
+("nhbt" "Y")
+("nme " "Z")
+("nvj " "[")
+("nbsb" "\")
+("tgag" "]")
+("r;i." "^")
+(".op." "_")
+("..fj" "`")
+(".lpr" "a")
+("qaxn" "b")
+("aean" "c")
+("een " "d")
+("en " "e")
+("zn " "f")
+("nqzk" "g")
+("n/h " "h")
+("npor" "i")
+("n;;g" "j")
+("nzqu" "k")
+("nme " "l")
+("ndae" "m")
+("nbqs" "n")
+("nwl." "o")
+("nop." "p")
+("nlpr" "q")
+("niue" "r")
+("nlv," "s")
+("npls" "t")
+("fpfx" "u")
+("gee " "v")
+("oajo" "w")
+("cj;o" "x")
+("ofp " "y")
+("ov/ " "z")
+("oqqp" "{")
+("obgv" "|")
+("obaz" "}")
+("ozaz" "~")
+("oafo" "")
+("odae" "")
+("opac" "")
+("obar" "")
+("o;ae" "")
+("opls" "")
+("ojq " "")
+("oof " "")
+("o.ab" "")
+("olv," "")
+("ojjz" "")
+("obif" "")
+("opa." "")
+("oequ" "")
+("cj;." "")
+("y;g." "")
+("qe. " "")
+("ru. " "")
+("aryr" "")
+("eey." "")
+("rako" "")
+("icap" "")
+("pvo " "")
+("pru " "")
+("ppp " "")
+("py;c" "")
+("prlp" "")
+("oz;p" "")
+("py;c" "")
+("p.k;" "")
+("k/p " "")
+("zzp " "")
+("raku" "")
+("fpfu" "")
+("vne " "")
+("vnac" "")
+("cj;v" "")
+("vjvj" "ƴ")
+("vzqd" "")
+("vvp " "")
+("vpv " "")
+("vvv " "")
+("vaxx" "")
+("vepf" "")
+("vzf " "")
+("vatw" "")
+("vtc " "")
+("vrak" "")
+("vpqq" "")
+("vfua" "")
+("veab" "")
+("vky " "")
+("vlpd" "")
+("vuu " "")
+("vrlp" "")
+("fkjv" "")
+("raak" "")
+("rakk" "")
+("ijk " "")
+("amax" "")
+("amfa" "")
+("vasb" "")
+("lq,," "")
+("o,, " "")
+("owc " "")
+("oaea" "")
+("crks" "")
+("chof" "")
+("ciue" "")
+("cnrb" "")
+("cnaa" "")
+("cbjb" "")
+("czaz" "")
+("cqtv" "")
+("cbar" "")
+("cvpa" "")
+("czqx" "")
+("crqk" "")
+("cvj " "")
+("cfjb" "")
+("cf;u" "")
+("ca/r" "")
+("cpu " "")
+("cm; " "")
+("cpa." "")
+("cpls" "")
+("cdae" "")
+("cjcl" "")
+("cme " "")
+("coaf" "")
+("ciue" "")
+("cjq " "")
+("cixx" "")
+("cbqs" "@")
+("cjjz" "A")
+("cale" "B")
+("ctsp" "C")
+("cbj " "D")
+("c.ab" "E")
+("cop " "F")
+("clpr" "G")
+(",y; " "H")
+("vv, " "I")
+("ky, " "J")
+(",jo " "K")
+("or, " "L")
+("mzh," "M")
+("rlp," "N")
+(",pqq" "O")
+("dlpf" "P")
+("ofzd" "Q")
+("bcof" "R")
+(".ip " "S")
+(".pax" "T")
+(".ktz" "U")
+(".por" "V")
+("arcx" "W")
+("arrk" "X")
+("arvv" "Y")
+("arah" "Z")
+("ares" "[")
+("araq" "\")
+("aras" "]")
+("arag" "^")
+("arne" "_")
+("arjv" "`")
+("arzd" "a")
+("arpq" "b")
+("orpb" "c")
+("ap.r" "d")
+("trpa" "e")
+("l,p " "f")
+("hlve" "g")
+("hbjf" "h")
+("hrn " "i")
+("hawq" "j")
+("hqi " "k")
+("hz; " "l")
+("hxk." "m")
+("bqi " "n")
+("btgb" "o")
+("lpns" "p")
+("lpo;" "q")
+("xk.b" "r")
+("cjku" "s")
+("jpv " "t")
+("ozqi" "u")
+("gcu " "v")
+("gap." "w")
+("gjs " "x")
+("lvcu" "y")
+("lvpf" "z")
+("lv;r" "{")
+("lvks" "|")
+("lv.d" "}")
+("nkt;" "~")
+("nklh" "")
+("nko;" "")
+("ypr " "")
+("yxk." "")
+("lrfh" "")
+("lvj " "")
+("ltf " "")
+("lqar" "")
+("ljq " "")
+("li; " "")
+("llp " "")
+("lub " "")
+("lkax" "")
+("lqsh" "")
+("a/, " "")
+("tg,g" "")
+("xyk." "")
+("xr; " "")
+("xafx" "")
+("xjts" "")
+("eqx " "")
+("w;x " "")
+("xx " "")
+("x.; " "")
+("xi; " "")
+("xlp " "")
+("xaxr" "")
+("x.q " "")
+("iri;" "")
+("ifbb" "")
+("i;bb" "")
+("rlqr" "")
+("ael;" "")
+("tde " "")
+("unms" "")
+("unkq" "")
+("uykk" "")
+("unkh" "")
+("qdtu" "")
+("uqx " "")
+("ujrk" "")
+("ulpf" "")
+("uzps" "")
+("uee " "")
+("uok " "")
+("if;d" "")
+(".jmq" "")
+("fy; " "")
+("fykf" "")
+("fhkh" "")
+("fcai" "")
+("fctb" "")
+("fne " "")
+("fatw" "")
+("fru " "")
+("faff" "")
+("frk." "")
+("fzps" "")
+("frlp" "")
+("fvkk" "")
+("fgfk" "")
+("fpu " "")
+("fplv" "")
+("feab" "")
+("fee " "")
+("fl, " "")
+("fok " "")
+("flvw" "")
+("flod" "")
+("f.v " "")
+("fqx " "")
+("fujb" "")
+("fj;h" "")
+("ewa " "")
+("/yk." "")
+("/rr " "")
+("/axr" "")
+("/p; " "")
+("/ov " "")
+("/i; " "")
+("/pf " "")
+("/lf;" "")
+(".rrd" "")
+("rylx" "")
+("amex" "")
+("ykkh" "")
+("a/pf" "")
+("yhjs" "")
+("yyr " "")
+("yhb " "")
+("yai " "")
+("ygq " "")
+("yae " "")
+("yf; " "")
+("yj; " "@")
+("yua " "A")
+("yoe " "B")
+("yoaa" "C")
+("yoh " "D")
+("yk. " "E")
+("yqd " "F")
+("ytb " "G")
+("jp. " "H")
+(".j; " "I")
+("mnad" "J")
+("me; " "K")
+("aaax" "L")
+("mx; " "M")
+("ffm " "N")
+("tgem" "O")
+("b;m " "P")
+(";dam" "Q")
+("/m " "R")
+("mln " "S")
+("ohjm" "T")
+("kaxm" "U")
+("rcqx" "V")
+("rcj;" "W")
+("rck." "X")
+("snq " "Y")
+("sqt " "Z")
+("sz.h" "[")
+("sjf " "\")
+("slts" "]")
+("soz " "^")
+("stb " "_")
+("sx; " "`")
+("qqd " "a")
+("qpf " "b")
+("qoz " "c")
+("f;yf" "d")
+("tcn " "e")
+("rkrn" "f")
+("jr;n" "g")
+("j;sn" "h")
+("kyn " "i")
+("lvwn" "j")
+(";;at" "k")
+("oft " "l")
+("sxht" "m")
+("qpwt" "n")
+("apra" "o")
+("aplv" "p")
+("papr" "q")
+("icl " "r")
+("igr " "s")
+("iaeg" "t")
+("ijk " "u")
+("ilaa" "v")
+("iads" "w")
+("iig " "x")
+("iz " "y")
+("izb " "z")
+("ey. " "{")
+("ear " "|")
+("eaf " "}")
+("ev " "~")
+("ep " "")
+("eu " "")
+("ezx " "")
+("ti. " "")
+("tqqp" "")
+("tzqu" "")
+("tpa." "")
+("tpm " "")
+("t.ar" "")
+("tlpr" "")
+("tof " "")
+("tpac" "")
+("zkky" "")
+("qdly" "")
+("zxky" "")
+("kyv " "")
+("gky " "")
+("zy. " "")
+("zaax" "")
+("t;qh" "")
+("qalm" "")
+("edam" "")
+(".alm" "")
+("mitx" "")
+("ibar" "")
+("ibzb" "")
+("ibas" "")
+("ibjk" "")
+("ibob" "")
+("kg, " "")
+("g,b " "")
+("rpk " "")
+("lvkc" "")
+("p, " "")
+(".bms" "")
+("kntf" "")
+("krm " "")
+("krh." "")
+("kzfh" "")
+("krr " "")
+("kqam" "")
+("kdky" "")
+("kop." "")
+("klp." "")
+("klpn" "")
+("kbb." "")
+("wpve" "")
+("nore" "")
+("a/ae" "")
+("fpzb" "")
+("wpvb" "")
+("rrb " "")
+("rkrb" "")
+("rmb " "")
+("qcky" "")
+(";irq" "")
+(";coz" "")
+(";bbv" "")
+(";fjx" "")
+(";g, " "")
+(";rlp" "")
+("fkk;" "")
+(";rxu" "")
+(";jfq" "")
+(";da/" "")
+(";pzn" "")
+(";l, " "")
+(";kxb" "")
+(";ljh" "")
+(";it;" "")
+(";lpf" "")
+(";rx " "")
+("pr;x" "")
+("p;m " "")
+("nrkr" "")
+("idur" "")
+("rnt;" "")
+("civr" "")
+("rjah" "")
+("rfi;" "")
+("rfuk" "")
+("rpbb" "")
+("r/u " "")
+("rox " "")
+("rl, " "")
+("rprh" "")
+(",,jr" "")
+("ljlz" "")
+("wna." "")
+("whoz" "")
+("witc" "")
+("wrjr" "")
+("wg, " "")
+("w/u " "")
+("wljn" "@")
+("wodb" "A")
+("wlpq" "B")
+("dy;;" "C")
+("dirq" "D")
+("jdps" "E")
+("fpff" "F")
+("nitc" "G")
+("nal." "H")
+(".vhx" "I")
+("wjpv" "J")
+(".ykh" "K")
+("os. " "L")
+("pmn " "M")
+("ypn " "N")
+("ixxn" "O")
+("zqnx" "P")
+("vjn " "Q")
+(".jn." "R")
+("fz;n" "S")
+("lv,n" "T")
+("iuen" "U")
+("nfuk" "V")
+("nfyo" "W")
+("na/v" "X")
+("n/u " "Y")
+("no, " "Z")
+("nit;" "[")
+("nox " "\")
+("tsan" "]")
+(".can" "^")
+("ndqi" "_")
+("rqkx" "`")
+(";aex" "a")
+("oirq" "b")
+("onke" "c")
+("oy;;" "d")
+("ont;" "e")
+("ofi;" "f")
+("ofkv" "g")
+("olmb" "h")
+("oqhh" "i")
+("oodb" "j")
+("obh/" "k")
+("o;m " "l")
+("oit;" "m")
+("omod" "n")
+("old " "o")
+("orjr" "p")
+("fl;." "q")
+("rqkf" "r")
+("yvo " "s")
+("pyp " "t")
+("pjq " "u")
+("petb" "v")
+("pjq " "w")
+("p.ab" "x")
+("pnaa" "y")
+("ppa." "z")
+("ppls" "{")
+("i/p " "|")
+("vhbt" "}")
+("caiv" "~")
+("vvgc" "")
+("vqqp" "")
+("vfjf" "")
+("vfjz" "")
+("vaga" "")
+("vaet" "")
+("vbqs" "")
+("vpa." "")
+("vem " "")
+("v;ae" "")
+("v/h " "")
+("vx " "")
+("vlgu" "")
+("viue" "")
+("vv/ " "")
+("vbj " "")
+("vff;" "")
+("plkk" "")
+("ezax" "")
+("orsb" "")
+("brkb" "")
+("oszo" "")
+("lqtb" "")
+("ciku" "")
+("cidu" "")
+("cnyf" "")
+("cnk;" "")
+("cykh" "")
+("czlc" "")
+("crjr" "")
+("cfuk" "")
+("czax" "")
+("cqhh" "")
+("crxu" "")
+("caxr" "")
+("ctgk" "")
+("c/u " "")
+("cmu " "")
+("ckyf" "")
+("cohp" "")
+("cit;" "")
+("c.o " "")
+("c.xz" "")
+("ca/v" "")
+("cljh" "")
+("iue," "")
+(",a/r" "")
+(",alm" "")
+(",rav" "")
+(",v/ " "")
+("pj;," "")
+(",py " "")
+(",pa." "")
+("pl;," "")
+(",lpr" "")
+(",jjz" "")
+("jt.," "")
+(",etb" "")
+(",pax" "")
+(",.ab" "")
+("k.at" "")
+("drsv" "")
+("ipzh" "")
+(".led" "")
+(".r;x" "")
+(".mu " "")
+("arht" "")
+("arfu" "")
+("areb" "")
+("aral" "")
+("arde" "")
+("arpj" "")
+("arjq" "")
+("arw." "")
+("arfz" "")
+("arie" "")
+("cj;p" "")
+("pzqd" "")
+("hhkh" "")
+("h,, " "")
+("hykf" "")
+("hvv " "")
+("hee " "")
+("hlpf" "")
+("hlvw" "")
+("hoz;" "")
+("hvv " "")
+("axau" "")
+("puu " "")
+("jru " "")
+("jatc" "")
+("jrkr" "")
+("jvkk" "")
+("eacj" "")
+("jrlp" "@")
+("/rif" "A")
+("j.v " "B")
+("j.td" "C")
+("jlpf" "D")
+("jos " "E")
+("jky " "F")
+("ozlw" "G")
+("gykf" "H")
+("gica" "I")
+("gnms" "J")
+("gjrk" "K")
+("gwc " "L")
+("gjr;" "M")
+("guu " "N")
+("glpf" "O")
+("gky " "P")
+("gnkq" "Q")
+("yhrk" "R")
+("yhwc" "S")
+("vvac" "T")
+("fpm " "U")
+("ky.m" "V")
+("lvr." "W")
+("lvky" "X")
+("lvj;" "Y")
+("lvin" "Z")
+("yp;v" "[")
+("lvpv" "\")
+("nkbd" "]")
+("nkpv" "^")
+("lntk" "_")
+("lbj " "`")
+("lrla" "a")
+("lqkk" "b")
+("ljs " "c")
+("cjh," "d")
+(",ap." "e")
+("lplg" "f")
+("xawq" "g")
+("x;u " "h")
+("xpv " "i")
+("xft " "j")
+("x.w " "k")
+("kd.x" "l")
+("/fua" "m")
+("/epf" "n")
+("/ee " "o")
+("/rlp" "p")
+("irlx" "q")
+("irck" "r")
+("tl;f" "s")
+("ae;r" "t")
+("aepg" "u")
+("ztf " "v")
+("qozf" "w")
+("utfb" "x")
+("ua/w" "y")
+("upa." "z")
+("upor" "{")
+("upn " "|")
+("ukkj" "}")
+("uop " "~")
+("uop." "")
+("ulpc" "")
+("uwl." "")
+("opb " "")
+("lmlb" "")
+("fykd" "")
+("fjq " "")
+("fc.;" "")
+("fnaa" "")
+("fbaz" "")
+("ft;q" "")
+("ff;u" "")
+("frsv" "")
+("famf" "")
+("fpls" "")
+("f;;g" "")
+("fm; " "")
+("flqh" "")
+("fop " "")
+("flps" "")
+("fetb" "")
+("fk;v" "")
+("e;gz" "")
+("epdb" "")
+(";ags" "")
+("/bjf" "")
+("/lrb" "")
+("/;gz" "")
+("oo/ " "")
+("/l/ " "")
+("/lox" "")
+("/k;s" "")
+("/.f " "")
+("zaa/" "")
+("/js " "")
+("/lve" "")
+(".atd" "")
+("cclx" "")
+("ylx;" "")
+("ykt;" "")
+("ykqh" "")
+("f,hx" "")
+("xryx" "")
+("ykpr" "")
+("lylx" "")
+("ykk;" "")
+("yolx" "")
+("s,js" "")
+("jjof" "")
+("ynlq" "")
+("yyxk" "")
+("yif " "")
+("yaqx" "")
+("yrfh" "")
+("yr; " "")
+("yzag" "")
+("yz, " "")
+("yqp " "")
+("yzgx" "")
+("ylf;" "")
+("yov " "")
+("yjzs" "")
+("ylp " "")
+("yir " "")
+("y.q " "")
+("jzky" "")
+("y.; " "")
+("eqy " "")
+("yyk." "")
+("iza." "")
+(".alp" "")
+("..; " "")
+("mafx" "")
+("aajm" "")
+("a/m " "")
+("mzu " "")
+("eqm " "")
+("karm" "")
+("m.; " "")
+("myxk" "")
+("syc " "")
+("stx " "")
+("szag" "")
+("s.; " "")
+("ss, " "")
+("ssv " "")
+("sjzs" "")
+("syk." "")
+("sov " "")
+(".sv " "")
+("qyk." "")
+("rqx " "")
+("qaqx" "")
+("qaxr" "")
+("b;yf" "@")
+("pfzx" "A")
+("jqn " "B")
+("hogn" "C")
+("iljn" "D")
+("i.n " "E")
+("rifn" "F")
+("qpn " "G")
+("t;qn" "H")
+("etbn" "I")
+("pmn " "J")
+("plkn" "K")
+("m;n " "L")
+("gjfn" "M")
+("lpan" "N")
+("iuen" "O")
+(".fjn" "P")
+("ldlt" "Q")
+("y;jt" "R")
+("apad" "S")
+("ap.;" "T")
+("apm;" "U")
+(".vpf" "V")
+("if; " "W")
+("ira " "X")
+("iz.h" "Y")
+("izjd" "Z")
+("ipd " "[")
+("ipf " "\")
+("ik; " "]")
+("ilts" "^")
+("il; " "_")
+("ilp " "`")
+("iib " "a")
+("iyx " "b")
+("inl " "c")
+("iqt " "d")
+("itb " "e")
+("ip " "f")
+("iodj" "g")
+("epd " "h")
+("tiku" "i")
+("tqjd" "j")
+("t;m " "k")
+("ysxy" "l")
+("kyd " "m")
+("ozky" "n")
+("l;ky" "o")
+("zp " "p")
+("zps " "q")
+("zlts" "r")
+("zib " "s")
+("yru " "t")
+("rfkq" "u")
+("rfts" "v")
+("bgdm" "w")
+("aasm" "x")
+("adsm" "y")
+("aram" "z")
+("kjam" "{")
+("kxam" "|")
+("ibgq" "}")
+("ibx;" "~")
+("ibls" "")
+("ibod" "")
+("g,gs" "")
+("g,z " "")
+("g,ed" "")
+("z.as" "")
+("lsl," "")
+("yqqs" "")
+("jg " "")
+("r;ib" "")
+("ow " "")
+("kk/p" "")
+("kypr" "")
+("krrs" "")
+("kr;;" "")
+("kqsp" "")
+("kzkc" "")
+("kcaz" "")
+("kjp." "")
+("klz;" "")
+("kgky" "")
+("ktsk" "")
+("keu " "")
+("f;ss" "")
+("bqis" "")
+("trpe" "")
+("zide" "")
+("q;dm" "")
+("zpuh" "")
+(";hoz" "")
+(";yk;" "")
+(";nvv" "")
+("cj;p" "")
+(";v;k" "")
+(";q;;" "")
+(";rz " "")
+("r;i;" "")
+(";p;w" "")
+(";alx" "")
+(";rh." "")
+(";rm " "")
+(";rlt" "")
+(";qp " "")
+(";bb." "")
+(";pff" "")
+("pzfh" "")
+("p;y;" "")
+("yqqr" "")
+("y;gr" "")
+("ryps" "")
+("fpzr" "")
+("rifr" "")
+("qor " "")
+("prbr" "")
+("rz.." "")
+("rgqh" "")
+("pvmm" "")
+("f/jm" "")
+("mnak" "")
+("zkyh" "")
+("zq;;" "")
+("wyk;" "")
+("wcjd" "")
+("wv;." "")
+("wq;;" "")
+("wa/c" "")
+("wpx " "")
+("wae," "")
+("ohdf" "")
+("nfpz" "")
+("nnud" "")
+("nalj" "")
+("nbb." "")
+("nsfm" "")
+("nrkv" "")
+("nxtb" "")
+("nxa;" "")
+("nmac" "")
+("caih" "")
+("bp;w" "")
+("dqo " "")
+("dq;;" "")
+("jdyf" "")
+(",.jd" "")
+("fpzd" "")
+("jdpx" "")
+("jdpb" "")
+("ny;t" "")
+("nbb." "")
+(",.f " "")
+(",.tg" "")
+("ypf." "")
+(".zu." "")
+(".tgn" "")
+("zlpn" "@")
+("xuqn" "A")
+("nntc" "B")
+("np/b" "C")
+("nsfm" "D")
+("nopb" "E")
+("nqo " "F")
+("nxx." "G")
+("nntf" "H")
+("rkyx" "I")
+("o,. " "J")
+("oyk;" "K")
+("oyxf" "L")
+("ozu." "M")
+("ofpz" "N")
+("op;w" "O")
+("obbp" "P")
+("opqx" "Q")
+("odky" "R")
+("nrko" "S")
+("onr," "T")
+("oxx." "U")
+("y;jb" "V")
+("fpff" "W")
+("hork" "X")
+("hozd" "Y")
+("pdp." "Z")
+("bqsa" "[")
+("pjpk" "\")
+("vykh" "]")
+("vnke" "^")
+("vnk;" "_")
+("vy;;" "`")
+(",,jv" "a")
+("vqm " "b")
+("vrjr" "c")
+("vzlv" "d")
+("vjky" "e")
+("vpbb" "f")
+("vkyf" "g")
+("vohp" "h")
+("vox " "i")
+("vit;" "j")
+("v.fh" "k")
+("vlen" "l")
+("fpfv" "m")
+("lmsv" "n")
+("vmod" "o")
+("itck" "p")
+("qdqk" "q")
+("o/u " "r")
+("cypf" "s")
+("cnak" "t")
+("cykx" "u")
+("cy.m" "v")
+("cyk;" "w")
+("choc" "x")
+("cirb" "y")
+("cfpz" "z")
+("crm " "{")
+("cbz " "|")
+("ca/c" "}")
+("crz " "~")
+("crjk" "")
+("crjd" "")
+("cvkc" "")
+("cv;k" "")
+("cqo " "")
+("ctgx" "")
+("cqn " "")
+("cqp " "")
+("cp/b" "")
+("cpx " "")
+("czu." "")
+("c.zd" "")
+("cg;s" "")
+("cu, " "")
+("cxx." "")
+("ckdv" "")
+("ceph" "")
+(",nk;" "")
+("qd;," "")
+(",gbb" "")
+("xuq," "")
+(",ljn" "")
+(",,j," "")
+("akj." "")
+("ofy;" "")
+(",,jf" "")
+(".yzh" "")
+(".ypf" "")
+("armd" "")
+("arcm" "")
+("arg," "")
+("arox" "")
+("arn;" "")
+("a/rh" "")
+("qozc" "")
+("heqa" "")
+("hpa." "")
+("hx " "")
+("hiue" "")
+("hjjz" "")
+("tdau" "")
+("qdtu" "")
+("jfp " "")
+("jbaz" "")
+("ejaj" "")
+("jof " "")
+("gixx" "")
+("grsv" "")
+("arlg" "")
+("gdz," "")
+("galm" "")
+("gpls" "")
+("yhem" "")
+("yhqp" "")
+("yhm;" "")
+("lvop" "")
+("lv.r" "")
+("nkcr" "")
+("nkm;" "")
+("ypls" "")
+("ydae" "")
+("lne " "")
+("lrak" "")
+("laxx" "")
+("lleb" "")
+("ljf " "")
+("lora" "")
+("lclp" "")
+("l.td" "")
+("lrlp" "")
+("lpf;" "")
+("llpf" "")
+(",ykf" "")
+(",nac" "")
+(",ru " "")
+("xnac" "")
+("xne " "")
+("xnac" "")
+("xepf" "")
+("xrk." "")
+("xwc " "")
+("qdtx" "")
+("xbbb" "")
+("xjis" "")
+("xjid" "")
+("xzqd" "")
+("xjr;" "")
+("xlpd" "")
+("x.v " "")
+("xijf" "")
+("xky " "")
+("xrlp" "")
+("xwp " "")
+("x.jb" "")
+("/ye " "@")
+("bbyf" "A")
+("eebb" "B")
+("bbky" "C")
+("eae " "D")
+("aebk" "E")
+("g.tf" "F")
+("nkfk" "G")
+("uykh" "H")
+("y;ju" "I")
+("uqjd" "J")
+("uqhh" "K")
+("utxn" "L")
+("hoou" "M")
+("zszx" "N")
+("r;jr" "O")
+("ozak" "P")
+("af;c" "Q")
+("ormq" "R")
+("lmgu" "S")
+("fnk;" "T")
+("fy;;" "U")
+("fnrd" "V")
+("fyxp" "W")
+("fja." "X")
+("fcky" "Y")
+("fcqh" "Z")
+("faac" "[")
+("frxu" "\")
+("fgc," "]")
+("fgfx" "^")
+("fky;" "_")
+("fox " "`")
+("fit;" "a")
+("fypx" "b")
+("fkxb" "c")
+("/nms" "d")
+("nnl/" "e")
+("/ru " "f")
+("/gfu" "g")
+("/vo " "h")
+("/pl." "i")
+("/oz;" "j")
+("ib/ " "k")
+("/izs" "l")
+("/jr;" "m")
+("cj;x" "n")
+("ykrc" "o")
+("eeyx" "p")
+("ypvx" "q")
+("ykpv" "r")
+("oajx" "s")
+("yklf" "t")
+("ykrp" "u")
+("ykj;" "v")
+("ybjf" "w")
+("yrn " "x")
+("yat;" "y")
+("yqkk" "z")
+("yjhn" "{")
+("yafx" "|")
+("ooy " "}")
+("y;gz" "~")
+("yk;s" "")
+("yo; " "")
+("yosz" "")
+("ylvg" "")
+("y.ar" "")
+("ycu " "")
+("yqh " "")
+("y;j." "")
+(".pr " "")
+(".lps" "")
+("nacm" "")
+("mzax" "")
+("miac" "")
+("rcrc" "")
+("rccu" "")
+("rcpf" "")
+("sbg;" "")
+("qqh " "")
+("qaes" "")
+("qawq" "")
+("qj;s" "")
+("yfv;" "")
+("r;ln" "")
+("rjrn" "")
+("gfln" "")
+(";dan" "")
+("mofn" "")
+(".esn" "")
+("pbbn" "")
+("/cn " "")
+("ohjn" "")
+(";ypt" "")
+("ntjt" "")
+("rrt " "")
+("aprf" "")
+("apx." "")
+("apo;" "")
+("apiv" "")
+("iyk." "")
+("itx " "")
+("ijq " "")
+("im; " "")
+("iov " "")
+("i.; " "")
+("iir " "")
+(".iad" "")
+("inw " "")
+("iif " "")
+("ios " "")
+("eyxk" "")
+("err " "")
+("e/ " "")
+("e.; " "")
+("ekax" "")
+("ei; " "")
+("tclc" "")
+("typf" "")
+("tmac" "")
+("eqky" "")
+(".;ky" "")
+("zale" "")
+("rfpa" "")
+("rfjz" "")
+("ypj;" "")
+("tbam" "")
+("ibam" "")
+("yx " "")
+("xx; " "")
+("iby." "")
+("ibif" "")
+("ibae" "")
+("ibl;" "")
+("g,.." "")
+("muys" "")
+("musb" "")
+("z.lq" "")
+("oxhf" "")
+("aaxx" "")
+(";l, " "")
+("axl," "")
+("sal," "")
+("nvvx" "")
+("ljpe" "")
+("ykde" "")
+("kypn" "")
+("kirx" "")
+("kb;f" "")
+("kapa" "")
+("ka/m" "")
+("kpfx" "")
+("ki/p" "")
+("ki;k" "")
+("kcjp" "")
+("kypv" "")
+("ea.e" "@")
+("b;yj" "A")
+("ohje" "B")
+("i;;e" "C")
+("i/pe" "D")
+("bbbn" "E")
+("zfpm" "F")
+(";,,b" "G")
+(";r;;" "H")
+(";zkc" "I")
+(";fpu" "J")
+(";p, " "K")
+(";eqj" "L")
+(";faf" "M")
+(";ewa" "N")
+(";vqi" "O")
+(";caz" "P")
+(";ffm" "Q")
+(";rao" "R")
+(";tde" "S")
+(";xxx" "T")
+("rbcf" "U")
+("rewa" "V")
+("rk/p" "W")
+("rffm" "X")
+("ti.r" "Y")
+("tzqr" "Z")
+("ry;." "[")
+("rl,p" "\")
+("zalp" "]")
+("wr;;" "^")
+("wev " "_")
+("w;;f" "`")
+("wor," "a")
+("wlz;" "b")
+("wrrs" "c")
+("nzkc" "d")
+("nfjh" "e")
+("nl,p" "f")
+("nol," "g")
+("bk/p" "h")
+("b.o." "i")
+("dbqi" "j")
+("dijk" "k")
+("jdyr" "l")
+("jdyx" "m")
+("jdlp" "n")
+("nbtb" "o")
+("nr;h" "p")
+("nfpu" "q")
+("nrao" "r")
+("nrpk" "s")
+("ncj." "t")
+("tg;f" "u")
+("py;." "v")
+(".f/n" "w")
+("olr." "x")
+("ygn." "y")
+("fftn" "z")
+("epn " "{")
+("qfzn" "|")
+("fpzc" "}")
+("alu." "~")
+("zean" "")
+("baan" "")
+(".kkn" "")
+("kk;n" "")
+("nypr" "")
+("n,mq" "")
+("ney." "")
+("nk/p" "")
+("npyc" "")
+("n;;f" "")
+("nffm" "")
+("nky," "")
+("nor," "")
+("bbkx" "")
+("nvvo" "")
+("rifo" "")
+("fpzo" "")
+("oypr" "")
+("ocaz" "")
+("o,,b" "")
+("ocjl" "")
+("otsk" "")
+("obtb" "")
+("orrs" "")
+("orao" "")
+("ozkc" "")
+("oru." "")
+("opab" "")
+("ol,p" "")
+("oor," "")
+("omz," "")
+("olqq" "")
+("oiph" "")
+("oa/f" "")
+("oijk" "")
+("ykj." "")
+("qhh." "")
+("p;d." "")
+("fpzp" "")
+("qop " "")
+("prkc" "")
+("pqf;" "")
+("virb" "")
+("vypf" "")
+("vy;t" "")
+("vzo " "")
+("vq;;" "")
+("va/c" "")
+("vqp " "")
+("vfpz" "")
+("vp;w" "")
+("v..z" "")
+("xmfv" "")
+("lpxv" "")
+("v.kc" "")
+("vzex" "")
+("vcjv" "")
+("q;;k" "")
+("rzjk" "")
+("amo." "")
+("y.sb" "")
+("q;;b" "")
+("xmfc" "")
+("cypr" "")
+("cbqi" "")
+("cbtb" "")
+("czkc" "")
+("cfjx" "")
+("crrs" "")
+("ca/f" "")
+("cqsp" "")
+("cvvu" "")
+("cfpu" "")
+("cr;." "")
+("cbgf" "")
+("c;dm" "")
+("cear" "")
+("cep " "")
+("cl,p" "")
+("uizc" "")
+("ctqh" "")
+("ctsk" "")
+("col," "")
+("y;g," "")
+("rh.," "")
+("rkr," "")
+("baa," "")
+("dgqh" "")
+("av.f" "")
+("xmfh" "")
+(".zik" "")
+(",,jh" "")
+("aryf" "")
+("arym" "")
+("arrr" "@")
+("ardy" "A")
+("xxax" "B")
+("hk,u" "C")
+("hfi;" "D")
+("h/u " "E")
+("hohp" "F")
+("hodb" "G")
+("hit;" "H")
+("hlmb" "I")
+("lpdi" "J")
+("ldlb" "K")
+("lmsu" "L")
+("jnr;" "M")
+("j,n " "N")
+("jrxu" "O")
+("jjpk" "P")
+("jfuk" "Q")
+("girq" "R")
+("gykh" "S")
+("gjky" "T")
+("ggg " "U")
+("gbrx" "V")
+("grxu" "W")
+("gg, " "X")
+("lmsg" "Y")
+("lvy;" "Z")
+("lvn." "[")
+("valb" "\")
+("lvzp" "]")
+("lvp." "^")
+("lv.o" "_")
+("nki," "`")
+("nk.g" "a")
+("liue" "b")
+("lvj " "c")
+("lqgs" "d")
+("lzqx" "e")
+("lw. " "f")
+("lgjf" "g")
+("llpr" "h")
+("lof " "i")
+("lktz" "j")
+(",f;u" "k")
+("xykd" "l")
+("xv/ " "m")
+("xt;q" "n")
+("xax." "o")
+("xzqx" "p")
+("xale" "q")
+("x;ae" "r")
+("xgjf" "s")
+("xw. " "t")
+("xlpc" "u")
+("xosb" "v")
+("x.ab" "w")
+("xof " "x")
+("xrf " "y")
+("xjcl" "z")
+("xpac" "{")
+("/g, " "|")
+("/xuq" "}")
+("ifps" "~")
+("gjfb" "")
+("fkpm" "")
+("ucjr" "")
+("ufpz" "")
+("uvkc" "")
+("ubb." "")
+("epu " "")
+("ua/c" "")
+("fnr," "")
+("f,. " "")
+("fbah" "")
+("fqn " "")
+("fgeo" "")
+("ftix" "")
+("fp/b" "")
+("f/zx" "")
+("fxmh" "")
+("fmac" "")
+("flqp" "")
+("f.fn" "")
+("flpn" "")
+("fnkp" "")
+("fcr." "")
+("/hbt" "")
+("/f;u" "")
+("/rsv" "")
+("/qp " "")
+("/etb" "")
+("/m; " "")
+("sf//" "")
+("/gjf" "")
+("/lpr" "")
+("/lvf" "")
+("/iue" "")
+(".t;d" "")
+(".opd" "")
+("ykps" "")
+("yko." "")
+("yk;x" "")
+("ykkv" "")
+("ykie" "")
+("ykgf" "")
+("ynua" "")
+("yy;c" "")
+("y,, " "")
+("yy;f" "")
+("yleb" "")
+("yru " "")
+("yrlp" "")
+("ypv " "")
+("ylvw" "")
+("yjo " "")
+("yjr;" "")
+("yky " "")
+("yijf" "")
+("y.td" "")
+("yykf" "")
+("yee " "")
+("yok " "")
+("qins" "")
+("qdti" "")
+("a.rp" "")
+("my; " "")
+("cj;m" "")
+("maax" "")
+("maxx" "")
+("mqx " "")
+("mrlp" "")
+("qdtm" "")
+("r/m " "")
+("mpl." "")
+("oom " "")
+("ntkm" "")
+("rcrp" "")
+("rcc;" "")
+("rcab" "")
+("sica" "")
+("saxx" "")
+("spv " "")
+("spl." "")
+("scp " "")
+("s.v " "")
+("soz;" "")
+("sizs" "")
+("sbf;" "")
+(".cj;" "")
+("casq" "")
+("qajk" "")
+("qbbb" "")
+("eeq " "")
+("zzq " "")
+("qijf" "")
+("qwp " "")
+("qjis" "")
+("qpqq" "@")
+("ykjn" "A")
+("nr,n" "B")
+("rh.n" "C")
+("qpn " "D")
+("a/zn" "E")
+(",mqt" "F")
+("ipzt" "G")
+("bqit" "H")
+("l,pt" "I")
+("apyf" "JK")
+("aprp" "L")
+("apzs" "M")
+("iyf " "N")
+("iktl" "O")
+("icu " "P")
+("iqh " "Q")
+("irlg" "R")
+("iuab" "S")
+("i;l;" "T")
+("ik;s" "U")
+("ikkr" "V")
+("i.f " "W")
+("im " "X")
+("ipr " "Y")
+("ipaf" "Z")
+("e;l;" "[")
+("ek;s" "\")
+("zcu " "]")
+("zlrb" "^")
+("zzax" "_")
+("zosz" "`")
+("o;ee" "a")
+("rfnw" "b")
+("rfrr" "c")
+("qshf" "d")
+("r;am" "e")
+("s,am" "f")
+("i;am" "g")
+("xlf;" "h")
+("irix" "i")
+("iblx" "j")
+("ib.w" "k")
+("ibiv" "l")
+("g,nq" "m")
+("g,yr" "n")
+("g,/ " "o")
+("g,;." "p")
+("wbg," "q")
+("b;g," "r")
+("g,l;" "s")
+("g,kh" "t")
+("muf;" "u")
+("z.zh" "v")
+("z.jr" "w")
+("eyjd" "x")
+("oxav" "y")
+("lpox" "z")
+("u,zh" "{")
+("u,p " "|")
+("jsl," "}")
+("qdl," "~")
+("l,tk" "")
+("fkkz" "")
+("nvvq" "")
+("lvlc" "")
+("p,r " "")
+("ei " "")
+("kzae" "")
+("ktdu" "")
+("krgh" "")
+("knam" "")
+("kyke" "")
+("eqpk" "")
+("jfpd" "")
+("kqoc" "")
+("ykde" "")
+("ljpe" "")
+("o/,b" "")
+(";kym" "")
+(";ypn" "")
+(";cjp" "")
+("q;fa" "")
+(";vvc" "")
+(";adm" "")
+(";;;v" "")
+(";;z;" "")
+(";pfx" "")
+(";ea." "")
+(";.j." "")
+(";lqk" "")
+(";ljz" "")
+(";fps" "")
+("b;yr" "")
+(".txr" "")
+("rypa" "")
+("ysxr" "")
+("zkyp" "")
+("wlyx" "")
+("yuwh" "")
+("o..f" "")
+("n/qx" "")
+("iljh" "")
+("tgaa" "")
+("nr/n" "")
+("kg,n" "")
+("af;n" "")
+("krln" "")
+("nypv" "")
+("nypn" "")
+("nzqx" "")
+("nljz" "")
+("njjf" "")
+(";;px" "")
+("oypa" "")
+("oysy" "")
+("ocjp" "")
+("orin" "")
+("ozqx" "")
+("oea." "")
+("oepb" "")
+("o/rf" "")
+("ozp " "")
+("o;;v" "")
+("oi;k" "")
+("okym" "")
+("ojzy" "")
+("om;n" "")
+("v;.e" "")
+("zlvp" "")
+("prrs" "")
+("pkyn" "")
+("pfaf" "")
+("pzax" "")
+("pzkc" "")
+("viph" "")
+("vcaz" "")
+("vfaf" "")
+("vbqi" "")
+("vrpk" "")
+("vbg;" "")
+("vr;h" "")
+("vqe." "")
+("vtzu" "")
+("vjp." "")
+("vlz;" "")
+("vlqq" "")
+("vky," "")
+("vxxx" "")
+("vrrs" "")
+("i;bk" "")
+("zlve" "")
+("cj;q" "")
+("cnic" "")
+("cbrb" "")
+("c;;v" "")
+("cpfx" "@")
+("c/rf" "A")
+("c/l/" "B")
+("cpfi" "C")
+("cljz" "D")
+("clp." "E")
+("cjzy" "F")
+("cypa" "G")
+("cbgm" "H")
+("cjaa" "I")
+("c/qx" "J")
+(",ypx" "K")
+(",y;." "L")
+(",,mq" "M")
+(",rrs" "N")
+(",bqi" "O")
+("req," "P")
+("r;i," "Q")
+(",zkc" "R")
+("cpa," "S")
+(",en " "T")
+(",mz," "U")
+("jo,," "V")
+("./l/" "W")
+("arrk" "X")
+("arxx" "Y")
+("ar,q" "Z")
+("arpc" "[")
+("arcz" "\")
+("a/ak" "]")
+("q;;h" "^")
+("f/jh" "_")
+("hypf" "`")
+("hb;k" "a")
+("hbz " "b")
+("epu " "c")
+("ocu " "d")
+("jcjr" "e")
+("jrjk" "f")
+("ja/c" "g")
+(",.j " "h")
+("nvvg" "i")
+("gzfh" "j")
+("rbsg" "k")
+("grm " "l")
+(".oac" "m")
+("lvrm" "n")
+("qlvm" "o")
+("lvl." "p")
+("u,lv" "q")
+("lvb." "r")
+("nkzs" "s")
+("ly;;" "t")
+("lypx" "u")
+("lqsv" "v")
+("lg, " "w")
+("ltgk" "x")
+("ljzx" "y")
+("lled" "z")
+("llpq" "{")
+(",ir," "|")
+(",nt;" "}")
+("xiku" "~")
+("xitc" "")
+(",,jx" "")
+("xqhh" "")
+("uacx" "")
+("xy;;" "")
+("xfuk" "")
+("xaxp" "")
+("xldd" "")
+("/nky" "")
+("irlx" "")
+("fpfb" "")
+("lpzb" "")
+("qjib" "")
+("fkzh" "")
+("uir;" "")
+("uaax" "")
+("ur;." "")
+("axrv" "")
+("ojqk" "")
+("lmob" "")
+("lmi;" "")
+("fnnn" "")
+("fzn " "")
+("fa/f" "")
+("fzik" "")
+("fcp." "")
+("fl,p" "")
+("fky," "")
+("ftde" "")
+("for," "")
+("fpab" "")
+("/ykh" "")
+("/jpk" "")
+("/g, " "")
+(",,j/" "")
+("qji/" "")
+(".uzd" "")
+("yktn" "")
+("yknq" "")
+("ykzh" "")
+("yk.s" "")
+("ykf;" "")
+("yvjs" "")
+("iues" "")
+("yykd" "")
+("yn. " "")
+("yv/ " "")
+("yt;q" "")
+("yrav" "")
+("yrsv" "")
+("yqqp" "")
+("yaa;" "")
+("yfz;" "")
+("ypls" "")
+("ypu " "")
+("yx " "")
+("yiue" "")
+("yyp " "")
+("yrqk" "")
+("y.ab" "")
+("bgd." "")
+("a.eb" "")
+(".fp " "")
+("v;jm" "")
+("sykd" "")
+("snrb" "")
+("sbjb" "")
+("sbgv" "")
+("sdae" "")
+("sop " "")
+("qqp " "")
+("q;ae" "")
+("qiue" "")
+("qzaz" "")
+("yfhf" "")
+("yfbf" "")
+("ipfn" "")
+(",mqn" "")
+("tstn" "")
+("bcon" "")
+("zkpn" "")
+(";dan" "")
+("cait" "")
+("appr" "")
+("inac" "")
+("irlx" "")
+("ibf;" "")
+("igfu" "")
+("irp " "")
+("iaxx" "")
+("ijid" "")
+("ipl." "")
+("iwc " "")
+("i.td" "")
+("iky " "@")
+("ilpd" "A")
+("izqd" "B")
+("ipqq" "C")
+("ipf;" "D")
+("iwp " "E")
+("ejo " "F")
+("ti.n" "G")
+("tzqn" "H")
+("ti;k" "I")
+("jr;y" "J")
+("zyw " "K")
+("zce;" "L")
+("zvv " "M")
+("zky " "N")
+("zos " "O")
+("zee " "P")
+("runc" "Q")
+("ru.d" "R")
+("alps" "S")
+("rfcu" "T")
+("zkkm" "U")
+("awqm" "V")
+("ecam" "W")
+("ig;m" "X")
+("qiam" "Y")
+("lvsm" "Z")
+("qd;m" "[")
+("embx" "\")
+("ibne" "]")
+("ibax" "^")
+("ibpq" "_")
+("ibjo" "`")
+("ib.u" "a")
+("g,yk" "b")
+("g,if" "c")
+("g,.;" "d")
+("muyk" "e")
+("mu.;" "f")
+("z.r;" "g")
+("z.eq" "h")
+("erk " "i")
+("u,ls" "j")
+("l,nq" "k")
+("f;l," "l")
+("jzl," "m")
+("pdl," "n")
+("ibl," "o")
+("mgs," "p")
+("p,zh" "q")
+("p,ig" "r")
+("yuq " "s")
+("jjaa" "t")
+("kal." "u")
+("kcjm" "v")
+("kppp" "w")
+("kyrp" "x")
+("zfpb" "y")
+(";y;." "z")
+(";nnd" "{")
+(";cjp" "|")
+(";zae" "}")
+(";rcc" "~")
+(";fjc" "")
+("ry;." "")
+("zpur" "")
+("ejar" "")
+("ro/," "")
+("mmw " "")
+("wnam" "")
+("wnvx" "")
+("gfze" "")
+("zsqu" "")
+("b.pw" "")
+("dozk" "")
+("dibm" "")
+("d.yh" "")
+("d,,v" "")
+("rrfd" "")
+("tga." "")
+("ox. " "")
+("nkkn" "")
+("nfop" "")
+(".txn" "")
+("nzae" "")
+("vbgn" "")
+("eqix" "")
+("rprx" "")
+("fl;o" "")
+("qdso" "")
+("b;yo" "")
+("oyke" "")
+("onnd" "")
+("onmc" "")
+("oqoc" "")
+("oe.;" "")
+("obby" "")
+("ofkb" "")
+("i;;." "")
+(",.aq" "")
+("p/rp" "")
+("p.j." "")
+("vypa" "")
+("vcjp" "")
+("vlp." "")
+("vi;k" "")
+("vi/p" "")
+("vlbj" "")
+("vfk;" "")
+("v;;v" "")
+("b;yv" "")
+("vjzy" "")
+("fl;v" "")
+("/l/k" "")
+("amik" "")
+("j;qh" "")
+("yp;q" "")
+("cnnd" "")
+("cnam" "")
+("cyke" "")
+("cy;." "")
+("cfj." "")
+("crgh" "")
+("cqdu" "")
+("cbby" "")
+("cjhe" "")
+("cejj" "")
+("czae" "")
+("cfkb" "")
+("cpx," "")
+("ckcz" "")
+("cxky" "")
+(",i.n" "")
+(",,j;" "")
+("y,,b" "")
+(",em," "")
+(",;;v" "")
+(",/l/" "")
+(",orb" "")
+(",i/p" "")
+(",ljz" "")
+("./bh" "")
+("xfk;" "")
+(".nnd" "")
+(".fkb" "")
+("are." "")
+("ar/x" "")
+("ar.." "")
+("are," "")
+("h,,b" "")
+("hzkc" "")
+("h;;d" "")
+("cpau" "")
+("jypr" "")
+("jbqi" "")
+("jqe." "")
+("j.jq" "")
+("jky," "@")
+("jzkc" "A")
+("ozl;" "B")
+("g,mq" "C")
+("grpk" "D")
+("gbqi" "E")
+("gxxx" "F")
+("gky," "G")
+("yhr;" "H")
+("yh;f" "I")
+("lvzn" "J")
+("nktr" "K")
+("lhoz" "L")
+("lp;w" "M")
+("l/zx" "N")
+("l.fn" "O")
+("lv;k" "P")
+("lkdv" "Q")
+(",ntc" "R")
+("nvv," "S")
+(",prk" "T")
+(",fpz" "U")
+(",qp " "V")
+(",o;n" "W")
+(",xx." "X")
+("xnkp" "Y")
+("xrm " "Z")
+("xbb." "[")
+("xp;w" "\")
+("xpx " "]")
+("xduu" "^")
+("x.fn" "_")
+("xlpn" "`")
+("x.kc" "a")
+("xwpv" "b")
+("oszx" "c")
+("xyxf" "d")
+("xa/c" "e")
+("xtg/" "f")
+("xp/b" "g")
+("xxx." "h")
+("xnak" "i")
+("rbsd" "j")
+("qozb" "k")
+("bbpk" "l")
+("rh.e" "m")
+("rbse" "n")
+("aeln" "o")
+("aexw" "p")
+(".kke" "q")
+("uypn" "r")
+("uysy" "s")
+("nkku" "t")
+("b;yu" "u")
+("brku" "v")
+("upfx" "w")
+("ujzy" "x")
+("ui;k" "y")
+("ui/p" "z")
+("qdt;" "{")
+("ozaf" "|")
+("rztx" "}")
+("fyvo" "~")
+("fcqh" "")
+("fzp " "")
+("fb;f" "")
+("fapa" "")
+("ffk;" "")
+("f/rp" "")
+("flef" "")
+("fos." "")
+("f/jq" "")
+("fu,e" "")
+("ekyg" "")
+("/yxf" "")
+("/ypf" "")
+("/cjr" "")
+("/fzf" "")
+("/fpz" "")
+("rc./" "")
+("/p;w" "")
+("/px " "")
+("/pqx" "")
+("/l,n" "")
+("yrkx" "")
+("ykbp" "")
+("y;;x" "")
+("ykpw" "")
+("baax" "")
+("dqis" "")
+("y,n " "")
+("yykh" "")
+("yitc" "")
+("yrjr" "")
+("yfyo" "")
+("ymod" "")
+("y.fh" "")
+("uizy" "")
+("ynlu" "")
+("nr;;" "")
+(".xz;" "")
+("a.dd" "")
+("mitc" "")
+("nrkm" "")
+("mrjr" "")
+("uizm" "")
+("mqhh" "")
+("rcld" "")
+("sirq" "")
+("spbb" "")
+("s.o " "")
+("s.xz" "")
+("qnr;" "")
+("qbrx" "")
+("vaqb" "")
+("qr;x" "")
+("oqak" "")
+("b;yn" "")
+("ea.n" "")
+("/qln" "")
+("fpmn" "")
+("jjon" "")
+("lphn" "")
+("aebt" "")
+("apn;" "")
+("ap/u" "")
+("apox" "")
+("inrb" "")
+("iirz" "")
+("ifp " "")
+("itfb" "")
+("iv/ " "")
+("ifjz" "")
+("im; " "")
+("iof " "")
+("iop " "")
+("ilv," "")
+("iosb" "")
+("i.ab" "")
+("ipa." "")
+("i;;g" "")
+("ecl;" "")
+("ebaz" "")
+("ev/ " "")
+("et;q" "")
+("e;;;" "")
+("t.qn" "")
+("vaac" "")
+(";/ky" "")
+("zvj " "")
+("zetb" "")
+("rfl," "")
+("fpfq" "")
+("pvam" "")
+("xuak" "")
+("ibpx" "")
+("g,pg" "")
+("g,x." "@")
+("u,if" "A")
+("u,y." "B")
+("u,zu" "C")
+("u,rr" "D")
+("cql," "E")
+("i;l," "F")
+("yqq," "G")
+("lvk;" "H")
+("p,e;" "I")
+("p,dd" "J")
+("p,xb" "K")
+("kax," "L")
+("ljpf" "M")
+("ykdc" "N")
+("caib" "O")
+(";u,p" "P")
+("sxh;" "Q")
+("rnrk" "R")
+("pppr" "S")
+("wnlp" "T")
+("t,xf" "U")
+("crjn" "V")
+("bbkx" "W")
+("onrk" "X")
+("oipt" "Y")
+("oal." "Z")
+("ozzq" "[")
+("o/xq" "\")
+("op;." "]")
+("or;m" "^")
+("xxao" "_")
+("pbby" "`")
+("ufj." "a")
+("vnam" "b")
+("vfj." "c")
+("vq;m" "d")
+("vqdu" "e")
+("vnnd" "f")
+("vbby" "g")
+("vrgh" "h")
+("vr;r" "i")
+("ozak" "j")
+("leed" "k")
+("amnm" "l")
+("cno," "m")
+("cnlp" "n")
+("cepn" "o")
+("cr/m" "p")
+("cmax" "q")
+("cprc" "r")
+("cohe" "s")
+(",o/," "t")
+(",tdu" "u")
+("rgq," "v")
+(",zae" "w")
+(".nrk" "x")
+(".w/w" "y")
+("b;yh" "z")
+("arej" "{")
+("ysxh" "|")
+("hb;f" "}")
+("hfpm" "~")
+("hiun" "¡")
+("r;ij" "¢")
+("jjky" "£")
+("jjzy" "¤")
+("ji;k" "¥")
+("gvvc" "¦")
+("yhpi" "§")
+("lvf;" "¨")
+("lvex" "©")
+("lvpx" "ª")
+("nkow" "«")
+("nkl." "¬")
+("ltde" "­")
+("lrpk" "®")
+("lqsp" "¯")
+("l;;f" "°")
+("l;dm" "±")
+("lep " "²")
+(",par" "³")
+("xypx" "´")
+("xir;" "µ")
+("xrrs" "¶")
+("xzkc" "·")
+("xtde" "¸")
+("xk/p" "¹")
+("xl,p" "º")
+("ofdf" "»")
+("rrrb" "¼")
+("l,pb" "½")
+("aeyx" "¾")
+("aeae" "¿")
+("uyke" "")
+("unam" "")
+("fkyo" "")
+("fzsx" "")
+("ftnr" "")
+("fqdu" "")
+("f.ls" "")
+("ffkp" "")
+("fo/," "")
+("fyke" "")
+("fr;r" "")
+("fya," "")
+("/rrs" "")
+("/;;f" "")
+("/// " "")
+("/l,p" "")
+("a/.." "")
+("rrjs" "")
+("jop." "")
+("yfpz" "")
+("yrr " "")
+("ybb." "")
+("yyk;" "")
+("fdfi" "")
+("rh.m" "")
+("zeac" "")
+("srjk" "")
+("sduu" "")
+("s.kc" "")
+("srm " "")
+("spff" "")
+(".q;;" "")
+("qzfh" "")
+("qzu." "")
+("akjn" "")
+("nkin" "")
+(".lpn" "")
+("qozp" "")
+("xmfp" "")
+("av.r" "")
+("ink;" "")
+("iykh" "")
+("icm " "")
+("il, " "")
+("iljv" "")
+("ifuk" "")
+("iy;;" "")
+("iiku" "")
+("iqjd" "")
+("ilen" "")
+("iit;" "")
+("erxu" "")
+("eg, " "")
+("efuk" "")
+("eidk" "")
+("y.dy" "")
+("ykky" "")
+("kykb" "")
+("ldly" "")
+(".xzy" "")
+("zohp" "")
+("rfbv" "")
+("rfl," "")
+("rfk." "@")
+("yplr" "A")
+("n.;m" "B")
+("n.am" "C")
+("pacm" "D")
+(";;am" "E")
+("dalm" "F")
+("xpa." "G")
+("ibop" "H")
+("ibob" "I")
+("ibox" "J")
+("amkx" "K")
+("lvp." "L")
+("g,zd" "M")
+("mupv" "N")
+("z.nc" "O")
+("z.vx" "P")
+("lvwx" "Q")
+("oxak" "R")
+("oxjs" "S")
+("ccl," "T")
+("u,pr" "U")
+("u,bj" "V")
+("kd.," "W")
+("u,lx" "X")
+(";ul," "Y")
+("lox," "Z")
+("o;l," "[")
+("p,r;" "\")
+("r;ih" "]")
+("owpf" "^")
+("kj;h" "_")
+(";re," "`")
+("ry/x" "a")
+("yuqr" "b")
+("rzle" "c")
+("nyuq" "de")
+("nepu" "f")
+("olrn" "g")
+("ny/x" "h")
+("nv;m" "i")
+("nf/j" "j")
+("v..o" "k")
+("oyuq" "l")
+("pnrk" "m")
+("pprc" "n")
+("vnrh" "o")
+("vr/m" "p")
+("ve;;" "q")
+("vu,p" "r")
+("cyuh" "s")
+("cfte" "t")
+("cv;m" "u")
+("cfpb" "v")
+("czle" "w")
+("cecm" "x")
+("cepu" "y")
+(",prc" "z")
+(",lpv" "{")
+("dr/m" "|")
+("ofrm" "}")
+(";;ph" "~")
+(".v;m" "á")
+("akjh" "â")
+("arj." "ã")
+("yf.f" "ä")
+("prgh" "å")
+("tgra" "æ")
+("hljf" "ç")
+("hqoc" "è")
+("jfj." "é")
+("gqoc" "ê")
+("yhrh" "ë")
+("lvfb" "ì")
+("lv.n" "í")
+("lnic" "î")
+("lcqh" "ï")
+("lrab" "ð")
+("li;k" "ñ")
+("ljzy" "ò")
+("loop" "ó")
+("qdsx" "ô")
+("fjd/" "õ")
+("x/rf" "ö")
+("xjaa" "÷")
+("xi/p" "ø")
+("/xky" "ù")
+("xlp." "ú")
+("ifya" "û")
+("ir,z" "ü")
+("yuih" "ý")
+("uw/w" "þ")
+("fclp" "ÿ")
+("frkx" "")
+("fp;." "")
+("ffkm" "")
+("fuic" "")
+("flpv" "")
+("fyrp" "")
+("/irx" "")
+("/jaa" "")
+("/plk" "")
+("jjo/" "")
+("/jzy" "")
+("ykcp" "")
+("ykvc" "")
+("yklz" "")
+("b;yx" "")
+("yfaf" "")
+("yicp" "")
+("yypx" "")
+("ybqi" "")
+("ya/f" "")
+("ybg;" "")
+("yxxx" "")
+("yr;;" "")
+("yky," "")
+("mk/p" "")
+("osom" "")
+("scaz" "")
+("siph" "")
+("sfrp" "")
+("szik" "")
+("sbqi" "")
+("srrs" "")
+("sy;h" "")
+("q,mq" "")
+("qlz;" "")
+(".bmf" "")
+("ljnn" "")
+("w/wn" "")
+("apbb" "")
+("apk," "")
+("iyps" "")
+("iyk;" "")
+("inor" "")
+("ihoz" "")
+("iqn " "")
+("icjr" "")
+("ip/b" "")
+("yqqi" "")
+("ia/c" "")
+("ipx " "")
+("ixmh" "")
+("ip;w" "")
+("iqdr" "")
+("qoi " "")
+("exxw" "")
+("tyuq" "")
+("rzky" "")
+("zc.r" "")
+("zbgb" "")
+("nvve" "")
+("t;qo" "")
+("yp;m" "")
+(",zhm" "")
+("zlpm" "@")
+("fuam" "A")
+("xodb" "B")
+("ibpb" "C")
+("ibrr" "D")
+("bgd," "E")
+("g,gf" "F")
+("z.fu" "G")
+("u,yc" "H")
+("u,pp" "I")
+("u,ru" "J")
+("u,j;" "K")
+("y;g," "L")
+("aae," "M")
+("rpl," "N")
+("zps," "O")
+("uul," "P")
+("yqqk" "Q")
+("ajhq" "R")
+("vvyq" "S")
+("fkk," "T")
+("f;;b" "U")
+(";yuq" "V")
+(";y;x" "W")
+(";mmw" "X")
+(";;z." "Y")
+(";./h" "Z")
+("ry;x" "[")
+("wzvj" "\")
+("wy;x" "]")
+("flef" "^")
+("narm" "_")
+("dj;h" "`")
+("uacn" "a")
+("nkkx" "b")
+("oy;x" "c")
+("oev/" "d")
+("oj;h" "e")
+("pirx" "f")
+("uyuq" "g")
+("vyvs" "h")
+("cev/" "i")
+("ctg." "j")
+("ci;." "k")
+(",epu" "l")
+("eqjh" "m")
+("aryq" "n")
+("hirx" "o")
+("hol." "p")
+("gnrk" "q")
+("gzfm" "r")
+("v..g" "s")
+("glpv" "t")
+("nkrm" "u")
+("y;ss" "v")
+("lrgh" "w")
+("lqdu" "x")
+("lfkp" "y")
+(",zae" "z")
+(",pzh" "{")
+("yfxf" "|")
+("xnam" "}")
+("xxxs" "~")
+("ljzx" "ġ")
+("mmod" "Ģ")
+("casy" "ģ")
+("uepu" "Ĥ")
+("lmqu" "ĥ")
+("fc;v" "Ħ")
+("fyps" "ħ")
+("fnvg" "Ĩ")
+("feky" "ĩ")
+("fepu" "Ī")
+("fecm" "ī")
+("fu,v" "Ĭ")
+("fx/u" "ĭ")
+("/y;." "Į")
+("/zae" "į")
+("ykqu" "İ")
+("o..s" "ı")
+("j/l/" "Ĳ")
+("yirx" "ĳ")
+("b;yy" "Ĵ")
+("fl;y" "ĵ")
+("y/rf" "Ķ")
+("y;;v" "ķ")
+("yjzy" "ĸ")
+("yumh" "Ĺ")
+("mjzy" "ĺ")
+("fpmc" "Ļ")
+("s;;v" "ļ")
+("s/l/" "Ľ")
+("srin" "ľ")
+("appi" "Ŀ")
+("l,/f" "")
+("iypr" "")
+("irrs" "")
+("itde" "")
+("e;;f" "")
+("zru." "")
+("a/ax" "")
+("ibrs" "")
+("ibxx" "")
+("rbsp" "")
+("nrk," "")
+("uiz," "")
+("g,b/" "")
+("g,zc" "")
+("u,pn" "")
+("u,l," "")
+("ep.x" "")
+("fkke" "")
+("cj;," "")
+("owa;" "")
+("eiua" "")
+("eil;" "")
+("eiib" "")
+("kajq" "")
+("k/xy" "")
+(";aee" "")
+(";qzh" "")
+(";;a;" "")
+("ilj." "")
+("bc//" "")
+("dlvx" "")
+("njjy" "")
+("naee" "")
+("oaee" "")
+("odk;" "")
+("y.e/" "")
+("py;x" "")
+("vmmw" "")
+("vev/" "")
+("vz;;" "")
+("amkx" "")
+("cf;y" "")
+(",ev/" "")
+("ofix" "")
+("aryx" "")
+("armw" "")
+("hv;m" "")
+("jyuq" "")
+("luic" "")
+("xnpr" "")
+("xr/m" "")
+("biff" "")
+("fb;v" "")
+("fev/" "")
+("fu,f" "")
+("/zfm" "")
+("zp//" "")
+("w.//" "")
+("/w/w" "")
+("ykfx" "")
+("yk/q" "")
+("qdts" "")
+("y;dn" "")
+("yfkb" "@")
+("ozay" "A")
+("mzsx" "B")
+("srgh" "C")
+("sbby" "D")
+("syke" "E")
+("qqq " "F")
+("yfyf" "G")
+("apo," "H")
+("inic" "I")
+("izp " "J")
+("ir;x" "K")
+("icjp" "L")
+("i/rf" "M")
+("i/l/" "N")
+("ikyd" "O")
+("eb;f" "P")
+("zrfu" "Q")
+("zb;f" "R")
+("zs.;" "S")
+("sxhp" "T")
+("gkym" "U")
+("py;m" "V")
+("sxhx" "W")
+("g,q;" "X")
+("g,ac" "Y")
+("fpz," "Z")
+("g,px" "[")
+("mupw" "\")
+("nvvx" "]")
+("oxym" "^")
+("u,rp" "_")
+("u,/c" "`")
+(",,j," "a")
+("jky," "b")
+("mof," "c")
+("tgk," "d")
+("yqqh" "e")
+("p,yp" "f")
+("r;if" "g")
+("eieq" "h")
+("eitx" "i")
+("fjei" "j")
+("k;;." "k")
+("kcj," "l")
+(";frx" "m")
+("qdjx" "n")
+(";/xy" "o")
+("yxxf" "p")
+("dfum" "q")
+("yxxd" "r")
+("yxxg" "s")
+("vqin" "t")
+("orzy" "u")
+("vf;y" "v")
+("f;;k" "w")
+("cajq" "x")
+("crzy" "y")
+("./xy" "z")
+("y;;k" "{")
+("pppa" "|")
+("ht.n" "}")
+("hu,f" "~")
+("yhyx" "š")
+("lyuq" "Ţ")
+("lv;m" "ţ")
+("yuqe" "Ť")
+("aeln" "ť")
+("ufzx" "Ŧ")
+("yuqx" "ŧ")
+("ykys" "Ũ")
+("jjj." "ũ")
+("yr/m" "Ū")
+("mr/m" "ū")
+("zklm" "Ŭ")
+("sipt" "ŭ")
+("soom" "Ů")
+("qxx;" "ů")
+("ajht" "Ű")
+("irgh" "ű")
+("iqdu" "Ų")
+("qdti" "ų")
+("zyke" "Ŵ")
+("z.pr" "ŵ")
+("rfrn" "Ŷ")
+("rfaa" "ŷ")
+("yp;m" "Ÿ")
+(";agx" "Ź")
+("g,l;" "ź")
+("g,rs" "Ż")
+("muff" "ż")
+("z..m" "Ž")
+(",.u," "ž")
+("u,qn" "ſ")
+("u,ac" "")
+("u,pb" "")
+("nr,," "")
+("q;;," "")
+("owqw" "")
+("eia;" "")
+("ei;c" "")
+("yuqk" "")
+(";fuv" "")
+("d;;." "")
+("yxxn" "")
+("yxxo" "")
+("ojjb" "")
+("oo.s" "")
+("pajq" "")
+("vajq" "")
+("arom" "")
+("nklm" "")
+("lkkx" "")
+("lev/" "")
+("li;f" "")
+("xmmw" "")
+("xkkx" "")
+("xj;h" "")
+("uosm" "")
+("fap," "")
+("f/xy" "")
+("///u" "")
+("yxx." "")
+("ajhn" "")
+("/xkn" "")
+("iyq," "")
+("ilpv" "")
+("iprc" "")
+("zpue" "")
+("pxxm" "")
+("zpux" "")
+("fl;," "")
+("g,/f" "")
+("g,ik" "")
+("muzn" "")
+("mupi" "")
+("mu//" "")
+("u,i;" "")
+("u,,q" "")
+("u,zk" "")
+("xxl," "")
+("yqqq" "")
+("op,." "")
+(";bc/" "")
+("rzru" "")
+("oqds" "")
+("czru" "")
+("hrzy" "")
+("hfum" "")
+("fuaa" "")
+("ofdy" "")
+("/rf," "")
+("qsq/" "")
+("qdj/" "")
+(".jjd" "")
+("yy;x" "")
+("yj;h" "")
+("ykkx" "@")
+("fdfs" "A")
+("ypfm" "B")
+("apyx" "C")
+("iepu" "D")
+("zzle" "E")
+("z;;k" "F")
+("zyps" "G")
+("rfan" "H")
+("ecaf" "I")
+("g,ak" "J")
+("z.nm" "K")
+("zpux" "L")
+("o..," "M")
+("nkk," "N")
+("s.;," "O")
+("ep.k" "P")
+("qdtu" "Q")
+("rh.a" "R")
+("eibr" "S")
+("eilm" "T")
+("naen" "U")
+("vqds" "V")
+("cyxg" "W")
+("ly.y" "X")
+("l/xy" "Y")
+("yxx/" "Z")
+("f;;s" "[")
+("saee" "\")
+("ojaj" "]")
+("iy;x" "^")
+("ii;f" "_")
+("epum" "`")
+("ibjh" "a")
+("munh" "b")
+("z.ww" "c")
+("o..k" "d")
+("cyxv" "e")
+("jbc/" "f")
+("yosm" "g")
+("iaee" "h")
+("rff," "i")
+("g,eu" "j")
+("g,ek" "k")
+("xqds" "l")
+("ycj," "m")
+("sfey" "n")
+("ap;." "o")
+("iosm" "p")
+("yxxi" "q")
+("i/xy" "r")
+("u,qa" "s")
+("u,eu" "t")
+("p,rm" "u")
+("fdfu" "v")
+("caii" "w")
+("mmw," "x")
+("oja," "y")
+("g,aq" "z")
+("vof." "{")
+("f;;," "|")
+("yxx," "}")
+("li;m" "~")
+("...." "@")
+("gs " "A")
+("dddd" "B")
+("qqqq" "C")
+("zzzz" "D")
+("al " "E")
+("ae " "F")
+("lq " "G")
+("aad " "H")
+("pppp" "I")
+("as " "J")
+("dddd" "K")
+("...." "L")
+("adsg" "M")
+("zj " "N")
+("aga " "O")
+("sf " "P")
+("aae " "Q")
+("kb " "R")
+("ks " "S")
+("kk " "T")
+("js " "U")
+("lls " "V")
+("oj " "W")
+("lsx " "X")
+("rs " "Y")
+("lgb " "Z")
+("tk " "[")
+("ck " "\")
+("ajd " "]")
+("qs " "^")
+("sb " "_")
+("sf " "`")
+("oooo" "a")
+("xxxx" "b")
+("wwww" "c")
+("fdh " "d")
+("kaaa" "e")
+("kq " "f")
+("kea " "g")
+("kos " "h")
+("kq " "i")
+("kd " "j")
+("fhe " "k")
+("qgds" "l")
+("fe " "m")
+("rad " "n")
+("br " "o")
+("mgs " "p")
+("zb " "q")
+("nad " "r")
+("nls " "s")
+("kc " "t")
+("bls " "u")
+("db " "v")
+("kd " "w")
+("jdad" "x")
+("nq " "y")
+("nk " "z")
+("nj " "{")
+("qx " "|")
+("ob " "}")
+("ol " "~")
+("gc " "ɡ")
+("ck " "ɢ")
+("cls " "ɣ")
+("cb " "ɤ")
+("zlh " "ɥ")
+(".ls " "ɦ")
+("arh " "ɧ")
+("mmmm" "ɨ")
+("us " "ɩ")
+("tb " "ɪ")
+("kfb " "ɫ")
+("kzsh" "ɬ")
+("kbk " "ɭ")
+("kof " "ɮ")
+("kjs " "ɯ")
+("kig " "ɰ")
+("kkx " "ɱ")
+("kke " "ɲ")
+("kn " "ɳ")
+("kaax" "ɴ")
+("kajd" "ɵ")
+("kads" "ɶ")
+("kqdl" "ɷ")
+("kz " "ɸ")
+("ktgd" "ɹ")
+("ku " "ɺ")
+("ko " "ɻ")
+("kaw " "ɼ")
+("aase" "ɽ")
+("ose " "ɾ")
+("jye " "ɿ")
+("bbb " "")
+("ql. " "")
+("qys " "")
+("faad" "")
+("zqdl" "")
+(";gf " "")
+("pw " "")
+("lp. " "")
+("rts " "")
+("ros " "")
+("rlh " "")
+("zed " "")
+("tsw " "")
+("wlq " "")
+("wq " "")
+("ww " "")
+("wd " "")
+("wlf " "")
+("lshw" "")
+("gfgf" "")
+("lgc " "")
+("zslh" "")
+("das " "")
+("dts " "")
+("djh " "")
+("dd " "")
+("yso " "")
+("afaf" "")
+("nr " "")
+("tsf " "")
+("ktgd" "")
+(".lh " "")
+("nz " "")
+("nos " "")
+("nlf " "")
+("oaf " "")
+("oas " "")
+("ogds" "")
+("olf " "")
+("oos " "")
+("ozk " "")
+("obh " "")
+("olh " "")
+("olq " "")
+("pls " "")
+("lsp " "")
+("vad " "")
+("vls " "")
+("vb " "")
+("vsd " "")
+("vs " "")
+("vj " "")
+("vq " "")
+("vk " "")
+("oe " "")
+("kc " "")
+("cys " "")
+("cts " "")
+("cz " "")
+("cbh " "")
+("cos " "")
+("clh " "")
+("ced " "@")
+(",j " "A")
+("ofb " "B")
+(".af " "C")
+(".os " "D")
+("arad" "E")
+("ljf " "F")
+("lps " "G")
+("nks " "H")
+("j.. " "I")
+("dd " "J")
+("fad " "K")
+("fj " "L")
+("fls " "M")
+("flg " "N")
+("eeee" "O")
+("ajea" "P")
+("yst " "Q")
+("aft " "RS")
+("qt " "T")
+("tst " "U")
+("tas " "V")
+("tgds" "W")
+("tsf " "X")
+("tos " "Y")
+("knl " "Z")
+("kai " "[")
+("kqt " "\")
+("krx " "]")
+("kva " "^")
+("kqh " "_")
+("kza " "`")
+("keac" "a")
+("kjz " "b")
+("k.h " "c")
+("kx; " "d")
+("iac " "e")
+("kyx " "f")
+("krs " "g")
+("k;k " "h")
+("kkd " "i")
+("jk; " "j")
+("kz.h" "k")
+("tgee" "l")
+("uae " "m")
+("tsae" "n")
+("j;b " "o")
+("ozb " "p")
+("lai " "q")
+("ept " "r")
+("j;j " "s")
+("zoaa" "t")
+("zoe " "u")
+(";zx " "v")
+(";tk " "w")
+(";kq " "x")
+(";zh " "y")
+(";y. " "z")
+(";, " "{")
+(";gr " "|")
+(";z " "}")
+(";of " "~ʡ")
+(";lf " "ʢ")
+(";laa" "ʣ")
+(";ads" "ʤ")
+(";ke " "ʥ")
+("c; " "ʦ")
+("pkq " "ʧ")
+("pkj " "ʨ")
+("pys " "ʩ")
+("roas" "ʪ")
+("rig " "ʫ")
+("kjr " "ʬ")
+("rads" "ʭ")
+("rkj " "ʮ")
+("qqr " "ʯ")
+(".f " "ʰ")
+("zz " "ʱ")
+("wf " "ʲ")
+("waax" "ʳ")
+("wjk " "ʴ")
+("wig " "ʵ")
+("wke " "ʶ")
+("wkj " "ʷ")
+("wkx " "ʸ")
+("wy. " "ʹ")
+("waas" "ʺ")
+("wo " "ʻ")
+("nlz " "ʼ")
+("nlq " "ʽ")
+("zsh." "ʾ")
+("zsar" "ʿ")
+("daf " "")
+("daas" "")
+("dqdl" "")
+("dlb " "")
+("dl. " "")
+("dig " "")
+("tdsd" "")
+("dlz " "")
+("do " "")
+("dke " "")
+("awq " "")
+("jdts" "")
+("jdjs" "")
+("nfb " "")
+("nads" "")
+("nqdl" "")
+("nig " "")
+("no " "")
+("kjf " "")
+("tgts" "")
+(".kx " "")
+(".lb " "")
+("anx " "")
+("acn " "")
+("ean " "")
+("nyc " "")
+("naas" "")
+("nfb " "")
+("nads" "")
+("n;d " "")
+("nof " "")
+("nlb " "")
+("njk " "")
+("noas" "")
+("n.d " "")
+("no " "")
+("nz " "")
+("nig " "")
+("gts " "")
+("oyc " "")
+("ojs " "")
+("oaax" "")
+("oaas" "")
+("oz " "")
+("op " "")
+("olb " "")
+("ojk " "")
+("ooas" "")
+("ozsh" "")
+("oxs " "")
+("ou " "")
+("olz " "")
+("oads" "")
+("oig " "")
+("oke " "")
+("ag. " "")
+("paf " "")
+("plh " "")
+("pz " "")
+("pd " "")
+("vaf " "")
+("vaag" "")
+("vax " "@")
+("vz " "A")
+("vas " "B")
+("vbh " "C")
+("vgds" "D")
+("vgf " "E")
+("vos " "F")
+("vsh " "G")
+("rsf " "H")
+("od " "I")
+("oed " "J")
+("ch " "K")
+("caf " "L")
+("cfd " "M")
+("caax" "N")
+("czsh" "O")
+("cqj " "P")
+("czh " "Q")
+("czx " "R")
+("cp " "S")
+("ce " "T")
+("cjk " "U")
+("cxs " "V")
+("cl. " "W")
+("cd " "X")
+("coas" "Y")
+("czb " "Z")
+("cfb " "[")
+("cof " "\")
+("ckq " "]")
+(",q " "^")
+(",gds" "_")
+("ofjh" "`")
+(".yc " "a")
+(".qdl" "b")
+(".gr " "c")
+(".;d " "d")
+(".xs " "e")
+(".ys " "f")
+(".lr " "g")
+("araf" "hi")
+("arlh" "j")
+("ared" "k")
+("arq " "l")
+("pad " "m")
+("pfag" "n")
+("had " "o")
+("hq " "p")
+("lpf " "q")
+("yhlg" "r")
+("aes " "s")
+("ujh " "t")
+(";u " "u")
+("uos " "v")
+("ulsh" "w")
+("u. " "x")
+("fac " "y")
+("fr " "z")
+("fax " "{")
+("ftg " "|")
+("fts " "}")
+("fgf " "~")
+("flf " "ˡ")
+("fsh " "ˢ")
+("flsh" "ˣ")
+("...." "ˤ")
+("bn " "˥")
+("dn " "˦")
+("yst " "˧")
+("ht " "˨")
+("jst " "˩")
+("zt " "˪")
+("aast" "˫")
+("kjt " "ˬ")
+("tqq " "˭")
+("tzgs" "ˮ")
+("te " "˯")
+("txs " "˰")
+(";;e " "˱")
+("knlq" "˲")
+("kyk." "˳")
+("kyxk" "˴")
+("kaak" "˵")
+("kafe" "˶")
+("kztg" "˷")
+("kr; " "˸")
+("kae " "˹")
+("kzag" "˺")
+("kaxr" "˻")
+("ktx " "˼")
+("keq " "˽")
+("kjq " "˾")
+("kp; " "˿")
+("klp " "")
+("kjzs" "")
+("kos " "")
+("klf;" "")
+("klu " "")
+("klm " "")
+("kxof" "")
+("kw; " "")
+("knw " "")
+("knlq" "")
+("kale" "")
+("k.; " "")
+("ki; " "")
+("j, " "")
+("kos " "")
+("ki; " "")
+("aee " "")
+("rre " "")
+("zaae" "")
+("hbe " "")
+("fdjh" "")
+("r;b " "")
+("l, " "")
+("lofd" "")
+("qi; " "")
+("zofd" "")
+("zaxr" "")
+(";nl " "")
+(";rx " "")
+(";ra " "")
+(";oad" "")
+(";qjd" "")
+(";tge" "")
+(";e; " "")
+(";;ag" "")
+(";pa " "")
+(";jr " "")
+(";/ " "")
+(";l; " "")
+(";xb " "")
+(";x; " "")
+(";ai " "")
+(";tss" "")
+(";va " "")
+(";zjd" "")
+(";sz " "")
+(";oaa" "")
+(";ib " "")
+("plv " "")
+("pib " "")
+("rza " "")
+("rtge" "")
+("rbq " "")
+("re; " "")
+("rjz " "")
+("rj; " "")
+("rsz " "")
+("rli " "")
+("roa " "")
+("roaa" "")
+("rxb " "")
+("rkr " "")
+("ri " "")
+("rnq " "@")
+("rib " "A")
+("rk. " "B")
+("zodj" "C")
+("wyr " "D")
+("wva " "E")
+("wra " "F")
+("wjz " "G")
+("wpa " "H")
+("wjr " "I")
+("wl; " "J")
+("wyx " "K")
+("wnl " "L")
+("wae " "M")
+("wqt " "N")
+("wj; " "O")
+("wpd " "P")
+("wlv " "Q")
+("wib " "R")
+("mgsw" "S")
+("kfhw" "T")
+("gfls" "U")
+("wbgf" "V")
+("nnl " "W")
+("ng " "X")
+("bnk " "Y")
+("bp " "Z")
+("dnq " "[")
+("dnk " "\")
+("dqt " "]")
+("df; " "^")
+("dza " "_")
+("dua " "`")
+("dpd " "a")
+("djz " "b")
+("dl; " "c")
+("dib " "d")
+("dqd " "e")
+("dtge" "f")
+("dj; " "g")
+("doe " "h")
+("dtb " "i")
+("dlp " "j")
+("dxb " "k")
+("dy " "l")
+("jdzh" "m")
+("jdtb" "n")
+("jdoz" "o")
+("tgj;" "p")
+("tgdb" "q")
+("tgkh" "r")
+("tgoa" "s")
+("wc " "t")
+(".ua " "u")
+(".ib " "v")
+(".oaa" "w")
+("y.n " "x")
+("on " "y")
+("nnl " "z")
+("nai " "{")
+("nf; " "|")
+("najk" "}")
+("ntss" "~")
+("nqx " "̡")
+("nj; " "̢")
+("ne; " "̣")
+("n;s " "̤")
+("nua " "̥")
+("npf " "̦")
+("n/ " "̧")
+("noz " "̨")
+("noe " "̩")
+("nl; " "̪")
+("nxb " "̫")
+("nwb " "̬")
+("ni " "̭")
+("nza " "̮")
+("nlts" "̯")
+("nib " "̰")
+("axax" "̱")
+("ghf " "̲")
+("ons " "̳")
+("ors " "̴")
+("ora " "̵")
+("orx " "̶")
+("ozjd" "̷")
+("ooz " "̸")
+("okfh" "̹")
+("ok. " "̺")
+("obq " "̻")
+("oua " "̼")
+("opd " "̽")
+("ojr " "̾")
+("ojz " "̿")
+("oln " "")
+("kj. " "")
+("xo " "")
+("hos " "")
+("ph " "")
+("py. " "")
+("pzb " "")
+("pl. " "")
+("pg " "")
+("py. " "")
+("pzk " "")
+("lzp " "")
+("pp " "")
+("plb " "")
+("pads" "")
+("pig " "")
+("pkj " "")
+("l.p " "")
+("uaas" "")
+("vaf " "")
+("vaas" "")
+("vz " "")
+("vqdl" "")
+("vads" "")
+("vgr " "")
+("vjk " "")
+("vlq " "")
+("vlx " "")
+("vjk " "")
+("vig " "")
+("vkj " "")
+("vn " "")
+("vaax" "")
+("vaw " "")
+("vzgs" "")
+("vlaa" "")
+("vo " "")
+("vlb " "")
+("vsb " "")
+("vkq " "")
+("vig " "")
+("pjk " "")
+("amlz" "")
+("aml." "")
+("qqlq" "")
+("ojk " "")
+("cp " "")
+("cnk " "")
+("cyx " "")
+("ci " "")
+("cai " "")
+("caac" "")
+("cra " "")
+("cvh " "")
+("cqx " "")
+("cz.h" "")
+("ctb " "")
+("cj; " "")
+("cp " "")
+("cl; " "")
+("coz " "")
+("ckfh" "")
+("clgl" "")
+("c.xk" "@")
+("coh " "A")
+("ck. " "B")
+("jsc " "C")
+("cc " "D")
+("cbgd" "E")
+("cnad" "F")
+("cgq " "G")
+("cqt " "H")
+("cva " "I")
+("cb; " "J")
+("cg " "K")
+("cpa " "L")
+("cdd " "M")
+("cor " "N")
+("cxb " "O")
+(",tk " "P")
+(",o " "Q")
+("p, " "R")
+(",hf " "S")
+(",y. " "T")
+(",gr " "U")
+(",v " "V")
+(",ads" "W")
+(",kx " "X")
+("p, " "Y")
+("kj, " "Z")
+("ofof" "[")
+(".nk " "\")
+(".aac" "]")
+(".qx " "^")
+(".za " "_")
+(".f; " "`")
+(".tge" "a")
+(".bq " "b")
+(".pa " "c")
+(".or " "d")
+(".ib " "e")
+("arf " "f")
+("arql" "g")
+("arqq" "h")
+("artk" "i")
+("arkj" "j")
+("arke" "k")
+("arjy" "l")
+("arof" "m")
+(".xkh" "n")
+("qqh " "o")
+("pys " "p")
+("pae " "q")
+("wp " "r")
+("atc " "s")
+("hq " "t")
+("tbaf" "u")
+("jys " "v")
+("jaf " "wx")
+("jos " "y")
+("gaf " "z")
+("gq " "{")
+("gas " "|")
+("gos " "}")
+("glq " "~")
+("ggf " "͡")
+("yhgs" "͢")
+("yhlh" "ͣ")
+("lvlq" "ͤ")
+("nkm " "ͥ")
+("nkaf" "ͦ")
+("lb " "ͧ")
+(",f " "ͨ")
+("xad " "ͩ")
+("aead" "ͪ")
+("kjkk" "ͫ")
+("uys " "ͬ")
+("uig " "ͭ")
+("ukf " "ͮ")
+("uo " "ͯ")
+("ujk " "Ͱ")
+("lmj " "ͱ")
+("fy. " "Ͳ")
+("fys " "ͳ")
+("faas" "ʹ")
+("fads" "͵")
+("fqq " "Ͷ")
+("ftl " "ͷ")
+("ftk " "͸")
+("fbgd" "͹")
+("fjk " "ͺ")
+("flq " "ͻ")
+("fo " "ͼ")
+("flz " "ͽ")
+("fl. " ";")
+("flb " "Ϳ")
+("fjk " "")
+("fig " "")
+("f, " "")
+("fgfs" "")
+("fzb " "")
+("flx " "")
+("fkaa" "")
+("/ad " "")
+("/sd " "")
+("/j " "")
+("/s " "")
+("a.h " "")
+("ysn " "")
+("arn " "")
+("qdln" "")
+("adsn" "")
+("zhn " "")
+("ofn " "")
+("lzn " "")
+("nlt " "")
+("ajkt" "")
+("rat " "")
+("zat " "")
+("x;t " "")
+("trx " "")
+("te; " "")
+("toe " "")
+("toaa" "")
+("tajk" "")
+("khtx" "")
+("kf,h" "")
+("kawq" "")
+("kzax" "")
+("kat;" "")
+("k;ts" "")
+("k;gz" "")
+("kjs " "")
+("kpfg" "")
+("k.zd" "")
+("kk;s" "")
+("kkkr" "")
+("kj;s" "")
+("k.ar" "")
+("kz; " "")
+("kdig" "")
+("k.w " "")
+("klrb" "")
+("klvx" "")
+("awqe" "")
+("kkre" "")
+("f;sb" "")
+("o;b " "")
+("qpw " "")
+("asjs" "")
+("zyf " "")
+("zzsh" "")
+("zq " "")
+("zpr " "")
+(";apa" "")
+(";ae " "")
+(";r; " "")
+(";axr" "")
+(";tx " "")
+(";jq " "@")
+("fl; " "A")
+(";s, " "B")
+(";ov " "C")
+(";oq " "D")
+(";lf;" "E")
+(";l.d" "F")
+(";mm " "G")
+(";ae " "H")
+("eq; " "I")
+("m; " "J")
+(";;ag" "K")
+(";rlq" "L")
+(";eq " "M")
+(";xof" "N")
+(";lp " "O")
+("rnw " "P")
+("rnlq" "Q")
+("rif " "R")
+("raxr" "S")
+("rjq " "T")
+("rs, " "U")
+("rjzs" "V")
+("rsv " "W")
+("a/r " "X")
+("rkzh" "Y")
+("rtf " "Z")
+("rcas" "[")
+("ri; " "\")
+("rrr " "]")
+(".qr " "^")
+("r;i " "_")
+("op. " "`")
+("zmm " "a")
+("wlf;" "b")
+("wr; " "c")
+("wapa" "d")
+("wafx" "e")
+("wzag" "f")
+("wov " "g")
+("wos " "h")
+("wjzs" "i")
+("wmm " "j")
+("wi; " "k")
+("w.q " "l")
+("wnw " "m")
+("wzu " "n")
+("wjq " "o")
+("woq " "p")
+("wm; " "q")
+("wsad" "r")
+("wlj;" "s")
+("wir " "t")
+("amew" "u")
+("bbbw" "v")
+("ns, " "w")
+("b;jd" "x")
+("dyxk" "y")
+("dapa" "z")
+("daxr" "{")
+("djzs" "|")
+("dlp " "}")
+("dame" "~")
+("djzs" "Ρ")
+("dzr " "΢")
+("d.; " "Σ")
+("di; " "Τ")
+("led " "Υ")
+("dnw " "Φ")
+("dztg" "Χ")
+("drlq" "Ψ")
+("dale" "Ω")
+("d.; " "Ϊ")
+("di; " "Ϋ")
+("dtx " "ά")
+("dzu " "έ")
+("dzgx" "ή")
+("gcas" "ί")
+("jdif" "ΰ")
+("jdi;" "α")
+("izjd" "β")
+("ojd " "γ")
+("w;jd" "δ")
+("nif " "ε")
+("nrfh" "ζ")
+("naxr" "η")
+("neq " "θ")
+("ns, " "ι")
+("nkv " "κ")
+("i;f " "λ")
+("iztg" "μ")
+("w. " "ν")
+(".a/ " "ξ")
+("vhn " "ο")
+("kgdn" "")
+("nyk." "")
+("nif " "")
+("nztg" "")
+("nrlq" "")
+("na/ " "")
+("nqar" "")
+("nqp " "")
+("np; " "")
+("ns, " "")
+("nmm " "")
+("nlp " "")
+("nl.d" "")
+("kfhn" "")
+("nr; " "")
+("nkv " "")
+("nlj;" "")
+("nir " "")
+("ge; " "")
+("gj; " "")
+("wbo " "")
+("oyk." "")
+("oqdd" "")
+("ozdf" "")
+("ozag" "")
+("oaxr" "")
+("otx " "")
+("obbb" "")
+("ojq " "")
+("o.; " "")
+("omm " "")
+("owm " "")
+("o.ok" "")
+("onlq" "")
+("oylx" "")
+("ovj " "")
+("oae " "")
+("oz, " "")
+("okar" "")
+("e;eb" "")
+("tsa." "")
+("l;o " "")
+("hogf" "")
+("hbp " "")
+("pyx " "")
+("ptge" "")
+("pbq " "")
+("pal." "")
+("pze " "")
+("pdd " "")
+("poz " "")
+("pl; " "")
+("pajk" "")
+(".kp " "")
+("podj" "")
+("phb " "")
+("pqb " "")
+("udd " "")
+("ul; " "")
+("vnq " "")
+("vnl " "")
+("vi " "")
+("vva " "")
+("vqt " "@")
+("vrs " "A")
+("vza " "B")
+("vg " "C")
+("vtb " "D")
+("vb; " "E")
+("vbq " "F")
+("vtge" "G")
+("vua " "H")
+("vjr " "I")
+("v;ag" "J")
+("vjz " "K")
+("v;k " "L")
+("v;s " "M")
+("v/ " "N")
+("vdd " "O")
+("voz " "P")
+("vogs" "Q")
+("vlts" "R")
+("vkfh" "S")
+("v.xk" "T")
+("vaac" "U")
+("x;v " "V")
+("vnk " "W")
+("vy " "X")
+("vz.h" "Y")
+("vgq " "Z")
+("ve; " "[")
+("vpa " "\")
+("vpd " "]")
+("v;l " "^")
+("vln " "_")
+("v.h " "`")
+("vib " "a")
+("vxb " "b")
+("kaxv" "c")
+("l;jk" "d")
+("amua" "e")
+("amk." "f")
+("yrsb" "g")
+("qqnl" "h")
+("pqq " "i")
+("b;lq" "j")
+("opd " "k")
+("o.h " "l")
+("cyk." "m")
+("cif " "n")
+("cqar" "o")
+("cztg" "p")
+("crr " "q")
+("czag" "r")
+("ca/ " "s")
+("czdf" "t")
+("ceq " "u")
+("cw; " "v")
+("cp; " "w")
+("cov " "x")
+("cm; " "y")
+("c.q " "z")
+("ckzh" "{")
+("clm " "|")
+("cnw " "}")
+("ciz " "~")
+("cr; " "ϡ")
+("crlg" "Ϣ")
+("caxr" "ϣ")
+("cz, " "Ϥ")
+("cale" "ϥ")
+("cpf " "Ϧ")
+("cpz " "ϧ")
+("cxof" "Ϩ")
+("csam" "ϩ")
+("cjzs" "Ϫ")
+("cktl" "ϫ")
+("c.q " "Ϭ")
+("c.ad" "ϭ")
+(",yr " "Ϯ")
+(",pa " "ϯ")
+(",;s " "ϰ")
+("x;, " "ϱ")
+("lts," "ϲ")
+(",ae " "ϳ")
+(",jz " "ϴ")
+(",.h " "ϵ")
+(",ib " "϶")
+("xqd " "Ϸ")
+("di " "ϸ")
+("dj; " "Ϲ")
+("ofll" "Ϻ")
+("ofpf" "ϻ")
+("ofsz" "ϼ")
+("kaxf" "Ͻ")
+("jzh " "Ͼ")
+(".r; " "Ͽ")
+(".afx" "")
+(".rlq" "")
+(".apa" "")
+(".jq " "")
+(".jfd" "")
+(".s, " "")
+("yxcl" "")
+("arnl" "")
+("arqd" "")
+("arb;" "")
+("arpd" "")
+("aryx" "")
+("arai" "")
+("arra" "")
+("arrs" "")
+("arzs" "")
+("arj;" "")
+("arua" "")
+("arpd" "")
+("arjr" "")
+("arx;" "")
+("arls" "")
+("aroj" "")
+("hqh " "")
+("kxqh" "")
+("l.jf" "")
+("plaa" "")
+("pzb " "")
+("hoas" "")
+("hqq " "")
+("bsb " "")
+("tgdu" "")
+("jjs " "")
+("jaax" "")
+("jadg" "")
+("jzb " "")
+("jlq " "")
+("jlaa" "")
+("jig " "")
+("jo " "")
+("oztd" "")
+("ozlz" "")
+("gz " "")
+("gqdl" "")
+("gqq " "")
+("gc " "")
+("glb " "")
+("gkj " "")
+("gke " "")
+("fg " "")
+("gjy " "")
+("gsb " "")
+("yhh " "")
+("yh;d" "")
+("yhsb" "")
+("yhlz" "")
+("yhke" "")
+("lvqq" "")
+("lv;d" "")
+("lvlq" "")
+("lvos" "")
+("lvkj" "")
+("nkas" "")
+("nklz" "@")
+("yzx " "A")
+("lys " "B")
+("lq " "C")
+(",os " "D")
+(",sf " "E")
+(",w " "F")
+(",fh " "G")
+(",zk " "H")
+(",lf " "I")
+("xed " "J")
+("xlsh" "K")
+("x.h " "L")
+("/z " "M")
+("irjk" "N")
+("zif " "O")
+("bbq " "P")
+("rll;" "Q")
+("aljz" "R")
+("alj." "S")
+("fkgf" "T")
+("zae " "U")
+("uyx " "V")
+("utge" "W")
+("urx " "X")
+("u;k " "Y")
+("uz.h" "Z")
+("upd " "[")
+("udd " "\")
+("uoz " "]")
+("uogs" "^")
+("uoe " "_")
+("uor " "`")
+("ul; " "a")
+("ukfh" "b")
+("ulp " "c")
+("ulgl" "d")
+("uk. " "e")
+("ujz " "f")
+("u.xk" "g")
+("afo " "h")
+("lmq " "i")
+("ddd " "j")
+("fy " "k")
+("fnl " "l")
+("fai " "m")
+("fz.h" "n")
+("fbq " "o")
+("ftge" "p")
+("fj; " "q")
+("fzs " "r")
+("fe; " "s")
+("fpf " "t")
+("fua " "u")
+("fpk " "v")
+("fxk " "w")
+("foe " "x")
+("foz " "y")
+("fkr " "z")
+("fkfh" "{")
+("fkc " "|")
+("ftgx" "}")
+("fajk" "~")
+("fza " "С")
+("ftss" "Т")
+("fsz " "У")
+("f.h " "Ф")
+("fxb " "Х")
+("/af " "Ц")
+("/lq " "Ч")
+("/os " "Ш")
+("/lh " "Щ")
+("yslu" "Ъ")
+(".afd" "Ы")
+("ykaf" "Ь")
+("ykgs" "Э")
+("ykbh" "Ю")
+("jsd " "Я")
+("lsy " "а")
+("ly " "б")
+("rcb " "в")
+("rsn " "г")
+("bqn " "д")
+("oen " "е")
+("e;n " "ж")
+("ift " "з")
+("rrt " "и")
+("rfht" "й")
+("zgxt" "к")
+("axrt" "л")
+("ovt " "м")
+("lpt " "н")
+("ljt " "о")
+(".qt " "п")
+("is " "")
+("tyxk" "")
+("tzu " "")
+("tale" "")
+("tzag" "")
+("tmm " "")
+("tov " "")
+("ky;c" "")
+("kykf" "")
+("knms" "")
+("k,, " "")
+("katc" "")
+("krk." "")
+("krak" "")
+("krlx" "")
+("kaxx" "")
+("kqtd" "")
+("kzac" "")
+("kepf" "")
+("keab" "")
+("kuts" "")
+("kuu " "")
+("kjr;" "")
+("kky " "")
+("knac" "")
+("kaax" "")
+("kvkx" "")
+("kpqq" "")
+("kjrk" "")
+("cj;s" "")
+("p;af" "")
+("rjr " "")
+("kru " "")
+("katw" "")
+("kpf;" "")
+("k.td" "")
+("ki " "")
+(",,e " "")
+("qtde" "")
+("rpe " "")
+("zqde" "")
+("bbbe" "")
+("eee " "")
+("a.he" "")
+("y;cb" "")
+("lzps" "")
+("zee " "")
+(";ccl" "")
+(";arf" "")
+(";rc " "")
+(";ap " "")
+(";rc " "")
+(";oo " "")
+(";zsh" "")
+(";tjb" "")
+("b;qd" "")
+(";m " "")
+(";;ts" "")
+(";;c " "")
+(";kkr" "")
+(";ig;" "")
+(";fjf" "")
+(";zkk" "@")
+(";paf" "A")
+(";.fh" "B")
+(";.w " "C")
+(";o; " "D")
+(";lve" "E")
+(";j " "F")
+(";iv " "G")
+("py " "H")
+("pa. " "I")
+("rhtx" "J")
+("bjr " "K")
+("r;lr" "L")
+("r.fh" "M")
+("r.gf" "N")
+("rj " "O")
+("cor " "P")
+(".sbr" "Q")
+("rnas" "R")
+("ryf " "S")
+("rnbd" "T")
+("rbjf" "U")
+("rtjb" "V")
+("rft " "W")
+("rdig" "X")
+("kkr." "Y")
+("rrsz" "Z")
+("wawq" "[")
+("w;c " "\")
+("wxoz" "]")
+("wy " "^")
+("wv; " "_")
+("wzsh" "`")
+("wlrb" "a")
+("wjs " "b")
+("w.w " "c")
+("wlve" "d")
+("zwgf" "e")
+("nqdd" "f")
+("ntl;" "g")
+("nzgx" "h")
+("qhfh" "i")
+("byf " "j")
+("oabq" "k")
+("dqh " "l")
+("dat;" "m")
+("dtl;" "n")
+(".grd" "o")
+("dyf " "p")
+("dhtx" "q")
+("ivd " "r")
+("jdcu" "s")
+("jdks" "t")
+("nrlf" "u")
+("nap " "v")
+("nofb" "w")
+("nzsh" "x")
+("tgaq" "y")
+("tgcu" "z")
+("qax." "{")
+("fjn " "|")
+("rrn " "}")
+("aljn" "~")
+("karn" "ѡ")
+("nhtx" "Ѣ")
+("nafx" "ѣ")
+("nbjf" "Ѥ")
+("n;ts" "ѥ")
+("n;u " "Ѧ")
+("npr " "ѧ")
+("npv " "Ѩ")
+("n.zd" "ѩ")
+("nxk." "Ѫ")
+("nj;s" "ѫ")
+("niv " "Ѭ")
+("n;lr" "ѭ")
+("no; " "Ѯ")
+("jqax" "ѯ")
+("gylx" "Ѱ")
+("rko " "ѱ")
+("w;o " "Ѳ")
+("onas" "ѳ")
+("ofjf" "Ѵ")
+("of,h" "ѵ")
+("objf" "Ѷ")
+("obg;" "ѷ")
+("otl;" "Ѹ")
+("obj " "ѹ")
+("o;ts" "Ѻ")
+("o.fh" "ѻ")
+("o.gf" "Ѽ")
+("o.w " "ѽ")
+("ok;s" "Ѿ")
+("oo; " "ѿ")
+("oosz" "")
+("oxk." "")
+("oj " "")
+("oq " "")
+("oap." "")
+("orc " "")
+("oawq" "")
+("opr " "")
+("opak" "")
+("ojs " "")
+("oec " "")
+("o.f " "")
+("oiv " "")
+("eacb" "")
+("i;eb" "")
+("hoad" "")
+("hojy" "")
+("holq" "")
+("hoo " "")
+("paxr" "")
+("pzgx" "")
+("pzag" "")
+("plj;" "")
+("ujkk" "")
+("us, " "")
+("vif " "")
+("viz " "")
+("vnw " "")
+("vrlg" "")
+("vrlq" "")
+("vaqx" "")
+("vztg" "")
+("vqt " "")
+("va/ " "")
+("vrk " "")
+("vvj " "")
+("vame" "")
+("vzdf" "")
+("vale" "")
+("vzu " "")
+("vaxr" "")
+("vcas" "")
+("vojy" "")
+("vlf;" "")
+("vlp " "")
+("fjv " "")
+("vadd" "")
+("vaak" "")
+("vae " "")
+("vzag" "")
+("vqp " "")
+("aajv" "")
+("karv" "")
+("yxkk" "")
+("r;jk" "")
+("pzjk" "")
+("i;jk" "")
+("hbjk" "")
+("erfh" "")
+("amtf" "")
+("amlu" "")
+("aelq" "")
+("kxsq" "")
+("lqos" "@")
+("bblq" "A")
+("lqa/" "B")
+("lqax" "C")
+("oa/ " "D")
+("cn;d" "E")
+("cnas" "F")
+("cnzx" "G")
+("cnof" "H")
+("cqdd" "I")
+("cfjf" "J")
+("ctl;" "K")
+("cblq" "L")
+("cqi " "M")
+("cap." "N")
+("cat;" "O")
+("cv; " "P")
+("crlf" "Q")
+("czu " "R")
+("cm " "S")
+("cpaf" "T")
+("c;c " "U")
+("c;lr" "V")
+("c.zd" "W")
+("ck;s" "X")
+("clve" "Y")
+("cj;s" "Z")
+("ckd." "[")
+("civ " "\")
+("cxoz" "]")
+("fjc " "^")
+("cnv " "_")
+("cnzh" "`")
+("crc " "a")
+("cjs " "b")
+("cpfg" "c")
+("c;gz" "d")
+("cpv " "e")
+("cjk;" "f")
+("c.w " "g")
+("cjy." "h")
+("clox" "i")
+(",apa" "j")
+(",rr " "k")
+(",s, " "l")
+("gca," "m")
+("kv, " "n")
+("ofd," "o")
+(",nlq" "p")
+(",yxk" "q")
+(",aqx" "r")
+(",vc " "s")
+(",zu " "t")
+(",jq " "u")
+(",os " "v")
+(",lu " "w")
+(",.ad" "x")
+(",ir " "y")
+(",i; " "z")
+("afa," "{")
+(",rk " "|")
+("xif " "}")
+("ofnf" "~")
+("ofir" "ҡ")
+("izof" "Ң")
+(".ccl" "ң")
+(".y " "Ҥ")
+(".qqr" "ҥ")
+(".oo " "Ҧ")
+("..zd" "ҧ")
+(".iv " "Ҩ")
+(".xk." "ҩ")
+(".lve" "Ҫ")
+("ary." "ҫ")
+("arrk" "Ҭ")
+("arae" "ҭ")
+("arcs" "Ү")
+("areq" "ү")
+("ars," "Ұ")
+("arlp" "ұ")
+("ar.d" "Ҳ")
+("arif" "ҳ")
+("artf" "Ҵ")
+("arzu" "ҵ")
+("arzf" "Ҷ")
+("arbb" "ҷ")
+("arpz" "Ҹ")
+("aros" "ҹ")
+("arlm" "Һ")
+("ari;" "һ")
+(".xkz" "Ҽ")
+(".xks" "ҽ")
+("ibqh" "Ҿ")
+("x;qh" "ҿ")
+("oror" "")
+("pk. " "")
+("hyr " "")
+("he; " "")
+("h;k " "")
+("hoe " "")
+("hl; " "")
+("htge" "")
+("hrs " "")
+("hln " "")
+("lpib" "")
+("lvu " "")
+("jnad" "")
+("jav " "")
+("jae " "")
+("jqx " "")
+("jpd " "")
+("joz " "")
+("jxb " "")
+("jk. " "")
+("jx; " "")
+("orj " "")
+("mgsj" "")
+("jj; " "")
+("gnq " "")
+("gy " "")
+("gqd " "")
+("gva " "")
+("gch " "")
+("ggs " "")
+("wbg " "")
+("gyr " "")
+("garh" "")
+("gtge" "")
+("gg " "")
+("gsz " "")
+("gib " "")
+("yhkh" "")
+("yhrx" "")
+("yhg " "")
+("yhf;" "")
+("yhzh" "")
+("yhj;" "")
+("yhoz" "")
+("lvvh" "")
+("lvqt" "")
+("lvza" "")
+("lvx;" "")
+("lvll" "")
+("lvoa" "")
+("lvbq" "")
+("lvpf" "")
+("lvlv" "")
+("nkln" "")
+("nkak" "")
+("nkj " "")
+("nkdd" "")
+("nkoj" "")
+("nk.k" "")
+("nkls" "")
+("yl; " "")
+("lys " "")
+("laf " "@")
+("lqq " "A")
+("l.. " "B")
+("ll. " "C")
+("llb " "D")
+("l.dk" "E")
+("laas" "F")
+("llaa" "G")
+("lig " "H")
+(",zb " "I")
+(",tds" "J")
+("qq, " "K")
+(",tgd" "L")
+(",gr " "M")
+(",lq " "N")
+(",l. " "O")
+("xjs " "P")
+("xar " "Q")
+("xz " "R")
+("xzh " "S")
+("xzx " "T")
+("xtgd" "U")
+("xbgd" "V")
+("xig " "W")
+("xke " "X")
+("xhf " "Y")
+("xzsh" "Z")
+("/yr " "[")
+("/ae " "\")
+("/bgl" "]")
+("/tss" "^")
+("/ua " "_")
+("/.xk" "`")
+("ifsb" "a")
+("ifkj" "b")
+("zxbb" "c")
+("bbkj" "d")
+("bb;d" "e")
+("fkcl" "f")
+("aezx" "g")
+("aeig" "h")
+("unw " "i")
+("uyxk" "j")
+("uale" "k")
+("uaxr" "l")
+("us, " "m")
+("u.ad" "n")
+("gcau" "o")
+("of " "p")
+("lm;d" "q")
+("lmts" "r")
+("fcq " "s")
+("fyk." "t")
+("fyxk" "u")
+("fafx" "v")
+("fztg" "w")
+("frr " "x")
+("frlq" "y")
+("fqsh" "z")
+("fapa" "{")
+("fvj " "|")
+("fa/ " "}")
+("fame" "~")
+("fzag" "ӡ")
+("faxr" "Ӣ")
+("ftx " "ӣ")
+("fcas" "Ӥ")
+("feq " "ӥ")
+("fjq " "Ӧ")
+("fsd." "ӧ")
+("f.; " "Ө")
+("fmm " "ө")
+("fkv " "Ӫ")
+("fkax" "ӫ")
+("fkzh" "Ӭ")
+("f.q " "ӭ")
+("f.ad" "Ӯ")
+("fi; " "ӯ")
+("fnw " "Ӱ")
+("fif " "ӱ")
+("fqdd" "Ӳ")
+("fzdr" "ӳ")
+("fale" "Ӵ")
+("f/ " "ӵ")
+("fmq " "Ӷ")
+("lses" "ӷ")
+(".es " "Ӹ")
+("/ys " "ӹ")
+("/z " "Ӻ")
+("/aas" "ӻ")
+("/qq " "Ӽ")
+("/fb " "ӽ")
+("/v " "Ӿ")
+("/bk " "ӿ")
+("/tk " "")
+("/tds" "")
+("/jk " "")
+("/o " "")
+("/.gs" "")
+("/k. " "")
+("/ig " "")
+("/kj " "")
+("/ke " "")
+("az/ " "")
+("/zsh" "")
+("/p " "")
+("/lq " "")
+("/laa" "")
+("/oas" "")
+("luz " "")
+("lugr" "")
+("ykz " "")
+("ykp " "")
+("yk;d" "")
+("ykjk" "")
+("ykla" "")
+("yklb" "")
+("ykig" "")
+("ykkj" "")
+("qjyx" "")
+("igyx" "")
+("ykjs" "")
+("ykfb" "")
+("yjh " "")
+("qiq " "")
+("asa." "")
+(".af " "")
+("mgds" "")
+("axm " "")
+("rcaf" "")
+("rcd " "")
+("slh " "")
+("sos " "")
+("saf " "")
+("qz " "")
+("qsh " "")
+("amen" "")
+("jqn " "")
+("lf;n" "")
+("lpn " "")
+("mmn " "")
+(".qn " "")
+("r;n " "")
+("zun " "")
+("qit " "")
+("ap.t" "")
+("qht " "")
+("at;t" "")
+("fjgt" "")
+("zkkt" "")
+("mt " "")
+(";l;t" "")
+(".gft" "")
+(".zjt" "")
+("o;t " "")
+("kk;t" "")
+("apaf" "")
+("apfh" "@")
+("apgs" "A")
+("igd " "B")
+("ilg " "C")
+("ils " "D")
+("tzkk" "E")
+("tec " "F")
+("kyf " "G")
+("ibad" "H")
+("z. " "I")
+(".hhq" "J")
+(".xs " "K")
+("kfjz" "L")
+("kqp " "M")
+("krqk" "N")
+("krsv" "O")
+("ka/w" "P")
+("kbar" "Q")
+("kbif" "R")
+("kequ" "S")
+("kpn " "T")
+("kpls" "U")
+("kpac" "V")
+("k.jr" "W")
+("kafo" "X")
+("kl;m" "Y")
+("klv," "Z")
+("kof " "[")
+("kop " "\")
+("klpr" "]")
+("kjm " "^")
+("k.rh" "_")
+("kyp " "`")
+("kip " "a")
+("kzp " "b")
+("kfjz" "c")
+("k;ae" "d")
+("kdae" "e")
+("kclj" "f")
+("kx " "g")
+("ka/r" "h")
+("nrbe" "i")
+("baxe" "j")
+("dale" "k")
+("m;e " "l")
+("pjb " "m")
+("qqlb" "n")
+("qqls" "o")
+("zof " "p")
+(";ctb" "q")
+(";nac" "r")
+(";yw " "s")
+(";y;f" "t")
+(";ykf" "u")
+(";irs" "v")
+(";zf " "w")
+(";atc" "x")
+(";ajk" "y")
+(";rp " "z")
+(";zps" "{")
+(";bje" "|")
+(";bdd" "}")
+(";epf" "~")
+(";leb" "ԡ")
+(";os " "Ԣ")
+(";if;" "ԣ")
+("ofa;" "Ԥ")
+(";hkh" "ԥ")
+(";rif" "Ԧ")
+(";rak" "ԧ")
+(";vkk" "Ԩ")
+(";zrr" "ԩ")
+(";.v " "Ԫ")
+("pru " "ԫ")
+("pijf" "Ԭ")
+("ry;f" "ԭ")
+("rjkv" "Ԯ")
+("rizs" "ԯ")
+("rkrh" "԰")
+("vvr " "Ա")
+("rfua" "Բ")
+("rbdd" "Գ")
+("rtc " "Դ")
+("rtjd" "Ե")
+("rjid" "Զ")
+("rpl." "Է")
+("ruu " "Ը")
+("rjo " "Թ")
+("rleb" "Ժ")
+("rr " "Ի")
+("r,, " "Լ")
+("rykf" "Խ")
+("rzf " "Ծ")
+("rru " "Կ")
+("rvp " "")
+("raea" "")
+("rrk." "")
+("rzqd" "")
+("rzrr" "")
+("ruak" "")
+("rpv " "")
+("rpf;" "")
+("reab" "")
+("r.td" "")
+("r.v " "")
+("rj;h" "")
+("ros " "")
+("eez " "")
+("wne " "")
+("wizs" "")
+("watc" "")
+("wru " "")
+("wrif" "")
+("wrak" "")
+("waeb" "")
+("waea" "")
+("wpv " "")
+("wpf;" "")
+("wepf" "")
+("w.lr" "")
+("eew " "")
+("wjr;" "")
+("wos " "")
+("wnac" "")
+("w,, " "")
+("wy; " "")
+("wy;c" "")
+("wrk." "")
+("wrlp" "")
+("wzrr" "")
+("wzqd" "")
+("wtgx" "")
+("weab" "")
+("wjrk" "")
+("wdzf" "")
+("w.v " "")
+("wlvw" "")
+("wazc" "")
+("wlpd" "")
+("qdtw" "")
+("gfaa" "")
+("gfnc" "")
+("natc" "")
+("n.v " "")
+("btqd" "")
+("dy;f" "")
+("daff" "")
+("dru " "")
+("drk." "")
+("dvp " "")
+("dbf;" "")
+("datc" "")
+("dvkk" "")
+("dzps" "")
+("dlpf" "")
+("doap" "")
+("dwp " "@")
+("dykf" "A")
+("dlvw" "B")
+("di " "C")
+("dpf;" "D")
+("jdrp" "E")
+("jdax" "F")
+("nrk." "G")
+("nrp " "H")
+("nrbk" "I")
+("nvkk" "J")
+("nlpf" "K")
+("tgyc" "L")
+("tguu" "M")
+(".zqd" "N")
+(".nac" "O")
+(".jr;" "P")
+("oon " "Q")
+(".,n " "R")
+("ivn " "S")
+("nnkq" "T")
+("nnac" "U")
+("nne " "V")
+("nizs" "W")
+("n,, " "X")
+("nvv " "Y")
+("ntgx" "Z")
+("nbbb" "[")
+("ncj;" "\")
+("npv " "]")
+("nee " "^")
+("noap" "_")
+("ngzh" "`")
+("ny;c" "a")
+("nlzc" "b")
+("npqq" "c")
+("ni " "d")
+("nijf" "e")
+("cclo" "f")
+("onms" "g")
+("oy; " "h")
+("one;" "i")
+("oykf" "j")
+("oica" "k")
+("o,, " "l")
+("oazc" "m")
+("oqax" "n")
+("oaea" "o")
+("oaeb" "p")
+("ozqd" "q")
+("oaxe" "r")
+("obbb" "s")
+("ojo " "t")
+("obf;" "u")
+("oeu " "v")
+("ojrk" "w")
+("oos " "x")
+("olpf" "y")
+("ogu " "z")
+("olvw" "{")
+("ouu " "|")
+("oleb" "}")
+("onac" "~")
+("otc " "ա")
+("oru " "բ")
+("oqx " "գ")
+("orak" "դ")
+("opqq" "ե")
+("opv " "զ")
+("k;s." "է")
+("hoib" "ը")
+("pnas" "թ")
+("pqh " "ժ")
+("pjs " "ի")
+("pxk." "լ")
+("pktl" "խ")
+("oop " "ծ")
+("uxk." "կ")
+("vhtx" "հ")
+("varf" "ձ")
+("vqqr" "ղ")
+("vzkk" "ճ")
+("vzax" "մ")
+("vz; " "յ")
+("vbg;" "ն")
+("vtjb" "շ")
+("vbj " "ո")
+("v;lr" "չ")
+("vdig" "պ")
+("vpfg" "ջ")
+("vpr " "ռ")
+("v.w " "ս")
+("v.gf" "վ")
+("vk;s" "տ")
+("vo; " "")
+("vj " "")
+("vig;" "")
+("vkc " "")
+("vccl" "")
+("vfjf" "")
+("vqi " "")
+("vv; " "")
+("vawq" "")
+("vtl;" "")
+("vgft" "")
+("vm " "")
+("v;u " "")
+("v;l;" "")
+("vxr " "")
+("vdkj" "")
+("v.zd" "")
+("v.f " "")
+("v., " "")
+("viv " "")
+("oov " "")
+("vkkr" "")
+("v;jk" "")
+("ejfk" "")
+(".zjk" "")
+("xozk" "")
+("amfs" "")
+("amfh" "")
+("am.f" "")
+("amzk" "")
+("amaq" "")
+("of;s" "")
+("cnac" "")
+("cne " "")
+("cnms" "")
+("cnkq" "")
+("cica" "")
+("crif" "")
+("crk." "")
+("cqax" "")
+("cvp " "")
+("cvkk" "")
+("cfua" "")
+("czff" "")
+("cbdd" "")
+("cpae" "")
+("cjrk" "")
+("cepf" "")
+("ccp " "")
+("cwc " "")
+("cuu " "")
+("cuts" "")
+("coae" "")
+("cl.n" "")
+("cjo " "")
+("coap" "")
+("cgv " "")
+("cign" "")
+("cbf;" "")
+("crkr" "")
+("cpah" "")
+("cpaz" "")
+("cpv " "")
+("cpp " "@")
+("ces " "A")
+("cfh " "B")
+("cfe " "C")
+("cl, " "D")
+("cjr;" "E")
+("cos " "F")
+("cif;" "G")
+(",htx" "H")
+(",ktl" "I")
+(",nas" "J")
+(",bg;" "K")
+(",awq" "L")
+(",xk." "M")
+(",.gf" "N")
+("tl;," "O")
+(",qh " "P")
+(",at;" "Q")
+(",a. " "R")
+(",jy." "S")
+(",;u " "T")
+(",ig;" "U")
+(",kk;" "V")
+(",osz" "W")
+(",lrb" "X")
+("xr, " "Y")
+("kd.," "Z")
+("oo, " "[")
+("ofa;" "\")
+("ofzh" "]")
+("ofaq" "^")
+("ofo;" "_")
+(".ykf" "`")
+(".zqd" "a")
+(".es " "b")
+(".pqq" "c")
+(".oae" "d")
+(".os " "e")
+(".lpf" "f")
+(".leb" "g")
+(".gu " "h")
+(".if;" "i")
+("yxok" "j")
+("arkl" "k")
+("ara;" "l")
+("ar;r" "m")
+("ar;u" "n")
+("aroc" "o")
+("arlb" "p")
+("arlg" "q")
+("ari;" "r")
+("art;" "s")
+("arm " "t")
+("ar;c" "u")
+("ardg" "v")
+("ar.d" "w")
+("arlx" "x")
+("ar.f" "y")
+("prfh" "z")
+("i;p " "{")
+("hyxk" "|")
+("hif " "}")
+("hzu " "~")
+("h/ " "֡")
+("hjq " "֢")
+("hmm " "֣")
+("hp; " "֤")
+("lpif" "֥")
+("lpeq" "֦")
+("cafu" "֧")
+("jiz " "֨")
+("j, " "֩")
+("jrr " "֪")
+("jztg" "֫")
+("jae " "֬")
+("jlp " "֭")
+("jm; " "֮")
+("j.ok" "֯")
+("eqj " "ְ")
+("jif " "ֱ")
+("jmm " "ֲ")
+("gr; " "ֳ")
+("ga/ " "ִ")
+("gtf " "ֵ")
+("gtx " "ֶ")
+("gjzs" "ַ")
+("g.; " "ָ")
+("eqg " "ֹ")
+("grr " "ֺ")
+("gjq " "ֻ")
+("yhbb" "ּ")
+("yhs," "ֽ")
+("yhov" "־")
+("yhjs" "ֿ")
+("yhok" "")
+("yhi;" "")
+("eqac" "")
+("y.dm" "")
+("lvnq" "")
+("lvr;" "")
+("aajv" "")
+("lvar" "")
+("nkcf" "")
+("nky." "")
+("nkrr" "")
+("lcgs" "")
+("lqt " "")
+("lqd " "")
+("lgq " "")
+("ltge" "")
+("ltss" "")
+("lj; " "")
+("lb; " "")
+("le; " "")
+("lpa " "")
+("lpb " "")
+("ll; " "")
+("llgl" "")
+("lib " "")
+("lwb " "")
+("lxf " "")
+("lq; " "")
+("lpd " "")
+("llts" "")
+(",qt " "")
+(",e; " "")
+(",va " "")
+(",jf " "")
+("xnad" "")
+("xnq " "")
+("xyr " "")
+("xrx " "")
+("xra " "")
+("xj; " "")
+("xpf " "")
+("xoz " "")
+("xogs" "")
+("xl; " "")
+("xk. " "")
+("xx; " "")
+("xva " "")
+("xjz " "")
+("xkfh" "")
+("/rr " "")
+("irhb" "")
+("ifnd" "")
+("ifoa" "")
+("irte" "")
+("ybb " "")
+("bby " "")
+("bbtb" "")
+("bboz" "")
+("bbl;" "")
+("bbzh" "")
+("bbk." "")
+("vabb" "")
+("fkqt" "")
+("fkb;" "@")
+("fkx;" "A")
+("aeae" "B")
+("aejr" "C")
+("aexb" "D")
+("unas" "E")
+("uzkk" "F")
+("uf,h" "G")
+("uawq" "H")
+("u;lr" "I")
+("u.fh" "J")
+("u.gf" "K")
+("ukkr" "L")
+("ulrb" "M")
+("uj;s" "N")
+("uxk." "O")
+("uy;d" "P")
+("uosz" "Q")
+("af;r" "R")
+("lmqd" "S")
+("lmpf" "T")
+("lmpd" "U")
+("lmoe" "V")
+("lmib" "W")
+("tges" "X")
+("fcjs" "Y")
+("fysn" "Z")
+("fhtx" "[")
+("ff,h" "\")
+("frla" "]")
+("fqi " "^")
+("fap " "_")
+("foz " "`")
+("focl" "a")
+("fqkk" "b")
+("fv; " "c")
+("ftl;" "d")
+("fjhn" "e")
+("fpkj" "f")
+("f.gf" "g")
+("f.w " "h")
+("f.zd" "i")
+("fk;s" "j")
+("fkkr" "k")
+("flrb" "l")
+("flox" "m")
+("fkoe" "n")
+("fxk." "o")
+("f.gr" "p")
+("fcv " "q")
+("fclb" "r")
+("fq " "s")
+("frjk" "t")
+("fzgx" "u")
+("fcu " "v")
+("fuab" "w")
+("fpb " "x")
+("f;ig" "y")
+("fleb" "z")
+("enl " "{")
+("eli " "|")
+("/yx " "}")
+("/qt " "~")
+("/z.h" "ס")
+("/j; " "ע")
+("/e; " "ף")
+("/jr " "פ")
+("/pf " "ץ")
+("/oz " "צ")
+("/kfh" "ק")
+("/oaa" "ר")
+("/oh " "ש")
+("/.xk" "ת")
+("/xb " "׫")
+("vs/ " "׬")
+("/l; " "׭")
+("/ajk" "׮")
+("/za " "ׯ")
+("/tb " "װ")
+(".yxd" "ױ")
+("yknq" "ײ")
+("yknk" "׳")
+("ykyx" "״")
+("yki " "׵")
+("ykrx" "׶")
+("ykzh" "׷")
+("ykj;" "׸")
+("ykjr" "׹")
+("ykoz" "׺")
+("ykos" "׻")
+("ykl;" "׼")
+("yklp" "׽")
+("ykoa" "׾")
+("ykk." "׿")
+("ybgx" "")
+("yx;x" "")
+("yltx" "")
+("ykua" "")
+("ykxb" "")
+("a/ln" "")
+("jtk " "")
+("jlb " "")
+("ofj " "")
+("yads" "")
+("yzsh" "")
+("ycl " "")
+("ylz " "")
+("kk;x" "")
+("kk;f" "")
+("a.af" "")
+("a.ts" "")
+(".jk " "")
+("mys " "")
+("rctk" "")
+("rccl" "")
+("rcla" "")
+("saf " "")
+("sfb " "")
+("stk " "")
+("slb " "")
+("stds" "")
+("qads" "")
+("qlq " "")
+("qoas" "")
+("qjk " "")
+("qsb " "")
+("qlr " "")
+("qig " "")
+("ccln" "")
+("qhn " "")
+("f,hn" "")
+("at;n" "")
+("eptn" "")
+("xk.n" "")
+(",,t " "")
+("atdt" "")
+("aebt" "")
+("vvt " "")
+("vkkt" "")
+("ost " "")
+("lebt" "")
+("lplt" "")
+("rut " "")
+(".zut" "")
+("apjs" "")
+("apsb" "")
+("apkj" "")
+("igap" "")
+("aplq" "")
+("iaf " "")
+("iax " "")
+("iz " "")
+("ios " "")
+("im " "")
+("i. " "")
+("iw " "")
+("iaf " "")
+("iaag" "@")
+("ir " "A")
+("igf " "B")
+("ifl " "C")
+("zlz " "D")
+("eaaa" "E")
+("eaf " "F")
+("trlp" "G")
+("tzqd" "H")
+("tee " "I")
+("tl, " "J")
+("tijf" "K")
+("axky" "L")
+("rfad" "M")
+("lsam" "N")
+("iblq" "O")
+("lsij" "P")
+("knk;" "Q")
+("kjky" "R")
+("kitc" "S")
+("kirq" "T")
+("krjr" "U")
+("kzc " "V")
+("krx " "W")
+("kg, " "X")
+("kfuk" "Y")
+("kpbb" "Z")
+("keqv" "[")
+("kmod" "\")
+("k.xz" "]")
+("k.es" "^")
+("kfae" "_")
+("osos" "`")
+("kit;" "a")
+("lfi;" "b")
+("l.tg" "c")
+("zlvv" "d")
+("zfuk" "e")
+(";yp " "f")
+(";y;s" "g")
+(";nrb" "h")
+(";n. " "i")
+(";hbt" "j")
+(";hl," "k")
+(";afo" "l")
+(";a/w" "m")
+(";qqp" "n")
+(";fz;" "o")
+(";fp " "p")
+(";pm " "q")
+(";l;," "r")
+(";.kp" "s")
+(";lpr" "t")
+(";i;f" "u")
+(";;ad" "v")
+(";d;d" "w")
+(";rqk" "x")
+(";ale" "y")
+(";t;q" "z")
+(";m; " "{")
+("pdae" "|")
+("rnaa" "}")
+("ryp " "~")
+("ra/r" "ء")
+("rrsv" "آ")
+("ralz" "أ")
+("rpm " "ؤ")
+("rpls" "إ")
+("rof " "ئ")
+("bqsr" "ا")
+("bgdr" "ب")
+("rv/ " "ة")
+("rqp " "ت")
+("rbj " "ث")
+("rzqx" "ج")
+("rzqu" "ح")
+("r;;g" "خ")
+("rop " "د")
+("rx " "ذ")
+("rlpr" "ر")
+("riue" "ز")
+("ctfr" "س")
+("alje" "ش")
+("whl," "ص")
+("wale" "ض")
+("wrsv" "ط")
+("bgdw" "ظ")
+("wpj " "ع")
+("wpac" "غ")
+("wpa." "ػ")
+("wpu " "ؼ")
+("wfz;" "ؽ")
+("wgjf" "ؾ")
+("wk;v" "ؿ")
+("wi;f" "")
+("wiue" "")
+("wof " "")
+("wirz" "")
+("wiue" "")
+("wnaa" "")
+("wbgv" "")
+("wzp " "")
+("wf;u" "")
+("wfjf" "")
+("wetb" "")
+("wfp " "")
+("wem " "")
+("wdae" "")
+("wlpr" "")
+("lv,w" "")
+("nhl," "")
+("nnu " "")
+("nrks" "")
+("npac" "")
+("nktb" "")
+("nem " "")
+("nxak" "")
+("r;ih" "")
+("zsop" "")
+("dip " "")
+("dn. " "")
+("dixx" "")
+("drqk" "")
+("dbj " "")
+("d;;g" "")
+("dpa." "")
+("dpls" "")
+("dpm " "")
+("d.d." "")
+("diue" "")
+("dhos" "")
+(";;;d" "")
+("dpn " "")
+("dme " "")
+("dlvf" "")
+("d.tf" "")
+("dykd" "")
+("dy;d" "")
+("dalm" "")
+("dpac" "")
+("dlpr" "")
+("drrh" "")
+("dvyr" "")
+("dzqx" "")
+("jdbr" "")
+("jdam" "")
+("wqoq" "")
+(".etb" "")
+(".pac" "")
+(".t;q" "")
+("ce;n" "")
+("nen " "")
+("nmgn" "")
+("nnn " "")
+("rakn" "")
+("eacn" "")
+("nyp " "")
+("njq " "@")
+("nqp " "A")
+("nrqk" "B")
+("nrf " "C")
+("nrsv" "D")
+("npa." "E")
+("nlpf" "F")
+("ngjf" "G")
+("n.d." "H")
+("von " "I")
+("nnaa" "J")
+("nn.;" "K")
+("nqpw" "L")
+("nale" "M")
+("npac" "N")
+("npax" "O")
+("n.ab" "P")
+("g,, " "Q")
+("qdto" "R")
+("ooo " "S")
+("okjo" "T")
+("onaa" "U")
+("oykd" "V")
+("oy;d" "W")
+("onaa" "X")
+("oiue" "Y")
+("ohl," "Z")
+("ofjz" "[")
+("oqp " "\")
+("oqpw" "]")
+("oaet" "^")
+("orqk" "_")
+("orsv" "`")
+("otfb" "a")
+("obqs" "b")
+("ogcu" "c")
+("ow. " "d")
+("o.kp" "e")
+("oi;f" "f")
+("oiue" "g")
+("olpr" "h")
+("ohos" "i")
+("oip " "j")
+("ofjf" "k")
+("opn " "l")
+("opax" "m")
+("oly " "n")
+("oop " "o")
+("o.fj" "p")
+("ogjf" "q")
+("zqdb" "rs")
+("bbb." "t")
+("pveb" "u")
+("ign." "v")
+("y;. " "w")
+(",,eb" "x")
+("y.ax" "y")
+(";;jf" "z")
+("okhf" "{")
+("rpo " "|")
+("hos," "}")
+("hozo" "~")
+("pnms" "١")
+("pykf" "٢")
+("pzps" "٣")
+("p.yr" "٤")
+("p,, " "٥")
+("ppl." "٦")
+("pjrk" "٧")
+("pos " "٨")
+("qsqp" "٩")
+("vnkq" "٪")
+("vy; " "٫")
+("vyw " "٬")
+("vhkh" "٭")
+("vica" "ٮ")
+("vizs" "ٯ")
+("v,, " "ٰ")
+("vrk." "ٱ")
+("vaea" "ٲ")
+("vqx " "ٳ")
+("vaeb" "ٴ")
+("vqax" "ٵ")
+("vrp " "ٶ")
+("vvkk" "ٷ")
+("va.h" "ٸ")
+("vbf;" "ٹ")
+("vbbb" "ٺ")
+("vjid" "ٻ")
+("vuak" "ټ")
+("v.v " "ٽ")
+("vl, " "پ")
+("vok " "ٿ")
+("vleb" "")
+("vlpf" "")
+("vign" "")
+("vijf" "")
+("vwp " "")
+("aebv" "")
+("eev " "")
+("vvig" "")
+("vvkj" "")
+("g.v " "")
+("vy;c" "")
+("vykf" "")
+("vnac" "")
+("vjkv" "")
+("vru " "")
+("vpf;" "")
+("vplv" "")
+("v.td" "")
+("vujb" "")
+("vee " "")
+("vjr;" "")
+("voap" "")
+("ve " "")
+("vkjv" "")
+("voz;" "")
+("vkxn" "")
+("zqdk" "")
+(",,jk" "")
+("jojk" "")
+("bbbk" "")
+("amtc" "")
+("amzs" "")
+("amop" "")
+("amy;" "")
+(".zub" "")
+("lqy;" "")
+("bbbq" "")
+("lqlq" "")
+("oru " "")
+("ccc " "")
+("cyp " "")
+("cyu " "")
+("cy;d" "")
+("cna;" "")
+("chl," "")
+("cirz" "")
+("cr;x" "")
+("cv/ " "")
+("cqp " "")
+("crsv" "")
+("cvac" "")
+("coi;" "")
+("cqqp" "")
+("cfjf" "")
+("calz" "")
+("ctge" "")
+("ct;q" "")
+("cbaz" "")
+("cgcu" "")
+("cclj" "")
+("cfz;" "")
+("cfqd" "")
+("cem " "")
+("cjzh" "@")
+("cpac" "A")
+("cpm " "B")
+("c/q " "C")
+("cpax" "D")
+("cdz," "E")
+("cfg " "F")
+("clv," "G")
+("cly " "H")
+("cx " "I")
+("ci;f" "J")
+("ckju" "K")
+("cnkh" "L")
+("cykd" "M")
+("cy;s" "N")
+("chos" "O")
+("czp " "P")
+("ctfb" "Q")
+("czpr" "R")
+("c;ae" "S")
+("cpor" "T")
+("cfp " "U")
+("cfjz" "V")
+("cdxs" "W")
+(",ykf" "X")
+(",y;f" "Y")
+(",epf" "Z")
+(",leb" "[")
+(",ojk" "\")
+(",,, " "]")
+("aeb," "^")
+(",nmq" "_")
+(",nkq" "`")
+(",ykk" "a")
+(",rp " "b")
+(",pu " "c")
+(",plf" "d")
+("e, " "e")
+("daxx" "f")
+("cj;l" "g")
+("ofis" "h")
+("ofyf" "i")
+("offa" "j")
+("ofjd" "k")
+("ofuk" "l")
+("puzh" "m")
+("zhzh" "n")
+(".fjz" "o")
+(".f;u" "p")
+(".bgv" "q")
+(".etb" "r")
+(".m; " "s")
+(".pls" "t")
+(".w. " "u")
+(".x " "v")
+("..d." "w")
+(".gjf" "x")
+("vkkh" "y")
+("arnc" "z")
+("arns" "{")
+("ar,," "|")
+("arzf" "}")
+("arax" "~")
+("arb;" "ڡ")
+("areb" "ڢ")
+("arwc" "ڣ")
+("arj;" "ڤ")
+("ar.d" "ڥ")
+("ary;" "ڦ")
+("arp." "ڧ")
+("arpp" "ڨ")
+("arjk" "ک")
+("aree" "ڪ")
+(".zjh" "ګ")
+("nnjf" "ڬ")
+("pxk." "ڭ")
+("ivp " "ڮ")
+("hccl" "گ")
+("hrlf" "ڰ")
+("hqh " "ڱ")
+("hat;" "ڲ")
+("hzsh" "ڳ")
+("hcu " "ڴ")
+("hkkr" "ڵ")
+("hosz" "ڶ")
+("alpp" "ڷ")
+("lplx" "ڸ")
+("f,hu" "ڹ")
+("jnas" "ں")
+("jktl" "ڻ")
+("jcu " "ڼ")
+("jjs " "ڽ")
+("jpaf" "ھ")
+("j;u " "ڿ")
+("j.zd" "")
+("jlox" "")
+("jj;s" "")
+("bgd;" "")
+("ozkr" "")
+("ghtx" "")
+("gzkk" "")
+("gzsh" "")
+("gawq" "")
+("gfys" "")
+("gpv " "")
+("glox" "")
+("gj " "")
+("cclg" "")
+("oog " "")
+("gq " "")
+("go; " "")
+("giv " "")
+("yhax" "")
+("yhzx" "")
+("yhtb" "")
+("yho;" "")
+("lvhx" "")
+("lvkl" "")
+("lv.f" "")
+("lviv" "")
+("lvx." "")
+("nkrf" "")
+("yv; " "")
+("ynzx" "")
+("lyk." "")
+("lqj " "")
+("ls, " "")
+("llf;" "")
+("lir " "")
+("lw; " "")
+("lrr " "")
+("lo; " "")
+("los " "")
+("aaj," "")
+(",a/ " "")
+(",alp" "")
+(",jq " "")
+("xaak" "")
+("xyxk" "")
+("xif " "")
+("xrr " "")
+("xcas" "")
+("xjq " "")
+("xpz " "")
+("xpx " "")
+("izx " "")
+("fjx " "")
+("xxxx" "")
+("xadd" "")
+("xalp" "")
+("xs, " "")
+("xov " "")
+("xir " "")
+("x.ad" "")
+("ofdf" "")
+("ofdq" "")
+("/;u " "")
+("/.gf" "@")
+("ifax" "A")
+("ifzg" "B")
+("irak" "C")
+("mmbb" "D")
+("aeae" "EF")
+("aer;" "G")
+("rjkx" "H")
+("eqjk" "I")
+("uizs" "J")
+("urp " "K")
+("ubf;" "L")
+("ubbb" "M")
+("ulvw" "N")
+("uky " "O")
+("uign" "P")
+("uykf" "Q")
+("tdqd" "R")
+("ljkk" "S")
+("raxx" "T")
+("axrr" "U")
+("axrx" "V")
+("ol, " "W")
+("lmrk" "X")
+("lm.q" "Y")
+("lmzg" "Z")
+("ifjs" "[")
+("dddd" "\")
+("fcqd" "]")
+("fcua" "^")
+("fnac" "_")
+("fnms" "`")
+("fyw " "a")
+("fyks" "b")
+("fnoa" "c")
+("fizs" "d")
+("f,, " "e")
+("fzf " "f")
+("fatc" "g")
+("faeb" "h")
+("foy " "i")
+("fqr " "j")
+("fqdb" "k")
+("fvje" "l")
+("frak" "m")
+("fozh" "n")
+("fvo " "o")
+("fvkx" "p")
+("faxe" "q")
+("fgcd" "r")
+("f;av" "s")
+("fpqq" "t")
+("fpp " "u")
+("fjis" "v")
+("fwc " "w")
+("futs" "x")
+("fjo " "y")
+("flvl" "z")
+("fky " "{")
+("flpf" "|")
+("flph" "}")
+("fi " "~")
+("fijf" "ۡ")
+("fgu " "ۢ")
+("fwf;" "ۣ")
+("fwp " "ۤ")
+("fng " "ۥ")
+("fnua" "ۦ")
+("fcqt" "ۧ")
+("fcj;" "ۨ")
+("fntk" "۩")
+("fvp " "۪")
+("fvv " "۫")
+("fopf" "۬")
+("fols" "ۭ")
+("fjf " "ۮ")
+("fe " "ۯ")
+("fazc" "۰")
+("/if " "۱۲")
+("/ztg" "۳")
+("r/x " "۴")
+("/r; " "۵")
+("/ame" "۶")
+("fj/ " "۷")
+("/tx " "۸")
+("/jzs" "۹")
+("/ktl" "ۺ")
+("rk/ " "ۻ")
+("qsh/" "ۼ")
+("le/ " "۽")
+("/alp" "۾")
+("/xof" "ۿ")
+("luae" "")
+(".rkd" "")
+(".jqd" "")
+("ykr;" "")
+("ykzo" "")
+("ykap" "")
+("ykzf" "")
+("ykpz" "")
+("ykov" "")
+("yk.q" "")
+("yk.;" "")
+("yki;" "")
+("ykw;" "")
+("ymmx" "")
+("pvlx" "")
+("yktx" "")
+("nljs" "")
+("e;js" "")
+("gqjs" "")
+("joaa" "")
+("j.xk" "")
+("jpa " "")
+("yqt " "")
+("yrs " "")
+("yvh " "")
+("yz.h" "")
+("ye; " "")
+("yj; " "")
+("ydd " "")
+("yoz " "")
+("yib " "")
+("yx; " "")
+("/y " "")
+("ynq " "")
+("yi " "")
+("yra " "")
+("yxb " "")
+("a.gs" "")
+(".nk " "")
+(".dd " "")
+("m;s " "")
+("moaa" "")
+("rsm " "")
+("mor " "")
+("xzm " "")
+("rcua" "")
+("rcll" "")
+("rcdd" "")
+("si " "")
+("syr " "")
+("sf; " "")
+("srs " "")
+("sg " "")
+("sbq " "")
+("sb; " "")
+("se; " "")
+("sua " "")
+("sk. " "")
+("skfh" "")
+("soh " "")
+("qai " "")
+("qz.h" "")
+("qj; " "")
+("q;k " "@")
+("q;s " "A")
+("qjz " "B")
+("ql; " "C")
+("qkfh" "D")
+("qoaa" "E")
+("qib " "F")
+("qgs " "G")
+("qk. " "H")
+("q.xk" "I")
+("xzq " "J")
+("qyr " "K")
+("qx; " "L")
+("nen " "M")
+("epfn" "N")
+("wcn " "O")
+("jqt " "P")
+("hlgt" "Q")
+("a/rt" "R")
+("bjt " "S")
+("t;qt" "T")
+("bazt" "U")
+("jzht" "V")
+("jswt" "W")
+("equt" "X")
+("fz;t" "Y")
+("ktot" "Z")
+("l;mt" "[")
+("iuet" "\")
+("apnq" "]")
+("apf;" "^")
+("ape;" "_")
+("apoe" "`")
+("apqd" "a")
+("ih " "b")
+("in " "c")
+("i, " "d")
+("iaf " "e")
+("iqq " "f")
+("izh " "g")
+("itgd" "h")
+("itk " "i")
+("itds" "j")
+("ilb " "k")
+("io " "l")
+("i.dk" "m")
+("ikx " "n")
+("ihf " "o")
+("iys " "p")
+("ijs " "q")
+("izx " "r")
+("ip " "s")
+("ieb " "t")
+("ixs " "u")
+("iu " "v")
+("ikj " "w")
+("zoz " "x")
+("eh " "y")
+("eys " "z")
+("elq " "{")
+("tzax" "|")
+("talz" "}")
+("tpax" "~")
+("tor " "ܡ")
+("tiue" "ܢ")
+("top " "ܣ")
+("igky" "ܤ")
+("fky " "ܥ")
+("afky" "ܦ")
+("zh " "ܧ")
+("zkj " "ܨ")
+("rfaf" "ܩ")
+("rfas" "ܪ")
+("rflh" "ܫ")
+("afam" "ܬ")
+("x. " "ܭ")
+("iblz" "ܮ")
+("l,s " "ܯ")
+("ca, " "ܰ")
+(",mqs" "ܱ")
+("vqis" "ܲ")
+("yp;a" "ܳ")
+("kypf" "ܴ")
+("kae," "ܵ")
+("kqn " "ܶ")
+("kqp " "ܷ")
+("ka/c" "ܸ")
+("ka/s" "ܹ")
+("kq;;" "ܺ")
+("kp/b" "ܻ")
+("kp;w" "ܼ")
+("kduu" "ܽ")
+("kl,n" "ܾ")
+("kmac" "ܿ")
+("k.kc" "")
+("kigm" "")
+("i;;k" "")
+("kzex" "")
+("kz.." "")
+("kdky" "")
+("av.j" "")
+("zfhe" "")
+("duue" "")
+("xxxe" "")
+(";y;;" "")
+(";itc" "")
+(";iku" "")
+(";nr;" "")
+(";bbu" "")
+(";qm " "")
+(";qjd" "")
+("vqsb" "")
+(";fuk" "")
+(";al." "")
+(";cm " "")
+(";;;v" "")
+(";fi;" "")
+(";eqv" "")
+(";fkv" "")
+(";zah" "")
+(";/u " "")
+(";odb" "")
+(";w;s" "")
+(";k.m" "")
+(";idu" "")
+(";ykh" "")
+(";mod" "")
+("prxu" "")
+("rjpk" "")
+("rrkc" "")
+("r;m " "")
+("rdqi" "")
+("uizr" "")
+("rk,u" "")
+("rohp" "")
+("rkxb" "")
+("rnk;" "")
+("rykh" "")
+("ry;;" "")
+("rqjd" "")
+("ra/v" "")
+("r/ae" "")
+("c;lr" "")
+("hbur" "")
+("vaea" "")
+("wjpk" "")
+("wzlc" "")
+("wtgk" "")
+("wda." "")
+("wda/" "")
+("wmod" "")
+("uizw" "")
+("wldd" "")
+("wox " "")
+(",,jw" "")
+("lmsw" "")
+("wnk;" "")
+("wzah" "@")
+("wzlv" "A")
+("wrx " "B")
+("wr;x" "C")
+("wfae" "D")
+("w.o " "E")
+("wohp" "F")
+("qd;w" "G")
+("nctb" "H")
+("nfuk" "I")
+("n.xk" "J")
+("pacl" "K")
+("zsmu" "L")
+("dnk;" "M")
+("dnt;" "N")
+("dlvq" "O")
+("dmqv" "P")
+("dljv" "Q")
+("dox " "R")
+("ivdd" "S")
+("dl, " "T")
+("dohp" "U")
+("dit;" "V")
+("awqo" "W")
+("jdn." "X")
+("jdjk" "Y")
+("jdqm" "Z")
+("jd.o" "[")
+("lmsd" "\")
+("nrxu" "]")
+("yag," "^")
+("nox " "_")
+("nodb" "`")
+("nohp" "a")
+("vatb" "b")
+("..xz" "c")
+(".mod" "d")
+("zpn " "e")
+("nyxp" "f")
+("nitc" "g")
+("nrx " "h")
+("nbh/" "i")
+("nbbu" "j")
+("nmu " "k")
+("nmod" "l")
+("n.o " "m")
+("nkyb" "n")
+("njpk" "o")
+("nqm " "p")
+("n.xz" "q")
+("ypax" "r")
+("rapx" "s")
+("bazx" "t")
+("porx" "u")
+("lgbx" "v")
+("gafo" "w")
+("cueo" "x")
+("lv,o" "y")
+("oyxp" "z")
+("oykh" "{")
+("ojky" "|")
+("oidu" "}")
+("oiku" "~")
+("onr;" "ݡ")
+("oqm " "ݢ")
+("oqaf" "ݣ")
+("orxu" "ݤ")
+("orlp" "ݥ")
+("oqjd" "ݦ")
+("ofuk" "ݧ")
+("oaxp" "ݨ")
+("ozax" "ݩ")
+("obrx" "ݪ")
+("otgk" "ݫ")
+("omu " "ݬ")
+("opbb" "ݭ")
+("opzn" "ݮ")
+("o/u " "ݯ")
+("o.o " "ݰ")
+("oldd" "ݱ")
+("obbu" "ݲ")
+("ol, " "ݳ")
+("olen" "ݴ")
+("ogbb" "ݵ")
+("o.es" "ݶ")
+("v;eo" "ݷ")
+("oitc" "ݸ")
+("oa/v" "ݹ")
+("obbv" "ݺ")
+("ogfx" "ݻ")
+("tsab" "ݼ")
+("y.gf" "ݽ")
+("hocu" "ݾ")
+("phos" "ݿ")
+("pbaz" "")
+("pv/ " "")
+("pt;q" "")
+("tsap" "")
+("palm" "")
+("pzp " "")
+("pfjf" "")
+("pae." "")
+("ufjz" "")
+("vnaa" "")
+("vy;d" "")
+("vhos" "")
+("vjq " "")
+("vip " "")
+("vzaz" "")
+("vzp " "")
+("vqp " "")
+("vrsv" "")
+("vrqk" "")
+("vvpa" "")
+("vtfb" "")
+("vbgv" "")
+("vgcu" "")
+("vfz;" "")
+("vetb" "")
+("vpls" "")
+("vpax" "")
+("vw. " "")
+("v.ab" "")
+("vof " "")
+("vlv," "")
+("vosb" "")
+("vka." "")
+("vl;m" "")
+("v.fj" "")
+("vgjf" "")
+("aajv" "")
+("bgdv" "")
+("vn.;" "")
+("vykd" "")
+("vn. " "")
+("vqpw" "")
+("vv;e" "")
+("vzqx" "")
+("vf;u" "")
+("vzrr" "")
+("vbaz" "")
+("vt;q" "")
+("vpn " "")
+("vdae" "")
+("vlpr" "")
+("v.cd" "")
+("ypjk" "")
+("a/rk" "")
+("afok" "")
+("dalk" "")
+("iuek" "")
+("rqkk" "")
+("amaa" "")
+("vqsb" "")
+("zquq" "")
+("plkq" "")
+("iueq" "@")
+("pjlq" "A")
+("lqpn" "B")
+("cnkk" "C")
+("cypx" "D")
+("cy;;" "E")
+("cnt;" "F")
+("cyxp" "G")
+("cjpk" "H")
+("citc" "I")
+("cir," "J")
+("cirq" "K")
+("czlv" "L")
+("cfjx" "M")
+("cqjd" "N")
+("cqdd" "O")
+("czah" "P")
+("ctiv" "Q")
+("cbh/" "R")
+("cpcs" "S")
+("cpa." "T")
+("cdqi" "U")
+("cda/" "V")
+("cda." "W")
+("ck.i" "X")
+("codb" "Y")
+("cox " "Z")
+("ckxb" "[")
+("clpf" "\")
+("cjk;" "]")
+("czc " "^")
+("cr;x" "_")
+("cvrr" "`")
+("caxp" "a")
+("cg, " "b")
+("cprh" "c")
+("cpi " "d")
+("c;m " "e")
+("cmqv" "f")
+("co, " "g")
+("clvq" "h")
+("cled" "i")
+("ckif" "j")
+(",jq " "k")
+(",,e;" "l")
+(",t;q" "m")
+(",bgv" "n")
+(",rsv" "o")
+(",rqk" "p")
+(",bj " "q")
+(",,jh" "r")
+("k;v," "s")
+(",gjf" "t")
+(",ip " "u")
+(",tfb" "v")
+(",rf " "w")
+(",zqx" "x")
+(",zrr" "y")
+(",por" "z")
+(",;;;" "{")
+(",pu " "|")
+(",fjz" "}")
+(",dae" "~")
+(",op " "ޡ")
+(",lv," "ޢ")
+("pqt," "ޣ")
+("diue" "ޤ")
+("oftb" "ޥ")
+("ofeb" "ަ")
+("ofjh" "ާ")
+("oflf" "ި")
+("rrff" "ީ")
+(".qhh" "ު")
+(".zlc" "ޫ")
+(".gfx" "ެ")
+(".mod" "ޭ")
+(".odb" "ޮ")
+(".it;" "ޯ")
+(".zlv" "ް")
+("arna" "ޱ")
+("arzx" "޲")
+("artq" "޳")
+("arp." "޴")
+("arw." "޵")
+("ar.b" "޶")
+("arlm" "޷")
+("arnl" "޸")
+("arie" "޹")
+("arqp" "޺")
+("arbj" "޻")
+("arpr" "޼")
+("arjz" "޽")
+("arlc" "޾")
+("rifk" "޿")
+("y;qh" "")
+("lvwh" "")
+("cj;h" "")
+("esra" "")
+("pnms" "")
+("pbbb" "")
+("vvp " "")
+("hne " "")
+("hrlp" "")
+("ha.h" "")
+("hzps" "")
+("htqd" "")
+("hpf;" "")
+("hpae" "")
+("hoae" "")
+("hok " "")
+("hoap" "")
+("hjrk" "")
+("huu " "")
+("hlvf" "")
+("hky " "")
+("volp" "")
+("rptb" "")
+("wcu " "")
+("jnms" "")
+("jykf" "")
+("jizs" "")
+("j,, " "")
+("jrk." "")
+("jzrr" "")
+("jwc " "")
+("joap" "")
+("jijf" "")
+("jgzh" "")
+("jjr;" "")
+("bgdp" "")
+("gnac" "")
+("gy; " "")
+("gaax" "")
+("grp " "")
+("gvv " "")
+("gzqd" "")
+("gplv" "")
+("ctbg" "")
+("grsz" "")
+("gru " "")
+("gvkx" "")
+("gjid" "")
+("g.td" "")
+("gijf" "")
+("qdtg" "")
+("yhpv" "")
+("yhj;" "")
+("yhyf" "")
+("yhld" "")
+("lvrr" "")
+("lvrk" "")
+("lvfa" "")
+("lvp;" "")
+("lvlf" "")
+("lvyf" "")
+("lvqx" "")
+("lvrp" "")
+("lvpv" "@")
+("lvif" "A")
+("nkyf" "B")
+("nkqx" "C")
+("nkjo" "D")
+("y.td" "E")
+("lnas" "F")
+("lhtx" "G")
+("larf" "H")
+("lzkk" "I")
+("lbjf" "J")
+("lcu " "K")
+("l;l;" "L")
+("llrb" "M")
+("lkd." "N")
+("lkoe" "O")
+("liv " "P")
+("lpaf" "Q")
+("lo; " "R")
+("llve" "S")
+("emb," "T")
+(",pr " "U")
+(",js " "V")
+("xktl" "W")
+("xap." "X")
+("xv; " "Y")
+("xfjf" "Z")
+("xf,h" "[")
+("xtjb" "\")
+("x.zd" "]")
+("xlrb" "^")
+("xj;s" "_")
+("xcu " "`")
+("x. " "a")
+("xkk;" "b")
+("zaax" "c")
+("xnas" "d")
+("x;l;" "e")
+("x.gf" "f")
+("/qax" "g")
+("/rrc" "h")
+("/vv " "i")
+("/zps" "j")
+("/bbb" "k")
+("ifns" "l")
+("ifaq" "m")
+("ifx." "n")
+("kd.b" "o")
+("bbzk" "p")
+("fkub" "q")
+("uyp " "r")
+("uzaz" "s")
+("uqp " "t")
+("urav" "u")
+("ufjf" "v")
+("ubar" "w")
+("upm " "x")
+("upax" "y")
+("u.d." "z")
+("uw. " "{")
+("uosb" "|")
+("uiue" "}")
+("u.fj" "~")
+("uof " "ߡ")
+("um; " "ߢ")
+("twjq" "ߣ")
+("lmbq" "ߤ")
+("lmcu" "ߥ")
+("lm.f" "ߦߧ")
+("lmiv" "ߨ")
+("fcif" "ߩ")
+("fcl;" "ߪ")
+("fnkh" "߫")
+("fy;d" "߬")
+("fhos" "߭")
+("fjap" "߮")
+("fhl," "߯")
+("fiue" "߰")
+("frrh" "߱")
+("fol;" "߲")
+("fqsw" "߳")
+("ffjb" "ߴ")
+("fv/ " "ߵ")
+("fqp " "߶")
+("fa/w" "߷")
+("frqk" "߸")
+("fvj " "߹")
+("fzqx" "ߺ")
+("fzax" "߻")
+("fawb" "߼")
+("fbqs" "߽")
+("ftge" "߾")
+("fcue" "߿")
+("fpj " "")
+("fme " "")
+("f;ae" "")
+("fpoe" "")
+("fpn " "")
+("f.ab" "")
+("fkka" "")
+("flv," "")
+("fof " "")
+("ful;" "")
+("fjm " "")
+("fj;b" "")
+("fl;m" "")
+("flpr" "")
+("fkx." "")
+("fgjf" "")
+("f.tf" "")
+("fwww" "")
+("fxq " "")
+("fxlh" "")
+("fczo" "")
+("fc.k" "")
+("fyp " "")
+("fbgv" "")
+("fzp " "")
+("ffjf" "")
+("fpax" "")
+("fmgn" "")
+("fuoe" "")
+("flvp" "")
+("fktb" "")
+("fktz" "")
+("fosb" "")
+("fkju" "")
+("/htx" "")
+("/zax" "")
+("/f,h" "")
+("/qqr" "")
+("/zkk" "")
+("/zsh" "")
+("/awq" "")
+("/bj " "")
+("/cu " "")
+("/;u " "")
+("/.gf" "")
+("/ogc" "")
+("/.fh" "")
+("/iv " "")
+("/qh " "")
+("ykzx" "")
+("ykqi" "")
+("ykpv" "")
+("yk;r" "")
+("ykks" "")
+("y;tx" "")
+("ooyx" "")
+("ykzk" "")
+("yk;u" "")
+("a/w." "")
+(".oks" "")
+("jrr " "")
+("jcas" "")
+("jjzs" "")
+("j.; " "@")
+("izj " "A")
+("fjj " "B")
+("eqj " "C")
+("j/ " "D")
+("yadd" "E")
+("yqar" "F")
+("yrr " "G")
+("ybb " "H")
+("yeq " "I")
+("yjq " "J")
+("ys, " "K")
+("yfk " "L")
+("yos " "M")
+("ymm " "N")
+("yif " "O")
+("yzu " "P")
+("ym; " "Q")
+("kk;k" "R")
+("mqi " "S")
+("pfqi" "T")
+("a.yk" "U")
+("a.tx" "V")
+("ea. " "W")
+(".apa" "X")
+(".tf " "Y")
+(".kv " "Z")
+("yxkm" "[")
+("rc/ " "\")
+("rcjs" "]")
+("rcak" "^")
+("rcr;" "_")
+("rcov" "`")
+("rcl;" "a")
+("rcmm" "b")
+("rcsv" "c")
+("rcae" "d")
+("rcbb" "e")
+("rcs," "f")
+("sif " "g")
+("sztg" "h")
+("srr " "i")
+("srfh" "j")
+("saxr" "k")
+("seq " "l")
+("spx " "m")
+("sos " "n")
+("smm " "o")
+("sir " "p")
+("si; " "q")
+("qshc" "r")
+("sa/ " "s")
+("qyxk" "t")
+("qif " "u")
+("qrk " "v")
+("qale" "w")
+("q.; " "x")
+("qir " "y")
+("qlm " "z")
+("rkq " "{")
+("dzq " "|")
+("ipn " "}")
+("paln" "~")
+("daln" "")
+("emn " "")
+("fz;n" "")
+("yxpt" "")
+("jpyt" "")
+("zaat" "")
+("axxt" "")
+(";mt " "")
+("l,t " "")
+("odbt" "")
+("ljnt" "")
+("apjq" "")
+("apqp" "")
+("inq " "")
+("iyr " "")
+("iyjd" "")
+("iarh" "")
+("iae " "")
+("iqd " "")
+("ivh " "")
+("iqx " "")
+("izs " "")
+("ibq " "")
+("ij; " "")
+("ie; " "")
+("ipa " "")
+("ij " "")
+("iua " "")
+("ijz " "")
+("isz " "")
+("ixk " "")
+("ix; " "")
+("ii " "")
+("igq " "")
+("itss" "")
+("iqjd" "")
+("irx " "")
+("ig " "")
+("ieac" "")
+("ior " "")
+("iojd" "")
+("ilv " "")
+("i.h " "")
+("i.xk" "")
+("enl " "")
+("eqd " "")
+("exf " "")
+("eai " "")
+("titc" "")
+("tzqq" "")
+("tdqi" "")
+("tox " "")
+("uaky" "")
+("zbgl" "")
+("zli " "")
+("zra " "")
+("zjz " "")
+("rfo " "")
+("rftd" "")
+("rflb" "")
+("rfig" "")
+("ysam" "")
+("fbam" "")
+("oalm" "")
+("xqdl" "")
+("ibnl" "")
+("iboj" "")
+("g,af" "")
+("g,lq" "")
+("g,lh" "")
+("g,f " "")
+("muaf" "")
+("mulh" "")
+("u,j " "")
+("cl, " "")
+("jl, " "")
+("l,s " "")
+("yqqq" "")
+("jaaa" "")
+("ky;h" "")
+("kiph" "")
+("k,,b" "")
+("kffm" "")
+("ka/," "")
+("krak" "")
+("kbg;" "")
+("kbgf" "")
+("k;;f" "")
+("k;dm" "")
+("kky," "")
+("vjvk" "")
+("k,mq" "")
+("kzzp" "")
+("kl,p" "")
+("krao" "@")
+("bgde" "A")
+("ky,e" "B")
+("rsmb" "C")
+("l,pb" "D")
+("q;;f" "E")
+("zp.;" "F")
+(";nnd" "G")
+(";ae," "H")
+(";a/c" "I")
+(";fft" "J")
+(";fpz" "K")
+("f;eb" "L")
+(";fkm" "M")
+(";zex" "N")
+(";pqx" "O")
+(";;s;" "P")
+(";dky" "Q")
+(";jhf" "R")
+(";lv " "S")
+(";igm" "T")
+(";qn " "U")
+("rntf" "V")
+("rzfh" "W")
+("rrr " "X")
+("rfps" "Y")
+("rrjd" "Z")
+("rp/b" "[")
+("rp;w" "\")
+("rduu" "]")
+("rxx." "^")
+("nvvr" "_")
+("rypf" "`")
+("ryk;" "a")
+("ry;t" "b")
+("ryqq" "c")
+("ra/c" "d")
+("rrqb" "e")
+("rfpz" "f")
+("rdky" "g")
+("xmfr" "h")
+("r;it" "i")
+("zce " "j")
+("wypf" "k")
+("wzag" "l")
+("wzfh" "m")
+("wqon" "n")
+("wbb." "o")
+("wp/b" "p")
+("weli" "q")
+("wfpz" "r")
+(",.w " "s")
+("zjsw" "t")
+("av.w" "u")
+("qozw" "v")
+("wnr," "w")
+("wntf" "x")
+("wntc" "y")
+("whoc" "z")
+("wrz " "{")
+("wqf;" "|")
+("av.f" "}")
+("np;w" "~")
+("nxy " "")
+("b.ec" "")
+("dypf" "")
+("dzag" "")
+("drjd" "")
+("dqp " "")
+("dbb." "")
+("dp;w" "")
+("d.kc" "")
+("doky" "")
+("d;ky" "")
+("dxmh" "")
+("dxx." "")
+("dnor" "")
+("dbbp" "")
+("dtg/" "")
+("dadm" "")
+("jdrm" "")
+("jdfz" "")
+("jdx." "")
+("nyqq" "")
+("nrr " "")
+("nrjd" "")
+("nqam" "")
+("nbrp" "")
+("ntix" "")
+("nprk" "")
+("nrh." "")
+("np;w" "")
+("tgq;" "")
+("tgpf" "")
+("a/a." "")
+(".,. " "")
+("idun" "")
+("vasn" "")
+("pa.n" "")
+("nypf" "")
+("nzfh" "")
+("nqdr" "")
+("nqp " "")
+("na/c" "")
+("nrjk" "")
+("nrr " "")
+("nbb." "")
+("nbbp" "")
+("nfpz" "")
+("np;w" "")
+("ndky" "")
+("no;n" "")
+("gfln" "")
+("nq;;" "")
+("nz.." "")
+("npqx" "")
+("axxx" "")
+("itlx" "")
+("zuqx" "")
+("lmso" "")
+("onkp" "")
+("oy.m" "")
+("oyqq" "")
+("ozag" "")
+("ozfh" "")
+("oqo " "")
+("oq;;" "")
+("oa/c" "")
+("ozex" "")
+("ozak" "")
+("ozrp" "")
+("obb." "")
+("op.;" "")
+("opx " "")
+("osfm" "")
+("o.vb" "")
+("o.fn" "")
+("olpn" "")
+("o.kc" "")
+("okyp" "")
+("oi;o" "")
+("oyps" "")
+("ozjs" "")
+("oqn " "")
+("oop." "")
+("owpv" "")
+("dqi." "")
+("rjrf" "")
+("pkxb" "")
+("py;;" "")
+("pdqi" "")
+("rxps" "")
+("pdv/" "")
+("qdtr" "")
+("vypx" "")
+("vnt;" "")
+("vhoz" "")
+("vjpk" "@")
+("virq" "A")
+("vavb" "B")
+("vrlp" "C")
+("vr;x" "D")
+("vrxu" "E")
+("vqhh" "F")
+("vfi;" "G")
+("val." "H")
+("vqee" "I")
+("vbcu" "J")
+("vey." "K")
+("vmu " "L")
+("vprh" "M")
+("vdqi" "N")
+("v.o " "O")
+("v.xz" "P")
+("vmqv" "Q")
+("vlpf" "R")
+("v.es" "S")
+("iduv" "T")
+("vir," "U")
+("vitc" "V")
+("vnlb" "W")
+("vnlu" "X")
+("vg, " "Y")
+("vrx " "Z")
+("vzlc" "[")
+("vfuk" "\")
+("vaxp" "]")
+("vbrx" "^")
+("vgfx" "_")
+("vfae" "`")
+("vpcs" "a")
+("vflp" "b")
+("y;jk" "c")
+("l,jk" "d")
+(".esk" "e")
+("am;m" "f")
+("am/u" "g")
+("amlh" "h")
+("y;jb" "i")
+("q;sb" "j")
+("pbbq" "k")
+(",,jc" "l")
+("cnnd" "m")
+("cnab" "n")
+("cneb" "o")
+("cnkr" "p")
+("cyof" "q")
+("cy;t" "r")
+("cnor" "s")
+("cntc" "t")
+("cyqq" "u")
+("c,. " "v")
+("czfh" "w")
+("cq;;" "x")
+("cfps" "y")
+("czau" "z")
+("cbb." "{")
+("ctg/" "|")
+("cpff" "}")
+("cp;w" "~")
+("c;;n" "")
+("cbrp" "")
+("celi" "")
+("ces." "")
+("cfzf" "")
+("c/kk" "")
+("cduu" "")
+("cdky" "")
+("civ." "")
+("ckdu" "")
+("c.ec" "")
+("c.kc" "")
+("c..u" "")
+("cwpv" "")
+("cntf" "")
+("crh." "")
+("cae," "")
+("cvvr" "")
+("cvvh" "")
+("cz.." "")
+("ccjr" "")
+("cpqx" "")
+("c.js" "")
+("cmac" "")
+("cop." "")
+(",y;;" "")
+(",jpk" "")
+(",;m " "")
+(",pcs" "")
+(",/u " "")
+(",o, " "")
+("o/, " "")
+(",nt;" "")
+(",rxu" "")
+(",bbu" "")
+(",it;" "")
+("xit;" "")
+("dykh" "")
+("ofn;" "")
+("ofrf" "")
+("ofld" "")
+("dqih" "")
+(".yps" "")
+(".qo " "")
+(".p/b" "")
+("arn;" "")
+("ariq" "")
+("arfk" "")
+("arb/" "")
+("ari;" "")
+("arzv" "")
+("arav" "")
+("ofqh" "")
+("gjfh" "")
+("lv,h" "")
+("pop " "")
+("fjpc" "")
+("hyp " "")
+("hfjz" "")
+("hv;e" "")
+("hetb" "")
+("hm; " "")
+("hktz" "")
+("hff;" "")
+("jqtb" "")
+("jjzh" "")
+("jpac" "")
+("jlv," "")
+(".fjh" "")
+("jiue" "")
+("bgdj" "")
+("tsaj" "")
+("l/rf" "")
+("j.fj" "")
+("gykd" "")
+("grqk" "")
+("gvpa" "")
+("gpa." "")
+("gpax" "")
+("gof " "")
+("gosb" "")
+(";;;g" "")
+("ggjf" "")
+("gy;d" "")
+("getb" "")
+("gm; " "")
+("gfjz" "")
+("yhyd" "")
+("yhfz" "")
+("yhar" "")
+("yhrv" "")
+("yhtq" "")
+("yhpc" "")
+("yhp." "")
+("yhpn" "@")
+("yhjq" "A")
+("yhw." "B")
+("yh.b" "C")
+("lvqp" "D")
+("lvbs" "E")
+("lvgu" "F")
+("lv.." "G")
+("lvgf" "H")
+("lvtq" "I")
+("nkyp" "J")
+("nkfz" "K")
+("nkie" "L")
+("ybif" "M")
+("lcx;" "N")
+("lnkq" "O")
+("lhkh" "P")
+("latc" "Q")
+("lru " "R")
+("lvv " "S")
+("loqd" "T")
+("laxe" "U")
+("lgfk" "V")
+("les " "W")
+("lpae" "X")
+("lplv" "Y")
+("li;e" "Z")
+("lujb" "[")
+("lykf" "\")
+("lvkk" "]")
+(",qx " "^")
+(",pv " "_")
+(",mqs" "`")
+(",lpf" "a")
+("xy;f" "b")
+("xykf" "c")
+("x,, " "d")
+("xizs" "e")
+("xru " "f")
+("xatc" "g")
+("xatw" "h")
+("xaeb" "i")
+("xvv " "j")
+("xqax" "k")
+("xpqq" "l")
+("xpl." "m")
+("xee " "n")
+("xlvw" "o")
+("xlod" "p")
+("x.k;" "q")
+("xleb" "r")
+("xlpf" "s")
+("xgzh" "t")
+("rakx" "u")
+("g.x " "v")
+("xnms" "w")
+("xy;c" "x")
+("xajk" "y")
+("/pn " "z")
+("jr;b" "{")
+("bbyw" "|")
+("rlpb" "}")
+("bbyc" "~")
+("fkrp" "")
+("aeqx" "")
+("aenq" "")
+("uiku" "")
+("urx " "")
+("u/u " "")
+("ulen" "")
+("ulpq" "")
+("uk,u" "")
+(",,ju" "")
+("af;," "")
+("fchx" "")
+("fciv" "")
+("fykh" "")
+("fyl;" "")
+("fhoz" "")
+("fnt;" "")
+("fjpk" "")
+("fjjh" "")
+("fjky" "")
+("firq" "")
+("fitc" "")
+("fidu" "")
+("fzlv" "")
+("frlp" "")
+("fqhh" "")
+("fqjd" "")
+("foqh" "")
+("fzah" "")
+("fzlc" "")
+("fzex" "")
+("ftgk" "")
+("ftiv" "")
+("fprh" "")
+("fmu " "")
+("fkk." "")
+("fofk" "")
+("flva" "")
+("fuue" "")
+("fkru" "")
+("flpq" "")
+("fw;o" "")
+("fxkj" "")
+("f.xk" "")
+("fljn" "")
+("f.rc" "")
+("fir," "")
+("fqaf" "")
+("fvj." "")
+("flmb" "")
+("f.tb" "")
+("ewak" "")
+("/y;f" "")
+("/irs" "")
+("/atc" "")
+("/rlp" "")
+("/vp " "")
+("/qax" "")
+("/rak" "")
+("/rp " "")
+("/vkx" "")
+("/bf;" "")
+("/bbb" "")
+("/gcd" "")
+("aea/" "")
+("/pv " "")
+("/dff" "")
+("/plv" "")
+("/lvw" "")
+("/lod" "")
+("/jo " "")
+("/ky " "")
+("/leb" "")
+("/os " "")
+("/lpf" "")
+("/e " "")
+("/d.b" "")
+("/ijf" "")
+("/gzh" "")
+("qdt/" "")
+("vo/ " "")
+("ee/ " "")
+("utd/" "")
+("leb/" "")
+("ykis" "")
+("yk,," "")
+("ykrx" "")
+("ykak" "")
+("ykzs" "")
+("ykb;" "")
+("ykpp" "")
+("ykp." "")
+("ykee" "")
+("eacx" "")
+("ykbb" "@")
+("ykr." "A")
+("yke " "B")
+("af,s" "C")
+("qkks" "D")
+("rnjs" "E")
+("jsjs" "F")
+("jf,h" "G")
+("jv; " "H")
+("jqc " "I")
+("yzax" "J")
+("yawq" "K")
+("ytsn" "L")
+("yxoz" "M")
+("yhtx" "N")
+("yfjf" "O")
+("kk;;" "P")
+("a..d" "Q")
+("a.a." "R")
+("mf,h" "S")
+("mm " "T")
+("m;;d" "U")
+("rckr" "V")
+("shtx" "W")
+("saes" "X")
+("src " "Y")
+("srlf" "Z")
+("stsn" "[")
+("sbjf" "\")
+("scu " "]")
+("sosz" "^")
+("sxk." "_")
+("oo;c" "`")
+("kd.c" "a")
+("s;c " "b")
+("sec " "c")
+("qnas" "d")
+("qtl;" "e")
+("qcu " "f")
+("qkk;" "g")
+("ypft" "h")
+("yqqt" "i")
+("zaat" "j")
+("aeat" "k")
+("zfht" "l")
+("bbkt" "m")
+("fpzt" "n")
+("p/bt" "o")
+("lvt " "p")
+("wpvt" "q")
+("apqh" "r")
+("ap;r" "s")
+("ap.h" "t")
+("apxu" "u")
+("iylx" "v")
+("i, " "w")
+("iafe" "x")
+("iaf;" "y")
+("iae " "z")
+("irlq" "{")
+("izf " "|")
+("izu " "}")
+("iaxr" "~")
+("ipz " "")
+("is, " "")
+("ijts" "")
+("imm " "")
+("i.q " "")
+("ii; " "")
+("iw; " "")
+("izgx" "")
+("qshi" "")
+("iadd" "")
+("iztg" "")
+("ihb " "")
+("iaqx" "")
+("irr " "")
+("ir; " "")
+("izax" "")
+("ialp" "")
+("izdf" "")
+("izag" "")
+("icas" "")
+("ixof" "")
+("ifk " "")
+("iarx" "")
+("ikv " "")
+("ikar" "")
+("eqi " "")
+("trh." "")
+("tnor" "")
+("zs, " "")
+("rujs" "")
+("rfi " "")
+("rfva" "")
+("rfrs" "")
+("rftx" "")
+("rfj;" "")
+("rflv" "")
+("rfua" "")
+("rfls" "")
+("rftb" "")
+("rfxb" "")
+("t;qa" "")
+("t;qh" "")
+("ialm" "")
+("xe; " "")
+("xlts" "")
+("iba;" "")
+("ibf." "")
+("ibjq" "")
+("lvpl" "")
+("lvpq" "")
+("g,tk" "")
+("g,p " "")
+("g,xs" "")
+("g,lb" "")
+("qfg," "")
+("g,;d" "")
+("g,. " "")
+("muke" "")
+("z.h " "")
+("z.js" "")
+("oxfb" "")
+("oxo " "")
+("u,lq" "")
+("u,lh" "")
+("u,q " "")
+("afl," "")
+("bl, " "")
+("sfl," "")
+("fkks" "")
+("knrr" "")
+("kypa" "")
+("kfh," "")
+("kvvc" "")
+("kfl." "")
+("k/qx" "")
+("kjaa" "")
+("k.j." "")
+("kjzy" "")
+("klp." "")
+("klvn" "")
+("kvvc" "")
+(";;;e" "")
+("ezae" "")
+("fpmb" "")
+("yp;b" "")
+(";y;h" "")
+(";iph" "")
+(";k/p" "")
+(";rrs" "")
+(";aen" "")
+(";bg;" "")
+(";qe." "")
+(";qsp" "")
+(";zik" "")
+(";tqh" "@")
+(";tsk" "A")
+(";;dm" "B")
+(";;;f" "C")
+(";pab" "D")
+(";a/f" "E")
+(";or," "F")
+(";/m " "G")
+(";lz;" "H")
+("p;dm" "I")
+("riph" "J")
+("rrrs" "K")
+("rbqi" "L")
+("r;;f" "M")
+("rcaz" "N")
+("nzqr" "O")
+("tw.r" "P")
+("rypr" "Q")
+("rir;" "R")
+("riph" "S")
+("wtra" "T")
+("wf;f" "U")
+("wzkc" "V")
+("wtzu" "W")
+("wky," "X")
+(".alw" "Y")
+("wir;" "Z")
+("wypx" "[")
+("wrpk" "\")
+("wbqi" "]")
+("w;dm" "^")
+("wfaf" "_")
+("wl,p" "`")
+("b.rv" "a")
+("d,mq" "b")
+("d,,b" "c")
+("diph" "d")
+("dk/p" "e")
+("drrs" "f")
+("dl,p" "g")
+("dky," "h")
+("dlz;" "i")
+("dqsp" "j")
+("dzik" "k")
+("dzkc" "l")
+("tzqd" "m")
+("jdfm" "n")
+("jd;f" "o")
+("jdo," "p")
+("jdpc" "q")
+("nfjx" "r")
+("nprr" "s")
+("nijk" "t")
+("nor," "u")
+("tgrk" "v")
+(".bcf" "w")
+(",.n " "x")
+("zon " "y")
+("rifn" "z")
+("ny;h" "{")
+("nbg;" "|")
+("nrrs" "}")
+("nr;." "~")
+("na/f" "")
+("nzn " "")
+("nqsp" "")
+("nzkc" "")
+("na/," "")
+("n;dm" "")
+("neu " "")
+("nlvj" "")
+("nlz;" "")
+("f,hn" "")
+("ntqh" "")
+("napx" "")
+("rh.o" "")
+("rkro" "")
+("oqe." "")
+("ofpx" "")
+("ozik" "")
+("orpk" "")
+("obqi" "")
+("otqh" "")
+("oear" "")
+("oeu " "")
+("o;dm" "")
+("o;;f" "")
+("olz;" "")
+("obcf" "")
+("otzu" "")
+("oli;" "")
+("tvp." "")
+("q;;b" "")
+("eja." "")
+("jjk." "")
+("stgo" "")
+("rro " "")
+("prz " "")
+("p.kc" "")
+("pmac" "")
+("pypf" "")
+("pzfh" "")
+("prjk" "")
+("pfpz" "")
+("vyk;" "")
+("vy.m" "")
+("vzag" "")
+("vfft" "")
+("vrkh" "")
+("vv;k" "")
+("vap," "")
+("vqn " "")
+("vrjk" "")
+("vrr " "")
+("vzak" "")
+("vbbp" "")
+("vbb." "")
+("veua" "")
+("vp/b" "")
+("v.vb" "")
+("vjhf" "")
+("vxx." "")
+("vwpv" "")
+("rkrv" "")
+("qov " "")
+("vzou" "")
+("vyps" "")
+("vntf" "")
+("vzjs" "")
+("vrm " "")
+("zjsv" "")
+("vzfh" "")
+("vz.." "")
+("vtvp" "")
+("vcjr" "")
+("vf.f" "")
+("vpx " "")
+("vpqx" "")
+("vlyr" "")
+("vkdu" "")
+("vg;s" "")
+("i;vd" "")
+("elik" "")
+("amnk" "")
+("amrr" "")
+("amrd" "")
+("aml," "")
+("lqfz" "")
+("p;dq" "")
+("xxxq" "")
+("av.q" "")
+("qcam" "")
+("av.c" "")
+("c,mq" "")
+("c,,b" "")
+("cffm" "")
+("cqam" "")
+("cr;h" "@")
+("cqe." "A")
+("crao" "B")
+("crpk" "C")
+("cbg;" "D")
+("ctra" "E")
+("ctde" "F")
+("cev " "G")
+("cp, " "H")
+("c;;f" "I")
+("cda." "J")
+("cor," "K")
+("clvu" "L")
+("cjp." "M")
+("cky," "N")
+("ckyv" "O")
+("clp;" "P")
+("c.o." "Q")
+("ci;b" "R")
+("rbsc" "S")
+("cy;." "T")
+("cizx" "U")
+("cicp" "V")
+("ck/p" "W")
+("czax" "X")
+("czn " "Y")
+("cpyc" "Z")
+("cprk" "[")
+("cptq" "\")
+("cfaf" "]")
+("cey." "^")
+("cltf" "_")
+("cozp" "`")
+("clvc" "a")
+("q,am" "b")
+(",rz " "c")
+(",a/c" "d")
+(",q;;" "e")
+(",bbp" "f")
+(",pff" "g")
+(",g;s" "h")
+(",yk;" "i")
+(",yqq" "j")
+(",bjn" "k")
+(",qdr" "l")
+(",bby" "m")
+(",p;w" "n")
+(",lvm" "o")
+(",lpn" "p")
+(".kk," "q")
+(",p/b" "r")
+("nvvf" "s")
+("baaf" "t")
+(",.zh" "u")
+("rh.h" "v")
+(".ypr" "w")
+(".rrs" "x")
+(".zkc" "y")
+(".bg;" "z")
+(".caz" "{")
+(".ol," "|")
+(".rpk" "}")
+(".,. " "~")
+(".lz;" "")
+("arhc" "")
+("arqn" "")
+("arrk" "")
+("arb." "")
+("arln" "")
+("ar.c" "")
+("arwv" "")
+("arr." "")
+("arzh" "")
+("arfv" "")
+("ljvh" "")
+(",,jh" "")
+("ppp " "")
+("hirq" "")
+("hzkr" "")
+("hbh/" "")
+("h/c " "")
+("hljn" "")
+("hox " "")
+("hidk" "")
+("hfuk" "")
+("hfjn" "")
+("lpy;" "")
+("lpas" "")
+("lplf" "")
+("lplp" "")
+("jodb" "")
+("/r;x" "")
+("vajb" "")
+("jkxb" "")
+("gnr;" "")
+("gy;;" "")
+("gitc" "")
+("gfuk" "")
+("gdqi" "")
+("g.xz" "")
+("gmqv" "")
+("gox " "")
+("g.es" "")
+("gnt;" "")
+("gbbv" "")
+("yhi," "")
+("yhg," "")
+("yh.s" "")
+(",,jc" "")
+("yhpb" "")
+("yhfk" "")
+("eqpm" "")
+("lvfk" "")
+("nk,f" "")
+("nkfk" "")
+("nk.k" "")
+("lhos" "")
+("lqzk" "")
+("lcue" "")
+("lfz;" "")
+("ljcl" "")
+("lka." "")
+("lxlh" "")
+("lcrk" "")
+("lclj" "")
+(",bgv" "")
+(",gcu" "")
+(",.kp" "")
+(",iue" "")
+("xjq " "")
+("xalz" "")
+("xnaa" "")
+("xip " "")
+("xvj " "")
+("xtsp" "")
+("xgcu" "")
+("xm; " "")
+("xpn " "")
+("xka." "")
+("xktz" "")
+("xiue" "")
+("xop." "")
+("xop " "")
+("/ohp" "")
+("ifzx" "")
+("ifd," "")
+("ifie" "")
+("bbkz" "")
+("bbls" "")
+("bb.." "")
+("bbjq" "")
+("iueb" "")
+("bbpc" "")
+("aeyd" "")
+("aebz" "")
+("unkr" "")
+("uyxf" "")
+("uzfh" "@")
+("upqx" "A")
+("up;w" "B")
+("utg/" "C")
+("udky" "D")
+("if;h" "E")
+("lmij" "F")
+("lmrv" "G")
+("lmpj" "H")
+("lm.." "I")
+("lmlr" "J")
+("lmgf" "K")
+("fnnd" "L")
+("fnab" "M")
+("fyk;" "N")
+("fy;t" "O")
+("fnak" "P")
+("fysb" "Q")
+("fykx" "R")
+("fyqq" "S")
+("fhoz" "T")
+("f,pf" "U")
+("ffft" "V")
+("frh." "W")
+("frih" "X")
+("fae," "Y")
+("frkh" "Z")
+("fa/c" "[")
+("fv;k" "\")
+("fzfh" "]")
+("fqo " "^")
+("fq;;" "_")
+("frjd" "`")
+("foky" "a")
+("fa.n" "b")
+("frr " "c")
+("fbb." "d")
+("ftl," "e")
+("fbjn" "f")
+("fbgb" "g")
+("feua" "h")
+("feph" "i")
+("fpis" "j")
+("fj, " "k")
+("fpqx" "l")
+("fpx " "m")
+("fpff" "n")
+("fp;w" "o")
+("f;ky" "p")
+("f.vb" "q")
+("fl, " "r")
+("fkdv" "s")
+("fkdu" "t")
+("f.ec" "u")
+("f.kc" "v")
+("f.oj" "w")
+("fxx." "x")
+("fx.h" "y")
+("fg;s" "z")
+("fceb" "{")
+("fhoc" "|")
+("ftvp" "}")
+(".fhs" "~")
+("/naa" "")
+("/hof" "")
+("/ip " "")
+("/nid" "")
+("/hl," "")
+("/rsz" "")
+("/qpw" "")
+("/qqp" "")
+("/zax" "")
+("/ale" "")
+("/alz" "")
+("/bgv" "")
+("/gcu" "")
+("/bj " "")
+("/pac" "")
+("/pa." "")
+("/pj " "")
+("/pls" "")
+("/pu " "")
+("/w. " "")
+("/.ab" "")
+("/.d." "")
+("/l;m" "")
+("/op." "")
+("/jm " "")
+("bgd/" "")
+("/y;d" "")
+("/fjf" "")
+("lv,/" "")
+("/alm" "")
+("/fjz" "")
+("/op " "")
+(".f;d" "")
+("ykyd" "")
+("ykjq" "")
+("ykqp" "")
+("ykrv" "")
+("ykqw" "")
+("yktq" "")
+("ykeu" "")
+("ypac" "")
+("ykw." "")
+("yk.b" "")
+("yolx" "")
+("ykfz" "")
+(",,js" "")
+("esjs" "")
+("lvws" "")
+("jzqd" "")
+("jrlp" "")
+("jos " "")
+("yaeb" "")
+("yrak" "")
+("ytgx" "")
+("yaxx" "")
+("ya.h" "")
+("yeab" "")
+("yes " "")
+("ycp " "")
+("yign" "")
+("ey " "")
+("ylpf" "")
+("raky" "")
+("yrlx" "")
+("yvv " "")
+("yvkk" "")
+("yos " "")
+("yoap" "")
+("kk;q" "")
+("qilf" "")
+(".lpf" "")
+("mykf" "")
+("mjrk" "")
+("mjr;" "")
+("naam" "")
+("vkkm" "")
+("mjkv" "")
+("m,, " "")
+("rcef" "")
+("rcl," "")
+("rcky" "")
+("rci " "")
+("snms" "")
+("sy; " "")
+("syw " "")
+("sykf" "")
+("sne;" "")
+("satc" "")
+("srkr" "")
+("srp " "")
+("srak" "")
+("saeb" "")
+("szqd" "")
+("seab" "")
+("sepf" "@")
+("slvw" "A")
+("sl, " "B")
+("sky " "C")
+("srk." "D")
+("sign" "E")
+("sijf" "F")
+("qy;c" "G")
+("qru " "H")
+("qrk." "I")
+("qaxx" "J")
+("qpv " "K")
+("quu " "L")
+("qjr;" "M")
+("qos " "N")
+("fkkn" "O")
+("rjjn" "P")
+("ua.n" "Q")
+("ypfn" "R")
+("v;.n" "S")
+("irit" "T")
+("k/pt" "U")
+("tq;t" "V")
+("tget" "W")
+(";;pt" "X")
+("or,t" "Y")
+("ohjt" "Z")
+("apy;" "[")
+("apax" "\")
+("apbb" "]")
+("apwc" "^")
+("apvv" "_")
+("apld" "`")
+("apky" "a")
+("inzx" "b")
+("ihtx" "c")
+("ia,b" "d")
+("iqi " "e")
+("iat;" "f")
+("if,h" "g")
+("izkk" "h")
+("ianx" "i")
+("itjb" "j")
+("i;gz" "k")
+("ifys" "l")
+("i;u " "m")
+("i.fh" "n")
+("ilrb" "o")
+("io; " "p")
+("iosz" "q")
+("ilox" "r")
+("ikk;" "s")
+("clzi" "t")
+("inas" "u")
+("ibg;" "v")
+("ifjf" "w")
+("irn " "x")
+("iv; " "y")
+("izax" "z")
+("iawq" "{")
+("ijs " "|")
+("ixk." "}")
+("ilve" "~")
+("i. " "")
+("iig;" "")
+("rlai" "")
+("ooi " "")
+("zbdd" "")
+("ehtx" "")
+("epv " "")
+("elrb" "")
+("eo " "")
+("t;dm" "")
+("trrs" "")
+("ivky" "")
+("zy " "")
+("zcad" "")
+("zcv " "")
+("rujs" "")
+("rfr;" "")
+("rftx" "")
+("rfi;" "")
+("t;q;" "")
+("iztq" "")
+("nwam" "")
+("yk.m" "")
+("yxkm" "")
+("ifam" "")
+("bbam" "")
+("jzgm" "")
+("fkam" "")
+("leam" "")
+("xame" "")
+("aajx" "")
+("eqix" "")
+("ibff" "")
+("ibqh" "")
+("ibqi" "")
+("ibv;" "")
+("ibx." "")
+("g,nl" "")
+("g,ai" "")
+("g,qt" "")
+("g,za" "")
+("g,ua" "")
+("g,pf" "")
+("g,j;" "")
+("g,ib" "")
+("g,x;" "")
+("g,j;" "")
+("g,k." "")
+("mgs," "")
+("mutb" "")
+("z.za" "")
+("z.j;" "")
+("z.bl" "")
+("z.tb" "")
+("z.ls" "")
+("oxqx" "")
+("oxzh" "")
+("u,ys" "")
+("u,h " "")
+("u,aw" "")
+("u,cl" "")
+("u,jk" "")
+("u,kj" "")
+("u,y." "")
+("u,as" "")
+("u,kq" "")
+("u,zb" "")
+("y.l," "")
+("zl, " "")
+("afl," "")
+("arl," "")
+("fbl," "")
+("qfl," "")
+("zl, " "")
+("igl," "")
+("kjl," "")
+("zkl," "")
+("jyl," "")
+("qkl," "")
+("yqq," "")
+("p,ax" "")
+("jjg " "")
+("lgjg" "")
+("knnd" "")
+("kr;r" "")
+("kqoc" "")
+("kf/m" "")
+("kpx," "")
+("kdq," "")
+("qljf" "")
+("ejab" "")
+(";ysy" "")
+(";rin" "")
+(";/qx" "")
+(";e;z" "@")
+(";ezx" "A")
+(";/l/" "B")
+(";lp." "C")
+(";i/p" "D")
+(";i;k" "E")
+(";ypk" "F")
+("p/qx" "G")
+("p/rf" "H")
+("rypv" "I")
+("rlp." "J")
+("rea." "K")
+("r/rf" "L")
+("rljz" "M")
+("brkr" "N")
+("qdsr" "O")
+("o..r" "P")
+("wypa" "Q")
+("wfk;" "R")
+("w/qx" "S")
+("w.j." "T")
+("wj;r" "U")
+("wlp." "V")
+("wi;k" "W")
+("b;yw" "X")
+("wixn" "Y")
+("wnic" "Z")
+("w;;v" "[")
+("wfop" "\")
+("nkyd" "]")
+("dirx" "^")
+("dfps" "_")
+("dpfx" "`")
+("d/rf" "a")
+("d/ee" "b")
+("djjf" "c")
+("di;k" "d")
+("dcav" "e")
+("o..d" "f")
+("dkyd" "g")
+("dlef" "h")
+("d;ax" "i")
+("ljld" "j")
+("jd;v" "k")
+("jdjy" "l")
+("b;yd" "m")
+("jdlj" "n")
+("nypv" "o")
+("nfk;" "p")
+("nb;f" "q")
+("njjf" "r")
+("ni/p" "s")
+("tg/x" "t")
+(".lp." "u")
+("y;gn" "v")
+("qe.n" "w")
+("vkkn" "x")
+("nea." "y")
+("njaa" "z")
+("n;;v" "{")
+("n/qx" "|")
+("n/rf" "}")
+("njzy" "~")
+("nlp." "")
+("ni;k" "")
+("ilan" "")
+("ob;f" "")
+("ofps" "")
+("o/qx" "")
+("ofl." "")
+("o/l/" "")
+("olp." "")
+("y;go" "")
+("opfx" "")
+("ofrv" "")
+("olbj" "")
+("oljz" "")
+("fbth" "")
+("lz;." "")
+("r;ib" "")
+("rpkf" "")
+("pypr" "")
+("py;." "")
+("pvqi" "")
+("ptgm" "")
+("pa/f" "")
+("psxt" "")
+("p,mq" "")
+("ppyc" "")
+("p;;f" "")
+("punq" "")
+("uypr" "")
+("vypx" "")
+("vypr" "")
+("v,mq" "")
+("vk/p" "")
+("vaax" "")
+("vffm" "")
+("vrcx" "")
+("va/f" "")
+("vf;f" "")
+("vfpx" "")
+("vzik" "")
+("vzkc" "")
+("vbcf" "")
+("vtde" "")
+("v;dm" "")
+("v;;f" "")
+("vllp" "")
+("vmz," "")
+("nnnv" "")
+("qdjv" "")
+("vir;" "")
+("vy;." "")
+("v,,b" "")
+("v,,s" "")
+("vymx" "")
+("vbgf" "")
+("vzn " "")
+("vcjv" "")
+("vcjl" "")
+("vear" "")
+("vl,p" "")
+("orvv" "")
+("ffmk" "")
+("ewak" "")
+("r;ik" "")
+("amyh" "")
+("amvi" "")
+("am;f" "")
+("ohdb" "")
+("o,sb" "")
+("bgdq" "")
+("yprq" "")
+("lqip" "")
+("cysy" "")
+("cvvc" "")
+("cfpf" "")
+("cfk;" "")
+("cb;f" "")
+("cjg " "")
+("c;ax" "")
+("cs.;" "")
+("cm;n" "")
+("cea." "")
+("ce;z" "")
+("cezx" "")
+("clqk" "")
+("clbj" "")
+("cjjf" "")
+("ci/p" "")
+("cypn" "")
+("caam" "")
+("czib" "")
+("carl" "")
+("cvvc" "")
+("czqx" "")
+("ccjp" "@")
+("cjky" "A")
+("cfpm" "B")
+("cfln" "C")
+("cem," "D")
+("ccav" "E")
+("ci;k" "F")
+("rkr," "G")
+(",a/f" "H")
+(",rpk" "I")
+(",qsp" "J")
+(",tqh" "K")
+(",;;f" "L")
+(",faf" "M")
+(",ky," "N")
+(",l,p" "O")
+(",,,v" "P")
+(",iph" "Q")
+(",bg;" "R")
+(",tde" "S")
+(",ey." "T")
+(",prk" "U")
+(",lz;" "V")
+(",,,," "W")
+("tdq," "X")
+("ofyr" "Y")
+("ofl;" "Z")
+(".ezx" "[")
+(".fps" "\")
+("./qx" "]")
+(".jjf" "^")
+(".lp." "_")
+(".i;k" "`")
+(".i/p" "a")
+("qozh" "b")
+("arb;" "c")
+("arlp" "d")
+("arkp" "e")
+("arbi" "f")
+("arth" "g")
+("arkn" "h")
+("ykjh" "i")
+("wpac" "j")
+("hhoz" "k")
+("ha/c" "l")
+("hzkn" "m")
+("hrr " "n")
+("hbb." "o")
+("hfpz" "p")
+("hmac" "q")
+("h.kc" "r")
+("hpx " "s")
+("euab" "t")
+("igau" "u")
+("jnak" "v")
+("jy.m" "w")
+("jzjs" "x")
+("jp;w" "y")
+("j.kc" "z")
+("f/jj" "{")
+("j;;n" "|")
+("jypf" "}")
+("jfpz" "~")
+("jl, " "")
+("grh." "")
+("gzex" "")
+("gpx " "")
+("gdky" "")
+("gduu" "")
+("gxx." "")
+("qog " "")
+("grqb" "")
+("gz.." "")
+("gzau" "")
+("gbb." "")
+("geph" "")
+("yh/b" "")
+("lvmc" "")
+("nvvv" "")
+("lvx." "")
+("nkpw" "")
+("nkln" "")
+("nkl," "")
+("nkkv" "")
+("nkaj" "")
+("lcpq" "")
+("lykh" "")
+("ljky" "")
+("lrjr" "")
+("lrxu" "")
+("la/v" "")
+("lqee" "")
+("ltiv" "")
+("ljzs" "")
+("l;m " "")
+("l.es" "")
+("lqm " "")
+("lgc," "")
+("lqso" "")
+("lldd" "")
+("lkru" "")
+(",rlf" "")
+(",bh/" "")
+(",ljh" "")
+(",qhh" "")
+(",tgk" "")
+("xirq" "")
+("xnyf" "")
+("xypx" "")
+("xidn" "")
+("xzah" "")
+("vaxb" "")
+("xzlc" "")
+("xmu " "")
+("x;m " "")
+("x/u " "")
+("x.o " "")
+("uizx" "")
+("xlen" "")
+("lmsx" "")
+("xnr;" "")
+("xykh" "")
+("xbbv" "")
+("xzlv" "")
+("xrx " "")
+(",,jd" "")
+("/bah" "")
+("/pff" "")
+("/wpv" "")
+("ifzc" "")
+("bby;" "")
+("fkyh" "")
+("fkrr" "")
+("aekb" "")
+("uypx" "")
+("u,mq" "")
+("urrs" "")
+("uffm" "")
+("ufyf" "")
+("uzkc" "")
+("ul,p" "")
+("ulqq" "")
+("uor," "")
+("uky," "")
+("usxt" "")
+("uypr" "")
+("ljvs" "")
+("lmyh" "")
+("lmiq" "")
+("lmiu" "")
+("fcqv" "")
+("fcpm" "")
+("fypr" "")
+("fcie" "")
+("fzax" "")
+("fffm" "")
+("frrs" "")
+("fvjj" "@")
+("fzmx" "A")
+("fa.r" "B")
+("ftqh" "C")
+("f;dm" "D")
+("fen " "E")
+("feu " "F")
+("f;;f" "G")
+("f.jq" "H")
+("flvv" "I")
+("flvl" "J")
+("flvu" "K")
+("flz;" "L")
+("fol," "M")
+("fmix" "N")
+("f.ip" "O")
+("f.o." "P")
+("fw;x" "Q")
+("fsxt" "R")
+("f.am" "S")
+("fxjs" "T")
+("frib" "U")
+("fqdy" "V")
+("fxx " "W")
+("aaes" "X")
+("esax" "Y")
+("eses" "Z")
+("/nr;" "[")
+("/hoz" "\")
+("/nt;" "]")
+("/zlv" "^")
+("fpf/" "_")
+("/zlc" "`")
+("/txn" "a")
+("/mu " "b")
+("/dqi" "c")
+("//u " "d")
+("/.xz" "e")
+("uiz/" "f")
+("/ljn" "g")
+("/l, " "h")
+("/ljh" "i")
+("/ox " "j")
+("/led" "k")
+("/.es" "l")
+("vas/" "m")
+("xuq/" "n")
+("/kxb" "o")
+("yk/u" "p")
+("ykxq" "q")
+("nrkx" "r")
+("yg,x" "s")
+(",,jx" "t")
+("ae,x" "u")
+("y/cx" "v")
+("yoxx" "w")
+("lmsx" "x")
+("ykn;" "y")
+("yknd" "z")
+("ykbv" "{")
+("ykpb" "|")
+("zqxj" "}")
+("ynaa" "~")
+("yjq " "")
+("ya/r" "")
+("yzqx" "")
+("yfjf" "")
+("ygcu" "")
+("yeqa" "")
+("y;;g" "")
+("ypac" "")
+("ypn " "")
+("yof " "")
+("ygjf" "")
+("yigu" "")
+("yqp " "")
+("y;ae" "")
+("ydae" "")
+("ylpr" "")
+(".etb" "")
+(".dae" "")
+(".iue" "")
+("mpj " "")
+("tdam" "")
+("mjq " "")
+("mzp " "")
+("mr;x" "")
+("rcem" "")
+("rceb" "")
+("rcip" "")
+("rcpc" "")
+("szp " "")
+("sqp " "")
+("srqk" "")
+("srsv" "")
+("svpa" "")
+("spac" "")
+("spa." "")
+("sl;m" "")
+("sgjf" "")
+("siue" "")
+("slv," "")
+(".qpw" "")
+("qip " "")
+("qbgv" "")
+("qpls" "")
+("qdae" "")
+("qop." "")
+("qly " "")
+("q.fj" "")
+("rrrn" "")
+("bgdn" "")
+(";;in" "")
+("bqin" "")
+("mmws" "")
+("jaat" "")
+(";;;t" "")
+("i/pt" "")
+("apju" "")
+("apfu" "")
+("apgu" "")
+("appc" "")
+("aprp" "")
+("ine " "")
+("iy;f" "")
+("iizs" "")
+("i,, " "")
+("iru " "")
+("iaea" "")
+("irlp" "")
+("ivkk" "")
+("izac" "")
+("izff" "")
+("ibbb" "")
+("itqd" "")
+("ipv " "")
+("ie " "")
+("ijr;" "")
+("ijo " "")
+("ilpf" "")
+("ileb" "")
+("inac" "")
+("inms" "")
+("izu " "")
+("iirs" "")
+("iqx " "")
+("iaeb" "")
+("irkr" "")
+("irk." "")
+("irak" "")
+("icj;" "")
+("ipp " "")
+("ieu " "")
+("ifkq" "")
+("ijrk" "")
+("icp " "")
+("idzf" "")
+("iuu " "@")
+("ilod" "A")
+("ioap" "B")
+("iijf" "C")
+("qdti" "D")
+("eaci" "E")
+("ehkh" "F")
+("erlp" "G")
+("eqax" "H")
+("ezps" "I")
+("epy." "J")
+("epp " "K")
+("e.jb" "L")
+("eky " "M")
+("eoap" "N")
+("tljz" "O")
+("kyky" "P")
+("zatw" "Q")
+("zaag" "R")
+("zctx" "S")
+("rf;u" "T")
+("kd.f" "U")
+("rfjs" "V")
+("emba" "W")
+("yp.f" "X")
+("tl;m" "Y")
+("mfam" "Z")
+("lrbm" "[")
+("ib,," "\")
+("ibbb" "]")
+("iblw" "^")
+("ibkk" "_")
+("lvpf" "`")
+("g,y." "a")
+("g,ae" "b")
+("g,ax" "c")
+("g,ar" "d")
+("g,pz" "e")
+("g,s," "f")
+("g,os" "g")
+("g,ir" "h")
+("g,jq" "i")
+("muy." "j")
+("muif" "k")
+("mueq" "l")
+("muzg" "m")
+("z.ae" "n")
+("z.l;" "o")
+("z.kv" "p")
+("z.pf" "q")
+("eqjd" "r")
+("u,nq" "s")
+("u,nl" "t")
+("u,av" "u")
+("u,rx" "v")
+("u,za" "w")
+("u,pd" "x")
+("u,pk" "y")
+("u,oe" "z")
+("u,kh" "{")
+("u,x;" "|")
+("u,qd" "}")
+("u,f;" "~")
+("u,ra" "")
+("u,l;" "")
+("l,nk" "")
+("yl, " "")
+("pal," "")
+(";ag," "")
+("lnl," "")
+("ozl," "")
+("l;l," "")
+("xfl," "")
+("xbl," "")
+("b;l," "")
+("ozl," "")
+("oas," "")
+("yqqr" "")
+("yqqa" "")
+("yqqv" "")
+("fkkx" "")
+("fkks" "")
+("p,js" "")
+("p,qs" "")
+("ca,j" "")
+("fljg" "")
+("ljps" "")
+("kyq," "")
+("kr/m" "")
+("kepn" "")
+("kprc" "")
+("kw/w" "")
+("kmp." "")
+("epnb" "")
+(";nmc" "")
+(";yke" "")
+(";tdu" "")
+(";fy;" "")
+(";fkb" "")
+(";/cn" "")
+(";nkp" "")
+(";qdu" "")
+(";bbf" "")
+(";bby" "")
+("rzae" "")
+("rrgh" "")
+("rqdu" "")
+("rfru" "")
+("wak." "")
+("wbby" "")
+("pbwb" "")
+("wnnd" "")
+("wzae" "")
+("wtdu" "")
+("wrgh" "")
+("wr;r" "")
+("zpuw" "")
+("gftu" "")
+("nxlv" "")
+("nqoc" "")
+("dqoc" "")
+("jdrh" "")
+("jdf." "")
+(".dy." "")
+(".i/p" "")
+("rrbn" "")
+("b;yn" "")
+("fl;n" "")
+("nnnd" "")
+("nyke" "")
+("nfjc" "")
+("nrgh" "")
+("nzph" "")
+("nfj." "")
+("onam" "")
+("ozae" "")
+("orgh" "")
+("ozph" "")
+("olje" "")
+("o.ek" "")
+("/ri." "")
+("/l/b" "")
+("o/l/" "")
+("hoac" "")
+("plp." "")
+("vypn" "")
+("vi.n" "")
+("vypv" "")
+("virx" "")
+("vaer" "")
+("va/m" "")
+("vm;n" "")
+("v/rf" "")
+("vjjf" "")
+("vkyd" "")
+("vorb" "")
+("vkym" "")
+("qdsv" "@")
+("t.qv" "A")
+("virk" "B")
+("viln" "C")
+("vzp " "D")
+("vapa" "E")
+("va/e" "F")
+("vvvc" "G")
+("vezx" "H")
+("v/ee" "I")
+("vvx " "J")
+("i;;k" "K")
+("amaa" "L")
+(";;;q" "M")
+("opcp" "N")
+("o..c" "O")
+("c,,c" "P")
+("cak." "Q")
+("cfpf" "R")
+("ctdu" "S")
+("cfru" "T")
+("ccah" "U")
+("c.qn" "V")
+("clje" "W")
+("cvlb" "X")
+("crax" "Y")
+("cbbf" "Z")
+("cixn" "[")
+(",/rf" "\")
+(",ypn" "]")
+(",irx" "^")
+(",bbm" "_")
+(",fpm" "`")
+(",.j." "a")
+("o..," "b")
+(".zae" "c")
+(".ak." "d")
+(".o/," "e")
+("cpah" "f")
+("arin" "g")
+("arcp" "h")
+("ars;" "i")
+("ar;v" "j")
+("arjn" "k")
+("aral" "l")
+("arf." "m")
+("arip" "n")
+(",mqh" "o")
+("k/ph" "p")
+("or,h" "q")
+("r;ih" "r")
+("p,mq" "s")
+("ht.r" "t")
+("hbtb" "u")
+("h;;f" "v")
+("heu " "w")
+("lplp" "x")
+("rifu" "y")
+("j,mq" "z")
+("ja/f" "{")
+("jbg;" "|")
+("jep " "}")
+("j;dm" "~")
+("jor," "")
+("jfaf" "")
+("jcaz" "")
+("ozkp" "")
+("gk/p" "")
+("grrs" "")
+("gr;;" "")
+("gl,p" "")
+("gkyv" "")
+("gcqv" "")
+("gy;." "")
+("ga/f" "")
+("g;;f" "")
+("glz;" "")
+("yhaf" "")
+("yhxx" "")
+("lvyr" "")
+("lvk," "")
+("lvxx" "")
+("lvrs" "")
+("lvrk" "")
+("lvl;" "")
+("nkrk" "")
+("nkas" "")
+("nklq" "")
+("lnor" "")
+("lyqq" "")
+("lfft" "")
+("lrm " "")
+("lzfh" "")
+("la/c" "")
+("lorp" "")
+("la.n" "")
+("ltxu" "")
+("lpff" "")
+("lpqx" "")
+("lo;n" "")
+("llvm" "")
+("l.ec" "")
+("lxx." "")
+("l.oj" "")
+("lna." "")
+("ly;t" "")
+("ly.m" "")
+("lqjk" "")
+("lrar" "")
+(",tg/" "")
+("xy.m" "")
+("xhoc" "")
+("xyxf" "")
+("xzfh" "")
+("qxam" "")
+("xfpz" "")
+("xpff" "")
+("xjs," "")
+("xdky" "")
+("mofx" "")
+("xmac" "")
+("xlp." "")
+("x.ec" "")
+("nvvx" "")
+("rifx" "")
+("qozx" "")
+("xqn " "")
+("ofdi" "")
+("/ypr" "")
+("/k/p" "")
+("/z,e" "")
+("bbqn" "")
+("a/ab" "")
+("fkpw" "")
+("uypa" "")
+("uea." "")
+("ur;b" "")
+("u;;v" "")
+("u/l/" "")
+("ukyd" "")
+("um;n" "")
+("tdqe" "")
+("lmpw" "")
+("lmqp" "")
+("lmrd" "")
+("fcy;" "")
+("fc/u" "")
+("fypn" "")
+("fy;q" "")
+("fnic" "")
+("f,am" "")
+("faam" "")
+("fr;b" "")
+("fzrk" "")
+("fama" "")
+("fam." "")
+("famx" "")
+("fbgm" "@")
+("fztf" "A")
+("fezx" "B")
+("fjg " "C")
+("f;ax" "D")
+("fetn" "E")
+("fs.;" "F")
+("f/jx" "G")
+("fm;n" "H")
+("f.j." "I")
+("f.bs" "J")
+("fozy" "K")
+("fjzy" "L")
+("fljz" "M")
+("fjjf" "N")
+("flp." "O")
+("fi/p" "P")
+("fwzh" "Q")
+("fysy" "R")
+("fzib" "S")
+("frin" "T")
+("flv." "U")
+("fi;k" "V")
+("evv." "W")
+("/nak" "X")
+("/yk;" "Y")
+("/y.m" "Z")
+("/nr," "[")
+("/yqq" "\")
+("/qp " "]")
+("/qo " "^")
+("/a/c" "_")
+("/rr " "`")
+("/rjd" "a")
+("/bb." "b")
+("/p/b" "c")
+("/lv " "d")
+("/lpn" "e")
+("nlp/" "f")
+("rh./" "g")
+("rif/" "h")
+("bgd/" "i")
+("tvp/" "j")
+("qt//" "k")
+("xmf/" "l")
+("kk;/" "m")
+(".h//" "n")
+(",./ " "o")
+("/nkr" "p")
+("ykym" "q")
+("ykqn" "r")
+("ykas" "s")
+("ykac" "t")
+("ykt/" "u")
+("yk,." "v")
+("yk.c" "w")
+("ykx." "x")
+("jpys" "y")
+("rjrs" "z")
+(",,js" "{")
+("jirf" "|")
+("vajb" "}")
+("yy;;" "~")
+("ybyf" "")
+("ypk." "")
+("y.xz" "")
+("yldd" "")
+("ymqv" "")
+("ykyb" "")
+("yodb" "")
+("yit;" "")
+("y.es" "")
+("nrky" "")
+(",,jy" "")
+("prky" "")
+("ygbb" "")
+("yzlc" "")
+("yfuk" "")
+("yiku" "")
+("qiic" "")
+("vaab" "")
+("a.zc" "")
+("a./u" "")
+("a..z" "")
+("..xz" "")
+(".lpq" "")
+("miku" "")
+("rcn;" "")
+("sfuk" "")
+("sbrx" "")
+("sohp" "")
+("sk,u" "")
+("sit;" "")
+("nrkc" "")
+("qzlv" "")
+("q/u " "")
+("yp;n" "")
+("lqkn" "")
+("f/jt" "")
+("ap,n" "")
+("apzu" "")
+("apfr" "")
+("apob" "")
+(",,jp" "")
+("apne" "")
+("apiq" "")
+("apju" "")
+("iixx" "")
+("ic.k" "")
+("ihbt" "")
+("iafo" "")
+("irqk" "")
+("iqqp" "")
+("izqx" "")
+("ime " "")
+("ietb" "")
+("ipn " "")
+("ipac" "")
+("i.d." "")
+("iop." "")
+("ilpr" "")
+("iktz" "")
+("czoi" "")
+("cosi" "")
+("bgdi" "")
+("inaa" "")
+("iykd" "")
+("ijq " "")
+("ibgv" "")
+("it;q" "")
+("irsv" "")
+("izrr" "")
+("ipls" "")
+("ipax" "")
+("iem " "")
+("ifj;" "")
+("ily " "")
+("ikd." "")
+("i.fj" "")
+("crki" "")
+("eyp " "")
+("erks" "")
+("ea/r" "")
+("ejzh" "")
+("ejeb" "")
+(".vhk" "")
+("tyke" "")
+("tpx," "")
+("tak." "")
+("zyig" "")
+("zcrk" "")
+("zcjq" "")
+("z;;;" "")
+("zfjz" "")
+("rfnq" "")
+("rfoy" "")
+("rfcp" "")
+("rflf" "@")
+("rfc;" "A")
+("t;qf" "B")
+("t;qx" "C")
+("kkax" "D")
+("nacm" "E")
+("gcdm" "F")
+("lefm" "G")
+("ialm" "H")
+("guam" "I")
+(",,am" "J")
+("eeix" "K")
+("ibjq" "L")
+("ibfu" "M")
+("ibaz" "N")
+("ibp." "O")
+("ibps" "P")
+("ibw." "Q")
+("iblr" "R")
+("ibkz" "S")
+("ib.d" "T")
+("iljx" "U")
+("lvps" "V")
+("lvpe" "W")
+("g,yf" "X")
+("g,hx" "Y")
+("g,ax" "Z")
+("g,v;" "[")
+("g,zh" "\")
+("g,tb" "]")
+("g,b;" "^")
+("g,pf" "_")
+("g,;u" "`")
+("g,ks" "a")
+("g,iv" "b")
+("g,xz" "c")
+("mua." "d")
+("z.cu" "e")
+("z.kr" "f")
+("z.le" "g")
+("z..f" "h")
+("oxcu" "i")
+("u,r;" "j")
+("u,qp" "k")
+("u,ae" "l")
+("u,ec" "m")
+("u,jq" "n")
+("u,s," "o")
+("u,.;" "p")
+("ame," "q")
+("equ," "r")
+("u,ov" "s")
+("u,js" "t")
+("u,i;" "u")
+("nwl," "v")
+("yk.," "w")
+("ifl," "x")
+("r;l," "y")
+("zaa," "z")
+("alj," "{")
+("f.l," "|")
+("ovl," "}")
+("lf;," "~")
+(".;l," "")
+("kvl," "")
+("lml," "")
+("xof," "")
+("ame," "")
+("kar," "")
+("w;l," "")
+("bbl," "")
+("lel," "")
+(",yqq" "")
+("afaq" "")
+("yqqo" "")
+("fkkf" "")
+("rpkr" "")
+("p,ra" "")
+("ca,h" "")
+("aasa" "")
+("owy." "")
+("owzh" "")
+("owkj" "")
+("eiq " "")
+("i;;f" "")
+("kyuq" "")
+("kyvs" "")
+("kzle" "")
+(";al." "")
+(";p,r" "")
+(";prc" "")
+(";;q;" "")
+(";nrk" "")
+(";ei " "")
+("///z" "")
+("wohe" "")
+("b.l;" "")
+("bnzc" "")
+("dckx" "")
+("jdfx" "")
+("jdnh" "")
+("crjn" "")
+("cain" "")
+("nnrk" "")
+("nal." "")
+("nf/x" "")
+("nprc" "")
+("nohe" "")
+("noom" "")
+("ilfn" "")
+("nirx" "")
+("oykn" "")
+("oepn" "")
+("olpv" "")
+("ow/w" "")
+("oirx" "")
+("ofmc" "")
+("ou,p" "")
+("y./k" "")
+("holp" "")
+("pfj." "")
+("po/," "")
+("pzae" "")
+("vyke" "")
+("vhod" "")
+("vzae" "")
+("vlrp" "")
+("voxf" "")
+("vy;." "")
+("vzq;" "")
+("vak." "")
+("vtbm" "")
+("vfkb" "")
+("vitx" "")
+("pxxk" "")
+("qozk" "")
+("fjaq" "")
+("cnrk" "")
+("cyq," "")
+("cnpr" "")
+("cirx" "")
+("c,,h" "")
+("cvab" "")
+("cf/x" "")
+("czfm" "")
+("cal." "")
+("ct;m" "")
+("ca.p" "")
+("clpv" "")
+("ccrk" "")
+("clmu" "")
+(",qdu" "")
+(",bby" "")
+("a.a," "")
+(",,,v" "")
+(",rgh" "")
+(".al." "")
+("arnm" "@")
+("arze" "A")
+("arok" "B")
+("arfb" "C")
+("arye" "D")
+("artu" "E")
+("arbf" "F")
+("arfu" "G")
+("jzkh" "H")
+("b;yh" "I")
+("hbrb" "J")
+("hlbj" "K")
+("how " "L")
+("hi/p" "M")
+("hos." "N")
+("hzp " "O")
+("hjzy" "P")
+("lpl." "Q")
+("yp;b" "R")
+("qdtu" "S")
+("j;;v" "T")
+("ji/p" "U")
+("zlvg" "V")
+("gzp " "W")
+("gapa" "X")
+("gb;f" "Y")
+("glp." "Z")
+("o..g" "[")
+("girx" "\")
+("gcjp" "]")
+("yhin" "^")
+("yhip" "_")
+("lvin" "`")
+("lcp." "a")
+("l,,b" "b")
+("lfqh" "c")
+("lqhu" "d")
+("la/f" "e")
+("lfk;" "f")
+("lzkc" "g")
+("lbqi" "h")
+("ltsk" "i")
+("ley." "j")
+("llz;" "k")
+("ldlf" "l")
+("xiph" "m")
+("xzn " "n")
+("xru." "o")
+("xtra" "p")
+("xbg;" "q")
+("x;dm" "r")
+("x;;f" "s")
+("xlz;" "t")
+("nnnx" "u")
+("x,mq" "v")
+("xpab" "w")
+("iffm" "x")
+("iflp" "y")
+(",mqb" "z")
+("ffmb" "{")
+("ae;m" "|")
+("uzae" "}")
+("ufkb" "~")
+("uo/," "")
+("lmyr" "")
+("lml," "")
+("fnnd" "")
+("fnro" "")
+("f,,," "")
+("fy;k" "")
+("faek" "")
+("fr;n" "")
+("frgh" "")
+("fa/h" "")
+("fozk" "")
+("frax" "")
+("fqoc" "")
+("fbby" "")
+("ftdu" "")
+("fjbz" "")
+("f/ye" "")
+("fcah" "")
+("f.pr" "")
+("flvs" "")
+("flp," "")
+("fcac" "")
+("fzae" "")
+("fak." "")
+("cpcs" "")
+("/,,b" "")
+("/ffm" "")
+("/r;;" "")
+("/r;." "")
+("/a/f" "")
+("/zn " "")
+("/rpk" "")
+("/zkc" "")
+("/tqh" "")
+("/tsk" "")
+("/p, " "")
+("/lz;" "")
+("/jp." "")
+("/ky," "")
+("/kam" "")
+("/xxx" "")
+("y./k" "")
+("qdj/" "")
+("/ypx" "")
+("sxh/" "")
+("rak/" "")
+("zid/" "")
+("/cqv" "")
+("ykrs" "")
+("ykvj" "")
+("ykbb" "")
+("yk;f" "")
+("ykcz" "")
+("ykj." "")
+("ykth" "")
+("ykeu" "")
+("yyk;" "")
+("yy.m" "")
+("yzag" "")
+("yq;;" "")
+("yqn " "")
+("ybbp" "")
+("yzrp" "")
+("yeua" "")
+("yeli" "")
+("yp/b" "")
+("yp;w" "")
+("ylpn" "")
+("rh.y" "")
+("rbsy" "")
+("ynr," "")
+("yrm " "")
+("ya/c" "")
+("ylvm" "")
+("tgxy" "")
+("rify" "")
+("kk;." "")
+("a..c" "")
+(".q;;" "")
+(".fpz" "")
+(".p;w" "")
+("qd;m" "")
+("rifm" "")
+("mxx." "")
+("qozm" "")
+("snkp" "")
+("syk;" "")
+("snr," "")
+("syqq" "")
+("szo " "")
+("sqam" "")
+("sqn " "")
+("sqp " "")
+("srjd" "@")
+("scjr" "A")
+("sxmh" "B")
+("s.ec" "C")
+(",.;c" "D")
+("qo;c" "E")
+("qyqq" "F")
+("qbb." "G")
+("qwpv" "H")
+("qqn " "I")
+(",.;s" "J")
+("nrpt" "K")
+("zzqt" "L")
+("alut" "M")
+("apym" "N")
+("apac" "O")
+("apq;" "P")
+("apzu" "Q")
+("apb." "R")
+("ina." "S")
+("iitc" "T")
+("izah" "U")
+("ig, " "V")
+("iqhh" "W")
+("ifi;" "X")
+("ipbb" "Y")
+("idqi" "Z")
+("io, " "[")
+("iodb" "\")
+("ilpq" "]")
+("iohp" "^")
+("int;" "_")
+("iirq" "`")
+("iidu" "a")
+("ibbv" "b")
+("ifjx" "c")
+("ir;x" "d")
+("irxu" "e")
+("icjs" "f")
+("ipcs" "g")
+("ikyf" "h")
+("iljn" "i")
+(",,ji" "j")
+("kd.i" "k")
+("epbb" "l")
+("edqi" "m")
+("eljv" "n")
+("tzqc" "o")
+("fpfy" "p")
+("f;;y" "q")
+("dky;" "rs")
+("jyfb" "t")
+("w;ty" "u")
+("z;m " "v")
+("zu.k" "w")
+("zja." "x")
+("rftb" "y")
+("rfpc" "z")
+("rfps" "{")
+("rfly" "|")
+("rrff" "}")
+("bgdf" "~")
+("rfrv" "")
+("rfif" "")
+("t;qq" "")
+("pacq" "")
+("t;qv" "")
+("ypfz" "")
+("jqam" "")
+("zqxm" "")
+("pmam" "")
+("xpn " "")
+("ibru" "")
+("ibo," "")
+("ibqh" "")
+("g,rk" "")
+("g,vk" "")
+("g,pq" "")
+("g,pv" "")
+("g,wc" "")
+("g,ee" "")
+("g,ld" "")
+("g,ky" "")
+("g,i;" "")
+("g,j;" "")
+("mulf" "")
+("y;jf" "")
+("z.is" "")
+("z.p." "")
+("z.uu" "")
+("eos " "")
+("qsqd" "")
+("oxqx" "")
+("oxrk" "")
+("oxky" "")
+("u,ns" "")
+("u,qh" "")
+("u,a;" "")
+("u,as" "")
+("u,a." "")
+("u,ks" "")
+("u,js" "")
+("u,. " "")
+("u,t;" "")
+("u,fh" "")
+("u,cu" "")
+("u,iv" "")
+("ktg," "")
+("fjg," "")
+("qhl," "")
+("zkk," "")
+("awq," "")
+("tsn," "")
+("ml, " "")
+("lpq," "")
+("l,iv" "")
+(".zj," "")
+("kk;," "")
+("l,x." "")
+(".ar," "")
+("tl;," "")
+("lvs," "")
+("yqqx" "")
+("yqqz" "")
+("p,mm" "")
+("rxja" "")
+("rkja" "")
+("ffrb" "")
+("owzh" "")
+("owg " "")
+("owor" "")
+("owl;" "")
+("ow.h" "")
+("ykd," "")
+("eios" "")
+("ky;x" "")
+("kd.," "")
+("j;qe" "")
+("y;;b" "")
+("zpud" "")
+(";yvs" "")
+("r;i;" "")
+(";zle" "")
+(";epu" "")
+(";ejo" "")
+(";ecm" "")
+("repu" "")
+("r;dn" "")
+("rejo" "")
+("alj." "")
+("w/dz" "")
+("wv;m" "")
+("wre," "")
+("dyuq" "")
+("jdnn" "")
+(".yuq" "@")
+("neqk" "A")
+("onrn" "B")
+("onrx" "C")
+("oyuh" "D")
+("ozky" "E")
+("op/x" "F")
+("oepu" "G")
+("av.k" "H")
+("hoin" "I")
+("hoip" "J")
+("pzfm" "K")
+("vyrp" "L")
+("vnbb" "M")
+("val." "N")
+("vppp" "O")
+("vfq;" "P")
+("vljh" "Q")
+("vlpv" "R")
+("qdjv" "S")
+("pppv" "T")
+("a.rv" "U")
+("va/n" "V")
+("voom" "W")
+("vxw." "X")
+("bbbk" "Y")
+("amrm" "Z")
+("lqup" "[")
+("cyvs" "\")
+("cyuq" "]")
+("c,,x" "^")
+("czky" "_")
+("cvab" "`")
+("ctzn" "a")
+("c;dn" "b")
+("cema" "c")
+("clvm" "d")
+("cnrn" "e")
+("cy/x" "f")
+("cqj/" "g")
+("oszc" "h")
+(",nrk" "i")
+(",yq," "j")
+("frk," "k")
+("ojq," "l")
+(",p,r" "m")
+("ofy," "n")
+("ofpc" "o")
+("of/q" "p")
+("ofww" "q")
+("ofzm" "r")
+("aryn" "s")
+("arlv" "t")
+("arq." "u")
+("arpp" "v")
+("mmqh" "w")
+("hyke" "x")
+("jnam" "y")
+("jxld" "z")
+("jo/," "{")
+("ozfb" "|")
+("gzae" "}")
+("gqdu" "~")
+("gfqh" "")
+("ozag" "")
+("gnam" "")
+("gfj." "")
+("yha." "")
+("lvye" "")
+("lvsm" "")
+("lfpf" "")
+("lorr" "")
+("lcjp" "")
+("ls.;" "")
+("lm;n" "")
+(",/rp" "")
+("b;y," "")
+("xypn" "")
+("xypa" "")
+("xi.n" "")
+("x;;v" "")
+("xpfx" "")
+("x/qx" "")
+("xjt," "")
+("xjjf" "")
+("b;yx" "")
+("xrin" "")
+("ysxd" "")
+("qdsd" "")
+("/fpd" "")
+("/xu," "")
+("ifik" "")
+("ezab" "")
+("/qlb" "")
+("aejy" "")
+("unfh" "")
+("uyq," "")
+("lmix" "")
+("lmcp" "")
+("lmeb" "")
+("fcaf" "")
+("fhox" "")
+("fnkg" "")
+("fy.b" "")
+("fykn" "")
+("fyq," "")
+("fr/m" "")
+("fv;n" "")
+("ft;m" "")
+("fvq;" "")
+("fa.p" "")
+("fepn" "")
+("fppp" "")
+("f/xq" "")
+("flvc" "")
+("fjj." "")
+("fohe" "")
+("fnvo" "")
+("fban" "")
+("fggg" "")
+("fol." "")
+("/aam" "")
+("/ypa" "")
+("yu/h" "")
+("/aer" "")
+("/cjp" "")
+("//qx" "")
+("//rf" "")
+("//l/" "")
+("fpm/" "")
+("fl;/" "")
+("maf/" "")
+("qds/" "")
+("/nic" "")
+("/frv" "")
+("ykya" "")
+("ykin" "")
+("ykpx" "")
+("yk/f" "")
+("yk//" "")
+("ykjy" "")
+("ykip" "")
+("ykik" "")
+("yk;v" "")
+("a/l." "")
+("ewas" "")
+(".bms" "")
+("j;;f" "")
+("yiph" "")
+("yy;." "")
+("yrrs" "")
+("yqe." "")
+("yzn " "")
+("yqsp" "")
+("ytsk" "")
+("yeu " "")
+("yor," "")
+("ylz;" "@")
+("y;;f" "A")
+("yl,p" "B")
+("yli;" "C")
+("kk;." "D")
+("a.vi" "E")
+("a.fm" "F")
+(".;;f" "G")
+("mzhh" "H")
+("y.am" "I")
+("ma/f" "J")
+("rcrs" "K")
+("rcrk" "L")
+("rck," "M")
+("rcl;" "N")
+("sk/p" "O")
+("s,mq" "P")
+("sbtb" "Q")
+("s;dm" "R")
+("sl,p" "S")
+("slz;" "T")
+(".,,b" "U")
+("qffm" "V")
+("qzkc" "W")
+("qbgf" "X")
+("qcaz" "Y")
+("ql,p" "Z")
+(";;px" "[")
+("reqt" "\")
+("f;;t" "]")
+("apaf" "^")
+("apcz" "_")
+("intf" "`")
+("ihoc" "a")
+("ifft" "b")
+("iq;;" "c")
+("izex" "d")
+("ibb." "e")
+("itg/" "f")
+("ieli" "g")
+("ifpz" "h")
+("idky" "i")
+("i.vb" "j")
+("i.kc" "k")
+("rh.i" "l")
+("inak" "m")
+("intc" "n")
+("inr," "o")
+("iyqq" "p")
+("izfh" "q")
+("ipff" "r")
+("ieph" "s")
+("ixx." "t")
+("rbsi" "u")
+("zzkc" "v")
+("ezjs" "w")
+("ecjr" "x")
+("bbky" "y")
+("zy;t" "z")
+("zbbp" "{")
+("zprk" "|")
+("zbah" "}")
+("zvv." "~")
+("rff;" "")
+("qjif" "")
+("lmsf" "")
+("t;qr" "")
+("t;qu" "")
+("t;qf" "")
+("rjrm" "")
+("bbbm" "")
+("muam" "")
+("dqim" "")
+("g,x " "")
+("dqix" "")
+("mofx" "")
+("xbh/" "")
+("ibir" "")
+("ibq;" "")
+("ibfz" "")
+("lvpc" "")
+("lvpu" "")
+("g,ie" "")
+("g,aw" "")
+("g,bv" "")
+("g,tb" "")
+("g,bz" "")
+("g,sd" "")
+("g,eb" "")
+("g,pc" "")
+("g,m;" "")
+("g,.." "")
+("g,fg" "")
+("g,lr" "")
+("g,ps" "")
+("mun;" "")
+("z.ie" "")
+("z.zp" "")
+("z.ve" "")
+("z.zu" "")
+("qji." "")
+("u,r." "")
+("u,ab" "")
+("u,vk" "")
+("u,td" "")
+("u,pq" "")
+("u,.;" "")
+("u,os" "")
+("u,in" "")
+("u,wp" "")
+("irk," "")
+("lvl," "")
+("u,yw" "")
+("u,yf" "")
+("u,rr" "")
+("u,rk" "")
+("u,ee" "")
+("u,lf" "")
+("nmg," "")
+("y;c," "")
+("ntk," "")
+("rul," "")
+("atd," "")
+("rkr," "")
+("l,rk" "")
+("zqd," "")
+("vkk," "")
+("bf;," "")
+("bdd," "")
+("bbb," "")
+("epf," "")
+("l,l," "")
+("j;s," "")
+("jr;," "")
+("ujb," "")
+("wpl," "")
+("gul," "")
+("l,ky" "")
+("osl," "")
+("lpl," "")
+("lvl," "")
+("l,pf" "")
+("vpl," "")
+("if;," "")
+("yqq;" "")
+("yqqs" "")
+("nvvb" "")
+("ca,h" "")
+("owrh" "")
+("ljph" "")
+("ljp;" "")
+("ykdu" "")
+("eiql" "")
+("eio " "")
+("eike" "")
+("qjjy" "")
+("y;gf" "")
+(";j;h" "@")
+("o..;" "A")
+("raew" "B")
+("wkkx" "C")
+("d,,;" "D")
+("deqx" "E")
+("nmmw" "F")
+("nu,f" "G")
+(".y;x" "H")
+(".pdc" "I")
+("ny;x" "J")
+("oyq," "K")
+("ommw" "L")
+("okkx" "M")
+("onrc" "N")
+("hook" "O")
+("pyuq" "P")
+("pre," "Q")
+("pzky" "R")
+("vyuq" "S")
+("vy/x" "T")
+("vzle" "U")
+("vepu" "V")
+("vfte" "W")
+("dlev" "X")
+("vq;a" "Y")
+("vu,v" "Z")
+("cy;x" "[")
+("c,pk" "\")
+("c,,;" "]")
+("cbbk" "^")
+("cmmw" "_")
+("c/ze" "`")
+("c./h" "a")
+("ckkx" "b")
+("cosx" "c")
+("cj;h" "d")
+("ci;f" "e")
+("czvj" "f")
+("crpx" "g")
+("cfn," "h")
+("celc" "i")
+(",ejo" "j")
+(",irx" "k")
+("kykf" "l")
+(".y;x" "m")
+(".tg." "n")
+("ojqh" "o")
+("lpy," "p")
+("lplv" "q")
+("r/mb" "r")
+("xriu" "s")
+("jnrk" "t")
+("jjj." "u")
+("jljh" "v")
+("jjkb" "w")
+("oz/q" "x")
+("gqdm" "y")
+("gf/x" "z")
+("gppp" "{")
+("pppg" "|")
+("gfmc" "}")
+("goom" "~")
+("yhzm" "")
+("lvy," "")
+("lvnk" "")
+("lvup" "")
+("ypf." "")
+("lr;r" "")
+("la/h" "")
+("lbby" "")
+("ly;." "")
+("lozk" "")
+(",qdu" "")
+("xzae" "")
+("x;dn" "")
+("xo/," "")
+("xkcz" "")
+("ifze" "")
+("rgqb" "")
+("aend" "")
+("uzky" "")
+("ure," "")
+("ojqa" "")
+("lmf." "")
+("lmye" "")
+("fyuq" "")
+("fzky" "")
+("fq;a" "")
+("fv;m" "")
+("frqu" "")
+("fo/f" "")
+("fzle" "")
+("f;;o" "")
+("f/jb" "")
+("f.ud" "")
+("f.oc" "")
+("fyvs" "")
+("/nam" "")
+("/yke" "")
+("/,,v" "")
+("/bby" "")
+("/fj." "")
+("/fkb" "")
+("ykle" "")
+("ykze" "")
+("jso." "")
+("o..j" "")
+("yypa" "")
+("yfps" "")
+("yjaa" "")
+("ypfx" "")
+("yi;k" "")
+("lphy" "")
+("ynic" "")
+("yorb" "")
+("rc;v" "")
+("sea." "")
+("slp." "")
+("b;yc" "")
+("qirx" "")
+("qfk;" "")
+("qzqx" "")
+("qfps" "")
+("q/qx" "")
+("qdsq" "")
+(".pwn" "")
+("z;;t" "")
+("j;qt" "")
+("apyn" "")
+("ape." "")
+("appx" "")
+("ap/f" "")
+("icp." "")
+("iy;." "")
+("i,mq" "")
+("iicp" "")
+("iiph" "")
+("ia/f" "")
+("iru." "")
+("iqsp" "")
+("izkc" "")
+("itgm" "")
+("ibqi" "")
+("ibg;" "")
+("ifaf" "")
+("i;dm" "")
+("icaz" "")
+("il,p" "")
+("iky," "")
+("ixxx" "")
+("i,,b" "")
+("ibtb" "")
+("itsk" "")
+("izn " "")
+("itp." "")
+("icjv" "")
+("ilvj" "@")
+("ijp." "A")
+("ikyv" "B")
+("ixr;" "C")
+("ti.i" "D")
+("eqe." "E")
+("e;dm" "F")
+("ei;b" "G")
+("zcrk" "H")
+("zbqi" "I")
+("rfyt" "J")
+("rfpw" "K")
+("igap" "L")
+("rbsp" "M")
+("a/am" "N")
+("rjdm" "O")
+("zeam" "P")
+("bbkm" "Q")
+("bblx" "R")
+("xbb." "S")
+("ibvi" "T")
+("ibr;" "U")
+("ibfm" "V")
+("ibtk" "W")
+("ib;m" "X")
+("ibcv" "Y")
+("g,ff" "Z")
+("g,pw" "[")
+("g,.z" "\")
+("g,lq" "]")
+("g,ob" "^")
+("g,ld" "_")
+("g,ox" "`")
+("g,op" "a")
+("g,gb" "b")
+("tec," "c")
+("muy;" "d")
+("muiq" "e")
+("muqh" "f")
+("z.rp" "g")
+("z.fk" "h")
+("z.ic" "i")
+("u,qw" "j")
+("u,rv" "k")
+("u,pc" "l")
+("u,pm" "m")
+("u,o." "n")
+("u,kz" "o")
+("bqs," "p")
+("u,bv" "q")
+("u,tb" "r")
+("u,zp" "s")
+("u,fu" "t")
+("u,zx" "u")
+("u,lr" "v")
+("nkz," "w")
+("ykj," "x")
+("jql," "y")
+("qpl," "z")
+("v;b," "{")
+("f;u," "|")
+("vhn," "}")
+("qql," "~")
+("qpw," "")
+("bgd," "")
+("fbg," "")
+("jzh," "")
+("pac," "")
+("plk," "")
+(";;a," "")
+(".az," "")
+("w.l," "")
+(".fj," "")
+("gjf," "")
+("ixx," "")
+("bgd," "")
+("lv,," "")
+("f;u," "")
+("fjz," "")
+("yqqx" "")
+("yqqe" "")
+("yqqb" "")
+("p,yc" "")
+("p,zs" "")
+("lvl," "")
+("p,ns" "")
+("owm " "")
+("owlb" "")
+("eirs" "")
+("eij;" "")
+("ei;k" "")
+("eix;" "")
+("eils" "")
+("yuqz" "")
+("krzy" "")
+("kosm" "")
+("nvve" "")
+("osoe" "")
+(";yky" "")
+(";rhm" "")
+(";f;y" "")
+("wdk;" "")
+("wkyb" "")
+("dled" "")
+("df;y" "")
+("nw;y" "")
+("nf;y" "")
+("onkw" "")
+("vfch" "")
+("vkkx" "")
+("vj;h" "")
+("vozf" "")
+("vy;x" "")
+("cfdi" "")
+("caee" "")
+("cqsd" "")
+("cjjy" "")
+("cw;y" "")
+("cppr" "")
+("cfqu" "")
+(",./h" "")
+(",i;f" "")
+(",y;x" "")
+(".f;y" "")
+("eqjh" "")
+("hlvm" "")
+("jzky" "")
+("gzky" "")
+("yuqg" "")
+("g,,x" "")
+("lp;." "")
+("lclp" "")
+(",zfm" "")
+("xnrk" "")
+(",xam" "")
+("xr;m" "")
+("xal." "")
+("xp,r" "")
+("pppx" "")
+("pppd" "")
+("ify." "")
+("fka." "")
+("yuph" "")
+("fy;x" "")
+("fyq," "")
+("fz;;" "")
+("ft.n" "")
+("frpr" "")
+("frf," "")
+("fqob" "")
+("fean" "")
+("f/ze" "")
+("fmmw" "")
+("fxf;" "")
+("fosx" "")
+("fi;." "")
+("fi;f" "")
+("/yrp" "@")
+("/ppp" "A")
+("/f/x" "B")
+("alp/" "C")
+("ip//" "D")
+("v../" "E")
+(".e//" "F")
+("lufx" "G")
+("ykrm" "HI")
+("ykpc" "J")
+("ykzp" "K")
+("qozj" "L")
+("yy;." "M")
+("yrgh" "N")
+("yjhe" "O")
+("yqoc" "P")
+("mmy " "Q")
+("mtdu" "R")
+("mmm " "S")
+("rcby" "T")
+("sak." "U")
+("sorq" "V")
+("qqdu" "W")
+("qcah" "X")
+("ozaq" "Y")
+("fdft" "Z")
+("f;;t" "[")
+("dkyt" "\")
+("apze" "]")
+("iypn" "^")
+("iea." "_")
+("i/qx" "`")
+("ii.n" "a")
+("irin" "b")
+("iffm" "c")
+("i;;v" "d")
+("im;n" "e")
+("iepb" "f")
+("ifrv" "g")
+("iezx" "h")
+("i.j." "i")
+("ii;k" "j")
+("erin" "k")
+("e/qx" "l")
+("ecjp" "m")
+("z;ax" "n")
+("zos." "o")
+("rfxx" "p")
+("t;qf" "q")
+("rrrm" "r")
+("xzkc" "s")
+("zhzx" "t")
+("xohp" "u")
+("ibya" "v")
+("ibex" "w")
+("g,rr" "x")
+("g,bp" "y")
+("g,pf" "z")
+("g,ln" "{")
+("g,x." "|")
+("rh.," "}")
+("rif," "~")
+("g,yf" "")
+("munv" "")
+("z.fz" "")
+("z.rk" "")
+("z.pb" "")
+("z.x." "")
+("qji." "")
+("oxac" "")
+("u,n;" "")
+("u,y;" "")
+("u,ic" "")
+("u,e." "")
+("u,ph" "")
+("u,pb" "")
+("u,md" "")
+("u,ld" "")
+("u,op" "")
+("nr;," "")
+("ntd," "")
+("itc," "")
+("iku," "")
+("valb" "")
+("qji," "")
+("fua," "")
+("fpf," "")
+("a/v," "")
+("pnw," "")
+("mul," "")
+("ldl," "")
+("lpz," "")
+("ohj," "")
+("k,u," "")
+("itl," "")
+("l,.s" "")
+("nrk," "")
+("xhl," "")
+("l,g," "")
+("l,ld" "")
+("ljv," "")
+("kxb," "")
+("ep.q" "")
+("yqqv" "")
+("p,ar" "")
+("p,rk" "")
+("p,if" "")
+("r;i;" "")
+("r;ie" "")
+("r;ix" "")
+("owru" "")
+("ykdm" "")
+("eipx" "")
+("izei" "")
+("yuqc" "")
+("yoja" "")
+(";fp/" "")
+(";;px" "")
+(";osm" "")
+("yxxz" "")
+("wajq" "")
+("yxxw" "")
+("dilw" "")
+("dosm" "")
+("najq" "")
+("oy.y" "")
+("onve" "")
+("oajq" "")
+("oosm" "")
+("vjjy" "")
+("vdk;" "")
+("vcab" "")
+("jjkq" "")
+("cy.y" "")
+("cnve" "")
+("c/ya" "")
+("cosm" "")
+(",///" "")
+(",f;y" "")
+("lvwf" "")
+(".al." "")
+("arfy" "")
+("tgah" "")
+("arr," "")
+("ard;" "")
+("hmmw" "")
+("lp.h" "")
+("gzvj" "")
+("yhif" "")
+("lvyx" "")
+("lv.h" "")
+("lzky" "")
+("lo/f" "")
+("liwc" "")
+("liax" "")
+("lepu" "")
+("k,by" "@")
+("dle," "A")
+("xepu" "B")
+("ofdu" "C")
+("/rfd" "D")
+("ujjy" "E")
+("lmeu" "F")
+("ffdi" "G")
+("faex" "H")
+("frpr" "I")
+("fled" "J")
+("fppr" "K")
+("flvx" "L")
+("/yuq" "M")
+("/fte" "N")
+("/epu" "O")
+("yuq/" "P")
+("dle/" "Q")
+("ykyq" "R")
+("r/ms" "S")
+("nl,s" "T")
+("jlpv" "U")
+("yiub" "V")
+("yppp" "W")
+("yjj." "X")
+(".t;y" "Y")
+("ynlp" "Z")
+("yffn" "[")
+("ohdm" "\")
+("snrh" "]")
+("snpr" "^")
+("sa/n" "_")
+("slpv" "`")
+("sw/w" "a")
+("sxxa" "b")
+(".t;c" "c")
+("qppp" "d")
+("qlpv" "e")
+("osot" "f")
+("inam" "g")
+("izae" "h")
+("ifkb" "i")
+("qawi" "j")
+("innd" "k")
+("iyke" "l")
+("i,,v" "m")
+("iak." "n")
+("ifru" "o")
+("icah" "p")
+("zbgj" "q")
+("t;q/" "r")
+("ezam" "s")
+("i;;m" "t")
+("xarl" "u")
+("ysxx" "v")
+("ibf." "w")
+("g,,q" "x")
+("g,kp" "y")
+("g,af" "z")
+("g,te" "{")
+("g,bf" "|")
+("g,b;" "}")
+("g,ff" "~")
+("g,ea" "")
+("g,;f" "")
+("g,y." "")
+("murs" "")
+("z.kp" "")
+("eqe." "")
+("tg,d" "")
+("oxea" "")
+("oxxx" "")
+("u,yf" "")
+("u,zt" "")
+("u,rm" "")
+("u,zh" "")
+("u,qr" "")
+("u,rb" "")
+("u,an" "")
+("u,bp" "")
+("u,kv" "")
+("ou,." "")
+("rh.," "")
+("u,qp" "")
+("u,mc" "")
+("ntj," "")
+("zfh," "")
+("z..," "")
+("bbk," "")
+("fiv," "")
+("pza," "")
+("p;d," "")
+("lyl," "")
+("hoo," "")
+(",.l," "")
+("rif," "")
+("v;.," "")
+("qoz," "")
+("brl," "")
+(";ky," "")
+("pff," "")
+("fkkm" "")
+("p,fk" "")
+("ownh" "")
+("owjh" "")
+("owjq" "")
+("ljpc" "")
+("eipv" "")
+("i;yq" "")
+("i;;v" "")
+("kppx" "")
+("w./e" "")
+("pppr" "")
+("r;;." "")
+("zrlf" "")
+("w;;." "")
+("deqh" "")
+("nlp/" "")
+("tgjb" "")
+("rzkn" "")
+("ncj," "")
+("njjb" "")
+("ocj," "")
+("oljx" "")
+("y.oa" "")
+("yxxp" "")
+("vosm" "")
+("yxxv" "")
+("v/xy" "")
+("rbs;" "")
+("ce;f" "")
+("co.s" "")
+("nvv," "")
+(".f;o" "")
+(".;;." "")
+(".jjb" "")
+("hw;y" "")
+("jf;y" "")
+("lean" "")
+("liop" "")
+("xy;x" "")
+("lmjh" "")
+("fy.y" "")
+("fyka" "")
+("fnyx" "")
+("fnve" "")
+("f,zm" "")
+("fqdx" "")
+("fryx" "")
+("/y;x" "")
+("iku/" "")
+("/qob" "")
+("/mmw" "")
+("ykrx" "")
+("yke/" "")
+("ykkx" "")
+("jre," "")
+("yre," "@")
+("kyyy" "A")
+("yuqy" "B")
+("yzle" "C")
+("kk;q" "D")
+("esem" "E")
+("syuq" "F")
+("qepu" "G")
+("qzle" "H")
+("apr," "I")
+("iepn" "J")
+("ioom" "K")
+("if.n" "L")
+("ilvc" "M")
+("iw/w" "N")
+("rffb" "O")
+("rfp," "P")
+("ypfb" "Q")
+("g,rx" "R")
+("g,ya" "S")
+("z.px" "T")
+("z./x" "U")
+("z.ip" "V")
+("u,ih" "W")
+("u,th" "X")
+("u,te" "Y")
+("u,b;" "Z")
+("u,bb" "[")
+("u,ea" "\")
+("u,lp" "]")
+("u,rs" "^")
+("u,j." "_")
+("u,l;" "`")
+("l,y." "a")
+("ipf," "b")
+("zkp," "c")
+("a/p," "d")
+("tde," "e")
+("bgd," "f")
+(";;p," "g")
+("/ml," "h")
+("or,," "i")
+("lz;," "j")
+("ky,," "k")
+("y;c," "l")
+("req," "m")
+("zid," "n")
+("rpk," "o")
+("evl," "p")
+("eul," "q")
+("faf," "r")
+("l,p," "s")
+("nvvm" "t")
+("lvkm" "u")
+("p,x." "v")
+("qoz," "w")
+("jpya" "x")
+("r;i/" "y")
+("owic" "z")
+("ow.z" "{")
+("ow.s" "|")
+("ljps" "}")
+("ykda" "~")
+("eiab" "")
+("eirp" "")
+("eizd" "")
+("eios" "")
+(";fji" "")
+("r;i;" "")
+("wbc/" "")
+("bmmm" "")
+("ow./" "")
+("pcj," "")
+("p;;." "")
+("vcj," "")
+("cbc/" "")
+("cfe/" "")
+("cpym" "")
+("cqds" "")
+(",cj," "")
+("areh" "")
+(".xk/" "")
+("yxxj" "")
+("gosm" "")
+("yh,m" "")
+("yhom" "")
+("lxxo" "")
+("xdk;" "")
+("/yxx" "")
+("lmkb" "")
+("fckx" "")
+("/f;y" "")
+("/jjy" "")
+("/dk;" "")
+("tfau" "")
+("yt.n" "")
+("yev/" "")
+("sy,b" "")
+("sy;x" "")
+("flec" "")
+("sev/" "")
+("apn," "")
+("apz;" "")
+("ap.h" "")
+("iii " "")
+("iyuq" "")
+("iq;a" "")
+("kyky" "")
+("zaan" "")
+("zkyy" "")
+("zyuq" "")
+("rfrm" "")
+("t;qm" "")
+("g,nm" "")
+("munm" "")
+("cqox" "")
+("u,ya" "")
+("u,pi" "")
+("u,ja" "")
+("u,;v" "")
+("u,/x" "")
+("u,ip" "")
+("c.x," "")
+("ypn," "")
+("yp;," "")
+("l,ix" "")
+("e;g," "")
+("/ri," "")
+("/l/," "")
+("yulh" "")
+("vpa," "")
+("b;y," "")
+("o..," "")
+("lph," "")
+("yqqa" "")
+("r;ir" "")
+("ljps" "")
+("ein." "")
+("eipm" "")
+("ei;g" "")
+(";qdx" "")
+("oqdx" "")
+("bc/o" "")
+("vbc/" "")
+("vppx" "")
+("vfe/" "")
+("vw./" "")
+("cqdx" "")
+(",qds" "")
+("ofi." "")
+("jcj," "")
+("jeq." "")
+("g;;." "")
+("lljn" "")
+("losm" "")
+("dd,y" "")
+("xajq" "")
+("xosm" "@")
+("rszx" "A")
+("x/xy" "B")
+("yxxk" "C")
+("rzkk" "D")
+("fppx" "E")
+("ftgy" "F")
+("fal;" "G")
+("ykaq" "H")
+("ykf/" "I")
+("ykfx" "J")
+("ykvo" "K")
+("jdk;" "L")
+("yaee" "M")
+("yf;y" "N")
+("snkw" "O")
+("sffp" "P")
+("sjjy" "Q")
+("ifch" "R")
+("iev/" "S")
+("ikkx" "T")
+("ij;h" "U")
+("inrc" "V")
+("zaa." "W")
+(",,ym" "X")
+("ibyx" "Y")
+("u,cp" "Z")
+("u,ok" "[")
+("u,ye" "\")
+("nnu," "]")
+("akj," "^")
+("bbk," "_")
+("fja," "`")
+("oza," "a")
+(".yz," "b")
+("yqqe" "c")
+("p,jy" "d")
+(";;pa" "e")
+("ljpa" "f")
+("eiiu" "g")
+("eifk" "h")
+("eild" "i")
+("irli" "j")
+("pyxv" "k")
+("cpxm" "l")
+("lyuh" "m")
+("/jjb" "n")
+("rcom" "o")
+("sosm" "p")
+("apaq" "q")
+("idk;" "r")
+("ippr" "s")
+("ifzx" "t")
+("if;y" "u")
+("g,r," "v")
+("u,fx" "w")
+("u,lv" "x")
+("u,zm" "y")
+("u,lx" "z")
+("l,pc" "{")
+("ppp," "|")
+("zpu," "}")
+("b;ya" "~")
+("i;;p" "")
+("cypm" "")
+("lpcc" "")
+(",fe/" "")
+("esk," "")
+("/bc/" "")
+("cky/" "")
+("xxa/" "")
+("yeqh" "")
+(".jjb" "")
+("sjjb" "")
+(".nam" "")
+("zcze" "")
+("aeam" "")
+("f;;m" "")
+("f;;x" "")
+("ibom" "")
+("lvpp" "")
+("g,yx" "")
+("g,zj" "")
+("g,r," "")
+("z.yx" "")
+("epu," "")
+("yuq," "")
+("ljpx" "")
+("ypfn" "")
+("vz;k" "")
+(",z;k" "")
+("f,.a" "")
+("sil." "")
+("icj," "")
+("ieqh" "")
+("ijjb" "")
+("g,fy" "")
+("g,d;" "")
+("ejja" "")
+("i;;," "")
+(",vo." "")
+("fojj" "")
+("yr/y" "")
+("ibc/" "")
+("u,fy" "")
+("fkki" "")
+("hyxk" "")
+("g,g," "")
+("u,aq" "")
+("ajh," "")
+("cfdu" "")
+("cvo." "")
+("yqqq" "")
+("eqji" "")
+("ljpx" "")
+("yuqq" "")
+("rakg" "")
+("ilvg" "")
+("yprx" "")
+("rfk;" "")
+("napa" "")
+(",nr " "")
+("weu " "")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: chinese-big5-unix
+;; End:
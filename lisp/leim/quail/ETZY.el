@@ -0,0 +1,1548 @@
+;; Quail package `chinese-etzy
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: ETZY.tit
+
+;; # -*- coding: cn-big5 -*-
+;; # HANZI input table for cxterm
+;; # Generated from ETZY.cit by cit2tit
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 1
+;; ENCODE:	BIG5
+;; MULTICHOICE:	YES
+;; PROMPT:	JiʤѪ`j
+;; #
+;; COMMENT Copyright (c) 1997, 2001 Wei-Chung Hwang <wchwang@csie.nctu.edu.tw>
+;; COMMENT 
+;; COMMENT Permission to copy and distribute both modified and unmodified
+;; COMMENT versions is granted without royalty provided this notice is preserved.
+;; COMMENT 
+;; COMMENT Contructed by Wei-Chung Hwang ()  <wchwang@csie.nctu.edu.tw>
+;; COMMENT Made available in TANET at OCT 15, 1992.
+;; COMMENT 
+;; COMMENT In Taipei(ETen) Big5 coding (eg. used with taipei15,taipei20)
+;; COMMENT 
+;; COMMENT LĥέʤL`ŸƦC覡C
+;; COMMENT
+;; COMMENT `: t u v w x y z { | } ~          
+;; COMMENT L:  b  p  m  f  d  t  n  l  v  k  h  g  7  c  ,  .  /  j  ;  '  s
+;; COMMENT
+;; COMMENT `:                
+;; COMMENT L:  a  o  r  w  i  q  z  y  8  9  0  -  =  e  x  u
+;; COMMENT
+;; COMMENT n: (@)  ()  Wn()  hn()  n()
+;; COMMENT L:  space         2         3         4        1 
+;; COMMENT
+;; COMMENT         L`ŸƦC      
+;; COMMENT +----+----+----+----+----+----+----+----+----+----+----+----+--
+;; COMMENT |1   |2   |3   |4   |    |    |7   |8   |9   |0   |-   |=   |
+;; COMMENT |n||Wn|hn|    |    |  |  |  |  |  |  |
+;; COMMENT ++---++---++---++---++---++---++---++---++---++---++---+----+-
+;; COMMENT  |Q   |W   |E   |R   |T   |Y   |U   |I   |O   |P   |
+;; COMMENT  |  |  |  |  |  y|  |  |  |  |  u|
+;; COMMENT  ++---++---++---++---++---++---++---++---++---++---++----+
+;; COMMENT   |A   |S   |D   |F   |G   |H   |J   |K   |L   |;   |'   |
+;; COMMENT   |  |  |  x|  w|  |  ~|  |  }|  {|  |  |
+;; COMMENT   ++---++---++---++---++---++---++---++---++---++---++---+
+;; COMMENT    |Z   |X   |C   |V   |B   |N   |M   |,   |.   |/   |
+;; COMMENT    |  |  |  |  ||  t|  z|  v|  |  |  |
+;; COMMENT    +----+----+----+----+----+----+----+----+----+----+
+;; COMMENT         |         (SPACE BAR)                      |
+;; COMMENT         |                                      |
+;; COMMENT         +------------------------------------------+
+;; # define keys
+;; VALIDINPUTKEY:	\040',-./01234789;=abcdefghijklmnopqrstuvwxyz
+;; SELECTKEY:	1
+;; SELECTKEY:	2
+;; SELECTKEY:	3
+;; SELECTKEY:	4
+;; SELECTKEY:	5
+;; SELECTKEY:	6
+;; SELECTKEY:	7
+;; SELECTKEY:	8
+;; SELECTKEY:	9
+;; SELECTKEY:	0
+;; BACKSPACE:	\010\177
+;; DELETEALL:	\015\025
+;; MOVERIGHT:	>
+;; MOVELEFT:	<
+;; REPEATKEY:	\020\022
+;; KEYPROMPT(\040):	@
+;; KEYPROMPT('):	
+;; KEYPROMPT(,):	
+;; KEYPROMPT(-):	
+;; KEYPROMPT(.):	
+;; KEYPROMPT(/):	
+;; KEYPROMPT(0):	
+;; KEYPROMPT(1):	
+;; KEYPROMPT(2):	
+;; KEYPROMPT(3):	
+;; KEYPROMPT(4):	
+;; KEYPROMPT(7):	
+;; KEYPROMPT(8):	
+;; KEYPROMPT(9):	
+;; KEYPROMPT(;):	
+;; KEYPROMPT(=):	
+;; KEYPROMPT(a):	
+;; KEYPROMPT(b):	t
+;; KEYPROMPT(c):	
+;; KEYPROMPT(d):	x
+;; KEYPROMPT(e):	
+;; KEYPROMPT(f):	w
+;; KEYPROMPT(g):	
+;; KEYPROMPT(h):	~
+;; KEYPROMPT(i):	
+;; KEYPROMPT(j):	
+;; KEYPROMPT(k):	}
+;; KEYPROMPT(l):	{
+;; KEYPROMPT(m):	v
+;; KEYPROMPT(n):	z
+;; KEYPROMPT(o):	
+;; KEYPROMPT(p):	u
+;; KEYPROMPT(q):	
+;; KEYPROMPT(r):	
+;; KEYPROMPT(s):	
+;; KEYPROMPT(t):	y
+;; KEYPROMPT(u):	
+;; KEYPROMPT(v):	|
+;; KEYPROMPT(w):	
+;; KEYPROMPT(x):	
+;; KEYPROMPT(y):	
+;; KEYPROMPT(z):	
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-etzy" "Chinese-BIG5" "ʪ`"
+ '(   (122 . "")
+   (121 . "")
+   (120 . "")
+   (119 . "")
+   (118 . "|")
+   (117 . "")
+   (116 . "y")
+   (115 . "")
+   (114 . "")
+   (113 . "")
+   (112 . "u")
+   (111 . "")
+   (110 . "z")
+   (109 . "v")
+   (108 . "{")
+   (107 . "}")
+   (106 . "")
+   (105 . "")
+   (104 . "~")
+   (103 . "")
+   (102 . "w")
+   (101 . "")
+   (100 . "x")
+   (99 . "")
+   (98 . "t")
+   (97 . "")
+   (61 . "")
+   (59 . "")
+   (57 . "")
+   (56 . "")
+   (55 . "")
+   (52 . "")
+   (51 . "")
+   (50 . "")
+   (49 . "")
+   (48 . "")
+   (47 . "")
+   (46 . "")
+   (45 . "")
+   (44 . "")
+   (39 . "")
+   (32 . "@")
+)"JiʤѪ`j
+
+ Copyright (c) 1997, 2001 Wei-Chung Hwang <wchwang@csie.nctu.edu.tw>
+ 
+ Permission to copy and distribute both modified and unmodified
+ versions is granted without royalty provided this notice is preserved.
+ 
+ Contructed by Wei-Chung Hwang ()  <wchwang@csie.nctu.edu.tw>
+ Made available in TANET at OCT 15, 1992.
+ 
+ In Taipei(ETen) Big5 coding (eg. used with taipei15,taipei20)
+ 
+ LĥέʤL`ŸƦC覡C
+
+ `: t u v w x y z { | } ~          
+ L:  b  p  m  f  d  t  n  l  v  k  h  g  7  c  ,  .  /  j  ;  '  s
+
+ `:                
+ L:  a  o  r  w  i  q  z  y  8  9  0  -  =  e  x  u
+
+ n: (@)  ()  Wn()  hn()  n()
+ L:  space         2         3         4        1 
+
+         L`ŸƦC      
+ +----+----+----+----+----+----+----+----+----+----+----+----+--
+ |1   |2   |3   |4   |    |    |7   |8   |9   |0   |-   |=   |
+ |n||Wn|hn|    |    |  |  |  |  |  |  |
+ ++---++---++---++---++---++---++---++---++---++---++---+----+-
+  |Q   |W   |E   |R   |T   |Y   |U   |I   |O   |P   |
+  |  |  |  |  |  y|  |  |  |  |  u|
+  ++---++---++---++---++---++---++---++---++---++---++----+
+   |A   |S   |D   |F   |G   |H   |J   |K   |L   |;   |'   |
+   |  |  |  x|  w|  |  ~|  |  }|  {|  |  |
+   ++---++---++---++---++---++---++---++---++---++---++---+
+    |Z   |X   |C   |V   |B   |N   |M   |,   |.   |/   |
+    |  |  |  |  ||  t|  z|  v|  |  |  |
+    +----+----+----+----+----+----+----+----+----+----+
+         |         (SPACE BAR)                      |
+         |                                      |
+         +------------------------------------------+
+
+Zhuyin base input method for Chinese Big5 characters (`chinese-big5-1',
+`chinese-big5-2').
+
+Zhuyin is a kind of phonetic symbol.  One to three Zhuyin symbols
+compose one Chinese character.
+
+In this input method, you enter a Chinese character by first typing
+keys corresponding to Zhuyin symbols (see the above table) followed by
+SPC, 1, 2, 3, or 4 specifying a tone (SPC:, 1:n, 2:, 3: Wn,
+4:hn).
+
+\\<quail-translation-docstring>
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   (">" . quail-next-translation)
+   ("<" . quail-prev-translation))
+ nil nil nil nil)
+
+(quail-define-rules
+("' " "θۣtl")
+("'- " "")
+("'-2" "heU")
+("'-4" "O")
+("'0 " "aܷɿaV")
+("'02" "t")
+("'2" "OϲۯZY[M")
+("'3" "˽uүl֦")
+("'4" "Z˵۴l")
+("'8 " "\|")
+("'82" "F[")
+("'83" "G٩v")
+("'84" "GTD")
+("'9 " "շ")
+("'92" "¯KպHX")
+("'a " "g")
+("'a3" "}")
+("'a4" "")
+("'i " "q")
+("'i2" "~]")
+("'i3" "ımBsٽ")
+("'i4" "ʪ")
+("'r4" "UZlI|")
+("'x " "")
+("'x- " "^oqw槼{vkpĽze")
+("'x-2" "qOFzUO")
+("'x-4" "")
+("'x2" "eu")
+("'x4" "PLLT`k")
+("'x8 " "O}")
+("'x82" "")
+("'x84" "«yy")
+("'x9 " "r")
+("'x92" "s")
+("'x93" "k")
+("'x94" "oTG")
+("'xo " "bROe")
+("'xo2" "ڵ˷Dh")
+("'xo3" "L")
+("'xo4" "Vk")
+("'xq " "RʱZQgiI")
+("'xq2" "")
+("'xq3" "A")
+("'xq4" "Aܺ|ufXcQZ")
+("'y4" "s")
+("'z " "W")
+("'z2" "ѹ˺]")
+("'z3" "{ZJ")
+("'z4" "Wͫ")
+(", " "´KĥusۯתϻjLO쮥gݥ|[CY")
+(",- " "]Cxú奿òuWpmMϳBB")
+(",-3" "@ɡͩ")
+(",-4" "GҬFgôV")
+(",0 " "is̼khܴ`R")
+(",03" "xSA")
+(",04" "VMbٽȧ`}H")
+(",2" "¾ȴӰY˻hŭԲTPjz޿[H")
+(",3" "uȤ}xk竤LT˯ܰ@tʪCV")
+(",4" "ܨvӻsPmxXϽomnicoFIŮKˤζdzл~_jPxW׺~Ҧ~lpϣEηгUdB")
+(",8 " "g¤LĸSevL")
+(",83" "iٷݪ~\RZ^")
+(",84" "ԯȥeŸEYXJN")
+(",9 " "uwísշrez¿dEްLezW޲س")
+(",93" "EElH׿h[̺Ga")
+(",94" "}_ӪE}_֨WմJ")
+(",a " "ӬdfHt̼")
+(",a2" "㥾ϹhZ׬C")
+(",a3" "wzux")
+(",a4" "^]BEcKQܦ\Kz")
+(",i " "KN")
+(",i2" "vC")
+(",i3" "h")
+(",i4" "Ź벽dqֹ")
+(",r " "Bծw")
+(",r1" "۾Bծw")
+(",r2" "PֻK͸GBծsQЧMs")
+(",r3" "̽")
+(",r4" "oCvp[")
+(",x " "]Ѯ޵ݻ˨xмUL־}@s")
+(",x- " "שJجnɱʸy`ޡqX")
+(",x-3" "ظ~")
+(",x-4" "حصFd\د")
+(",x0 " "˲Χ")
+(",x03" "N")
+(",x04" "Y")
+(",x2" "˿vv⵮ǥĽTbbCz")
+(",x3" "DݵNJZf쯩G_[F")
+(",x4" "ۧU`nWEűϮRV}rMwKg")
+(",x8 " "MjBFWlm@")
+(",x83" "")
+(",x84" "ȽfW๶޵{")
+(",x9 " "Τ٪ʽ")
+(",x93" "ǭGԭb")
+(",x94" "")
+(",xa " "f")
+(",xa3" "")
+(",xi " "")
+(",xi3" "m")
+(",xi4" "")
+(",xo " "g")
+(",xo2" "_Bްu`۰NµZ|տٸZ@HUٺ~ka")
+(",xq " "l@իAߡ")
+(",xq3" "D")
+(",xq4" "Yشm]p")
+(",y " "Pg{w൰yNzv|EҺPM")
+(",y2" "bo")
+(",y3" "y")
+(",y4" "޽Kz`GóC@̦HB")
+(",z " "©۬LlۼJxฮO")
+(",z2" "")
+(",z3" "hۨ")
+(",z4" "ӻlnF@EgŴUU}")
+("- " "񢣶")
+(". " "YEè^]ګZֲwju")
+(".- " "ټeWڥaԿgY")
+(".-2" "{ӲۧegJٳshкLգmu]oIWή")
+(".-3" "xѭG")
+(".-4" "ٯWg")
+(".0 " "Ҳs@KuI@ڨ")
+(".02" "`nvzZu|^")
+(".03" "t")
+(".04" "ۭҺZJC")
+(".2" "𹣰ͦUWӳרzYӢAbNw")
+(".3" "ؾ`׿ݶӿj^Nɭ{")
+(".4" "ͥwK̸ܿUSLk`Kr")
+(".8 " "Ue˦~V")
+(".82" "Ia``GsGd^URx@")
+(".83" "ĶAC˱L|ossA")
+(".84" "b_")
+(".9 " "ҵ`QݧԮ")
+(".92" "IڹШWըHfpӲ}YBqjɯ")
+(".93" "w^")
+(".94" "XŨh@")
+(".a " "teCXj`")
+(".a2" "dgAhQͤ")
+(".a3" "")
+(".a4" "ҧëbtЮ˲L")
+(".i " "t[")
+(".i2" "[")
+(".i4" "")
+(".r " "s")
+(".r3" "")
+(".r4" "Mw\Kж")
+(".x " "X")
+(".x- " "RĨRݼrE")
+(".x-2" "Reܣӵ֡")
+(".x-3" "d")
+(".x-4" "o")
+(".x0 " "нHwy")
+(".x02" "ɼl")
+(".x03" "m")
+(".x04" "[ޯ")
+(".x2" "xpSoQ]q`")
+(".x3" "Bx¦SuG")
+(".x4" "BĲbJԩzHMڢbG")
+(".x8 " "tJ޸")
+(".x82" "ǲ")
+(".x83" "ݦӶ")
+(".x84" "곩k@U")
+(".x9 " "KYs")
+(".x92" "®BJE]LzB")
+(".x93" "eb")
+(".xa " "")
+(".xi2" "D")
+(".xi3" "")
+(".xi4" "D")
+(".xo " "W")
+(".xo4" "ؽ[Y]N\wuM")
+(".xq " "j")
+(".xq2" "lݴն质޽i|P[Ƚxߡ")
+(".xq4" "j")
+(".y " "oݱl")
+(".y2" "TwSYCåvAW۬EP")
+(".y3" "|p")
+(".y4" "ŷh{")
+(".z " "۶rWp̢˶")
+(".z2" "¼_JHq")
+(".z3" "n")
+(".z4" "f")
+("/ " "Iv÷ͣNr˥߭йOiwHk")
+("/- " "nӤɬ@cưNʢdTd")
+("/-2" "÷Izh")
+("/-3" "f")
+("/-4" "ӲtOo")
+("/0 " "Ӷ˼ҴNY")
+("/01" "n")
+("/03" "ΤW")
+("/04" "W|sg")
+("/1" "")
+("/2" "QۮɹꭹBkӮgAMc")
+("/3" "ϩlvpګ˨")
+("/4" "Oƥ@hѫǥܸյAͻ}uݫKUIaغb]Kiflmrr")
+("/8 " "smRûQ\ksݵh}[")
+("/83" "{٥")
+("/84" "¾տµTSĺbIMQlR")
+("/9 " "`ӲԩDHxWEMgP~]k[XPp")
+("/92" "")
+("/93" "HfTnZ{{˩T")
+("/94" "VǺƸ¨G߸Ҳ̽z")
+("/a " "FTƧگjңFq")
+("/a2" "ԣ")
+("/a3" "")
+("/a4" "KHQ|gl")
+("/i " "z")
+("/i3" "")
+("/i4" "ή")
+("/q2" "")
+("/r " "aB")
+("/r2" "Dެe`")
+("/r3" "˪")
+("/r4" "]gAjeiQB")
+("/x " "ѿή޲Vg_Y")
+("/x0 " "\")
+("/x03" "n")
+("/x04" "f")
+("/x2" "QūEZa")
+("/x3" "ƹݴpLaIr")
+("/x4" "Nƾzpݲfƹֺ@oo}")
+("/x8 " "꭬C")
+("/x84" "R")
+("/x93" "mp")
+("/x94" "Hv")
+("/xa " "|m")
+("/xa3" "A")
+("/xi " "LI")
+("/xi3" "")
+("/xi4" "vO")
+("/xo " "")
+("/xo4" "Һ{޲v}qT㷤cx|a")
+("/xq2" "O")
+("/xq3" "")
+("/xq4" "ε|tX")
+("/y " "ӧ")
+("/y2" "")
+("/y3" "⭺uSF")
+("/y4" "~½G")
+("/z " "NyߥzvKݾefK")
+("/z2" "@ਢcϹ")
+("/z3" "")
+("/z4" "ֲЭlso׸ڼL")
+("0 " "ˣ")
+("02" "W")
+("03" "B")
+("04" "s")
+("7 " "")
+("7e " "Cd۱ϱ~YmּPNPQNHԧNhQr")
+("7e- " "MCɭBfJԫg")
+("7e-2" "")
+("7e-3" "г")
+("7e-4" "yjvkSMjբ")
+("7e0 " "jʶmf٪B{ᬱN")
+("7e02" "jRb|p")
+("7e03" "jmuhf")
+("7e04" "v")
+("7e2" "_XMѸR֪±Ta[XQ_ϲNתKuNBmY]gӽդDCQkcY")
+("7e3" "_ҰZ^]vs}Uͼʦ")
+("7e4" "𾹨T󫴬_WͽrE¿ltddyӽay")
+("7e8 " "d]EñoҴOaHʷ^ǺSrILdˡRjmCNtIV")
+("7e82" "erX@xzaH̵y߰ɰFK")
+("7e83" "LV")
+("7e84" "pg}SdfH")
+("7e9 " "˫I]k\\j")
+("7e92" "Ե^V߾^tAhͭܤ")
+("7e93" "`ʫH")
+("7e94" "Gk")
+("7ea " "t")
+("7ea3" "da")
+("7ea4" "ꬢαK")
+("7ew " "P")
+("7ew2" "XG")
+("7ew3" "B")
+("7ew4" "ѩcĴg櫴۷h^")
+("7ey " "CLZ_tD")
+("7ey2" "Dy}}AsX[MGSڹgNаɦDuvZG\y")
+("7ey3" "")
+("7ez " "VTKktdtpJjuW")
+("7ez2" "@¼LkNVBHXK")
+("7ez3" "sNN")
+("7ez4" "¼¬NkTߴs")
+("7u " "ϩ}X߹򦱳I£׶徵]X`B̶v\q")
+("7u- " "|")
+("7u-2" "aã|rۼFTcrv߳")
+("7u2" "WT£CWykEQaۧ")
+("7u3" "TϦ")
+("7u4" "h@m")
+("7u8 " "ѪٯμW")
+("7u82" "vuறͲlҡyޤhAht޾p")
+("7u83" "enFQ")
+("7u84" "UҢy")
+("7u9 " "_n")
+("7u92" "sg")
+("7uw " "")
+("7uw2" "a")
+("7uw4" "oTNe|O[i")
+("8 " "wbgڮiOuΦrLP")
+("82" "u")
+("83" "{٣~")
+("84" "tשfC}Ӱ")
+("9 " "⣴")
+("94" "ݮ")
+("; " "stԸYdhFhۤrE^S@")
+(";- " "W¹ye")
+(";-4" "p")
+(";0 " "żB}N")
+(";03" "")
+(";04" "ŦN")
+(";1" "l")
+(";3" "lJTdӥE~I͡BI")
+(";4" "ۦr{ְFIH~")
+(";8 " "¯")
+(";82" "")
+(";83" "se")
+(";84" "ټgfo")
+(";93" "")
+(";94" "")
+(";a " "ϥ`sN")
+(";a2" "{")
+(";i " "av")
+(";i3" "J_")
+(";i4" "bA")
+(";q2" "")
+(";r2" "hdܿAɯVQᲲе")
+(";r3" "")
+(";r4" "z")
+(";x " "")
+(";x- " "vaOqHwGI")
+(";x-3" "`pz")
+(";x-4" "aqr")
+(";x2" "ڨjA")
+(";x3" "կ[A")
+(";x8 " "pp")
+(";x83" "ġp@")
+(";x84" "p")
+(";x9 " "LJdmbS")
+(";x93" "J")
+(";x94" "T`WQ")
+(";xo2" "Q@O")
+(";xo3" "w")
+(";xo4" "@y`wg̩_Y")
+(";xq " "pn")
+(";xq3" "LFCZ")
+(";xq4" "̸oK٢IPb")
+(";y " "Q԰ph_iٴi")
+(";y3" "")
+(";y4" "J~")
+(";z " "DVܷ")
+(";z2" "w")
+(";z3" "ǾĦDj")
+(";z4" "ym꾸ķ_ļqT")
+("= " "")
+("=2" "ϥSkwlFӴԢ{")
+("=3" "լ|ҭbzΩt")
+("=4" "GL˹F֬")
+("a " "ڣ")
+("a1" "ڪ")
+("a4" "")
+("b " "t")
+("b- " "Y^[My]")
+("b-2" "")
+("b-3" "ff}ԾO")
+("b-4" "{nng")
+("b0 " "ı}W")
+("b03" "]jƻH")
+("b04" "νSFr")
+("b8 " "Zh{IWݽx")
+("b83" "OƶzI")
+("b84" "bղ̩räb̭")
+("b9 " "bNI")
+("b93" "cf")
+("b94" "^ʬ")
+("ba " "KäڬͪݯJzЧaT")
+("ba1" "a}]I")
+("ba2" "޶[YnɥnZ")
+("ba3" "vj")
+("ba4" "}QBf")
+("be " "GYMD")
+("be- " "LB|")
+("be-3" "[`ì}@׮~ε")
+("be-4" "ïf֦}xR")
+("be2" "")
+("be3" "񵧩P]YӼp_D")
+("be4" "ͲzuAźѪcڽȹʹp@]t{qXDNShnzKAҥul}GղǷ]ڷتctʯ}gLrGZXWtvz~ͶKs~qJ")
+("be8 " "s@Hx_t")
+("be83" "SнG")
+("be84" "KܹMGX|٥KqZ")
+("be9 " "رlby}xˬ@gRɢ~y")
+("be94" "lK")
+("bew " "xž")
+("bew2" "ODvo")
+("bew3" "çס")
+("bew4" "")
+("bez " "гCtdI@nlܭIdH[l")
+("bez3" "DtF")
+("bez4" "")
+("bi " "T")
+("bi2" "")
+("bi3" "\yx")
+("bi4" "ѫax")
+("bo " "Բgܼ׷[qYQi")
+("bo2" "Bլfyki䩭򽳻KY`JJcWaf`cѴުߴwcR{")
+("bo3" "_ðװ")
+("bo4" "ðB")
+("bq " "IMdOڴS׻t|յɸs")
+("bq3" "_")
+("bq4" "QƭIuVήH_ȪڪOXtXϺ")
+("bx " "ժl")
+("bx2" "")
+("bx3" "ɮHR{")
+("bx4" "BƧGïZO")
+("bz " "]McRUU")
+("bz2" "rn")
+("bz3" "O_ȸ̯ؿ")
+("bz4" "z\jS^XۭsoI")
+("c " "")
+("ce " "ƧlH}x˪RH^RfhQOLֱEXծDm]cQQ{DWR^\GrѩִrPkweξο]jioܾj\оIGM")
+("ce- " "PV{ɴiXz޼`S|")
+("ce-2" "ΫDxO˶xϭn{P")
+("ce-3" "ٿ")
+("ce-4" "濳ʩmƱӮc")
+("ce0 " "mۭc^[R߹H")
+("ce02" "Բ")
+("ce03" "QTɻWY")
+("ce04" "ѦV۹HQAmM_")
+("ce2" "ߩu@ŧVDgKbiٶ_O{Ry")
+("ce3" "߬~pâuVCqCҧ")
+("ce4" "Ytôiؾ񾵿ͥbͮQg\Wrm̧[]Myb")
+("ce8 " "PA־kC_yD[IWjwGlܹHsGҹ")
+("ce82" "嶢wЩβͼ_ܲC~w}pߺV۸Gyqԡ")
+("ce83" "IA~ndhK`dP@vݣzBB")
+("ce84" "{umr`óA乷sիڽW|beVbv")
+("ce9 " "߷s~YNʲQ`c`tʻF")
+("ce92" "MV")
+("ce93" "ɳ")
+("ce94" "H]\ʻvX")
+("cea " "M")
+("cea2" "vlLUXEIƪ\jߣݡzһExE")
+("cea4" "UL~Hvyg")
+("cew " "Ƿt")
+("cew2" "cׯٿӨe^EHFq\DZjݲ޺_")
+("cew3" "g")
+("cew4" "±񬪮hmӨnɸѱPkbr跤طcc^_ZLgʶJWa[[")
+("cey " "ץ۲竦κZpVӪt")
+("cey3" "J")
+("cey4" "q¸óSJqͩҵɧhi")
+("cez " "Ptdp­dv]ŻNJi`cFnӷڰ}AmQڴ߿]WdGuԪr")
+("cez2" "mB")
+("cez3" "pNQ")
+("cez4" "կĻüSvSZ")
+("cu " "ݵŽNVEXSwYhdFSc")
+("cu- " "SݤIF")
+("cu-2" "\")
+("cu-4" "")
+("cu2" "}")
+("cu3" "\ݷ֫HJYҷr")
+("cu4" "WԵBbf̹z͹m[w̡TC|E")
+("cu8 " "ŰaޱySU~J̷Pimu")
+("cu82" "ȱax{fKozٿ")
+("cu83" "j")
+("cu84" "xt֭bױ|`Ta״XE")
+("cu9 " "tH}Oee{")
+("cu92" "Mߴ`ұì}K{JнXbOgC@")
+("cu94" "TVSĿA")
+("cuw " "uf{")
+("cuw2" "ǥ`bOP")
+("cuw3" "")
+("cuw4" "峷ޫde~\׳")
+("d " "x")
+("d- " "nOhSf]")
+("d-3" "u")
+("d-4" "H޹jELI")
+("d0 " "Lh@N")
+("d03" "Ҿm")
+("d04" "Xۥ~fE]am")
+("d8 " "ᤦ°XCHE")
+("d83" "xnܳPɿldd")
+("d84" "HJϾuܿF~vDlHy\ICcxEPL")
+("da " "fʵ弽DľU")
+("da2" "FŶ޽DHӯT|bb{ϯX")
+("da3" "")
+("da4" "j")
+("de " "Cwzw׾}ai")
+("de- " "BvmonExM")
+("de-3" "C")
+("de-4" "wqvHa~E_r")
+("de2" "ĭ}fúC޹޺@S{ܫ`t_")
+("de3" "CkscE")
+("de4" "aħ̫һlͮXڻAj`aMЩIZki")
+("de8 " "AqiY\he")
+("de83" "IKکG")
+("de84" "qlԾ}QିfeJN")
+("dea " "")
+("dew " "R")
+("dew2" "^Һ|޳ҼSآk{]yETxGD")
+("dey " "")
+("dez " "JNIMpnڤKע")
+("dez3" "x")
+("dez4" "ձQsKɹ")
+("di " "b")
+("di3" "e")
+("di4" "NaݳUpLUjũeԴgLo@cs")
+("dq3" "o")
+("dr1" "o")
+("dr2" "ow")
+("dx " "G")
+("dx- " "FVN]Фlϵ۪")
+("dx-3" "\Q")
+("dx-4" "ʬ}ɫѯi")
+("dx2" "ŪWr|Ap}upZ\r")
+("dx3" "@w{EE")
+("dx4" "״{h")
+("dx8 " "ݭBek")
+("dx83" "u")
+("dx84" "q_v|b")
+("dx9 " "ۼ[")
+("dx93" "Ļ")
+("dx94" "y޶wPڿLPyQWʭɶT{")
+("dxo " "hGө")
+("dxo2" "Mhs@tiէjM")
+("dxo3" "ئW֣c")
+("dxo4" "kZF⹤WOmOƫײ")
+("dxq " "")
+("dxq4" "ﶤIPUXdv")
+("dy " "")
+("dy3" "ݰ~BUw")
+("dy4" "rku^eMŪ")
+("dz " "Mo{ͱ[")
+("dz3" "ˮqëor")
+("dz4" "D˽_sбACq")
+("e " "@촥avTUIWϫHۺvbw^")
+("e- " "^NatxXĢLw}VtcRQ")
+("e-2" "ǿĹռslƶ^m]DDF")
+("e-3" "vor_ջV")
+("e-4" "wMjT")
+("e0 " "omߪtfKbG")
+("e02" "vϨ˯LGzR۱޴ҳֱػ")
+("e03" "ioWbϴ̿}")
+("e04" "˾i~y·")
+("e2" "òyɫi@˯ضM~xߨ^[U˲DelfpưYDQAΧ֫B˷ЭMۦҿ׻C۳ݿheolGL")
+("e3" "HwAʴȨoƧíwѰYcAܯ࿨^\xH٨")
+("e4" "NqĳqĶGl̼ݶhw@ö~cڦzHݬ汳triŦkѺm٨@|}HѥhCԷa@AJfJTܲ\EYmp^ɩh~{U̴a]٦Q԰Lnm[ZLm^γ|g")
+("e8 " "ϲjTM|کaҹPYIkmҸ`\")
+("e82" "㨥CYuQòFԺwwr^ngZJz")
+("e83" "tln^kLλjVQfJ}kٰj|LbXV")
+("e84" "P˶bTvV۳x|`@Ϊu]oŬijEvIK[mmQܵE[Avzx")
+("e9 " "]îfءeXMϧhL")
+("e92" "ȧuG]iҤCUlH{hyPdm")
+("e93" "޶}CvUiXhAVL")
+("e94" "LNJxWPyu")
+("ea " "r~nXٲ")
+("ea2" "޲PŰHbɷ")
+("ea3" "Ȱ׶oVܦ")
+("ea4" "ȳY]GYPgoK")
+("ei2" "Vԩ")
+("eo " "")
+("ew " "CO")
+("ew2" "ݭCx^")
+("ew3" "]MԱ")
+("ew4" "~]|֫MgogEeOe")
+("ey " "u~ձyNM̫׫")
+("ey2" "ѴCתolS߹\ɬץO;{ɬO[a_")
+("ey3" "ͨKNO}kv߮D")
+("ey4" "SkcVɨݫ^rn\έϻ")
+("ez " "nyԧܤ\[m߷")
+("ez2" "n󻻫ca\fdޭ]\ҰWbl`lor")
+("ez3" "rHʼ̳ХPJUE")
+("ez4" "nģ`_cF@xM")
+("f " "w")
+("f- " "׺ƮpWlZ߱ީʲJgGv")
+("f-2" "{_ʰIذߧ")
+("f-3" "w")
+("f-4" "^Ŀ_c")
+("f0 " "ڧ{D˨BbCK")
+("f02" "Шէ{")
+("f03" "Xϥ鯼")
+("f04" "")
+("f8 " "f½ºn|`Z]")
+("f82" "Zc|sÿdͨ\OESڳcDysG_h")
+("f83" "Ϫ")
+("f84" "dSǥƦƶcxoJU")
+("f9 " "ɪ^hjܨwdV")
+("f92" "XIWFnVʷZbtc")
+("f93" "")
+("f94" "ļT\ʮx")
+("fa " "o")
+("fa2" "F@ֵ|ӫk")
+("fa3" "kv")
+("fa4" "kW")
+("fez4" "")
+("fo2" "")
+("fq " "DvئmnPW")
+("fq2" "x")
+("fq3" "B^IK")
+("fq4" "oOͪmpȪQauWM")
+("fx " "ҽŹlSiy[@˪i`fTu")
+("fx-4" "")
+("fx2" "A֧߯Bť񩻿TR{ܿ罻MegӺվӬ{ZXpߦlm߶׷tQNRfYGy{]z")
+("fx3" "GjyƳ@XF̹dfrkD")
+("fx4" "tII_ƳнƸJutrL{^nF`bקTΥ۽P")
+("fy2" "MR")
+("fy3" "_o")
+("g " "")
+("ge " "nZݿEVȦٽ]_ֺFLjEYXTBRQҨ~A~D۵F\jpl~@")
+("ge- " "gק󹸮HܸeRըɰa")
+("ge-3" "ĵV[mdLX")
+("ge-4" "qRҲbvw|tlHjE߼y")
+("ge0 " "Næ߫LŷlEsXo~")
+("ge03" "C")
+("ge04" "KjNz᰾L")
+("ge2" "ίŷYeyNI᧣AVEYǽCDaͿDk˸KcOOyiϡSϿBdHnoX@nѹո\")
+("ge3" "Xvu٤LqP")
+("ge4" "pOJ~uHާپôҺ[MV^EkŴgɫ[ا߽xr\^ɾSELx@DA`p")
+("ge8 " "ʰyݪ}lνpq̱yf쿡J^ޥieTlFYݸۢܩT~bZh")
+("ge83" "²߰Ŵ˴zõPZcVج_uQ¥I޹")
+("ge84" "ذ󶡺ŲbCĥųϷ^xqetϽҶh}]r^D^V")
+("ge9 " "Tzy̬o~ҴVWjd")
+("ge93" "AԾѽ@DXԻjί")
+("ge94" "iɸTʾluᶾڿʵRHݨͯh]cnSEɻa")
+("gea " "a[Ũγí{EPmX@JjSrXަ뱧")
+("gea2" "UH|IhճqU@ֳ")
+("gea3" "Ҹ[aKzHٮL")
+("gea4" "[r[ɲ")
+("gew " "󱵬ҶnnNx٬a~")
+("gew2" "`ǱܧTINe׮P~ͮܤmKU^ںjQDfCP_ѹgr")
+("gew3" "jѩn")
+("gew4" "ɭɤǩΪ|znkzʥɲѣXP")
+("gey " "ȴGGyVBЯjۮ")
+("gey3" "E[shvb")
+("gey4" "Ns¸ݬ^Sl\ѵ")
+("gez " "Х潦źJb뿼GtBMkN`wjSdh")
+("gez2" "Z")
+("gez3" "}úͶB˳岮ϸǬQѿ@ޢ")
+("gez4" "ХsոıⵢuCiҫ]PN")
+("gu " "~sqjIѨuu_^ٹLڡc|")
+("gu- " "")
+("gu-3" "~~ޣRujbʨ滬q")
+("gu2" "Żѷ|]BvپKDϾնVާ{\J^")
+("gu3" "|xCqLټ@")
+("gu4" "ڥy㥨@EѩڶZ߹dح£U~_\uN̥먬]~H^Kl")
+("gu8 " "SYOկO")
+("gu83" "ԯd")
+("gu84" "¨hmѦX]ڿRβJr")
+("gu9 " "xgvdYt")
+("gu93" "~")
+("gu94" "T߰pmm@CsڭMѸY]լʣj")
+("guw " "")
+("guw2" "MıﱸZZּݿṶPྻwƨnũi}TDRn͸Ti|ZnԳ")
+("guw3" "")
+("guw4" "")
+("h " "~")
+("h- " "P")
+("h-2" "ҲdmKh˼")
+("h-4" "ԦZ")
+("h0 " "q")
+("h02" "C\ޮͳͬӹ")
+("h03" "")
+("h04" "Y")
+("h8 " "oMFwܬP{")
+("h82" "Ht[զRmrU")
+("h83" "ۨuDUD")
+("h84" "M~kѿٮXvFcթCھrZ_ATg_FpFu")
+("h92" "")
+("h93" "ܬ")
+("h94" "")
+("ha " "")
+("ha2" "")
+("ha3" "")
+("hi " "y")
+("hi2" "٫e")
+("hi3" "W")
+("hi4" "`bٮ")
+("hq " "¼KH")
+("hq3" "")
+("hr " "ܨFΫ")
+("hr2" "XMeֲݽŨ׬TϲUr\ҬN粶ꭨP}{]Q[Z]]")
+("hr4" "PMbܲ~q{tw")
+("hx " "IGp|vOpR}zA")
+("hx- " "FMбʡnHF`")
+("hx-2" "xEilRbdATcG^gfRrlCXDRto}")
+("hx-3" "")
+("hx-4" "iE")
+("hx0 " "WwЪ")
+("hx02" "aq®XD׬ӰĵGNChtJIAvر]oR}L")
+("hx03" "̷E̤agS")
+("hx04" "A")
+("hx2" "JkGM[z}pݬ|tVm`R")
+("hx3" "[q\\")
+("hx4" "@᤬}|Cɼ̲[^jQqlhcz")
+("hx8 " "wNa[")
+("hx82" "GU`lXJ{{wѳl|Sܥ")
+("hx83" "wpںd")
+("hx84" "Ʊw۷ثAȸMR޽I|")
+("hx9 " "BN_ݼ")
+("hx92" "_VLI")
+("hx93" "V")
+("hx94" "VTIľ@ܱ")
+("hxa " "ؼMr")
+("hxa2" "طƦEϼM~Ź@b")
+("hxa4" "ܤƵeT_pE")
+("hxi2" "ha޺i˿wvTf")
+("hxi4" "aeE")
+("hxo " "")
+("hxo1" "M")
+("hxo2" "dߪ")
+("hxo3" "d")
+("hxo4" "ìMbNfi|tֺF]nC~E_RO")
+("hxq " "ǴٷuZZokϤskA")
+("hxq2" "^jw֤")
+("hxq3" "|kt")
+("hxq4" "|føzJ©kмc}PFJrnn^YU[_PIV[Qhwj_")
+("hy " "")
+("hy2" "UJjSo")
+("hy3" "q")
+("hy4" "ԫpZmM^пZϬ")
+("hz " "UQ")
+("hz2" "@ĮzbHM")
+("hz3" "nq")
+("hz4" "ӯEqUnPVREDѮ")
+("i " "sJuM")
+("i2" "Jc")
+("i3" "GħGHd")
+("i4" "Rêi@WإTiT|MI")
+("j " "")
+("j- " "")
+("j-2" "r}")
+("j-3" "")
+("j02" "cš[{m")
+("j03" "W[c")
+("j04" "J")
+("j4" "s")
+("j82" "MUwףפ׹")
+("j83" "VTw\I{")
+("j92" "HQI")
+("j93" "ԸZPe")
+("j94" "{bbMѡQݶ`t")
+("jr3" "SoY")
+("jr4" "")
+("jx-2" "eaķT_AxCgvSD`ycn")
+("jx-3" "_D")
+("jx2" "pį}}]ѲwδQ")
+("jx3" "Ŧdk")
+("jx4" "JdvP@")
+("jx82" "أ")
+("jx83" "nįRA}")
+("jx9 " "i")
+("jx94" "|")
+("jxo4" "YzٰkYxd")
+("jxq2" "Bo")
+("jxq3" "uս")
+("jxq4" "UͺU")
+("jy2" "X|ɨq")
+("jy3" "Mn")
+("jy4" "")
+("jz2" "c")
+("jz3" "Z")
+("jz4" "¶")
+("k " "}")
+("k- " "|^\[")
+("k-3" "")
+("k0 " "dBRnty")
+("k02" "")
+("k03" "B")
+("k04" "ܪʩfz˧p")
+("k8 " "Zɷ`")
+("k83" "ԧrteԹB")
+("k84" "EЫe")
+("k93" "ְپiV")
+("k94" "vֶ")
+("ka " "@ث")
+("ka3" "dya")
+("ka4" "")
+("ki " "}{|˴")
+("ki3" "ʹn_ϰZZmt")
+("ki4" "nZtyqn")
+("kr " "_VOWHa\^HΤި")
+("kr2" "y")
+("kr3" "iVeu_")
+("kr4" "ȽҨJgط«ߥiEyNݤ")
+("kx " "\]u\")
+("kx- " "űSOTQ")
+("kx-3" "խ")
+("kx-4" "ű")
+("kx0 " "JصFo")
+("kx02" "g")
+("kx03" "")
+("kx04" "pqmزKRiv")
+("kx3" "W")
+("kx4" "wǻA}")
+("kx8 " "eb")
+("kx83" "")
+("kx9 " "X[bCOխt񱹦cc")
+("kx93" "iѨ@")
+("kx94" "xte")
+("kxa " "ئjfӡ˺Z")
+("kxa3" "˺")
+("kxa4" "m")
+("kxi " "J{")
+("kxi3" "")
+("kxi4" "ֶ|_̼DzDaV")
+("kxo3" "")
+("kxo4" "AXJrbz")
+("kxq " "swѧJxkJ")
+("kxq2" "̫}ftUZP")
+("kxq3" "iyΡ")
+("kxq4" "\칼XJ±|D~B`ַl")
+("ky " "׼c")
+("ky3" "f")
+("ky4" "FnMF̪n")
+("kz " "u")
+("kz3" "үNϢ")
+("kz4" "aR")
+("l " "{")
+("l-2" "WٱUͷ")
+("l-3" "N")
+("l-4" "hD")
+("l0 " "j")
+("l02" "TYw}[հGcq")
+("l03" "άѢNH")
+("l04" "J")
+("l82" "xdiİP")
+("l83" "iVlI_X_")
+("l84" "lS")
+("la " "԰ճXi")
+("la1" "")
+("la2" "f")
+("la3" "")
+("la4" "þNfKݷ")
+("le " "")
+("le- " "")
+("le-2" "sFaֳٲܭdDoMҾ~WFaIdSABRevA̰S")
+("le-3" "v")
+("le-4" "Ot϶")
+("le02" "}q³DdxGWY")
+("le03" "Ry")
+("le04" "qG̽gDyWNѢ")
+("le2" "XzpvWԸuqռIƳNx}RzMuN")
+("le3" "̲z§ح@U[ZCĿ׾YUT~")
+("le4" "OߧQRcҾFyrɻYEwtO߷XWg~ѰŰ|UBRetgҪskEv`zqHlв`שdStVHrFUxYݹKCyd")
+("le82" "spGîIſ棩rUTiIC¾Z")
+("le83" "yLܶ")
+("le84" "mʷkFKVߵة")
+("le92" "L{FOMCYbMZ`szYixSovzPB")
+("le93" "oܱ۫j")
+("le94" "[nĩMe")
+("lea3" "")
+("lew " "")
+("lew3" "")
+("lew4" "CPHyʨca{~duJ۶qq")
+("ley " "")
+("ley2" "Byd[hsF~aeuܬ^FUW")
+("ley3" "hqg")
+("ley4" "Hya")
+("lez " "")
+("lez2" "d鼺RI·Vyc{lgvSsQ")
+("lez3" "FAdBm")
+("lez4" "ARSb")
+("li2" "ӵܱt]ٷJԨ")
+("li4" "uţ_")
+("lq " "")
+("lq2" "pݹJý]DOvAd")
+("lq3" "SwԽULOWsOT|W|{KE")
+("lq4" "\־t")
+("lr1" "F")
+("lr4" "֩UǦM{Rѻ}ɪɤBͧ")
+("lu2" "j[qB")
+("lu3" "fȼiQT\M~e")
+("lu4" "ߺv{oJw")
+("lu82" "p")
+("lu83" "")
+("luw4" "n")
+("lx " "P")
+("lx-2" "sŢVŤngK]tSPFDuPRM")
+("lx-3" "lb")
+("lx-4" "@ձ")
+("lx2" "cĪfĤl`ytGjCFDVGOB")
+("lx3" "|ۺrfsi[")
+("lx4" "SSLSOFdOuxiFr^ڣtwSZpֵjF\c")
+("lx82" "rq}eCk")
+("lx83" "Z")
+("lx84" "J")
+("lx9 " "")
+("lx92" "۽׽_[ںԬCeKۡF")
+("lx93" "A")
+("lx94" "j")
+("lxo " "o")
+("lxo2" "ùrY[ozm")
+("lxo3" "rs")
+("lxo4" "dܯOT_BָpΪ")
+("ly " "O")
+("ly2" "ӹư\ܼo~nKy")
+("ly3" "MO\")
+("ly4" "|Sb")
+("lz " "")
+("lz2" "ҨcGRHbc")
+("lz3" "ѫWL{y")
+("lz4" "ҵOToU")
+("m " "v")
+("m-2" "Xéacjܿ_{jpfEw`")
+("m-3" "rgSj")
+("m-4" "کsqx")
+("m02" "~]ʾQʱAvl`]ڳ\xB")
+("m03" "x\i")
+("m82" "ZCfںOѫ")
+("m83" "^")
+("m84" "Cҽpg[rBܻ")
+("m9 " "e")
+("m91" "")
+("m92" "̱ۯ")
+("m93" "")
+("m94" "eTV")
+("ma " "")
+("ma1" "")
+("ma2" "·s")
+("ma3" "½XbVM")
+("ma4" "|XY")
+("me " "}N")
+("me-2" "Wʿ߽P\UHy@yQ")
+("me-3" "֮qo")
+("me-4" "R\")
+("me2" "gjSGn^")
+("me3" "ڮ֩w߾kQ")
+("me4" "KeVcQWmYⷦ΢XmLCG")
+("me82" "ֺvضQzv")
+("me83" "KjqîYSB\_MMy")
+("me84" "")
+("me92" "ТxB^J~")
+("me93" "Ӽ{ԩת{׵C]Injݼ^")
+("mew " "A")
+("mew4" "GNBݩGzw")
+("mey " "")
+("mey4" "")
+("mez " "p")
+("mez2" "]y^")
+("mez3" "zHW")
+("mez4" "q[")
+("mi2" "Iŵ")
+("mi3" "RGh")
+("mi4" "گ")
+("mo " "N")
+("mo1" "")
+("mo2" "ҿiU]Ĩr")
+("mo3" "")
+("mo4" "qzS歯\ߪj[Zipnw֯~mEEh۾KfrM")
+("mq2" "SѬܪTC`𷰵DУSث޻Qqzu_K")
+("mq3" "CZT")
+("mq4" "fAKNξyzLڶq")
+("mr1" "")
+("mx2" "")
+("mx3" "adiϼྫΨ")
+("mx4" "ع}ӶҿpǨN`VAӾ~q")
+("my2" "Ѳ[ۿϨN")
+("my3" "YN^")
+("mz " "")
+("mz2" "Tٻiͻب]\U")
+("mz3" "f}g")
+("mz4" "U_TZѬعͻAHZ")
+("n " "z")
+("n-2" "")
+("n-4" "")
+("n0 " "")
+("n01" "")
+("n02" "n")
+("n03" "")
+("n04" "")
+("n8 " "_")
+("n82" "nk䷣Ix")
+("n83" "ivk")
+("n84" "")
+("n94" "")
+("na2" "Ѳ")
+("na3" "")
+("na4" "ǧo[u̮RͰʴ")
+("ne-2" "羮{fڬ]k")
+("ne-3" "")
+("ne-4" "צ")
+("ne02" "Q]")
+("ne04" "C")
+("ne2" "dgOeND]FObk")
+("ne3" "ApF̻oP")
+("ne4" "fİοdE|д")
+("ne82" "~HpD")
+("ne83" "ɼ[VӯGU")
+("ne84" "")
+("ne92" "z")
+("ne93" "")
+("new " "En")
+("new2" "|")
+("new4" "^\¿hIAnܡjvAsQXXQ")
+("ney " "")
+("ney2" "")
+("ney3" "çscUp")
+("ney4" "")
+("nez3" "оrs")
+("nez4" "")
+("ni2" "")
+("ni3" "DiΩ`CN")
+("ni4" "@`qUn")
+("nq3" "kN")
+("nq4" "")
+("nr " "O")
+("nu3" "kF")
+("nu4" "~")
+("nuw4" "h")
+("nx-2" "A@wªT")
+("nx-4" "")
+("nx2" "qV")
+("nx3" "V")
+("nx4" "")
+("nx83" "xN")
+("nxo2" "R{")
+("nxo3" "")
+("nxo4" "zݫѽ")
+("ny2" "c")
+("ny4" "U")
+("nz " "o")
+("nz2" "¾Lq̬`")
+("nz3" "o")
+("nz4" "x")
+("o " "ᣬ")
+("o2" "@")
+("p " "u")
+("p- " "yi{⧼q")
+("p-2" "B^꽴NPOˢ@LܽXh~L")
+("p-3" "֥")
+("p-4" "IԸkٮ")
+("p0 " "S")
+("p02" "eHKʾܧxY")
+("p03" "")
+("p04" "D")
+("p8 " "k")
+("p82" "LYϯDn\")
+("p83" "")
+("p84" "Pq߯`׵KNdXϸ")
+("p9 " "Q")
+("p92" "K")
+("p93" "{")
+("pa " "wr")
+("pa2" "]ҪI")
+("pa4" "ȩ׽")
+("pe " "ܤǼARQA`_e̮m|")
+("pe- " "\{")
+("pe-2" "~̵īөWiΰnunmзM[۲ӱߩϰ")
+("pe-3" "")
+("pe2" "֯hʵ\Jts]@}ﳲgei˭ׯhAfwfpf")
+("pe3" "_ǥԵlСy")
+("pe4" "ĴPB@}IW\vY")
+("pe8 " "gؾ")
+("pe82" "Kck")
+("pe84" "FM")
+("pe9 " "c")
+("pe92" "hxWIy")
+("pe93" "~")
+("pe94" "u")
+("pew " "hJ~")
+("pew3" "J")
+("pez " "ƺ}_ܸ")
+("pez2" "]A")
+("pez3" "}gegpOn")
+("pez4" "}YN[")
+("pi " "")
+("pi2" "ƵPrl")
+("pi3" "x")
+("pi4" "")
+("po " "iY@")
+("po2" "CIx")
+("po3" "r")
+("po4" "}zĪyjs")
+("pq " "FA[B_N")
+("pq2" "߳pIy")
+("pq3" "ڦ")
+("pq4" "tبK\nSůrɵ")
+("px " "QPڱ_̷")
+("px2" "븲ZЦڲ\m@rzYN")
+("px3" "HЮEPV")
+("px4" "ɾQrnE")
+("py " "}")
+("py2" "hѼ")
+("py3" "٫")
+("pz " "K")
+("pz2" "THS̩ϲƬҽ")
+("pz3" "]")
+("pz4" "wpC")
+("q " "")
+("r " "ˣΣ")
+("r2" "B_ZZ@omXʧx˳Hrxiڸ")
+("r3" "")
+("r4" "cjXk̹KsEcjmˮ맸K~FإخYGݦh_")
+("s " "q䴵prRBTzӸ@GWS@|")
+("s- " "")
+("s0 " "")
+("s03" "ݺb{")
+("s04" "")
+("s1" "")
+("s3" "")
+("s4" "|}xvSrx쾩qξo]NYAI")
+("s8 " "TM")
+("s83" "oX")
+("s84" "{")
+("s9 " "ix")
+("sa " "e")
+("sa3" "xs")
+("sa4" "Ĥٻ")
+("si " "θ|Bl")
+("si4" "ɶ")
+("sr4" "槣¨OlpZu")
+("sx " "ĬdpqZ")
+("sx- " "QPSCpe]C")
+("sx-3" "qn[")
+("sx-4" "e|^w")
+("sx2" "U")
+("sx4" "Dt±Jg½YHhAPFP\S{YeBɧZϩWMyB")
+("sx8 " "ĵmҩ")
+("sx83" "")
+("sx84" "[H")
+("sx9 " "]^ެݻ_N")
+("sx93" "lgih")
+("sx94" "")
+("sxo " "YPuTfbaV")
+("sxo3" "ү꺾c@")
+("sxo4" "")
+("sxq " "kAFhB֪gCcoD")
+("sxq2" "Hs")
+("sxq3" "gar")
+("sxq4" "EHJG`gaԽH^ID")
+("sy " "jB઻``YIޮ\^")
+("sy3" "]")
+("sy4" "")
+("sz " "bkiR")
+("sz3" "AԵ")
+("sz4" "M")
+("t " "y")
+("t-2" "küf")
+("t0 " "A")
+("t02" "}޷eF]_x")
+("t03" "սlI\f")
+("t04" "S")
+("t8 " "gyu~̾Rd")
+("t82" "ͼuȾ¾»\z^Gg")
+("t83" "ZReJT")
+("t84" "ļۺҬԼE")
+("ta " "Loe|͢")
+("ta3" "GX")
+("ta4" "f϶áݭľ־ػkYlOZkoN")
+("te " "I")
+("te- " "ťUչKͪ")
+("te-2" "xʫF^@lM߬W^")
+("te-3" "m[pMoXn")
+("te-4" "ť")
+("te2" "Dڳ׽{w󻶬NVxJgl")
+("te3" "^W")
+("te4" "PcOKVR³|")
+("te8 " "ѲKZ_")
+("te82" "в۰")
+("te83" "QfSb٧")
+("te84" "ml")
+("tew " "Ḳ")
+("tew3" "KR")
+("tew4" "Kצ")
+("tez " "Dֽιo")
+("tez2" "Ѩ٭|mgqULkf")
+("tez3" "DKw")
+("tez4" "ظоfm")
+("ti " "La")
+("ti2" "xOa׶`iϱ|")
+("ti4" "ӺAOg`^yV")
+("tr4" "S|i")
+("tx " "r`ա")
+("tx- " "qf֢ϵk")
+("tx-2" "Pɮc˾ֻwӦuhiYn@J")
+("tx-3" "εѶTJo")
+("tx-4" "hºEI")
+("tx2" "ϳ~{OY\E~r̨߫YLPbwS")
+("tx3" "gRAzG")
+("tx4" "ߦR")
+("tx8 " "~")
+("tx82" "{wqa")
+("tx84" "ν")
+("tx9 " "]tK")
+("tx92" "٧ybv͵ʤ")
+("tx93" "ʤ")
+("tx94" "a")
+("txo " "즫UحѾ~K")
+("txo2" "mbkY@]Ws[eײO")
+("txo3" "IW")
+("txo4" "ݳl")
+("txq " "a")
+("txq2" "ZR")
+("txq3" "L")
+("txq4" "haa")
+("ty " "")
+("ty1" "Y")
+("ty2" "Yޤ")
+("ty3" "DYo")
+("ty4" "z")
+("tz " "ܷŹqlݰmO[{E")
+("tz2" "k糳^ܰެvhBp`fA")
+("tz3" "Q")
+("tz4" "M")
+("u " "J@P֧ͦ")
+("u- " "ıel־sV`Hvou׻R")
+("u-2" "qQMx")
+("u-3" "êaiֿ鸺iñvsM\UίFѤ")
+("u-4" "Φ")
+("u2" "rTl_ME򷮹O\ַصͪpfjڮLgYܢٿi½ߨҨSBB\}maЬԥؤزOm")
+("u3" "PyBthžFܺ@޷OYּ{[J")
+("u4" "|JwɱUADηԴJmP౿ݱs{~¡RL\nֹ{ܮfڮKyٵHìg@HO٭RzqM}SsRgѬPkw")
+("u8 " "޲Wp{uBi")
+("u82" "줸tDK᫮JլGXʹEF˫ʺ`ӻ[_CuޫDd")
+("u83" "S")
+("u84" "|@bD޶@dpC")
+("u9 " "wrIjd")
+("u92" "éЪ⾸aeXNʳɴ]")
+("u93" "kfevpeu˰")
+("u94" "BĭY@wPy")
+("uw " "A_")
+("uw4" "V֮\fDģ_`ൻGeͣTcb^|v")
+("v " "|")
+("v- " "ѩeüN۩X")
+("v-3" "ծCXǮGd")
+("v-4" "}")
+("v0 " "^z\tiٻԶk")
+("v03" "^")
+("v04" "b")
+("v8 " "̤zxaXݯihzЦQ")
+("v83" "PzAux")
+("v84" "FBhmG")
+("v9 " "")
+("v92" "")
+("v93" "")
+("v94" "ӣ")
+("va " "")
+("va1" "")
+("va2" "")
+("va4" "")
+("vi " "ӫ¸u˴yjU[")
+("vi3" "")
+("vi4" "\t@vbG")
+("vq3" "")
+("vr " "qFޤvϷ]O")
+("vr1" "")
+("vr2" "歲jոf𫣻J@uӨC\}")
+("vr3" "S}")
+("vr4" "ӦUШ")
+("vx " "htdBfۣݩKGTl^@`VW~ZTIaU")
+("vx- " "u\ѧc`}GǪtpc@Z")
+("vx-3" "dE@Ҭq{ѱۻ")
+("vx-4" "@Ѱ^Pݢ")
+("vx0 " "֬ҮYӤ[|")
+("vx03" "sx")
+("vx04" "}Rt")
+("vx2" "")
+("vx3" "ѥj\YSƯL[¢SaתWF`FLBXk")
+("vx4" "GTUDiL_D")
+("vx8 " "x[aì``")
+("vx83" "]_FE")
+("vx84" "Ded|a[cuVq")
+("vx93" "uOXl@եR")
+("vx94" "k")
+("vxa " "ʬAhK~gߢ߲Aa")
+("vxa3" "l")
+("vxa4" "ohGEo")
+("vxi " "")
+("vxi3" "^b")
+("vxi4" "J[sM")
+("vxo " "Oԭb")
+("vxo2" "~UQA")
+("vxo3" "GqK_t]e")
+("vxo4" "L")
+("vxq " "kWtӦc^ԳصDиt")
+("vxq3" "yެosVɣiwֿ۹F")
+("vxq4" "Qd`P@k")
+("vy " "yĹ_e")
+("vy3" "AceeQӭ׭")
+("vy4" "ʫcbpỸzloU")
+("vz " "|It̯oSAR\")
+("vz3" "Zͷd`XR")
+("vz4" "ip{")
+("w " "")
+("w4" "M")
+("x " "ίQædzrdcjwzh")
+("x- " "ζoS")
+("x-3" "c[f")
+("x-4" "|")
+("x0 " "Lʿq")
+("x02" "`")
+("x03" "PɱSI٤vR")
+("x04" "ѦkZ")
+("x2" "Ld^ſz`\kfmOlbid")
+("x3" "ȪZRVMaKuɮqݳԤTmV")
+("x4" "Ūȴc~aJEcBظWt|QܪVO|;ڲg")
+("x8 " "WsܭdɽU")
+("x82" "xYKˣJ")
+("x83" "߸J{YpFd`{V١wNd")
+("x84" "Uñ{ɺdEcg")
+("x9 " "ŽEg")
+("x92" "DALTͲڧJ")
+("x93" "íkF")
+("x94" "ݻDZKݯoʹ")
+("xa " "zکKEqHCp")
+("xa2" "")
+("xa3" "_")
+("xa4" "")
+("xi " "n")
+("xi3" "")
+("xi4" "~")
+("xo " "ۭشsA")
+("xo3" "զ")
+("xo4" "רUWSQR_")
+("xq " "´Q߻~ejkDOm|ZPa")
+("xq2" "LMߺHޮcRWIWQt\ϪaobN")
+("xq3" "enӸTmԮUЬ޳qC߯~Lߤͷ|zypBַC")
+("xq4" "쥼Qè׭G޼LȽL}Bؼbst^Ycqu")
+("y " "ڿ^޹ãӰe_P")
+("y2" "ʡ")
+("y3" "¹ý~Bx")
+("y4" "x")
+("z " "Wb")
+("z2" "ξCgR}vmlWjj")
+("z3" "ͶͽD")
+("z4" "ƿDMش鮩j")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: chinese-big5-unix
+;; End:
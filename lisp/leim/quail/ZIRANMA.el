@@ -0,0 +1,28583 @@
+;; Quail package `chinese-ziranma'
+;;   Generated by the command `miscdic-convert'
+;;   Source dictionary file: ziranma.cin
+;;   Copyright notice of the source file
+;;------------------------------------------------------
+;; "ziranma.cin" is included in a free package called CCE.  It is
+;; available at:
+;;	http://ftp.debian.org/debian/dists/potato/main
+;;		/source/utils/cce_0.36.orig.tar.gz
+;; This package contains the following copyright notice.
+;;
+;;
+;;             Copyright (C) 1999, Rui He, herui@cs.duke.edu
+;;
+;;
+;;                  CCE(Console Chinese Environment) 0.32
+;;
+;; CCE is free software; you can redistribute it and/or modify it under the
+;; terms of the GNU General Public License as published by the Free Software
+;; Foundation; either version 1, or (at your option) any later version.
+;;
+;; CCE is distributed in the hope that it will be useful, but WITHOUT ANY
+;; WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+;; FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+;; details.
+;;
+;; You should have received a copy of the GNU General Public License along with
+;; CCE.  If not, see <https://www.gnu.org/licenses/>.
+;;------------------------------------------------------
+
+;;; Code:
+
+(require 'quail)
+(quail-define-package "chinese-ziranma" "Chinese-GB" "Ȼ" t
+"ˡȻ
+
+                            ̶ձ:
+ ששששששששש
+             shch    
+   iu  ua   e uan  ue uai   u   i   o  un
+       ia     van  ve ing          uo  vn
+ שߩשߩשߩשߩשߩשߩשߩשߩשߩש
+                     
+      aionguang  en eng ang  an  ao  ai
+        ongiang      ng                
+   שߩשߩשߩשߩשߩשߩשߩשߩשߩש
+           zh            
+       ei  ie iao  ui  ou  in ianǰҳҳũ
+                    v                        
+     ߩߩߩߩߩߩߩߩߩ
+
+
+Pinyin base input method for Chinese GB2312 characters (`chinese-gb2312').
+
+Pinyin is the standard roman transliteration method for Chinese.
+For the details of Pinyin system, see the documentation of the input
+method `chinese-py'.
+
+Unlike the standard spelling of Pinyin, in this input method all
+initials and finals are assigned to single keys (see the above table).
+For instance, the initial \"ch\" is assigned to the key `i', the final
+\"iu\" is assigned to the key `q', and tones 1, 2, 3, 4, and  are
+assigned to the keys `q', `w', `e', `r', `t' respectively.
+
+\\<quail-translation-docstring>
+
+To input one-letter words, you type 4 keys, the first two for the
+Pinyin of the letter, next one for tone, and the last one is always a
+quote (').  For instance, \"vsq'\" input .  Exceptions are these
+letters.  You can input them just by typing a single key.
+
+	Character:             û
+	Key:	   a  b  c  d  e  f  g  h  i  j  k  l  m
+	Character:  ŷ Ƭ        С һ 
+	Key:	   n  o  p  q  r  s  t  u  v  w  x  y  z
+
+To input two-letter words, you have two ways.  One way is to type 4
+keys, two for the first Pinyin, two for the second Pinyin.  For
+instance, \"vsgo\" inputs й.  Another way is to type 3 keys: 2
+initials of two letters, and quote (').  For instance, \"vg'\" also
+inputs й.
+
+To input three-letter words, you type 4 keys: initials of three
+letters, and the last is quote (').  For instance, \"bjy'2\" inputs 
+Ѽ (the last `2' is to select one of the candidates).
+
+To input words of more than three letters, you type 4 keys, initials
+of the first three letters and the last letter.  For instance,
+\"bjdt\" inputs ̨.
+
+To input symbols and punctuation, type `/' followed by one of `a' to
+`z', then select one of the candidates."
+  '(("" . quail-delete-last-char)
+   ("." . quail-next-translation)
+   ("[" . quail-next-translation)
+   ("," . quail-prev-translation)
+   ("]" . quail-prev-translation))
+  nil nil nil nil)
+
+(quail-define-rules
+("/a" "")
+("/b" "£ڡ")
+("/c" "é©éĩũƩ")
+("/d" "")
+("/e" "ţࢳǢѢۢסءޡ")
+("/f" "")
+("/g" "")
+("/h" "")
+("/i" "ɣߣܣ¢̢֢ǡɡ͡١֡ԡաơšȡ")
+("/j" "ʣ")
+("/k" "ˣ䡰")
+("/l" "̡ࣣסء")
+("/m" "ͣ¡")
+("/n" "Σߡѡۡ")
+("/o" "ϣۣâ͢ע")
+("/p" "УݣĢ΢آ")
+("/q" "ѣܣŢϢ٢񡬡")
+("/r" "ңȢҢܢ")
+("/s" "ӡ")
+("/t" "ԣɢӢݢ")
+("/u" "գˢբߢ")
+("/v" "֩ȩɩʩ˩̩ͩΩϩЩѩҩөԩթ֩שة٩ک۩ܩݩީߩ")
+("/w" "ףƢТڢѡ䡰")
+("/x" "أڡܡ")
+("/y" "٣ޣʢԢޢСڡܡۡݡߡ")
+("a" "")
+("aaba" [""])
+("aabk" [""])
+("aae'" "")
+("aaer" [""])
+("aaha" [""])
+("aajj" [""])
+("aali" [""])
+("aamj" [""])
+("aamk" ["ë"])
+("aamy" [""])
+("aapo" [""])
+("aaq'" "߹")
+("aar'" "")
+("aat'" "")
+("aaw'" "")
+("aayi" [""])
+("abbd" [""])
+("abjb" ["Ͱ"])
+("ablv" ["չ"])
+("abvb" [""])
+("ad'" [""])
+("adl'" ["" "µ"])
+("adly" ["Ĵ"])
+("adsm" ["˹ɽ"])
+("adsu" ["˹ɽ"])
+("adu'" [""])
+("aebm" ["˹ɽ"])
+("aeby" [""])
+("aeje" [""])
+("aejy" [""])
+("ael'" [""])
+("aetu" ["̩ɽ"])
+("afh'" [""])
+("afuj" ["ؼ"])
+("agd'" ["涨"])
+("aggv" [""])
+("agl'" [""])
+("agq'" "")
+("agr'" "")
+("agrj" ["Ȼ"])
+("agru" ["ʿ"])
+("agsd" ["¹˹"])
+("agsi" ["˾"])
+("agt'" ["͢"])
+("agub" [""])
+("agvy" [""])
+("agw'" "")
+("agwd" ["˶"])
+("agyh" [""])
+("agzh" [""])
+("agzw" [""])
+("ahu'" ["ʡ"])
+("ahv'" [""])
+("aibj" [""])
+("aida" ["" "ߴ"])
+("aidk" ["" "ߵ"])
+("aidl" [""])
+("aie'" "")
+("aiee" ["" "߶"])
+("aifu" [""])
+("aige" ["" ""])
+("aigo" [""])
+("aihk" ["" ""])
+("aihu" [""])
+("aiib" [""])
+("aiji" [""])
+("aijn" ["߽"])
+("ailm" [""])
+("aima" [""])
+("aimn" [""])
+("aimu" ["Ľ"])
+("aimy" [""])
+("aimz" [""])
+("aiq'" "")
+("aiqq" [""])
+("aiqy" [""])
+("air'" "")
+("airf" [""])
+("aisi" ["˼"])
+("aitj" ["̾"])
+("aits" ["ʹ"])
+("aiuh" ["" ""])
+("aiui" [""])
+("aive" [""])
+("aivg" ["֢"])
+("aiw'" "")
+("aixc" ["С"])
+("aixi" ["ϧ"])
+("aiya" ["ѽ" "ѽ"])
+("aiyo" ["Ӵ"])
+("aiyt" [""])
+("aizg" [""])
+("aizi" [""])
+("aj'" [""])
+("ajh'" ["ƻ"])
+("ajlh" ["仧"])
+("ajly" ["ҵ"])
+("ajs'" [""])
+("ajsl" [""])
+("akl'" [""])
+("albd" ["뵺"])
+("albr" [""])
+("alfp" ["ͷ"])
+("alft" [""])
+("alh'" [""])
+("alqi" ["ȡ"])
+("alu'" ["»ɽ"])
+("amj'" ["澵"])
+("anan" [""])
+("anbk" [""])
+("anbm" [""])
+("anch" [""])
+("anci" [""])
+("andj" [""])
+("andp" [""])
+("ands" [""])
+("andy" [""])
+("ane'" "")
+("anfh" [""])
+("anfu" ["" ""])
+("angh" [""])
+("ango" [""])
+("angr" [""])
+("anhk" [""])
+("anhl" [""])
+("anhv" [""])
+("anhw" [""])
+("ania" [""])
+("anjc" [""])
+("anji" [""])
+("anjm" [""])
+("anjr" [""])
+("anju" [""])
+("anjw" [""])
+("anjy" [""])
+("anle" [""])
+("anli" [""])
+("anlq" [""])
+("anma" [""])
+("anmf" [""])
+("anmm" [""])
+("anmn" [""])
+("anmo" ["Ħ"])
+("anna" ["" ""])
+("annj" [""])
+("annq" ["ť"])
+("anny" [""])
+("anpl" [""])
+("anpz" [""])
+("anq'" "")
+("anqi" [""])
+("anqr" ["ȫ"])
+("anqy" [""])
+("anr'" "")
+("anrj" ["Ȼ"])
+("anua" ["ɱ"])
+("anuf" [""])
+("anug" [""])
+("anui" ["ʱ" "ʾ" ""])
+("anuj" ["ɽ"])
+("anuo" ["˵"])
+("anuu" [""])
+("anuv" ["ˮ"])
+("anvd" ["װ"])
+("anvi" [""])
+("anvk" [""])
+("anvs" [""])
+("anwf" [""])
+("anwz" ["Σ" "ο"])
+("anxc" ["Ц"])
+("anxd" [""])
+("anxi" ["Ϣ"])
+("anxm" ["" ""])
+("anxn" [""])
+("anya" ["ѹ"])
+("anyh" [""])
+("anyi" [""])
+("anyj" [""])
+("anyr" ["Դ"])
+("anyu" ["" ""])
+("anzh" [""])
+("anzi" ["" ""])
+("aobl" [""])
+("aoe'" "")
+("aogo" [""])
+("aohv" ["û"])
+("aojn" [""])
+("aoln" [""])
+("aomc" [""])
+("aomf" [""])
+("aomi" [""])
+("aomj" [""])
+("aonk" [""])
+("aoq'" "")
+("aor'" "°ð")
+("aosh" ["ɥ"])
+("aotb" ["͸"])
+("aotu" ["͹"])
+("aovb" [""])
+("aow'" "")
+("aoxd" [""])
+("aoxm" [""])
+("aoyb" [""])
+("aoye" ["ҹ"])
+("aoyk" ["ҩ"])
+("ap'" [""])
+("aq'" ["ȫ"])
+("aqcu" ["ȫʩ"])
+("aqd'" ["ȫ"])
+("aqf'" ["ȫ"])
+("aqji" ["ȫ"])
+("aqlh" ["ȫ»"])
+("aqui" ["ȫ"])
+("aqxu" ["ȫϵ"])
+("asey" [""])
+("ashe" ["ɭ"])
+("ast'" ["˹"])
+("au'" ["ʱ"])
+("autq" ["̾"])
+("auvl" ["ʷ֮"])
+("auwi" ["ʱ"])
+("av'" [""])
+("avny" [""])
+("axfp" [""])
+("ayh'" ["˻"])
+("ayst" ["˹̹"])
+("b" "")
+("baba" ["Ͱ" "ְ"])
+("babk" ["˱"])
+("babl" ["˰"])
+("baby" ["ѱ"])
+("baci" ["˴"])
+("back" ["β"])
+("bad'" [""])
+("badb" ["ʶ"])
+("badc" ["ε"])
+("badk" ["Ե"])
+("badp" ["Ͷ"])
+("bae'" "а")
+("bael" [""])
+("baer" ["Ѷ"])
+("baff" ["˷"])
+("bafg" ["ѷ"])
+("bafh" ["˷"])
+("bage" ["˸"])
+("bagr" ["ѹ" "չ"])
+("bags" ["չ"])
+("bagu" ["˹"])
+("bahe" ["ͺ" "κ"])
+("bahf" ["̺"])
+("bahu" ["˻"])
+("baie" ["ǳ"])
+("baig" ["˳"])
+("baih" ["г"])
+("baii" ["ѳ"])
+("baiu" ["γ" ""])
+("bajc" ["Ž" "˽" "ս"])
+("bajm" ["μ"])
+("bajq" ["Ѿ"])
+("bajw" ["˼" "Ѽ"])
+("bajx" ["˽" "ͽ" "ν"])
+("bake" ["տ"])
+("bakl" ["ǿ"])
+("baku" ["Ϳ"])
+("balc" [""])
+("bald" [""])
+("bali" [""])
+("baln" [""])
+("balu" ["·"])
+("balz" [""])
+("bamf" [""])
+("bamm" [""])
+("bani" [""])
+("baq'" "ŰưǰȰɰʰ˰̰")
+("baqi" [""])
+("baqm" ["ǧ"])
+("baqr" ["Ȩ"])
+("bar'" "ѰҰӰ԰հ")
+("barj" ["Ⱦ"])
+("bat'" "ɰ")
+("baub" ["" ""])
+("baue" [""])
+("baui" ["ʮ" "ʽ" ""])
+("bauj" ["ɽ"])
+("bavh" [""])
+("bavj" ["ռ"])
+("bavu" [""])
+("baw'" "˰ΰ")
+("bawh" [""])
+("bawo" [""])
+("baxi" ["" "Ϸ"])
+("baxq" [""])
+("baya" [""])
+("baye" ["ҵ"])
+("bayt" [""])
+("bazi" ["" "" "" ""])
+("bb'" [""])
+("bbd'" ["Ͳ" "첻"])
+("bbjl" ["䱾"])
+("bbju" ["ȱȽ"])
+("bbku" ["ز"])
+("bbl'" ["ͱ"])
+("bbm'" ["ȱ"])
+("bbq'" [""])
+("bbt'" [""])
+("bbu'" ["Ȳ" ""])
+("bbv'" ["ס"])
+("bbw'" [""])
+("bbx'" ["˱" "" "Ѷ"])
+("bbxj" ["׼"])
+("bbxr" [""])
+("bby'" ["" "Ҫ"])
+("bbz'" ["뱲"])
+("bbzb" ["ʱ"])
+("bc'" [""])
+("bcbc" [""])
+("bcbf" ["걾"])
+("bcbh" [""])
+("bcbi" [""])
+("bcbk" [""])
+("bcbl" [""])
+("bcby" [""])
+("bccg" [""])
+("bcda" [""])
+("bcdg" [""])
+("bcdi" [""])
+("bcdm" [""])
+("bcdy" ["궨"])
+("bce'" "")
+("bcfz" [""])
+("bcge" [""])
+("bcgj" [""])
+("bcgk" [""])
+("bcgm" ["ݸĿ"])
+("bcgr" [""])
+("bchk" [""])
+("bcii" [""])
+("bcji" [""])
+("bcjt" [""])
+("bcjw" [""])
+("bcld" [""])
+("bcli" [""])
+("bclu" ["¶"])
+("bcmm" [""])
+("bcmy" ["" ""])
+("bcmz" [""])
+("bcpi" ["Ƥ"])
+("bcpj" [""])
+("bcq'" "")
+("bcqd" ["ǹ"])
+("bcqm" ["ǩ"])
+("bcqy" [""])
+("bcr'" "")
+("bctb" ["ͷ"])
+("bcti" [""])
+("bctl" ["̬"])
+("bcts" ["ͳ"])
+("bctu" [""])
+("bcui" ["ʾ"])
+("bcuu" [""])
+("bcuy" [""])
+("bcvf" [""])
+("bcvh" ["" ""])
+("bcvi" ["־"])
+("bcvp" ["׼"])
+("bcwn" [""])
+("bcwz" ["β"])
+("bcxd" [""])
+("bcxm" [""])
+("bcxy" [""])
+("bcyh" [""])
+("bcyj" [""])
+("bcyu" [""])
+("bd'" [""])
+("bdb'" ["ò"])
+("bdd'" ["õ" "𶯶" ""])
+("bddj" ["Ծ"])
+("bdei" [""])
+("bdev" ["ö֪"])
+("bdf'" [""])
+("bdfh" [""])
+("bdg'" ["" ""])
+("bdgl" ["˵ø"])
+("bdgm" ["ϸ"])
+("bdgs" ["ϴ˹"])
+("bdh'" ["" "" "Ⱥ"])
+("bdi'" ["׵۳" ""])
+("bdj'" [""])
+("bdjh" ["ȼ۽"])
+("bdl'" ["" ""])
+("bdlg" ["" ""])
+("bdps" ["˹"])
+("bdq'" [""])
+("bdrx" [""])
+("bds'" [""])
+("bdt'" ["뵼" "ͷ"])
+("bdu'" ["" "ʽ"])
+("bdus" ["ɫ"])
+("bdy'" [""])
+("bdyu" ["˵һ"])
+("bedy" ["Һ"])
+("beg'" ["Ͷ"])
+("begd" [""])
+("bels" ["׶˹"])
+("ben'" [""])
+("beqy" [""])
+("beuk" ["ʲά"])
+("bf'" [""])
+("bfan" [""])
+("bfb'" ["ٷֱ"])
+("bfbf" [""])
+("bfbk" [""])
+("bfbo" [""])
+("bfbu" [""])
+("bfcc" ["׷Բ"])
+("bfck" [""])
+("bfdi" [""])
+("bfdj" [""])
+("bfdv" [""])
+("bfe'" "")
+("bfer" [""])
+("bfff" ["" ""])
+("bffh" [""])
+("bffu" [""])
+("bfgo" [""])
+("bfh'" [""])
+("bfhh" [""])
+("bfhr" [""])
+("bfhv" [""])
+("bfii" [""])
+("bfj'" ["⽨" ""])
+("bfjd" ["⽨ֳ"])
+("bfji" [""])
+("bfju" [""])
+("bfjw" [""])
+("bfjx" ["" "ٷϾ"])
+("bfke" [""])
+("bfl'" ["ٷ"])
+("bfli" [""])
+("bfll" [""])
+("bflp" [""])
+("bflq" [""])
+("bfly" [""])
+("bflz" [""])
+("bfmh" ["æ"])
+("bfmo" ["ĩ"])
+("bfng" [""])
+("bfnm" [""])
+("bfpc" ["Ʊ"])
+("bfpk" [""])
+("bfq'" "")
+("bfqi" [""])
+("bfqm" ["Ǯ"])
+("bfr'" ["" "" "" "" ""])
+("bfrf" [""])
+("bfse" ["ɫ"])
+("bfso" [""])
+("bftg" [""])
+("bfti" ["" ""])
+("bftl" ["̨"])
+("bftu" [""])
+("bfu'" ["ٷ"])
+("bfuf" [""])
+("bfug" [""])
+("bfui" ["" ""])
+("bfuu" [""])
+("bfv'" ["ٷ֮"])
+("bfvb" ["ٷ֮" "" ""])
+("bfve" [""])
+("bfvi" ["ְ" ""])
+("bfvo" ["׾"])
+("bfvs" [""])
+("bfvu" [""])
+("bfvv" ["ս"])
+("bfwf" [""])
+("bfwz" ["λ"])
+("bfx'" ["ѩ"])
+("bfxd" [""])
+("bfxi" ["Ϫ"])
+("bfxn" [""])
+("bfxy" [""])
+("bfy'" [""])
+("bfye" ["ҵ"])
+("bfyf" ["˷"])
+("bfyi" [""])
+("bfyr" ["Դ"])
+("bfyt" [""])
+("bfzb" [""])
+("bfzi" [""])
+("bg'" [""])
+("bgbd" ["빤"])
+("bgbg" ["ܲ"])
+("bgbu" [""])
+("bgd'" ["͸" "" "ҵ"])
+("bgdl" [""])
+("bgdt" [""])
+("bge'" ["" ""])
+("bgfa" ["ŷ"])
+("bgi'" [""])
+("bgjn" [""])
+("bgkv" [""])
+("bglh" [""])
+("bglj" ["˹"])
+("bglx" ["" ""])
+("bgn'" [""])
+("bgq'" "")
+("bgr'" ["" "" "" "" "" "" ""])
+("bgt'" ["칫"])
+("bgta" [""])
+("bgu'" ["칫" ""])
+("bgvc" ["չ"])
+("bgw'" "")
+("bgwx" ["ѧ"])
+("bgx'" [""])
+("bgyq" ["һ"])
+("bgz'" [""])
+("bgzu" ["չ"])
+("bh'" ["仯"])
+("bhbf" [""])
+("bhbj" [""])
+("bhd'" ["ʵ" "͵" "Ͷ" ""])
+("bhdl" ["͵" "պϵ·"])
+("bhe'" "")
+("bhel" [""])
+("bhg'" [""])
+("bhgd" [""])
+("bhgs" ["ٻ˾" "﹤"])
+("bhgu" ["˰"])
+("bhh'" ["׻" ""])
+("bhhv" [""])
+("bhig" [""])
+("bhjc" [""])
+("bhjw" [""])
+("bhke" [""])
+("bhlm" [""])
+("bhmh" ["æ"])
+("bhpl" [""])
+("bhq'" ["" "" "" "" "任" "绤Ȩ"])
+("bhqd" ["ǻ"])
+("bhqf" ["ٻ"])
+("bhqq" [""])
+("bhr'" ["" "" "" "" "" "" "" "" "" "" "绤"])
+("bhry" ["Һ"])
+("bhtv" [""])
+("bhu'" ["绤ʿ"])
+("bhub" ["" ""])
+("bhud" ["ٻ̵"])
+("bhuy" ["ˮѹ" "ʱ"])
+("bhvt" ["״̬"])
+("bhvu" [""])
+("bhw'" ["׻" ""])
+("bhwj" [""])
+("bhxs" [""])
+("bhyh" [""])
+("bhys" ["˼"])
+("bhzi" ["" "" ""])
+("bi'" [""])
+("bian" ["˰"])
+("bibh" ["۰"])
+("bibi" ["ȱ"])
+("bibk" ["ڱ"])
+("bibl" ["ذ"])
+("bibo" ["̲"])
+("biby" ["ײ"])
+("bici" ["˴"])
+("bid'" ["׳"])
+("bidb" ["Ƕ"])
+("bidc" ["ʵ"])
+("bide" ["Ƶ" "˵" "ص"])
+("bidh" [""])
+("bidr" ["׶"])
+("bidv" ["ȶ"])
+("bidy" ["ض"])
+("bie'" "ȱɱʱذ")
+("bier" ["ȶ"])
+("bifa" ["ʷ"])
+("biff" ["ȷ"])
+("bifg" ["ʷ" "ܷ"])
+("bifh" ["ȷ"])
+("bifu" ["ȸ"])
+("bigj" ["ʸ"])
+("bigk" ["ȸ"])
+("bigr" ["չ"])
+("bigs" ["ƹ"])
+("bih'" ["溦"])
+("bihe" ["պ"])
+("bihu" ["ӻ" "ڻ"])
+("bihv" ["ջ"])
+("bihw" ["ʻ" "ڻ"])
+("biiu" ["ʴ" "ڳ"])
+("bijc" ["Ƚ"])
+("bijd" ["ؽ"])
+("biji" ["ʼ" "ʼ" "ߴ"])
+("bijm" ["Ǽ" "ʼ"])
+("bijn" ["ƽ"])
+("bijt" ["־"])
+("bijw" ["ȼ"])
+("bijy" ["Ͼ"])
+("bikb" ["տ"])
+("bikl" ["ܿ"])
+("biks" ["ǿ"])
+("bilc" [""])
+("bild" [""])
+("bili" ["" ""])
+("bilr" [""])
+("bilu" ["¼" "¯" "³"])
+("bilv" ["" ""])
+("bilz" [""])
+("bima" [""])
+("bimf" [""])
+("bimm" [""])
+("bimo" ["ī"])
+("bimu" ["Ļ"])
+("bimy" ["" ""])
+("bing" [""])
+("bini" [""])
+("binj" [""])
+("binm" [""])
+("bip'" ["Ʒ"])
+("bipo" [""])
+("biq'" "")
+("biqd" ["ǻ"])
+("biqi" [""])
+("bir'" "̱ͱαϱбѱұӱԱձֱױرٱڱ۱ܱݷ޵")
+("bire" [""])
+("birf" ["" ""])
+("birj" ["Ȼ"])
+("birs" [""])
+("biru" [""])
+("bise" [""])
+("bisi" [""])
+("bisl" [""])
+("bita" ["" "" ""])
+("bitb" ["ͷ"])
+("biti" [""])
+("bitk" [""])
+("bitl" ["·"])
+("biu'" ["" ""])
+("biub" ["ذ"])
+("biue" [""])
+("biug" ["" "" "ʤ"])
+("biui" ["" ""])
+("biuk" [""])
+("biup" ["˳"])
+("biuu" [""])
+("bive" [""])
+("bivf" [""])
+("bivg" ["֢"])
+("bivi" ["ֵ" "ֱ" "ֵ" ""])
+("bivk" [""])
+("bivs" [""])
+("biw'" "ݩ")
+("biwo" [""])
+("bix'" [""])
+("bixi" ["Ϣ"])
+("bixq" [""])
+("bixu" ["" ""])
+("bixw" ["" ""])
+("bixx" ["а"])
+("bixy" [""])
+("biye" ["ҵ"])
+("biyi" [""])
+("biyj" [""])
+("biyk" ["Ҫ"])
+("biyn" [""])
+("biyp" [""])
+("biyu" ["" ""])
+("bizi" ["" ""])
+("bizo" [""])
+("bj'" [""])
+("bjan" ["참"])
+("bjb'" ["༭"])
+("bjbf" ["汾"])
+("bjbi" [""])
+("bjbj" ["߰"])
+("bjbk" ["屨"])
+("bjbl" ["߰"])
+("bjbm" [""])
+("bjbu" ["䲼" "벿"])
+("bjc'" ["߽"])
+("bjci" [""])
+("bjcl" [""])
+("bjd'" ["" ""])
+("bjda" [""])
+("bjdg" [""])
+("bjdk" ["뵺" "쵽"])
+("bjdm" ["ߵ" ""])
+("bjds" ["ᶯ"])
+("bjdt" ["̨"])
+("bjdx" ["ѧ"])
+("bje'" "")
+("bjfa" ["䷢" "취"])
+("bjge" [""])
+("bjgs" ["칫"])
+("bjgu" [""])
+("bjhk" [""])
+("bjho" [""])
+("bjhu" [""])
+("bjhw" ["滭"])
+("bji'" [""])
+("bjie" ["೵"])
+("bjih" ["볡"])
+("bjij" [""])
+("bjj'" ["" ""])
+("bjjc" [""])
+("bjji" ["" "༶"])
+("bjjn" [""])
+("bjju" [""])
+("bjjw" [""])
+("bjjx" ["" ""])
+("bjjy" ["뾶"])
+("bjkl" ["Ὺ"])
+("bjky" ["Ѽ"])
+("bjl'" ["߽" ""])
+("bjli" ["" ""])
+("bjlt" ["˹"])
+("bjlu" ["·"])
+("bjlv" [""])
+("bjly" [""])
+("bjm'" [""])
+("bjma" [""])
+("bjmd" ["˶"])
+("bjmj" ["˹"])
+("bjmm" [""])
+("bjmo" ["Ĥ"])
+("bjnm" [""])
+("bjpz" [""])
+("bjq'" ["" "" "" "" "" "" "" "" "Ȩ" ""])
+("bjqi" [""])
+("bjqq" ["" ""])
+("bjqr" ["Ȩ"])
+("bjqu" [""])
+("bjr'" ["" "" "" "" "" "" "" "Ȼ"])
+("bjri" [""])
+("bjs'" [""])
+("bjsi" [""])
+("bjst" ["ͻ˹̹" "ͨ"])
+("bjsv" [""])
+("bjtj" [""])
+("bjtl" ["ͳ"])
+("bjtm" [""])
+("bjtu" ["ͼ" ";"])
+("bju'" ["ʯ" "" "" ""])
+("bjub" [""])
+("bjug" [""])
+("bjuh" [""])
+("bjui" ["" ""])
+("bjuu" ["" ""])
+("bjuv" ["˰"])
+("bjv'" ["˽"])
+("bjvd" [""])
+("bjve" [""])
+("bjvh" ["೤"])
+("bjvm" ["ټ"])
+("bjvq" [""])
+("bjvs" [""])
+("bjwf" [""])
+("bjwt" ["߽"])
+("bjx'" [""])
+("bjxj" ["С"])
+("bjxt" ["ѧ"])
+("bjxy" [""])
+("bjy'" ["׾" "Ѽ"])
+("bjya" [""])
+("bjye" ["ҹ"])
+("bjyi" [""])
+("bjyj" [""])
+("bjyn" ["" ""])
+("bjyp" [""])
+("bjyr" ["Բ"])
+("bjys" [""])
+("bjyt" [""])
+("bjzb" [""])
+("bjzi" ["" "" ""])
+("bjzu" [""])
+("bjzv" ["ս"])
+("bk'" [""])
+("bkan" [""])
+("bkb'" ["ɲ"])
+("bkbc" ["" ""])
+("bkbi" [""])
+("bkbj" [""])
+("bkbk" [""])
+("bkbm" ["" "ɱ"])
+("bkby" [""])
+("bkbz" [""])
+("bkch" [""])
+("bkcj" [""])
+("bkcp" [""])
+("bkda" [""])
+("bkdd" ["ɶ"])
+("bkdk" ["" "" ""])
+("bkdm" [""])
+("bkds" [""])
+("bkdx" [""])
+("bkdy" [""])
+("bke'" "")
+("bkfa" ["" ""])
+("bkfg" [""])
+("bkfr" ["ɷ"])
+("bkfu" ["" "" ""])
+("bkfz" [""])
+("bkgd" ["ع"])
+("bkgj" [""])
+("bkgk" [""])
+("bkgo" ["" ""])
+("bkgr" ["" "" "ɸ"])
+("bkgs" [""])
+("bkgu" ["" ""])
+("bkgv" [""])
+("bkhe" [""])
+("bkhj" ["" "" ""])
+("bkhu" [""])
+("bkhw" ["ٻ"])
+("bkib" ["" ""])
+("bkid" ["ٴ"])
+("bkie" [""])
+("bkih" [""])
+("bkii" [""])
+("bkij" [""])
+("bkik" [""])
+("bkil" [""])
+("bkjd" [""])
+("bkji" [""])
+("bkjm" ["" "" ""])
+("bkjn" [""])
+("bkjp" [""])
+("bkjw" [""])
+("bkjx" [""])
+("bkjy" [""])
+("bkkj" [""])
+("bkkk" [""])
+("bkko" [""])
+("bkku" [""])
+("bklb" ["¶"])
+("bkle" ["ն"])
+("bkli" ["" ""])
+("bklj" [""])
+("bklo" [""])
+("bklq" [""])
+("bklr" [""])
+("bklx" ["" ""])
+("bklz" [""])
+("bkmc" [""])
+("bkmi" ["" ""])
+("bkmj" [""])
+("bkmm" ["ĥ"])
+("bkmu" ["ķ" "ĸ"])
+("bkmy" [""])
+("bknt" ["Ű"])
+("bkpi" ["Ƥ"])
+("bkpo" [""])
+("bkpu" [""])
+("bkq'" ["" "" "" "" "" "" "" "" "" ""])
+("bkqi" [""])
+("bkqm" ["Ǹ"])
+("bkqr" ["ȫ"])
+("bkqu" ["ٿȫ"])
+("bkqy" [""])
+("bkr'" "")
+("bkrf" [""])
+("bkss" [""])
+("bksy" ["˼"])
+("bkt'" ["׿"])
+("bkta" [""])
+("bktb" ["ͷ"])
+("bktl" ["̥"])
+("bktu" ["ͽ"])
+("bkub" [""])
+("bkue" [""])
+("bkuf" [""])
+("bkuh" [""])
+("bkui" ["ʯ"])
+("bkul" ["ɹ"])
+("bkum" [""])
+("bkuu" ["ʤ"])
+("bkux" [""])
+("bkva" ["" "ը"])
+("bkvd" ["װ"])
+("bkve" [""])
+("bkvf" [""])
+("bkvg" ["֤" ""])
+("bkvh" ["" ""])
+("bkvi" ["ֽ"])
+("bkvl" ["֪"])
+("bkvm" ["׽"])
+("bkvr" [""])
+("bkvs" [""])
+("bkvu" [""])
+("bkw'" "")
+("bkwf" [""])
+("bkwu" ["" ""])
+("bkwz" ["Χ" ""])
+("bkxc" ["" ""])
+("bkxi" ["ϲ"])
+("bkxm" [""])
+("bkxn" [""])
+("bkxq" [""])
+("bkxx" [""])
+("bkxy" [""])
+("bkyb" ["" ""])
+("bkyh" [""])
+("bkyi" [""])
+("bkyr" ["Թ"])
+("bkyu" ["" "" "" "һ"])
+("bkzh" [""])
+("bkzi" ["" "" "" ""])
+("bkzk" [""])
+("bkzl" [""])
+("bkzo" [""])
+("bkzv" ["־"])
+("blb'" ["" ""])
+("blbh" ["仯"])
+("blbj" ["ٰ"])
+("blbl" ["װ"])
+("blbu" ["ײ" "ڲ"])
+("blbz" ["ٱ"])
+("blcl" ["ײ"])
+("bld'" ["" "¡"])
+("blda" ["״"])
+("bldh" ["޵ĺ"])
+("bldi" ["׵"])
+("bldm" ["׵"])
+("bldp" ["ٶ"])
+("blds" ["ڶ"])
+("bldt" [""])
+("bldu" ["ڶ"])
+("ble'" "ذٰڰ۲")
+("blee" [""])
+("bleh" ["Ͷ"])
+("bler" ["ٶ"])
+("blfa" ["׷"])
+("blff" ["׷" "ٷ"])
+("blfh" ["ݷ"])
+("blfv" ["ҷ"])
+("blfz" ["׷" "׷"])
+("blg'" ["" ""])
+("blgm" [""])
+("blgr" ["ٹ"])
+("blgs" ["׹"])
+("blgu" ["蹫" "׹"])
+("blh'" ["" ""])
+("blhe" ["׺"])
+("blhk" ["ں"])
+("blho" ["ٻ"])
+("blhu" ["׻"])
+("blhv" ["׻" "ݻ"])
+("blhw" ["׻" "׻" "׻" ""])
+("blhy" ["ܻ"])
+("bli'" ["" "ݴ"])
+("blie" ["ά"])
+("blii" ["׳"])
+("bliu" ["ٳ"])
+("blj'" ["·" ""])
+("bljd" ["ܽ"])
+("blji" ["ټ"])
+("bljm" ["ݼ"])
+("bljn" ["׽"])
+("bljp" ["׾"])
+("bljq" ["׾"])
+("blju" ["ܾ"])
+("bljw" ["ټ"])
+("bljy" ["׾"])
+("blke" ["ٿ"])
+("blla" [""])
+("blld" [""])
+("bllh" [""])
+("blli" [""])
+("bllj" [""])
+("blln" [""])
+("bllu" ["¶"])
+("bllv" ["֮"])
+("blly" [""])
+("bllz" [""])
+("blma" [""])
+("blmi" [""])
+("blmm" [""])
+("blmu" ["ľ"])
+("bln'" ["³ŵ"])
+("blnm" ["" ""])
+("blns" ["Ū"])
+("blq'" ["" ""])
+("blqi" [""])
+("blqu" [""])
+("blqx" [""])
+("blr'" "ܰݰ")
+("blrb" [""])
+("blre" [""])
+("blrf" [""])
+("blri" ["" ""])
+("bls'" ["˿"])
+("blse" ["ɫ" "³"])
+("blst" ["˹̹"])
+("blsu" [""])
+("blt'" ["ͼ" "³"])
+("blta" [""])
+("bltb" ["ͷ"])
+("blth" [""])
+("bltk" [""])
+("bltm" [""])
+("blto" ["" ""])
+("blts" ["ͭ"])
+("bltv" [""])
+("bltx" [""])
+("blty" ["һ"])
+("blu'" ["" "ʱ"])
+("blua" ["ɳ"])
+("blue" [""])
+("blug" ["ʤ"])
+("blut" ["ʧ"])
+("bluu" ["" ""])
+("bluv" ["ˮ"])
+("blv'" ["" "ֽ"])
+("blvb" [""])
+("blvg" [""])
+("blvh" [""])
+("blvi" ["ֽ"])
+("blvj" ["ս"])
+("blvk" ["׳"])
+("blvo" [""])
+("blvs" [""])
+("blvx" [""])
+("blw'" ["" ""])
+("blwh" [""])
+("blwj" [""])
+("blwy" ["ά"])
+("blx'" ["ѧ"])
+("blxd" [""])
+("blxm" [""])
+("blxs" [""])
+("blxt" ["ѩ"])
+("blxw" ["ά"])
+("blxx" ["л"])
+("blxy" ["" ""])
+("blyb" [""])
+("blyd" ["˶"])
+("blyh" [""])
+("blyi" [""])
+("blyj" [""])
+("blyn" [""])
+("blyp" [""])
+("blyr" ["Ԫ"])
+("blyu" [""])
+("blzi" [""])
+("blzl" [""])
+("blzu" [""])
+("bm'" [""])
+("bmbo" ["粵"])
+("bmbu" ["鲼"])
+("bmbx" [""])
+("bmce" ["޲"])
+("bmcl" ["߲"])
+("bmcr" [""])
+("bmcs" [""])
+("bmda" ["޴" ""])
+("bmdb" ["ⶹ"])
+("bmdh" ["㵱"])
+("bmdi" ["" ""])
+("bmdj" ["ⵣ"])
+("bmdk" ["ർ" ""])
+("bmdl" ["ߴ"])
+("bmdm" [""])
+("bmds" ["䶯"])
+("bmdv" [""])
+("bmdy" ["ඩ"])
+("bme'" "")
+("bmee" ["Ҷ"])
+("bmeh" ["ı"])
+("bmer" ["߶"])
+("bmfa" ["䷨"])
+("bmfg" ["߷"])
+("bmfh" ["߷"])
+("bmfj" ["㷹"])
+("bmfu" [""])
+("bmgd" [""])
+("bmge" [""])
+("bmgg" [""])
+("bmgu" [""])
+("bmgw" [""])
+("bmh'" ["滯"])
+("bmhj" ["Լ"])
+("bmhk" [""])
+("bmhr" ["任" ""])
+("bmhs" [""])
+("bmhu" ["绤"])
+("bmhv" [""])
+("bmhw" ["仯"])
+("bmig" ["" ""])
+("bmiv" [""])
+("bmj'" [""])
+("bmjd" ["߽"])
+("bmji" ["߼" "༭"])
+("bmju" [""])
+("bmjx" ["߽" ""])
+("bmjy" ["߾"])
+("bmk'" [""])
+("bmkd" ["߿"])
+("bmke" [""])
+("bmld" [""])
+("bmli" [""])
+("bmll" [""])
+("bmlp" [""])
+("bmlr" [""])
+("bmm'" ["ãã"])
+("bmma" [""])
+("bmmk" ["ë"])
+("bmml" [""])
+("bmmn" [""])
+("bmn'" ["ëŮ"])
+("bmng" [""])
+("bmpk" [""])
+("bmpl" [""])
+("bmpn" ["Ƶ"])
+("bmpy" ["ƽ"])
+("bmq'" "ޱ߱")
+("bmqm" ["Ǩ"])
+("bmqt" ["ȵ"])
+("bmqu" [""])
+("bmr'" "")
+("bmrf" [""])
+("bmru" [""])
+("bmse" ["ɫ"])
+("bmsu" [""])
+("bmt'" "")
+("bmta" ["̢"])
+("bmtc" [""])
+("bmtl" ["̬"])
+("bmts" ["ͨ"])
+("bmu'" [""])
+("bmuf" [""])
+("bmuh" [""])
+("bmui" [""])
+("bmuu" [""])
+("bmv'" [""])
+("bmve" [""])
+("bmvg" ["֤"])
+("bmvi" ["֯" "" "ֵ" ""])
+("bmvl" ["" ""])
+("bmvs" [""])
+("bmvu" [""])
+("bmvx" [""])
+("bmwz" ["Ϊ"])
+("bmxd" [""])
+("bmxm" [""])
+("bmxn" [""])
+("bmxq" ["" ""])
+("bmxr" ["ѡ"])
+("bmxx" ["д" "Я"])
+("bmxy" ["" ""])
+("bmy'" ["Ŀ" "û"])
+("bmya" ["ѹ"])
+("bmye" ["Ұ"])
+("bmyh" [""])
+("bmyi" ["" "" ""])
+("bmyj" [""])
+("bmyn" ["ӡ"])
+("bmyr" ["Ե" "Զ" "Բ"])
+("bmyu" ["" ""])
+("bmzi" ["" ""])
+("bmzk" [""])
+("bmzr" [""])
+("bn'" [""])
+("bnb'" ["ܲ"])
+("bnbn" [""])
+("bnd'" [""])
+("bndj" [""])
+("bnfa" ["޷"])
+("bnff" ["ͷ"])
+("bngr" [""])
+("bnh'" [""])
+("bnhl" [""])
+("bnii" [""])
+("bniu" [""])
+("bnjc" ["޽"])
+("bnke" [""])
+("bnln" [""])
+("bnm'" [""])
+("bnmh" ["˺"])
+("bnq'" "")
+("bnqi" [""])
+("bnr'" "")
+("bnvb" [""])
+("bnvu" [""])
+("bnxf" ["ȷ"])
+("bnyu" ["" ""])
+("bnzh" [""])
+("boai" [""])
+("bobi" [""])
+("bobj" [""])
+("bobo" ["" "" "" ""])
+("bocg" [""])
+("bocl" [""])
+("bodb" [""])
+("bode" [""])
+("bodk" ["" ""])
+("bodo" [""])
+("bodr" [""])
+("bods" [""])
+("boe'" "")
+("boen" [""])
+("boer" [""])
+("bofa" [""])
+("bofg" [""])
+("bofh" [""])
+("bofu" [""])
+("boge" [""])
+("bogu" [""])
+("bohe" [""])
+("bohl" [""])
+("bohv" [""])
+("boih" [""])
+("boii" [""])
+("boir" [""])
+("boiu" [""])
+("boji" ["" ""])
+("bojt" [""])
+("bokl" [""])
+("bokr" [""])
+("bolh" [""])
+("boli" ["" "" ""])
+("bolj" ["" ""])
+("boln" [""])
+("bolo" ["" ""])
+("bomo" ["Ĥ"])
+("bomu" ["ĸ"])
+("bomz" [""])
+("bopm" ["Ƭ"])
+("boq'" "")
+("boqi" [""])
+("bor'" "ر")
+("borj" ["Ȼ"])
+("boro" [""])
+("bosi" ["˹"])
+("boss" [""])
+("bot'" "")
+("bote" [""])
+("botk" [""])
+("boui" ["ʴ" "ʿ"])
+("bouu" [""])
+("bove" [""])
+("bovi" ["ֽ"])
+("bovs" [""])
+("bow'" "ذٱ")
+("bowf" [""])
+("bowu" ["" ""])
+("bowz" ["λ"])
+("boxt" ["" "ѧ"])
+("boxy" [""])
+("boyn" [""])
+("boyp" [""])
+("boyr" ["Դ"])
+("bozi" [""])
+("bp'" [""])
+("bpbl" ["Ʋ"])
+("bpdy" ["ƽԼ"])
+("bpg'" ["Ƶ"])
+("bph'" ["ƽ"])
+("bpq'" ["Ƶ"])
+("bq'" [""])
+("bqbn" [""])
+("bquj" ["ʵ" ""])
+("bqvy" ["Ȩ"])
+("br'" [""])
+("brdw" ["鶯"])
+("brhj" [""])
+("brm'" [""])
+("brwg" ["Ȼ"])
+("brx'" ["Ȼ"])
+("bsbs" [""])
+("bsj'" ["ɫ"])
+("bskb" ["ɫֲ"])
+("bsq'" [""])
+("bsw'" ["˹"])
+("bsyd" ["˶"])
+("bt'" ["ͬ"])
+("btc'" [""])
+("btdj" ["̧"])
+("btef" [";"])
+("btfx" ["ͬ"])
+("btlu" [""])
+("btm'" ["͸" "͸"])
+("btp'" ["Ƥ"])
+("btq'" ["ͬ"])
+("btu'" ["͸ˮ"])
+("btvj" ["ͳν׼"])
+("btvv" ["ͳ"])
+("btxd" ["ѩ"])
+("bty'" ["ͬ"])
+("bu'" [""])
+("buan" [""])
+("bubi" ["" ""])
+("bubj" ["ֱ"])
+("bubm" ["" ""])
+("bubo" [""])
+("bubu" [""])
+("buby" [""])
+("bubz" [""])
+("buce" ["" ""])
+("bucg" [""])
+("buci" [""])
+("buco" [""])
+("bud'" ["ʿ"])
+("buda" [""])
+("budc" ["" ""])
+("bude" [""])
+("budg" [""])
+("budh" [""])
+("budi" [""])
+("budj" ["" ""])
+("budk" [""])
+("budl" [""])
+("budo" [""])
+("budr" ["" ""])
+("buds" [""])
+("budu" [""])
+("budv" ["" ""])
+("budx" [""])
+("budy" ["" ""])
+("bue'" "߲")
+("bufa" ["" "" "" ""])
+("buff" ["" ""])
+("bufg" [""])
+("bufh" ["" ""])
+("bufj" [""])
+("bufu" ["" ""])
+("bugb" [""])
+("bugd" [""])
+("bugf" [""])
+("bugj" ["" ""])
+("bugk" [""])
+("bugl" [""])
+("bugo" ["" ""])
+("bugr" ["" "" ""])
+("bugs" [""])
+("bugu" [""])
+("bugv" [""])
+("buhe" ["" ""])
+("buho" [""])
+("buhv" [""])
+("bui'" ["´"])
+("buig" [""])
+("buih" [""])
+("buii" ["" ""])
+("buis" [""])
+("buj'" [""])
+("bujc" [""])
+("buji" ["" "" "" ""])
+("bujm" ["" ""])
+("bujn" ["" "" ""])
+("bujq" ["" ""])
+("buju" ["" ""])
+("bujx" ["ʵ" "" ""])
+("bujy" ["" "" ""])
+("buke" ["" "" ""])
+("bukj" [""])
+("bukk" [""])
+("bukv" [""])
+("buky" [""])
+("bulc" ["" ""])
+("buld" [""])
+("bulh" [""])
+("buli" ["" "" ""])
+("bulk" [""])
+("bulo" [""])
+("bulp" [""])
+("bulv" [""])
+("buly" [""])
+("bulz" [""])
+("bumc" [""])
+("bumf" [""])
+("bumh" ["æ"])
+("bumj" ["" ""])
+("bumm" ["" ""])
+("bumn" [""])
+("bumy" [""])
+("bung" [""])
+("bupa" [""])
+("bupc" ["Ʊ"])
+("bupi" ["ƥ"])
+("bupy" ["ƽ"])
+("bupz" [""])
+("buq'" ["" "" "" "˥"])
+("buqc" [""])
+("buqd" ["ǹ"])
+("buqi" [""])
+("buqt" ["ȱ"])
+("buqu" [""])
+("bur'" "")
+("burf" ["" ""])
+("buri" [""])
+("burj" ["Ȼ"])
+("burs" [""])
+("buru" ["" ""])
+("buse" ["ɫ"])
+("busj" ["ɢ"])
+("buss" [""])
+("butb" ["ͷ"])
+("bute" [""])
+("buto" [""])
+("buts" ["ͨ" "ͬ"])
+("butu" ["ͼ"])
+("butx" [""])
+("buub" [""])
+("buuf" [""])
+("buug" ["ʤ"])
+("buui" ["ʳ" "ʱ" "" "" "ʲ"])
+("buuj" ["" "ʧʱ"])
+("buuk" [""])
+("buuu" ["ɽˮ" "" ""])
+("buuv" ["ɽׯ"])
+("buvb" [""])
+("buvf" ["" ""])
+("buvg" [""])
+("buvh" [""])
+("buvi" ["֪" "ֵ" "ֹ" "ֻ" "" "" ""])
+("buvo" ["׽"])
+("buvp" ["׼"])
+("buvr" ["ʳ"])
+("buvs" [""])
+("buvu" ["" "ס"])
+("buw'" ["" "" "ɳ" "ʧΪ"])
+("buwf" ["" "" ""])
+("buwl" [""])
+("buwu" [""])
+("buwz" ["Ω" "ί" "λ"])
+("buxc" ["" "Т" "Ф"])
+("buxd" [""])
+("buxi" ["ϰ" "ϧ"])
+("buxm" [""])
+("buxq" ["" ""])
+("buxr" ["ѡ"])
+("buxu" [""])
+("buxw" ["Ͼ" ""])
+("buxx" ["и" "м"])
+("buxy" ["" "" "" ""])
+("buy'" ["ʧҵ" "˵" "Ա"])
+("buyi" ["һ" "" "" "" "" ""])
+("buyj" [""])
+("buyk" ["Ҫ"])
+("buyp" [""])
+("buys" [""])
+("buyu" ["" "" ""])
+("buzi" [""])
+("buzl" [""])
+("buzu" ["" "" ""])
+("bv'" ["׼"])
+("bva'" ["߰"])
+("bvbj" ["֪" "ű߼"])
+("bvbk" ["۲"])
+("bvbn" ["۲"])
+("bvbu" ["սʤ"])
+("bvd'" ["װ" "֪"])
+("bvdy" ["׼ѹ"])
+("bvf'" ["֤"])
+("bvg'" ["׼"])
+("bvgy" ["֤Ӧ"])
+("bvgz" ["׼"])
+("bvh'" ["׼"])
+("bvhy" [""])
+("bvi'" ["׼"])
+("bvil" ["ʴ"])
+("bvj'" ["ֻ" "" "׼"])
+("bvl'" ["ֵ"])
+("bvm'" ["׼ľ"])
+("bvmd" ["ֳ"])
+("bvmj" [""])
+("bvp'" ["Ʒ"])
+("bvq'" [""])
+("bvr'" ["" "֤"])
+("bvry" ["׼Һ"])
+("bvsc" ["֪"])
+("bvu'" ["ը" "׼ʱ"])
+("bvux" [""])
+("bvv'" ["־"])
+("bvvf" ["֮"])
+("bvvk" ["׼״"])
+("bvvt" ["׼״̬"])
+("bvy'" ["" ""])
+("bw'" ["δ"])
+("bwe'" [""])
+("bwfw" [""])
+("bwg'" [""])
+("bwhp" ["ƽ"])
+("bwl'" ["¼"])
+("bwm'" [""])
+("bwp'" ["ƿ"])
+("bwq'" ["ΧȦ"])
+("bwv'" [""])
+("bwvy" ["λ"])
+("bwzg" [""])
+("bx'" [""])
+("bxb'" ["ϸ"])
+("bxba" [""])
+("bxd'" ["ֵ"])
+("bxde" [""])
+("bxds" [""])
+("bxdx" ["ֶ"])
+("bxe'" "")
+("bxf'" ["Ϸ"])
+("bxg'" ["չ" "" ""])
+("bxge" [""])
+("bxgo" [""])
+("bxgr" [""])
+("bxgs" ["չ˾"])
+("bxh'" [""])
+("bxhb" [""])
+("bxi'" ["γ"])
+("bxiu" [""])
+("bxje" ["ս"])
+("bxjj" ["׼"])
+("bxjq" ["ѡȨ"])
+("bxk'" ["޿"])
+("bxkj" [""])
+("bxl'" ["" ""])
+("bxly" ["" ""])
+("bxmy" [""])
+("bxnq" ["Ť"])
+("bxp'" ["Ʒ"])
+("bxq'" ["" "" "" "Ѫ"])
+("bxqi" [""])
+("bxqy" [""])
+("bxr'" ["" ""])
+("bxrf" [""])
+("bxrh" [""])
+("bxs'" ["˿"])
+("bxsj" [""])
+("bxti" [""])
+("bxu'" ["Сʱ"])
+("bxui" [""])
+("bxuo" ["˵"])
+("bxuu" [""])
+("bxux" [""])
+("bxv'" [""])
+("bxvi" [""])
+("bxvy" ["ע"])
+("bxw'" "")
+("bxwu" ["ѧ"])
+("bxx'" ["" ""])
+("bxxc" ["Ц"])
+("bxxd" [""])
+("bxy'" [""])
+("bxyg" ["мһ"])
+("bxzi" [""])
+("by'" ["Ҫ"])
+("byba" [""])
+("bybk" ["" ""])
+("bybm" ["" ""])
+("bybu" ["" ""])
+("bybz" ["" ""])
+("bycp" [""])
+("bycs" [""])
+("byd'" ["ɵ"])
+("bydh" [""])
+("bydk" ["" ""])
+("bydm" [""])
+("bydq" ["Զ"])
+("byds" [""])
+("bydu" [""])
+("bydy" [""])
+("bye'" "")
+("byet" ["Լͬ"])
+("byey" ["Զ"])
+("byez" ["һ"])
+("byfa" ["" ""])
+("byfg" [""])
+("byfh" ["" ""])
+("byfu" ["ɷ˵"])
+("byfz" [""])
+("bygf" [""])
+("bygj" [""])
+("bygp" [""])
+("bygs" [""])
+("byhe" [""])
+("byhk" [""])
+("byhl" [""])
+("byid" [""])
+("byig" ["" ""])
+("byih" [""])
+("byip" [""])
+("byir" ["" ""])
+("byj'" ["Ҫ"])
+("byjd" [""])
+("byjf" [""])
+("byjm" ["" ""])
+("byjn" [""])
+("byjp" [""])
+("byjq" [""])
+("byju" [""])
+("byjw" ["" ""])
+("byjy" ["" ""])
+("byk'" ["¿"])
+("byke" [""])
+("bykx" ["Եѧ"])
+("byl'" ["Ҫ"])
+("byld" ["ҪͶ" ""])
+("bylg" [""])
+("bylh" [""])
+("byli" ["" "" "" "" ""])
+("bylm" [""])
+("bylp" ["" ""])
+("bylx" [""])
+("byly" [""])
+("bylz" [""])
+("byma" [""])
+("bymo" ["ħ"])
+("byng" [""])
+("byns" ["ŵ˹˹"])
+("byp'" ["ѹ"])
+("bypj" ["ѹȽ׼"])
+("bypl" [""])
+("bypz" ["ѹ"])
+("byq'" ["" "" "" "" "ѹ"])
+("byqi" ["" ""])
+("byqq" [""])
+("byqr" ["Ȩ"])
+("byqx" [""])
+("byqy" ["" ""])
+("byr'" "")
+("byrf" [""])
+("byru" [""])
+("bys'" [""])
+("bysg" ["ҹ"])
+("byt'" ["ԭ"])
+("bytc" [""])
+("bytd" [""])
+("byth" [""])
+("bytl" ["̬"])
+("bytm" [""])
+("bytp" [""])
+("bytr" [""])
+("byts" ["ͪ"])
+("byu'" ["" "ҵ" "˵"])
+("byuf" ["˫"])
+("byui" ["ʿ" ""])
+("byuj" ["ɽ"])
+("byuu" [""])
+("byvd" ["״"])
+("byvf" [""])
+("byvg" ["֢"])
+("byvi" [""])
+("byvl" ["֮·"])
+("byvs" ["" "" ""])
+("byvu" [""])
+("bywj" [""])
+("bywr" ["ΪȻ"])
+("bywu" [""])
+("bywz" ["Σ" "δ"])
+("byx'" ["Ҫ"])
+("byxd" [""])
+("byxi" ["ϡ"])
+("byxt" ["ѩ"])
+("byxu" ["ϵ"])
+("byxy" [""])
+("byy'" ["Ա" "ҩ"])
+("byyh" [""])
+("byyi" ["" ""])
+("byyk" ["Ҫ"])
+("byyl" [""])
+("byyn" [""])
+("byyr" ["Ա" "Ա" "ԭ" "Ժ"])
+("byys" [""])
+("byyu" ["" ""])
+("byyx" [""])
+("byyy" ["Ӫ"])
+("byz'" [""])
+("byzi" [""])
+("byzk" [""])
+("byzl" [""])
+("byzv" [""])
+("bz'" [""])
+("bzai" [""])
+("bzan" [""])
+("bzbi" ["" ""])
+("bzbk" [""])
+("bzbm" [""])
+("bzbu" ["" "" ""])
+("bzbz" [""])
+("bzci" [""])
+("bzcj" [""])
+("bzd'" ["Զ"])
+("bzdi" [""])
+("bzdj" [""])
+("bzdk" [""])
+("bzds" [""])
+("bze'" "")
+("bzer" [""])
+("bzff" ["" "" ""])
+("bzfg" ["" ""])
+("bzfh" ["" ""])
+("bzfu" ["" ""])
+("bzfz" [""])
+("bzgd" [""])
+("bzge" [""])
+("bzgg" [""])
+("bzgk" [""])
+("bzgr" [""])
+("bzh'" ["ں"])
+("bzhb" [""])
+("bzhd" [""])
+("bzhl" ["" ""])
+("bzia" [""])
+("bzik" [""])
+("bziu" [""])
+("bzjc" [""])
+("bzji" ["" ""])
+("bzjm" ["" ""])
+("bzju" [""])
+("bzjx" [""])
+("bzjy" ["" ""])
+("bzke" ["" ""])
+("bzku" [""])
+("bzl'" [""])
+("bzla" [""])
+("bzlc" [""])
+("bzld" [""])
+("bzle" [""])
+("bzli" [""])
+("bzlx" [""])
+("bzlz" [""])
+("bzm'" ["ô"])
+("bzmm" ["" "" ""])
+("bzn'" [""])
+("bzou" ["ŷ"])
+("bzpj" [""])
+("bzpn" ["Ʒ"])
+("bzpo" [""])
+("bzq'" ["" "" "" "" "" "" "" "" "" ""])
+("bzqi" [""])
+("bzr'" "")
+("bzru" [""])
+("bzss" ["" ""])
+("bzt'" "")
+("bzts" ["ʹ"])
+("bzu'" [""])
+("bzud" ["ֶ"])
+("bzuh" [""])
+("bzuj" ["ɽ"])
+("bzuk" [""])
+("bzuu" ["" ""])
+("bzvb" [""])
+("bzvd" ["׳"])
+("bzvi" [""])
+("bzvj" ["ս"])
+("bzvu" ["ע"])
+("bzvw" ["ֲ"])
+("bzwf" [""])
+("bzwh" [""])
+("bzwo" [""])
+("bzwq" ["Ϊ"])
+("bzwz" ["γ"])
+("bzxf" ["ܷ"])
+("bzxg" [""])
+("bzxn" [""])
+("bzxw" [""])
+("bzxx" ["б"])
+("bzy'" [""])
+("bzyb" [""])
+("bzyh" [""])
+("bzys" [""])
+("bzyu" [""])
+("bzyy" ["Ӱ"])
+("bzz'" [""])
+("bzzg" [""])
+("bzzi" ["" "" ""])
+("c" "")
+("cadc" [""])
+("cae'" "")
+("cagj" [""])
+("caiu" [""])
+("cajy" [""])
+("cald" [""])
+("capo" [""])
+("caq'" "")
+("cauh" [""])
+("cb'" ["Ӳ"])
+("cbdk" ["յ"])
+("cbhe" ["պ"])
+("cbji" ["ռ"])
+("cbqc" [""])
+("cbr'" "")
+("cc'" ["Ӵ"])
+("ccbq" ["β"])
+("ccmm" ["Ҵææ"])
+("cdbv" ["ֵ"])
+("ce'" ["Ӷ"])
+("ceds" ["߶"])
+("cedy" ["ⶨ"])
+("ceer" [""])
+("cegf" [""])
+("cehd" [""])
+("cehv" [""])
+("cehw" ["߻"])
+("ceiu" [""])
+("ceju" [""])
+("celd" [""])
+("celt" [""])
+("cemf" [""])
+("cemm" [""])
+("cequ" ["ȡ"])
+("cer'" "޲߲")
+("ceso" [""])
+("cesu" [""])
+("ceuf" ["" ""])
+("ceui" [""])
+("cevi" ["֦"])
+("cevj" ["վ"])
+("cevs" [""])
+("cexm" ["" ""])
+("ceya" ["ѿ"])
+("ceye" ["ҳ"])
+("ceyi" [""])
+("ceyj" [""])
+("ceyy" ["Ӧ"])
+("cezi" [""])
+("cfci" ["β"])
+("cfdq" ["ŷŴ"])
+("cfq'" "")
+("cfw'" "")
+("cg'" ["ι"])
+("cgcg" [""])
+("cgci" [""])
+("cgdj" ["ӹŵ"])
+("cggk" [""])
+("cgjd" [""])
+("cgjy" [""])
+("cglb" ["¥"])
+("cgli" [""])
+("cglq" [""])
+("cgq'" "")
+("cgr'" "")
+("cgui" ["ʹ"])
+("cgw'" "")
+("cgwz" ["Ϊ"])
+("cgy'" ["ŸӦ"])
+("cgya" ["ѹ"])
+("cgyb" [""])
+("cgzl" [""])
+("ch'" ["˺"])
+("chbl" ["԰"])
+("chch" ["Բ"])
+("chcu" ["ִ" ""])
+("chcv" ["Դ"])
+("chhd" ["Ի" "ֻ"])
+("chhl" ["׺"])
+("chj'" ["߻"])
+("chjx" [""])
+("chjy" ["Ծ"])
+("chku" ["ֿ"])
+("chlh" ["߻ѻ"])
+("chlk" [""])
+("chln" [""])
+("chmh" ["ã"])
+("chni" [""])
+("chq'" "Բղֲ")
+("chsh" ["ɣ"])
+("chss" [""])
+("chtm" [""])
+("chuf" [""])
+("chui" [""])
+("chuu" [""])
+("chvb" [""])
+("chw'" "")
+("chwz" ["λ"])
+("chyy" ["Ӭ"])
+("chzy" ["߻"])
+("ciai" ["Ȱ"])
+("cibi" ["α"])
+("cibq" [""])
+("cibz" ["ȱ"])
+("cidg" ["ε"])
+("cidi" ["˵" "ε"])
+("cidk" ["̵"])
+("cidl" ["Ŵ"])
+("cidm" ["ǵ" "ʵ"])
+("cie'" "")
+("cier" ["ʶ" "̶"])
+("cifu" ["ŷ"])
+("cigf" ["ʸ"])
+("cigu" ["̹"])
+("cigx" ["Ʋϵ"])
+("cihb" ["˺" "ź"])
+("cihd" ["ƻ"])
+("cihv" ["ʻ"])
+("cihw" ["Ż" "ƻ" "˻"])
+("cihy" ["̻"])
+("ciih" ["ų"])
+("ciiu" ["˴"])
+("cijc" ["ͽ"])
+("ciji" ["ż" "̼"])
+("cijm" ["˼"])
+("cijp" ["˾"])
+("ciju" ["ž" "ʾ"])
+("cijy" ["ӳ"])
+("cike" ["˿" "̿"])
+("ciku" ["ʿ"])
+("cili" [""])
+("cilz" [""])
+("cimu" ["ĸ"])
+("cing" [""])
+("cipj" [""])
+("cipn" ["Ʒ"])
+("cipy" ["ƺ"])
+("ciq'" ["" "" "" "" "ƲȨ" "洢"])
+("ciqd" ["ųǿ"])
+("ciqi" ["Ʋ" ""])
+("ciqu" ["ȥ" ""])
+("cir'" "̴ʹ")
+("cirf" [""])
+("ciri" [""])
+("cirv" [""])
+("citb" ["ͷ"])
+("cith" [""])
+("citi" [""])
+("citj" ["̽"])
+("cits" ["ͨ"])
+("citu" [""])
+("citv" [""])
+("citx" [""])
+("ciu'" ["Ʋ˰"])
+("ciua" ["ɱ"])
+("ciug" [""])
+("ciuh" [""])
+("ciui" ["ʱ" "" "ʷ"])
+("ciuj" [""])
+("ciuu" [""])
+("civf" [""])
+("civh" ["γ"])
+("civi" ["ְ" "" "֮"])
+("civr" ["ש"])
+("ciw'" "ĴŴƴǴȴɴ")
+("ciwh" [""])
+("ciwl" [""])
+("ciwz" ["β" ""])
+("cix'" ["᯴"])
+("cixd" ["" ""])
+("cixi" [""])
+("cixn" ["о" ""])
+("cixq" [""])
+("cixr" ["ѡ"])
+("cixs" [""])
+("cixu" ["" ""])
+("cixy" ["" "" ""])
+("ciyb" [""])
+("ciyi" [""])
+("ciyj" [""])
+("ciyk" ["Ҫ"])
+("ciyu" ["" "" ""])
+("cizi" [""])
+("cizu" [""])
+("cj'" ["μ"])
+("cjan" ["Ұ"])
+("cjb'" ["Ļ"])
+("cjbk" ["б"])
+("cjbl" ["Ұ" "Ұ"])
+("cjbu" ["в"])
+("cjby" ["б"])
+("cjcp" ["д"])
+("cjdb" ["϶"])
+("cjdj" ["ҵ"])
+("cje'" "")
+("cjee" ["϶"])
+("cjeg" [""])
+("cjfz" ["з"])
+("cjg'" ["ּӹ"])
+("cjgr" ["ι"])
+("cjhe" [""])
+("cjhl" ["к" "к"])
+("cjjc" ["ҽ"])
+("cjji" ["м"])
+("cjjm" ["μ" "ϼ"])
+("cjjp" ["ξ"])
+("cjju" [";" "о"])
+("cjjw" ["μ" ""])
+("cjkj" ["ο"])
+("cjkk" ["ο"])
+("cjku" ["п"])
+("cjkv" [""])
+("cjld" [""])
+("cjlj" [""])
+("cjlq" [""])
+("cjlr" [""])
+("cjmb" ["ı"])
+("cjp'" ["ٽ"])
+("cjpo" [""])
+("cjq'" "Ͳ")
+("cjqt" ["ȱ"])
+("cjr'" "ҲӲ")
+("cjrf" [""])
+("cjs'" ["н"])
+("cjsh" ["ɣ"])
+("cjsi" ["˿" ""])
+("cjtm" [""])
+("cjts" ["ʹ"])
+("cjty" [""])
+("cjua" ["ɱ" "ɱ"])
+("cjui" ["" "ʳ"])
+("cjuu" [""])
+("cjvd" ["״"])
+("cjvg" [""])
+("cjvj" ["ս"])
+("cjvk" [""])
+("cjvo" [""])
+("cjvs" [""])
+("cjw'" "ϲв")
+("cjxq" ["μȦ"])
+("cjyi" [""])
+("cjys" ["Ӽ"])
+("cjyt" [""])
+("cjyu" ["" "Ԥ" ""])
+("cjza" [""])
+("cjzj" [""])
+("cjzk" [""])
+("cjzo" [""])
+("ckan" ["ݰ"])
+("ckbf" ["ݱ"])
+("ckbk" ["ݰ"])
+("ckcj" ["ܲ"])
+("ckck" ["ܲ" "ݲ"])
+("ckcs" ["ݴ"])
+("ckdi" ["ݵ"])
+("ckdm" ["ݵ"])
+("cke'" "")
+("ckff" ["ɿ󷽷"])
+("ckfh" ["ݷ"])
+("ckgh" ["۸"])
+("ckgk" ["ݸ"])
+("ckgy" ["ɿҵ"])
+("ckid" ["ݴ"])
+("ckih" ["ٳ" "ݳ"])
+("ckii" ["ٳ"])
+("ckis" ["ݳ"])
+("cklc" [""])
+("cklk" [""])
+("cklm" [""])
+("cklv" [""])
+("ckmh" ["ç"])
+("ckmi" [""])
+("ckmk" ["ñ"])
+("ckmu" ["ľ"])
+("ckmz" ["ݮ"])
+("ckni" [""])
+("ckpg" [""])
+("ckpi" ["ا" "Ƥ"])
+("ckpy" ["ƺ"])
+("ckq'" ["" "" "ɿ"])
+("ckqm" ["ǩ"])
+("cksr" [""])
+("ckth" [""])
+("cktu" ["ͼ"])
+("cku'" ["ο"])
+("ckud" ["ˬ"])
+("ckug" [""])
+("ckuu" [""])
+("ckuy" [""])
+("ckvi" ["ֽ"])
+("ckw'" "۲")
+("ckwz" ["κ"])
+("ckxi" ["ϯ"])
+("ckxn" [""])
+("ckxx" ["Ь" "οϢ"])
+("ckye" ["Ҷ"])
+("ckyk" ["ҩ"])
+("ckyp" [""])
+("ckyr" ["ԭ"])
+("ckyt" ["Լ"])
+("ckyu" ["خ" ""])
+("ckza" [""])
+("ckzi" [""])
+("ckzl" ["ο"])
+("ckzo" [""])
+("ckzs" [""])
+("clba" ["Ű"])
+("clbj" ["ɰ"])
+("clbk" ["Ʊ"])
+("clce" ["²"])
+("cldb" ["˶"])
+("cldc" ["õ"])
+("cldi" ["˵"])
+("cldj" ["˵"])
+("cldk" ["˵"])
+("cldl" ["ʴ"])
+("cldm" ["ʵ"])
+("cldy" ["ö"])
+("cle'" "ǲȲɲ")
+("clfa" ["Ʒ" "ɷ"])
+("clff" ["ŷ"])
+("clfg" ["÷"])
+("clfh" ["ɷ"])
+("clfu" ["Ƹ"])
+("clgb" ["ɹ"])
+("clgd" ["ɹ"])
+("clgj" ["Ÿ"])
+("clho" ["ƻ"])
+("clhs" ["ʺ"])
+("clhv" ["ʻ"])
+("clhw" ["Ż" "˻"])
+("cli'" ["ĳ"])
+("clie" ["ó"])
+("clig" ["ó"])
+("clih" ["˳"])
+("clij" ["Ʋ"])
+("clj'" [""])
+("cljd" ["Ž"])
+("clji" ["¼" "ɼ"])
+("cljm" ["ü" "ü"])
+("cljp" ["þ"])
+("cljt" ["þ" "ɾ"])
+("clju" ["ž"])
+("cljy" ["ƾ"])
+("clkd" ["ɿ"])
+("clke" ["ſ"])
+("clkl" ["ÿ"])
+("clkv" ["ƻ"])
+("cllc" [""])
+("clli" ["" ""])
+("clmi" [""])
+("clmk" ["ó"])
+("clml" [""])
+("clna" [""])
+("clng" [""])
+("clnr" ["ů"])
+("clpj" [""])
+("clpu" [""])
+("clq'" "")
+("clqi" [""])
+("clqr" ["Ȩ"])
+("clqu" ["ȡ"])
+("clr'" "ɲ˲")
+("cls'" [""])
+("clse" ["ɫ"])
+("clt'" [""])
+("cltk" [""])
+("cltl" ["̦"])
+("cltr" [""])
+("cluf" [""])
+("clui" ["" ""])
+("cluu" [""])
+("cluv" ["˰"])
+("clvg" [""])
+("clvi" ["" ""])
+("clvl" ["ժ"])
+("clvs" [""])
+("clvu" ["" ""])
+("clw'" "òĲŲ")
+("clwh" ["Ի"])
+("clwu" ["" ""])
+("clx'" [""])
+("clxd" [""])
+("clxm" [""])
+("clxw" ["ϼ"])
+("clxy" [""])
+("cly'" [""])
+("clyb" ["" "" ""])
+("clyh" [""])
+("clyi" [""])
+("clyk" [""])
+("clyp" [""])
+("clyr" ["Դ" "԰"])
+("clys" [""])
+("clzi" ["" "" ""])
+("cmcv" [""])
+("cmg'" ["ë"])
+("cmh'" ["ľ"])
+("cmv'" ["ı"])
+("cmy'" ["ë"])
+("cn'" [""])
+("cncy" ["Ѵ"])
+("coan" [""])
+("cobj" [""])
+("cobl" [""])
+("coci" [""])
+("codk" ["ﱵ"])
+("coe'" "")
+("cogo" [""])
+("cohe" [""])
+("cohw" [""])
+("coiu" [""])
+("cojt" [""])
+("cokl" [""])
+("colc" [""])
+("colo" [""])
+("colr" [""])
+("coq'" "")
+("cor'" "")
+("couh" ["" ""])
+("coui" ["ʩ"])
+("cove" [""])
+("covi" [""])
+("cow'" "")
+("cowu" [""])
+("cowz" ["λ"])
+("coza" [""])
+("cozi" [""])
+("cozs" [""])
+("cpbu" ["粽"])
+("cpdh" ["浵"])
+("cpe'" "")
+("cpfh" [""])
+("cpgf" [""])
+("cpho" [""])
+("cphu" ["滧"])
+("cpih" ["糤"])
+("cpiu" ["洢"])
+("cpkr" [""])
+("cplj" [""])
+("cplo" [""])
+("cpmn" [""])
+("cppj" [""])
+("cpq'" "")
+("cpqu" ["ȡ"])
+("cpr'" "")
+("cpru" [""])
+("cptu" [""])
+("cpvd" ["ׯ"])
+("cpve" [""])
+("cpvf" [""])
+("cpvh" ["峤"])
+("cpvu" [""])
+("cpw'" "")
+("cpwh" [""])
+("cpxn" [""])
+("cpy'" ["Ա"])
+("cpzi" [""])
+("cpzl" [""])
+("cqbf" ["˷"])
+("crbp" ["ݲ"])
+("crdo" ["۶"])
+("crfj" ["ܷ"])
+("crgl" ["۸"])
+("crq'" "ߥ")
+("crr'" "۴")
+("crru" [""])
+("crw'" "")
+("crwz" ["λ"])
+("csbl" ["а"])
+("csbu" ["Ӳ"])
+("csci" ["Ӵ"])
+("cscs" ["Ҵ"])
+("cscu" ["Ҵ"])
+("cscv" ["д"])
+("csda" ["Ӵ"])
+("csds" ["Ӷ"])
+("csdu" ["ɫ"])
+("cser" ["Ӷ"])
+("csfg" ["ӷ"])
+("csfj" ["ӷ"])
+("csfu" ["Ӹ"])
+("cshw" ["л"])
+("csjd" ["н"])
+("csjm" ["Ӽ"])
+("csjn" ["ӽ"])
+("csjp" ["Ӿ"])
+("cskj" ["Կ"])
+("cskr" ["ӿ"])
+("csl'" [""])
+("csll" [""])
+("csln" [""])
+("cslp" [""])
+("cslt" [""])
+("cslu" [""])
+("csmh" ["æ"])
+("csmu" ["ĸ"])
+("csmy" [""])
+("csp'" ["ɫƬ"])
+("csq'" "ϴдѴҴ")
+("csqm" ["ǰ"])
+("csrs" [""])
+("cssu" [""])
+("cstb" ["ͷ" "ͷ"])
+("cstj" ["̸"])
+("csug" [""])
+("csui" [""])
+("csuu" ["" ""])
+("csve" [""])
+("csvg" [""])
+("csvs" [""])
+("csw'" "Ӵ")
+("cswz" ["δ"])
+("csxc" ["С"])
+("csxm" [""])
+("csxn" [""])
+("csye" ["ҵ"])
+("csyj" [""])
+("csyy" ["ӱ"])
+("cszi" [""])
+("ctk'" [""])
+("ctl'" ["ͨ"])
+("ctm'" ["ͨ"])
+("cu'" ["ʱ"])
+("cubf" ["ֱ"])
+("cubj" ["ֲ"])
+("cubk" ["ֱ"])
+("cubu" ["ֲ"])
+("cuck" ["ֲ"])
+("cucu" ["ִ"])
+("cuda" ["ִ"])
+("cufh" ["ַ" "ַ"])
+("cugd" [""])
+("cugx" ["ϵ"])
+("cui'" [""])
+("cuig" ["ٳ"])
+("cujn" ["ٽ"])
+("cul'" [""])
+("culd" [""])
+("cult" [""])
+("culu" ["³"])
+("culx" [""])
+("cumk" ["ë"])
+("cuq'" "")
+("cuqm" ["ǳ"])
+("cur'" "״ش")
+("cusr" [""])
+("cuua" ["ɴ"])
+("cuui" ["ʹ"])
+("cuvd" ["׳"])
+("cuvi" ["֦"])
+("cuvs" [""])
+("cuw'" "")
+("cux'" ["ѧ"])
+("cuxi" ["ϸ"])
+("cuxn" [""])
+("cuxr" ["ѡ"])
+("cuy'" [""])
+("cuye" ["Ұ"])
+("cuys" ["ӵ"])
+("cvb'" [""])
+("cvcj" ["ݲ"])
+("cvcu" ["ߴ"])
+("cvdy" ["֦Ҷ"])
+("cve'" "")
+("cvf'" ["֬"])
+("cvfz" ["߷"])
+("cvgj" ["֮"])
+("cvho" [""])
+("cvhv" ["ݻ"])
+("cvhw" ["߻"])
+("cvij" ["߲"])
+("cvlv" [""])
+("cvlz" [""])
+("cvmm" [""])
+("cvnd" [""])
+("cvp'" ["Ʒ"])
+("cvq'" ["" "" "" "˥" "" "" "Ȩ" ""])
+("cvqu" ["ȡ"])
+("cvr'" "")
+("cvro" [""])
+("cvvu" [""])
+("cvw'" [""])
+("cvwj" ["Σ"])
+("cvxy" [""])
+("cvya" ["ѿ"])
+("cvzj" ["ʽ"])
+("cw'" [""])
+("cwj'" ["ļ"])
+("cwyg" ["δй"])
+("cxc'" ["Դ"])
+("cxcl" ["Բ"])
+("cxdy" ["Ĵ"])
+("cxq'" ["ѩ"])
+("cxtx" [""])
+("cxw'" ["ά"])
+("cxxs" ["ټ"])
+("cxy'" ["ЧӦ"])
+("cxyv" [""])
+("cy'" [""])
+("cyb'" ["ѹ"])
+("cyd'" ["Դ"])
+("cyg'" ["ѹ"])
+("cymd" ["Ҫì"])
+("cyp'" ["Ԫ"])
+("cyv'" [""])
+("cyy'" ["Ա" "Ժ"])
+("cz'" [""])
+("czfz" ["۸"])
+("czgi" [""])
+("czt'" ["̨" "̨"])
+("czx'" [""])
+("czxt" ["ϵͳ"])
+("czy'" ["Ա"])
+("d" "")
+("daan" [""])
+("daba" ["" ""])
+("dabh" [""])
+("dabi" ["" ""])
+("dabj" ["" ""])
+("dabk" [""])
+("dabl" ["" ""])
+("dabm" ["" ""])
+("dabo" [""])
+("dabu" ["" ""])
+("daby" ["" ""])
+("dacl" [""])
+("daco" [""])
+("dacs" [""])
+("dada" ["" ""])
+("dadb" ["" ""])
+("dadc" ["" ""])
+("dade" [""])
+("dadg" [""])
+("dadi" ["" "" ""])
+("dadj" ["ﵩ" ""])
+("dadk" ["ﵽ" "" "" ""])
+("dadm" ["" "" ""])
+("dado" [""])
+("dadr" [""])
+("dads" [""])
+("dadu" [""])
+("dadv" [""])
+("dady" [""])
+("dae'" "")
+("daee" [""])
+("daer" [""])
+("dafa" ["" ""])
+("daff" [""])
+("dafg" [""])
+("dafh" [""])
+("dafj" ["" ""])
+("dafu" [""])
+("dagd" [""])
+("dage" [""])
+("dagg" [""])
+("dagh" ["" ""])
+("dagj" [""])
+("dagl" [""])
+("dago" ["" ""])
+("dagp" [""])
+("dagr" ["" ""])
+("dags" ["" ""])
+("dagu" ["" ""])
+("dagv" [""])
+("dagw" [""])
+("dahb" [""])
+("dahd" [""])
+("dahe" [""])
+("dahj" [""])
+("dahk" ["" ""])
+("dahl" [""])
+("daho" ["" ""])
+("dahr" [""])
+("dahs" [""])
+("dahu" ["" ""])
+("dahv" [""])
+("dahw" ["" "" ""])
+("dahy" [""])
+("daia" [""])
+("daie" ["" ""])
+("daif" [""])
+("daig" ["" ""])
+("daih" ["" ""])
+("daip" [""])
+("dair" [""])
+("dajc" ["" ""])
+("dajd" ["" "" "" ""])
+("daji" ["" ""])
+("dajm" [""])
+("dajn" ["" ""])
+("dajp" [""])
+("dajq" [""])
+("dajr" [""])
+("daju" ["" ""])
+("dajw" ["" ""])
+("dajx" ["" "" "" ""])
+("dajy" [""])
+("daka" ["￨"])
+("dakl" [""])
+("daku" [""])
+("dakw" [""])
+("daky" [""])
+("dala" ["" ""])
+("dalb" ["¥"])
+("dalc" [""])
+("dald" ["" ""])
+("dali" ["" "" ""])
+("dalk" [""])
+("dall" [""])
+("dalm" [""])
+("daln" [""])
+("dalo" [""])
+("dalq" [""])
+("dalr" [""])
+("dalt" [""])
+("dalu" ["·" "½"])
+("dalx" [""])
+("dalz" [""])
+("dama" ["" ""])
+("damc" [""])
+("damf" [""])
+("damh" ["æ"])
+("dami" [""])
+("damk" ["ë"])
+("daml" [""])
+("damm" [""])
+("damo" ["ĥ" "Į"])
+("damy" [""])
+("dand" [""])
+("dani" [""])
+("danj" [""])
+("dank" [""])
+("danm" [""])
+("dapi" [""])
+("dapk" ["" ""])
+("dapo" [""])
+("dapy" ["ƽ"])
+("dapz" [""])
+("daq'" "")
+("daqc" [""])
+("daqd" ["ǹ"])
+("daqi" [""])
+("daqm" ["Ǯ"])
+("daqn" [""])
+("daqq" [""])
+("daqr" ["Ȩ"])
+("daqu" ["Ȥ" ""])
+("daqy" [""])
+("dar'" "")
+("darf" ["" ""])
+("dark" [""])
+("daru" ["" ""])
+("dasi" ["" ""])
+("dasj" ["ɢ" ""])
+("dask" ["ɨ" "ɩ"])
+("dasr" ["" ""])
+("dasv" [""])
+("dat'" "")
+("datb" ["ͷ" "ͷ"])
+("dath" [""])
+("dati" [""])
+("datm" [""])
+("dats" ["ͨ" "ͬ"])
+("datu" [""])
+("datv" ["" ""])
+("datx" [""])
+("daty" ["" ""])
+("daua" [""])
+("daub" [""])
+("daue" [""])
+("daug" [""])
+("daui" ["ʦ" "ʹ" "" ""])
+("dauj" ["ڨ"])
+("daup" ["˳"])
+("dauu" ["" ""])
+("dauv" ["ˮ"])
+("davb" [""])
+("davd" ["׮"])
+("davf" [""])
+("davh" [""])
+("davi" ["־" "" ""])
+("davj" ["ս"])
+("davk" ["ھ"])
+("davl" ["կ"])
+("davr" ["ת"])
+("davs" ["" ""])
+("davu" [""])
+("daw'" "")
+("dawh" [""])
+("dawu" [""])
+("dawz" ["ξ" ""])
+("daxc" ["" "С" "У"])
+("daxd" ["" ""])
+("daxi" ["ϲ" "Ϸ"])
+("daxm" [""])
+("daxn" [""])
+("daxq" [""])
+("daxr" ["ѡ"])
+("daxs" [""])
+("daxt" ["ѧ" "ѩ"])
+("daxw" ["" ""])
+("daxx" ["л" "д"])
+("daxy" ["" ""])
+("daya" [""])
+("dayb" ["" ""])
+("daye" ["ү" "ұ" "ҵ"])
+("dayh" [""])
+("dayi" ["" "һ" "" ""])
+("dayj" ["" "" ""])
+("dayk" ["Ҫ"])
+("dayn" ["" "ӡ" "ӡ"])
+("dayr" ["Ա" "Բ" "Ժ"])
+("days" [""])
+("dayt" ["Լ" ""])
+("dayu" ["" ""])
+("dayy" ["Ӧ"])
+("daza" [""])
+("dazi" [""])
+("dazo" [""])
+("dazs" [""])
+("dazu" [""])
+("db'" [""])
+("dbb'" ["󱿲"])
+("dbba" [""])
+("dbbj" [""])
+("dbbu" [""])
+("dbby" [""])
+("dbbz" [""])
+("dbc'" ["ײ"])
+("dbd'" [""])
+("dbdb" ["" ""])
+("dbde" [""])
+("dbdh" [""])
+("dbdk" [""])
+("dbdm" [""])
+("dbds" [""])
+("dbdv" [""])
+("dbdy" [""])
+("dbe'" "")
+("dbef" ["Ա"])
+("dbes" ["Ա"])
+("dbf'" ["󲿷"])
+("dbfg" [""])
+("dbfu" [""])
+("dbg'" ["򲻹"])
+("dbgh" ["籨Һ"])
+("dbhf" [""])
+("dbhk" [""])
+("dbhv" [""])
+("dbi'" ["촦" "аٳ"])
+("dbiu" ["òʧ"])
+("dbj'" [""])
+("dbjd" ["" ""])
+("dbjx" [""])
+("dbke" [""])
+("dbl'" ["" ""])
+("dbld" ["е"])
+("dbli" ["" ""])
+("dblq" [""])
+("dblx" [""])
+("dblz" [""])
+("dbm'" ["ø"])
+("dbmc" ["" ""])
+("dbmf" [""])
+("dbmz" ["û"])
+("dbpo" [""])
+("dbq'" ["" "" "" "" "Բ"])
+("dbqc" [""])
+("dbqr" ["Ȧ"])
+("dbr'" "")
+("dbrj" ["Ȼ"])
+("dbs'" ["ٰ˹"])
+("dbsb" [""])
+("dbt'" ["" "" "౶"])
+("dbu'" ["" "ɽ"])
+("dbua" ["ɳ"])
+("dbub" [""])
+("dbui" [""])
+("dbul" ["ȱ"])
+("dbv'" ["" "Բס"])
+("dbva" [""])
+("dbvg" [""])
+("dbvi" ["־" ""])
+("dbw'" [""])
+("dbx'" ["" ""])
+("dbxd" [""])
+("dbxj" ["̱"])
+("dby'" ["Ӫ"])
+("dbyb" ["" ""])
+("dbyi" [""])
+("dbyk" ["Ҫ"])
+("dbys" [""])
+("dbyu" [""])
+("dbyy" ["Ӧ"])
+("dbzi" [""])
+("dbzl" [""])
+("dc'" ["Դ"])
+("dcb'" ["Ų"])
+("dcbi" [""])
+("dcbk" ["ﱤ" ""])
+("dcbo" [""])
+("dcby" [""])
+("dcds" [""])
+("dcdu" [""])
+("dcdv" [""])
+("dce'" "")
+("dcfu" ["ŷ"])
+("dcgb" [""])
+("dcgj" [""])
+("dcgy" ["ŸӦ"])
+("dchk" [""])
+("dchr" ["" "" ""])
+("dchv" [""])
+("dci'" ["ų"])
+("dcia" [""])
+("dcie" ["" ""])
+("dciu" [""])
+("dcji" ["" "ټ"])
+("dcjw" [""])
+("dcke" [""])
+("dcli" [""])
+("dcnj" [""])
+("dcpi" ["Ƥ"])
+("dcpj" [""])
+("dcq'" "")
+("dcqc" [""])
+("dcqm" ["ǲ"])
+("dcr'" "")
+("dcrf" [""])
+("dcru" [""])
+("dcsi" [""])
+("dcso" [""])
+("dcsu" [""])
+("dct'" [""])
+("dctb" ["ͷ"])
+("dcts" ["Ͱ"])
+("dcui" ["ʽ"])
+("dcv'" [""])
+("dcvd" [""])
+("dcve" [""])
+("dcvi" [""])
+("dcvo" [""])
+("dcvr" ["ת"])
+("dcwv" ["Ϊֹ"])
+("dcx'" ["ѧ"])
+("dcxc" [""])
+("dcxd" [""])
+("dcxw" [""])
+("dcxx" ["л"])
+("dcxy" [""])
+("dcy'" ["ԭ"])
+("dcyn" [""])
+("dcyp" [""])
+("dcys" [""])
+("dcyu" [""])
+("dczi" [""])
+("dd'" ["ﵽ"])
+("ddb'" [""])
+("ddbx" ["ੲ"])
+("dddd" ["صص"])
+("dddz" [""])
+("ddg'" ["¸" "ζ"])
+("ddgf" ["¹淶"])
+("ddh'" ["ɺ" "" "绰"])
+("ddhb" ["ߵڰ"])
+("ddiu" [""])
+("ddj'" ["綯" "Զ"])
+("ddkf" [""])
+("ddl'" [""])
+("ddm'" [""])
+("ddp'" [""])
+("ddq'" ["Ե"])
+("ddt'" ["ε"])
+("ddu'" ["" "綯"])
+("dduf" ["ߵǷ"])
+("ddvx" ["ѧ"])
+("ddw'" [""])
+("ddwb" ["شﲩ"])
+("ddxx" ["϶"])
+("ddy'" ["˵ѹ" "̴"])
+("ddz'" [""])
+("dean" ["ð"])
+("deby" ["ò"])
+("dec'" ["ڶ"])
+("decv" ["ڶս"])
+("dedh" ["õ"])
+("dedk" ["õ"])
+("defa" ["÷"])
+("deff" ["÷"])
+("degj" ["ڶ"])
+("dego" ["¹"])
+("dehj" ["º"])
+("dehw" ["Ļ"])
+("deig" ["ó"])
+("deiu" ["ó"])
+("dejd" ["ý"])
+("dejq" ["þ"])
+("delc" [""])
+("deli" [""])
+("dem'" ["ڶ"])
+("deqi" [""])
+("der'" "")
+("dese" ["ɫ"])
+("det'" "ĵصõ")
+("deti" [""])
+("deu'" ["ڶ"])
+("deub" [""])
+("deug" ["ʤ"])
+("deui" ["ʧ" ""])
+("deuj" ["ڶ"])
+("deuu" [""])
+("devb" [""])
+("devi" ["֪" "־"])
+("dew'" ["" "" "" ""])
+("dewf" [""])
+("dex'" ["ڶ"])
+("dexi" ["Ϥ"])
+("dexy" ["" ""])
+("dey'" ["ԩ"])
+("deyd" ["ڶٶ"])
+("deyi" ["" "" ""])
+("deys" [""])
+("deyu" ["" ""])
+("dezi" [""])
+("dezv" [""])
+("df'" ["ط"])
+("dfb'" ["ط"])
+("dfbd" ["ط"])
+("dfd'" [""])
+("dfdl" [""])
+("dffq" ["طȨ"])
+("dfg'" ["󷨹"])
+("dfgy" ["طҵ" "طӪ"])
+("dfh'" [""])
+("dfj'" ["ط"])
+("dfm'" ["" "෽"])
+("dfp'" ["Ƥ"])
+("dfr'" [""])
+("dfu'" ["" "ط˰" ""])
+("dfvf" ["ط"])
+("dfwv" ["طװ"])
+("dfx'" ["" "طϷ"])
+("dfz'" [""])
+("dfzj" ["Ƿ켫"])
+("dfzv" ["ط"])
+("dgan" ["ǰ"])
+("dgb'" ["󹫱"])
+("dgbc" ["Ʊ"])
+("dgbk" ["Ǳ"])
+("dgbm" ["ȱ"])
+("dgdg" ["ȵ"])
+("dgdk" ["ȵ"])
+("dgdl" ["ȴ"])
+("dge'" ["" "" ""])
+("dgf'" [""])
+("dgff" ["ȷ" "ȷ"])
+("dggd" ["ƹ"])
+("dggi" ["󹦸"])
+("dggk" ["Ǹ" "ȸ"])
+("dgh'" ["ɻ"])
+("dghb" ["Ⱥ"])
+("dghk" ["Ⱥ"])
+("dgho" ["ƻ"])
+("dghz" ["ƺ"])
+("dgi'" ["̴"])
+("dgia" ["Ȳ"])
+("dgih" ["ǳ"])
+("dgjc" ["Ƚ"])
+("dgjd" ["Ƚ"])
+("dgji" ["Ǽ" "Ǽ" "ȼ"])
+("dgju" ["ƾ" "Ⱦ"])
+("dgjw" ["ȼ"])
+("dgl'" ["" "" "繦"])
+("dgld" [""])
+("dgls" [""])
+("dglu" ["½"])
+("dgm'" ["" "ģ"])
+("dgmf" [""])
+("dgml" ["ģɵ·"])
+("dgn'" ["" "Ů" "๦"])
+("dgpk" [""])
+("dgpn" ["Ʒ"])
+("dgq'" ["" "" "" "" "" "ع"])
+("dgqg" ["ùҹ"])
+("dgr'" "εŵɵʵ")
+("dgrf" [""])
+("dgri" [""])
+("dgs'" ["˾"])
+("dgsi" ["˿"])
+("dgta" [""])
+("dgtl" ["̨"])
+("dgts" ["ͬ"])
+("dguh" [""])
+("dgui" ["ʽ"])
+("dguj" ["ɽ"])
+("dgve" [""])
+("dgvk" [""])
+("dgvy" ["۹"])
+("dgvz" ["۹"])
+("dgwf" [""])
+("dgwl" [""])
+("dgwm" ["Ļ"])
+("dgws" ["˽"])
+("dgx'" ["ȸ"])
+("dgxc" ["Ч"])
+("dgxm" [""])
+("dgyb" [""])
+("dgyj" [""])
+("dgyk" [""])
+("dgyu" [""])
+("dgyy" ["Ӱ"])
+("dgz'" ["" ""])
+("dgzi" [""])
+("dgzl" [""])
+("dh'" [""])
+("dhan" [""])
+("dhbj" [""])
+("dhbk" [""])
+("dhby" [""])
+("dhci" [""])
+("dhde" [""])
+("dhdh" ["" ""])
+("dhdi" [""])
+("dhdj" ["󺰴"])
+("dhdk" [""])
+("dhdl" [""])
+("dhe'" ["" "" "" ""])
+("dher" [""])
+("dhf'" [""])
+("dhfg" ["" ""])
+("dhfu" [""])
+("dhfz" [""])
+("dhg'" [""])
+("dhgh" [""])
+("dhgo" [""])
+("dhgr" [""])
+("dhh'" [""])
+("dhhm" ["绰"])
+("dhhy" ["绰"])
+("dhi'" ["ϳ"])
+("dhie" [""])
+("dhig" [""])
+("dhih" [""])
+("dhil" [""])
+("dhiu" [""])
+("dhj'" ["⻯"])
+("dhjg" ["ͺϽ"])
+("dhji" ["" "" ""])
+("dhjn" [""])
+("dhju" [""])
+("dhjw" [""])
+("dhjy" ["绯"])
+("dhke" [""])
+("dhks" [""])
+("dhl'" ["º" "" ""])
+("dhld" [""])
+("dhlu" ["·"])
+("dhly" [""])
+("dhmm" [""])
+("dhnm" [""])
+("dhnz" [""])
+("dhpl" [""])
+("dhpu" [""])
+("dhpy" ["ƽ"])
+("dhq'" "")
+("dhqm" ["ǰ"])
+("dhqr" ["Ȩ"])
+("dhr'" "")
+("dhrf" [""])
+("dhri" [""])
+("dhrj" ["Ȼ"])
+("dhs'" [""])
+("dhtb" ["ͷ"])
+("dhtm" [""])
+("dhtr" [""])
+("dhui" ["ʱ" "" "" "ʷ"])
+("dhvf" [""])
+("dhvg" ["" ""])
+("dhvh" [""])
+("dhvs" ["" ""])
+("dhvu" ["ס"])
+("dhwj" [""])
+("dhwl" [""])
+("dhwu" [""])
+("dhwz" ["ί"])
+("dhx'" ["绯ѧ"])
+("dhxc" ["У"])
+("dhxm" [""])
+("dhxn" [""])
+("dhxr" ["ѡ"])
+("dhxw" [""])
+("dhxy" [""])
+("dhy'" ["" "⻯"])
+("dhyh" [""])
+("dhyr" ["Ա"])
+("dhyt" [""])
+("dhyu" [""])
+("dhzl" [""])
+("dhzo" ["" ""])
+("dhzu" [""])
+("diai" ["Ͱ"])
+("dian" ["̰"])
+("diba" ["̰" "ڰ"])
+("dibc" ["ر"])
+("dibf" ["ױ"])
+("dibj" ["װ" "ذ"])
+("dibk" ["ر" "ر"])
+("dibm" ["ױ"])
+("dibo" ["ز"])
+("dibu" ["ز"])
+("dicg" ["ײ" "ز"])
+("dici" ["ش"])
+("dida" ["ִ"])
+("didg" ["͵"])
+("didh" ["͵" "ֵ"])
+("didi" ["͵" "͵" "ܵ"])
+("didk" ["ص"])
+("didl" ["ش"])
+("didm" ["ص" "ص"])
+("didr" ["ض"])
+("dids" ["ض" "ض"])
+("didv" ["ж"])
+("didy" ["ζ"])
+("die'" "ֵصڮۡ")
+("diee" ["۶"])
+("dier" ["ڶ"])
+("difh" ["̷" "ط"])
+("difz" ["׷"])
+("digj" ["󳦸˾"])
+("digk" ["׸"])
+("digo" ["й" "۹"])
+("digr" ["ι"])
+("digu" ["͹" "ֹ"])
+("digv" ["ݹ"])
+("digw" ["ع"])
+("dihb" ["к"])
+("dihd" ["ۻ"])
+("dihk" ["ͺ"])
+("dihv" ["ڮ"])
+("diif" ["ͳ"])
+("diih" ["ֳ"])
+("diij" ["Ͳ" "ز"])
+("diik" ["ͳ"])
+("diiq" [""])
+("diiu" ["ִ"])
+("diiv" ["ʹ"])
+("dij'" ["糪" "紫"])
+("dijc" ["ؽ" "ݽ"])
+("diji" ["ͼ" "л" "ػ"])
+("dijm" ["ݼ"])
+("dijp" ["о"])
+("dijq" ["ھ"])
+("dijw" ["ؼ"])
+("dijx" ["ؽ" "޽"])
+("dikb" ["п"])
+("dikh" ["ֿ"])
+("diks" ["Ϳ"])
+("diky" ["ؿ"])
+("dila" [""])
+("dili" ["" ""])
+("dilj" [""])
+("dill" [""])
+("dilm" [""])
+("dilo" [""])
+("dilp" [""])
+("dilq" [""])
+("dils" [""])
+("dilx" [""])
+("dilz" [""])
+("dimj" [""])
+("dimk" ["ò"])
+("dimm" [""])
+("dimo" ["Ĥ"])
+("dimu" ["Ķ"])
+("dimy" [""])
+("dimz" [""])
+("ding" [""])
+("dipi" ["Ƥ" "Ʀ"])
+("dipj" ["" ""])
+("dipm" ["Ƭ"])
+("dipn" ["Ƶ"])
+("dipy" ["ƽ"])
+("diq'" ["" "" "" "" "ص" "" "" "" ""])
+("diqc" ["ؿ"])
+("diqi" [""])
+("diqn" [""])
+("diqq" [""])
+("diqt" ["ȷ"])
+("diqu" [""])
+("diqy" [""])
+("dir'" "ĵصٵڵ۵ܵݵ")
+("dire" [""])
+("dirf" [""])
+("dise" ["ɫ"])
+("disi" [""])
+("disj" [""])
+("diss" [""])
+("disu" [""])
+("ditb" ["ͷ" "ͷ"])
+("dite" [""])
+("ditj" ["̳" "̺"])
+("ditu" ["ͼ"])
+("ditx" [""])
+("dity" [""])
+("diub" [""])
+("diug" [""])
+("diuh" [""])
+("diui" ["" "" "ʮ"])
+("diul" ["Ȳ"])
+("diuu" [""])
+("diuv" ["ˮ"])
+("div'" ["Գ"])
+("divb" [""])
+("divf" [""])
+("divg" [""])
+("divi" ["" "֧" "ַ" ""])
+("divl" ["ծ"])
+("divu" ["" ""])
+("divx" ["Գ"])
+("diw'" "ĵϵеѵҵӵԵݶ")
+("diwa" [""])
+("diwf" ["" ""])
+("diwh" [""])
+("diwo" [""])
+("diwu" ["" ""])
+("diwz" ["΢" "α" "λ"])
+("dix'" [""])
+("dixc" ["" ""])
+("dixi" ["ϵ" "ϸ"])
+("dixm" [""])
+("dixn" [""])
+("dixs" [""])
+("dixt" ["ѧ"])
+("dixw" ["" "" ""])
+("dixy" [""])
+("diy'" ["Ժ"])
+("diya" ["ѹ" "Ѻ"])
+("diyi" ["" "һ"])
+("diyj" ["о"])
+("diyn" [""])
+("diyp" ["һƬ"])
+("diyt" ["Լ"])
+("diyu" ["" "" "" "" ""])
+("diz'" [""])
+("dizg" [""])
+("dizi" ["" ""])
+("dizk" [""])
+("dizo" [""])
+("dizu" [""])
+("dizv" [""])
+("dj'" [""])
+("djbf" [""])
+("djbk" [""])
+("djbl" ["" ""])
+("djbm" [""])
+("djbo" ["" ""])
+("djbu" [""])
+("djc'" [""])
+("djci" [""])
+("djcs" [""])
+("djd'" ["򽻵"])
+("djda" ["" ""])
+("djdc" [""])
+("djdh" [""])
+("djdj" ["" ""])
+("djdk" [""])
+("djdp" [""])
+("djdq" [""])
+("djdu" [""])
+("djdv" [""])
+("dje'" "")
+("djfh" [""])
+("djfj" [""])
+("djfu" [""])
+("djfz" [""])
+("djge" [""])
+("djgf" ["͹"])
+("djgh" [""])
+("djgj" ["" ""])
+("djgk" [""])
+("djgr" [""])
+("djh'" ["ƻ"])
+("djhd" [""])
+("djhk" [""])
+("djhl" [""])
+("djhw" ["" ""])
+("djie" [""])
+("djif" [""])
+("djig" [""])
+("djij" [""])
+("djip" [""])
+("djj'" ["󽫾"])
+("djjc" [""])
+("djji" ["" ""])
+("djjm" ["" ""])
+("djju" [""])
+("djjw" ["" ""])
+("djke" ["" ""])
+("djl'" ["Ⱦ"])
+("djld" ["" ""])
+("djlt" [""])
+("djma" [""])
+("djml" [""])
+("djmz" ["û"])
+("djng" [""])
+("djnh" [""])
+("djny" [""])
+("djq'" "")
+("djqi" [""])
+("djqx" [""])
+("djqy" ["" ""])
+("djr'" ["" "" "" "" "" "" "" "" "" "ʯ" "" "" "" "" ""])
+("djrf" ["" ""])
+("djrj" ["Ȼ"])
+("djru" [""])
+("djse" ["ɫ"])
+("djsi" ["˿"])
+("djt'" ["ͥ" ""])
+("djta" [""])
+("djtb" ["ͷ"])
+("djth" [""])
+("djti" [""])
+("djtm" [""])
+("djtu" ["ͽ"])
+("djuf" [""])
+("djug" [""])
+("djui" ["ʶ" ""])
+("djuu" [""])
+("djuv" ["ˮ"])
+("djv'" ["" ""])
+("djvi" ["" "֭"])
+("djw'" ["ȼ"])
+("djwu" [""])
+("djwz" ["λ"])
+("djx'" ["Խ" ""])
+("djxc" ["С"])
+("djxd" ["" "" ""])
+("djxg" ["С"])
+("djxi" ["Ϧ"])
+("djxm" [""])
+("djxn" ["" ""])
+("djxy" [""])
+("djy'" [""])
+("djyb" [""])
+("djyh" [""])
+("djyi" ["һ" ""])
+("djyj" [""])
+("djyk" ["ҩ"])
+("djyr" ["Ԫ" "Ը"])
+("djyu" [""])
+("djyy" ["Ӧ"])
+("djzi" ["" "" "" ""])
+("djzl" [""])
+("djzo" [""])
+("djzv" [""])
+("dkb'" ["ؿ"])
+("dkba" ["" ""])
+("dkbi" [""])
+("dkbj" [""])
+("dkby" [""])
+("dkbz" [""])
+("dkci" [""])
+("dkck" [""])
+("dkda" [""])
+("dkde" [""])
+("dkdi" [""])
+("dkdj" ["" ""])
+("dkdk" ["" "߶߶"])
+("dkdm" [""])
+("dkdy" ["" ""])
+("dke'" ["" "" "" "" "" "" "￦" "ѿ"])
+("dkfa" [""])
+("dkfg" [""])
+("dkfh" [""])
+("dkfj" [""])
+("dkfu" [""])
+("dkfz" [""])
+("dkgd" [""])
+("dkge" [""])
+("dkgk" [""])
+("dkgo" [""])
+("dkgr" ["" ""])
+("dkgu" [""])
+("dkgv" ["" ""])
+("dkhe" ["" "뮺"])
+("dkhh" [""])
+("dkhk" [""])
+("dkhr" [""])
+("dkhu" ["ʡ"])
+("dkhv" ["" ""])
+("dki'" ["ͳ"])
+("dkia" [""])
+("dkie" [""])
+("dkih" [""])
+("dkiu" [""])
+("dkjc" [""])
+("dkjm" [""])
+("dkju" ["" ""])
+("dkjw" ["" "" ""])
+("dkkb" ["" ""])
+("dkl'" ["ֿ"])
+("dklc" [""])
+("dkli" ["" ""])
+("dklk" ["߶"])
+("dkll" [""])
+("dklp" [""])
+("dklq" ["" ""])
+("dklr" [""])
+("dklu" ["·"])
+("dkmf" [""])
+("dkmi" [""])
+("dkml" [""])
+("dkmz" ["ù" ""])
+("dkna" [""])
+("dknm" [""])
+("dkpj" [""])
+("dkpm" ["Ƭ"])
+("dkq'" "߶")
+("dkqd" ["ǹ"])
+("dkqi" [""])
+("dkqm" ["Ǹ"])
+("dkqu" ["ȡ"])
+("dkqx" [""])
+("dkqy" [""])
+("dkr'" "")
+("dkre" [""])
+("dkrf" ["" ""])
+("dksl" [""])
+("dksv" ["" ""])
+("dkta" [""])
+("dktb" ["ͷ"])
+("dktg" [""])
+("dkti" [""])
+("dktl" ["̨"])
+("dktm" [""])
+("dktv" [""])
+("dku'" ["˯"])
+("dkub" [""])
+("dkuh" [""])
+("dkui" ["" "ʦ" "ʿ"])
+("dkuj" ["ɽ"])
+("dkuu" ["" ""])
+("dkve" [""])
+("dkvi" ["" ""])
+("dkvj" ["վ"])
+("dkvr" ["ת"])
+("dkvs" [""])
+("dkw'" "߶")
+("dkx'" ["Կ"])
+("dkxd" [""])
+("dkxi" ["ϲ"])
+("dkxm" [""])
+("dkxr" [""])
+("dkxt" ["ѧ"])
+("dkxu" ["Կ"])
+("dkxw" [""])
+("dkxx" ["л"])
+("dkyb" [""])
+("dkye" ["ү"])
+("dkyh" [""])
+("dkyi" [""])
+("dkyj" ["" ""])
+("dkyr" ["Ա"])
+("dkys" [""])
+("dkyu" [""])
+("dkyy" ["Ӱ"])
+("dkzi" ["" ""])
+("dkzz" [""])
+("dlb'" [""])
+("dlbc" [""])
+("dlbj" [""])
+("dlbu" [""])
+("dlby" [""])
+("dlc'" ["" ""])
+("dlci" [""])
+("dld'" ["׶"])
+("dldd" ["Ͷ"])
+("dldm" [""])
+("dlds" [""])
+("dldv" [""])
+("dle'" "")
+("dlfh" ["" ""])
+("dlfu" [""])
+("dlg'" [""])
+("dlgb" [""])
+("dlgg" [""])
+("dlgh" [""])
+("dlgr" [""])
+("dlgs" [""])
+("dlgy" ["ҵ"])
+("dlgz" [""])
+("dlh'" [""])
+("dlhk" [""])
+("dlhs" [""])
+("dlhv" ["" ""])
+("dlia" [""])
+("dlih" [""])
+("dliu" [""])
+("dlj'" ["½" ""])
+("dljn" [""])
+("dljq" ["̵"])
+("dlju" [""])
+("dljw" [""])
+("dlkr" [""])
+("dll'" [""])
+("dlli" [""])
+("dllk" [""])
+("dlll" [""])
+("dllm" [""])
+("dllu" ["·"])
+("dlly" [""])
+("dlm'" ["³" ""])
+("dlma" [""])
+("dlmj" [""])
+("dlmk" ["ñ"])
+("dlmy" [""])
+("dln'" ["" ""])
+("dlnd" ["Ũ"])
+("dlq'" "߾")
+("dlqd" ["ǿ" "ǿ"])
+("dlr'" ["" "" "" "" "" "" "" "" "" "" "ܤ" "߰" "" "" "" "" "" "" ""])
+("dls'" [""])
+("dlt'" ["" "·ͼ"])
+("dltb" ["ͷ"])
+("dlti" [""])
+("dltu" ["ͽ"])
+("dlty" ["ͳһ"])
+("dlu'" ["ʯ"])
+("dlug" ["ˮ"])
+("dluh" [""])
+("dlui" [""])
+("dluu" [""])
+("dlve" [""])
+("dlvi" ["" ""])
+("dlvu" ["ס"])
+("dlvv" ["װ"])
+("dlw'" [""])
+("dlwg" [""])
+("dlwo" [""])
+("dlwv" ["λ"])
+("dlwz" ["Ϊ"])
+("dlx'" ["ѧ" "" "ѧ" ""])
+("dlxc" [""])
+("dlxd" [""])
+("dlxw" [""])
+("dlxx" ["л"])
+("dlxy" [""])
+("dly'" ["Ժ"])
+("dlyb" [""])
+("dlye" ["ҵ"])
+("dlys" [""])
+("dlyu" ["" ""])
+("dlz'" [""])
+("dlzb" [""])
+("dlzi" ["" ""])
+("dlzt" [""])
+("dlzu" [""])
+("dlzv" [""])
+("dmbc" [""])
+("dmbd" ["沿"])
+("dmbj" [""])
+("dmbk" ["籨"])
+("dmbo" ["" "㲥" "㲦" "粨"])
+("dmbz" ["汳"])
+("dmc'" ["" ""])
+("dmci" [""])
+("dmcl" [""])
+("dmdg" ["" ""])
+("dmdh" ["䵱"])
+("dmdi" [""])
+("dmdk" ["ߵ" "絼"])
+("dmdm" [""])
+("dmds" ["綯"])
+("dmdu" [""])
+("dmdy" ["ģ" "춨"])
+("dme'" "ؼ")
+("dmer" [""])
+("dmfa" ["㷢"])
+("dmff" [""])
+("dmfj" ["䷶"])
+("dmfu" ["߸" "߸" "渶"])
+("dmg'" [""])
+("dmgd" [""])
+("dmgj" [""])
+("dmgk" [""])
+("dmgs" ["繤"])
+("dmgu" [""])
+("dmh'" [""])
+("dmhe" ["" ""])
+("dmhj" ["纸"])
+("dmho" [""])
+("dmhu" ["绡" "軧"])
+("dmhw" ["绰"])
+("dmie" ["糵"])
+("dmih" ["糡"])
+("dmii" [""])
+("dmij" [""])
+("dmiu" [""])
+("dmj'" ["Ļ"])
+("dmjd" ["㽫"])
+("dmjh" [""])
+("dmji" ["伮" "" "缫" "" ""])
+("dmjm" [""])
+("dmjq" [""])
+("dmjw" [""])
+("dmjx" [""])
+("dmk'" ["ſ"])
+("dmke" [""])
+("dmkh" ["翹"])
+("dmld" ["" ""])
+("dmli" ["" "" ""])
+("dmlj" ["" ""])
+("dmlq" [""])
+("dmlu" ["¯" "·"])
+("dmly" [""])
+("dmma" [""])
+("dmmy" [""])
+("dmng" [""])
+("dmnj" [""])
+("dmnk" [""])
+("dmnm" [""])
+("dmns" ["ũ"])
+("dmpm" ["Ƭ"])
+("dmpo" [""])
+("dmpu" [""])
+("dmpy" ["ƽ" "ƿ"])
+("dmq'" ["" "" "" "" "" "ľ"])
+("dmqc" [""])
+("dmqi" ["" ""])
+("dmqr" ["Ȧ"])
+("dmqy" [""])
+("dmr'" "")
+("dmre" [""])
+("dmrj" ["ȼ"])
+("dmrs" [""])
+("dmt'" [""])
+("dmtb" ["ͷ"])
+("dmti" [""])
+("dmtl" ["̨"])
+("dmts" ["Ͳ"])
+("dmu'" ["" "ˮ" ""])
+("dmug" ["ʿ"])
+("dmui" [""])
+("dmuj" [""])
+("dmuu" [""])
+("dmuw" ["ˢ"])
+("dmv'" ["" "Ĵָ" "վ" "ľ"])
+("dmvf" [""])
+("dmvh" [""])
+("dmvj" ["վ"])
+("dmvv" ["׺"])
+("dmw'" [""])
+("dmwd" ["¶"])
+("dmwf" [""])
+("dmwh" [""])
+("dmwu" [""])
+("dmwz" ["λ"])
+("dmx'" ["Ѫ"])
+("dmxm" [""])
+("dmxn" ["" ""])
+("dmxp" ["Ѷ"])
+("dmxt" ["ѧ"])
+("dmxw" [""])
+("dmxy" ["" ""])
+("dmya" ["ѹ"])
+("dmyp" [""])
+("dmyr" ["Ա" "Դ"])
+("dmys" ["Ӿ"])
+("dmyy" ["Ӱ"])
+("dmz'" ["ñ"])
+("dmzi" ["" ""])
+("dmzj" [""])
+("dmzr" [""])
+("dmzu" [""])
+("dnbd" ["治"])
+("dndv" ["ڶ"])
+("dngh" ["ڸ"])
+("dnj'" ["Խ"])
+("dnl'" [""])
+("dnpc" ["Ƥ"])
+("dnu'" [""])
+("dnwl" [""])
+("dny'" [""])
+("dnym" ["ǹ"])
+("dobc" [""])
+("dobi" [""])
+("dobj" [""])
+("dobm" ["" ""])
+("doch" [""])
+("doci" [""])
+("doda" ["" ""])
+("dode" ["" ""])
+("dodk" ["ൽ"])
+("dodm" [""])
+("dodo" [""])
+("dodr" [""])
+("doe'" "")
+("dofa" ["෢"])
+("doff" [""])
+("dofh" ["෽"])
+("doge" ["" ""])
+("dogk" [""])
+("dogw" [""])
+("dohv" [""])
+("doih" ["೤"])
+("doiu" ["ദ"])
+("dojc" [""])
+("dojq" [""])
+("dojw" [""])
+("dokl" ["㿪"])
+("doks" [""])
+("dokv" [""])
+("dola" [""])
+("dolo" [""])
+("dolp" [""])
+("dolu" ["·"])
+("dome" ["ô"])
+("domm" [""])
+("domu" ["Ŀ"])
+("donm" [""])
+("dopy" ["ŷƽԭ"])
+("doq'" "޶")
+("doqi" [""])
+("doqr" ["Ȩ"])
+("doqu" ["ȡ"])
+("doqy" [""])
+("dor'" "")
+("dorb" [""])
+("doru" [""])
+("doso" [""])
+("dosv" [""])
+("dotb" ["ͷ"])
+("doth" [""])
+("dotl" [""])
+("doub" [""])
+("doui" ["ʱ" ""])
+("douj" [""])
+("douk" [""])
+("douu" [""])
+("dovs" [""])
+("dow'" "ȶ")
+("doxd" ["" ""])
+("doxn" [""])
+("doxx" ["л"])
+("doxy" [""])
+("doyh" [""])
+("doyp" [""])
+("doyr" ["Ԫ" "Զ"])
+("doys" [""])
+("doyu" ["" ""])
+("dozj" [""])
+("dozl" [""])
+("dozv" [""])
+("dpbp" ["˲"])
+("dpbu" ["ղ"])
+("dpco" ["ٴ"])
+("dpcu" ["ش"])
+("dpdm" ["׵"])
+("dpe'" "")
+("dpg'" [""])
+("dph'" [""])
+("dphd" ["ػ"])
+("dphe" ["ٺ"])
+("dphk" ["ٺ"])
+("dpig" ["Ƴ"])
+("dpjc" ["۽"])
+("dpl'" [""])
+("dppl" [""])
+("dpq'" "նֶ׶")
+("dpr'" "ٶڶ۶ܶ")
+("dpub" [""])
+("dpui" ["ʱ"])
+("dpwz" ["λ"])
+("dpx'" ["ƽ"])
+("dpxu" ["ƪС˵"])
+("dpxw" [""])
+("dpyl" ["Ƥ"])
+("dpyn" [""])
+("dpz'" [""])
+("dpzu" [""])
+("dq'" ["ǰ"])
+("dqc'" [""])
+("dqdc" [""])
+("dqh'" ["" ""])
+("dqhx" ["ѧ"])
+("dqj'" [""])
+("dql'" ["ȷ"])
+("dqlm" [""])
+("dqp'" ["Ȩ"])
+("dqq'" "")
+("dqqi" [""])
+("dqr'" [""])
+("dqrf" [""])
+("dqt'" ["ǰ"])
+("dqui" ["ʧ"])
+("dqwi" [""])
+("dqwl" [""])
+("dqws" ["о"])
+("dqxw" [""])
+("dqy'" ["ѹ" "ѹ"])
+("dqzi" [""])
+("dr'" ["Ȼ"])
+("dran" ["ϰ"])
+("drbo" ["̲"])
+("drcg" ["ϲ"])
+("drcu" ["̴" "̴"])
+("drdm" ["ϵ" "ϵ"])
+("drdr" ["̶"])
+("drdy" ["϶"])
+("dre'" "")
+("drfa" ["̷"])
+("drfh" ["˷"])
+("drgs" ["̹" "͹"])
+("drhb" [""])
+("dria" ["˲"])
+("drig" ["̳"])
+("drih" ["̳"])
+("drir" ["̴"])
+("driu" ["̴"])
+("driv" ["ʹ"])
+("drjc" ["Ͻ"])
+("drjm" ["̼" "ͼ"])
+("drjt" ["Ͼ"])
+("drjw" ["˽"])
+("drkb" ["˿" "Ͽ"])
+("drkl" ["Ͽ"])
+("drlm" [""])
+("drlo" [""])
+("drlu" ["·" "¯" "·"])
+("drlx" [""])
+("drma" [""])
+("drmm" ["" ""])
+("drmu" ["ģ"])
+("drmy" [""])
+("drnl" [""])
+("drpk" [""])
+("drpm" ["ƪ"])
+("drpy" [""])
+("drq'" ["" ""])
+("drqi" ["" ""])
+("drqt" ["ȱ"])
+("drr'" "Ͷζ϶")
+("drrj" ["Ȼ"])
+("drss" [""])
+("drtb" ["ͷ"])
+("druk" ["" ""])
+("druv" ["ˮ"])
+("drvd" ["ׯ"])
+("drvg" [""])
+("drw'" [""])
+("drwf" [""])
+("drxc" ["С"])
+("drxd" [""])
+("drxm" ["" ""])
+("drya" ["ѹ"])
+("dryh" [""])
+("dryj" [""])
+("dryn" [""])
+("dryu" ["" ""])
+("drzi" [""])
+("drzj" [""])
+("drzk" [""])
+("drzo" [""])
+("dsan" [""])
+("dsbi" [""])
+("dsbm" [""])
+("dsbu" [""])
+("dsby" [""])
+("dsbz" [""])
+("dsci" [""])
+("dsde" ["" ""])
+("dsdh" [""])
+("dsdi" [""])
+("dsdj" [""])
+("dsdk" [""])
+("dsdu" [""])
+("dse'" "")
+("dsfg" [""])
+("dsfh" ["" ""])
+("dsfz" [""])
+("dsg'" ["ɫ"])
+("dsgg" [""])
+("dsgs" ["" ""])
+("dsgw" [""])
+("dshe" [""])
+("dshj" [""])
+("dshl" ["" ""])
+("dshu" [""])
+("dshw" [""])
+("dshy" [""])
+("dsia" [""])
+("dsid" [""])
+("dsig" [""])
+("dsih" [""])
+("dsij" [""])
+("dsiy" ["ҵ"])
+("dsj'" ["" "ļ"])
+("dsjc" [""])
+("dsjd" [""])
+("dsji" ["" ""])
+("dsjn" [""])
+("dsjt" [""])
+("dsjw" [""])
+("dsjx" [""])
+("dsjy" ["" "" ""])
+("dskb" [""])
+("dsld" ["" ""])
+("dsli" [""])
+("dsll" [""])
+("dslq" [""])
+("dslr" [""])
+("dsly" [""])
+("dsm'" ["˾"])
+("dsmf" [""])
+("dsmg" [""])
+("dsml" ["" ""])
+("dsmm" ["" ""])
+("dsng" [""])
+("dsnj" [""])
+("dsou" ["ŷ"])
+("dsp'" [""])
+("dspo" [""])
+("dspx" ["˽"])
+("dspy" ["ƽ"])
+("dsq'" "")
+("dsqy" [""])
+("dsr'" "")
+("dsrf" [""])
+("dssi" ["" ""])
+("dssp" [""])
+("dsti" [""])
+("dstj" [""])
+("dstl" ["̬"])
+("dstm" [""])
+("dstu" [""])
+("dsty" [""])
+("dsu'" ["ʡ"])
+("dsub" [""])
+("dsuf" [""])
+("dsug" [""])
+("dsuh" [""])
+("dsui" ["" ""])
+("dsuj" [""])
+("dsv'" [""])
+("dsvb" [""])
+("dsvd" ["װ"])
+("dsve" [""])
+("dsvh" [""])
+("dsvi" ["֥" ""])
+("dswu" ["" ""])
+("dswz" ["κ"])
+("dsxd" ["" ""])
+("dsxi" [""])
+("dsxm" [""])
+("dsxn" [""])
+("dsxs" [""])
+("dsxt" ["Ѩ"])
+("dsya" [""])
+("dsyh" [""])
+("dsyi" [""])
+("dsyk" ["ҡ"])
+("dsyr" ["Ա"])
+("dsys" [""])
+("dszi" [""])
+("dszo" [""])
+("dszu" [""])
+("dtb'" ["̤"])
+("dtdh" [""])
+("dtfw" ["̬Χ"])
+("dtfy" ["̯"])
+("dtg'" ["̼"])
+("dtl'" ["ͷ"])
+("dtld" [""])
+("dtph" ["̬ƽ"])
+("dttu" [";˵"])
+("dtu'" [""])
+("dtus" ["ͷ˾"])
+("dtv'" ["ͷ" "ͷ"])
+("dtx'" [""])
+("dtxy" ["ͬС"])
+("du'" ["ʱ"])
+("duba" [""])
+("dubj" [""])
+("dubk" [""])
+("dubl" [""])
+("dubo" ["Ĳ"])
+("duc'" ["ٴ"])
+("ducg" ["Ʋ"])
+("duck" [""])
+("ducl" [""])
+("ducu" [""])
+("duda" [""])
+("dudk" [""])
+("dudr" [""])
+("dudu" ["" "" ""])
+("due'" "¶öĶ")
+("duer" [""])
+("dufi" [""])
+("dufu" ["" "Ÿ"])
+("dug'" ["ʹ"])
+("dugb" ["ӹ㲥"])
+("duge" ["Ƹ"])
+("dugo" ["ȹ" "ɹ"])
+("duh'" ["" "ʱ" "»"])
+("duhb" [""])
+("duhe" ["ɺ"])
+("duhl" [""])
+("duhu" [""])
+("duhv" [""])
+("duhw" [""])
+("duia" [""])
+("duid" [""])
+("duig" [""])
+("duih" [""])
+("duir" ["ɴ"])
+("duis" [""])
+("duiu" [""])
+("duj'" ["ʹ" "" "ӻ"])
+("dujd" ["ɽ"])
+("duji" ["" "ʼ"])
+("dujj" ["ӽջ"])
+("dujn" ["ƽ"])
+("dujp" ["" ""])
+("dujr" ["ž"])
+("dujt" ["ž"])
+("duju" [""])
+("dujw" [""])
+("dujx" ["½"])
+("dujy" [""])
+("dukb" ["ɿ"])
+("dula" [""])
+("duld" [""])
+("duli" [""])
+("dulj" [""])
+("dulp" [""])
+("dulq" [""])
+("dum'" [""])
+("dun'" [""])
+("dunh" [""])
+("dunq" ["ţ"])
+("dupd" ["Ƶ"])
+("dupi" ["Ƥ"])
+("dupj" [""])
+("dupn" ["Ʒ"])
+("duq'" "")
+("duqi" ["" ""])
+("duqu" ["ȡ"])
+("dur'" ["" "" "" "" "" "" "ܶ" "" "" ""])
+("duri" [""])
+("duse" [""])
+("dusi" [""])
+("dusq" [""])
+("dusu" [""])
+("dusw" ["ʧ"])
+("dut'" ["̨" ""])
+("dute" [""])
+("duti" [""])
+("duts" ["ͳ" "ͭ"])
+("dutu" ["ͼ"])
+("duu'" ["ʽ" ""])
+("duua" ["ɱ"])
+("duub" [""])
+("duue" [""])
+("duuf" [""])
+("duug" [""])
+("duui" [""])
+("duuu" ["" "" ""])
+("duv'" ["ʤ"])
+("duvb" [""])
+("duve" [""])
+("duvj" ["ս" "ռ"])
+("duvr" ["׫"])
+("duvu" ["ס" "ע"])
+("duw'" "")
+("duwu" ["" ""])
+("duwz" ["ξ"])
+("dux'" [""])
+("duxn" ["п"])
+("duxy" [""])
+("duy'" ["ү" "ˮ"])
+("duyk" ["ҩ"])
+("duyn" ["" ""])
+("duyq" ["ȥ"])
+("duz'" [""])
+("duzb" [""])
+("duzf" ["Ů"])
+("duzi" ["" "" "" ""])
+("duzn" ["Ů"])
+("dv'" ["ַ"])
+("dvan" ["԰" "԰"])
+("dvay" ["־"])
+("dvb'" ["֧"])
+("dvbf" ["Ա"])
+("dvbi" ["Ա"])
+("dvbj" ["԰"])
+("dvbk" ["Ա"])
+("dvbl" ["԰"])
+("dvbu" ["Ӳ" "Բ"])
+("dvce" ["Բ"])
+("dvci" ["Դ"])
+("dvda" ["Դ"])
+("dvdc" ["Ե"])
+("dvdg" ["Ե"])
+("dvdh" ["Ե"])
+("dvdl" ["Դ"])
+("dvdu" ["Զ"])
+("dvdy" ["ֶ"])
+("dvf'" ["ɷ"])
+("dvfh" ["ѷ" "Է"])
+("dvfu" ["Ը"])
+("dvfz" ["ѷ"])
+("dvgd" ["Թ"])
+("dvgo" ["Թ"])
+("dvh'" ["к" "ڻ" "к"])
+("dvhj" ["Ѻ"])
+("dvhr" ["һ"])
+("dvhs" ["Ժ"])
+("dvhw" ["Ի"])
+("dvif" ["Գ"])
+("dvj'" [""])
+("dvjc" ["Խ"])
+("dvjg" [""])
+("dvji" ["ѻ"])
+("dvjj" ["׼"])
+("dvju" ["Ծ"])
+("dvjy" ["־Ӫ"])
+("dvkb" ["Կ"])
+("dvkh" ["Կ"])
+("dvkl" ["Կ"])
+("dvli" [""])
+("dvlm" [""])
+("dvlq" [""])
+("dvlu" ["·"])
+("dvlx" [""])
+("dvm'" [""])
+("dvmf" [""])
+("dvmm" [""])
+("dvnz" [""])
+("dvou" ["ż"])
+("dvp'" [""])
+("dvq'" "")
+("dvqg" [""])
+("dvqy" ["ȡ"])
+("dvr'" "ҶӶԶ")
+("dvs'" [""])
+("dvt'" ["" "ͼ"])
+("dvtb" ["ͷ"])
+("dvub" [""])
+("dvug" [""])
+("dvui" [""])
+("dvuj" ["ɽ"])
+("dvuu" [""])
+("dvve" ["" ""])
+("dvvg" ["֢" "֤"])
+("dvvh" ["ӳ"])
+("dvvi" [""])
+("dvvk" [""])
+("dvvp" ["׼"])
+("dvvr" ["ת"])
+("dvwf" [""])
+("dvwl" [""])
+("dvws" ["ά"])
+("dvwu" [""])
+("dvwz" ["λ"])
+("dvx'" ["ֵ" "ѧ" "ѧ" ""])
+("dvxc" [""])
+("dvxd" [""])
+("dvxj" ["սľ"])
+("dvxm" [""])
+("dvxn" [""])
+("dvxu" ["ʽ"])
+("dvxw" ["" "Ϻ"])
+("dvxy" ["" "֢ҩ"])
+("dvxz" ["ѡ"])
+("dvy'" ["" ""])
+("dvyb" ["Ԥ"])
+("dvyj" [""])
+("dvyr" ["Ա"])
+("dvyu" [""])
+("dvyv" ["־"])
+("dvyx" ["רԺУ"])
+("dvyy" ["Ӧ"])
+("dvz'" ["ֶ"])
+("dvzb" ["֧ʱ"])
+("dvzi" [""])
+("dw'" ["λ"])
+("dwb'" [""])
+("dwe'" "")
+("dwg'" ["λ"])
+("dwgi" ["λ"])
+("dwh'" ["ί"])
+("dwi'" ["λ"])
+("dwj'" ["λ"])
+("dwjx" [""])
+("dwjy" ["λ"])
+("dwkf" ["⿪"])
+("dwmd" ["ì"])
+("dwml" ["λ"])
+("dwmy" ["ó"])
+("dwq'" ["λ"])
+("dwu'" ["λ"])
+("dwuj" ["ί"])
+("dwv'" ["λ"])
+("dwvj" ["֮"])
+("dww'" ["η"])
+("dwwu" ["η"])
+("dwwy" ["ίίԱ"])
+("dwx'" ["" "ѧ"])
+("dwy'" ["԰"])
+("dxal" ["˰"])
+("dxb'" ["ϸ" "ѵ"])
+("dxbk" [""])
+("dxd'" [""])
+("dxdi" ["͵"])
+("dxdk" [""])
+("dxdl" [""])
+("dxdx" [""])
+("dxf'" [""])
+("dxff" [""])
+("dxg'" ["С"])
+("dxgi" [""])
+("dxh'" ["" "ͻ" "ź"])
+("dxhi" ["º"])
+("dxj'" ["¾"])
+("dxjh" ["С"])
+("dxjw" ["" ""])
+("dxl'" [""])
+("dxlo" [""])
+("dxm'" ["С"])
+("dxma" [""])
+("dxn'" ["л"])
+("dxnu" ["ʩ"])
+("dxp'" ["Сƽ"])
+("dxq'" "")
+("dxqi" [""])
+("dxqy" ["ҵ"])
+("dxt'" ["ͼ"])
+("dxtm" ["ľ"])
+("dxtx" [""])
+("dxu'" ["ѧ" "ʽ" "" "ˮ" "ʽ"])
+("dxuu" [""])
+("dxuw" ["ˮλ"])
+("dxvq" [""])
+("dxw'" ["" "" "" "" "" "" "" "ܦ" "" "" "" "" "" "" "" "ά"])
+("dxx'" ["" ""])
+("dxy'" [""])
+("dxyp" [""])
+("dxys" ["Ӿ"])
+("dxyu" ["Ӧ"])
+("dxz'" ["С"])
+("dxzi" [""])
+("dy'" [""])
+("dya'" ["Ҷ"])
+("dyan" [""])
+("dybf" [""])
+("dybj" [""])
+("dybk" [""])
+("dycv" ["һս"])
+("dyd'" ["ӡ"])
+("dydc" [""])
+("dydh" ["" ""])
+("dydj" [""])
+("dydm" ["" ""])
+("dydo" [""])
+("dydr" [""])
+("dyds" ["ӡȹ˾"])
+("dydu" [""])
+("dydy" [""])
+("dye'" "")
+("dyee" [""])
+("dyfg" ["" ""])
+("dyfu" [""])
+("dyg'" ["Լ"])
+("dygb" [""])
+("dygk" [""])
+("dygv" [""])
+("dyh'" ["˺" ""])
+("dyhk" [""])
+("dyhl" [""])
+("dyho" ["" ""])
+("dyhp" ["" ""])
+("dyhq" ["ѹ"])
+("dyhu" ["" ""])
+("dyij" [""])
+("dyip" [""])
+("dyiv" [""])
+("dyj'" ["ӡ" "һ" "Ծ"])
+("dyjb" ["Ӱ籾"])
+("dyjc" [""])
+("dyji" [""])
+("dyjm" [""])
+("dyjn" [""])
+("dyju" ["" ""])
+("dyjw" [""])
+("dykw" ["пΪ"])
+("dyl'" ["һ"])
+("dyld" [""])
+("dyli" ["" "" ""])
+("dylp" [""])
+("dylv" [""])
+("dym'" ["һ"])
+("dymc" [""])
+("dymy" [""])
+("dyng" [""])
+("dynj" [""])
+("dyny" [""])
+("dyp'" ["Ʒ"])
+("dypa" [""])
+("dypg" [""])
+("dyq'" "")
+("dyqi" [""])
+("dyqn" ["ҵ"])
+("dyqq" [""])
+("dyqx" [""])
+("dyr'" ["" "" "" "" "" "" "" "" ""])
+("dyri" [""])
+("dyrj" ["Ȼ"])
+("dysr" [""])
+("dysx" [""])
+("dyt'" ["һͳ"])
+("dytb" ["ͷ"])
+("dyti" [""])
+("dytm" [""])
+("dyu'" ["һ"])
+("dyuf" [""])
+("dyug" ["ʢ"])
+("dyui" ["" "ʱ"])
+("dyv'" ["" "־"])
+("dyvb" [""])
+("dyvd" ["ײ"])
+("dyve" [""])
+("dyvf" [""])
+("dyvg" [""])
+("dyvi" [""])
+("dyvp" ["׼"])
+("dyvu" ["ס" "" "ס"])
+("dyw'" [""])
+("dywe" ["һ޶"])
+("dywj" [""])
+("dywz" ["λ"])
+("dyx'" ["һ"])
+("dyxd" ["" ""])
+("dyxi" ["ϩ"])
+("dyxm" [""])
+("dyxn" [""])
+("dyxt" ["һźϵͳ"])
+("dyxy" ["" "" ""])
+("dyy'" ["ӰԺ"])
+("dyya" ["ѿ"])
+("dyye" ["Ҷ"])
+("dyyi" [""])
+("dyyk" ["Ҫ"])
+("dyyr" ["Ա"])
+("dyys" [""])
+("dyyt" ["Լ" ""])
+("dyyu" ["" ""])
+("dyyy" ["" "Ӱ"])
+("dyze" [""])
+("dyzi" ["" ""])
+("dyzo" [""])
+("dyzu" [""])
+("dyzv" [""])
+("dyzw" ["Ϊ"])
+("dzb'" ["ֱ"])
+("dzdl" ["ӵ·"])
+("dze'" "")
+("dzft" ["ӷ"])
+("dzg'" ["ӹ"])
+("dzgy" ["ӹҵ"])
+("dzij" ["ʲ׼"])
+("dzj'" ["ֻ"])
+("dzjj" ["Ӽ"])
+("dzkx" ["ӿƼѧ"])
+("dzl'" [""])
+("dzq'" [""])
+("dzr'" ["Ȼ"])
+("dzt'" ["ͳ"])
+("dzu'" [""])
+("dzv'" ["֧"])
+("dzx'" ["ѧ"])
+("dzxj" ["΢"])
+("dzy'" [""])
+("dzyj" ["Ԫ"])
+("dzyw" ["Ҷֲ"])
+("e" "")
+("ebdv" ["Ե"])
+("ebe'" ["ٶ"])
+("ebt'" [""])
+("ebu'" ["" ""])
+("ebw'" [""])
+("ecdz" ["ε"])
+("ecfi" ["η"])
+("ecgm" ["θ"])
+("ecps" [""])
+("edgl" [""])
+("edu'" ["ʽ"])
+("edv'" ["ֵ"])
+("eeba" [""])
+("eedu" [""])
+("eedy" [""])
+("eee'" "")
+("eeer" [""])
+("eegj" [""])
+("eego" ["" ""])
+("eegp" [""])
+("eehw" [""])
+("eeib" [""])
+("eeis" [""])
+("eejc" [""])
+("eelc" [""])
+("eelo" [""])
+("eelx" [""])
+("eemg" [""])
+("eemk" ["ë"])
+("eemo" ["ħ"])
+("eemz" [""])
+("eeq'" "")
+("eer'" "ج")
+("eerf" [""])
+("eerj" ["Ȼ"])
+("eesi" [""])
+("eet'" "")
+("eetb" ["ͷ"])
+("eeua" ["ɱ"])
+("eeub" [""])
+("eeva" ["ե" "թ"])
+("eevi" [""])
+("eew'" "Ŷݭ")
+("eewf" [""])
+("eewl" [""])
+("eexi" ["ϰ"])
+("eexn" [""])
+("eexy" [""])
+("eeyi" [""])
+("eeyj" [""])
+("eeyk" ["Ҫ"])
+("eeyp" [""])
+("eeyu" ["" ""])
+("eezi" [""])
+("eezu" [""])
+("egde" ["϶"])
+("egs'" ["˹"])
+("ehh'" ["ݺ"])
+("eie'" "")
+("eif'" [""])
+("eir'" "")
+("eiw'" "")
+("eix'" [""])
+("ejb'" ["ױ"])
+("ejfh" ["ֻ"])
+("ejg'" [""])
+("ejv'" [""])
+("ejwv" ["λ"])
+("eklm" ["³"])
+("elb'" ["ϰ"])
+("elhm" [""])
+("elht" ["̼"])
+("eli'" ["״"])
+("elq'" ["Ȧ"])
+("elu'" ["ɽ"])
+("elyw" [""])
+("elz'" [""])
+("emj'" [""])
+("emu'" ["üɽ"])
+("emyx" ["Ŀһ"])
+("enai" [""])
+("enci" [""])
+("ende" [""])
+("endm" [""])
+("enhv" [""])
+("enj'" ["꼶"])
+("enq'" "")
+("enqy" [""])
+("enr'" "")
+("enrf" [""])
+("enu'" [""])
+("enyr" ["Թ"])
+("eq'" [""])
+("erba" [""])
+("erbl" [""])
+("erbm" [""])
+("erci" [""])
+("erdg" [""])
+("erdo" [""])
+("erdv" [""])
+("ere'" "")
+("erfu" [""])
+("ergd" [""])
+("erge" ["" "" ""])
+("erhb" ["" ""])
+("erhd" [""])
+("erhr" [""])
+("erhu" [""])
+("erhw" [""])
+("erji" ["" ""])
+("erjn" [""])
+("erjx" [""])
+("erkd" [""])
+("erke" [""])
+("erld" [""])
+("erli" [""])
+("erlk" [""])
+("erll" [""])
+("erlp" [""])
+("erls" [""])
+("ermf" [""])
+("ermu" ["Ŀ"])
+("ernv" ["Ů"])
+("erqm" ["ǧ"])
+("erqx" [""])
+("err'" "٦")
+("errf" [""])
+("ersj" [""])
+("ersp" [""])
+("ertm" [""])
+("erts" ["ͯ"])
+("erui" ["" "ʱ" "ʮ"])
+("erve" [""])
+("ervi" ["ָ"])
+("ervj" ["ս"])
+("erw'" "")
+("erwf" [""])
+("erwj" [""])
+("erwl" [""])
+("erxi" ["ϱ" "Ϸ"])
+("erxm" [""])
+("erxn" [""])
+("erya" [""])
+("eryb" [""])
+("eryh" [""])
+("eryi" [""])
+("eryk" ["Ҫ"])
+("eryn" [""])
+("eryr" ["Ԫ"])
+("eryt" [""])
+("eryu" [""])
+("erzi" [""])
+("erzl" [""])
+("ett'" ["ͯ"])
+("eu'" [""])
+("eusu" ["ʮʷ"])
+("eut'" ["ʮ"])
+("euyt" ["ʮһ"])
+("ewfd" ["⸺"])
+("ewwv" ["ǧﳤ"])
+("exf'" ["ϱ"])
+("exu'" ["ʽ"])
+("exx'" [""])
+("exxh" ["ѭ"])
+("eyhd" [""])
+("eyhg" [""])
+("eyhl" [""])
+("eyhm" [""])
+("eyht" ["̼"])
+("eyl'" ["Ԫ"])
+("f" "")
+("fa'" [""])
+("faan" [""])
+("fabc" [""])
+("fabh" [""])
+("fabi" [""])
+("fabj" [""])
+("fabk" ["" ""])
+("fabl" [""])
+("fabm" [""])
+("fabu" [""])
+("faby" [""])
+("facl" ["" ""])
+("fada" [""])
+("fadb" [""])
+("fadl" [""])
+("fadm" ["" ""])
+("fadr" [""])
+("fads" [""])
+("fadu" [""])
+("fady" [""])
+("fae'" "")
+("faer" [""])
+("faff" [""])
+("fafg" [""])
+("fafh" [""])
+("fagd" [""])
+("fago" [""])
+("fagr" [""])
+("fagv" [""])
+("fagz" [""])
+("fahf" [""])
+("faho" ["" ""])
+("fahp" [""])
+("fahr" [""])
+("fahs" [""])
+("fahv" [""])
+("fahz" [""])
+("faib" ["" ""])
+("faij" [""])
+("faiu" [""])
+("fajc" [""])
+("fajd" [""])
+("faji" ["" ""])
+("fajn" [""])
+("fajt" ["" ""])
+("fajw" ["" ""])
+("fajy" [""])
+("fakd" [""])
+("fakj" [""])
+("fakr" [""])
+("fala" [""])
+("fald" [""])
+("falg" [""])
+("falh" ["" ""])
+("fali" [""])
+("falj" [""])
+("falk" [""])
+("falv" [""])
+("faly" [""])
+("fama" [""])
+("famf" [""])
+("famk" ["ë"])
+("famm" [""])
+("famu" ["ľ"])
+("famy" [""])
+("famz" ["ù"])
+("fanj" [""])
+("fanu" ["ŭ"])
+("fapc" ["Ʊ"])
+("fapk" [""])
+("fapz" [""])
+("faq'" "")
+("faqi" [""])
+("faqm" ["Ǯ"])
+("faqq" ["" ""])
+("faqr" ["Ȩ"])
+("faqu" [""])
+("faqy" [""])
+("far'" "")
+("fare" [""])
+("farf" [""])
+("farr" [""])
+("fasj" ["ɢ"])
+("fasr" [""])
+("fass" [""])
+("fatc" [""])
+("fats" ["ͳ"])
+("faty" ["ͥ"])
+("faue" [""])
+("faug" ["" ""])
+("faui" ["" "ʦ"])
+("fauk" [""])
+("favg" [""])
+("favh" [""])
+("favi" ["" ""])
+("favj" ["չ"])
+("faw'" "")
+("fawf" [""])
+("fawz" ["ζ"])
+("faxc" ["Ц"])
+("faxm" ["" ""])
+("faxn" [""])
+("faxt" ["ѧ"])
+("faxx" ["й"])
+("faxy" [""])
+("faya" ["ѿ"])
+("fayh" [""])
+("fayi" ["ҽ"])
+("fayj" ["" ""])
+("fayn" [""])
+("fayr" ["Դ" "Ժ"])
+("fayu" ["" ""])
+("faze" [""])
+("fazi" ["" ""])
+("fazo" [""])
+("fbdy" [""])
+("fbe'" "")
+("fbgu" ["ܲ"])
+("fbjt" [""])
+("fbl'" ["" "" "ֱ"])
+("fbq'" ["ֲ"])
+("fbrf" [""])
+("fbud" ["ܵ"])
+("fbv'" [""])
+("fbze" [""])
+("fcvv" [""])
+("fcy'" [""])
+("fdd'" ["Ե"])
+("fddu" ["綯"])
+("fddx" ["ѧ"])
+("fdfz" [""])
+("fdgj" [""])
+("fdgx" ["Թϵ"])
+("fdh'" [""])
+("fdi'" ["糧"])
+("fdj'" ["" "" "Ŵ" "ý"])
+("fdjv" ["ǵ"])
+("fdkx" ["ǶԿ"])
+("fdl'" ["" "Ŵ"])
+("fdll" [""])
+("fdlt" [""])
+("fdmj" [""])
+("fdp'" ["" ""])
+("fdq'" ["Ŵ"])
+("fdt'" ["ֶͷ"])
+("fdv'" ["վ"])
+("fdvd" ["֮"])
+("fdxu" ["Ŵϵ"])
+("fdy'" ["Ա"])
+("fdyb" ["ֵ"])
+("fdyq" ["һ"])
+("febh" ["Ѷ͹"])
+("fejh" ["Ӻ"])
+("feml" [""])
+("fes'" [""])
+("ff'" [""])
+("ffbi" ["" "۱"])
+("ffbm" ["ֱ" "ֱ" ""])
+("ffbp" ["߷߲ƽ"])
+("ffbu" ["ֲ"])
+("ffbx" ["ֱ"])
+("ffbz" ["ֱ"])
+("ffcp" ["ִ"])
+("ffcs" ["ִ"])
+("ffdb" ["ܶ"])
+("ffdc" ["ḻ" "ḻ"])
+("ffde" ["ֵ"])
+("ffdg" ["ֵ"])
+("ffdi" ["ص"])
+("ffdj" ["ֵ"])
+("ffdk" ["ֵ"])
+("ffdm" ["ֵ"])
+("ffdr" ["ֶ"])
+("ffdv" ["ֶ" ""])
+("ffe'" "")
+("ffee" ["ݶ"])
+("fffa" ["ַ" "ܷ"])
+("ffff" ["׷" "޷" "߷"])
+("fffg" ["ַ"])
+("fffh" ["ҷ"])
+("fffu" ["Ը" "ָ"])
+("fffz" [""])
+("ffgd" ["ֹ"])
+("ffge" ["ָ" "ָ"])
+("ffgr" ["ֹ"])
+("ffgs" ["ֹ"])
+("ffgz" ["ָ"])
+("ffhe" ["ں"])
+("ffhf" ["ߺ"])
+("ffhh" [""])
+("ffhs" ["ֺ" "ۺ"])
+("ffhv" ["ֻ" "ٻ"])
+("ffhw" ["ֻ"])
+("ffif" ["۳"])
+("ffig" ["ֳ"])
+("ffih" ["ֳ"])
+("ffj'" [""])
+("ffji" ["ֻ" "ּ" "ۼ"])
+("ffjq" ["ھ"])
+("ffju" ["־" "־" "־"])
+("ffjw" ["ּ"])
+("ffjx" ["ֽ" "ֽ"])
+("ffjy" ["ֽⷴӦ"])
+("ffk'" [""])
+("ffkl" ["ֿ" "߿"])
+("ffl'" [""])
+("ffld" [""])
+("ffli" ["" "" "" ""])
+("fflj" [""])
+("fflq" ["" ""])
+("fflr" [""])
+("fflu" ["·"])
+("fflx" [""])
+("fflz" [""])
+("ffmc" [""])
+("ffmf" [""])
+("ffmi" [""])
+("ffmm" [""])
+("ffmo" ["ĩ"])
+("ffmu" ["ĸ" "Ĺ"])
+("ffmy" [""])
+("ffmz" ["ú"])
+("ffnu" ["ŭ"])
+("ffnx" [""])
+("ffnz" ["" ""])
+("ffpi" [""])
+("ffpl" [""])
+("ffpz" [""])
+("ffq'" "ҷӷԷշַ")
+("ffqi" ["" "" "" ""])
+("ffqp" ["Ⱥ"])
+("ffqr" ["ȩ"])
+("ffqy" [""])
+("ffr'" "ַܷݷ޷߷")
+("ffrj" ["Ȼ"])
+("ffse" ["ɫ"])
+("ffsi" ["˿"])
+("ffsj" ["ɢ"])
+("ffss" [""])
+("ffsv" [""])
+("fftb" ["ͷ"])
+("fftc" [""])
+("fftj" ["̯"])
+("fftl" ["̪"])
+("fftq" ["ܷͼǿ"])
+("ffub" [""])
+("ffue" [""])
+("ffui" ["ʽ" ""])
+("ffuk" [""])
+("ffuo" ["˵"])
+("ffuu" ["" ""])
+("ffuv" ["ˮ"])
+("ffuw" ["ˢ"])
+("ffvd" ["״"])
+("ffvg" [""])
+("ffvi" ["֧" "֮"])
+("ffvj" ["ս"])
+("ffvs" ["" ""])
+("ffvy" [""])
+("ffw'" "طٷ")
+("ffwf" [""])
+("ffwl" [""])
+("ffwz" ["Ϊ"])
+("ffxd" [""])
+("ffxi" [""])
+("ffxn" [""])
+("ffxr" ["ѡ"])
+("ffxs" ["˹"])
+("ffxw" ["ǷΪ"])
+("ffy'" ["Ӧ"])
+("ffyh" [""])
+("ffyi" [""])
+("ffyp" [""])
+("ffys" [""])
+("ffzh" [""])
+("ffzi" ["" ""])
+("ffzu" [""])
+("fgbi" [""])
+("fgbk" ["籩"])
+("fgbo" ["粨"])
+("fgbu" ["첹"])
+("fgci" [""])
+("fgcp" [""])
+("fgdb" ["綷"])
+("fgdi" [""])
+("fgdk" [""])
+("fgds" ["" "ⶳ" "綴"])
+("fgdu" [""])
+("fge'" "")
+("fgfg" [""])
+("fgfh" ["䷿"])
+("fgfu" ["ḻ"])
+("fggd" [""])
+("fgge" [""])
+("fggj" [""])
+("fggk" [""])
+("fggs" [""])
+("fghb" [""])
+("fghd" [""])
+("fghe" [""])
+("fgho" [""])
+("fghw" ["绯"])
+("fgie" ["糵"])
+("fgif" ["糾"])
+("fgig" [""])
+("fgij" [""])
+("fgik" ["䳲" "糱"])
+("fgir" ["紫"])
+("fgj'" ["⾵" "ֹ⾵"])
+("fgjm" ["⽨"])
+("fgjy" ["羰"])
+("fgkb" ["" ""])
+("fgkd" [""])
+("fgl'" [""])
+("fgla" [""])
+("fgld" [""])
+("fglh" [""])
+("fgli" ["" ""])
+("fglq" [""])
+("fglr" [""])
+("fglu" ["˵" "ٺ»"])
+("fglz" [""])
+("fgm'" [""])
+("fgmf" [""])
+("fgmh" ["â"])
+("fgmi" [""])
+("fgmj" [""])
+("fgmk" ["ò"])
+("fgmm" ["" ""])
+("fgmy" ["" ""])
+("fgmz" [""])
+("fgnj" [""])
+("fgnm" [""])
+("fgpi" ["Ƥ"])
+("fgpz" ["" ""])
+("fgq'" "ۺ")
+("fgqi" ["" ""])
+("fgqn" [""])
+("fgqp" ["Ⱥ"])
+("fgqr" ["Ȱ"])
+("fgqu" ["Ȥ"])
+("fgr'" "ٺ")
+("fgrf" [""])
+("fgs'" ["˾"])
+("fgso" [""])
+("fgss" [""])
+("fgsu" ["" ""])
+("fgtb" ["ͷ"])
+("fgtc" [""])
+("fgtl" ["̨"])
+("fgtm" [""])
+("fgtu" [""])
+("fgua" ["ɳ"])
+("fgub" [""])
+("fgud" ["˪"])
+("fgug" ["ʢ" ""])
+("fguh" [""])
+("fgui" ["ʪ"])
+("fguj" ["ɽ" ""])
+("fguo" ["˶"])
+("fguu" [""])
+("fguv" ["ˮ"])
+("fgv'" [""])
+("fgvi" ["ֵ"])
+("fgw'" "")
+("fgwh" [""])
+("fgwj" ["Ṧΰ"])
+("fgwo" [""])
+("fgwz" ["ζ"])
+("fgxd" ["" "" ""])
+("fgxi" ["϶"])
+("fgxm" ["" ""])
+("fgxr" ["ѡ"])
+("fgxt" ["ѩ"])
+("fgxy" ["" ""])
+("fgya" ["ѹ"])
+("fgye" ["Ҷ"])
+("fgyh" [""])
+("fgyp" [""])
+("fgys" ["ӵ"])
+("fgyt" [""])
+("fgyu" [""])
+("fgzi" [""])
+("fgzr" [""])
+("fh'" [""])
+("fhai" [""])
+("fhan" [""])
+("fhbm" [""])
+("fhbo" [""])
+("fhbz" [""])
+("fhci" [""])
+("fhcl" ["" "ϲ"])
+("fhda" ["Ŵ"])
+("fhdh" ["ŵ"])
+("fhdm" ["ŵ"])
+("fhds" ["" ""])
+("fhdu" ["" "Ŷ"])
+("fhdy" [""])
+("fhe'" "·÷")
+("fhfa" [""])
+("fhfg" ["" "ŷ"])
+("fhfj" [""])
+("fhfu" ["" "·"])
+("fhg'" [""])
+("fhgd" ["Ź"])
+("fhge" [""])
+("fhgf" [""])
+("fhgo" ["Ź"])
+("fhgu" ["¹"])
+("fhhj" [""])
+("fhhl" [""])
+("fhho" ["" "Ż"])
+("fhhs" [""])
+("fhhu" [""])
+("fhhw" ["û"])
+("fhia" [""])
+("fhie" ["ĳ"])
+("fhif" [""])
+("fhig" [""])
+("fhij" [""])
+("fhik" [""])
+("fhiu" ["ų"])
+("fhiv" ["Ĵ"])
+("fhj'" ["轥"])
+("fhjm" [""])
+("fhjp" [""])
+("fhjr" [""])
+("fhjw" ["ż"])
+("fhkd" [""])
+("fhkl" ["ſ"])
+("fhkr" ["ſ"])
+("fhks" [""])
+("fhky" [""])
+("fhl'" ["" ""])
+("fhla" [""])
+("fhlk" [""])
+("fhlt" [""])
+("fhmj" [""])
+("fhmm" [""])
+("fhmu" [""])
+("fhpi" ["ƨ"])
+("fhpk" [""])
+("fhq'" ["" "" "" "" "" "" "" ""])
+("fhqi" [""])
+("fhqu" [""])
+("fhr'" "")
+("fhre" [""])
+("fhrf" [""])
+("fhsi" ["˿" ""])
+("fhsj" ["ɢ"])
+("fhss" ["" ""])
+("fhty" [""])
+("fhu'" [""])
+("fhua" ["ɴ"])
+("fhub" ["" ""])
+("fhue" [""])
+("fhuf" [""])
+("fhug" ["" "" ""])
+("fhui" ["ʽ" "ʿ"])
+("fhuj" ["ɽ"])
+("fhuk" [""])
+("fhul" ["ʩ"])
+("fhun" ["ǻŮ"])
+("fhuu" [""])
+("fhuv" ["ˮ" "ˮ"])
+("fhvf" ["" ""])
+("fhvg" [""])
+("fhvi" ["ֹ" "" "" "֯" ""])
+("fhvk" [""])
+("fhvl" ["ծ"])
+("fhvo" [""])
+("fhvu" [""])
+("fhw'" ["" "" "" "" "" "" ""])
+("fhwf" [""])
+("fhwu" ["" ""])
+("fhwz" ["λ" ""])
+("fhxc" ["Ч"])
+("fhxd" ["" ""])
+("fhxm" [""])
+("fhxn" [""])
+("fhxp" ["Ѵ"])
+("fhxq" ["" ""])
+("fhxt" ["ѧ"])
+("fhxw" [""])
+("fhxy" ["" ""])
+("fhyh" [""])
+("fhyi" [""])
+("fhyj" [""])
+("fhyr" ["Բ"])
+("fhyu" ["" ""])
+("fhyy" ["ӳ"])
+("fhzi" ["" ""])
+("fhzk" [""])
+("fhzl" [""])
+("fhzs" [""])
+("fhzu" [""])
+("fi'" ["ǳ"])
+("fij'" [""])
+("fik'" [""])
+("fip'" ["Ʒ"])
+("fit'" [""])
+("fiu'" ["ʽ"])
+("fiyd" ["紵"])
+("fiz'" [""])
+("fjan" [""])
+("fjba" [""])
+("fjbf" [""])
+("fjbi" [""])
+("fjbj" [""])
+("fjbl" [""])
+("fjbo" [""])
+("fjbu" [""])
+("fjch" ["ּ"])
+("fjcl" [""])
+("fjcy" ["⽨"])
+("fjdd" ["⽨"])
+("fjdi" [""])
+("fjdk" ["" ""])
+("fjdm" [""])
+("fjdo" [""])
+("fjds" ["" ""])
+("fjdv" [""])
+("fje'" "")
+("fjer" [""])
+("fjfa" [""])
+("fjfj" ["" "" ""])
+("fjfu" ["" ""])
+("fjgd" [""])
+("fjgj" [""])
+("fjgo" [""])
+("fjgp" [""])
+("fjgr" [""])
+("fjgs" ["" ""])
+("fjgv" [""])
+("fjhe" [""])
+("fjhh" [""])
+("fjhk" [""])
+("fjhv" [""])
+("fjhw" [""])
+("fji'" ["ɻ"])
+("fjia" [""])
+("fjib" [""])
+("fjie" [""])
+("fjig" [""])
+("fjih" [""])
+("fjii" [""])
+("fjik" [""])
+("fjir" [""])
+("fjis" [""])
+("fjiu" ["ۻ"])
+("fjji" [""])
+("fjjr" [""])
+("fjjx" [""])
+("fjjy" [""])
+("fjke" [""])
+("fjkh" [""])
+("fjkl" [""])
+("fjkv" [""])
+("fjlc" [""])
+("fjli" ["" ""])
+("fjlj" [""])
+("fjlr" [""])
+("fjma" [""])
+("fjmf" [""])
+("fjmh" ["æ"])
+("fjmk" ["ï"])
+("fjml" [""])
+("fjmm" [""])
+("fjnj" [""])
+("fjnk" [""])
+("fjpc" ["Ʊ"])
+("fjpj" [""])
+("fjpu" [""])
+("fjq'" ["" "" "" "" "ެ" "" "Ȩ"])
+("fjqi" [""])
+("fjqm" ["Ǳ"])
+("fjqx" [""])
+("fjqy" [""])
+("fjr'" "")
+("fjrf" ["" ""])
+("fjrk" [""])
+("fjrs" [""])
+("fjse" ["ɫ"])
+("fjsl" [""])
+("fjso" ["" ""])
+("fjsr" [""])
+("fjsu" [""])
+("fjtg" [""])
+("fjti" [""])
+("fjtm" [""])
+("fjty" [""])
+("fju'" ["ʯ" "ǽ" "ʡ" ""])
+("fjub" [""])
+("fjue" [""])
+("fjuf" [""])
+("fjug" ["ʢ"])
+("fjuh" ["⽨"])
+("fjui" ["" ""])
+("fjus" ["ǽԪ"])
+("fjuu" [""])
+("fjv'" ["⽨"])
+("fjvd" ["ׯ"])
+("fjvf" ["" ""])
+("fjvg" ["" "֤"])
+("fjvi" ["ֳ" "֮" "ָ"])
+("fjvo" [""])
+("fjvr" ["ת" "ת"])
+("fjvs" [""])
+("fjvy" ["⽨"])
+("fjw'" "ެ")
+("fjwf" ["" ""])
+("fjwh" ["⽨Ļ"])
+("fjwj" [""])
+("fjwz" ["Χ"])
+("fjx'" ["ֽ" "⽨"])
+("fjxd" ["" ""])
+("fjxn" [""])
+("fjxq" ["" ""])
+("fjxy" ["ʡ"])
+("fjye" ["ҳ"])
+("fjyh" [""])
+("fjyi" [""])
+("fjyj" [""])
+("fjyn" ["ӡ" ""])
+("fjyp" [""])
+("fjyt" ["Խ" ""])
+("fjyu" [""])
+("fjyy" ["Ӧ" "ӳ"])
+("fjza" [""])
+("fjzi" [""])
+("fjzk" [""])
+("fjzl" [""])
+("fjzv" [""])
+("fkc'" [""])
+("fkt'" ["ͼ"])
+("fl'" ["¼"])
+("flb'" ["ɱ"])
+("fld'" [""])
+("flf'" ["˷"])
+("flfq" ["ȥ" "ȥ"])
+("flge" [""])
+("flgw" ["ɹ"])
+("flhf" ["źͷ"])
+("fliz" ["ĳ"])
+("fljj" [""])
+("flk'" [""])
+("flkf" ["˸"])
+("flp'" [""])
+("flt'" [""])
+("flth" ["û"])
+("flv'" [""])
+("flvy" ["" ""])
+("flx'" ["ѧ"])
+("flxf" ["ϣ"])
+("flxg" ["͹"])
+("flxw" ["Ϊ"])
+("flxy" ["Я"])
+("fly'" ["Ҷ"])
+("flz'" [""])
+("fm'" [""])
+("fmbl" ["ű"])
+("fmiz" [""])
+("fmjy" ["Ա"])
+("fmrw" [""])
+("fmu'" [""])
+("fmv'" [""])
+("fmyj" ["ĩұ"])
+("fnfz" ["ũ"])
+("fngj" [""])
+("fnjj" ["ũ"])
+("fofa" [""])
+("fojc" [""])
+("fojy" [""])
+("fouj" ["ɽ"])
+("fow'" "")
+("foxd" [""])
+("foxt" ["ѧ"])
+("foye" ["ү"])
+("fpf'" ["䷧"])
+("fpj'" ["ݼ"])
+("fpl'" ["Ʒ" ""])
+("fplj" ["ƽ˾"])
+("fpq'" ["Ƣ"])
+("fqk'" ["Ǧ"])
+("fqlv" ["ս"])
+("fqq'" [""])
+("fqr'" [""])
+("fqsl" ["ȩ"])
+("fquv" ["ȩ֬"])
+("fqv'" ["Ȩ"])
+("fqvq" [""])
+("fqw'" [""])
+("fqwu" ["ʳ"])
+("fqyy" ["ӿ"])
+("frfy" ["ȷӦ"])
+("friu" ["ٲʢ"])
+("frj'" ["һ"])
+("frl'" [""])
+("fryh" ["Ⱦӡ"])
+("fsd'" ["ɢ"])
+("fsjv" ["ɢ"])
+("fsrl" ["ɢȾ"])
+("fsvy" ["ɢ"])
+("fsx'" ["ɢ"])
+("ftf'" [""])
+("ftfd" ["츲" "츴"])
+("ftg'" ["ڸ"])
+("ftj'" ["ؼ"])
+("ftl'" [""])
+("ftm'" [""])
+("ftq'" ["̨"])
+("ftxk" ["ͬС"])
+("ftz'" [""])
+("fu'" ["ʽ"])
+("fuan" [""])
+("fub'" ["䲡"])
+("fubc" [""])
+("fubf" ["" ""])
+("fubi" [""])
+("fubj" [""])
+("fubl" [""])
+("fubu" [""])
+("fubv" ["ʳ"])
+("fuby" [""])
+("fubz" [""])
+("fuci" [""])
+("fucs" [""])
+("fudc" [""])
+("fudi" [""])
+("fudj" [""])
+("fudk" [""])
+("fudl" ["䶨" ""])
+("fudm" ["" ""])
+("fuds" [""])
+("fudu" ["" ""])
+("fue'" "")
+("fufa" [""])
+("fufh" [""])
+("fufi" ["ʽ"])
+("fufu" [""])
+("fug'" [""])
+("fugh" [""])
+("fugk" ["غ"])
+("fugl" ["" ""])
+("fugo" [""])
+("fugr" [""])
+("fugs" [""])
+("fugu" [""])
+("fugv" [""])
+("fugz" [""])
+("fuh'" ["仡"])
+("fuhe" ["" "" "" "" ""])
+("fuhk" ["" "" ""])
+("fuhl" [""])
+("fuho" ["" ""])
+("fuhu" [""])
+("fuhv" [""])
+("fuhw" ["" ""])
+("fuia" [""])
+("fuib" ["" ""])
+("fuif" [""])
+("fuig" [""])
+("fuii" [""])
+("fuis" [""])
+("fuiu" [""])
+("fuix" [""])
+("fuj'" [""])
+("fujc" [""])
+("fujd" [""])
+("fuji" ["" ""])
+("fujm" ["" ""])
+("fujn" [""])
+("fujq" [""])
+("fuju" [""])
+("fujw" [""])
+("fukd" [""])
+("fuke" ["" ""])
+("fukj" ["" ""])
+("fukr" ["" ""])
+("fuku" [""])
+("fukw" [""])
+("ful'" ["ʿ" "ˮ"])
+("fuli" ["" "" "" "" ""])
+("fulj" [""])
+("fulk" [""])
+("fulm" [""])
+("fulr" [""])
+("fulu" ["²" "¼"])
+("fuly" [""])
+("fuma" [""])
+("fumm" [""])
+("fumn" [""])
+("fumo" ["" "Ħ"])
+("fumu" ["ĸ"])
+("fumx" [""])
+("fumz" [""])
+("fun'" [""])
+("funj" ["߻"])
+("funs" ["ũ"])
+("funv" ["Ů"])
+("fupi" ["Ƥ"])
+("fupm" ["Ƭ"])
+("fupy" ["Ƽ"])
+("fuq'" ["" "" "" "" "߻" "" "" "" "" ""])
+("fuqc" [""])
+("fuqd" ["ǻ" "ǿ"])
+("fuqi" ["" "" "" ""])
+("fuqm" ["ǳ"])
+("fuqn" [""])
+("fuqr" ["Ȩ"])
+("fuqu" [""])
+("fuqy" [""])
+("fur'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("furf" ["" "" "" ""])
+("furi" [""])
+("furk" [""])
+("furs" ["ܽ"])
+("fuse" ["ɫ"])
+("fusg" [""])
+("fusl" [""])
+("fusu" [""])
+("fut'" ["" "ͼ"])
+("futb" ["ͷ"])
+("futc" [""])
+("fute" ["" ""])
+("futi" [""])
+("futu" ["ͼ"])
+("fuub" ["" ""])
+("fuue" ["" "" ""])
+("fuuf" [""])
+("fuug" [""])
+("fuuh" ["" "" ""])
+("fuui" ["" "" "" "ʴ" "ʳ"])
+("fuup" ["˳"])
+("fuuu" ["" "" "" "" ""])
+("fuuv" ["˰"])
+("fuvb" [""])
+("fuvd" ["װ"])
+("fuvf" [""])
+("fuvi" ["ֲ" "ְ" ""])
+("fuvl" ["ծ"])
+("fuvo" [""])
+("fuvs" ["" ""])
+("fuvu" [""])
+("fuw'" "ۮܽݳ")
+("fuwg" [""])
+("fuwh" [""])
+("fuwu" [""])
+("fuwz" ["ο" "λ"])
+("fux'" ["ѧ" "" ""])
+("fuxc" [""])
+("fuxi" ["ϰ"])
+("fuxm" [""])
+("fuxn" [""])
+("fuxq" [""])
+("fuxr" ["ѡ" "ѡ"])
+("fuxs" ["ͬλ" "Ԫ" ""])
+("fuxu" [""])
+("fuxx" ["д" "к"])
+("fuxy" [""])
+("fuyb" ["" "" "" ""])
+("fuye" ["ҵ"])
+("fuyh" ["" ""])
+("fuyi" ["" "" ""])
+("fuyj" [""])
+("fuyl" ["ɽԽ" "ɽ"])
+("fuyn" ["" "" "" "ӡ"])
+("fuyp" [""])
+("fuyr" ["Ա" "Ա" "ԭ"])
+("fuys" ["" "ӹ"])
+("fuyu" ["" "" "" "ԣ"])
+("fuyy" ["Ӣ"])
+("fuza" [""])
+("fuze" [""])
+("fuzh" [""])
+("fuzi" ["" "" "" ""])
+("fuzl" ["" ""])
+("fuzo" [""])
+("fuzu" [""])
+("fuzv" ["֯"])
+("fv'" ["չ"])
+("fvbh" ["չƽ"])
+("fvcl" [""])
+("fvf'" ["֤"])
+("fvg'" ["չ"])
+("fvgy" ["֯ҵ"])
+("fvi'" ["֯"])
+("fvl'" ["ֳ"])
+("fvp'" ["תƬ" "֯Ʒ" "Ʒ"])
+("fvr'" [""])
+("fvsd" ["չٶ"])
+("fvtv" ["ͳһ֯"])
+("fvu'" ["ʽ" ""])
+("fvui" ["չ" ""])
+("fvv'" ["ֲ"])
+("fvvj" ["չй"])
+("fvvu" ["ָ"])
+("fvxg" ["Ч"])
+("fvxu" ["ֳϵ"])
+("fw'" [""])
+("fwhy" ["ҵ"])
+("fwi'" ["Գ"])
+("fwj'" ["λ"])
+("fwm'" ["ú"])
+("fwt'" [""])
+("fwtd" ["̬"])
+("fwv'" ["վ"])
+("fwvl" [""])
+("fwy'" ["ҵ" "Ա"])
+("fx'" [""])
+("fxgy" ["㹤ҵ"])
+("fxh'" ["ѭ"])
+("fxhh" ["ۺ"])
+("fxj'" ["ѡ"])
+("fxjf" ["ϵ"])
+("fxp'" [""])
+("fxq'" [""])
+("fxs'" ["˹"])
+("fxsy" ["˹"])
+("fxt'" [""])
+("fxu'" [""])
+("fxvw" ["ֲ"])
+("fxwa" ["δ"])
+("fxxj" ["Ԫ"])
+("fxxv" ["ʧ"])
+("fxy'" ["Ա"])
+("fxz'" [""])
+("fy'" ["Ӧ"])
+("fyd'" ["Դ" "Ӧ"])
+("fydw" ["ζ"])
+("fydx" ["µ"])
+("fyf'" ["һ"])
+("fyfi" ["Ӧ"])
+("fyfy" ["Է"])
+("fygd" [""])
+("fyj'" ["ӡ"])
+("fyjr" ["Ա"])
+("fyl'" ["ӳ"])
+("fymd" ["ܶ"])
+("fypv" ["ɶ"])
+("fyq'" ["Ȩ"])
+("fyr'" [""])
+("fyt'" [""])
+("fytj" [""])
+("fyu'" ["Ӧʽ"])
+("fyuj" ["Ӧʱ"])
+("fyuw" [""])
+("fyvw" ["ֲ"])
+("fywk" ["翹"])
+("fyx'" ["ҽѧ" ""])
+("fz'" [""])
+("fzai" ["ΰ"])
+("fzbf" ["ɱ"])
+("fzbh" ["˰" "̰"])
+("fzbu" ["β"])
+("fzby" ["β"])
+("fzcv" [""])
+("fzda" ["ʴ"])
+("fzde" ["ǵ"])
+("fzdj" ["ǵ"])
+("fzdl" ["ӵ"])
+("fzdm" ["е"])
+("fzds" ["ʶ"])
+("fzdu" ["Ƕ"])
+("fze'" "Ʒ˷")
+("fzer" ["Ѷ"])
+("fzf'" [""])
+("fzfa" ["Ƿ"])
+("fzff" ["ʷ"])
+("fzfj" ["Ƿ"])
+("fzfu" ["θ"])
+("fzgo" ["ɹ"])
+("fzgs" ["ѹ"])
+("fzhb" ["ʺ"])
+("fzhs" ["糺"])
+("fzhw" ["ɻ" "ϻ"])
+("fzig" ["ʳ"])
+("fzih" ["ǳ"])
+("fzii" ["ɳ"])
+("fzir" ["ɴ"])
+("fzis" ["ɳ"])
+("fziu" ["ϳ"])
+("fzjg" ["ӽṹ"])
+("fzji" ["ɻ"])
+("fzjm" ["ɽ"])
+("fzjn" ["ɽ" "Ѿ" "Ѿ"])
+("fzjp" ["˾"])
+("fzky" ["ɿ"])
+("fzl'" ["" ""])
+("fzlc" ["" ""])
+("fzld" ["Ͷ"])
+("fzli" ["" ""])
+("fzll" [""])
+("fzlm" [""])
+("fzlp" [""])
+("fzmz" [""])
+("fznc" [""])
+("fznj" [""])
+("fzph" [""])
+("fzpk" ["" ""])
+("fzpn" ["Ʒ"])
+("fzq'" "ƷǷȷ")
+("fzqi" ["" ""])
+("fzqm" ["Ǯ"])
+("fzqn" [""])
+("fzqt" ["ȱ"])
+("fzr'" "ͷηϷз")
+("fzrb" [""])
+("fzrf" [""])
+("fzsu" [""])
+("fzte" [""])
+("fztg" ["" ""])
+("fztm" [""])
+("fztu" ["ͽ"])
+("fztx" [""])
+("fzty" ["ͧ"])
+("fzu'" ["ɸ" "ʽ"])
+("fzub" [""])
+("fzud" ["ˮ"])
+("fzui" ["ʯ" "ʱ" ""])
+("fzuv" ["ˮ" "ˮ"])
+("fzux" ["ѧ"])
+("fzv'" [""])
+("fzva" [""])
+("fzvb" [""])
+("fzvd" ["׳"])
+("fzvh" [""])
+("fzvi" ["ֹ" "ֽ"])
+("fzw'" "")
+("fzwh" [""])
+("fzwo" ["" ""])
+("fzwu" ["" ""])
+("fzxc" ["Ч"])
+("fzxd" [""])
+("fzxn" [""])
+("fzxu" [""])
+("fzxy" [""])
+("fzy'" ["" ""])
+("fzye" ["Һ"])
+("fzyh" [""])
+("fzyi" [""])
+("fzyj" [""])
+("fzyk" ["Ҫ"])
+("fzyl" ["" "˶"])
+("fzyr" ["Դ"])
+("fzys" [""])
+("fzyt" ["Ծ"])
+("fzyu" [""])
+("fzzb" [""])
+("fzzh" [""])
+("fzzi" [""])
+("fzzk" [""])
+("g" "")
+("gab'" [""])
+("gabd" [""])
+("gae'" "")
+("gaga" ["¸"])
+("gaj'" [""])
+("gaq'" "¸п٤")
+("gar'" "")
+("gas'" ["Ȱ"])
+("gatb" ["۰ͬ"])
+("gaw'" "")
+("gb'" ["ı"])
+("gban" [""])
+("gbb'" ["ɰͰ"])
+("gbci" [""])
+("gbd'" ["˲" "ֲ"])
+("gbde" [""])
+("gbdh" [""])
+("gbdt" ["㲥̨"])
+("gbdv" ["Ѳ"])
+("gbe'" "")
+("gbf'" [""])
+("gbge" [""])
+("gbh'" [""])
+("gbhe" ["" "ź"])
+("gbhg" ["籾"])
+("gbho" ["" ""])
+("gbhw" [""])
+("gbig" [""])
+("gbiy" [""])
+("gbjm" [""])
+("gbjn" [""])
+("gbjx" [""])
+("gbkp" ["߲"])
+("gblc" [""])
+("gbmd" ["ì"])
+("gbml" [""])
+("gbn'" [""])
+("gbq'" ["" "" "" "" "" "" "" "" "" "ȥ"])
+("gbqm" [""])
+("gbqu" [""])
+("gbqx" [""])
+("gbr'" "ڸ")
+("gbsi" ["˼"])
+("gbtc" ["㲥"])
+("gbts" ["ͨ"])
+("gbtu" ["ͼ"])
+("gbu'" ["ϲ" "" "˲" ""])
+("gbui" ["ʩ"])
+("gbvi" [""])
+("gbvu" ["ס" ""])
+("gbw'" ["ί"])
+("gbwu" [""])
+("gbx'" [""])
+("gbxc" [""])
+("gbxd" [""])
+("gbxs" [""])
+("gbxy" [""])
+("gby'" ["Ա"])
+("gbyk" ["ҧ"])
+("gbyn" [""])
+("gbyq" ["Ӧ"])
+("gbzf" ["ʲԷ"])
+("gbzi" [""])
+("gbzk" [""])
+("gc'" ["ղ"])
+("gcf'" ["ɲݷ"])
+("gcub" ["˴ʧ"])
+("gd'" ["涨"])
+("gdan" ["㰲"])
+("gdb'" ["ߵ"])
+("gdbc" [""])
+("gdbo" ["Ⲩ" "㲥" "㲩"])
+("gdc'" ["ŵش"])
+("gdcl" [""])
+("gdda" ["" ""])
+("gddl" [""])
+("gddm" [""])
+("gdds" ["㶫"])
+("gddu" ["" ""])
+("gddw" ["ߵȶ"])
+("gde'" "")
+("gdeg" [""])
+("gdfj" ["㷺"])
+("gdfu" ["⸴"])
+("gdg'" ["ߵ͸" ""])
+("gdgk" [""])
+("gdgp" ["" ""])
+("gdgu" [""])
+("gdh'" ["㶫"])
+("gdhe" [""])
+("gdhj" ["㺺"])
+("gdhv" [""])
+("gdhw" ["⻪" "⻬"])
+("gdi'" ["ɵ" ""])
+("gdih" ["㳡"])
+("gdir" ["㴨"])
+("gdjc" [""])
+("gdjq" [""])
+("gdjx" [""])
+("gdjy" ["ߵȽ" "⾰"])
+("gdko" [""])
+("gdl'" [""])
+("gdld" [""])
+("gdlj" [""])
+("gdln" [""])
+("gdly" [""])
+("gdmc" ["Ħ"])
+("gdmh" ["â"])
+("gdmj" [""])
+("gdmm" [""])
+("gdmn" [""])
+("gdmy" [""])
+("gdng" [""])
+("gdnj" [""])
+("gdnm" [""])
+("gdpu" [""])
+("gdq'" ["" "" "" "" "ȥ"])
+("gdqi" [""])
+("gdqr" ["Ȧ"])
+("gdqs" [""])
+("gdqv" ["Ⱥ"])
+("gdr'" "")
+("gdrp" [""])
+("gdrs" [""])
+("gdsu" [""])
+("gdt'" ["ض"])
+("gdtb" ["ͷ"])
+("gdu'" ["㶫ʡ"])
+("gdui" [""])
+("gduj" ["դ"])
+("gdup" ["ߵƷ"])
+("gduq" ["ʱ"])
+("gduu" [""])
+("gdvb" ["" ""])
+("gdvi" [""])
+("gdvk" [""])
+("gdvy" ["ŵ"])
+("gdw'" ["λ"])
+("gdwu" [""])
+("gdwx" ["ŵѧ"])
+("gdwz" ["Ϊ"])
+("gdx'" ["涨"])
+("gdxi" [""])
+("gdxm" ["" ""])
+("gdxt" ["ѧ"])
+("gdxu" ["" "ʽ"])
+("gdxx" ["ߵѧУ"])
+("gdxy" ["ЧӦ"])
+("gdy'" ["ѹ"])
+("gdyi" [""])
+("gdyn" [""])
+("gdyr" ["Դ"])
+("gdyx" ["ߵԺУ"])
+("gdz'" [""])
+("gdzb" ["̶ʱ"])
+("gdze" [""])
+("gdzi" ["̶ʲ" ""])
+("gdzj" ["̶ʲ۾" "̶ʽ"])
+("gdzs" [""])
+("gdzy" ["̵"])
+("geba" [""])
+("gebi" ["" "" ""])
+("gebj" ["" ""])
+("gebo" ["첲"])
+("gebx" ["" ""])
+("geci" [""])
+("ged'" [""])
+("geda" [""])
+("gede" [""])
+("gedi" ["" ""])
+("gedr" ["" ""])
+("gee'" "Ǹ")
+("geer" ["" ""])
+("geff" [""])
+("gefu" [""])
+("gege" ["" "" "" "" ""])
+("gegh" [""])
+("gego" [""])
+("gehb" [""])
+("gehe" [""])
+("geih" ["質"])
+("geik" ["߶"])
+("geiu" ["" "" ""])
+("gej'" ["߶"])
+("geji" [""])
+("gejq" [""])
+("gejt" [""])
+("geju" ["" "" ""])
+("gejx" [""])
+("gekl" [""])
+("gel'" [""])
+("gelb" ["¥"])
+("geli" [""])
+("geln" [""])
+("gelv" [""])
+("gelx" [""])
+("gelz" [""])
+("gemo" ["Ĥ"])
+("gemy" [""])
+("genv" ["Ů"])
+("gepu" [""])
+("geq'" "")
+("geqd" ["ǽ"])
+("geqm" ["ǳ"])
+("gequ" [""])
+("ger'" "")
+("gere" [""])
+("gerf" ["" ""])
+("gerh" [""])
+("gers" [""])
+("gese" ["ɫ"])
+("gesk" ["ɩ"])
+("gess" [""])
+("geti" [""])
+("getj" ["̳"])
+("geub" [""])
+("geug" [""])
+("geui" ["ʽ"])
+("geuu" [""])
+("geve" [""])
+("gevi" ["" "ְ"])
+("gevs" [""])
+("gew'" "تܪ")
+("gewl" [""])
+("gewu" [""])
+("gewz" ["λ" "λ"])
+("gexd" [""])
+("gexm" [""])
+("gexn" [""])
+("gexw" [""])
+("gexy" [""])
+("geyb" [""])
+("geyh" [""])
+("geyj" [""])
+("geyk" ["ҥ"])
+("geyn" [""])
+("geys" ["ӽ"])
+("gezi" ["" "" "" ""])
+("gezu" [""])
+("gf'" ["㷺"])
+("gfb'" [""])
+("gfba" [""])
+("gfbf" [""])
+("gfbj" [""])
+("gfdi" [""])
+("gfe'" "")
+("gfer" [""])
+("gfgr" [""])
+("gfgy" ["ҵ"])
+("gfh'" ["淶"])
+("gfhk" [""])
+("gfiu" [""])
+("gfj'" ["ķ" ""])
+("gfji" [""])
+("gfjm" [""])
+("gfjn" ["" ""])
+("gfjt" [""])
+("gfju" [""])
+("gfjy" [""])
+("gfl'" ["ķ¯"])
+("gfll" [""])
+("gflq" [""])
+("gfmc" [""])
+("gfmk" ["ë"])
+("gfq'" "")
+("gfqm" ["ǰ"])
+("gfr'" "بݢ")
+("gfsv" [""])
+("gftb" ["ͷ"])
+("gfu'" [""])
+("gfuh" [""])
+("gfui" ["ʽ"])
+("gfuj" ["伫"])
+("gfve" [""])
+("gfvi" [""])
+("gfvu" [""])
+("gfw'" "")
+("gfwh" ["ίԱ"])
+("gfxi" ["ϵ"])
+("gfyn" [""])
+("gfyr" ["Դ"])
+("gfys" ["ɷ޹˾"])
+("gfz'" ["߷"])
+("gfzi" [""])
+("gfzs" [""])
+("gg'" [""])
+("ggbr" [""])
+("ggbu" [""])
+("ggd'" ["й"])
+("ggda" [""])
+("ggdd" [""])
+("ggdi" [""])
+("ggdl" ["ɶ"])
+("ggdo" [""])
+("ggds" [""])
+("gge'" "")
+("ggfj" [""])
+("ggfu" [""])
+("gggi" ["ȹ"])
+("gggk" [""])
+("gggl" ["" ""])
+("ggh'" [""])
+("gghk" [""])
+("gghl" ["߹ٺ»"])
+("gghr" [""])
+("ggih" [""])
+("ggis" [""])
+("ggiu" [""])
+("ggj'" [""])
+("ggjd" [""])
+("ggjj" ["ɸɾ" "" "ؾ"])
+("ggjl" [""])
+("ggjp" [""])
+("ggjw" [""])
+("ggkf" ["ĸ￪"])
+("ggkr" [""])
+("ggky" [""])
+("gglu" [""])
+("ggmj" [""])
+("ggmy" [""])
+("ggnq" ["ţ"])
+("ggp'" ["йƬ" "Ƭ"])
+("ggq'" "")
+("ggqi" ["" ""])
+("ggr'" "")
+("ggsd" ["蹦̵"])
+("ggsi" [""])
+("ggss" [""])
+("ggti" [""])
+("ggtm" [""])
+("ggug" [""])
+("ggui" [""])
+("gguk" [""])
+("ggv'" ["йֽ"])
+("ggvg" [""])
+("ggvh" [""])
+("ggvs" [""])
+("ggwz" ["Ϊ"])
+("ggxg" [""])
+("ggxn" [""])
+("ggxt" ["ϵͳ"])
+("ggxx" ["߸"])
+("ggyb" [""])
+("ggye" [""])
+("ggyi" [""])
+("ggyk" ["Ҫ"])
+("ggyp" [""])
+("ggz'" ["߸"])
+("ggzi" [""])
+("ggzo" [""])
+("ggzw" ["߸"])
+("gh'" ["滮"])
+("ghao" ["۰"])
+("ghbi" ["ֱ" "۱"])
+("ghbj" ["ְ"])
+("ghcl" ["ղ" "ֲ" "Բ"])
+("ghcs" ["մ"])
+("ghd'" ["͵"])
+("ghdi" ["ڵ"])
+("ghdk" ["ֵ"])
+("ghdu" ["ն"])
+("ghdy" ["ֶ"])
+("ghe'" "ڸ")
+("ghg'" ["͹"])
+("ghgh" ["ո"])
+("ghgj" ["ܸ"])
+("ghgo" ["չ"])
+("ghgr" ["ֹ"])
+("ghgu" ["ֹ"])
+("ghgv" ["ֹ"])
+("ghgy" ["иҵ"])
+("ghhk" ["պ"])
+("ghih" ["ٳ"])
+("ghj'" ["̻"])
+("ghjm" ["ս"])
+("ghjn" ["ֽ"])
+("ghkb" ["ۿ"])
+("ghld" [""])
+("ghll" [""])
+("ghly" ["" ""])
+("ghmf" [""])
+("ghmk" ["ë"])
+("ghmu" ["Ŀ"])
+("ghn'" [""])
+("ghpi" [""])
+("ghq'" "Ըոָ׸ظٸܿ")
+("ghqd" ["ǿ"])
+("ghqm" ["ǥ"])
+("ghqn" [""])
+("ghr'" "ָ")
+("ghsi" ["˿"])
+("ghti" [""])
+("ghtl" ["̨"])
+("ghtx" [""])
+("ghuk" [""])
+("ghuv" ["ˮ"])
+("ghv'" ["" ""])
+("ghvf" [""])
+("ghvs" [""])
+("ghvu" [""])
+("ghwj" [""])
+("ghwz" ["λ"])
+("ghxy" [""])
+("ghyi" [""])
+("ghyk" ["Ҫ"])
+("ghyu" [""])
+("ghzi" [""])
+("ghzy" [""])
+("gi'" [""])
+("gib'" ["̱"])
+("gid'" [""])
+("gidr" [""])
+("gidy" ["Ա"])
+("gigj" [""])
+("gih'" [""])
+("gihd" ["ĳ"])
+("gij'" ["۲"])
+("gis'" ["۲"])
+("gisl" [""])
+("giu'" ["߳ʱ" "ʦ"])
+("giuj" [""])
+("giuy" ["ֹҵ"])
+("givv" [""])
+("givx" ["ִ᳹"])
+("givy" [""])
+("gix'" [""])
+("gixm" ["Ŀ"])
+("giy'" ["۲Ա"])
+("gj'" [""])
+("gjai" ["ΰ"])
+("gjb'" ["ұ"])
+("gjbh" ["ʲ"])
+("gjbk" ["ұ"])
+("gjbu" ["ɲ"])
+("gjbv" ["ʱ׼" "ұ׼"])
+("gjbx" ["ɱ"])
+("gjby" ["ɱ"])
+("gjbz" ["ɱ" "ɱ"])
+("gjck" ["ʲ"])
+("gjcl" ["ɲ"])
+("gjcv" ["ɴ"])
+("gjd'" ["о" "ݵ" ""])
+("gjdc" ["ɵ"])
+("gjdh" ["ʵ"])
+("gjdi" ["ʵ"])
+("gjdj" ["ε" "ҵ"])
+("gjdk" ["ϵ" "е"])
+("gjds" ["ж"])
+("gjdv" ["ʵλ"])
+("gjdw" ["ί"])
+("gje'" "˸ϸиѸߦ")
+("gjf'" ["ʷ" "ҷ"])
+("gjff" ["ɷ"])
+("gjfy" ["۷Ӧ" "ʷԺ"])
+("gjg'" ["߸" "ʸ"])
+("gjgd" ["й"])
+("gjge" ["ɸ"])
+("gjgj" ["Ҹ"])
+("gjgl" ["ʹ"])
+("gjgr" ["й"])
+("gjgs" ["ι"])
+("gjgy" ["ʹԼ"])
+("gjh'" [""])
+("gjhe" ["ɺ"])
+("gjhj" ["ɺ"])
+("gjho" ["ɻ"])
+("gjht" ["ֽ"])
+("gjhv" ["ϻ"])
+("gjhw" ["л"])
+("gjie" ["ϳ"])
+("gjig" ["˳"])
+("gjih" ["ϳ"])
+("gjik" ["ϳ"])
+("gjit" ["ɾ"])
+("gjiu" ["д"])
+("gjj'" ["" "ۼ"])
+("gjjd" ["ɽ" "߼׶"])
+("gjjg" ["һ" "һ"])
+("gjji" ["ϼ" "м"])
+("gjjj" ["ʾ" "һ"])
+("gjjl" ["߼" "һ"])
+("gjjm" ["һ"])
+("gjjn" ["ɾ" "Ͻ"])
+("gjjp" ["˾"])
+("gjjq" ["һ"])
+("gjjr" ["ʽ"])
+("gjjt" ["о"])
+("gjju" ["̽" "" "ʾ"])
+("gjjx" ["ʽ"])
+("gjjy" ["ɾ"])
+("gjkh" ["п"])
+("gjkj" ["ҿ"])
+("gjkl" ["п"])
+("gjku" ["ɿ" "ʿ"])
+("gjky" ["Ͽ"])
+("gjl'" ["߽"])
+("gjlc" [""])
+("gjld" [""])
+("gjlj" ["Ͷ" ""])
+("gjlk" [""])
+("gjlm" [""])
+("gjlq" ["" ""])
+("gjlu" ["·" "¶" "·"])
+("gjlx" [""])
+("gjly" [""])
+("gjm'" ["ɽĸ"])
+("gjma" ["" ""])
+("gjmh" ["æ"])
+("gjmk" ["ð"])
+("gjmu" [""])
+("gjmy" ["ó"])
+("gjny" [""])
+("gjpk" [""])
+("gjq'" "ɸʸ˸̸͸Ǭ")
+("gjqg" ["о"])
+("gjql" ["Ȩ"])
+("gjqr" ["Ȫ"])
+("gjqu" [""])
+("gjqy" ["" ""])
+("gjr'" "ɸ")
+("gjrf" [""])
+("gjrj" ["Ⱦ"])
+("gjrk" [""])
+("gjs'" ["߼"])
+("gjsf" ["˽"])
+("gjsi" [""])
+("gjsn" [""])
+("gjsu" [""])
+("gjt'" ["ܽͷ"])
+("gjtj" ["̾"])
+("gju'" ["" ""])
+("gjub" [""])
+("gjue" [""])
+("gjug" [""])
+("gjuh" ["" ""])
+("gjui" [""])
+("gjuj" ["о"])
+("gjuo" ["˵"])
+("gjuu" [""])
+("gjuv" ["֧"])
+("gjv'" [""])
+("gjvb" [""])
+("gjvd" ["ƶ"])
+("gjve" [""])
+("gjvi" ["֧" "֪"])
+("gjvk" [""])
+("gjvw" ["Ž"])
+("gjvy" [""])
+("gjw'" ["߾" ""])
+("gjwt" ["̨"])
+("gjxc" ["У" "Ц"])
+("gjxd" ["" ""])
+("gjxm" [""])
+("gjxn" [""])
+("gjxu" ["ʽ"])
+("gjxx" ["л"])
+("gjxy" [""])
+("gjy'" ["ؽ"])
+("gjyb" [""])
+("gjyh" [""])
+("gjyj" [""])
+("gjyr" ["Ը"])
+("gjys" ["Ԥ"])
+("gjyu" ["Ԥ" "" "Ԫ"])
+("gjyy" ["Ӧ"])
+("gjzb" [""])
+("gjzh" [""])
+("gjzi" ["" ""])
+("gjzk" [""])
+("gjzo" [""])
+("gk'" ["˿"])
+("gkag" ["߰"])
+("gkai" ["߰"])
+("gkao" ["߰"])
+("gkbx" [""])
+("gkcg" ["߲"])
+("gkci" [""])
+("gkda" ["ߴ" "ߴ"])
+("gkdc" ["ߵ"])
+("gkdg" ["ߵ" "ߵ"])
+("gkdh" ["ߵ"])
+("gkdi" ["ߵ" "ߵ"])
+("gkdm" [""])
+("gkdu" ["߶"])
+("gke'" "޻")
+("gkee" ["߶"])
+("gkfa" ["淢"])
+("gkfg" ["߷" "߷"])
+("gkfu" ["߷"])
+("gkfz" [""])
+("gkge" ["߸"])
+("gkgh" ["߸"])
+("gkgk" ["߸"])
+("gkgv" ["߹" ""])
+("gkhj" ["ߺ" "ߺ"])
+("gkhk" [""])
+("gkho" [""])
+("gkhr" ["߻"])
+("gkhu" ["ߺ"])
+("gkhv" ["߻"])
+("gkia" ["߲"])
+("gkib" [""])
+("gkie" ["߳"])
+("gkig" ["߳" ""])
+("gkih" ["߳"])
+("gkij" ["߲"])
+("gkik" ["߳" "߳"])
+("gkji" ["߼" "漱"])
+("gkjm" ["߼" ""])
+("gkjp" ["߾"])
+("gkjq" ["߾"])
+("gkju" ["߾"])
+("gkjw" ["߼"])
+("gkjx" [""])
+("gkjy" ["澯"])
+("gkkh" ["߿"])
+("gkks" ["߿"])
+("gkkw" [""])
+("gklb" ["¥"])
+("gkld" [""])
+("gkli" ["" ""])
+("gklu" ["¯"])
+("gkly" [""])
+("gkmi" ["" ""])
+("gkmm" [""])
+("gkmy" [""])
+("gkng" [""])
+("gknm" [""])
+("gkpj" [""])
+("gkpn" ["Ƶ"])
+("gkpy" ["ƽ"])
+("gkq'" ["" "" "" "" "" "" "غ" "" "ȯ"])
+("gkqd" ["ǿ"])
+("gkqq" [""])
+("gkqy" ["" "ҵ"])
+("gkr'" "ھ۬")
+("gkre" [""])
+("gksg" ["ɮ"])
+("gksi" ["˹"])
+("gkss" [""])
+("gksu" ["" ""])
+("gkub" [""])
+("gkuf" [""])
+("gkug" ["" ""])
+("gkuh" [""])
+("gkui" ["ʾ"])
+("gkuj" ["ɽ"])
+("gkuk" [""])
+("gkv'" ["֮"])
+("gkvb" [""])
+("gkvd" ["״"])
+("gkvh" [""])
+("gkvi" ["ֽ" "֪" "֮"])
+("gkvs" ["" ""])
+("gkwf" [""])
+("gkwj" ["غ"])
+("gkwz" ["λ"])
+("gkx'" [""])
+("gkxc" ["С" "У" "Ч"])
+("gkxd" ["" ""])
+("gkxw" [""])
+("gkxy" [""])
+("gkya" ["ѹ"])
+("gkyh" [""])
+("gkyk" ["ҩ"])
+("gkyn" [""])
+("gkyr" ["ԭ"])
+("gkyu" [""])
+("gkzi" [""])
+("gkzk" [""])
+("gkzu" [""])
+("gl'" [""])
+("glb'" ["ײ" "Ͳ"])
+("glbm" ["ı" "ı"])
+("glby" ["ױ"])
+("glcg" ["ǲ"])
+("gldb" ["ʱ"])
+("gldh" ["õ"])
+("gldk" ["ĵ"])
+("glds" ["Ķ"])
+("gldv" [""])
+("gldy" ["Ķ"])
+("gle'" "")
+("glfq" ["ʷŴ"])
+("glfy" [""])
+("glgd" ["ߵ"])
+("glge" ["ĸ"])
+("glgo" ["Ĺ"])
+("glgr" ["Ĺ"])
+("glgw" ["ª"])
+("glh'" ["ϻ"])
+("glhk" ["Ǻ"])
+("glhr" ["Ļ"])
+("glhv" ["Ļ"])
+("glhw" ["ƻ"])
+("gli'" ["¶"])
+("glih" ["ó"])
+("glj'" ["" "˻"])
+("gljd" ["ý"])
+("gljm" ["Ľ"])
+("gljn" ["Ľ"])
+("gljw" ["ļ"])
+("glkb" ["Ŀ"])
+("glkd" ["ſ"])
+("glko" [""])
+("gll'" [""])
+("glld" [""])
+("gllp" [""])
+("gllt" [""])
+("gllv" [""])
+("glmk" ["׿"])
+("glnm" [""])
+("glpm" ["Ƭ"])
+("glpv" ["Ʒ"])
+("glq'" "")
+("glr'" "ŸƸǸȽؤ")
+("glrf" [""])
+("gls'" [""])
+("glsg" [""])
+("glsi" [""])
+("glsr" [""])
+("glt'" [""])
+("gltm" [""])
+("gltu" [""])
+("gltv" [""])
+("glu'" ["ʯ" "ʯ"])
+("gluh" [""])
+("glui" [""])
+("gluj" [""])
+("gluo" ["˵"])
+("gluu" [""])
+("glvd" ["װ"])
+("glvg" [""])
+("glvh" [""])
+("glvi" [""])
+("glvy" ["" "" ""])
+("glwz" ["Ϊ"])
+("glx'" [""])
+("glxr" ["ѡ"])
+("glxx" ["д"])
+("glxy" [""])
+("glyk" ["Ҫ"])
+("glyr" ["Ԫ"])
+("glyu" [""])
+("glzb" ["ʱ"])
+("glzi" [""])
+("glzk" [""])
+("glzu" [""])
+("glzw" [""])
+("gm'" [""])
+("gmb'" [""])
+("gmd'" [""])
+("gmdv" ["־"])
+("gmg'" ["Ź"])
+("gmgj" ["ɾ" ""])
+("gmh'" [""])
+("gmhy" [""])
+("gmj'" ["" ""])
+("gmjd" [""])
+("gmjh" ["񾭼üƻ"])
+("gmjj" ["񾭼"])
+("gmjr" [""])
+("gmjx" [""])
+("gml'" [""])
+("gmlf" ["þ׷"])
+("gmlh" ["һ"])
+("gmll" [""])
+("gmlu" ["ʿ"])
+("gmq'" ["Ȩ"])
+("gmr'" ["ĭ"])
+("gmrb" ["ձ"])
+("gmsj" [""])
+("gmsy" ["˼"])
+("gmth" ["û"])
+("gmur" [""])
+("gmuv" ["ֵ"])
+("gmvd" [""])
+("gmvf" [""])
+("gmvv" ["ս"])
+("gmwh" ["ίԱ"])
+("gmwx" ["ѧ"])
+("gmx'" [""])
+("gmxk" ["Ŀ࿴"])
+("gmyv" ["־"])
+("gn'" [""])
+("gnb'" ["ũ"])
+("gnf'" ["ɷ" "ڷ"])
+("gnh'" [""])
+("gnhj" ["ũ"])
+("gnj'" [""])
+("gnlm" ["ũ"])
+("gnm'" [""])
+("gnt'" [""])
+("gnvv" ["ս"])
+("gnw'" [""])
+("gnxt" ["̬"])
+("gny'" ["ũҵ"])
+("gnyv" ["ũҵֵܲ"])
+("gobc" [""])
+("gobj" [""])
+("goby" [""])
+("goce" [""])
+("goco" [""])
+("gocv" [""])
+("gode" [""])
+("godh" [""])
+("godi" ["" ""])
+("godk" [""])
+("godo" [""])
+("godr" [""])
+("gods" [""])
+("godu" ["" "" "" ""])
+("goe'" "")
+("gofa" [""])
+("goff" [""])
+("gofg" [""])
+("gofh" [""])
+("gofj" [""])
+("goge" [""])
+("gogj" [""])
+("gogk" [""])
+("gogl" [""])
+("gogo" [""])
+("gogr" [""])
+("gogs" [""])
+("gogu" [""])
+("gohb" [""])
+("gohk" [""])
+("goho" ["" "" ""])
+("gohu" [""])
+("gohv" ["" ""])
+("gohw" ["" ""])
+("goig" ["" ""])
+("goih" [""])
+("goij" [""])
+("gojc" [""])
+("gojd" [""])
+("goji" ["" "" "" "" ""])
+("gojp" [""])
+("gojq" ["" ""])
+("gojw" [""])
+("gojx" ["" ""])
+("gojy" ["" ""])
+("goku" [""])
+("goky" [""])
+("golc" [""])
+("gold" [""])
+("golg" [""])
+("goli" ["" ""])
+("goll" [""])
+("golm" [""])
+("golu" ["¯" "·"])
+("golv" [""])
+("gomf" [""])
+("gomn" ["" ""])
+("gomu" ["ľ" "Ŀ"])
+("gonj" [""])
+("gonm" [""])
+("gonz" [""])
+("gopi" ["Ƥ"])
+("gopn" ["Ʒ"])
+("goq'" "")
+("goqc" [""])
+("goqi" ["" "" ""])
+("goqu" ["ȥ"])
+("goqy" ["" ""])
+("gor'" "")
+("gorb" [""])
+("gorf" ["" "" ""])
+("gorj" ["Ȼ"])
+("goso" [""])
+("gosv" [""])
+("gotb" ["ͷ"])
+("goth" [""])
+("goti" [""])
+("gotl" ["̨"])
+("gotu" [""])
+("goub" [""])
+("gouf" [""])
+("goug" ["ʣ"])
+("goui" ["" "" "ʵ" "ʧ" "ʱ"])
+("gouk" [""])
+("goul" ["ɸ"])
+("gouu" ["" ""])
+("gove" ["" ""])
+("govf" [""])
+("govh" [""])
+("govi" ["֦" "֭"])
+("govl" ["ծ"])
+("govs" [""])
+("gow'" "")
+("gowf" ["" ""])
+("gowh" ["" ""])
+("gowl" [""])
+("gowu" [""])
+("goxd" [""])
+("goxi" ["ϸ"])
+("goxn" [""])
+("goxt" ["ѧ"])
+("goyb" [""])
+("goye" ["ҹ"])
+("goyn" [""])
+("goyr" ["԰"])
+("goys" [""])
+("goyu" ["" ""])
+("goyy" ["Ӫ" "Ӭ" "Ӳ"])
+("gozi" [""])
+("gozl" [""])
+("gozz" [""])
+("gpbh" [""])
+("gpbm" [""])
+("gpdj" [""])
+("gpds" [""])
+("gpe'" "")
+("gpfj" [""])
+("gpfx" ["׷"])
+("gpgp" [""])
+("gpkl" [""])
+("gplp" [""])
+("gpr'" "")
+("gpth" [""])
+("gpts" ["Ͳ"])
+("gpvu" [""])
+("gpx'" [""])
+("gpzi" ["" "" ""])
+("gq'" ["ȥ"])
+("gqd'" ["ǿ"])
+("gqdj" ["ȫ"])
+("gqgx" ["Ⱥϵ"])
+("gqj'" [""])
+("gql'" ["ȥ"])
+("gqt'" [""])
+("gqty" ["Ա"])
+("gqwd" ["¶"])
+("gqx'" [""])
+("gr'" [""])
+("grb'" ["ٰ"])
+("grbi" ["ر"])
+("grbj" ["ٰ"])
+("grbk" ["ܱ"])
+("grby" ["ٱ"])
+("grce" ["۲"])
+("grcl" ["ײ" "ܲ"])
+("grdi" ["ٵ"])
+("grdk" ["ܵ"])
+("grdl" ["ܴ"])
+("grdm" ["۵"])
+("grds" ["ض"])
+("grdu" ["˵ʧ" "ٶ"])
+("gre'" "ܹݸ")
+("grfh" ["ٷ"])
+("grfj" ["߷"])
+("grfu" ["ٸ"])
+("grgd" ["۹"])
+("grgj" ["۸"])
+("grgl" [""])
+("grhw" ["ٻ"])
+("grhy" ["ػ"])
+("gria" ["۲"])
+("grid" ["ش"])
+("grie" ["޳" "᳹"])
+("grih" ["ٳ"])
+("grir" ["ᴩ"])
+("grjc" ["ܽ" "ܽ"])
+("grjd" ["ཬ"])
+("grji" ["ػ"])
+("grjj" ["˽׼"])
+("grjm" ["ؼ"])
+("grjn" ["ؽ"])
+("grjp" ["پ" "ھ"])
+("grjt" ["پ"])
+("grjw" ["ټ" "ټ" "ܼ"])
+("grjx" ["ؽ"])
+("grka" ["ؿ"])
+("grkb" ["ؿ"])
+("grkj" ["ۿ"])
+("grl'" ["Ⱦ"])
+("grlc" [""])
+("grli" ["" "" ""])
+("grlm" [""])
+("grls" [""])
+("grlu" ["·"])
+("grly" [""])
+("grmf" [""])
+("grmo" ["Ħ"])
+("grmu" ["ľ" "ľ"])
+("grng" [""])
+("grnm" [""])
+("grnz" [""])
+("grq'" ["" "" "" "" "" "" "" "ݸ" "" "" ""])
+("grqi" [""])
+("grqu" [""])
+("grqw" ["ؿ"])
+("grqx" [""])
+("grr'" "ڹ۹޹߹")
+("grrb" ["ձ"])
+("grrf" [""])
+("grsi" ["˾"])
+("grt'" [""])
+("grtb" ["ͷ" "ͷ"])
+("grtm" [""])
+("grts" ["ͨ"])
+("grua" ["ɴ"])
+("gruh" ["" ""])
+("grui" [""])
+("gruu" ["" "" "" ""])
+("gruv" ["˰" "ˮ"])
+("grvd" ["ׯ"])
+("grvh" ["ݳ"])
+("grvi" ["ְ" ""])
+("grvk" [""])
+("grvs" [""])
+("grvu" ["ע" "ע" "ע"])
+("grvy" [""])
+("grw'" [""])
+("grwh" [""])
+("grwl" [""])
+("grxf" [""])
+("grxi" ["ϵ" "ϴ"])
+("grxm" [""])
+("grxn" [""])
+("grxw" ["Ͻ"])
+("grxy" [""])
+("gry'" [""])
+("grya" ["Ѻ"])
+("gryd" ["˶"])
+("gryk" ["Ҥ"])
+("gryn" [""])
+("gryr" ["Ա"])
+("grys" ["" ""])
+("gryu" [""])
+("grz'" [""])
+("grzi" ["" "" ""])
+("grzl" [""])
+("grzo" [""])
+("gs'" ["˾"])
+("gsan" ["" ""])
+("gsbf" [""])
+("gsbi" [""])
+("gsbk" ["" ""])
+("gsbu" [""])
+("gsby" [""])
+("gsbz" [""])
+("gsci" [""])
+("gscp" [""])
+("gsd'" [""])
+("gsda" [""])
+("gsdc" [""])
+("gsdh" [""])
+("gsdi" ["" ""])
+("gsdj" ["˹"])
+("gsdk" [""])
+("gsdm" ["" ""])
+("gsdr" ["" ""])
+("gsdu" ["" ""])
+("gse'" "")
+("gsee" [""])
+("gsf'" ["˾"])
+("gsfa" [""])
+("gsff" ["" "" ""])
+("gsfg" [""])
+("gsfj" [""])
+("gsfu" ["" ""])
+("gsfz" [""])
+("gsg'" ["ٸ"])
+("gsgk" [""])
+("gsgo" [""])
+("gsgr" ["" ""])
+("gsgs" ["" ""])
+("gsgu" [""])
+("gshb" [""])
+("gshe" ["" ""])
+("gshj" [""])
+("gshk" [""])
+("gshl" ["" ""])
+("gshv" ["" ""])
+("gshy" ["˽Ӫ"])
+("gsia" [""])
+("gsif" [""])
+("gsig" ["" ""])
+("gsih" ["" ""])
+("gsii" [""])
+("gsij" ["" ""])
+("gsil" [""])
+("gsiu" ["" ""])
+("gsjd" [""])
+("gsji" ["" "" "" "" ""])
+("gsjm" ["" ""])
+("gsjn" [""])
+("gsjt" [""])
+("gsju" ["" "" ""])
+("gsjw" [""])
+("gsjy" [""])
+("gskd" [""])
+("gske" ["" "" ""])
+("gskl" [""])
+("gskr" [""])
+("gsl'" [""])
+("gsld" [""])
+("gsli" ["" "" "" "" "" ""])
+("gslk" [""])
+("gslp" [""])
+("gslq" [""])
+("gslu" ["·"])
+("gslv" [""])
+("gsly" [""])
+("gsmf" [""])
+("gsmn" [""])
+("gsmu" ["Ķ" "Ĺ"])
+("gsmy" ["" ""])
+("gsn'" [""])
+("gsng" [""])
+("gsnr" ["ů"])
+("gsns" ["ũ"])
+("gsnv" ["Ů"])
+("gspn" ["Ʒ"])
+("gspo" ["" ""])
+("gspu" [""])
+("gspy" ["ƽ"])
+("gsq'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "˿Ȧ"])
+("gsqc" [""])
+("gsqd" ["ǽ"])
+("gsqi" [""])
+("gsqm" ["Ǯ"])
+("gsqq" [""])
+("gsqu" ["" "ȡ"])
+("gsqy" ["" ""])
+("gsr'" ["" "" "" ""])
+("gsrf" ["" "" ""])
+("gsri" [""])
+("gsrj" ["Ȼ"])
+("gssi" ["˽" "˾"])
+("gssu" [""])
+("gstb" ["ͷ"])
+("gsth" [""])
+("gsts" ["ͨ" "ͬ"])
+("gstv" [""])
+("gsty" ["͢"])
+("gsu'" ["ʡ" "˿"])
+("gsub" ["" ""])
+("gsue" ["" ""])
+("gsuf" ["" ""])
+("gsug" ["" ""])
+("gsuh" ["" ""])
+("gsui" ["ʱ" "" "" "ʹ" "ʽ" "" ""])
+("gsup" ["˳"])
+("gsuu" [""])
+("gsvf" [""])
+("gsvg" ["" "" "֤"])
+("gsvh" [""])
+("gsvi" ["" "ְ" "ְ"])
+("gsvj" ["ռ"])
+("gsvl" ["ծ"])
+("gsvr" ["ת"])
+("gsvs" ["" ""])
+("gsvu" [""])
+("gswf" [""])
+("gswu" ["" ""])
+("gswz" ["ά"])
+("gsxc" ["Ч" "Ч" ""])
+("gsxd" [""])
+("gsxi" ["ϲ"])
+("gsxm" ["" ""])
+("gsxp" ["ѫ"])
+("gsxu" ["" ""])
+("gsxw" [""])
+("gsxy" ["" "" ""])
+("gsy'" [""])
+("gsyb" ["" "" ""])
+("gsye" ["ҵ"])
+("gsyh" ["" ""])
+("gsyi" ["" "" ""])
+("gsyj" [""])
+("gsyp" [""])
+("gsyr" ["Ԫ" "԰"])
+("gsys" ["" ""])
+("gsyu" ["Ԣ"])
+("gsyy" ["Ӧ" "Ӫ"])
+("gszi" ["" "" ""])
+("gszo" [""])
+("gszu" [""])
+("gszz" [""])
+("gtfy" ["巢"])
+("gtg'" ["̼"])
+("gtgl" ["ͬ"])
+("gth'" ["廧"])
+("gthd" ["컻"])
+("gthm" ["ͷ"])
+("gthr" ["컯"])
+("gths" ["ͬ"])
+("gtjj" ["徭"])
+("gtkl" ["̸"])
+("gtm'" ["" ""])
+("gtrl" ["ȼ"])
+("gtsv" [""])
+("gtt'" ["ͬ" "ͺͺ"])
+("gtui" ["ͬг"])
+("gtup" ["ͷʳƷ"])
+("gtuy" ["ֹҵ"])
+("gty'" ["ͬ"])
+("gtz'" [""])
+("gu'" ["ʽ"])
+("guba" ["Ű"])
+("gubf" ["ɱ"])
+("guce" [""])
+("guch" ["Ȳ"])
+("guci" ["ʴ"])
+("guck" ["Ȳ"])
+("gudg" ["ٹ"])
+("gudi" ["ʵ"])
+("gudj" ["µ" "̵"])
+("gudl" ["" "Ŵ" ""])
+("gudm" ["ŵ"])
+("guds" ["Ķ" "Ŷ" "ɶ"])
+("gudu" ["" "¶" "Ŷ"])
+("gudy" ["̶"])
+("gue'" "ĹŹƹǹȹɼڬ")
+("guer" ["¶" "ʶ"])
+("guff" ["ɷ"])
+("gufg" ["ķ"])
+("gufu" ["" "ø"])
+("gug'" ["ʹ"])
+("guge" [""])
+("gugj" ["Ǹ"])
+("gugo" ["ʹ"])
+("gugs" ["ʹ" "͹"])
+("gugu" ["" "ù"])
+("gugy" ["ʽ" "Ź"])
+("guh'" ["绯" "ʽ" "ʱ"])
+("guhv" ["ǻ"])
+("guhw" ["Ż" "ǻ" "̻"])
+("guig" ["ų" "ȳ"])
+("guih" ["ʳ"])
+("guip" ["̴"])
+("guiv" ["Ĵ"])
+("guj'" ["̽"])
+("guji" ["" "ż" "ż" "˼" "˼"])
+("gujn" ["Ž" "ɽ"])
+("gujp" ["¾"])
+("gujq" ["ž" "ʾ"])
+("guju" ["ʾ"])
+("gujw" ["" "Ǽ"])
+("gujx" ["ǽ"])
+("guke" ["ǿ" "˿"])
+("guku" ["¿"])
+("gul'" [""])
+("gulb" ["¥"])
+("gulc" [""])
+("guld" [""])
+("guli" ["" "" ""])
+("gulk" [""])
+("gull" [""])
+("gulu" [""])
+("gulv" [""])
+("gulz" [""])
+("gum'" ["ʲô"])
+("guma" [""])
+("gumo" ["Ĥ"])
+("gumu" ["ĸ"])
+("gund" [""])
+("guns" ["ũ"])
+("gup'" [""])
+("gupc" ["Ʊ"])
+("guq'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("guqi" [""])
+("guqr" ["ȫ"])
+("guqx" [""])
+("gur'" "ʹ˹̹")
+("gurb" [""])
+("gurf" ["" ""])
+("gurj" ["Ȼ"])
+("gurk" ["ʣ˿"])
+("gusr" [""])
+("gusv" [""])
+("gutb" ["ͷ"])
+("guti" [""])
+("gutl" ["̬"])
+("gutu" [""])
+("guu'" ["ʡ" ""])
+("guub" [""])
+("guui" ["ʫ" ""])
+("guuj" ["ɽ"])
+("guuu" [""])
+("guve" [""])
+("guvh" ["" ""])
+("guvi" ["֪" "ִ"])
+("guvu" [""])
+("guw'" ["" ""])
+("guwf" ["" ""])
+("guwl" ["ɱ"])
+("guwo" [""])
+("guwu" ["" ""])
+("gux'" [""])
+("guxd" ["" ""])
+("guxi" ["Ϣ" "Ϣ"])
+("guxx" [""])
+("guy'" ["ҵ"])
+("guya" [""])
+("guyb" [""])
+("guye" ["ү"])
+("guyi" [""])
+("guyj" [""])
+("guyl" ["һ¥"])
+("guyr" ["Ա"])
+("guys" ["Ӷ"])
+("guyt" [""])
+("guyu" [""])
+("guz'" ["ɽ"])
+("guzi" [""])
+("guzk" [""])
+("guzu" [""])
+("gv'" [""])
+("gvan" ["鰸"])
+("gvbi" [""])
+("gvbm" [""])
+("gvbn" [""])
+("gvby" ["鲢"])
+("gvdh" ["鵵"])
+("gvdk" ["" ""])
+("gvdm" [""])
+("gvdv" [""])
+("gvdy" ["涨"])
+("gve'" "")
+("gvfh" ["뷿"])
+("gvfj" ["淶"])
+("gvfu" ["鸽"])
+("gvfz" [""])
+("gvge" [""])
+("gvgo" ["" ""])
+("gvgr" [""])
+("gvgs" ["鹦" "鹫"])
+("gvgu" [""])
+("gvgy" ["ָ" ""])
+("gvh'" ["ݻ"])
+("gvhp" [""])
+("gvhr" ["黹"])
+("gvhw" ["滮" "黯" "" ""])
+("gvig" ["" ""])
+("gviu" [""])
+("gvjd" ["ս׶"])
+("gvji" ["켣" ""])
+("gvjm" [""])
+("gvjq" [""])
+("gvju" ["" ""])
+("gvjx" [""])
+("gvkb" [""])
+("gvli" [""])
+("gvlm" [""])
+("gvln" [""])
+("gvlu" ["·"])
+("gvlv" [""])
+("gvlz" [""])
+("gvmo" ["ģ"])
+("gvna" [""])
+("gvnv" ["Ů"])
+("gvpi" ["Ƥ"])
+("gvpm" ["Ƭ"])
+("gvq'" "")
+("gvqc" [""])
+("gvr'" "Ȳ")
+("gvrf" [""])
+("gvru" [""])
+("gvso" [""])
+("gvsr" [""])
+("gvsu" [""])
+("gvtl" ["̨"])
+("gvu'" ["ָ" "" "ʡ"])
+("gvuf" [""])
+("gvuh" [""])
+("gvui" ["ʯ"])
+("gvuj" ["ɽ"])
+("gvuo" ["˵"])
+("gvup" ["˳"])
+("gvuu" [""])
+("gvva" ["թ"])
+("gvvb" [""])
+("gvvd" ["ƶ"])
+("gvvg" [""])
+("gvvh" [""])
+("gvvi" ["" ""])
+("gvvr" ["ש"])
+("gvvs" [""])
+("gvw'" [""])
+("gvxq" [""])
+("gvxw" [""])
+("gvxy" [""])
+("gvyb" [""])
+("gvyh" [""])
+("gvyr" ["ԭ"])
+("gvyt" ["Լ"])
+("gvyu" ["" ""])
+("gvyv" ["עһ" "հԶ"])
+("gvze" [""])
+("gvzi" ["" ""])
+("gvzk" [""])
+("gvzu" [""])
+("gwbv" ["񲿳"])
+("gwcl" ["Ҳ"])
+("gwd'" ["γ"])
+("gwdk" ["ε"])
+("gwe'" "й")
+("gwff" ["Ϸ"])
+("gwfg" ["η"])
+("gwfu" ["Ѹ"])
+("gwgb" ["ҹ"])
+("gwgw" [""])
+("gwh'" ["ί"])
+("gwhk" ["Һ"])
+("gwhy" [""])
+("gwi'" [""])
+("gwie" ["ҳ"])
+("gwj'" [""])
+("gwjd" ["ල"])
+("gwjl" [""])
+("gwjy" ["Ϊ"])
+("gwlm" [""])
+("gwm'" [""])
+("gwmj" ["Ĩ"])
+("gwmm" [""])
+("gwmu" ["ĸ"])
+("gwmy" [""])
+("gwnm" [""])
+("gwpm" ["Ƭ"])
+("gwq'" ["" "" "" "" "" "" "" ""])
+("gwr'" "ҹڴ")
+("gwtb" ["ͷ"])
+("gwtu" ["ͼ"])
+("gwuy" ["˧"])
+("gwwy" ["ίԱ"])
+("gwy'" ["Ա" "Ժ"])
+("gwyj" [""])
+("gwyl" ["Ժ"])
+("gwzi" ["" ""])
+("gwzv" ["λ"])
+("gx'" ["ϵ"])
+("gxb'" ["Ĳ"])
+("gxbl" ["ѧ"])
+("gxd'" ["" ""])
+("gxdj" ["Ķ"])
+("gxdl" ["Զ"])
+("gxg'" [""])
+("gxgv" ["а"])
+("gxh'" ["ϵ"])
+("gxhd" ["»"])
+("gxhu" [""])
+("gxhx" ["Ժ͸"])
+("gxij" [""])
+("gxj'" [""])
+("gxl'" [""])
+("gxq'" ["ѩ"])
+("gxqu" ["" ""])
+("gxqy" ["Ը"])
+("gxru" ["ʶ"])
+("gxt'" ["̨"])
+("gxtx" ["ͨ"])
+("gxu'" ["ʡ"])
+("gxvz" ["׳"])
+("gxy'" ["" "Ѫѹ" ""])
+("gxyd" ["ֶ"])
+("gxyx" [""])
+("gy'" [""])
+("gyb'" ["ҵ"])
+("gybm" ["ҵ"])
+("gybq" ["ⲻȥ"])
+("gyci" ["Ӳд"])
+("gyd'" ["ѹ"])
+("gydl" ["Ӧ" "һ"])
+("gydu" ["ҵ"])
+("gydx" ["ҵѧ"])
+("gye'" "")
+("gyg'" ["ҵ"])
+("gygm" ["ҵ"])
+("gygp" ["չ"])
+("gygy" ["Թ"])
+("gyh'" ["ҵ" "л"])
+("gyhq" [""])
+("gyhw" ["ֻ" ""])
+("gyix" ["ճ"])
+("gyj'" [""])
+("gyjd" ["ҵ"])
+("gyli" [""])
+("gylz" [""])
+("gymu" [""])
+("gyn'" [""])
+("gyni" ["Ӫũ"])
+("gyp'" ["ҵƷ" "Ʒ"])
+("gypl" ["Ƶ"])
+("gyq'" ["" "" ""])
+("gyqq" ["ǧ"])
+("gyqy" ["Ӫҵ"])
+("gyr'" "")
+("gytx" ["ҵϵ"])
+("gyu'" ["ʽ" "" "Լ" ""])
+("gyui" [""])
+("gyuy" ["ҵ" "Ӫҵ"])
+("gyv'" ["" ""])
+("gyvh" [""])
+("gyvx" ["ҵս" "ҵ"])
+("gyw'" [""])
+("gywj" [""])
+("gywu" [""])
+("gyx'" ["ѹ"])
+("gyxn" [""])
+("gyyl" ["ҵԭ"])
+("gyzi" [""])
+("gyzl" [""])
+("gz'" [""])
+("gzc'" [""])
+("gzd'" [""])
+("gze'" "")
+("gzf'" [""])
+("gzg'" ["ָ"])
+("gziu" [""])
+("gzj'" ["" "Ӽ"])
+("gzjb" ["ʼ"])
+("gzl'" [""])
+("gzld" ["Ͷ"])
+("gzm'" [""])
+("gzni" [""])
+("gznn" [""])
+("gzq'" [""])
+("gzr'" [""])
+("gzrf" [""])
+("gzta" ["" "" ""])
+("gzu'" ["" ""])
+("gzv'" ["" ""])
+("gzvd" ["ƶ"])
+("gzvv" [""])
+("gzwo" [""])
+("gzwv" ["Ϊ"])
+("gzwy" ["Ӫ"])
+("gzx'" [""])
+("gzxy" ["Ҫ"])
+("gzy'" [""])
+("gzyi" [""])
+("gzyu" [""])
+("gzze" ["ܶ"])
+("h" "")
+("hada" [""])
+("hae'" "")
+("haha" [""])
+("haji" [""])
+("hake" [""])
+("hali" [""])
+("hama" [""])
+("hami" [""])
+("haq'" "")
+("har'" "")
+("hash" ["ɣ"])
+("hasz" ["ǰ"])
+("hate" [""])
+("haw'" "Ϻ")
+("hax'" [""])
+("hb'" ["ϲ"])
+("hbb'" ["ڰ屨"])
+("hbbm" [""])
+("hbbo" [""])
+("hbbu" [""])
+("hbbz" ["" ""])
+("hbd'" ["޲"])
+("hbdl" [""])
+("hbdp" [""])
+("hbdu" ["ڰ׵" ""])
+("hbe'" "")
+("hber" [""])
+("hbfh" [""])
+("hbgf" [""])
+("hbgo" [""])
+("hbgr" [""])
+("hbgs" [""])
+("hbgv" [""])
+("hbh'" ["ò" "᲻"])
+("hbhj" [""])
+("hbhl" ["һ"])
+("hbhr" [""])
+("hbhv" [""])
+("hbie" [""])
+("hbif" [""])
+("hbix" [""])
+("hbj'" ["󱸾"])
+("hbjc" ["" ""])
+("hbji" ["" ""])
+("hbjm" [""])
+("hbjn" [""])
+("hbk'" ["̱"])
+("hblc" [""])
+("hbld" [""])
+("hbli" [""])
+("hbll" [""])
+("hbls" [""])
+("hblt" ["" "ͨ"])
+("hblu" ["·"])
+("hbmf" [""])
+("hbmm" [""])
+("hbmu" ["ĸ"])
+("hbnc" [""])
+("hbnk" [""])
+("hbnm" [""])
+("hbpl" [""])
+("hbpy" ["ƽԭ"])
+("hbqc" [""])
+("hbqi" ["" ""])
+("hbqn" [""])
+("hbqy" ["ַԼ"])
+("hbr'" "ܩ")
+("hbrf" ["" ""])
+("hbss" [""])
+("hbtb" ["ͷ" "ͷ" "ͷ"])
+("hbth" [""])
+("hbtl" ["̨"])
+("hbtm" [""])
+("hbtu" [""])
+("hbtv" [""])
+("hbu'" ["ӱʡ" "ʡ"])
+("hbub" [""])
+("hbue" [""])
+("hbuf" [""])
+("hbug" ["" ""])
+("hbui" ["ʵ" "" ""])
+("hbv'" ["˱ը"])
+("hbvb" [""])
+("hbve" [""])
+("hbvf" [""])
+("hbvi" ["֫"])
+("hbvu" [""])
+("hbw'" "")
+("hbwz" [""])
+("hbxc" ["Ч"])
+("hbxd" [""])
+("hbxr" ["ѡ"])
+("hbxt" ["ѧ"])
+("hbxu" [""])
+("hbxy" [""])
+("hby'" ["ҹ"])
+("hbyi" [""])
+("hbyj" [""])
+("hbyr" ["Ժ"])
+("hbyu" [""])
+("hbyy" [""])
+("hbzb" ["ʱ"])
+("hbzi" [""])
+("hbzj" ["ʽ"])
+("hbzo" [""])
+("hczm" ["ģ"])
+("hd'" [""])
+("hdan" ["ǰ"])
+("hdb'" ["˵"])
+("hdba" ["ư"])
+("hdbj" ["ư"])
+("hdbk" ["ѱ"])
+("hdbl" ["ư"])
+("hdd'" ["ö˶" "ڶ"])
+("hddb" ["ƶ"])
+("hddh" ["ε"])
+("hddi" ["ĵ" "ʵ"])
+("hddj" ["ĵ"])
+("hddk" ["ĵ" "Ƶ"])
+("hdds" ["ζ"])
+("hde'" "λϻл")
+("hdfg" ["Ʒ"])
+("hdfz" ["ķ"])
+("hdgh" ["Ƹ"])
+("hdgr" ["ʹ"])
+("hdgs" ["ʹ"])
+("hdgw" ["ƹ"])
+("hdhb" ["ʺ"])
+("hdhd" ["̻" "λ"])
+("hdhe" ["ƺ"])
+("hdhl" ["ƺ"])
+("hdho" ["̻"])
+("hdhp" ["ƻ"])
+("hdhu" ["" ""])
+("hdhw" ["ƻ" "ѻ"])
+("hdig" ["ѳ"])
+("hdik" ["ʳ"])
+("hdis" ["ȳ"])
+("hdiu" ["̶ܴ"])
+("hdj'" [""])
+("hdjc" ["Ľ"])
+("hdjn" ["ƽ"])
+("hdjq" ["ƾ"])
+("hdjw" ["ʼ"])
+("hdks" ["̿"])
+("hdl'" ["ĵ" "˶"])
+("hdla" [""])
+("hdld" [""])
+("hdli" [""])
+("hdlm" [""])
+("hdlr" [""])
+("hdls" ["鶼˹" ""])
+("hdly" [""])
+("hdm'" [""])
+("hdma" [""])
+("hdmc" ["Ħ"])
+("hdmh" ["æ"])
+("hdmo" ["Į"])
+("hdmq" [""])
+("hdmz" ["÷"])
+("hdn'" [""])
+("hdnm" [""])
+("hdnq" ["ţ"])
+("hdp'" ["Ƶ"])
+("hdpm" ["Ƭ"])
+("hdpu" ["" ""])
+("hdq'" ["" "" "" ""])
+("hdqc" [""])
+("hdqr" ["Ȩ"])
+("hdr'" ["" "ܶ"])
+("hdrh" [""])
+("hdrj" ["Ȼ"])
+("hdse" ["ɫ"])
+("hdsr" [""])
+("hdth" [""])
+("hdti" [""])
+("hdtm" [""])
+("hdts" ["ͭ"])
+("hdtu" [""])
+("hdu'" ["ʽ"])
+("hduh" [""])
+("hdui" ["ʯ" ""])
+("hduj" ["ɽ" "ɽ"])
+("hduu" [""])
+("hdv'" ["վ"])
+("hdvb" [""])
+("hdvd" ["ׯ"])
+("hdvh" [""])
+("hdvi" [""])
+("hdvs" ["" ""])
+("hdw'" "ƻǻȻɻʻ˻̻")
+("hdwu" [""])
+("hdxm" [""])
+("hdxw" ["Ϊ"])
+("hdxy" [""])
+("hdy'" [""])
+("hdyb" [""])
+("hdye" ["Ұ"])
+("hdyh" [""])
+("hdyi" [""])
+("hdyj" [""])
+("hdyn" [""])
+("hdyr" ["ԭ"])
+("hdyu" [""])
+("hdzi" [""])
+("hdzu" [""])
+("heai" ["Ͱ"])
+("hean" ["Ӱ"])
+("heb'" [""])
+("hebi" ["α"])
+("hebk" ["ɰ"])
+("hebu" ["β" "ʵ" ""])
+("heby" ["ϲ"])
+("hebz" ["ӱ"])
+("hecg" [""])
+("heci" ["ش"])
+("hecl" ["Ȳ" "Ȳ"])
+("hecp" ["ʹ"])
+("hedg" ["ε"])
+("hedi" ["ӵ"])
+("hedk" ["ȵ" "ӵ"])
+("hedm" ["ص"])
+("heds" ["Ӷ"])
+("hedv" ["˶"])
+("hedy" ["˶"])
+("heer" ["ն"])
+("hefa" ["Ϸ"])
+("hefg" ["ͷ"])
+("hefh" ["η"])
+("hefu" ["ͷ"])
+("hefz" ["Ϸ"])
+("hegb" ["ӹ"])
+("hege" ["ϸ"])
+("hego" ["ι"])
+("hegs" ["ӹ"])
+("hegu" ["Ϲ" ""])
+("hehe" ["Ǻ" "ɺ" "պ"])
+("hehk" ["ͺ"])
+("heho" ["ϻ"])
+("hehr" ["ͻ" "ϻ"])
+("hehu" ["Ϻ"])
+("hehv" ["ͻ"])
+("hehw" ["ɻ"])
+("heia" ["Ȳ" "˲"])
+("heid" ["Ӵ"])
+("heig" ["ϳ" "ϳ"])
+("heih" ["γ" "ϳ"])
+("heii" ["ǳ"])
+("heip" ["ʹ"])
+("heir" ["Ӵ"])
+("heiu" ["δ"])
+("heji" ["ϼ" "ϼ"])
+("hejm" ["Ӽ"])
+("hejn" ["Ͻ"])
+("hejq" ["Ⱦ"])
+("heju" [";"])
+("hejw" ["ͼ"])
+("hejx" ["ͽ"])
+("hejy" [";"])
+("hekb" ["Ͽ" "ӿ"])
+("hekd" ["ο"])
+("heku" ["ο"])
+("heli" ["" ""])
+("helj" [""])
+("helq" ["" ""])
+("hels" ["£"])
+("hemb" ["ı"])
+("hemc" [""])
+("heml" [""])
+("hemm" [""])
+("hemo" ["Ĥ"])
+("hemu" [""])
+("hemz" ["ú"])
+("heni" ["" ""])
+("henj" [""])
+("henn" [""])
+("henr" ["ů"])
+("henz" [""])
+("hepj" [""])
+("hepl" [""])
+("hepy" ["ƽ"])
+("heq'" "Ǻڭ")
+("heqi" ["" ""])
+("heqm" ["Ƿ"])
+("heqn" [""])
+("heqp" ["Ⱥ"])
+("hequ" [""])
+("her'" "Ⱥɺͺκպֺ׺")
+("herf" [""])
+("herj" ["Ȼ"])
+("heru" [""])
+("hese" ["ɫ"])
+("hesi" ["˹"])
+("hesr" ["" "" ""])
+("heta" [""])
+("hetb" ["ͷ"])
+("heth" [""])
+("hetj" ["̸" "̲"])
+("hetk" ["" ""])
+("hetm" [""])
+("hets" ["ͬ"])
+("heuf" [""])
+("heug" [""])
+("heuh" [""])
+("heui" ["ʵ" "ʫ" "ʱ" ""])
+("heuj" ["" "ɽ"])
+("heup" ["˳"])
+("heuu" ["" ""])
+("heuv" ["ˮ" "ˮ"])
+("heva" ["բ"])
+("hevb" [""])
+("hevg" [""])
+("hevi" ["ֹ"])
+("hevp" ["׼"])
+("hevs" ["" ""])
+("hevu" [""])
+("hew'" "ɺʺ˺̺ͺκϺкѺҺӺ")
+("hewf" [""])
+("hewh" [""])
+("hewo" [""])
+("hewy" ["϶Ϊһ"])
+("hewz" ["ν"])
+("hexi" ["" "ϲ"])
+("hexj" ["ն"])
+("hexm" [""])
+("hexn" ["" ""])
+("hexx" ["г" "з"])
+("heye" ["Ҷ"])
+("heyi" ["" "" "" "" ""])
+("heyj" [""])
+("heys" [""])
+("heyt" ["Լ"])
+("heyy" ["Ӫ" "Ӱ"])
+("hezb" [""])
+("hezh" [""])
+("hezi" ["" "" "" "" ""])
+("hezl" ["" ""])
+("hezo" [""])
+("hf'" ["Ϸ"])
+("hfbu" ["ܲ"])
+("hfda" ["ܴ"])
+("hfdi" ["ܵ"])
+("hfdo" ["ܶ"])
+("hfdr" ["ܶ"])
+("hfdu" ["ݶ"])
+("hfdv" ["Ϸ" "ܶ"])
+("hfdx" ["ѧ"])
+("hfe'" "ܺ")
+("hfg'" ["۹"])
+("hfgd" ["ܹ"])
+("hfgk" ["ܸ"])
+("hfhf" ["ܺ" "ݺ"])
+("hfhk" ["ܺ"])
+("hfhy" ["ܻ"])
+("hfia" ["ܲ"])
+("hfih" ["ܳ"])
+("hfji" ["ۼ"])
+("hfjq" ["ܾ"])
+("hfky" ["ܿ"])
+("hfl'" [""])
+("hfmj" [""])
+("hfnj" [""])
+("hfpo" [""])
+("hfqd" ["ǿ"])
+("hfqy" ["ϷȨ"])
+("hfr'" "")
+("hfs'" ["ʸ"])
+("hftb" ["͸"])
+("hfu'" ["Ϸ"])
+("hfub" [""])
+("hfuf" [""])
+("hfuk" [""])
+("hfvw" ["ץ"])
+("hfw'" ["" "ӷ"])
+("hfwj" [""])
+("hfxc" ["С"])
+("hfxd" [""])
+("hfxn" [""])
+("hfy'" ["˷Ӧ" "ӷ"])
+("hfyb" [""])
+("hfyd" ["˷Ӧ"])
+("hfyr" ["Զ"])
+("hfz'" [""])
+("hfzk" [""])
+("hg'" ["ϸ"])
+("hgbk" ["ᱩ"])
+("hgbo" ["Შ"])
+("hgcl" [""])
+("hgd'" [""])
+("hgdg" [""])
+("hgdu" [""])
+("hgdy" ["㶨"])
+("hge'" ["ڸ"])
+("hgfh" [""])
+("hgfu" [""])
+("hgg'" [""])
+("hggr" [""])
+("hghg" ["ߺ"])
+("hgi'" [""])
+("hgj'" ["ɻ"])
+("hgjw" ["" ""])
+("hgkw" [""])
+("hgld" ["" "" ""])
+("hgli" [""])
+("hglq" [""])
+("hgmj" [""])
+("hgpl" [""])
+("hgq'" "ߺ")
+("hgqx" [""])
+("hgr'" "")
+("hgs'" ["" "ݸ˹"])
+("hgsk" ["ɨ"])
+("hgth" [""])
+("hgug" [""])
+("hgui" ["ʪ"])
+("hguj" ["ɽ" "ɽ" ""])
+("hguu" [""])
+("hgvb" [""])
+("hgvi" ["ֱ"])
+("hgvy" ["֮"])
+("hgw'" "޿")
+("hgwf" [""])
+("hgwl" ["عζ"])
+("hgws" ["Ϊ˽"])
+("hgwy" ["øԶ"])
+("hgxd" [""])
+("hgxm" [""])
+("hgxy" ["" ""])
+("hgy'" [""])
+("hgya" ["ѹ"])
+("hgyb" ["˹ҵ"])
+("hgyd" ["˶"])
+("hgyh" [""])
+("hgym" [""])
+("hgzu" [""])
+("hh'" ["ܺ"])
+("hhbc" [""])
+("hhbj" [""])
+("hhd'" ["ںڵ" "" ""])
+("hhdd" ["ƺƵ"])
+("hhdk" ["" ""])
+("hhfd" ["𻨷ŵ"])
+("hhhl" [""])
+("hhht" ["ͺ"])
+("hhhv" ["л"])
+("hhhw" ["л"])
+("hhig" [""])
+("hhir" [""])
+("hhj'" ["ϼ" ""])
+("hhjg" ["Ͻṹ"])
+("hhjm" ["м"])
+("hhju" ["о"])
+("hhjw" ["м"])
+("hhkb" [""])
+("hhks" [""])
+("hhlj" ["Ϻ߼"])
+("hhll" ["" ""])
+("hhlu" ["·"])
+("hhlx" [""])
+("hhm'" [""])
+("hhn'" [""])
+("hhq'" ["" ""])
+("hhqy" [""])
+("hhr'" "")
+("hhs'" ["˻" "ƺɫ" ""])
+("hhsu" [""])
+("hhtm" [""])
+("hhu'" [""])
+("hhui" [""])
+("hhvb" [""])
+("hhvj" ["ս"])
+("hhw'" ["" "" "" "" "" "" "" "" ""])
+("hhx'" [""])
+("hhxd" [""])
+("hhxm" [""])
+("hhxy" [""])
+("hhy'" ["ƻ"])
+("hhye" ["ҵ"])
+("hhyp" [""])
+("hhz'" ["ú"])
+("hi'" ["᳡"])
+("hia'" ["ϳɰ"])
+("hii'" ["ڳ"])
+("hil'" ["س"])
+("hiq'" ["" ""])
+("hiry" ["Һ"])
+("hit'" ["ͷ"])
+("hiu'" [""])
+("hiuv" ["ϳ֬"])
+("hiv'" ["վ"])
+("hixj" ["ϳϴӼ" "ϳ"])
+("hixw" ["ϳά"])
+("hj'" ["" ""])
+("hjbh" [""])
+("hjbk" [""])
+("hjcp" [""])
+("hjdi" [""])
+("hjdj" [""])
+("hjdk" [""])
+("hjdl" ["" ""])
+("hjdm" [""])
+("hjds" ["" ""])
+("hje'" "")
+("hjfg" ["" ""])
+("hjfj" [""])
+("hjg'" ["ü" "Ͻ"])
+("hjgb" [""])
+("hjgd" [""])
+("hjgo" [""])
+("hjgs" [""])
+("hjh'" ["üһ"])
+("hjhb" [""])
+("hjhp" [""])
+("hjhu" ["" "仰˵"])
+("hjhw" [""])
+("hjif" [""])
+("hjig" [""])
+("hjik" ["" ""])
+("hjir" [""])
+("hjjc" [""])
+("hjjd" [""])
+("hjji" [""])
+("hjjm" ["" "" ""])
+("hjjw" [""])
+("hjjx" [""])
+("hjka" [""])
+("hjkb" [""])
+("hjl'" ["" "ü"])
+("hjla" [""])
+("hjld" ["½ս" ""])
+("hjlg" [""])
+("hjln" [""])
+("hjlq" [""])
+("hjlu" ["¶"])
+("hjlv" [""])
+("hjmn" [""])
+("hjq'" "")
+("hjqi" [""])
+("hjqy" [""])
+("hjr'" "")
+("hjre" [""])
+("hjrf" [""])
+("hjrj" ["Ȼ"])
+("hjs'" [""])
+("hjt'" ["Ͳ"])
+("hjtb" ["ͷ"])
+("hjtc" [""])
+("hjtl" ["̬"])
+("hjtm" [""])
+("hju'" [""])
+("hjub" [""])
+("hjud" ["ƽʱ"])
+("hjug" [""])
+("hjuu" ["" ""])
+("hjuv" ["˯" "ˮ" "ˮ"])
+("hjv'" [""])
+("hjvs" [""])
+("hjvu" [""])
+("hjw'" "")
+("hjwr" ["Ⱦ"])
+("hjwu" [""])
+("hjwz" [""])
+("hjxc" ["Ц"])
+("hjxi" [""])
+("hjxn" [""])
+("hjxq" [""])
+("hjxt" ["ѧ"])
+("hjxu" [""])
+("hjyb" [""])
+("hjyh" ["" ""])
+("hjyi" ["" "" ""])
+("hjyj" [""])
+("hjyr" ["ԩ" ""])
+("hjyu" [""])
+("hjyy" ["Ӣ"])
+("hjzi" ["" ""])
+("hjzl" [""])
+("hjzu" [""])
+("hk'" ["ܿ"])
+("hkan" [""])
+("hkba" [""])
+("hkbi" ["ñ"])
+("hkbu" ["" "ò"])
+("hkda" ["ƴ"])
+("hkde" ["õ"])
+("hkdh" ["Ƶ"])
+("hkdl" ["ô"])
+("hkdm" ["ĵ"])
+("hkdo" ["ö"])
+("hke'" "ú")
+("hkf'" ["շ"])
+("hkfh" [""])
+("hkfu" ["" ""])
+("hkfz" ["ķ"])
+("hkgb" [""])
+("hkgj" ["ø"])
+("hkgo" ["ù"])
+("hkhg" [""])
+("hkhj" ["ú" ""])
+("hkhk" ["ú" "ƺ"])
+("hkhw" ["" "û"])
+("hkhy" ["û"])
+("hkig" ["ų"])
+("hkii" ["ó"])
+("hkiu" ["ô"])
+("hkjc" ["" "Ž"])
+("hkjn" ["ľ"])
+("hkjq" ["þ"])
+("hkjx" ["" "ƽ"])
+("hkke" ["" "ÿ"])
+("hkkj" ["ÿ"])
+("hklc" [""])
+("hkly" [""])
+("hkma" [""])
+("hkmc" [""])
+("hkmf" [""])
+("hkmi" [""])
+("hkmj" ["ĸ"])
+("hkmk" ["ë"])
+("hkml" [""])
+("hkpy" [""])
+("hkq'" "޶")
+("hkqd" ["ǿ"])
+("hkqi" [""])
+("hkqq" [""])
+("hkqy" [""])
+("hkr'" "úĺź")
+("hkrf" [""])
+("hksi" [""])
+("hksj" ["ɢ"])
+("hksp" [""])
+("hkt'" ["ҿ"])
+("hkty" [""])
+("hkub" ["" ""])
+("hkuf" [""])
+("hkug" ["" ""])
+("hkui" ["ʹ" ""])
+("hkul" ["ʯ"])
+("hkuo" ["˵"])
+("hkuu" [""])
+("hkuv" ["ˮ"])
+("hkvj" ["ս"])
+("hkvk" [""])
+("hkvr" ["ת"])
+("hkvu" [""])
+("hkw'" "ź")
+("hkwj" [""])
+("hkwu" [""])
+("hkwz" ["΢"])
+("hkxc" ["Ц"])
+("hkxd" ["" ""])
+("hkxi" ["Ϸ"])
+("hkxn" [""])
+("hkxt" ["ѧ"])
+("hkxx" ["Щ"])
+("hkyb" [""])
+("hkyi" [""])
+("hkys" [""])
+("hkyu" [""])
+("hkzi" ["" "" ""])
+("hkzl" [""])
+("hl'" [""])
+("hlan" [""])
+("hlb'" ["ѱ" "ܲ"])
+("hlba" [""])
+("hlbj" [""])
+("hlbm" [""])
+("hlbn" [""])
+("hlbo" [""])
+("hlbs" ["ܲ"])
+("hlbu" ["Ա" ""])
+("hlbz" [""])
+("hld'" [""])
+("hlde" [""])
+("hldi" ["" ""])
+("hldk" ["" ""])
+("hldl" [""])
+("hldm" [""])
+("hle'" "")
+("hler" [""])
+("hlfd" [""])
+("hlfg" [""])
+("hlfh" ["" "ַ"])
+("hlfi" ["糧"])
+("hlgh" [""])
+("hlgr" [""])
+("hlgv" [""])
+("hlh'" [""])
+("hlhe" [""])
+("hlhf" [""])
+("hlhk" [""])
+("hlht" ["Ϳ"])
+("hlhv" [""])
+("hlij" [""])
+("hlik" [""])
+("hlir" [""])
+("hlis" [""])
+("hliu" [""])
+("hlj'" ["" "" "ӽ" "ϼ"])
+("hljb" ["䤱"])
+("hljd" ["" ""])
+("hljn" [""])
+("hljp" [""])
+("hlju" ["ʡ"])
+("hlkb" [""])
+("hlke" [""])
+("hll'" ["" ""])
+("hllh" [""])
+("hlli" [""])
+("hllp" [""])
+("hllq" [""])
+("hlls" [""])
+("hlm'" ["¥"])
+("hlma" [""])
+("hlmm" ["" ""])
+("hlmv" ["ֲ"])
+("hlng" [""])
+("hlnj" [""])
+("hlnl" [""])
+("hlnx" [""])
+("hlnz" [""])
+("hlou" ["Ÿ"])
+("hlpa" [""])
+("hlq'" ["" "" "" ""])
+("hlqi" [""])
+("hlqu" [""])
+("hlr'" "")
+("hlsi" [""])
+("hlsk" [""])
+("hlsp" [""])
+("hlth" [""])
+("hltj" ["̲"])
+("hlts" ["ͯ"])
+("hlu'" ["ʽ"])
+("hluf" [""])
+("hluh" [""])
+("hlui" [""])
+("hluv" ["ˮ"])
+("hlve" [""])
+("hlvj" ["ս"])
+("hlw'" "")
+("hlwj" [""])
+("hlwl" [""])
+("hlwz" ["ζ" "δ"])
+("hlxc" ["С"])
+("hlxd" [""])
+("hlxf" ["³"])
+("hlxm" [""])
+("hlxq" [""])
+("hlxu" ["ѧʿ"])
+("hlxw" ["Ͽ"])
+("hlya" [""])
+("hlyb" [""])
+("hlyh" [""])
+("hlyj" ["" ""])
+("hlyk" ["Ҫ"])
+("hlyp" [""])
+("hlyr" ["Ա"])
+("hlyu" [""])
+("hlyy" ["Ӧ"])
+("hlz'" [""])
+("hlzi" [""])
+("hlzk" [""])
+("hlzl" [""])
+("hm'" [""])
+("hmb'" ["ײ"])
+("hmgl" [""])
+("hmjl" [""])
+("hmxu" ["ĻС˵"])
+("hn'" [""])
+("hnd'" ["ϵ"])
+("hngt'" "")
+("hnj'" [""])
+("hnt'" [""])
+("hnu'" ["ʡ" "˵" "ʡ"])
+("hnz'" [""])
+("hoba" [""])
+("hobi" [""])
+("hobj" [""])
+("hoch" [""])
+("hode" [""])
+("hods" [""])
+("hoe'" "")
+("hoer" [""])
+("hofh" ["﷿"])
+("hofo" [""])
+("hogf" [""])
+("hogl" [""])
+("hogs" [""])
+("hohb" [""])
+("hohl" ["" ""])
+("hoho" [""])
+("hohs" [""])
+("hohw" ["" ""])
+("hoia" [""])
+("hoie" ["" ""])
+("hoil" [""])
+("hoir" [""])
+("hojd" [""])
+("hoji" ["" ""])
+("hojm" [""])
+("hoju" [""])
+("hojx" [""])
+("hojy" [""])
+("hokb" [""])
+("hokh" [""])
+("hokr" [""])
+("holc" [""])
+("holi" ["" "" ""])
+("holo" [""])
+("holp" [""])
+("holr" ["" ""])
+("hols" [""])
+("holu" ["·" "¯"])
+("homc" [""])
+("homf" [""])
+("homl" [""])
+("homm" [""])
+("homy" [""])
+("hong" [""])
+("hopk" [""])
+("hopn" ["Ʒ"])
+("hopo" [""])
+("hoq'" "߫")
+("hoqd" ["ǽ"])
+("hoqi" ["" "" ""])
+("hoqu" ["ȡ"])
+("hor'" "ͻ޽")
+("hore" [""])
+("horj" ["Ȼ"])
+("hose" ["ɫ"])
+("hosh" ["ɣ"])
+("hosl" [""])
+("hosu" [""])
+("hotb" ["ͷ"])
+("hoti" [""])
+("hotj" ["̯"])
+("hots" ["ͬ"])
+("hotv" [""])
+("houb" [""])
+("houe" [""])
+("houg" ["ʤ"])
+("houi" ["ʳ" "" "" ""])
+("houj" ["ɽ" "ɽ"])
+("houk" [""])
+("houv" ["ˮ"])
+("hove" [""])
+("hovj" ["ջ"])
+("hovo" ["׽"])
+("hovp" ["׼"])
+("hovs" [""])
+("hovu" [""])
+("how'" "")
+("howh" [""])
+("howu" [""])
+("howz" ["Ϊ"])
+("hoxd" ["" ""])
+("hoxi" ["Ϥ"])
+("hoxm" ["" ""])
+("hoxu" [""])
+("hoxy" ["" ""])
+("hoyb" ["" ""])
+("hoyj" [""])
+("hoyk" ["ҩ"])
+("hoyp" [""])
+("hoyr" ["Դ"])
+("hoys" [""])
+("hoyt" ["Ծ"])
+("hozi" [""])
+("hozl" [""])
+("hozv" [""])
+("hp'" ["ƽ"])
+("hpan" ["谵"])
+("hpcl" [""])
+("hpdj" ["쵰"])
+("hpdp" [""])
+("hpfb" [""])
+("hpfh" [""])
+("hpgd" ["ƽ"])
+("hpgi" ["ƽ"])
+("hphb" [""])
+("hphd" [""])
+("hphe" ["" ""])
+("hphk" ["ڻ"])
+("hphp" [""])
+("hpif" [""])
+("hpig" [""])
+("hpj'" ["ҽ"])
+("hpjn" [""])
+("hpli" [""])
+("hplm" [""])
+("hplr" [""])
+("hpm'" ["ƽ"])
+("hpmi" [""])
+("hpmm" [""])
+("hppu" [""])
+("hppz" [""])
+("hpq'" ["" "" "" "" "Ƶ"])
+("hpqi" [""])
+("hpr'" "ڻ")
+("hpru" [""])
+("hptp" ["ƽ̸"])
+("hpts" ["ͬ"])
+("hpuf" [""])
+("hpui" [""])
+("hpvh" [""])
+("hpvj" ["ս"])
+("hpvo" ["" ""])
+("hpw'" "")
+("hpxc" [""])
+("hpxd" [""])
+("hpyb" [""])
+("hpyh" [""])
+("hpyn" [""])
+("hpys" ["ӹ"])
+("hpyt" ["Լ"])
+("hpza" [""])
+("hpzo" [""])
+("hq'" [""])
+("hqb'" ["ڲ"])
+("hqhc" ["ȥδ"])
+("hqhl" [""])
+("hqj'" [""])
+("hql'" [""])
+("hqm'" ["" "ù"])
+("hqs'" [""])
+("hqt'" ["Ǳͧ"])
+("hqu'" [""])
+("hqvx" ["֮"])
+("hqx'" [""])
+("hrb'" ["Ȳ"])
+("hrbf" [""])
+("hrbj" [""])
+("hrbk" [""])
+("hrby" [""])
+("hrcp" [""])
+("hrdc" [""])
+("hrdg" ["õ"])
+("hrdl" [""])
+("hrdu" [""])
+("hrdw" ["Ȼ"])
+("hre'" "")
+("hrfa" [""])
+("hrfh" [""])
+("hrg'" ["ʸ"])
+("hrgr" ["¹"])
+("hrgs" [""])
+("hrgu" [""])
+("hrgz" [""])
+("hrhe" [""])
+("hrhh" [""])
+("hrhr" [""])
+("hrhu" [""])
+("hria" [""])
+("hrie" [""])
+("hrig" [""])
+("hrih" [""])
+("hris" [""])
+("hrji" ["" ""])
+("hrjt" ["þ"])
+("hrju" [""])
+("hrjx" ["" ""])
+("hrjy" [""])
+("hrky" [""])
+("hrl'" ["ȼ"])
+("hrle" [""])
+("hrlq" [""])
+("hrmj" [""])
+("hrmx" [""])
+("hrnj" [""])
+("hrq'" ["" "" ""])
+("hrqi" ["" "" ""])
+("hrqq" [""])
+("hrqu" ["ȡ"])
+("hrqy" [""])
+("hrr'" "»ۼߧ")
+("hrrf" [""])
+("hrrk" [""])
+("hrsj" ["ɢ"])
+("hrsr" [""])
+("hrss" [""])
+("hrsu" [""])
+("hrt'" [""])
+("hrtg" [""])
+("hrtw" [""])
+("hrub" [""])
+("hrug" [""])
+("hrui" [""])
+("hrve" [""])
+("hrvg" ["֢"])
+("hrvl" ["ծ"])
+("hrvs" [""])
+("hrw'" "ۨ")
+("hrwf" [""])
+("hrwj" [""])
+("hrxc" ["Ц"])
+("hrxd" ["" "" ""])
+("hrxi" ["ϲ"])
+("hrxn" ["" ""])
+("hrxr" [""])
+("hrxy" ["" "" "" ""])
+("hry'" [""])
+("hrye" ["ҳ"])
+("hryh" [""])
+("hryr" ["ԭ"])
+("hryt" ["Ȼһ"])
+("hryu" [""])
+("hryx" ["Ȼһ"])
+("hryy" ["ӭ"])
+("hrz'" [""])
+("hsb'" ["벡"])
+("hsbz" ["決"])
+("hsda" ["" ""])
+("hsdb" ["춹"])
+("hsdg" [""])
+("hsdj" ["쵤"])
+("hsds" ["䶯"])
+("hse'" "")
+("hsfg" [""])
+("hsg'" [""])
+("hsgb" ["蹵"])
+("hsgd" [""])
+("hsgh" ["ɫ"])
+("hsgj" [""])
+("hsgo" [""])
+("hsgr" [""])
+("hsh'" [""])
+("hshe" [""])
+("hshl" ["캣"])
+("hsho" [""])
+("hshu" [""])
+("hshw" ["컨"])
+("hsia" [""])
+("hsj'" ["ľ"])
+("hsji" [""])
+("hsjm" ["轥"])
+("hsjp" [""])
+("hsju" ["ɫ"])
+("hskb" [""])
+("hskk" ["濾"])
+("hslb" ["¥"])
+("hsld" [""])
+("hslm" [""])
+("hsln" [""])
+("hslq" ["" ""])
+("hsls" ["¡"])
+("hslu" ["¯"])
+("hslx" ["˼"])
+("hsma" [""])
+("hsmf" [""])
+("hsmu" ["ľ"])
+("hsmy" [""])
+("hsns" ["ũ"])
+("hspm" ["ƭ"])
+("hsq'" "ް")
+("hsqi" [""])
+("hsqr" ["Ȧ"])
+("hsqu" [""])
+("hsqy" [""])
+("hsr'" "ڧޮ")
+("hsre" [""])
+("hsrf" [""])
+("hsrh" [""])
+("hsrp" [""])
+("hss'" ["ɫ"])
+("hsse" ["ɫ"])
+("hsss" [""])
+("hsth" [""])
+("hstl" ["̧"])
+("hsto" [""])
+("hsts" ["ͭ"])
+("hstu" ["ͼ"])
+("hsuk" ["" ""])
+("hsuu" [""])
+("hsuv" ["ˮ"])
+("hsva" ["ը"])
+("hsvh" ["ɫл"])
+("hsvq" ["ɫȨ"])
+("hsvs" [""])
+("hsw'" "ݦޮ")
+("hswu" [""])
+("hswz" ["ΰ"])
+("hsxd" [""])
+("hsxi" [""])
+("hsxm" [""])
+("hsxn" [""])
+("hsxy" [""])
+("hsye" ["Ҷ"])
+("hsyh" ["" ""])
+("hsyj" ["" ""])
+("hszp" [""])
+("ht'" ["ͬ"])
+("hte'" [""])
+("htfj" ["ɻ"])
+("htgy" ["ԭ"])
+("hth'" ["̫"])
+("hthn" ["ͷ"])
+("hths" ["Ǻ"])
+("htk'" ["" "ͭ"])
+("htl'" ["¯" "¯"])
+("htu'" ["ɽ"])
+("htxd" ["ϲ"])
+("htyk" ["ͷһ"])
+("htyw" ["ͨ"])
+("htz'" ["̫"])
+("hu'" [""])
+("hub'" [""])
+("hubd" ["˵˵"])
+("hubn" [""])
+("hubu" ["" ""])
+("huby" [""])
+("hubz" [""])
+("huc'" ["ˮ"])
+("hud'" ["ʢ" "ʱ"])
+("hudc" [""])
+("hudi" [""])
+("hudm" ["¶ĥ"])
+("hudu" [""])
+("hudx" [""])
+("hue'" "")
+("huer" [""])
+("hufa" [""])
+("hufh" [""])
+("hugd" ["" ""])
+("hugj" [""])
+("huhh" [""])
+("huhj" [""])
+("huhk" [""])
+("huhl" [""])
+("huhr" ["" ""])
+("huhs" ["ɫ"])
+("huhu" ["" ""])
+("huhv" [""])
+("huhw" [""])
+("hujc" ["" ""])
+("hujd" [""])
+("huji" [""])
+("hujp" [""])
+("hujq" [""])
+("hujy" ["ڽ" "ϼ"])
+("hukb" ["" "" "" ""])
+("hul'" ["ˮ" "" ""])
+("huld" ["׶"])
+("hulh" [""])
+("huli" ["" "" ""])
+("hull" [""])
+("huln" [""])
+("hulr" [""])
+("hult" [""])
+("hulu" ["«"])
+("hum'" [""])
+("huma" [""])
+("humf" [""])
+("humi" [""])
+("humm" [""])
+("hunj" [""])
+("hunk" [""])
+("hupl" [""])
+("hupo" [""])
+("huq'" "Ϸ")
+("huqi" [""])
+("huqn" [""])
+("huqq" [""])
+("hur'" "")
+("hurj" ["Ȼ"])
+("hurs" [""])
+("huss" [""])
+("hutb" ["ͷ"])
+("hutk" [""])
+("huts" ["ͬ" "ͨ"])
+("hutu" ["Ϳ" "Ϳ"])
+("huu'" [""])
+("huug" ["" ""])
+("huui" ["" "ʿ"])
+("huul" ["¥"])
+("huuo" ["˵"])
+("huuv" ["ˮ"])
+("huvb" [""])
+("huvc" ["ٲ"])
+("huvk" [""])
+("huvu" ["" ""])
+("huw'" "˺ͺ")
+("huwz" ["" "Ϊ"])
+("hux'" ["ʤ"])
+("huxc" ["Х"])
+("huxd" [""])
+("huxi" [""])
+("huxm" [""])
+("huxt" ["Ѩ"])
+("huxu" [""])
+("huxy" [""])
+("huy'" ["" ""])
+("huyj" [""])
+("huyu" ["" ""])
+("huyy" ["Ӧ"])
+("huzh" ["ʮֻ"])
+("huzi" ["" ""])
+("hv'" [""])
+("hvan" ["Ұ" "ް"])
+("hvba" [""])
+("hvbi" ["ر"])
+("hvbj" ["ת뾶" ""])
+("hvbk" ["㱨"])
+("hvbl" ["" "Ұ"])
+("hvbm" [""])
+("hvbo" ["ز"])
+("hvcl" ["ز"])
+("hvda" ["ش"])
+("hvdc" ["ٵ"])
+("hvdh" ["ص" "ᵱ"])
+("hvdk" ["ص"])
+("hvdm" ["ص"])
+("hvds" ["Ӷ" "ض"])
+("hvdv" [""])
+("hve'" "ٻ")
+("hver" [""])
+("hvfa" ["ӷ"])
+("hvff" ["ҷ"])
+("hvfg" ["ط"])
+("hvfh" ["ط"])
+("hvfu" ["ָ" "ظ"])
+("hvge" ["Ӹ"])
+("hvgl" ["ڸ"])
+("hvgo" ["ع"])
+("hvgr" [""])
+("hvgu" ["ع"])
+("hvgv" ["ع"])
+("hvhb" [""])
+("hvhd" ["Ի"])
+("hvhe" ["غ" "" ""])
+("hvhf" ["ں"])
+("hvho" ["ӻ"])
+("hvhv" ["ػ"])
+("hvhw" ["Ự" "滭"])
+("hvhy" ["ٻ"])
+("hvie" ["س"])
+("hvif" ["ҳ"])
+("hvig" ["س"])
+("hvih" ["᳡"])
+("hvik" ["س"])
+("hvis" ["׳"])
+("hviu" [""])
+("hvj'" ["ը"])
+("hvjc" ["ؽ"])
+("hvjd" ["ҽ"])
+("hvji" ["ػ" "Ἧ" "㼯"])
+("hvjm" ["ؼ" ""])
+("hvjn" ["ҽ"])
+("hvju" ["" "" "ʵ"])
+("hvjw" ["ؼ"])
+("hvkb" ["ؿ"])
+("hvke" [""])
+("hvkr" [""])
+("hvli" [""])
+("hvll" [""])
+("hvlq" [""])
+("hvls" [""])
+("hvlu" ["·" "¸"])
+("hvlv" [""])
+("hvm'" ["־"])
+("hvmm" [""])
+("hvmn" [""])
+("hvmx" [""])
+("hvp'" ["ױƷ"])
+("hvpc" ["Ʊ"])
+("hvq'" "һӻԻջڶ")
+("hvqi" [""])
+("hvqu" ["ȥ"])
+("hvr'" "ۻܻݻ޻߻ޥ")
+("hvru" [""])
+("hvse" ["ɫ"])
+("hvsi" ["˿"])
+("hvsp" [""])
+("hvt'" [""])
+("hvtb" ["ͷ"])
+("hvth" [""])
+("hvtj" ["̸"])
+("hvtm" [""])
+("hvts" ["ͬ"])
+("hvtu" ["" "ͼ"])
+("hvu'" [""])
+("hvub" ["" "" "" ""])
+("hvuf" [""])
+("hvug" ["" ""])
+("hvuh" ["" ""])
+("hvui" ["ʦ" "ʦ" "ʹ" ""])
+("hvuo" ["˵"])
+("hvuu" [""])
+("hvuv" ["ˮ"])
+("hvv'" ["ս" ""])
+("hvvb" [""])
+("hvvf" [""])
+("hvvh" [""])
+("hvvi" [""])
+("hvvj" ["ս"])
+("hvvr" ["ת"])
+("hvvs" [""])
+("hvw'" "׻")
+("hvwl" ["Ϊ"])
+("hvwu" ["" "" "" ""])
+("hvwz" ["ζ"])
+("hvxd" ["" "" "" ""])
+("hvxn" ["" "" ""])
+("hvxr" [""])
+("hvxx" ["г" "ڶг"])
+("hvyb" ["" "" ""])
+("hvyh" [""])
+("hvyi" ["" "" ""])
+("hvyj" [""])
+("hvyn" [""])
+("hvyr" ["Ա" "Զ"])
+("hvyu" [""])
+("hvyy" ["ӳ"])
+("hvz'" [""])
+("hvzg" [""])
+("hvzi" [""])
+("hvzs" [""])
+("hvzu" [""])
+("hw'" [""])
+("hwb'" [""])
+("hwbf" [""])
+("hwbi" [""])
+("hwbj" ["" ""])
+("hwbk" [""])
+("hwbl" [""])
+("hwbm" ["" ""])
+("hwbu" ["" ""])
+("hwby" [""])
+("hwbz" ["" ""])
+("hwce" [""])
+("hwck" [""])
+("hwd'" [""])
+("hwdg" [""])
+("hwdk" [""])
+("hwdo" [""])
+("hwds" ["" ""])
+("hwdy" [""])
+("hwdz" [""])
+("hwee" [""])
+("hwer" ["" ""])
+("hwfa" [""])
+("hwff" ["" ""])
+("hwfu" [""])
+("hwfz" ["" ""])
+("hwgk" [""])
+("hwgr" [""])
+("hwgs" [""])
+("hwgv" [""])
+("hwh'" [""])
+("hwhe" [""])
+("hwhr" [""])
+("hwhs" [""])
+("hwhv" [""])
+("hwia" [""])
+("hwie" [""])
+("hwih" [""])
+("hwiu" [""])
+("hwj'" [""])
+("hwjc" ["" ""])
+("hwji" [""])
+("hwjm" [""])
+("hwjr" [""])
+("hwju" [""])
+("hwjw" ["" "" ""])
+("hwkj" [""])
+("hwla" [""])
+("hwlh" [""])
+("hwli" ["" ""])
+("hwlm" [""])
+("hwln" [""])
+("hwlp" [""])
+("hwlz" [""])
+("hwm'" ["΢"])
+("hwmi" [""])
+("hwmm" [""])
+("hwmu" ["ľ"])
+("hwmz" [""])
+("hwn'" [""])
+("hwnc" [""])
+("hwnd" [""])
+("hwni" [""])
+("hwnj" [""])
+("hwns" ["ŧ"])
+("hwpf" [""])
+("hwpi" ["Ƥ"])
+("hwpk" [""])
+("hwpm" ["Ƭ"])
+("hwpo" ["" ""])
+("hwpy" ["ƿ"])
+("hwq'" ["" "" "" "" "" ""])
+("hwqc" [""])
+("hwqi" ["" ""])
+("hwqm" ["Ǯ"])
+("hwqp" ["ȹ"])
+("hwqr" ["Ȧ"])
+("hwqy" ["" ""])
+("hwr'" "")
+("hwrf" [""])
+("hwrj" ["Ȼ"])
+("hwrp" [""])
+("hwse" ["ɫ"])
+("hwsi" ["˿"])
+("hwt'" [""])
+("hwtb" ["ͷ"])
+("hwti" [""])
+("hwtj" ["̳"])
+("hwto" ["٢"])
+("hwts" ["Ͳ"])
+("hwtu" ["ͼ"])
+("hwua" ["ɳ"])
+("hwuf" [""])
+("hwug" [""])
+("hwui" ["" "ʯ" "" "ʯ"])
+("hwuj" ["ɽ"])
+("hwuo" ["˵"])
+("hwuu" [""])
+("hwvb" [""])
+("hwvd" ["װ" "ױ"])
+("hwvj" ["չ"])
+("hwvk" [""])
+("hwvs" [""])
+("hwvu" [""])
+("hww'" "")
+("hwwf" [""])
+("hwwy" ["Ϊ"])
+("hwx'" ["" ""])
+("hwxd" ["ߵ" "" ""])
+("hwxi" [""])
+("hwxm" ["" ""])
+("hwxt" ["ѩ" "ѧ"])
+("hwxu" [""])
+("hwxw" [""])
+("hwxx" ["ϵ"])
+("hwxy" [""])
+("hwy'" [""])
+("hwya" ["ѿ"])
+("hwyh" [""])
+("hwyi" ["" "" "" "һ" "һ"])
+("hwyj" [""])
+("hwyk" ["ҩ"])
+("hwyn" [""])
+("hwyr" ["԰"])
+("hwyt" ["Ϊһ̸"])
+("hwyu" [""])
+("hwyw" [""])
+("hwyy" [""])
+("hwzi" [""])
+("hwzo" [""])
+("hx'" ["ѧ"])
+("hxah" ["మ"])
+("hxb'" ["ϸ" "С"])
+("hxbd" ["аԵ"])
+("hxbh" ["ѧ仯"])
+("hxbv" [""])
+("hxd'" ["׵" ""])
+("hxfl" ["ѧ"])
+("hxfu" ["ѧʽ"])
+("hxfx" ["ѧ"])
+("hxfy" ["ѧӦ"])
+("hxg'" [""])
+("hxgw" [""])
+("hxgy" ["ѧҵ"])
+("hxh'" ["˻"])
+("hxhi" ["ѧϳ"])
+("hxj'" ["ѧ"])
+("hxjq" [""])
+("hxkn" [""])
+("hxn'" ["ѧ"])
+("hxph" ["ѧƽ"])
+("hxq'" ["Ѫ" ""])
+("hxr'" ["ѡ"])
+("hxrl" ["Ⱦ"])
+("hxsq" ["ɥ"])
+("hxt'" ["" "̿"])
+("hxv'" [""])
+("hxvx" [""])
+("hxwq" ["ѧ"])
+("hxwv" ["ժ"])
+("hxxt" ["ϵͳ"])
+("hxxv" ["ѧ"])
+("hxxw" ["ѧά"])
+("hxys" ["ѧԪ"])
+("hy'" [""])
+("hyan" [""])
+("hybc" [""])
+("hybk" [""])
+("hybz" [""])
+("hyde" [""])
+("hydj" [""])
+("hyf'" [""])
+("hyfh" ["ѿֻ"])
+("hyg'" ["һ" "Ա"])
+("hygu" [""])
+("hygv" ["־"])
+("hyh'" ["º"])
+("hyhb" [""])
+("hyhe" [""])
+("hyhf" [""])
+("hyhl" [""])
+("hyhw" [""])
+("hyhy" ["ƻ"])
+("hyiu" [""])
+("hyj'" ["ԭ"])
+("hyjq" [""])
+("hyl'" ["" "¼"])
+("hylc" [""])
+("hynj" [""])
+("hynm" [""])
+("hyq'" ["Ȩ" ""])
+("hyr'" "")
+("hyrb" [""])
+("hyrf" [""])
+("hyrl" ["ԭȾ" "ԭ"])
+("hys'" ["˼"])
+("hysi" [""])
+("hyt'" ["" "ͥ"])
+("hyu'" ["˵"])
+("hyui" [""])
+("hyuu" [""])
+("hyuv" ["֬"])
+("hyv'" ["" "֮"])
+("hyvd" ["ƶ"])
+("hyve" [""])
+("hyw'" "")
+("hywi" ["޳"])
+("hyy'" ["ѹѹ" ""])
+("hyyi" [""])
+("hyyp" [""])
+("hyyw" [""])
+("hyzy" [""])
+("hz'" [""])
+("hzan" ["ڰ"])
+("hzb'" [""])
+("hzbh" ["ڰ"])
+("hzbj" ["ڰ"])
+("hzbl" ["ڰ"])
+("hzbx" ["ֱ"])
+("hzdb" ["ڶ"])
+("hzdi" ["ڵ"])
+("hzfw" ["Ϊ"])
+("hzgd" ["ڹ"])
+("hzge" ["ڸ"])
+("hzh'" ["" ""])
+("hzhl" ["ں"])
+("hzho" ["ڻ"])
+("hzhz" ["ٺ"])
+("hzml" [""])
+("hzmu" ["Ļ"])
+("hzmz" ["ù"])
+("hzng" ["ڸ"])
+("hzq'" ["" "" "" ""])
+("hzrf" [""])
+("hzse" ["ɫ"])
+("hzss" [""])
+("hzti" [""])
+("hztk" [""])
+("hztm" [""])
+("hztu" [""])
+("hzu'" [""])
+("hzub" ["" ""])
+("hzud" ["̵"])
+("hzui" ["" ""])
+("hzuj" ["ɽ"])
+("hzur" [""])
+("hzuv" ["ˮ"])
+("hzxn" [""])
+("hzxw" [""])
+("hzye" ["ҹ"])
+("hzyq" ["ǰ"])
+("hzyu" ["ӡˢ"])
+("i" "")
+("iabj" ["" ""])
+("iabx" [""])
+("iabz" ["豭"])
+("iaco" [""])
+("iade" [""])
+("iadg" [""])
+("iadk" [""])
+("iadm" ["" "" ""])
+("iads" [""])
+("iadv" ["" ""])
+("iae'" "")
+("iaee" [""])
+("iaff" [""])
+("iafg" [""])
+("iafh" ["跿" ""])
+("iago" [""])
+("iagr" [""])
+("iahk" [""])
+("iaho" [""])
+("iahu" [""])
+("iahv" [""])
+("iahw" ["廰"])
+("iaih" ["賡"])
+("iaiu" ["" "鴦"])
+("iaj'" [""])
+("iaji" ["輸"])
+("iajm" [""])
+("iajn" [""])
+("iajq" ["龿"])
+("iajt" [""])
+("iaju" [""])
+("iajw" [""])
+("iakb" ["" ""])
+("iakj" ["鿱" "鿴" "쿴"])
+("iakk" ["鿼"])
+("iakl" [""])
+("ialb" ["¥"])
+("ialu" ["·"])
+("iamy" [""])
+("iana" ["ɲ"])
+("ians" ["ũ"])
+("iaq'" "")
+("iaqu" [""])
+("iaqy" [""])
+("iar'" "ɲ")
+("iaru" [""])
+("iase" ["ɫ"])
+("iatb" ["ͷ"])
+("iatc" [""])
+("iath" [""])
+("iatr" [""])
+("iatu" ["ͼ"])
+("iaub" [""])
+("iauh" [""])
+("iauu" ["" ""])
+("iauv" ["ˮ"])
+("iavg" ["֤"])
+("iavh" [""])
+("iavi" ["ֵ"])
+("iavk" [""])
+("iaw'" "")
+("iawf" [""])
+("iawj" ["" ""])
+("iaxc" [""])
+("iaxp" ["ѯ"])
+("iayb" [""])
+("iaye" ["ҳ" "Ҷ"])
+("iayh" [""])
+("iayi" ["" ""])
+("iayr" ["԰"])
+("iayt" [""])
+("iazi" ["" "" ""])
+("iazo" [""])
+("iazu" [""])
+("iazv" [""])
+("ibbj" [""])
+("ibbz" ["ﱸ"])
+("ibco" [""])
+("ibd'" [""])
+("ibda" [""])
+("ibdc" [""])
+("ibdi" [""])
+("ibdr" [""])
+("ibds" ["鶯"])
+("ibdu" [""])
+("ibe'" "")
+("ibee" [""])
+("ibfg" [""])
+("ibhf" [""])
+("ibhs" ["ɱ"])
+("ibhw" ["ﻮ" ""])
+("ibia" [""])
+("ibis" [""])
+("ibiu" ["鴤" ""])
+("ibj'" [""])
+("ibjc" [""])
+("ibji" ["Ｏ"])
+("ibjm" ["ｨ" ""])
+("ibjn" ["" ""])
+("ibjs" ["ɱ"])
+("ibju" [""])
+("ibk'" ["Բ"])
+("ibkr" [""])
+("ibks" [""])
+("ibku" [""])
+("ibl'" ["" ""])
+("iblb" ["ª"])
+("iblk" [""])
+("ibmf" [""])
+("ibmi" [""])
+("ibq'" "")
+("ibqi" ["" ""])
+("ibqm" ["ǩ"])
+("ibr'" "")
+("ibrf" [""])
+("ibrs" [""])
+("ibsv" [""])
+("ibtb" ["ͷ"])
+("ibti" [""])
+("ibtl" ["̬"])
+("ibu'" ["ɽ" "Բ" ""])
+("ibuh" [""])
+("ibui" ["" ""])
+("ibuj" ["ư"])
+("ibuv" ["ˮ" "˰"])
+("ibv'" ["԰"])
+("ibve" [""])
+("ibw'" "ٱ")
+("ibwf" [""])
+("ibwz" ["ζ"])
+("ibx'" ["Բ" "Բ"])
+("ibxd" [""])
+("ibxx" ["л"])
+("ibyh" ["" ""])
+("ibyj" [""])
+("ibzi" [""])
+("ic'" [""])
+("icj'" ["ݼ"])
+("icvw" ["֮"])
+("id'" ["̶"])
+("idb'" ["̲"])
+("idba" [""])
+("idbj" [""])
+("idd'" ["" ""])
+("iddj" [""])
+("iddl" [""])
+("idds" [""])
+("ide'" "")
+("idf'" [""])
+("idgo" [""])
+("idho" [""])
+("idhu" [""])
+("idhv" [""])
+("idiu" [""])
+("idj'" [""])
+("idjd" [""])
+("idjm" ["" ""])
+("idju" [""])
+("idjy" [""])
+("idkb" ["" ""])
+("idkd" [""])
+("idkj" [""])
+("idli" [""])
+("idlm" [""])
+("idpu" [""])
+("idq'" ["" "" "" "Ƶ"])
+("idqi" [""])
+("idr'" "")
+("idru" [""])
+("idtb" ["ͷ"])
+("idtl" ["̨"])
+("idu'" ["ɶ"])
+("idue" [""])
+("iduh" [""])
+("idui" ["ʼ"])
+("idv'" [""])
+("idvi" [""])
+("idw'" "")
+("idwh" [""])
+("idwz" ["λ"])
+("idx'" [""])
+("idxn" [""])
+("idye" ["ҵ"])
+("idzi" [""])
+("idzk" [""])
+("idzo" [""])
+("ieba" [""])
+("ieby" [""])
+("ieci" [""])
+("iedc" [""])
+("iedg" [""])
+("iedi" [""])
+("iedk" ["" ""])
+("iedv" [""])
+("iedy" [""])
+("iee'" "")
+("iefh" [""])
+("iefu" [""])
+("iegb" [""])
+("iegs" [""])
+("iehd" [""])
+("ieho" [""])
+("iehr" [""])
+("iehv" [""])
+("ieid" [""])
+("ieir" [""])
+("ieiu" [""])
+("iejm" [""])
+("iejp" [""])
+("iejw" [""])
+("ield" [""])
+("ieli" ["" ""])
+("ielp" [""])
+("ielq" [""])
+("ielr" [""])
+("iemf" [""])
+("ienj" ["ѩ˹"])
+("iepc" ["Ʊ"])
+("iepi" ["Ƥ"])
+("ieq'" "")
+("ieqm" ["ǰ"])
+("ier'" "")
+("iesu" [""])
+("ietb" ["ͷ"])
+("ieti" [""])
+("ietl" ["̥"])
+("ietv" [""])
+("ieuf" [""])
+("ievb" [""])
+("ieve" [""])
+("ievi" ["ְ"])
+("ievj" ["վ"])
+("iexc" ["" ""])
+("iexd" ["" ""])
+("iexy" [""])
+("ieye" ["ҹ"])
+("iezb" [""])
+("iezi" [""])
+("if'" [""])
+("ifai" [""])
+("ifbk" [""])
+("ifbu" ["Ĳ"])
+("ifcu" ["´"])
+("ifd'" [""])
+("ifdm" ["" "ĵ"])
+("ife'" "")
+("iffg" [""])
+("iffu" ["" "¸"])
+("ifgd" ["" ""])
+("ifgv" ["¹"])
+("ifho" ["»"])
+("ifif" [""])
+("ifii" ["³"])
+("ifjd" [""])
+("ifji" ["" "" "¼" "û"])
+("ifjn" [""])
+("ifjq" ["¾"])
+("ifjy" [""])
+("ifli" [""])
+("iflp" [""])
+("iflx" [""])
+("ifmf" [""])
+("ifmi" [""])
+("ifmn" [""])
+("ifmo" ["û" "Ĭ"])
+("ifni" [""])
+("ifpl" ["˷"])
+("ifq'" ["" "" "" "" "ǹ" ""])
+("ifqi" [""])
+("ifqu" [""])
+("ifqx" [""])
+("ifr'" "óĳƳ")
+("ifre" [""])
+("ifsi" ["˼"])
+("ift'" ["" "" "ͷ"])
+("iftj" [""])
+("ifto" [""])
+("ifts" ["ʹ"])
+("iftu" [""])
+("ifua" ["ɰ"])
+("ifug" ["ʤ"])
+("ifui" ["" ""])
+("ifuj" [""])
+("ifuu" [""])
+("ifuv" ["˯"])
+("ifve" [""])
+("ifvo" [""])
+("ifvs" [""])
+("ifw'" "³")
+("ifx'" [""])
+("ifxi" [""])
+("ifxn" [""])
+("ifxv" [""])
+("ifxy" [""])
+("ifyi" ["" ""])
+("ifyn" [""])
+("ifyp" [""])
+("ifzi" [""])
+("ifzk" [""])
+("ifzv" [""])
+("ig'" ["ɹ"])
+("igba" ["ư"])
+("igbf" ["ɱ"])
+("igbi" ["ű"])
+("igbj" ["Ͱ" "а"])
+("igbk" ["ʱ" "а" "б"])
+("igbl" ["ɰ"])
+("igby" ["Ʋ"])
+("igbz" ["ɱ"])
+("igcl" ["ɲ"])
+("igd'" ["ߵ"])
+("igde" ["е"])
+("igdh" ["е"])
+("igdi" ["ʵ"])
+("igdj" ["е"])
+("igdk" ["Ƶ"])
+("igdu" ["ɶ" "̶"])
+("igdv" ["ɶ"])
+("ige'" "ѳ")
+("igfa" ["˷" "ͷ"])
+("igff" ["ɷ"])
+("igfg" ["ɷ"])
+("igfh" ["Ƿ" "ɷ" "˷"])
+("igfz" ["˷"])
+("iggb" ["ӹ"])
+("iggo" ["ǹ" "ɹ"])
+("iggs" ["ɹ"])
+("iggv" ["ɹ"])
+("ighd" ["Ȼ"])
+("ighk" ["ƺ" "˺"])
+("igho" ["ɻ"])
+("ighs" ["Ⱥ"])
+("ighu" ["ƺ"])
+("ighw" ["ɻ"])
+("igie" ["˳"])
+("igii" ["ǳ"])
+("igir" ["˴"])
+("igis" ["ɳ"])
+("igiu" ["˳" "ʹ"])
+("igiv" ["Ӵ"])
+("igjc" ["ǽ" "ɽ"])
+("igjd" ["ν"])
+("igji" ["ɼ" "˻" "˻"])
+("igjm" ["ɼ"])
+("igjq" ["ɾ"])
+("igjw" ["ɼ"])
+("igjx" ["н"])
+("igke" ["˿"])
+("igkf" ["Ͽ"])
+("iglb" ["¥"])
+("iglc" [""])
+("igli" ["" ""])
+("iglj" [""])
+("igmf" [""])
+("igmg" [""])
+("igmi" [""])
+("igmy" [""])
+("igng" [""])
+("ignj" [""])
+("ignm" [""])
+("igno" ["ŵ"])
+("ignz" [""])
+("igp'" ["Ƶ"])
+("igpi" [""])
+("igpn" ["Ʒ"])
+("igpu" ["Ǳ"])
+("igq'" ["" "" "" "" "" "" "" "" ""])
+("igqd" ["ǽ" "ǿ"])
+("igqi" [""])
+("igqn" [""])
+("igqp" ["Ⱥ"])
+("igqr" ["ȫ"])
+("igqu" [""])
+("igqy" [""])
+("igr'" "Ƴ")
+("igrf" ["" ""])
+("igrj" ["Ȼ"])
+("igse" ["ɫ"])
+("igss" [""])
+("igt'" ["Ÿ"])
+("igti" [""])
+("igtk" [""])
+("igtm" ["" ""])
+("igto" [""])
+("igu'" [""])
+("igub" [""])
+("igug" ["ʤ"])
+("iguh" [""])
+("igui" ["" "" "ʽ" "ʵ"])
+("iguo" ["˵"])
+("iguu" ["" "" ""])
+("igvd" ["ʢװ"])
+("igvf" [""])
+("igvh" ["ɳ"])
+("igvi" ["" "ֿ"])
+("igvs" [""])
+("igw'" "ǳȳɳʳ˳̳ͳγϳʢة")
+("igwf" ["" ""])
+("igwl" [""])
+("igwq" [""])
+("igwu" [""])
+("igwz" ["Ϊ" "ν" "Ϊ"])
+("igxc" ["Ч"])
+("igxd" ["" "" "ة"])
+("igxi" ["" "Ϯ"])
+("igxm" [""])
+("igxn" ["" ""])
+("igxs" [""])
+("igxu" [""])
+("igxy" ["" ""])
+("igy'" ["ѹ"])
+("igyi" ["" "" ""])
+("igyk" ["" "ҩ"])
+("igyn" [""])
+("igyp" [""])
+("igyr" ["Ա"])
+("igys" [""])
+("igyt" ["Լ"])
+("igyu" [""])
+("igzj" [""])
+("igzl" ["" ""])
+("igzo" [""])
+("ihai" [""])
+("ihan" [""])
+("ihba" [""])
+("ihbf" [""])
+("ihbl" [""])
+("ihbm" [""])
+("ihbo" [""])
+("ihbz" [""])
+("ihci" [""])
+("ihcp" [""])
+("ihda" [""])
+("ihde" [""])
+("ihdi" [""])
+("ihdk" ["" ""])
+("ihdr" [""])
+("ihdu" [""])
+("ihe'" ["" "" "" "" "" "" ""])
+("ihee" ["϶"])
+("ihfa" [""])
+("ihfh" ["" ""])
+("ihfu" [""])
+("ihge" [""])
+("ihgr" [""])
+("ihgs" [""])
+("ihgv" [""])
+("ihh'" ["軰"])
+("ihhe" ["" ""])
+("ihhl" [""])
+("ihhr" [""])
+("ihhs" [""])
+("ihhv" [""])
+("ihig" [""])
+("ihih" [""])
+("ihik" ["ϻ̳Ͽ"])
+("ihip" [""])
+("ihis" [""])
+("ihiu" [""])
+("ihjd" [""])
+("ihji" ["" "潼"])
+("ihjm" [""])
+("ihjq" [""])
+("ihjt" [""])
+("ihjw" [""])
+("ihjy" [""])
+("ihkb" [""])
+("ihkd" ["" ""])
+("ihkl" [""])
+("ihku" [""])
+("ihky" [""])
+("ihl'" ["ɻ"])
+("ihld" [""])
+("ihle" [""])
+("ihlh" [""])
+("ihm'" [""])
+("ihmk" ["ë"])
+("ihmm" ["" ""])
+("ihmy" ["" ""])
+("ihnm" ["" ""])
+("ihny" [""])
+("ihpj" [""])
+("ihpk" ["" ""])
+("ihpm" ["ƪ" "Ƭ"])
+("ihpn" ["Ƶ"])
+("ihpu" [""])
+("ihpy" ["ƽ"])
+("ihq'" "")
+("ihqd" ["ǿ" "ǹ" "ǻ"])
+("ihqi" [""])
+("ihqu" [""])
+("ihqy" ["" "" ""])
+("ihr'" "")
+("ihrf" ["" ""])
+("ihrj" ["Ȼ"])
+("ihsi" ["˿"])
+("ihso" [""])
+("ihtc" [""])
+("ihtj" ["̾" "̸"])
+("ihtl" ["̬"])
+("ihts" ["ͨ"])
+("ihtu" [";"])
+("ihua" ["ɳ"])
+("ihub" [""])
+("ihue" [""])
+("ihug" ["ʢ" ""])
+("ihuh" [""])
+("ihui" ["" "ʶ" "ʫ" "ʯ"])
+("ihuj" [""])
+("ihup" ["˳"])
+("ihuu" [""])
+("ihvb" [""])
+("ihvg" [""])
+("ihvh" [""])
+("ihvi" ["" "ַ"])
+("ihvu" ["ס" "פ" ""])
+("ihw'" "")
+("ihwf" [""])
+("ihwu" [""])
+("ihwz" ["ί" "θ"])
+("ihxc" [""])
+("ihxi" ["Ϸ"])
+("ihxn" [""])
+("ihyb" ["" ""])
+("ihye" ["ҹ"])
+("ihyi" [""])
+("ihyj" ["" "" ""])
+("ihyl" [""])
+("ihyn" [""])
+("ihyr" ["Ժ" "Բ" "Զ"])
+("ihys" [""])
+("ihyu" [""])
+("ihzi" ["" "" ""])
+("ii'" [""])
+("iibh" [""])
+("iibi" ["" ""])
+("iibv" [""])
+("iicp" ["ߴ"])
+("iicu" ["Դ"])
+("iid'" [""])
+("iide" ["Ե"])
+("iidk" ["ٵ" ""])
+("iidl" ["մ"])
+("iidp" ["ٶ"])
+("iidu" ["߶"])
+("iie'" "ܳݳ޳")
+("iifj" ["Է"])
+("iigd" ["Թ"])
+("iihr" ["ٻ"])
+("iihs" [""])
+("iiig" ["۳" "" ""])
+("iiii" ["Գ" "ٳ"])
+("iijc" [""])
+("iijg" ["۸"])
+("iijn" ["Խ" "Ծ"])
+("iijq" ["־"])
+("iijw" ["ּ"])
+("iijy" ["Ծ"])
+("iiku" ["Կ"])
+("iikv" ["Կ"])
+("iild" [""])
+("iili" ["" ""])
+("iilo" [""])
+("iilp" [""])
+("iilx" [""])
+("iimy" [""])
+("iimz" ["ü"])
+("iinl" [""])
+("iipn" ["ƶ"])
+("iipy" ["ƽ"])
+("iiq'" "Գ")
+("iiqd" ["ǹ"])
+("iiqq" [""])
+("iir'" "߳")
+("iire" [""])
+("iirr" [""])
+("iiru" [""])
+("iiss" [""])
+("iitb" ["͸"])
+("iitc" [""])
+("iith" [""])
+("iitj" ["̸"])
+("iiu'" [""])
+("iiub" [""])
+("iiuf" [""])
+("iiuh" [""])
+("iiui" ["ʳ"])
+("iiuv" ["ˮ"])
+("iivi" [""])
+("iivk" [""])
+("iivs" [""])
+("iiw'" "ֳ׳سٳڳܯ")
+("iixd" [""])
+("iixu" [""])
+("iiyb" [""])
+("iiyh" [""])
+("iiyi" [""])
+("iiyj" ["" ""])
+("iiyn" [""])
+("iiyu" [""])
+("iiyy" ["´"])
+("iize" [""])
+("iizi" ["" ""])
+("iizk" [""])
+("ij'" ["ɼ"])
+("ijb'" [""])
+("ijdb" [""])
+("ijdc" [""])
+("ijdg" [""])
+("ijdi" [""])
+("ijds" [""])
+("ije'" "")
+("ijer" [""])
+("ijf'" [""])
+("ijfa" [""])
+("ijfu" ["" ""])
+("ijh'" ["ƻ"])
+("ijhb" [""])
+("ijib" ["ɱ"])
+("ijid" [""])
+("ijij" [""])
+("ijiu" ["" ""])
+("ijj'" ["׼"])
+("ijjf" ["侭"])
+("ijke" [""])
+("ijl'" [""])
+("ijld" [""])
+("ijlm" [""])
+("ijlr" [""])
+("ijm'" ["¾"])
+("ijmf" [""])
+("ijmm" [""])
+("ijmy" [""])
+("ijpn" ["Ʒ"])
+("ijpo" [""])
+("ijpy" ["ƽ" "ƽԭ"])
+("ijqm" ["ǰ"])
+("ijqr" ["Ȩ"])
+("ijr'" "")
+("ijrk" [""])
+("ijsd" ["ٶ"])
+("ijsh" ["ɼ˼"])
+("ijsv" [""])
+("ijsx" ["Ͽ"])
+("ijtu" [""])
+("iju'" ["" "ʿ"])
+("ijug" [""])
+("ijui" ["ʦ"])
+("ijuu" [""])
+("ijv'" ["־ս"])
+("ijvd" ["״"])
+("ijvi" ["ֵ"])
+("ijw'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("ijwu" [""])
+("ijxc" [""])
+("ijxq" ["Ȧ"])
+("ijy'" [""])
+("ijye" ["ҵ"])
+("ijyj" [""])
+("ijyn" [""])
+("ijyu" ["ҽ"])
+("ijzi" [""])
+("ijzs" [""])
+("ijzu" [""])
+("ik'" [""])
+("ikbf" [""])
+("ikbk" [""])
+("ikbl" [""])
+("ikbm" [""])
+("ikcl" [""])
+("ikdk" [""])
+("ikdl" [""])
+("ikdr" [""])
+("ike'" "")
+("ikee" [""])
+("ikfg" [""])
+("ikgk" [""])
+("ikgo" [""])
+("ikgs" [""])
+("ikh'" [""])
+("ikij" [""])
+("ikik" [""])
+("ikiu" [""])
+("ikj'" ["׻"])
+("ikjg" [""])
+("ikji" [""])
+("ikjm" [""])
+("ikjw" ["" ""])
+("ikjx" [""])
+("iklq" [""])
+("iklu" ["¼"])
+("ikmm" [""])
+("iknk" [""])
+("iknl" ["Կ"])
+("ikns" ["Ū"])
+("ikpc" ["Ʊ"])
+("ikpi" ["Ƣ"])
+("ikq'" "½")
+("ikqi" [""])
+("ikqm" ["ǰ"])
+("ikqy" [""])
+("ikr'" "")
+("ikre" [""])
+("ikrf" [""])
+("ikrh" [""])
+("ikrj" ["Ȼ"])
+("ikss" [""])
+("ikto" [""])
+("ikty" ["͢"])
+("ikug" ["" "ʥ"])
+("ikui" ["ʪ"])
+("ikuj" [""])
+("ikuk" [""])
+("ikuu" [""])
+("ikuv" ["ˮ"])
+("ikvb" [""])
+("ikve" [""])
+("ikvg" [""])
+("ikvi" ["֧"])
+("ikvs" [""])
+("ikvx" ["ת"])
+("ikw'" "")
+("ikxc" ["Ц"])
+("ikxd" [""])
+("ikxi" ["Ϯ" "ϫ"])
+("ikxm" [""])
+("ikxt" ["Ѩ"])
+("ikxx" ["д"])
+("ikye" ["Ұ"])
+("ikyn" [""])
+("ikyr" ["Ա"])
+("ikyt" ["Խ"])
+("ikzb" [""])
+("ikzl" [""])
+("ikzs" [""])
+("ikzv" [""])
+("il'" [""])
+("ilbx" ["Ϣ"])
+("ilck" [""])
+("ildc" [""])
+("ilf'" ["˷"])
+("ilhe" [""])
+("ilho" [""])
+("ilhv" [""])
+("ilhy" [""])
+("ili'" ["ѳ"])
+("ilir" [""])
+("iliu" [""])
+("ilj'" [""])
+("ilkl" ["" "Ҷ"])
+("ill'" [""])
+("illh" [""])
+("ilmi" [""])
+("ilp'" ["Ʒ"])
+("ilpt" ["ͨ"])
+("ilq'" "")
+("ilqm" ["Ǩ"])
+("ilr'" "")
+("ilrf" [""])
+("ilsj" ["ɢ"])
+("iltl" ["̨"])
+("ilui" ["ʹ" ""])
+("ilvd" ["װ"])
+("ilw'" "٭")
+("ilxi" ["ϴ"])
+("ilxm" [""])
+("ilxx" ["ж"])
+("ilyb" [""])
+("ilyi" [""])
+("ilz'" [""])
+("imb'" ["ë"])
+("imhc" ["ı"])
+("imjx" ["Ŀ"])
+("imkl" ["ü"])
+("iml'" [""])
+("imr'" ["ë"])
+("ims'" ["ù"])
+("imvv" [""])
+("inr'" [""])
+("iohk" ["º"])
+("ioir" [""])
+("iopo" [""])
+("ioq'" "")
+("ior'" "")
+("iouh" [""])
+("ip'" ["Ʒ"])
+("ipbo" [""])
+("ipcl" [""])
+("ipcv" [""])
+("ipdu" [""])
+("ipe'" "")
+("ipff" [""])
+("ipfg" [""])
+("ipgd" [""])
+("ipgg" [""])
+("iphb" [""])
+("iphw" ["" "" ""])
+("ipji" [""])
+("ipjm" [""])
+("ipjx" ["" ""])
+("ipjy" [""])
+("ipl'" ["Ʒ"])
+("ipli" [""])
+("iplj" [""])
+("iplm" [""])
+("ipln" [""])
+("iplv" [""])
+("iplz" [""])
+("ipml" [""])
+("ippu" ["" ""])
+("ipq'" "")
+("ipqq" [""])
+("ipsp" [""])
+("iptm" [""])
+("ipuu" [""])
+("ipvf" [""])
+("ipvg" [""])
+("ipvs" [""])
+("ipw'" "ݻ")
+("ipxp" ["Ѵ"])
+("ipxu" ["ƪС˵"])
+("ipxw" [""])
+("ipyb" [""])
+("ipyi" [""])
+("iqby" ["䲻"])
+("iqgc" ["ڹ"])
+("iqiw" ["ǧ"])
+("iql'" ["" ""])
+("iquw" ["ǧ"])
+("iqvr" ["ֱ"])
+("ir'" [""])
+("irb'" ["Ⱦ"])
+("irbh" [""])
+("irbi" [""])
+("irbm" [""])
+("irbo" ["" ""])
+("irbu" [""])
+("irch" [""])
+("irci" [""])
+("ircl" [""])
+("ircw" ["ϴ"])
+("irda" [""])
+("irde" [""])
+("irdi" [""])
+("irdj" [""])
+("irdk" ["" ""])
+("irdl" [""])
+("irds" [""])
+("irdt" ["ȴ"])
+("irdv" [""])
+("ire'" "")
+("irfu" [""])
+("irgo" [""])
+("irgs" [""])
+("irgz" [""])
+("irhr" [""])
+("irhu" [""])
+("iria" [""])
+("irih" [""])
+("irjc" [""])
+("irjd" [""])
+("irjp" [""])
+("irke" [""])
+("irks" [""])
+("irll" [""])
+("irlm" [""])
+("irly" [""])
+("irmf" [""])
+("irnz" [""])
+("irpc" ["Ʊ" "Ʊ"])
+("irq'" "")
+("irqi" ["" ""])
+("irqq" [""])
+("irr'" "")
+("irre" [""])
+("irrj" ["Ⱦ"])
+("irso" [""])
+("irss" ["" ""])
+("irtb" ["͸" "ͷ"])
+("irti" [""])
+("irtl" ["̨"])
+("irts" ["ͳ" "ͨ"])
+("irub" ["" ""])
+("iruf" [""])
+("iruh" [""])
+("irui" [""])
+("iruj" [""])
+("iruo" ["˵"])
+("iruu" [""])
+("irva" ["բ"])
+("irve" [""])
+("irvf" [""])
+("irvh" [""])
+("irvi" ["" "ֻ"])
+("irvu" [""])
+("irw'" "")
+("irwf" [""])
+("irwl" [""])
+("irwu" [""])
+("irwz" ["λ"])
+("irxi" ["ϰ" "Ϣ"])
+("irxm" [""])
+("irxp" ["Ѷ"])
+("irxu" ["ϵ"])
+("iryi" [""])
+("iryj" [""])
+("iryr" ["Ա"])
+("iryt" ["Խ" ""])
+("isai" ["谮"])
+("isbj" ["ذ"])
+("isbl" [""])
+("isbo" ["ز"])
+("isci" [""])
+("isd'" ["ʹ"])
+("isdh" ["䵱"])
+("isdj" ["嵭"])
+("isdk" ["嵽"])
+("isdm" [""])
+("isds" ["嶯"])
+("isdx" ["ص"])
+("ise'" "")
+("iser" [""])
+("isff" [""])
+("isfg" ["" "ط"])
+("isfj" ["ط"])
+("isfu" ["ظ"])
+("isgb" ["幵"])
+("isgk" [""])
+("ishe" ["غ"])
+("ishl" ["溦"])
+("isho" ["ػ"])
+("ishp" ["ػ"])
+("isia" [""])
+("isig" [""])
+("isis" ["" ""])
+("isiu" [""])
+("isjc" ["潺"])
+("isjd" ["ؽ"])
+("isji" ["伢" "" ""])
+("isjm" ["ؽ"])
+("isjp" [""])
+("isjt" [""])
+("isjy" ["羴" ""])
+("iskl" ["忪"])
+("isli" [""])
+("islr" [""])
+("isma" [""])
+("ismj" [""])
+("ismy" [""])
+("ispo" [""])
+("ispz" [""])
+("isq'" ["" "" "ӿ" "" "" "" "" "" "" ""])
+("isqy" ["" ""])
+("isr'" "")
+("isrf" ["" ""])
+("istm" ["" ""])
+("istu" ["ͻ"])
+("isuf" [""])
+("isug" [""])
+("isui" ["ʵ"])
+("isuw" ["ˢ"])
+("isvd" ["ײ"])
+("isvf" [""])
+("isvv" [""])
+("isw'" "")
+("iswf" [""])
+("iswu" [""])
+("iswz" ["Χ"])
+("isxi" ["ϴ"])
+("isxm" [""])
+("isxn" ["" ""])
+("isxq" [""])
+("isxt" ["Ѫ"])
+("isya" ["ѹ"])
+("isyh" [""])
+("isyj" [""])
+("isyn" ["" "ӡ"])
+("isyu" ["ԣ"])
+("isyy" [""])
+("iszi" [""])
+("iszl" ["" ""])
+("iszu" [""])
+("itdh" [";绰"])
+("itdl" ["͸"])
+("itiw" ["ͷβ"])
+("itjy" ["ͳ"])
+("itk'" [""])
+("itl'" ["¯"])
+("itsq" ["ͷɥ"])
+("itub" ["豸"])
+("itww" [""])
+("iu'" ["ʼ"])
+("iub'" [""])
+("iuba" [""])
+("iubj" ["" ""])
+("iubu" [""])
+("iuby" [""])
+("iubz" [""])
+("iuch" [""])
+("iuci" ["" "" ""])
+("iuck" ["" "" ""])
+("iuco" [""])
+("iucp" [""])
+("iudc" [""])
+("iudg" [""])
+("iudm" ["" ""])
+("iuds" ["" ""])
+("iue'" "")
+("iuer" [""])
+("iufa" ["" "" "" "" ""])
+("iuff" [""])
+("iufh" ["" "" ""])
+("iufj" [""])
+("iufz" [""])
+("iug'" ["ˮ"])
+("iugh" ["й滮"])
+("iugj" ["й"])
+("iugk" [""])
+("iugo" [""])
+("iugs" [""])
+("iugv" ["" ""])
+("iuhh" [""])
+("iuhk" [""])
+("iuhl" ["" ""])
+("iuho" [""])
+("iuhu" [""])
+("iuid" [""])
+("iuie" [""])
+("iuif" [""])
+("iuih" ["" ""])
+("iuij" [""])
+("iuik" [""])
+("iuil" [""])
+("iuiu" ["" ""])
+("iuj'" ["ˮ"])
+("iujc" ["" ""])
+("iujd" [""])
+("iuji" ["" "" ""])
+("iujl" ["ɽ"])
+("iujt" ["" ""])
+("iuju" ["" ""])
+("iujw" ["" ""])
+("iujx" [""])
+("iujy" ["" ""])
+("iukb" [""])
+("iuke" [""])
+("iukl" [""])
+("iukq" ["ֿȭ"])
+("iul'" [""])
+("iulc" [""])
+("iuld" [""])
+("iuli" ["" "" "" ""])
+("iull" [""])
+("iulm" [""])
+("iuls" [""])
+("iulu" ["·"])
+("iuma" [""])
+("iumc" [""])
+("iumf" [""])
+("iuml" [""])
+("iumm" [""])
+("iumo" ["û"])
+("iumy" ["" ""])
+("iumz" ["ý"])
+("iuna" [""])
+("iunv" ["Ů"])
+("iupm" ["ƶ"])
+("iupn" ["Ʒ"])
+("iuq'" "")
+("iuqi" ["" "" ""])
+("iuqn" [""])
+("iuqt" ["ȱ"])
+("iuqu" ["ȥ" "ȥ"])
+("iur'" ["" "" "" "" "" "ء" "" "" "" "" ""])
+("iurf" [""])
+("iurh" [""])
+("iurs" [""])
+("iuru" [""])
+("iuse" ["ɫ"])
+("iusi" [""])
+("iusj" [""])
+("iusl" [""])
+("iuso" [""])
+("iusu" [""])
+("iutb" ["ͷ" "ͷ"])
+("iutk" [""])
+("iutl" ["̨"])
+("iutu" [""])
+("iutx" [""])
+("iuty" ["ͥ"])
+("iuu'" ["ɳ"])
+("iuub" ["" "" ""])
+("iuuf" ["" "" ""])
+("iuug" ["" "" ""])
+("iuui" ["ʮ" "ʼ" "ʦ" "ʹ" "" "ʦ" ""])
+("iuuj" ["ɽ"])
+("iuuu" ["" ""])
+("iuvg" [""])
+("iuvh" [""])
+("iuvi" ["" ""])
+("iuvs" ["" ""])
+("iuw'" "ۻ")
+("iuwl" ["" ""])
+("iuxc" ["С"])
+("iuxi" ["Ϣ" "ϯ" "Ϧ"])
+("iuxm" ["" ""])
+("iuxp" ["Ѳ"])
+("iuxt" ["ѧ" "Ѫ"])
+("iuxu" [""])
+("iuxy" ["" ""])
+("iuy'" ["Ա"])
+("iuya" ["ѿ"])
+("iuyb" [""])
+("iuyh" [""])
+("iuyi" ["һ"])
+("iuyr" ["Ժ"])
+("iuyu" ["" ""])
+("iuzb" [""])
+("iuzi" ["" ""])
+("iuzl" [""])
+("iuzu" [""])
+("ivdc" [""])
+("ivdk" [""])
+("ivds" [""])
+("ivfg" [""])
+("ivfu" [""])
+("ivg'" [""])
+("ivju" [""])
+("ivlm" ["" ""])
+("ivm'" ["ֱ"])
+("ivmx" [""])
+("ivnq" ["ţ"])
+("ivpg" [""])
+("ivpx" ["ֱƽ"])
+("ivq'" "")
+("ivqg" [""])
+("ivsi" [""])
+("ivti" [""])
+("ivui" [""])
+("ivvi" ["ֱ"])
+("ivw'" ["" "" "" "׵" "" "" "" "֮Ϊ" "֮Ϊ"])
+("ivwz" ["Σ"])
+("ivx'" ["ֱ"])
+("ivxm" [""])
+("ivxn" [""])
+("ivxu" [""])
+("ivyh" ["֮Ժ"])
+("ivyj" [""])
+("ivzb" [""])
+("ivzi" [""])
+("ivzu" [""])
+("iw'" ["Ϊ"])
+("iwd'" [""])
+("iwh'" ["ί"])
+("iwi'" [""])
+("iwib" ["ư"])
+("iwij" ["ʽ"])
+("iwj'" [""])
+("iwq'" [""])
+("iwt'" [""])
+("iwy'" ["Ա"])
+("ix'" [""])
+("ixb'" ["Ѫ"])
+("ixd'" [""])
+("ixgn" [""])
+("ixh'" ["ʢ"])
+("ixht" ["ͬ"])
+("ixiy" ["ĳ"])
+("ixjl" ["Ļ"])
+("ixkv" [""])
+("ixld" ["Ͷ"])
+("ixm'" ["С"])
+("ixsw" ["˼ά"])
+("ixu'" ["С"])
+("ixuj" [""])
+("ixyg" ["ЧӦ"])
+("ixz'" [""])
+("iy'" [""])
+("iyce" [""])
+("iyd'" ["Ե" "õ"])
+("iydu" ["ö"])
+("iye'" "")
+("iygm" ["ҵ"])
+("iygr" ["ҵ"])
+("iyhj" ["ҵ󱸾"])
+("iyj'" ["" "ͻ" "ҧ" "ݬ"])
+("iyly" ["Զ"])
+("iymo" ["Ħ"])
+("iyq'" ["" "" ""])
+("iyr'" ["" "" "" "" "" ""])
+("iys'" [""])
+("iysx" ["ٷ"])
+("iyt'" ["ѹ"])
+("iyy'" ["ԲԲ"])
+("iyzb" ["ҵʱ"])
+("iz'" [""])
+("izff" [""])
+("izqi" [""])
+("izr'" ["Ȼ"])
+("izu'" [""])
+("izuj" ["ʵ"])
+("izx'" [""])
+("j" "")
+("jazm" [""])
+("jb'" [""])
+("jbbw" ["ͲΤ"])
+("jbd'" [""])
+("jbf'" ["Ӱ"])
+("jbfy" ["۱䷴Ӧ"])
+("jbg'" [""])
+("jbh'" ["𲻻"])
+("jbj'" [""])
+("jbjs" [""])
+("jbju" [""])
+("jbjz" ["Ͷ"])
+("jbll" [""])
+("jblx" ["·"])
+("jblz" [""])
+("jbm'" [""])
+("jbmd" ["ì"])
+("jbn'" [""])
+("jbp'" ["۱"])
+("jbq'" ["첨" "" "" ""])
+("jbr'" ["Ӱ"])
+("jbru" ["ʿ"])
+("jbs'" [""])
+("jbt'" [""])
+("jbu'" [""])
+("jbui" [""])
+("jbuj" ["ٲʤ"])
+("jbuy" ["ҵ"])
+("jbv'" ["ס"])
+("jbx'" ["۱ϩ"])
+("jby'" ["ֱ"])
+("jbyx" ["۱ϩ"])
+("jbyz" ["ԭ"])
+("jbzu" ["ʳ"])
+("jc'" [""])
+("jcan" ["̰"])
+("jcao" [""])
+("jcba" ["ִٲ"])
+("jcbf" ["ű" "̱"])
+("jcbi" [""])
+("jcbj" ["" "" "Ű"])
+("jcbm" ["" "Ʊ"])
+("jcbu" ["" "Ų"])
+("jccl" ["̲"])
+("jcco" [""])
+("jcda" ["ϴ"])
+("jcdi" ["ϵ"])
+("jcdk" ["µ" "ʵ" "̵"])
+("jcdl" ["" "" ""])
+("jcdm" ["" ""])
+("jcdo" ["϶"])
+("jcdr" ["϶"])
+("jcds" ["" ""])
+("jcdu" ["Ƕ"])
+("jcdv" ["У"])
+("jce'" "½ýĽŽƽǽȽɽʽٮ")
+("jcer" [""])
+("jcfg" [""])
+("jcfu" ["" "ɸ" "η"])
+("jcfz" ["˷"])
+("jcgf" ["Ÿ"])
+("jcgh" ["Ǹ"])
+("jcgk" ["ϸ"])
+("jcgo" ["ǹ"])
+("jcgr" ["" "" "̹"])
+("jcgs" [""])
+("jcgz" [""])
+("jchd" ["" "̻"])
+("jche" [""])
+("jchg" [""])
+("jchj" ["к"])
+("jchk" ["Ϻ" "к"])
+("jcho" ["" "ɻ"])
+("jchr" ["" "" "л"])
+("jchu" [""])
+("jchv" ["̻"])
+("jchw" ["" "" "ƻ" "̻"])
+("jcia" ["" "ϲ"])
+("jcie" ["ʳ" "γ"])
+("jcig" ["" "̳"])
+("jcih" ["ϳ"])
+("jcii" ["ǳ"])
+("jciu" [""])
+("jcjc" [""])
+("jcji" ["" "" ""])
+("jcjm" ["ý" "ż"])
+("jcjr" [""])
+("jcjt" ["о"])
+("jcju" ["" "̾"])
+("jcjw" ["" "ʼ"])
+("jcjx" ["" "" "" "½" "ͽ"])
+("jckb" [""])
+("jckj" ["У"])
+("jckr" ["ɿ"])
+("jcku" ["п"])
+("jcky" ["Ͽ"])
+("jclc" [""])
+("jcld" [""])
+("jcli" [""])
+("jcll" [""])
+("jclm" ["" ""])
+("jclo" [""])
+("jclq" [""])
+("jclr" [""])
+("jcls" [""])
+("jclv" [""])
+("jcma" [""])
+("jcmf" [""])
+("jcmj" [""])
+("jcml" [""])
+("jcmn" [""])
+("jcmo" ["Ĥ"])
+("jcmu" ["ľ" "ĸ"])
+("jcmx" [""])
+("jcmz" ["ú"])
+("jcna" ["" ""])
+("jcnf" [""])
+("jcni" [""])
+("jcpi" ["Ƥ"])
+("jcpj" [""])
+("jcpm" ["Ƭ"])
+("jcpz" [""])
+("jcq'" ["" "" "" "" "" "" "" "" "" "" "" "" "ܴ" "" "" "" "" "" "" "Ĵ"])
+("jcqd" ["ǹ" "ǿ"])
+("jcqi" ["" ""])
+("jcqm" ["ǳ"])
+("jcqq" [""])
+("jcqu" [""])
+("jcqy" ["" ""])
+("jcr'" "̽ͽνϽнѾУ")
+("jcrb" [""])
+("jcrh" [""])
+("jcrk" [""])
+("jcro" [""])
+("jcrs" [""])
+("jcru" [""])
+("jcse" ["ɫ"])
+("jcso" ["" ""])
+("jcsu" [""])
+("jctc" [""])
+("jcth" [""])
+("jcti" ["" ""])
+("jctj" ["̿" "̸"])
+("jcts" ["ͨ"])
+("jctu" ["ͽ"])
+("jcua" ["ɱ" "ɶ"])
+("jcub" ["" ""])
+("jcue" [""])
+("jcuf" [""])
+("jcui" ["ʯ" "ʦ" "ʿ" ""])
+("jcuk" [""])
+("jcuu" [""])
+("jcuv" ["ˮ" "ˮ"])
+("jcva" ["թ"])
+("jcvg" ["" "У"])
+("jcvh" [""])
+("jcvi" ["֯" "ֺ" "ֱ" "ֺ" ""])
+("jcvj" ["ս"])
+("jcvo" ["" ""])
+("jcvs" [""])
+("jcvu" ["" "" "ע" ""])
+("jcw'" "")
+("jcwh" [""])
+("jcwl" [""])
+("jcwu" [""])
+("jcwz" ["β" "Ϊ"])
+("jcxc" [""])
+("jcxd" [""])
+("jcxi" ["ϰ"])
+("jcxp" ["ѵ"])
+("jcxt" ["ѧ"])
+("jcxw" [""])
+("jcxx" ["Ь" "е" "ж"])
+("jcxy" ["" "" ""])
+("jcy'" [""])
+("jcyb" ["" ""])
+("jcyh" [""])
+("jcyi" ["" "" ""])
+("jcyn" ["ӡ"])
+("jcyr" ["Ա"])
+("jcyu" [""])
+("jczi" ["" ""])
+("jczo" ["" ""])
+("jd'" [""])
+("jdan" [""])
+("jdbf" ["󲿷"])
+("jdbi" [""])
+("jdbu" [""])
+("jdby" ["ᶨ"])
+("jdbz" [""])
+("jdcl" [""])
+("jdcs" [""])
+("jdd'" ["ص"])
+("jddb" [""])
+("jddi" [""])
+("jddk" ["" ""])
+("jdds" [""])
+("jddu" ["" ""])
+("jddv" [""])
+("jde'" "")
+("jdf'" [""])
+("jdfa" ["" ""])
+("jdgk" [""])
+("jdgn" ["Թ"])
+("jdgo" ["" ""])
+("jdgr" [""])
+("jdgy" ["Ӧ"])
+("jdgz" [""])
+("jdh'" ["򵥻" "Ի" ""])
+("jdhe" ["" ""])
+("jdhj" [""])
+("jdhk" [""])
+("jdhu" ["" ""])
+("jdhv" [""])
+("jdhw" ["" "" ""])
+("jdhz" [""])
+("jdi'" ["" ""])
+("jdig" [""])
+("jdih" [""])
+("jdii" [""])
+("jdiu" ["糣"])
+("jdj'" ["" "缫"])
+("jdjd" [""])
+("jdji" [""])
+("jdjn" ["" ""])
+("jdjp" [""])
+("jdjq" ["" ""])
+("jdju" [""])
+("jdjw" ["" "" ""])
+("jdjx" ["򵥻е" "" "" ""])
+("jdke" [""])
+("jdl'" ["" "" ""])
+("jdlc" ["" ""])
+("jdld" ["Ͷ" ""])
+("jdli" ["" ""])
+("jdll" [""])
+("jdln" [""])
+("jdlo" [""])
+("jdly" ["ȵ" "" ""])
+("jdmd" ["ӵ"])
+("jdmi" [""])
+("jdmo" ["Ĥ"])
+("jdmy" [""])
+("jdng" [""])
+("jdnj" [""])
+("jdny" [""])
+("jdpl" [""])
+("jdpn" ["Ʒ"])
+("jdpo" [""])
+("jdpy" [""])
+("jdq'" ["" "" "" "" "" "" "" "" "" "" "̵"])
+("jdqc" ["͵ȡ"])
+("jdqq" [""])
+("jdr'" "罫ǿ")
+("jdrf" [""])
+("jdsi" [""])
+("jdsu" [""])
+("jdth" ["" ""])
+("jdtj" ["̳"])
+("jdtl" ["̨"])
+("jdts" ["ͬ"])
+("jdtu" [""])
+("jdu'" ["ڶʹ" ""])
+("jdua" ["ɴ"])
+("jdub" ["" ""])
+("jdud" ["ʪ"])
+("jdug" ["" "" "ʶ"])
+("jduh" ["" ""])
+("jdui" ["" "ʬ" "ʹ" "ʿ" "" "ʦ" "ʷ"])
+("jduj" ["ɽ"])
+("jduu" [""])
+("jduv" ["ˮ"])
+("jduy" ["˧"])
+("jdv'" ["" "ֵ"])
+("jdvb" [""])
+("jdvd" ["״"])
+("jdvh" [""])
+("jdvz" [""])
+("jdwb" ["±"])
+("jdwd" ["¶"])
+("jdwf" [""])
+("jdwi" [""])
+("jdwu" [""])
+("jdx'" ["" ""])
+("jdxc" ["У"])
+("jdxi" ["" "ϯ" "ϰ"])
+("jdxn" ["" ""])
+("jdxs" ["ϸ"])
+("jdxt" ["ѧ"])
+("jdxw" ["" ""])
+("jdxz" ["Э"])
+("jdy'" ["̵Ա"])
+("jdya" ["ѹ"])
+("jdyb" [""])
+("jdye" ["Һ"])
+("jdyi" [""])
+("jdyj" [""])
+("jdyk" ["Ҫ"])
+("jdyn" [""])
+("jdyu" ["" ""])
+("jdyy" ["Ӳ"])
+("jdz'" ["۵"])
+("jdzb" ["ʱ"])
+("jdzj" [""])
+("jdzl" [""])
+("jdzo" [""])
+("jdzv" ["֯"])
+("je'" [""])
+("jegd" ["Ӷ"])
+("jehf" [""])
+("jejv" ["ö֮"])
+("jels" ["Ӷ"])
+("jes'" [""])
+("jf'" ["׷"])
+("jfdl" ["ֵ·"])
+("jfj'" ["ž"])
+("jfjb" ["ž"])
+("jfl'" [""])
+("jfq'" ["ǰ" "" ""])
+("jfrb" ["ձ"])
+("jfsx" ["˼"])
+("jft'" ["̬"])
+("jfu'" ["ٷ"])
+("jfvv" ["ս"])
+("jfyd" ["˶"])
+("jg'" [""])
+("jgb'" ["ر"])
+("jgck" ["ο"])
+("jgdg" [""])
+("jgdh" ["ӹ"])
+("jgeq" ["ҸͶ"])
+("jgg'" ["ṹ"])
+("jggg" ["ĸ"])
+("jggy" ["ӹҵ"])
+("jgkw" ["ؿ"])
+("jgl'" [""])
+("jglx" ["Ӹ"])
+("jgny" [""])
+("jgq'" ["ǹ" ""])
+("jgu'" ["ṹʽ" "ʯ" "ɽ"])
+("jgux" ["ٹ"])
+("jgv'" ["֦" ""])
+("jgvy" [""])
+("jgw'" ["׹"])
+("jgxz" ["ϸ"])
+("jgy'" [""])
+("jgyh" ["ӹӲ"])
+("jgyl" ["ӹ"])
+("jgz'" [""])
+("jh'" ["ƻ"])
+("jhb'" ["ϰ" "˲"])
+("jhf'" ["ᷨ"])
+("jhfy" ["ۺϷӦ"])
+("jhh'" [""])
+("jhi'" ["Ȼ"])
+("jhjj" ["ƻ"])
+("jhjp" [""])
+("jhjv" ["ֵ"])
+("jhl'" ["" ""])
+("jhm'" ["Ӻ"])
+("jhn'" [""])
+("jht'" [""])
+("jhtb" ["̹"])
+("jhtl" ["·"])
+("jhtx" ["ͼ"])
+("jhu'" ["ˮ"])
+("jhuc" ["ʧ"])
+("jhuj" ["ʵ"])
+("jhuy" ["ƻ"])
+("jhvv" [""])
+("jhvy" [""])
+("jhw'" ["ۺ"])
+("jhx'" ["ѧ" "ƻ"])
+("ji'" [""])
+("jiag" [""])
+("jian" ["" ""])
+("jibf" [""])
+("jibi" ["" ""])
+("jibj" [""])
+("jibl" ["" ""])
+("jibm" ["" "" ""])
+("jibo" ["" "񤱡"])
+("jibu" ["" "Ȳ"])
+("jibx" ["" "ֲи"])
+("jiby" ["" ""])
+("jibz" ["" ""])
+("jice" ["Ʋ"])
+("jicg" [""])
+("jich" [""])
+("jici" ["" ""])
+("jicl" [""])
+("jicp" ["" "Ĵ"])
+("jicu" [""])
+("jida" [""])
+("jidb" [""])
+("jidc" [""])
+("jide" ["" "ǵ"])
+("jidh" [""])
+("jidi" ["" "" "" "" ""])
+("jidj" [""])
+("jidl" ["ɵ·" "" "ؽ"])
+("jidm" ["" "" "" "" "" ""])
+("jidr" [""])
+("jids" ["" ""])
+("jidu" ["" "" "" "" ""])
+("jidv" [""])
+("jidy" ["ȶ"])
+("jidz" [""])
+("jie'" "ü")
+("jiee" [""])
+("jier" ["" "" "ȶ" "̶"])
+("jif'" ["Ӵ"])
+("jifa" ["" ""])
+("jiff" ["" "" "" "Ʒ" "Ƿ"])
+("jifg" ["" "" ""])
+("jifh" [""])
+("jifu" ["" "̸"])
+("jifz" ["" ""])
+("jigb" [""])
+("jigd" [""])
+("jige" ["" ""])
+("jigg" [""])
+("jigj" [""])
+("jigr" ["" ""])
+("jigs" ["" "" "ǹ"])
+("jihd" [""])
+("jihe" ["" ""])
+("jihj" [""])
+("jihk" ["Ǻ"])
+("jiho" ["" ""])
+("jihu" ["" ""])
+("jihv" ["" "" "" "Ļ" "ɻ"])
+("jihw" ["" "" "ƻ"])
+("jiia" ["" ""])
+("jiib" ["Ƴ"])
+("jiid" [""])
+("jiie" [""])
+("jiif" ["" ""])
+("jiig" ["" "̳"])
+("jiih" [""])
+("jiii" [""])
+("jiir" [""])
+("jiiu" [""])
+("jijc" ["ƽ"])
+("jijd" [""])
+("jiji" ["" "" "" ""])
+("jijm" ["" "" "" "" "" "Ƽ"])
+("jijn" ["" "" ""])
+("jijq" ["" ""])
+("jiju" ["" "" "" "" ""])
+("jijx" ["" ""])
+("jijy" ["" "" "" "ž"])
+("jik'" ["" ""])
+("jike" ["" "" "ȿ"])
+("jikg" [""])
+("jikj" [""])
+("jiku" [""])
+("jikv" [""])
+("jikx" ["ѧ"])
+("jilc" [""])
+("jild" ["" "" "" ""])
+("jili" ["" "" ""])
+("jill" [""])
+("jiln" [""])
+("jilo" [""])
+("jilp" [""])
+("jilq" ["" ""])
+("jilu" ["¼" "¼" "¼"])
+("jilv" ["" ""])
+("jilx" [""])
+("jily" ["" ""])
+("jilz" [""])
+("jimb" ["ı"])
+("jimh" ["æ"])
+("jimi" [""])
+("jimj" [""])
+("jimk" ["ë"])
+("jimn" ["" ""])
+("jimo" ["į"])
+("jimu" ["ľ" "Ŀ" "ĸ"])
+("jimy" [""])
+("jina" [""])
+("jing" ["" "" ""])
+("jinj" [""])
+("jinl" [""])
+("jinm" ["" "" "" ""])
+("jinu" ["ŭ"])
+("jinv" ["Ů"])
+("jiny" [""])
+("jipi" ["Ƥ"])
+("jipm" ["ƪ"])
+("jipn" ["ƶ"])
+("jipo" ["" ""])
+("jipu" ["" ""])
+("jiq'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "آ" "" "" "" "ܸ" "ߴ" "" "" "" "" "" "" "" "" "" "" "" "" "" "̳Ȩ" "Ӵ"])
+("jiqc" [""])
+("jiqd" ["ǹ" "ǿ"])
+("jiqi" ["" "" "" ""])
+("jiqm" ["ǧ"])
+("jiqp" ["Ⱥ"])
+("jiqq" [""])
+("jiqr" ["Ȩ"])
+("jiqu" ["ȡ" "ȡ"])
+("jiqx" [""])
+("jiqy" ["" ""])
+("jir'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "ϵ" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "̳"])
+("jirb" ["" ""])
+("jirf" ["" ""])
+("jiri" [""])
+("jirj" ["Ȼ"])
+("jise" ["ɫ"])
+("jisi" [""])
+("jiso" ["" ""])
+("jisr" [""])
+("jisu" ["" ""])
+("jisv" [""])
+("jita" [""])
+("jitc" [""])
+("jiti" ["" "" ""])
+("jitl" ["̬"])
+("jitm" ["" ""])
+("jito" [""])
+("jitr" ["" ""])
+("jitv" [""])
+("jiub" [""])
+("jiue" [""])
+("jiuf" [""])
+("jiug" ["ʢ" ""])
+("jiuh" [""])
+("jiui" ["ʯ" "" "ʱ" "" "ʱ" "ʹ" "" "ʮ" "ʱ" "ʦ" "ʱ" "ʱ" "" "ʹ" "" "ʵ"])
+("jiuj" [""])
+("jiuk" [""])
+("jiuu" ["" "" "" "" "" "ȳʵ"])
+("jiuv" ["ˮ" "ˮ" "ˮ"])
+("jivb" [""])
+("jivd" ["װ"])
+("jive" [""])
+("jivf" ["" ""])
+("jivh" [""])
+("jivi" ["" "" "" "ֵ" ""])
+("jivj" ["ս"])
+("jivp" ["׼"])
+("jivs" ["" "" ""])
+("jivu" ["ע" "" "" "ס"])
+("jivv" ["׵"])
+("jivw" ["צ"])
+("jiw'" "Ｊؽ٥ڵު")
+("jiwf" [""])
+("jiwj" [""])
+("jiwu" [""])
+("jiwz" ["Ϊ" "λ" "΢" "ί"])
+("jixc" ["Ц" "С" "У"])
+("jixd" ["" "" ""])
+("jixi" ["ϰ" "" "ϯ"])
+("jixm" ["" "" ""])
+("jixn" [""])
+("jixp" ["ѵ"])
+("jixq" [""])
+("jixt" ["ѩ"])
+("jixu" ["" "" "" ""])
+("jixw" [""])
+("jixx" ["е"])
+("jixy" ["" "" "" "" "" ""])
+("jiya" ["ѹ" "ѹ" "Ѻ"])
+("jiyb" ["" "" ""])
+("jiyi" ["" "" "" "" ""])
+("jiyj" [""])
+("jiyk" ["Ҫ" "Ҫ"])
+("jiyl" ["ӴӦ"])
+("jiyn" ["" ""])
+("jiyp" [""])
+("jiyr" ["Ժ" "Ԫ"])
+("jiys" [""])
+("jiyt" ["Խ" "Լ"])
+("jiyu" ["" "" "" "Ԣ"])
+("jizg" [""])
+("jizi" ["" "" "" ""])
+("jizk" ["" ""])
+("jizl" [""])
+("jizo" ["" ""])
+("jizu" [""])
+("jj'" [""])
+("jjb'" ["žű"])
+("jjbb" ["Ͱ"])
+("jjbv" ["׼"])
+("jjdr" [""])
+("jjdv" ["׼"])
+("jjfh" ["׼ֻ"])
+("jjfi" ["÷"])
+("jjfx" ["׼"])
+("jjfy" ["Ӿ۷Ӧ"])
+("jjfz" [""])
+("jjgd" ["׼۵"])
+("jjgg" ["øܸ"])
+("jjgl" ["ù"])
+("jjgz" ["Ƽ"])
+("jjh'" [""])
+("jjhh" ["Ҽһ"])
+("jjhs" ["ú"])
+("jjhu" ["۾"])
+("jji'" [""])
+("jjif" ["óɷ"])
+("jjj'" ["߻"])
+("jjji" ["û"])
+("jjjj" ["ƾͼ"])
+("jjjw" ["׼"])
+("jjjz" ["佾"])
+("jjkh" ["ÿֻ"])
+("jjli" ["׼"])
+("jjlx" ["׼·"])
+("jjmd" ["׼ì"])
+("jjnl" [""])
+("jjq'" ["ᾧ"])
+("jjql" ["" "߾ȫ"])
+("jjr'" ["ڼ"])
+("jjsd" ["Ǽٶ"])
+("jjt'" ["ᾧ"])
+("jjtg" ["Ƹĸ"])
+("jjtv" [""])
+("jju'" ["⾧ʯ" "" "ʯ" "ᾧˮ" "ɽɽ"])
+("jjuh" ["׼"])
+("jjvb" [""])
+("jjvd" ["ƶ"])
+("jjvv" ["ߴߴ"])
+("jjvy" [""])
+("jjwj" ["Σ"])
+("jjwt" [""])
+("jjx'" ["" "" "׼" "ѧ"])
+("jjxj" ["ѧ"])
+("jjxy" ["Ч"])
+("jjya" ["׼Ѱ"])
+("jjys" [""])
+("jjyu" ["׼ʶ"])
+("jjyw" ["ζ" "ҵ"])
+("jjyy" ["ҵҵ"])
+("jjzj" ["ӽ"])
+("jjzw" [""])
+("jk'" [""])
+("jkfd" ["ܶ"])
+("jkn'" [""])
+("jksk" ["ݿ˹工"])
+("jku'" ["̿"])
+("jkwv" ["״"])
+("jky'" ["Ϳ"])
+("jl'" [""])
+("jlb'" ["" "ֲ"])
+("jlbh" ["ձȺ"])
+("jld'" [""])
+("jlf'" ["" ""])
+("jlfy" [""])
+("jlif" ["ɴ"])
+("jlj'" [""])
+("jljj" ["ۻ"])
+("jljs" ["˹"])
+("jll'" ["٤"])
+("jlmq" ["¯ú"])
+("jln'" [""])
+("jlp'" ["¡"])
+("jlru" ["ȼ"])
+("jls'" ["ɡ"])
+("jlt'" [""])
+("jlu'" ["ʡ"])
+("jlwm" [""])
+("jlx'" ["" "ѧ"])
+("jlyl" ["ϩ"])
+("jlyx" ["ϩ"])
+("jmai" ["氮"])
+("jman" [""])
+("jmao" ["尾"])
+("jmbh" [""])
+("jmbk" [""])
+("jmbm" ["" "" ""])
+("jmbo" ["첨"])
+("jmbu" [""])
+("jmbx" [""])
+("jmby" ["" "" "沢"])
+("jmbz" ["汸"])
+("jmce" ["" ""])
+("jmcg" [""])
+("jmci" [""])
+("jmck" [""])
+("jmcl" ["" "" "Ħ"])
+("jmco" [""])
+("jmd'" ["ܶ" ""])
+("jmdc" [""])
+("jmde" [""])
+("jmdh" [""])
+("jmdi" ["ߵ" "" "" ""])
+("jmdj" [""])
+("jmdk" ["⵶" "" ""])
+("jmdl" [""])
+("jmdm" [""])
+("jmdr" ["" "" ""])
+("jmdu" ["ල" "" ""])
+("jmdv" [""])
+("jmdx" [""])
+("jmdy" ["ᶨ" "ⶥ" "춨" ""])
+("jme'" "")
+("jmer" [""])
+("jmfa" [""])
+("jmfh" ["" ""])
+("jmfu" ["縺"])
+("jmfz" [""])
+("jmge" [""])
+("jmgg" ["˹͹"])
+("jmgj" [""])
+("jmgo" ["" ""])
+("jmgr" ["" ""])
+("jmgs" ["๤"])
+("jmgu" ["" ""])
+("jmgv" [""])
+("jmgy" [""])
+("jmhe" [""])
+("jmhk" [""])
+("jmho" [""])
+("jmhr" [""])
+("jmhu" ["໤"])
+("jmhw" ["" ""])
+("jmia" ["" "" "" ""])
+("jmif" ["鳼"])
+("jmig" ["" "" ""])
+("jmih" [""])
+("jmii" [""])
+("jmij" [""])
+("jmiu" [""])
+("jmj'" ["" "ë" "ĸ"])
+("jmjc" [""])
+("jmjd" [""])
+("jmji" [""])
+("jmjm" ["" ""])
+("jmjn" ["" ""])
+("jmjp" [""])
+("jmjt" [""])
+("jmju" ["" "" ""])
+("jmjw" ["" ""])
+("jmjx" ["" "" "" "" ""])
+("jmke" [""])
+("jmkh" ["" ""])
+("jmkl" [""])
+("jmks" [""])
+("jmku" [""])
+("jmlb" ["ª"])
+("jmli" ["" "" "" ""])
+("jmlk" [""])
+("jmlm" ["" ""])
+("jmlo" [""])
+("jmlt" [""])
+("jmlu" ["¼"])
+("jmma" ["" ""])
+("jmmc" [""])
+("jmmj" [""])
+("jmmk" ["ë"])
+("jmmm" ["" ""])
+("jmmo" ["Ĭ"])
+("jmmx" [""])
+("jmmy" ["" ""])
+("jmmz" [""])
+("jmnj" [""])
+("jmny" [""])
+("jmou" [""])
+("jmpj" [""])
+("jmpn" ["Ƶ"])
+("jmpu" ["" ""])
+("jmq'" "߼꽥ǳ")
+("jmqc" [""])
+("jmqd" ["ǿ"])
+("jmqi" [""])
+("jmqr" ["ȫ"])
+("jmqu" ["ȥ"])
+("jmqx" [""])
+("jmqy" [""])
+("jmr'" "")
+("jmrf" ["" "" ""])
+("jmro" [""])
+("jmrs" ["" ""])
+("jmru" [""])
+("jmrv" [""])
+("jms'" ["ľ˹"])
+("jmsi" ["˿"])
+("jmso" [""])
+("jmsu" [""])
+("jmta" ["̤"])
+("jmtb" ["ͷ" "ͷ" "ͷ"])
+("jmti" [""])
+("jmtk" [""])
+("jmtm" [""])
+("jmtu" ["ͼ"])
+("jmtv" [""])
+("jmtx" [""])
+("jmty" ["ͧ"])
+("jmub" [""])
+("jmue" [""])
+("jmuf" [""])
+("jmuh" ["" "" ""])
+("jmui" ["" "ʵ" "" "ʷ" "ʶ"])
+("jmuk" [""])
+("jmuu" ["" "" ""])
+("jmv'" ["ս"])
+("jmva" ["թ"])
+("jmvb" [""])
+("jmvd" ["׳"])
+("jmvf" ["" ""])
+("jmvg" ["֤"])
+("jmvh" [""])
+("jmvi" ["ֽ" "ְ" "ֱ" "ֽ" ""])
+("jmvo" [""])
+("jmvs" [""])
+("jmvu" [""])
+("jmwf" [""])
+("jmwj" [""])
+("jmwl" [""])
+("jmwu" [""])
+("jmwz" ["λ"])
+("jmx'" ["Ѫ"])
+("jmxc" ["С" "Ц" "Ч"])
+("jmxi" ["϶" "ϸ" "ϰ"])
+("jmxm" [""])
+("jmxn" ["" ""])
+("jmxp" ["Ѷ"])
+("jmxq" [""])
+("jmxs" [""])
+("jmxw" ["" ""])
+("jmxx" ["Ъ" "д"])
+("jmxy" ["" ""])
+("jmya" ["ѹ"])
+("jmyb" [""])
+("jmye" ["Ҷ" "ҵ"])
+("jmyi" ["" "" "" ""])
+("jmyj" [""])
+("jmyk" ["Ҫ"])
+("jmyn" [""])
+("jmyq" [""])
+("jmyr" ["Ԫ"])
+("jmyt" [""])
+("jmyu" ["" "" ""])
+("jmyy" ["Ӳ" "Ӫ"])
+("jmzi" ["" "" ""])
+("jmzk" [""])
+("jmzl" [""])
+("jmzo" [""])
+("jn'" [""])
+("jnb'" [""])
+("jnbc" [""])
+("jnbi" ["" "" "" ""])
+("jnbk" [""])
+("jnbm" [""])
+("jnbu" [""])
+("jnby" [""])
+("jnbz" [""])
+("jncb" [""])
+("jnd'" ["ô"])
+("jndb" ["" ""])
+("jnde" [""])
+("jndk" [""])
+("jndl" [""])
+("jnds" ["" ""])
+("jndu" [""])
+("jne'" "")
+("jnee" [""])
+("jner" ["" ""])
+("jnfa" [""])
+("jnfj" [""])
+("jng'" [""])
+("jngd" [""])
+("jngh" [""])
+("jngr" [""])
+("jngs" ["" "" ""])
+("jngu" ["" ""])
+("jnhb" [""])
+("jnhd" [""])
+("jnhe" [""])
+("jnhl" [""])
+("jnho" [""])
+("jnhu" [""])
+("jnhw" ["" ""])
+("jnig" [""])
+("jnih" [""])
+("jnii" ["" ""])
+("jniu" [""])
+("jnjc" [""])
+("jnjd" [""])
+("jnji" ["" "" "" ""])
+("jnjm" ["" ""])
+("jnjn" ["" "" ""])
+("jnjp" ["" ""])
+("jnjt" [""])
+("jnkb" [""])
+("jnkd" ["" ""])
+("jnke" [""])
+("jnku" [""])
+("jnky" [""])
+("jnl'" [""])
+("jnld" ["" ""])
+("jnli" [""])
+("jnll" ["" ""])
+("jnln" [""])
+("jnlo" [""])
+("jnlp" [""])
+("jnls" [""])
+("jnlu" ["·"])
+("jnly" ["" ""])
+("jnmi" [""])
+("jnng" [""])
+("jnnm" [""])
+("jnp'" ["Ʒ"])
+("jnph" [""])
+("jnpk" [""])
+("jnpl" [""])
+("jnpo" [""])
+("jnpx" ["ƫ"])
+("jnq'" "")
+("jnqi" ["" ""])
+("jnqm" ["Ǯ" "ǰ"])
+("jnqn" [""])
+("jnqu" ["ȡ" "ȥ" ""])
+("jnqv" [""])
+("jnqy" [""])
+("jnr'" ["" "" "" "" "" "" "" "" "" "" "ݣ" "" "" "" "" "" ""])
+("jnrb" [""])
+("jnrf" ["" ""])
+("jnri" ["" ""])
+("jnrj" ["Ⱦ"])
+("jnrp" [""])
+("jnrs" [""])
+("jnru" ["" ""])
+("jnse" ["ɫ"])
+("jnsi" [""])
+("jnso" [""])
+("jnt'" [""])
+("jntb" ["͸" "ͷ" "ͷ"])
+("jntm" [""])
+("jntv" [""])
+("jntx" [""])
+("jnu'" [""])
+("jnua" ["ɳ"])
+("jnuf" ["" ""])
+("jnug" ["" "" "" ""])
+("jnui" ["ʯ" "" "ʳ" "ʿ" "" "" "ʪ" "ʴ" ""])
+("jnuj" ["ɽ"])
+("jnuu" ["" ""])
+("jnuv" ["ˮ" "ˮ" "ˮ"])
+("jnv'" [""])
+("jnvb" [""])
+("jnvh" [""])
+("jnvi" ["ֻ" "ֹ"])
+("jnvj" ["չ" "ռ"])
+("jnvk" ["" ""])
+("jnvs" ["" ""])
+("jnvu" ["" "פ"])
+("jnwf" ["" ""])
+("jnwj" [""])
+("jnwo" [""])
+("jnwz" [""])
+("jnxd" [""])
+("jnxi" [""])
+("jnxm" [""])
+("jnxn" [""])
+("jnxq" [""])
+("jnxt" ["ѧ"])
+("jnxy" ["" ""])
+("jny'" [""])
+("jnyb" [""])
+("jnye" ["ҹ"])
+("jnyh" [""])
+("jnyi" [""])
+("jnyj" ["" ""])
+("jnyk" ["Ҫ"])
+("jnyp" [""])
+("jnyr" ["Ԫ"])
+("jnyu" ["Ǳ" ""])
+("jnzi" ["" "" ""])
+("jnzk" [""])
+("jnzl" [""])
+("jpbu" [""])
+("jpbz" [""])
+("jpdg" [""])
+("jpdv" [""])
+("jpf'" ["ƶ"])
+("jpfa" ["" ""])
+("jpff" [""])
+("jpfh" [""])
+("jpfu" [""])
+("jpfz" [""])
+("jpgr" ["" ""])
+("jpgs" ["" "" ""])
+("jph'" ["" "ƽ"])
+("jphe" [""])
+("jphg" [""])
+("jphk" [""])
+("jpho" [""])
+("jphu" [""])
+("jpi'" ["ճ"])
+("jpie" [""])
+("jpji" ["" ""])
+("jpjm" [""])
+("jpjx" [""])
+("jpjy" [""])
+("jpke" [""])
+("jpl'" ["Ƶ"])
+("jpld" [""])
+("jpli" [""])
+("jplo" [""])
+("jply" ["" "" ""])
+("jplz" [""])
+("jpma" [""])
+("jpmc" [""])
+("jpmk" ["ñ"])
+("jpmn" [""])
+("jpq'" ["" "" "" "" "" "" "" "" "" "Ƶ"])
+("jpqr" ["Ȩ"])
+("jpqu" [""])
+("jpqy" [""])
+("jpr'" "")
+("jpre" [""])
+("jprf" [""])
+("jprw" [""])
+("jpsi" ["˿"])
+("jptm" [""])
+("jptp" [""])
+("jptr" [""])
+("jpts" ["ͳ"])
+("jpui" ["" "ʦ" "ʿ" ""])
+("jpuu" [""])
+("jpv'" ["կ"])
+("jpvd" ["װ"])
+("jpvg" [""])
+("jpvh" [""])
+("jpvi" [""])
+("jpvs" [""])
+("jpvu" ["" ""])
+("jpvv" ["Ʒ"])
+("jpwh" [""])
+("jpwu" [""])
+("jpwz" ["ί"])
+("jpx'" ["ѧ"])
+("jpxc" ["У"])
+("jpxd" ["" ""])
+("jpxn" [""])
+("jpxp" ["ѵ"])
+("jpxu" [""])
+("jpxx" ["е"])
+("jpyi" ["һ" "" "ҽ"])
+("jpyp" [""])
+("jpys" [""])
+("jpyu" [""])
+("jpyy" ["Ӫ"])
+("jpzi" [""])
+("jpzs" [""])
+("jq'" [""])
+("jqba" ["ư"])
+("jqbj" ["ɰ"])
+("jqbl" ["Ű"])
+("jqbm" ["ͱ"])
+("jqbq" ["ǿ"])
+("jqbu" ["Ͳ"])
+("jqby" ["ȱ"])
+("jqbz" ["Ʊ" "ͱ"])
+("jqci" ["Ŵ" "ʹ"])
+("jqcj" ["Ͳ"])
+("jqcl" ["²" "Ʋ"])
+("jqcs" ["ʹ"])
+("jqd'" ["ȷ"])
+("jqdb" ["Ͷ"])
+("jqde" ["ɵ"])
+("jqdi" ["ɵ" "͵"])
+("jqdm" ["Ƶ"])
+("jqe'" "¾þľž")
+("jqff" [""])
+("jqfj" ["ͷ"])
+("jqfl" ["ڷ"])
+("jqfu" ["˸"])
+("jqfz" ["Ƿ"])
+("jqge" ["Ÿ"])
+("jqgk" ["Ÿ"])
+("jqgo" ["ȹ" "ɹ"])
+("jqgr" ["ƹ" "ɹ"])
+("jqgs" ["˹"])
+("jqhd" ["»"])
+("jqhe" [""])
+("jqho" ["Ȼ" "Ȼ" "ɻ"])
+("jqhu" ["Ȼ"])
+("jqhv" ["ƻ" "ͻ"])
+("jqhw" ["ƻ"])
+("jqia" [""])
+("jqig" ["ų"])
+("jqih" ["Ƴ"])
+("jqii" ["ʳ"])
+("jqij" [""])
+("jqiu" [""])
+("jqjc" ["ɽ"])
+("jqjd" ["Ž"])
+("jqji" ["" "ȼ" "ȼ"])
+("jqjn" ["ͽ"])
+("jqjq" ["þ" "ž" "˾"])
+("jqju" ["ɾ"])
+("jqjv" ["⾫"])
+("jqjw" ["Ƽ"])
+("jqjy" ["" "ž" "ƾ"])
+("jqke" ["Ϳ"])
+("jqlh" ["ѻ"])
+("jqli" [""])
+("jqll" [""])
+("jqlq" [""])
+("jqls" [""])
+("jqma" [""])
+("jqmy" [""])
+("jqn'" ["ǧ"])
+("jqng" [""])
+("jqpn" ["Ʒ"])
+("jqq'" ["" "" "" "" "" "" "" "" ""])
+("jqqi" [""])
+("jqqr" ["Ȫ"])
+("jqqy" [""])
+("jqr'" ["" "" "" "" "" "" "" "" "" "" "" "" ""])
+("jqrf" [""])
+("jqrh" [""])
+("jqri" [""])
+("jqsr" [""])
+("jqtm" [""])
+("jqug" ["" ""])
+("jqui" ["ʮ" "ʫ" "ʱ" "" "" "" ""])
+("jquu" [""])
+("jqvb" [""])
+("jqvg" ["" ""])
+("jqvh" [""])
+("jqvi" ["" "ַ" "" "ְ"])
+("jqvs" [""])
+("jqvu" [""])
+("jqvv" ["ֱ׷"])
+("jqwf" [""])
+("jqwh" [""])
+("jqwo" ["" ""])
+("jqwu" ["" ""])
+("jqwz" ["Υ"])
+("jqxd" [""])
+("jqxi" ["ϯ"])
+("jqxt" ["ѧ" "ѧ"])
+("jqxu" [""])
+("jqxy" [""])
+("jqyb" [""])
+("jqyd" ["˶"])
+("jqye" ["ҵ"])
+("jqyh" [""])
+("jqyi" ["" "ҽ" ""])
+("jqyk" ["ҩ" "Ҫ"])
+("jqyr" ["Զ" "Ԯ"])
+("jqys" [""])
+("jqyt" [""])
+("jqzk" [""])
+("jqzl" ["" ""])
+("jqzo" [""])
+("jr'" [""])
+("jrbb" ["Ͳ"])
+("jrbt" ["Ȼͬ" "Ȼͬ"])
+("jre'" "")
+("jrgi" ["ȹ"])
+("jrgt" ["ڹͷ"])
+("jri'" ["ճ"])
+("jrii" [""])
+("jrj'" [""])
+("jrjv" ["˽֪"])
+("jrkr" [""])
+("jrl'" ["¯" "¯"])
+("jrlm" [""])
+("jrq'" ["" "" "" "Ȧ" "" "" "" ""])
+("jrqu" ["" "ȡ"])
+("jrr'" "Ȧ۲")
+("jrrf" [""])
+("jrrj" ["Ⱦ"])
+("jrrk" [""])
+("jrru" [""])
+("jrts" ["Ͳ"])
+("jrui" ["г"])
+("jruu" [""])
+("jruv" ["˰"])
+("jrvd" ["װ"])
+("jrvu" [""])
+("jrwz" ["γ"])
+("jrx'" [""])
+("jrxm" [""])
+("jryi" [""])
+("jryj" [""])
+("jrzb" ["ʱ"])
+("jrzi" [""])
+("jrzs" [""])
+("jrzz" [""])
+("jsb'" ["ٱ"])
+("jsd'" ["ٶ"])
+("jse'" "")
+("jsfx" ["ķϩ"])
+("jsgy" ["˼"])
+("jsi'" [""])
+("jsj'" ["" "ټ"])
+("jsjs" ["Ƽ" ""])
+("jsjy" [""])
+("jsl'" [""])
+("jspo" [""])
+("jsq'" ["" "" ""])
+("jst'" ["˿"])
+("jsu'" ["" "ʡ"])
+("jsv'" ["ֵ"])
+("jsvx" [""])
+("jsx'" ["˼"])
+("jsyd" ["˶"])
+("jt'" [""])
+("jtb'" ["ͨ"])
+("jtbi" [""])
+("jtbu" [""])
+("jtce" [""])
+("jtdb" [""])
+("jtdd" ["춯"])
+("jtde" [""])
+("jtdi" [""])
+("jtdr" [""])
+("jtdu" ["˵"])
+("jtdv" [""])
+("jtdy" ["" ""])
+("jte'" "")
+("jteg" [""])
+("jtfl" ["帣"])
+("jtfy" ["ͥҵ"])
+("jtg'" [""])
+("jtgj" ["ͨ"])
+("jth'" ["廯" "廯"])
+("jthl" ["κ"])
+("jti'" ["̤"])
+("jtia" [""])
+("jtiu" ["ͥ"])
+("jtj'" ["ž"])
+("jtjc" [""])
+("jtjd" ["ǿ"])
+("jtjg" ["ṹ"])
+("jtji" ["" ""])
+("jtjj" ["徭"])
+("jtjn" [""])
+("jtju" ["" ""])
+("jtjy" [""])
+("jtkb" ["" ""])
+("jtld" ["쵼" "Ͷ"])
+("jtlp" [""])
+("jtlu" ["·"])
+("jtlx" [""])
+("jtly" [""])
+("jtmc" [""])
+("jtmi" [""])
+("jtnv" ["ũׯ"])
+("jtq'" "")
+("jtqc" [""])
+("jtqi" [""])
+("jtqu" ["ȡ"])
+("jtqy" [""])
+("jtr'" "")
+("jtre" [""])
+("jtrj" ["Ȼ"])
+("jtry" ["Һ"])
+("jtsg" [""])
+("jtsl" [""])
+("jtsr" [""])
+("jtsv" [""])
+("jttb" ["ͷ"])
+("jttu" [""])
+("jtud" ["̤ʵ"])
+("jtui" ["ʿ" "ʳ"])
+("jtuk" [""])
+("jtul" ["˵"])
+("jtuy" ["ֹͥҵ"])
+("jtv'" ["" ""])
+("jtvj" ["ս"])
+("jtvl" [""])
+("jtvq" [""])
+("jtvs" [""])
+("jtvy" ["" ""])
+("jtw'" "ŽǾާ")
+("jtwh" [""])
+("jtwu" [""])
+("jtwz" ["λ"])
+("jtx'" ["ͨ"])
+("jtxn" [""])
+("jtxw" ["ͷβ"])
+("jtxy" [""])
+("jtyi" ["" ""])
+("jtyr" ["Ե"])
+("jtze" [""])
+("ju'" ["" "ʮ"])
+("jub'" [""])
+("jubf" ["籾"])
+("jubj" ["ٰ"])
+("jubm" ["۱" "ޱ"])
+("jubu" ["ֲ"])
+("jubz" ["ٱ" "߱"])
+("juci" ["ݴ"])
+("jucj" ["۲"])
+("jucl" [""])
+("jucu" ["ִ"])
+("jud'" ["ʱ"])
+("juda" ["޴"])
+("judm" ["ݵ"])
+("judo" ["Ӷ"])
+("juds" ["" "ٶ"])
+("judw" ["赥λ"])
+("jue'" "׾ؾپ")
+("juee" ["޶"])
+("jufa" ["䷨"])
+("jufg" ["" "쫷"])
+("jufj" ["ٷ"])
+("jufl" [""])
+("juft" ["·ͥ"])
+("jufu" ["ʴ" "޷"])
+("jugg" ["۹"])
+("jugm" [""])
+("jugo" ["ٹ"])
+("jugs" ["Ϲ"])
+("jugx" [""])
+("jugz" ["ʱ" ""])
+("juh'" ["»"])
+("juhb" [""])
+("juhe" ["ۺ"])
+("juhf" [""])
+("juhk" [""])
+("juhs" ["ۺ"])
+("juhv" ["ۻ"])
+("juhw" ["ջ"])
+("jui'" [""])
+("juid" ["ⴲ" "ٳɶ"])
+("juih" ["糡"])
+("juii" [""])
+("juir" ["ݴ"])
+("juiu" ["ٳ"])
+("juj'" ["ּ" "ɳ" "" "¼"])
+("jujc" ["۽"])
+("jujd" ["»"])
+("juji" ["ۻ" "ۼ"])
+("jujm" ["ƾ"])
+("jujn" ["н" "н"])
+("jujt" ["׽" "ܾ"])
+("juju" ["۾"])
+("jujx" ["߽"])
+("juki" [""])
+("jukr" ["޿"])
+("jul'" ["ˮ"])
+("jule" [""])
+("juli" ["" "" ""])
+("julm" [""])
+("julq" ["" ""])
+("julx" [""])
+("jum'" ["ģ"])
+("jumm" [""])
+("jumn" [""])
+("jumu" ["Ŀ" "Ŀ"])
+("jumy" ["ó"])
+("jun'" ["ʮ"])
+("juni" [""])
+("jupa" [""])
+("juq'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("juqi" [""])
+("juqr" ["ȫ"])
+("juqy" [""])
+("jur'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "ڪ" "" "" "" "" "" "" "" "" "" "" "" ""])
+("jurf" ["" ""])
+("jurj" ["Ȼ"])
+("jus'" ["ɳ" "˿" "ʯ"])
+("jush" ["ɥ"])
+("jutb" ["ͷ"])
+("jutc" [""])
+("juti" [""])
+("jutr" [""])
+("juu'" ["˵"])
+("juub" [""])
+("juuh" [""])
+("juui" ["ʿ" "" "" ""])
+("juuj" [""])
+("juuo" ["˵"])
+("juup" ["ˮƽ"])
+("juuu" [""])
+("juuv" ["ˮ׼"])
+("juvb" ["װ"])
+("juvd" ["ָ"])
+("juvf" [""])
+("juvh" ["ֳ"])
+("juvi" ["ֹ" ""])
+("juvs" ["" "" ""])
+("juvu" ["ס" ""])
+("juvy" [""])
+("juw'" ["" "" "" "" "" ""])
+("juwf" [""])
+("juwl" [""])
+("juwm" [""])
+("juwz" ["ί"])
+("jux'" ["" "" ""])
+("juxi" ["Ϥ"])
+("juxl" ["ѵ"])
+("juxm" [""])
+("juxn" [""])
+("juxy" ["" "" "" ""])
+("juy'" ["Ա" "ʻԱ" ""])
+("juyb" [""])
+("juyi" [""])
+("juyr" ["Ժ"])
+("juys" ["Ԫ"])
+("juyu" [""])
+("juzi" ["" "" ""])
+("jv'" [""])
+("jvc'" ["ʲ"])
+("jvcl" [""])
+("jvdw" ["׵" "֫"])
+("jvf'" [""])
+("jvfy" ["зӳ"])
+("jvg'" ["ս" "й" ""])
+("jvgd" [""])
+("jvgi" [""])
+("jvgl" ["ֵ"])
+("jvgy" ["ҵ"])
+("jvh'" ["ٻ"])
+("jvid" ["ֵ߶"])
+("jvj'" ["ֱ"])
+("jvjg" ["ṹ"])
+("jvjx" ["е"])
+("jvl'" ["ֵ" "ֵ" ""])
+("jvlv" [""])
+("jvlx" [""])
+("jvm'" ["׼"])
+("jvmj" [""])
+("jvpl" ["ֹƵ"])
+("jvr'" ["֤" ""])
+("jvsu" [""])
+("jvu'" [""])
+("jvuj" [""])
+("jvuv" ["֬"])
+("jvv'" ["ҳ" ""])
+("jvvv" ["ר"])
+("jvw'" ["" ""])
+("jvws" ["ά"])
+("jvx'" ["״"])
+("jvxu" ["ֵʽ"])
+("jvxv" ["״"])
+("jvxw" ["ά"])
+("jvy'" ["Ӫ" "ҵ" "ְԱ"])
+("jvyl" [""])
+("jvyu" [""])
+("jvzb" ["ʱ"])
+("jw'" ["Ϊ"])
+("jwan" ["ٰ"])
+("jwbf" ["ױ"])
+("jwbj" ["а" "Ӱ" "װ"])
+("jwby" ["ױ"])
+("jwbz" ["ӱ"])
+("jwcg" ["в"])
+("jwci" ["ܴ"])
+("jwcj" ["Ҳ"])
+("jwcl" ["Ҳ"])
+("jwd'" ["" ""])
+("jwda" ["Ӵ"])
+("jwde" ["ٵ"])
+("jwdh" ["ҵ"])
+("jwdi" ["ҵ" "׵"])
+("jwdk" ["е"])
+("jwdl" ["д"])
+("jwdm" ["ӵ"])
+("jwdo" ["Ӷ"])
+("jwdy" ["ζ" "ٶ"])
+("jwe'" "ּ׼ؼٽ½ýĽŽƽǽȽɽʽٮ")
+("jwfa" ["ҷ" "ӷ"])
+("jwff" ["׷"])
+("jwfg" ["з"])
+("jwfh" ["׷"])
+("jwfu" ["Ҹ"])
+("jwfz" ["ط"])
+("jwge" ["Ҹ" "۸"])
+("jwgk" ["Ӹ"])
+("jwgl" ["Ӹ"])
+("jwgo" ["Թ"])
+("jwgs" ["й" "ӹ"])
+("jwgu" ["ӹ"])
+("jwgz" ["޸"])
+("jwhb" ["Ӻ" "ֺ"])
+("jwhe" ["κ"])
+("jwho" ["һ"])
+("jwhw" ["ѻ" "ٻ"])
+("jwih" ["ҳ"])
+("jwij" ["Ҳ"])
+("jwip" ["״"])
+("jwis" ["׳"])
+("jwiu" [""])
+("jwjc" ["н"])
+("jwjd" ["ν"])
+("jwji" ["л" "Ӽ" "׻"])
+("jwjn" ["ӽ"])
+("jwju" ["о" "Ҿ" "Ӿ"])
+("jwjw" ["Ҽ"])
+("jwjx" ["ѽ" "ٽ" "޽" "ľѧ"])
+("jwjy" ["ξ" "Ҿ"])
+("jwke" ["׿"])
+("jwkl" [""])
+("jwkr" ["ӿ"])
+("jwks" ["ܿ"])
+("jwky" ["ӿ"])
+("jwlc" [""])
+("jwli" [""])
+("jwlp" [""])
+("jwmf" [""])
+("jwmi" [""])
+("jwmk" ["ð"])
+("jwmo" ["Ĥ"])
+("jwmu" ["Ŀ"])
+("jwmy" [""])
+("jwna" [""])
+("jwni" [""])
+("jwnm" ["" ""])
+("jwnu" ["ū"])
+("jwpg" [""])
+("jwpu" [""])
+("jwq'" "μϼмѼҼЮ٤")
+("jwqd" ["ǿ"])
+("jwqi" [""])
+("jwqm" ["Ǯ"])
+("jwqn" [""])
+("jwqr" ["ȩ"])
+("jwqu" ["Ȣ"])
+("jwqy" ["" ""])
+("jwr'" ["" "" "" "" "" "" ""])
+("jwre" [""])
+("jwrf" ["" ""])
+("jwri" [""])
+("jwro" [""])
+("jwru" ["" ""])
+("jwso" [""])
+("jwsr" [""])
+("jwsu" [""])
+("jwt'" "")
+("jwto" [""])
+("jwtu" [""])
+("jwty" ["ͥ"])
+("jwue" ["" ""])
+("jwuf" [""])
+("jwug" [""])
+("jwuh" [""])
+("jwui" ["ʷ" "" "" "" "ʿ" "ʹ" "" "ʽ" "" "ʻ"])
+("jwuj" ["ɽ" "ɽ"])
+("jwuo" ["˵"])
+("jwuu" ["" "" ""])
+("jwuv" ["֦"])
+("jwvd" ["װ" "ױ"])
+("jwve" [""])
+("jwvh" ["ҳ"])
+("jwvi" ["ֲ" "ֵ"])
+("jwvs" [""])
+("jwvu" ["ע"])
+("jwvv" ["ս"])
+("jww'" "мԼۣ")
+("jwwj" [""])
+("jwwu" ["" ""])
+("jwxd" ["" "" ""])
+("jwxn" ["" ""])
+("jwxt" ["ѧ"])
+("jwxy" [""])
+("jwy'" ["Ժ"])
+("jwya" ["ѹ"])
+("jwyb" [""])
+("jwye" ["ҵ"])
+("jwyi" ["" "" "" ""])
+("jwyj" [""])
+("jwyn" [""])
+("jwyr" ["԰"])
+("jwys" [""])
+("jwyu" ["" "Ԧ"])
+("jwza" [""])
+("jwzi" ["" "" ""])
+("jwzl" [""])
+("jwzo" [""])
+("jwzu" [""])
+("jx'" [""])
+("jxa'" [""])
+("jxan" ["᰸"])
+("jxbf" ["ڱ"])
+("jxbj" ["Ӱ" ""])
+("jxbk" ["ݱ"])
+("jxbl" [""])
+("jxby" [""])
+("jxbz" ["䱸" "籮"])
+("jxcg" ["ײ"])
+("jxci" [""])
+("jxcl" [""])
+("jxcp" [""])
+("jxda" [""])
+("jxdc" [""])
+("jxdg" ["ѧ"])
+("jxdi" ["ӵ"])
+("jxdk" ["ӵ" "ֵ"])
+("jxdl" ["Ӵ" ""])
+("jxdm" ["ӵ" "ڵ"])
+("jxdo" ["ٶ"])
+("jxdp" ["Ķ"])
+("jxdr" ["׶" "ض" ""])
+("jxds" ["ⶳ"])
+("jxdu" ["ⶾ"])
+("jxdv" [""])
+("jxe'" "")
+("jxf'" ["ȷ" "ѧ"])
+("jxfa" ["ҷ"])
+("jxfh" ["ַ" "" "跽"])
+("jxfu" [""])
+("jxg'" ["" "ϸ"])
+("jxgb" ["ṹ"])
+("jxgd" [""])
+("jxgi" ["е"])
+("jxgk" ["Ӹ"])
+("jxgl" ["ڸ"])
+("jxgm" [""])
+("jxgo" [""])
+("jxgr" ["ӹ"])
+("jxgu" ["" ""])
+("jxh'" ["е"])
+("jxhe" ["Ӻ" "" ""])
+("jxho" ["ٻ"])
+("jxhp" [""])
+("jxi'" ["޳"])
+("jxid" ["괯"])
+("jxig" ["߳"])
+("jxii" ["ٳ"])
+("jxil" [""])
+("jxir" ["Ҵ"])
+("jxiu" ["Ӵ" "ܳ" ""])
+("jxj'" ["Լ" "о"])
+("jxjc" ["ό" "ύ"])
+("jxjh" ["ѧƻ" ""])
+("jxji" ["Ӽ" "׼" "ػ" "ٻ" "Ἧ"])
+("jxjm" ["Ӽ" "ڼ" "ڼ" ""])
+("jxjn" ["ӽ" "߾"])
+("jxjq" [""])
+("jxjt" [""])
+("jxju" ["" ""])
+("jxjx" ["ڽ" "" ""])
+("jxjy" ["ݾ" "ྻ" "ᾧ"])
+("jxkb" ["ӿ" "" ""])
+("jxke" ["ݿ" ""])
+("jxkl" ["ҿ" "⿪"])
+("jxkr" [""])
+("jxky" [""])
+("jxl'" ["е"])
+("jxlc" [""])
+("jxli" ["" "" ""])
+("jxlm" [""])
+("jxlp" [""])
+("jxlq" [""])
+("jxlt" [""])
+("jxlu" ["¶" "¼"])
+("jxlv" ["" ""])
+("jxlx" [""])
+("jxmf" [""])
+("jxmg" [""])
+("jxmi" [""])
+("jxmj" [""])
+("jxmk" ["ë"])
+("jxmm" ["" ""])
+("jxmu" ["Ļ" "Ŀ"])
+("jxmz" [""])
+("jxn'" ["е"])
+("jxna" [""])
+("jxpb" [""])
+("jxpi" [""])
+("jxpl" ["ƽ¯" ""])
+("jxpm" ["Ƭ"])
+("jxpo" [""])
+("jxq'" ["" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("jxqi" ["" ""])
+("jxqw" ["Ǣ"])
+("jxr'" "۽")
+("jxrf" ["" ""])
+("jxrh" [""])
+("jxri" [""])
+("jxrj" ["Ȼ"])
+("jxru" [""])
+("jxsj" ["ɢ"])
+("jxsr" [""])
+("jxsv" [""])
+("jxt'" "Ҽ")
+("jxtb" ["ͷ" "ͷ"])
+("jxtc" [""])
+("jxti" ["" "" ""])
+("jxto" [""])
+("jxts" ["ͨ"])
+("jxu'" ["ʡ"])
+("jxub" ["" "" "" ""])
+("jxue" [""])
+("jxug" ["" "ʡ"])
+("jxui" ["ʾ" "" "ʳ" "ʯ" "ʵ" "ʶ" "" "ʱ"])
+("jxuk" [""])
+("jxuo" ["˵" "˵"])
+("jxuu" [""])
+("jxuw" ["С΢"])
+("jxv'" [""])
+("jxva" [""])
+("jxve" [""])
+("jxvh" [""])
+("jxvi" ["ֹ" "" "" "ְ" "ָ" ""])
+("jxvl" ["ծ"])
+("jxvs" ["" ""])
+("jxvu" ["ס" ""])
+("jxw'" "ؽٽڽ۽ܽݽ޽߽ڦڵ")
+("jxws" ["ά"])
+("jxwy" ["еΨ"])
+("jxwz" ["β" "Χ"])
+("jxx'" ["" ""])
+("jxxc" [""])
+("jxxi" ["" ""])
+("jxxl" ["еЧ"])
+("jxxm" ["" "" ""])
+("jxxn" ["е" "" ""])
+("jxxu" [""])
+("jxy'" ["е" "" ""])
+("jxya" ["ǰ"])
+("jxyd" ["е˶"])
+("jxye" ["ҵ"])
+("jxyi" ["" "" ""])
+("jxyj" [""])
+("jxyr" ["Բ"])
+("jxys" ["" ""])
+("jxyt" ["Լ"])
+("jxyu" ["" "" "" "" ""])
+("jxyw" [""])
+("jxyy" ["Ӧ"])
+("jxz'" [""])
+("jxzb" [""])
+("jxzi" ["" "" ""])
+("jxzo" [""])
+("jy'" [""])
+("jyai" [""])
+("jyb'" ["һ" ""])
+("jybk" [""])
+("jybz" [""])
+("jycl" ["" "" "Ե"])
+("jyde" [""])
+("jydi" ["" "" ""])
+("jydk" [""])
+("jydm" ["" ""])
+("jydq" ["õ"])
+("jyds" [""])
+("jydu" ["" "" ""])
+("jydv" [""])
+("jye'" "")
+("jyee" [""])
+("jyfh" ["" ""])
+("jyfv" [""])
+("jyfz" [""])
+("jygd" ["" ""])
+("jyge" [""])
+("jygj" ["" ""])
+("jygk" [""])
+("jygo" [""])
+("jygr" ["" "" "" "" ""])
+("jyhb" [""])
+("jyhd" ["" ""])
+("jyhe" [""])
+("jyhl" [""])
+("jyhu" [""])
+("jyhv" [""])
+("jyhw" ["" "" ""])
+("jyhx" [""])
+("jyia" ["" ""])
+("jyig" [""])
+("jyih" [""])
+("jyik" [""])
+("jyj'" [""])
+("jyji" ["" "" "" "" ""])
+("jyjj" ["Խ"])
+("jyjm" [""])
+("jyjn" [""])
+("jyjq" ["" ""])
+("jyjt" [""])
+("jyju" ["" ""])
+("jyjw" [""])
+("jyjx" ["" "" "" ""])
+("jyjy" [""])
+("jykb" ["" ""])
+("jykd" ["" "" "" ""])
+("jyks" [""])
+("jyl'" ["" "Ӧ" "" "ԣ»"])
+("jyld" [""])
+("jyli" ["" "" "" "" ""])
+("jylm" ["" ""])
+("jylo" [""])
+("jylp" [""])
+("jylq" ["" ""])
+("jylr" [""])
+("jylt" [""])
+("jylv" [""])
+("jyly" ["" ""])
+("jymc" [""])
+("jymi" ["" ""])
+("jyml" [""])
+("jymm" [""])
+("jymo" ["Ĭ"])
+("jymu" [""])
+("jymy" [""])
+("jymz" [""])
+("jynh" [""])
+("jynz" [""])
+("jypd" ["ж"])
+("jypf" [""])
+("jypi" ["" "Ƨ"])
+("jypm" ["Ƭ"])
+("jypo" [""])
+("jypz" [""])
+("jyq'" "ݼ")
+("jyqc" [""])
+("jyqi" ["" ""])
+("jyqj" [""])
+("jyqr" ["Ȯ"])
+("jyqt" ["ȷ"])
+("jyr'" "")
+("jyrf" [""])
+("jyrj" ["Ȼ" "Ȼ"])
+("jyrv" [""])
+("jys'" [""])
+("jyse" ["ɫ"])
+("jysl" ["" ""])
+("jysv" [""])
+("jyt'" ["ѹ" "Ե"])
+("jytb" ["ͷ"])
+("jytc" [""])
+("jyti" ["" ""])
+("jytj" ["̾"])
+("jytl" ["̨" "̬"])
+("jytm" [""])
+("jyts" ["ͨ" "Ͳ"])
+("jyu'" [""])
+("jyua" ["ɴ"])
+("jyub" ["" ""])
+("jyuf" ["" ""])
+("jyug" ["ʣ"])
+("jyuh" [""])
+("jyui" ["ʦ" "" ""])
+("jyuj" ["ɽ" "ɽ"])
+("jyuu" ["" ""])
+("jyuv" ["ˮ"])
+("jyv'" ["վ"])
+("jyvb" ["" "" ""])
+("jyvd" ["ƶ" "״" "׳"])
+("jyve" [""])
+("jyvg" [""])
+("jyvi" ["" "" "" "ֹ" "֮" "ֱ" ""])
+("jyvj" ["տ" "澭"])
+("jyvl" ["ѹ"])
+("jyvs" ["" "" ""])
+("jyvv" ["׵"])
+("jyvy" ["ѹ" "" ""])
+("jyw'" ["" ""])
+("jywu" [""])
+("jywz" ["΢" "γ" "" "η"])
+("jyx'" ["" "ѧ" "ϩ"])
+("jyxc" [""])
+("jyxd" ["" "" ""])
+("jyxi" ["" "Ϸ" "ϲ" "ϸ" "ϩ"])
+("jyxm" ["" ""])
+("jyxn" ["" ""])
+("jyxr" ["ѡ" "ѡ"])
+("jyxt" ["ѧ"])
+("jyxv" [""])
+("jyxw" [""])
+("jyxy" ["" "" ""])
+("jyy'" [""])
+("jyya" ["" "ѹ"])
+("jyyb" ["" ""])
+("jyye" ["Һ"])
+("jyyh" [""])
+("jyyi" ["" "" "" ""])
+("jyyj" ["" "" ""])
+("jyyu" ["" "" ""])
+("jyyw" ["Ϊ"])
+("jyyy" ["Ө" "Ӫ"])
+("jyz'" [""])
+("jyzb" [""])
+("jyzg" [""])
+("jyzi" ["" "" ""])
+("jzf'" ["Ѹ"])
+("jzj'" [""])
+("jzjx" ["Ϣ"])
+("jzm'" [""])
+("jzqv" [""])
+("jzt'" [""])
+("jzx'" [""])
+("k" "")
+("kae'" "")
+("kaer" [""])
+("kafz" [""])
+("kaia" [""])
+("kaie" [""])
+("kaii" [""])
+("kaka" [""])
+("kali" [""])
+("kamf" [""])
+("kano" ["ŵ"])
+("kapj" [""])
+("kapm" ["Ƭ"])
+("kaq'" "")
+("kaqi" [""])
+("kate" [""])
+("kaxx" ["Ѫ"])
+("kban" ["ڰ"])
+("kbcl" ["ڲ"])
+("kbdl" ["ڴ"])
+("kbdq" ["ɱ"])
+("kbe'" ["" ""])
+("kbfa" ["۷"])
+("kbfg" ["ڷ"])
+("kbfu" ["ڷ"])
+("kbfz" ["ֲ"])
+("kbg'" [""])
+("kbgj" ["ڸ"])
+("kbgl" ["ڸ"])
+("kbgs" ["ڹ"])
+("kbhk" ["ں"])
+("kbi'" [""])
+("kbii" ["ڳ"])
+("kbiu" ["۳"])
+("kbjc" ["ڽ"])
+("kbji" ["ڼ"])
+("kbjy" ["ھ"])
+("kbke" ["ڿ"])
+("kbky" ["ɲ"])
+("kbld" [""])
+("kblq" [""])
+("kbly" [""])
+("kbpv" ["Ʒ"])
+("kbq'" ["" "" "" ""])
+("kbqd" ["ǻ"])
+("kbqi" ["" ""])
+("kbqn" [""])
+("kbr'" "ۿޢߵ")
+("kbrh" ["̲ݻ"])
+("kbtb" ["ͷ" "ߵͷ"])
+("kbub" [""])
+("kbue" [""])
+("kbui" ["ʵ"])
+("kbuu" [""])
+("kbuv" ["ˮ"])
+("kbv'" ["ס"])
+("kbvk" [""])
+("kbvs" [""])
+("kbvy" ["ֲ"])
+("kbwf" [""])
+("kbwl" [""])
+("kbwz" ["ζ"])
+("kbxy" [""])
+("kbya" ["ѹ" "Ѻ"])
+("kbyn" [""])
+("kbyu" [""])
+("kbzb" ["ɱʱ"])
+("kbzi" ["" ""])
+("kce'" ["ɶ"])
+("kcgj" ["ݲݸ˾"])
+("kcj'" ["Ļ"])
+("kcm'" [""])
+("kdbk" [""])
+("kdcg" [""])
+("kdch" [""])
+("kde'" "")
+("kdfg" [""])
+("kdfh" [""])
+("kdfu" ["︴"])
+("kdgs" ["" ""])
+("kdh'" [""])
+("kdhr" [""])
+("kdhu" [""])
+("kdhy" [""])
+("kdi'" ["̶ȳ"])
+("kdid" [""])
+("kdie" [""])
+("kdij" [""])
+("kdjd" [""])
+("kdjw" [""])
+("kdjy" [""])
+("kdkd" [""])
+("kdke" [""])
+("kdkg" [""])
+("kdlj" [""])
+("kdml" [""])
+("kdni" [""])
+("kdnu" ["ŭ"])
+("kdq'" ["" "" "" "ڲ" "" ""])
+("kdqr" ["Ȫ"])
+("kdqu" [""])
+("kdqx" [""])
+("kdr'" "")
+("kdre" [""])
+("kdrf" [""])
+("kdri" [""])
+("kdti" [""])
+("kdtu" ["ͼ"])
+("kdu'" [""])
+("kdua" ["ɰ"])
+("kdui" ["ʯ"])
+("kduj" ["ɽ"])
+("kdv'" ["ס"])
+("kdva" [""])
+("kdvh" [""])
+("kdvi" [""])
+("kdvt" ["ɶ"])
+("kdvu" [""])
+("kdw'" "ڿ")
+("kdwh" [""])
+("kdwu" [""])
+("kdxc" ["Ц"])
+("kdxi" ["ϲ"])
+("kdye" ["ҵ" "Ұ"])
+("kdyj" [""])
+("kdzi" ["" "" ""])
+("keai" ["ɰ"])
+("kean" ["ɰ"])
+("keba" ["ɰ"])
+("kebf" ["̱" "α"])
+("kebi" ["ɱ"])
+("kebj" ["ư" "̰"])
+("kebm" ["ɱ"])
+("kebo" ["̱"])
+("kebu" ["ɲ"])
+("kebz" ["ɱ"])
+("kech" ["Ͳ"])
+("kecs" ["ɴ"])
+("keda" ["ɴ"])
+("kedi" ["˵"])
+("kedm" ["͵"])
+("kedu" ["̶" "̶"])
+("kee'" "ɿ")
+("keer" ["ƶ" "˶"])
+("kefb" ["ɷ"])
+("keff" ["ɷ"])
+("kefg" ["ɷ"])
+("kefh" ["ͷ"])
+("kefu" ["˷" "˸"])
+("kegr" ["ɹ" "͹"])
+("kegs" ["ɹ"])
+("kegu" ["̹"])
+("kegv" ["ɹ"])
+("kehf" ["ɺ"])
+("kehj" ["ɺ"])
+("kehk" ["ɺ"])
+("keho" ["ͻ"])
+("kehu" ["ͻ"])
+("kehw" ["̻" "̻"])
+("keie" ["ͳ"])
+("keig" ["γ"])
+("keii" ["ɳ"])
+("keir" ["ʹ"])
+("kejc" ["ƽ"])
+("kejd" ["ɽ"])
+("keji" ["Ƽ" "ͻ"])
+("kejm" ["ɼ"])
+("keju" ["ƾ"])
+("kejy" ["ɾ"])
+("kekb" ["ɿ" "˿"])
+("keke" ["" "ƿ" "ɿ"])
+("kekk" ["ɿ"])
+("keks" ["ɿ"])
+("keku" ["̿"])
+("kela" [""])
+("keli" ["" "" ""])
+("kell" [""])
+("kelm" [""])
+("kelp" [""])
+("kem'" [""])
+("kemj" [""])
+("kemu" ["Ŀ"])
+("kenf" ["ƶ"])
+("keng" [""])
+("keni" [""])
+("kepa" [""])
+("kepu" [""])
+("keq'" "ǿ¿ÿĿſ")
+("keqc" [""])
+("keqi" [""])
+("keqn" [""])
+("keqq" ["" ""])
+("kequ" ["ȡ"])
+("keqy" [""])
+("ker'" "ɿ˿̿Ϳ")
+("kerf" ["" ""])
+("kes'" ["˹"])
+("kesb" [""])
+("kesk" ["˹"])
+("ketb" ["ͷ"])
+("ketc" ["ɵ"])
+("keth" ["" ""])
+("keti" ["" ""])
+("ketu" [""])
+("kety" [""])
+("keub" [""])
+("keuh" [""])
+("keui" ["" "ʳ" "ʱ"])
+("keuu" [""])
+("keuv" ["˰" "˯"])
+("kevh" ["Ƴ"])
+("kevi" ["֪" ""])
+("kew'" "ǿ")
+("kewf" [""])
+("kewh" ["" ""])
+("kewl" [""])
+("kewu" ["ɶ"])
+("kewz" ["ί" "ν"])
+("kexc" ["Ц"])
+("kexi" ["ϧ" "ϲ"])
+("kexr" ["ѡ"])
+("kext" ["ѧ"])
+("kexw" [""])
+("kexx" ["Э"])
+("kexy" [""])
+("keyi" ["" "" ""])
+("keyj" [""])
+("keyp" [""])
+("keys" [""])
+("keyu" [""])
+("kezi" [""])
+("kezo" [""])
+("kf'" [""])
+("kfby" ["籩"])
+("kfdl" ["ŵ·"])
+("kfdy" ["϶"])
+("kfe'" "Ͽпѿ")
+("kffu" ["Ѹ"])
+("kfgh" ["Ÿ"])
+("kfhd" ["ѻ"])
+("kfk'" [""])
+("kfkn" ["˷"])
+("kfqq" [""])
+("kfqu" [""])
+("kfqx" [""])
+("kfqy" [""])
+("kfr'" "")
+("kfs'" ["ɫ"])
+("kfvi" ["ֳ"])
+("kfyk" ["ſ"])
+("kfz'" ["˷"])
+("kfzd" ["˷Ũ"])
+("kgcz" ["͹۴"])
+("kgdk" ["ӵ"])
+("kggs" ["˾"])
+("kgmu" ["ľ"])
+("kgq'" "ӿ")
+("kgqd" [""])
+("kgqi" [""])
+("kgt'" ["йͷ"])
+("kgug" [""])
+("kguz" ["͹ʵ"])
+("kgvl" ["͹"])
+("kgvy" ["͹"])
+("kgx'" ["ѧ"])
+("kh'" [""])
+("khbk" [""])
+("khby" [""])
+("khda" [""])
+("khde" [""])
+("khfu" [""])
+("khhg" [""])
+("khhj" [""])
+("khhs" [""])
+("khjg" [""])
+("khji" [""])
+("khjn" [""])
+("khju" [""])
+("khkl" [""])
+("khle" [""])
+("khli" [""])
+("khlk" [""])
+("khmz" [""])
+("khq'" ["" "" "" "" ""])
+("khqr" ["ȩ"])
+("khr'" "")
+("khre" [""])
+("khri" [""])
+("khsu" [""])
+("khtb" ["ͷ"])
+("khti" [""])
+("khuv" ["˰"])
+("khvf" [""])
+("khvg" [""])
+("khvj" ["ս"])
+("khvo" [""])
+("khw'" "")
+("khxd" [""])
+("khxi" [""])
+("khxs" ["Ѫ"])
+("khxw" ["Ϻ"])
+("khxy" [""])
+("khyi" [""])
+("khyj" [""])
+("khyr" ["ԭ"])
+("khyu" [""])
+("kibg" ["ϲ"])
+("kivj" ["ɳ֮"])
+("kix'" ["ѧ"])
+("kizy" ["Դ"])
+("kjbb" ["Ʊ"])
+("kjbk" [""])
+("kjbu" [""])
+("kjbv" ["ս"])
+("kjby" [""])
+("kjce" [""])
+("kjdc" [""])
+("kjdg" [""])
+("kjdh" ["ռ"])
+("kjdk" [""])
+("kjdl" [""])
+("kje'" "٩ݨ")
+("kjfa" ["" ""])
+("kjfg" ["˼"])
+("kjfl" ["Ʒ¼" "˼"])
+("kjg'" ["ɼ"])
+("kjgo" [""])
+("kjgr" [""])
+("kjhj" ["ռʱ"])
+("kjhs" ["ƺ"])
+("kjhu" [""])
+("kjia" [""])
+("kjig" [""])
+("kjir" [""])
+("kjiu" [""])
+("kjjd" ["վ"])
+("kjjg" ["ռṹ"])
+("kjjm" [""])
+("kjjw" [""])
+("kjke" [""])
+("kjkj" [""])
+("kjlc" [""])
+("kjll" [""])
+("kjmf" [""])
+("kjpo" [""])
+("kjpv" ["ƾ֤"])
+("kjq'" "")
+("kjqi" [""])
+("kjr'" "Ƕ")
+("kjs'" ["" "Ƽ˾"])
+("kjtb" ["͸"])
+("kjtj" ["̽"])
+("kjtl" ["̨"])
+("kjub" [""])
+("kjuh" [""])
+("kjuu" [""])
+("kjvd" ["ƶ"])
+("kjve" [""])
+("kjvp" ["׼"])
+("kjvs" ["" ""])
+("kjwh" [""])
+("kjwu" ["" ""])
+("kjxd" [""])
+("kjxy" [""])
+("kjyn" ["ӡ"])
+("kjzl" [""])
+("kjzo" ["" ""])
+("kjzu" ["˰"])
+("kkan" [""])
+("kkbm" [""])
+("kkbz" ["" ""])
+("kkda" [""])
+("kke'" "")
+("kkg'" ["ɿع"])
+("kkgu" [""])
+("kkhe" [""])
+("kkho" [""])
+("kkia" ["" ""])
+("kkja" [""])
+("kkjn" [""])
+("kkjq" [""])
+("kkju" [""])
+("kkls" ["£"])
+("kklv" [""])
+("kkpx" [""])
+("kkq'" "")
+("kkqn" [""])
+("kkqu" ["ȡ"])
+("kkr'" "")
+("kktt" ["޿"])
+("kkug" [""])
+("kkui" [""])
+("kkuj" ["ɽ"])
+("kkuu" ["ڿ"])
+("kkve" [""])
+("kkvg" ["֤"])
+("kkvs" [""])
+("kkwf" [""])
+("kkx'" ["ɿ"])
+("kkya" ["Ѽ"])
+("kkyj" ["" ""])
+("klbj" [""])
+("klbk" [""])
+("klcl" [""])
+("kldk" ["" ""])
+("kldl" ["ض"])
+("kldr" [""])
+("klds" [""])
+("kle'" "")
+("klfa" [""])
+("klfg" [""])
+("klfh" ["" ""])
+("klfj" [""])
+("klfu" [""])
+("klge" [""])
+("klgo" [""])
+("klgr" [""])
+("klgs" [""])
+("klhd" ["" ""])
+("klho" [""])
+("klhu" [""])
+("klhv" [""])
+("klhw" ["" ""])
+("klid" [""])
+("klie" [""])
+("klig" [""])
+("klih" [""])
+("klip" [""])
+("klir" [""])
+("kliu" [""])
+("kljm" [""])
+("kljt" [""])
+("klju" [""])
+("klkb" [""])
+("klkd" [""])
+("klke" [""])
+("klkf" [""])
+("klko" [""])
+("klks" ["³˹"])
+("kllh" [""])
+("kllo" [""])
+("kllu" ["·"])
+("kllx" [""])
+("klmf" [""])
+("klmg" ["ķֹ"])
+("klmo" ["ģ"])
+("klmu" ["Ļ"])
+("klmy" [""])
+("klp'" [""])
+("klpc" ["Ʊ"])
+("klpi" [""])
+("klpj" [""])
+("klpk" [""])
+("klpy" ["ƽ"])
+("klq'" ["" "" "" "" ""])
+("klqd" ["ǹ" "ǿ"])
+("klqi" [""])
+("klqq" [""])
+("klqt" ["ȱ"])
+("klr'" "")
+("klrj" ["Ȼ"])
+("kls'" ["˹"])
+("klsl" [""])
+("kltb" ["ͷ"])
+("klth" [""])
+("klti" [""])
+("kltj" ["̾"])
+("klto" ["" ""])
+("klts" ["ͨ"])
+("klty" ["ͥ"])
+("klue" [""])
+("klui" ["ʼ" ""])
+("kluj" ["ɽ"])
+("kluu" [""])
+("kluv" ["ˮ"])
+("klvg" [""])
+("klvh" [""])
+("klvi" ["֧"])
+("klvj" ["չ" "ս"])
+("klwl" [""])
+("klxc" [""])
+("klxn" [""])
+("klxr" [""])
+("klxt" ["ѧ"])
+("klye" ["ҵ"])
+("klyj" [""])
+("klyr" ["Ԫ" "Զ"])
+("klzk" [""])
+("kmbx" ["Űѧ"])
+("kmc'" ["Ļ"])
+("kmj'" ["޻"])
+("kmju" ["żɽ"])
+("kml'" ["¡" "Ħ"])
+("kmu'" ["Ļʽ" ""])
+("kmvd" ["֮"])
+("kmz'" ["ñ"])
+("kn'" [""])
+("knd'" [""])
+("knfy" ["淴Ӧ"])
+("knx'" ["" ""])
+("kny'" [""])
+("kobm" [""])
+("kobu" [""])
+("kobx" [""])
+("koda" [""])
+("kohk" [""])
+("kohu" [""])
+("kois" [""])
+("kojm" [""])
+("kojp" [""])
+("koks" [""])
+("koqi" [""])
+("kor'" "")
+("kosj" ["ɢ"])
+("kovh" [""])
+("kovj" ["չ"])
+("koyn" [""])
+("kpbh" [""])
+("kpe'" "")
+("kpfa" [""])
+("kpho" [""])
+("kpis" [""])
+("kpjr" [""])
+("kpjy" [""])
+("kpku" [""])
+("kpl'" [""])
+("kplp" [""])
+("kpmy" [""])
+("kpnj" [""])
+("kpq'" "")
+("kpqu" [""])
+("kpr'" "")
+("kpvu" ["ס"])
+("kpyh" [""])
+("kqdf" ["ȸϷ"])
+("kql'" [""])
+("kqmd" ["ܶ"])
+("kqu'" ["ȸʯ"])
+("kqzl" [""])
+("krda" [""])
+("krdl" [""])
+("krdu" [""])
+("kre'" "")
+("kree" [""])
+("krgd" [""])
+("krhb" [""])
+("krih" [""])
+("krko" [""])
+("krq'" "")
+("krrj" ["ռ"])
+("krrs" [""])
+("kruu" ["ˡ"])
+("krvl" ["խ"])
+("krvv" ["ս"])
+("krwz" ["ο"])
+("krx'" ["ȼ" ""])
+("krxd" [""])
+("krxh" [""])
+("krxm" [""])
+("krxy" [""])
+("kryu" ["ԣ"])
+("krzi" [""])
+("ksbl" ["հ"])
+("ksbu" ["ֲ"])
+("ksde" ["׵"])
+("ksdi" ["յ"])
+("ksdk" ["׵"])
+("ksds" ["ն" "׶"])
+("kse'" "ֿ")
+("ksee" ["ն"])
+("ksfj" ["շ"])
+("ksge" ["ո"])
+("ksgk" ["ظ"])
+("kshd" ["ֻ"])
+("kshe" [""])
+("kshj" ["պ"])
+("kshw" ["ջ"])
+("ksig" ["ճ"])
+("ksjc" ["׽"])
+("ksjd" ["ս"])
+("ksjm" ["ռ"])
+("ksjp" ["վ"])
+("ksju" ["־"])
+("ksjy" ["׾"])
+("kskb" ["׿"])
+("kskd" ["տ"])
+("ksks" ["տ"])
+("ksls" [""])
+("ksmc" [""])
+("ksmo" ["ī"])
+("ksnj" [""])
+("kspa" [""])
+("kspk" [""])
+("ksq'" "")
+("ksqi" [""])
+("ksqm" ["ǰ"])
+("ksqq" [""])
+("ksqt" ["ȸ"])
+("ksr'" "տ")
+("kssu" ["" ""])
+("kst'" ["˹"])
+("kstb" ["Ͷ" "ͷ"])
+("kstc" ["յ"])
+("kstj" ["̸"])
+("kstu" ["˹ˮ"])
+("ksub" [""])
+("ksuu" [""])
+("ksvi" [""])
+("ksvj" ["ս"])
+("ksvl" ["ɥ"])
+("ksvr" ["ת"])
+("ksvs" [""])
+("kswz" ["λ"])
+("ksx'" [""])
+("ksxd" [""])
+("ksxi" ["Ϯ" "϶" "϶"])
+("ksxm" [""])
+("ksxn" [""])
+("ksxt" ["Ѩ" "Ѩ"])
+("ksxu" [""])
+("ksxw" [""])
+("ksxy" [""])
+("ksyp" [""])
+("ksyu" [""])
+("kszi" [""])
+("kszl" [""])
+("kte'" ["" "ض"])
+("ktgi" ["̽"])
+("kthd" [""])
+("ktm'" [""])
+("ktv'" [""])
+("kty'" ["ͷ"])
+("ku'" [""])
+("kuai" ["ᰮ"])
+("kuch" [""])
+("kuck" ["ݲ"])
+("kucp" [""])
+("kudj" ["൨"])
+("kue'" "")
+("kufh" ["ⷿ"])
+("kugj" ["ݸ" ""])
+("kugs" ["๦"])
+("kuhd" ["ݻ"])
+("kuhj" ["޺"])
+("kuhl" ["ຣ"])
+("kuiu" ["" "ദ"])
+("kujc" [""])
+("kujx" ["ݽ"])
+("kuku" [""])
+("kuli" [""])
+("kulm" [""])
+("kulp" [""])
+("kuls" [""])
+("kulu" ["±"])
+("kumf" [""])
+("kumu" ["ľ"])
+("kumy" [""])
+("kunj" [""])
+("kunk" ["" ""])
+("kuq'" ["" "" "" "" "ܥ" "" "ˮ"])
+("kuqi" [""])
+("kur'" "")
+("kure" [""])
+("kurf" [""])
+("kurs" [""])
+("kus'" [""])
+("kuse" ["ɬ"])
+("kusi" [""])
+("kusu" [""])
+("kutb" ["ͷ"])
+("kuti" [""])
+("kuts" ["ʹ"])
+("kutv" [""])
+("kuug" [""])
+("kuuu" ["" ""])
+("kuuv" ["ˮ" "ˮ"])
+("kuvj" ["ս"])
+("kuvs" [""])
+("kuwz" ["ή" "ζ"])
+("kuxc" ["Ц"])
+("kuxf" ["ķ"])
+("kuxn" [""])
+("kuxy" [""])
+("kuyi" [""])
+("kuyk" [""])
+("kuyl" ["ɽѹ"])
+("kuyu" [""])
+("kuzi" [""])
+("kuzk" [""])
+("kv'" ["չ"])
+("kvb'" ["ư"])
+("kvbf" [""])
+("kvbl" [""])
+("kvce" [""])
+("kvdd" ["ׯ"])
+("kve'" "")
+("kvfa" ["ѷ"])
+("kvgz" ["չ"])
+("kvhf" [""])
+("kvho" [""])
+("kvhw" [""])
+("kvji" [""])
+("kvjw" [""])
+("kvks" [""])
+("kvlj" [""])
+("kvlz" [""])
+("kvq'" "")
+("kvqd" ["ǿ"])
+("kvr'" "")
+("kvrk" ["˿"])
+("kvsi" [""])
+("kvsj" ["ɢ"])
+("kvsp" [""])
+("kvss" [""])
+("kvt'" ["̨"])
+("kvtv" [""])
+("kvu'" [""])
+("kvub" [""])
+("kvui" [""])
+("kvw'" "ظ")
+("kvwu" [""])
+("kvwz" ["ΰ"])
+("kvxn" [""])
+("kvyh" [""])
+("kvz'" [""])
+("kvzg" [""])
+("kwbk" [""])
+("kwd'" ["̴"])
+("kwda" [""])
+("kwdu" [""])
+("kwe'" "٨")
+("kwgo" [""])
+("kwjd" ["佱"])
+("kwkb" [""])
+("kwlj" [""])
+("kwq'" "")
+("kwr'" "")
+("kws'" ["ζ"])
+("kwt'" [""])
+("kwtl" ["̨" "̨"])
+("kwto" [""])
+("kwv'" [""])
+("kwvh" [""])
+("kwx'" ["Ц" "ѧ"])
+("kwy'" [""])
+("kwyk" ["ҫ"])
+("kwyt" ["Խ"])
+("kx'" ["ѧ"])
+("kxev" ["֪"])
+("kxgl" ["ѧ"])
+("kxh'" ["ѧ"])
+("kxi'" ["С"])
+("kxj'" ["Լ" "Լ" "ѧ" "ѧ"])
+("kxju" ["ѧ"])
+("kxn'" [""])
+("kxuy" ["ѧ"])
+("kxv'" ["ש"])
+("kxx'" [""])
+("kxy'" ["ѧԺ"])
+("kxyj" ["ѧо"])
+("ky'" [""])
+("kyb'" ["в"])
+("kybj" [""])
+("kybk" ["챨"])
+("kybu" ["첽"])
+("kycj" [""])
+("kydk" ["쵽"])
+("kye'" "")
+("kyer" [""])
+("kygf" [""])
+("kygj" ["" ""])
+("kygs" ["칥"])
+("kyho" [""])
+("kyie" ["쳵"])
+("kyig" ["гɹ"])
+("kyj'" [""])
+("kyjl" ["Դ"])
+("kyjy" ["龥"])
+("kykw" ["п"])
+("kyky" ["" ""])
+("kyl'" ["Ҷ"])
+("kyle" [""])
+("kyma" [""])
+("kymf" [""])
+("kymj" [""])
+("kymz" ["ú"])
+("kyq'" [""])
+("kyqd" ["ѹǿ"])
+("kyr'" "ۦ")
+("kysu" [""])
+("kyty" ["ͧ"])
+("kyu'" ["Ҷ"])
+("kyui" [""])
+("kyvd" ["״"])
+("kyw'" ["Ϊ"])
+("kyyi" [""])
+("kyyk" ["Ҫ"])
+("kyz'" [""])
+("kyzi" [""])
+("kzml" [""])
+("l" "")
+("laba" ["" ""])
+("labi" [""])
+("labj" [""])
+("lade" [""])
+("ladk" [""])
+("lado" [""])
+("lady" [""])
+("lae'" "")
+("lafu" ["" ""])
+("lagj" [""])
+("lagr" [""])
+("lahd" [""])
+("laie" ["" ""])
+("laih" [""])
+("lajc" [""])
+("lajd" [""])
+("laji" [""])
+("lak'" ["¿"])
+("lakl" [""])
+("lali" [""])
+("lalm" [""])
+("lals" ["£"])
+("lama" [""])
+("lamz" ["" "÷"])
+("lapy" ["ƽ"])
+("laq'" "")
+("lar'" "")
+("las'" ["" "Ұ" ""])
+("lasa" [""])
+("lasi" ["˿"])
+("lat'" "")
+("laub" [""])
+("lauf" [""])
+("laui" ["ʺ"])
+("lavi" ["" "ֽ"])
+("lavu" [""])
+("law'" "")
+("laxi" ["ϡ"])
+("layt" [""])
+("lb'" [""])
+("lbb'" [""])
+("lbbj" ["¥"])
+("lbbk" ["Ǳ" "§"])
+("lbcx" [""])
+("lbd'" ["˲"])
+("lbdb" ["©"])
+("lbdm" ["©"])
+("lbds" ["©"])
+("lbdy" ["¥"])
+("lbe'" ["§" "¨" "" "ϰ"])
+("lbfg" ["©"])
+("lbfh" ["¥"])
+("lbgd" ["©"])
+("lbge" ["¥"])
+("lbgl" ["¥"])
+("lbgu" [""])
+("lbh'" [""])
+("lbir" ["¥"])
+("lbiu" ["©"])
+("lbj'" ["" "ܰͽ"])
+("lbk'" ["ȿ"])
+("lbkp" ["β"])
+("lbkx" [""])
+("lblk" ["޲ֿ"])
+("lblp" [""])
+("lbly" [""])
+("lbmm" ["¥"])
+("lbn'" [""])
+("lbnz" ["¥"])
+("lbq'" ["§" "˲" "˲"])
+("lbqi" ["©"])
+("lbqp" ["¥Ⱥ"])
+("lbr'" "©ª¶")
+("lbs'" ["˹" "˾"])
+("lbsu" ["ֲ˼"])
+("lbt'" ["" "" "޲"])
+("lbti" ["¥"])
+("lbtl" ["¥̨"])
+("lbuh" ["¥"])
+("lbuk" ["©"])
+("lbuv" ["©ˮ" "©˰"])
+("lbve" ["§"])
+("lbw'" "¥¦")
+("lbwh" ["©"])
+("lbwj" ["ǱΪ"])
+("lbx'" ["ϰ" ""])
+("lbxb" ["ܰϸ"])
+("lbxi" ["ªϰ"])
+("lbxm" ["©"])
+("lbxw" ["¥" "©"])
+("lby'" [""])
+("lbzi" ["©"])
+("lcbp" ["ִ˲ƣ"])
+("lcck" ["ʲ"])
+("lcdb" ["϶"])
+("lcde" ["˵"])
+("lcdk" ["ϵ"])
+("lcdl" ["ζ"])
+("lcds" ["ɶ"])
+("lce'" "ޤ")
+("lcfa" ["Ʒ"])
+("lche" ["ɺ"])
+("lcie" ["ϳ"])
+("lcig" ["Ƴ"])
+("lcj'" ["׽" "Ż"])
+("lcjq" ["Ͼ"])
+("lcjx" ["˽" "˽"])
+("lckk" [""])
+("lcko" [""])
+("lclc" [""])
+("lcld" ["" ""])
+("lcli" [""])
+("lcny" [""])
+("lcq'" "")
+("lcqi" [""])
+("lcr'" "")
+("lcrk" [""])
+("lctm" [""])
+("lcui" [""])
+("lcw'" "")
+("lcwh" [""])
+("lcxc" ["Ч"])
+("lcxd" [""])
+("lcxi" [""])
+("lcyh" ["" ""])
+("lcyr" ["ԭ"])
+("lczi" [""])
+("ld'" ["쵼"])
+("ldba" [""])
+("ldbd" ["ɶ뵺"])
+("ldbh" ["Ͷ"])
+("ldbj" [""])
+("ldbm" ["" ""])
+("ldbn" [""])
+("ldbx" ["Ͷ" ""])
+("ldch" [""])
+("ldci" [""])
+("ldck" [""])
+("ldde" ["Ͷ"])
+("lddm" [""])
+("lddr" [""])
+("lddu" ["" ""])
+("lddx" ["Ͷ"])
+("lddy" ["·˵ѹ"])
+("lde'" "")
+("ldf'" ["Ͷ"])
+("ldfg" [""])
+("ldfh" [""])
+("ldgd" ["" ""])
+("ldge" [""])
+("ldgf" ["Ͷ"])
+("ldgh" [""])
+("ldgi" ["Ͷ"])
+("ldgj" ["Ͷ" ""])
+("ldgo" [""])
+("ldgv" [""])
+("ldgz" ["Ͷ"])
+("ldh'" ["Ͷ"])
+("ldhe" [""])
+("ldhj" [""])
+("ldhk" [""])
+("ldhu" [""])
+("ldhy" [""])
+("ldia" [""])
+("ldig" [""])
+("ldip" ["ͶƷ"])
+("ldis" [""])
+("ldj'" ["ü"])
+("ldjd" [""])
+("ldjg" ["¢ϼ۸"])
+("ldji" ["" ""])
+("ldjl" ["Ͷ"])
+("ldjn" [""])
+("ldjq" [""])
+("ldjs" ["Ͷ"])
+("ldju" [""])
+("ldjx" ["½"])
+("ldks" [""])
+("ldku" [""])
+("ldky" ["" ""])
+("ldl'" ["Ͷ" "Ͷ"])
+("ldlc" [""])
+("ldli" ["" "" ""])
+("ldlr" ["¢"])
+("ldlz" ["" ""])
+("ldm'" ["½"])
+("ldmf" ["Ͷģ"])
+("ldmm" [""])
+("ldmn" [""])
+("ldmv" [""])
+("ldmy" ["鵤ҩ"])
+("ldn'" ["ϴ" "ϴ"])
+("ldnm" [""])
+("ldpc" ["Ʊ"])
+("ldph" [""])
+("ldpj" [""])
+("ldpl" [""])
+("ldqd" ["Ͷǿ" ""])
+("ldqi" ["" ""])
+("ldqm" ["ǧ"])
+("ldqq" [""])
+("ldqv" ["ͶȺ"])
+("ldr'" ["" "" "" "" "" "" "" "" "Ͷ"])
+("ldrf" [""])
+("ldrm" ["Ͷ"])
+("ldtb" ["ͷ"])
+("ldtc" [""])
+("ldth" [""])
+("ldtj" ["Ͷ" ""])
+("ldtm" [""])
+("ldts" ["Ͳ"])
+("ldub" [""])
+("ldud" ["ˬ"])
+("ldui" ["Ͷ" "ʳ"])
+("lduj" ["Ͷʱ" "ɽ" "ɽ"])
+("ldul" ["Ͷ" "Ͷ" "ɹ"])
+("lduu" [""])
+("lduv" ["ˮ"])
+("ldv'" ["Ͷ" ""])
+("ldve" [""])
+("ldvf" ["Ͷ¸"])
+("ldvi" ["֪" "ֻ"])
+("ldvs" ["" ""])
+("ldw'" ["" "" "" "" "" "" "ܮ" "ݹ" "" "" ""])
+("ldxd" ["" "" ""])
+("ldxj" ["ȶ"])
+("ldxn" [""])
+("ldxw" ["Ͷ"])
+("ldxx" ["Ь"])
+("ldxy" ["" "" "" "޵"])
+("ldy'" ["ϴү" "Դ" "Ե"])
+("ldyb" [""])
+("ldyh" [""])
+("ldyi" ["" ""])
+("ldyk" ["ҩ"])
+("ldyx" ["ͶӢ"])
+("ldzb" ["ʱ" "¢ʱ"])
+("ldzi" [""])
+("ldzk" [""])
+("ldzl" ["Ͷ"])
+("ldzm" ["ĸ"])
+("ldzv" ["¢֯"])
+("lede" ["ֵ"])
+("legr" ["ֹ"])
+("lely" [""])
+("leq'" "")
+("lequ" ["Ȥ"])
+("ler'" "߷")
+("leso" [""])
+("let'" "")
+("letm" [""])
+("letu" [""])
+("leuj" ["ɽ"])
+("leyi" [""])
+("leyr" ["԰"])
+("leyu" [""])
+("lfg'" [""])
+("lfgz" ["ַָ"])
+("lfjg" [""])
+("lfq'" ["Ȩ"])
+("lft'" ["׷" ""])
+("lfy'" ["޷"])
+("lfzw" ["̷"])
+("lg'" [""])
+("lgb'" ["ϸɲ"])
+("lgch" [""])
+("lgdj" ["䵭"])
+("lgds" ["䶳"])
+("lge'" "")
+("lgfg" [""])
+("lggd" [""])
+("lghj" ["亹"])
+("lgj'" ["Ϲ"])
+("lgjc" [""])
+("lgjg" ["˻"])
+("lgjy" ["⾵" "侲"])
+("lgku" ["" ""])
+("lgl'" [""])
+("lglc" [""])
+("lglo" [""])
+("lgmo" ["Į"])
+("lgnr" ["ů"])
+("lgny" [""])
+("lgq'" ["" "«" ""])
+("lgqi" [""])
+("lgqt" ["ȴ"])
+("lgr'" "")
+("lgs'" ["˹" "߸˹"])
+("lgtl" ["̨"])
+("lgtm" [""])
+("lguj" ["ɼ"])
+("lguv" ["ˮ"])
+("lgva" [""])
+("lgvj" ["ս"])
+("lgvu" ["" "ס" "ס"])
+("lgvv" ["׵" "׶"])
+("lgw'" "ܨ")
+("lgx'" ["ϵ"])
+("lgxc" ["Ц"])
+("lgy'" ["Ը"])
+("lgyn" [""])
+("lgyu" [""])
+("lgzo" [""])
+("lh'" [""])
+("lha'" ["Ȼ"])
+("lhb'" ["Ӱ"])
+("lhbz" ["Ǳ"])
+("lhdu" ["ʶ"])
+("lhe'" "")
+("lhfh" ["ȷ"])
+("lhfz" ["˷"])
+("lhg'" ["Ϲ" "Ȼ"])
+("lhgb" ["ǹ" "Ϲ"])
+("lhge" ["ʸ"])
+("lhh'" ["ϻ" "" "򻯺" "Һ"])
+("lhhw" ["˻"])
+("lhi'" [""])
+("lhik" ["˳"])
+("lhj'" ["ϻ" "򻯼" "Ȼ"])
+("lhk'" ["Ȼ"])
+("lhl'" ["Ȼ"])
+("lhlh" [""])
+("lhlu" ["仨ˮ"])
+("lhm'" ["Ȼþ"])
+("lhmj" [""])
+("lhn'" ["ϻţ" "" "Ȼ"])
+("lhq'" ["" "" "Ǧ" "" "Ȼ" "Ȼ"])
+("lhr'" "ݹ")
+("lhrl" ["Ⱦ"])
+("lhss" [""])
+("lht'" ["Ȼ" ""])
+("lhtb" ["ͷ" "ͷ"])
+("lhtk" [""])
+("lhu'" [""])
+("lhum" [""])
+("lhv'" ["" ""])
+("lhvf" [""])
+("lhvs" [""])
+("lhw'" ["" "" "" "" "" "" "" "" "" "" "±" "Ȼ" ""])
+("lhx'" ["п" "Ȼп"])
+("lhy'" ["Ӣ" "ϻ"])
+("lhya" [""])
+("lhyx" ["Ȼ"])
+("liag" ["ﰺ"])
+("lian" [""])
+("lib'" ["̱"])
+("liba" [""])
+("libi" ["" ""])
+("libl" ["" ""])
+("libm" [""])
+("libu" ["" ""])
+("libx" [""])
+("lici" [""])
+("licl" ["" ""])
+("lid'" [""])
+("lide" [""])
+("lidh" [""])
+("lidi" ["" ""])
+("lidl" ["" ""])
+("lidm" [""])
+("lids" [""])
+("lidu" ["" ""])
+("lidy" [""])
+("lie'" "ٵ")
+("lifa" ["" "" "" ""])
+("lifh" [""])
+("lifu" [""])
+("ligf" [""])
+("ligo" [""])
+("ligs" [""])
+("lihe" [""])
+("lihl" ["ﺣ" "" ""])
+("lihp" [""])
+("lihv" [""])
+("lihw" ["" "" ""])
+("liig" ["" ""])
+("liih" ["" ""])
+("liip" [""])
+("lijc" ["" ""])
+("lijd" ["콭"])
+("liji" ["Ｙ" "" "" "" "" ""])
+("lijm" ["" "" ""])
+("lijn" ["" ""])
+("liju" [""])
+("lijw" ["" ""])
+("lijx" ["" "" "" ""])
+("lijy" ["" ""])
+("like" ["" ""])
+("likl" ["뿪"])
+("lila" [""])
+("lilc" [""])
+("lild" [""])
+("lili" [""])
+("lill" [""])
+("lilo" [""])
+("lilp" ["" ""])
+("lils" ["Ū"])
+("lilv" [""])
+("lima" [""])
+("limi" [""])
+("limk" ["ò"])
+("limm" [""])
+("limn" [""])
+("limu" ["ľ"])
+("limy" [""])
+("linm" [""])
+("lins" ["ũ"])
+("liou" ["ż"])
+("lipg" [""])
+("lipn" ["Ʒ"])
+("liq'" "")
+("liqi" ["" "" ""])
+("liqq" ["" ""])
+("liqr" ["Ȩ"])
+("liqu" ["ȥ"])
+("liqy" [""])
+("lir'" "تٳ۪ݰ޺߿")
+("lirf" ["" "" ""])
+("lirh" [""])
+("lirp" [""])
+("liru" [""])
+("lisi" ["˹" ""])
+("lisj" ["ɢ"])
+("liso" ["" ""])
+("lit'" "")
+("litb" ["ͷ"])
+("lith" [""])
+("liti" ["" ""])
+("litm" [""])
+("lits" ["ͨ"])
+("litu" ["ͼ"])
+("liug" ["" ""])
+("liui" ["" "ʱ" "ʷ" "ʱ" "ʽ"])
+("liuu" ["" "" "" "" ""])
+("liuv" ["˰"])
+("livb" [""])
+("livd" ["״"])
+("livg" ["֤" "" ""])
+("livi" ["ְ" "" "֦" "" "־"])
+("livj" ["ս"])
+("livu" ["" ""])
+("liw'" ["" "" "" "" "" "" "" "" "" "" "" "޼" "" "" "" "" "" "" "" "" "" "" ""])
+("liwj" [""])
+("liwl" [""])
+("liwu" ["" ""])
+("lix'" [""])
+("lixd" [""])
+("lixi" ["" "Ϣ" "ϵ"])
+("lixm" ["" "" "" ""])
+("lixn" ["" ""])
+("lixq" [""])
+("lixr" ["ѡ"])
+("lixt" ["ѧ" "ѧ"])
+("lixw" [""])
+("lixy" ["" "" "" ""])
+("liyb" ["" ""])
+("liyh" [""])
+("liyi" ["" "" "" ""])
+("liyj" [""])
+("liyr" ["԰" "Ԩ"])
+("liys" [""])
+("liyt" [""])
+("liyu" ["" "" ""])
+("liyy" ["Ӧ"])
+("lizi" ["" "" "" "" ""])
+("lizu" ["" ""])
+("lj'" [""])
+("ljbf" [""])
+("ljbg" ["Ž̲"])
+("ljbu" [""])
+("ljbx" ["ż"])
+("ljd'" ["ٽ"])
+("ljdc" ["ĵ"])
+("ljde" [""])
+("ljdm" [""])
+("ljdo" [""])
+("lje'" "")
+("ljf'" [""])
+("ljfa" ["ķ"])
+("ljfh" ["ֻ"])
+("ljg'" ["ӹ" "Ź" "ù"])
+("ljgj" [""])
+("ljhe" [""])
+("ljhj" [""])
+("ljhw" [""])
+("lji'" [""])
+("ljie" ["³"])
+("ljj'" [""])
+("ljjx" [""])
+("ljkk" [""])
+("ljl'" [""])
+("ljlu" ["·"])
+("ljly" [""])
+("ljmj" [""])
+("ljmu" ["Ŀ"])
+("ljni" [""])
+("ljq'" ["ۼ" "" "ѽ"])
+("ljqk" ["˽"])
+("ljqq" [""])
+("ljr'" "")
+("ljse" ["ɫ"])
+("ljsi" ["˹"])
+("ljsj" ["ɢ"])
+("ljsw" ["߼˼ά"])
+("ljt'" ["ͼ" "ͤ"])
+("ljtm" [""])
+("ljtu" ["ͼ"])
+("ljug" [""])
+("ljuj" ["ɺ" "߼"])
+("ljvb" [""])
+("ljvu" ["ס"])
+("ljvy" [""])
+("ljw'" "")
+("ljwd" ["ٽ¶"])
+("ljwh" [""])
+("ljwz" ["β"])
+("ljx'" ["߼ѧ" "߼"])
+("ljxi" ["Ϫ"])
+("ljy'" ["ٽѹ" "½Ԩ"])
+("ljyd" ["һ"])
+("ljyk" [""])
+("ljys" [""])
+("ljzi" ["" ""])
+("ljzk" [""])
+("ljzu" [""])
+("lk'" [""])
+("lkb'" ["ݲ"])
+("lkbj" ["ϰ" "ϰ"])
+("lkbk" ["ͱ"])
+("lkbo" ["ϲ"])
+("lkby" ["ϱ"])
+("lkbz" ["ϱ"])
+("lkcl" ["ϲ"])
+("lkda" ["ϴ"])
+("lkdi" ["ϵ" "ϵ"])
+("lkdk" ["ϵ" "߶"])
+("lkds" ["Ͷ"])
+("lkdx" ["ϵ"])
+("lke'" "")
+("lkf'" ["׿"])
+("lkfh" ["η"])
+("lkfl" ["˷"])
+("lkfu" ["Ϸ"])
+("lkgk" ["ϸ"])
+("lkgl" ["͸"])
+("lkgs" ["͹" "Ϲ"])
+("lkgu" ["ι"])
+("lkhj" ["Ϻ"])
+("lkhu" ["ϻ"])
+("lkhw" ["ϻ" "ϻ"])
+("lkig" ["ϳ"])
+("lkih" ["ϳ"])
+("lkjd" ["Ͻ"])
+("lkji" ["μ"])
+("lkjq" ["Ͼ"])
+("lkjw" ["ͼ" "ϼ"])
+("lkkk" ["ο"])
+("lkku" ["Ϳ"])
+("lklc" [""])
+("lkli" ["" "ÿг"])
+("lklk" ["" "" ""])
+("lklm" [""])
+("lkln" [""])
+("lkls" [""])
+("lklu" ["·"])
+("lklz" [""])
+("lkml" [""])
+("lkmo" ["ģ"])
+("lkmy" [""])
+("lknd" [""])
+("lknm" [""])
+("lkns" ["ũ"])
+("lkpl" [""])
+("lkpo" [""])
+("lkq'" "")
+("lkqi" [""])
+("lkqu" ["ȡ" ""])
+("lkr'" "")
+("lkrf" [""])
+("lkro" [""])
+("lksk" ["ɧ"])
+("lksr" [""])
+("lktb" ["ͷ"])
+("lktx" [""])
+("lkub" [""])
+("lkue" [""])
+("lkui" ["ʦ" "ʵ" "ʽ" ""])
+("lkuk" [""])
+("lkuo" ["˵"])
+("lkuu" ["" ""])
+("lkve" [""])
+("lkw'" "")
+("lkwg" [""])
+("lkwh" [""])
+("lkwo" [""])
+("lkwu" [""])
+("lkxc" ["С"])
+("lkxd" [""])
+("lkxq" [""])
+("lkxs" [""])
+("lkyb" [""])
+("lkye" ["ү"])
+("lkyi" [""])
+("lkyk" [""])
+("lkyn" ["ӡ"])
+("lkyr" ["Զ"])
+("lkyu" [""])
+("lkyy" ["ӥ" "Ӫ"])
+("lkz'" [""])
+("lkzi" ["" ""])
+("lkzk" [""])
+("lkzl" [""])
+("lkzo" [""])
+("lkzs" [""])
+("ll'" [""])
+("llan" [""])
+("llbn" [""])
+("lld'" ["" "̵"])
+("lldb" ["Ա"])
+("llde" [""])
+("lldf" [""])
+("lldk" [""])
+("lldm" [""])
+("llex" [""])
+("llfh" [""])
+("llfj" [""])
+("llfu" [""])
+("llgk" [""])
+("llgo" [""])
+("llgv" [""])
+("llh'" ["·"])
+("llhj" [""])
+("llhv" [""])
+("lli'" [""])
+("lljd" [""])
+("lljv" ["쾡"])
+("lljy" [""])
+("llke" [""])
+("llkj" [""])
+("lll'" [""])
+("llli" [""])
+("llln" [""])
+("lllu" ["·"])
+("llmo" ["û"])
+("llnm" [""])
+("llpi" ["Ƥ"])
+("llqm" ["ȥ"])
+("llqq" [""])
+("llqu" ["ȥ"])
+("llr'" "")
+("llrf" [""])
+("llri" [""])
+("lls'" ["˹"])
+("llss" [""])
+("llte" [""])
+("llti" [""])
+("llu'" ["ɽ"])
+("llug" [""])
+("llui" ["" ""])
+("lluo" ["˵"])
+("llus" ["ʧ"])
+("lluu" ["" "ʵʵ"])
+("llv'" ["־"])
+("llve" ["" ""])
+("llvh" [""])
+("llvk" [""])
+("llvw" ["ץ"])
+("llw'" "")
+("llwh" [""])
+("llww" ["" ""])
+("llx'" ["ѧ"])
+("llxn" ["" ""])
+("llyb" [""])
+("llyh" [""])
+("llyi" [""])
+("llyr" ["Դ"])
+("llzi" [""])
+("lm'" [""])
+("lmai" [""])
+("lmb'" ["ë"])
+("lmbd" ["಻"])
+("lmbf" [""])
+("lmbh" [""])
+("lmbo" [""])
+("lmby" [""])
+("lmci" [""])
+("lmd'" ["" ""])
+("lmda" ["" ""])
+("lmdg" ["۹"])
+("lmdj" ["" ""])
+("lmdk" [""])
+("lmdl" [""])
+("lmdv" [""])
+("lme'" "")
+("lmf'" [""])
+("lmfa" [""])
+("lmfh" ["" "ľֻ"])
+("lmgh" [""])
+("lmgj" [""])
+("lmgr" ["" ""])
+("lmgs" ["" ""])
+("lmhe" [""])
+("lmhr" ["" ""])
+("lmhs" [""])
+("lmhw" [""])
+("lmig" [""])
+("lmih" [""])
+("lmii" [""])
+("lmir" [""])
+("lmj'" ["ż"])
+("lmjc" [""])
+("lmji" [""])
+("lmjp" [""])
+("lmjq" [""])
+("lmjw" ["" ""])
+("lmjx" ["" "" "" ""])
+("lmlm" [""])
+("lmlo" [""])
+("lmlp" [""])
+("lmlz" [""])
+("lmmg" [""])
+("lmmh" ["æ"])
+("lmmm" ["" ""])
+("lmmn" [""])
+("lmmy" [""])
+("lmnf" ["ŵ"])
+("lmnm" [""])
+("lmny" [""])
+("lmp'" [""])
+("lmpf" [""])
+("lmpg" [""])
+("lmph" [""])
+("lmpi" ["Ƥ" "Ƥ"])
+("lmpl" [""])
+("lmpm" ["ƪ"])
+("lmpu" [""])
+("lmqq" [""])
+("lmr'" "")
+("lmrf" [""])
+("lmri" [""])
+("lmru" [""])
+("lmsd" [""])
+("lmse" ["ɫ"])
+("lmsl" [""])
+("lmso" ["" ""])
+("lmt'" ["ͼ"])
+("lmtc" [""])
+("lmtm" [""])
+("lmts" ["ͨ" "ͬ"])
+("lmtx" [""])
+("lmu'" [""])
+("lmug" [""])
+("lmui" ["ʽ"])
+("lmuz" [""])
+("lmvi" [""])
+("lmvy" [""])
+("lmw'" "")
+("lmwh" [""])
+("lmwu" [""])
+("lmx'" [""])
+("lmxd" [""])
+("lmxi" ["ϵ" "ϰ"])
+("lmxn" [""])
+("lmxu" [""])
+("lmxx" ["д"])
+("lmyb" [""])
+("lmye" ["ҹ"])
+("lmyn" [""])
+("lmyp" [""])
+("lmys" [""])
+("lmyu" [""])
+("lmyy" ["Ӫ"])
+("lmz'" [""])
+("lmzi" ["" "" "" ""])
+("lmzl" [""])
+("lmzo" ["" ""])
+("lmzu" [""])
+("lnan" ["ٰ"])
+("lnba" ["ܰ"])
+("lnbh" ["ڰ"])
+("lndi" ["ֵ"])
+("lndk" ["ٵ"])
+("lndl" ["ִ"])
+("lne'" "")
+("lnff" ["ַ" "ٷ"])
+("lnfz" ["׷"])
+("lngd" ["׹"])
+("lngl" ["常"])
+("lngo" ["ڹ"])
+("lngr" ["ֹ"])
+("lnhl" ["ֺ" "ٺ"])
+("lnid" ["ٴ"])
+("lnih" ["ֳ"])
+("lnjn" ["ٽ" "ڽ"])
+("lnju" ["ھ"])
+("lnjx" ["ٽ" "ڽ"])
+("lnjy" ["۾"])
+("lnlh" [""])
+("lnli" ["" "" ""])
+("lnln" ["" ""])
+("lnlx" [""])
+("lnly" [""])
+("lnmo" ["ġ"])
+("lnmu" ["ľ"])
+("lnn'" [""])
+("lnpm" ["Ƭ"])
+("lnqj" ["ȫ"])
+("lnqu" [""])
+("lnqw" ["ֿ"])
+("lnqy" [""])
+("lnr'" "")
+("lnse" [""])
+("lnsi" [""])
+("lnsr" [""])
+("lntb" ["ͷ"])
+("lntc" [""])
+("lnu'" ["ŵ" "ʡ"])
+("lnui" ["ʱ"])
+("lnuv" ["ˮ"])
+("lnvf" [""])
+("lnvi" ["֬"])
+("lnvs" ["" ""])
+("lnvy" [""])
+("lnw'" "")
+("lnxd" [""])
+("lnxi" ["ϴ" "ϧ"])
+("lnxj" ["ѡ"])
+("lnxm" [""])
+("lnxt" ["ѧ"])
+("lnxw" [""])
+("lnxy" ["" ""])
+("lnye" ["ҵ"])
+("lnyu" ["ԡ"])
+("lnzi" [""])
+("lobi" [""])
+("lobo" ["ܲ"])
+("lode" [""])
+("lodi" ["" ""])
+("lodj" ["޵"])
+("lodk" ["䵽"])
+("lodm" [""])
+("lody" ["ݶ"])
+("loe'" "")
+("lofu" [""])
+("logu" [""])
+("lohb" [""])
+("lohe" [""])
+("lohj" ["޺"])
+("lohu" ["仧"])
+("lohw" ["仨"])
+("loia" [""])
+("loig" [""])
+("loiv" ["䴸"])
+("lojc" [""])
+("loji" ["߼"])
+("loju" ["ݾ"])
+("lojy" ["޾"])
+("lokd" ["" ""])
+("loke" [""])
+("loks" [""])
+("lola" [""])
+("lolj" [""])
+("loln" [""])
+("lolo" ["" ""])
+("lolu" ["¶"])
+("lolx" [""])
+("lolz" [""])
+("loma" ["" ""])
+("lomk" ["ñ"])
+("lomu" ["ĸ"])
+("lomz" [""])
+("lopj" [""])
+("loq'" "")
+("lor'" "")
+("lori" [""])
+("losi" ["˿" "˹"])
+("loso" [""])
+("losu" [""])
+("lot'" "")
+("loti" ["" ""])
+("loto" [""])
+("loui" ["ʵ"])
+("lour" ["˨"])
+("louv" ["ˮ"])
+("love" [""])
+("lovi" ["֯"])
+("low'" "")
+("lowf" ["" ""])
+("lowh" [""])
+("lowu" [""])
+("loxm" ["" "" ""])
+("loxr" ["" "ѡ"])
+("loxw" [""])
+("loye" ["Ҷ"])
+("loyh" [""])
+("loyi" [""])
+("loyu" [""])
+("lozi" [""])
+("lozl" [""])
+("lpbj" ["ְ"])
+("lpdc" ["۵"])
+("lpdk" ["ֵ"])
+("lpdl" ["ִ"])
+("lpdm" ["۵"])
+("lpdp" ["׶"])
+("lpdr" ["۶"])
+("lpdu" ["ֶ"])
+("lpdv" ["ֶ"])
+("lpfj" ["ַ"])
+("lpgu" [""])
+("lphg" ["ۺ"])
+("lphr" ["ֻ"])
+("lphv" ["ֻ"])
+("lpih" ["׳"])
+("lpii" ["ֳ"])
+("lpir" ["ִ"])
+("lpis" ["ֳ"])
+("lpiu" ["۴"])
+("lpji" ["ֻ"])
+("lpju" ["۾"])
+("lpjw" ["ۼ"])
+("lpko" [""])
+("lpli" ["" ""])
+("lplq" [""])
+("lplx" [""])
+("lpp'" [""])
+("lppj" [""])
+("lpq'" "")
+("lpqn" [""])
+("lpr'" "")
+("lptj" ["̳"])
+("lptl" ["̥"])
+("lpuo" ["˵"])
+("lpuu" [""])
+("lpvb" [""])
+("lpvg" ["" "֤"])
+("lpvj" ["ս"])
+("lpvr" ["ת"])
+("lpvu" [""])
+("lpw'" "")
+("lpwf" [""])
+("lpwz" ["Ϊ"])
+("lpxm" [""])
+("lpxp" ["ѵ"])
+("lpyu" [""])
+("lpz'" [""])
+("lpzi" [""])
+("lpzo" [""])
+("lpzv" [""])
+("lqb'" ["ǰ"])
+("lqbh" [""])
+("lqbi" [""])
+("lqbu" [""])
+("lqby" [""])
+("lqbz" ["" "߰"])
+("lqci" [""])
+("lqcp" [""])
+("lqdc" [""])
+("lqdj" [""])
+("lqdk" [""])
+("lqdm" [""])
+("lqds" [""])
+("lqdu" ["" ""])
+("lqe'" "")
+("lqfa" [""])
+("lqfh" [""])
+("lqge" [""])
+("lqgf" [""])
+("lqgj" [""])
+("lqgz" [""])
+("lqhd" [""])
+("lqhw" [""])
+("lqi'" [""])
+("lqig" [""])
+("lqih" [""])
+("lqij" [""])
+("lqik" [""])
+("lqir" ["" ""])
+("lqj'" [""])
+("lqjc" [""])
+("lqji" [""])
+("lqjn" [""])
+("lqjp" [""])
+("lqjw" [""])
+("lqjy" ["ﾮ" ""])
+("lqkb" [""])
+("lqks" [""])
+("lqld" [""])
+("lqlh" [""])
+("lqli" ["" "" ""])
+("lqlm" ["" ""])
+("lqlo" [""])
+("lqlu" ["¶"])
+("lqmh" ["å"])
+("lqmn" [""])
+("lqnm" [""])
+("lqpl" [""])
+("lqq'" ["" "" "ȴ"])
+("lqqn" [""])
+("lqqy" [""])
+("lqr'" "µ½")
+("lqrf" ["" ""])
+("lqsj" ["ɢ"])
+("lqsr" [""])
+("lqsu" [""])
+("lqtc" ["" ""])
+("lqti" [""])
+("lqts" ["ͨ"])
+("lqu'" ["˳"])
+("lqua" ["ɳ"])
+("lqub" [""])
+("lquf" [""])
+("lqui" ["ʧ" "ʦ" "ʮ"])
+("lquj" ["ɼ"])
+("lquu" [""])
+("lquv" ["ˮ"])
+("lqux" [""])
+("lqvb" [""])
+("lqvf" [""])
+("lqvi" ["ְ" "" "֦"])
+("lqvr" ["ת"])
+("lqvu" ["ס"])
+("lqw'" "")
+("lqwh" ["" ""])
+("lqxm" [""])
+("lqxn" [""])
+("lqxt" ["ѧ" "Ѫ"])
+("lqxw" [""])
+("lqxy" ["" ""])
+("lqyh" [""])
+("lqyi" ["" ""])
+("lqyj" ["" ""])
+("lqys" [""])
+("lqyt" [""])
+("lqyu" [""])
+("lqyy" ["Ӱ"])
+("lqzb" [""])
+("lqzi" [""])
+("lr'" [""])
+("lrds" ["Ҷ"])
+("lre'" "")
+("lrfi" ["շ"])
+("lrgk" ["Ҹ"])
+("lrhd" ["ѻ"])
+("lrik" ["ѳ"])
+("lrj'" ["˼"])
+("lrky" ["ѿ"])
+("lrl'" [""])
+("lrlh" [""])
+("lrli" [""])
+("lrll" [""])
+("lrlx" [""])
+("lrpk" ["" ""])
+("lrq'" ["" ""])
+("lrr'" "")
+("lrt'" ["½͢"])
+("lrug" ["" ""])
+("lrui" ["ʯ" ""])
+("lruo" ["˵"])
+("lrvb" [""])
+("lrvf" [""])
+("lrvv" ["ָ"])
+("lrw'" "")
+("lrxy" [""])
+("lrzb" [""])
+("lrzi" ["" ""])
+("ls'" [""])
+("lsa'" [""])
+("lsb'" ["ᱵ" "¬ɭ"])
+("lsd'" ["˿"])
+("lsdr" ["Ȼ" "¢"])
+("lsds" ["¡"])
+("lse'" ["" "¢" "£" "¤" "" ""])
+("lsfg" [""])
+("lsfy" ["Ӧ"])
+("lsg'" ["" ""])
+("lsgs" [""])
+("lsgu" [""])
+("lshu" [""])
+("lsj'" ["" "" "ɫ"])
+("lsjd" [""])
+("lsju" [""])
+("lsjy" [""])
+("lsk'" ["˹" "¬"])
+("lskb" [""])
+("lsl'" [""])
+("lslo" [""])
+("lsls" ["¡¡"])
+("lsm'" ["þ" "˿ñ"])
+("lsmf" [""])
+("lsn'" ["" ""])
+("lsnj" ["ܼ"])
+("lsnm" [""])
+("lspk" [""])
+("lsq'" "¡")
+("lsqi" ["¡"])
+("lsr'" "Ū")
+("lst'" ["ͭ"])
+("lstb" ["ͷ"])
+("lstf" ["˹з"])
+("lstk" [""])
+("lsts" ["ͳ"])
+("lsu'" [""])
+("lsuj" ["ɽ"])
+("lsvk" [""])
+("lsvs" ["" "¡"])
+("lsvw" ["ɫֲ"])
+("lsw'" "¡")
+("lswh" [""])
+("lsx'" ["п"])
+("lsxi" ["Ϫ"])
+("lsy'" ["" ""])
+("lsya" [""])
+("lsyj" ["" ""])
+("lsyt" [""])
+("lszi" ["" ""])
+("lt'" [""])
+("ltb'" ["̳"])
+("ltdl" ["·" "Դ"])
+("ltdo" ["Ӷ"])
+("lte'" ["" "ͷ"])
+("ltfy" ["ͨ"])
+("ltgo" ["ӹ"])
+("ltjh" ["弸"])
+("ltjw" ["Լ"])
+("ltk'" ["" "¶" ""])
+("ltkc" ["¶쿪"])
+("ltl'" ["¯"])
+("ltlt" [""])
+("ltly" ["ͨ"])
+("ltp'" ["̫"])
+("ltq'" ["ͨ"])
+("ltqu" ["ȡ" "ȥ"])
+("ltr'" "")
+("ltt'" ["̫̫" "ͼ"])
+("lttl" ["·"])
+("lttu" ["ͼ"])
+("ltu'" ["" "·͸"])
+("ltud" ["ֶͨ"])
+("ltvi" ["֪"])
+("ltwz" ["΢"])
+("lty'" ["̫ү" "ү"])
+("ltyh" [""])
+("ltz'" ["ͷ"])
+("lu'" ["ʷ"])
+("luan" [""])
+("lub'" ["ɽ"])
+("lubc" ["·"])
+("lubi" ["¬"])
+("lubj" ["³"])
+("lubl" ["¶"])
+("lubm" ["·"])
+("lubu" ["¬"])
+("lubz" ["·"])
+("ludb" ["ʱ"])
+("lude" ["·"])
+("ludg" ["·"])
+("ludi" ["½"])
+("ludm" ["¶"])
+("ludr" ["·"])
+("ludy" ["¯"])
+("lue'" "«°±²³")
+("luf'" ["ʦ"])
+("lufg" ["½"])
+("lufy" ["ʽӦ"])
+("lufz" ["·"])
+("lug'" ["ʱ" "¹" "ˮ"])
+("lugf" ["«"])
+("lugh" ["¹"])
+("lugo" ["·"])
+("lugr" ["¯"])
+("lugu" ["­" "¶" "½"])
+("luh'" ["»" "¶ˮ"])
+("luho" ["¯"])
+("luhv" ["¯"])
+("luhw" ["«" "±"])
+("luif" ["¯"])
+("luig" ["·"])
+("luil" ["ʷ"])
+("luit" ["̸"])
+("luiu" ["¶"])
+("luj'" ["ʷ" "" "ɼ"])
+("lujd" ["®"])
+("lujg" ["ۼ۸"])
+("luji" ["·"])
+("lujp" ["½"])
+("luju" ["·"])
+("lujy" ["·"])
+("lukb" ["·"])
+("lukd" ["·"])
+("lulc" ["¯"])
+("luln" [""])
+("lult" ["°"])
+("lulu" ["µµ" "½·" "½½" ""])
+("luly" ["ʿ԰"])
+("lum'" [""])
+("lumf" ["¯"])
+("lumh" ["³ç"])
+("lumm" ["¶" "·"])
+("luq'" ["ߣ" "" ""])
+("luqm" ["·ǩ"])
+("luqu" ["¼ȡ"])
+("lur'" "´µ¶·¸¹º»¼½¾ޤ")
+("lurf" ["·"])
+("lurs" ["¹"])
+("luru" ["¼"])
+("lusu" ["±"])
+("lut'" "")
+("lutb" ["¶ͷ"])
+("luth" ["¯"])
+("lutm" ["¶"])
+("lutu" ["·;"])
+("luug" ["«"])
+("luuh" ["·"])
+("luuj" ["®ɽ"])
+("luuu" ["·"])
+("luuv" ["±ˮ" "¶ˮ"])
+("luv'" ["ʱ"])
+("luva" ["¯"])
+("luvb" ["®" ""])
+("luvi" ["¼"])
+("luvj" ["½ս"])
+("luvu" ["¶"])
+("luw'" ["«" "¬" "­" "®" "¯" "" "" "" "" "" "" "" "" "ˬ"])
+("luwf" ["¯"])
+("luwh" ["ɽĻ"])
+("luwz" ["«έ"])
+("lux'" ["ʷ" "ˮ"])
+("luxi" ["«ϯ"])
+("luxm" ["·"])
+("luxp" ["³Ѹ"])
+("luxu" ["½"])
+("luyb" ["½"])
+("luyi" ["·"])
+("luym" ["ү"])
+("luyn" ["¼"])
+("luys" ["¼"])
+("luyu" [""])
+("luyy" ["ʷ" "¶Ӫ" "ʦ"])
+("luzi" ["¯" "·"])
+("luzk" ["¯"])
+("luzu" ["±"])
+("luzw" ["ʳ"])
+("luzy" ["ˮҵ"])
+("lv'" [""])
+("lvbd" ["ݰ뵺"])
+("lvbf" ["ȱ"])
+("lvbj" ["߲"])
+("lvbo" ["" "˲"])
+("lvby" ["֮"])
+("lvci" ["Ŵ"])
+("lvda" ["ô"])
+("lvdb" ["̶"])
+("lvdg" ["̵"])
+("lvdi" ["̵"])
+("lvdl" ["Ĵ"])
+("lvdm" ["õ"])
+("lve'" "")
+("lvfh" ["ȷ"])
+("lvfj" ["̷"])
+("lvfz" ["÷" "̷"])
+("lvgo" ["˹"])
+("lvgr" ["ù"])
+("lvhu" [""])
+("lvhw" ["Ȼ" "̻"])
+("lvia" ["̲"])
+("lvig" ["ó"])
+("lvii" ["˳"])
+("lvj'" [""])
+("lvju" ["þ"])
+("lvke" ["ÿ"])
+("lvli" ["" ""])
+("lvlp" [""])
+("lvlv" ["" ""])
+("lvly" [""])
+("lvq'" [""])
+("lvqi" ["" ""])
+("lvqv" ["ֱ׳"])
+("lvqy" [""])
+("lvr'" "")
+("lvse" ["ɫ"])
+("lvsr" [""])
+("lvtu" [";"])
+("lvu'" [""])
+("lvue" [""])
+("lvui" ["ʦ" "ʫ"])
+("lvuk" [""])
+("lvup" ["˳"])
+("lvuv" ["ˮ"])
+("lvuy" [""])
+("lvvb" [""])
+("lvvh" ["ó"])
+("lvvi" ["" "ֽ"])
+("lvvu" [""])
+("lvw'" "¿")
+("lvx'" ["½"])
+("lvxy" ["" ""])
+("lvy'" [""])
+("lvyb" [""])
+("lvye" ["Һ" "Ҷ"])
+("lvyn" [""])
+("lvyt" ["Լ"])
+("lvyy" ["Ӫ"])
+("lvzk" [""])
+("lw'" [""])
+("lwbj" ["Σ"])
+("lwd'" [""])
+("lwe'" "")
+("lwrf" [""])
+("lwx'" [""])
+("lx'" ["ϵ"])
+("lxap" ["а"])
+("lxb'" ["ϸ"])
+("lxbm" ["ѱ"])
+("lxd'" ["д"])
+("lxdg" ["ӵ"])
+("lxdv" ["ж" "·߶"])
+("lxe'" "")
+("lxfg" ["ѷ"])
+("lxfu" ["з"])
+("lxg'" ["ϵ" "빵" "߹"])
+("lxgb" ["Թ"])
+("lxgo" ["й"])
+("lxgp" [""])
+("lxgu" ["й"])
+("lxhf" ["Ѻ"])
+("lxho" ["һ" "Ի"])
+("lxhu" ["" "ӻ"])
+("lxhw" ["ѻ"])
+("lxhy" ["ϯ"])
+("lxie" ["г"])
+("lxiu" ["г"])
+("lxj'" ["Ļ" "" "¼" ""])
+("lxji" ["Ӽ"])
+("lxju" ["о"])
+("lxjx" ["ѽ"])
+("lxjy" ["нԼ"])
+("lxkb" ["ѿ"])
+("lxkl" ["ѿ"])
+("lxl'" [""])
+("lxnv" ["Ů"])
+("lxny" [""])
+("lxp'" [""])
+("lxpm" ["Ƭ"])
+("lxq'" ["" "ϰ" "ǫ"])
+("lxqd" ["ǿ" "ǹ"])
+("lxqr" ["Ȯ"])
+("lxqu" ["ȡ"])
+("lxqv" ["ϵȺ"])
+("lxr'" ["" "" "" "" "" "" "" "" "" "" "" "" "ϵ"])
+("lxrf" [""])
+("lxri" [""])
+("lxru" ["ʶ" ""])
+("lxt'" ["" "" ""])
+("lxtl" ["·"])
+("lxtv" ["֪ͨ"])
+("lxu'" ["" "ѧ"])
+("lxub" [""])
+("lxuf" [""])
+("lxui" ["" "ʿ" ""])
+("lxuj" ["ϵʵ"])
+("lxuu" [""])
+("lxvi" [""])
+("lxvr" ["д"])
+("lxvv" [""])
+("lxvy" [""])
+("lxwf" [""])
+("lxwz" ["Ϊ"])
+("lxx'" ["" ""])
+("lxxi" ["ϯ" "϶"])
+("lxxu" ["Ѫ"])
+("lxxy" [""])
+("lxy'" [""])
+("lxyd" ["˶"])
+("lxzd" ["ֵ"])
+("lxzi" [""])
+("ly'" [""])
+("lya'" ["Ե"])
+("lyb'" ["һ" "ҵ"])
+("lybj" ["ﲻ"])
+("lybk" ["鱦"])
+("lyd'" ["ŵ"])
+("lydh" [""])
+("lydi" ["" ""])
+("lydk" ["쵼" ""])
+("lydl" [""])
+("lydm" [""])
+("lydu" [""])
+("lydv" [""])
+("lydz" ["۵"])
+("lye'" "")
+("lyfm" ["һ"])
+("lyfy" [""])
+("lyg'" ["Ƹ"])
+("lygj" [""])
+("lyh'" ["" "Ԫ"])
+("lyhh" ["캽"])
+("lyhl" ["캣"])
+("lyho" [""])
+("lyhp" [""])
+("lyhv" [""])
+("lyie" ["鳵"])
+("lyif" ["賿"])
+("lyii" [""])
+("lyj'" ["¼"])
+("lyjc" ["" ""])
+("lyjd" ["콱" ""])
+("lyjh" ["ݽ"])
+("lyji" ["伶"])
+("lyjm" [""])
+("lyjq" [""])
+("lykb" [""])
+("lyks" ["" ""])
+("lyl'" [""])
+("lyli" [""])
+("lylo" [""])
+("lylr" ["" ""])
+("lyls" [""])
+("lylt" [""])
+("lymj" [""])
+("lymn" [""])
+("lymu" ["Ĺ"])
+("lynj" [""])
+("lypd" ["ж"])
+("lyq'" "")
+("lyqc" [""])
+("lyqi" [""])
+("lyqn" [""])
+("lyqu" ["" "ȡ"])
+("lyr'" "")
+("lyrf" [""])
+("lyrl" ["Լ¬"])
+("lyru" [""])
+("lys'" ["·˹" "Ҷ"])
+("lysj" ["ɢ"])
+("lysv" [""])
+("lyt'" ["һ"])
+("lytb" ["ͷ"])
+("lyts" ["ͨ"])
+("lytu" [""])
+("lyty" [""])
+("lyu'" ["¼"])
+("lyub" ["" ""])
+("lyug" [""])
+("lyui" ["ʱ" ""])
+("lyuj" ["ɽ"])
+("lyuv" ["ˮ"])
+("lyv'" ["һ"])
+("lyvi" ["֥"])
+("lyvu" [""])
+("lyw'" "۹")
+("lywh" ["Ӧ"])
+("lywl" [""])
+("lywu" ["" ""])
+("lyx'" ["ϩ"])
+("lyxm" ["" ""])
+("lyxq" [""])
+("lyxu" ["ϵ"])
+("lyxy" ["" "" ""])
+("lyy'" ["" "үү" "" "Ժ" "ҵ" ""])
+("lyyb" ["" ""])
+("lyyd" [""])
+("lyyh" [""])
+("lyyi" ["һ"])
+("lyyj" [""])
+("lyyp" [""])
+("lyyr" ["԰"])
+("lyys" [""])
+("lyyu" ["" ""])
+("lyz'" ["ү"])
+("lyzi" [""])
+("lz'" [""])
+("lzbi" [""])
+("lzbk" ["ױ"])
+("lzbx" [""])
+("lzci" ["۴" ""])
+("lzd'" [""])
+("lzda" ["״"])
+("lzde" ["۵"])
+("lzdm" ["׵"])
+("lzds" ["׶"])
+("lze'" "ڳ")
+("lzfg" ["׷"])
+("lzfj" ["۷"])
+("lzgr" ["׹"])
+("lzgu" ["߹"])
+("lzhf" [""])
+("lzhw" ["Ứ"])
+("lzi'" ["Գ"])
+("lzjh" ["ӽ"])
+("lzji" ["׻" "ۻ" "ۼ"])
+("lzjm" ["ۼ"])
+("lzjn" ["ս" "۽"])
+("lzjw" ["ۼ"])
+("lzjy" ["ྭ"])
+("lzk'" ["ӿ"])
+("lzli" [""])
+("lzlo" [""])
+("lzlq" [""])
+("lzlx" ["ѧ"])
+("lzly" [""])
+("lzlz" [""])
+("lzm'" [""])
+("lzmy" [""])
+("lzno" ["ŵ"])
+("lzq'" "")
+("lzqq" [""])
+("lzr'" "")
+("lzsi" ["" ""])
+("lzt'" "")
+("lztl" ["̨"])
+("lzts" ["ͬ"])
+("lztv" [""])
+("lzty" [""])
+("lzue" [""])
+("lzug" [""])
+("lzuv" ["ˮ"])
+("lzvu" [""])
+("lzvv" ["׸"])
+("lzvw" ["ֲ"])
+("lzw'" "")
+("lzx'" [""])
+("lzxy" [""])
+("lzy'" ["Ԫ"])
+("lzyj" [""])
+("lzyt" [""])
+("lzyu" [""])
+("lzz'" [""])
+("m" "û")
+("maan" [""])
+("mabi" [""])
+("mabm" [""])
+("mabu" ["鲼"])
+("mack" [""])
+("mada" [""])
+("madg" [""])
+("madk" [""])
+("madl" [""])
+("madv" [""])
+("mady" [""])
+("mae'" "")
+("maer" ["" ""])
+("mafh" [""])
+("mafj" ["鷳"])
+("mafu" [""])
+("mafz" [""])
+("magw" [""])
+("mahe" [""])
+("mahu" [""])
+("maie" [""])
+("maig" [""])
+("maih" [""])
+("majc" [""])
+("majw" [""])
+("make" ["" ""])
+("mala" [""])
+("mald" [""])
+("mali" ["" "" ""])
+("malj" [""])
+("mals" [""])
+("malu" ["·"])
+("malx" [""])
+("mama" ["" ""])
+("mamu" ["ľ"])
+("mank" [""])
+("maq'" "ĦĨ")
+("maqp" ["Ⱥ"])
+("maqt" ["ȸ"])
+("mar'" "")
+("marf" [""])
+("masi" ["˹"])
+("masl" [""])
+("mat'" "ô")
+("matb" ["ͷ" "ͷ" "ͷ"])
+("mati" [""])
+("matl" ["̫"])
+("maua" ["ɴ"])
+("maug" [""])
+("mauh" [""])
+("mava" [""])
+("mavf" [""])
+("maw'" "")
+("mawf" [""])
+("maxi" ["Ϸ"])
+("maxm" [""])
+("mayb" [""])
+("mayi" [""])
+("mayk" ["ҩ"])
+("mazi" ["" ""])
+("mazs" [""])
+("mazv" [""])
+("mbbu" ["ĳ"])
+("mbd'" ["򲻵"])
+("mbdi" ["ĳ"])
+("mbdy" ["Դ"])
+("mbe'" "ĳ")
+("mbfj" ["ı"])
+("mbge" ["ĳ"])
+("mbgx" ["Į"])
+("mbhl" ["ı"])
+("mbhw" ["ı"])
+("mbjj" ["׼"])
+("mbjm" ["ĳ"])
+("mbjw" ["ĳ"])
+("mbjx" [""])
+("mbl'" ["ⲻ"])
+("mblt" ["ı"])
+("mblu" [""])
+("mbmb" ["ĳĳ"])
+("mbq'" "")
+("mbqq" ["ı"])
+("mbqu" ["ıȡ" "Ĳȡ"])
+("mbrf" ["ĳ"])
+("mbu'" ["Ī"])
+("mbua" ["ıɱ"])
+("mbuf" ["Ƿ"])
+("mbug" ["ı"])
+("mbui" ["ĳ"])
+("mbvj" ["Ŀת"])
+("mbvs" ["ĳ"])
+("mbvw" ["ľֲ"])
+("mbw'" "ıĲٰ")
+("mbxd" ["ĳ"])
+("mbxx" ["ĳЩ"])
+("mbzh" ["ں"])
+("mbzu" ["Ĭ"])
+("mc'" ["ÿ"])
+("mcbc" [""])
+("mce'" ["" "" "" "" "" "" "" "" "ɲɶ"])
+("mcfz" [""])
+("mcgl" ["ľĸ"])
+("mchv" ["" ""])
+("mchw" ["軭"])
+("mcid" ["紲"])
+("mcji" [""])
+("mcl'" ["Ħ"])
+("mcly" [""])
+("mcmh" ["ã"])
+("mcmu" ["ľ"])
+("mcpu" [""])
+("mcq'" "")
+("mcqi" [""])
+("mcr'" "")
+("mctb" ["ͷ"])
+("mctc" [""])
+("mcth" [""])
+("mcub" [""])
+("mcui" [""])
+("mcuu" [""])
+("mcuw" ["ʵ"])
+("mcve" [""])
+("mcvf" [""])
+("mcvp" ["׼"])
+("mcvs" [""])
+("mcw'" "")
+("mcxc" ["С"])
+("mcxu" ["Ħϵ"])
+("mcxx" ["д"])
+("mcys" [""])
+("mcyu" ["" ""])
+("mczi" [""])
+("mczl" ["Ħ"])
+("mczu" [""])
+("md'" ["Ŀ"])
+("mdd'" ["Ŀĵ"])
+("mddl" [""])
+("mdj'" ["ĵ"])
+("mdjj" ["˹"])
+("mdkd" ["Ŀɿڴ"])
+("mdl'" ["" "ì" "ŵ·"])
+("mdm'" [""])
+("mdsj" ["ϵ˹"])
+("mdu'" ["û˵"])
+("mdvy" ["ä"])
+("mdw'" [""])
+("mebx" ["ض"])
+("mess" ["˹"])
+("met'" ["ô" "" ""])
+("mfbj" ["Ű"])
+("mfdb" ["Ŷ"])
+("mfdk" ["ŵ"])
+("mfer" ["Ŷ"])
+("mffa" ["ŷ"])
+("mffg" ["ŷ"])
+("mffh" ["ŷ"])
+("mfhu" ["Ż"])
+("mfi'" ["޷ĳ"])
+("mfii" ["ų"])
+("mfjy" ["ž"])
+("mfkb" ["ſ"])
+("mfkd" ["ſ"])
+("mfkj" ["ż"])
+("mflb" ["¥"])
+("mflm" [""])
+("mflo" [""])
+("mflu" ["·"])
+("mflz" [""])
+("mfmm" [""])
+("mfnz" [""])
+("mfpc" ["Ʊ"])
+("mfpl" [""])
+("mfq'" "")
+("mfqi" [""])
+("mfqu" ["ʵ"])
+("mfr'" "")
+("mfre" [""])
+("mfrf" [""])
+("mfsw" ["üɫ"])
+("mft'" "")
+("mftu" ["ͽ"])
+("mfug" [""])
+("mfui" [""])
+("mfvf" [""])
+("mfw'" "")
+("mfwl" [""])
+("mfxm" [""])
+("mfxw" [""])
+("mfz'" ["û"])
+("mg'" ["ÿ"])
+("mgbh" ["˰"])
+("mgbi" ["ɱ"])
+("mgdf" ["۴"])
+("mgds" ["ȶ"])
+("mge'" "")
+("mgfa" ["ȷ"])
+("mggh" ["̸"])
+("mggo" ["˹"])
+("mggs" ["͹"])
+("mggu" ["ɹ"])
+("mgh'" ["ع"])
+("mgho" ["ͻ"])
+("mghp" ["ɻ"])
+("mghr" ["λ"])
+("mghu" ["ͻ"])
+("mghw" ["λ"])
+("mgig" ["ɳ"])
+("mgis" ["ͳ"])
+("mgjd" ["ͽ"])
+("mgjm" ["μ"])
+("mgjp" ["˾"])
+("mgjy" ["ξ"])
+("mgke" [""])
+("mgls" [""])
+("mglx" [""])
+("mgmg" [""])
+("mgml" [""])
+("mgpi" ["Ƥ"])
+("mgpm" ["ƭ"])
+("mgpu" [""])
+("mgq'" "")
+("mgr'" ["" "" "ÿ" "ɹ"])
+("mgrb" ["ձ"])
+("mgrj" ["Ȼ"])
+("mgte" [""])
+("mgtx" [""])
+("mgty" ["Լ"])
+("mgub" ["" ""])
+("mgug" [""])
+("mguj" ["ɽ"])
+("mguu" [""])
+("mgvu" [""])
+("mgw'" "åޫ")
+("mgx'" ["ûϵ" ""])
+("mgxd" ["" ""])
+("mgy'" ["Ī"])
+("mgya" ["ѿ"])
+("mgyb" [""])
+("mgyt" ["Լ"])
+("mgz'" ["" "ɹ" ""])
+("mgzg" [""])
+("mgzi" ["" ""])
+("mgzu" [""])
+("mhbq" ["ģ"])
+("mhcs" ["ä"])
+("mhda" ["ä"])
+("mhds" ["ä"])
+("mhe'" "ç")
+("mhgg" ["ɻ"])
+("mhgo" ["â"])
+("mhh'" ["λ"])
+("mhih" ["ä"])
+("mhj'" ["" "þϽ"])
+("mhl'" ["ƺ«"])
+("mhlr" ["æ"])
+("mhlu" ["æµ"])
+("mhmd" ["ºĬ"])
+("mhmh" ["ãã" "çç"])
+("mhmu" ["äĿ"])
+("mhq'" [""])
+("mhrf" ["ä"])
+("mhrj" ["ãȻ"])
+("mhvd" ["çײ"])
+("mhvs" ["â"])
+("mhw'" "âãäåæ")
+("mhwf" ["ä"])
+("mhxc" ["â"])
+("mhxx" [""])
+("mhyu" ["æ"])
+("mi'" [""])
+("mibi" ["ܱ"])
+("mibu" ["ֲ" "ܲ"])
+("midi" ["յ"])
+("midm" ["ܵ"])
+("midu" ["ܶ"])
+("mie'" "")
+("mier" ["׶"])
+("miff" ["׷"])
+("mifg" ["з" "۷" "ܷ"])
+("mifh" ["ط"])
+("mifj" ["׷"])
+("mify" ["Ƿ"])
+("migs" ["Թ"])
+("mihd" ["׻"])
+("miho" ["Ի"])
+("mihp" ["Ի"])
+("mihu" ["Ժ"])
+("mihv" ["ջ"])
+("miji" ["ܼ"])
+("mijm" ["ܼ"])
+("mijt" ["ؾ"])
+("mijx" ["ܽ"])
+("mikh" ["׿"])
+("mild" ["״"])
+("mile" ["" ""])
+("mili" ["" ""])
+("milj" ["" ""])
+("milm" [""])
+("milu" ["·"])
+("mily" [""])
+("milz" [""])
+("mima" [""])
+("mimb" ["ı"])
+("mimg" [""])
+("mimi" [""])
+("mimj" ["" ""])
+("minc" [""])
+("mipc" ["Ʊ"])
+("miq'" "")
+("miqx" [""])
+("mir'" "")
+("mirf" [""])
+("mise" ["ɫ"])
+("mitj" ["̸" "̽"])
+("mitu" [";"])
+("miui" ["ʧ" "ʷ" "ʳ" "ʵ"])
+("miuu" [""])
+("mivb" [""])
+("mivi" ["֬" "ֲ"])
+("mivu" ["ס"])
+("miw'" "")
+("miwh" [""])
+("mix'" ["ûϢ"])
+("mixn" [""])
+("miyb" [""])
+("miyp" [""])
+("miyr" ["Դ"])
+("miyt" [""])
+("miyu" [""])
+("mj'" [""])
+("mjbu" [""])
+("mjdu" ["Ħӵɳ"])
+("mje'" "")
+("mjf'" [""])
+("mjg'" ["û" "ľṹ"])
+("mjgj" [""])
+("mjgu" ["" ""])
+("mjh'" [""])
+("mjhg" [""])
+("mjhw" [""])
+("mjhy" [""])
+("mjie" [""])
+("mjig" [""])
+("mjih" [""])
+("mjkb" [""])
+("mjlf" ["Žз"])
+("mjlg" ["ϼ"])
+("mjli" [""])
+("mjma" ["" "á"])
+("mjmf" [""])
+("mjmj" ["" "" ""])
+("mjmm" [""])
+("mjmu" ["Ŀ"])
+("mjq'" "")
+("mjqd" ["ǻ"])
+("mjr'" "áܬ")
+("mjsu" [""])
+("mjtb" ["ͷ"])
+("mjtj" ["̸"])
+("mjtm" ["" ""])
+("mjuf" [""])
+("mjv'" [""])
+("mjvb" [""])
+("mjw'" "á")
+("mjwx" ["ѧ"])
+("mjxn" [""])
+("mjxy" [""])
+("mjy'" ["ú"])
+("mjyi" [""])
+("mjyj" ["" "" ""])
+("mjyu" ["" ""])
+("mjzb" [""])
+("mjzl" [""])
+("mjzu" ["" "" ""])
+("mkbi" ["ë"])
+("mkby" ["ë"])
+("mkci" ["ë"])
+("mkck" ["é"])
+("mkdp" ["ì"])
+("mkdy" ["í" "ð"])
+("mke'" "íî")
+("mkfa" ["ë"])
+("mkfh" ["ë"])
+("mkgu" ["ê"])
+("mkhk" ["ð"])
+("mkho" ["ð"])
+("mkhv" ["ñ"])
+("mkia" ["ë"])
+("mkis" ["ë" "ð"])
+("mkjn" ["ë" "ð"])
+("mkjx" ["í"])
+("mkkb" ["ð"])
+("mklc" ["ë"])
+("mkli" ["ë"])
+("mklv" ["ë¿"])
+("mkmi" ["ï"])
+("mkmk" ["ëë"])
+("mkmy" ["ð"])
+("mkmz" ["ëù" "ð"])
+("mkpi" ["ë" "ëƤ"])
+("mkpk" ["ð"])
+("mkpl" ["ð"])
+("mkq'" "è")
+("mkr'" "ïðñòó")
+("mkrj" ["óȻ"])
+("mks'" ["˹" "˼"])
+("mksi" ["ò"])
+("mksw" ["˹Τ"])
+("mksy" ["˼"])
+("mkt'" [""])
+("mktb" ["ìͷ"])
+("mktc" ["ë"])
+("mktj" ["ë̺"])
+("mktl" ["ę́"])
+("mkug" ["ïʢ"])
+("mkui" ["ëʫ" "ðʧ"])
+("mkuj" ["éɽ"])
+("mkvd" ["ëװ"])
+("mkve" ["ð"])
+("mkvj" ["ëձ"])
+("mkvu" ["ë"])
+("mkw'" "èéêëì")
+("mkwu" ["é"])
+("mkxi" ["ëϸ"])
+("mkxm" ["ë" "ð"])
+("mkxr" ["ëѡ"])
+("mkyi" ["ë" "ó"])
+("mkyj" ["ð"])
+("mkyu" ["ð"])
+("mkyx" ["üЦ"])
+("mkzi" ["ë" "ñ"])
+("ml'" [""])
+("mlb'" [""])
+("mlbj" [""])
+("mlbo" [""])
+("mlbu" [""])
+("mlch" [""])
+("mlds" [""])
+("mle'" "ݤ")
+("mlfu" ["" ""])
+("mlg'" ["Ħ"])
+("mlgo" [""])
+("mlgz" [""])
+("mlhw" [""])
+("mli'" [""])
+("mlia" [""])
+("mlie" ["" ""])
+("mlis" [""])
+("mliu" [""])
+("mljg" ["ڹ"])
+("mljn" ["" ""])
+("mljw" ["" "" ""])
+("mlli" ["" ""])
+("mlll" [""])
+("mllo" [""])
+("mlmc" [""])
+("mlml" [""])
+("mlmo" ["û"])
+("mlmy" [""])
+("mlns" ["Ū"])
+("mlq'" [""])
+("mlqm" ["Ǯ"])
+("mlr'" "۽")
+("mlsv" [""])
+("mltb" ["ͷ"])
+("mlts" ["ͨ"])
+("mlty" ["ë"])
+("mlu'" [""])
+("mlub" [""])
+("mluf" [""])
+("mlui" ["ʯ"])
+("mlvh" [""])
+("mlvu" ["" ""])
+("mlvy" [""])
+("mlw'" "")
+("mlwf" [""])
+("mlxw" [""])
+("mlxy" [""])
+("mly'" [""])
+("mlya" ["ѿ"])
+("mlyi" [""])
+("mlyn" [""])
+("mlyr" ["Թ"])
+("mlzb" [""])
+("mlzh" ["" ""])
+("mlzi" [""])
+("mm'" ["ÿ"])
+("mmao" ["ް"])
+("mmbk" [""])
+("mmbu" ["޲" "沿"])
+("mmbz" ["ޱ"])
+("mmd'" ["ܵ"])
+("mmde" [""])
+("mmdm" [""])
+("mmdv" [""])
+("mme'" "")
+("mmff" [""])
+("mmfh" ["޷"])
+("mmfz" [""])
+("mmgf" ["ب"])
+("mmgr" [""])
+("mmh'" ["ľ"])
+("mmhh" ["" "ģģ"])
+("mmhw" ["޻"])
+("mmhy" ["廳"])
+("mmif" ["洺"])
+("mmih" ["೤"])
+("mmiu" [""])
+("mmjc" ["潻"])
+("mmjd" ["㵽"])
+("mmji" [""])
+("mmjn" [""])
+("mmjr" ["޾"])
+("mmju" [""])
+("mmks" [""])
+("mmku" ["޿"])
+("mmli" [""])
+("mmln" [""])
+("mmly" [""])
+("mmmk" ["ò"])
+("mmmm" ["" ""])
+("mmmu" ["Ŀ"])
+("mmpc" ["Ʊ" "Ʊ"])
+("mmqd" ["ǿ" "ǽ"])
+("mmqm" ["ǰ" "Ī"])
+("mmqq" ["ǿǿ"])
+("mmqu" ["ȥ"])
+("mmr'" ["" ""])
+("mmrf" [""])
+("mmrs" [""])
+("mmse" ["ɫ"])
+("mmtc" ["" ""])
+("mmtj" ["̸"])
+("mmtm" [""])
+("mmtr" [""])
+("mmts" ["ͪ"])
+("mmu'" ["ë"])
+("mmua" ["ɴ"])
+("mmub" [""])
+("mmui" ["ʳ"])
+("mmuv" ["˰"])
+("mmvd" ["Ŀŵ"])
+("mmvi" ["ְ"])
+("mmw'" "߼")
+("mmww" ["ĬĬ"])
+("mmx'" ["äĿ"])
+("mmxd" ["" ""])
+("mmxm" [""])
+("mmxu" [""])
+("mmya" [""])
+("mmyh" ["" ""])
+("mmyi" ["" "" "" ""])
+("mmyj" [""])
+("mmyk" ["ҩ"])
+("mmyq" [""])
+("mmzi" ["" ""])
+("mn'" ["ÿ"])
+("mnbj" [""])
+("mnbk" [""])
+("mnbm" [""])
+("mnby" [""])
+("mne'" "")
+("mnfa" [""])
+("mnff" [""])
+("mnfh" [""])
+("mnfu" [""])
+("mnfz" [""])
+("mnge" ["" ""])
+("mngj" [""])
+("mngo" [""])
+("mngs" [""])
+("mnh'" ["Ľ"])
+("mnhb" [""])
+("mnhe" [""])
+("mnhh" [""])
+("mnjd" ["" "ẽ"])
+("mnjj" ["ģ"])
+("mnjm" [""])
+("mnjx" [""])
+("mnjy" [""])
+("mnl'" [""])
+("mnli" [""])
+("mnq'" ["ģ"])
+("mnqi" [""])
+("mnqr" ["Ȩ"])
+("mnqy" [""])
+("mnrv" [""])
+("mntm" [""])
+("mntr" [""])
+("mnug" [""])
+("mnui" [""])
+("mnvg" [""])
+("mnvi" [""])
+("mnvs" [""])
+("mnvu" [""])
+("mnw'" "")
+("mnxc" ["У"])
+("mnxn" [""])
+("mnxr" ["ѡ"])
+("mnyi" [""])
+("mnyk" ["ҥ"])
+("mnys" [""])
+("mnzu" [""])
+("mnzv" [""])
+("moai" ["Ĭ"])
+("mobf" ["ġ"])
+("mobi" ["ī"])
+("mobl" ["Ĥ"])
+("mobu" ["Ī"])
+("moca" ["ĥ" "Ħ"])
+("moda" ["Ī"])
+("modg" ["Ħ"])
+("modi" ["" "ī"])
+("modk" ["" "ĥ"])
+("modl" ["ĩ"])
+("modu" ["Ĭ"])
+("moe'" "Ĩ")
+("moer" ["Ħ" "Ī"])
+("mofh" ["ġ" "ģ"])
+("mofj" ["ģ"])
+("mofz" ["Ī"])
+("mogd" ["ĥ"])
+("mogu" ["Ģ"])
+("mogv" ["ħ"])
+("mohe" ["ĥ"])
+("mohk" ["ĥ"])
+("mohu" ["ģ"])
+("mohv" ["Ĩ"])
+("mohz" ["" "Ĩ"])
+("moid" ["ĥ"])
+("moji" ["ī"])
+("mojw" ["ī"])
+("mojy" ["ī"])
+("mokd" ["ĥ"])
+("moky" ["ģ"])
+("molc" ["ĥ" "ĩ"])
+("moli" ["ħ"])
+("molm" ["ĥ" "ĥ"])
+("molo" ["û"])
+("molv" ["ī"])
+("momo" ["ĬĬ" ""])
+("momx" ["ĥ" "ĭ"])
+("moni" ["ġ" "ģ" "Ī"])
+("monj" ["ĥ"])
+("monl" ["Ī"])
+("monm" ["ĩ"])
+("moq'" "")
+("moqi" ["ĩ" "Ĭ" "Ĭ"])
+("mor'" "ѺðûĥĨĩĪīĬĭĮįİ")
+("morf" ["Ĭ"])
+("mori" ["ĩ"])
+("morj" ["ĬȻ" "ĮȻ" "įȻ"])
+("moru" ["û" "Ī" "Ī"])
+("moso" [""])
+("mosp" ["ĥ"])
+("mote" ["ģ"])
+("motm" ["Ħ"])
+("moto" ["Ħ"])
+("moua" ["Ĩɱ" "Ĩɷ"])
+("moub" ["û"])
+("moug" ["İ"])
+("moui" ["ģʽ" "ĥʯ" "ĩ" "Į"])
+("mouu" ["ģ" "ħ"])
+("mouv" ["īˮ"])
+("movi" ["ī֭"])
+("movp" ["׼"])
+("mow'" "ġĢģĤĥĦħ")
+("mowh" ["ħ"])
+("mowz" ["ĩβ"])
+("moxc" ["ĥ"])
+("moxm" ["ī"])
+("moxu" ["Ī" "Ĭ"])
+("moxx" ["Ĭд"])
+("moxy" ["ģ"])
+("moya" ["ģѹ"])
+("moye" ["ĩҶ"])
+("moyh" ["ģ"])
+("moyj" ["Ĥ"])
+("moyu" ["ī"])
+("mozi" ["ī"])
+("mpt'" [""])
+("mpvh" ["ê֧"])
+("mq'" ["Ŀǰ"])
+("mqcj" ["ƾ"])
+("mqhu" ["Ȥ"])
+("mqlp" [""])
+("mqr'" "")
+("mqvy" ["Ȩ"])
+("mqwu" [""])
+("mr'" ["ÿ"])
+("msbk" ["Īɣȿ"])
+("msk'" ["Ī˹"])
+("msl'" ["˹"])
+("msln" ["ī"])
+("mt'" ["ÿ"])
+("mte'" ["¶" "ģض"])
+("mtgy" ["ú̿ҵ"])
+("mtgz" ["ͷ"])
+("mth'" ["ľ̿"])
+("mti'" ["Ħг"])
+("mtj'" ["ę́"])
+("mtkg" ["ͷ"])
+("mtsl" ["˹"])
+("mtt'" [""])
+("mtx'" [""])
+("mtz'" ["̫"])
+("muai" ["ĸ"])
+("mub'" ["в"])
+("mubc" ["Ŀ"])
+("mubf" ["ĸ" "ľ"])
+("mubj" ["ľ" "ľ"])
+("mubu" ["Ļ"])
+("mubz" ["Ĺ"])
+("muck" [""])
+("mucl" ["ľ"])
+("mudi" ["Ĺ" "Ŀ"])
+("mudj" ["ĵ"])
+("mudr" ["ģ"])
+("mudu" ["Ŀ"])
+("mue'" ["" "Ĵ" "ĵ" "Ķ" "ķ" "ĸ" "û¶"])
+("muer" ["ľ" "¶"])
+("mufa" ["ľ"])
+("mufg" ["ĸ"])
+("mufu" ["Ļ"])
+("mugd" ["Ŀ"])
+("mugj" ["ʤż"])
+("mugp" ["ľ"])
+("mugs" ["ľ" ""])
+("muhb" ["ĸ" "Ļ"])
+("muhi" ["ֻش"])
+("muih" [""])
+("muij" ["Ķ"])
+("muil" ["ľ"])
+("muir" ["ľ"])
+("mujd" ["ľ"])
+("muji" ["ĸ" "ļ" "Ŀ"])
+("mujr" ["ļ"])
+("muju" ["ģ"])
+("mujy" ["Ŀ"])
+("muke" ["ľ"])
+("mul'" ["ĸ"])
+("mulc" ["ľ"])
+("muli" ["Ŀ"])
+("mulj" ["ľ"])
+("muln" ["ľ" ""])
+("muls" ["ľ"])
+("mulu" ["Ŀ¼"])
+("mum'" ["ûʲô"])
+("muma" ["ľ"])
+("mumk" ["ÿʱÿ"])
+("mumn" [""])
+("mumu" [""])
+("mumy" ["Ľ"])
+("munm" ["ĺ"])
+("muou" ["ľż"])
+("mupl" ["ľ"])
+("muqi" ["ľ"])
+("muqm" ["Ŀǰ"])
+("muqn" ["ĸ"])
+("muqu" [""])
+("mur'" ["Ĳ" "Ĺ" "ĺ" "Ļ" "ļ" "Ľ" "ľ" "Ŀ" "" "" "" "" "" "" "" "" "İ"])
+("murf" ["ľ" ""])
+("murs" ["Ľ"])
+("muse" ["ĺɫ"])
+("muss" ["Ŀ"])
+("mut'" [""])
+("mutb" ["ľͷ"])
+("muti" ["ĸ"])
+("mutj" ["ľ̿"])
+("muts" ["ͯ"])
+("muui" ["ľʯ" "ʦ"])
+("muuu" ["ĸ" "ľ"])
+("muv'" ["鳤"])
+("muvi" ["Ĵָ" "ķָ" "ľ"])
+("muvu" ["ĸ" "ĸ" "û"])
+("muvy" [""])
+("muw'" "ģ")
+("muwk" ["ʲά"])
+("muwu" ["ľ"])
+("muxc" ["ĸУ"])
+("muxi" ["ĸϵ" "ľ"])
+("muxm" ["ĸ"])
+("muxu" [""])
+("muxw" ["Ŀ"])
+("muy'" ["ʿӢ"])
+("muya" ["ģѹ"])
+("muye" ["ĸҺ" "ҵ"])
+("muyh" ["ģ" "ĸ" ""])
+("muyn" ["ĸ"])
+("muyu" ["" "ԡ"])
+("muzh" ["Ĺ"])
+("muzi" ["ĸ"])
+("mv'" [""])
+("mvb'" ["ľʲ" ""])
+("mvbz" ["в"])
+("mvdp" [""])
+("mvdt" ["Ī۴"])
+("mvg'" ["޹" ""])
+("mvgf" ["֪ʷ"])
+("mvgg" ["ĸ"])
+("mvgm" [""])
+("mvjv" [""])
+("mvm'" ["Ĺ־"])
+("mvmg" ["֬"])
+("mvp'" ["ë֯Ʒ" "֯Ʒ"])
+("mvs'" ["ľ"])
+("mvvv" ["" "ר"])
+("mvwr" ["Ŀ"])
+("mvwx" ["ά"])
+("mvx'" ["ëϯ"])
+("mws'" ["β"])
+("mwx'" ["ڤ"])
+("mx'" ["ĳЩ"])
+("mxa'" [""])
+("mxb'" ["Բ"])
+("mxbt" ["Ϫ̸"])
+("mxg'" ["ëϸ" "ī"])
+("mxgi" ["ī"])
+("mxgw" ["ī"])
+("mxho" [""])
+("mxji" [""])
+("mxjp" [""])
+("mxjt" [""])
+("mxkb" [""])
+("mxq'" "ؿ")
+("mxr'" "")
+("mxui" [""])
+("mxv'" ["ϸ"])
+("mxvy" ["ð"])
+("mxw'" ["ά"])
+("mxwh" [""])
+("mxy'" ["Ī"])
+("my'" ["û"])
+("myan" [""])
+("mybl" [""])
+("myce" [""])
+("myci" ["" ""])
+("mycl" [""])
+("mycy" [""])
+("myde" [""])
+("mydg" [""])
+("mydj" [""])
+("mydk" [""])
+("mydl" [""])
+("mye'" "")
+("myee" [""])
+("myer" [""])
+("myff" [""])
+("myfh" [""])
+("myfj" [""])
+("myg'" ["ûй"])
+("mygb" [""])
+("mygv" [""])
+("mygz" ["幤"])
+("myhk" [""])
+("myhw" [""])
+("myig" [""])
+("myij" [""])
+("myiu" [""])
+("myjc" ["" ""])
+("myjd" [""])
+("myji" [""])
+("myjv" ["ý"])
+("myjw" [""])
+("myjy" ["" ""])
+("myke" [""])
+("myky" [""])
+("myl'" ["ѿ"])
+("mylc" [""])
+("myld" [""])
+("mylh" [""])
+("myli" ["" ""])
+("mylq" [""])
+("mylv" [""])
+("myly" ["" ""])
+("myma" [""])
+("myml" [""])
+("mymu" ["Ŀ"])
+("mymy" ["" ""])
+("mymz" [""])
+("mynm" [""])
+("mypl" ["" ""])
+("mypm" ["Ƭ"])
+("myqd" ["ǹ"])
+("myqi" [""])
+("myqt" ["ȷ"])
+("myr'" "")
+("myrf" ["" ""])
+("myri" [""])
+("myt'" ["ѿ"])
+("myth" [""])
+("myti" [""])
+("mytm" [""])
+("myug" ["" "ʤ"])
+("myui" ["ʱ" "ʵ" "ʿ" "óг"])
+("myuj" ["ɽ"])
+("myuo" ["˵"])
+("myuu" [""])
+("myvg" ["" "֤"])
+("myvi" ["֪" ""])
+("myvk" [""])
+("myvs" ["" ""])
+("myvu" ["" "" ""])
+("myw'" "ڤ")
+("mywf" ["" ""])
+("mywh" [""])
+("myxd" ["óЭ"])
+("myxi" [""])
+("myxm" [""])
+("myxt" ["ѧ"])
+("myxw" [""])
+("myxy" [""])
+("myyi" ["ҽ" ""])
+("myyj" [""])
+("myyp" [""])
+("myyu" [""])
+("myzi" ["" ""])
+("myzk" [""])
+("mzba" ["û"])
+("mzcg" ["ú"])
+("mzci" ["ÿ"])
+("mzco" ["û"])
+("mzcp" ["÷"])
+("mzd'" ["ë"])
+("mzde" [""])
+("mzdh" ["ÿ"])
+("mzdp" ["ÿ"])
+("mzdu" ["÷"])
+("mzdx" ["ë˼"])
+("mze'" "ÿþ")
+("mzeg" ["ض"])
+("mzfa" ["û"])
+("mzff" ["ÿ"])
+("mzfg" ["ÿ"])
+("mzfu" ["÷"])
+("mzge" ["ÿ"])
+("mzgj" ["û" ""])
+("mzgm" [""])
+("mzgo" [""])
+("mzgr" [""])
+("mzgv" ["õ"])
+("mzh'" ["廯"])
+("mzhk" ["ú" ""])
+("mzho" ["ú"])
+("mzhu" ["ÿ"])
+("mzhv" ["ÿ"])
+("mzhw" ["÷" ""])
+("mzj'" [""])
+("mzjd" ["˶"])
+("mzjf" [""])
+("mzjn" [""])
+("mzjp" ["ù"])
+("mzjq" [""])
+("mzju" ["ö"])
+("mzjw" ["ÿ"])
+("mzjx" ["ý"])
+("mzjy" [""])
+("mzkd" ["ú"])
+("mzke" ["ÿ"])
+("mzlc" ["û"])
+("mzli" ["" ""])
+("mzlj" ["ù"])
+("mzln" ["÷"])
+("mzlu" ["ú¯"])
+("mzly" [""])
+("mzlz" ["ø"])
+("mzmc" ["ÿ" ""])
+("mzmd" ["ì"])
+("mzmg" [""])
+("mzmj" [""])
+("mzmk" ["üë"])
+("mzmu" ["üĿ"])
+("mzmy" [""])
+("mzmz" ["ÿÿ" ""])
+("mznm" ["ÿ"])
+("mznv" ["Ů"])
+("mzpd" ["ƽ"])
+("mzpl" ["ÿ"])
+("mzpo" ["ý"])
+("mzqi" ["ú" "ÿ"])
+("mzqq" ["ú"])
+("mzqx" [""])
+("mzr'" "")
+("mzrf" ["ý" "ÿ" ""])
+("mzri" ["ÿ"])
+("mzrs" [""])
+("mzsu" ["ù"])
+("mztb" ["üͷ"])
+("mztj" ["ú̿" "̸" "Ž"])
+("mztm" ["ú" "ÿ"])
+("mzua" ["þɰ"])
+("mzuk" ["ü"])
+("mzuu" [""])
+("mzva" ["ú"])
+("mzvb" ["ÿ" ""])
+("mzvi" ["ý"])
+("mzvp" ["û׼"])
+("mzvr" ["þש"])
+("mzvy" [""])
+("mzw'" "ûõö÷øùúüýݮ")
+("mzwh" ["Ļ"])
+("mzwl" [""])
+("mzwt" [""])
+("mzwz" ["ζ"])
+("mzxi" ["úϵ"])
+("mzxt" ["ѧ"])
+("mzxy" ["ѧԺ"])
+("mzyb" ["ú" "û"])
+("mzyi" ["ÿһ"])
+("mzyj" ["ú" "ü"])
+("mzyk" ["úҤ"])
+("mzyp" ["ѹ"])
+("mzyr" ["Ԫ"])
+("mzys" ["û"])
+("mzyt" ["ÿ"])
+("mzyu" ["÷" ""])
+("mzyx" ["Ӣ"])
+("mzzb" ["ʱ"])
+("mzzi" ["÷" ""])
+("mzzj" ["ʲ׼"])
+("mzzv" [""])
+("n" "")
+("nabj" ["ǰ"])
+("nabm" ["Ǳ"])
+("nacl" ["ǲ"])
+("nacv" ["ɴ"])
+("nada" ["ô"])
+("nadk" ["õ"])
+("nae'" "")
+("naer" ["Ķ" "Ƕ"])
+("nage" ["ĸ" "Ǹ"])
+("nags" ["ɹ"])
+("nagz" ["ø"])
+("nahj" ["ź"])
+("nahv" ["ǻ"])
+("naiu" ["ó"])
+("najq" ["Ǿ"])
+("nald" [""])
+("nali" ["" ""])
+("nall" [""])
+("nalu" ["·"])
+("namc" [""])
+("name" ["ô"])
+("namf" [""])
+("nang" [""])
+("napa" [""])
+("naq'" "")
+("naqi" [""])
+("naqu" ["ȥ"])
+("nar'" "")
+("naru" [""])
+("nat'" "")
+("naub" [""])
+("naui" ["ʱ" ""])
+("nauv" ["˰"])
+("nave" [""])
+("navs" [""])
+("navu" ["ס"])
+("naw'" "")
+("nawz" ["λ" "λ"])
+("naxx" ["Щ" "Щ"])
+("nayb" [""])
+("naye" ["Ҳ"])
+("nayh" [""])
+("nayj" [""])
+("nazb" [""])
+("nazj" [""])
+("nb'" ["ڲ"])
+("nbe'" ["Ჴ"])
+("nbi'" ["ϱ"])
+("nblx" ["ڲϵ"])
+("nbmd" ["ڲì"])
+("nbnv" ["Ůװ"])
+("nbq'" ["ϰ"])
+("nbr'" "")
+("nbyh" ["ϱ"])
+("ncbu" [""])
+("nce'" "")
+("ncer" [""])
+("ncgu" ["ũ幫"])
+("ncik" [""])
+("ncj'" ["ڴ"])
+("ncls" [""])
+("nclz" [""])
+("ncpf" [""])
+("ncpm" ["Ƭ"])
+("ncqd" ["ǹ"])
+("ncr'" "")
+("ncsu" [""])
+("ncub" [""])
+("nd'" [""])
+("nder" [""])
+("ndjq" [""])
+("ndjw" [""])
+("ndl'" ["涨"])
+("ndmi" [""])
+("ndnd" [""])
+("ndr'" "")
+("ndu'" ["ѵ˵"])
+("ndw'" "")
+("ndx'" ["ܶ"])
+("ndz'" ["ڵ"])
+("ndzi" [""])
+("ndzk" [""])
+("nehi" ["Ŭ"])
+("nem'" [""])
+("ner'" "ګ")
+("net'" "")
+("new'" "")
+("nfb'" ["ڷ"])
+("nfbx" ["ڷ"])
+("nfip" ["ũƷ"])
+("nflq" ["긻ǿ"])
+("nflv" [""])
+("nfr'" "")
+("nfwy" ["ŮԱ"])
+("nfya" ["ѿ"])
+("ng'" ["ܹ"])
+("ngba" ["ܰ"])
+("ngd'" ["̵"])
+("ngdl" ["ܴ"])
+("ngds" ["ܶ"])
+("ngdv" ["ܶ"])
+("nge'" "")
+("ngfb" ["ܷ"])
+("nggb" ["ܹ"])
+("nggj" ["ܸ"])
+("ngjd" ["ܽ"])
+("ngji" ["ܼ"])
+("ngjm" ["ܼ"])
+("ngl'" [""])
+("ngld" [""])
+("ngli" [""])
+("ngm'" ["ָ"])
+("ngnl" [""])
+("ngnv" ["иŮ֯"])
+("ngqj" ["ܹɽ"])
+("ngqx" ["ڹ"])
+("ngr'" "")
+("ngrf" [""])
+("ngub" [""])
+("ngui" ["ʹ" ""])
+("nguu" ["ţ"])
+("ngve" [""])
+("ngvi" ["֪"])
+("ngw'" "")
+("ngwz" ["Ϊ"])
+("ngy'" ["Ů"])
+("ngyb" [""])
+("ngyi" [""])
+("ngyr" ["Դ"])
+("ngys" [""])
+("ngzo" [""])
+("nhcl" ["ͻ"])
+("nhd'" ["ͻ"])
+("nhe'" ["߭" "" "" "ǻ"])
+("nhj'" ["ڻ" "ϼ"])
+("nhko" [""])
+("nhl'" ["³"])
+("nhnt" ["ͻ"])
+("nhpz" [""])
+("nhq'" "")
+("nhv'" ["ͻש"])
+("nhw'" "")
+("nhx'" ["ͺ"])
+("nhz'" ["Ů"])
+("ni'" [""])
+("niai" ["簮"])
+("niba" [""])
+("nibx" [""])
+("nibz" ["㱻"])
+("nicl" [""])
+("nide" [""])
+("nidy" ["ⶨ" "ⶩ"])
+("nie'" "")
+("nifg" [""])
+("nifh" ["㷽"])
+("nigd" [""])
+("nigk" [""])
+("nigs" ["๤"])
+("nigu" [""])
+("nihe" [""])
+("nihk" [""])
+("nihs" ["޺"])
+("niia" [""])
+("nijd" ["ཬ"])
+("nijy" ["澳"])
+("nike" [""])
+("nikg" [""])
+("nil'" [""])
+("nilc" [""])
+("nill" [""])
+("nilq" [""])
+("nils" [""])
+("nimf" [""])
+("nimy" ["" ""])
+("nink" [""])
+("niny" ["Ţ"])
+("nip'" ["ũƷ"])
+("niq'" "")
+("niqq" [""])
+("niqu" ["ȥ"])
+("nir'" "٣")
+("nirf" [""])
+("nirs" [""])
+("nisi" ["˹" ""])
+("nisu" [""])
+("nitj" ["̶" "̿"])
+("nitu" [""])
+("niu'" ["ϲ"])
+("niui" [""])
+("niuv" ["ˮ" "ˮ" "ˮ"])
+("nivi" [""])
+("nivr" ["ת"])
+("niw'" "")
+("niwz" ["ζ"])
+("nix'" ["ϳ"])
+("niya" [""])
+("niyi" [""])
+("niyj" [""])
+("niyk" ["Ҫ"])
+("nizi" [""])
+("nizl" [""])
+("nizo" [""])
+("nj'" ["꼶"])
+("njbj" ["Ѱ"])
+("njbk" ["ѱ"])
+("njbm" ["ϱ"])
+("njbu" ["ϲ"])
+("njbz" ["ϱ"])
+("njde" ["ѵ"])
+("njdk" ["ѵ"])
+("njdm" ["ѵ"])
+("njdu" ["Ѷ"])
+("njdv" ["ж"])
+("nje'" "")
+("njer" ["ж"])
+("njfg" ["Ϸ"])
+("njfh" ["Ϸ" "з"])
+("njfl" ["ũҷ"])
+("njfy" ["Ӧ"])
+("njfz" ["Ϸ"])
+("njgo" ["Ϲ" "ѹ"])
+("njgr" ["Ϲ" "ѹ"])
+("njgs" ["Ϲ"])
+("njgw" ["Ϲ"])
+("njgy" ["ѹ"])
+("njhe" ["Ϻ"])
+("njhj" ["Ϻ"])
+("njhl" ["Ϻ" "к"])
+("njhv" ["ϻ"])
+("njhw" ["ϻ"])
+("njig" ["ϳ"])
+("njih" ["ϲ"])
+("njij" ["Ѳ"])
+("njik" ["ϳ"])
+("njis" ["ϳ"])
+("njiu" ["Ѵ"])
+("njji" ["ϼ"])
+("njjp" ["Ͼ" "Ͽ"])
+("njjy" ["Ͼ"])
+("njkb" ["Ͽ"])
+("njkj" ["ѿ" "ѿ"])
+("njkl" ["Ͽ"])
+("njlg" [""])
+("njlq" [""])
+("njlv" [""])
+("njly" [""])
+("njmf" [""])
+("njmj" [""])
+("njmm" ["" ""])
+("njmn" [""])
+("njmu" ["ľ"])
+("njmy" [""])
+("njmz" [""])
+("njnf" ["ѽѷ"])
+("njnj" [""])
+("njnv" ["Ů"])
+("njny" [""])
+("njou" ["ŷ"])
+("njpi" ["Ƥ"])
+("njpv" ["ũƷ"])
+("njpy" ["ƽ"])
+("njq'" "")
+("njr'" "")
+("njrf" ["" ""])
+("njss" [""])
+("njth" [""])
+("njti" [""])
+("njts" ["ͨ"])
+("njty" [""])
+("nju'" ["Ͼ" "ˮ"])
+("njub" [""])
+("njue" [""])
+("njug" [""])
+("njui" ["ʷ" "" ""])
+("njuj" ["ɽ"])
+("njuo" ["˵"])
+("njv'" ["ϼ"])
+("njvi" [""])
+("njvk" ["گ" ""])
+("njvs" [""])
+("njw'" "")
+("njwf" [""])
+("njwh" ["" ""])
+("njwz" ["Υ" "Ϊ"])
+("njx'" [";"])
+("njxt" ["ѧ"])
+("njxy" [""])
+("njy'" ["ڽԲ"])
+("njya" [""])
+("njyh" ["" ""])
+("njyi" [""])
+("njyt" ["Խ"])
+("njyu" [""])
+("njzi" [""])
+("nkdl" ["Դ"])
+("nkdu" ["Ӷ"])
+("nke'" "")
+("nker" ["Զ"])
+("nkfj" ["ַ"])
+("nkgv" ["ֹ"])
+("nkhl" ["Ժ"])
+("nkho" ["ջ"])
+("nkjn" ["Խ"])
+("nkke" ["Կ"])
+("nkli" [""])
+("nklu" ["­"])
+("nkmo" ["Ĥ"])
+("nknu" ["ŭ"])
+("nkq'" "ث")
+("nkqu" [""])
+("nkr'" "")
+("nks'" [""])
+("nksv" [""])
+("nkui" ["" "" ""])
+("nkvi" ["֭"])
+("nkvs" [""])
+("nkw'" "Ŭ")
+("nkwy" ["ŤΪӯ"])
+("nkyh" [""])
+("nkyj" [""])
+("nkzi" [""])
+("nkzy" ["Ťӯ"])
+("nl'" [""])
+("nlb'" ["ޱ"])
+("nldg" ["ʵ"])
+("nldy" ["޵"])
+("nle'" "ܵ")
+("nlff" ["̷"])
+("nlfj" ["ͷ"])
+("nlh'" ["޺"])
+("nlhe" ["κ"])
+("nlhj" ["ͺ"])
+("nlho" ["ͻ"])
+("nlir" ["ʹ"])
+("nljm" ["ͼ"])
+("nljq" [";"])
+("nll'" [""])
+("nlld" ["Ͷ" "ūͶ"])
+("nlli" [""])
+("nllk" ["" ""])
+("nlma" [""])
+("nlmo" ["ĥ"])
+("nlmy" ["ũ"])
+("nlnl" [""])
+("nlnq" ["ţ"])
+("nlpy" ["ƿ"])
+("nlqi" [""])
+("nlqy" ["ū"])
+("nlr'" "ؾ٦")
+("nlre" [""])
+("nlsr" [""])
+("nltb" ["ͷ"])
+("nlth" [""])
+("nltr" [""])
+("nltv" [""])
+("nluh" ["ū"])
+("nlui" [""])
+("nlv'" ["ū" "ū"])
+("nlvd" ["ūƶ"])
+("nlvi" [""])
+("nlxn" [""])
+("nlxy" [""])
+("nlyb" [""])
+("nlys" [""])
+("nlzv" [""])
+("nm'" [""])
+("nmb'" ["Ǳ" "Ů"])
+("nmbc" [""])
+("nmby" ["ױ"])
+("nmc'" ["Ħ"])
+("nmdi" [""])
+("nmdl" [""])
+("nmdo" ["" ""])
+("nmdu" ["" "" ""])
+("nme'" "")
+("nmff" [""])
+("nmfu" ["𤸽"])
+("nmg'" ["ɹ"])
+("nmgd" [""])
+("nmgf" [""])
+("nmgm" ["ũ"])
+("nmgo" [""])
+("nmgr" [""])
+("nmhk" [""])
+("nmhv" [""])
+("nmhw" ["껪" "껭"])
+("nmig" [""])
+("nmij" [""])
+("nmiu" [""])
+("nmji" ["꼶" ""])
+("nmjj" ["ũ׼"])
+("nmjm" ["" ""])
+("nmjn" [""])
+("nmjp" [""])
+("nmjx" [""])
+("nmjy" ["꾰" ""])
+("nmkj" ["꿯"])
+("nmli" ["" ""])
+("nmlk" [""])
+("nmll" [""])
+("nmlp" [""])
+("nmly" [""])
+("nmmi" [""])
+("nmml" [""])
+("nmmo" ["Ĥ"])
+("nmnm" ["" ""])
+("nmpu" [""])
+("nmq'" "")
+("nmqm" ["ǰ"])
+("nmqy" ["" "" "ũ"])
+("nmr'" "إ")
+("nmso" [""])
+("nmsv" [""])
+("nmtb" ["ͷ"])
+("nmtu" [""])
+("nmui" ["ʱ" "" "ʫ" "ũóг"])
+("nmuk" [""])
+("nmuu" [""])
+("nmv'" [""])
+("nmvh" ["곤"])
+("nmvo" [""])
+("nmvs" [""])
+("nmvv" ["ũս"])
+("nmw'" "ճ")
+("nmx'" ["ôЩ"])
+("nmxh" ["ũЭ"])
+("nmxm" [""])
+("nmxn" ["ĥ"])
+("nmxw" [""])
+("nmxy" [""])
+("nmy'" ["ô"])
+("nmye" ["Һ"])
+("nmyt" [""])
+("nmyu" [""])
+("nmzb" [""])
+("nnbu" [""])
+("nnbw" [""])
+("nnde" [""])
+("nne'" "")
+("nnhk" [""])
+("nnjd" [""])
+("nnke" [""])
+("nnkg" ["ܿɹ"])
+("nnmf" [""])
+("nnng" [""])
+("nnnn" ["ŮŮ"])
+("nnpd" ["Ůƽ"])
+("nnqc" [""])
+("nnr'" "")
+("nnrh" [""])
+("nnu'" [""])
+("nnui" [""])
+("nnuo" ["˵"])
+("nnv'" ["ũū" "ũū"])
+("nnw'" "")
+("nnxd" [""])
+("nods" ["Ų"])
+("nofu" ["ų"])
+("nola" [""])
+("nomi" ["Ŵ"])
+("nor'" "ųŴŵ")
+("noro" ["ų"])
+("nosi" ["ŵ˼"])
+("now'" "Ų")
+("nowz" ["Ų"])
+("noyj" ["ŵ"])
+("noys" ["Ų"])
+("nozb" ["Ų"])
+("npc'" ["ţƤ"])
+("npj'" [""])
+("npy'" ["" "Ů"])
+("nqda" ["Ť"])
+("nqdb" ["ţ"])
+("nqdl" ["Ŧ"])
+("nqdp" ["ţ"])
+("nqds" ["Ť"])
+("nqdu" ["ţ"])
+("nqe'" "ŤťŦ")
+("nqff" ["ţ"])
+("nqh'" ["ữ"])
+("nqie" ["ţ"])
+("nqjc" ["ţ"])
+("nqju" ["Ť" "Ť"])
+("nqjx" ["Ť"])
+("nqkb" ["ť" "Ŧ"])
+("nqli" ["Ť"])
+("nqma" ["ţ"])
+("nqmk" ["ţë"])
+("nqnl" ["ţ"])
+("nqpg" ["ţ"])
+("nqpi" ["ţƤ"])
+("nqq'" ["" ""])
+("nqqu" ["Ť"])
+("nqr'" ["" ""])
+("nqrb" ["ţ"])
+("nqru" ["ţ"])
+("nqu'" [""])
+("nque" ["ţ"])
+("nquh" ["Ť"])
+("nqvr" ["Ťת"])
+("nqw'" "ţ")
+("nqy'" ["Բ"])
+("nqyb" ["ţ"])
+("nqyt" ["ŦԼ"])
+("nr'" [""])
+("nre'" ["ů" "ն"])
+("nrfh" ["ů"])
+("nrg'" ["ȸ"])
+("nrhe" ["ů"])
+("nrhj" ["ȺϽ"])
+("nrhu" ["ݺʽ"])
+("nrj'" ["ȼ" "Ů˼"])
+("nrji" ["ȼ"])
+("nrlq" ["ů"])
+("nrly" [""])
+("nrqi" ["ů"])
+("nrvs" ["ů"])
+("nrxw" ["Ѱζ"])
+("nsby" ["ŧ"])
+("nsco" ["Ū"])
+("nscp" ["ũ"])
+("nsdj" ["Ũ"])
+("nsdu" ["Ũ"])
+("nse'" [""])
+("nsfu" ["ũ" "ũ"])
+("nshb" ["Ũ"])
+("nsho" ["ũ"])
+("nshu" ["ũ"])
+("nshv" ["ũ"])
+("nshy" ["Ū"])
+("nsi'" ["ó"])
+("nsia" ["Ũ"])
+("nsid" ["ŧ"])
+("nsih" ["ũ"])
+("nsij" ["ũ"])
+("nsiu" ["ũ"])
+("nsji" ["ũ"])
+("nsju" ["ũ"])
+("nsjw" ["ũ"])
+("nslf" ["˹"])
+("nsli" ["ũ"])
+("nsln" ["ũ"])
+("nslv" ["Ũ"])
+("nslx" ["Ũ"])
+("nsmh" ["ũæ"])
+("nsmi" ["Ũ"])
+("nsmk" ["ũó"])
+("nsmn" ["ũ"])
+("nsmz" ["Ũü"])
+("nsns" ["ŨŨ"])
+("nsnu" ["ũū"])
+("nsqu" ["ũ" "ũ"])
+("nsqy" ["Ū"])
+("nsr'" "Ū")
+("nsso" ["Ũ"])
+("nstm" ["ũ"])
+("nsts" ["Ūͨ"])
+("nsui" ["ũʱ" "ũ"])
+("nsvs" ["ŧ" "Ũ" "ũ"])
+("nsw'" "ŧŨũٯ")
+("nswh" ["һ"])
+("nswu" ["Ũ"])
+("nsxm" ["ũ"])
+("nsxt" ["ũѧ"])
+("nsye" ["ũҵ"])
+("nsyi" ["ũ"])
+("nsyj" ["Ũ" "Ũ" "ũ"])
+("nsyk" ["ũҩ"])
+("nsyu" ["Ũ"])
+("ntdl" ["Ű"])
+("nte'" ["ͷ"])
+("ntji" ["ű"])
+("ntju" ["ũ"])
+("ntr'" "Űű")
+("ntul" ["ũˮ"])
+("ntv'" ["Ůͬ־"])
+("nu'" ["ʱ"])
+("nubi" ["ū"])
+("nucl" ["ū"])
+("nue'" "Ŭ")
+("nufh" ["ŭ"])
+("nuh'" ["ʱ"])
+("nuhb" ["ŭ"])
+("nuhd" ["˵"])
+("nuho" ["ŭ"])
+("nuii" ["ŭ"])
+("nuik" ["ŭ"])
+("nuj'" [""])
+("nuli" ["ū" "Ŭ"])
+("numu" ["ŭĿ"])
+("nunx" [""])
+("nupu" ["ū"])
+("nuqi" ["ŭ"])
+("nur'" "ŭ")
+("nurs" ["ŭ"])
+("nutk" ["ŭ"])
+("nuw'" "ū")
+("nuyi" ["ū"])
+("nv'" [""])
+("nvbv" ["ս"])
+("nvdv" ["Ů"])
+("nve'" "Ů")
+("nver" ["Ů"])
+("nvfh" ["Ů"])
+("nvgs" ["Ů"])
+("nvhd" ["Ů"])
+("nvhl" ["Ů"])
+("nvlh" ["Ů"])
+("nvlj" ["Ů"])
+("nvpl" ["Ů"])
+("nvpu" ["Ů"])
+("nvr'" ["" "" "Ů"])
+("nvrf" ["Ů"])
+("nvuf" ["Ů"])
+("nvug" ["Ů"])
+("nvui" ["Ůʿ"])
+("nvvf" ["Ů" "Ů"])
+("nvwg" ["׷Ҹ"])
+("nvwh" ["Ů"])
+("nvxu" ["Ů"])
+("nvxy" ["Ů"])
+("nvys" ["ŮӶ"])
+("nvzi" ["Ů"])
+("nwb'" [""])
+("nwf'" [""])
+("nwjk" ["⽻" ""])
+("nwkt" ["Ŭ߿Ф"])
+("nwnw" [""])
+("nwq'" ["Ϊ"])
+("nx'" ["Щ"])
+("nxa'" [""])
+("nxge" [""])
+("nxhe" [""])
+("nxn'" ["ū"])
+("nxq'" "")
+("nxqi" [""])
+("nxr'" "ؿ")
+("nxuj" [""])
+("nxvh" [""])
+("nxvu" ["ס"])
+("nxzi" [""])
+("nxzj" ["Ū"])
+("nxzk" [""])
+("ny'" [""])
+("nybm" ["ũҵ"])
+("nybo" [""])
+("nydk" ["ũҵ"])
+("nydx" ["ũҵѧ"])
+("nye'" "š")
+("nyg'" ["Ť" "ũҵ"])
+("nygh" [""])
+("nygr" ["ũҵ"])
+("nygu" [""])
+("nyjh" ["ũҵе"])
+("nyji" [""])
+("nyjn" ["š"])
+("nyjq" ["ũҵ"])
+("nyju" ["" "ũҵ"])
+("nyjx" ["" "ũҵе"])
+("nyjy" [""])
+("nyke" [""])
+("nykf" [""])
+("nykl" ["š"])
+("nyl'" ["Ӧ"])
+("nymg" [""])
+("nyny" [""])
+("nyqt" ["ȱ"])
+("nyr'" "šŢ")
+("nys'" [""])
+("nysi" ["˼"])
+("nyu'" ["ũҵ" "ũҵ˰" "ũʦ"])
+("nyuf" [""])
+("nyui" [""])
+("nyuu" ["ũҵ"])
+("nyvi" [""])
+("nyvx" ["ũҵѧ"])
+("nyw'" "š")
+("nywh" [""])
+("nyxc" ["Ц"])
+("nyxw" [""])
+("nyy'" ["ů"])
+("nyyr" ["Ը"])
+("nzbk" ["ڰ"])
+("nzbu" ["ڲ"])
+("nzcp" ["ڴ"])
+("nzdi" ["ڵ"])
+("nze'" "")
+("nzfu" ["ڷ"])
+("nzge" ["Ǹ" "ڸ"])
+("nzh'" ["Ӻ"])
+("nzhe" ["ں"])
+("nzhh" [""])
+("nzhj" ["ں" "ں"])
+("nzhk" ["ں"])
+("nzhl" ["ں"])
+("nzhv" ["ǻ"])
+("nzih" ["ڳ"])
+("nzj'" ["Ӿ"])
+("nzjc" ["ڽ"])
+("nzjm" ["ڼ"])
+("nzjx" ["ڽ"])
+("nzjy" ["ھ" "ھ"])
+("nzke" ["ڿ"])
+("nzli" [""])
+("nzlk" [""])
+("nzlr" [""])
+("nzlu" ["¾"])
+("nzma" [""])
+("nzmg" [""])
+("nzmu" ["Ļ"])
+("nzng" [""])
+("nzpi" ["Ƥ"])
+("nzpy" ["ƽ"])
+("nzqy" [""])
+("nzr'" "")
+("nzre" [""])
+("nzrf" [""])
+("nzrj" ["ȼ"])
+("nzrs" [""])
+("nztl" ["̥"])
+("nzuh" [""])
+("nzui" ["ʷ" ""])
+("nzvg" [""])
+("nzvi" ["" ""])
+("nzvj" ["ս"])
+("nzvr" ["ת"])
+("nzvs" [""])
+("nzvu" [""])
+("nzw'" ["ũ"])
+("nzwl" [""])
+("nzwu" [""])
+("nzxc" [""])
+("nzxd" [""])
+("nzxm" [""])
+("nzxn" [""])
+("nzxt" ["ѧ"])
+("nzyi" [""])
+("nzyj" [""])
+("nzyn" [""])
+("nzyy" ["Ӧ"])
+("nzzh" [""])
+("nzzi" [""])
+("nzzl" [""])
+("nzzu" [""])
+("o" "ŷ")
+("ojld" ["ŷ"])
+("omdl" ["ŷķ"])
+("ooq'" "")
+("oor'" "Ŷ")
+("oow'" "Ŷ")
+("orx'" ["żȻ"])
+("ouda" ["Ź"])
+("oue'" "źŻż")
+("ouer" ["ż"])
+("ouff" ["ź"])
+("oufz" ["Ž"])
+("ouge" ["ک"])
+("ouhe" ["ź" "ż" ""])
+("ouhw" ["ŷ"])
+("oumu" ["ŷķ"])
+("oumz" ["ŷ"])
+("ouq'" "ŷŸŹŽک")
+("our'" "ŻŽ")
+("ourj" ["żȻ"])
+("outu" ["Ż"])
+("ouui" ["ŷʽ"])
+("ouuu" ["ż"])
+("ouvb" ["ŷ"])
+("ouwf" ["ŷ"])
+("ouxd" ["ż"])
+("ouya" ["ŷ"])
+("ouyh" ["ŷ"])
+("ovgt" ["ŷ޹ͬ"])
+("p" "Ƭ")
+("paer" [""])
+("pais" [""])
+("paku" ["¿"])
+("pali" [""])
+("palz" [""])
+("paq'" "žſ")
+("par'" "")
+("parf" [""])
+("pasi" [""])
+("pat'" "")
+("patg" [""])
+("paug" [""])
+("pauh" [""])
+("pauj" ["ɽ"])
+("paw'" "ǰ")
+("paxy" [""])
+("pb'" ["ձ"])
+("pbbk" ["ƣ"])
+("pbcj" ["ձþ"])
+("pbdu" ["ʶ"])
+("pbe'" "")
+("pbf'" ["Ư׷"])
+("pbfu" ["ʸ"])
+("pbgl" ["ձ"])
+("pbi'" ["ƽ峵"])
+("pbjd" ["Ȳ"])
+("pbmm" [""])
+("pbmy" [""])
+("pbq'" "")
+("pbu'" ["бʽ"])
+("pbui" [""])
+("pbvl" ["ձ"])
+("pbw'" "")
+("pbx'" ["ձ"])
+("pbxi" [""])
+("pby'" ["ƽ"])
+("pcbl" ["Ư"])
+("pcbo" ["Ư"])
+("pcdh" ["Ʈ"])
+("pcdl" ["Ʈ"])
+("pce'" "Ưݳ")
+("pcfu" ["Ʈ" "Ư"])
+("pcis" ["ư"])
+("pcju" ["Ʊ"])
+("pcjw" ["Ʊ"])
+("pcld" ["Ư"])
+("pclo" ["Ʈ"])
+("pclq" ["Ʈ" "Ư"])
+("pcly" ["Ʈ"])
+("pcmc" ["Ʈ"])
+("pcq'" "ƮƯ")
+("pcqi" ["Ʈ"])
+("pcqx" [""])
+("pcr'" "ƯƱ")
+("pcrj" ["ƮȻ"])
+("pcsa" ["Ʈ"])
+("pcsj" ["Ʈɢ"])
+("pcw'" "ư")
+("pcyh" ["Ʈ"])
+("pcyi" ["Ư"])
+("pczi" ["Ʊ"])
+("pdh'" ["»"])
+("pdhl" ["ƽȻ"])
+("pdi'" ["豶"])
+("pdid" ["Ƥ"])
+("pdj'" ["ѵ"])
+("pdl'" ["Ƥ"])
+("pdp'" [""])
+("pdu'" ["ƽɽ"])
+("pei'" ["ն"])
+("pf'" [""])
+("pfdi" [""])
+("pfdu" [""])
+("pfg'" ["ƽ"])
+("pfgl" ["ƽ"])
+("pfgr" [""])
+("pfhw" ["绨"])
+("pfjm" ["罦"])
+("pfjy" ["辰"])
+("pfm'" ["ƽ"])
+("pfq'" ["" ""])
+("pfqd" ["ǹ" "ǻ"])
+("pfqi" ["" ""])
+("pfqr" ["Ȫ"])
+("pfqs" ["ƽɫ"])
+("pfr'" "")
+("pfsa" [""])
+("pftb" ["ͷ"])
+("pfti" [""])
+("pfue" [""])
+("pfw'" "")
+("pfwu" [""])
+("pfxd" [""])
+("pfzi" [""])
+("pfzv" [""])
+("pgbi" [""])
+("pgbo" [""])
+("pgda" [""])
+("pgdk" [""])
+("pge'" "")
+("pgig" [""])
+("pgih" [""])
+("pgji" [""])
+("pgjm" [""])
+("pglr" [""])
+("pgpg" [""])
+("pgpl" [""])
+("pgq'" "")
+("pgqc" [""])
+("pgr'" "")
+("pgrf" [""])
+("pgsr" [""])
+("pgss" [""])
+("pgtb" ["ͷ"])
+("pgtc" [""])
+("pgua" ["ɰ"])
+("pgvd" ["ײ"])
+("pgvf" [""])
+("pgvh" [""])
+("pgw'" "ܡ")
+("pgyb" [""])
+("pgzi" ["" ""])
+("phbj" ["Ʒ"])
+("phbl" ["԰"])
+("phbm" ["Ա"])
+("phbo" [""])
+("phda" ["Ӵ"])
+("phe'" "")
+("phgr" ["Թ"])
+("phiu" ["ƽⳣ"])
+("phld" ["е"])
+("phlu" ["·"])
+("phm'" ["ƽľ"])
+("phq'" "")
+("phr'" "")
+("phrf" [""])
+("phts" ["ͨ"])
+("phty" [""])
+("phub" [""])
+("phvg" ["֤" "֢"])
+("phw'" "")
+("phxn" [""])
+("phxx" ["з"])
+("phza" [""])
+("phzi" [""])
+("piao" ["Ƥ"])
+("pibk" ["Ƥ"])
+("pibm" ["Ƥ"])
+("pibo" [""])
+("pibu" [""])
+("pibz" ["ƣ"])
+("picg" ["Ƥ"])
+("pidb" [""])
+("pidl" ["Ƥ"])
+("pie'" "ƥƦߨ")
+("pifa" ["" "ƣ"])
+("pifg" [""])
+("pifu" ["" "Ƥ" "ƥ"])
+("pige" ["Ƥ"])
+("pigl" [""])
+("pigp" ["Ƥ"])
+("pigu" ["ƨ"])
+("pigw" [""])
+("piho" [""])
+("piil" [""])
+("pijm" [""])
+("pijq" ["ơ"])
+("pijr" ["ƣ"])
+("pijy" ["Ƨ"])
+("pikl" [""])
+("pilc" [""])
+("pild" [""])
+("pili" [""])
+("pilk" ["ƣ"])
+("pilm" [""])
+("piln" [""])
+("pilu" ["¶"])
+("pimk" ["Ƥë"])
+("pimm" ["Ƥ" "Ƥ"])
+("pimx" ["Ƴ"])
+("pimz" [""])
+("pipa" [""])
+("pipi" ["ƤƤ" ""])
+("pipj" [""])
+("pipy" [""])
+("pipz" ["ƥ"])
+("piq'" "ٻا")
+("piqi" ["Ƣ"])
+("piqq" ["Ƥ"])
+("pir'" "ƧƨƩ")
+("pirb" ["Ƥ"])
+("piru" ["Ʃ"])
+("pis'" ["ɳ"])
+("piud" ["˪"])
+("piui" ["ʾ"])
+("pive" [""])
+("pivi" ["Ƥ"])
+("pivp" ["׼"])
+("pivr" ["ת"])
+("piw'" "ơƢƣƤۯܱ")
+("piwn" ["ų"])
+("piwz" ["Ƣθ"])
+("pixd" ["Ƥ"])
+("pixm" ["ۯ"])
+("pixw" ["Ƥ"])
+("pixx" ["ƤЬ"])
+("piyj" ["Ƥ"])
+("piys" ["ƨ"])
+("piyt" [""])
+("piyu" ["Ʃ"])
+("pizh" ["Ƣ"])
+("pizi" ["Ƥ"])
+("pj'" ["ƽ"])
+("pjan" ["а"])
+("pjbm" ["ѱ"])
+("pjbo" ["̰"])
+("pjbx" ["б"])
+("pjcp" ["̴"])
+("pjdg" ["ʵ"])
+("pjdh" ["ѵ"])
+("pjdm" ["̵"])
+("pjdq" ["ƽȨ"])
+("pjdr" ["ж"])
+("pjdy" ["ж"])
+("pjfh" ["˷"])
+("pjfz" ["ѷ"])
+("pjgg" ["̸"])
+("pjgo" ["ѹ"])
+("pjgr" ["й"])
+("pjgz" ["ƽ"])
+("pjho" ["̻"])
+("pjiu" ["д"])
+("pjjp" ["Ѿ"])
+("pjjt" ["о"])
+("pjju" ["̾"])
+("pjli" [""])
+("pjlr" ["" "ƽ"])
+("pjml" [""])
+("pjmy" [""])
+("pjni" [""])
+("pjq'" "ⷬ")
+("pjqn" [""])
+("pjqw" ["ƽ"])
+("pjr'" "")
+("pjrk" [""])
+("pjro" [""])
+("pjsd" ["ƽٶ"])
+("pjsr" [""])
+("pjtj" ["̸"])
+("pjtu" ["ͽ"])
+("pju'" ["о" "ƽ"])
+("pjuj" ["ɽ"])
+("pjv'" ["ƽֵ"])
+("pjvj" ["ն"])
+("pjvy" ["ƽ"])
+("pjw'" "")
+("pjwf" [""])
+("pjwh" [""])
+("pjxr" [""])
+("pjyr" ["Ԯ" "Ե"])
+("pjzi" [""])
+("pjzv" [""])
+("pkbm" ["ܱ"])
+("pkbu" ["ܲ"])
+("pkby" ["ڱ"])
+("pkcl" ["ݲ"])
+("pkdj" ["ڵ"])
+("pkdk" ["ܵ"])
+("pkdm" ["ƿڴ"])
+("pke'" "")
+("pkgd" ["׹"])
+("pkh'" ["ƶ"])
+("pkho" ["ڻ"])
+("pkhs" ["ں"])
+("pkhv" ["ڻ"])
+("pkie" ["ܳ"])
+("pkji" ["ڻ"])
+("pkjm" ["ڽ"])
+("pkkb" ["ڿ"])
+("pkkl" ["ܿ"])
+("pklc" [""])
+("pklz" [""])
+("pkma" [""])
+("pkmk" ["ê"])
+("pkmo" ["ĭ"])
+("pkq'" "")
+("pkqi" [""])
+("pkqq" [""])
+("pkr'" "")
+("pkta" [""])
+("pktl" ["̨"])
+("pkts" ["ͩ"])
+("pktv" [""])
+("pkub" ["" ""])
+("pkug" [""])
+("pkvi" ["" ""])
+("pkvr" ["ש"])
+("pkw'" "")
+("pkwu" [""])
+("pkwz" ["λ"])
+("pkxc" [""])
+("pkyj" [""])
+("pkzi" ["" ""])
+("pl'" [""])
+("plbj" ["Ű"])
+("plbx" ["ɱ"])
+("pld'" ["³"])
+("plda" ["Ĵ"])
+("pldv" ["Ŷ"])
+("ple'" "")
+("plfh" ["Ʒ"])
+("plgr" ["Ź"])
+("plgu" ["Ź"])
+("plhf" ["кŵ"])
+("plhk" ["ĺ" "ƺ"])
+("plhy" ["ǻ"])
+("plih" ["ų"])
+("plii" ["ų"])
+("pliu" ["ų" "ɳ"])
+("plj'" ["ۼ"])
+("plji" ["ż"])
+("pljw" ["ż" "Ƽ"])
+("pljx" ["Ž" "ƣͼ"])
+("plk'" ["ʿ"])
+("pllb" ["¥" "§"])
+("pllk" [""])
+("pllm" [""])
+("pllr" [""])
+("pllx" [""])
+("plly" [""])
+("plm'" [""])
+("plml" [""])
+("plpn" ["Ƶ"])
+("plq'" "")
+("plqd" ["ƣǿ"])
+("plqi" ["" ""])
+("plqm" ["ǲ"])
+("plqq" [""])
+("plr'" "")
+("pltb" ["ͷ"])
+("pltn" ["ŵ"])
+("plu'" ["ˮ"])
+("plub" [""])
+("plue" [""])
+("plug" [""])
+("plui" [""])
+("pluv" ["ˮ"])
+("plvh" ["ų"])
+("plvk" [""])
+("plw'" "ٽ")
+("plwh" [""])
+("plwl" [""])
+("plwz" ["λ"])
+("plxi" ["Ϸ" "ϵ"])
+("plxu" [""])
+("plxx" ["й"])
+("plxy" ["" "ƵӦ"])
+("ply'" ["Ա"])
+("plyj" [""])
+("plyn" ["ӡ"])
+("plzi" ["" ""])
+("plzl" [""])
+("pm'" ["Ʒ"])
+("pmai" ["ƫ"])
+("pmdi" ["Ƭ"])
+("pmdr" ["Ƭ" "Ƭ"])
+("pme'" "")
+("pmfu" ["ƪ"])
+("pmgh" ["ۻ"])
+("pmia" ["ƫ"])
+("pmj'" ["ƽ" "ƽ澵"])
+("pmjc" ["ƫ"])
+("pmjh" ["ƽ漸"])
+("pmjm" ["ƫ"])
+("pmju" ["ƭ"])
+("pmk'" ["ƶ"])
+("pmke" ["Ƭ"])
+("pmli" ["ƫ"])
+("pmlq" ["ƫ"])
+("pmmm" ["Ƭ"])
+("pmph" ["ƫ"])
+("pmpi" ["ƫƧ"])
+("pmpm" ["ƫƫ" ""])
+("pmpo" ["ƫ"])
+("pmq'" "ƪƫƬ")
+("pmqu" ["ƭȡ"])
+("pmr'" "Ƭƭ")
+("pmrf" ["ƭ"])
+("pmsl" ["ĭ"])
+("pmt'" ["ƽͼ" "ͼ"])
+("pmtj" ["ƫ̻"])
+("pmui" ["Ƭʱ"])
+("pmuu" ["ƭ"])
+("pmvf" ["ƫ"])
+("pmvh" ["ƪ"])
+("pmvr" ["ƫת"])
+("pmvs" ["ƫ"])
+("pmw'" "")
+("pmx'" ["Ƭ"])
+("pmxd" ["ƫ"])
+("pmxi" ["ƫ" "ƫ"])
+("pmxn" ["ƫ"])
+("pmya" ["ƫѹ"])
+("pmyi" [""])
+("pmyr" ["ƫԶ"])
+("pmyu" ["ƫ"])
+("pmzi" ["Ƭ" "ƭ"])
+("pnbo" ["ƴ"])
+("pncb" ["ƴ"])
+("pnde" ["Ʒ"])
+("pndk" ["Ƶ"])
+("pndl" ["Ƶ"])
+("pndr" ["Ƶ"])
+("pndu" ["Ƶ"])
+("pne'" "Ʒ")
+("pnfa" ["ƶ"])
+("pnfj" ["Ƶ"])
+("pnfu" ["ƶ"])
+("pnge" ["Ʒ"])
+("pnhj" ["ƶ"])
+("pnhw" ["ƶ"])
+("pnih" ["Ʒ"])
+("pnir" ["Ƶ"])
+("pnji" ["ƶ" "Ʒ"])
+("pnjm" ["ƶ"])
+("pnkd" ["ƶ"])
+("pnkp" ["ƶ"])
+("pnku" ["ƶ"])
+("pnlv" ["Ƶ"])
+("pnlz" ["Ʒ"])
+("pnmn" ["ƶ"])
+("pnmy" ["ƴ" "Ʒ"])
+("pnns" ["ƶũ"])
+("pnpn" ["ƵƵ"])
+("pnpu" ["Ƶ"])
+("pnpy" ["Ʒ"])
+("pnq'" "ƴ")
+("pnqs" ["ƶ"])
+("pnqy" ["Ƹ"])
+("pnr'" "Ƹ")
+("pnrf" ["Ƹ"])
+("pnro" ["ƶ"])
+("pnuu" ["Ƹ"])
+("pnvi" ["Ʒ"])
+("pnvs" ["Ʒ"])
+("pnw'" "Ƶƶƻ")
+("pnwz" ["Ʒλ"])
+("pnxi" ["Ʒϵ"])
+("pnxr" ["Ƹѡ"])
+("pnxx" ["ƴд"])
+("pnxy" ["ƴ" "Ʒ" "Ʒ"])
+("pnyb" ["ƶ"])
+("pnyn" ["ƴ"])
+("pnys" ["Ƹ"])
+("poan" ["ư"])
+("podi" ["µ"])
+("podk" ["µ"])
+("podu" ["¶"])
+("poe'" "")
+("pofz" ["Ʒ"])
+("poge" ["Ƹ"])
+("pohl" ["Ⱥ"])
+("poho" ["ƻ"])
+("pohy" ["ƻ"])
+("poij" ["Ʋ"])
+("poiu" ["Ƴ"])
+("pojn" ["Ƚ"])
+("pojq" ["ƾ"])
+("pojw" ["ż"])
+("pokb" ["ƿ"])
+("pola" [""])
+("poli" ["" ""])
+("polj" [""])
+("polo" [""])
+("polx" [""])
+("pomx" [""])
+("pond" [""])
+("popo" [""])
+("poq'" "")
+("poqx" [""])
+("por'" "")
+("posp" [""])
+("posv" [""])
+("potu" [""])
+("poui" ["ʹ"])
+("pouv" ["ˮ"])
+("povj" [""])
+("pow'" "۶")
+("poxc" [""])
+("poxi" ["ϱ"])
+("poyh" ["۶"])
+("poyi" ["" ""])
+("poyu" [""])
+("pozl" [""])
+("ppbb" [""])
+("ppd'" ["ֵ" "Ƥ" "е"])
+("ppj'" ["" "ƽƽ"])
+("ppq'" ["ƹ"])
+("ppr'" ["ƮƮȻ"])
+("pptt" ["ͨͨ"])
+("pqfj" [""])
+("pqt'" ["ͭ"])
+("pqu'" ["ʽ"])
+("prwr" [""])
+("pst'" ["˿ͷ"])
+("pt'" ["ͨ"])
+("ptf'" ["ͨ"])
+("pth'" ["" "ͨ"])
+("ptj'" ["Ѿ"])
+("ptlm" ["ͷ¶"])
+("ptqj" [""])
+("ptt'" [""])
+("ptxm" ["ͨС"])
+("pty'" ["" "԰"])
+("pub'" [""])
+("pubc" ["ױ"])
+("pubi" ["˱"])
+("pubm" ["ձ"])
+("pubu" ["ٲ"])
+("pucs" ["ʹ"])
+("puda" ["˴"])
+("pudh" ["ɽ"])
+("pudm" ["̵"])
+("pue'" "")
+("puer" ["ն"])
+("pufu" [""])
+("pug'" ["ˮ" "ˮ"])
+("pugl" ["̸"])
+("pugv" ["̹"])
+("puhk" ["׺"])
+("puia" ["ղ"])
+("puik" ["ֳƿ"])
+("pujd" ["ֽ"])
+("puji" ["ռ"])
+("pujq" ["˾"])
+("pukb" ["ֿ"])
+("puke" ["˿"])
+("pul'" ["ˮ"])
+("puli" [""])
+("pulu" ["·"])
+("pumx" [""])
+("pupy" ["ƽ"])
+("puq'" "")
+("pur'" "")
+("purf" [""])
+("pusa" [""])
+("pusu" [""])
+("put'" ["ͼ"])
+("pute" [""])
+("puth" [""])
+("putk" [""])
+("puts" ["ͨ" "ͨ"])
+("puui" ["ʵ"])
+("puul" ["ɹ"])
+("puvk" [""])
+("puw'" "")
+("puxr" ["ѡ"])
+("puxt" ["ˮϵͳ"])
+("puxx" ["д"])
+("puy'" ["Ա"])
+("puyi" [""])
+("puzi" ["" ""])
+("pvg'" ["ƫ"])
+("pvlf" ["˷"])
+("pvp'" ["ƫƬ"])
+("pvsl" [""])
+("pvtd" ["ƽ"])
+("pvxq" ["ƫתȦ"])
+("pvxu" ["ϵ"])
+("pvyu" ["Ʒ"])
+("pwq'" [""])
+("pwx'" [""])
+("pxbd" ["Ʒв"])
+("pxdw" ["ж"])
+("pxdy" ["Ǵ"])
+("pxe'" "Ʋد")
+("pxj'" ["ϣ"])
+("pxjm" ["Ƴ"])
+("pxkl" ["Ʋ"])
+("pxl'" ["ƫ"])
+("pxlt" ["ƽ"])
+("pxq'" "ƲƳ")
+("pxsx" ["ƽı"])
+("pxvn" ["ƶũ"])
+("pxw'" ["й"])
+("pxx'" ["ƽ"])
+("pxzv" ["Ʋ"])
+("pxzy" ["ƽҵ"])
+("py'" ["ƴ"])
+("pyan" ["ƽ"])
+("pyba" ["ƺ"])
+("pybi" ["" ""])
+("pybj" ["ƽ"])
+("pyce" [""])
+("pydc" ["ƽ"])
+("pydg" ["ƽ"])
+("pydi" ["ƽ"])
+("pydj" ["ƽ" "ƾ"])
+("pyds" ["ƽ" "ƽ"])
+("pydu" ["ƽ"])
+("pydy" ["ƽ" "ƽ" ""])
+("pyff" ["ƽ" ""])
+("pyfg" [""])
+("pyfh" ["ƽ" "ƽ"])
+("pyfj" ["ƽ" "ƽ"])
+("pygo" ["ƻ"])
+("pygs" [""])
+("pygu" ["ƽ"])
+("pyhe" ["ƽ"])
+("pyhg" ["ƽ"])
+("pyhh" ["ƽ"])
+("pyhr" ["ƽ"])
+("pyhw" ["ƽ" "ƽ" ""])
+("pyie" ["ƽ"])
+("pyih" ["ƽ"])
+("pyir" ["ƽ"])
+("pyj'" [""])
+("pyjc" ["ƽ"])
+("pyjd" [""])
+("pyji" [""])
+("pyjp" ["ƽ"])
+("pyjr" ["ƽ׽"])
+("pyju" ["ƾ" ""])
+("pyjw" ["ƽ" ""])
+("pyjx" ["ƾ" ""])
+("pyjy" ["ƽ"])
+("pyks" ["ƾ"])
+("pyld" ["ƽ"])
+("pyli" [""])
+("pylj" ["ƾ"])
+("pylp" [""])
+("pylu" ["ƽ¯"])
+("pymb" ["Ŀ"])
+("pymm" ["ƽ"])
+("pymn" ["ƽ"])
+("pymu" ["Ļ"])
+("pypc" ["ƾƱ"])
+("pyph" ["ƹ"])
+("pypj" [""])
+("pypy" ["ƽƽ"])
+("pyq'" ["ƹ" "ٷ" "" ""])
+("pyrh" ["ƽ"])
+("pyri" ["ƽ"])
+("pyrs" ["ƽ"])
+("pysu" ["ƽ"])
+("pytb" ["ƽͷ"])
+("pytc" ["ƽ"])
+("pytj" ["ƹ̳" "ƽ̹"])
+("pytl" ["ƽ̨"])
+("pyug" ["ƽ"])
+("pyui" ["ƽʱ" "ƽ"])
+("pyup" ["ƽ˳"])
+("pyvd" ["ƽװ" "ƿװ"])
+("pyvg" ["ƽ" "ƽ" "ƾ֤"])
+("pyvh" [""])
+("pyw'" "ƺƻƼƽƾƿ")
+("pywf" ["ƽ" "ƽ"])
+("pywz" ["ƴ" "Ϊ"])
+("pyxd" ["Ƽ"])
+("pyxi" ["ƽ" "ƽϢ"])
+("pyxr" ["ѡ"])
+("pyxy" ["ƽ"])
+("pyye" ["ƽҰ"])
+("pyyh" ["ƽ"])
+("pyyi" ["ƽһ" "ƽ" ""])
+("pyyr" ["ƽԭ"])
+("pyys" ["ƽӹ"])
+("pyyu" [""])
+("pyze" ["ƽ"])
+("pyzi" ["ƿ"])
+("pyzm" ["ƴĸ"])
+("pzbf" ["Ȿ"])
+("pzbh" [""])
+("pzbj" [""])
+("pzbz" ["䱸"])
+("pzcg" ["߲"])
+("pzdi" [""])
+("pzdl" [""])
+("pzdm" [""])
+("pzdv" [""])
+("pzfh" ["䷽"])
+("pzfu" [""])
+("pzgf" ["߸" ""])
+("pzhe" [""])
+("pzif" [""])
+("pzih" ["⳥"])
+("pzjc" [""])
+("pzjm" [""])
+("pzke" [""])
+("pzkr" [""])
+("pzlc" ["" ""])
+("pzli" [""])
+("pzmj" ["ü"])
+("pzou" ["ż"])
+("pzq'" "")
+("pzqi" [""])
+("pzqm" ["Ǯ"])
+("pzr'" "")
+("pzru" [""])
+("pzse" ["ɫ"])
+("pztk" [""])
+("pztl" ["̥"])
+("pzts" ["ͬ"])
+("pztu" [""])
+("pzuf" [""])
+("pzvb" [""])
+("pzve" [""])
+("pzvi" ["ֲ" "" ""])
+("pzvs" [""])
+("pzvu" [""])
+("pzw'" "")
+("pzxp" ["ѵ"])
+("pzya" ["ѿ"])
+("pzyb" [""])
+("pzyh" [""])
+("pzyk" ["ҩ"])
+("pzyu" [""])
+("pzzi" [""])
+("pzzv" [""])
+("q" "")
+("qb'" ["ȫ"])
+("qbj'" ["뾶"])
+("qbq'" ["Ʋ"])
+("qbs'" ["鱨"])
+("qbu'" ["Ʋ"])
+("qbw'" ["ǧ"])
+("qbwh" ["ǧ"])
+("qbx'" [""])
+("qbz'" [""])
+("qbzj" ["鲻Խ"])
+("qc'" [""])
+("qcbi" ["ͱ"])
+("qcbk" ["Ȱ"])
+("qcda" ["ô"])
+("qcdp" ["Ŷ"])
+("qce'" "ȸ")
+("qcgj" ["ɸ"])
+("qche" ["ɺ"])
+("qchv" ["Ȼ"])
+("qcii" ["ʳ"])
+("qcji" ["û"])
+("qcjm" ["Ƽ"])
+("qcjr" ["Ⱦ"])
+("qcju" ["Ⱦ"])
+("qckl" ["˿"])
+("qcld" [""])
+("qcmc" [""])
+("qcmf" [""])
+("qcml" [""])
+("qcmm" [""])
+("qcmn" [""])
+("qcmu" ["ľ"])
+("qcpi" ["Ƥ"])
+("qcq'" "ȸ")
+("qcqc" ["" ""])
+("qcqj" ["ȥȡ"])
+("qcql" ["ȺȺ"])
+("qcqm" ["Ǩ"])
+("qcr'" "ڽ")
+("qcrj" ["Ȼ"])
+("qcsl" [""])
+("qctb" ["ͷ"])
+("qctl" ["̨"])
+("qcva" ["թ"])
+("qcvi" [""])
+("qcw'" "")
+("qcwu" [""])
+("qcxy" [""])
+("qd'" ["嵥"])
+("qdb'" ["򵰰"])
+("qdbi" ["ǹ" "ǽ"])
+("qdbk" ["ǿ"])
+("qdcw" ["ȱ"])
+("qdda" ["ǿ"])
+("qddc" ["ǻ" "ǿ"])
+("qddj" ["ǹ"])
+("qddk" ["ǿ"])
+("qddm" ["ǿ"])
+("qddo" [""])
+("qddu" ["ǿ" "ǿ"])
+("qde'" "ǿ")
+("qdf'" [""])
+("qdfg" ["ǿ"])
+("qdgb" [""])
+("qdgf" ["ǽ"])
+("qdgj" ["ǹ"])
+("qdgo" ["ǿ"])
+("qdgu" ["ǿ"])
+("qdhi" ["ǡô"])
+("qdhj" ["ǿ"])
+("qdhw" ["ǿ"])
+("qdi'" ["洬"])
+("qdj'" ["𶯻"])
+("qdjc" ["ǽ" "ǽ"])
+("qdji" ["ǽ" "ǻ"])
+("qdjm" ["ǿ" "ǿ" "ǿ"])
+("qdjq" [""])
+("qdjt" ["ǹ"])
+("qdjw" ["ǿ"])
+("qdjx" ["ǿȼ" ""])
+("qdkb" ["ǹ"])
+("qdl'" [""])
+("qdli" ["ǿ"])
+("qdlt" [""])
+("qdlx" ["ǿ"])
+("qdpk" ["ǹ"])
+("qdpl" ["ǿ"])
+("qdpo" ["ǿ"])
+("qdq'" "ǹǺǻǼ")
+("qdqq" ["ǿ"])
+("qdqr" ["ǿȨ"])
+("qdr'" "Ǻ")
+("qdro" ["ǿ"])
+("qdsr" ["ǿ"])
+("qdtb" ["ǽͷ"])
+("qdto" ["ǹ"])
+("qdua" ["ǹɱ"])
+("qdub" [""])
+("qdug" ["ǹ" "ǿʢ"])
+("qduh" [""])
+("qdui" ["ǿʹ"])
+("qdvd" ["ǿ׳"])
+("qdve" ["ǿ"])
+("qdvi" ["ǹ֧" "ǿ"])
+("qdvj" ["ת" "ǿռ" "ռ"])
+("qdvs" [""])
+("qdw'" "ǽǾǿ")
+("qdwz" ["Ǿޱ"])
+("qdxm" ["" ""])
+("qdxq" [""])
+("qdxx" ["ǹе"])
+("qdxy" ["ǿ"])
+("qdyy" ["ǿӲ"])
+("qdzo" ["ǿ"])
+("qdzu" ["Ǽ"])
+("qedv" ["ȡ֮"])
+("qeu'" ["ȸɽ"])
+("qeyj" ["׾"])
+("qfb'" ["ǧֱ"])
+("qfbj" ["ǧټ"])
+("qfq'" ["Ǳ"])
+("qfs'" [""])
+("qfu'" ["ȫ"])
+("qfv'" ["ȱ֢"])
+("qfy'" ["з"])
+("qg'" ["ȫ"])
+("qgd'" ["⵰"])
+("qggd" ["ȫ"])
+("qgjl" ["ȫ¼" ""])
+("qgjx" ["ڹѧ"])
+("qgvx" ["ڹѧ"])
+("qgx'" ["ȫ"])
+("qgxd" ["൱"])
+("qgy'" ["Ṥҵ"])
+("qgyb" ["Ṥҵ"])
+("qgz'" ["ǹ"])
+("qhbj" ["Ʋ"])
+("qhd'" ["ػʵ"])
+("qhdx" ["廪ѧ"])
+("qhf'" ["軯"])
+("qhh'" [""])
+("qhj'" ["軯"])
+("qhl'" ["׺"])
+("qhlb" ["Ȩ"])
+("qhnx" ["ﻢ"])
+("qhq'" [""])
+("qhu'" ["ຣʡ"])
+("qhw'" ["⻯"])
+("qhzb" [""])
+("qi'" [""])
+("qibd" ["ȡ"])
+("qibi" ["" ""])
+("qibk" ["" ""])
+("qibl" ["ǧ"])
+("qibu" ["߲" ""])
+("qiby" ["" ""])
+("qibz" ["뱸"])
+("qici" [""])
+("qicj" [""])
+("qick" [""])
+("qicl" [""])
+("qidc" [""])
+("qidi" ["" "ղ"])
+("qidj" [""])
+("qidk" [""])
+("qidl" ["ڴ"])
+("qidm" ["" ""])
+("qids" ["" "" ""])
+("qie'" "ܻ")
+("qiee" [""])
+("qier" [""])
+("qifa" ["" ""])
+("qiff" ["" ""])
+("qifg" ["" ""])
+("qifu" ["۸" "" ""])
+("qifz" ["" ""])
+("qige" ["߸"])
+("qigh" ["" ""])
+("qigj" ["" ""])
+("qigk" [""])
+("qigl" ["ؤ" ""])
+("qigo" [""])
+("qigr" ["" "" ""])
+("qigs" ["߹" ""])
+("qigy" [""])
+("qihb" [""])
+("qihk" [""])
+("qiho" [""])
+("qihw" ["" ""])
+("qihz" [""])
+("qii'" [""])
+("qiia" [""])
+("qiid" [""])
+("qiie" ["ﳵ" ""])
+("qiig" ["" ""])
+("qiih" ["볪"])
+("qiii" ["߳"])
+("qiir" ["" ""])
+("qiiu" [""])
+("qiiv" [""])
+("qiji" ["漣" "" ""])
+("qijm" ["ڼ" "" "" ""])
+("qijn" ["" ""])
+("qijt" ["߾"])
+("qiju" ["" ""])
+("qijw" [""])
+("qijx" [""])
+("qijy" ["澰"])
+("qika" [""])
+("qikb" [""])
+("qikj" ["ڿ"])
+("qikl" [""])
+("qiks" [""])
+("qild" ["" "" ""])
+("qilg" [""])
+("qili" ["" ""])
+("qill" [""])
+("qilo" [""])
+("qilp" [""])
+("qilq" [""])
+("qilu" ["·"])
+("qilv" [""])
+("qily" [""])
+("qima" ["" ""])
+("qimc" [""])
+("qimf" ["" ""])
+("qimg" [""])
+("qimi" [""])
+("qimj" [""])
+("qimk" ["ë"])
+("qimn" [""])
+("qimy" ["" ""])
+("qing" [""])
+("qinh" [""])
+("qink" [""])
+("qinm" [""])
+("qinz" [""])
+("qiou" ["ż"])
+("qipc" ["Ʊ"])
+("qipj" [""])
+("qipk" ["" "" "" ""])
+("qipl" [""])
+("qipm" ["ƭ"])
+("qipo" [""])
+("qiq'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "ഺ"])
+("qiqd" ["ǽ"])
+("qiqi" ["" ""])
+("qiqq" ["" "" "" ""])
+("qiqr" ["ȫ" "Ȩ"])
+("qiqu" [""])
+("qir'" "ؽ")
+("qirf" [""])
+("qiri" [""])
+("qirj" ["Ȼ"])
+("qise" ["ɫ" "ɫ"])
+("qisu" [""])
+("qita" ["" ""])
+("qitb" ["ͷ"])
+("qitc" [""])
+("qite" [""])
+("qiti" [""])
+("qitj" ["̸"])
+("qitk" ["" ""])
+("qitl" ["̬"])
+("qitm" [""])
+("qits" ["Ͳ"])
+("qitu" [";" "ͼ"])
+("qity" ["ͧ"])
+("qiub" ["" ""])
+("qiuf" [""])
+("qiug" ["" ""])
+("qiui" ["ʮ" "ʵ" "" "" "" "ʿ" "ʼ" "" "" "ʾ" "ʹ" ""])
+("qiuj" [""])
+("qiuu" [""])
+("qiuv" ["ˮ"])
+("qiva" ["թ"])
+("qive" [""])
+("qivg" [""])
+("qivi" ["" "ֹ" "" ""])
+("qivs" ["" "" ""])
+("qiw'" "ٹݽޭ")
+("qiwb" ["ǧ"])
+("qiwf" ["" ""])
+("qiwh" ["" "" ""])
+("qiwu" ["" ""])
+("qiwz" ["ζ"])
+("qix'" ["Ǧ"])
+("qixd" [""])
+("qixi" ["Ϣ" "Ϣ"])
+("qixm" ["" ""])
+("qixn" [""])
+("qixu" [""])
+("qixx" ["е"])
+("qixy" ["" ""])
+("qiya" ["ѹ" "ѹ"])
+("qiyb" [""])
+("qiye" ["ҵ"])
+("qiyi" ["һ" "һ" "" ""])
+("qiyj" [""])
+("qiyn" ["" ""])
+("qiyp" [""])
+("qiyr" ["Դ"])
+("qiys" ["" "" ""])
+("qiyt" ["" "Լ" ""])
+("qiyu" ["" "" ""])
+("qizi" ["" "" "" ""])
+("qj'" ["ڼ"])
+("qjd'" ["ǧﶥ"])
+("qjg'" ["ݼ̹"])
+("qju'" [""])
+("qjwh" ["ǧ"])
+("qjwm" ["ǧ"])
+("qjwv" ["Ϊֹ"])
+("qjy'" ["ǿ" "ȡ"])
+("qjyf" ["ǧһ"])
+("qjyr" ["ǿ"])
+("qk'" [""])
+("qkdu" ["쿪ʤ"])
+("qkl'" ["" "ɿ"])
+("qkq'" ["ؿ"])
+("ql'" ["Ȩ"])
+("qlfj" ["ַ"])
+("qlj'" ["" "ֻ"])
+("qlm'" ["ǧ"])
+("qlmm" ["Ŀ"])
+("qlnl" ["Ȩ"])
+("qlu'" ["ɽ"])
+("qlus" [""])
+("qlv'" ["ǧ" ""])
+("qlvv" ["ս"])
+("qly'" ["ǧ"])
+("qlyd" ["˶"])
+("qlyf" ["ȫԸ"])
+("qm'" ["ȫ"])
+("qmbi" ["Ǧ" "Ǯ" "ǰ"])
+("qmbj" ["Ǧ"])
+("qmbk" ["Ǯ"])
+("qmbm" ["ǰ"])
+("qmbo" ["ǳ"])
+("qmbz" ["ǰ"])
+("qmci" ["ǰ"])
+("qmcl" ["Ǯ"])
+("qmdi" ["ǰ"])
+("qmds" ["ǣ"])
+("qmdu" ["Ǩ"])
+("qmdx" ["赭д"])
+("qmdy" ["ǩ"])
+("qme'" "ǲǳǴ")
+("qmee" ["ǰ"])
+("qmfa" ["ǩ"])
+("qmff" ["Ǧ"])
+("qmfg" ["ǰ"])
+("qmfh" ["ǰ"])
+("qmfj" ["ǲ"])
+("qmfu" ["ǧ" "ǰ" "Ǳ"])
+("qmgg" ["ǳ"])
+("qmgs" ["ǯ"])
+("qmgu" ["ǧ"])
+("qmgw" ["ǣ"])
+("qmhb" ["ǰ"])
+("qmhe" ["ǧ"])
+("qmhj" ["ǰ"])
+("qmhl" ["ǳ"])
+("qmhu" ["ǧ"])
+("qmia" ["Ǥ"])
+("qmie" ["ǣ" "ǰ"])
+("qmig" ["ǰ" ""])
+("qmih" ["ǰ"])
+("qmj'" ["޻"])
+("qmjc" ["ǰ"])
+("qmjh" ["漸"])
+("qmjm" ["ǰ"])
+("qmjn" ["ǧ" "ǧ" "ǰ"])
+("qmjq" ["Ǩ"])
+("qmju" ["Ǩ"])
+("qmjw" ["Ƿ"])
+("qmjy" ["ǰ"])
+("qmka" ["ǧ"])
+("qmkd" ["Ǧ"])
+("qmke" ["ǧ"])
+("qmkp" ["Ǭ"])
+("qmkr" ["Ƿ"])
+("qmld" ["Ǯ"])
+("qmli" ["ǧ" "ǰ" "Ǳ"])
+("qmll" ["ǰ"])
+("qmlm" ["ǣ"])
+("qmlp" ["ǰ"])
+("qmls" ["Ǭ¡"])
+("qmlx" ["ǰ"])
+("qmmf" ["ǰ"])
+("qmmi" ["ǧ"])
+("qmmm" ["ǰ"])
+("qmmo" ["İ"])
+("qmmu" ["ǧĶ"])
+("qmmy" ["ǩ"])
+("qmnm" ["ǰ"])
+("qmpl" ["ǰ"])
+("qmq'" "ǣǤǥǦǧǨǩǪǫܷ")
+("qmqc" ["ǰ"])
+("qmqd" ["ǣǿ"])
+("qmqi" ["ǰ"])
+("qmqm" ["ǳǳ"])
+("qmqn" ["ǰ"])
+("qmqq" ["Ǧ" "ǧ"])
+("qmqt" ["Ƿȱ"])
+("qmqu" ["ǰ" "ǰȥ"])
+("qmqy" ["ǰ"])
+("qmr'" "ǵǶǷǸٻ")
+("qmre" ["Ǳ"])
+("qmrf" ["ǰ" "ǰ"])
+("qmrh" ["ǫ"])
+("qmri" ["ǰ"])
+("qmru" ["Ǩ" "Ǳ" "Ƕ"])
+("qms'" ["ù"])
+("qmse" ["ǳɫ"])
+("qmsj" ["ǲɢ"])
+("qmso" ["ǰ"])
+("qmss" ["ǲ"])
+("qmsu" [""])
+("qmsv" ["ǧ" "ȫ"])
+("qmsx" [""])
+("qmtb" ["ǰͷ"])
+("qmti" ["ǰ"])
+("qmtk" ["Ǳ"])
+("qmtl" ["ǰ̨"])
+("qmtm" ["ǰ"])
+("qmto" ["Ƿ"])
+("qmtp" ["ȫͶƱ"])
+("qmtu" ["ǰ;"])
+("qmty" ["ǰͥ" "Ǳͧ"])
+("qmub" ["Ǹ"])
+("qmue" ["ǣ"])
+("qmuf" ["ǣ" "ǰ" "Ƿ"])
+("qmug" ["ǧ"])
+("qmui" ["ǰ"])
+("qmuj" ["Ǧɽ"])
+("qmuk" ["ǰ"])
+("qmuu" ["ǩ"])
+("qmuv" ["Ǳˮ"])
+("qmvb" ["ǧ"])
+("qmvd" ["Ǯׯ"])
+("qmve" ["ǰ"])
+("qmvg" ["ǩ֤"])
+("qmvi" ["ǣ" "ǯ" "ǰ֫"])
+("qmvl" ["Ƿծ"])
+("qmvt" ["ī"])
+("qmvu" ["ǩע"])
+("qmvw" ["ǰצ"])
+("qmw'" "ǬǭǮǯǰǱݡ")
+("qmwa" ["ǧ"])
+("qmwh" ["ǰ"])
+("qmwj" ["ǧ" "޼"])
+("qmwz" ["ǰ"])
+("qmx'" ["ȫ"])
+("qmxd" ["ǰ"])
+("qmxi" ["Ǩ" "Ǩ" "ǰϦ"])
+("qmxm" ["ǰ" "ǳ"])
+("qmxp" ["ǫѷ"])
+("qmxu" ["ǫ"])
+("qmxw" ["Ƿ"])
+("qmxx" ["ǰЩ"])
+("qmyd" ["˶"])
+("qmye" ["ǰҹ"])
+("qmyi" ["Ǩ" "Ǹ"])
+("qmyj" ["ǰ" "ǰ"])
+("qmyn" ["ǣ"])
+("qmyr" ["ǧԪ" "ǰԺ"])
+("qmys" ["ǱӾ"])
+("qmzb" ["ǰ"])
+("qmze" ["Ǵ"])
+("qmzi" ["ǥ" "Ǧ" "ǧ" "ǩ" "ǯ"])
+("qmzl" ["Ǳ"])
+("qmzo" ["ǰ"])
+("qn'" ["ȥ"])
+("qnai" ["װ"])
+("qnbi" ["ױ"])
+("qncl" ["۲"])
+("qndl" ["ش"])
+("qndo" ["ֶ"])
+("qne'" "")
+("qnff" ["ڷ"])
+("qnfj" ["ַ"])
+("qnh'" ["ǣţ"])
+("qnhl" ["ֺ"])
+("qnih" ["׳"])
+("qnjm" ["ټ" "ڼ"])
+("qnjn" ["׽"])
+("qnkb" ["׿"])
+("qnkf" ["ڿ"])
+("qnky" ["ڿ"])
+("qnlk" [""])
+("qnlt" [""])
+("qnlv" [""])
+("qnly" [""])
+("qnma" [""])
+("qnmi" [""])
+("qnna" [""])
+("qnnd" [""])
+("qnni" [""])
+("qnpz" [""])
+("qnq'" "")
+("qnqi" [""])
+("qnqn" [""])
+("qnqr" ["Ȩ"])
+("qnqx" [""])
+("qnqy" [""])
+("qnr'" ["" "" "" ""])
+("qnre" [""])
+("qnrf" [""])
+("qnrk" [""])
+("qnru" [""])
+("qntp" [""])
+("qnub" ["" ""])
+("qnue" [""])
+("qnuf" [""])
+("qnug" [""])
+("qnui" ["ʴ" "" ""])
+("qnuu" [""])
+("qnvb" [""])
+("qnvg" ["" ""])
+("qnvj" ["ռ"])
+("qnw'" "")
+("qnwh" ["" ""])
+("qnwu" [""])
+("qnxi" ["Ϯ"])
+("qnxm" [""])
+("qnxn" [""])
+("qnxt" ["ѧ"])
+("qnyb" [""])
+("qnyj" [""])
+("qnyt" ["Խ"])
+("qnzi" [""])
+("qnzu" [""])
+("qpb'" ["ݲ"])
+("qpdk" ["Ⱥ"])
+("qpfg" ["Ⱥ"])
+("qphj" ["ǰͺ"])
+("qphp" ["Ⱥ"])
+("qpju" ["Ⱥ"])
+("qplo" ["Ⱥ"])
+("qpq'" ["" ""])
+("qpqi" ["Ⱥ"])
+("qpqy" ["Ⱥ"])
+("qpti" ["Ⱥ"])
+("qpu'" ["ǹ"])
+("qpvs" ["Ⱥ"])
+("qpw'" "ȹȺ")
+("qpxc" ["ȺС"])
+("qpyl" ["ǧƪһ"])
+("qpzi" ["ȹ"])
+("qq'" ["Ȩ"])
+("qqbo" ["ﲥ"])
+("qqdb" ["ȫȨ"])
+("qqds" ["ﶬ"])
+("qqdv" [""])
+("qqe'" "")
+("qqff" [""])
+("qqfg" [""])
+("qqfj" [""])
+("qqgf" [""])
+("qqgg" [""])
+("qqgo" [""])
+("qqhb" [""])
+("qqhd" ["ȡ"])
+("qqhe" ["" ""])
+("qqhh" ["ǰǰ"])
+("qqhp" [""])
+("qqig" [""])
+("qqih" [""])
+("qqii" [""])
+("qqiu" [""])
+("qqjc" [""])
+("qqji" ["＾"])
+("qqjn" [""])
+("qqjp" [""])
+("qqjq" [""])
+("qqkk" ["ڿҿ"])
+("qqly" [""])
+("qqmf" [""])
+("qqmm" [""])
+("qqpl" [""])
+("qqq'" "")
+("qqqm" ["ǧ"])
+("qqqr" ["ȫ"])
+("qqqy" [""])
+("qqrf" [""])
+("qqs'" [""])
+("qqse" ["ɫ"])
+("qqsl" [""])
+("qqti" [""])
+("qqtl" ["̨"])
+("qqtm" ["" ""])
+("qqub" [""])
+("qqug" [""])
+("qqui" ["ʵ" ""])
+("qquv" ["ˮ"])
+("qqvd" ["״"])
+("qqvg" ["֤"])
+("qqvh" [""])
+("qqvi" ["֪" "ְ"])
+("qqw'" "ٴ")
+("qqwh" [""])
+("qqww" ["ǧǧ"])
+("qqxf" ["ǡǡ෴"])
+("qqxn" [""])
+("qqxp" ["Ѵ"])
+("qqxt" ["ѧ"])
+("qqxx" ["Ь"])
+("qqxy" [""])
+("qqyr" ["Ԯ"])
+("qqyu" [""])
+("qqzb" ["ȫ"])
+("qrbu" ["ȫ"])
+("qrcp" ["ȫ"])
+("qrdb" ["ȫ"])
+("qrdg" ["ȫ"])
+("qrdh" ["ȫ"])
+("qrdi" ["Ȧ"])
+("qrdk" ["Ȱ"])
+("qrdm" ["Ȧ"])
+("qre'" "Ȯ")
+("qrfu" ["ȫ"])
+("qrgk" ["Ȱ"])
+("qrgo" ["ȫ"])
+("qrgu" ["ȧ"])
+("qrgv" ["Ȩ"])
+("qrhg" ["Ȩ" "ȫ"])
+("qrhv" ["ȫ"])
+("qrif" ["Ȩ"])
+("qrig" ["ȫ" "ȫ" "ȫ"])
+("qrih" ["ȫ" "ȫ"])
+("qrjc" ["ȫ"])
+("qrji" ["ȫ" "ȭ"])
+("qrjn" ["Ȱ"])
+("qrjp" ["ȫ"])
+("qrju" ["ȫ"])
+("qrjw" ["ȫ"])
+("qrjy" ["ȫ"])
+("qrkl" ["ȫ"])
+("qrld" ["Ȧ"])
+("qrli" ["Ȩ" "Ȩ" "ȫ"])
+("qrma" ["ȫ"])
+("qrmk" ["ȫò"])
+("qrmm" ["ȫ"])
+("qrmn" ["ȫ"])
+("qrng" ["Ȩ" "ȫ"])
+("qrnm" ["ȫ"])
+("qrpj" ["ȫ"])
+("qrq'" "Ȧ")
+("qrqf" ["ǡ"])
+("qrqq" ["ȫ"])
+("qrqr" ["ȫȨ"])
+("qrr'" "ȯȰ")
+("qrrf" ["ȫ"])
+("qrrj" ["ȫȻ"])
+("qrsu" ["ȫ"])
+("qrt'" [""])
+("qrtb" ["ȭͷ"])
+("qrti" ["ȫ"])
+("qrtk" ["Ȧ" "ȫ"])
+("qrtm" ["ȫ"])
+("qruf" ["ȫ"])
+("qrug" ["ȫʡ" "ȫʢ" "ȫʤ"])
+("qrui" ["Ȩʱ" "Ȩ" "ȫ" "ȫ"])
+("qruo" ["Ȱ˵"])
+("qruu" ["Ȩ" "Ȩ" "ȫ" "ȫ"])
+("qruv" ["Ȫˮ"])
+("qrv'" ["ȫ"])
+("qrvb" ["Ȫ"])
+("qrvt" ["̸֮"])
+("qrvu" ["ȫס"])
+("qrw'" "ȧȨȩȪȫȬȭڹ")
+("qrwf" ["ȫ"])
+("qrwu" ["ȫ"])
+("qrwz" ["Ȩ" "Ȱο"])
+("qrxi" ["ȫϢ"])
+("qrxm" ["Ȩ" "ȫ" "ȫ"])
+("qrxn" ["ȫ"])
+("qrxy" ["ȫ" "ȫ"])
+("qryi" ["Ȩ"])
+("qryj" ["Ȫ"])
+("qryk" ["ȨҪ"])
+("qryn" ["ȫ"])
+("qryr" ["ȪԴ"])
+("qryu" ["Ȭ"])
+("qrzi" ["Ȧ"])
+("qrzu" ["Ȱ"])
+("qsdv" [""])
+("qshw" [""])
+("qsjd" [""])
+("qsjn" [""])
+("qskp" [""])
+("qsku" [""])
+("qsl'" [""])
+("qsrf" [""])
+("qsu'" [""])
+("qsvi" ["֬"])
+("qsvv" ["׷"])
+("qsw'" "")
+("qswl" ["ǧ˿"])
+("qswy" ["ǰδ"])
+("qsyk" [""])
+("qt'" [""])
+("qtba" ["ȴ"])
+("qtbj" ["ͷ" "ȸ"])
+("qtbk" ["ȷ"])
+("qtbu" ["ȴ" "ȴ"])
+("qtbz" ["ȴ"])
+("qtde" ["ȱ"])
+("qtdh" ["ȷ"])
+("qtdm" ["ȱ"])
+("qtdy" ["ȷ"])
+("qtfa" ["ȱ"])
+("qtgl" ["̸"])
+("qtgz" ["ȴ"])
+("qtj'" ["Ǯ"])
+("qtkb" ["ȱ"])
+("qtli" ["ȷ"])
+("qtmc" ["ȱ"])
+("qtng" ["ȴ"])
+("qtq'" ["ȱ" "Ȳ" "" "ͭ"])
+("qtqc" ["ȵ"])
+("qtqn" ["ȱ"])
+("qtqx" ["ȷ"])
+("qtr'" "ȴȵȶȷȸ")
+("qtrf" ["ȷ"])
+("qtrl" ["ȼ"])
+("qtug" ["ȱʡ"])
+("qtui" ["ȷʵ" "ȷ"])
+("qtuk" ["ȱ"])
+("qtuo" ["ȴ˵"])
+("qtuu" ["ȷ"])
+("qtw'" "ȳ")
+("qtwx" ["ǧͷ"])
+("qtxi" ["ȱϯ"])
+("qtxm" ["ȱ"])
+("qtxn" ["ȷ"])
+("qtyb" ["ȴ" "ȴ" "ȷ"])
+("qtyk" ["ȴҪ"])
+("qtzi" ["ȳ"])
+("qtzl" ["ȴ"])
+("qtzo" ["ȷ"])
+("qu'" ["ʵ"])
+("qubj" ["ְ˽"])
+("qubk" ["ȡ"])
+("qubx" [""])
+("quby" [""])
+("qucl" ["ȡ"])
+("qucs" [""])
+("qudc" ["" "ȥ"])
+("qude" ["ȡ"])
+("qudi" ["" "ȡ"])
+("qudk" ["" "ȡ"])
+("qudl" ["ȡ"])
+("qudm" [""])
+("quds" [""])
+("que'" "ȡȢȣ")
+("quf'" ["ʦ"])
+("qufa" ["ȡ"])
+("quff" [""])
+("qufu" ["" ""])
+("qug'" ["ʷ"])
+("qugj" ["" ""])
+("qugv" ["ȫע"])
+("qugz" ["ȥ"])
+("quho" ["ȡ"])
+("quhw" [""])
+("quie" [""])
+("quii" ["ȣ"])
+("quiu" ["" "ȡ" "ȥ"])
+("quj'" ["ȫ"])
+("qujm" [""])
+("qujp" [""])
+("qujq" ["ȥ"])
+("qujt" ["ȡ"])
+("qujx" [""])
+("qujy" ["ݼ" "ȡ" "ȡ"])
+("qukr" ["ȡ"])
+("qukx" ["ʵ"])
+("qulu" ["ȥ·"])
+("qulv" [""])
+("quly" [""])
+("qumm" [""])
+("qumz" ["ù"])
+("qun'" [""])
+("quna" ["ȥ"])
+("qunm" ["ȥ"])
+("qunr" ["ȡů"])
+("qupl" [""])
+("qupu" [""])
+("quq'" ["" "" "" "" "" "" "" "ڰ" "" "" "" "" "" "" "ˮǽ"])
+("quqc" ["ȡ"])
+("quqj" ["ʽػ"])
+("quqn" ["Ȣ"])
+("ququ" ["" "ȥȥ"])
+("quqy" [""])
+("qur'" "Ȥȥ")
+("quru" [""])
+("qusi" ["ȥ˼"])
+("qusj" ["ɢ"])
+("qusv" ["ȥ"])
+("qut'" ["" "Ǳˮͧ" ""])
+("quti" [""])
+("quu'" [""])
+("quue" ["ȡ"])
+("quuf" [""])
+("quug" ["ȡʤ" "ȥ"])
+("quui" ["" "ʽ" "ʹ" "ȥ"])
+("quuv" ["ˮ" "ˮ"])
+("quvb" [""])
+("quve" [""])
+("quvg" [""])
+("quvh" [""])
+("quvi" ["ֱ" "ȥְ"])
+("quvu" [""])
+("quw'" "۾ޡ޾")
+("quwz" ["ί" "λ" "Ȥζ"])
+("quxc" ["ȡ" "ȡЦ"])
+("quxd" ["" "ȥ"])
+("quxi" ["ϥ"])
+("quxm" [""])
+("quxs" ["ȥ"])
+("quxw" ["ȡ"])
+("quxx" [""])
+("quy'" ["ǱˮԱ"])
+("quyb" [""])
+("quyh" ["" "ȡ"])
+("quyi" [""])
+("quyq" ["ȫ"])
+("quyr" ["ԭ"])
+("quyu" ["" ""])
+("quzi" [""])
+("quzy" ["ʴ"])
+("qv'" [""])
+("qvbd" ["֮"])
+("qvbj" ["ȡ֮"])
+("qvd'" ["Ǧж" "ζ"])
+("qvg'" [""])
+("qvgd" ["Ⱥڹ۵"])
+("qvhj" ["ػ"])
+("qvi'" ["ش"])
+("qvij" [""])
+("qvj'" ["ػ" "" ""])
+("qvls" ["թ"])
+("qvlx" ["Ⱥ·"])
+("qvs'" [""])
+("qvsl" [""])
+("qvwq" ["ǧȷ"])
+("qvx'" ["Ⱥ"])
+("qvxm" [""])
+("qvxu" ["Ⱥѧ"])
+("qvy'" [""])
+("qvyd" ["Ⱥ˶"])
+("qvzv" ["Ⱥ֯"])
+("qw'" [""])
+("qwb'" [""])
+("qwcv" ["ȥα"])
+("qwdh" ["ǡ"])
+("qwe'" "")
+("qwhk" ["ǡ"])
+("qwpj" [""])
+("qwq'" "٤")
+("qwqc" ["ǡ"])
+("qwqw" ["ǡǡ"])
+("qwr'" "ǡǢ")
+("qwru" ["ǡ"])
+("qwtj" ["Ǣ̸"])
+("qwuh" ["Ǣ"])
+("qwy'" ["Ա"])
+("qxbu" ["Ҳ"])
+("qxco" ["д"])
+("qxd'" ["б" ""])
+("qxdm" ["е"])
+("qxdr" ["ж"])
+("qxe'" "")
+("qxge" ["и"])
+("qxgo" ["Թ"])
+("qxgv" ["ι״"])
+("qxhe" ["к"])
+("qxhj" [""])
+("qxhr" ["л"])
+("qxig" ["г"])
+("qxii" ["г"])
+("qxiu" ["г"])
+("qxj'" ["" "б"])
+("qxje" ["׼"])
+("qxji" ["м" "м"])
+("qxju" ["ǫ" "Ծ"])
+("qxkb" ["п"])
+("qxkl" ["п"])
+("qxky" ["п"])
+("qxl'" [""])
+("qxmj" [""])
+("qxmm" [""])
+("qxno" ["ų"])
+("qxp'" ["Ȱѧƪ"])
+("qxpm" ["Ƭ"])
+("qxq'" "")
+("qxqu" ["ȡ"])
+("qxqx" [""])
+("qxqy" ["ȫȫ"])
+("qxr'" "ۧ")
+("qxrk" [""])
+("qxsd" ["ٶ"])
+("qxt'" ["̨" "ͼ"])
+("qxty" [""])
+("qxuf" [""])
+("qxui" ["ʵ"])
+("qxuo" ["˵"])
+("qxw'" "٤")
+("qxwk" ["ǧ"])
+("qxwu" [""])
+("qxwx" [""])
+("qxx'" ["ѧ" ""])
+("qxxl" ["Э"])
+("qxxm" [""])
+("qxxn" [""])
+("qxxt" [""])
+("qxxx" ["м"])
+("qxy'" [""])
+("qxyd" ["˶"])
+("qxyi" [""])
+("qxyl" [""])
+("qxys" ["Ҫ"])
+("qxzi" [""])
+("qy'" [""])
+("qyai" ["鰮"])
+("qyan" ["밲"])
+("qybk" ["鱨"])
+("qybl" [""])
+("qybm" [""])
+("qybo" ["ᱡ"])
+("qyce" [""])
+("qyci" [""])
+("qyck" ["" ""])
+("qycl" ["д" ""])
+("qycv" ["" ""])
+("qycw" ["ҵ"])
+("qydb" ["ඹ"])
+("qydc" [""])
+("qydj" ["ⵯ" "嵥" "嵭"])
+("qydk" ["ൺ" "㵹" ""])
+("qydl" [""])
+("qydm" ["" ""])
+("qyds" ["㶯"])
+("qye'" "")
+("qyfg" ["" ""])
+("qyfh" [""])
+("qyfu" ["ḡ" "㸲" "㸴"])
+("qyge" [""])
+("qygj" [""])
+("qygk" [""])
+("qygl" ["ҵ"])
+("qygr" [""])
+("qygs" ["๤" "칦"])
+("qyh'" ["ҵ" "ȫ˻"])
+("qyhe" ["" "" ""])
+("qyhg" ["" "ǰ"])
+("qyhj" [""])
+("qyhl" ["ຣ" ""])
+("qyhn" [""])
+("qyhv" [""])
+("qyhw" ["໨" "⻯" "" "廪" "軯"])
+("qyhy" ["黳"])
+("qyia" [""])
+("qyie" ["峺"])
+("qyif" ["峿"])
+("qyih" ["峥"])
+("qyik" ["峯"])
+("qyip" ["ഺ"])
+("qyiu" ["" ""])
+("qyj'" ["ҵ" "ͻ"])
+("qyjc" ["" "" ""])
+("qyjd" ["彭"])
+("qyjj" ["ҵ"])
+("qyjm" [""])
+("qyjn" [""])
+("qyjw" [""])
+("qyjx" ["" ""])
+("qyjy" ["徲" "徻" "龰" "龳"])
+("qykd" [""])
+("qyke" ["" "" ""])
+("qykj" ["뿴"])
+("qyks" [""])
+("qyky" ["" "пԭ"])
+("qyl'" ["ǣ" "ǿ"])
+("qyld" ["" ""])
+("qylh" [""])
+("qyli" ["" ""])
+("qylk" [""])
+("qyll" [""])
+("qylq" [""])
+("qyls" [""])
+("qylv" ["" ""])
+("qymc" [""])
+("qymh" ["ǱĬ"])
+("qymm" [""])
+("qymx" [""])
+("qymy" [""])
+("qymz" ["÷"])
+("qyni" [""])
+("qynm" [""])
+("qynn" [""])
+("qyq'" "")
+("qyqc" [""])
+("qyqi" ["" ""])
+("qyqq" [""])
+("qyqr" ["Ȫ"])
+("qyqu" ["Ȥ"])
+("qyqy" [""])
+("qyr'" "")
+("qyrb" [""])
+("qyrf" ["" ""])
+("qys'" ["һɫ"])
+("qysk" ["ɨ"])
+("qysr" ["" ""])
+("qyss" ["" ""])
+("qyth" ["" ""])
+("qytj" ["̸"])
+("qytm" ["" ""])
+("qyts" ["ͭ"])
+("qytu" [""])
+("qyty" ["" ""])
+("qyu'" ["Ǳʶ" "Ը"])
+("qyub" ["" ""])
+("qyud" ["ˬ"])
+("qyug" [""])
+("qyuh" [""])
+("qyui" ["" "ʱ" "" "" "ʾ"])
+("qyuj" ["ɽ"])
+("qyuu" [""])
+("qyuv" ["ˮ"])
+("qyuy" [""])
+("qyvb" [""])
+("qyvd" ["״"])
+("qyvf" [""])
+("qyvg" [""])
+("qyvs" [""])
+("qyvu" ["" "ע" "ף"])
+("qyw'" "")
+("qywa" [""])
+("qywf" ["" ""])
+("qywu" [""])
+("qywz" ["΢"])
+("qyx'" [""])
+("qyxc" [""])
+("qyxd" ["" ""])
+("qyxi" ["" "ϴ"])
+("qyxn" ["" "" "" ""])
+("qyxq" [""])
+("qyxu" [""])
+("qyxx" ["б" "к"])
+("qyxy" ["" "" "" ""])
+("qyyb" [""])
+("qyyi" ["" "" ""])
+("qyyn" [""])
+("qyyr" ["Ը" "Ը" "Ԫ"])
+("qyyu" ["" ""])
+("qyyy" ["ӯ"])
+("qyzb" [""])
+("qyzi" [""])
+("qyzk" [""])
+("qyzl" [""])
+("qyzo" [""])
+("qyzv" ["" ""])
+("qz'" ["ǩ"])
+("qzql" ["ȥȥ"])
+("qzth" ["̰"])
+("r" "")
+("rb'" ["ձ"])
+("rbco" [""])
+("rbdk" [""])
+("rbdy" ["ⶡ"])
+("rbh'" ["ձ"])
+("rbhe" [""])
+("rblz" [""])
+("rbma" [""])
+("rbmo" ["ĩ"])
+("rbnf" [""])
+("rbnm" [""])
+("rbpi" ["Ƥ"])
+("rbpm" ["Ƭ"])
+("rbr'" ["" "ձ"])
+("rbrf" [""])
+("rbrr" [""])
+("rbs'" ["ɫ"])
+("rbti" [""])
+("rbui" ["ʳ"])
+("rbup" ["˳"])
+("rbv'" ["̲ס"])
+("rbvi" [""])
+("rbw'" "")
+("rbxr" ["˰"])
+("rbxy" [""])
+("rbyj" [""])
+("rc'" ["˴"])
+("rcdd" ["˵ȵ"])
+("rcey" ["˶"])
+("rcjj" ["˲żü"])
+("rdh'" ["˴"])
+("rdi'" ["ȵ糧" ""])
+("rdl'" ["ȵ"])
+("rdo'" ["ȵż"])
+("rdvw" ["ȴֲ"])
+("rdvy" ["˵"])
+("rdx'" ["ȶ"])
+("rdyl" ["ȴ"])
+("re'" ["Ȼ"])
+("reai" ["Ȱ"])
+("reby" ["Ȳ"])
+("redl" ["ȴ"])
+("redm" ["ȵ"])
+("redu" ["ȶ"])
+("ree'" "")
+("refg" ["ȷ"])
+("rehe" ["Ⱥ"])
+("reho" ["ǻ" "Ȼ"])
+("reif" ["ȳ"])
+("reig" ["ȳ"])
+("reik" ["ȳ"])
+("reji" ["Ȼ"])
+("rejm" ["ȼ"])
+("reld" [""])
+("reli" [""])
+("relq" [""])
+("relx" [""])
+("relz" [""])
+("reng" [""])
+("renk" [""])
+("reqi" [""])
+("reqx" [""])
+("reqy" [""])
+("rer'" "")
+("retm" [""])
+("reuv" ["ˮ"])
+("reva" [""])
+("revh" [""])
+("revi" ["ֵ"])
+("revs" [""])
+("revv" ["նս"])
+("rewh" [""])
+("rexn" [""])
+("rext" ["Ѫ"])
+("reya" ["ѹ"])
+("reyr" ["Դ"])
+("rfai" ["ʰ"])
+("rfci" ["ʴ" "˴"])
+("rfcl" ["˲" "˲"])
+("rfco" ["ϴ"])
+("rfcs" ["˴"])
+("rfda" ["˴"])
+("rfde" ["ϵ"])
+("rfdi" ["ʵ"])
+("rfdk" ["˵"])
+("rfdl" ["ʹ"])
+("rfdy" ["˶" "϶"])
+("rfe'" "")
+("rfer" ["˶"])
+("rffu" ["˸"])
+("rfgb" ["Ϲ"])
+("rfge" ["˸"])
+("rfgs" ["˹"])
+("rfhe" ["˺" "κ"])
+("rfig" ["˳"])
+("rfiu" ["ϳ"])
+("rfjc" ["ν"])
+("rfji" ["˼" "˼"])
+("rfjm" ["˼"])
+("rfjp" ["˾"])
+("rfju" ["о"])
+("rfjw" ["˼"])
+("rfkb" ["˿"])
+("rfke" ["Ͽ"])
+("rfl'" ["ȷ¯"])
+("rfli" [""])
+("rflp" [""])
+("rflq" [""])
+("rfly" [""])
+("rflz" [""])
+("rfma" [""])
+("rfmf" [""])
+("rfmm" [""])
+("rfmn" [""])
+("rfmu" ["ĸ"])
+("rfmy" ["" ""])
+("rfn'" ["˷"])
+("rfnl" [""])
+("rfpn" ["Ʒ"])
+("rfpy" ["ƾ"])
+("rfqi" ["" ""])
+("rfqp" ["Ⱥ"])
+("rfqr" ["Ȩ"])
+("rfqy" ["" ""])
+("rfr'" "")
+("rfrf" ["" ""])
+("rfrh" [""])
+("rfri" [""])
+("rftb" ["ͷ"])
+("rfti" [""])
+("rfts" ["ʹ" "ͬ"])
+("rfu'" ["ȷ"])
+("rfub" ["" ""])
+("rfuf" ["˲" "" ""])
+("rfug" ["" ""])
+("rfui" ["ʱ" "ʿ" "" "" "" "ʶ"])
+("rfuu" ["" ""])
+("rfvf" [""])
+("rfvg" ["" "֤" "֤"])
+("rfvi" ["" "" "ְ"])
+("rfvs" ["" ""])
+("rfvu" ["" "ס"])
+("rfw'" "")
+("rfwf" [""])
+("rfwu" ["" ""])
+("rfwz" ["Ϊ" "Ϊ"])
+("rfxd" [""])
+("rfxn" ["" ""])
+("rfxr" ["ѡ" "ѡ"])
+("rfxs" [""])
+("rfxw" [""])
+("rfxy" ["" "" ""])
+("rfyi" ["" ""])
+("rfyj" ["" ""])
+("rfyr" ["Ա"])
+("rfys" [""])
+("rfyu" ["˸" ""])
+("rfyy" ["Ӱ"])
+("rfzi" [""])
+("rfzk" [""])
+("rfzo" [""])
+("rfzv" [""])
+("rg'" [""])
+("rgb'" ["ǲ"])
+("rgbu" ["Բ"])
+("rgd'" ["չ"])
+("rgdc" ["ӵ"])
+("rgdl" ["ȹ"])
+("rgh'" ["˸"])
+("rghi" ["˹ϳ"])
+("rgjq" ["Ծ"])
+("rgke" ["Կ"])
+("rgl'" ["˹"])
+("rgng" [""])
+("rgq'" "")
+("rgrj" ["Ȼ"])
+("rgui" [""])
+("rguj" ["˹ھ"])
+("rgw'" "")
+("rgwz" ["δ"])
+("rgx'" ["ȹ"])
+("rgxu" [""])
+("rgxw" [""])
+("rgyb" ["" ""])
+("rgyl" [""])
+("rh'" ["Ȼ"])
+("rhbu" ["ò"])
+("rhe'" "")
+("rhfy" ["Ⱥ˷Ӧ"])
+("rhgz" ["ø"])
+("rhit" ["Ȼ"])
+("rhj'" ["黯"])
+("rhkl" ["ÿ"])
+("rhlu" ["·"])
+("rhq'" "")
+("rhr'" "")
+("rhrh" [""])
+("rhrt" ["ݱ"])
+("rhtu" [""])
+("rhty" ["绢"])
+("rhv'" ["֬"])
+("rhve" [""])
+("rhw'" "ȿ")
+("rhwz" ["λ"])
+("rhy'" [""])
+("rhyu" [""])
+("ribc" ["ձ"])
+("ribf" ["ձ"])
+("ribk" ["ձ"])
+("ric'" ["ȳɲ"])
+("rid'" ["ȴ"])
+("rigd" ["չ"])
+("rigs" ["չ"])
+("rihb" ["պ"])
+("rihw" ["ջ"])
+("riig" ["ճ"])
+("riih" ["ճ"])
+("riij" ["ղ"])
+("riiu" ["ճ"])
+("riji" ["ռ"])
+("rijm" ["ռ" "ս"])
+("rijq" ["վ"])
+("rikj" ["տ"])
+("ril'" ["ȴ" "ղ"])
+("rili" ["" ""])
+("rill" [""])
+("rilo" [""])
+("rinj" [""])
+("rinz" [""])
+("riqi" [""])
+("riqm" ["ǰ"])
+("riqu" [""])
+("rir'" "")
+("ritb" ["ͷ"])
+("ritj" ["̳"])
+("riui" ["ʳ" "ʴ"])
+("rivk" [""])
+("rivs" [""])
+("riwf" [""])
+("rixn" [""])
+("rixw" [""])
+("riye" ["ҹ"])
+("riyi" [""])
+("riyr" ["Ԫ"])
+("riys" [""])
+("riyt" [""])
+("riyu" [""])
+("rizi" [""])
+("rjb'" [""])
+("rjby" ["Ⱦ"])
+("rjdm" ["ȼ"])
+("rje'" "ȽȾ")
+("rjer" ["Ȼ"])
+("rjg'" ["ȼӹ"])
+("rjgh" ["Ⱦ"])
+("rjh'" ["Ƚ"])
+("rjhb" ["Ȼ"])
+("rjlc" ["ȼ" "Ⱦ"])
+("rjqc" ["˾"])
+("rjqi" ["ȼ"])
+("rjse" ["Ⱦɫ"])
+("rjsk" ["缢ƿ"])
+("rjsx" [""])
+("rjti" ["վ쳤"])
+("rjuk" ["ȼ"])
+("rjvg" ["Ⱦ"])
+("rjw'" "Ȼȼ")
+("rjze" ["Ȼ"])
+("rk'" ["˿"])
+("rkdk" ["Ƶ"])
+("rkds" ["Ŷ"])
+("rke'" "")
+("rkgo" ["ƹ"])
+("rkgu" ["˿ڹʣ"])
+("rkkl" ["ƿ"])
+("rkl'" ["˿"])
+("rklr" [""])
+("rkmy" [""])
+("rkpy" ["ƽ"])
+("rkr'" "")
+("rkuu" ["ˡ"])
+("rkvb" [""])
+("rkw'" "")
+("rkxy" [""])
+("rkzj" ["˿"])
+("rkzu" [""])
+("rl'" [""])
+("rlgi" [""])
+("rlgy" ["ȼϹҵ"])
+("rli'" [""])
+("rll'" [""])
+("rlp'" ["ƿ"])
+("rlry" ["Թ"])
+("rlwu" ["ʷ"])
+("rlx'" ["ѧ"])
+("rlxh" ["ѭ"])
+("rly'" ["ȼ"])
+("rlyk" ["ӯ"])
+("rm'" [""])
+("rmb'" ["" ""])
+("rmd'" [""])
+("rmdh" [""])
+("rmdt" [""])
+("rmdz" [""])
+("rmft" ["ͥ"])
+("rmfx" ["η"])
+("rmfy" ["Ժ"])
+("rmgu" [""])
+("rmiu" [""])
+("rmjd" [""])
+("rmji" ["񾯲"])
+("rmrb" ["ձ"])
+("rms'" ["ľ"])
+("rmtt" [""])
+("rmvf" [""])
+("rmvj" ["ȼü֮"])
+("rmvv" ["ս"])
+("rmvx" [""])
+("rmwv" ["װ"])
+("rmx'" [""])
+("rmyv" ["־"])
+("rnw'" [""])
+("rnwy" ["Э"])
+("rny'" [""])
+("rodm" ["" ""])
+("rofu" [""])
+("rofz" [""])
+("rogj" [""])
+("rogo" [""])
+("rohe" [""])
+("rois" [""])
+("rojm" [""])
+("ror'" "ټ")
+("rosr" [""])
+("roui" [""])
+("rove" [""])
+("rowu" [""])
+("rowz" ["Ϊ"])
+("roxc" ["С"])
+("rpb'" ["Ƥ"])
+("rph'" ["ƽ"])
+("rphw" [""])
+("rpih" [""])
+("rpnm" [""])
+("rpr'" "")
+("rpri" [""])
+("rpse" ["ɫ"])
+("rpui" ["ʪ"])
+("rpv'" [""])
+("rpyt" [""])
+("rq'" [""])
+("rqli" ["ȼֻ"])
+("rqlj" ["ȼֻ"])
+("rqtt" [""])
+("rqu'" ["ȫʳ"])
+("rqw'" ["ζ"])
+("rr'" ["Ȼ"])
+("rre'" "")
+("rree" [""])
+("rrgk" [""])
+("rrgr" [""])
+("rrgs" [""])
+("rrgu" [""])
+("rrhw" [""])
+("rrjm" [""])
+("rrl'" [""])
+("rrmu" ["ľ"])
+("rrpj" [""])
+("rrro" [""])
+("rruv" ["ˮ"])
+("rrvu" ["־ʿ"])
+("rrwx" ["Ϊ"])
+("rrx'" [""])
+("rryy" ["ҹҹ" "Ӳ"])
+("rsbu" ["޲"])
+("rsco" ["ݴ"])
+("rsdm" ["۵"])
+("rsds" ["ܶ"])
+("rse'" "")
+("rshe" ["ں" "ܺ"])
+("rshj" ["ۺ"])
+("rsho" ["ٻ"])
+("rshv" ["ڻ"])
+("rshw" ["ڻ" "ۻ" "ܻ"])
+("rsii" ["۳"])
+("rsjc" ["ܽ"])
+("rsji" ["ۼ" "ܼ" "ݻ"])
+("rsjx" ["ڽ" "۽" "ܽ"])
+("rskh" ["ݿ"])
+("rsld" ["Ⱦɫζ" ""])
+("rslm" [""])
+("rslu" ["»" "¯"])
+("rsma" [""])
+("rsmk" ["ë" "ò" "ë"])
+("rsna" [""])
+("rsqi" [""])
+("rsqw" ["Ǣ"])
+("rsrf" [""])
+("rsrs" ["" ""])
+("rst'" ["Ⱦɫ"])
+("rsu'" ["ȼ˵"])
+("rsuu" [""])
+("rsv'" ["Ⱦɫ"])
+("rsvi" [""])
+("rsvs" [""])
+("rsw'" "")
+("rswz" ["Ϊ"])
+("rsx'" [""])
+("rsxm" ["" ""])
+("rsxu" [""])
+("rsxx" ["Ѫ"])
+("rsxy" ["" ""])
+("rsye" ["Һ"])
+("rsyi" ["" ""])
+("rsyj" [""])
+("rsyk" ["ҫ"])
+("rsyu" ["" "" ""])
+("rtdw" ["嶯"])
+("ru'" ["ʶ"])
+("rubl" [""])
+("rubx" ["ٱ"])
+("ruch" [""])
+("ruci" ["" ""])
+("rudh" ["뵳"])
+("ruds" ["䶯" "綫" "붬"])
+("rue'" "")
+("ruer" ["" ""])
+("ruff" [""])
+("rufh" ["鷿"])
+("rug'" [""])
+("rugj" [""])
+("rugk" [""])
+("rugo" [""])
+("rugu" ["" ""])
+("ruhe" [""])
+("ruho" [""])
+("ruhv" [""])
+("ruhw" ["黯" "뻭"])
+("ruih" ["糣" "볡"])
+("ruik" ["볬"])
+("ruj'" [""])
+("rujc" ["齺"])
+("ruji" [""])
+("rujn" [""])
+("rujw" [""])
+("rujy" ["뾳"])
+("rukb" [""])
+("ruku" [""])
+("rul'" ["ʶ"])
+("ruld" ["ɹζ"])
+("rulk" [""])
+("rull" [""])
+("ruln" [""])
+("ruma" [""])
+("rumf" [""])
+("rumg" [""])
+("rumi" [""])
+("rumo" ["ī"])
+("rumu" ["ĸ"])
+("runj" [""])
+("runq" ["ţ"])
+("rup'" ["ˮƿ"])
+("ruqi" ["" ""])
+("ruqn" [""])
+("rur'" "")
+("ruro" [""])
+("rusr" [""])
+("rusu" [""])
+("rutb" ["ͷ"])
+("ruth" [""])
+("rutk" [""])
+("ruto" [""])
+("rutr" [""])
+("ruts" ["ͬ"])
+("rutu" ["ͼ" ""])
+("ruu'" ["ȼ"])
+("ruub" [""])
+("ruue" ["" ""])
+("ruuf" [""])
+("ruug" [""])
+("ruuh" [""])
+("ruui" ["ʵ" "" "ʱ" ""])
+("ruuj" ["ɽ"])
+("ruuu" ["" ""])
+("ruuv" ["˯"])
+("ruve" [""])
+("ruvi" ["֭" "ֱ"])
+("ruvx" ["ѧ"])
+("ruw'" "޸")
+("ruwu" ["" ""])
+("ruwz" ["΢" "ζ"])
+("rux'" ["ʳ"])
+("ruxm" [""])
+("ruxs" [""])
+("ruxt" ["ѧ" "ѧ"])
+("ruxw" [""])
+("ruyb" [""])
+("ruye" ["ҹ"])
+("ruyf" [""])
+("ruyi" [""])
+("ruyp" [""])
+("ruyr" ["Ը" "Ժ"])
+("ruyt" [""])
+("ruyu" ["" "" ""])
+("ruzi" ["" ""])
+("ruzo" [""])
+("ruzy" [""])
+("rv'" [""])
+("rvdm" [""])
+("rve'" "")
+("rvh'" ["֪"])
+("rvig" [""])
+("rviq" ["֮"])
+("rvjc" [""])
+("rvjn" [""])
+("rvli" ["" ""])
+("rvp'" ["Ʒ"])
+("rvqi" [""])
+("rvr'" "")
+("rvs'" ["֬"])
+("rvui" ["ʿ"])
+("rvw'" "ި")
+("rvy'" ["Һ"])
+("rw'" ["Ϊ"])
+("rwd'" ["Ϊ"])
+("rwkr" ["޿"])
+("rwqu" [""])
+("rwxg" ["Ը"])
+("rwy'" ["λ"])
+("rx'" [""])
+("rxd'" ["е"])
+("rxl'" ["Ч" ""])
+("rxsx" [""])
+("rxy'" ["ЧӦ"])
+("rxyy" [""])
+("ry'" ["Ա"])
+("ryd'" ["˶"])
+("rydd" [""])
+("ryjh" ["Һۺ" "Һۺ"])
+("ryjj" ["Ӿ"])
+("ryju" ["Ӳʩ"])
+("rykw" ["Կη"])
+("ryp'" ["Ʒ"])
+("ryss" ["˼"])
+("ryzv" [""])
+("rzb'" [""])
+("rzdx" [""])
+("rzj'" ["ּ"])
+("rzm'" [""])
+("rzs'" ["˿"])
+("rzt'" [""])
+("rzwx" [""])
+("rzxj" [""])
+("rzxw" ["ά"])
+("s" "")
+("sabo" [""])
+("sae'" "")
+("saer" [""])
+("sahd" [""])
+("sajc" [""])
+("sakl" [""])
+("sala" [""])
+("sali" [""])
+("samu" ["ķ"])
+("sana" [""])
+("saq'" "")
+("sar'" "ئ")
+("satv" [""])
+("saub" [""])
+("saui" ["ʩ"])
+("sauv" ["ˮ"])
+("sbbu" ["Ѳ"])
+("sbe'" "޴")
+("sbgw" ["ѹ"])
+("sbia" ["Ѳ"])
+("sbji" ["Ѽ"])
+("sbko" [""])
+("sblm" ["㲻ʲô"])
+("sblo" [""])
+("sbnu" ["˹ŵɯ"])
+("sbp'" ["ƪ"])
+("sbq'" ["" "" "" "" "" "" "" "" ""])
+("sbqq" [""])
+("sbr'" "")
+("sbs'" ["˹"])
+("sbso" [""])
+("sbt'" ["ı"])
+("sbx'" ["ı"])
+("sbxp" ["Ѱ"])
+("sbxu" ["زʶ"])
+("scs'" ["ɣ˿"])
+("scsd" ["ĵ"])
+("sd'" ["ٶ"])
+("sdgm" ["˹¸Ħ"])
+("sdjz" ["Ĵ"])
+("sdl'" ["˹"])
+("sdp'" ["ն"])
+("sdu'" ["ʽ" "˰"])
+("sdum" ["ʲô"])
+("secl" ["ɫ"])
+("sedc" ["ɫ"])
+("sedh" ["ɫ"])
+("sedu" ["ɫ"])
+("segd" ["ɫ"])
+("seia" ["ɫ"])
+("selc" ["ɫ"])
+("semh" ["ɫä"])
+("sepu" ["ɫ"])
+("seqy" ["ɫ"])
+("ser'" "ɪɫɬ")
+("sesj" ["ɫɢ"])
+("seso" ["ɪ"])
+("sesu" ["ɫ"])
+("sewd" ["߶"])
+("sewy" ["ά"])
+("sexd" ["ɫ"])
+("seze" ["ɫ"])
+("sezl" ["Ȳ"])
+("sfb'" ["˾"])
+("sfdl" ["˾"])
+("sfln" ["ɭ"])
+("sfq'" ["ɭ" "˾Ȩ"])
+("sfvd" ["˾ƶ"])
+("sfwc" [""])
+("sfwl" ["ķ"])
+("sfy'" [""])
+("sfyf" ["ķ"])
+("sfyj" ["ɭ"])
+("sfyy" ["㷨"])
+("sgl'" ["ո"])
+("sglq" ["ɮ"])
+("sglv" ["ɮ"])
+("sgni" ["ɮ"])
+("sgq'" "ɮ")
+("sgrf" ["ɮ"])
+("sgv'" ["־"])
+("sgwi" ["峣"])
+("sgxh" ["ĸִ"])
+("sgyy" [""])
+("shcj" ["ɣ"])
+("shdj" ["ɥ"])
+("she'" "ɤ")
+("shfu" ["ɥ"])
+("shj'" ["ɻ"])
+("shmf" ["ɤ"])
+("shmy" ["ɥ"])
+("shpi" ["⳥"])
+("shq'" "ɣɥ")
+("shqi" ["ɥ"])
+("shr'" "ɥ")
+("sht'" ["ͬ"])
+("shtm" ["ɣ"])
+("shui" ["ɥʧ" "ɥ"])
+("shuu" ["ɣ"])
+("shvs" ["ɥ"])
+("shx'" [""])
+("shye" ["ɣҶ"])
+("shyn" ["ɤ"])
+("shyr" ["ɣ԰"])
+("shz'" ["λ"])
+("shzi" ["ɤ"])
+("sibj" [""])
+("sibm" ["ı"])
+("sibu" ["" "Ĳ"])
+("sic'" ["Ĵ"])
+("sich" ["˽"])
+("sici" ["Ĵ"])
+("sicp" ["˼"])
+("sida" ["Ĵ"])
+("side" [""])
+("sidh" [""])
+("sidi" ["" ""])
+("sidm" [""])
+("sidr" ["Ķ"])
+("sie'" "")
+("sien" ["˼"])
+("sif'" ["ﴫ"])
+("sifa" ["˽" "˾"])
+("sifh" ["˽" "ķ"])
+("sifu" ["ŷ"])
+("sigd" ["˿"])
+("sige" ["ĸ"])
+("sigl" ["˼"])
+("sigo" ["Ĺ"])
+("sigs" ["˼"])
+("sigu" ["Ĺ"])
+("sigw" ["˿"])
+("sihb" ["" "ú"])
+("sihh" [""])
+("sihk" ["˿"])
+("sihl" ["ĺ"])
+("siho" ["˽" ""])
+("sihu" ["ƺ"])
+("sihv" ["˺"])
+("sihw" ["Ļ"])
+("siib" ["˿"])
+("siie" ["˺"])
+("siij" ["˽"])
+("siik" ["˼"])
+("siir" ["Ĵ"])
+("siiu" ["Ĵ"])
+("sij'" [""])
+("sijc" ["˿" "" "Ľ"])
+("siji" ["˾" "ļ" "Ż"])
+("siju" ["˾"])
+("sijw" ["˽"])
+("sikb" ["˾"])
+("sikk" ["˼"])
+("sil'" ["" "ɡ" "ᴦ"])
+("silc" [""])
+("sild" ["˼"])
+("sili" ["˽" ""])
+("silm" ["˼"])
+("siln" [""])
+("sils" ["˹¡"])
+("silu" ["˼·" "·"])
+("silv" ["˼"])
+("silx" ["˺"])
+("sily" ["˾"])
+("silz" [""])
+("sima" ["˾"])
+("simc" [""])
+("simi" ["˿"])
+("simm" ["˿" ""])
+("simy" [""])
+("simz" [""])
+("sinj" [""])
+("sinm" ["˼"])
+("sipd" ["Ĵ"])
+("siph" [""])
+("sipo" ["˺"])
+("sipy" ["ƽ"])
+("siq'" "˹˺˻˼˽˾˿")
+("siqi" [""])
+("siqq" [""])
+("siqu" ["ȥ"])
+("sir'" ["ʳ" "" "" "" "" "" "" "" "" "ٹ" "" "" "" "" "" "" "" "" "Ĵ"])
+("sirf" ["˽"])
+("sirs" ["˿"])
+("sisi" [""])
+("sisj" ["ɢ"])
+("siso" ["˼"])
+("sisu" ["˿"])
+("sit'" ["" "ﴫͥ"])
+("sitj" ["˹̹"])
+("sito" ["˹"])
+("sits" ["˹ͨ" "˽ͨ" "ͨ"])
+("situ" ["˾ͽ"])
+("siu'" ["Ĵʡ"])
+("siub" [""])
+("siug" ["˽" ""])
+("siuh" ["˽" ""])
+("siui" ["˽" "ʬ" "ʮ" "ʱ"])
+("siuu" ["˽" "˿" ""])
+("siv'" [""])
+("sivb" [""])
+("sivd" ["˿״"])
+("sivf" [""])
+("sivh" ["˾"])
+("sivi" ["˿֯" "֫" ""])
+("sivj" ["ս"])
+("sivl" ["˿֮·"])
+("sivs" [""])
+("siwf" ["˹"])
+("siwh" ["˿" ""])
+("siwl" [""])
+("siwu" ["˾"])
+("siwz" ["˼ά" "Χ"])
+("sixd" ["˼" "" ""])
+("sixm" ["˿" "˿"])
+("sixn" ["˽" "˽" ""])
+("sixt" ["˽ѧ"])
+("sixu" ["˼"])
+("sixw" ["˽"])
+("sixy" [""])
+("siya" ["˻"])
+("siyb" ["˽"])
+("siyh" [""])
+("siyi" [""])
+("siyr" ["Ժ"])
+("siyt" [""])
+("siyy" ["˽Ӫ"])
+("size" [""])
+("sizi" ["˽"])
+("sizv" [""])
+("sjb'" ["ǰ"])
+("sjbe" ["ɣͶ"])
+("sjbk" [""])
+("sjbo" ["ɢ"])
+("sjbu" ["ɢ" "ɢ"])
+("sjby" ["ɡ"])
+("sjci" [""])
+("sjcj" [""])
+("sjcl" [""])
+("sjda" [""])
+("sjdl" [""])
+("sjdy" [""])
+("sje'" "ɡɢ")
+("sjfa" ["" "ɢ"])
+("sjfh" [""])
+("sjfi" ["Ƿ"])
+("sjfu" [""])
+("sjfy" ["۷Ӧ"])
+("sjfz" [""])
+("sjg'" ["" "ļ"])
+("sjgd" ["ɢ"])
+("sjge" [""])
+("sjgg" [""])
+("sjgo" [""])
+("sjgr" [""])
+("sjgs" [""])
+("sjh'" [""])
+("sjhe" [""])
+("sjhh" [""])
+("sjhk" [""])
+("sjhl" [""])
+("sjhr" [""])
+("sjhu" ["" "Ǻ"])
+("sjhv" ["ɢ"])
+("sjih" ["ɢ"])
+("sjii" [""])
+("sjj'" ["ż"])
+("sjjc" [""])
+("sjji" [""])
+("sjjp" [""])
+("sjjq" [""])
+("sjju" ["ɢ"])
+("sjjx" [""])
+("sjkl" ["ɢ"])
+("sjld" [""])
+("sjlg" [""])
+("sjli" [""])
+("sjlk" [""])
+("sjlo" ["ɢ"])
+("sjlr" ["ɢ"])
+("sjmf" [""])
+("sjmj" ["ɢ"])
+("sjml" [""])
+("sjnm" [""])
+("sjpd" ["Ƥ"])
+("sjpn" ["Ʒ"])
+("sjq'" ["" "" "" "ȥ"])
+("sjqi" [""])
+("sjqq" [""])
+("sjr'" ["ɢ" "ν"])
+("sjri" [""])
+("sjth" [""])
+("sjtl" ["̨"])
+("sjts" ["ͨ" "ͬ" "ͳ"])
+("sjue" ["ɢ"])
+("sjug" [""])
+("sjui" ["ʦ" "ʮ" "ʱ" "" "ɢʧ"])
+("sjuv" ["ˮ"])
+("sjv'" [""])
+("sjvd" ["ɢװ"])
+("sjvg" [""])
+("sjvh" [""])
+("sjwf" ["ɢ"])
+("sjwu" [""])
+("sjx'" ["" "ѧ"])
+("sjxd" [""])
+("sjxm" [""])
+("sjxn" ["ɢ"])
+("sjxw" ["Ͽ"])
+("sjxy" [""])
+("sjy'" ["ɽ"])
+("sjyb" ["Ӧ"])
+("sjyh" [""])
+("sjyr" ["Ԫ" "ԭ"])
+("sjyt" [""])
+("sjzl" [""])
+("skdh" ["ɨ"])
+("skdi" ["ɨ"])
+("skds" ["ɧ"])
+("ske'" "ɨɩ")
+("skgo" ["ɨ"])
+("skiu" ["ɨ"])
+("sklr" ["ɧ"])
+("sklz" ["ɨ"])
+("skmc" ["ɨ"])
+("skmh" ["ɨä"])
+("skpy" ["ɨƽ"])
+("skq'" "ɦɧ")
+("skr'" "ɨܣ")
+("skrk" ["ɧ"])
+("sksi" ["˿"])
+("sksk" ["ɩɩ"])
+("skue" ["ɨ"])
+("skui" ["ɨ"])
+("skvb" ["ɨ"])
+("skwz" ["ɨβ"])
+("skxr" ["ɨѡ"])
+("skxy" ["ɨ"])
+("skyh" ["ɦ"])
+("skzi" ["ɩ"])
+("sl'" [""])
+("slfk" ["˹工"])
+("slgo" [""])
+("slgx" ["ɭָ"])
+("slgy" ["ɭֹҵ"])
+("slht" ["Ȼ̼"])
+("sli'" ["ֳ"])
+("slie" [""])
+("slig" [""])
+("slj'" ["⾵"])
+("slji" [""])
+("sljl" ["ɭ־"])
+("sljn" [""])
+("slla" [""])
+("sllk" ["˹"])
+("slm'" [""])
+("slma" [""])
+("slmj" [""])
+("slpk" [""])
+("slq'" "˼")
+("slr'" "")
+("sls'" ["ɢ"])
+("slsy" [""])
+("slt'" [""])
+("sltr" ["ɭ"])
+("slu'" [""])
+("sluh" [""])
+("slwl" [""])
+("slwu" [""])
+("slxm" [""])
+("sly'" ["˾Ա"])
+("slz'" [""])
+("slzi" [""])
+("slzw" [""])
+("slzy" ["ɭԴ"])
+("smbf" ["˷"])
+("smhq" [""])
+("smi'" ["ë"])
+("smig" [""])
+("sml'" ["" ""])
+("smt'" [""])
+("smvy" [""])
+("smx'" ["Ͽ"])
+("snje" ["ڼӶ"])
+("sobu" [""])
+("sode" [""])
+("sodk" [""])
+("sodr" [""])
+("soe'" "")
+("sogu" [""])
+("sohe" [""])
+("soii" [""])
+("soji" ["Ȼ"])
+("sojm" ["" ""])
+("soju" [""])
+("soks" [""])
+("solm" [""])
+("sona" [""])
+("sopz" [""])
+("soq'" "ɯ")
+("soqu" ["ȡ"])
+("sosr" [""])
+("sosv" [""])
+("soug" [""])
+("soui" ["ʹ" "" "ʾ"])
+("souo" ["˵"])
+("souu" [""])
+("souv" ["ˮ"])
+("sovh" [""])
+("sovi" [""])
+("sovj" ["ռ"])
+("sowf" [""])
+("sowz" ["ν"])
+("soxc" ["С"])
+("soxu" [""])
+("soxx" ["д"])
+("soxy" [""])
+("soyb" ["" ""])
+("soyi" [""])
+("soyn" ["ӡ" ""])
+("soyu" [""])
+("soyy" ["Ӱ"])
+("sozi" [""])
+("sozl" [""])
+("sozo" [""])
+("spbn" [""])
+("spe'" "")
+("sphk" [""])
+("sphl" [""])
+("sphy" [""])
+("spls" ["·˹"])
+("spnv" ["Ů"])
+("spq'" "ݥ")
+("spqr" ["Ȩ"])
+("spuh" [""])
+("spui" ["ʧ"])
+("spvu" [""])
+("spwf" [""])
+("spwu" ["" ""])
+("spyi" [""])
+("spzi" [""])
+("sqfl" ["Ȩ"])
+("sqt'" [""])
+("sr'" ["Ȼ"])
+("srb'" ["˰"])
+("srbl" [""])
+("srde" [""])
+("srdu" [""])
+("srfa" ["㷨"])
+("srgf" [""])
+("srgj" [""])
+("srhw" ["ữ"])
+("sri'" ["ܲ"])
+("sriu" [""])
+("srji" ["" ""])
+("srla" [""])
+("srlc" [""])
+("srlj" [""])
+("srmc" [""])
+("srmy" [""])
+("srni" [""])
+("srpj" [""])
+("srq'" ["" "" "ɢ"])
+("srr'" "")
+("srts" ["ʹ"])
+("srui" ["ʽ" ""])
+("sruu" ["" ""])
+("srvh" [""])
+("srxi" ["ϴ"])
+("srxt" ["ѧ"])
+("srxy" [""])
+("ssbb" [""])
+("ssbl" ["ɰ"])
+("ssbx" ["ͱ"])
+("ssdl" ["δ"])
+("ssds" ["ɶ"])
+("ssdu" ["ж"])
+("sse'" "")
+("ssf'" ["Ϸ"])
+("ssfa" ["Ϸ"])
+("ssfg" ["ͷ"])
+("ssge" ["̸"])
+("ssgz" ["͸"])
+("ssho" ["ͻ"])
+("sshr" ["ͻ"])
+("ssii" ["ɳ"])
+("ssik" ["γ"])
+("ssiu" ["ͳ"])
+("ssjc" ["ͽ"])
+("ssjd" ["ɽ"])
+("ssjn" ["ɽ" "ɾ"])
+("ssjy" [";"])
+("sske" ["ɿ" "Ϳ"])
+("sskl" ["ɿ"])
+("ssky" ["ɿ"])
+("ssli" ["" ""])
+("ssll" ["" ""])
+("ssln" [""])
+("ssmu" ["ľ"])
+("ssq'" "ڡݿ")
+("ssqy" [""])
+("ssr'" "")
+("ssrr" [""])
+("ssru" ["" ""])
+("sssi" [""])
+("sssj" ["ɢ"])
+("ssti" [""])
+("sstk" [""])
+("sstu" [""])
+("ssub" [""])
+("ssui" ["ʷ"])
+("ssuj" ["ɽ"])
+("ssuu" ["" "" ""])
+("ssxd" [""])
+("ssxm" [""])
+("ssxn" [""])
+("ssxt" ["ѧ"])
+("ssxw" [""])
+("ssxx" ["и"])
+("ssxy" [""])
+("ssyh" [""])
+("ssys" [""])
+("sszh" [""])
+("stbd" ["ͨ˴"])
+("ste'" ["˹ض"])
+("stf'" ["ͨ" "˹̹"])
+("stgs" ["ͨ˾"])
+("stjt" ["ͨ"])
+("stl'" ["˹"])
+("stz'" ["̫"])
+("su'" ["ʾ"])
+("subi" ["ٱ"])
+("sucl" ["ز" "ز"])
+("sucv" ["ִ"])
+("suda" ["մ"])
+("sudj" ["յ"])
+("sudu" ["ٶ"])
+("sue'" [""])
+("suee" ["ն"])
+("suef" ["Ƕ"])
+("sufh" ["շ" ""])
+("sufj" ["෴"])
+("suhw" ["׻"])
+("suig" ["ٳ"])
+("sujc" ["ܽ"])
+("suji" ["ټ"])
+("sujp" ["վ" "վ"])
+("sujy" ["ྲ"])
+("suku" ["߿"])
+("sulc" [""])
+("sull" [""])
+("sulm" [""])
+("sulv" [""])
+("sumc" [""])
+("sumi" [""])
+("sumu" ["ľ" ""])
+("sumy" [""])
+("sunh" [""])
+("suq'" "")
+("suqu" [""])
+("suqy" [""])
+("sur'" "")
+("surj" ["Ȼ"])
+("susd" ["ʱ"])
+("suss" [""])
+("sut'" [""])
+("suth" [""])
+("sutk" [""])
+("sutx" [""])
+("suue" [""])
+("suuo" ["˵"])
+("suuu" [""])
+("suvb" [""])
+("suvd" ["״"])
+("suvi" [""])
+("suvu" [""])
+("suw'" "")
+("suwr" [""])
+("suwz" [""])
+("suxc" ["Ч"])
+("suxd" ["" ""])
+("suxx" ["д"])
+("suxy" ["" ""])
+("suy'" ["ʽ"])
+("suyb" [""])
+("suyh" [""])
+("suyr" ["Ը"])
+("suyu" [""])
+("suyy" ["Ӫ"])
+("suzk" [""])
+("suzu" [""])
+("sv'" [""])
+("svb'" [""])
+("svbi" [""])
+("svbm" [""])
+("svcs" [""])
+("svdi" [""])
+("svdk" [""])
+("sve'" "")
+("svfg" [""])
+("svfz" [""])
+("svhb" [""])
+("svi'" ["˿֯"])
+("svik" ["峯"])
+("sviu" ["洦" ""])
+("svji" ["" "漴"])
+("svkb" [""])
+("svky" [""])
+("svlc" [""])
+("svlx" [""])
+("svp'" ["˿֯Ʒ"])
+("svpm" ["Ƭ"])
+("svq'" "ݴ")
+("svr'" "")
+("svrj" ["Ȼ"])
+("svru" [""])
+("svth" [""])
+("svts" ["ͬ"])
+("svu'" ["ɽ"])
+("svub" [""])
+("svuf" [""])
+("svui" ["ʱ" "ʯ" "ʯ"])
+("svuo" ["˵"])
+("svuu" ["" ""])
+("svv'" ["" "־"])
+("svve" [""])
+("svvi" ["֮"])
+("svw'" "")
+("svxy" [""])
+("svyb" [""])
+("svyi" [""])
+("svyr" ["Ա" "Զ"])
+("svyt" [""])
+("svze" [""])
+("svzi" [""])
+("sw'" ["ν"])
+("swa'" ["ά"])
+("swd'" ["ĵ"])
+("swjd" ["޼ɵ"])
+("swk'" [""])
+("swl'" [""])
+("swyd" ["˶"])
+("sx'" ["˼"])
+("sxbx" ["Ա"])
+("sxcl" ["Բ"])
+("sxff" ["˼뷽"])
+("sxfx" ["ŷ"])
+("sxgq" ["˼"])
+("sxj'" ["˼"])
+("sxnr" ["˼"])
+("sxpm" [""])
+("sxsy" [""])
+("sxtx" ["˼ϵ"])
+("sxu'" ["ʽ" "˼"])
+("sxvb" ["˼׼"])
+("sxvx" ["˼ս"])
+("sxwd" ["޵"])
+("sxwy" [""])
+("sxx'" ["˼" "Ч"])
+("sy'" [""])
+("syb'" ["°"])
+("sybv" ["׼"])
+("syd'" ["쾵"])
+("syl'" ["Ԫ"])
+("syly" [""])
+("syq'" ["Ҷ" "Ȩ"])
+("syr'" ["Ȼ"])
+("syu'" ["ʿ"])
+("syuh" ["ʿ˺"])
+("syv'" ["˽" ""])
+("szdu" ["ɽ"])
+("szgb" ["޸ɲ"])
+("szsw" ["Ϊ"])
+("szys" [""])
+("t" "")
+("tabj" ["̤"])
+("tabu" ["̤"])
+("tabz" ["" "" ""])
+("tade" ["" "" ""])
+("tady" [""])
+("tae'" "̡")
+("tafh" [""])
+("tago" [""])
+("tajm" [""])
+("takj" ["̤"])
+("talw" ["" ""])
+("tam'" ["찲"])
+("tamf" ["" "" ""])
+("tans" ["ٯ"])
+("taq'" "̤")
+("tar'" "̢̣̤")
+("tarf" [""])
+("tari" [""])
+("taso" ["" ""])
+("tata" ["̤̤"])
+("taua" ["ɱ"])
+("taui" ["" "" "" "̤ʵ"])
+("tauo" ["˵" "˵"])
+("tawz" ["Ϊ" "Ϊ" "Ϊ"])
+("taxd" ["" "" ""])
+("taxm" [""])
+("tayb" ["" "" ""])
+("tayi" [""])
+("tazl" ["" "" ""])
+("tb'" ["ر"])
+("tbbc" ["Ͷ"])
+("tbbf" ["Ͷ"])
+("tbbj" ["ͷ"])
+("tbbk" ["Ͷ"])
+("tbbu" ["ͷ"])
+("tbcp" ["ͷ"])
+("tbd'" ["̸"])
+("tbdg" ["ͷ"])
+("tbdi" ["Ͷ" "Ͷ"])
+("tbdj" ["ͬ綯" "Ͷ"])
+("tbdu" ["͵"])
+("tbdy" ["ͷ" "͸"])
+("tbe'" "")
+("tbf'" ["ر"])
+("tbfa" ["ͷ"])
+("tbfg" ["͸"])
+("tbfh" ["Ͷ"])
+("tbg'" ["ذϹ"])
+("tbgd" ["͸"])
+("tbgk" ["Ͷ"])
+("tbgo" ["͸"])
+("tbgu" ["ͷ"])
+("tbhk" ["ͷ"])
+("tbhr" ["͵"])
+("tbi'" ["ڲ"])
+("tbia" ["ͷ"])
+("tbie" ["͸"])
+("tbig" ["Ͷ"])
+("tbij" ["Ͷ"])
+("tbjc" ["ͷ"])
+("tbji" ["Ͷ"])
+("tbjn" ["ͷ"])
+("tbjy" ["ͷ" "͸"])
+("tbkj" ["͵"])
+("tbkk" ["Ͷ" "Ͷ"])
+("tbld" ["͸"])
+("tbli" ["ͷ"])
+("tblj" ["" "͵" "Ͷ"])
+("tblu" ["ͷ­" "͸¶"])
+("tbmu" ["ͷĿ"])
+("tbmy" ["͸"])
+("tbnk" ["ͷ"])
+("tbnm" ["ͷ"])
+("tbpc" ["ͶƱ"])
+("tbpi" ["ͷƤ"])
+("tbpy" ["͸ƽ"])
+("tbq'" "͵")
+("tbqi" ["͸"])
+("tbr'" "͸")
+("tbru" ["Ͷ"])
+("tbso" ["Ͷ"])
+("tbt'" ["ذ"])
+("tbtb" ["͵͵"])
+("tbtc" ["ͷ"])
+("tbtg" ["ͷ"])
+("tbtk" ["ͷ"])
+("tbtm" ["ͷ"])
+("tbts" ["ͷʹ"])
+("tbty" ["͵"])
+("tbu'" ["ر" "ذ" "̨"])
+("tbue" ["Ͷ" "͸"])
+("tbuf" ["Ͷ"])
+("tbuh" ["ͷ"])
+("tbui" ["͸"])
+("tbuv" ["͵˰" "͸ˮ"])
+("tbvi" ["Ͷ" "͸֧"])
+("tbw'" "Ͷͷ")
+("tbwj" ["߽"])
+("tbxd" ["Ͷ" "ͷ"])
+("tbxi" ["͵Ϯ"])
+("tbxm" ["ͷ"])
+("tbxn" ["͸"])
+("tbxu" ["ͷ"])
+("tbyh" ["ͷ"])
+("tbyk" ["Ͷҩ"])
+("tbyp" ["ͷ"])
+("tbyy" ["ͶӰ"])
+("tbzi" ["Ͷ" "ͷ"])
+("tcan" [""])
+("tcbj" [""])
+("tcbo" ["" ""])
+("tcds" ["" ""])
+("tce'" "")
+("tcfu" ["" ""])
+("tcgg" [""])
+("tcgh" [""])
+("tcgj" [""])
+("tcgk" [""])
+("tche" [""])
+("tci'" ["Ʋų"])
+("tcif" [""])
+("tciu" [""])
+("tcji" [""])
+("tcjm" [""])
+("tcjx" ["" ""])
+("tckr" [""])
+("tcks" [""])
+("tcl'" [""])
+("tclc" [""])
+("tcli" ["" ""])
+("tcma" [""])
+("tcmu" ["Ŀ"])
+("tcpi" ["Ƥ"])
+("tcpn" ["Ƶ"])
+("tcpz" [""])
+("tcq'" "٬")
+("tcqi" ["" ""])
+("tcr'" "")
+("tcse" ["ɫ"])
+("tcsj" ["ɡ"])
+("tcso" [""])
+("tcti" [""])
+("tctl" ["̨"])
+("tcty" ["ͣ"])
+("tcug" [""])
+("tcui" [""])
+("tcuv" ["ˮ"])
+("tcvg" [""])
+("tcvi" ["" "֧"])
+("tcvj" ["ս"])
+("tcw'" "")
+("tcwf" ["" ""])
+("tcwh" [""])
+("tcwu" [""])
+("tcwz" ["ζ"])
+("tcx'" [""])
+("tcxd" [""])
+("tcxi" ["Ϸ"])
+("tcxn" [""])
+("tcxr" ["ѡ"])
+("tcxx" ["г"])
+("tcxy" [""])
+("tcyp" [""])
+("tcyr" ["Զ"])
+("tcyt" ["Լ" "Ծ"])
+("tczi" ["" ""])
+("tczk" [""])
+("td'" [""])
+("tdb'" ["" ""])
+("tdbx" ["͹"])
+("tdgd" ["ظĸ˶"])
+("tdgg" ["ظĸ"])
+("tdgh" ["عл"])
+("tdgm" ["ظ"])
+("tdh'" ["ػ"])
+("tdu'" ["˰"])
+("tdv'" ["֤"])
+("tdwy" ["̰"])
+("tdx'" [""])
+("tdxl" ["ͬѧ"])
+("tebx" ["ر"])
+("teci" ["ش"])
+("teda" ["ش"])
+("tedg" ["ص"])
+("tedi" ["ص"])
+("tedm" ["ص"])
+("tedy" ["ض"])
+("tegs" ["ع"])
+("tehz" ["غ"])
+("teih" ["س"])
+("teij" ["ز"])
+("teji" ["ؼ" "ؼ"])
+("teli" ["" ""])
+("tepl" [""])
+("teq'" [""])
+("teqr" ["Ȩ"])
+("tequ" [""])
+("ter'" "߯")
+("tes'" ["ж"])
+("tese" ["ɫ"])
+("test" ["ж˹̩"])
+("teue" ["" ""])
+("teui" ["ʹ"])
+("teuu" [""])
+("tevg" [""])
+("tevi" ["" ""])
+("tevs" [""])
+("tewu" [""])
+("tewz" ["Ϊ"])
+("texc" ["Ч"])
+("texu" [""])
+("texx" ["д"])
+("texy" [""])
+("teyb" [""])
+("teyi" ["" ""])
+("teyk" [""])
+("teyt" ["Լ"])
+("tfj'" ["ͨ"])
+("tfmj" ["ͻͽ"])
+("tfui" [""])
+("tfw'" [""])
+("tg'" ["ͨ"])
+("tgai" ["۰"])
+("tge'" ["̩"])
+("tgf'" ["͸ⷥ"])
+("tggk" ["ͬʹ"])
+("tgjl" ["͵"])
+("tgjt" ["߾"])
+("tgks" ["ڿ"])
+("tgkw" ["칤"])
+("tgqy" [""])
+("tgtg" [""])
+("tgti" ["ͬͬ"])
+("tgts" ["ʹ"])
+("tgtx" ["ͳͳ"])
+("tgw'" "")
+("tgxx" ["д"])
+("tgyi" [""])
+("tgyt" ["Խ"])
+("thb'" ["컨"])
+("thbv" ["ɻ"])
+("thci" ["´"])
+("thcu" [""])
+("thd'" [""])
+("thdk" ["ɵ"])
+("thdl" ["ƴ"])
+("the'" "")
+("thfa" ["̷"])
+("thg'" ["ɸ" "̼"])
+("thgo" ["" "ǹ" ""])
+("thgr" [""])
+("thhd" ["û"])
+("thhj" ["ʺ"])
+("thhv" ["û"])
+("thhw" [""])
+("thi'" ["ɳ"])
+("thid" ["۴"])
+("thih" [""])
+("thik" ["Ƴ"])
+("thj'" ["Ͻ"])
+("thjd" ["ǽ" ""])
+("thjy" ["Ǿ" ""])
+("thke" ["ÿ"])
+("thks" ["ۿ"])
+("thl'" [""])
+("thlc" [""])
+("thlu" [""])
+("thlv" ["" "컨׹"])
+("thlz" [""])
+("thmi" [""])
+("thng" [""])
+("thni" [""])
+("thpv" ["ͨ"])
+("thq'" "")
+("thqi" [""])
+("thr'" "")
+("thrf" [""])
+("thrj" ["Ȼ"])
+("thro" [""])
+("thry" ["̸"])
+("thse" [""])
+("thth" [""])
+("thtr" [""])
+("thtu" ["ͻ"])
+("thuh" ["" ""])
+("thui" ["ʫ" "ʹ"])
+("thuj" ["ɽ"])
+("thuv" ["ˮ" "ˮ"])
+("thvf" [""])
+("thvs" [""])
+("thw'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "̼"])
+("thwu" [""])
+("thxw" [""])
+("thyi" ["" ""])
+("thyk" ["ҩ"])
+("thyr" ["Բ"])
+("thzi" [""])
+("thzl" [""])
+("thzy" ["ͬ"])
+("ti'" ["˳"])
+("tian" ["᰸"])
+("tiba" [""])
+("tibi" [""])
+("tibk" [""])
+("tici" [""])
+("tick" [""])
+("ticl" ["" ""])
+("tidc" [""])
+("tidj" ["ᵥ"])
+("tidk" ["ᵽ"])
+("tidl" [""])
+("tidu" ["ݶ" "ᶽ"])
+("tie'" "")
+("tifa" ["ᷨ" "巣"])
+("tifv" ["ᴿ׳"])
+("tige" [""])
+("tigh" [""])
+("tigk" [""])
+("tigs" ["ṩ"])
+("tiho" [""])
+("tihr" ["滻"])
+("tihv" [""])
+("tihw" ["Ứ"])
+("tii'" ["ͣ"])
+("tiia" [""])
+("tiig" [""])
+("tiih" ["ᳫ"])
+("tiip" ["ᴿ"])
+("tiiu" ["޳" "޳" ""])
+("tiix" ["Ƴ³"])
+("tijc" ["ύ"])
+("tijg" ["ͳ"])
+("tiji" ["ݼ" ""])
+("tijm" [""])
+("tijw" [""])
+("tiku" [""])
+("tild" [""])
+("tili" ["" ""])
+("tilm" [""])
+("timm" [""])
+("timu" ["Ŀ"])
+("timy" ["" ""])
+("tipo" [""])
+("tiq'" "")
+("tiqd" ["ǻ"])
+("tiqi" [""])
+("tiqm" ["ǰ"])
+("tiqn" [""])
+("tiqq" [""])
+("tiqu" ["ȡ"])
+("tir'" "")
+("tirf" [""])
+("titb" ["ͷ"])
+("titl" ["̬"])
+("titm" [""])
+("titx" [""])
+("tiuf" [""])
+("tiug" [""])
+("tiui" ["ʾ"])
+("tivi" ["" "" ""])
+("tivs" [""])
+("tiw'" "")
+("tiwf" ["" ""])
+("tixi" ["ϵ"])
+("tixm" [""])
+("tixu" [""])
+("tixx" ["Я"])
+("tixy" ["" "" "" ""])
+("tiye" ["Һ"])
+("tiyi" ["" ""])
+("tiyj" [""])
+("tiyk" ["Ҫ"])
+("tiyu" [""])
+("tizi" ["" "" ""])
+("tizk" [""])
+("tj'" [""])
+("tjb'" ["̿Ҳ" "ͳƱ"])
+("tjbi" ["̿"])
+("tjbl" ["̹"])
+("tjce" ["̽"])
+("tjcj" ["̼"])
+("tjdb" ["Ͷ"])
+("tjdh" ["̹"])
+("tjdk" ["̸"])
+("tjdy" ["쾭"])
+("tje'" "̹̺̻")
+("tjf'" ["ͼⷨ"])
+("tjfh" ["̽"])
+("tjfj" ["̯"])
+("tjfu" [""])
+("tjgl" [""])
+("tjhd" [""])
+("tjhe" [""])
+("tjhj" ["ּۻ"])
+("tjho" ["̿"])
+("tjhr" ["̱"])
+("tjhu" ["̻"])
+("tjhv" [""])
+("tjhw" ["̸" "̿" "꼻"])
+("tji'" ["׳"])
+("tjig" ["̸"])
+("tjih" ["̸"])
+("tjiu" [""])
+("tjj'" ["Ӽ"])
+("tjjq" ["̽"])
+("tjk'" [""])
+("tjkd" ["̽"])
+("tjke" ["̹"])
+("tjkl" ["̯"])
+("tjli" [""])
+("tjlj" ["̰"])
+("tjlp" ["̸"])
+("tjmu" ["̴ľ"])
+("tjmy" ["̽"])
+("tjp'" ["ͣƬ"])
+("tjpj" ["̸"])
+("tjpl" ["̯" "̯"])
+("tjq'" ["̮" "̯" "̰" "̱" "̲" "" "̫ȭ" "ƽ"])
+("tjqi" ["̾"])
+("tjqn" ["" "̽"])
+("tjqq" ["̽"])
+("tjr'" "̼̽̾̿")
+("tjrj" ["̹Ȼ"])
+("tjso" ["̽"])
+("tjsr" ["̼"])
+("tjsu" ["̿"])
+("tjt'" ["ͳͼ"])
+("tjta" ["̮"])
+("tjtb" ["̽ͷ"])
+("tjtc" [""])
+("tjtj" ["̸̸"])
+("tjtk" ["̽"])
+("tjtm" ["̸"])
+("tjto" ["̸"])
+("tjtu" ["̰ͼ" "̸"])
+("tjty" ["̽"])
+("tju'" [""])
+("tjuh" ["̽"])
+("tjui" ["̽"])
+("tjuw" ["̿ˢ"])
+("tjuy" ["̹"])
+("tjvb" ["̶"])
+("tjw'" "̴̵̶̷̸̳۰")
+("tjwf" ["̽"])
+("tjwh" ["̽"])
+("tjwj" ["̰"])
+("tjwu" ["̰"])
+("tjx'" ["ͳѧ"])
+("tjxd" ["̴"])
+("tjxi" ["̾Ϣ"])
+("tjxm" ["̽"])
+("tjxn" ["̸"])
+("tjxp" ["̽ѯ"])
+("tjxy" [""])
+("tjy'" ["ƼҢ"])
+("tjya" ["ѹ"])
+("tjyd" ["ﾶ˶"])
+("tjyk" ["̿Ҥ"])
+("tjyr" ["̶Ԩ" "̼Դ"])
+("tjyu" ["̰" "̵"])
+("tjzb" [""])
+("tjzh" ["̰"])
+("tjzi" ["̯" "̳" "̺"])
+("tkbi" ["ӱ"])
+("tkby" ["ӱ"])
+("tkci" ["մ"])
+("tkck" ["Ͳ"])
+("tkcr" ["Ӵ"])
+("tke'" "")
+("tkfa" ["ַ"])
+("tkff" ["ͷ"])
+("tkfj" ["ַ"])
+("tkgb" ["׹"])
+("tkgs" ["չ"])
+("tkhd" ["ӻ"])
+("tkhk" ["ֺ"])
+("tkhs" ["Һ"])
+("tkhw" ["һ"])
+("tkis" ["г"])
+("tkiu" ["ͳ"])
+("tkjd" ["ҽ"])
+("tkjm" ["׼"])
+("tkli" [""])
+("tklp" [""])
+("tklu" ["·"])
+("tkmy" [""])
+("tknj" [""])
+("tkpk" [""])
+("tkq'" "߶")
+("tkqi" ["" ""])
+("tkr'" "")
+("tkrf" [""])
+("tkse" ["ɫ" "ɫ"])
+("tktk" ["" ""])
+("tktl" ["̭"])
+("tktm" [""])
+("tkto" [""])
+("tkts" ["Ͳ"])
+("tktu" [""])
+("tkuh" [""])
+("tkuu" [""])
+("tkvs" [""])
+("tkw'" "ػ")
+("tkwh" [""])
+("tkye" ["ұ"])
+("tkyi" [""])
+("tkyj" [""])
+("tkyn" ["ӡ"])
+("tkyr" ["Դ"])
+("tkys" [""])
+("tkzb" [""])
+("tkzi" ["" ""])
+("tkzo" [""])
+("tkzv" [""])
+("tl'" [""])
+("tlan" ["̨"])
+("tlbk" ["̨" "̫"])
+("tlbl" ["̫"])
+("tlbu" ["̨"])
+("tlbz" ["̨"])
+("tlch" ["̫"])
+("tlci" ["̨"])
+("tlcj" ["Ļ"])
+("tld'" ["̮"])
+("tlda" ["̫"])
+("tldg" ["̨"])
+("tldi" ["̨" "̫"])
+("tldo" ["̫"])
+("tldr" ["̫"])
+("tldu" ["̬"])
+("tle'" "߾")
+("tler" ["̥"])
+("tlf'" ["³"])
+("tlfg" ["̨"])
+("tlfu" ["̫"])
+("tlgk" ["̧" "̫"])
+("tlgo" ["̩"])
+("tlgs" ["̫"])
+("tlgu" ["̫"])
+("tlh'" ["ۻ" "Ϻ"])
+("tlhb" ["̫"])
+("tlhe" ["̩" "̫"])
+("tlhk" ["̫"])
+("tlhu" ["̫"])
+("tlhy" ["̫"])
+("tlhz" ["ͨ"])
+("tlie" ["̨"])
+("tlih" ["̫"])
+("tlj'" ["" "" ""])
+("tlji" ["̫"])
+("tljm" ["̫"])
+("tljn" ["̫"])
+("tljp" ["̫"])
+("tlju" [""])
+("tljv" ["վ"])
+("tljw" ["̫"])
+("tljx" ["̨"])
+("tlkh" ["̫"])
+("tlks" ["̫"])
+("tlky" ["̫"])
+("tll'" ["ͬ"])
+("tlld" ["Ͷ"])
+("tlle" ["̩"])
+("tllg" ["̫"])
+("tlly" ["̩"])
+("tlmg" ["̫"])
+("tlmj" ["̫"])
+("tlnj" ["̫"])
+("tlpj" ["̥"])
+("tlpy" ["̫ƽ"])
+("tlq'" "̨̥̦")
+("tlqd" ["̫ǿ"])
+("tlqi" ["̧"])
+("tlqm" ["̨ǰ"])
+("tlqq" ["̨"])
+("tlr'" "̩̪̫̬̭")
+("tlre" ["̫"])
+("tlro" ["̫"])
+("tls'" ["˿" "˹"])
+("tltb" ["̧ͷ"])
+("tltl" ["̫̫"])
+("tlub" ["̫"])
+("tluf" ["̫"])
+("tlug" ["̥"])
+("tluh" ["̨"])
+("tlui" ["̫ʦ"])
+("tluj" ["̩ɽ" "ͣʱ"])
+("tluk" ["̫"])
+("tlv'" ["͹"])
+("tlvj" ["̨վ"])
+("tlvs" ["̨"])
+("tlw'" "̧̨̦ۢ޷")
+("tlwh" ["̨"])
+("tlwj" ["̨"])
+("tlwz" ["̫ξ"])
+("tlx'" ["ͬ"])
+("tlxc" ["̫С"])
+("tlxi" ["̩"])
+("tlxt" ["̫ѧ"])
+("tlxu" ["̫"])
+("tlye" ["̫ү"])
+("tlyh" ["̫"])
+("tlyj" ["̧"])
+("tlyr" ["̦ԭ" "̫ԭ" "̫Զ"])
+("tlzi" ["̨" "̫"])
+("tlzk" ["̫"])
+("tlzu" ["̫"])
+("tm'" [""])
+("tmb'" ["Ǳ" "Ǳ"])
+("tmbc" [""])
+("tmbg" ["ͬ˰չ"])
+("tmbj" [""])
+("tmbk" ["챣" "챦" ""])
+("tmbm" [""])
+("tmbo" ["첨"])
+("tmbu" [""])
+("tmby" [""])
+("tmci" [""])
+("tmcl" ["" ""])
+("tmd'" ["" "ǵ" "͸"])
+("tmdi" ["" "" ""])
+("tmdk" [""])
+("tmdm" [""])
+("tme'" "")
+("tmee" [""])
+("tmfh" [""])
+("tmfu" ["츳" "︳"])
+("tmg'" ["ͬ˹"])
+("tmgb" ["칵" "칷"])
+("tmgd" [""])
+("tmgg" ["﹡"])
+("tmgj" [""])
+("tmgo" [""])
+("tmgs" ["칤"])
+("tmgw" [""])
+("tmh'" ["ͬ˻"])
+("tmhb" [""])
+("tmhd" [""])
+("tmhe" [""])
+("tmhv" [""])
+("tmhw" ["컨"])
+("tmib" [""])
+("tmid" ["촰"])
+("tmie" ["쳵"])
+("tmig" [""])
+("tmih" ["쳤"])
+("tmil" ["̽"])
+("tmis" [""])
+("tmj'" ["ͬ˾"])
+("tmji" [""])
+("tmjm" [""])
+("tmjn" [""])
+("tmjw" [""])
+("tmjy" ["쾩" "쾮" "ﾶ" ""])
+("tmkl" ["쿪"])
+("tmks" ["" ""])
+("tmlc" [""])
+("tmld" ["" ""])
+("tmli" ["" ""])
+("tmlj" [""])
+("tmlp" [""])
+("tmmf" [""])
+("tmmi" [""])
+("tmmj" [""])
+("tmmu" ["Ļ" "Ķ"])
+("tmmy" ["" ""])
+("tmmz" [""])
+("tmna" [""])
+("tmpg" [""])
+("tmpy" ["ƽ" "ƽ"])
+("tmq'" "")
+("tmqc" [""])
+("tmqi" ["" "" ""])
+("tmqq" [""])
+("tmqr" ["ȫ"])
+("tmr'" "")
+("tmrf" [""])
+("tmri" [""])
+("tmrj" ["Ȼ"])
+("tmrw" ["ͷ"])
+("tms'" ["ù" "˹"])
+("tmse" ["ɫ"])
+("tmsl" [""])
+("tmtb" ["ͷ" "ͷ"])
+("tmth" [""])
+("tmti" [""])
+("tmtj" ["̳"])
+("tmtm" [""])
+("tmty" ["ͬԼ"])
+("tmu'" ["Ŀɽ" "ͬ"])
+("tmub" [""])
+("tmue" [""])
+("tmuf" [""])
+("tmug" [""])
+("tmuh" [""])
+("tmui" ["ʱ" "ʹ"])
+("tmuj" ["ɽ"])
+("tmuo" ["˵"])
+("tmup" ["˳"])
+("tmuu" ["" "" ""])
+("tmuv" ["ˮ"])
+("tmvd" ["ׯ"])
+("tmvf" [""])
+("tmvg" [""])
+("tmvi" [""])
+("tmvu" ["" "" "" ""])
+("tmw'" "")
+("tmwf" [""])
+("tmwh" [""])
+("tmwj" [""])
+("tmwz" ["ζ"])
+("tmxd" [""])
+("tmxm" ["" ""])
+("tmxs" [""])
+("tmxw" [""])
+("tmxx" ["д"])
+("tmxy" [""])
+("tmya" ["" "Ѽ"])
+("tmyb" [""])
+("tmye" ["Ұ"])
+("tmyi" ["һ" ""])
+("tmyr" ["԰"])
+("tmze" [""])
+("tmzh" [""])
+("tmzi" ["" ""])
+("tmzl" [""])
+("tmzs" [""])
+("tn'" ["ͬ"])
+("tnb'" [""])
+("tndu" ["ˮ"])
+("tns'" ["ͻ˹"])
+("toba" ["ذ"])
+("tobz" ["ձ"])
+("todc" ["ѵ"])
+("todh" ["׵"])
+("todk" ["ϵ"])
+("todl" ["ϴ"])
+("toe'" "")
+("toer" ["ж"])
+("togr" ["й"])
+("toie" ["ϳ"])
+("toij" ["Ѳ"])
+("toir" ["ϴ"])
+("toiu" ["ѳ"])
+("tojc" ["ѽ"])
+("tojw" ["м"])
+("tojx" ["ѽ"])
+("tokb" ["ѿ"])
+("toks" ["ѿ"])
+("tola" [""])
+("toli" ["" ""])
+("tolo" [""])
+("tolq" [""])
+("tolz" [""])
+("toma" ["" ""])
+("tomk" ["ë"])
+("tomo" ["ĭ"])
+("tomu" ["ģ"])
+("tonc" [""])
+("toni" [""])
+("topj" [""])
+("topk" [""])
+("topu" ["" ""])
+("toq'" "ر")
+("toqi" [""])
+("toqm" ["Ƿ"])
+("toqq" [""])
+("toqy" [""])
+("tor'" "")
+("tors" [""])
+("tose" ["ɫ"])
+("tosu" [""])
+("totj" ["̼"])
+("totk" [""])
+("totl" ["̥"])
+("toub" [""])
+("touf" [""])
+("touj" [""])
+("touv" ["ˮ"])
+("tovi" ["֬"])
+("tow'" "٢")
+("towh" [""])
+("towz" ["ά"])
+("toxc" [""])
+("toxm" [""])
+("toxx" ["Ь" "Э"])
+("toye" ["Һ"])
+("toyh" [""])
+("toyi" [""])
+("toyj" ["" ""])
+("toyp" [""])
+("toyr" ["Բ"])
+("tpbu" ["β"])
+("tpby" ["̲"])
+("tpd'" ["̫ƽ"])
+("tpe'" "")
+("tpgj" ["̫ƽ"])
+("tpj'" ["̫ƽ" "ͨ"])
+("tpji" ["ڻ"])
+("tpk'" ["ͻƿ"])
+("tpli" [""])
+("tpm'" ["̫ƽ"])
+("tpmo" ["û"])
+("tpnj" ["ͬڽ"])
+("tpq'" "")
+("tpqi" [""])
+("tpr'" "")
+("tptg" ["̫ƽ"])
+("tptm" [""])
+("tptu" [""])
+("tpui" ["ʳ" ""])
+("tpuu" [""])
+("tpw'" "")
+("tpy'" ["̫ƽ" "̰"])
+("tpzi" [""])
+("tqdl" ["ͨ"])
+("tqhw" ["̼⻯"])
+("tqq'" ["Ǧ"])
+("tqxu" [""])
+("tqxx" [""])
+("tqyb" ["Ԥ"])
+("tr'" ["ͻȻ"])
+("tre'" "")
+("trel" ["Ȼ"])
+("trf'" ["̷˷"])
+("trfl" [""])
+("trgx" ["Ȼ"])
+("tria" ["Ų"])
+("trj'" ["Ȼ"])
+("trjg" ["ṹ"])
+("trji" ["ļ"])
+("trjt" [""])
+("trju" ["ž"])
+("trjx" ["Ž"])
+("trl'" ["Ȼ"])
+("trlm" [""])
+("trlq" [""])
+("trq'" ["" "Ȼ" "Ȼ"])
+("trqi" [""])
+("trqj" ["Ȼ"])
+("trql" ["ͻ"])
+("trr'" "")
+("trry" ["Һ"])
+("trs'" ["Ȼ˿"])
+("trti" [""])
+("trtr" [""])
+("tru'" ["ˮ"])
+("trud" ["ʪ"])
+("truv" ["Ȼ֬"])
+("trvh" ["ų"])
+("trw'" "")
+("trwd" ["¶"])
+("trww" ["΢"])
+("trwz" ["ί"])
+("trxj" ["Ȼ" "ͻȻϮ"])
+("trxw" ["Ȼά"])
+("tryr" ["Ա" "Բ"])
+("tryv" ["л"])
+("trzj" ["Ȼӽ"])
+("tsan" ["ͬ"])
+("tsb'" ["ᱵ"])
+("tsbj" ["ͬ" "ͭ"])
+("tsbk" ["ͨ" "ͨ" "ͬ"])
+("tsbu" ["ͬ"])
+("tsby" ["ͨ"])
+("tsbz" ["ͬ"])
+("tsda" ["ͨ" "ʹ"])
+("tsdg" ["ͬ"])
+("tsdk" ["ͨ" "ͬ"])
+("tsdl" ["ͳ"])
+("tsdm" ["ͨ" "ͨ"])
+("tsdw" ["ͨ׶"])
+("tse'" ["" "Ͱ" "ͱ" "Ͳ" "ͳ" ""])
+("tsff" ["ͨ"])
+("tsfg" ["ͨ"])
+("tsg'" ["̼ظ" "̼"])
+("tsgb" ["ͳ"])
+("tsgj" ["ͬ"])
+("tsgk" ["ͨ"])
+("tsgo" ["ͨ" "ͨ"])
+("tsgr" ["ͭ" "Ͳ" ""])
+("tsgs" ["ͯ"])
+("tsgv" ["ͬ"])
+("tshf" ["ʹ"])
+("tshh" ["ͨ" "ͬ"])
+("tsho" ["ͨ" "ͬ"])
+("tshp" ["ͨ"])
+("tshs" ["ͨ"])
+("tshw" ["ͨ" "ͨ" "ͬ" "ͯ"])
+("tsib" ["ͳ"])
+("tsid" ["ͬ"])
+("tsie" ["ͨ"])
+("tsig" ["ͨ" "ͳ"])
+("tsih" ["ͨ" "ͨ" "ͭ"])
+("tsii" ["ʹ"])
+("tsij" ["ͬ"])
+("tsir" ["ͱ"])
+("tsiu" ["ʹ"])
+("tsj'" ["̼"])
+("tsji" ["ͨ" "ͳ"])
+("tsju" ["ͬ"])
+("tskd" ["ͭ"])
+("tske" ["ͬ"])
+("tskk" ["ͨ" "ͳ"])
+("tsks" ["ͫ"])
+("tsku" ["ʹ" "ʹ"])
+("tsky" ["ʹ"])
+("tsl'" ["˹"])
+("tslc" ["ͬ"])
+("tsld" ["ͨ"])
+("tsli" ["ͨ"])
+("tslu" ["ͨ·"])
+("tsly" ["ͨ" "ͳ"])
+("tslz" ["ͬ"])
+("tsm'" ["̼þ"])
+("tsma" ["ʹ"])
+("tsmb" ["ͬı"])
+("tsmg" ["ͬ"])
+("tsmy" ["ͨ" "ͬ"])
+("tsn'" ["̼"])
+("tsnm" ["ͬ" "ͯ"])
+("tsny" ["̹ɣ"])
+("tspj" ["ͨ"])
+("tspl" ["ͭ"])
+("tspo" ["ͱ"])
+("tsq'" ["" "ͨ" "" ""])
+("tsqa" ["̼"])
+("tsqi" ["ͨ" "ͬ" "ͬ" "ͭ"])
+("tsqm" ["ͭǮ"])
+("tsqn" ["̼"])
+("tsqx" ["ʹ"])
+("tsqy" ["ͬ"])
+("tsr'" "ͨͬʹ")
+("tsrf" ["ͨ" "ͬ" "ͬ"])
+("tsrs" ["ͨ"])
+("tssi" ["ͭ˿"])
+("tssu" ["ͨ"])
+("tssv" ["ͬ"])
+("tst'" ["̷ͬ"])
+("tstm" ["ͨ"])
+("tsts" ["ͨͨ" "ͨͬ" "ͳͳ"])
+("tsu'" ["˹"])
+("tsug" ["ͯ"])
+("tsuh" ["ͨ" "ͬ"])
+("tsui" ["ͨʷ" "ͨʽ" "ͬʱ" "ͬ" "ͬ"])
+("tsup" ["ͨ˳"])
+("tsuu" ["ͨ"])
+("tsuy" ["ͳ" "ͳ˧"])
+("tsvb" ["ͨ"])
+("tsvg" ["ͬ"])
+("tsvh" ["ͨ"])
+("tsvi" ["֪ͨ" "ͨ־" "֪ͬ" "ͬ־" "ͬ" "ͳ" "ͳ"])
+("tsvj" ["ͳս"])
+("tsw'" ["" "ͩ" "ͪ" "ͫ" "ͬ" "ͭ" "ͮ" "ͯ" "١" "" "" "" "" "" "" "˿"])
+("tswh" ["ͨ"])
+("tsxc" ["ͨ" "ͨ" "ͳ"])
+("tsxd" ["ͬ" "ͭ"])
+("tsxm" ["ͨ"])
+("tsxn" ["ͨ" "ͬ" "ͯ" "ʹ"])
+("tsxp" ["ͨѶ"])
+("tsxr" ["ͳѡ"])
+("tsxt" ["ͬѧ"])
+("tsxw" ["ͳϽ"])
+("tsxy" ["ͨ" "ͬ" "ͬ" "ͬ"])
+("tsy'" ["̼"])
+("tsya" ["ͨѺ"])
+("tsyb" ["ͨ" "ͩ"])
+("tsyd" ["ɡ˶"])
+("tsyh" ["ͬ"])
+("tsyi" ["ͨ" "ͬһ" "ͬ" "ͳһ"])
+("tsyk" ["ͯҥ"])
+("tsyr" ["ͬԴ"])
+("tsys" ["ͨ"])
+("tsyt" ["ͬ"])
+("tsze" ["ͨ"])
+("tszi" ["ͯ" "Ͳ"])
+("tszs" ["ͬ"])
+("ttbj" ["ϲ"])
+("ttc'" [""])
+("tti'" ["ز"])
+("ttj'" ["̭" ""])
+("ttk'" [""])
+("ttkk" ["ʹʹ"])
+("ttl'" [""])
+("ttmm" ["͵͵"])
+("tts'" [""])
+("tttt" [""])
+("ttud" ["ͷͷǵ"])
+("ttuu" ["̤̤ʵʵ"])
+("ttz'" ["̫"])
+("tu'" ["ͬʱ"])
+("tuan" ["ͼ"])
+("tubc" ["ͼ"])
+("tubm" ["ͻ"])
+("tubu" ["ͽ" ""])
+("tucg" [""])
+("tudb" [""])
+("tudi" ["ͽ" ""])
+("tudk" [""])
+("tudr" [""])
+("tudy" ["ͺ"])
+("tue'" "")
+("tuei" ["ͦ"])
+("tuer" ["ͼ"])
+("tuf'" ["ʯ"])
+("tufa" [""])
+("tuff" [""])
+("tufh" [""])
+("tufj" ["ެ"])
+("tufu" [""])
+("tufz" [""])
+("tug'" ["ͼ"])
+("tugl" ["Ϳ" ""])
+("tugs" ["ͽ" ""])
+("tuh'" ["⻯"])
+("tuhd" [""])
+("tuhk" [""])
+("tuhw" ["̼ˮ" "ͼ" ""])
+("tuig" [";"])
+("tuij" [""])
+("tuil" ["ƴ"])
+("tuiu" ["͹" "ͻ" "ͻ"])
+("tuji" ["ͻ"])
+("tujn" ["ͻ"])
+("tujt" ["ͻ"])
+("tujw" [""])
+("tujx" ["ͼ"])
+("tujy" ["ͼ" ";"])
+("tula" ["ͼ"])
+("tulc" ["Ϳ"])
+("tuli" ["ͼ"])
+("tulk" ["ͽ"])
+("tulp" ["͹"])
+("tulu" ["¶"])
+("tumb" ["ͼı"])
+("tumf" [""])
+("tumk" ["ë"])
+("tumo" ["ͿĨ"])
+("tumu" ["ľ"])
+("tupi" [""])
+("tupm" ["ͼƬ"])
+("tupo" ["ͻ"])
+("tuq'" ["͹" "ͺ" "ͻ" "Ǳ"])
+("tuqi" ["͹" "ͻ" "" ""])
+("tuqj" ["ʽػ"])
+("tuqu" ["ͻȥ"])
+("tur'" "ܢ")
+("turf" [""])
+("turh" [""])
+("turj" ["ͻȻ" "ͽȻ"])
+("tusi" ["˿"])
+("tusj" ["ͼ"])
+("tut'" ["͸ͼ"])
+("tutb" ["͹͸"])
+("tutg" ["ͼ"])
+("tutu" ["ͻͻ"])
+("tuua" ["ɱ"])
+("tuub" ["ͽ"])
+("tuui" ["ͼʽ"])
+("tuuo" ["ͼ˵"])
+("tuuu" ["ͼ"])
+("tuvh" ["ͼ" "ͽ"])
+("tuvi" ["ͼֽ" ""])
+("tuvs" [";"])
+("tuvu" [""])
+("tuw'" "ͼͽ;Ϳݱ")
+("tuwf" [""])
+("tuwu" ["ͻأ"])
+("tuwz" ["ͻΧ" "ͼΪ"])
+("tux'" ["" "͸ˮ"])
+("tuxd" ["ͼ" "ͼ"])
+("tuxi" ["ͻϮ"])
+("tuxu" [""])
+("tuxy" ["ͼ" "ͽ" ""])
+("tuy'" [""])
+("tuyh" ["ͼ"])
+("tuyi" ["ͼһ"])
+("tuyr" ["͹Ե"])
+("tuzi" [""])
+("tuzl" [""])
+("tuzu" [""])
+("tv'" ["֪ͨ"])
+("tvb'" ["֧"])
+("tvbm" ["ɱ"])
+("tvbq" ["ͣͲǰ"])
+("tvbu" ["Ȳ" "˲"])
+("tvby" ["˱"])
+("tvce" ["Ʋ"])
+("tvci" ["ƴ" "˴"])
+("tvd'" ["̽յ"])
+("tvdk" ["Ƶ" "Ƶ"])
+("tvdl" ["ͬ" "ƴ"])
+("tvdr" ["ƶ"])
+("tvds" ["ƶ"])
+("tve'" "")
+("tvfj" ["Ʒ"])
+("tvfz" ["Ƿ"])
+("tvgd" ["ƹ"])
+("tvge" ["˸"])
+("tvgj" ["Ƹ"])
+("tvho" ["˻" "˻"])
+("tvhr" ["˻"])
+("tvhv" ["˻"])
+("tvhw" ["ɻ" "˻"])
+("tvii" ["Ƴ" "Ƴ"])
+("tvik" ["˳"])
+("tvis" ["Ƴ"])
+("tviu" ["Ƴ" "˳"])
+("tvj'" [""])
+("tvjc" ["Ƚ"])
+("tvjd" ["˽"])
+("tvjj" ["ͳν׼"])
+("tvjm" ["Ƽ"])
+("tvjn" ["ƽ"])
+("tvjq" ["ƾ"])
+("tvju" ["ƾ"])
+("tvkl" ["ƿ"])
+("tvl'" ["ͨ"])
+("tvli" ["" ""])
+("tvlp" [""])
+("tvm'" ["ͬ־"])
+("tvmo" ["ĥ"])
+("tvpc" ["Ʊ"])
+("tvpi" ["Ƥ"])
+("tvpz" [""])
+("tvq'" ["" "߯" ""])
+("tvqc" [""])
+("tvqq" [""])
+("tvqt" ["ȴ"])
+("tvr'" "")
+("tvrh" [""])
+("tvrv" ["֮֮"])
+("tvse" ["ɫ"])
+("tvsh" ["ɥ"])
+("tvso" [""])
+("tvsr" [""])
+("tvto" ["" ""])
+("tvtu" [""])
+("tvu'" ["֪ͨ"])
+("tvub" [""])
+("tvui" [""])
+("tvv'" ["ͳ" "ͽ֦"])
+("tvvi" ["ְ"])
+("tvvs" [""])
+("tvw'" "")
+("tvwh" [""])
+("tvwj" [""])
+("tvwu" [""])
+("tvwz" ["λ"])
+("tvxc" [""])
+("tvxd" [""])
+("tvxi" ["ϯ"])
+("tvxq" [""])
+("tvxr" ["ѡ"])
+("tvxt" ["ѧ"])
+("tvxu" ["ϵ"])
+("tvxx" ["ж"])
+("tvxy" [""])
+("tvyi" [""])
+("tvzi" [""])
+("tw'" ["Ϊ"])
+("twdq" ["̰۵"])
+("twdw" ["ĵλ"])
+("twhh" ["ֻ"])
+("twj'" ["ͬλ"])
+("twjr" [""])
+("tws'" ["ͬλ"])
+("twt'" ["̨"])
+("twu'" ["̨ʡ"])
+("twub" ["̩ʿ"])
+("twuh" ["̰ܻ"])
+("twx'" ["" "ѧ"])
+("txb'" ["ϸ" "ͷز"])
+("txbj" [""])
+("txbu" [""])
+("txby" [""])
+("txda" [""])
+("txdd" ["ĵ"])
+("txdk" [""])
+("txe'" "")
+("txfj" [""])
+("txgo" [""])
+("txgr" [""])
+("txgs" [""])
+("txgv" [""])
+("txih" [""])
+("txjd" [""])
+("txjn" [""])
+("txjw" [""])
+("txkd" [""])
+("txld" [""])
+("txlm" [""])
+("txlu" ["·"])
+("txmf" [""])
+("txnq" ["ţ"])
+("txpi" ["Ƥ"])
+("txq'" "")
+("txqc" [""])
+("txqx" [""])
+("txqy" [""])
+("txr'" "")
+("txrf" [""])
+("txsi" ["˿"])
+("txt'" [""])
+("txta" [""])
+("txtd" ["ͬͬ"])
+("txtp" ["̫ƽ"])
+("txts" ["Ͱ"])
+("txu'" ["̴ɽ" "ͨѶ"])
+("txuf" [""])
+("txuu" [""])
+("txuv" ["ˮ"])
+("txv'" ["֤ͨ"])
+("txvf" ["" "ø"])
+("txvg" ["֤"])
+("txvi" [""])
+("txvy" ["Ͷ"])
+("txwx" ["ͨ"])
+("txxl" ["ͨ·" "ͬЭ"])
+("txxm" ["" ""])
+("txxn" ["" ""])
+("txxq" [""])
+("txxx" ["м"])
+("txy'" ["ͨԱ" "ͨѶԱ"])
+("txyj" [""])
+("txz'" [""])
+("ty'" ["ͳһ"])
+("tyba" ["ͦ"])
+("tybj" ["ͣ" "󲢾"])
+("tybo" ["ͣ"])
+("tycs" [""])
+("tyd'" ["ͳһ"])
+("tydh" ["ͣ"])
+("tydi" ["̫"])
+("tydk" [""])
+("tydl" [""])
+("tydm" ["ͣ"])
+("tydp" ["ͣ"])
+("tyds" ["ͨõ˾"])
+("tye'" ["ͦ" "ͧ" "" "" "" "Ҳ"])
+("tyfa" ["ͣ"])
+("tyfh" ["ͣ"])
+("tyfu" ["̫"])
+("tyg'" [""])
+("tygh" ["ͬҵ"])
+("tygs" ["ͣ"])
+("tyhb" [""])
+("tyhd" ["̫"])
+("tyho" ["ͣ"])
+("tyht" [""])
+("tyhw" [""])
+("tyi'" [""])
+("tyie" ["ͣ"])
+("tyij" ["ͣ"])
+("tyil" [""])
+("tyjc" ["ͼӴ"])
+("tyjd" ["" "͡"])
+("tyjh" ["ͳһƻ" ""])
+("tyji" ["ͣ"])
+("tyjm" [""])
+("tyjn" ["ͦ"])
+("tyjt" [""])
+("tyjw" ["Ƽ"])
+("tyke" [""])
+("tykj" ["ͣ"])
+("tykk" ["ͣ"])
+("tyl'" [""])
+("tyli" ["ͦ"])
+("tylq" ["ͣ"])
+("tym'" ["ͶӰ"])
+("tymh" ["ͦæ"])
+("tymy" [""])
+("tyn'" ["̫"])
+("typy" ["ƾ"])
+("tyq'" "͡")
+("tyqi" ["ͦ"])
+("tyqu" ["ȡ"])
+("tyr'" ["" "̫"])
+("tyrf" [""])
+("tyt'" ["" "ͳһ"])
+("tyth" [""])
+("tyts" ["Ͳ"])
+("tyty" [""])
+("tyu'" ["̫" "̫ԭ"])
+("tyuf" ["ͦ"])
+("tyui" ["ͣʳ"])
+("tyuo" ["˵"])
+("tyvb" ["͡"])
+("tyve" [""])
+("tyvf" [""])
+("tyvh" ["ͥ"])
+("tyvi" ["ְͣ" "ֹͣ" "ͣ"])
+("tyvj" ["ͣս"])
+("tyvs" [""])
+("tyvu" ["ͣס"])
+("tyvx" ["ͳһս"])
+("tyw'" "ͣͤͥ͢")
+("tywf" ["޷"])
+("tywz" ["͢ξ"])
+("tyx'" ["̫ϵ" "̫Ѩ" "ͬһ" "ͯϱ" "ͳһ" "Һ" "ͨ"])
+("tyxd" [""])
+("tyxi" ["Ϸ" "ͣϢ"])
+("tyxm" ["ͣ"])
+("tyxn" ["" "ͣн"])
+("tyxq" ["ͦ"])
+("tyxw" ["ͣ"])
+("tyxx" ["ͣЪ"])
+("tyy'" ["̫ҽԺ"])
+("tyyd" ["˶"])
+("tyye" ["ͣҵ"])
+("tyyr" ["ͥ԰" "ͥԺ"])
+("tyzi" ["ͤ"])
+("tzd'" [""])
+("tzi'" ["׳"])
+("tzq'" "߯")
+("tzrh" ["˻"])
+("u" "")
+("uaba" ["ɳ"])
+("uabk" ["ɳ"])
+("uabu" ["ɰ" "ɴ" "ɷ"])
+("uadl" ["ɳ"])
+("uady" ["ɴ"])
+("uae'" "ɵ")
+("uaee" ["ɳ"])
+("uaer" ["ɳ"])
+("uafa" ["ɳ"])
+("uago" ["ɳ"])
+("uagw" ["ɵ"])
+("uahd" ["ɳ" "ɳ"])
+("uahe" ["ɳ"])
+("uahl" ["ɱ"])
+("uaie" ["ɯ" "ɲ"])
+("uaih" ["ɳ" "ɴ"])
+("uais" ["ɱ"])
+("uajd" ["ɰ" "ɰ"])
+("uajn" ["ɴ"])
+("uajp" ["ɱ"])
+("uakg" ["ɳ"])
+("uala" ["ɳ"])
+("uali" ["ɳ"])
+("ualo" ["ɴ"])
+("ualp" ["ɰ"])
+("ualu" ["ɱ½"])
+("uamf" ["ɳ"])
+("uamo" ["ɳĮ"])
+("uaq'" "ɯɰɱɲɳɴɷɼ")
+("uaqq" ["ɳ"])
+("uaqy" ["ɱ"])
+("uar'" "ɳɶɷ")
+("uarf" ["ɱ"])
+("uasi" ["ɱ"])
+("uatb" ["ɱͷ"])
+("uath" ["ɰ"])
+("uatj" ["ɳ̲"])
+("uatm" ["ɳ"])
+("uatu" ["ɰ" "ɳ"])
+("uaua" ["ɳɳ"])
+("uauh" ["ɱ"])
+("uaui" ["ɳʯ" "ɳ"])
+("uavb" ["ɳ"])
+("uavi" ["ɰֽ"])
+("uavu" ["ɱ"])
+("uawg" ["ɯ"])
+("uaxm" ["ɴ"])
+("uaxy" ["ɰ"])
+("uaya" ["ɳ"])
+("uayj" ["ɰ" "ɰ"])
+("uayu" [""])
+("uazi" ["ɳ" "ɵ" "ɶ"])
+("ubbc" ["ֱ"])
+("ubbi" ["ֱ" "ֱ"])
+("ubbj" ["ְ"])
+("ubbm" ["ձ" "ֱ"])
+("ubby" ["ֱ" "ܲ"])
+("ubbz" ["ֱ" "ر"])
+("ubce" ["ֲ"])
+("ubch" ["ղ"])
+("ubci" ["״"])
+("ubco" ["ܴ"])
+("ubd'" ["ٲ" "᲻" "˵"])
+("ubdk" ["յ" "ܵ"])
+("ubdr" ["ֶ"])
+("ubds" ["ֶ"])
+("ubdu" ["׶"])
+("ube'" "")
+("ubf'" ["̱귨"])
+("ubfa" ["շ" "ַ" "ط" "ܷ"])
+("ubff" ["ڷ" "ܷ"])
+("ubfh" ["շ"])
+("ubfu" ["ո" "׸"])
+("ubfz" ["շ"])
+("ubg'" ["ʾ"])
+("ubgb" ["չ"])
+("ubge" ["ո"])
+("ubgj" ["ָ"])
+("ubgk" ["ָ"])
+("ubgo" ["ܹ"])
+("ubgs" ["չ" "ֹ"])
+("ubh'" ["겻" "屾"])
+("ubhb" ["غ"])
+("ubhj" ["ܺ"])
+("ubhl" ["ܺ"])
+("ubho" ["ջ" "ۻ"])
+("ubhu" ["ػ"])
+("ubhv" ["ջ" "ܻ"])
+("ubid" ["״"])
+("ubie" ["س"])
+("ubif" ["ճ"])
+("ubig" ["ճ"])
+("ubih" ["ճ" "׳" "ݳ"])
+("ubik" ["ܳ"])
+("ubjc" ["ս" "ֽ"])
+("ubjd" ["ڽ" "ܽ"])
+("ubji" ["ռ"])
+("ubjn" ["ս" "ֽ" "ֽ" "ܾ"])
+("ubjp" ["ؾ"])
+("ubjq" ["ؾ"])
+("ubjr" ["־" "־"])
+("ubju" ["վ"])
+("ubjw" ["ۼ"])
+("ubjx" ["׽" "ؽ"])
+("ubjy" ["ھ" "ܾ" "ܾ"])
+("ubkb" ["տ"])
+("ubke" ["ڿ"])
+("ubkj" ["տ"])
+("ubkk" [""])
+("ubkr" ["տ"])
+("ubku" ["ܿ"])
+("ubl'" ["ٲ" "ܲ" "ˮ"])
+("ubli" ["" ""])
+("ubll" ["Ʋ"])
+("ublm" [""])
+("ublo" [""])
+("ublp" [""])
+("ubls" ["£"])
+("ublu" ["¼"])
+("ublv" [""])
+("ublx" [""])
+("ubly" [""])
+("ublz" ["" ""])
+("ubmf" [""])
+("ubml" ["" ""])
+("ubmy" ["" ""])
+("ubnj" [""])
+("ubnk" [""])
+("ubpa" [""])
+("ubpc" ["Ʊ"])
+("ubpm" ["ƭ"])
+("ubq'" ["" "ʾ" "˵"])
+("ubqd" ["ǹ"])
+("ubqi" [""])
+("ubqq" [""])
+("ubqr" ["Ȩ"])
+("ubqu" ["ȡ"])
+("ubqy" [""])
+("ubr'" "")
+("ubrb" [""])
+("ubre" [""])
+("ubro" [""])
+("ubrs" ["" ""])
+("ubru" [""])
+("ubso" [""])
+("ubtb" ["ͷ"])
+("ubtc" [""])
+("ubti" [""])
+("ubtj" ["̯"])
+("ubtk" [""])
+("ubtl" ["̥"])
+("ubto" [""])
+("ubty" [""])
+("ubu'" ["ʱʱ" "˵"])
+("ubuf" [""])
+("ubuh" [""])
+("ubui" ["ʰ" "" ""])
+("ubuu" ["" "" "ʤ"])
+("ubuv" ["˰"])
+("ubv'" ["ⲻ֪"])
+("ubva" [""])
+("ubvb" [""])
+("ubvf" [""])
+("ubvh" ["" "" "׳"])
+("ubvi" ["֧" "ָ" ""])
+("ubvo" [""])
+("ubvs" [""])
+("ubw'" "")
+("ubwj" [""])
+("ubwz" ["β" "λ" ""])
+("ubxc" ["Ч" "С"])
+("ubxd" [""])
+("ubxi" ["ϯ"])
+("ubxm" [""])
+("ubxn" [""])
+("ubxp" ["ѵ"])
+("ubxu" [""])
+("ubxw" [""])
+("ubxx" ["д"])
+("ubxy" [""])
+("uby'" ["˲Ա"])
+("ubyh" ["" ""])
+("ubyi" ["" "" "" "" "" "" "ҽ"])
+("ubyj" ["ɼ"])
+("ubyk" ["Ҫ"])
+("ubyn" ["" "ӡ"])
+("ubyp" [""])
+("ubyr" ["Ԯ"])
+("ubyt" ["Ӳ"])
+("ubyu" [""])
+("ubze" [""])
+("ubzi" [""])
+("ubzl" [""])
+("ubzu" [""])
+("ubzv" [""])
+("uc'" ["ϴ"])
+("uch'" ["ˮʻ"])
+("ucjv" ["ϲ㽨" "澺"])
+("ud'" ["յ"])
+("udbd" ["ɽ뵺"])
+("udbk" ["˫"])
+("udbm" ["˫"])
+("udcg" ["˫"])
+("udda" ["˫"])
+("udds" ["˪"])
+("ude'" "ˬ")
+("udf'" ["ʿ" "ˮ"])
+("udfg" ["˫"])
+("udfh" ["˫"])
+("udgh" ["˫"])
+("udgr" ["˫" "˫"])
+("udhc" ["ɵڴ"])
+("udhp" [""])
+("udis" ["˫"])
+("udj'" ["ʪȼ"])
+("udjd" ["˪"])
+("udjm" ["˫"])
+("udjx" [""])
+("udkb" ["ˬ"])
+("udky" ["ˬ"])
+("udl'" ["ֵ"])
+("udlh" ["ˬ"])
+("udlq" ["˫"])
+("udly" ["ʮ"])
+("udmm" ["˫"])
+("udpn" ["˫ƴ"])
+("udq'" "˪˫")
+("udqi" ["˪"])
+("udql" ["ֵ"])
+("udqn" ["˫"])
+("uds'" ["ʪ"])
+("udt'" ["ֵͲ"])
+("udth" ["˫"])
+("udu'" ["ɽʡ"])
+("udub" ["˫"])
+("udud" ["˫˫"])
+("udug" ["˫" "˫"])
+("uduu" ["˫"])
+("udv'" ["ˮվ"])
+("udws" ["ʷ˹"])
+("udxi" ["˫ϲ"])
+("udxj" ["˳"])
+("udyg" ["ʥǸ"])
+("udz'" [""])
+("uebj" ["Ӷ"])
+("uebl" ["©"])
+("uebz" ["豸"])
+("uedc" [""])
+("uede" [""])
+("uedi" [""])
+("uedj" ["ߵ"])
+("uedm" [""])
+("uedy" ["趨"])
+("uee'" "")
+("uef'" ["ʮ"])
+("uefa" ["跨"])
+("uefh" [""])
+("uegf" [""])
+("uegu" [""])
+("uehv" [""])
+("ueig" [""])
+("ueii" ["ݳ"])
+("uejc" ["罻"])
+("ueji" ["" "漰" "" ""])
+("uejm" [""])
+("uelc" [""])
+("ueli" [""])
+("uelp" [""])
+("uelq" [""])
+("uemf" [""])
+("uemm" [""])
+("uepi" ["Ƥ"])
+("ueq'" "")
+("ueqi" [""])
+("ueqm" ["Ƿ"])
+("uequ" ["ȡ"])
+("uer'" "")
+("ueri" [""])
+("ueru" [""])
+("uess" [""])
+("uetb" ["ͷ"])
+("uetl" ["̦"])
+("uetr" [""])
+("ueub" [""])
+("ueuf" [""])
+("ueui" ["ʳ" "" "ʩ" "ʹ"])
+("uevh" ["糤"])
+("uevi" ["" "" "ʮָ"])
+("uew'" "")
+("uewh" [""])
+("uewl" [""])
+("uexd" ["" ""])
+("uexm" [""])
+("uey'" ["ʮ"])
+("ueyb" [""])
+("ueyh" [""])
+("ueyj" [""])
+("ueyr" ["Ա"])
+("ueyt" [""])
+("ueyy" ["Ӱ" "Ӱ"])
+("uezl" [""])
+("uf'" ["Ƿ"])
+("ufao" [""])
+("ufbk" ["걨"])
+("ufbm" ["" ""])
+("ufbu" [""])
+("ufcg" [""])
+("ufcl" ["" ""])
+("ufdk" ["" ""])
+("ufdr" [""])
+("ufdu" [""])
+("ufe'" "")
+("ufer" [""])
+("ufff" ["" ""])
+("uffj" [""])
+("uffm" ["ͷ"])
+("uffu" [""])
+("ufgg" [""])
+("ufgk" [""])
+("ufgu" [""])
+("ufgy" [""])
+("ufhb" ["" ""])
+("ufhe" [""])
+("ufhj" [""])
+("ufhl" [""])
+("ufho" [""])
+("ufhs" [""])
+("ufhu" [""])
+("ufhw" ["" "" ""])
+("ufia" ["" ""])
+("ufif" [""])
+("ufih" ["쳤" "" ""])
+("ufii" [""])
+("ufiu" ["" "" ""])
+("ufj'" ["ȷ"])
+("ufjp" [""])
+("ufjw" ["" ""])
+("ufjy" [""])
+("ufke" [""])
+("ufkl" ["쿪"])
+("ufko" [""])
+("ufks" [""])
+("ufl'" ["˵" "ˮ"])
+("uflb" ["©"])
+("ufld" [""])
+("ufli" [""])
+("uflq" [""])
+("uflv" [""])
+("ufly" ["" ""])
+("ufme" ["ô" "ʲô"])
+("ufmi" [""])
+("ufmy" ["" ""])
+("ufmz" [""])
+("ufnv" ["Ů"])
+("ufpi" [""])
+("ufpj" [""])
+("ufq'" ["" "" "" "" "" "" "" "" "" "ڷ" "ݷ" "" "ַ"])
+("ufqi" ["" ""])
+("ufqm" ["ǳ"])
+("ufqq" [""])
+("ufqr" ["Ȩ"])
+("ufqu" [""])
+("ufqx" [""])
+("ufqy" ["" "" ""])
+("ufr'" "")
+("ufru" ["" ""])
+("ufse" ["ɫ"])
+("ufsi" ["˼"])
+("ufso" [""])
+("ufsu" [""])
+("ufsv" [""])
+("uftb" ["͸"])
+("ufti" [""])
+("uftj" ["̼" "ַ"])
+("uftk" [""])
+("uftl" ["̬"])
+("ufts" ["ͯ"])
+("ufu'" ["շ"])
+("ufub" ["" "" "" ""])
+("ufuf" ["" ""])
+("ufug" ["ʥ"])
+("ufuh" [""])
+("ufui" ["" "ʿ" ""])
+("ufuj" ["ɽ"])
+("ufuu" [""])
+("ufuv" ["ˮ" "ˮ"])
+("ufvb" [""])
+("ufvf" [""])
+("ufvh" [""])
+("ufvi" ["ֱ" "־" ""])
+("ufvj" ["չ"])
+("ufvs" ["" ""])
+("ufw'" "ʲ")
+("ufwf" [""])
+("ufwh" [""])
+("ufxd" [""])
+("ufxm" [""])
+("ufxn" ["" ""])
+("ufxp" ["Ѷ"])
+("ufxt" ["ѧ"])
+("ufxx" ["ʦѧУ"])
+("ufye" ["ҹ"])
+("ufyh" [""])
+("ufyi" ["" "" ""])
+("ufyj" [""])
+("ufyn" [""])
+("ufyr" ["ԩ" "Ԩ" "Զ"])
+("ufyt" ["Լ" ""])
+("ufyy" ["Ӱ"])
+("ufzh" [""])
+("ufzi" ["" ""])
+("ufzk" [""])
+("ug'" ["Ǹ"])
+("uga'" ["ʩ" "ʳܰ"])
+("ugbl" ["ʤ"])
+("ugbm" [""])
+("ugbo" [""])
+("ugbu" [""])
+("ugby" [""])
+("ugci" ["ʣ"])
+("ugcl" ["" ""])
+("ugcp" [""])
+("ugd'" ["Ϲ"])
+("ugda" ["ʢ"])
+("ugdc" [""])
+("ugde" ["ʡ"])
+("ugdi" ["" "ʤ" "ʥ"])
+("ugdj" ["ʥ"])
+("ugdk" [""])
+("ugdl" [""])
+("ugdm" ["ʢ"])
+("ugds" [""])
+("uge'" "ʡ")
+("uger" [""])
+("ugfa" [""])
+("ugff" ["" "ʡ"])
+("ugfu" ["ʤ"])
+("uggf" [""])
+("uggk" [""])
+("uggr" [""])
+("uggs" [""])
+("ughk" [""])
+("ugho" ["" ""])
+("ughv" ["ʡ" "ʢ"])
+("ughw" ["" ""])
+("ugig" ["" "" "ʡ"])
+("ugii" [""])
+("ugij" ["" "ʢ"])
+("ugiu" [""])
+("ugj'" ["ո"])
+("ugjd" ["" ""])
+("ugji" ["" "" ""])
+("ugjq" [""])
+("ugjx" ["ʥ"])
+("ugjy" ["ʢ" "ʥ"])
+("ugkb" [""])
+("ugkd" ["ʢ"])
+("ugkl" ["ʢ"])
+("uglh" [""])
+("ugli" ["" "" "ʤ"])
+("ugll" [""])
+("uglt" ["ʡ"])
+("uglu" ["·"])
+("ugly" [""])
+("ugmn" [""])
+("ugmu" ["ĸ" "ĸ" "ʥĸ"])
+("ugmy" ["" "" "" "ʢ" "ʥ"])
+("ugn'" [""])
+("ugna" [""])
+("ugpa" [""])
+("ugpi" [""])
+("ugpn" ["Ƶ"])
+("ugpy" ["ƽ" "ƽ"])
+("ugq'" "ʤ")
+("ugqi" ["" "" ""])
+("ugqm" ["ǰ"])
+("ugqu" ["" "ʡȥ"])
+("ugqy" ["ʢ"])
+("ugr'" "ʢʣʤʥ")
+("ugrf" ["" "ʤ" "ʥ"])
+("ugri" [""])
+("ugs'" ["ٹ"])
+("ugse" ["ɫ" "ɫ"])
+("ugsi" ["˿" "" "ʤ"])
+("ugso" [""])
+("ugsu" [""])
+("ugtg" [""])
+("ugtk" [""])
+("ugtl" ["̬"])
+("ugtm" [""])
+("ugtu" [""])
+("ugtx" [""])
+("uguh" ["" "ʥ"])
+("ugui" ["" "" "ʡ" "ʢ"])
+("uguu" [""])
+("uguv" ["ˮ" "ˮ"])
+("ugvg" ["ʡ"])
+("ugvh" ["" "" "ʡ" "ʤ"])
+("ugvi" ["ֳ" "ʥּ"])
+("ugvs" ["ʡ"])
+("ugvu" [""])
+("ugw'" "")
+("ugwf" [""])
+("ugwh" [""])
+("ugwu" [""])
+("ugwz" ["" "ʡί"])
+("ugx'" ["ʯ"])
+("ugxc" ["Ч"])
+("ugxd" [""])
+("ugxi" ["Ϣ" "Ϣ"])
+("ugxm" ["" "ʥ"])
+("ugxq" [""])
+("ugxt" ["ѧ" "ѧ"])
+("ugxw" ["ʡ" "ʢ" "ʣ"])
+("ugxy" ["" "ʢ"])
+("ugy'" ["Ը" "ֹҵ"])
+("ugya" ["" "ѹ"])
+("ugyb" [""])
+("ugyi" ["" ""])
+("ugyj" [""])
+("ugyn" [""])
+("ugyp" [""])
+("ugyr" ["Ա" "Ԯ"])
+("ugyt" [""])
+("ugyu" ["" "" "" "ʢ" "ʣ" "ʤ"])
+("ugyv" ["ֹҵ"])
+("ugyy" ["Ӳ"])
+("ugzi" ["" ""])
+("ugzj" ["ʢ"])
+("uh'" [""])
+("uhan" ["ϰ"])
+("uhb'" ["ˮұ"])
+("uhba" ["˰"])
+("uhbc" ["̱"])
+("uhbg" [""])
+("uhbi" ["ϱ"])
+("uhbj" ["ϰ"])
+("uhbk" ["ϱ"])
+("uhbm" ["ϱ" "ϱ"])
+("uhbr" ["ˮ"])
+("uhbu" ["̲" "ϲ"])
+("uhbx" ["ᱣ"])
+("uhby" ["˱"])
+("uhcg" ["ϲ"])
+("uhci" ["ʹ" "ϴ"])
+("uhcj" ["˲"])
+("uhck" ["ϲ"])
+("uhcu" ["ϴ"])
+("uhcz" [""])
+("uhda" ["ϴ"])
+("uhdc" ["ϵ"])
+("uhdg" ["ϵ" "ϵ"])
+("uhdh" ["ϵ" "ϵ"])
+("uhdi" ["ϵ" "ϵ"])
+("uhdl" ["ϴ" "غ㶨"])
+("uhdm" ["̵"])
+("uhds" ["϶"])
+("uhdy" ["̶" "۹"])
+("uhe'" "")
+("uhf'" [""])
+("uhfa" ["̷" "ͷ"])
+("uhfg" ["˷" "Ϸ" "ֹ"])
+("uhfh" ["Ϸ" "Ϸ"])
+("uhfj" ["̷"])
+("uhfu" ["ʽ"])
+("uhg'" ["ɽ"])
+("uhgd" ["Ϲ" "ṫ"])
+("uhgj" ["˸"])
+("uhgk" ["ϸ"])
+("uhgo" ["Ϲ"])
+("uhgr" ["Ϲ" "Ϲ"])
+("uhgs" ["Ϲ" "Ϲ"])
+("uhgu" ["̼" "Ϲ"])
+("uhgx" ["ϵ"])
+("uhhd" [""])
+("uhhe" [""])
+("uhhf" ["˺"])
+("uhhh" ["Ϻ"])
+("uhhj" ["˺"])
+("uhhk" ["̺" "Ϻ"])
+("uhhl" ["˺" "Ϻ"])
+("uhho" ["ϻ"])
+("uhhv" ["̻"])
+("uhid" ["ϴ"])
+("uhig" ["ϳ"])
+("uhih" ["̳" "ϳ"])
+("uhik" ["̳"])
+("uhir" ["̴"])
+("uhj'" ["ɽ"])
+("uhjc" ["Ͻ" "Ͻ"])
+("uhjd" ["Ͻ" "Ͻ"])
+("uhji" ["ϼ" "ϼ" "ϼ" ""])
+("uhjn" ["Ͻ" "Ͻ" "Ͻ"])
+("uhjp" ["̾"])
+("uhjx" ["̽" "Ͻ" "Ͻ"])
+("uhkb" ["˿" "Ͽ"])
+("uhke" ["Ͽ"])
+("uhkj" ["ռ"])
+("uhks" ["Ͽ"])
+("uhkx" ["ѧ"])
+("uhky" ["ѧԺ"])
+("uhla" [""])
+("uhlb" ["¥"])
+("uhld" [""])
+("uhll" [""])
+("uhlm" [""])
+("uhln" [""])
+("uhlo" [""])
+("uhlq" [""])
+("uhlu" ["·" "·"])
+("uhlx" [""])
+("uhlz" ["ˮ"])
+("uhma" [""])
+("uhmf" [""])
+("uhmi" [""])
+("uhmm" [""])
+("uhmy" [""])
+("uhnm" [""])
+("uhns" ["ũ"])
+("uhpi" ["Ƥ"])
+("uhpj" [""])
+("uhpn" ["Ʒ" "Ʒ"])
+("uhpu" [""])
+("uhq'" ["" "" "" "" "" "" "" ""])
+("uhqm" ["ǰ"])
+("uhqq" [""])
+("uhqt" ["ȶ"])
+("uhqu" ["ȥ"])
+("uhqx" [""])
+("uhqy" ["" ""])
+("uhr'" ["" "" "" "ʯ" "ջ"])
+("uhrf" ["" "" ""])
+("uhri" [""])
+("uhse" ["ɫ"])
+("uhsi" ["˼" "˾"])
+("uhsr" [""])
+("uhsu" ["" ""])
+("uht'" "")
+("uhtb" ["ͷ"])
+("uhti" [""])
+("uhtj" ["̸"])
+("uhtk" [""])
+("uhtl" ["̨"])
+("uhtm" [""])
+("uhtr" [""])
+("uhts" ["ʹ"])
+("uhu'" ["" "ʷ" "ʯʯ" "ʯˮ" "Ϻ"])
+("uhub" ["" ""])
+("uhuf" [""])
+("uhug" ["" ""])
+("uhuh" ["" ""])
+("uhui" ["" "ʶ" "ʯ" "" ""])
+("uhuj" ["ɽ" "ʵ" "ʵ"])
+("uhup" ["ˮƽ"])
+("uhuu" ["" "" "" ""])
+("uhuv" ["ˮ"])
+("uhv'" ["ʯ" "ʳ־"])
+("uhvb" [""])
+("uhvd" ["װ" "ƶ"])
+("uhvf" ["" ""])
+("uhvh" ["" ""])
+("uhvi" ["֫"])
+("uhvj" ["徭" "г"])
+("uhvm" [""])
+("uhvu" ["彨"])
+("uhvy" [""])
+("uhvz" [""])
+("uhw'" ["ˮ"])
+("uhwf" [""])
+("uhwh" [""])
+("uhwj" [""])
+("uhwu" ["" "" "" ""])
+("uhwz" ["ξ" "δ"])
+("uhx'" ["ѧ" ""])
+("uhxc" ["У"])
+("uhxd" [""])
+("uhxm" ["" ""])
+("uhxn" ["" ""])
+("uhxp" ["Ѯ"])
+("uhxt" ["ѧ" "̬"])
+("uhxw" [""])
+("uhxy" [""])
+("uhy'" ["ʯ" "ʯҤ" "ۻԱ"])
+("uhyb" ["" ""])
+("uhye" ["ҵ" "ҹ"])
+("uhyh" [""])
+("uhyi" ["" ""])
+("uhyj" [""])
+("uhyk" ["ҩ"])
+("uhyr" ["Ա" "ԭ"])
+("uhyt" ["Լ" "ʶ̬"])
+("uhyu" ["" "ʶ"])
+("uhyy" ["ӳ"])
+("uhz'" ["ʯ"])
+("uhzb" ["ʱ"])
+("uhzl" [""])
+("ui'" [""])
+("uian" ["ǰ"])
+("uibi" ["Ʊ"])
+("uibj" ["ʬ" "ʯ" "԰"])
+("uibk" ["ʱ"])
+("uibl" ["ʧ"])
+("uibm" ["±"])
+("uibq" ["ѹ"])
+("uibx" ["ʶ"])
+("uiby" ["ʿ"])
+("uibz" ["ʮ" "ʯ"])
+("uic'" [""])
+("uice" ["ʷ"])
+("uici" ["ʫ" "Ĵ"])
+("uico" ["ʧ"])
+("uics" ["̴"])
+("uidc" ["ʧ"])
+("uidd" [""])
+("uide" ["ʹ" "ǵ"])
+("uidh" ["" "ʧ" "ʵ"])
+("uidi" ["ʦ" "ʧ" "ʵ"])
+("uidk" ["ʳ" ""])
+("uidl" ["ʱ" ""])
+("uidm" ["ʱ" "е" "Ե"])
+("uido" ["ʰ"])
+("uidr" ["¶"])
+("uidu" ["ʪ" "ʶ"])
+("uidv" ["" "Ƕ"])
+("uie'" "ʷʸʹʺʻʼ")
+("uiee" ["ʮ"])
+("uier" ["ʮ" "ʱ" "¶"])
+("uifb" ["Ƿ"])
+("uiff" ["ʮ" "ʱ" "з" ""])
+("uifh" ["ʩ" "ʱ" "ͷ"])
+("uifj" ["ʦ" "ʾ"])
+("uifu" ["ʽ" "ʦ" "ʦ"])
+("uifz" ["ʩ" "Ƿ" "Է"])
+("uigd" ["ʱ"])
+("uige" ["ʫ" "ʮ" "Ǹ"])
+("uigf" ["ʵ"])
+("uigj" ["" "ʵ" "˫ع"])
+("uigk" ["ʯ"])
+("uigo" ["ʹ"])
+("uigr" ["ʳ" "ʷ" "ʷ" "ʹ" "ʿ" "Թ"])
+("uigs" ["ʩ"])
+("uigu" ["ʣ" "ʬ" "¹"])
+("uigx" ["ϵ"])
+("uihb" ["ʱ" "º" "̺"])
+("uihe" ["ʺ"])
+("uihh" ["Ժ"])
+("uihk" ["Ⱥ"])
+("uiho" ["ʧ" "ʳ"])
+("uihr" ["ʹ"])
+("uihu" ["" "ʯ"])
+("uihv" ["ʯ" "ʱ" "ʵ"])
+("uihw" ["ʫ" "ʵ"])
+("uiia" ["ʱ" "Ӳ"])
+("uiib" [""])
+("uiie" ["Գ"])
+("uiif" ["ʱ" "ʹ" ""])
+("uiig" ["ʮ"])
+("uiih" ["ʧ" "ʱ" "г" "ӳ"])
+("uiii" ["г"])
+("uiir" ["ʧ"])
+("uiis" ["ʯ"])
+("uiiu" ["ʹ"])
+("uij'" ["ɱ"])
+("uijc" ["н" "ӽ"])
+("uijd" ["ʬ" "ʯ" "ǽ"])
+("uijg" ["г۸"])
+("uiji" ["ʫ" "ʱ" "ʵ" "ʶ" "ʷ" "ʷ" "" "»" "¼" "м" "Լ"])
+("uijj" ["" "г"])
+("uijm" ["ʱ" "ʱ" "ʵ" "" "¼" "Լ"])
+("uijn" ["ʲ" "ʹ" "н"])
+("uijp" ["ʹ"])
+("uijq" ["ʮ"])
+("uijr" ["ʽ" "Ծ"])
+("uijt" ["Ӿ"])
+("uiju" ["ʫ" "ʱ"])
+("uijw" ["ʩ" "" "м"])
+("uijx" ["ʱ" "ʹ" "" "ӽ"])
+("uijy" ["ʡԼ" "ʧ" "ʫ" "ʯ"])
+("uikb" ["ʿ"])
+("uikd" ["ʵ"])
+("uike" ["ʯ" "ʱ" "ʳ"])
+("uikj" ["Կ"])
+("uiky" ["ʯ" "п"])
+("uil'" ["" "" "" "ˮ"])
+("uila" ["ʯ"])
+("uilc" ["ʯ" "ʷ"])
+("uild" ["ʳ" "ʳ" "ʸ" ""])
+("uile" ["ʯ"])
+("uilh" ["ʩ" ""])
+("uili" ["" "ʧ" "ʵ" "ʵ" "ʾ" "" "" "" "" "" ""])
+("uiln" ["ʿ"])
+("uilo" ["ʧ"])
+("uilp" ["ʷ"])
+("uilq" ["ʯ"])
+("uilt" ["ʷ"])
+("uily" ["ʧ" ""])
+("uilz" ["ʯ"])
+("uima" [""])
+("uimf" ["ʯ"])
+("uimi" ["ʧ"])
+("uimk" ["ʱ"])
+("uimm" ["ʧ" "ʯ" ""])
+("uimn" ["ʿ" ""])
+("uimo" ["ʯī" "ʼĩ"])
+("uimu" ["ʦĸ" "Ķ"])
+("uimy" ["ʧ" "ʹ"])
+("uind" ["ʦ"])
+("uing" [""])
+("uinl" [""])
+("uinv" ["ʹŮ" "ʿŮ" "Ů"])
+("uinz" ["" ""])
+("uip'" ["ݳƷ" "ˮƷ"])
+("uipm" ["ʫƪ"])
+("uipn" ["ʳƷ" "Ƶ"])
+("uipo" ["ʶ"])
+("uipu" ["ʳ"])
+("uiq'" "ʦʧʨʩʪʫʬʭ")
+("uiqc" ["ʯ"])
+("uiqi" ["ʪ" "ʯ" "ʱ" "ʱ" "ʹ" "ʿ"])
+("uiqm" ["ʷǰ" "ǰ"])
+("uiqr" ["ʵȨ" "Ȩ"])
+("uiqt" ["ʧȴ"])
+("uiqu" ["ʧȥ" ""])
+("uiqy" ["ʵ" ""])
+("uir'" "ʽʾʿݪ߱")
+("uire" ["ʪ"])
+("uirf" ["ʫ" "ʯ" "ʱ" "ʹ" "ʿ" ""])
+("uiri" ["ʮ" "ʱ"])
+("uiro" ["ʾ"])
+("uirp" ["ʪ"])
+("uirs" [""])
+("uiru" ["ʻ"])
+("uirv" ["ʯ"])
+("uise" ["ʧɫ"])
+("uisi" ["ʮ" ""])
+("uisj" ["ʧɢ" "ʮ"])
+("uisu" ["ʧ" "ʱ" ""])
+("uit'" "ֳ")
+("uitb" ["ʪ͸" "ʯͷ" "ͷ"])
+("uitc" ["ʧ"])
+("uith" ["ʳ" "ʳ"])
+("uiti" ["ʬ" "ʵ" "" ""])
+("uitj" ["ʯ̿" "̽" "г"])
+("uitl" ["ʯ̨" "̬" "̬"])
+("uitr" ["ʦ"])
+("uitu" ["ʦͽ" "ʹͽ" ";" "ͼ" "ͼ"])
+("uity" [""])
+("uiub" ["ʧ" "ʧ" "ʬ"])
+("uiue" ["ʩ"])
+("uiuf" ["ʬ" "ʿ"])
+("uiug" ["ʦ" "ʧ" ""])
+("uiuh" ["ʱ" "" ""])
+("uiui" ["ʧ" "ʧ" "ʫʷ" "ʯ" "ʱʱ" "ʱʳ" "ʱ" "ʱ" "ʵʩ" "ʵʱ" "ʵʵ" "ʵ" "ʷʫ" "ʷʵ" "" "ʵ" "" "ʦ" "" "ʱ"])
+("uiuj" ["ʯɽ"])
+("uiuo" ["ʦ˵"])
+("uiuu" ["ʫ" "ʵ" "ʷ"])
+("uiuv" ["ʧˮ" "ʱˮ" "˭"])
+("uivd" ["ʱװ"])
+("uive" ["ʹ" ""])
+("uivf" ["ʧ" "ʪ" "ʱ" ""])
+("uivg" ["ʩ" "ʱ" ""])
+("uivh" ["ʦ" "г"])
+("uivi" ["ʧְ" "ʧֵ" "ʱֵ" "ʳָ" "ʵ" "ֽ" ""])
+("uivj" ["ʩչ" "ʵս"])
+("uivs" ["ʧ" "ʱ" "ʱ" "ʼ" "ʾ" "" "" ""])
+("uivu" ["ʯ"])
+("uiw'" ["ʮ" "ʯ" "ʰ" "ʱ" "ʲ" "ʳ" "ʴ" "ʵ" "ʶ" "" "ݪ" "" "" "" ""])
+("uiwf" ["" ""])
+("uiwh" ["ʧ"])
+("uiwj" ["ʮ"])
+("uiwl" [""])
+("uiwo" ["ʹ"])
+("uiwu" ["ʧ" "ʮ" "ʱ" "ʳ" "ʵ" "" ""])
+("uiwz" ["ʾ" "" "ί"])
+("uix'" [""])
+("uixc" ["ʧЧ" "ʱЧ" "ʵЧ" ""])
+("uixd" ["ʵ" "ʹ" "" ""])
+("uixi" ["ʵϰ" "Ϯ" "ϵ"])
+("uixm" ["ʧ" "ʱ" "ʵ" "ʵ" "" ""])
+("uixn" ["ʧ" "ʵ"])
+("uixq" ["ʧ"])
+("uixs" ["ʦ" ""])
+("uixt" ["ʧѧ" "ʫѧ" "ʵѧ" "ʷѧ"])
+("uixw" ["ʱ"])
+("uixx" ["ʧѪ" "гϢ"])
+("uixy" ["ʩ" "ʱ" "ʱ" "ʳ" "ʵ" ""])
+("uiyb" ["ʯ" "ʳ" ""])
+("uiye" ["ʦү" "ʧҵ" "ʵҵ" "ҵ" "Ұ"])
+("uiyh" ["ʽ" ""])
+("uiyi" ["ʫ" "ʮһ" "ʰ" "ʵ" "ʹ" "ʾ" "" ""])
+("uiyj" ["ʳ" "ʵ" "" ""])
+("uiyn" ["ʯӡ"])
+("uiyp" ["ʱ"])
+("uiyr" ["ʰԪ"])
+("uiys" ["ʩ" "ʳ" "ʵ" "ʹ" "" ""])
+("uiyt" ["ʧԼ" "ʮ"])
+("uiyu" ["ʳ" "" ""])
+("uiyy" ["ʯӢ" "Ӧ"])
+("uizb" ["ʱ"])
+("uize" ["ʵ"])
+("uizi" ["ʦ" "ʨ" "ʭ" "ʮ" "ʯ" "ʶ" "ʽ" ""])
+("uizk" ["迹"])
+("uizl" ["" "ʵ"])
+("uizo" ["ʫ"])
+("uizs" ["ʧ"])
+("uizu" ["ʧ" "ʮ" "ʼ" "ʿ" "ʿ" ""])
+("uj'" ["ʱ"])
+("ujb'" ["" "񾭲" "籨"])
+("ujbf" ["Ʊ"])
+("ujbg" ["ɽ"])
+("ujbj" [""])
+("ujbk" ["ɽ"])
+("ujbm" ["ʰ"])
+("ujbu" ["սᱺ"])
+("ujbv" ["ս"])
+("ujbz" ["±"])
+("ujd'" ["˫" "˫" "ˮ"])
+("ujdi" ["ɽ"])
+("ujdm" ["" ""])
+("ujds" ["ɽ" "ɽ" "ɿ" ""])
+("ujdv" ["ս"])
+("ujdy" ["ɽ"])
+("uje'" "")
+("ujfg" ["ɽ" "ɽ"])
+("ujfh" ["ɽ"])
+("ujg'" ["" "侫"])
+("ujgb" ["ɽ"])
+("ujgd" [""])
+("ujge" ["ɽ"])
+("ujgf" ["ɽ"])
+("ujgl" ["ɾ"])
+("ujgm" ["񾭹"])
+("ujgo" [""])
+("ujgu" ["ɽ"])
+("ujgz" ["ʵʹ"])
+("ujhb" ["ƺ" ""])
+("ujhe" ["ɽ"])
+("ujho" ["ɽ" "ɿ"])
+("ujhs" ["ɽ"])
+("ujhu" ["ɺ" "ɺ"])
+("uji'" ["Ǵ"])
+("ujia" ["ɽ" "ɽ"])
+("ujib" ["ʵʳɱ"])
+("ujig" ["ɽ"])
+("ujih" ["ó"])
+("ujil" ["ݴ"])
+("ujir" ["ɽ"])
+("ujiu" ["ɾ" "ʱ䳣"])
+("ujj'" ["ɱ" "񾭽" ""])
+("ujjc" ["ɽ"])
+("ujjd" ["ƽ׶"])
+("ujji" ["" "դ"])
+("ujjq" ["ʱ̵"])
+("ujjr" ["Ἲ"])
+("ujk'" ["ݿ"])
+("ujkb" ["ɽ"])
+("ujkl" [""])
+("ujl'" ["ʵ" "ܾ"])
+("ujld" ["ɽ" "" "ƾ"])
+("ujli" ["ɽ"])
+("ujln" ["ɽ"])
+("ujlr" ["ɽ" "Ͻ"])
+("ujlu" ["ɽ´" "ɽ·"])
+("ujlx" [""])
+("ujly" ["ɽ"])
+("ujm'" ["ĩ"])
+("ujmf" ["ɽ"])
+("ujml" ["ɽ"])
+("ujnj" ["ɽ"])
+("ujpk" ["ɽ"])
+("ujpo" ["ɽ"])
+("ujq'" ["ɺ" "ɻ" "ɼ" "ɽ" "ɾ" "ɿ" "" "" "դ" "" "" "" "" "" "" "" "" "" "ʡ"])
+("ujqd" ["ɽǽ" "ɱȡ"])
+("ujqk" ["ʵ"])
+("ujqm" ["ɽǰ"])
+("ujqr" ["ɽȪ"])
+("ujqt" ["ʵ"])
+("ujqu" ["ɽ" "ɾȥ"])
+("ujr'" ["" "" "ɻ" "" "" "" "" "" "" "" "" "ڨ" "۷" "" "" "" "" "" "" "" "ռ"])
+("ujrf" ["ɽ"])
+("ujs'" [""])
+("ujt'" ["ɾ"])
+("ujtb" ["ɽͷ" "ͷ"])
+("uju'" ["ʵ" "Խʯ"])
+("ujui" ["ʳ" "г"])
+("ujuj" [""])
+("ujuo" ["˸"])
+("ujur" ["˥"])
+("ujuv" ["ɽˮ"])
+("ujv'" ["" "ʮ" "ʯׯ"])
+("ujvd" ["ɽׯ"])
+("ujvf" ["ɽ"])
+("ujvj" ["ս"])
+("ujvl" ["ɽկ"])
+("ujvm" ["ʵ֤"])
+("ujvu" [""])
+("ujwa" ["ɽ"])
+("ujwh" ["Ļ"])
+("ujwr" ["ἺΪ"])
+("ujwv" ["ʮλ"])
+("ujx'" ["ʱ"])
+("ujxb" ["ϸ"])
+("ujxd" ["ɽ"])
+("ujxi" ["ɽ" "ɽϵ" ""])
+("ujxn" [""])
+("ujxt" ["ϵͳ"])
+("ujxw" ["ά"])
+("ujxy" [""])
+("ujy'" ["ԭ" "Ժ"])
+("ujya" ["ɽ"])
+("ujyh" ["ɽ" "ɽ" "ɽ" ""])
+("ujyi" [""])
+("ujyk" ["ɽ" "ɽҩ" "ҫ"])
+("ujyl" ["ʩѹ"])
+("ujyn" ["ɽ"])
+("ujyt" ["ɽ"])
+("ujyu" ["ɽ" "" "ʢһʱ"])
+("ujzi" ["" ""])
+("ujzy" ["ɱ"])
+("ukbh" ["ڰ"])
+("ukby" ["ձ" "ڱ"])
+("ukbz" ["ձ"])
+("ukdl" ["Ӵ"])
+("uke'" "")
+("ukev" ["ʿɶֹ"])
+("ukfu" ["ٸ"])
+("ukgo" ["չ"])
+("ukgr" ["ع"])
+("ukhb" ["Ժ"])
+("ukho" ["ջ"])
+("ukhv" ["ջ"])
+("ukig" ["ճ"])
+("ukjd" ["ٽ"])
+("ukjm" ["ռ" "ټ"])
+("ukjq" ["վ" "ܾ"])
+("ukjx" ["ս"])
+("ukld" [""])
+("ukmk" ["ë"])
+("uknm" [""])
+("uknv" ["Ů"])
+("ukpy" ["ƿ"])
+("ukq'" ["" "" "" "" "" "" "" "" "ʪ"])
+("ukqy" [""])
+("ukr'" "ۿ")
+("ukso" [""])
+("uktb" ["ͷ"])
+("ukuh" [""])
+("ukui" ["ʱ"])
+("ukuj" ["ɽ"])
+("ukuk" [""])
+("ukuu" [""])
+("ukvd" ["׳"])
+("ukw'" "")
+("ukwu" [""])
+("ukwz" ["΢" "Ϊ" "ξ"])
+("ukxc" ["У"])
+("ukxd" [""])
+("ukxn" [""])
+("ukxu" ["" ""])
+("ukxy" [""])
+("ukye" ["ү"])
+("ukyh" [""])
+("ukyk" ["ҩ"])
+("ukyn" [""])
+("ukyu" [""])
+("ukyy" ["ˮ"])
+("ukzi" ["" ""])
+("ul'" ["ʤ"])
+("ulb'" ["" "ˮֱ"])
+("ulbj" ["ɸ"])
+("uld'" [""])
+("ule'" "ɫ")
+("ulfa" ["ɹ"])
+("ulfd" ["ˮ"])
+("ulff" ["ɸ" "ʮ"])
+("ulfj" ["ˮַ"])
+("ulg'" ["ѹ"])
+("ulgi" ["ˮ"])
+("ulgj" ["ɹ" "ֽ"])
+("ulgu" ["ʤʵ"])
+("ulh'" ["ɽ" "ˮ" ""])
+("ulhh" [""])
+("ulhk" ["ɸ"])
+("ulj'" ["" "" "ˮֻ" "¼"])
+("uljv" ["ʮ"])
+("ull'" ["ʪ"])
+("ulm'" ["ˣå"])
+("ulp'" ["ʵ"])
+("ulq'" "ɸ")
+("ulr'" "ɹ")
+("ultu" ["ɹͼ"])
+("ulu'" ["ʽ"])
+("ulv'" ["ʤ" "ʳ"])
+("ulvs" ["ɹ"])
+("ulwh" ["ɹ"])
+("ulx'" ["ѧ"])
+("ulxr" ["ɸѡ"])
+("ulyj" ["ɹ"])
+("ulyu" ["ˮ"])
+("ulzi" ["ɸ"])
+("um'" ["˵"])
+("umb'" ["ʯ޲" "˪ù"])
+("umd'" ["ܶ"])
+("umhd" [""])
+("umj'" ["޻"])
+("umjl" ["æ"])
+("uml'" ["" ""])
+("umq'" ["ʡú" "ˮú"])
+("ums'" ["ʷ˹"])
+("umt'" ["ʩ"])
+("umu'" ["ʹ" "ˮĥʯ" "˵"])
+("umvy" [""])
+("umx'" [""])
+("umxx" [""])
+("umy'" ["ʲô" "Ժ"])
+("umyl" ["ıԶ"])
+("umz'" ["Ŀ"])
+("ung'" ["깬" ""])
+("uni'" ["ˮ೧"])
+("unj'" ["Խ"])
+("unn'" [""])
+("unxd" ["ȷ"])
+("uobu" ["˵"])
+("uode" ["˵"])
+("uodk" ["˵"])
+("uody" ["˵"])
+("uofa" ["˵"])
+("uofu" ["˵"])
+("uogo" ["˵" ""])
+("uohd" ["˵"])
+("uohe" ["˵"])
+("uohk" ["˵"])
+("uohw" ["˵"])
+("uoig" ["˵"])
+("uoih" ["˵"])
+("uoir" ["˵"])
+("uojc" ["˵"])
+("uoli" ["˵"])
+("uoll" ["˵"])
+("uomy" ["˵"])
+("uopo" ["˵"])
+("uoq'" "˵")
+("uoqi" ["˵"])
+("uoqy" ["˵"])
+("uor'" "˶˷˸")
+("uoui" ["˶ʿ"])
+("uouo" ["˵˵"])
+("uouu" ["˵"])
+("uoxc" ["˵Ц"])
+("up'" ["ˮƽ"])
+("upbm" ["˳"])
+("upci" ["˳"])
+("upcs" ["˳"])
+("upde" ["˳"])
+("upe'" "˱")
+("upfg" ["˳"])
+("upg'" ["й"])
+("upgy" ["ʳƷҵ"])
+("upi'" ["Ʊ"])
+("upia" ["˳"])
+("upih" ["˳"])
+("upij" ["˳"])
+("upjj" ["Ʒ"])
+("upjm" ["˲"])
+("upkb" ["˳"])
+("upl'" ["Ʒ"])
+("uplf" ["Ʒͨ"])
+("upli" ["˳"])
+("uplt" ["Ʒͨ"])
+("uplu" ["˳·"])
+("uplv" ["Ʒת"])
+("upm'" ["ˮƽ"])
+("upq'" ["Ȩ"])
+("upr'" "˲˳˴")
+("uptm" ["˳"])
+("upub" ["˳"])
+("upui" ["Ʒ" "Ʒ" "˳"])
+("upuv" ["˳ˮ"])
+("upv'" ["г"])
+("upve" ["˳"])
+("upvi" ["˳"])
+("upx'" ["ˮƽ"])
+("upxi" ["˱" "˲Ϣ"])
+("upxn" ["˳"])
+("upxu" ["˳"])
+("upy'" ["Ա" "ˮƽ"])
+("upyj" ["˳" "˳"])
+("upyy" ["˳Ӧ"])
+("upzb" ["Ʒʱ"])
+("upzj" ["Ʒʽ"])
+("uq'" ["ʱ"])
+("uqbb" [""])
+("uqg'" ["ˮ"])
+("uqhy" ["ʫ黭"])
+("uql'" ["ˮ"])
+("uqlr" ["ʢ"])
+("uqtt" ["ɱ"])
+("uqu'" ["ǹ" "ʫ"])
+("uquj" ["ɽˮ"])
+("uqum" ["ʮȫʮ"])
+("uqwd" ["ʪ¶"])
+("uqx'" ["˫"])
+("uqyv" ["һָ"])
+("urf'" ["ɱ˷"])
+("urff" ["뷽"])
+("urji" ["˨"])
+("urpv" [""])
+("urq'" "˨˩")
+("urqi" ["ǳ"])
+("urr'" "")
+("urrx" [""])
+("urse" ["˨"])
+("uruv" ["ʯֽ"])
+("urvu" ["˩ס"])
+("ury'" ["ˮҺ"])
+("urzb" ["ʱ"])
+("urzk" ["迹"])
+("uscw" [""])
+("usd'" ["ʮ"])
+("usl'" ["ʮ"])
+("usrg" [""])
+("usul" ["˼"])
+("utab" ["ɳذ"])
+("utbi" ["ˮ"])
+("utd'" ["ˣ̬"])
+("utf'" ["ʵ巨"])
+("uti'" ["Ƴ"])
+("utj'" ["ʯ̿" "ʯͷ" "̫"])
+("utl'" ["̥"])
+("utlu" ["ˮʧ"])
+("utlx" [""])
+("utm'" [""])
+("utph" ["̬ƽ"])
+("utx'" ["͸" "̬ѧ"])
+("uty'" ["͸ѹ"])
+("uu'" ["ʵ"])
+("uubf" ["鱾"])
+("uubk" ["" "鱨"])
+("uuby" ["ɯʿ"])
+("uuci" [""])
+("uucl" ["߲"])
+("uucs" [""])
+("uudh" ["ʦ"])
+("uudi" [""])
+("uudk" ["赼"])
+("uudm" ["" ""])
+("uudu" [""])
+("uudw" ["ˮ"])
+("uue'" "")
+("uuee" [""])
+("uufa" ["㷢" "跥" "鷨"])
+("uufh" ["鷿"])
+("uufu" ["常" "" ""])
+("uugd" [""])
+("uugj" [""])
+("uugo" [""])
+("uugr" [""])
+("uuh'" ["ɽˮ" "ʯ"])
+("uuhb" [""])
+("uuhd" ["ƺƴ"])
+("uuhj" [""])
+("uuhr" ["ˮ"])
+("uuhu" [""])
+("uuhw" ["黭" "컯"])
+("uuih" ["泩"])
+("uuiu" [""])
+("uujc" [""])
+("uuji" ["鼮" ""])
+("uujm" [""])
+("uujp" ["迣"])
+("uujq" [""])
+("uujr" [""])
+("uuju" ["" ""])
+("uujw" ["" ""])
+("uujy" ["龭" ""])
+("uuk'" ["Կ"])
+("uukb" [""])
+("uuke" [""])
+("uukj" ["鿯"])
+("uukk" ["ʱʱ̿"])
+("uuks" [""])
+("uul'" ["ʵ"])
+("uulb" ["©"])
+("uulc" [""])
+("uuld" [""])
+("uuli" ["" "" "" ""])
+("uulm" [""])
+("uuln" [""])
+("uulo" [""])
+("uulp" ["" ""])
+("uulx" [""])
+("uulz" [""])
+("uuma" [""])
+("uumc" [""])
+("uumi" [""])
+("uuml" [""])
+("uumm" [""])
+("uumn" [""])
+("uumu" ["Ŀ" "ľ" "Ŀ"])
+("uumy" ["" ""])
+("uumz" [""])
+("uunq" ["Ŧ"])
+("uupi" ["Ƥ"])
+("uupy" [""])
+("uuq'" "ٿ")
+("uuqi" ["" ""])
+("uuqn" [""])
+("uuqu" ["ʵ" ""])
+("uuqy" [""])
+("uur'" ["" "" "" "" "" "" "" "" "" "" "ˡ" "" "ح" "" "" "" ""])
+("uurf" ["" ""])
+("uuru" [""])
+("uusi" [""])
+("uusj" ["ɢ"])
+("uusk" ["ɩ"])
+("uuss" ["" ""])
+("uutb" ["ͷ"])
+("uutj" ["̹"])
+("uuts" ["ͨ"])
+("uutv" ["˳ˮ"])
+("uutx" [""])
+("uuu'" ["ʡ" "ʵ"])
+("uuug" [""])
+("uuui" ["" "ʵ"])
+("uuuk" [""])
+("uuuo" ["˵"])
+("uuuu" ["" ""])
+("uuuv" ["ˮ" "˯" "ʼ"])
+("uuv'" ["˲ʱֵ"])
+("uuvb" ["" ""])
+("uuvd" ["ױ"])
+("uuvh" [""])
+("uuvi" ["ֶ" "֪" "֦" "֬" "ֵ"])
+("uuvj" ["չ"])
+("uuvl" ["ի"])
+("uuvs" [""])
+("uuvw" ["ˮֲ"])
+("uuw'" "")
+("uuwc" ["޲"])
+("uuwu" [""])
+("uuwz" ["λ"])
+("uux'" [""])
+("uuxi" ["Ϥ" "ϰ"])
+("uuxn" [""])
+("uuxs" [""])
+("uuxt" ["ѧ" "ѧ"])
+("uuxx" ["ɽ" "Ѫ" "д"])
+("uuxy" [""])
+("uuye" ["Һ" "Һ"])
+("uuyh" [""])
+("uuyr" ["Զ" "Ժ" "԰"])
+("uuyu" ["" ""])
+("uuzi" ["" ""])
+("uuzv" ["ˡ"])
+("uuzz" ["ʵʵ"])
+("uv'" [""])
+("uvba" ["ˮ"])
+("uvbc" ["ˮ"])
+("uvbg" ["ˮ"])
+("uvbj" ["ʮ֮˾"])
+("uvbu" ["ˮ"])
+("uvby" ["ʼղ" "ˮ"])
+("uvck" ["ˮ"])
+("uvcl" ["ˮ" "ˮ׼"])
+("uvd'" ["" "ƶ"])
+("uvdb" ["˭"])
+("uvdi" ["ˮ" "ˮ"])
+("uvdj" ["˰"])
+("uvdk" ["ˮ" "ˮ"])
+("uvdl" ["˯"])
+("uvdm" ["ˮ"])
+("uve'" "ˮ")
+("uvee" ["˰"])
+("uvff" ["ˮ"])
+("uvfg" ["ˮ"])
+("uvfz" ["ˮ"])
+("uvg'" ["˫ְ"])
+("uvgb" ["ˮ" "ˮ"])
+("uvge" ["˭"])
+("uvgj" ["˭"])
+("uvgo" ["ˮ" "˯"])
+("uvgr" ["ˮ"])
+("uvgs" ["ˮ"])
+("uvhe" ["ˮ"])
+("uvho" ["ˮ"])
+("uvhr" ["ˮ"])
+("uvhu" ["ˮ"])
+("uvhw" ["ˮ" "ˮ"])
+("uvhy" ["ֳ"])
+("uvie" ["ˮ"])
+("uvii" ["ˮ" "ˮ"])
+("uvij" ["ˮ"])
+("uvjc" ["˯"])
+("uvjm" ["ˮ"])
+("uvjn" ["˰"])
+("uvjp" ["ˮ"])
+("uvjr" ["ʱ"])
+("uvjx" ["ˮ"])
+("uvjy" ["ˮ" "ˮ" "ˮ"])
+("uvkb" ["ˮ"])
+("uvkg" ["ˮ"])
+("uvkr" ["˰"])
+("uvku" ["ˮ"])
+("uvl'" ["" "˯"])
+("uvld" ["ˮ"])
+("uvlg" ["ˮ"])
+("uvli" ["ˮ" "ˮ"])
+("uvlo" ["ˮ"])
+("uvlq" ["ˮ"])
+("uvlu" ["ˮ·"])
+("uvlv" ["˰"])
+("uvlz" ["ˮ"])
+("uvmg" ["˯"])
+("uvmi" ["ˮ"])
+("uvmm" ["ˮ" "˯"])
+("uvmo" ["ˮĥ"])
+("uvmu" ["ˮĸ"])
+("uvn'" ["ũ"])
+("uvng" ["˭" "ˮ"])
+("uvni" ["ˮ"])
+("uvnq" ["ˮţ"])
+("uvpk" ["ˮ"])
+("uvpy" ["ˮƽ"])
+("uvq'" ["" "ֳ" "ˮ" "ˮ׼"])
+("uvqi" ["ˮ" "ˮ"])
+("uvqu" ["ˮ"])
+("uvqy" ["ˮ"])
+("uvr'" "˯˰˵")
+("uvry" ["ʼһ"])
+("uvs'" [""])
+("uvse" ["ˮɫ"])
+("uvst" ["ͨ"])
+("uvt'" ["ָͷ"])
+("uvta" ["ˮ"])
+("uvtb" ["ˮͷ"])
+("uvth" ["ˮ"])
+("uvti" ["ˮ"])
+("uvtm" ["ˮ"])
+("uvts" ["ˮͰ"])
+("uvtu" ["ˮ"])
+("uvu'" ["˫"])
+("uvub" ["ˮ" "˰"])
+("uvuh" ["ˮ"])
+("uvui" ["˭" "ˮʦ"])
+("uvuj" ["ˮɼ"])
+("uvuu" ["˯"])
+("uvva" ["ˮբ"])
+("uvvi" ["˭֪" "ˮ" "˰"])
+("uvvj" ["ˮս"])
+("uvvp" ["ˮ׼"])
+("uvvs" ["ˮ" "ˮ"])
+("uvw'" ["˭" ""])
+("uvwf" ["ˮ"])
+("uvwu" ["˰"])
+("uvwz" ["ˮλ"])
+("uvx'" ["ֳ" ""])
+("uvxb" ["ֳϸ"])
+("uvxd" ["ˮ" "ˮ"])
+("uvxi" ["ˮϴ" "ˮϵ" "ˮ"])
+("uvxm" ["ˮ" "ˮ"])
+("uvxr" ["ˮѡ"])
+("uvxw" ["ˮ"])
+("uvxy" ["ˮ" "ˮ"])
+("uvy'" ["" "ˮ׼"])
+("uvya" ["ˮѹ"])
+("uvye" ["˭Ҳ"])
+("uvyh" ["ˮ"])
+("uvyj" ["ˮ" "ˮ"])
+("uvyp" ["ˮ"])
+("uvyt" ["ˮ"])
+("uvyu" ["ˮ" "ˮԡ"])
+("uvze" ["˰"])
+("uvzl" ["ˮ"])
+("uvzu" ["ˮ"])
+("uw'" [""])
+("uwct" ["޴"])
+("uwdz" ["ʵ"])
+("uwe'" "ˣ")
+("uwet" ["ֶ"])
+("uwfv" [""])
+("uwhx" ["ﻯѧ"])
+("uwj'" ["" "˰"])
+("uwll" ["ˣ"])
+("uwm'" ["Ĥ"])
+("uwq'" "ˢ")
+("uwql" ["ʷǰ"])
+("uwr'" "ˢ")
+("uws'" ["˰˾"])
+("uwvd" ["ʳж"])
+("uwvy" ["ɳ"])
+("uwx'" ["ѧ"])
+("uwxi" ["ˢϴ"])
+("uwxj" ["ѧ"])
+("uwxn" ["ˢ"])
+("uwy'" ["Ԫ"])
+("uwya" ["ˢ"])
+("uwyg" ["ӡ"])
+("uwzd" ["㵸"])
+("uwzi" ["ˢ"])
+("ux'" ["ʵ"])
+("uxbt" ["ˮйͨ"])
+("uxd'" ["ȶ"])
+("uxfx" ["ѧ"])
+("uxh'" ["ʢ"])
+("uxi'" ["ʳĳ"])
+("uxjk" ["Ľ"])
+("uxk'" ["п"])
+("uxmx" ["ѧģ"])
+("uxq'" ["ʵ"])
+("uxu'" ["ɽʡ" "ʡ"])
+("uxwb" ["˳Ϣ"])
+("uxy'" ["ʷ"])
+("uy'" ["ʹ"])
+("uyb'" ["ҵ" "ͱ"])
+("uybl" ["˥"])
+("uybm" ["˥"])
+("uybu" ["ʲ"])
+("uyd'" ["ɽҩ"])
+("uydk" ["ˤ"])
+("uydw" ["ҵλ"])
+("uye'" "˦")
+("uyg'" ["͹"])
+("uygm" ["ʮ¸"])
+("uyhx" ["ʯͻѧ"])
+("uyip" ["ʣƷ"])
+("uyix" ["ʵó"])
+("uyj'" ["ʵҵ" "ʵҵ" "" "" "ˮѹ"])
+("uyjc" ["ˤ"])
+("uyjl" ["ʣֵ"])
+("uyjm" ["˥"])
+("uyju" ["ɷн"])
+("uyjv" ["ʣֵ" "ʹüֵ"])
+("uyjx" ["˥"])
+("uykl" ["˦"])
+("uyld" ["ʣͶ"])
+("uylk" ["˥"])
+("uylo" ["˥"])
+("uylr" ["ҵ"])
+("uyly" [""])
+("uyq'" ["ˤ" "˥" "ʯ" "ʹȨ"])
+("uyr'" "˧")
+("uyro" ["˥"])
+("uyt'" ["ʾͼ" ""])
+("uytv" ["˥"])
+("uyu'" ["" "˫ˮ"])
+("uyuv" ["ʯ֯"])
+("uyux" ["ʱʱ"])
+("uyuy" ["ˮѹ"])
+("uyvy" ["ʵ"])
+("uyw'" ["ҵ" "ʮһ"])
+("uywh" ["˥"])
+("uywz" ["˥΢"])
+("uyx'" ["Ӧ" "ʵ"])
+("uyxm" ["˧"])
+("uyy'" ["Ժ" "ʮһ"])
+("uyyh" ["ҵ"])
+("uyyu" ["Ӱ"])
+("uyyw" ["ԸΥ"])
+("uyzb" ["ҵʱ"])
+("uz'" [""])
+("uzb'" ["ʶְ"])
+("uzgl" ["ڹ"])
+("uzj'" ["ʮּ"])
+("uzlk" ["ʮ·"])
+("uzt'" ["ʮͷ"])
+("uztx" ["ͨ"])
+("uzw'" "˭")
+("uzyw" ["˫Ҷֲ"])
+("v" "")
+("vaba" ["գ"])
+("vabj" ["բ" "զ"])
+("vabz" ["բ"])
+("vack" ["ա"])
+("vacl" ["ե"])
+("vade" ["է"])
+("vadj" ["ը"])
+("vadk" ["ա"])
+("vae'" "գ")
+("vafa" ["բ"])
+("vagd" [""])
+("vagf" [""])
+("vagh" [""])
+("vagj" [""])
+("vagp" [""])
+("vahv" ["ը"])
+("vaji" ["" ""])
+("vajm" [""])
+("valj" ["դ"])
+("vamf" ["բ"])
+("vapm" ["թƭ"])
+("vaq'" "զ߸")
+("vaqu" ["եȡ"])
+("var'" "դեզէըթ߸")
+("varu" [""])
+("vaui" ["ʵ"])
+("vavi" [""])
+("vaw'" ["" "" "" "ա" "բ" "ը" "" "ϰ"])
+("vawa" ["բ"])
+("vayb" ["" "ե"])
+("vayj" ["գ"])
+("vayk" ["ըҩ"])
+("vazi" ["" ""])
+("vb'" ["׼"])
+("vbbk" ["ܱ"])
+("vbbm" ["ܱ" ""])
+("vbbo" ["ܲ" "ܲ"])
+("vbdk" ["ܵ" "ܵ"])
+("vbe'" "")
+("vbfz" [""])
+("vbgr" [""])
+("vbgs" ["ܹ"])
+("vbh'" ["׼"])
+("vbhd" ["׼"])
+("vbhf" [""])
+("vbif" [""])
+("vbig" [""])
+("vbih" ["ܳ" "೧"])
+("vbjc" ["ܽ"])
+("vbji" ["޼"])
+("vbjr" ["β"])
+("vbju" [""])
+("vbjw" ["ܼ"])
+("vbkj" ["ܿ"])
+("vbks" [""])
+("vbl'" ["Ų" ""])
+("vblv" [""])
+("vbma" [""])
+("vbmi" [""])
+("vbmo" ["ĩ"])
+("vbmz" ["ü"])
+("vbnm" [""])
+("vbq'" ["" "" "" "" "" "" "" "ǹ"])
+("vbqi" [""])
+("vbqr" ["ȫ"])
+("vbr'" "ݧ")
+("vbrj" ["Ȼ"])
+("vbsv" [""])
+("vbtk" [""])
+("vbtm" [""])
+("vbtx" ["ָϵ"])
+("vbua" ["ɴ"])
+("vbuf" [""])
+("vbuj" ["ɽ"])
+("vbuu" [""])
+("vbv'" [""])
+("vbve" ["" ""])
+("vbvh" ["ݳ"])
+("vbvi" ["֪" ""])
+("vbvr" ["ת"])
+("vbw'" "")
+("vbwa" [""])
+("vbwf" ["" ""])
+("vbwz" ["Χ"])
+("vbxd" ["" ""])
+("vbxm" [""])
+("vbxn" [""])
+("vbxr" [""])
+("vbyb" [""])
+("vbye" ["ҹ"])
+("vbyi" [""])
+("vbyu" [""])
+("vbzi" [""])
+("vc'" [""])
+("vcmz" [""])
+("vcux" ["ʵѧ"])
+("vcy'" ["вҩ"])
+("vd'" ["ֱ"])
+("vdb'" ["ղ" "֬" "ж̲"])
+("vdbj" ["װ"])
+("vdbx" [""])
+("vdbz" ["װ"])
+("vdda" ["׳"])
+("vddj" ["׳"])
+("vddk" ["ײ"])
+("vddm" ["װ"])
+("vddy" ["װ" "׳"])
+("vde'" "")
+("vdf'" ["ƶ"])
+("vdg'" ["ƶ"])
+("vdgl" ["ת"])
+("vdgr" ["׳"])
+("vdh'" ["д" "" "ص"])
+("vdhd" ["װ"])
+("vdhu" ["ׯ"])
+("vdi'" ["Գ"])
+("vdie" ["ײ"])
+("vdj'" ["ս"])
+("vdji" ["ײ"])
+("vdjm" ["׳"])
+("vdjn" ["׳"])
+("vdjt" ["ն"])
+("vdjw" ["ׯ" "װ"])
+("vdjy" ["еȽ"])
+("vdkd" ["״"])
+("vdl'" ["ս"])
+("vdlc" ["װ"])
+("vdli" ["ׯ" "׳"])
+("vdlx" ["׳"])
+("vdmc" ["׳"])
+("vdmj" ["װ"])
+("vdmt" [""])
+("vdmz" ["׳"])
+("vdnm" ["׳"])
+("vdpz" ["װ"])
+("vdq'" ["׮" "ׯ" "װ" "ױ" "" "ƶ" "Ȩ"])
+("vdr'" "ײ׳״")
+("vdru" ["װ"])
+("vds'" ["д"])
+("vdsx" ["ָ˼"])
+("vdtl" ["״̬"])
+("vdtm" ["ׯ"])
+("vdu'" ["ɸ"])
+("vdua" ["װɵ"])
+("vdub" ["ն豸"])
+("vdui" ["װ" "׳ʿ"])
+("vduu" ["װ"])
+("vdv'" ["ս" ""])
+("vdvb" ["ׯ"])
+("vdvi" ["װ" "׳־"])
+("vdvs" ["ׯ"])
+("vdx'" [""])
+("vdxd" ["װ"])
+("vdxq" ["װ"])
+("vdxx" ["װж"])
+("vdy'" ["սԱ" "ָԱ"])
+("vdyb" ["װ"])
+("vdyh" ["װ"])
+("vdyj" ["ׯ"])
+("vdyp" ["װ"])
+("vdyr" ["ׯԱ" "ׯ԰" "״Ԫ"])
+("vdyu" ["״"])
+("vdyx" ["սӢ"])
+("vdz'" [""])
+("vdzi" ["ׯ" "״"])
+("vdzl" ["װ"])
+("vdzu" ["׳"])
+("vebi" ["ڱ"])
+("vebj" ["۰" ""])
+("vebm" [""])
+("vebu" ["ⲽ"])
+("vech" ["ڲ"])
+("veci" [""])
+("ved'" [""])
+("vedh" ["ڵ"])
+("vedm" [""])
+("vedr" ["ڶ"])
+("veds" ["㶫"])
+("vedx" ["۵"])
+("vee'" "")
+("veer" [""])
+("veff" [""])
+("vefu" ["۷" "ݷ" "ܶʼ"])
+("vegd" ["ڹ" "۹"])
+("vege" [""])
+("vegl" ["ڸ"])
+("vehe" ["ۺ"])
+("vehl" ["⻹"])
+("vehv" ["ۻ"])
+("veih" ["ⳡ"])
+("vejc" ["۽" ""])
+("vejd" ["㽭"])
+("vejq" ["۾" ""])
+("vejw" ["ۼ"])
+("vekb" ["ۿ"])
+("vel'" ["ܶ"])
+("veli" ["" ""])
+("velz" [""])
+("veme" ["ô"])
+("vemo" ["ĥ"])
+("veq'" "")
+("ver'" "")
+("vesr" [""])
+("vet'" "")
+("vetc" [""])
+("vetg" [""])
+("veth" ["" ""])
+("veue" [""])
+("veui" ["ʱ" ""])
+("vevb" [""])
+("vevi" ["֧"])
+("vevs" ["" "" ""])
+("vevu" ["ס"])
+("vew'" "ߡ")
+("vewz" ["λ"])
+("vexd" ["" ""])
+("vexi" [""])
+("vexm" [""])
+("vexq" [""])
+("vext" ["ѧ"])
+("vexx" ["Щ"])
+("veyh" [""])
+("veyi" ["һ"])
+("veyj" [""])
+("veyn" [""])
+("vezo" [""])
+("vf'" [""])
+("vfbj" [""])
+("vfbk" ["䱦"])
+("vfbo" [""])
+("vfbu" ["治" "벼"])
+("vfbx" [""])
+("vfby" [""])
+("vfch" [""])
+("vfci" [""])
+("vfck" [""])
+("vfde" ["" "" ""])
+("vfdh" ["" ""])
+("vfdi" ["" ""])
+("vfdm" ["ֶ"])
+("vfdr" [""])
+("vfds" ["" ""])
+("vfdv" [""])
+("vfdy" [""])
+("vfe'" "")
+("vffa" ["뷨"])
+("vfff" [""])
+("vffg" [""])
+("vffj" [""])
+("vffu" [""])
+("vfge" [""])
+("vfgr" [""])
+("vfgu" [""])
+("vfgv" [""])
+("vfhj" [""])
+("vfhl" [""])
+("vfhw" ["滰"])
+("vfia" ["" ""])
+("vfig" [""])
+("vfjd" [""])
+("vfji" ["漣" "켩" ""])
+("vfjm" [""])
+("vfjp" [""])
+("vfjq" [""])
+("vfjw" [""])
+("vfjx" [""])
+("vfjy" ["" ""])
+("vfke" [""])
+("vfks" [""])
+("vfl'" [""])
+("vflc" [""])
+("vfli" [""])
+("vflx" [""])
+("vfm'" [""])
+("vfmu" ["ľ" "ľ"])
+("vfpn" ["Ʒ"])
+("vfq'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("vfqi" [""])
+("vfqt" ["ȷ"])
+("vfqx" [""])
+("vfqy" [""])
+("vfr'" "")
+("vfrf" [""])
+("vfrs" [""])
+("vfru" [""])
+("vfs'" ["֬"])
+("vfso" [""])
+("vft'" [""])
+("vftb" ["ͷ" "ͷ"])
+("vftj" ["̽"])
+("vfts" ["ʹ" "ʹ"])
+("vfub" [""])
+("vfui" ["" "ʵ" "" ""])
+("vfvf" [""])
+("vfvg" [""])
+("vfvh" [""])
+("vfvi" ["֪" "ֿ" "֯" ""])
+("vfvo" [""])
+("vfvs" ["" ""])
+("vfvu" ["" ""])
+("vfvv" ["зս"])
+("vfwh" [""])
+("vfx'" [""])
+("vfxd" ["" "" "" "" ""])
+("vfxi" ["ϧ"])
+("vfxm" ["" ""])
+("vfxn" [""])
+("vfxy" [""])
+("vfya" ["ѹ"])
+("vfyb" [""])
+("vfyr" ["Դ"])
+("vfyu" [""])
+("vfyy" ["Ӫ"])
+("vfzi" ["" ""])
+("vfzo" [""])
+("vg'" ["й"])
+("vgba" [""])
+("vgbi" [""])
+("vgbm" ["" "" ""])
+("vgby" [""])
+("vgc'" ["ս" "йش"])
+("vgce" [""])
+("vgci" ["֤"])
+("vgda" [""])
+("vgdb" [""])
+("vgdc" [""])
+("vgde" [""])
+("vgdh" ["" "" ""])
+("vgdi" ["" ""])
+("vgdl" [""])
+("vgdm" ["" ""])
+("vgdo" [""])
+("vgdp" [""])
+("vgdr" [""])
+("vgdv" [""])
+("vgdy" ["" ""])
+("vge'" ["" "" "׼"])
+("vgfa" ["" "" "" "" ""])
+("vgfg" [""])
+("vgfh" [""])
+("vgfj" [""])
+("vgfu" ["" "" ""])
+("vggb" [""])
+("vggd" ["" "" "й" "й"])
+("vgge" ["" ""])
+("vggh" [""])
+("vggl" [""])
+("vggo" ["֣"])
+("vggr" ["й"])
+("vggs" [""])
+("vggv" ["" "" ""])
+("vgh'" ["й"])
+("vghb" ["֢"])
+("vghe" ["" "֣"])
+("vghk" ["" ""])
+("vgho" [""])
+("vgih" [""])
+("vgii" [""])
+("vgik" [""])
+("vgiu" [""])
+("vgj'" ["ֻ" ""])
+("vgjc" [""])
+("vgji" ["" ""])
+("vgjm" ["" "֤"])
+("vgjq" [""])
+("vgju" ["" "֤"])
+("vgjx" ["" "" "֢"])
+("vgjy" ["" "֣"])
+("vgke" [""])
+("vgkl" [""])
+("vgky" ["йѧԺ"])
+("vgl'" ["Ṧ" ""])
+("vgli" [""])
+("vglp" [""])
+("vglq" ["" ""])
+("vgls" [""])
+("vglu" ["·"])
+("vgly" [""])
+("vgm'" ["ץ"])
+("vgmf" [""])
+("vgmm" [""])
+("vgmy" ["" "" "֤"])
+("vgn'" ["ָ"])
+("vgni" [""])
+("vgnj" [""])
+("vgnx" ["ܶ"])
+("vgny" [""])
+("vgpl" [""])
+("vgpm" ["Ƭ"])
+("vgpn" ["֡Ƶ"])
+("vgq'" "֢")
+("vgqc" [""])
+("vgqi" ["" "" "" "" ""])
+("vgqm" ["Ǯ"])
+("vgqq" [""])
+("vgqr" ["Ȩ" "֤ȯ"])
+("vgqt" ["ȷ"])
+("vgqu" ["ȡ" ""])
+("vgqx" [""])
+("vgr'" "֢֣֤֡ں")
+("vgrf" ["֤"])
+("vgrm" ["й"])
+("vgru" [""])
+("vgse" ["ɫ"])
+("vgt'" ["ֱͼ" ""])
+("vgtg" [""])
+("vgti" ["" ""])
+("vgtk" [""])
+("vgtm" [""])
+("vgto" [""])
+("vgts" ["ͳ"])
+("vgtu" [";"])
+("vgty" [""])
+("vgub" [""])
+("vgud" ["սʱ"])
+("vgui" ["ʽ" "ʱ" "ʼ" "ʽ" "" "" "" "" "֤ʵ"])
+("vguu" ["" "" "֤"])
+("vguv" ["˰"])
+("vgva" [""])
+("vgvb" ["֣"])
+("vgvd" ["֢״"])
+("vgvg" ["" "" "ץι"])
+("vgvi" ["ִ" "֦" "" "ֱ" "" ""])
+("vgvj" ["ս"])
+("vgvk" [""])
+("vgvs" ["" "֣"])
+("vgvy" ["й" ""])
+("vgwf" [""])
+("vgwu" ["" "" "֤" ""])
+("vgwx" ["йѧ"])
+("vgwz" ["ί"])
+("vgxd" ["" ""])
+("vgxm" ["" ""])
+("vgxp" ["ѯ"])
+("vgxq" [""])
+("vgxx" ["Э"])
+("vgxy" [""])
+("vgy'" ["֣Ӧ" "عҵ"])
+("vgyh" ["й"])
+("vgyi" ["" ""])
+("vgyj" ["" "" ""])
+("vgyk" ["Ҫ"])
+("vgys" [""])
+("vgyt" [""])
+("vgzi" [""])
+("vgzl" [""])
+("vh'" ["ֻ"])
+("vhai" ["ϰ"])
+("vhb'" ["ָӲ"])
+("vhbf" ["ʱ"])
+("vhbu" ["ʲ"])
+("vhbz" [""])
+("vhce" ["ʲ"])
+("vhd'" ["Ż"])
+("vhda" ["" "Ŵ"])
+("vhde" ["õ"])
+("vhdj" ["ʵ"])
+("vhdo" ["ƶ"])
+("vhe'" ["" "" "" "" ""])
+("vhfa" ["·"])
+("vhfh" ["ʷ"])
+("vhfu" ["ɷ"])
+("vhgr" ["" "ƹ"])
+("vhgu" ["ƹ"])
+("vhgv" ["ƹ"])
+("vhhe" ["º" "ĺ"])
+("vhhg" ["ź"])
+("vhhj" ["º"])
+("vhhk" ["ʺ" "˺"])
+("vhhu" ["ʻ"])
+("vhig" ["³"])
+("vhik" ["ǳ"])
+("vhjc" ["Ž"])
+("vhjn" [""])
+("vhju" ["¾"])
+("vhjw" ["Ǽ"])
+("vhjx" ["½"])
+("vhkb" ["ſ"])
+("vhkg" ["ת"])
+("vhkl" ["ſ"])
+("vhkr" ["ʿ"])
+("vhl'" ["ʺ"])
+("vhld" [""])
+("vhli" [""])
+("vhlk" [""])
+("vhlo" ["" ""])
+("vhmu" ["Ŀ" "Ŀ"])
+("vhmz" ["л"])
+("vhnk" [""])
+("vhpg" ["" "" ""])
+("vhq'" "۵")
+("vhqi" [""])
+("vhqm" [""])
+("vhqr" ["Ȩ"])
+("vhr'" "")
+("vhrf" [""])
+("vhsp" [""])
+("vht'" ["»"])
+("vhtx" [""])
+("vhug" [""])
+("vhuh" [""])
+("vhui" [""])
+("vhuj" ["л"])
+("vhuu" [""])
+("vhuv" ["ˮ"])
+("vhvb" [""])
+("vhve" ["" ""])
+("vhwh" ["" ""])
+("vhwo" [""])
+("vhxd" [""])
+("vhxn" [""])
+("vhxp" ["ѫ"])
+("vhxu" ["»С˵"])
+("vhy'" ["ָԱ"])
+("vhyi" [""])
+("vhzi" ["" ""])
+("vhzv" [""])
+("vi'" ["ָ"])
+("viai" ["°"])
+("vian" ["ΰ"])
+("vibc" ["ָ" "Ʊ"])
+("vibf" ["ֱ"])
+("vibi" ["ִ" "ֽ"])
+("vibj" ["ֵ" "ð" "ư"])
+("vibk" ["ֲ"])
+("vibm" ["ʱ"])
+("vibo" ["ֱ"])
+("vibu" ["֧" "֯" "ֹ"])
+("viby" ["²" "β"])
+("vibz" ["ֲ" "Ʊ"])
+("vicg" ["ֻ"])
+("vici" ["ֵ" "ֻ" "" "´"])
+("vicl" ["Ʋ"])
+("vida" ["ֱ" ""])
+("vide" ["Ƶ" "ֵ" "ֻ"])
+("vidh" ["ֻ"])
+("vidi" ["ʵ" "ʵ"])
+("vidk" ["֪" "ֱ" "ֱ" "ֱ" "ָ" ""])
+("vidl" ["ֽ"])
+("vidm" ["֧" "ָ" "µ" "ʵ"])
+("vido" [""])
+("vids" ["ƶ"])
+("vidu" ["ƶ"])
+("vidv" ["֧"])
+("vidy" ["ָ" "ƶ" "ƶ"])
+("vie'" "ַָֹֺֻּֽ")
+("vier" ["ֶ"])
+("vifa" ["֪" "ִ" "ָ"])
+("viff" ["֬"])
+("vifh" ["֪" "֬"])
+("vifu" ["֧" "֪" "¸" "Ʒ"])
+("vig'" ["֣ɹ"])
+("vige" ["Ƹ"])
+("vigj" ["֦" "֧" "֮" "ʸ"])
+("vigo" ["ι"])
+("vigr" ["ְ" "ֱ" "ֻ"])
+("vigs" ["֧" "֯" "ְ"])
+("vigu" ["ֻ"])
+("vihb" ["֮"])
+("vihj" ["º" "кϽ"])
+("vihk" ["ֻ"])
+("vihr" ["û"])
+("vihu" ["֧"])
+("vihv" ["ָ" "ֻ" "ǻ"])
+("vihw" [""])
+("viid" ["̴"])
+("viig" ["֧" "֯" "ְ" "Ƴ" "ʳ"])
+("viih" ["ֱ"])
+("viii" ["֧" "ֱ" "ָ" ""])
+("viiu" ["֧" "֮" "ָ"])
+("vij'" [""])
+("vijc" ["ֱ" "ָ"])
+("vijd" ["ֽ"])
+("viji" ["֪" "֮" "֯" "Ƽ"])
+("vijm" ["֮" "Ƽ"])
+("vijn" [""])
+("vijt" ["֪" "ֱ"])
+("vijw" ["֧" "ָ" "μ"])
+("vijx" ["֦" "֫" "ֱ"])
+("vijy" ["ֱ" "ֹ" "¾"])
+("vike" ["ֻ"])
+("vikj" ["ֻ"])
+("viks" ["ָ"])
+("vil'" ["ת"])
+("vilc" ["" ""])
+("vild" [""])
+("vilg" ["" ""])
+("vili" ["֧" "ֱ" "" "" "" ""])
+("vilq" ["֧" "ֱ" ""])
+("vily" ["ָ"])
+("vilz" ["֮"])
+("vima" ["֥"])
+("vimb" ["ı"])
+("vimc" ["ֲ"])
+("vimi" [""])
+("vimm" ["ֽ" ""])
+("vimn" ["ֳ"])
+("vimy" ["֪" "ָ" "ָ" ""])
+("ving" ["ְ" "ֻ" ""])
+("vinh" [""])
+("vinj" ["ָ"])
+("vins" ["֧ũ" "־ũ"])
+("vinv" ["ֶŮ"])
+("vinz" ["֮"])
+("vip'" ["ƳƷ"])
+("vipa" ["ֻ"])
+("vipc" ["֧Ʊ"])
+("vipl" ["ָ"])
+("vipm" ["ֽƬ"])
+("vipn" ["Ʒ"])
+("vipu" [""])
+("vipy" ["ƽ"])
+("vipz" ["֧"])
+("viq'" "ֻ֪֥֦֧֭֮֨֩֫֬֯ش")
+("viqi" ["־" ""])
+("viqm" ["֮ǰ" "ֵǮ" "Ǯ"])
+("viqn" ["ִ" "ֵ"])
+("viqq" ["ֻ"])
+("viqr" ["ְȨ"])
+("viqu" ["֧" "־Ȥ" "ȡ"])
+("viqy" ["֪" "֪"])
+("vir'" ["ʶ" "֪" "־" "ֿ" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "ۤ" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("virf" [""])
+("viri" ["ֵ" "ָ" ""])
+("vish" ["ɥ"])
+("visi" [""])
+("viso" [""])
+("vitb" ["֦ͷ" "ָͷ" "ֺͷ" "ֽͷ"])
+("vitc" ["֦"])
+("vith" ["" ""])
+("viti" ["֫" ""])
+("vits" ["ֹʹ"])
+("vitu" ["ͼ"])
+("viub" ["ְ"])
+("viud" ["ֱˬ"])
+("viuf" ["ֻ" ""])
+("viuh" ["֮" ""])
+("viui" ["֧ʹ" "֪ʶ" "֪" "֮ʱ" "ֱ" "ִ" "ָʹ" "ָʾ" "ָ" "ֻ" "־ʿ" "ʹ"])
+("viuj" ["ɽ"])
+("viuk" [""])
+("viuu" ["֧" "֧" "ֱ" "ֲ" "ָ" ""])
+("viuv" ["ˮ"])
+("viuy" ["ֱ"])
+("vivb" ["֯"])
+("vive" ["ָ" ""])
+("vivf" ["ָ"])
+("vivg" ["ִ" "ָ" ""])
+("vivh" ["ִ" "ֽ"])
+("vivi" ["֩֩" "ֱ" "֮" "ֹ" ""])
+("vivk" ["ִ"])
+("vivl" ["ָժ"])
+("vivs" ["֮"])
+("vivu" ["֧" "֧ס" "֩" "ֲ" "ֹס" ""])
+("viw'" "ְֱֲֳִֵֶָ")
+("viwf" ["ָ" ""])
+("viwh" ["ָ"])
+("viwl" ["֮"])
+("viwu" ["֮" "֯" "ְ" "ֲ" "ָ"])
+("viwz" ["ְλ"])
+("vix'" ["д"])
+("vixc" ["ֻ" ""])
+("vixd" ["ָ" "ֽ" "־"])
+("vixi" ["Ϣ"])
+("vixm" ["֧" "֪" "ֱ" "ֻ"])
+("vixn" ["֪" ""])
+("vixt" ["ֹѪ" "ѧ"])
+("vixu" ["ֻ" "ֻ" ""])
+("vixw" ["֮" "ֱϽ"])
+("vixx" ["ֹѪ" "л"])
+("vixy" ["ִ"])
+("viyb" ["ֻ" "ֿ"])
+("viye" ["֦Ҷ" "֭Һ" "ְҵ"])
+("viyi" ["֮һ" "ּ" "" "" "" ""])
+("viyj" ["ֽ"])
+("viyk" ["ֻҪ" "Ҫ"])
+("viyn" ["֪" "ָ"])
+("viyr" ["ְԱ" "֧Ԯ" "־Ը" "Ԫ"])
+("viys" [""])
+("viyt" ["Լ"])
+("viyu" ["" "" ""])
+("vize" ["ְ" "ָ"])
+("vizi" ["֦" "ֶ" ""])
+("vizk" ["֯" ""])
+("vizl" ["ֻ"])
+("vizo" ["֧" "֧" ""])
+("vizu" ["֪"])
+("vizv" [""])
+("vj'" ["ֱ"])
+("vjbk" ["ս"])
+("vjbl" ["ս"])
+("vjbz" ["ս"])
+("vjdb" ["ս"])
+("vjdi" ["ռ" "ս"])
+("vjdr" ["ն"])
+("vjdv" ["վ"])
+("vjdy" ["վ"])
+("vje'" "յնշոչ")
+("vjfj" ["ս"])
+("vjfu" ["ս"])
+("vjfz" ["ս"])
+("vjg'" ["򾲸" "֥Ӹ"])
+("vjgd" ["մ"])
+("vjge" ["ս"])
+("vjgh" ["վ"])
+("vjgo" ["ս" "ս"])
+("vjgs" ["ս"])
+("vjgu" ["ս"])
+("vjhb" ["ս"])
+("vjhk" ["ս"])
+("vjho" ["ս" "ս"])
+("vji'" ["װ׳"])
+("vjie" ["ս"])
+("vjig" ["ռ"])
+("vjih" ["ս"])
+("vjii" ["չ"])
+("vjiu" ["չ"])
+("vjjd" ["տ"])
+("vjjj" ["۾ɻ"])
+("vjjm" ["ս"])
+("vjju" ["ռ" "ս"])
+("vjjy" ["ֱӾ"])
+("vjk'" ["żҿ"])
+("vjkl" ["չ" ""])
+("vjl'" ["֦" "о"])
+("vjlc" ["ռ"])
+("vjld" ["ֱ˵"])
+("vjli" ["ս"])
+("vjlj" ["չ"])
+("vjlm" ["ճ"])
+("vjlr" ["ս"])
+("vjlt" ["ս"])
+("vjlx" [""])
+("vjly" ["ռ"])
+("vjma" ["ս"])
+("vjmk" ["ձñ"])
+("vjpn" ["չƷ"])
+("vjq'" "հձղճմռ")
+("vjqi" ["չ"])
+("vjqm" ["սǰ"])
+("vjqu" ["ս"])
+("vjr'" ["" "պ" "ջ" "ռ" "ս" "վ" "տ" "" "м" "ׯ"])
+("vjrj" ["մȾ"])
+("vjrl" ["ֱȾ"])
+("vjsi" ["ս"])
+("vjsv" ["齭"])
+("vjsx" ["ֱ"])
+("vjt'" ["м"])
+("vjtl" ["վ̨"])
+("vjtx" ["ճ"])
+("vjty" ["չ"])
+("vju'" ["" "㽭ʡ" "ؽ" "ؾʯ"])
+("vjub" ["ն"])
+("vjug" ["սʤ"])
+("vjui" ["չʾ" "սʱ" "սʿ" "ս"])
+("vjuu" ["ս" "ս" "˵"])
+("vjv'" ["мվ"])
+("vjve" ["վ"])
+("vjvg" ["ս"])
+("vjvh" ["վ"])
+("vjvm" ["ֱ֤"])
+("vjvr" ["շת"])
+("vjvu" ["ճס" "վס"])
+("vjw'" ["мί"])
+("vjwf" ["վ"])
+("vjwh" ["չ"])
+("vjxj" ["ֱѡ"])
+("vjxm" ["չ" "ռ" "ռ" "ս"])
+("vjxn" ["ո"])
+("vjyb" ["ռ" "ս"])
+("vjyh" ["հ"])
+("vjyi" ["ս"])
+("vjys" ["ռ"])
+("vjzb" ["ֱ"])
+("vjzl" ["վ"])
+("vk'" ["ٿ"])
+("vkan" ["ٰ"])
+("vkb'" ["ձ"])
+("vkbc" ["б"])
+("vkbj" ["հ" "հ"])
+("vkdk" ["ҵ"])
+("vkdl" ["д"])
+("vkdu" ["ն"])
+("vke'" "צ")
+("vkfa" ["շ"])
+("vkfu" ["и"])
+("vkg'" ["չ"])
+("vkge" ["Ҹ"])
+("vkgr" ["չ"])
+("vkgu" ["չ"])
+("vkhe" ["׺"])
+("vkho" ["Ż"])
+("vkhp" ["л"])
+("vkhr" ["ٻ"])
+("vkhu" ["к"])
+("vkhv" ["ջ" "ٻ"])
+("vkih" ["ճ"])
+("vkik" ["ճ"])
+("vkiu" ["ҳ"])
+("vkji" ["м" "ټ" "ż"])
+("vkjm" ["ټ"])
+("vkjq" ["վ"])
+("vkjw" ["м" "Լ"])
+("vkkk" ["п"])
+("vkkl" ["ٿ"])
+("vklc" [""])
+("vkld" [""])
+("vkli" ["" ""])
+("vkll" [""])
+("vkly" ["گ"])
+("vkmu" ["ļ" "Ľ" "ļ"])
+("vkmy" [""])
+("vkpl" [""])
+("vkpm" ["Ƭ"])
+("vkpn" ["Ƹ"])
+("vkpy" ["ƽ"])
+("vkq'" "")
+("vkqi" ["" ""])
+("vkqy" [""])
+("vkr'" "گ")
+("vkrf" [""])
+("vktb" ["ͷ"])
+("vku'" ["֣ˬ"])
+("vkub" ["" ""])
+("vkue" [""])
+("vkug" ["" ""])
+("vkui" ["" ""])
+("vkuu" ["گ"])
+("vkvd" ["ׯ"])
+("vkve" [""])
+("vkvi" [""])
+("vkvj" ["չ"])
+("vkvp" ["׼"])
+("vkw'" "")
+("vkwa" [""])
+("vkxd" ["н" ""])
+("vkxi" ["Ϧ"])
+("vkxp" ["Ѱ"])
+("vkxt" ["ѩ"])
+("vkxw" ["ϼ"])
+("vkxx" ["רѧУ"])
+("vky'" ["Կط"])
+("vkya" ["צ"])
+("vkyh" ["" ""])
+("vkyi" [""])
+("vkyk" ["ҫ"])
+("vkyy" ["Ӧ"])
+("vkze" [""])
+("vkzi" [""])
+("vkzl" [""])
+("vl'" [""])
+("vlb'" ["" "" "" ""])
+("vld'" ["ֱ" ""])
+("vldj" ["ֱ綯" "ֱ"])
+("vle'" "խ")
+("vlf'" ["ר"])
+("vlfj" ["ֱ"])
+("vlg'" ["չ" "" ""])
+("vlgl" [""])
+("vlh'" ["չ" "ֽϻ"])
+("vli'" [""])
+("vlik" ["ժ"])
+("vliu" ["ժ"])
+("vlj'" ["ۼ" "־" "" ""])
+("vljd" ["ٶ"])
+("vljy" [""])
+("vlkf" [""])
+("vll'" [""])
+("vllu" ["ժ¼"])
+("vlps" ["֧"])
+("vlq'" ["" "ժ" "ի" "" "" "רȨ"])
+("vlqr" ["ծȨ" "ծȯ"])
+("vlr'" "ծկ")
+("vlrh" [""])
+("vlu'" ["ˮ" ""])
+("vlun" [""])
+("vlv'" ["ռ"])
+("vlvb" ["ָ"])
+("vlvu" ["ծ"])
+("vlw'" "լ")
+("vlwl" ["կ"])
+("vlwu" ["ծ"])
+("vlxc" ["խС"])
+("vlxn" ["ժ"])
+("vly'" ["Ҷ"])
+("vlyi" ["ժ"])
+("vlyk" ["ժҪ"])
+("vlyn" ["ժ"])
+("vlyr" ["լԺ"])
+("vlyt" ["ի"])
+("vlz'" ["" ""])
+("vlzi" ["կ"])
+("vm'" ["֤"])
+("vmd'" ["ֳ"])
+("vmh'" ["רŻ"])
+("vmi'" ["ľ"])
+("vmjg" ["רŻ"])
+("vmru" ["֪ʿ"])
+("vmrw" [""])
+("vmt'" ["üͷ"])
+("vmu'" ["֤"])
+("vmv'" ["ô" ""])
+("vmvy" ["ֳ"])
+("vmx'" ["ô" "ôЩ"])
+("vmy'" ["Ŀ" "֥" "ô"])
+("vmzy" ["װģ"])
+("vn'" ["ֻ"])
+("vnh'" ["ܻ"])
+("vnu'" ["ɽ"])
+("vnv'" ["ָ"])
+("vnx'" ["֯Ů"])
+("vnzb" ["ְʱ"])
+("vojm" ["׿"])
+("vojt" ["׿"])
+("vold" [""])
+("voli" [""])
+("volo" [""])
+("volu" ["¼" "½"])
+("volx" ["׾"])
+("vomm" [""])
+("vomo" ["׽" "ĥ"])
+("vona" ["׽"])
+("vons" ["׽Ū"])
+("voq'" "׽׾׿پ")
+("voqy" [""])
+("vore" [""])
+("vose" ["ɫ"])
+("voub" [""])
+("vouh" [""])
+("voui" ["׿ʶ" "ʳ"])
+("vovd" ["׳"])
+("vovs" [""])
+("vovu" ["׽ס" "׾" "׿"])
+("vow'" "ߪ")
+("voxd" [""])
+("voyi" [""])
+("voyj" [""])
+("voyn" [""])
+("voyt" ["׿Խ"])
+("vozi" ["" ""])
+("vpbz" ["׼"])
+("vpe'" "׼")
+("vpq'" "׻")
+("vpql" [""])
+("vpqt" ["׼ȷ"])
+("vpug" ["׼"])
+("vpui" ["׼ʱ"])
+("vpvp" ["׻׻"])
+("vpxm" ["׼"])
+("vpxu" ["׼"])
+("vpy'" ["ռ"])
+("vpyu" ["׼"])
+("vpze" ["׼"])
+("vq'" ["ȡ"])
+("vqb'" ["ڱ"])
+("vqd'" ["׼ȷ"])
+("vqdl" ["Ȩ"])
+("vqg'" ["֧" "Ȩ"])
+("vqhu" ["ں"])
+("vqil" ["鴦"])
+("vqj'" ["" ""])
+("vqjg" ["Ȩ"])
+("vqji" [""])
+("vql'" ["վ" ""])
+("vqn'" [""])
+("vqpb" [""])
+("vqr'" ["ծȨ"])
+("vqww" ["׼ȷ"])
+("vqx'" ["ȷ" "" "׼ȷ"])
+("vr'" [""])
+("vran" ["ר"])
+("vrbm" ["ת"])
+("vrbo" ["ת"])
+("vrcl" [""])
+("vrda" ["ת"])
+("vrdc" ["ת"])
+("vrdk" ["ת"])
+("vrdm" ["ר"])
+("vrdr" ["ר"])
+("vrds" ["ת"])
+("vre'" "ת")
+("vrer" ["ת"])
+("vrfa" ["ת"])
+("vrg'" ["˹"])
+("vrgk" ["ת" "׫"])
+("vrhg" ["ר"])
+("vrhr" ["ת"])
+("vrhw" ["ת"])
+("vria" ["ש"])
+("vrie" ["ר"])
+("vrig" ["ר"])
+("vrih" ["ר"])
+("vrjc" ["ת" "ת"])
+("vrji" ["" "ר" "ר" "ת"])
+("vrjw" ["ר" "ת"])
+("vrke" ["ר"])
+("vrkr" ["ר"])
+("vrli" ["ר"])
+("vrlj" ["ר"])
+("vrlm" ["ת"])
+("vrlu" ["ת¯" "ת¼"])
+("vrmf" ["ר"])
+("vrml" ["ר"])
+("vrnm" ["ת"])
+("vrpj" ["ת"])
+("vrq'" "רש")
+("vrqm" ["׬Ǯ"])
+("vrqr" ["רȨ"])
+("vrqu" ["ר"])
+("vrr'" "ת׫׬׭")
+("vrrf" ["ר" "ר"])
+("vrrh" ["ת"])
+("vrru" ["ת"])
+("vrss" ["ת"])
+("vrsu" ["ת"])
+("vrtb" ["שͷ"])
+("vrti" ["ר"])
+("vrtl" ["ת̨"])
+("vruf" ["ת"])
+("vrui" ["רʹ"])
+("vrup" ["ת˲"])
+("vrvb" ["ת"])
+("vrve" ["ת"])
+("vrvg" ["ר" "ת"])
+("vrvh" ["ת"])
+("vrvi" ["רְ" "רָ" "ר"])
+("vrvj" ["תս"])
+("vrvu" ["ר" "רע" "תע"])
+("vrw'" [""])
+("vrwf" ["׫"])
+("vrwj" ["ת"])
+("vrwl" ["Ϊ"])
+("vrwy" ["ίԱ"])
+("vrwz" ["רΪ" "תΪ"])
+("vrxd" ["ר" "ת"])
+("vrxn" ["ר"])
+("vrxt" ["תѧ"])
+("vrxx" ["׫д"])
+("vrye" ["רҵ" "תҵ"])
+("vryi" ["רһ" "ת"])
+("vryj" ["ת"])
+("vryn" ["ת"])
+("vryp" ["ת"])
+("vryr" ["רԱ"])
+("vrys" ["ר"])
+("vrze" ["ר"])
+("vrzi" ["ת" "׭"])
+("vrzl" ["ת"])
+("vsbc" ["б" "ӱ"])
+("vsbi" ["ر"])
+("vsbk" ["б" "б"])
+("vsbl" ["Ӱ"])
+("vsbo" ["в"])
+("vsbu" ["в"])
+("vsbx" ["ֱ"])
+("vsby" ["ر" "ز"])
+("vscg" ["в"])
+("vscl" ["ٲ"])
+("vsda" ["ش"])
+("vsde" ["е"])
+("vsdg" ["е"])
+("vsdi" ["е" "ֵ" "ص"])
+("vsdj" ["е" "ֵ" "ص"])
+("vsdk" ["е" "е"])
+("vsdm" ["е" "ӵ" "յ" "ص"])
+("vsdo" ["ڶ"])
+("vsdr" ["ж" "ж" "ն"])
+("vsds" ["ж"])
+("vsdu" ["ж"])
+("vsdv" ["ж"])
+("vse'" "ڣ")
+("vsfg" ["з" "з"])
+("vsfj" ["з"])
+("vsfu" ["ظ"])
+("vsfz" ["з" "ַ"])
+("vsgg" ["и"])
+("vsgk" ["Ҹ"])
+("vsgo" ["й"])
+("vsgr" ["ӹ"])
+("vsgs" ["й"])
+("vsgu" ["й" "й" "ӹ"])
+("vsgv" ["չ"])
+("vshb" ["Һ"])
+("vshd" ["л"])
+("vshe" ["к"])
+("vshh" [""])
+("vsho" ["ػ"])
+("vshw" ["л" "ֻ"])
+("vsia" ["Ӳ" "ֲ"])
+("vsif" ["ҳ"])
+("vsig" ["г" "ҳ"])
+("vsih" ["г"])
+("vsik" ["г"])
+("vsiu" [""])
+("vsjc" ["У"])
+("vsjd" ["н" "ؽ"])
+("vsji" ["м" "м" "м" "ռ"])
+("vsjm" ["м" "м"])
+("vsjp" ["о"])
+("vsjq" ["վ" "վ"])
+("vsju" ["о" "վ"])
+("vsjx" ["" "н" "ս"])
+("vsjy" ["о" "о"])
+("vskf" ["п"])
+("vskj" ["п"])
+("vsl'" [""])
+("vslb" ["¥"])
+("vslc" [""])
+("vsld" [""])
+("vsli" ["" ""])
+("vslj" [""])
+("vslo" [""])
+("vslp" [""])
+("vslq" ["" ""])
+("vslu" ["·"])
+("vslv" [""])
+("vslx" [""])
+("vslz" [""])
+("vsma" ["" ""])
+("vsmz" [""])
+("vsni" [""])
+("vsnj" [""])
+("vsnm" ["" ""])
+("vsns" ["ũ"])
+("vsou" ["ŷ"])
+("vspk" [""])
+("vspl" [""])
+("vspn" ["Ƶ"])
+("vspy" ["ƽ"])
+("vsq'" "")
+("vsqi" ["" ""])
+("vsqp" ["Ⱥ"])
+("vsqq" [""])
+("vsqy" ["" ""])
+("vsr'" "")
+("vsrf" ["" "" "" ""])
+("vsri" ["" ""])
+("vssu" [""])
+("vstb" ["ͷ"])
+("vstm" ["" ""])
+("vsts" ["ͳ"])
+("vstu" [";" ""])
+("vstx" [""])
+("vsty" [""])
+("vsuf" ["" ""])
+("vsug" ["" "" ""])
+("vsuh" ["" "" "" ""])
+("vsui" ["ʹ" "ʽ" "ʵ" ""])
+("vsuj" ["ɽ" "ɽ"])
+("vsuu" ["" "" ""])
+("vsuv" ["ˮ"])
+("vsvb" [""])
+("vsvd" ["װ"])
+("vsvf" ["" ""])
+("vsvh" [""])
+("vsvi" ["֧" "֪" "ָ" "ֹ" "ֹ" "ֲ"])
+("vsvr" ["ר" "ת"])
+("vsvs" ["" ""])
+("vsvu" [""])
+("vsvv" ["֪"])
+("vswf" [""])
+("vswl" [""])
+("vswu" ["" ""])
+("vswz" ["ί" "ξ" ""])
+("vsxc" ["С" "У" "Т"])
+("vsxd" [""])
+("vsxi" [""])
+("vsxm" [""])
+("vsxn" ["" "" "" "" ""])
+("vsxp" ["Ѯ"])
+("vsxr" ["ѡ"])
+("vsxt" ["ѧ"])
+("vsxy" ["" "" "" ""])
+("vsy'" ["֮"])
+("vsya" [""])
+("vsyb" ["" ""])
+("vsye" ["Ҷ"])
+("vsyh" [""])
+("vsyi" ["ҽ" "" ""])
+("vsyk" ["ҩ" "Ҫ"])
+("vsyn" [""])
+("vsyr" ["ԭ"])
+("vsys" ["ӹ" "" ""])
+("vsyt" ["Խ"])
+("vsyu" ["" "" ""])
+("vsyy" ["Ӫ"])
+("vszi" ["" ""])
+("vszl" [""])
+("vszu" [""])
+("vt'" ["״̬"])
+("vtb'" [""])
+("vtcu" ["״̬"])
+("vtdd" ["ս춷"])
+("vtdh" ["־ͬ"])
+("vtg'" ["̼"])
+("vttl" ["ר"])
+("vtxu" ["̽С˵"])
+("vty'" ["ͶӰ"])
+("vtzy" [""])
+("vu'" ["֪ʶ"])
+("vubh" [""])
+("vubi" ["" ""])
+("vubj" ["" ""])
+("vubk" ["鱦"])
+("vubm" [""])
+("vubu" [""])
+("vubz" [""])
+("vuce" ["ע"])
+("vuch" [""])
+("vuci" ["" "" "" "ף"])
+("vucp" [""])
+("vucs" [""])
+("vud'" ["ָʾ" ""])
+("vudi" ["פ"])
+("vudk" [""])
+("vuds" [""])
+("vudy" ["" "ע"])
+("vue'" "")
+("vuer" ["" ""])
+("vufa" [""])
+("vufg" [""])
+("vufh" ["ס" "פ"])
+("vufj" ["ֱɻ" ""])
+("vufu" ["" "" "ף"])
+("vufz" ["֪ʶ" ""])
+("vugd" [""])
+("vuge" ["" ""])
+("vugf" [""])
+("vugh" [""])
+("vugj" ["" "" ""])
+("vugr" ["" "" "" ""])
+("vugs" ["" "" "" "" ""])
+("vugu" [""])
+("vuh'" ["ʱ" "֪ʶ"])
+("vuhb" [""])
+("vuhe" ["ף"])
+("vuhl" ["麣"])
+("vuhs" [""])
+("vuhu" ["ָ" "ס" "ʽ"])
+("vuhw" ["פ"])
+("vuig" ["" "" ""])
+("vuih" [""])
+("vuii" [""])
+("vuij" [""])
+("vuis" [""])
+("vuiu" ["" "ס"])
+("vuj'" ["" "ֱ" "ָʾ" ""])
+("vujc" ["" "" "" "ע"])
+("vujd" ["齭" "" ""])
+("vuji" ["" ""])
+("vujm" ["" "" "" "" ""])
+("vujp" ["" "פ"])
+("vujq" ["ף"])
+("vujr" ["Ȧ"])
+("vuju" [""])
+("vujw" ["ס"])
+("vujx" ["" "ע"])
+("vujy" ["ס"])
+("vukb" ["ס"])
+("vuke" ["" ""])
+("vul'" ["" "" ""])
+("vulb" ["¥"])
+("vuli" ["" "" ""])
+("vulm" ["" ""])
+("vuln" [""])
+("vulq" ["" "פ"])
+("vulu" ["¼" "·"])
+("vuma" [""])
+("vumf" [""])
+("vumu" ["עĿ"])
+("vumy" ["" "" ""])
+("vuni" ["ף"])
+("vunm" [""])
+("vunn" ["ף"])
+("vup'" ["װƷ"])
+("vupi" ["Ƥ"])
+("vupk" [""])
+("vuq'" ["" "" "" "" "" "" "" "٪" "ۥ" "" "" "" "" "" "" "ָʾ"])
+("vuqi" [""])
+("vuqm" ["ǩ"])
+("vuqn" ["֪ʶ"])
+("vuqr" ["Ȩ"])
+("vur'" "סעףפ")
+("vurb" [""])
+("vurf" ["" ""])
+("vuri" [""])
+("vurj" ["ȼ"])
+("vuru" ["" "ע"])
+("vurv" [""])
+("vuso" ["ס"])
+("vusp" [""])
+("vusr" [""])
+("vuss" [""])
+("vusu" ["ס" "ע"])
+("vut'" ["" "ͼ"])
+("vutb" ["ͷ" "ͷ"])
+("vutc" [""])
+("vuti" ["" "" ""])
+("vuto" [""])
+("vuts" ["Ͳ"])
+("vutx" [""])
+("vuua" ["ɰ"])
+("vuub" ["" "ס" "ף" "פ"])
+("vuue" ["ע"])
+("vuug" [""])
+("vuui" ["ʳ" "" "ʯ" "ע" "ע"])
+("vuuj" [""])
+("vuuu" ["" ""])
+("vuuv" ["עˮ"])
+("vuuy" ["˧"])
+("vuva" ["פ"])
+("vuvb" [""])
+("vuve" ["" ""])
+("vuvh" ["" ""])
+("vuvi" ["֦" "ֵ" "ּ" "" "סַ"])
+("vuvj" ["ս"])
+("vuvl" ["סլ"])
+("vuvs" ["ע"])
+("vuw'" "")
+("vuwf" [""])
+("vuwh" [""])
+("vuwz" ["λ"])
+("vux'" ["ʵ"])
+("vuxc" ["ע"])
+("vuxd" ["" ""])
+("vuxi" ["" "ϯ" "ϯ"])
+("vuxm" [""])
+("vuxr" ["ѡ"])
+("vuxt" ["ѧ"])
+("vuxw" [""])
+("vuxy" ["" ""])
+("vuy'" ["װ"])
+("vuyb" ["" "" "ע"])
+("vuye" ["Ҷ"])
+("vuyi" ["һ" "" "" "ע"])
+("vuyk" ["Ҫ"])
+("vuyn" ["" "ע"])
+("vuyr" ["סԺ" "ףԸ"])
+("vuyt" [""])
+("vuyu" [""])
+("vuyy" ["Ӫ"])
+("vuzi" ["" "" "" "" "" "" ""])
+("vuzk" [""])
+("vuzl" [""])
+("vuzo" [""])
+("vuzs" [""])
+("vv'" [""])
+("vvb'" ["ֵ" "β"])
+("vvbl" ["֮"])
+("vvbn" ["α"])
+("vvbu" ["׷"])
+("vvd'" ["ִ" "ת۵"])
+("vvdc" ["׷"])
+("vvdk" ["׷"])
+("vvdu" ["׶"])
+("vvdw" ["֮"])
+("vvf'" ["η"])
+("vvfz" ["׷"])
+("vvgj" ["׷"])
+("vvgu" ["׵"])
+("vvhe" ["׺"])
+("vvhr" ["׷"])
+("vvhv" ["׷" "׹"])
+("vvia" ["׷"])
+("vvj'" ["μ" "״" "ξ"])
+("vvji" ["׷"])
+("vvjq" ["׷"])
+("vvjw" ["׷"])
+("vvjx" ["ξѧ"])
+("vvk'" ["ο"])
+("vvlo" ["׹"])
+("vvmm" ["׶"])
+("vvmv" [""])
+("vvp'" ["֯Ʒ"])
+("vvq'" "׵׶׷")
+("vvql" ["Ȩ"])
+("vvqq" ["" "׷"])
+("vvqu" ["֣"])
+("vvr'" "׸׹׺")
+("vvru" [""])
+("vvsu" ["׷" "׷"])
+("vvsv" ["׷"])
+("vvti" ["׶"])
+("vvu'" ["֣"])
+("vvuh" ["׷"])
+("vvuu" ["ʵʵ" "׷" "׸"])
+("vvvd" ["רƶ"])
+("vvvi" ["ָ"])
+("vvvt" ["ս״̬"])
+("vvvu" ["׷"])
+("vvwf" ["׷"])
+("vvww" ["֧֧"])
+("vvwy" ["ίԱ"])
+("vvxp" ["׷Ѱ"])
+("vvxu" ["Э"])
+("vvxw" ["׹"])
+("vvxy" ["׶"])
+("vvy'" ["ָսԱ" "ֲҵ" "ֲ԰"])
+("vvyi" ["׷"])
+("vvyp" ["սƽ"])
+("vvzh" ["׷"])
+("vvzi" ["׶"])
+("vvzs" ["׷"])
+("vw'" ["ְ"])
+("vwbh" ["ֲﱣ"])
+("vwbu" ["ս޲ʤ"])
+("vwd'" ["γ"])
+("vwdb" ["ץ"])
+("vwdm" ["ץ"])
+("vwe'" "צ")
+("vwhj" ["Ļ"])
+("vwhk" ["ץ"])
+("vwhz" [""])
+("vwiu" ["ץ"])
+("vwjn" ["ץ"])
+("vwq'" "ץ")
+("vwqi" ["ץ"])
+("vwql" ["ֲȺ"])
+("vwqx" ["ֲϵ"])
+("vwr'" ["ծ"])
+("vwt'" ["ֲ"])
+("vwu'" ["" "λ"])
+("vwug" ["ץ"])
+("vwui" [""])
+("vwur" [""])
+("vwvu" ["ץס"])
+("vww'" [""])
+("vwx'" ["ֲѧ"])
+("vwxu" ["ѧ"])
+("vwy'" ["Ժ" "ֲ"])
+("vwz'" ["΢"])
+("vwzb" ["ץ"])
+("vwzi" ["צ"])
+("vwzv" ["֯֯"])
+("vx'" ["Щ"])
+("vxb'" ["չұ" "Ҳ" ""])
+("vxdi" ["ĶԳ"])
+("vxdl" ["Ҷ"])
+("vxg'" ["ҹ"])
+("vxgg" ["Ĺ"])
+("vxh'" ["չ"])
+("vxhy" ["ܻ"])
+("vxj'" ["" "ѧ" "Ľ" "ת"])
+("vxjr" ["Ȼ"])
+("vxkh" ["ȿֺ"])
+("vxl'" [""])
+("vxlq" ["ת"])
+("vxml" ["ִ"])
+("vxnr" [""])
+("vxq'" ["ת" "װж"])
+("vxqx" [""])
+("vxrl" ["Ⱦ"])
+("vxrw" [""])
+("vxsx" ["˼"])
+("vxt'" ["" "ϯ"])
+("vxu'" ["ֱϽ" "ѧ"])
+("vxuy" ["ʵ" "ʵҵ"])
+("vxv'" [""])
+("vxvv" ["ר־"])
+("vxx'" ["֣Т" "Сѧ"])
+("vxy'" ["Ҫ"])
+("vxyd" ["ֱ˶"])
+("vy'" ["ֻ"])
+("vyd'" ["۵"])
+("vydk" ["רҵԿ"])
+("vydt" ["̨"])
+("vye'" ["ת" ""])
+("vygs" ["רҵ˾"])
+("vyh'" ["רҵ" "רҵ"])
+("vyix" ["׿гЧ"])
+("vyj'" ["־Ը" "" "ץһ" "װһ"])
+("vyjj" ["רû"])
+("vyjq" ["뼯Ȩ"])
+("vyjw" ["ί"])
+("vyjy" ["רҵ"])
+("vyk'" ["רҵ"])
+("vyl'" ["Ҷ" "Ӧ"])
+("vymd" ["Ҫì"])
+("vyq'" ["ק" "ռȨ" ""])
+("vyqj" ["鱨"])
+("vyr'" "ҷק")
+("vyry" ["רҵԱ" "ҪԱ"])
+("vyu'" ["Ҷ" ""])
+("vyuv" ["Ҫ"])
+("vyv'" ["Ԫ"])
+("vyvf" [""])
+("vyvp" ["ҡײƭ"])
+("vyvu" ["רҵ֪ʶ"])
+("vyvv" ["ս"])
+("vywh" ["ίԱ"])
+("vywt" ["Ҫ"])
+("vyx'" ["Ҫ" "ר"])
+("vyy'" ["Ժ"])
+("vyyh" ["רҵ"])
+("vyyy" ["Ҫԭ"])
+("vyzm" ["עĸ"])
+("vz'" ["ְ"])
+("vzbj" ["Ӱټ"])
+("vzd'" ["" "ӵ"])
+("vzg'" ["פڹ"])
+("vzl'" [""])
+("vzqu" [""])
+("vzr'" "")
+("vzt'" [""])
+("vzvy" [""])
+("vzx'" [""])
+("vzy'" ["԰"])
+("w" "")
+("wabu" ["ڲ"])
+("wadi" ["ݵ"])
+("wae'" "")
+("waer" ["߶"])
+("wafh" ["߷"])
+("wagj" ["洸"])
+("wagr" ["߹"])
+("wags" ["߹"])
+("waiu" ["ڳ"])
+("wajt" ["ھ"])
+("wajx" ["߽"])
+("waku" ["ڿ"])
+("wala" [""])
+("wali" [""])
+("walo" [""])
+("walp" [""])
+("wapf" [""])
+("waq'" "")
+("waqm" ["Ǳ"])
+("war'" "")
+("wasi" ["˹"])
+("wat'" "")
+("wate" [""])
+("wau'" ["ʯ"])
+("waw'" "")
+("wawa" [""])
+("waxm" [""])
+("ways" ["Ӿ"])
+("wazi" ["" ""])
+("wb'" [""])
+("wbcz" ["ʴ"])
+("wbn'" [""])
+("wbub" ["ⲿ豸"])
+("wbwj" ["ޱ޼"])
+("wbx'" [""])
+("wbxt" ["䱸ѧ"])
+("wbzd" ["΢"])
+("wbzx" ["" ""])
+("wc'" ["Ϊ"])
+("wcbf" ["ͷ"])
+("wcbv" ["Ͳ"])
+("wce'" ["϶"])
+("wckj" ["ռ"])
+("wd'" ["ҵ"])
+("wdi'" ["¶ȳ"])
+("wdj'" ["¶ȼ" "ȶ"])
+("wdl'" ["·"])
+("wdlx" ["ΰ" "ΰëϯ"])
+("wdly" ["ά"])
+("wdm'" ["κ"])
+("wdml" ["Σ"])
+("wdtd" ["¶ݶ"])
+("wdug" ["ʮ"])
+("wdx'" ["ȶ"])
+("wdxt" ["޶̼"])
+("wdyv" ["޶"])
+("wdz'" ["΢"])
+("webz" ["޶"])
+("weuw" ["η"])
+("wex'" ["ѷ"])
+("wf'" ["޷"])
+("wfb'" [""])
+("wfbc" ["±"])
+("wfbf" ["ı"])
+("wfbi" ["ı"])
+("wfbj" ["ư"])
+("wfbk" ["±"])
+("wfbu" ["Ȳ"])
+("wfcp" ["´"])
+("wfda" ["ʴ"])
+("wfdh" ["ȵ"])
+("wfdl" ["΢ֵ·" "´"])
+("wfdu" ["¶"])
+("wfdy" ["ȶ"])
+("wfe'" "")
+("wfed" ["ŷ"])
+("wffa" ["ķ"])
+("wffg" ["ķ" "ŷ"])
+("wffi" ["΢ַ"])
+("wfge" ["ĸ"])
+("wfgg" ["޷ֹ"])
+("wfgk" ["ĸ" "ĸ"])
+("wfgr" ["Ĺ"])
+("wfgu" ["ȹ"])
+("wfhb" ["ʺ"])
+("wfhe" ["º" "Ǻ"])
+("wfhk" ["ĺ" "ʺ" "ʺ"])
+("wfho" ["Ļ"])
+("wfhw" ["Ļ" "ʻ"])
+("wfia" ["²"])
+("wfid" ["´"])
+("wfih" ["Ĳ"])
+("wfis" ["ó"])
+("wfjc" ["Ľ"])
+("wfji" ["ļ" "ʼ"])
+("wfjm" ["ļ" "ż" "Ƚ"])
+("wfju" ["ľ" "ľ"])
+("wfjy" ["ľ" "ʾ"])
+("wfke" ["Ŀ"])
+("wfld" [""])
+("wfli" ["" ""])
+("wflj" ["ΥҼ"])
+("wfll" [""])
+("wflm" [""])
+("wflq" ["" ""])
+("wflr" [""])
+("wflu" ["·"])
+("wfmh" ["ä"])
+("wfmy" ["" ""])
+("wfnr" ["ů"])
+("wfpy" ["ƾ"])
+("wfq'" "")
+("wfqr" ["Ȫ"])
+("wfqy" [""])
+("wfr'" "")
+("wfrb" [""])
+("wfrf" [""])
+("wfro" [""])
+("wfti" ["" ""])
+("wfto" [""])
+("wfui" ["" ""])
+("wfuu" ["" ""])
+("wfuv" ["ˮ"])
+("wfv'" ["֮"])
+("wfvb" [""])
+("wfvh" [""])
+("wfvl" ["ժ"])
+("wfvs" ["" ""])
+("wfvu" ["ס"])
+("wfw'" "")
+("wfwh" [""])
+("wfwu" ["" ""])
+("wfxi" ["ϰ"])
+("wfxm" [""])
+("wfxp" ["Ѷ" "Ѷ"])
+("wfxq" ["а"])
+("wfxr" ["ѡ"])
+("wfxt" ["ѧ"])
+("wfxw" ["ΥΪ"])
+("wfya" ["" "ѹ"])
+("wfyd" ["巴˶"])
+("wfyh" [""])
+("wfyi" ["" "" ""])
+("wfyj" [""])
+("wfyu" [""])
+("wfzd" ["Ϊ"])
+("wfze" [""])
+("wfzi" ["" ""])
+("wg'" ["ҹ"])
+("wgd'" ["ڸɴ"])
+("wgdi" ["޹糵"])
+("wge'" "")
+("wggl" ["޹"])
+("wgiq" ["ų"])
+("wgj'" ["߸ھ" "޹"])
+("wgl'" ["幫"])
+("wglz" ["΢"])
+("wgn'" ["ū"])
+("wgq'" "")
+("wgqx" ["⹫"])
+("wgr'" "޳")
+("wguj" ["΢"])
+("wgus" ["ʮɫ"])
+("wgvx" ["¹֪"])
+("wgw'" ["ά"])
+("wgwg" [""])
+("wgy'" [""])
+("wh'" ["Ļ"])
+("whb'" ["Ļ㱨" "Ļ"])
+("whba" [""])
+("whbf" [""])
+("whbm" ["廨"])
+("whdc" [""])
+("whdi" [""])
+("whdk" ["" ""])
+("whdm" ["" "Ļ"])
+("whdp" [""])
+("whe'" "")
+("whfa" ["" ""])
+("whfj" [""])
+("whfu" ["" ""])
+("whg'" ["Ļ" "Ļ"])
+("whgo" ["" ""])
+("whgr" ["" ""])
+("whgs" ["" ""])
+("whhb" ["" "" ""])
+("whhy" [""])
+("whid" ["Ļ̶"])
+("whig" [""])
+("whih" [""])
+("whik" [""])
+("whis" [""])
+("whji" ["" "" ""])
+("whjm" [""])
+("whjx" [""])
+("whkd" [""])
+("whkl" [""])
+("whks" [""])
+("whlc" [""])
+("whld" ["ﻯͶ"])
+("whll" [""])
+("whlo" ["" ""])
+("whmg" [""])
+("whmh" ["ç"])
+("whmo" ["Ĥ"])
+("whmy" ["" ""])
+("whnm" [""])
+("whq'" ["" "" "δ" ""])
+("whqm" ["ǰ"])
+("whqq" [""])
+("whqr" ["Ȩ"])
+("whqt" ["ȴ"])
+("whqy" [""])
+("whr'" "")
+("whrf" [""])
+("whri" [""])
+("whrj" ["Ȼ"])
+("whsy" [""])
+("whtk" [""])
+("whtl" ["̨"])
+("whtu" ["ͼ"])
+("whu'" ["ɽ" "人"])
+("whug" ["ʢ"])
+("whuh" ["" ""])
+("whui" ["" ""])
+("whup" ["Ļˮƽ"])
+("whuv" ["ˮ"])
+("whvd" ["ׯ" "״"])
+("whve" [""])
+("whvi" [""])
+("whvu" ["ְ"])
+("whw'" "â")
+("whwh" ["" "" ""])
+("whwn" ["ʺů"])
+("whwo" [""])
+("whwz" ["ά" "λ"])
+("whx'" ["Σ"])
+("whxd" ["" ""])
+("whxi" [""])
+("whxw" [""])
+("whxy" [""])
+("whyb" [""])
+("whye" ["ү"])
+("whyh" [""])
+("whyj" [""])
+("whyl" ["Ļ"])
+("whyr" ["Զ"])
+("whzi" [""])
+("whzo" [""])
+("wi'" [""])
+("wigi" ["Ȳ߲"])
+("wijj" ["޲׼" "޲׼"])
+("wijm" ["޲׼"])
+("wijv" ["޲׼ר"])
+("wilj" ["΢"])
+("win'" ["δ"])
+("wiqy" [""])
+("wiuy" ["˫"])
+("wj'" ["Σ"])
+("wjb'" ["⽻"])
+("wjbi" [""])
+("wjbk" [""])
+("wjbz" ["걸" ""])
+("wjdb" ["⽻" "㶹"])
+("wjdj" ["군"])
+("wjdk" [""])
+("wjdl" [""])
+("wjdm" [""])
+("wjdp" [""])
+("wjdu" [""])
+("wje'" "ݸ")
+("wjee" [""])
+("wjer" [""])
+("wjf'" ["΢"])
+("wjff" [""])
+("wjfh" [""])
+("wjfj" [""])
+("wjfl" ["޻"])
+("wjfu" [""])
+("wjg'" ["⽻"])
+("wjgs" ["깤"])
+("wjgu" ["" ""])
+("wjhk" [""])
+("wjho" [""])
+("wjhp" [""])
+("wjhu" ["" ""])
+("wjhv" ["" ""])
+("wjig" [""])
+("wjj'" ["ھ"])
+("wjji" [""])
+("wjjm" [""])
+("wjjn" [""])
+("wjjq" [""])
+("wjju" ["" ""])
+("wjjx" [""])
+("wjkg" ["޼ҿɹ"])
+("wjkh" ["翹"])
+("wjl'" ["޼"])
+("wjlc" [""])
+("wjli" ["" "" ""])
+("wjlq" [""])
+("wjlu" ["·"])
+("wjmj" [""])
+("wjmp" ["޼ͶƱ"])
+("wjmz" [""])
+("wjng" [""])
+("wjnj" [""])
+("wjnm" ["" ""])
+("wjns" ["Ū"])
+("wjpi" ["Ƥ"])
+("wjq'" "")
+("wjqd" ["ǿ"])
+("wjqi" [""])
+("wjqm" ["ǧ"])
+("wjqq" [""])
+("wjqr" ["ȫ" "ȫ"])
+("wjqu" [""])
+("wjr'" "")
+("wjrf" ["" ""])
+("wjro" [""])
+("wjru" [""])
+("wjsm" ["彲"])
+("wjsv" [""])
+("wjtb" ["ͷ"])
+("wjtq" ["⽻Ȩ"])
+("wjty" [""])
+("wjub" [""])
+("wjud" ["˪"])
+("wjuh" ["" ""])
+("wjui" ["" "ʯ" "" "" ""])
+("wjuj" ["⽻ʹ" ""])
+("wjuu" [""])
+("wjuw" ["ˣ"])
+("wjvd" ["״"])
+("wjvg" [""])
+("wjvh" [""])
+("wjvs" [""])
+("wjvu" ["ָ"])
+("wjw'" ["" "" "" "" "" "ܹ" "" ""])
+("wjwj" [""])
+("wjwu" ["" "" "޾"])
+("wjwz" ["ζ"])
+("wjx'" [""])
+("wjxc" ["Ц"])
+("wjxd" [""])
+("wjxi" ["ϧ"])
+("wjxm" [""])
+("wjxw" ["ϼ"])
+("wjy'" ["Բ" "޻"])
+("wjyb" [""])
+("wjyi" ["" "" "һ"])
+("wjyj" ["" "" ""])
+("wjyk" ["ҩ"])
+("wjyr" ["Ԫ"])
+("wjys" [""])
+("wjyu" ["޼"])
+("wjz'" ["⾴"])
+("wjzi" [""])
+("wkfg" ["޿ɷ"])
+("wkfy" ["޿ɷ"])
+("wkl'" ["ڿ"])
+("wknh" ["޿κ"])
+("wkvb" ["޿"])
+("wkxs" ["ڿ˼"])
+("wl'" ["Ϊ"])
+("wlbc" [""])
+("wlbh" ["仯"])
+("wlbm" [""])
+("wlbn" [""])
+("wlbu" ["ⲿ"])
+("wlcp" [""])
+("wldc" [""])
+("wldi" ["" ""])
+("wldm" [""])
+("wle'" "")
+("wlfg" [""])
+("wlfi" [""])
+("wlgo" [""])
+("wlgr" [""])
+("wlgs" ["⹫"])
+("wlhh" [""])
+("wlhk" [""])
+("wlhl" ["⺣"])
+("wlho" [""])
+("wlhr" ["⻼"])
+("wlhv" [""])
+("wlhx" ["ѧ"])
+("wli'" [""])
+("wlih" ["ⳡ"])
+("wlii" ["ﳤ"])
+("wliv" ["ﳤ"])
+("wljc" ["⽻" ""])
+("wljm" [""])
+("wljw" [""])
+("wljx" ["" ""])
+("wlke" ["" ""])
+("wlli" [""])
+("wlll" [""])
+("wllq" [""])
+("wlmk" ["ò" "ó"])
+("wlmm" [""])
+("wlmq" ["³ľ"])
+("wlpj" [""])
+("wlpo" [""])
+("wlq'" "")
+("wlqc" [""])
+("wlqi" ["" ""])
+("wlqn" ["" "ȡ"])
+("wlqu" [""])
+("wlr'" "")
+("wlrf" [""])
+("wlrh" [""])
+("wlsp" [""])
+("wltb" ["ͷ"])
+("wltk" ["" ""])
+("wlue" [""])
+("wlug" ["" "" "ʡ"])
+("wluh" [""])
+("wlui" ["ʷ" ""])
+("wlut" ["Ψͼ"])
+("wluv" ["ˮ"])
+("wlv'" ["»"])
+("wlvh" ["ⳤ"])
+("wlvi" [""])
+("wlvj" ["ᷢ"])
+("wlvl" ["ծ"])
+("wlvr" ["ת"])
+("wlwf" [""])
+("wlwu" ["" "" ""])
+("wlwz" ["Χ"])
+("wlx'" ["ѧ"])
+("wlxc" [""])
+("wlxd" ["" ""])
+("wlxj" ["ѧ"])
+("wlxm" ["" ""])
+("wlxn" [""])
+("wlxt" ["ѧ"])
+("wlxv" [""])
+("wlxx" ["б"])
+("wlxy" [""])
+("wlyh" [""])
+("wlyi" [""])
+("wlyj" ["" ""])
+("wlyn" [""])
+("wlyr" ["Ԯ"])
+("wlys" ["" "΢Ԫ"])
+("wlyu" [""])
+("wlzi" ["" ""])
+("wlzl" [""])
+("wlzu" [""])
+("wlzy" [""])
+("wm'" [""])
+("wmb'" ["Ǳ" ""])
+("wmbt" [""])
+("wmjl" [""])
+("wml'" [""])
+("wmv'" ["ָ"])
+("wmwx" ["΢΢Ф"])
+("wmyx" ["Ӣ"])
+("wmz'" [""])
+("wn'" ["δ"])
+("wni'" ["ബ"])
+("wnjh" ["ƻ"])
+("wnrl" ["ί"])
+("wns'" ["˹"])
+("wnwl" ["Ϊ"])
+("woai" ["Ұ"])
+("wobz" ["ұ" "ұ"])
+("woch" ["Ѳ"])
+("wode" ["ҵ"])
+("wodh" ["ҵ"])
+("wodk" ["Ե"])
+("wodp" ["ֶ"])
+("woe'" "")
+("wofh" ["ҷ" "Է"])
+("wogo" ["ҹ"])
+("wogs" ["ѹ"])
+("wohe" ["Һ"])
+("woho" ["ѻ"])
+("wohv" ["һ"])
+("wojd" ["ҽ"])
+("wojn" ["ս"])
+("wojp" ["Ҿ"])
+("wokb" [""])
+("wokj" ["ҿ"])
+("woll" [""])
+("wolp" [""])
+("wolq" [""])
+("womf" [""])
+("wonq" ["ţ"])
+("wopg" [""])
+("wopu" [""])
+("woq'" "ݫ")
+("wor'" "Ŷ")
+("woso" [""])
+("wotb" ["ͷ"])
+("woub" [""])
+("woui" ["" "ʽ" ""])
+("wouo" ["˵"])
+("wovu" ["ס"])
+("wow'" "Ŷ")
+("wowo" ["ݫݫ"])
+("woxd" [""])
+("woxr" [""])
+("wozl" [""])
+("wq'" ["ȫ"])
+("wqby" ["ΪڲԶ"])
+("wqtx" ["ͽ"])
+("wqwj" ["޾"])
+("wqxf" ["Ȩܷ"])
+("wrf'" [""])
+("wrif" ["εȻɷ"])
+("wrjj" ["˼ʻɻ"])
+("wrqt" [";"])
+("wrub" ["Ϊʦ"])
+("wsbd" ["˿"])
+("wsbh" ["λƱ任"])
+("wslj" ["ｭ"])
+("wsr'" ["˼"])
+("wsvx" ["λ"])
+("wsw'" ["ν"])
+("wsyd" ["˶"])
+("wsyw" ["ΪΪ"])
+("wszw" ["Ϊ"])
+("wt'" [""])
+("wtb'" ["а"])
+("wtf'" ["͢"])
+("wth'" ["ͬ" "̫"])
+("wtj'" ["" ""])
+("wtm'" ["Ĥ"])
+("wttd" ["Ͷ"])
+("wtu'" ["̨ɽ"])
+("wty'" ["ͥ"])
+("wu'" [""])
+("wub'" [""])
+("wuba" [""])
+("wubi" ["ޱ" "" "" ""])
+("wubj" [""])
+("wubk" ["屣"])
+("wubl" [""])
+("wubm" ["ޱ"])
+("wubu" ["޲" "޲"])
+("wubv" ["׼"])
+("wubz" ["ᱲ" "䱸"])
+("wucj" [""])
+("wucl" [""])
+("wucs" ["޴"])
+("wud'" ["ʿ"])
+("wuda" ["ڴ" ""])
+("wudb" ["䶷"])
+("wude" [""])
+("wudi" ["޵" ""])
+("wudj" ["´"])
+("wudk" ["赸"])
+("wudl" [""])
+("wudm" ["۵" ""])
+("wudr" ["޶" ""])
+("wuds" ["趯" ""])
+("wudu" ["޶" "޶" "嶾"])
+("wudy" ["ݶ"])
+("wue'" "")
+("wuer" ["ڶ"])
+("wufa" ["޷"])
+("wufh" ["" "޷" "巽"])
+("wufj" ["緹"])
+("wufy" [""])
+("wufz" ["޷"])
+("wugb" ["۹"])
+("wugd" [""])
+("wuge" [""])
+("wugg" [""])
+("wugh" ["ٸ"])
+("wugk" ["ܸ"])
+("wugr" ["޹" "" "" ""])
+("wugs" ["书" ""])
+("wugu" ["޹" "޹" "" ""])
+("wugv" ["ڹ"])
+("wugy" ["޹"])
+("wuhb" ["ݺ" ""])
+("wuhj" ["" "人"])
+("wuhl" ["޺"])
+("wuhr" ["ڻ"])
+("wuhu" ["غ" "ߺ"])
+("wuhv" ["ۻ" "" ""])
+("wuhw" ["ﻯ"])
+("wuhz" ["ں"])
+("wui'" [""])
+("wuia" [""])
+("wuig" ["޳"])
+("wuih" ["޳" "޳" "" "峣" "賡"])
+("wuii" ["޳" ""])
+("wuij" ["޲" ""])
+("wujb" ["¾㱸"])
+("wujd" ["ڽ"])
+("wuji" ["ݼ" "޻" "޻" "޼" "޼" "޼"])
+("wujm" ["޼" "轣" ""])
+("wujn" ["" ""])
+("wujt" [""])
+("wuju" [""])
+("wujw" ["ݼ" ""])
+("wujx" [""])
+("wujy" ["ﾵ"])
+("wuke" ["޿"])
+("wukv" [""])
+("wula" [""])
+("wulc" [""])
+("wuld" ["" ""])
+("wuli" ["" "" "" "" "" "" ""])
+("wull" ["" ""])
+("wuln" [""])
+("wulp" ["" ""])
+("wuls" ["" ""])
+("wulu" ["·"])
+("wulv" [""])
+("wuly" ["" ""])
+("wum'" ["Ϊʲô"])
+("wuma" [""])
+("wumf" [""])
+("wumm" [""])
+("wumx" ["" ""])
+("wumy" ["" ""])
+("wumz" ["÷" ""])
+("wunb" ["ʮ겻"])
+("wung" [""])
+("wuni" [""])
+("wunl" [""])
+("wuns" ["ũ"])
+("wunv" ["Ů"])
+("wupc" ["Ʊ"])
+("wupn" ["Ʒ"])
+("wupo" [""])
+("wuq'" ["" "" "" "" "" "" "" "" "أ" "" "" "" "˪"])
+("wuqi" ["" "" ""])
+("wuqm" ["ǰ" "ǰ" "ǧ" "ǰ"])
+("wuqq" [""])
+("wuqr" ["Ȩ"])
+("wuqs" [""])
+("wuqt" ["ȱ"])
+("wuqu" [""])
+("wuqy" [""])
+("wur'" "أ")
+("wurf" ["" "" "" ""])
+("wuri" [""])
+("wurj" ["Ⱦ"])
+("wuru" ["" "" ""])
+("wus'" ["ά" ""])
+("wuse" ["ɫ" "ɫ" "ɫ"])
+("wusi" ["˿" "˽" ""])
+("wuss" ["" ""])
+("wusu" [""])
+("wuta" [""])
+("wutb" ["ͷ"])
+("wuti" [""])
+("wutl" ["̨" "̨" "̬"])
+("wuts" ["ͩ"])
+("wuty" [""])
+("wuua" ["ɰ"])
+("wuud" ["˫"])
+("wuug" ["" ""])
+("wuuh" [""])
+("wuui" ["" "ʿ" "ʮ" "ʱ" "ʰ" "" "ʹ" ""])
+("wuuj" ["ɽ"])
+("wuuu" ["" "" ""])
+("wuuv" ["ˮ" "ˮ" "˯"])
+("wuv'" ["ʿ" "װ"])
+("wuvb" ["" ""])
+("wuvd" ["װ"])
+("wuve" [""])
+("wuvg" ["֤"])
+("wuvi" ["֪" "ָ" ""])
+("wuvo" [""])
+("wuvs" ["" "" "" "" ""])
+("wuvu" ["" ""])
+("wuw'" "")
+("wuwh" [""])
+("wuwj" ["޽" ""])
+("wuwk" ["ʱ޿"])
+("wuwl" [""])
+("wuwo" [""])
+("wuwu" ["" "" ""])
+("wuwx" ["΢ѧ"])
+("wuwz" ["Ϊ" "ζ" "η" "ν" "" "ζ"])
+("wuxc" ["Ч"])
+("wuxd" ["" "" ""])
+("wuxm" ["" "" "" ""])
+("wuxn" [""])
+("wuxq" [""])
+("wuxu" ["" "" "" ""])
+("wuxw" ["Ͽ" "Ͼ"])
+("wuxy" ["" "" "" "" "" "" "" ""])
+("wuya" ["ѻ"])
+("wuye" ["ҹ"])
+("wuyi" ["" "" "" "" "" "һ"])
+("wuyj" [""])
+("wuyn" [""])
+("wuyp" [""])
+("wuyr" ["Ԫ"])
+("wuys" ["" "ӹ" ""])
+("wuyt" ["Խ" ""])
+("wuyu" ["" ""])
+("wuyy" ["Ӫ"])
+("wuzh" [""])
+("wuzi" ["" "" "" ""])
+("wuzu" [""])
+("wuzv" [""])
+("wv'" ["λ"])
+("wvb'" ["ʲ"])
+("wvbd" ["װ"])
+("wvcf" ["ʲƸ"])
+("wvdv" ["װ"])
+("wvft" ["״̬"])
+("wvj'" ["Ѿ" "ֹ"])
+("wvjg" ["״ṹ"])
+("wvjl" ["ʽ"])
+("wvll" ["װ" ""])
+("wvql" ["װ"])
+("wvu'" ["δ֪" "ָɽ"])
+("wvuy" [""])
+("wvwq" ["ȱ"])
+("wvx'" ["κ"])
+("wvyx" ["һ"])
+("wwbv" ["΢"])
+("wwd'" ["κĵ"])
+("wwez" ["ά"])
+("wwl'" ["Ψ"])
+("wwqq" ["" "ȫȫ"])
+("wwr'" [""])
+("wwsv" ["ɥ־"])
+("wwug" ["Ψʷ"])
+("wwvv" ["Ψ"])
+("wwvy" ["Ψ"])
+("wwyu" ["һʧ"])
+("wwz'" ["ζ"])
+("wx'" ["΢"])
+("wxb'" ["С"])
+("wxbf" ["䷨"])
+("wxd'" ["ִ" "޴" "ߵ"])
+("wxdb" ["ߵ籨" "ߵ粨" "ߵ㲥"])
+("wxdh" ["ߵ绰"])
+("wxdj" ["ߵջ"])
+("wxdt" ["ߵ̨"])
+("wxdu" ["ǵ"])
+("wxdw" ["ߵ綨λ"])
+("wxdx" ["ߵѧ" "ߵͨ"])
+("wxf'" [""])
+("wxhq" ["Ǻ"])
+("wxid" ["н"])
+("wxj'" ["" "΢ͻ" "ѧ"])
+("wxl'" ["Ψ"])
+("wxsj" ["ά˹"])
+("wxtx" ["ͨ"])
+("wxu'" ["ѧʷ"])
+("wxug" ["Ψʷ"])
+("wxv'" ["" "ֹ"])
+("wxvb" [""])
+("wxvy" ["Ψ"])
+("wxwk" [""])
+("wxx'" ["Σ"])
+("wxyz" ["ԭ"])
+("wxzj" ["ӽ"])
+("wy'" [""])
+("wydb" ["õ"])
+("wydh" [""])
+("wydl" ["λƵ"])
+("wyfx" ["ո"])
+("wyh'" ["ίԱ"])
+("wyj'" ["Զ"])
+("wyl'" [""])
+("wyls" ["ɫ"])
+("wym'" ["" "ú"])
+("wyn'" ["" "άҲ"])
+("wyu'" ["ʶ" "ʫ"])
+("wyv'" ["ίԱ"])
+("wywg" ["Ե޹"])
+("wywz" ["Ӱ"])
+("wyyl" [""])
+("wyz'" ["ԭ"])
+("wz'" [""])
+("wzai" ["θ"])
+("wzan" ["΢"])
+("wzba" ["Ϊ" "β"])
+("wzbi" ["" "δ"])
+("wzbm" ["δ"])
+("wzbo" ["΢" "΢"])
+("wzbu" ["β"])
+("wzby" ["θ" ""])
+("wzbz" ["Υ"])
+("wzcg" ["δ"])
+("wzci" ["Ϊ" "λ"])
+("wzda" ["ΰ"])
+("wzdc" ["ή"])
+("wzdg" ["Φ"])
+("wzdk" ["ζ" ""])
+("wzdl" ["΢"])
+("wzdu" ["Ψ" "Ω" "γ"])
+("wzdv" [""])
+("wzdy" ["δ"])
+("wze'" "Ψέήίΰαβγ")
+("wzee" ["Ρ"])
+("wzer" [""])
+("wzfa" ["Υ"])
+("wzff" ["΢"])
+("wzfg" ["" "΢"])
+("wzfh" ["Ϋ"])
+("wzfj" ["Υ" "Υ"])
+("wzfu" ["΢" "Ϊ"])
+("wzgj" ["Φ"])
+("wzgo" ["κ" ""])
+("wzgr" ["΢" "Χ"])
+("wzgs" ["Χ"])
+("wzhe" ["Ϊ"])
+("wzhl" ["" "Σ"])
+("wzhp" ["δ"])
+("wzhu" ["ά" ""])
+("wzhv" ["ί"])
+("wzig" ["Χ"])
+("wzih" ["δ" "θ"])
+("wzii" ["ά"])
+("wzjc" ["Χ"])
+("wzji" ["΢" "Σ" "Σ" "Σ" "άϵ" "ΰ"])
+("wzjm" ["Χ" "Ϊ"])
+("wzjn" ["Χ" "δ"])
+("wzjp" ["α"])
+("wzjt" ["δ" "ζ"])
+("wzju" ["η"])
+("wzjy" ["δ" "δ" "ζ" "θ"])
+("wzkb" ["θ"])
+("wzkd" ["β"])
+("wzke" ["δ"])
+("wzkf" ["Χ"])
+("wzkh" ["Υ"])
+("wzkp" ["Χ"])
+("wzks" ["Ψ" "Ω"])
+("wzl'" [""])
+("wzlc" ["Ϊ"])
+("wzld" ["΢"])
+("wzli" ["" "΢" "Υ" "Ϊ"])
+("wzlj" ["ε"])
+("wzlk" ["ο"])
+("wzll" ["δ"])
+("wzlm" [""])
+("wzlp" ["ά"])
+("wzmc" ["΢" "΢"])
+("wzmi" ["΢" "γ"])
+("wzmm" ["δ"])
+("wzmu" ["Ļ"])
+("wzmy" ["Ϊ"])
+("wzna" ["ά"])
+("wzng" ["δ" "λ"])
+("wznj" ["Σ" "Ϊ" "η"])
+("wznm" ["ή"])
+("wznn" ["Ϊ"])
+("wzpl" ["ί"])
+("wzq'" "Ρ΢Σήίޱ")
+("wzqd" ["Χǽ"])
+("wzqh" ["ǧ"])
+("wzqi" ["Χ" "Χ" "Ϊ" "β" "β"])
+("wzqp" ["Χȹ"])
+("wzqr" ["Ȩ"])
+("wzqu" ["ί"])
+("wzqv" [""])
+("wzr'" "Ϊδεζηθικλμνξο")
+("wzrf" ["Ϊ" "ί" "ΰ"])
+("wzrj" ["ΡȻ" "δȻ"])
+("wzrk" ["Χ"])
+("wzro" ["΢"])
+("wzso" ["ή" "η" ""])
+("wzsr" ["θ"])
+("wzsv" ["β" "δ"])
+("wzt'" [""])
+("wztc" ["΢"])
+("wzto" ["ί"])
+("wzua" ["γɴ"])
+("wzub" ["Ϊ"])
+("wzue" [""])
+("wzug" ["΢" "Ϊ" "β" ""])
+("wzui" ["" "Ϊʹ" "ίʵ" "δʼ" "ʿ"])
+("wzuj" ["α"])
+("wzuu" ["Ϊ" "β" "κ" ""])
+("wzuv" ["μˮ"])
+("wzvd" ["αװ"])
+("wzve" ["Χ" "Ϊ"])
+("wzvf" ["΢"])
+("wzvg" ["α֤"])
+("wzvh" ["Υ"])
+("wzvi" ["Ϊ֮" "Ϊֹ" "δ֪" "λ"])
+("wzvs" ["Ϊ"])
+("wzvu" ["Ϊ"])
+("wzw'" "ΤΥΦΧΨΩΪΫά")
+("wzwf" ["ο"])
+("wzwh" ["" "Σ" "Χ"])
+("wzwj" ["ί"])
+("wzwo" ["Ϊ"])
+("wzwu" ["" "Ψ"])
+("wzwz" ["ΡΡ" "΢΢"])
+("wzxc" ["΢С" "΢Ц"])
+("wzxd" ["λ"])
+("wzxi" ["΢ϸ"])
+("wzxm" ["Σ" "Υ" "γ"])
+("wzxn" ["" "Ψ" "ά"])
+("wzxq" ["ά"])
+("wzxw" [""])
+("wzxx" ["в"])
+("wzxy" ["΢" ""])
+("wzyb" ["Ω"])
+("wzye" ["θҺ"])
+("wzyh" ["ι"])
+("wzyi" ["Ψһ" "β" "λ"])
+("wzyj" ["" "΢" "Χ" "θ"])
+("wzyk" ["ιҩ"])
+("wzyr" ["ίԱ" "κԴ"])
+("wzyt" ["ΥԼ"])
+("wzyu" ["λ" "ν"])
+("wzzi" ["λ"])
+("wzzk" ["α"])
+("x" "С")
+("xaj'" ["°"])
+("xal'" ["˰"])
+("xald" ["İ"])
+("xau'" ["Ѳʹ" ""])
+("xb'" ["Ա"])
+("xbb'" ["ϸ"])
+("xbc'" ["Сײ"])
+("xbd'" ["Ų"])
+("xbf'" [""])
+("xbfl" ["ϸ"])
+("xbh'" ["ϸ"])
+("xbi'" ["Ѧ"])
+("xbly" [""])
+("xbm'" ["ϸĤ"])
+("xbn'" [""])
+("xbq'" ["ϸ"])
+("xbs'" ["ѡ"])
+("xbt'" ["ϸ" "벻ͨ" "Ĳ" "вͨ"])
+("xbu'" ["С"])
+("xbv'" ["ϸ"])
+("xbvx" ["֮"])
+("xbwq" ["С"])
+("xbx'" ["ϸѧ"])
+("xby'" ["" "ϸҺ" "°ҹ"])
+("xbz'" ["С"])
+("xbzy" ["Ĳ"])
+("xc'" ["´"])
+("xcbh" ["Ф"])
+("xcbj" ["С" "С"])
+("xcbk" ["С"])
+("xcbl" ["С"])
+("xcbm" ["С"])
+("xcbu" ["С"])
+("xcdc" ["С"])
+("xcde" [""])
+("xcdg" ["С"])
+("xcdi" ["С" "Т"])
+("xcdk" ["С" "С"])
+("xcds" ["С"])
+("xcdu" [""])
+("xcdv" ["С"])
+("xcdy" [""])
+("xce'" "С")
+("xcer" ["С"])
+("xcfa" ["Ч"])
+("xcfg" ["У"])
+("xcfh" ["" "Ч"])
+("xcfj" ["С"])
+("xcfu" ["С"])
+("xcfz" [""])
+("xcgb" ["С"])
+("xcgj" ["Т"])
+("xcgo" ["Ч"])
+("xcgs" ["С" "С"])
+("xcgu" ["С"])
+("xcgv" ["С"])
+("xchd" ["С"])
+("xche" ["С"])
+("xchk" ["" "С"])
+("xchl" ["С"])
+("xcho" ["С"])
+("xchs" [""])
+("xchu" ["С" "С"])
+("xchv" [""])
+("xchw" ["" "" "Ц"])
+("xcib" ["С"])
+("xcie" ["С"])
+("xcif" [""])
+("xcig" ["С"])
+("xcih" ["С"])
+("xcii" ["С"])
+("xcip" ["С"])
+("xcir" ["" "С"])
+("xciu" [""])
+("xcjc" ["С"])
+("xcjd" ["С"])
+("xcji" ["" ""])
+("xcjm" ["С"])
+("xcjn" ["" "С"])
+("xcjx" ["С" "С" "С" "С"])
+("xcjy" ["С" "Т" "Т"])
+("xcke" ["С"])
+("xckh" ["С"])
+("xckj" ["С"])
+("xcld" ["С"])
+("xcli" ["Ч"])
+("xclk" ["Ч"])
+("xclm" ["Т" "Ц"])
+("xcln" ["Ц"])
+("xclu" ["·"])
+("xclv" ["Ч"])
+("xcmi" ["С"])
+("xcmk" ["Сè" "Сë" "Цò"])
+("xcml" ["С"])
+("xcmo" ["ĥ"])
+("xcmx" [""])
+("xcmy" ["С"])
+("xcng" ["Ч"])
+("xcnk" ["С"])
+("xcns" ["Сũ"])
+("xcpn" ["СƷ"])
+("xcq'" "Ф")
+("xcqc" ["С"])
+("xcqi" ["С"])
+("xcqm" ["ǲ"])
+("xcqu" ["С"])
+("xcr'" "ТУФХЦЧ")
+("xcrf" ["С"])
+("xcro" [""])
+("xcrs" ["Ц"])
+("xcsa" [""])
+("xcsj" ["ɢ"])
+("xcsr" [""])
+("xcsv" ["С"])
+("xctb" ["С͵"])
+("xctc" [""])
+("xcti" ["С"])
+("xctv" ["" "С"])
+("xcty" ["Сͧ"])
+("xcub" ["" ""])
+("xcue" ["У"])
+("xcug" ["С" "С"])
+("xcui" ["ʯ" "ʧ" "" "Сʱ"])
+("xcuo" ["С˵"])
+("xcup" ["Т˳"])
+("xcuu" ["С" "С"])
+("xcuv" ["Сˮ"])
+("xcvh" ["" "" "С" "У"])
+("xcvi" ["Сָ"])
+("xcvj" ["Сվ"])
+("xcvs" ["" "Ч"])
+("xcw'" "")
+("xcwh" [""])
+("xcwl" ["У"])
+("xcwu" ["С"])
+("xcx'" ["޴ѧ"])
+("xcxc" ["" "СС"])
+("xcxd" ["С" "Ф"])
+("xcxi" ["Ϣ" "СϪ" "СϷ"])
+("xcxm" [""])
+("xcxn" ["С"])
+("xcxs" ["С"])
+("xcxt" ["Сѧ"])
+("xcxx" ["Сд"])
+("xcxy" ["С"])
+("xcya" ["С"])
+("xcyb" ["У"])
+("xcye" ["СҶ"])
+("xcyh" ["С"])
+("xcyi" ["Ч"])
+("xcyj" [""])
+("xcyk" ["ң"])
+("xcyr" ["У԰"])
+("xcys" ["Ч"])
+("xcyu" ["С" "С" "Ц"])
+("xcyy" ["ЧӦ"])
+("xcz'" ["С"])
+("xczh" [""])
+("xczi" ["" "С" "С" "Т"])
+("xczu" ["С"])
+("xd'" [""])
+("xdai" ["మ"])
+("xdan" ["㰸"])
+("xdbh" [""])
+("xdbi" [""])
+("xdbm" [""])
+("xdbz" ["" ""])
+("xdcl" [""])
+("xdcp" [""])
+("xdd'" ["õ" "Сܵ" "ֵܵ"])
+("xddg" [""])
+("xddh" ["൱" "絳"])
+("xddi" ["" ""])
+("xddk" ["뵽" ""])
+("xdds" ["춯" ""])
+("xddv" [""])
+("xde'" "")
+("xdey" ["Զ"])
+("xdfa" ["뷨"])
+("xdfg" [""])
+("xdfh" ["" "᷿"])
+("xdfj" ["෴" "差"])
+("xdfu" ["" "" ""])
+("xdge" [""])
+("xdgh" [""])
+("xdgj" [""])
+("xdgo" [""])
+("xdgr" ["" ""])
+("xdgs" ["๫"])
+("xdgu" ["㹽"])
+("xdgy" ["ִҵ"])
+("xdh'" ["ִ"])
+("xdhb" [""])
+("xdhe" [""])
+("xdhk" [""])
+("xdho" [""])
+("xdhu" ["໥"])
+("xdhv" [""])
+("xdhw" ["㻨"])
+("xdi'" [""])
+("xdia" [""])
+("xdie" ["쳹"])
+("xdif" [""])
+("xdig" ["" "" ""])
+("xdii" [""])
+("xdir" ["ഫ"])
+("xdiu" ["" "ദ" ""])
+("xdj'" ["ϴӼ" "ϼ"])
+("xdjc" ["ཻ" "㽶" ""])
+("xdjd" ["潭"])
+("xdji" ["" ""])
+("xdjm" ["" "" "" ""])
+("xdjn" ["" "꾡"])
+("xdjp" [""])
+("xdju" ["" ""])
+("xdjw" [""])
+("xdjx" ["" ""])
+("xdjy" ["㾫"])
+("xdkb" [""])
+("xdl'" ["" "" "µ"])
+("xdlc" [""])
+("xdld" ["" ""])
+("xdle" [""])
+("xdli" [""])
+("xdll" ["" ""])
+("xdlm" ["" ""])
+("xdln" [""])
+("xdlu" ["¯"])
+("xdlv" [""])
+("xdmk" ["ò" "é"])
+("xdmm" [""])
+("xdmu" ["Ŀ"])
+("xdnm" [""])
+("xdny" ["ִũҵ"])
+("xdpi" ["Ƥ"])
+("xdpm" ["Ƭ" "Ƭ"])
+("xdq'" "ܼ")
+("xdqi" ["" "" ""])
+("xdqm" ["Ƕ" "ǰ"])
+("xdqn" ["" ""])
+("xdqu" ["ȥ"])
+("xdqx" [""])
+("xdqy" [""])
+("xdr'" ["" "" "" "" "" "" "" "" "ִ" "뵱Ȼ"])
+("xdrf" ["" ""])
+("xdri" [""])
+("xdrs" [""])
+("xdsd" ["ٶ"])
+("xdsi" [""])
+("xdtb" ["ͷ"])
+("xdtj" ["̶" "̸"])
+("xdtm" [""])
+("xdts" ["ͨ" "ͬ"])
+("xdtu" ["" "ͼ"])
+("xdu'" ["¶" "ִʫ" ""])
+("xdub" [""])
+("xdud" ["ʪ"])
+("xduf" [""])
+("xdug" ["" "" ""])
+("xduh" [""])
+("xdui" ["ʶ"])
+("xduj" ["ɽ" "ɽ"])
+("xduu" [""])
+("xduv" ["ˮ"])
+("xdv'" ["Сӳ"])
+("xdve" [""])
+("xdvf" [""])
+("xdvg" [""])
+("xdvh" ["糤"])
+("xdvs" [""])
+("xdvu" [""])
+("xdw'" "")
+("xdwh" ["" "" ""])
+("xdwi" [""])
+("xdwk" ["ȶΪ"])
+("xdwz" ["λ" "ζ"])
+("xdx'" ["ִϷ" ""])
+("xdxd" ["" "" ""])
+("xdxi" ["Ϥ" "ϸ" ""])
+("xdxm" [""])
+("xdxn" [""])
+("xdxt" ["ѧ"])
+("xdxv" ["״"])
+("xdxw" ["" ""])
+("xdxx" ["б"])
+("xdxy" ["" "" ""])
+("xdya" ["" ""])
+("xdyb" ["" "" ""])
+("xdyd" ["˶"])
+("xdyh" ["" "" ""])
+("xdyi" ["" ""])
+("xdyj" ["" ""])
+("xdyk" ["Ҫ"])
+("xdyn" [""])
+("xdyp" [""])
+("xdys" ["" "" ""])
+("xdyt" ["Լ"])
+("xdyu" ["" "" ""])
+("xdyy" ["Ӧ" "Ӧ"])
+("xdzi" [""])
+("xdzj" ["Ŵʽ"])
+("xdzk" [""])
+("xdzo" [""])
+("xe'" ["޶"])
+("xebt" ["ϣ"])
+("xeux" ["ζѧ"])
+("xeyj" ["Զ׼"])
+("xf'" ["෴"])
+("xfd'" ["ȷ" "Сֶ"])
+("xfdg" ["ܷ"])
+("xfe'" ["ϱ"])
+("xfgj" [""])
+("xfi'" ["Ѧ"])
+("xfj'" [""])
+("xfl'" [""])
+("xfp'" ["Ʒ"])
+("xft'" ["ϣͤ"])
+("xfu'" ["ˮ"])
+("xfuf" ["뷽跨"])
+("xfv'" ["̷־"])
+("xfvr" ["ȷ"])
+("xfxi" ["ศ"])
+("xfy'" ["Һ"])
+("xfzl" ["" "˷"])
+("xg'" ["޸"])
+("xgcl" ["˸߲"])
+("xgf'" ["ϰ߷"])
+("xgi'" ["ܳ"])
+("xgil" [""])
+("xgj'" ["ϥؽ"])
+("xgl'" ["С¯"])
+("xgn'" ["С"])
+("xgx'" ["ϰ"])
+("xh'" [""])
+("xhbl" [""])
+("xhc'" ["ӻ"])
+("xhd'" ["źŵ" "źŵ"])
+("xhdb" ["Ѫ쵰"])
+("xhgm" [""])
+("xhj'" ["廯"])
+("xhl'" [""])
+("xhq'" ["źǹ" "ѭ"])
+("xhr'" [""])
+("xhsb" ["Ⱥ벡"])
+("xhu'" ["" "»"])
+("xhud" ["»"])
+("xhw'" ["廯"])
+("xhxt" ["ϵͳ" "źϵͳ" "ѭϵͳ"])
+("xhxu" ["ѭС"])
+("xhy'" ["С" "廯"])
+("xhyl" ["Ļ" "Ѳҽ"])
+("xhz'" ["С"])
+("xhzy" ["໥"])
+("xi'" ["γ"])
+("xiai" ["ϲ"])
+("xian" ["" ""])
+("xib'" ["߳没" ""])
+("xibj" ["Ϸ"])
+("xibk" ["ϲ" "ϸ"])
+("xibm" [""])
+("xibo" ["" "ϡ"])
+("xibu" ["" "ϸ" "ϸ"])
+("xibx" ["ϧ"])
+("xibz" [""])
+("xic'" ["γɲ"])
+("xici" ["ϵ"])
+("xicj" [""])
+("xid'" [""])
+("xide" [""])
+("xidg" ["Ϩ"])
+("xidi" ["ϯ" "ϴ"])
+("xidj" [""])
+("xidk" ["ϳ"])
+("xidx" ["³´л"])
+("xie'" "ϲϳϴ")
+("xier" ["ϣ"])
+("xifa" ["" "Ϸ"])
+("xifg" [""])
+("xifh" [""])
+("xifj" ["ϡ"])
+("xifu" ["" "" "ϱ"])
+("xifz" [""])
+("xigb" [""])
+("xigh" [""])
+("xigl" ["ϥ"])
+("xigr" ["" "ϰ"])
+("xigw" [""])
+("xihj" ["ϡ" "ϣ"])
+("xihk" ["ϲ"])
+("xihl" [""])
+("xiho" ["Ϩ"])
+("xihr" ["ϲ"])
+("xihu" [""])
+("xii'" ["˳"])
+("xiid" ["ϳ"])
+("xiif" ["ϴ"])
+("xiig" [""])
+("xiih" ["ϸ"])
+("xiiu" [""])
+("xiiv" [""])
+("xij'" ["ܳɻ"])
+("xijc" [""])
+("xijd" [""])
+("xiji" ["Ϯ"])
+("xijm" ["ϰ"])
+("xijn" [""])
+("xijp" ["ϸ"])
+("xijq" ["ϲ"])
+("xijr" ["ϯ"])
+("xiju" ["ϲ" "Ϸ"])
+("xijx" ["ϴ" "ϸ"])
+("xijy" ["" ""])
+("xikd" [""])
+("xikg" ["г̿"])
+("xil'" ["³"])
+("xila" ["ϣ"])
+("xile" ["ϯ"])
+("xili" ["" "" "" "Ϭ" "ϴ"])
+("xilm" ["ϴ"])
+("xiln" [""])
+("xilo" [""])
+("xilq" ["Ϫ"])
+("xilx" ["ϵ"])
+("ximf" [""])
+("ximg" [""])
+("ximi" ["ϸ"])
+("ximk" ["ϸë"])
+("ximm" [""])
+("ximn" ["ϸ"])
+("ximo" ["ī"])
+("ximu" ["ľ"])
+("ximx" ["Ϩ"])
+("ximz" ["ϴú"])
+("xinf" ["ϸ"])
+("xini" ["ϸ"])
+("xinj" [""])
+("xinq" ["Ϭţ"])
+("xins" ["ϷŪ"])
+("xiny" [""])
+("xiou" ["ŷ"])
+("xip'" ["²Ʒ" "Ʒ"])
+("xipi" ["Ƥ"])
+("xipj" [""])
+("xiq'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "ϡ" "Ϣ" "ϣ" "Ϥ" "ϥ" "Ϧ" "ϧ" "Ϩ" "ϩ" "Ϫ" "ϫ" "Ϭ" "" "" "ۭ" "" "ݾ" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("xiqi" ["" "ϡ" "ϰ" "ϲ"])
+("xiqt" ["ϲȵ"])
+("xiqu" ["ȡ" "Ϸ"])
+("xiqy" ["ϲ"])
+("xir'" "ϵ϶Ϸϸ")
+("xire" [""])
+("xirf" ["Ϯ" "ϲ"])
+("xiri" [""])
+("xirj" ["ϴȾ"])
+("xiro" ["ϸ"])
+("xirr" ["ϸ"])
+("xirs" [""])
+("xisr" [""])
+("xisu" ["ϰ"])
+("xisv" ["ϸ"])
+("xit'" ["С͢"])
+("xiti" ["ϰ"])
+("xitl" ["Ϸ̨"])
+("xitm" [""])
+("xits" ["ϵͳ"])
+("xitu" ["ϣͼ"])
+("xity" ["ϩ"])
+("xiua" ["ϸɴ"])
+("xiub" ["" "ϴ"])
+("xiug" [""])
+("xiui" ["ʩ" "ʽ" "ʪ" "ʳ" "ϡ" "ϲ"])
+("xiuj" ["ɽ"])
+("xiuk" ["ϡ"])
+("xiup" ["˱"])
+("xiuu" ["ϡ" "ϵ"])
+("xiuv" ["ˮ" "Ϫˮ" "ˮ"])
+("xiuw" ["ϴˢ"])
+("xivb" [""])
+("xivd" ["װ"])
+("xivi" ["ϸ"])
+("xiw'" "ϭϮϯϰϱ")
+("xiwf" ["" "ϭ"])
+("xiwh" ["ϣ"])
+("xiww" ["ϲ"])
+("xiwz" ["κ" "ϯλ" "ϸ΢"])
+("xixc" ["ϸС"])
+("xixi" ["" "ϸϸ" "Ϸ"])
+("xixm" ["ϸ"])
+("xixn" ["Ϥ" "ϸ"])
+("xixp" ["ϲѶ"])
+("xixr" ["ϴѡ"])
+("xixt" ["ѧ"])
+("xixw" [""])
+("xixy" ["ϰ"])
+("xiy'" ["Ա"])
+("xiya" [""])
+("xiyb" ["ϡ"])
+("xiyh" ["" "" "Ϧ"])
+("xiyi" ["ҽ" "ϴ"])
+("xiyj" [""])
+("xiyk" ["ҩ"])
+("xiyn" [""])
+("xiyr" ["ϷԺ"])
+("xiys" ["Ϯ" "ϰ"])
+("xiyt" ["ϲ"])
+("xiyu" ["" "ϸ"])
+("xize" ["ϸ"])
+("xizh" [""])
+("xizi" ["ϯ" "ϲ" "Ϸ"])
+("xizk" ["ϴ"])
+("xizo" ["ϰ"])
+("xj'" ["ֽ"])
+("xjb'" [""])
+("xjd'" ["ֽ׶"])
+("xjf'" ["ѡٷ"])
+("xjgl" ["ֽ"])
+("xji'" ["Сγ"])
+("xjj'" [""])
+("xjjt" ["Ƚ"])
+("xjl'" ["½" "½"])
+("xjp'" ["¼"])
+("xjq'" ["ѡȨ"])
+("xjrt" ["ľ"])
+("xjs'" ["Լ"])
+("xjt'" ["С" "Сͥ"])
+("xju'" ["" "¼"])
+("xjv'" ["ѡ"])
+("xjvd" ["ѡƶ"])
+("xjvm" ["ȼ֮"])
+("xjw'" [""])
+("xjxc" ["׼ײ"])
+("xjy'" ["㾫" "¼Ԫ" "ļ"])
+("xjzg" ["ѡʸ"])
+("xk'" ["ֿ"])
+("xkj'" ["Сھ"])
+("xkv'" ["֤"])
+("xkw'" ["ܿ"])
+("xl'" ["·"])
+("xlb'" ["ѵ"])
+("xlf'" ["ϴ"])
+("xlh'" ["ϵл" "ﻰ" "ѩ"])
+("xlhl" ["ϡﻩ"])
+("xlht" ["ϡͿ"])
+("xlib" [""])
+("xlp'" ["С"])
+("xlq'" [""])
+("xlqb" ["岼"])
+("xlr'" ["ϣ"])
+("xlt'" [""])
+("xlx'" ["ѧ" ""])
+("xlxf" ["·"])
+("xlxy" [""])
+("xly'" ["Ӫ" ""])
+("xm'" [""])
+("xmai" ["ٰ"])
+("xmby" ["ڱ" "ܱ"])
+("xmbz" ["ȱ" "ʱ"])
+("xmc'" [""])
+("xmce" ["ײ"])
+("xmci" ["״"])
+("xmcl" ["̲" "߲" "Ȳ"])
+("xmcp" ["ִ"])
+("xmdc" ["Ƶ"])
+("xmde" ["Ե"])
+("xmdj" ["̵"])
+("xmdk" ["ȵ"])
+("xmdl" ["ִ"])
+("xmdr" ["ȶ" "߶"])
+("xmds" ["ƶ"])
+("xmdu" ["޶"])
+("xmdy" ["޶"])
+("xme'" "ϳϴ޺")
+("xmee" ["ն" "޶"])
+("xmfa" ["ܷ"])
+("xmfg" ["ȷ" "̷"])
+("xmgo" ["ɹ" "ʹ"])
+("xmgr" ["ع"])
+("xmgs" ["ȹ" "й"])
+("xmgu" ["ɹ"])
+("xmgv" ["Թ"])
+("xmgz" ["׸"])
+("xmhb" ["Ⱥ"])
+("xmhe" ["Ժ"])
+("xmhl" ["̺" "ݺ"])
+("xmho" ["ֻ"])
+("xmhs" ["ʺ"])
+("xmhv" ["ͻ"])
+("xmhw" ["ɻ" "ʻ" "л" "׻"])
+("xmi'" ["ë"])
+("xmid" ["ϴ"])
+("xmig" ["ֳ" "س"])
+("xmih" ["ֳ"])
+("xmis" ["߳"])
+("xmiu" ["Գ"])
+("xmjc" ["ֽ"])
+("xmjd" ["Ƚ" "ֽ"])
+("xmji" ["׼"])
+("xmjm" ["ȼ" "Լ" "߼"])
+("xmjn" ["Ƚ" "ֽ" "ֽ"])
+("xmjp" ["վ"])
+("xmjt" ["Ⱦ"])
+("xmjx" ["ν" "޽"])
+("xmjy" ["ɾ" "վ" "־" ""])
+("xmkl" ["ƿ"])
+("xmkr" ["ֿ"])
+("xmld" ["" ""])
+("xmli" ["" ""])
+("xmlo" [""])
+("xmlu" ["ϲɽ" "¶" "·"])
+("xmlx" [""])
+("xmly" ["" "" ""])
+("xmm'" ["Ц"])
+("xmmk" ["ë"])
+("xmmu" ["Ľ"])
+("xmmy" ["" ""])
+("xmmz" ["" ""])
+("xmnf" [""])
+("xmng" [""])
+("xmnv" ["Ů"])
+("xmny" [""])
+("xmq'" "ݲ")
+("xmqi" ["" "" "" ""])
+("xmqm" ["ǰ" "ǲ" "Ǯ"])
+("xmqn" ["" ""])
+("xmqr" ["Ȧ"])
+("xmqu" ["" ""])
+("xmqy" [""])
+("xmr'" "")
+("xmrf" ["" "" "" "" ""])
+("xmrj" ["Ȼ"])
+("xmru" [""])
+("xmsj" ["ɢ"])
+("xmso" [""])
+("xmtb" ["ͷ" "ͷ"])
+("xmtc" [""])
+("xmti" [""])
+("xmtj" ["̸" "̲"])
+("xmtm" [""])
+("xmtx" [""])
+("xmub" [""])
+("xmuf" [""])
+("xmug" ["" "" ""])
+("xmuh" [""])
+("xmui" ["" "" "ʾ" "ʱ" "ʵ" ""])
+("xmuv" ["ˮ"])
+("xmv'" [""])
+("xmvd" ["״"])
+("xmvg" [""])
+("xmvh" ["س" ""])
+("xmvi" ["֪" "" "־" "ֹ" ""])
+("xmvu" [""])
+("xmw'" "")
+("xmwz" ["ά" "΢" "Ϊ" "ί" "λ"])
+("xmxd" ["" ""])
+("xmxi" ["ϸ"])
+("xmxm" [""])
+("xmxt" ["Ѫ" "ѧ"])
+("xmxx" ["Щ"])
+("xmxy" ["" "" "" "" "" "" "" ""])
+("xmy'" ["ϸë" "ҵ"])
+("xmyb" [""])
+("xmyh" [""])
+("xmyi" ["" "" ""])
+("xmyj" ["" "" ""])
+("xmyk" ["Ҫ" "Ҫ" "Ҫ"])
+("xmyt" [""])
+("xmyu" [""])
+("xmyy" ["Ӱ"])
+("xmyz" [""])
+("xmza" [""])
+("xmzl" [""])
+("xmzu" [""])
+("xn'" [""])
+("xnai" ["İ"])
+("xnal" ["ϲŭ"])
+("xnan" ["°"])
+("xnbj" ["п" "°"])
+("xnbk" ["İ"])
+("xnbn" ["±"])
+("xnby" ["±"])
+("xnci" ["´"])
+("xncl" ["Ĳ"])
+("xncp" ["´"])
+("xncs" ["Ŵ"])
+("xnde" ["µ" "ĵ"])
+("xndi" ["µ" "ĵ" "ĵ"])
+("xndk" ["µ"])
+("xndl" ["Ŵ"])
+("xnds" ["¶" "Ķ"])
+("xndu" ["¶"])
+("xner" ["Ķ"])
+("xnfa" ["·"])
+("xnfg" ["·" "ŷ" "ŷ"])
+("xnfh" ["·" "ķ"])
+("xnfu" ["¸" "ķ" "ĸ" "ŷ"])
+("xnfv" ["Ϸ"])
+("xngd" ["¹"])
+("xngj" ["ĸ"])
+("xngv" ["¹"])
+("xnhd" ["Ļ"])
+("xnhk" ["ź"])
+("xnhl" [""])
+("xnhp" ["»"])
+("xnhv" ["»"])
+("xnhw" ["»" "»"])
+("xnhy" ["Ļ"])
+("xnib" [""])
+("xnig" ["³"])
+("xnih" ["ĳ"])
+("xnik" ["ĳ"])
+("xnip" ["´"])
+("xnj'" ["˼"])
+("xnjc" ["½"])
+("xnjd" ["½"])
+("xnji" ["Ļ" "ļ" "ļ"])
+("xnjj" ["Сũ"])
+("xnjm" ["½" "ż"])
+("xnjn" ["н" "½" "½" "½"])
+("xnjp" ["¾"])
+("xnjq" ["¾"])
+("xnju" ["¾"])
+("xnjy" ["¾" "ľ"])
+("xnkb" ["Ŀ"])
+("xnkj" ["Ŀ"])
+("xnkl" ["¿"])
+("xnku" [""])
+("xnla" [""])
+("xnlh" [""])
+("xnli" ["" "" ""])
+("xnlk" ["" ""])
+("xnll" [""])
+("xnlo" [""])
+("xnly" [""])
+("xnm'" ["Ĥ"])
+("xnmu" ["Ŀ"])
+("xnnd" [""])
+("xnnm" ["" ""])
+("xnpm" ["оƬ"])
+("xnq'" "нопܰ")
+("xnqi" [""])
+("xnqn" [""])
+("xnqx" [""])
+("xnqy" ["" ""])
+("xnr'" "оض")
+("xnrf" ["" ""])
+("xnrj" ["Ȼ"])
+("xnsi" ["˼" "Ѱ˼"])
+("xnsr" ["" "" ""])
+("xntb" ["ͷ"])
+("xntc" ["" ""])
+("xntg" [""])
+("xntm" [""])
+("xnto" [""])
+("xntu" ["" "ͽ"])
+("xnu'" [""])
+("xnua" ["ɳ"])
+("xnub" [""])
+("xnuf" [""])
+("xnug" ["" ""])
+("xnuh" [""])
+("xnui" ["ʫ" "ʽ" "" "" ""])
+("xnuu" ["" ""])
+("xnuv" ["нˮ"])
+("xnvb" [""])
+("xnvd" ["װ"])
+("xnvg" [""])
+("xnvi" ["ֽ"])
+("xnvs" [""])
+("xnw'" "Ѱ")
+("xnwf" [""])
+("xnwz" ["ο"])
+("xnxd" ["" "" ""])
+("xnxi" ["ϲ" "Ϣ"])
+("xnxm" [""])
+("xnxn" [""])
+("xnxs" [""])
+("xnxt" ["ѧ" "ѧ" "Ѫ"])
+("xnxu" ["" ""])
+("xnxy" ["" "" "" ""])
+("xnyb" [""])
+("xnyh" ["" ""])
+("xnyi" ["" "" ""])
+("xnyr" ["Ը"])
+("xnys" [""])
+("xnyt" [""])
+("xnyu" [""])
+("xnyy" ["ӱ"])
+("xnzh" [""])
+("xnzi" ["о"])
+("xpbu" ["Ѳ"])
+("xpdk" ["ѵ"])
+("xpfh" ["Ѱ"])
+("xpfu" ["ѱ" "Ѳ"])
+("xpgo" ["ѳ"])
+("xpgu" ["ѵڬ"])
+("xph'" ["ƽ"])
+("xphh" ["Ѳ"])
+("xphr" ["ѭ"])
+("xphv" ["Ѳ"])
+("xphw" ["ѱ" "ѵ"])
+("xpi'" ["䳧"])
+("xpia" ["Ѳ"])
+("xpih" ["Ѱ"])
+("xpii" ["ѵ"])
+("xpjm" ["Ѳ"])
+("xpjx" ["ѳ"])
+("xpjy" ["Ѳ"])
+("xpkd" [""])
+("xpkj" ["Ѯ"])
+("xpl'" ["·"])
+("xplm" ["ѵ"])
+("xplo" ["Ѳ"])
+("xply" ["ѵ"])
+("xpma" ["ѱ"])
+("xpmg" ["Ѹ"])
+("xpmi" ["Ѱ"])
+("xpnj" ["ѳ"])
+("xpq'" "ѫѬ޹")
+("xpqh" ["ƽ"])
+("xpqi" ["Ѵ"])
+("xpqq" ["Ѱ"])
+("xpr'" "ѬѳѴѵѶѷѸަ")
+("xpri" ["Ѯ"])
+("xpse" ["ѷɫ"])
+("xpsi" ["˽"])
+("xpsu" ["Ѹ"])
+("xptk" ["Ѭ"])
+("xpui" ["Ѱ" "Ѳ"])
+("xpuk" ["Ѳ"])
+("xpup" ["ѱ˳"])
+("xpv'" [""])
+("xpvg" ["Ѭ" "ѵ"])
+("xpvh" ["ѫ"])
+("xpvi" ["Ѱַ" "ѳְ"])
+("xpvk" ["Ѱ"])
+("xpw'" "ѭѮѯѰѱѲۨ")
+("xpwf" ["ѯ" "Ѷ"])
+("xpxu" ["ѭ"])
+("xpxy" ["Ѳ"])
+("xpy'" ["С"])
+("xpyb" ["Ѳ"])
+("xpye" ["Ѳҹ"])
+("xpyh" ["ѱ"])
+("xpyi" ["Ѱһ"])
+("xpzh" ["ѳ"])
+("xpzi" [""])
+("xq'" [""])
+("xqbu" ["޲"])
+("xqby" ["ⲡ"])
+("xqci" ["޴"])
+("xqcl" [""])
+("xqde" ["ݵ"])
+("xqdy" ["޶"])
+("xqe'" "")
+("xqfu" ["޸"])
+("xqgl" ["޸"])
+("xqh'" ["С"])
+("xqhk" ["޺"])
+("xqhv" ["ݻ"])
+("xqhw" ["廨"])
+("xqie" ["޳"])
+("xqig" ["޳"])
+("xqii" ["߳"])
+("xqir" ["޴"])
+("xqj'" ["н" "ǰ"])
+("xqjm" ["޼" "޽"])
+("xqjt" [""])
+("xqjw" ["ݼ"])
+("xqk'" ["ǰ"])
+("xqkb" [""])
+("xqkv" [""])
+("xqli" ["" ""])
+("xqlu" ["·"])
+("xqmm" [""])
+("xqmo" [""])
+("xqmu" ["ľ"])
+("xqpz" [""])
+("xqq'" "")
+("xqqi" [""])
+("xqqq" [""])
+("xqqx" [""])
+("xqr'" ["" "" "" "" "" "" "" "" "" ""])
+("xqru" [""])
+("xqse" ["ɬ"])
+("xqsr" [""])
+("xqti" [""])
+("xqu'" ["С"])
+("xqub" [""])
+("xquf" [""])
+("xqui" [""])
+("xquj" [""])
+("xquv" ["ˮ" "ˮ"])
+("xqvf" [""])
+("xqvg" ["" "" ""])
+("xqvi" ["ֹ"])
+("xqvu" [""])
+("xqxd" [""])
+("xqxi" ["Ϣ"])
+("xqxm" [""])
+("xqxq" [""])
+("xqxt" ["ѧ"])
+("xqxy" [""])
+("xqye" ["ҵ"])
+("xqyh" ["" ""])
+("xqyk" ["Ҫ"])
+("xqyy" ["ϲ"])
+("xqzi" [""])
+("xqzk" [""])
+("xr'" ["Ȼ"])
+("xran" [""])
+("xrba" ["ѡ"])
+("xrbf" ["ѡ"])
+("xrbi" [""])
+("xrbu" [""])
+("xrcl" ["ѡ"])
+("xrde" [""])
+("xrdu" ["" "ѡ"])
+("xrdy" ["ѡ"])
+("xre'" "ѡѢ")
+("xrff" ["Ƿ"])
+("xrfg" [""])
+("xrfu" [""])
+("xrgb" ["ѡ"])
+("xrgk" [""])
+("xrgs" [""])
+("xrgw" [""])
+("xrhj" ["˺"])
+("xrhw" [""])
+("xrid" [""])
+("xrig" [""])
+("xrir" [""])
+("xriu" ["ѡ"])
+("xriv" [""])
+("xrjd" [""])
+("xrji" ["" "ѡ" "ѡ"])
+("xrju" ["ѡ"])
+("xrjx" ["Ѣ"])
+("xrk'" ["տ"])
+("xrkd" ["ѡ"])
+("xrks" [""])
+("xrli" ["Ѥ"])
+("xrlj" ["Ѥ"])
+("xrlu" ["ѡ¼"])
+("xrlv" [""])
+("xrmc" [""])
+("xrmn" ["ѡ"])
+("xrmz" ["ѡú"])
+("xrnc" [""])
+("xrnk" [""])
+("xrnm" [""])
+("xrnq" ["ť"])
+("xrpc" ["ѡƱ"])
+("xrpj" [""])
+("xrpl" ["ѡ"])
+("xrpn" ["ѡƸ"])
+("xrpz" ["ѡ"])
+("xrq'" ["" "" "" "" "" "" "" "" "" ""])
+("xrqu" ["ѡ" "ѡȡ"])
+("xrr'" "ȯѣѤ")
+("xrrf" ["ѡ"])
+("xrrh" [""])
+("xrrj" ["Ⱦ"])
+("xrss" ["ѡ"])
+("xrts" ["ͳ"])
+("xrub" ["ѡ"])
+("xrui" ["ʾ" ""])
+("xruu" [""])
+("xrve" [""])
+("xrvi" ["ֽ"])
+("xrvj" ["ս"])
+("xrvr" ["ת"])
+("xrvs" ["ѡ" "ѡ"])
+("xrw'" "")
+("xrwo" ["" ""])
+("xrwu" [""])
+("xrxc" [""])
+("xrxq" ["ѡ"])
+("xrxt" ["ѧ"])
+("xrxu" [""])
+("xrya" [""])
+("xryh" [""])
+("xryj" [""])
+("xryk" ["ҫ"])
+("xryp" ["ѣ"])
+("xrys" ["ѡ"])
+("xryu" ["ѡ"])
+("xrze" ["ѡ"])
+("xs'" ["Ѹ"])
+("xsa'" [""])
+("xsbk" ["ױ"])
+("xsbm" ["۱"])
+("xsbu" ["ز"])
+("xscj" ["ײ"])
+("xsd'" ["ٶ" "Сմ"])
+("xsdi" ["ֵ"])
+("xsee" ["׶"])
+("xsfg" ["۷"])
+("xsfj" ["׷"])
+("xsg'" [""])
+("xsgu" ["ع"])
+("xshb" ["ۺ"])
+("xshf" ["׺"])
+("xshl" [""])
+("xshw" ["ۻ"])
+("xshy" ["ػ"])
+("xsj'" ["" "ľ"])
+("xsji" ["ۼ"])
+("xsjm" ["۽"])
+("xsjn" ["ؽ"])
+("xskb" ["ؿ"])
+("xsmg" [""])
+("xsmk" ["è"])
+("xsmz" [""])
+("xsn'" [""])
+("xsnu" ["ū"])
+("xsp'" ["С"])
+("xspu" ["ظ"])
+("xsq'" "ܺ")
+("xsqd" ["ǻ"])
+("xsqi" ["" ""])
+("xsrb" [""])
+("xsrv" [""])
+("xsth" [""])
+("xsua" ["ɱ"])
+("xsub" [""])
+("xsui" ["ʦ"])
+("xsvd" ["׳"])
+("xsvh" ["ֳ" ""])
+("xsw'" "")
+("xswz" ["Χ" "ΰ"])
+("xsx'" [""])
+("xsxd" [""])
+("xsxm" [""])
+("xsxn" [""])
+("xsxs" ["" ""])
+("xsxy" [""])
+("xsy'" [""])
+("xsys" ["ӿ"])
+("xsyy" ["ӥ"])
+("xt'" ["ϵͳ"])
+("xtan" ["Ѫ"])
+("xtbg" ["ѩ"])
+("xtbk" ["ѧ"])
+("xtbl" ["Ტ" "ѩ"])
+("xtbo" ["ѧ" "Ѩ"])
+("xtbu" ["ѧ"])
+("xtdi" ["ѩ"])
+("xtdk" ["ѧ" "Ѩ"])
+("xtdz" ["Эͬ"])
+("xte'" "ѩ")
+("xtff" ["ѧ"])
+("xtfg" ["ѧ"])
+("xtfu" ["ѧ"])
+("xtfy" ["ϵͳ"])
+("xtfz" ["ѧ"])
+("xtg'" ["ѧͽ"])
+("xtgi" ["ϵͳ"])
+("xtgr" ["Ѫ"])
+("xtgs" ["ѧ"])
+("xth'" ["̫"])
+("xthj" ["Ѫ"])
+("xthk" ["ѧ"])
+("xthl" ["ѧ" "Ѫ"])
+("xths" ["Ѫ"])
+("xthv" ["ѧ"])
+("xthw" ["ѩ"])
+("xthy" ["ѧ"])
+("xtjd" ["Ѫ"])
+("xtji" ["ѧ" "Ѫ"])
+("xtjm" [""])
+("xtjp" ["ѧ"])
+("xtjq" ["ѧ"])
+("xtju" ["Ѩ"])
+("xtjw" ["ѧ" "ѩ"])
+("xtjx" ["ѧ"])
+("xtke" ["ѧ"])
+("xtl'" ["ϣ"])
+("xtld" ["ѩ"])
+("xtli" ["ѧ" "ѧ"])
+("xtlu" ["Ѫ·"])
+("xtly" ["ѧ"])
+("xtlz" ["Ѫ"])
+("xtml" ["Ѫ"])
+("xtmy" ["ó" "ѧ"])
+("xtnm" ["ѧ"])
+("xtpl" ["ѧ"])
+("xtpm" ["ѩƬ"])
+("xtq'" ["" "ѥ" "Ѧ" "С"])
+("xtqc" ["ѩ"])
+("xtqi" ["ѧ"])
+("xtqn" ["ѩ" "Ѫ"])
+("xtqq" ["Ѫ"])
+("xtqy" ["Ѫ"])
+("xtr'" "Ѫ")
+("xtrb" ["Ѫ"])
+("xtro" [""])
+("xtse" ["Ѫɫ"])
+("xtsi" ["Ѫ˿"])
+("xtth" ["ѧ"])
+("xtts" ["Ѫͳ"])
+("xttu" ["ѧͽ"])
+("xtug" ["ѧ"])
+("xtui" ["ѧʱ" "ѧʶ" "ѧʿ"])
+("xtuj" ["ѩɽ"])
+("xtuo" ["ѧ˵"])
+("xtur" ["Ѫ˨"])
+("xtuu" ["ѧ" "Ѫ"])
+("xtuv" ["Ѫˮ"])
+("xtve" ["ѧ"])
+("xtvg" ["ѧ"])
+("xtvi" ["ѧ"])
+("xtvj" ["Ѫս"])
+("xtvl" ["Ѫծ"])
+("xtw'" "ѧѨ")
+("xtwf" ["ѧ" "ѧ"])
+("xtwz" ["ѧλ" "Ѩλ"])
+("xtx'" ["̬ѧ"])
+("xtxc" ["ѧУ"])
+("xtxi" ["ѧϰ" "ѧϵ" "Ѫϴ"])
+("xtxy" ["Ѫ" "Ѫ" "Ѫ"])
+("xtya" ["Ѫѹ"])
+("xtye" ["ѧҵ" "ѪҺ"])
+("xtyi" ["ѧ"])
+("xtyr" ["ѧԱ" "ѧԺ" "ѩԭ" "ѪԵ"])
+("xtzi" ["ѥ" "ѧ"])
+("xu'" [""])
+("xubk" ["鱨"])
+("xubm" [""])
+("xubn" ["˫"])
+("xuci" [""])
+("xud'" ["ˮ" "С"])
+("xudm" [""])
+("xudo" [""])
+("xudv" ["ʦ"])
+("xue'" ["" "ڼ" "" "" "" "" "۶" ""])
+("xuf'" ["·"])
+("xufa" ["뷢"])
+("xufu" ["츣"])
+("xufz" ["·"])
+("xugb" ["鹹"])
+("xugf" [""])
+("xugp" ["չ"])
+("xuh'" ["ʯ" "Сʱ" "ٻ" "ѧ"])
+("xuhk" [""])
+("xuhr" [""])
+("xui'" ["С" ""])
+("xuih" [""])
+("xuij" [""])
+("xuiv" ["С"])
+("xuj'" ["ռ" "С˵" "ѧ"])
+("xuji" [""])
+("xujq" ["" ""])
+("xujw" [""])
+("xuke" [""])
+("xul'" ["" "ʤ"])
+("xulj" ["ʽ߼"])
+("xull" [""])
+("xulp" ["" ""])
+("xulx" [""])
+("xum'" ["С"])
+("xumu" ["Ļ" ""])
+("xumy" [""])
+("xuni" [""])
+("xuno" ["ŵ"])
+("xuny" [""])
+("xup'" ["Ʒ" "СƷ"])
+("xupg" ["Թ"])
+("xuq'" "")
+("xuqd" ["ɳȺ" "ʯʱ"])
+("xuqq" [""])
+("xuqu" [""])
+("xur'" "")
+("xuri" [""])
+("xuro" [""])
+("xurs" [""])
+("xut'" ["ޣ" ""])
+("xuu'" ["ʽ" "ʫ"])
+("xuui" ["ʵ" ""])
+("xuuo" ["˵"])
+("xuuu" ["" "" ""])
+("xuuv" ["ˮ"])
+("xuuw" [""])
+("xuv'" ["ʱ"])
+("xuvb" [""])
+("xuvh" [""])
+("xuvi" ["֪"])
+("xuvy" ["ʵ" "ʽ"])
+("xuw'" "")
+("xuwf" [""])
+("xuwh" [""])
+("xuwu" [""])
+("xuwz" ["α"])
+("xux'" ["ʪ" "ʵ"])
+("xuxd" [""])
+("xuxm" ["" ""])
+("xuxn" [""])
+("xuxu" ["" ""])
+("xuy'" ["Ӧ"])
+("xuyb" ["С˵±"])
+("xuyd" ["ѧ˶"])
+("xuyi" [""])
+("xuyj" ["" ""])
+("xuyk" ["Ҫ" "Ҫ"])
+("xuzr" [""])
+("xv'" [""])
+("xvbb" ["²"])
+("xvd'" ["г"])
+("xvf'" ["" "ֹ"])
+("xvg'" ["й"])
+("xvgl" [""])
+("xvh'" ["Ϲָ" "л"])
+("xvif" [""])
+("xvm'" ["־Ħ"])
+("xvn'" ["ũ"])
+("xvq'" ["йֳǻ" "" "Ȩ"])
+("xvqj" ["תػ"])
+("xvqy" [""])
+("xvst" ["ѩ̿"])
+("xvu'" ["֪"])
+("xvv'" ["ת"])
+("xvvy" [""])
+("xvwu" [""])
+("xvx'" [""])
+("xvxu" ["ϵ"])
+("xvy'" ["Һ"])
+("xvyu" [""])
+("xvyx" ["֮Ч"])
+("xw'" [""])
+("xwai" [""])
+("xwb'" ["ά"])
+("xwba" ["°"])
+("xwbi" ["±"])
+("xwbj" ["°"])
+("xwbl" ["°"])
+("xwbm" ["±"])
+("xwbo" ["ϻ"])
+("xwbu" ["²"])
+("xwcg" ["²"])
+("xwci" ["´"])
+("xwda" ["´"])
+("xwde" ["ŵ"])
+("xwdg" ["µ"])
+("xwdi" ["µ" "µ"])
+("xwdj" ["µ"])
+("xwdk" ["ŵ"])
+("xwdy" ["¶"])
+("xwee" [""])
+("xwfa" ["·" "·"])
+("xwfh" ["·" "·"])
+("xwfj" ["·"])
+("xwgb" ["Ź"])
+("xwgd" ["ϼ"])
+("xwgr" ["¹" "¹"])
+("xwgs" ["¹"])
+("xwgu" ["Ͽ"])
+("xwh'" ["Ļ"])
+("xwhe" ["º" ""])
+("xwhl" ["º"])
+("xwhu" ["Ż"])
+("xwhv" ["»"])
+("xwhw" ["»"])
+("xwhy" ["Ż"])
+("xwi'" ["괾" "λ"])
+("xwid" ["ά"])
+("xwie" ["Ϲ" "³"])
+("xwif" ["³"])
+("xwih" ["" "³" "³"])
+("xwiu" ["´"])
+("xwiv" ["´"])
+("xwj'" ["΢"])
+("xwjc" ["½"])
+("xwjd" ["Ͽ" "½"])
+("xwji" ["¼" "ļ"])
+("xwjm" ["¼"])
+("xwjq" ["¾"])
+("xwjr" ["¾"])
+("xwjv" ["ż"])
+("xwkb" ["Ͽ"])
+("xwke" ["" "¿"])
+("xwld" [""])
+("xwli" ["" ""])
+("xwlj" ["ϲּ"])
+("xwll" [""])
+("xwlm" [""])
+("xwlo" [""])
+("xwlq" [""])
+("xwlx" [""])
+("xwly" [""])
+("xwma" [""])
+("xwmf" [""])
+("xwmh" ["Ϲæ"])
+("xwmi" ["Ϻ"])
+("xwmm" [""])
+("xwmu" ["ľ"])
+("xwnk" ["Ϲ"])
+("xwnl" ["Ϊ"])
+("xwpj" [""])
+("xwpn" ["Ʒ"])
+("xwq'" ["Ϲ" "Ϻ" "" ""])
+("xwqi" [""])
+("xwqu" ["Ͻ" "ȥ"])
+("xwqy" [""])
+("xwr'" "")
+("xwrf" ["Ϻ" ""])
+("xws'" ["ά"])
+("xwsi" [""])
+("xwtb" ["ͷ"])
+("xwtl" ["̨"])
+("xwtm" [""])
+("xwts" ["ͬ"])
+("xwtu" [""])
+("xwub" ["" ""])
+("xwue" [""])
+("xwuf" [""])
+("xwug" [""])
+("xwuj" ["ɽ" "ί"])
+("xwuo" ["Ϲ˵"])
+("xwuu" [""])
+("xwuv" ["ˮ"])
+("xwv'" ["д" "ֵ" "ֽ"])
+("xwvi" ["֫" "ֱ" ""])
+("xwvl" ["խ"])
+("xwvs" ["" ""])
+("xwvw" ["Ϲץ"])
+("xwvy" ["Ϊ" ""])
+("xww'" "ϻϼϽϾϿ")
+("xwwf" [""])
+("xwwu" [""])
+("xwx'" ["ѧ"])
+("xwxc" ["С"])
+("xwxd" ["" ""])
+("xwxm" ["" ""])
+("xwxp" ["Ѯ"])
+("xwxy" [""])
+("xwyb" [""])
+("xwyi" ["" ""])
+("xwyu" ["" ""])
+("xwz'" ["" ""])
+("xwzb" [""])
+("xwzi" ["Ϲ" "Ϻ" "ϻ" ""])
+("xwzo" [""])
+("xx'" ["ѧϰ"])
+("xxal" ["С˰"])
+("xxan" ["Ѫ"])
+("xxb'" ["ѧϰ" "ѪС"])
+("xxbh" ["Ա任"])
+("xxbm" ["б"])
+("xxbo" ["г"])
+("xxby" ["Բ"])
+("xxcs" ["в"])
+("xxd'" ["СС"])
+("xxdi" ["Ь"])
+("xxdk" ["д"])
+("xxdl" ["Я"])
+("xxdu" ["б" ""])
+("xxdy" ["Э"])
+("xxe'" "дѪ")
+("xxee" ["а"])
+("xxf'" ["з"])
+("xxfa" ["д"])
+("xxfz" ["Է"])
+("xxg'" ["Ѫ" ""])
+("xxgk" ["д"])
+("xxgr" ["Ѫ"])
+("xxgs" ["Ъ"])
+("xxh'" ["" "Ѫѭ" "Ǻ"])
+("xxhd" ["з"])
+("xxhe" ["Э" "г"])
+("xxhh" [""])
+("xxhj" ["Ѫ"])
+("xxho" ["ж"])
+("xxhv" ["Э"])
+("xxi'" ["Ѫ"])
+("xxie" ["ж"])
+("xxii" ["Ю"])
+("xxil" ["Ϣ"])
+("xxiu" ["д"])
+("xxjc" ["б"])
+("xxjj" ["ѭ򽥽" "ѭ"])
+("xxjq" ["д"])
+("xxjt" ["л"])
+("xxju" ["СĽ" "Ľ"])
+("xxjw" ["л"])
+("xxjy" ["б"])
+("xxkk" [""])
+("xxl'" ["" "" "" "Ϣ" "ϣ" "Ϣ"])
+("xxlb" ["й©"])
+("xxlc" ["д"])
+("xxli" ["Э" "Э"])
+("xxlu" ["а·" "й¶"])
+("xxlv" ["б"])
+("xxmi" ["й"])
+("xxmk" ["Ьñ"])
+("xxmm" ["б"])
+("xxpo" ["б" "в"])
+("xxq'" ["Ш" "Щ" "Ъ" "Ы" ""])
+("xxqc" ["б"])
+("xxqi" ["а" "й"])
+("xxr'" ["" "" "д" "е" "ж" "з" "и" "й" "к" "л" "м" "" "" "ޯ" "" "" "" "" "" "" "" "" "" ""])
+("xxrr" [""])
+("xxru" ["д" ""])
+("xxss" ["ɫɫ"])
+("xxsw" ["˼ά"])
+("xxtc" ["Э"])
+("xxts" ["Эͬ" "Эͳ"])
+("xxu'" ["Сѧ"])
+("xxub" ["Я"])
+("xxue" ["б"])
+("xxug" ["д"])
+("xxuh" ["Э"])
+("xxui" ["б" "дʵ"])
+("xxuo" ["а˵"])
+("xxuw" ["Ьˢ"])
+("xxva" ["б"])
+("xxvf" ["г" "д"])
+("xxvh" ["֮"])
+("xxvk" ["д"])
+("xxvu" ["Э"])
+("xxvv" ["׳־"])
+("xxw'" "ЬЭЮЯабвгҶߢ")
+("xxwa" ["Ь"])
+("xxwf" ["б"])
+("xxx'" ["ѧ" "С" "Ц"])
+("xxxc" ["ЩС"])
+("xxxi" ["ЪϢ"])
+("xxxm" ["б"])
+("xxxn" ["д"])
+("xxxr" ["л" ""])
+("xxxx" ["лл"])
+("xxyb" ["Ь"])
+("xxyh" ["б"])
+("xxyi" ["Э" "д" "л"])
+("xxyj" ["Ԫ" "б"])
+("xxyn" ["г"])
+("xxyy" ["С"])
+("xxzi" ["Ш" "Ь" "д"])
+("xxzo" ["Э" "д"])
+("xy'" ["Ҫ"])
+("xyan" ["˰"])
+("xyb'" ["һ"])
+("xybj" ["˰"])
+("xybm" ["α"])
+("xybu" ["̲" "в"])
+("xybx" ["Ա"])
+("xyby" ["Բ"])
+("xydb" ["Ƕ"])
+("xydd" ["ӡȺ"])
+("xydk" ["е"])
+("xyds" ["ж" "ж"])
+("xye'" ["ʡ" "" "ߩ" "۶"])
+("xyer" ["Ҷ"])
+("xyf'" ["ϴ·"])
+("xyfa" ["̷" "̷"])
+("xyff" ["˷"])
+("xyfu" ["Ҹ"])
+("xyg'" ["ЭԼ"])
+("xygd" ["ǹ"])
+("xyge" ["Ը"])
+("xygh" ["͸"])
+("xygj" ["Ը"])
+("xygo" ["˹"])
+("xygs" ["й"])
+("xyha" [""])
+("xyhk" ["ͺ" "Һ"])
+("xyho" ["ǻ"])
+("xyhv" ["л"])
+("xyhw" ["˻"])
+("xyie" ["г"])
+("xyig" ["γ" "г"])
+("xyir" ["д"])
+("xyiv" ["г"])
+("xyj'" ["ϴ»" "Ӱ" "Ѳ"])
+("xyjc" ["Խ"])
+("xyjd" ["н"])
+("xyji" ["Լ"])
+("xyjm" ["˽" "м"])
+("xyjn" ["н"])
+("xyjp" ["о"])
+("xyju" ["ϡн" "̾"])
+("xyjy" ["о"])
+("xyks" ["ǿ"])
+("xykv" ["ҿ"])
+("xyl'" ["" "" ""])
+("xylc" [""])
+("xyli" ["" ""])
+("xyll" [""])
+("xyls" ["¡"])
+("xylv" [""])
+("xyma" [""])
+("xymm" [""])
+("xymu" ["Ŀ"])
+("xymy" ["" "" ""])
+("xyng" [""])
+("xypd" ["ѡж"])
+("xyq'" ["" "" "" "" "" "" "ЧӦ"])
+("xyqi" ["" "" "" ""])
+("xyqq" [""])
+("xyqu" ["Ȥ"])
+("xyqy" [""])
+("xyr'" "")
+("xyrf" ["" ""])
+("xyrs" [""])
+("xys'" ["ϡ" "С˼"])
+("xysi" [""])
+("xyti" ["" ""])
+("xytl" ["̬" "̨"])
+("xyu'" ["ʶ"])
+("xyua" ["ɰ"])
+("xyug" ["ʢ" "" "ʡ"])
+("xyui" ["ʡ" "" "ʽ" "" "ʱ" "ʹ" "ʻ" "" ""])
+("xyuu" ["" "" ""])
+("xyv'" ["Сҵ" "֤" "ѡ֫"])
+("xyvd" ["״" "װ" "״"])
+("xyve" [""])
+("xyvg" [""])
+("xyvi" ["" "" ""])
+("xyvs" ["ʡ"])
+("xyw'" "")
+("xywf" ["ʡ" ""])
+("xywh" ["" ""])
+("xywi" ["ϰΪ"])
+("xywu" [""])
+("xywz" ["ζ" "Ϊ"])
+("xyx'" ["ӱ"])
+("xyxc" [""])
+("xyxd" ["" "" ""])
+("xyxi" ["ϵ"])
+("xyxm" [""])
+("xyxp" ["Ѷ"])
+("xyxq" [""])
+("xyxs" [""])
+("xyxu" [""])
+("xyxy" ["" "" "" "" "" ""])
+("xyye" ["ҹ"])
+("xyyh" [""])
+("xyyi" ["ҽ"])
+("xyyp" ["" ""])
+("xyyu" [""])
+("xyyy" ["Ӱ"])
+("xyzb" [""])
+("xyzi" [""])
+("xyzl" [""])
+("xyzo" [""])
+("xyzs" [""])
+("xz'" [""])
+("xzb'" [""])
+("xzjg" ["߻"])
+("xzq'" ["Э"])
+("xzt'" ["д̨"])
+("xzx'" ["ѡ"])
+("y" "һ")
+("yaan" ["Ű"])
+("yaba" ["ư"])
+("yabi" ["±"])
+("yadh" ["ǵ"])
+("yadi" ["ѹ"])
+("yadj" ["Ѽ"])
+("yadk" ["ѹ"])
+("yadm" ["ѹ" "ŵ"])
+("yads" ["Ƕ"])
+("yady" ["Ƕ"])
+("yae'" "ƥ")
+("yaff" [""])
+("yafu" ["ѹ"])
+("yafz" ["Ƿ"])
+("yagd" [""])
+("yagh" ["Ǹ"])
+("yagk" [""])
+("yagl" ["ѹ"])
+("yagr" ["" "Ź"])
+("yaid" [""])
+("yaii" [""])
+("yais" [""])
+("yaji" ["ѹ" "ż" ""])
+("yajm" [""])
+("yajn" ["Ѻ"])
+("yajp" ["Ǿ"])
+("yaju" ["ƾ"])
+("yajw" ["ѹ"])
+("yake" [""])
+("yali" ["ѹ"])
+("yaly" [""])
+("yama" [""])
+("yamf" [""])
+("yami" [""])
+("yapm" ["ѻƬ"])
+("yapo" ["ѹ"])
+("yaq'" "ѹѺѻѼѽѾ")
+("yaqd" ["ѹǿ"])
+("yaqi" ["ѹ"])
+("yar'" "ѹ")
+("yare" [""])
+("yarf" [""])
+("yars" ["Ѽ"])
+("yasi" ["˹"])
+("yaso" ["ѹ"])
+("yass" ["Ѻ"])
+("yasv" ["ѹ"])
+("yat'" "ѽ")
+("yatb" ["ѹͷ" "Ѿͷ"])
+("yatc" ["ѹ"])
+("yatx" [""])
+("yauw" ["ˢ"])
+("yava" ["ѹե"])
+("yavb" [""])
+("yavi" ["ѹ" "" ""])
+("yavu" ["ѹ" "ѹס"])
+("yaw'" "ѿ")
+("yaya" ["ѽѽ"])
+("yayi" ["ѹ"])
+("yayj" ["ѹ"])
+("yayp" ["ѹ" "Ѻ" "Ѻ"])
+("yayu" [""])
+("yazi" ["Ѽ" ""])
+("yazo" [""])
+("yb'" ["һ"])
+("ybai" ["а" "Ѱ"])
+("yban" ["İ"])
+("ybb'" ["۰Ͱ" "Ҷ߲"])
+("ybba" ["ְ"])
+("ybbc" ["α"])
+("ybbg" ["ͱ"])
+("ybbh" ["Ѱ"])
+("ybbm" ["ұ"])
+("ybbu" ["Ͳ"])
+("ybby" ["ͱ"])
+("ybbz" ["ֱ"])
+("ybcg" ["Ͳ"])
+("ybch" ["Ͳ"])
+("ybci" ["ɴ"])
+("ybck" ["Ͳ"])
+("ybcl" ["Ͳ"])
+("ybco" ["д"])
+("ybd'" ["Ҫ" "ն"])
+("ybdb" ["ֶ"])
+("ybde" ["е"])
+("ybdg" ["ŵ" "͵"])
+("ybdh" ["ε"])
+("ybdi" ["ʵ" "е" "ҵ"])
+("ybdj" ["첽綯"])
+("ybdk" ["е" "յ"])
+("ybdl" ["Ŵ" "д"])
+("ybdm" ["ŵ" "ʵ" "е"])
+("ybds" ["ζ"])
+("ybdu" ["һ˵"])
+("ybdv" ["ֶ"])
+("ybdw" ["һȼ"])
+("ybe'" "ݬ")
+("yber" ["Ҷ" "ն" "׶"])
+("ybf'" ["һ"])
+("ybfa" ["շ"])
+("ybff" ["Ƿ"])
+("ybfh" ["ͷ" "з" "ҷ"])
+("ybfu" ["Ÿ"])
+("ybgb" ["ʹ"])
+("ybgd" ["͹" "й"])
+("ybge" ["и"])
+("ybgf" ["׸"])
+("ybgo" ["͹" "й"])
+("ybgr" ["͹" "͹" "й"])
+("ybgs" ["й"])
+("ybgv" ["й"])
+("ybgx" ["һʹ"])
+("ybgz" ["ָ"])
+("ybh'" ["һ㻯"])
+("ybhb" ["ź"])
+("ybhe" ["ֺ"])
+("ybhk" ["Ѻ"])
+("ybhl" ["к"])
+("ybho" ["ջ"])
+("ybhr" ["ǻ"])
+("ybhv" ["Ż" "ͻ" "ֻ"])
+("ybhw" ["Ż" "ͻ" "ͻ"])
+("ybhz" [""])
+("ybia" ["Ͳ"])
+("ybib" ["ǳ"])
+("ybig" ["г"])
+("ybih" ["Ƴ" "г"])
+("ybii" ["ֳ"])
+("ybio" ["ʴ"])
+("ybir" ["ʹ"])
+("ybis" ["׳"])
+("ybiu" ["ʳ"])
+("ybjc" ["ֽ"])
+("ybjd" ["ս"])
+("ybji" ["ʼ" "λ" "μ" "л" "ּ"])
+("ybjm" ["ʼ" "м"])
+("ybjn" ["о"])
+("ybjp" ["Ѿ" "Ҿ"])
+("ybjq" ["ƾ" "о"])
+("ybju" ["ʾ" ";"])
+("ybjw" ["м"])
+("ybjy" ["ľ" ";"])
+("ybkd" ["˿" "Ϳ"])
+("ybke" ["ο" "п" "ֿ"])
+("ybki" ["α꿨"])
+("ybku" ["Ϳ"])
+("ybl'" ["ò"])
+("yblc" ["" ""])
+("ybld" [""])
+("yble" [""])
+("ybli" ["" "" "" "" "" ""])
+("yblj" [""])
+("yblk" [""])
+("ybll" ["" "" ""])
+("ybln" [""])
+("yblp" [""])
+("yblv" ["" ""])
+("yblx" ["" "Ԥ"])
+("ybly" ["" ""])
+("yblz" [""])
+("ybmc" [""])
+("ybmf" [""])
+("ybmm" [""])
+("ybmn" [""])
+("ybmo" ["Ĭ" "ī"])
+("ybmu" [""])
+("ybmy" ["" ""])
+("ybmz" [""])
+("ybng" [""])
+("ybni" ["" ""])
+("ybnm" ["" ""])
+("ybpc" ["Ʊ"])
+("ybpl" [""])
+("ybpm" ["ƭ"])
+("ybq'" "")
+("ybqi" ["" "" ""])
+("ybqm" ["Ǯ"])
+("ybqr" ["Ȩ"])
+("ybqu" ["Ȥ"])
+("ybqy" ["" "" "" ""])
+("ybr'" ["" "" "" "" "" "" "" "٧" "" "" "" "" "" "ҪȻ" "һ"])
+("ybrf" ["" "" ""])
+("ybrj" ["Ȼ"])
+("ybru" ["" "" ""])
+("ybse" ["ɫ"])
+("ybsi" ["˾"])
+("ybso" [""])
+("ybsr" [""])
+("ybss" [""])
+("ybtb" ["ͷ"])
+("ybtc" [""])
+("ybtd" ["һͿ"])
+("ybti" [""])
+("ybtk" [""])
+("ybtl" ["̫"])
+("ybtm" [""])
+("ybts" ["ͩ" "Ͱ"])
+("ybty" ["ͧ"])
+("ybu'" ["Ҫ" "һ" "б"])
+("ybua" ["ɱ"])
+("ybub" [""])
+("ybuf" ["" ""])
+("ybug" ["ʤ" ""])
+("ybuh" [""])
+("ybui" ["" "ʧ" "ʱ" "ʶ" "" ""])
+("ybul" ["һ˵"])
+("ybuu" [""])
+("ybuv" ["ˮ" "˵" "˯"])
+("ybv'" ["һץ" "ò"])
+("ybvb" [""])
+("ybve" [""])
+("ybvg" [""])
+("ybvi" ["" "ַ" "֬" "ֽ" ""])
+("ybvj" ["һ" "ձ"])
+("ybvs" ["" "" ""])
+("ybw'" "ݯݵ")
+("ybwf" [""])
+("ybwj" ["" ""])
+("ybwu" ["" ""])
+("ybwz" ["Ϊ" "ν"])
+("ybxc" ["Ч" "С"])
+("ybxd" ["" "" ""])
+("ybxi" ["Ϸ" "ϲ"])
+("ybxj" ["ұ"])
+("ybxm" ["" "" "" ""])
+("ybxn" [""])
+("ybxq" [""])
+("ybxr" ["ѡ"])
+("ybxx" ["Щ" "Э"])
+("ybxy" ["" "" "" ""])
+("ybya" ["ѹ" "ѿ"])
+("ybyb" ["" "" ""])
+("ybyh" [""])
+("ybyi" ["" "" "" "" "" "" "" "һ"])
+("ybyk" ["Ҫ"])
+("ybyn" ["ӡ"])
+("ybyr" ["Զ" "԰" "Դ"])
+("ybys" ["Ӿ" ""])
+("ybyt" ["Խ"])
+("ybyu" ["" "" "" "" "ԥ" "" ""])
+("ybz'" ["һ" "ӡ"])
+("ybzh" ["Ͳ"])
+("ybzi" ["" ""])
+("ybzl" [""])
+("ybzs" [""])
+("yc'" [""])
+("ycfi" ["һη"])
+("yckj" ["ɴ˿ɼ"])
+("ycl'" ["ò" "ԭ"])
+("yclt" [""])
+("yctu" ["ͬʱ"])
+("yd'" ["е"])
+("ydar" ["ӡڰ"])
+("ydb'" ["ʵ粿"])
+("ydbd" ["һ"])
+("ydd'" ["Զص"])
+("yddh" ["ƶ绰"])
+("yddm" ["Ե"])
+("yde'" ["һ"])
+("ydf'" ["һٷ"])
+("ydfu" ["еķʸ"])
+("ydh'" ["" "Լ" "˶"])
+("ydi'" ["ԭ" "˶"])
+("ydj'" ["" "ԭ"])
+("ydjj" ["˶"])
+("ydjs" ["˶"])
+("ydl'" ["" "ԭ"])
+("ydny" ["ӡ"])
+("ydp'" ["һ"])
+("ydq'" ["" "һ"])
+("ydu'" ["鶨" "е"])
+("ydv'" ["õ"])
+("ydvn" ["ӡ֧"])
+("ydvy" [""])
+("ydx'" ["ҹѧ"])
+("ydy'" ["һһ" "ӡ" "˶Ա"])
+("ydyd" ["һһ"])
+("ye'" [""])
+("yeba" ["Ҳ"])
+("yebi" ["Ҳ"])
+("yebj" ["ҹ" "ҹ"])
+("yebu" ["Ҳ"])
+("yeby" ["Ҷ"])
+("yebz" ["Ҳ"])
+("yecg" ["Ҳ"])
+("yecj" ["Ұ"])
+("yecl" ["Ұ"])
+("yedb" ["Ҳ"])
+("yede" ["Ҳ"])
+("yedi" ["Ұ"])
+("yee'" "ҰұҲ")
+("yeer" ["ү" "Ҷ"])
+("yegd" ["ҹ"])
+("yegz" ["Ҳ"])
+("yehh" ["ҹ"])
+("yehk" ["Ҳ"])
+("yehl" ["Ҳ"])
+("yeho" ["Ұ"])
+("yehv" ["Ҳ"])
+("yehw" ["Ұ" "Һ"])
+("yei'" ["Ҷ"])
+("yeia" ["ҹ"])
+("yejc" ["Ҳ"])
+("yeji" ["Ұ" "ҵ"])
+("yejm" ["ҹ" "˼"])
+("yejn" ["ұ"])
+("yejq" ["Ҳ"])
+("yejy" ["ҵ" "ҹ" "Һ"])
+("yeke" ["Ҳ"])
+("yeks" ["ҹ"])
+("yeli" ["ҹ" "Һ"])
+("yell" ["Ҳ" "ҹ"])
+("yelm" ["ұ"])
+("yelp" ["Ҷ"])
+("yema" ["Ұ" "ҳ"])
+("yemf" ["ү" "Ҳ"])
+("yemj" ["Ұ"])
+("yeml" ["Ҷ"])
+("yemm" ["Ҷ"])
+("yemu" ["ҹĻ"])
+("yemz" ["Ҳû"])
+("yeng" ["Ҳ"])
+("yepk" ["Һ"])
+("yepm" ["ҶƬ"])
+("yeq'" "ҬҭҮҴ")
+("yeqc" ["Ҷ"])
+("yer'" "ҳҴҵҶҷҸҹҺק")
+("yerb" ["Ҷ"])
+("yerf" ["Ұ"])
+("yese" ["ҹɫ"])
+("yesp" ["ү"])
+("yesr" ["Ҷ"])
+("yesu" ["Ү"])
+("yet'" ["Ŷ"])
+("yeti" ["Һ"])
+("yetl" ["Һ̬"])
+("yetu" ["Ұ"])
+("yety" ["Ҷͦ"])
+("yeub" ["Ұ"])
+("yeuf" ["ҹ"])
+("yeug" ["Ұ"])
+("yeui" ["Ҳʹ" "Ҳ" "ҹ"])
+("yeuu" ["ҳ"])
+("yevj" ["Ұս"])
+("yevu" ["ҵ"])
+("yew'" "аҮү")
+("yewj" ["ҹ"])
+("yewl" ["Ұ"])
+("yewo" ["Ҹ"])
+("yewu" ["ҵ"])
+("yewz" ["ҲΪ"])
+("yexc" ["ҹУ"])
+("yexd" ["Ҳ"])
+("yexi" ["ҹϮ"])
+("yexm" ["Ҳ" "Ҵ"])
+("yexn" ["Ұ"])
+("yexu" ["Ҳ"])
+("yexw" ["Ҹ"])
+("yey'" ["׶԰"])
+("yeya" ["ҰѼ" "Ҷѿ" "Ҹѿ" "Һѹ"])
+("yeyb" ["Ҳ"])
+("yeye" ["үү" "ҶҸ"])
+("yeyi" ["Ҳ" "ҵ"])
+("yeyj" ["ҳ"])
+("yeyk" ["ҲҪ"])
+("yeyu" ["ҵ"])
+("yeyy" ["ҰӪ" "ҲӦ"])
+("yezi" ["Ҭ" "Ҷ"])
+("yezl" ["Ҳ"])
+("yf'" ["ҷ"])
+("yfbd" ["ԭⲻ"])
+("yffu" ["һ˳"])
+("yfhy" ["Ƿǻ"])
+("yfk'" ["Ԥ"])
+("yfm'" ["һ"])
+("yfsv" ["Լ"])
+("yfui" [""])
+("yfwe" ["һΪ"])
+("yfwv" ["ԤΪ"])
+("yfy'" [""])
+("yfyv" ["һһ"])
+("yfyw" ["Υ"])
+("yfz'" ["һ"])
+("yfzb" ["Ԥʱ"])
+("yg'" ["һ"])
+("ygbp" ["Ÿ"])
+("ygej" ["һɶ"])
+("ygel" ["һŶ"])
+("ygf'" ["ӫ"])
+("yggl" ["й"])
+("yggy" ["ƹԭ"])
+("ygh'" ["칹"])
+("ygii" ["¹ڳ"])
+("ygje" ["һ"])
+("ygl'" ["Ӣ"])
+("yglv" ["һ"])
+("ygp'" ["ӫ"])
+("ygt'" ["칹" "Ӳͷ"])
+("ygyj" ["ио"])
+("ygyl" ["Ӳ"])
+("ygyq" ["ϸҪ"])
+("ygyu" ["޹ɽ"])
+("ygz'" [""])
+("yh'" ["Ժ"])
+("yhb'" [""])
+("yhbf" [""])
+("yhbj" [""])
+("yhbu" [""])
+("yhby" ["" ""])
+("yhcs" [""])
+("yhd'" ["" ""])
+("yhdi" [""])
+("yhdm" [""])
+("yhdv" ["ᶷ"])
+("yhe'" ["" "" "" "" "һ" "һ"])
+("yhff" [""])
+("yhfg" [""])
+("yhfh" [""])
+("yhfu" [""])
+("yhg'" ["" "" ""])
+("yhgd" ["" "" ""])
+("yhge" [""])
+("yhgk" [""])
+("yhh'" ["Үͻ"])
+("yhhe" [""])
+("yhhh" [""])
+("yhho" ["" ""])
+("yhhu" [""])
+("yhhv" [""])
+("yhhw" ["ﻨ" ""])
+("yhhy" [""])
+("yhi'" [""])
+("yhie" [""])
+("yhig" ["" "" ""])
+("yhj'" [""])
+("yhjc" ["" ""])
+("yhji" ["" ""])
+("yhjm" [""])
+("yhjw" [""])
+("yhl'" ["" ""])
+("yhlc" [""])
+("yhli" [""])
+("yhlk" [""])
+("yhlq" ["" ""])
+("yhlu" ["·"])
+("yhly" [""])
+("yhm'" ["ø" "þ"])
+("yhmc" [""])
+("yhmk" ["ë"])
+("yhmm" ["" ""])
+("yhmu" ["Ľ"])
+("yhmz" ["÷"])
+("yhp'" ["׺Ʒ"])
+("yhpi" ["Ƥ"])
+("yhpn" ["Ʒ"])
+("yhq'" ["" "" "" "" "" "" "Ǧ" "ȭ" "ȯ" "Żȯ"])
+("yhqi" ["" "" ""])
+("yhqm" ["Ǯ"])
+("yhqn" [""])
+("yhqp" ["Ⱥ"])
+("yhqq" [""])
+("yhr'" "")
+("yhrb" [""])
+("yhrf" [""])
+("yhrs" [""])
+("yht'" ["" "ͭ" ""])
+("yhti" ["кس"])
+("yhtl" ["̨" "·"])
+("yhtm" [""])
+("yhu'" ["ԭ"])
+("yhug" ["" ""])
+("yhuh" [""])
+("yhui" ["" "ʽ"])
+("yhuo" ["˷"])
+("yhuu" [""])
+("yhuv" ["ˮ"])
+("yhv'" [""])
+("yhvb" [""])
+("yhvd" ["װ"])
+("yhvh" ["ʺ"])
+("yhvi" ["ֳ"])
+("yhvu" [""])
+("yhw'" ["" "" "" "" "" "" "" "" "" "" "" "" "û"])
+("yhwf" [""])
+("yhwh" [""])
+("yhwo" [""])
+("yhwu" [""])
+("yhwz" [""])
+("yhx'" ["п" "ϵ" "Լѷ"])
+("yhxy" ["" ""])
+("yhy'" ["ú԰"])
+("yhyb" [""])
+("yhyh" ["" "" ""])
+("yhyi" [""])
+("yhyj" [""])
+("yhyk" [""])
+("yhys" ["Ӿ"])
+("yhyt" ["ͭ"])
+("yhyu" ["" ""])
+("yhyv" ["ֺר"])
+("yhzb" ["ʱ"])
+("yhzi" ["" "" "" ""])
+("yhzs" ["׻"])
+("yhzy" ["컯"])
+("yi'" ["ô"])
+("yian" ["鰸"])
+("yib'" ["ʴ"])
+("yiba" ["Ѱ"])
+("yibb" ["һɲ"])
+("yibc" ["Ǳ"])
+("yibd" ["ﳤܶ"])
+("yibf" ["ұ" "뱾"])
+("yibi" ["һ"])
+("yibj" ["һ" "һ"])
+("yibk" ["ױ"])
+("yibm" ["һ" "Ա"])
+("yibn" ["˱"])
+("yibo" ["²"])
+("yibu" ["Ѳ" "첽"])
+("yibx" [""])
+("yiby" ["һ" "߲"])
+("yibz" ["α" "ѱ" "Ա"])
+("yici" ["һ" "" "" "Դ"])
+("yicj" ["ϲ"])
+("yicl" [""])
+("yicp" [""])
+("yics" ["Ѵ"])
+("yid'" [""])
+("yide" ["һ"])
+("yidg" ["һ"])
+("yidi" [""])
+("yidj" ["һ"])
+("yidk" ["һ"])
+("yidl" ["һ" "һ"])
+("yidm" ["һ" "ɵ" ""])
+("yidr" ["һ" "һ" "ܶ" ""])
+("yids" ["һ" "" "ƶ" "Զ" "׶"])
+("yidu" ["һ" "涼"])
+("yidv" ["һ"])
+("yidy" ["һ" "鶨"])
+("yie'" "β")
+("yier" ["һ" "Ѷ"])
+("yifa" ["һ" "" "淢"])
+("yiff" ["һ" "·" ""])
+("yifh" ["ҷ"])
+("yifj" ["һ"])
+("yifu" ["һ" "" "·"])
+("yifz" [""])
+("yig'" ["ݳ"])
+("yige" ["һ"])
+("yigi" ["Ŵ"])
+("yigj" ["һ"])
+("yigl" ["һ"])
+("yigo" [""])
+("yigr" ["һ" "¹"])
+("yigs" ["һ"])
+("yigu" ["ѹ"])
+("yigv" ["¹"])
+("yihb" ["Ժ"])
+("yihd" ["һ"])
+("yihe" [""])
+("yihf" ["ź"])
+("yihh" ["һ" ""])
+("yihj" ["ź"])
+("yihk" ["һ"])
+("yihl" ["ź"])
+("yiho" ["ɻ" "ֻ"])
+("yihp" ["ѻ"])
+("yihr" ["໹"])
+("yihs" [""])
+("yihv" [""])
+("yihw" ["컯"])
+("yiig" [""])
+("yiih" ["˲" "쳣"])
+("yiij" ["Ų"])
+("yiip" ["˴" "Ҵ"])
+("yiir" ["Ŵ"])
+("yiis" [""])
+("yiiu" ["" "洦" ""])
+("yijc" ["һ" "Ž" "ƽ"])
+("yiji" ["һ" "ż" "Ѽ" "Լ" "༴" "켺"])
+("yijj" ["в׼"])
+("yijm" ["һ" ""])
+("yijn" ["ҿ" "½" "Խ"])
+("yijq" ["һ" ""])
+("yijt" [""])
+("yiju" ["һ" "" "ƾ" "ɾ" "Ѿ"])
+("yijw" ["һ" ""])
+("yijx" ["һ"])
+("yijy" ["һ" "Ѿ" "׾" "⾳"])
+("yik'" ["һ"])
+("yikb" ["һ"])
+("yike" ["һ" "ҽ"])
+("yikk" ["" "п"])
+("yikl" ["ƿ"])
+("yiku" [""])
+("yiky" ["һ"])
+("yil'" ["" "Ԥ"])
+("yilb" ["©"])
+("yilc" ["ҽ" "" ""])
+("yilh" [""])
+("yili" ["һ" "һ" "" "" ""])
+("yilj" ["һ"])
+("yilk" [""])
+("yill" ["һ" "" "" ""])
+("yilm" ["һ" ""])
+("yilp" [""])
+("yilq" ["һ" "" ""])
+("yilu" ["һ·"])
+("yilv" ["һ" "" ""])
+("yilz" [""])
+("yima" ["" ""])
+("yimc" ["" ""])
+("yimg" [""])
+("yimi" [""])
+("yimm" ["һ" ""])
+("yimn" ["һ" "" ""])
+("yimo" ["һĨ"])
+("yimv" ["һĪչ"])
+("yinc" [""])
+("yinj" ["" ""])
+("yinm" ["һ"])
+("yinz" [""])
+("yip'" ["ԭ"])
+("yipj" ["һ"])
+("yipm" ["һƫ" "һƬ"])
+("yipx" ["һƳ"])
+("yiq'" "һҼҽҾҿ")
+("yiqi" ["һ" "һ" "һ" "" "" "" "" ""])
+("yiqm" ["һǧ" "ǰ"])
+("yiqq" [""])
+("yiqr" ["ȩ"])
+("yiqt" ["Ȳ"])
+("yiqu" ["һ" ""])
+("yiqx" ["һ"])
+("yiqy" ["һ" ""])
+("yir'" "߰٫ܲ޲߽߮")
+("yirf" ["һ" "" ""])
+("yiri" ["һ" "" ""])
+("yirj" ["Ȼ" "Ȼ" "ȼ" "Ȼ"])
+("yirs" [""])
+("yiru" ["һ"])
+("yise" ["һɫ"])
+("yisi" ["һ˿" "˼" ""])
+("yisr" [""])
+("yisv" [""])
+("yitb" ["һͷ"])
+("yith" [""])
+("yiti" ["һ" "" "" ""])
+("yitl" ["̫"])
+("yitm" ["һ" ""])
+("yitr" ["һ" ""])
+("yits" ["һͬ" "һͳ" "ͬ"])
+("yitu" ["ͼ"])
+("yitx" ["һ"])
+("yiu'" [""])
+("yiub" ["һ"])
+("yiuf" ["һ"])
+("yiug" ["һ" "ҽ"])
+("yiuh" ["" ""])
+("yiui" ["һʱ" "һ" "һ" "ҽʦ" "ʳ" "ʧ" "ʽ" "" "ʶ" "ʿ" ""])
+("yiuj" ["һɽ" ""])
+("yiup" ["һ˲"])
+("yiuu" ["ҽ" "" ""])
+("yiv'" ["в"])
+("yivb" ["һ" ""])
+("yive" ["" ""])
+("yivf" ["һ"])
+("yivh" ["һ" "" "" "鳤"])
+("yivi" ["һֱ" "һ" "ҽ" "ַ" "־" "ֲ" "֪" "" "" "ֹ" "" "ּ" "־"])
+("yivj" ["չ" "վ"])
+("yivk" ["һ" ""])
+("yivo" [""])
+("yivp" ["һ׼"])
+("yivr" ["гת"])
+("yivs" ["һ"])
+("yivu" ["" ""])
+("yiw'" "ڱ")
+("yiwf" ["" "" ""])
+("yiwh" ["" "" ""])
+("yiwj" ["һ" "" ""])
+("yiwl" ["" ""])
+("yiwu" ["һ" "ҽ" "" "" "" "" ""])
+("yiwv" ["Ŵ"])
+("yiwz" ["һζ" "" "λ" "Ϊ" "λ" "ζ" "ζ"])
+("yix'" ["Ŵ" "Ŵѧ" "˳ѧ"])
+("yixd" ["һ" "" "" "" "" "" "" ""])
+("yixi" ["ϡ" "ϩ" "" "ϯ"])
+("yixm" ["һ" "" ""])
+("yixn" ["һ" ""])
+("yixt" ["ҽѧ"])
+("yixw" ["һ" ""])
+("yixx" ["һЩ" "ŴϢ"])
+("yixy" ["һ" "" "" ""])
+("yiyb" ["һ" "" ""])
+("yiye" ["һҶ" "ҵ"])
+("yiyh" ["һ" "" ""])
+("yiyi" ["" "" "" "" ""])
+("yiyj" ["һ" ""])
+("yiyk" ["ҽҩ"])
+("yiyn" ["" ""])
+("yiyr" ["Ա" "ҽԺ" "Ը" "Զ" "Ը" "Ժ"])
+("yiys" ["" ""])
+("yiyt" ["һ"])
+("yiyu" ["һ" "" ""])
+("yiyy" ["һӦ"])
+("yizi" ["" ""])
+("yizj" ["ӽ"])
+("yizk" ["һ" ""])
+("yizl" ["һ" "" ""])
+("yizs" ["һ"])
+("yizu" ["" "" ""])
+("yj'" ["Լ"])
+("yjan" ["Ӱ" "ذ"])
+("yjba" ["ΰ"])
+("yjbi" ["ڱ"])
+("yjbj" ["ϰ"])
+("yjbl" ["л"])
+("yjbm" ["ݱ"])
+("yjbv" ["һ겻"])
+("yjcg" ["Ҳ"])
+("yjci" ["ϴ" "Դ" "Դ"])
+("yjck" ["̲"])
+("yjcs" ["̴"])
+("yjd'" ["żӴ" "μ"])
+("yjdb" ["̶"])
+("yjdi" ["۵"])
+("yjdl" ["̴"])
+("yjdm" [""])
+("yjds" ["϶" "Ҷ"])
+("yje'" "ٲ۱")
+("yjfa" ["η"])
+("yjfh" ["Ϸ" "鷽"])
+("yjfj" ["ᷳ"])
+("yjfl" ["л"])
+("yjfu" ["ϸ"])
+("yjgd" ["۹" ""])
+("yjge" ["˸" "ϸ" "ظ"])
+("yjgl" ["ڸ"])
+("yjgo" ["̹"])
+("yjgy" ["ұҵ"])
+("yjh'" ["μ" "һ仰" "мƻ" "¼"])
+("yjhb" ["ʺ"])
+("yjhe" ["Ӻ" "Ժ" "غ"])
+("yjhi" ["лϳ"])
+("yjhj" ["Ϻ"])
+("yjhl" ["غ"])
+("yjho" ["̻" ""])
+("yjhr" ["ӻ"])
+("yjhs" ["ۺ"])
+("yjhu" ["κ" "ڻ"])
+("yjhv" ["̻" ""])
+("yjhw" ["̻" "ۻ" "ݻ" "л"])
+("yjhx" ["лѧ"])
+("yji'" [""])
+("yjif" ["̳"])
+("yjig" ["γ" "ϳ"])
+("yjih" ["γ" "ӳ" "ݳ"])
+("yjii" ["γ" "ӳ"])
+("yjis" ["۳"])
+("yjiu" ["ݳ"])
+("yjjc" ["۽"])
+("yjjd" ["ҽ" "ؽ" "ݽ"])
+("yjjm" ["̼" "μ" "ۼ" ""])
+("yjjn" ["Ͻ" "ݽ"])
+("yjjp" ["Ͼ"])
+("yjjq" ["о"])
+("yjjr" [""])
+("yjju" ["ݾ"])
+("yjjx" ["۽"])
+("yjjy" ["۾" "۾" "ྩ"])
+("yjkd" ["ۿ"])
+("yjke" ["ۿ"])
+("yjkj" ["ۿ"])
+("yjku" ["Ͽ"])
+("yjlc" [""])
+("yjld" ["һ"])
+("yjli" ["" "" "" ""])
+("yjlp" [""])
+("yjlu" ["±" "·"])
+("yjlx" ["ӢϿ"])
+("yjly" [""])
+("yjlz" ["" ""])
+("yjm'" ["۽ë"])
+("yjmi" [""])
+("yjml" ["" ""])
+("yjmo" ["û" "ĥ"])
+("yjmu" ["Ļ"])
+("yjmy" [""])
+("yjmz" ["ú"])
+("yjn'" [""])
+("yjng" [""])
+("yjnm" [""])
+("yjpi" ["Ƥ"])
+("yjq'" "۳")
+("yjqi" [""])
+("yjqm" ["ǰ"])
+("yjqq" [""])
+("yjqr" ["Ȧ"])
+("yjqy" [""])
+("yjr'" "")
+("yjre" [""])
+("yjrj" ["ٲȻ" "Ȼ"])
+("yjrs" [""])
+("yjs'" ["о"])
+("yjse" ["ɫ" "ɫ"])
+("yjsi" [""])
+("yjsr" ["" "" ""])
+("yjsu" [""])
+("yjt'" ["μ" "л"])
+("yjtb" ["ͷ" "ͷ"])
+("yjti" [""])
+("yjtj" ["̸"])
+("yjtk" [""])
+("yjtl" ["̨"])
+("yjts" ["Ͳ"])
+("yjtu" ["" "" ";"])
+("yju'" ["о" "о" "ҩʦ"])
+("yjub" ["" ""])
+("yjue" [""])
+("yjuf" ["" ""])
+("yjuh" [""])
+("yjui" ["ʯ" "" "ʱ" "ʾ" "ʬ"])
+("yjuj" ["ɽ" "ɽ"])
+("yjuo" ["˵"])
+("yjuv" ["ˮ" "˰"])
+("yjv'" ["λս" "л"])
+("yjvb" [""])
+("yjve" ["" ""])
+("yjvg" ["" "" "֢" "֤" ""])
+("yjvi" ["" "֬" "һ֮"])
+("yjvj" ["չ"])
+("yjvq" ["м֤ȯ"])
+("yjvs" [""])
+("yjw'" "Ǧܾ")
+("yjwh" [""])
+("yjwo" ["" ""])
+("yjwu" ["" "" ""])
+("yjx'" [""])
+("yjxi" ["" "Ϯ" "ϰ" "Ϸ" "ϯ"])
+("yjxm" [""])
+("yjxn" ["" ""])
+("yjxr" [""])
+("yjxt" ["Ѫ"])
+("yjxu" [""])
+("yjxw" [""])
+("yjxy" ["" ""])
+("yjy'" ["оԱ"])
+("yjye" ["Ҷ" "ҵ"])
+("yjyi" [""])
+("yjyj" ["" "" "ּ־"])
+("yjyr" ["Ա"])
+("yjys" [""])
+("yjyu" ["" "" "ӵ"])
+("yjyy" ["ӳ"])
+("yjzb" [""])
+("yjzi" [""])
+("yk'" [""])
+("ykba" ["ҡ" "Ҫ"])
+("ykbi" ["ҡ" "Ҫ"])
+("ykbk" [""])
+("ykbl" ["ҡ" "ң"])
+("ykbu" ["" "Ҫ"])
+("ykce" ["ң"])
+("ykcl" ["ҩ"])
+("ykcs" ["Ҫ"])
+("ykde" ["Ҫ"])
+("ykdh" ["ҡ"])
+("ykdi" ["Ҫ"])
+("ykdk" ["" "Ҫ" "Ҫ"])
+("ykdl" [""])
+("ykdm" ["Ҫ"])
+("ykds" ["ҡ" "Ҥ"])
+("ykdv" ["Ҫ"])
+("yke'" "ҧҨ")
+("ykff" ["ҩ"])
+("ykfg" [""])
+("ykfh" ["ҩ" "ҩ"])
+("ykfj" ["Ҫ" "Ҫ"])
+("ykfz" ["ҩ"])
+("ykgj" ["ҡ" "ң"])
+("ykgk" ["ҩ"])
+("ykgs" ["" "Ҫ"])
+("ykgu" [""])
+("ykgy" [""])
+("ykgz" ["Ҫ"])
+("ykhd" ["ҡ"])
+("ykhe" ["Ҫ" "ߺ"])
+("ykhk" ["Ҫ"])
+("ykhl" ["ҩ" "Ҫ"])
+("ykhw" [""])
+("ykie" ["ҡ"])
+("ykih" ["ҩ"])
+("ykir" ["ҥ"])
+("ykis" ["Ҫ"])
+("ykjd" ["Ҫ"])
+("ykji" ["" "ҩ"])
+("ykjm" ["Ҫ"])
+("ykjn" ["Ҫ"])
+("ykjq" ["ҩ" "Ҫ"])
+("ykjy" [""])
+("ykkk" ["Ҫ"])
+("ykks" ["ң"])
+("ykld" ["ҩ"])
+("yklj" ["ҡ"])
+("yklt" ["Ҫ"])
+("ykly" ["Ҫ"])
+("ykme" ["Ҫô"])
+("ykmo" ["ħ" "Լ"])
+("ykmu" ["ҪĿ"])
+("ykmy" ["Ҫ"])
+("ykpm" ["ҩƬ"])
+("ykpn" ["ҩƷ"])
+("ykpu" ["ҩ"])
+("ykq'" ["" "" "" "Ҫ" "Լ" "ز" "ߺ" "" "һ"])
+("ykqd" ["Ҫǿ"])
+("ykqq" ["Ҫ"])
+("ykqy" [""])
+("ykr'" "űҩҪҫԿ")
+("ykrf" ["Ҫ"])
+("ykrh" ["Ҫ"])
+("yks'" ["ſ"])
+("yksl" ["Ҫ"])
+("yksr" [""])
+("ykst" ["˼"])
+("yksu" ["Ҫ"])
+("yktb" ["ҡͷ"])
+("ykts" ["Ҫͬ"])
+("yktu" ["ͬ"])
+("ykub" ["ҡ"])
+("ykui" ["Ҫʹ" "Ҫ" "Ҫ" "Կ"])
+("ykup" ["Ң˴"])
+("ykuv" ["ҩˮ"])
+("ykve" ["ز"])
+("ykvi" ["Ҫְ"])
+("ykvj" ["ն"])
+("ykvu" ["ҧס"])
+("ykw'" "ҡҢңҤҥҦس")
+("ykwf" ["Ҫ"])
+("ykwj" ["ҩ"])
+("ykwu" ["ҩ"])
+("ykwz" ["Χ" "ҪΪ"])
+("ykxd" ["Ҫ" "Ҫ"])
+("ykxx" ["ҪЮ"])
+("ykxy" ["ҩ"])
+("ykya" ["ҧ"])
+("ykyb" ["Ҫ" "Ҫ"])
+("ykyd" ["һҧ"])
+("ykye" ["ҡҷ"])
+("ykyi" ["Ҫ" "Ҫ" ""])
+("ykyj" ["ҥ" "ҫ"])
+("ykyk" ["ҡҡ" "ңң"])
+("ykyr" ["ңԶ"])
+("ykys" ["Ҫ"])
+("ykyt" ["Լ"])
+("ykyu" ["Ҫ"])
+("ykzi" [""])
+("ykzl" ["Ҫ"])
+("ykzo" ["Ҫ"])
+("ykzu" [""])
+("yl'" [""])
+("ylb'" ["ѹ" "Ӣ" "һ"])
+("ylbx" ["ҽƱ"])
+("yldv" [""])
+("ylf'" ["ҽƷ"])
+("ylfi" [""])
+("ylfr" [""])
+("ylid" ["Һ"])
+("ylj'" ["ѹ" "ѹ" "Ѽ̽"])
+("yljj" ["ªͼ"])
+("ylk'" [""])
+("ylkt" ["ͼ"])
+("yll'" ["" ""])
+("ylp'" ["Ƭ"])
+("ylq'" [""])
+("yls'" ["" "Ҷ"])
+("ylsl" ["Ү·"])
+("ylsy" [""])
+("ylt'" ["Ҷ" "ͧ"])
+("ylu'" [""])
+("ylud" ["ɽ"])
+("ylx'" ["ѧ"])
+("yly'" ["ԪԺ" "ԽԽ" ""])
+("ylyj" ["Ѿ"])
+("ylyy" ["һ"])
+("ylz'" [""])
+("ylzj" ["³ز"])
+("ylzw" [""])
+("ym'" [""])
+("yme'" ["ö"])
+("ymgd" ["Ŀ"])
+("ymgj" ["ı"])
+("ymh'" [""])
+("ymig" ["Բɹ"])
+("ymj'" ["ı" "Բ"])
+("ymlr" ["һĿȻ"])
+("ymm'" ["" ""])
+("ymq'" ["" "ë"])
+("ymsh" [""])
+("ymtq" ["ü"])
+("ymvx" ["֮"])
+("ymwu" ["ʵ"])
+("ymwv" ["֪"])
+("ymxi" ["һ"])
+("ymy'" ["û"])
+("ymyy" ["һģһ"])
+("yn'" ["һ"])
+("ynan" [""])
+("ynbc" [""])
+("ynbi" ["" "" ""])
+("ynbk" [""])
+("ynbl" [""])
+("ynbo" [""])
+("ynch" [""])
+("ynci" ["" ""])
+("yndc" [""])
+("ynde" [""])
+("yndh" [""])
+("yndk" ["" ""])
+("yndm" [""])
+("yndt" ["һ굽ͷ"])
+("yndu" ["" "ӡ"])
+("yne'" "")
+("yner" ["" ""])
+("ynfa" ["" "ӡ"])
+("ynff" [""])
+("ynfu" ["" ""])
+("yngf" [""])
+("yngj" [""])
+("yngk" [""])
+("yngo" [""])
+("yngu" [""])
+("ynhe" ["" ""])
+("ynhf" ["" "ӡ"])
+("ynhh" [""])
+("ynhj" [""])
+("ynhk" [""])
+("ynhr" [""])
+("ynhv" ["" ""])
+("ynhw" ["" "ӡ"])
+("ynia" [""])
+("ynif" [""])
+("ynig" [""])
+("ynir" [""])
+("yniu" [""])
+("ynji" [""])
+("ynjn" [""])
+("ynjq" [""])
+("ynju" [""])
+("ynjx" ["" ""])
+("ynjy" [""])
+("ynkd" [""])
+("ynlc" [""])
+("ynld" ["" "" ""])
+("ynli" ["" "" "" ""])
+("ynlq" [""])
+("ynlr" [""])
+("ynlu" ["·"])
+("ynlv" [""])
+("ynma" [""])
+("ynmb" ["ı"])
+("ynmj" [""])
+("ynmu" ["Ļ"])
+("ynmy" [""])
+("ynnh" [""])
+("ynni" ["" "ӡ"])
+("ynpg" [""])
+("ynpl" [""])
+("ynpn" ["Ƶ"])
+("ynq'" "ܧ")
+("ynqc" [""])
+("ynqi" ["" ""])
+("ynqm" ["Ǯ"])
+("ynqn" ["" ""])
+("ynqu" [""])
+("ynqx" [""])
+("ynr'" ["" "" "ӡ" "ط" "" "" "Խ"])
+("ynrf" [""])
+("ynrj" ["ӡȾ"])
+("ynru" [""])
+("ynse" ["ɫ"])
+("ynsf" ["ɭ"])
+("ynsj" ["һļ"])
+("ynsu" ["" ""])
+("yntm" [""])
+("yntr" [""])
+("ynu'" ["ʡ"])
+("ynuf" [""])
+("ynui" ["ʽ" "ʳ" "ʿ"])
+("ynuj" ["ɽ"])
+("ynuu" ["" ""])
+("ynuv" ["ˮ" "ˮ"])
+("ynuw" ["ӡˢ"])
+("ynvg" ["֤" "ӡ֤"])
+("ynvh" ["ӡ"])
+("ynvi" ["" "ӡ"])
+("ynvp" ["׼"])
+("ynvs" [""])
+("ynvx" ["ūѧ"])
+("ynw'" "۴")
+("ynwf" [""])
+("ynwz" ["Ϊ" "λ" ""])
+("ynxd" ["" "ӡ"])
+("ynxi" ["Ϯ"])
+("ynxm" ["" ""])
+("ynxn" ["" "ӡ"])
+("ynxp" ["ѭ" "Ѷ"])
+("ynxu" [""])
+("ynxy" ["" "" "" "" "" "ӡ"])
+("ynyb" ["" ""])
+("ynyh" [""])
+("ynyj" [""])
+("ynyn" [""])
+("ynyp" ["" ""])
+("ynyr" ["Ե" "Ե"])
+("ynys" [""])
+("ynyt" ["" "Լ"])
+("ynyu" ["" "" ""])
+("ynyy" ["Ӱ"])
+("ynzi" ["" "" "" "ӡ"])
+("yoq'" "Ӵ")
+("yot'" "Ӵ")
+("ypbu" ["ϲ"])
+("ypcg" ["Ʋ"])
+("ypch" ["̲"])
+("ypcl" ["Ʋ"])
+("ypdb" ["ٶ"])
+("ypdi" ["˵"])
+("ypdj" ["˵"])
+("ypdk" ["˵" "ε"])
+("ypds" ["˶"])
+("ypdy" ["ƶ"])
+("ype'" "")
+("ypfu" ["и"])
+("ypfz" ["˷"])
+("ypgv" ["ƹ"])
+("yphe" ["˺"])
+("yphj" ["̺"])
+("yphv" ["˻"])
+("ypib" ["˳"])
+("ypie" ["γ"])
+("ypif" ["ȳ"])
+("ypir" ["δ"])
+("ypjc" ["Ͻ"])
+("ypji" ["Ƽ"])
+("ypls" [""])
+("yplv" [""])
+("ypmu" ["ĸ" "ĸ"])
+("ypmy" ["ѻƬó"])
+("ypnd" [""])
+("ypnj" [""])
+("ypno" ["ŵ"])
+("ypq'" "")
+("ypqi" ["" ""])
+("ypqq" [""])
+("ypqt" ["ȸ"])
+("ypr'" "Ա۩")
+("yprj" ["Ⱦ"])
+("ypsr" [""])
+("ypss" [""])
+("ypsv" [""])
+("ypti" [""])
+("yptm" [""])
+("yptu" ["ͼ"])
+("ypui" ["" "ʯ"])
+("ypuj" ["ɼ" "ɽ"])
+("ypuu" [""])
+("ypv'" ["ѹ"])
+("ypvg" [""])
+("ypvr" ["ת"])
+("ypvv" ["ѻƬս"])
+("ypw'" "Աܿ")
+("ypwh" [""])
+("ypwu" [""])
+("ypxc" [""])
+("ypxu" [""])
+("ypxw" ["ϼ"])
+("ypxy" [""])
+("ypyj" [""])
+("ypyp" [""])
+("ypys" [""])
+("ypyu" ["" ""])
+("ypyy" ["Ӫ"])
+("ypzl" [""])
+("yq'" [""])
+("yqbf" ["һȥ"])
+("yqbt" ["һϲͨ"])
+("yqby" ["Ӧ"])
+("yqd'" ["ȱ"])
+("yqei" ["һ"])
+("yqff" ["緢"])
+("yqms" ["Ȩı˽"])
+("yqp'" ["ƿ"])
+("yqr'" ["Ǯ" ""])
+("yqs'" [""])
+("yqtx" ["ͽ"])
+("yqwl" [""])
+("yqz'" ["һ"])
+("yr'" [""])
+("yran" ["ԩ" "ԭ"])
+("yrbf" ["Ԫ" "ԭ"])
+("yrbj" ["ԭ"])
+("yrbk" ["Ԫ"])
+("yrbo" ["Ԩ"])
+("yrd'" ["ȴ"])
+("yrda" ["Զ"])
+("yrdi" ["ԭ" "԰"])
+("yrdj" ["Ԫ"])
+("yrdk" ["Զ"])
+("yrdm" ["ԭ" "Բ"])
+("yrds" ["Զ"])
+("yrdy" ["ԭ" "԰"])
+("yre'" "Զ")
+("yrej" ["ӭж"])
+("yrey" ["˶"])
+("yrff" ["Թ"])
+("yrfh" ["Զ" "Զ"])
+("yrfz" ["Զ"])
+("yrge" ["Զ"])
+("yrgh" ["Բ"])
+("yrgk" ["ԭ" "ԭ"])
+("yrgl" ["ԭ"])
+("yrgs" ["Ա"])
+("yrgu" ["ԭ" "Ե" "Զ"])
+("yrgv" ["Բ"])
+("yrhb" ["Գ"])
+("yrhf" ["Թ"])
+("yrhh" ["Զ"])
+("yrhp" ["ԩ"])
+("yrhu" ["Բ"])
+("yrhw" ["Բ"])
+("yrib" ["ԩ"])
+("yrig" ["Զ"])
+("yrik" ["Ԫ"])
+("yris" ["ԭ"])
+("yriu" ["Ԫ" "Զ"])
+("yrjc" ["Զ"])
+("yrji" ["ԭ" "ԭ"])
+("yrjm" ["Ԫ" "Զ"])
+("yrjn" ["Զ"])
+("yrjp" ["Ԯ"])
+("yrjq" ["Ԯ"])
+("yrjw" ["һ" "ԩ" "Ԫ" "ԭ"])
+("yrjy" ["Բ" "Զ"])
+("yrjz" ["վ"])
+("yrkd" ["ԭ"])
+("yrlc" ["ԭ"])
+("yrld" ["ԭ" "ԭ"])
+("yrli" ["ԭ"])
+("yrlk" ["Ԫ"])
+("yrll" ["ԭ"])
+("yrln" ["԰"])
+("yrlo" ["Ժ"])
+("yrlq" ["Դ"])
+("yrmf" ["ԯ"])
+("yrmj" ["Բ"])
+("yrmm" ["ԭ"])
+("yrmu" ["ԭľ"])
+("yrmz" ["ԭú"])
+("yrnm" ["Ԫ"])
+("yrnz" ["Ժ"])
+("yrpj" ["Բ"])
+("yrq'" "ԧԨԩ")
+("yrqi" ["Ԫ" "Թ"])
+("yrqn" ["԰"])
+("yrqq" ["Բ"])
+("yrqr" ["ԲȦ" "ԴȪ"])
+("yrqu" ["ԩ" "Ԫ"])
+("yrr'" "ԷԸԹԺ")
+("yrrp" ["Բ"])
+("yrru" ["ʤ"])
+("yrse" ["ԭɫ"])
+("yrsu" ["Ԫ"])
+("yrtb" ["Դͷ"])
+("yrti" ["ԭ"])
+("yrtl" ["Բ̨"])
+("yrtm" ["԰"])
+("yrts" ["ԲͲ"])
+("yrub" ["Ԫ"])
+("yruf" ["Ԩ" "ԭ"])
+("yrug" ["ԭ"])
+("yrui" ["Ԫʷ" "ԭʫ" "ԭʼ" "ԭ" "Ժʿ"])
+("yruj" ["Ԫɽ"])
+("yruk" ["Ԭ"])
+("yruy" ["Ԫ˧"])
+("yrvb" ["Բ"])
+("yrvd" ["ԭ״"])
+("yrvg" ["Զ"])
+("yrvh" ["Ժ"])
+("yrvm" ["עĿ"])
+("yrvo" ["Բ"])
+("yrvs" ["ԭ"])
+("yrvu" ["ԭ" "ԭ" "Ԯ" "Բ" "Բ"])
+("yrvv" ["Բ׶"])
+("yrw'" ["Ԫ" "ԫ" "Ԭ" "ԭ" "Ԯ" "ԯ" "԰" "Ա" "Բ" "Գ" "Դ" "Ե" "ܫ" "ܾ" "" "" "" "" "" "" "" "ȼ"])
+("yrwf" ["ԭ"])
+("yrwh" ["ԩ" "Զ" "Ը"])
+("yrwl" ["Ժ"])
+("yrwu" ["ԭ" "Ϊ"])
+("yrwz" ["ԸΪ"])
+("yrxc" ["Զ" "ԺУ"])
+("yrxm" ["ԭ"])
+("yrxn" ["Բ"])
+("yrxy" ["ԭ" "ԭ" "ԭ" "Բ"])
+("yryb" ["ԭ" "ԭ" "ԭ" "Ե"])
+("yrye" ["ԭҰ"])
+("yryh" ["ԧ" "Զ"])
+("yryi" ["ԭ" "԰" "Ը"])
+("yryj" ["ԭ" "Թ"])
+("yryn" ["Ԫ" "ԭ" "ԭ" "Ԯ"])
+("yryr" ["ԨԴ" "ԴԴ" "ԶԶ"])
+("yrys" ["Ԯ"])
+("yryt" ["Ԫ"])
+("yryu" ["ԩ"])
+("yrze" ["ԭ"])
+("yrzi" ["Ԫ" "ԭ" "԰" "Ժ"])
+("yrzl" ["Զ"])
+("yrzo" ["ԭ"])
+("ys'" ["˼"])
+("ysan" [""])
+("ysb'" ["ѹ"])
+("ysbg" ["һ˿"])
+("ysbk" ["ӵ"])
+("ysbu" [""])
+("ysbx" [""])
+("ysby" ["Ұ" "ӵ" "ñ"])
+("ysci" [""])
+("ysdk" ["õ"])
+("ysdl" ["ӵ"])
+("ysdo" ["ö"])
+("ysdy" [""])
+("yse'" "ӻӼӽӾӿٸ")
+("ysf'" ["Լɪ"])
+("ysfa" ["÷"])
+("ysfh" ["Ԫط"])
+("ysfl" ["˿"])
+("ysfz" ["÷"])
+("ysgd" ["ù"])
+("ysgj" ["¸"])
+("ysgo" ["ù"])
+("ysgs" ["Ӷ" "ù"])
+("ysh'" ["ӹ׻"])
+("yshe" [""])
+("yshg" [""])
+("yshu" ["ӵ" "û"])
+("ysi'" ["ò"])
+("ysih" ["" "ó"])
+("ysiu" ["ô"])
+("ysj'" ["ѹ"])
+("ysji" ["ӵ" "ü"])
+("ysjl" ["ӹ׽"])
+("ysjn" ["ӿ" "þ" "þ"])
+("ysjq" ["" "þ"])
+("ysju" ["þ" "ɫ"])
+("ysjw" [""])
+("yskq" ["ѹ"])
+("ysl'" ["ɫ"])
+("yslb" ["˹"])
+("yslc" [""])
+("ysld" [""])
+("ysle" [""])
+("ysli" [""])
+("yslj" ["˹"])
+("ysll" [""])
+("yslu" ["ӹµ"])
+("ysmg" [""])
+("ysmy" [""])
+("ysnm" [""])
+("ysny" [""])
+("yspn" ["Ʒ"])
+("yspy" ["Ұ" "ƽ"])
+("ysq'" ["ӵ" "Ӷ" "ӷ" "Ӹ" "ӹ" "Ӻ" "" "ܭ" "" "" "" "" "" "" ""])
+("ysqi" [""])
+("ysqm" ["Ǯ"])
+("ysqy" [""])
+("ysr'" "Ӷ")
+("ysrf" ["Ӷ" "ӹ" ""])
+("ysru" ["ӿ"])
+("ysrv" ["ɫ"])
+("yssu" ["ӹ"])
+("ystj" ["ӽ̾"])
+("ystu" [";"])
+("ysug" ["" "ʤ"])
+("ysui" ["" "ʿ" ""])
+("ysvd" ["ת"])
+("ysvg" ["Ӻ"])
+("ysvs" ["ӷ"])
+("ysw'" "")
+("yswu" [""])
+("ysxm" ["ӿ"])
+("ysxn" ["" ""])
+("ysxy" [""])
+("ysyb" ["ӵ"])
+("ysyd" ["˶"])
+("ysyi" ["" ""])
+("ysyp" [""])
+("ysyr" ["Զ"])
+("ysyt" ["ӻԾ"])
+("ysyu" ["" "" ""])
+("yszl" [""])
+("yszv" [""])
+("yt'" [";"])
+("ytbk" ["±"])
+("ytbu" ["Խ"])
+("ytbw" [""])
+("ytby" ["ı"])
+("ytda" ["Խ"])
+("ytdi" ["µ"])
+("ytdj" ["Լ"])
+("ytdo" ["Խ"])
+("ytdr" ["ֶ"])
+("ytds" ["Խ"])
+("ytdu" ["Ķ"])
+("ytdv" ["ֶ"])
+("ytdw" ["һ쵽"])
+("ytdy" ["Լ"])
+("yter" ["ö"])
+("ytfa" ["Լ" "Խ"])
+("ytff" ["Լ" "·" "·"])
+("ytfu" ["ָ" ""])
+("ytfz" [""])
+("ytgd" ["¹"])
+("ytgk" ["Խ"])
+("ytgo" ["Խ"])
+("ytgs" ["¹"])
+("ytgv" ["Խ"])
+("yth'" ["һ廯" "԰ﻯ" "ֻ"])
+("ythj" ["Լ"])
+("ythk" ["Խ"])
+("ythn" ["ҡͷ"])
+("ythv" ["Լ"])
+("ytiu" ["³" "³"])
+("ytji" ["Լ"])
+("ytjn" ["Ծ"])
+("ytju" ["־" "Խ" ""])
+("ytjx" ["Խ"])
+("ytjy" ["¾"])
+("ytke" ["Լ"])
+("ytkj" ["¿"])
+("ytkq" ["Һ̬"])
+("ytky" ["Խ"])
+("ytl'" ["һ"])
+("ytld" [""])
+("ytli" ["" ""])
+("ytlj" [""])
+("ytll" ["Խ"])
+("ytlt" ["Լ"])
+("ytly" [""])
+("ytmj" ["Խ"])
+("ytmo" ["Լ" "ԼĪ" "ĩ"])
+("ytmu" ["ĸ" "Ŀ"])
+("ytnj" ["Խ"])
+("ytpc" ["Ʊ"])
+("ytpu" [""])
+("ytq'" "ԻԼ")
+("ytqi" ["" "Ծ"])
+("ytqm" ["ԾǨ"])
+("ytqn" [""])
+("ytqq" [""])
+("ytqr" ["ԽȨ"])
+("ytqu" [""])
+("ytr'" ["" "˵" "Խ" "Ծ" "Կ" "" "" "" "" "" "" "" "" "" "" "" "̫"])
+("ytrl" ["Һȼ"])
+("ytse" ["ɫ"])
+("ytt'" ["̫̫"])
+("yttj" ["ӭͷʹ" "̳"])
+("yttl" ["̨"])
+("yttr" [""])
+("ytts" ["Լͬ"])
+("ytui" ["Խ" "ʳ" "ʴ"])
+("ytuk" ["Խ"])
+("ytuu" ["Լ" "Լ"])
+("ytvb" [""])
+("ytvh" [""])
+("ytvj" ["Լռ"])
+("ytvs" ["" ""])
+("ytw'" ["Ӣ" ""])
+("ytwz" ["ԼΪ" "Խλ"])
+("ytxn" ["н"])
+("ytya" [""])
+("ytyb" ["Լ" "Խ"])
+("ytye" ["ԽҰ" "ҹ"])
+("ytyk" ["ԽҪ"])
+("ytyl" [""])
+("ytyn" [""])
+("ytyu" ["Խ"])
+("yu'" [""])
+("yuba" [""])
+("yubf" ["ޱ"])
+("yubi" [""])
+("yubk" ["Ԥ"])
+("yubu" ["ಽ"])
+("yubx" ["һ"])
+("yubz" ["Ԥ"])
+("yuce" ["Ԥ"])
+("yuci" ["ڴ" ""])
+("yud'" ["ʶ"])
+("yudc" ["" ""])
+("yude" [""])
+("yudf" ["ʷ"])
+("yudh" ["൳"])
+("yudi" ["޵" ""])
+("yudk" ["" ""])
+("yudm" [""])
+("yudu" ["඾" ""])
+("yudw" ["ԭ"])
+("yudy" ["Ԥ" "Ԥ"])
+("yudz" ["ֶ"])
+("yue'" "ٶ")
+("yuee" [""])
+("yufa" ["﷨"])
+("yuff" ["" "Ԥ"])
+("yufh" ["Ԥ"])
+("yufj" ["ʽֽ"])
+("yufu" ["" "Ԥ"])
+("yufz" ["ڷ" ""])
+("yugb" ["Ԥ"])
+("yuge" ["" ""])
+("yugh" ["" "ԡ"])
+("yugj" ["Ԥ"])
+("yugk" ["Ԥ"])
+("yugo" [""])
+("yugs" ["빲"])
+("yugu" ["ԭʼ"])
+("yuh'" ["Ǻ"])
+("yuhb" [""])
+("yuhd" [""])
+("yuhe" [""])
+("yuhh" [""])
+("yuhj" [""])
+("yuhk" [""])
+("yuhl" [""])
+("yuhr" [""])
+("yuhv" ["ػ" "" ""])
+("yuhw" ["㻨" ""])
+("yuhx" ["ֺ"])
+("yuia" [""])
+("yuib" ["ɱ"])
+("yuih" ["泡" "ԡ"])
+("yuii" ["" "" "ԡ"])
+("yuip" ["޴"])
+("yuir" ["洬"])
+("yuiu" [""])
+("yuj'" ["" "ӡˢ" ""])
+("yujc" [""])
+("yuji" ["꼾" "Ԥ" ""])
+("yujl" ["ԭʼ" "ԭʼ¼"])
+("yujm" ["" "Ԥ"])
+("yujn" ["ڽ"])
+("yuju" ["" "" "ԥ"])
+("yujw" ["" ""])
+("yuk'" ["Ԭ"])
+("yuky" [""])
+("yul'" [""])
+("yulc" ["Ԥ"])
+("yuld" ["" "" ""])
+("yule" [""])
+("yulf" ["ʳƷ"])
+("yuli" ["" "" ""])
+("yulj" [""])
+("yulk" [""])
+("yull" ["" ""])
+("yuln" ["" "" ""])
+("yulp" ["" ""])
+("yulr" [""])
+("yulu" ["¶" "¼"])
+("yulv" [""])
+("yulx" [""])
+("yuly" [""])
+("yulz" ["" ""])
+("yum'" [""])
+("yumb" ["Ԥı"])
+("yumc" ["" ""])
+("yumf" ["" ""])
+("yumi" [""])
+("yumk" ["ë"])
+("yumn" ["" ""])
+("yumz" [""])
+("yuni" ["" ""])
+("yunj" [""])
+("yunl" [""])
+("yunm" ["" ""])
+("yuns" ["Ū"])
+("yunv" ["Ů" "Ů"])
+("yup'" ["Ʒ"])
+("yupm" ["Ƭ"])
+("yupv" ["ԭʼƾ֤"])
+("yuq'" "")
+("yuqi" ["" "" "" "" "" "" "Ԥ"])
+("yuqp" ["Ⱥ"])
+("yuqt" ["ȱ"])
+("yuqu" [""])
+("yuqx" [""])
+("yuqy" [""])
+("yur'" "εξԡԢԣԤԥԦع")
+("yurb" [""])
+("yure" ["Ԥ"])
+("yurf" [""])
+("yurs" [""])
+("yuse" [""])
+("yusi" ["˼"])
+("yusj" ["ɡ"])
+("yusl" ["Ԥ"])
+("yuso" ["Ԣ"])
+("yusr" ["Ԥ"])
+("yut'" ["ӡˢ"])
+("yutb" ["ͷ"])
+("yuth" [""])
+("yutm" ["" ""])
+("yutr" ["һͬ"])
+("yuu'" [""])
+("yuuf" ["Ԥ"])
+("yuug" [""])
+("yuuh" ["" "ԭʼ"])
+("yuui" ["" "ʯ" "" "ԡ" "Ԥʾ"])
+("yuuu" ["" "" ""])
+("yuuv" ["ˮ" "ˮ"])
+("yuv'" ["ԭ"])
+("yuvb" ["" "ԥ"])
+("yuvf" [""])
+("yuvi" ["Ԥ֪" "Ԥ" "ּ"])
+("yuvk" ["Ԥ"])
+("yuvs" ["" "" ""])
+("yuvu" ["Ԥף"])
+("yuvx" ["¡ʳס" "ʳס"])
+("yuw'" ["" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "خ" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" "" ""])
+("yuwf" [""])
+("yuwh" ["" "" ""])
+("yuwi" ["һ޳"])
+("yuwk" ["޿"])
+("yuwl" [""])
+("yuwz" ["β" "Ϊ"])
+("yux'" ["" "ѧ" ""])
+("yuxd" ["Ԥ"])
+("yuxi" ["ϵ" "Ϫ"])
+("yuxm" ["" "" "Ԥ"])
+("yuxp" ["Ѵ"])
+("yuxt" ["ʶ̬" "ѩ" "ԡѪ" "ϵͳ"])
+("yuxw" [""])
+("yuxx" ["Ѫ" "Ѫ"])
+("yuy'" ["ʳҵ" "ԭ"])
+("yuyb" ["ҡһ" ""])
+("yuye" ["ҵ"])
+("yuyh" [""])
+("yuyi" ["" "" "" "Ԣ"])
+("yuyj" ["" "Ԣ" "Ԥ"])
+("yuyk" ["һʱһ" "Ҧ"])
+("yuyn" ["" ""])
+("yuys" ["ɫ" ""])
+("yuyt" ["Խ" "ԤԼ"])
+("yuyu" ["" "" "" "Ԣ"])
+("yuz'" ["Ԫ"])
+("yuzd" ["Թص"])
+("yuzi" [""])
+("yuzz" [""])
+("yv'" ["һ"])
+("yvam" ["ӵ"])
+("yvb'" ["Ӳֽ"])
+("yvbm" [""])
+("yvbt" ["ڲͬ"])
+("yvfi" ["ɴ"])
+("yvg'" ["ʸ" ""])
+("yvhj" ["ӲʺϽ"])
+("yvi'" [""])
+("yvj'" ["Ƽ" "Բܽ"])
+("yvkj" ["ռ"])
+("yvl'" ["Բ"])
+("yvm'" ["Բ"])
+("yvq'" ["־"])
+("yvqx" ["Բ׶"])
+("yvt'" ["Բ"])
+("yvtp" ["ӲͷƤ"])
+("yvu'" ["֪"])
+("yvug" ["¹"])
+("yvws" ["ά"])
+("yvx'" ["" "չ" ""])
+("yvy'" ["һգ" "" ""])
+("yvyd" ["Բ˶"])
+("yvyl" ["֮"])
+("yvyr" ["гһ"])
+("yvz'" [""])
+("yvzy" [""])
+("yw'" ["Ϊ"])
+("ywd'" ["µ"])
+("ywdj" ["һ"])
+("ywhj" ["Ļ"])
+("ywld" ["Ͷ"])
+("ywlx" ["ҵϵ"])
+("ywp'" [""])
+("ywsv" ["һ֪"])
+("ywt'" ["̩"])
+("ywu'" ["ҽ"])
+("ywv'" ["־" "ζ"])
+("ywvq" ["ֱǰ"])
+("ywvy" ["Ϊ"])
+("yww'" [""])
+("ywx'" ["ҩѧ"])
+("ywyd" ["˶"])
+("ywyu" ["һһʮ"])
+("yx'" ["һЩ"])
+("yxbb" ["ҰĲ"])
+("yxc'" ["һС"])
+("yxdl" ["Ҷ"])
+("yxf'" ["ѡ"])
+("yxfv" ["ȷչ" "ԡѪս"])
+("yxg'" ["ȹ"])
+("yxgb" ["߹㲥"])
+("yxgl" ["Ч"])
+("yxgs" ["޹˾"])
+("yxh'" ["һϯ" "ֻ"])
+("yxii" [""])
+("yxj'" ["Ұļ" "ԲĽ"])
+("yxl'" ["ѹ" "һϵ" "Ч"])
+("yxmj" ["Ч"])
+("yxp'" ["ӡ"])
+("yxq'" ["" "Ч" "ԭȦ"])
+("yxqy" ["һԸ"])
+("yxr'" [""])
+("yxs'" [""])
+("yxtk" ["쿪"])
+("yxu'" ["ɽ"])
+("yxuj" ["ѭؾ"])
+("yxuv" ["ֳ"])
+("yxuz" ["Ч"])
+("yxv'" ["Чֵ"])
+("yxx'" ["Ч"])
+("yxy'" ["ϸ" "ҽѧԺ"])
+("yxyv" ["һ"])
+("yxyy" ["һһ"])
+("yxz'" ["һ"])
+("yy'" [""])
+("yyan" ["Ӧ"])
+("yyba" ["Ӧ"])
+("yybb" ["ԭԭ"])
+("yybh" ["Ӣ"])
+("yybi" ["Ӳ"])
+("yybj" ["ԥ"])
+("yybm" ["Ӧ"])
+("yybn" ["ӭ"])
+("yycl" ["Ӣ"])
+("yycp" ["Ӣ"])
+("yyd'" ["Զ" "ԲԲ" "ԶԶ"])
+("yydc" ["Ӱ"])
+("yyde" ["Ӣ" "Ӧ" "Ӯ"])
+("yydh" ["Ӧ"])
+("yydi" ["Ӫ"])
+("yydu" ["Ӳ"])
+("yydv" ["Ӧ"])
+("yydy" [""])
+("yye'" ["Ӱ" "ӱ" "۫" "" "" "Ӫҵ"])
+("yyer" ["Ӥ"])
+("yyfb" ["Ӧ"])
+("yyfg" ["ӭ"])
+("yyfh" ["Ӫ"])
+("yyfu" ["Ӧ"])
+("yyfv" ["Ӫֳ"])
+("yyg'" ["ù"])
+("yygd" ["ӫ"])
+("yygl" ["Ӧ"])
+("yygo" ["Ӣ"])
+("yygx" ["һ"])
+("yyh'" ["һԪ"])
+("yyhe" ["Ӧ" "ӭ" "ӭ"])
+("yyhj" ["Ӣ"])
+("yyhl" ["Ӥ"])
+("yyho" ["ө"])
+("yyhw" ["ӣ" "Ӳ"])
+("yyhy" [""])
+("yyi'" ["" "Ӿ"])
+("yyib" ["Ӧ"])
+("yyig" ["Ӧ"])
+("yyii" ["Ӣ"])
+("yyip" ["ӭ"])
+("yyir" ["򣴨"])
+("yyj'" ["ѹӻ" "Һѹ" "¾"])
+("yyjc" ["ӭ"])
+("yyjd" ["Ӧ"])
+("yyji" ["Ӧ" "ӭ" "Ӱ"])
+("yyjm" ["Ӫ" "Ӳ"])
+("yyjp" ["Ӣ"])
+("yyjq" ["Ӫ"])
+("yyjr" ["ҹԼ"])
+("yyju" ["Ӧü"])
+("yyjx" ["ӭ"])
+("yyjy" ["Ӧо"])
+("yykb" ["Ӫ"])
+("yyke" ["Ӳ"])
+("yykk" ["Ӧ"])
+("yykv" ["ӯ"])
+("yykx" ["Ӧÿѧ"])
+("yyl'" ["һԪ" "ԤӦ"])
+("yyld" ["Ӣ"])
+("yyli" ["Ӣ" "Ӧ" "Ӫ" "Ӯ" "ӯ" "ԴԶ"])
+("yyll" ["ӭ"])
+("yylz" ["Ӫ"])
+("yymm" ["ӭ" "Ӳ"])
+("yymu" ["ӢĶ" "Ӳľ" "ӳĻ"])
+("yymy" ["Ӣ" "Ӣ"])
+("yypj" ["Ӳ"])
+("yypm" ["ӰƬ"])
+("yypn" ["ӦƸ"])
+("yypy" ["Ӱ"])
+("yyq'" "ӢӣӤӥӦӧݺ")
+("yyqg" ["Ӫ"])
+("yyqi" ["ҧг"])
+("yyqr" ["ӥȮ"])
+("yyr'" "ӦӲӳ")
+("yyri" ["Ӣ"])
+("yys'" ["˼"])
+("yysi" ["Ӫ˽"])
+("yyss" ["ӭ"])
+("yyt'" ["һ" "һ" "ԭҶ"])
+("yytb" ["ӭͷ"])
+("yytk" ["ӣ"])
+("yyu'" ["ʶ"])
+("yyub" ["Ӧ"])
+("yyue" ["Ӱ" "ӳ"])
+("yyug" ["Ӧ" "Ӫ"])
+("yyui" ["Ӣʯ" "Ӧʱ" "Ӧ" "өʯ" "Ӳ"])
+("yyuo" ["Ӳ˵"])
+("yyuu" ["Ӣ"])
+("yyuv" ["Ӫ" "Ӳˮ"])
+("yyv'" ["֮"])
+("yyvb" [""])
+("yyvg" ["Ӧ"])
+("yyvh" ["Ӫ"])
+("yyvi" ["Ӣ" "Ӧ" "Ӳ֬"])
+("yyvj" ["Ӧս" "ӭս"])
+("yyvk" ["Ӫ״" "ӳ"])
+("yyw'" "ӨөӪӫӬӭӮӯ")
+("yywf" ["Ӣ"])
+("yywj" ["Ϊ"])
+("yywu" ["Ӣ"])
+("yywz" ["ӦΪ"])
+("yyx'" ["Ӧ" "ҽҩѧ" "Խ" "ѧ"])
+("yyxd" ["Ӱ" "Ӱ" "Ӱ" "ӳ"])
+("yyxi" ["ӰϷ"])
+("yyxj" ["ѧ"])
+("yyxn" ["ӭ"])
+("yyxs" ["Ӣ"])
+("yyxy" ["Ӳ"])
+("yyy'" ["Һѹ" "Ӫ" "" "ӪҵԱ"])
+("yyyb" ["Ӧ" "Ӧ"])
+("yyye" ["Ӫҵ"])
+("yyyh" ["Ӫ"])
+("yyyi" ["Ӧ"])
+("yyyj" ["Ӧ"])
+("yyyk" ["Ӧ"])
+("yyyn" ["Ӱӡ"])
+("yyyp" ["Ӧ" "Ӧ"])
+("yyyr" ["ӰԺ"])
+("yyys" ["Ӧ" "ӪԪ"])
+("yyyu" ["Ӣ" "ӯ" "Զ"])
+("yyyv" ["ҡҡ׹"])
+("yyyx" ["һϢ"])
+("yyyy" ["ԼԼ" "ӯӯ"])
+("yyzi" ["Ӣ" "Ӱ"])
+("yyzk" ["Ӫ"])
+("yyzr" [""])
+("yz'" ["ԭ"])
+("yzd'" ["ԭӵ"])
+("yzgp" ["ԭӹ"])
+("yzh'" ["ԭӺ"])
+("yzhj" ["ػ"])
+("yzj'" ["ԭӼ"])
+("yzjg" ["ԭӽṹ"])
+("yzl'" ["Ҷ" "ԭ"])
+("yzn'" ["ԭ"])
+("yznd" ["ԭܷ"])
+("yzu'" ["ԭ˵"])
+("yzx'" ["ԭ"])
+("yzxu" ["ԭ"])
+("yzy'" ["Ҷ"])
+("z" "")
+("zack" ["Ӳ"])
+("zae'" "զ")
+("zafz" ["ӷ" "ӷ"])
+("zagj" ["Ӹ"])
+("zaho" ["ӻ"])
+("zahv" ["һ"])
+("zajc" ["ӽ"])
+("zaji" ["Ӽ" "Ӽ"])
+("zaju" ["Ӿ" "Ӿ"])
+("zald" [""])
+("zalj" [""])
+("zalr" [""])
+("zapn" ["Ʒ"])
+("zaq'" "")
+("zase" ["ɫ"])
+("zasv" [""])
+("zaui" [""])
+("zauo" ["˵"])
+("zauu" [""])
+("zavi" ["־" ""])
+("zavs" [""])
+("zaw'" "")
+("zawf" [""])
+("zawu" [""])
+("zayn" [""])
+("zazv" [""])
+("zb'" ["ʱ"])
+("zbbm" ["߱"])
+("zbbu" ["߲"])
+("zbdk" ["ߵ" "ߵ"])
+("zbds" ["߶"])
+("zbdv" ["ʱת"])
+("zbe'" "")
+("zbfh" ["߷"])
+("zbg'" ["ܰչ"])
+("zbgb" ["߹"])
+("zbgo" ["߹"])
+("zbhb" ["ߺ"])
+("zbj'" ["ʱ"])
+("zbjl" ["ʱ"])
+("zbjv" ["ʱ"])
+("zbkl" ["߿"])
+("zbl'" ["ʱ" "Ա"])
+("zblh" [""])
+("zbll" [""])
+("zblu" ["·"])
+("zbma" [""])
+("zbq'" "۸")
+("zbqu" ["ȥ"])
+("zbr'" "")
+("zbrs" [""])
+("zbsi" ["˽"])
+("zbsj" ["ɢ"])
+("zbtx" ["زͨ"])
+("zbuh" [""])
+("zbui" ["ʱ" "ʧ" "ʱ"])
+("zbuu" [""])
+("zbvd" ["ʱƶ"])
+("zbve" [""])
+("zbvh" ["ʱ" ""])
+("zbvj" ["ʱ"])
+("zbvv" ["ʱת"])
+("zbvy" ["ʱ"])
+("zbx'" ["ٱ" "ϵ"])
+("zbxc" ["Ч"])
+("zbxd" [""])
+("zbxh" ["ʱѭ"])
+("zbyh" [""])
+("zbyi" [""])
+("zbyp" [""])
+("zbzu" [""])
+("zc'" ["Դ"])
+("zcmb" ["ܲı"])
+("zcmv" ["ܲı"])
+("zdb'" ["ӵܱ"])
+("zdc'" ["赲"])
+("zdej" [""])
+("zdh'" ["Զ"])
+("zdjc" ["Զ"])
+("zdjs" ["Զ"])
+("zdjy" ["Զʻ"])
+("zdkv" ["Զ"])
+("zdm'" ["ݶ"])
+("zdqw" [""])
+("zdul" ["ܵ˵"])
+("zdux" ["Զ"])
+("zdx'" ["Զ"])
+("zdxd" ["޶"])
+("zdy'" ["ܶԱ"])
+("zdzv" ["Զ"])
+("zebu" [""])
+("zebz" [""])
+("zefa" [""])
+("zegy" [""])
+("zehl" [""])
+("zeig" [""])
+("zejd" [""])
+("zeke" [""])
+("zely" [""])
+("zema" [""])
+("zemz" ["û"])
+("zeng" [""])
+("zenj" [""])
+("zer'" "")
+("zerf" [""])
+("zeui" [""])
+("zevo" ["׽"])
+("zew'" "զ")
+("zewf" [""])
+("zexj" ["о"])
+("zeyb" [""])
+("zeyk" ["Ҫ"])
+("zeyv" ["֮ܶ"])
+("zeze" [""])
+("zf'" [""])
+("zfe'" "")
+("zfhv" [""])
+("zflh" ["ܷʻ"])
+("zfls" ["ܷ"])
+("zfme" ["ô"])
+("zfng" [""])
+("zfr'" "")
+("zfug" [""])
+("zfv'" ["ܷ"])
+("zfvd" ["ڷƶ"])
+("zfyh" [""])
+("zfyk" ["Ըӯ"])
+("zg'" ["ܹ"])
+("zgbo" [""])
+("zgbu" [""])
+("zgby" [""])
+("zgda" [""])
+("zgdo" [""])
+("zgdy" [""])
+("zge'" ["Ը"])
+("zgf'" ["" "߷"])
+("zgfy" ["Ը"])
+("zggd" [""])
+("zggk" [""])
+("zggz" [""])
+("zgh'" ["ܹ"])
+("zghf" [""])
+("zgij" [""])
+("zgj'" ["߼"])
+("zgjm" [""])
+("zgjn" [""])
+("zgjw" [""])
+("zgld" [""])
+("zgn'" ["Ըũ"])
+("zgpn" ["Ʒ"])
+("zgq'" "")
+("zgqd" ["ǿ"])
+("zgqw" [""])
+("zgr'" "")
+("zgsp" [""])
+("zgss" [""])
+("zgtm" [""])
+("zgue" [""])
+("zgug" [""])
+("zguj" ["ɾ"])
+("zgvh" [""])
+("zgvi" ["ֳ" "ֵ"])
+("zgvu" ["ָʾ"])
+("zgwu" [""])
+("zgxr" ["ѡ"])
+("zgya" ["ѹ"])
+("zgyi" [""])
+("zgyl" ["Թ"])
+("zgyr" ["Ԯ"])
+("zgyu" [""])
+("zgzd" ["ԸԴ"])
+("zgzu" [""])
+("zgzz" ["Ը"])
+("zh'" ["ۺ"])
+("zhe'" "")
+("zhfv" ["ۺϷ"])
+("zhjc" ["ݺύ" "ݺӴ"])
+("zhkr" ["߿"])
+("zhli" ["" ""])
+("zhly" ["ۺ"])
+("zhm'" ["ߺ"])
+("zhph" ["ۺƽ"])
+("zhq'" "")
+("zhqb" ["ܺڲ"])
+("zhqi" [""])
+("zhr'" "")
+("zhss" [""])
+("zhvl" ["ۺ"])
+("zhwf" [""])
+("zhwu" [""])
+("zhyi" ["ҽ"])
+("zhzu" [""])
+("zi'" [""])
+("ziai" ["԰"])
+("zibf" ["ʱ" "ɲ"])
+("zibl" ["԰"])
+("zici" ["ִ"])
+("zicl" ["ϲ"])
+("zics" ["Դ"])
+("zida" ["Դ"])
+("zide" ["Ե"])
+("zidi" ["ӵ"])
+("zidj" ["ӵ"])
+("zidl" ["Ӵ"])
+("zidm" ["ֵ"])
+("zids" ["Զ"])
+("zie'" "")
+("zier" ["Ӷ" "ֶ"])
+("zifa" ["Է"])
+("zifb" ["ʲծ"])
+("zifg" ["Է"])
+("zifh" ["ӷ"])
+("zifu" ["Ը" "ַ"])
+("zifz" ["Է"])
+("zigb" ["Թ"])
+("zige" ["ʸ"])
+("zigs" ["ӹ"])
+("zigu" ["Թ"])
+("zigz" ["Ը"])
+("zihk" ["Ժ" "ֺ"])
+("zihs" ["Ϻ"])
+("zihw" ["ֻ"])
+("zii'" ["촬"])
+("ziig" ["Գ"])
+("ziij" ["ʲ" "Ӳ"])
+("ziji" ["м" "Լ" "ּ"])
+("zijj" ["ʲ׼"])
+("zijn" ["ʽ" "Ͻ" "Ծ"])
+("zijq" ["Ծ"])
+("zijt" ["Ծ" "Ծ"])
+("ziju" ["Ծ" "־" "־" "־"])
+("zijv" ["ʲ׼"])
+("zijw" ["Լ"])
+("zijx" ["ֽ"])
+("zijy" ["Լ" "Ծ"])
+("zikb" ["ӿ"])
+("ziku" ["ֿ"])
+("zil'" ["ܲ"])
+("zilc" [""])
+("zili" ["" "" "" "" "" ""])
+("zill" ["" ""])
+("zilq" [""])
+("zimj" [""])
+("zimm" ["" "" ""])
+("zimo" ["ģ"])
+("zimu" ["ģ" "ĸ"])
+("zimy" [""])
+("zimz" [""])
+("zinh" [""])
+("zinv" ["Ů"])
+("zip'" ["ڲƷ"])
+("ziq'" "֨")
+("zir'" "")
+("zirj" ["Ȼ" "ȼ"])
+("zirk" [""])
+("ziro" [""])
+("zirp" [""])
+("ziru" [""])
+("zise" ["ɫ"])
+("zisi" ["˼" "˽"])
+("zisp" [""])
+("zisu" [""])
+("ziti" [""])
+("zitl" ["̬"])
+("zits" ["ͭ"])
+("zitx" [""])
+("ziua" ["ɱ"])
+("ziub" [""])
+("ziuf" [""])
+("ziug" [""])
+("ziui" ["" "" "ʱ" "ʵ" "" ""])
+("ziuu" ["" ""])
+("ziv'" ["ֵܲ"])
+("zivg" [""])
+("zivh" ["̳"])
+("zivi" ["" ""])
+("zivr" ["Դ" "ת"])
+("zivs" ["" ""])
+("zivu" ["" ""])
+("ziw'" ["ԳΪ"])
+("ziwf" ["" "" ""])
+("ziwo" [""])
+("ziwu" [""])
+("ziwz" ["ζ" "Ϊ" "ο" ""])
+("zixd" [""])
+("zixi" ["ϸ"])
+("zixn" ["" ""])
+("zixp" ["ѯ" "ѯ"])
+("zixq" [""])
+("zixr" ["ѡ"])
+("zixt" ["ѧ"])
+("zixu" ["" ""])
+("zixw" [""])
+("zixy" ["" "" ""])
+("ziyb" ["" ""])
+("ziye" ["Ҷ" "ҹ"])
+("ziyh" ["" "" ""])
+("ziyi" ["" "" ""])
+("ziyj" [""])
+("ziyn" [""])
+("ziyr" ["Դ" "Ը"])
+("ziys" [""])
+("zizi" [""])
+("zizk" [""])
+("zizl" [""])
+("zizp" [""])
+("zj'" ["ܼ"])
+("zjba" [""])
+("zjd'" [""])
+("zjdk" ["ܵ"])
+("zjdy" ["ݶ"])
+("zje'" "")
+("zjge" ["޸"])
+("zjgg" ["ڽ̸ĸ"])
+("zjhr" ["ݻ"])
+("zjig" ["޳"])
+("zjj'" ["ٽᾧ"])
+("zjjw" ["ۼ"])
+("zjjy" ["ܽᾭ"])
+("zjli" [""])
+("zjlw" [""])
+("zjly" ["ʽԴ"])
+("zjmf" [""])
+("zjmz" [""])
+("zjpb" ["ʽƽ"])
+("zjq'" "")
+("zjqb" ["ӽױ"])
+("zjqm" ["Ǯ"])
+("zjqt" ["ȱ"])
+("zjqx" [""])
+("zjr'" ["" "" "" "" "Լ"])
+("zjss" [""])
+("zjt'" ["" "Ӽ"])
+("zjtj" ["̾"])
+("zjts" ["ͬ"])
+("zjty" ["ͣ"])
+("zju'" ["Ͻɽ"])
+("zjuh" [""])
+("zjui" ["ʱ"])
+("zjv'" ["ӽ"])
+("zjvu" [""])
+("zjvy" ["ʽռ"])
+("zjw'" "")
+("zjx'" ["Խϵ" "ܽϰ"])
+("zjxu" [""])
+("zjxy" [""])
+("zjy'" ["ٽ"])
+("zjyh" [""])
+("zjys" [""])
+("zjyu" [""])
+("zjyv" ["ӽ"])
+("zjyy" ["ʽ"])
+("zjzi" [""])
+("zjzl" ["ٽ"])
+("zjzy" ["ԾԸ"])
+("zkan" ["簲"])
+("zkcj" [""])
+("zkck" [""])
+("zkdk" ["⵽" "絾"])
+("zkdm" [""])
+("zkds" ["궯"])
+("zke'" "")
+("zkfj" ["緹" "췴"])
+("zkfu" ["츣"])
+("zkgk" [""])
+("zkho" [""])
+("zkhs" [""])
+("zkhu" [""])
+("zkhw" ["컯" ""])
+("zkif" ["糿"])
+("zkig" [""])
+("zkij" [""])
+("zkip" ["紺"])
+("zkir" ["촬"])
+("zkji" ["缺"])
+("zkjq" ["" ""])
+("zkju" [""])
+("zkjw" [""])
+("zkjy" ["侮"])
+("zkks" [""])
+("zklc" [""])
+("zkln" [""])
+("zklz" [""])
+("zknm" [""])
+("zkpm" ["Ƭ"])
+("zkpo" [""])
+("zkpp" ["迹ƥ"])
+("zkq'" "")
+("zkqi" ["" ""])
+("zkqq" [""])
+("zkr'" "")
+("zkre" [""])
+("zkri" [""])
+("zkta" ["̣"])
+("zkth" [""])
+("zktl" ["̨"])
+("zktm" [""])
+("zkub" [""])
+("zkud" ["˪"])
+("zkug" [""])
+("zkuh" [""])
+("zkuu" ["" ""])
+("zkuy" ["˥"])
+("zkva" [""])
+("zkvd" ["ׯ"])
+("zkvi" ["ֽ"])
+("zkw'" "")
+("zkwj" [""])
+("zkwu" [""])
+("zkxi" ["ϴ"])
+("zkxm" [""])
+("zkxy" ["" ""])
+("zkyh" [""])
+("zkyi" ["" ""])
+("zkyj" [""])
+("zkyk" ["ҥ"])
+("zkyn" [""])
+("zkyt" ["Ի"])
+("zkyu" [""])
+("zkzi" [""])
+("zkzl" [""])
+("zkzo" [""])
+("zl'" [""])
+("zlan" ["ڰ"])
+("zlba" ["ٰ" ""])
+("zlbh" ["ڰ"])
+("zlbj" ["ٰ"])
+("zlbl" ["ٰ"])
+("zlbm" ["ڱ"])
+("zlbo" ["ز"])
+("zlbu" ["ٲ"])
+("zlci" ["ٴ" "ڴ"])
+("zld'" [""])
+("zldu" ["ٶ"])
+("zle'" "")
+("zlfg" [""])
+("zlge" ["׸"])
+("zlgg" [""])
+("zlgo" ["ٹ"])
+("zlgu" [""])
+("zlhd" ["ֻ"])
+("zlhe" ["غ"])
+("zlhh" [""])
+("zlhl" ["ֺ"])
+("zlho" ["ֻ" "ػ"])
+("zlhu" ["ں"])
+("zlhv" ["ٻ"])
+("zlhw" ["Ի"])
+("zlih" ["ڳ"])
+("zlik" ["ڳ"])
+("zlj'" [""])
+("zljc" ["ڽ"])
+("zljd" ["ٽ"])
+("zlji" ["ؼ" "ڼ"])
+("zljm" ["ټ"])
+("zljw" ["ڼ"])
+("zljy" ["ھ"])
+("zlke" ["ؿ"])
+("zll'" [""])
+("zlli" [""])
+("zlmn" [""])
+("zlnj" [""])
+("zlnz" [""])
+("zlpn" ["Ƶ"])
+("zlpz" [""])
+("zlq'" "")
+("zlqi" [""])
+("zlqu" [""])
+("zlqy" [""])
+("zlr'" "")
+("zlrf" ["" ""])
+("zlru" [""])
+("zlsj" [""])
+("zlti" [""])
+("zltk" [""])
+("zlu'" ["ˮ" ""])
+("zlua" ["ɱ"])
+("zluf" [""])
+("zlug" [""])
+("zlui" [""])
+("zluo" ["˵"])
+("zluu" [""])
+("zlve" ["" ""])
+("zlvi" ["ֲ" "ְ"])
+("zlvs" ["" ""])
+("zlwf" [""])
+("zlwh" [""])
+("zlwo" [""])
+("zlwv" [""])
+("zlwz" ["λ"])
+("zlx'" ["·"])
+("zlxd" [""])
+("zlxm" ["" ""])
+("zlxn" [""])
+("zlxp" ["Ѱ"])
+("zlxw" [""])
+("zlya" ["Ѻ"])
+("zlyb" ["" ""])
+("zlye" ["Ҳ" "Ұ"])
+("zlyg" ["һ"])
+("zlyi" [""])
+("zlyp" [""])
+("zlyu" [""])
+("zlz'" [""])
+("zlze" [""])
+("zlzi" [""])
+("zlzk" [""])
+("zlzl" [""])
+("zlzo" [""])
+("zm'" ["ô"])
+("zmm'" [""])
+("zmq'" [""])
+("zmuy" ["ü"])
+("zmv'" ["ô"])
+("zmy'" ["ô"])
+("znk'" ["ҿ"])
+("zoan" [""])
+("zobc" ["" ""])
+("zobj" [""])
+("zobk" [""])
+("zobm" [""])
+("zocj" [""])
+("zode" [""])
+("zodk" [""])
+("zodl" [""])
+("zodm" [""])
+("zodv" [""])
+("zody" [""])
+("zoe'" "")
+("zoee" [""])
+("zoer" ["" ""])
+("zofa" ["" ""])
+("zofg" [""])
+("zofh" [""])
+("zofj" [""])
+("zofz" [""])
+("zogr" [""])
+("zogs" ["" ""])
+("zogu" [""])
+("zogy" [""])
+("zohk" [""])
+("zoig" ["" ""])
+("zoiu" ["" ""])
+("zojn" [""])
+("zojw" ["" ""])
+("zoke" [""])
+("zolc" [""])
+("zole" [""])
+("zolk" [""])
+("zolo" ["" "" ""])
+("zolr" [""])
+("zomg" [""])
+("zomm" [""])
+("zonj" [""])
+("zopl" [""])
+("zopn" ["Ʒ"])
+("zopz" [""])
+("zoq'" "")
+("zoqi" [""])
+("zoqu" [""])
+("zoqy" [""])
+("zor'" "")
+("zorf" [""])
+("zori" [""])
+("zosi" ["˿"])
+("zotj" ["̸"])
+("zotm" [""])
+("zotu" ["ͼ"])
+("zoub" [""])
+("zouh" [""])
+("zoui" ["ʫ" "" ""])
+("zove" ["" ""])
+("zovf" [""])
+("zovg" ["֤" "֤"])
+("zovj" ["ս"])
+("zovp" ["׼"])
+("zovr" ["ת"])
+("zovu" ["" ""])
+("zow'" "")
+("zowf" [""])
+("zowj" ["" ""])
+("zowu" [""])
+("zowz" ["Ϊ" "α" "λ" "λ"])
+("zoxw" [""])
+("zoyb" [""])
+("zoye" ["ҹ" "ҵ"])
+("zoyi" ["" ""])
+("zoys" [""])
+("zozl" [""])
+("zozo" [""])
+("zpbz" [""])
+("zpcs" [""])
+("zpe'" "ߤ")
+("zpgv" [""])
+("zphw" [""])
+("zpig" [""])
+("zpis" [""])
+("zpjy" [""])
+("zpm'" [""])
+("zpmy" [""])
+("zpq'" "")
+("zpub" [""])
+("zpui" ["ʦ"])
+("zpvh" [""])
+("zpvk" [""])
+("zpvs" [""])
+("zpvy" [""])
+("zpxp" ["ѭ"])
+("zpxy" [""])
+("zpyi" [""])
+("zpyj" [""])
+("zqj'" [""])
+("zqqr" [""])
+("zqsl" ["ǿ"])
+("zr'" ["Ȼ"])
+("zrc'" ["Ȼ"])
+("zre'" "")
+("zrer" ["ȻȻ"])
+("zrfp" ["Ȼѧ"])
+("zrg'" ["θ" "Ȼ"])
+("zrgj" [""])
+("zrid" ["괲"])
+("zrj'" ["ȼ" "Ȼ"])
+("zrji" [""])
+("zrjj" ["Ȼ"])
+("zrjn" [""])
+("zrjy" ["꾮"])
+("zrk'" ["˿"])
+("zrkx" ["Ȼѧ"])
+("zrl'" ["Ȼ"])
+("zrm'" ["Ȼ"])
+("zrng" ["ڸ"])
+("zrq'" "")
+("zrr'" ["׬" "" "߬" "Ȼ"])
+("zrtb" ["ͷ"])
+("zrtf" ["Ȼͨ"])
+("zrtj" ["̽"])
+("zru'" ["Ȼ"])
+("zrug" ["¹"])
+("zrui" ["ʯ"])
+("zrv'" [""])
+("zrvy" ["Ȼ"])
+("zrx'" [""])
+("zrxq" [""])
+("zrxz" ["Ȼѡ"])
+("zryj" [""])
+("zryy" ["Ӫ"])
+("zrzh" ["Ȼֺ"])
+("zsbc" ["ܱ"])
+("zsbi" ["ܱ"])
+("zsbj" ["ܰ"])
+("zsbm" ["ܱ"])
+("zsbo" ["ݲ"])
+("zsbu" ["ܲ"])
+("zsby" ["ܱ"])
+("zscj" ["ܲ"])
+("zscl" ["ܲ"])
+("zsde" ["ܵ" "ܵ"])
+("zsdp" ["ܶ"])
+("zsdu" ["ܶ"])
+("zsdv" ["ݶ"])
+("zse'" "")
+("zsee" ["ܶ"])
+("zsfa" ["ڷ"])
+("zsgr" ["۹" "ܹ" "ݹ" "ݹ"])
+("zsgs" ["ܹ" "ܹ" "ܹ"])
+("zsgv" ["ܹ"])
+("zsh'" ["뻱"])
+("zshb" ["ܺ"])
+("zshe" ["ۺ" "ܺ" "ܺ"])
+("zshg" ["ݺ"])
+("zsho" ["ݻ"])
+("zshv" ["ܻ"])
+("zsig" ["ܳ"])
+("zsih" ["ܳ"])
+("zsj'" ["ܼ"])
+("zsjc" ["ڽ"])
+("zsji" ["ټ" "ܼ"])
+("zsjm" ["ܼ"])
+("zsju" ["ܾ"])
+("zsjx" ["ܽ"])
+("zsko" [""])
+("zsl'" ["˾"])
+("zsld" [""])
+("zsli" [""])
+("zslj" [""])
+("zslv" [""])
+("zsmc" [""])
+("zsmk" ["ë"])
+("zsmu" ["Ŀ"])
+("zsng" [""])
+("zspl" [""])
+("zspu" [""])
+("zsq'" "")
+("zsqy" [""])
+("zsr'" "")
+("zsrh" [""])
+("zsrj" ["Ȼ"])
+("zsrs" [""])
+("zsse" ["ɫ"])
+("zssr" [""])
+("zsti" [""])
+("zsts" ["ͳ"])
+("zstu" ["ͼ"])
+("zsuf" ["" ""])
+("zsuh" ["" ""])
+("zsui" ["" "" "ʹ"])
+("zsuu" ["" ""])
+("zsvg" [""])
+("zsvh" ["ܳ" ""])
+("zsvi" ["ּ" "֮" "ֵ"])
+("zsvu" [""])
+("zswu" [""])
+("zsxd" ["" ""])
+("zsxm" [""])
+("zsyk" ["Ҫ"])
+("zsyr" ["Ժ"])
+("zsyy" ["Ӱ"])
+("zsze" [""])
+("zszi" ["" ""])
+("zszl" ["˽"])
+("zszu" [""])
+("zt'" [""])
+("zth'" ["̸" "̸"])
+("ztv'" ["ͳ"])
+("ztwl" ["Ͷ·"])
+("zu'" [""])
+("zuai" ["谭"])
+("zuan" ["鰷"])
+("zubz" ["汲"])
+("zudh" ["赲"])
+("zudm" ["" ""])
+("zue'" "")
+("zuee" [""])
+("zuex" ["϶"])
+("zuff" [""])
+("zufu" ["游"])
+("zugb" ["㹻"])
+("zuge" ["" "" ""])
+("zugo" [""])
+("zuhe" [""])
+("zuhw" ["黭"])
+("zui'" [""])
+("zuie" ["⳵"])
+("zuig" [""])
+("zuir" ["⴬" "洫"])
+("zuj'" [""])
+("zuji" ["㼣" ""])
+("zujm" ["" ""])
+("zujn" [""])
+("zujx" ["" ""])
+("zukh" ["迹"])
+("zuli" [""])
+("zulj" [""])
+("zuln" [""])
+("zulz" [""])
+("zumi" [""])
+("zumu" ["ĸ"])
+("zuni" [""])
+("zunk" [""])
+("zuq'" "")
+("zuql" ["ʳ"])
+("zuqq" [""])
+("zuqr" ["Ȩ"])
+("zuqu" [""])
+("zurf" [""])
+("zuse" [""])
+("zusu" [""])
+("zusv" [""])
+("zuti" [""])
+("zuui" ["ʦ"])
+("zuuv" ["˰"])
+("zuvb" [""])
+("zuvd" ["ƶ" "װ"])
+("zuvh" ["鳤"])
+("zuvi" ["ֵ" "ֹ" "" "֯"])
+("zuvv" ["ʼ"])
+("zuw'" "")
+("zux'" ["ʳ"])
+("zuxm" [""])
+("zuxw" [""])
+("zuy'" ["Ե"])
+("zuye" ["ҵ"])
+("zuyi" [""])
+("zuys" [""])
+("zuyt" ["Լ"])
+("zuzi" ["" ""])
+("zuzs" [""])
+("zuzu" [""])
+("zv'" ["֮"])
+("zva'" ["֯"])
+("zvb'" ["֯"])
+("zvba" [""])
+("zvda" [""])
+("zvdi" [""])
+("zvdo" [""])
+("zve'" "")
+("zvee" [""])
+("zvfj" ["ﷸ"])
+("zvg'" [""])
+("zvgb" ["ְɲ"])
+("zvgk" [""])
+("zvgo" [""])
+("zvgv" [""])
+("zvh'" ["ָ"])
+("zvhb" [""])
+("zvhd" ["ֺ"])
+("zvhf" [""])
+("zvhk" [""])
+("zvhy" [""])
+("zvi'" ["ֽ"])
+("zvia" [""])
+("zvid" ["մ"])
+("zvii" [""])
+("zvip" ["촽"])
+("zviu" [""])
+("zvjc" [""])
+("zvjn" [""])
+("zvjq" [""])
+("zvjw" [""])
+("zvkv" [""])
+("zvky" [""])
+("zvl'" [""])
+("zvld" ["֯쵼"])
+("zvlm" [""])
+("zvlx" ["֯·"])
+("zvmj" [""])
+("zvmy" [""])
+("zvnj" [""])
+("zvp'" ["Ʒ"])
+("zvq'" ["" ""])
+("zvqi" [""])
+("zvr'" "ީ")
+("zvrf" [""])
+("zvsd" ["ٶ"])
+("zvu'" ["֯"])
+("zvuh" ["֯"])
+("zvuk" [""])
+("zvv'" [""])
+("zvvb" ["β"])
+("zvvd" ["״"])
+("zvvg" ["֤"])
+("zvvs" [""])
+("zvwj" [""])
+("zvwz" ["Ϊ"])
+("zvx'" ["" "֯" "֯ѧ"])
+("zvxc" ["С"])
+("zvxm" [""])
+("zvxn" ["" ""])
+("zvxu" ["֯ʽ"])
+("zvxy" [""])
+("zvy'" ["Ժ" "֯Һ"])
+("zvyb" ["" ""])
+("zvyr" ["Զ"])
+("zvyu" [""])
+("zvze" [""])
+("zvzk" [""])
+("zvzv" [""])
+("zw'" ["Ϊ"])
+("zwpd" ["Դ"])
+("zwpp" [""])
+("zwv'" ["" ""])
+("zwx'" ["" ""])
+("zwxu" [""])
+("zwy'" ["ү"])
+("zx'" [""])
+("zxbb" ["°汾"])
+("zxeu" ["¶"])
+("zxi'" ["г" "ĳ"])
+("zxj'" ["ͻ"])
+("zxmd" ["ì"])
+("zxqu" [""])
+("zxx'" ["" "ϵ"])
+("zxyu" [""])
+("zy'" [""])
+("zybh" ["Ҳ"])
+("zyd'" ["ɶ" "ӹ"])
+("zydz" ["ɵ"])
+("zyhy" [""])
+("zyj'" ["һ" "" "" "ɻ" ""])
+("zyjv" ["ɾ"])
+("zyl'" [""])
+("zylt" [""])
+("zym'" ["" "" ""])
+("zymy" ["Ҳû"])
+("zys'" ["Ԥ"])
+("zytc" [""])
+("zyu'" [""])
+("zyui" ["г"])
+("zyvy" [""])
+("zywg" [""])
+("zyxv" ["֤"])
+("zyy'" ["Ӣ" "Ӿ"])
+("zyzh" [""])
+("zyzy" [""])
+("zyzz" [""])
+("zzb'" [""])
+("zzbb" ["汲"])
+("zzir" [""])
+("zzld" [""])
+("zzp'" [""])
+("zzw'" "")
+("zzx'" [""])
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: cn-gb-2312
+;; End:
+
+;;; ZIRANMA.el ends here
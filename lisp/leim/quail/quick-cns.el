@@ -0,0 +1,691 @@
+;; Quail package `chinese-cns-quick'
+;;   Generated by the command `miscdic-convert'
+;;   Source dictionary file: cangjie-table.cns
+;;   Copyright notice of the source file
+;;------------------------------------------------------
+;; # Copyright 2001 Christian Wittern <wittern@iis.sinica.edu.tw>
+;; #
+;; # Permission to copy and distribute both modified and
+;; # unmodified versions is granted without royalty provided
+;; # this notice is preserved.
+;;------------------------------------------------------
+
+;;; Code:
+
+(require 'quail)
+(quail-define-package "chinese-cns-quick" "Chinese-CNS" "$(Gv|(BC" t
+"$AVPND$(GrS$AHk!>$(Gv|$ARW!?(BCNS
+
+	$(GiGk#v|$ARW$(GrS$AHk$(Guomu(B
+
+   [Q $AJV(B] [W $ALo(B] [E $AK.(B] [R $A?Z(B] [T $AX%(B] [Y $A27(B] [U $AI=(B] [I $A8j(B] [O $AHK(B] [P $APD(B]
+
+    [A $AHU(B] [S $AJ,(B] [D $AD>(B] [F $A;p(B] [G $AMA(B] [H $AVq(B] [J $AJ.(B] [L $AVP(B]
+
+      [Z  ] [X $(GyE(B] [C $A=p(B] [V $AE.(B] [B $ATB(B] [N $A9-(B] [M $AR;(B]
+
+\\<quail-translation-docstring>"
+  '(("." . quail-next-translation-block)
+   ("," . quail-prev-translation-block))
+  nil nil)
+
+(quail-define-rules
+("a"	"$AHUT;(B")
+("aa"	"$A2}>'Jn$(Gbf$A05Jo$(H'-CK[S[W[Z`;(B")
+("ab"	"$ACw$(G[)$AGg$(Gbg$(H*u$AjN$(HJ^PoaheV(B")
+("ac"	"$AjT$(Gw`wnx:{B|O$(H<JCJWAjT(B")
+("ad"	"$Aj=CA$(Gbe$(H$:."CEUPd:(B")
+("ae"	"$AB|WnO>E/1)$(Gsp$AFX$(H'''.*x5n[X`?(B")
+("af"	"$A>0A@UUlc$(Gpru|w_$AjA$(H'y<H=iCGDWPlWE\1$AjV$(Hh}j~k3k4m)nio~p!p8(B")
+("ag"	"$AMzA?$(Gbck\$AjW$(H.M/U:i<GUQW>[Y`=geh~(B")
+("ah"	"$ARW$(G]pdB$AS0$(H'('1*p5o<IBQHS(B")
+("ai"	"$(GQVUkbhk]k_pq$(H$;*m$Aj-$(HPn(B")
+("aj"	"$ATg:5$(Gd=d?jLppzO{<$Aj:$(H:*<ECLHVPmWBWF(B")
+("ak"	"$Aj;S3$(Gbbu{$(H$<'&'*=q$AjR$(HCMPp$AjU$(H[V\}`>jSp9(B")
+("al"	"$A<40:j?Nz$(GgP$(H*q$AjD$(H@xNWWC(B")
+("am"	"$A5)j@PG$(GSmUq$AjQt_$(H:)J]WG[Td8jU(B")
+("an"	"$(GO\$AL^j9$(H'0*nAA(B")
+("ao"	"$AJGjBjK$(GX`$AP*$(Gk[wa$Aj>$(H'J*sPjPkafat(B")
+("ap"	"$A@%3W$(G_,|:$AjG$(Hh|(B")
+("aq"	"$(Gu}$(HCHWDdNlY(B")
+("ar"	"$AUQIN$(GYB$ANnjP$(Gk^k`m4oduzu~$(H*t/XHTTF_X(B")
+("as"	"$AWr$(G[+$AjX$(H'%')*y$AjI$(H/W$A[C$(HA@(B")
+("at"	"$(GN#$AjE$(Gbd$ACK$(Gw^yC$(HHUJ_W@d9(B")
+("au"	"$A0MC0<HC<;NCaMm$(Goepn$(H#f$='/*r5k5m<D<F<KABD%D'K3[U`<gd(B")
+("av"	"$At^jL3?$(GdC$AjY$(HUOlZ(B")
+("aw"	"$AI9$(Hl[(B")
+("ax"	"$(Gro$(HUR(B")
+("ay"	"$A;^$(H[R(B")
+("b"	"$ATB(B")
+("ba"	"$AV,6Cuv$(Go/u&y%$(H-&7P$A@0$(HEEF9YTZc]ibB(B")
+("bb"	"$AEs7N9G8,>&$(Gfs$Aku$(Gp6qPuU$AKhkG$(H9T>@>C>DEFF?M0XcZ^]h^[bif&jr(B")
+("bc"	"$(GKJ$A>_Z$Lsn($(GmzqxuSuVw-{u|D$(H,z@LN<TRXbYW[f]jdRf%gtiClBlnpb(B")
+("bd"	"$AfZ$(GNh$A2I21$(G`z$A2G$(GeJmw$AwA$(H%M$Aml$(H-!113%$ACPkc$(HF<$Auw$(HTV$Ak}$(HbA(B")
+("be"	"$AJ\7~V+9Ik<$(G]Icx$A89OYw;kxO%$(H,E5q8K8S?2EBEDFAFCL)N;$An$$(HU{Z]$Ak{$(Hbjd@iD$A[G$(Hqx(B")
+("bf"	"$AVK<@H;$(Gk5$A1ln)$(Gql$AGF$(GtKy\zV{O}E$(HEA$A3r$(HM,TWV9XkYCYYY\Y]]k$Atm$(Hbke!f'fLhThUiak)k2k6m*q((B")
+("bg"	"$A6G?tD@n!$(Gf'k1$ALE$(GpJ$An*5qM+S7vD$(Gwf$(H20$Amu$(H8M$Akb$(H8Q?4$Aksm}$(HF>$AvBky$(HS-WHY_i`knmro:(B")
+("bh"	"$AM.ENmp2r$(GXB$A2J$(GZ4f#nOo2$AErk@ut$(H-'$AkS$(H17$Am{$(Hc`(B")
+("bi"	"$AVbkE9ZT)Q#1*8-22$(Go-$A>t$(GuW$AwG$(G}/}3$(H$t$w,C,w,y-%/18N>EHoMzS)S,Z4^YfKfpgxjtl5(B")
+("bj"	"$A:18N$(GS[$AF"n"$(Gfpy0$(H(:(N3$7O>B?6E?$Akn$(HHnS(TPTQXiYXZb]g]l$AwB$(Hg3g6(B")
+("bk"	"$A^Ik^kYPX$(GZu$AR8n%D$n+Mx$(H+~,{-)7KCNEG$Akm$(HL*Xj[v_b`p$Aux$(Hg4ixq)(B")
+("bl"	"$AkN$(Gf&$A6&$(H(O,I$AkO$(H142/3<$A[.$(H@u@{@|H+N=$Aw:$(HV=Y^(B")
+("bm"	"$AGR8XE_kUG;PHK/$(Go,$A`m$(H,G$AJ$$(H128L@O@QFFG^M$RGS*$Ak~$(Hjs(B")
+("bn"	"$AH_k><!$(GI4$A6"$(GP,TK$ARH$(Gb1ks$(H!h!}#/$v(;$A09$(H(M,x10223o7N$Amw$(H8T9U$Akr$(HL.Z_f#(B")
+("bo"	"$AZ#U#Lwk`ki$(Gb:$A=^$(GeEfw$A:!$(Gu%$Ak|$(GvoxT$(H,~$AkR$(H/Y/Z15$Ak\$(H218JFBL+Xf]m^V(B")
+("bp"	"$AC_Hy$(Gs^$AR\$(Gylyrzz$(H?5M/Xh[x$Auy(B")
+("bq"	"$ASCEVmxK4klK2$(H7TG_$Al"n,(B")
+("br"	"$AM,V\L%kX8luu$(Gb2b4$A:Q$(Gfv$AO9$(Go*$Aw<IEw@$(Gu$uNuQ$AU0$(GzE$(H#,)K$AkT$(H-$$Amt$(H1;7Q?1EHFGM.TSZdc[$AwD$(Hl@(B")
+("bs"	"$AM9@_Vz7>?h$(G^9$A0r$(G{.{p$Amm$(H,H$AkQ$(H16[y^ZiE(B")
+("bt"	"$(GEu$ACsk]$(G\m$An'5I$(Gz/|(|U$(HGYM+M-_dlA(B")
+("bu"	"$AK&D?$(GKD$AHi$(GM%$A7JkFmo0{kW4`$(G\k]<$AMskg$(Gc*$Am~C2$(Gz-$AkC$(H*z$Amq$(H,F,}3N$Akd$(H8R>>>A>F?/@M@NE>E@FEL2N.$Ak=$(HXdYVY[Z`_Gg!$Ak,$(HnQp((B")
+("bv"	"$AMWXh$(GWc$AQ[$(G\naN$AQ|MH$(Gk4o.sOu#xi{H$(H(813$A07$(H7R?3$Akt$(HF@S+Xec](B")
+("bw"	"$(Gf*$ACi$(GrI$(HF;YZ(B")
+("bx"	"$AR($(Gw,(B")
+("by"	"$A5$kh$(H8U(B")
+("c"	"$A=p(B")
+("ca"	"$ATx$(GgHrc$(HA:Nw[1[F[J[N_~j8j<(B")
+("cb"	"$(Gb\gBoZo[rjwYw[y6},$(HA=H6HJHONeU7[/UK[G[L[O`.d-gLj@jNlSn7n=qa(B")
+("cc"	"$A8*$(G]NgcgdoawUwX{5}=$(HGXH:[D[I`6`Tc~gYj>jBjIjKn6oY$AvN(B")
+("cd"	"$(GkTrhwW|L$(H:#:&HPN_NxN|N~UA[,[7`0`2d'd.gSjMjPlRlUn<(B")
+("ce"	"$(GbagMrguluvuwy;|M$(HA2A;NrU.U1U4UG[5[A[C`#`&`'d(gVgZjHlWn8o[r1(B")
+("cf"	"$(GupuuwVy=y>|K$(H'zA+V7[.[3[=d"d0dye%gPg[j=jEm6r/(B")
+("cg"	"$(GbZkVo_obriuty:yAzL{7}?$A[P$(H:%H5NfNtO!U9[B`(`3gUqbqd(B")
+("ch"	"$A7V5\$(GbYgKoYrfux$(H:!:'A>UId/cYgQg`j5jLlV$(IOP(B")
+("ci"	"$A9+$(G]j]l]ogIgJrdy?{:{{$(H9P9~A.A5A9H7HDHKN}U,U8U<_;_yd!d#gRg]g_j9jFn?qAqDr7(B")
+("cj"	"$(GX\oXo`ocy9{9}5$(H9zA6NbNd[;[K`/d5g^j:jAoZ(B")
+("ck"	"$A88$(GgAkOumuqy8$(H'"5i9|A0HCNgU5`)g0gTj6j;r0(B")
+("cl"	"$A8+$(GP3]me%gCgO$(H">%,3AA/A3NpT}UC_{(B")
+("cm"	"$ANL$(G]nb]g@usy7$(HH8H@HBHNNsNvTNUE[0[<`-d%d,gNqC(B")
+("cn"	"$ALj5y$(GX[X]b_$ANM$(H-a3E3G9}A7N`NjNqUH[8$Aj5$(H`"n:(B")
+("co"	"$AS{$(G`#b`r_$(HA4HEHRNhU2[2`%c}gMgWjCjOlNlPlXqE(B")
+("cp"	"$A7^$(Gllre$(H9{A*A-H4H=HINcU3UBW.[H`$a[d)d6g\jJlMoRoXpY(B")
+("cq"	"$(Guo$(H9QHGN{`1j7lQ(B")
+("cr"	"$A9H$(G]kg?gEgGkRkSkUo]rarkrmurwSw\w]$(HH9H>H?HFHHHLN8NaNkNlNmNuU0U:U=U@UJ[+[6[9[E`!`7`8d$d+gOjQpZ(B")
+("cs"	"$AYb$(Gb[gLkPo\uywT{;$(H3F:$A)NnNyjGlTqc(B")
+("ct"	"$AEh$(GkYrbwZ{||o$(H#rA,U/[4d&d2j?n>(B")
+("cu"	"$(GI+$A2m0V$(Gb^gFkZo^y5zM$(H-b0"A1A8A<H<HANiNzU?UF[-[>[?[M`9d3d4(B")
+("cv"	"$(GkQkXr`y@}+$(H:"H;N^U-U6UD[@_z_}`4`5d1lOo\(B")
+("cw"	"$(GgDgNrnun{6{8$(Hd*jDqB(B")
+("cx"	"$(GzN$(H[:_|n;(B")
+("cy"	"$(GX_$(HHMHQU;(B")
+("d"	"$AD>(B")
+("da"	"$AhC0Xhz?,2[$(Gsux?$(H/n/t<Y<x$A4;$(HJiK%K*P|WIWLWYaleW(B")
+("db"	"$AJA1zIRM0<,$(G_l$AC^EoiB$(Gi,$AiY$(Gp{p}$(H"U$AhD$(H++/e/i6064<f<qC]ChCjCnCsCx$AiG$(HJrPqPrPyQ*Q6]&$AiU$(HakapgomS(B")
+("dc"	"$AFe$(GdOi+kjpwrJvNvPx=$(H"W$AhW$(H+0+9/d6/<Q<_JfJ|K$Q,TUWMWNWW]%aqebo/p`(B")
+("dd"	"$A@nAVVj$(G[4$A?CI-i;$(GmCsx$(H$>$D$E+3/g$Ahu$(H6)6768<`<a<p<s<t<zCQCWC[C\JwQ%WbWd]"`NdOdPe]i((B")
+("de"	"$AF$V&0eKs$(G[B$Ai&=7$(Gm5v"$A<+$(H'G+&5y6'$A@b$(H<W<]<uC_Cc$Ai2$(HJnQ!Q"]*areXeYmT(B")
+("df"	"$A1-=\<m$(G\T$AWX7Yi,={$(Gm:$AiJiThM$(H66<S$Ai#i1$(HJ{K!K"K#K'PwQ3WTWZhMh]k+nop:prq"(B")
+("dg"	"$A6EMwVy?r9pK(hhW5H6$(GvSvU{b$(H'9$Ahd$(H445t5{5~$Ahv$(H6269CtCyJ}$AiL$(HQ5WJWf]$mRo1(B")
+("dh"	"$A2E2DI<hB$(GQe$A1rL]$(GdN}H$(H'7'?*}$Ahx$(H63$Ah{$(HCoP}Q$We]4(B")
+("di"	"$A4g4eh<KIhs$(G_qbydR$A;1i?iW$(Gpyq"vTx<$Ah>$(H$G$A99$(H'A+5$AhZ$(H9/JlJsMxPuQ.WR]#]6k\k^l4nAq!q$(B")
+("dj"	"$AD)8KhF$(GN8$AhRhw$(G[2$Ah~i*i.i>UA$(Gpu$(H(7+!/r65<d<nCR$Ai@$(HK(O1Px$AiN$(HQ2WPWQWX]'amdMgql_(B")
+("dk"	"$AUHC6P#k79#P(D#7.iOO-$(H!;$A+-+;/\=}$Ai($(HCgCuJeJqJvO2Q/W^(B")
+("dl"	"$AJxNvAxhT0p@FR,$(Gm7sv$(H"S+?/b/h/p5z6+6.$A3;$(H9o<y@y\C(B")
+("dm"	"$A1>8\8L2ih\;8hrV2$(GdK$Ai=U{L4$(H'B'D+$+*+>/`6,8B<M<U<X<c$Ai8i+i"i6$(HPt$AiH$(HP~Q4]1i#k]r+(B")
+("dn"	"$A4L:<hLX]$(GV/$AhlS\$(GvR$(H!K"P"Q$A;z$(H$F'I+)/a/f5|<jCPCqCzW`]2(B")
+("do"	"$(GKt$AhQ:KLR3~$(GmApt$AOp$(Gst$ACJ$(H'6'=+2+6+A/q5u6:<Z<[<b<o$A4*$(HI#PvP{$AiS$(H]!].]3anec(B")
+("dp"	"$AhA9wOkm.B4$(G|;$(H"V$@'@'H$Ah^$(H+($Aha$(H;l<e<|CwW%Wc\~i!(B")
+("dq"	"$(GSt$A0tEJ$(H'E*~C=$Ai%$(HCvFHWK$AiX$(H](k_(B")
+("dr"	"$APS?]?Bh[=[M)8qN`9WRN$(GdW$AiE$(Gi3$Ai3$(Gm9$Ai\$(Gx>y~zr$AhO<O$(H+<+=$Ahi$(H5w5x$Aht$(H6&6-61<N$Ai'$(H<r<w<{C^CmCrJdJmU]W]ajaoe[i'(B")
+("ds"	"$AP`hJWu@c0qU%$(H"R$?'>$A9qhU$(H+@+D$Ah`$(H/s5}$AiK$(HW_])e\(B")
+("dt"	"$(GQ`$AP5i:3H$(GvQ$(H'4+#+:/[5s6*JkJtJ~Q(gpi$(B")
+("du"	"$AT}h=UmhKO`JaN&$(GVs[=[A$A8Ei9$(Gi8$AGA$(Gq#ys}#$Ah;$(H'5'8';'C+/+1+4$Ahf$(H6#<R<^CiJyK)Q)Q+Q7]/ea(B")
+("dv"	"$A8y@7$(G_tm=zp$Ahq$(H5r5v6!<O<V$Ai)$(HC`CaCp$AiA$(HJjK&$AiP$(HWa`Oasi"k`(B")
+("dw"	"$(GN)$AhV$(G_n$AAq$(Gsrswzq$AF\$(H<gCSCVE#E,Q0Wg$Ai[$(HeZq#(B")
+("dx"	"$(Gm8yI$(HJuWVaii%(B")
+("dy"	"$AFShXC7$(H+B/l<P<v$Ai<$(H]5(B")
+("e"	"$AK.(B")
+("ea"	"$Ach24d-d>$(G`I$Adn$(GmQmX$Acim3$(H6T6[6c=-=9=T$Adf$(HKHQ^Q_QhX%b#(B")
+("eb"	"$AEfd"O{FVd8S?Ge$(G[d$AO}:~N<MDK]$(Gdd$A;,@l5NB)$(GiHiI$Adz31e&$(Gyu$Ae1$(H$U05$Ad;$(H6V=.=?=F=QD+D4DFDGKBKMKPKSKUQL$Ad{$(HW|X.]=a~b%el$Ae.$(Hkc(B")
+("ec"	"$Act:id?dF5aQ]$(GiDmVm\$Ae%$(Gq2t#v\xBxE$(H!a'P$Acp$(H060D6H6R=C$Adi$(HD/DBQFQG$Adj$(HQc$AvH$(HX'$AvL$(H`+`:awb"emeogs$Ae/$(Hi,i6mYp=q[qp(B")
+("ed"	"$(GH?$A3Xce$(GN]$AH>FbI#8!A:4>A\In$(G[g$ASNG~d`A;$(GiW$Ad}Th$(G}2$(H+V$Ad($(H0-04$AM?$(H0B0H6\6b6g$AdM$(H=S$AdZ3|$(HDCDD$Ado$(HKTQOQWX0X1b$(B")
+("ee"	"$(GJt$A<3S>2(=~?#Jg:-6I$(G`K$AQzFaB~$(GmLq(t-$AFY$(H$Z$['d6J6U<9$Am5$(HD;K6K7K<QYQi]<]Da|b!eki8(B")
+("ef"	"$(G[I$AdH5-T4$(Gdf$AF/dp$(GiU$AAJ$(GmNm]q=t.v1vYw~$(H'T+d=1=4=7=I$AdP$(HD0D3$AdQ$(HKWK^QPQSQVQ]QbX*]EaxeihPi1i7pj(B")
+("eg"	"$AMtW"$(GVC$ADyQDRy;4dWdN$(G`L$AdR$(GcUdi$Ad|$(GmW$Ae*$(Gt0$A9`$(G{e$AJ%$(H+Q$AM]$(H+c.R096_:u=VB7D=KNKXK[Wt$Ae!$(Haya{ejkdkekfmV(B")
+("eh"	"$AI37ZCZLiIf$(G`=$ACl$(GiV$AElFc$(H$W'_'b0KKCKJK_X!X)r?(B")
+("ei"	"$A2fO+$(GHFHG$AL-7(c|cvTi$(G[Q$AdAWLd_$(GiXm[q,t'v]$Acb$(H"_$N$R$Acy$(H'^0*0L6`=M$Ada$(HD8D@K?KD$Adx$(HQ`WzX(]A]Ra}eri/i2p;pc(B")
+("ej"	"$AV-:9Q4D-6}4cEH$(G`D$AWR$(Gdm$AUD$(GiN$AL6$(Gq+$(H$\'S076I$ADW$(H=:=<=WK9KEQQQeWvWx]>]Fkbo3(B")
+("ek"	"$(GJn$ANVckcs$(GR'$AR:$(G[a`1`G$AO*deD.3:0D<$$(Gyv$(H"\$Q'X+O+]+`$Ad&$(H+k010>0@0C0G6a=2=;=>=D=P=ZK>KOKVKZ$Adw$(HQRQ\QfW~(B")
+("el"	"$(GJs$ARJcwV^Uc$(G[\$Ad@dO$(GiL$(H"`$X+e0(0,$Ad3dD$(HK:$Ady$(HWyX#$Ae((B")
+("em"	"$A=-$(GJ|$A>Z$(GN_$Ad!$(GV=$AOQdVT|Dge$$(Gt*$Ae+$(GxD$(H$T$Aco$(H'i'l'n6G6K6N6f=G=XD1K;K\QMQZ$Ae,$(Hi0mX(B")
+("en"	"$AM!F{cl7Pd#d9dLdU$(G`A$ASe$(Gt"v_$Ae-$(G}$$(H!b$Ac`$(H'e$AE"$(H+R+i+m.-0<6X=/KAKYi.(B")
+("eo"	"$AGv7:d,$(GVK$AdCdv$(GiG$AJ~e)$(Gt&$Ae'$(H']'`$Ad75m$(H6M="=ED)$Adc$(HKLKQKRQUWuW}X"X2ed(B")
+("ep"	"$AG_$(GJ~$Ac{D`c}$(GR-VJ$ALm;l$(GvBv[{d$(H$Y$]+W6Y6];\DE$Adudq$(HQaX&X+X/]B]GaSehep(B")
+("eq"	"$AQs=rczd.$(H+h0+$Aj}$(H===UDAQDQdQgX$(B")
+("er"	"$A:S9AU4USQXVN64;nG"BeT!:FLJ:T8"$(G`5`<$AH\$(Gdo$Adte#$(H#F'Z'\'g'j'k$Ad2d'$(H+[$A=`$(H+l0.$Ad4$(H0I$AdJ$(H6^6h6j=0=3=8=A=B=J=L>Q$Adg$(HD5EQK@QX$AB:$(Hi+(B")
+("es"	"$AN[cf$(G`0$A23dh$(H!c$K$Acn$(H'h'o+T+b0F6eQE(B")
+("et"	"$AF|P9d*$(G`y$ARgd[$(Gdk$A3Ne"$(Gt(tExF$(H$L$M+P006O7J=N$AdTd]$(H]?]@b&kakgr>(B")
+("eu"	"$(GFf$AIGIr3Acdcg$(GNS$AE]AwO4$(GR,$Ad)$(GVM$AQMLT8[Of8HdX$(GiTmOq3t+$Aca$(H$O$V'm+j$Ad=$(H0/0;$Ad<$(H0E6F6P$AdG$(H6d6i=)=@=R=[D9K5K]egi5o4p>(B")
+("ev"	"$AHjEIf6@KFE$(G[^$AU??JtD$(Gi>iMq*q4$(H"Z'W+_0J=HD*D<KFazeqi)i-q%(B")
+("ew"	"$ASM>FWMAoEK$(GvZyt$(H'[$AHw$(H+f6L=5=YD-WwX,p<(B")
+("ex"	"$ALO$(Gt$xA$(H6ZQN(B")
+("ey"	"$Acj:#SY$(H'a+^mW(B")
+("f"	"$A;p(B")
+("fa"	"$AFI$(Gh)q5t8$ATc$(H=f>m$AlZtX$(HX6f7(B")
+("fb"	"$AP$1~<93#O)$(Gh\$A>+:}$(Gvc$AE4$(H*30W6s6w=gDQ$AlR$(HD[K`KiM1$AlX$(HQs$AtZ$(HX>XBY3]Lkikt(B")
+("fc"	"$A:f$(Gdvo+t^yK$(H0_KaKbO3X5XA]K`Vd7eskvqG(B")
+("fd"	"$ACWWQLDC:$(Gi*t4$ATo$(GxH$(H$_'v6q=]DKDLKeLf$At[$(HX<b*(B")
+("fe"	"$AEQ$(Ge"e$$A[F$(Gt7$A?71,$(H1k6p<=K4$AlW$(H]M(B")
+("ff"	"$AQW$(Gdxi^$AtUAGH<8b$(Gqjv`z]{M|*$AlM$(H>wD]QlRVX:XCetm.nmp?(B")
+("fg"	"$ATnLCH8$(Gc^du$A;M$(Gmfv}$AR+$(H'u$AlD$(H0N0\1o6{DVD\EzGGQtb(ewm[$(I=~(B")
+("fh"	"$AIYH/347[$(Gd{tb$(H"a1q6l6v=kr@(B")
+("fi"	"$AWFlE$(Gr-t6z($(H'x+v,hX7X=Y4Y6]J$At]$(H_=b+$Al_$(HmZqu(B")
+("fj"	"$AAO:87i4b$(GoB$(H's(H,f,j8%=\$AlL$(HDHDODTLhQoX4X8X9]H(B")
+("fk"	"$A<btM1V3($(Gd~$A>,$(Gq6$Al[$(Gt_$AH2$(H't+t,i=e$AlT$(HQ}X@$At\(B")
+("fl"	"$(GoP$(H'q1n$A[0(B")
+("fm"	"$A4VI?$(H$^+o+s0M0U6o=_=dY7bfr,(B")
+("fn"	"$AEP?;Ow$(Ghc$(H*=,e$AX_$(H0[D}E(QwR5Rj][(B")
+("fo"	"$A46;?l]$(H!<0O0T6u<~=`Qk$Au?(B")
+("fp"	"$(G`U$AO($(Gq>sn$(H0S$A1o$(HQrQx]Ia6(B")
+("fq"	"$A0kH-lHUF$(Giaq7$(H0cB~DJDSU^(B")
+("fr"	"$AIP><$(GR:$A@S1:H[LG$(Gt2$A2Z$(H0X0]6n$AlIlJ$(H6y$AU3$(H>nDIDUDXKgKjQm_W(B")
+("fs"	"$AAS>fU(?>$(G^8$(H8#i:(B")
+("ft"	"$AA#lO1W$(Gq9vayw$(H0Z8&=hKdKhQub'iX(B")
+("fu"	"$A9b>mEZJ!>lk)$(Gq8$AF3l@$(H+p$A53$(H0Y$AtN$(H1p$AMi$(H=cAVDNE{KcQpT7YK_Ic&ctmBq&(B")
+("fv"	"$AlPIQ$(H,g6kBCDMIZLe$AtT$(HQvZBkj(B")
+("fw"	"$(Ge5zu$AtQ$(HDR$Al\$(H_uqr(B")
+("fx"	"$AQf$(HX?i9(B")
+("fy"	"$(H+u0V6z(B")
+("g"	"$AMA(B")
+("ga"	"$A6BTvtw\0$(H:bj[(B")
+("gb"	"$AH=FR$(GTmk7sY|^$(H.W$A\#\!$(H4B:f:oB.B3$A\*\-$(HIAIDIH\Vg:o2(B")
+("gc"	"$A3`Ln:U$(GlBo1onv>wC$(H4HB)B+T[ULZec_eCg8$AvK$(Hgbl`q^(B")
+("gd"	"$A5X[W$(H%y$A6b$(H.P40414I4L4M$A\&$(HB5GfGiQ&TYVSj$(B")
+("ge"	"$A;xFBtv$(G^^`&$A9D$(Gn'$AH$$(Gu_$(H&#.X$A\$$(H4E4KAv$Al0$(HAv$A\,$(HJhQ[RFW<Y=Zf$Al2$(H_^iAm$(B")
+("gf"	"$A;5$(Gc\$A0>$(Gm`$Ald$(GsNvb$(H4?:kIKX3^Ka'g9hJlkllnann(B")
+("gg"	"$A9gBq6Q$(Gh<jW$(H%}$A[l$(H)^$A[t$(H.Q4G$A\'$(H:q:sINN>OxTZlCpw(B")
+("gh"	"$(G^[$AEm3C$(H#N$A[|$(H9W@TIE(B")
+("gi"	"$AH%KB7b$(GYZc[c]h@$As'$(H"*$A[i$(H&"$A[x$(H43$A\"$(H:r;;GbI>OqOzZ;\W$Ar|$(H_6p)(B")
+("gj"	"$AF:PR2:[}$(Gk8$Aqz$(Gtx$A\1$(H$H.U$A8O$(H4@IGOtTXVVdI(B")
+("gk"	"$A9!0#0=Ib\)$(Gh?$A6U$(H%v)Z9V:eIM$Aia$(HVTVWo"(B")
+("gl"	"$A[Z[_@$tq:B$(H-Y-Z.YIIm=(B")
+("gm"	"$AV7>y[aL9T+Sr$(G^c$AKzPf$(GpKw(x0$AEw$(H%z$A[f[z[o$(H4D9X:a:h$Atr$(HB0B6B9GkI?i^(B")
+("gn"	"$A?S$(H!O$A[Y$(H#K%Q%s.V.Z:tGh$Ats$(HI@$Aj4(B")
+("go"	"$A?2W_[r5L?n$(GcV$A:>$(H)V/x$Ah%tt$(HGlOuVUWkZh(B")
+("gp"	"$AV>\2$(H#J$A[h[g$(H)R$Am#$(HB*IJJ*PC(B")
+("gq"	"$A\/$(Glx$(H%~)S)[4ADdPTPU(B")
+("gr"	"$A<*?@98E`O2$(G^`$A3,$(GcE$ALAK~<NLKm`[c$(H%w$A[m$(H)]4F4J:nB1GeGgOy_ecQ$Av%$(HcXe=m<p4(B")
+("gs"	"$A[X=Y7;3G?e$(Gc<$(H%U$A[j$(H-S:pB2ILIP(B")
+("gt"	"$A@,nAR<$(GcZ$(H)`B,Os\X\Y]eeBhn(B")
+("gu"	"$A[]Fp$(G^Y$A>3s@$(GuX$An-$(G|}$(H!9$A[\$(H#M)W)\$A[y$(H3(42$A\%$(H494O:m@UAWGcN-Ore-e.g7n"(B")
+("gv"	"$A[sT,$(G^F$A?0Q_T=$(Gx.$AH@$(H)Q.L:gICJ`m>(B")
+("gw"	"$(GlF$(H4C:lB/Zg$(IPJ(B")
+("gx"	"$(H4<eD(B")
+("gy"	"$AL.XT[e80$(Gx)(B")
+("h"	"$AVq(B")
+("ha"	"$A0W;ha_Oc20$(Ga1$A2-sg;|t"$(Gv|$A<.$(H',$AjCp*$(HEdRC$Ak+$(HW"]:^-$At=$(HefiQr"(B")
+("hb"	"$A2/<g$(GPuU:$AITO!2_j{$(Gj"$A8eF*8]$(GqdvWw|$AwN$(G|@$(H*48VBbEfEo$Asbt9$(HKnLMLO$Asd9?$(HR@S4XF$Ast$(HY2^#$A@i$(H^_$AwL$(HbWe|f3f6m4m?p%(B")
+("hc"	"$(Gb;b|$A;~$(GjXo3qXq{s%uav)$A;I$(Gv{xJxYy&{A{m}1}K$Aoxjx$(H?=E^Hf$Ap!$(HReUfY,Y.\/^"^*`S`UbUdkf1g}hKiPiWkFn+p*q,qz(B")
+("hd"	"$A:u:LVl6d$(GK(K]$A<>sDPlt+@f$(G[@$Ao}6c7u$(Gi7j.$AwH$(GpPq`t[$(H0a1X<l=m$Ao{$(H>]EbEeEuFKFMLZL`R^S0$Asv$(HY*[le#i@(B")
+("he"	"$A74R[1Kaa6NH*p'[ERst20c$(G[F_&$AJr$(GdZe^$Ap"@hKRp%$(GxW$At$$(GyNz{$Al/$(H#u$AsE$(H7x7|;Y>^DaLNLbOES2WoWp];e&eyhumjnypIq'qkqq(B")
+("hf"	"$AO5Go$(GVT^$$AL:$(GkzqWqax&x'$AWk$(G|x$Al`$(H2q53;t$At*Q,tl$(HM2QyXyY/YE\3\4\:]N]}^,a+a,a-a/a5bSe"e)evexh>hWhYhZh[i?iOk8k9k<$Aws$(Hlaltm,m-m3m5nkoxp#ptpuqP(B")
+("hg"	"$AHID5My;JVX;Kae3L?p9MVIM'$(Gj!$AvCsr$(G}%}&$(H)_.S0b$At,$(H7j9K$As\$(H>hE]ErS3VZXEY#Y%]|^;$At>$(HdlhXiSiUiykGmho<(B")
+("hh"	"$AImNoCkCX5ZDB$(Gq\vswq}*$(H(Q+z,_$AovsK$(H7"$AsJ$(H>[ARHgO9RbX{^5$Aww$(HbMjanD(B")
+("hi"	"$A72C4$(GG#$AYmV[BQNRK=5D4}Sm$(GSx$AIdLX9m5C7{OO5H7$$(Gj)$AFG4[szN:2>$(Gz$$(H"?#t$`&W(0+|1.$A2O$(H7{8[><@#$AX:$(HRdT&\{]~^+$As.$(HbOfNgyhc$Ah7$(Hl6mcmgmknVo>pApm(B")
+("hj"	"$AG'10870]?F8M8^3Sow$(Ga"$AV~$(Gj1$A?}Eq$(Gt{$Aw}$(GvzzK$(H#P$q$Alf$(H0&<@@&Dc$A0^$(HEvFLLcRB^0$At!$(HbXf2gnlHminx(B")
+("hk"	"$AX2$(GIY$AleDAQmP&3t$(GZv$Ap($(Gc_$AN"?j$(Ghe$Aagss$(Gp*$A;U4X$(G|\$AX6$(H1d>bBiDb$Asc$(HJ(L-Q>Rc$AwIah$(HW;\i^7a>a?b>bVe0krn`nvnwoo$Aw{(B")
+("hl"	"$A=oC.S!$(GL<$AKy1|[!GdSy$(GbSeg$A1G[6$(H!7$AVV[%$(H-_-`$At1[,$(H7o8!8Y9p$A[/sL$(HA"H/H0H1$Ask$(HNXOFU$^6^8n5pF(B")
+("hm"	"$AX5IzUwsC49I|$(GR>U@$AIHWbLp1?sOs^s[si$(Gn4$Atf$(Gqb$A0?$(Grl$A7-$(G|>$Aa^$(H&X,d$At-$(H-T1#1R1U1i7#$AsN$(H=nD^E_Ec$Asm$(HYb[~^'^)^1dje2fMnUqU(B")
+("hn"	"$A<8PP@{9NVF6g$(GM=$AQ\:=9*RF$(G]4$AJ#=VQC$(GkWl,$A<}$(Gnlnm$AXf:bai$(H-L1a1j7r94@'@(ATD|ExHsK{K|K}L\LaR4R`T*Ug$Aw|$(H^3hdiTkQq\(B")
+("ho"	"$A0KW&7&J'9OP@t'M=VHac$(GZ7Z:$As_<ZW-sy$(GvVx\$Aa\p,sI$(H;Z>d?8$Al&$(HEnK,K-LXL]LdR_^.^4^:bLbmiV$At?$(Hn2o;(B")
+("hp"	"$AJOjrTm9TcCTu3KO"sBO$6f3nm)o~$(Ghf$ALr5B$(Glk$Am,sw$(Gs6$AKk$(Gx4xX{l$AX1$(H(D$Aou$(H,^1V1c7I7g7sD(O:$As|$(HdUeKez(B")
+("hq"	"$AE#BIa`@g38$(Ga-$Ak&UX$(Gu($(H"f'{;[?>C!D`J@LPP@Y0m\(B")
+("hr"	"$A8wOr:sI`ML8f:M>L;2jtadsW4,$(G^R$Ajwp)M24p3m9\$(Gj0km$AEMspLI$(Goqq}$Ap$$(GwJx]$Awy$(G{-$(H*S$Alg$(H1S5254$Ajujv=U$(H7p$AsSsTsU$(H7v$AsQsMt4$(H=(>e>g$AsX$(HE`EqEwKmLUO4$Ash$(H^2bGbRe1e3f,f5hehmj!n((B")
+("hs"	"$(GEB$AU'a]Pc7?t3$(GY/$AsPI{=n$(Gcqem$A>K$(Gp:zv$(H"b#2(G)51Q$At7$(H??EtI+Y$YabNfPgAq+(B")
+("ht"	"$AI}Q*1bsRKct;$(Gmsmu$AnB$(Gz%z0$(H1/$AsGt($(H7H7}EmY'Yc$As~$(HbP$At#$(Hg~h\mlms(B")
+("hu"	"$AC+X4OHWT$(GK5L#$AE@$(GO'$A?46\t.$(GU5$A0J65lhozQ-Mn$(Ga$ej$AOd$(Gn/z<$(H"g$(*&,]0#0~$Amr$(H1h262Z7n8":D$Ak%$(H=l=o$AsZaf$(HEk$At:$(HGBKoLLL^O5RARf$At<$(HS1T9VpVtY+$Asx$(HY1Y`^!`bm0p,px(B")
+("hv"	"$AN/:\$(GfT$AJs$(Gj{q_tWvt$AwM$(G|0$(H,c/2;3$Ao|$(HBDElP"V#ZFZt^]e{ht$Ap&$(Hp-r)rC(B")
+("hw"	"$AAt5Q7,ST$(Gvr$Awxt&$(G|?$(H*?+{0%1W$At6$(HLK$Ap+$(Hf4fOkslc(B")
+("hx"	"$A>J5>$(Gvw$(H-+f0ic(B")
+("hy"	"$A6,3bEGli??$(HLW$Asu$(H`ce4(B")
+("i"	"$A8j(B")
+("ia"	"$AjF$(H5,I~V}bK(B")
+("ib"	"$A8&O/@JS9$(Gl[$Ab_$(H!g.$I|L@f/iNme(B")
+("ic"	"$(GFZ$ABi$(Gb3$AA.lw$(Gfqi|l]o4$Awiwh$(H.(./3&@RI}J"RXdSj^p$pDpE(B")
+("id"	"$A42$(Gl)$ACSwg$(H(B$AbS$(H+8.'.w/u7a7i$AtR$(HCkEYLCVyXz$Awe$(Hm8(B")
+("ie"	"$AS@1yGs6HAh?5$(G_#$Aqe$(GcneZlYlc$AbQ$(H,X.y5+>XBfLJhakA(B")
+("if"	"$(GR3$AJ|F]$(Gc%$AP\$(Gky|.|y$AlF$(H>yBdP;P>$Alz$(HRTV;VD\6$Awc$(Ha0d{hGm!ndo5(B")
+("ig"	"$AIgW<M%Wy$(Gh8$AW/$(H*83k:0AjB8IFLB$Ab\$(HZK$Awf$(HkY(B")
+("ih"	"$ANl$(GW)Y6$AAN$(H#^#o.zLF(B")
+("ii"	"$AJy@d8.$(Gk{lZxV$AD'wj$(H&p(C*7.k1I$Aln$(HBeJ!Z<]{_4lbo&(B")
+("ij"	"$AHV$(GU;tS$AbX$(H@oE[LHV{]zk@(B")
+("ik"	"$AH.RSll>H$(Gl^$A7s$(H!d#-,Y$Alp$(H=r$AbZly$(He+(B")
+("il"	"$AV]FnFm@IIq@H@*j0$(GkIl\$(H#q$A["$(H,W,Z-[38@vI'NQcu(B")
+("im"	"$AJ=Pg5W;rlmWflsY|$(H.}7_$Ab[$(HRWXx\<pv(B")
+("in"	"$A;.PrY}4I$(G_!$Awd$(H#p%S1"3lAnkP(B")
+("io"	"$AV.4N8}bW8/D}u>$(H![*:/{1O$AbU$(H5.6=$Alv$(HLELIP=bJ(B")
+("ip"	"$A_.1S5!$(GRl$Am'D\B9;s8P$(GhhlipUs\x2}"$AbO_/$(H*9*@HtIzLGPQmMrA(B")
+("iq"	"$AD2bTOiD&wk$(HLDQ{$Ab]$(Hhs(B")
+("ir"	"$AL(R15jWIOL5rLF$(GW*$Alt$(Gi~$AD%l{$(H%O.&1K$Alo$(H1N7d:E>YEZh_k?(B")
+("is"	"$A3Ilq$(H$r,V(B")
+("it"	"$A[M=dJ"$(Ge@vqx3$(H*6>=>VBc(B")
+("iu"	"$ATJSHbRlkW#bV$(G_"a~$Awb$(H#n$AY~$(H7bE\Q@RUa8h`(B")
+("iv"	"$AA<WKM~tCl|$(H!]$AF`$(H7c>WJ$Uhe*hr(B")
+("iw"	"$(GTD$A[N8#$(H.xBgVz(B")
+("ix"	"$(HqR(B")
+("iy"	"$ACR(B")
+("j"	"$AJ.(B")
+("ja"	"$AU_jHK^$(Gm2$Aq?(B")
+("jb"	"$AA1e6:zO|T"3/$(Gk:oCoGy/|=$(H!=1Z9a;:NNTpTtZxnt(B")
+("jc"	"$AQ(UfRz$(Gb5hRk3$A4w$(GuTwlyByMyjz"$(H;9@eBOG|HeR\TTU_`QgBn9(B")
+("jd"	"$AN4WVSnP"XCKN08TTCBq=U/$(Gi6$Atp$(H(F4u7k>_IdQ'Ts$AiR$(HY!Zv\d],_lcre^gDn4(B")
+("je"	"$AV'?\<E$(GhToD$(H9b;8BN$AXE$(HK2QCTqZye/(B")
+("jf"	"$AWZKwVs2le<$(GlQn+s7x_zU$(H;4ToV3X~a$dzgChEhIk'k,k=l~m&m'm1neqL(B")
+("jg"	"$AJRVOqsH{$(Gg'h=$A=X$(Gj#wR$(H7m9c?9@pH!K8$A[T$(Hd<(B")
+("jh"	"$A4)9QAHe5$(H@mAkcq(B")
+("ji"	"$AJX:j$(GXGYq^'$A2)j*C[$(GlOwK$As<q6$(H3-?x@i@kPSTrW:Z-\>c7fqj(lG(B")
+("jj"	"$A^C$(GKO$ADOTW$(GXF$A9<$(Gclg%$ANS$(GrR{2$(H@bEgR[csj-(B")
+("jk"	"$AUI@t9JM;=L40$(Gg$$AD/$(GrTvvwL$(H#\,a3,7l@c@gLR(B")
+("jl"	"$A;B$(GZ}$A6<$(Gz\$(H.h1]3:9lG}NTY"(B")
+("jm"	"$AJ?RKV1?UP{3a$(Gg&k<$A:2A~4#$(H@jEh$Atc$(HbgoV(B")
+("jn"	"$A>?JBq7$(GP+S\$AX`G,8n$(GhOn,rS$AD~e3$(H"h.*9d@lAl$Aq>$(HOM(B")
+("jo"	"$A6(<Rq;$(G]TbJp+$(H(5)x$Aq9$(H1^4t;7?-@nBPGzL!$AqA$(HWi\e^$$Ae?$(HcoeSgE(B")
+("jp"	"$AK|U,@O;]$(GoJpTx1$(H9`;];^X}cpj*(B")
+("jq"	"$A@Ne:$(Gmcsdv'y.$Ae8$(Ha9(B")
+("jr"	"$A9E9YTU?M:&$(GU'$AH]<D>==Q$(GbH$Ae;$(Gj$$A;m$(Gu]$Ae4$(H,r.i@d@h@qG~IfNMNOTuXrZz$Ae@(B")
+("js"	"$A?<$(GL6$A2*U-q:$(H)4.jVg(B")
+("jt"	"$A;\$(H;5G{_mlFoUr9(B")
+("ju"	"$AF_?KMjMp$(GOQ$Ak#$(GXH$AC\$(G]S$A?_>$$(Gk;k=q]$(H#]$Aq8$(H1[1\1_9^9_;6@fNLQATvZ{\?^%^&fDn#(B")
+("jv"	"$A02F^Qge72C$(GoI$Ae>$(Gu^u`vu$ADRfK$(HIeX|$Ae=$(HZwj+j,(B")
+("jw"	"$AVf8;$(GbIlPoHrQ$(HByZugFj)n3(B")
+("jx"	"$(HEi(B")
+("jy"	"$A:.$(HH"(B")
+("k"	"$A4s$(H!!(B")
+("ka"	"$APqI]2~$(GlG$Aj8$(HE%E.E6L"XMb:(B")
+("kb"	"$A2<SPO#kHaz2!$(GW]Z'$A2BM4$(Ge($A;+q$H3$(GqLvjxR$(H!.0h7-7C$Ab)$(H=|>5>8BRE8R$R)]O]P]ci=r:(B")
+("kc"	"$(GVYb7e:r~vdxLzy|b$(H'|1(:2E7R'R>km(B")
+("kd"	"$A4f<\b#$(G[ze?$Aa|b.$(H>4DkE9(B")
+("ke"	"$ASQR_F#$(G[D`s$AJ]q#$(Gt=$Ab!$(H<7<8='=v={$Ajy$(HKs$Ap}$(HR:]ab,$Aq0$(Hm]o8(B")
+("kf"	"$A;R5RDN$(GRR$AL5$(Ggmo{tCy[$(H'}DfDgF*$Ab2$(HR&$Aq&q)q'$(H\8$Ab4$(Ha(d|e$e'hLnfoqqQ(B")
+("kg"	"$ATZ?q?|@jH,P[$(G{f|a$(H#_$Aap$(H$g$Aaypf$(H;<$Apn$(HE:R!R8$Ab5$(Ho9(B")
+("kh"	"$AUn$(Gil$(H$b0d$App$(H>7XG$Aq,(B")
+("ki"	"$AMhL+awLWVL$(GhDimqA$(H!8$A^M$(H('7D=zDe$Ap~$(HR<(B")
+("kj"	"$A4a$(Ge<$Ab/UNq1amau^Gb'$(H7+]bo#(B")
+("kk"	"$AX3=F<2K,:o$(Gibioy{$(H=sL#$Apz$(HR(XKXW$Aq"$(Hb;o7(B")
+("kl"	"$A^Nar=jSt^E$(H$d&$0g3;$A[-$(H9t$A1T$(HIQKrb8o6(B")
+("km"	"$AWs>QV"pa>RpcPI$(G`pcoik$(H(!(%(&(6,$2'7,J?$Ap{$(HXZ$Aq*(B")
+("kn"	"$A>EXWRD8m$(GP&$ApjA!$(Gint<$Aal$(H"d$f$Ap[XZat$(H)b$AX^a{$(H1+7)7F>/E4$Apx(B")
+("ko"	"$(GIh$A:|>N$(GVX$Ap-b1$(GxS$(H,'1-$Al$$(H7A$Al%$(H=y$Aj3pqpu$(HR%R=XLX^`@(B")
+("kp"	"$A4Cpk[D$(Gvk{i$(H$p($,#,>,?567(R;$Aq!$(HXY(B")
+("kq"	"$(G{j$(H,p$AQwb3(B")
+("kr"	"$A<SSRFf97phF&3U$(GhE$A4q$(Gmq$(H(",!,%-Q$A[Aa~$(H1'1*$Ab"b&$(H7E7G=w$Apm$(HDjE$E-E1$Aps$(HL&L(b=(B")
+("ks"	"$AA&?d$(GtB$A:;$(H!~$Apd(B")
+("kt"	"$A1<CM?x6;NA$(GsS$(H,&1,(B")
+("ku"	"$A^L78QYp^0Lp`^K0)aq$(H+L.q2Y7'$Ab%X8$(HD$DhE'E0$Ab0$(HR"(B")
+("kv"	"$A:]@G:[tBb+T3pt$(Gveyz$(H"2'~)w=xXHXIb9i<mb(B")
+("kw"	"$(G`Y$AAv$(GpM$(Hb<(B")
+("kx"	"$(Hf$(B")
+("ky"	"$AL[pvpr$(H$a>:(B")
+("l"	"$AVP(B")
+("la"	"$AEA$(GUs$AqR$(GlW$Aq^$(H2m2t5)9@@$@+M_$A@/$(HN$So$As)$(Hc8fzl/l:(B")
+("lb"	"$A=m$(GP$$AkP13S<$(GfP$Ar_k;:{ryq[$(Gp#$AHd$(G{$$(H.u$Ar8qDrE$(H919<$ArY$(HG2G7G@MuN!StSzS~T+$AqX$(HZ0Z9ZH_'$As$$(H_/_?c2c>cD$Aq`$(HpM(B")
+("lc"	"$(G^{b6b8b{oo$A<=Cx$(Gs4xI$(H96;WB_B`Iw$Ar`$(HP7T"T'Za_&c($As($(Hc0c5ff$As9$(Hipl7l8oJ(B")
+("ld"	"$AVkk:Bc5{qY$(H-N2`9><i@,@.$Ar]r\$(HG:M\$Ard$(HMk$Arv$(HSsT.Vu$Ar{$(HZI_2c<fsf|ir(B")
+("le"	"$A0f1;a#$(Gneno$A`z$(H'c2_2x2~93G+MfMgMt$AqV$(HN)S|S}$Ars$(HT4_1c?$As6$(Hl9$As=(B")
+("lf"	"$(Gp(r,s8$AB]=s$(HJaM}P9P:Sl$As"$(HZ6_)$As*$(H_Bc.c1c4njos(B")
+("lg"	"$AqEa!V{M\rNrQ$(GfS$A41;Hs+a"$(HG,$AqN$(HMoT)_>fiispKpL(B")
+("lh"	"$A3uI@QA$(Gi#$Arf$(H(i2i2z9BG.Iy$AqS$(HSw_0_F$As2(B")
+("li"	"$A7+3fr<rH6jHl$(Gw9xq{($(H-J$AqC$(H5*9"9*9799=jG5Md$Arc$(HZ8\g$Aq_$(HaQaRc/c6cCfmfx$As:$(Hq8q9qt(B")
+("lj"	"$Ar=0vEF7da$qTrr$(GoEr1$As0s/$(Gw8$(H-G$Arg$(HP8$Aro$(HT,_@c+c@flfw(B")
+("lk"	"$AJ7QkNCqGl3rT8$rZ$(Gm0$As!$(Gxx$(H&N2b2g4P9$9:?~@-IxMvSrT(T6Z*Z3Z7_DnS(B")
+("ll"	"$A4(F,Ij4.Z}r>rark$(H%)(h2e$Ar;$(H2u@}G0MsN*SqU!Vx_,iv(B")
+("lm"	"$A:g>B$(G[$$Ar@GyrGL;$(G`kh^$Atd$(Gu?$(H2o2w9+929A9FG/$ArbQQ$(HShZ=ZJ_.fgftoHoL(B")
+("ln"	"$A8%$(GXn$Ar[$(Gh"$Aru$(Gnr$(H!Y#.(g$Ar1r4$(H..2[2h$AqF$(H?w?zD_T$(B")
+("lo"	"$AUW$(Gxsz9$A`yr6$(H2a2s9)9-9=B^G-G4G?M^SvS{T2T3\h_E$As-$(HcAcBfuf{$As7(B")
+("lp"	"$A11R7VR$(GX3$A;<I_1/s,$(G{)$(H-H$Ar7$(H2p95$As#$(HZ?_*_3$As3$(HeJmzn!q7(B")
+("lq"	"$Am2$(GO.^|$(H+x$AqHrUrV$(H@/MjT0$Aqa(B")
+("lr"	"$AL{rArB;W8rrRH9T#V)rh$(Gj~nf$AqWs8$(H*2+y9%9&909;9??y@)$AqKqJ$(H@2Me$AqU$(HVvZ)$As%$(HZGc)fy(B")
+("ls"	"$ArFs&$(H$n9#$ArJ$(H9GKlc'(B")
+("lt"	"$AVQ0;$(Gip$Arlr~$(Gz;|G$(H*1?vG9Z1Z2Z>m|pN(B")
+("lu"	"$A6yX7E[C1;O$(GfGfJfW$Arjriq]$(Gw7xr{r$(H!5#k#l.v2]2c2f2l$Ar:$(H2}$Aeu$(H?}@*G<$Ar^$(HMmMqM|N"Q?SkSuSxZ:_Ac=dhqf(B")
+("lv"	"$Ar5$(GY_Z($AEa:VMJ$(Gu=uD{'$(H4]?|$AqL$(HG)G*G8Ml$AqQ$(HSnSp$AP+$(HT/Z/`WfkfvoFoI(B")
+("lw"	"$ASIPd7yrPa&rps4$(Gxv$(H%1$ArD$(HM`$Arx$(HT-fjl0oK(B")
+("lx"	"$(GaH$(HBaMniqm{(B")
+("ly"	"$A7G9S$(H9,N&Sm(B")
+("m"	"$AR;(B")
+("ma"	"$A0YgjXH$(GUl$AQ3$(Go)$A4W$(Gpm$(H0r<L=%>,>;DuEM$Au%$(HXQ[*]Z]ogh(B")
+("mb"	"$A1{TY$(GNvV_$ATR$(G\j$AOu:wHpEp$(Gl0$AA'Ov$(Gy}$A0T$(H"p,50v737<DrESEW$AmZm\$(HN9NZN]Q<R,RI$Av,$(HXOXpXu$Au-u/$(H]yb.cxdie}f)lLma(B")
+("mc"	"$(GSwXC^!$Agw$(Gbz$AEv5b$(Gfrg`gbieiz$Ah+$(GqVs!s$$A;G$(GvXyLy|{v|<$Agn$(H79:I>-AQK.Kv$AvF$(HQ:RJRK_]`Eb-b/dBeef-g2giiHiMj\pC(B")
+("md"	"$ASZ:q@uJbVi$(G\>$AAUh!KZKV5z=Mu)4<UiAXh2$(Gz!$(H$i(A$AX+$(H0w$At}ih$(H7>:H>)>N>UENEPEVH]KyKzR0R3$Am]m_$(HU)UX]V]s$AmaCQ$(He`e~pU(B")
+("me"	"$A9/$(GN?$A1C2#ODFFGrtyh&B5Ka$(GlhrHt@$AO<82$(GxNy3$(H,O,P,U1@6?9v=#>&>'DqDyL9L=U'U(_tb0eEh3p\qF(B")
+("mf"	"$A2;J>T-ARQIF1$(Gif$AL<$(Gn#p)qE$A=8u4$(GyY$Au8$(H0^$Ag}g|$(HOJQ=V1V2V5V8XmXn__`}a)a1$Al^$(Hcyd}$Ame$(Hk*kqm%m(m`oWoro|qMqmr=(B")
+("mg"	"$AMuVA$(GNs$APM0`$(GVaYS$A@m0_QcQEmTh-$(Gm}$Av*;t$(GsL$Av/v2$(H%Z$A@e$(H)Y1C7275$A9hH7$(H?:AK$Au($(HU+XTXo$AH)$(Hkom^p](B")
+("mh"	"$AQ@PNUdI0FvI*$(GmF$A3'$(H"$'L()$Agc$(H)9$Aie$(H,)$Am<$(H,Q,t70$A7S$(H>KAMDoDsGAH\J'L6R-XqXv]X$Au2$(Hgkls(B")
+("mi"	"$ATF4uSqM_NyAaDMr3m@HhWCj)$(G`$`]bx$ArWAc9e4E;j$(GqCqT$AHZ$(GtPukxMzQ|f|w$(H!f$j,-1D1G1H$At|$(H7=>$$AmRrK$(HETJ=KwMh$Au*$(HR2ROU&XSXw[_bHc;$Amg$(HgjiIl2l\pW(B")
+("mj"	"$A8IF=Eiq{$(Ge1$AKi1.h0Wm$(Gom$AEy$(H$h(((/$Am7$(H)8):,.$Agmt{$(H>SR+TOWn]W]w]xb3bEgJgmj4(B")
+("mk"	"$ALl9%8|gdC5U~QjVB$(GZz$APo8RS2v)gx$(Gh%i_$Av1$(G}<$(H#Q"M'K(+,s0l0y>+DxH_K0L?R1RMXlXt]Y$Amb$(H_a`HbFf!f}l]p@q*(B")
+("ml"	"$A6xPOP0m=CfIiX*gp$(Ge+$A3jPh$(G{z|N$AX"XAZu$(H"s$AZv$(H$k%+(-$AZ{Z|$(H,,,4,8,R$A[$$(H363739:v$A[2$(HH,H-NR$A[3$(Hcwe;gg$A[9(B")
+("mm"	"$A6~H}9$;%NeX'U}$(GG'$ASO$(GKi$ANdX=MamF$(GW&$AQ)V3$(G`j$A:($(GeX$Ah*4h$(Gq%$AtgPQ$(Gzs|p|q$(H#6#j$l(=$Aic$(H,/,30x1?$Atx$(H3s6B>L$Aij$(HDlDwELH^Ku$A2j$(HL8Q;]8^S_w$Amd$(Hq{(B")
+("mn"	"$A6!?/APPL5=tz81$(G\#$AmJGYXbh$XcUgX!$(H!|$Ag`$(H(1(?)2$Agq$(H1A$AmI$(H7;@KDtL<[^`D(B")
+("mo"	"$AXFNW>Au9$(GL%$A?3m>XJWA8hh1F0$(Gs}$Ah3$(GvpxU$(H(k,L$Agr$(H3#6A747:9H>JC|Dp$AmV$(HG[$Au<$(HN:O%$Ah/$(HR/$Au.$(H]ScZdD$Amfu3u6(B")
+("mp"	"$AK@gi?V$(G_*$AE}g{T8$(Gy^yy$Al}$(H(*(@$AExm$$(H0p$AmHu"h.:)$(Ha7j1p^q`(B")
+("mq"	"$A1B$(GqD$AAW$(H/}0t0u7X>#B}Dn(B")
+("mr"	"$A?IJ/Na7q4ygh8g4=gsUh$(G`e$Agy5o@Ru$h)1L?a@ZX,$(Gru$Au1B6gfgl$(H,2,60|1>1F7177787V$AmQmO$(H=&$Ah"$(H>(>*>T$At~$(HA&A(Dm$AmU$(HEO$AM*$(HI-KtKxL>RHRQ$Au,$(HUV$Ah4$(H]q`F`G]tczpV(B")
+("ms"	"$AX$9&GI$(GP0$AmDv'0u$(GsDyG$AMr$(H!-#776?;$Au!$(HALXs_v(B")
+("mt"	"$AE*69S[I:$(GRZ$AQP?Dmc$(Guj$Au7$(H";,0/~$AmG$(H9RK/RL$Ail$(HXR[&_`$Au0$(H_xb2b4$Au5$(Hf*g1jW(B")
+("mu"	"$AX#T*6rMfAp$(GW($AEd$(G\"$AArgzEC$(G`~$Ah#Mk$(GgY$A1"$(Gid$AMc$(GoW$AD^$(Gr|$AK*$(Gvg$AX#$(H!>%Y(>)7,1,70o0z6>7Z9S9u9y=$$Ag~$(HB]DvEUN+N,RPU*WlZ%]pa=mdn@(B")
+("mv"	"$A3=K#R*@EAQmYDkUpv.$(Gt?$AwQ$(Gzwzx|P|n|r$AXN$(H)v7Y>I$AmK$(HG\L4L7[]\bdCj3jV(B")
+("mw"	"$ANwh'@W$(Gwg$ANx$(HXP]T]rbCbIf"iJ(B")
+("mx"	"$(G{~$(Hb1(B")
+("my"	"$AOBSjC9v-$(H(.,T.20{>.$AmX(B")
+("n"	"$A9-(B")
+("na"	"$AD0$(Gbjp'yU{K$(H:+EIT;`wk#n^nbpiqI(B")
+("nb"	"$AqcKeSg8t$(Grq$AHf$(GsZv/yV$(H(|-d.|2351:/V)`Cdndwh7j{k$lvl|$Aew$(Hohonq;qi(B")
+("nc"	"$AP!$(GSWgSg_$Ab9$(HHWP?USUd[g$AvJ$(H`RhBjRlwnYqJ(B")
+("nd"	"$AWSTP3ZHahn3}$(Gq[$(H"3"w-h:.Cl\#]-a!dxh@hDjyk!n$n_pgqh(B")
+("ne"	"$A<0Zf:/ZiAjZn$(G`u{L{s|-$(H!:!`&R,@9JN/N1PgV.dvh4h5j|o'oi(B")
+("nf"	"$A>D$(GU!^#$AI7O6$(Gkcq@s;x$yQyTzZ{P|,$AfX$(H0P4s50OLUz$AZt$(H`yhSjqk0k;ncoMot(B")
+("ng"	"$A3sM"=G1]$(GXh]t$AZr$(GlClDv0x!$(H:jAFAHGCOwhAk&n[r8(B")
+("nh"	"$AC,$(Gblw=$AZl$(HHpV(V*\"dt(B")
+("ni"	"$AO&:k6`MCORJ-8=$(GZ0$A50$(G]ungs~$AP7$(Gz=$(H&S(xBz$Aj.4%Zs$(HM{OH$Arz$(H\$\)$As1$(H_8lym_nZoeofqg(B")
+("nj"	"$AZdet$(GXb$AuzZpUO$(Gl_|+$(H"xJ&dJg"nW(B")
+("nk"	"$ASVWN$(GPY$A9o$(Gv.$Au{$(HADO#PdV+[[dqj}lx(B")
+("nl"	"$(GE>$AR}$(GoRx"$(H-P-e9q@z$Av"X>$(H\&`xj0(B")
+("nm"	"$Af]X)QSWhHu$(GXg$AB!Zo$(GpS$A=.$(H%/&T({.{4r?)@9@;HXO$OIV'\%\-lznXojpd(B")
+("nn"	"$AAKSh$(GKc$AqfevV`5J$(H"y-gAGI(V%b5e9(B")
+("no"	"$A>Cf^G7qb9B;!3P:"$(GSy$A68$(GXe$AOs$(Gbibq$AT%Km$(Grr|Y$AZk$(H3H=!$Au}$(H\'`{h6jzn]om(B")
+("np"	"$AMS<1T9SA$(Gv!yDzY$(H%-J9OGV-\!$AcD$(Hh8h;r<(B")
+("nq"	"$Ab6p.=(=5=b$(Gv-|X$(H!0_Jk"(B")
+("nr"	"$AC{0"$(GY\$AEcU2$(GyW|W}@$(H&Q$AZg$(H:,>GGFJ%T:\*\+\,\.`v`z`|a#cWdoduh9k%luqj(B")
+("ns"	"$ADK7@SBCc$(GSRY-$(H!i$AZh$(H-fV&\(n\(B")
+("nt"	"$AZeCOS/5G0/$(G}A$(H,AHY\cpe(B")
+("nu"	"$ARR?WN#I+CbHnT:JhLU$(Gp&s5s?$(H!Q$AZc$(H#s%.%0$Af_$(H*0$Amsv!$(HGE$An&$(HP6T<UTV,Wq["a"dmdpdrdsh:l{olpf(B")
+("nv"	"$AO^B*$(GZ/$Ab8$(H&4$AfD$(HAC$AZq$(HV~h?jxph(B")
+("nw"	"$(G]s$(Hh<l}ok(B")
+("nx"	"$AO]$(H"#`AogqK(B")
+("ny"	"$AMb$(H:-hC(B")
+("o"	"$AHK(B")
+("oa"	"$A2.0[=h3+$(GXr$AYIVG$(GdD$AI.YT$(Gl&sC$(H%@3c3eA\I%]njZqo(B")
+("ob"	"$(GDyI)$AEeY+Y'Y8GNY;$(GT*T>$AE<F+$(G\l^,c+$AG]$(Gghgzg}$AHe$(Gs,tL$(H!t!y'N)(-w3V3Z3\3h:9$AGh$(HAbH|S.Uk`Y$AY_(B")
+("oc"	"$A1x9)>c$(GX~]L]Mb<c,c0fug|kkl$opp3s#sA$(H!4#*-o-~3a:7:=AfHyI!\FgajdjejfkOnCr!(B")
+("od"	"$AWPK{P]S`Y*1#7}$(GV4[>^-$A</$(Gou$(H+E/v3R:?$AK[$(HH}UjWh$AsA$(HdWjgn|(B")
+("oe"	"$(GG;$AGV?!$(GXi$A<YBH$(Gc!$AI5$(Gs@wdwsyO$A<?Y`Y484$(H-n-u.[/P$A4v$(HA`OUUn[i\Hi4f((B")
+("of"	"$A;oDc$(GO{Xs$A5*=9$(G`Res$AAE$(Gs:$A71$(Gv2$Awl$(Gx#{N{X$(H!U!w$AY\$(H-i-l-s-z0Q0R3]6}:;:<AZA]$AYQ$(HAhDP$AYU$(HOPOQV6VC[h\9\Ea.a2e8h^m/n}owoyr4(B")
+("og"	"$AJKHNH+W!Wx<Q$(GL!$Av?Y51$$(Gb~$A4_otYW$(Gg{zc$A9^V6$(H)*),)0-y3T3_3`:6$Aos$(HAIONUUV@[\`^gzkNmmoOp[(B")
+("oh"	"$AHkF97]7UP^$(Gc2c5$AXs$(H"zHh\J`[le(B")
+("oi"	"$A86AnXpER7%AfC?JL6m8)85?~$(Gc.jsl!osp2s)wtx+zS}.$(H!p!s"}#()1-q-|3b3jHwJ>dX(B")
+("oj"	"$AJ2NgG*$(GT)$AYBP1$(G^0kp$AF'$(Gw'$AXu$(H"{$AY&$(H-j$AY>v@$(H3g:CAYA[H~[a`X(B")
+("ok"	"$AULJ8RA7|X|J9:n1cY9$(GT#$A:rk3H1WvY?Ct$(GZx^1$A0A$(Gknsm{W$(H#$$AY.$(H)%,K3O3f:A<;ASAiO7$AYS$(HOW`Z`_g|(B")
+("ol"	"$A=iVYQvIlP6C|Gq$(GSiY&$Ak-<[$(H!x!z$Ak.k0$(H%J+M$Aor$(HA!A#HiU#Um[%(B")
+("om"	"$AHJGpNiFsWt5+5MY^8WYEV5$(G[G\_$Ata$(G`*$Atb$(Gc/$A=)$(GyP$AXm$(H!F!G$AYZLe$(H#")!-{3^:8:>F6OO`PaEld(B")
+("on"	"$AFrXj3p=qXx$(GHo$A7p@}3^@~Sa7z59$(GT/Xj$AM#$(GY!$AM5$(G^6$AJf$(Gl-l.$AXkFxXn$(H!o!L$AXt$(H%6%7).)3-r$Aj2$(H3K$AXd$(HV?VB]]``(B")
+("oo"	"$(GG/$AHbKFX}Y,$(GOn$A4Y:$$(G^)c#gx$AOq$(Gl'$Al($(H!l%4%5(K-m/z3YAeAgD!H{NIOYVA[k]7`]nF(B")
+("op"	"$A;/4zXrY"@PDnSFDz$(Gc4$ASz$(Gk~pWs*zb$(H!r%2%=%I&Z*A*N-}.m$Am%$(H3W57:3AcOX\GaCiGn{(B")
+("oq"	"$A<~Dj0iS6QpY:DCQu$(GXy$A=!NhY0jp$(HI$i;(B")
+("or"	"$A:O:N9@SSY$KE$(GH|$AX~:,V*IaPE$(GOs$AKW$(GP!$AYD16RPYF$(GT6$ALH$(GT?$AY<J[$(G^/gegf$AYR$(Gkqs($(H#&$AY%61$(H%?%C%G%K%L)#)-$AYC$(H4':5?#A_O6O8$AYY$(HQ8g{jc(B")
+("os"	"$AHT7BDJWw>X0x$(Gc$gU$AXl$(H"|$AY(Y7$(HHx(B")
+("ot"	"$AN;$(GKwK{$A:P6L$(Gi;kop1$(H#)%D*<3U?"UlXadVjbmp(B")
+("ou"	"$AOIs>Y)a7T@>k03>sD_$(Gc"$AX9$(Ggggtr6zR$(H!J!X$ASE$(H!n!u#+$Ak/$(H%A%B)$)&)))+-k-v.t3i$Ak4$(H:@:BA^BY$Ak(YV$(HOTaD(B")
+("ov"	"$AXzR@J3$(GT1$AYA01YHYK$(GY%$A4|0+$(Gl%otv*$(H%<%H&5(})")/-p$At@$(H3Q3S$AYJ$(HAa$AYX$(H[j\I`\e7qH(B")
+("ow"	"$A5h$(Gl($A@\$(Gwr$(H0'3P3d7@9x>2I&(B")
+("ox"	"$(Gp4s+$(H3[(B")
+("oy"	"$AFMNjY=X{Y!$(H%E$Ak1(B")
+("p"	"$APD(B")
+("pa"	"$AV<Q.EB=TO'Tw$(H'2*H$Ab~$(H5C;bJ/J4PJ(B")
+("pb"	"$A2@YiGDGi6hc7c<E3$(H&^/&/(/+5I;jBpBqJ1PEPNPOPP(B")
+("pc"	"$Abp$(G^"$AIw$(GgahklsqYx6$(H&f5H@P$Ac;$(HBuBvPMQBQj^AaUaZeL(B")
+("pd"	"$AR2c#<B$(GZPc~d"pX$(H%V*P$Ac'$(H/.1m5=5A;g;iPLW(W[(B")
+("pe"	"$Ac9?6B}$(Gmt$Abe$(H$!&k$Ac*$(H5?;k;sBtaVaXo*(B")
+("pf"	"$A;Vc8c=c>$(Glu$A;3$(H+r595<$A>*c:$(HJ0O?PKV4\5bahRk.m+o)(B")
+("pg"	"$Abn9VN);L$(GgW$Ac?6.$(Gwezj$(H#O*G*R$Ac&$(H//J.J7OvkZl;(B")
+("ph"	"$AGPNp1Xc)Lh$(Ghn$Aba$(H&[$A1Q$(H;hJ3PG(B")
+("pi"	"$AQ>IW94bbblGSJQ@"A/$(H5>BoJ-PR\paW(B")
+("pj"	"$A:7c2c,5?$(Glrzk$Abc$(H#3$Abhbq$(H;c;fJ,PHW*(B")
+("pk"	"$A4RPY?lbs$(Glo$A0C$(H"@$$*B*M5DBwJ5J;W,\q(B")
+("pl"	"$Ac$$(Gg9hm$AbgPC$(H(s*j$A[($(H;p(B")
+("pm"	"$(GE$$AUzPTbr$(GQ1$APJ$(Gym$(H&d&m58;mJ2J<$A:c(B")
+("pn"	"$AXXEYbv$(G_3$ASdX?$(H!6"A$'*D*K:G\maY(B")
+("po"	"$(G_.$ARI$(H$"&g*J+F;qW&W-\o\r(B")
+("pp"	"$A1H:vbuc1$(GpY$A:6$(H$#&_*E5F5G;_PI(B")
+("pq"	"$AR^$(Gln$AP8$(H&l,;(B")
+("pr"	"$A>dbyG!Lq62c!Nr5kc0$(Gd#$Abobw$(H&b&i*I*O*Q$AYj$(H/05:$Ac.$(H:F;nJ8J:W+(B")
+("ps"	"$A[>c6c5$(Ghl$Abt$(H&j3qI*(B")
+("pt"	"$AJ@Pt$(Gd!d'$(H*C/%(B")
+("pu"	"$AMM0|3@;P$(GUPWp$AMo?.;EcB$(H#z#|%W&c&n'M.1$Ac($(H/-5;@6BrPDPFW'(B")
+("pv"	"$AC&:^$(GZDZG$Ac/$(G_;x5$(H&`/$2{;e;o;rJ6W)a\hv(B")
+("pw"	"$A5iYk$(G_6$(H&e*F;dBl(B")
+("px"	"$(HBs\n(B")
+("py"	"$A;Zbmc-(B")
+("q"	"$AJV(B")
+("qa"	"$AEDV84:4k?+Lf_!$(H$.5p<*C+C.JAJKJTM(ac(B")
+("qb"	"$AG`IS26>h$(GZaZe$A4'$(G_S$A8c$(Gd8$AU*qnG\$(Gpkzm$(H$4&v&}*d$AM1$(H5Z$A^g$(H5`5d;y<(<6$A^w$(HC,C2C8JBP]P`Pb$Aqp$(H\ta](B")
+("qc"	"$A0G90$(G]Jd4$AW+$(GvDvJ$(H/G5O5[5fC(C-$A^v$(HJOPYP^UMUe\smQ(B")
+("qd"	"$AqgMO@&GXL=$(GZgZh$A^dH`2k2Y$(Gr{$(H"C"F*X$Aqh$(H/6/>/N/o5h$A^i$(H<.C?$A^z$(HJZQ-W7a_hw(B")
+("qe"	"$A<<0bM6E{L)JZT.0aKQ$(Gm!$A4i$(GslvF$A>p$(H$//7/C0A5T$A6^$(H5cJPk}(B")
+("qf"	"$AKXBS^`$(G_A$A>>^}AC$(Gm(m)$A2A$(H$-*f5P6~;}>xC/C9CAJHJI$A^{$(HV0abhHo+$A_,tn(B")
+("qg"	"$AE$VtK)9RM&4l^_MFNU4]W2$(Gp_$A_*$(G{a$(H*Z*g/D/I<-<4C$GHP\$A_+$(HmN(B")
+("qh"	"$A3-0g9U$(G_Rh|$(H&y/L$Aqi$(HJLJY(B")
+("qi"	"$AURD4A`3V6>TE2+I&rX_$qq$(Gyp$A4@$(H"J"K$+&u$A^T^[$(H?{JEPWP[W3\up7(B")
+("qj"	"$A7a66D(Ej:45tR>$(G_L$AK$$(Gm,oFpevGzl$(H"D$AG$$(H*e/E/M5N$A^c$(H<0C)JQJXP_$A_((B")
+("qk"	"$A>q$(GJP$A0NFuW`0$R4^f^qWa$(G_P$AF237C~Hv$(GvI$(H"I$5&~*V/F/J;~$A^~$(HW2W4W9\v(B")
+("ql"	"$AU[RV0nQ:E2K:$(GvE$(H$8%*$A^S$(H*W/;9s$A^^$(HJFW8$A_)$(Hcv(B")
+("qm"	"$A?8365VJCU|Dseg?X474j$(Ghx$AIC$(H&t&{/H5R5S5a$A^o$(H;{$A^y$(HC3C;hy(B")
+("qn"	"$A4r?9Jc7wMZ0F$(GZcsg$(H"H$7*_$A^Y$(H5V;z;|$A^m$(HeO(B")
+("qo"	"$A7r7vW%Lt$(GUW$AW==]OFLa$(Gl{m-pcph$A5e$(Gsi$(H$0&w'!5b$A^r$(HJJJS$Au=>o$(H\xhz(B")
+("qp"	"$AMPEzCrW'Dm;[:3$(GvHx9$(H$1&z*b$Am"$(H55$A^]$(H5g<1Bk$A^t$(HJCJRPBa^eMmP(B")
+("qq"	"$A7n0hj|Eu$(Gl}pa$(H;v$Aj~$(H<&$Ak!$(HPa(B")
+("qr"	"$A?[UPMXDi>PL'^W@(J0U\Nf$(GZo$AqjLB4n$(Gd5$AJD$(Gpjsj$(H*]*^$Am9$(H/9$A^\$(H/A$A^e5`^a>]$(H8D8E<3>RC'C:JG$AAL$(HPc(B")
+("qs"	"$AHS>\$(GMa$A^V?=$(Gc=d+l|pd$(H!^$A?f$(H*\8CC#F8JD$AEU(B")
+("qt"	"$A@-^UF48{^p$(H&s<+C&C*C5PZeR(B")
+("qu"	"$ATz0Q6sW>1'Ml0R:D$(GZV$A>rQZLM$(G]=d6d7m"$AGK$(G{V|9|_$(H"E"L$*$,$AHE$(H$3$6&r/5$A^Z$(H/@/K5K5\<'<5C7$A^u$(HJVJWO&UY(B")
+("qv"	"$A1m04Uq=S=R$(Ghv$AHA$(H*[*a*c/?5_5e$A^k$(H<$<2$A^x$(HG>I[W0$A_'$(HW6^Ta`aaeNeQhxk[$A_-(B")
+("qw"	"$A3iCh2%$(Gp`$A@^$(Gyo$(H<!</$A4$(B")
+("qx"	"$At)2e$(Gsf$AF~$(HC6(B")
+("qy"	"$AFK2p$(GZb$AEE$(H$)/BmO(B")
+("r"	"$A?Z(B")
+("ra"	"$AE>3*JH`PL$$(GsGv<$A3y$(H)P3}$A`3`.$(H:WCI$A`a$(HOeTcVNZi\Rcbci$A2d$(Hq?(B")
+("rb"	"$A5u$(GIQ$AIZ`!28_q?PLd4-`0`V30Wl`_Lcu_`i$(GwE$A1D$(H$u$A_F$(H%d%l3|$A`/$(HAoAs$A`C`JS;$(HNEOcOoTn$Auaud`c$(H_icccjg@lD(B")
+("rc"	"$AV;0H:eE?$(GT^$AYc$(Gfx$ABo$(Gh1l;o8p@sIwHwo{x$(H%e$A_j$(H.<4*ApAt$A`A$(HAyI;OhOiOnTd_faJcgeAg>kSmGq_(B")
+("rd"	"$ASu4tN6:t_d_]Ox`)I$6e$(Gg"$AuW2HTkueTj$(G|4$(H"%)D.A.I3+3w4-AzA|A}I:NBTj$Au^$(Hn/(B")
+("re"	"$AN|V(_NKt`(uK$(GpE$Aub$(H.:$A`#$(H9Z$AuA$(H:L$A`D`2$(HCBNG$A`\$(HTeTgTl\P\QaFaHg=$Aus$(Hqyr.(B")
+("rf"	"$A`"`1`B$(GcCcJ$A`<$(Gkx$A`Z:Y`d$(Gx%x,|z$(H#=#?:O:VI/$A`Q`R$(HOmZs\2$A`j$(Hcdk5nrou(B")
+("rg"	"$AMB3JM[A(N(`8`,u`$(Gv#{0{[};$(H#>)?$A_r$(H.H4,:X@W$AuM$(HGqGvI8TbTkVG\UaGckkRkT$Aup$(Hq@(B")
+("rh"	"$A_67TNG33Q=$(Gh4$AL_$(H%[.3.9:M@_NKVKZo(B")
+("ri"	"$(GGU$A_:8@E6$(G^O$A`Mj+8B$(Gl>o9p]$A6W=@un$(Gze{/{Y|]$(H#8$A_>$(H%\%m$A_J$(H.D$Au@uF$(HA~GpO_OgVLclhlmEn,(B")
+("rj"	"$AF!`+$(G^L$A`F$(Gh5l7wIzd})$(H#@%i)=)I.C$A_}$(H4#4)<?I9I<OjOlT_$AuV$(H\Tch(B")
+("rk"	"$(GIF$A7MR'0%QJ_^?^0&_l`&$(G^P$A:m$(G^V$A0OPauS`U`;`^uh$(GxKyd$(H#9#<)G*i9[I2OdVJVMj&(B")
+("rl"	"$A_5=PL}Ik_HDD_s[+$(GYJ$A6u`=1IK;$(G{w$(H#E$A_n$(H3=$A`%$(H:Z:]H.PhU"[#[$(B")
+("rm"	"$A5pE^>W$(GY<$AV:PzT{MY`5NK$(Gl8$AucL#$(H#C%]%c%k%n)<4$@^I1I6Zme>n1(B")
+("rn"	"$A6#3T$(GI1$A?TRwVd_W_V:_@.Sw$(GsF$(H#0%^%`$A6_$(H.G3*$A`'`G$(HGnGuI4OZZr(B")
+("ro"	"$(GIB$A45Wc_I?HWDuC`95xLxKT$(Gh,$A`[`eJI:?Lg$(GwG$Aukuj$(H)C.5.>.B$A`$$(H3{4+NANJ$A`Y$(HTaVOVPZncmj%(B")
+("rp"	"$A_3Cq_8DX$(GYF$AuI`Em*`f$(Gx-$(H#:%j)M$A_Z$(H@[GrGs$AuU$(HObTmceoT(B")
+("rq"	"$A_c$(GzI$(H#A)E$A_h_t$(H:^@VVHg<lE(B")
+("rr"	"$(GIH$A:G?'9>F79~?)Qd_m0!_z?&:0uLKC$(GcM$AB7$(Gh+k9$AN{uX>aFw$(Gzf$(H%a%f%h$A_R$(H)A)F.@.F$AI6_v$(H:_@X$AuEuJ$(H@]Ar$A`*$(HGwI7L:$Au[uZ$(HTf_jaI(B")
+("rs"	"$AAm_7U&$(G^:$A>`?g$(Gl1rM$(H%b$A_O$(H)LB&(B")
+("rt"	"$A@2uG`>R-5E$(H#B.4$AuB$(H:Y@Y$A`I$(HB!Gm\N\Se?(B")
+("ru"	"$AKHPV0I_@K1:pRX_MEXT[_{;#E\$(Gf@$A9r$(Go?y,$Aum6V$(H.=3y3~4"4%9]:K:[;IB#B'$AuP$(HHu$A`W$(HL0N@O^OaT\]9aKe<n.p3qT(B")
+("rv"	"$A:HN98z$(Gh.pC$A8AHB$(Gyc$AwR_g$(H.E$A_~$(H:Q:\$AuT$(HT^TiVIZk_ggGmF$Auq$(HpR$A`l$(Hq>(B")
+("rw"	"$A_S$(Gp=$(H.6$A_w$(HGyZj_h$Aul$(HpT(B")
+("rx"	"$(GYMl=$A58$(G{1$(H:P\Mcfe@(B")
+("ry"	"$A_K7H`K$(H4(@aNF(B")
+("s"	"$AJ,(B")
+("sa"	"$AM@$(G\dlRw*$(HO<h0julgnHnRod(B")
+("sb"	"$ATQVcP<XR$(GaM$AwW1[MN$(GyRyS|&$(H)y$Aqu$(HVwYP`l`qaNdgh2lpnLr3(B")
+("sc"	"$AF%ek$(Gh$o0oxs&$ARm$(G{}|)|v}8$(H&:Uc[P[ebhc^cadYj_jvjwp6paq|(B")
+("sd"	"$AJ:$(GU"$Aen$(Ggi$Ai^$(H!M<hP*$Aw[$(H`nd\f8h#nKr%(B")
+("se"	"$ADrH!el$(Gc&$A5nBD$(GmHv,$(H8=O>PeS!V!`id]h'h*jllq(B")
+("sf"	"$A9"$(GXk$ANu$(Gj;$AlYWW$(GzX{E{G|/$(H6r=bHrM'OKV:XD^La4aOd~e(fAgchNhOk/ngnpnqp'psqNqer;(B")
+("sg"	"$A?o$(GM#$AN]$(GYRc>e{$A5T$(Gow$A1Z$(HJbVX[p[t`rd`gfh,hjo`r2(B")
+("sh"	"$A56E|$(H"!2($AwT$(H8AUoUyU~`hdfljlr(B")
+("si"	"$AHPN>qv$(G^r$AB>$(Go}$A4Ah5$(GwzzWzh$(H2+HlMwUvXN_9gvj`jn(B")
+("sj"	"$A6z1Y4d$(Gw+|R$(H.l?*HjI,S"Up[n[o[z^R`d`k`tjhlhlmnInMnO(B")
+("sk"	"$AR|8D$(Ggjkroyp!$(H8@:(O;OAR}S&[m[q`oh%jjlonP(B")
+("sl"	"$A=33<O;DGI[R.?$AD[1$(Ggk$A[8$(H"u#52)9m?+?7NUO@T~^\`gp~(B")
+("sm"	"$A5sSpth$(H,q8FM)M*UrUsU|YSjplfnNoa(B")
+("sn"	"$AK"$(GqH$Aej$(H""%P$Aqt$(H2,3m3rS%`s$Aj6$(Hh!h/h1i_(B")
+("so"	"$A3_$(GO:$A>[$(GmDs-|S|u$(H8>A?F7$Aeo$(HS$[raudZh&h(j'(B")
+("sp"	"$ADaF(<IHL$(GPoUD$Am+N?$(Gov$AwZ$(Gty{o}G$(HHk\kd[jkli(B")
+("sq"	"$AO,H:KAk"eq$(H;uQ|h$nG(B")
+("sr"	"$AUYK>XO>}>V>SDd$(GY4$Aqx$(Go|s/$AwY$(Gu'ww$AF)$(G{D$(H%X$Aem$(H8??,EXUuUwUx$AwX$(H[u[{`jdadbfJh)h+(B")
+("ss"	"$A>^$(GL4$AF8$(Gv+$A[?$(H8HOCUq(B")
+("st"	"$AFAt`$(GYt$ARn$(Giqo(s.tz||}7$ARl$(H8<HmVE`fb@(B")
+("su"	"$A<:RQ0<N2YnG|5"wUwV$(G{*|'$(H$s0!0$@8O=ODR~UNV"[s`md_$Aw\$(Hjmqnr$(B")
+("sv"	"$(GO[$AU9H"$(GhXsTuE$AtEw`$(H",)64qBMI]M%$AfT$(HZC`eh"h-jiob$Aw_$(Hr#r&(B")
+("sw"	"$(GwP$(H&;Ut[}jo(B")
+("sx"	"$(HnJ(B")
+("sy"	"$A7K$(GYu$(Hd^(B")
+("t"	"$AX%(B")
+("ta"	"$ANt\w2\FUVxD:^#Jm=e$(Gxp$A]E$(HF{F}G$$A]i$(H^|`Kf[mu(B")
+("tb"	"$A\@\[K7FNFZ]<CH$(Ge\$A5Y:yFOD;]o$(Gj^$AFQGJE:\G$(H-A.#2@8j8m8z?d?e$Ami$(HFqFt$A]t$(HMBMCMJMOS7SISOS]YeYkYqYvYw[`^`^t$A^8$(Hc%fU$Amk$(Hi]ihl.mw(B")
+("tc"	"$A92$(GKd$AFd5d<f$(Gc'z6}D$A]=$(H?cFoM9$A]s$(HS9UbYiYlYoY~^d^e^f$A^.$(H^lbdbvfWfYgrigj]oCp_q}(B")
+("td"	"$ASsD3<v2h\o])]1f\$(G_~$A>z>U2K$(GdFf4$A]aiQ>Ow7$(Gxo$ADuTe$(Gz7{!$(H$~2L$A]3$(H8u?X?oFRF|$AiC$(HM4$A]h$(HMHO,STS\$A^!$(HYtdKl"l&(B")
+("te"	"$A\O\A2$Ab]D]J]gB{$(Gn`$A^)$(Gv;$ALYYg\8$(H(d2%878`8s8v?M?P$A]U$(H?\E<$AtH$(HFjFsG%G'HbMKMYMZO/$A^"$(HS:SZSdY{Z"^g^q^u_#fT$A^<$(Hf`ilk|o](B")
+("tf"	"$(GOI$A8a]6<eKbUt$(Gjf$AUa2LQ`=6$(Gr($A^9$(Gu5wiyZ{F$AU:$(G|Q}6}I$(H(b-??JFTFZFl$Atk$(HMEMV$AtJDh$(HSDSNSVS[YOYxY|Z$a&a*bpbwc"c#eufVh=ink1k:k>$A^@$(Hm"m#nhoDo^opo{o}p"q4qO(B")
+("tg"	"$A\s\u;yP_$(G\}$AK\6-D9P,^7$(GyEz4|F$A\6\]$(H2<2D$A2g$(H8o$A\p$(H8t$A]H$(HAJFrM;SJSYYfZ#^w$A^3$(Ha:byb~d=$A^=$(Hl%mvmxo?q5(B")
+("th"	"$AQ?7RC)C/<tI/$(Gr$$(H"l$A\L$(H-/2&8e?_MR$A^$$(HSaYu\B^j^nr5(B")
+("ti"	"$AIV\?\_$(GW{$AAgWp]Kj,$(GexhWjh$AN5$(GnW$ACo$(GnZ$A1!$(Gx`xk$(H!D%"$A\9$(H%T(e$A\^$(H-@-D2M$A<k]-]?$(H?b@!AP$A]W$(HFxM:MA$A]j$(HMIO*SASCSFSRYhYn$A^*$(H^s$A^6$(H_!btb}c:fRfnfol3l^my$AnC$(Hq~(B")
+("tj"	"$AX&\T8oHW2]]7]MF<$(Ga^$AUe$(Gf.nU$AEn^&^5Q&\7F;$(H2:2>8w?&$A]I$(HANFc$A]]$(HF~H#J\MWO(S>SWW=Yr`LfQii(B")
+("tk"	"$A0,C@S"RpD*5lI">4i`?{w11N^11^8~$(Gxl$(H(R(W(X(]$A\X\z$(H2I$A\r]C$(HFPG&$A]p$(HMLMX$A]}$(HS@^y^{$Amj$(Hb{fel-(B")
+("tl"	"$AG[=f\bK9[4$(GoQr]$AP=:*$(H-X2T2V<A$A]>$(H@~$A=y$(HHaNVPiS8SGS`$A[7$(HY}^o_pgHgIikjXlJ(B")
+("tm"	"$A8J\F1=Gu2n$(G\y$AOh]f]nw0$(Gu.w0xf|#$(H(f$A\Z\V\|$(H2?$A]@tF$(H8a?j$A]O$(H?H?O?iF4FkFmFwM<MGMMO-$Ate$(HS?SLSQSU$A^(^/$(H`I$AYe$(Hijl'o@pJ(B")
+("tn"	"$AG0$(GS5Wt$AF?@r$(GhB$A]y$(Gu4$(H"k$A\4\:$(H(S(Y(\$A\K$(H-3.+$A\h$(H2B2K$A\t$(H888:8}:1?'?Q?V?s$A]c$(HFUFdFfHc$AXa$(HR|Ygbnbub|fSfa$A^?$(Hl)(B")
+("to"	"$AV%\=4D$(G\x$AF[$(Gab$A]T]G$(Gey$AG8CI$(GmE$A^'$(GzF{c$A\M$(H,o-9$A\S$(H-<298d8f$A](O[$(H?D?L?mD"MSMU$A]x$(HSK$A]{$(HS_Se_$bqbrbxdFfGfX$A^>$(HpSq3(B")
+("tp"	"$A;(P>m&9'4HHGQ%D=$(Gn^$AHo^%^0$(H${$A\E$(H-2$A\e$(H2=$A\k$(H8^8i;`?Y?t$A]_$(HG"J)$A1M$(HMTS<Yp\j\l$A^2$(H^caTf\f^fcidl$o((B")
+("tq"	"$AQr$(Gf2$AD!Gf$(G{#|"$(H/32X?KFuMQO'Ys^m^z_"bodEfb(B")
+("tr"	"$A?A?`GQHtL&96\nHc\x\l:IIFFP]QBd$(Gf8$AHX]m$(Gji$AD">/$(H)B$A\fI;\m$(H2J2O2Q8g8h$A:J9=]P$(H?lFOFWF_FnM6M8MFO+RzSHTHUZU\^r^x`M$Aw6$(HfZfdglifl#q6$(IC7(B")
+("ts"	"$A7<\D@s@U?1],D<GZ]`tK2X$(Gya$A\5$(H-;-F2C8r8y8{8|?kFYFaFhFpG#$A]r$(HO0O\SP(B")
+("tt"	"$A>.2"RfC'Ta$(Gjajdw1z5z8$(H!N-.2S8b?N?rFNG(GZO)^a`JbzdLmt(B")
+("tu"	"$AG<0EOo76WB\YT70zJW;D]8$(G]'a`$ALQ]b0PJ_Cj$(Gw<|s}($A\;\>$(H(U([$A\R\{$(H2F8]8n?@$A]R$(H?G?I?]?qAOF3$A]Y$(HFbFeFyO.S5SSSc$A^+$(HYjZ!$Aw4$(H^v_HavioqYr-(B")
+("tv"	"$AC"=*IuC#]BN.$(Gam$A8p$(Gg)$AKrtI00$(Goru)z2$A]"$(H2R$A]9]4$(H?F?[FXF\$A]X]Z$(HFv$A]e$(HG!$A]u$(HS;SXU[Yy^kbsc!dGjYl!l*oAoE(B")
+("tw"	"$AGzCgPn$(Gn\$A^,@Y$(Gu/$A7*$(G{"$(H-7$A\g$(H8c?g?n?pFSF[SfYzbef]l+(B")
+("tx"	"$(Gr'w.w5$A]L(B")
+("ty"	"$A].]N7F$(H$y-ESb$A^B(B")
+("u"	"$AI=(B")
+("ua"	"$(H&K$Aa>$(H5#IkItP.P3(B")
+("ub"	"$AGM1@$(GZ!$AaEaT$(H*..n4y;E;NIjP2d>d?kW(B")
+("uc"	"$(GsUsVwp{]$(H&=5';PIvgumL(B")
+("ud"	"$(GY{sX$AaF$(H;HBVBWVoi&mn(B")
+("ue"	"$Aa*a'>~$(H#c&J4z;F(B")
+("uf"	"$AL?Kn3g$(HBZP1P5(B")
+("ug"	"$AQB4^$(H)|*#;R;TIoIpkXq-(B")
+("uh"	"$AX0a,$(H#d;>;CIlIr(B")
+("ui"	"$AVESD6kr?aB$(G^uyk$AN!$(H"8$AAkaQ$(H;S$AaM$(HIqIuP-VhVsaPgwhqm~(B")
+("uj"	"$A067e$(H.r4x5"5%;LH$$AaV$(HVkVr(B")
+("uk"	"$APW$(GsW|5$(H#g&CJ[Kpo%(B")
+("ul"	"$(GS%hY$Aex$(H#h#i$Aa5$(H**$A[:$(HlK(B")
+("um"	"$AaGaO$(H&@&A){Is(B")
+("un"	"$ARYa/$(G^3^5$(H#e&G*!*(3n;G;K;OAm(B")
+("uo"	"$(GU0U6$AG6$(GlU$AaY$(H)z4}4~;QC~InP4Vn$AaZ(B")
+("up"	"$Aa:$(GY|$(H&<*)$A[KaLaS$(HeI(B")
+("uq"	"$(H;M$AaW$(HVm(B")
+("ur"	"$AQRa<SxFi$(GhZ$Aa2a8a3$(H&H*$*%*+*,.o.p4|$AaD$(H;UBSBTB\hp(B")
+("us"	"$(H!W&>&I&L*/;BIiP,Vq(B")
+("ut"	"$(GX?$AaX$(GwB}C$Aa)$(H&M(B")
+("uu"	"$A3v$(GG=U7$AaH$(GZ$uF|l$(H"6$Aa($(H"9"j#a)}*"--$AaCaR$(H?AP/(B")
+("uv"	"$AaK$(H*'*-.s5&;@;DImViVjmK(B")
+("uw"	"$Aa6$(H4{5$;=B[P0(B")
+("uy"	"$(HVl(B")
+("v"	"$AE.(B")
+("va"	"$Af=;i$(Ga@jEqotcv~w%xc{@$(H4f;+>{P$Rpo.(B")
+("vb"	"$A`{>j$(GWJYa$APvfE$(Geo$A5UfO$(GjAjClLn7n>qmth$(H#T&*)o)s*5$Af:$(H4p:~;";,;1F$F'I_LmM"O~RqY?\Z\^^=b]b`iYkUpG(B")
+("vc"	"$AOS$(GqiqnsPtdtsz*z}}>$(H4V4k;0B:P%P'VdY@b^eGkukwq/(B")
+("vd"	"$A:CK}CC$(GR}$A32C=$(GcpepjBlIm?m@tl{\$(H&2$Af[f-$(H4Y4m8/:y;#;*>}BGF!F-IXLiLqVeYHYIf<o0(B")
+("ve"	"$AE+<K$(GWH$AfBI)$(Gj9j:j<jGmIn@nAnBtq$(H&U4W4e4j;.F"F#IWI`LpRwV^^HbckVkx(B")
+("vf"	"$Ati$(GK$Lr$APu$(Ga=cd$AfNfPfL$(Gj7lKn8oztgtow#|Z}J$(H1t4`4b4d6|:wB;BHI^LkM!O}P!Y>YJ\7^Ga3eHf?hVi[k7m2(B")
+("vg"	"$(GIg$Af$HQM^$(GPa$Af2$(GWFaAjDz|$(H&%)u.c1s4\4g8);2>r>~F%IORxVf\[\a^EdAkyq1(B")
+("vh"	"$ACnf"f7$(GW@WLnEtetr$(H#W&-.b81:}E|F(IVLt(B")
+("vi"	"$AeyD7c^$(GRwRzR|$A6p$(GWIYr\R^}qksQtpz+$As;$(G|C}'$(H#S#X&,&3,l1v4i8*85$AfJ$(HBBBFITY<\`^@_:bYc9p5qv(B")
+("vj"	"$A<if>$(Ga9j8lJn=nDtixa$(H"1#R&&)f1{4U4[4l;-BJ$AfQ$(HLjLzO|P(RkY9^?^C^Mb_(B")
+("vk"	"$AJUQ}$(GNm$Af/Rv^J$(GTvWA\^a7$A<5D[$(Gmdn:xd|H$(H#Y&(,m.\._1u84;'>uB=E}$AfF$(HL{RlRtRuV`^Bb[eFmHo$(B")
+("vl"	"$(GO+$ADH<'$(G\YbTeqn<vK$A[I$(H#V#[&1'#,k.a1w1z:x>zE~NY(B")
+("vm"	"$A=cPU$(GRx\ZennC|B$Ac]$(H!C".&'$Af'$(H&.)e.]4X8+83;&;)B<LrLyO{Rm$AfS$(HV_Y8b\f:ho(B")
+("vn"	"$Af%esRL$(GR{TL\V$AfC=K$(G{_$Af!$(H(I)k.f1x1y8';%;(?!Rv\]aMn~(B")
+("vo"	"$ARTf&R&<^$(Gj5n?nFtk$Aeh$(H.^$Af<$(H4a8.:|>o>p>|IaIbLnVaXV^>^D^If;i\q2(B")
+("vp"	"$Ae~D]@QE-K!$(GWGWK$AO1fG$(Gtj|6$(H"-4o8($Aei$(H>vIULsRsVcbZf9mIq.(B")
+("vq"	"$(GLt\QaBn9tn|7$(H)q*U/40`bbf@fB(B")
+("vr"	"$AHg9CJ<f9$(G\U^ja8a>a?hIj6j?j@$AfR$(Gn;v=w!{y$(H&+&0)c)d)l)m)p)r)t+w.`1B4Q4Z4^4c4h8,8082;!>tBEF)F,IcKkLxP#RrYDYFiZ(B")
+("vs"	"$A;CDLSWE,6J7Af3$(GW?c:$(H&/)gISYG(B")
+("vt"	"$Ae{$(GLm$Af0$(G\]ceqhvA$(H;$>qE=P&YA\_iBmo(B")
+("vu"	"$Aez$(GRy$Af8Cd$(GWE$Ag_Mq$(G\S\W$ACD$(Ga:j>lMqpw"xb$AfW$(G{^}9$(H"0#Z)i)j.d1r1|4R4_:{>sB?BAF&F+LlLwL~RoY;pB(B")
+("vv"	"$(GIiPc$ADoIof;$(GerfRj=pNtfyh{C|A$(H"/)n.e4nBILoLvV]Y:f=f>mJo=(B")
+("vw"	"$Af($(G\XjF$Ag\$(Gt;v@w&wQ$Ag^$(H8-;/BLP)RnV\(B")
+("vx"	"$(Gw$$(HBKYB(B")
+("vy"	"$(G\\$(HLu(B")
+("w"	"$ALo(B")
+("wa"	"$AJpwvn@(B")
+("wb"	"$A`sN8FT$(H#H$A`u$(H4/:`?$fE(B")
+("wc"	"$AKD$(G\,]Kb9cQv(}B$(HOpdTnu(B")
+("wd"	"$A`n@'9{$(H%p?%F0YNe_qZ(B")
+("we"	"$An2$(H1%<:>1E"E+F2\z(B")
+("wf"	"$A@[:Z$(GnGs9|e$An7$(HfF$Awt$(HkznsovpHpoppql(B")
+("wg"	"$A@oFhJ{D+n>$(Gv?xe$(H1}86K~^Om9o!(B")
+("wh"	"$A`qn3$(H2!p&(B")
+("wi"	"$AD8X.Jq$(Gh6xP$A`r$(H7?YL(B")
+("wj"	"$ANc`v$(G\+eH$AUV$(H!@VRYM(B")
+("wk"	"$ARrn0n1D,$(H\yaL(B")
+("wl"	"$A<W$(GNw$A=gn/(B")
+("wm"	"$(GYO$AVC$(G{h$(H,<$An8$(H2#F.a;fI(B")
+("wn"	"$AR0b7$(GjH$AG-$(H#I$An.$(H^Q$Awp(B")
+("wo"	"$AGt$(G\8s|$(H.K/y2$(B")
+("wp"	"$AK<E~6wS^$(GnH$(H#G+K2"J+M#V<(B")
+("wq"	"$AEO$(G^X$(H]_(B")
+("wr"	"$A;X9L`tn9BT;{$(Gv5$Awo$(H.J$An:$(HiKmqqS(B")
+("ws"	"$ADPwnfU(B")
+("wt"	"$(HB(m;(B")
+("wu"	"$A6ZH&wm$(HE!$An5n;$(H\@\AkCkEk{(B")
+("wv"	"$AN7$(GcP$A`o$(H(2@4RE$A`w$(Hm:(B")
+("ww"	"$(Gh7$(HR6Ry(B")
+("wy"	"$AWo$(HF/(B")
+("y"	"$A27(B")
+("ya"	"$AFHRt$(Gfaffnz$ATb$(Gr=rDx{x|$(H31TDTMcJcKeUg(p0(B")
+("yb"	"$AJPkAS}?O5[$(GPv]A$AePM(Sv1i>86K8`kv$(Gk!k.k/$Ae\$(GnPnyo"oKr7rAuJuewAwMy!}!$Al7$(H35$A@keM$(HCCCDGV$AeW$(HRYTxZQZWZ[Z}[w_LcEcFg*g,pz(B")
+("yc"	"$AAyR`$(GSV$AJv$(Gft$AFl$(GrYr\s"uIwmyJ{t|$|3|m}-}4$(H@>GaH(HdM[O"T>U`Ua[Q_[cTg)g5h{j"kJm@nBoSqW(B")
+("yd"	"$(GJb$ASX$(GKS$AOmJ)eFW@2q$(GX=X>$ACT$(G[9$AM>$(Gebfdg+nwn{o#r;r<uGzB$(H*k9!Ej$AtS$(HGRN7TJ_QcMnz(B")
+("ye"	"$AJeFg75$(G]C$A?"$(Gb"b.$A4~eZGC$(GkF$ARc$(GrF{,$(H*h+I/O$AeOeReV$(HK1T=TBVFX`_N_R_Sb?cNiRj#j.n'o_p/(B")
+("yf"	"$A>)NIEkeQWO$(Gf`kA$AJl$(Gnunv$AUZ$(Gr9r[v:y$yX}:$(H7eHqV/\0\|_Z`~a%cScUe5g+hFhQk(k-mCnloNozpkplpnqsr'r((B")
+("yg"	"$AVwM{3Q9dM/$(Gb!$AeS$(GbPfg$AeXS:[S$(Gk-$A4F$(Go!$A[Ue_[V$(Gwbwcwkx/|J|~$(H(m$Au~$(HGLGMTwZNZ\q=(B")
+("yh"	"$A2=$(GP}$A1k$(G]?b,dY$AUC$(Gr8w@$AeB$(H,(8~9N9eH&_%hgpy(B")
+("yi"	"$AP~$(GV\X6$AJk$(G]D^%$AR]$(Gf]klpRrB$AWq$(GsauMy"z>za|j$(H,b/|3!5j>a@DBxT?T@Z&g#l=m}(B")
+("yj"	"$A67PAQ8WdW?$(GSSX5X9$ABJ$(G]B]Y$A7jUB$(Gb#g*o$$A1f$(GrV$A1\0j$(Gxzx~z)zA{3{n|t$AeC$(H@sTGTzZMZPZZ[d_McIg-hkq<(B")
+("yk"	"$AND=;R97E^HP'r/KMWe$(G]@$A6XS]$(Gflk(m.$Ae[Q{$(Gw>yx$(H(p(r9O<<@?N5PfT{_OdQg$g&kMqw(B")
+("yl"	"$AS-=|=<$(GX;]F$AKYJE2?9yPB$(Gg:$A@1Zx$(H%'$AZz$(H/T$Aq5$(HGKH*$A[5$(Hhhhi(B")
+("ym"	"$AIOV9P)E0$(GX7$Al:$(G\(]]apb%b(b*f\$Ae]$(Gntnxw?z_|k$ASkq41s$(H@IAXD~E)GNN3ZLZRZV[c_Y_ncLfHizl>m7mDn%o-oQp.(B")
+("yn"	"$A?::`Fy?LM$$(GST$AFJ$(GX<](c7$ASb$(Gl*p8$AYx$(GrCvh$AYz$(GzD$(H'$(l,93.32D{GTO[XUcVe6$AYy$(Hklk~pq(B")
+("yo"	"$A:%5|$(GVd$ALSP}Vp$(GfZ$AKl$(Gk$$A:@$(Go&p/$AeaedH?$(G|2|{$(H/w6;<B?.@C$Al'$(HGQG]K+Q9TATKTyWjZT_oadZ(eTi~l<l?(B")
+("yp"	"$A4KM|C%Yq$(GX:$Al;$(G]E$ARb$(GfYk"k%les>{T|I$Ar.l~$(H&Y-U;a@GGON4TE$Am-$(HZUaAcPg'mAn*pOr*rD(B")
+("yq"	"$(G[tf[g.g0r:$Ae`$(GrZ$AebeL$(H@HW5(B")
+("yr"	"$AU<A_QTeHLveDeJU>$(GXO$AW7eK8_IL$(G]U$ATl`4$(Gb$b&b'b-bN$ARa$(Gf^fcfhfj$Av$$(Gg4$Al=$(Gk#k*$AG2IX$(Gn~r>r?y#zCz[z`{+|1$(H)J-W1`3/$AJJ$(H34$AmN$(H9h@@@A@E$AeU$(HGPGWH)ZO_TcHg/kIkKkpoPp1r6(B")
+("ys"	"$A7=[@ET$(G]>$AM8$(Gb)f?f_fbk,u6uHy1$AXU$(H%%$AeE$(H.09i@<@JO]ZS\KcGe:p{(B")
+("yt"	"$AA"^D1E6:$(Gk&qMuOx}$(H-K-M@=GULTZX[!_\ddhfkHqV(B")
+("yu"	"$A3dX@C$;"AA$(GP"X4X8$ADf:A>9>M6=$(Gfe$A5@6]n#$(Gk)kCkDoOr5t!uKuL$Aec$(Gz#$(H":%&(o$Al8$(H7S9L9M$Al<$(H@7@BGST8TCTLWrZ'Z|Z~_P_UfCf~g%i|kLp2qXrB(B")
+("yv"	"$AMvM}RBQ2f*0'BCK%VTMK$(G]5$AeTYv6t=_9|$(Gk?$A0}$(Gn|r@rE$A2M$(GuA$AOe$(Gud$Aee$(G{U{q|i$(H7/$AYs$(H9D9E@3G=N'N2N6T5TIUiZAZDZEcOi{i}$AwS$(IDN(B")
+("yw"	"$A5OPs$(GXN$A1Fe^$(Gzn$AeY$(HZYaeg.n&n)pP(B")
+("yx"	"$(Gk}n}(B")
+("yy"	"$A1e?(l6$(GSUb+k+o%$Al9(B")
+("z;" "$A#;$(G!2$A#,!"$(G!.!/(B")
+("z:" "$A#:$(G!+!3$A#.!#!$$(G!0!1(B")
+("z'" "$A!/!.(B")
+("z\"" "$A!1!0$(G!h!i$A!((B")
+("z\\" "$A#\$(G"b#M(B")
+("z|" "$(G!6!8!:$A#|(B")
+("z/" "$A#/$(G"a#L(B")
+("z?" "$A#?$(G!4(B")
+("z<" "$A!4#<$(G"A!T$A!O(B")
+("z>" "$A!5#>$(G"B!U(B")
+("z[" "$A!2!>$(G!b!H!L$A!8!:$(G!X!\(B")
+("z]" "$A!3!?$(G!c!I!M$A!9!;$(G!Y!](B")
+("z{" "$A#{$(G!`!D(B ")
+("z}" "$A#}$(G!a!E(B")
+("z`" "$A!d$(G!k(B")
+("z~" "$(G"D"+",!<!=(B")
+("z!" "$A#!$(G!5(B")
+("z@" "$A#@$(G"n(B")
+("z#" "$A##$(G"-(B")
+("z$" "$A!g$(G"l(B")
+("z%" "$A#%$(G"m(B")
+("z&" "$A#&$(G".(B")
+("z*" "$A#*$(G"/$A!y!n!o(B")
+("z(" "$A#($(G!^!@(B")
+("z)" "$A#)$(G!_!A(B")
+("z-" "$(G!7!9"#"$$A#-$(G"@(B")
+("z_" "$A#_$(G"&(B")
+("z=" "$A#=$(G"C(B")
+("z+" "$A#+$(G"?(B")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: iso-2022-cn-ext
+;; End:
+
+;;; quick-cns.el ends here
@@ -0,0 +1,12584 @@
+;; Quail package `chinese-b5-tsangchi'
+;;   Generated by the command `miscdic-convert'
+;;   Source dictionary file: cangjie-table.b5
+;;   Copyright notice of the source file
+;;------------------------------------------------------
+;; # Copyright 2001 Christian Wittern <wittern@iis.sinica.edu.tw>
+;; #
+;; # Permission to copy and distribute both modified and
+;; # unmodified versions is granted without royalty provided
+;; # this notice is preserved.
+;;------------------------------------------------------
+
+;;; Code:
+
+(require 'quail)
+(quail-define-package "chinese-b5-tsangchi" "Chinese-BIG5" "B" t
+"JiܾejBIG5
+
+	~yܾeJL
+
+   [Q ] [W ] [E ] [R f] [T ] [Y R] [U s] [I ] [O H] [P ]
+
+    [A ] [S r] [D ] [F ] [G g] [H ] [J Q] [L ]
+
+      [Z  ] [X ] [C ] [V k] [B ] [N }] [M @]
+
+\\<quail-translation-docstring>"
+  '(("." . quail-next-translation-block)
+   ("," . quail-prev-translation-block))
+  nil nil)
+
+(quail-define-rules
+("a"	"")
+("aa"	"")
+("aaa"	"")
+("aamh"	"z")
+("aaph"	"٦")
+("aapv"	"{")
+("aate"	"n")
+("aayf"	"")
+("ab"	"")
+("abac"	"\")
+("abbe"	"")
+("abbt"	"")
+("abhaf"	"q")
+("abik"	"m")
+("abjcm"	"")
+("abjj"	"uw")
+("abme"	"x")
+("abms"	"")
+("abof"	"")
+("abu"	"_")
+("abuu"	"ի")
+("acim"	"")
+("acnh"	"խ")
+("acsh"	"")
+("ad"	"X")
+("adhaf"	"p")
+("adhl"	"")
+("admq"	"")
+("adwf"	"")
+("aenl"	"o")
+("af"	"RY")
+("afbf"	"")
+("afdq"	"")
+("aff"	"٥")
+("afhhh"	"v")
+("afmbc"	"V")
+("afmu"	"")
+("afno"	"")
+("agbt"	"")
+("agdi"	"")
+("aggu"	"")
+("ahbr"	"")
+("ahbu"	"")
+("ahe"	"")
+("ahgf"	"")
+("ahhl"	"")
+("ahln"	"")
+("ahml"	"")
+("ahog"	"٤")
+("ahoo"	"")
+("ahor"	"")
+("ahqm"	"P")
+("ahqo"	"")
+("ahs"	"Q")
+("ahsk"	"")
+("aht"	"@")
+("ahvl"	"")
+("ahxu"	"٨")
+("aice"	"լ")
+("aihs"	"")
+("aijb"	"ժ")
+("aimvu"	"J")
+("aine"	"")
+("aisl"	"Y")
+("aitc"	"m")
+("aj"	"")
+("ajbj"	"")
+("ajd"	"N")
+("ajii"	"")
+("ajka"	"")
+("ajmm"	"y")
+("ajmu"	"թ")
+("ajnu"	"١")
+("ajv"	"")
+("ak"	"")
+("akcf"	"")
+("akkb"	"")
+("akll"	"")
+("aklu"	"٣")
+("akms"	"")
+("akn"	"")
+("albk"	"M")
+("alg"	"K")
+("alln"	"")
+("almo"	"")
+("alnc"	"")
+("am"	"")
+("amam"	"")
+("ambb"	"")
+("ambc"	"")
+("ambg"	"R")
+("ambi"	"")
+("amcw"	"")
+("amd"	"")
+("amg"	"")
+("amhaf"	"")
+("amhqu"	"k")
+("ami"	"u")
+("amig"	"")
+("amj"	"")
+("amk"	"")
+("amks"	"")
+("ammk"	"")
+("ammp"	"")
+("ammr"	"")
+("ammv"	"")
+("amo"	"")
+("amob"	"")
+("amsh"	"")
+("amtb"	"K")
+("amwg"	"q")
+("amwj"	"")
+("amyo"	"O")
+("an"	"")
+("ana"	"")
+("anaa"	"K")
+("anasm"	"l")
+("anau"	"ñ")
+("anayk"	"J")
+("anb"	"")
+("anbbe"	"L")
+("anbue"	"")
+("anbuk"	"")
+("ancru"	"\")
+("and"	"~")
+("andh"	"")
+("andmq"	"")
+("andwf"	"")
+("anehr"	"")
+("anf"	"e")
+("anfbg"	"x")
+("anfbw"	"m")
+("angg"	"")
+("angit"	"")
+("anhe"	"")
+("anher"	"")
+("anhpa"	"N")
+("anhqu"	"{")
+("anhud"	"n")
+("anhx"	"")
+("aniav"	"")
+("anirm"	"H")
+("anit"	"")
+("anjbc"	"")
+("anjka"	"G")
+("anki"	"")
+("anklu"	"I")
+("anlmc"	"F")
+("anlmi"	"")
+("anm"	"")
+("anmfj"	"")
+("anmg"	"|")
+("anmj"	"F")
+("anmjk"	"E")
+("anmmm"	"E")
+("anmnr"	"")
+("anmt"	"}")
+("anmwg"	"")
+("annhx"	"F")
+("annkg"	"")
+("annok"	"")
+("ano"	"{")
+("anog"	"M")
+("anoi"	"")
+("anok"	"")
+("anomm"	"G")
+("anomr"	"")
+("anp"	"e")
+("anph"	"")
+("anqou"	"w")
+("anr"	"")
+("anrhr"	"[")
+("anrrj"	"")
+("anrrr"	"")
+("ansj"	"D")
+("ansqf"	"")
+("ansrj"	"P")
+("antcu"	"")
+("antuo"	"")
+("anumt"	"m")
+("anvit"	"")
+("anwd"	"")
+("anwl"	"h")
+("anwlv"	"l")
+("anygq"	"k")
+("anyhn"	"z")
+("anyhs"	"y")
+("anyk"	"{")
+("anymr"	"")
+("anysy"	"F")
+("anyta"	"")
+("anyvo"	"")
+("aodmq"	"")
+("aofh"	"K")
+("aohaf"	"")
+("aoii"	"S")
+("aoin"	"")
+("aombc"	"D")
+("aop"	"")
+("aowy"	"")
+("aphh"	"")
+("api"	"")
+("apim"	"")
+("app"	"")
+("apr"	"")
+("apu"	"")
+("apvo"	"T")
+("aqka"	"")
+("aqmb"	"")
+("arf"	"ӷ")
+("armd"	"")
+("arrj"	"")
+("arrk"	"")
+("arye"	"v")
+("asf"	"q")
+("ashr"	"L")
+("asje"	"")
+("asmg"	"`")
+("asp"	"")
+("astr"	"")
+("atak"	"")
+("atbc"	"٧")
+("atbo"	"")
+("atce"	"")
+("atcr"	"")
+("atgs"	"f")
+("atlb"	"")
+("atlf"	"Q")
+("atlo"	"")
+("atmj"	"")
+("au"	"")
+("auam"	"[")
+("aug"	"ا")
+("auhqu"	"A")
+("auks"	"m")
+("aumt"	"")
+("aunl"	"S")
+("aunwf"	"p")
+("auu"	"")
+("av"	"")
+("avhaf"	"")
+("avhl"	"")
+("avhqu"	"")
+("avno"	"")
+("awla"	"")
+("awle"	"")
+("aybp"	"P")
+("aydk"	"")
+("ayhs"	"")
+("ayk"	"")
+("ayoj"	"٢")
+("ayrb"	"")
+("ayrf"	"")
+("ayrv"	"")
+("aysd"	"ݿ")
+("ayt"	"R")
+("ayta"	"t")
+("aytg"	"")
+("aytj"	"")
+("ayvi"	"")
+("b"	"")
+("bahm"	"{")
+("bamh"	"z")
+("bau"	"")
+("bayc"	"")
+("bb"	"B")
+("bbb"	"")
+("bbbr"	"ߢ")
+("bbbuu"	"")
+("bbdhe"	"")
+("bbdi"	"J")
+("bbe"	"")
+("bbggu"	"")
+("bbhaf"	"")
+("bbher"	"f")
+("bbhf"	"P")
+("bbhhj"	"")
+("bbhne"	"")
+("bbibi"	"f")
+("bbijc"	"")
+("bbjhr"	"")
+("bbjmc"	"")
+("bbjr"	"u")
+("bbjti"	"b")
+("bbkms"	"m")
+("bbkni"	"")
+("bbln"	"l")
+("bblwv"	"\")
+("bbmbc"	"")
+("bbmj"	"")
+("bbmlk"	"d")
+("bbmr"	"")
+("bbnd"	"K")
+("bbnq"	"")
+("bboll"	"")
+("bbpe"	"R")
+("bbr"	"J")
+("bbtmt"	"ż")
+("bbtqm"	"e")
+("bbtwt"	"")
+("bbu"	"")
+("bbug"	"E")
+("bbul"	"")
+("bbuu"	"V")
+("bbwd"	"N")
+("bbwli"	"")
+("bbyck"	"j")
+("bbyhn"	"")
+("bbykb"	"")
+("bbymp"	"l")
+("bbyrb"	"d")
+("bbytj"	"")
+("bbyvo"	"e")
+("bcabu"	"")
+("bcaph"	"")
+("bcbcc"	"S")
+("bcbcd"	"")
+("bcbgr"	"")
+("bcbjj"	"")
+("bcbuc"	"T")
+("bcbuu"	"y")
+("bccwa"	"")
+("bcdh"	"]")
+("bcff"	"")
+("bcgwc"	"ū")
+("bchaf"	"")
+("bche"	"c")
+("bcher"	"")
+("bchio"	"S")
+("bchpm"	"")
+("bchqm"	"")
+("bcibi"	"")
+("bcii"	"")
+("bciih"	"")
+("bcij"	"")
+("bcije"	"S")
+("bcikk"	"H")
+("bcims"	"B")
+("bcir"	"M")
+("bcj"	"ͮ")
+("bcjir"	"")
+("bcjka"	"")
+("bcjmn"	"J")
+("bckb"	"")
+("bcll"	"U")
+("bclmt"	"R")
+("bcln"	"h")
+("bcmj"	"u")
+("bcmmv"	"")
+("bcmpm"	"")
+("bcmvn"	"w")
+("bcmwj"	"J")
+("bcncr"	"ĺ")
+("bcnl"	"")
+("bcoju"	"Ģ")
+("bcok"	"")
+("bcomf"	"")
+("bcpd"	"")
+("bcqka"	"")
+("bcr"	"j")
+("bcrhu"	"")
+("bcrl"	"}")
+("bcru"	"")
+("bcrxu"	"x")
+("bcsmv"	"")
+("bctbc"	"")
+("bctct"	"")
+("bcttb"	"")
+("bctxc"	"")
+("bcv"	"")
+("bcyhn"	"")
+("bcymr"	"Q")
+("bcyoj"	"")
+("bcyr"	"K")
+("bcytr"	"")
+("bcyvo"	"")
+("bd"	"")
+("bdhhh"	"m")
+("bdi"	"y")
+("bdnl"	"")
+("bdoe"	"")
+("bdu"	"")
+("beee"	"M")
+("behaf"	"")
+("bf"	"")
+("bfbg"	"")
+("bfcb"	"")
+("bfd"	"")
+("bfdq"	"")
+("bfhvf"	"")
+("bfmu"	"")
+("bfp"	"a")
+("bfq"	"D")
+("bfqc"	"")
+("bfqe"	"")
+("bfqf"	"")
+("bfqg"	"")
+("bfqi"	"f")
+("bfqr"	"")
+("bfqs"	"")
+("bfqu"	"J")
+("bfqv"	"")
+("bfu"	"K")
+("bg"	"{")
+("bggu"	"")
+("bghqu"	"")
+("bgi"	"X")
+("bgr"	"P")
+("bgte"	"")
+("bgth"	"")
+("bha"	"c")
+("bhae"	"")
+("bhbue"	"")
+("bhbvk"	"")
+("bhdh"	"[")
+("bhdv"	"N")
+("bhdw"	"")
+("bher"	"")
+("bhgf"	"")
+("bhhau"	"")
+("bhher"	"")
+("bhhh"	"x")
+("bhhhj"	"")
+("bhhj"	"")
+("bhhv"	"")
+("bhhwp"	"")
+("bhjc"	"")
+("bhje"	"|")
+("bhjg"	"~")
+("bhjm"	"ߡ")
+("bhju"	"~")
+("bhlq"	"Y")
+("bhlwv"	"")
+("bhma"	"")
+("bhmam"	"X")
+("bhmj"	"")
+("bhml"	"ͯ")
+("bhn"	"")
+("bhne"	"")
+("bhob"	"")
+("bhod"	"Z")
+("bhomn"	"")
+("bhon"	"n")
+("bhpi"	"\")
+("bhpm"	"O")
+("bhqm"	"`")
+("bhqo"	"]")
+("bhrrj"	"G")
+("bhrye"	"")
+("bhs"	"_")
+("bhshr"	"I")
+("bhsrr"	"")
+("bhtak"	"")
+("bhtw"	"")
+("bhuc"	"")
+("bhumb"	"")
+("bhuu"	"")
+("bhvo"	"g")
+("bhwg"	"")
+("bhwp"	"")
+("bhx"	"")
+("bhxo"	"")
+("bibi"	"K")
+("bice"	"կO")
+("bijb"	"")
+("bije"	"G")
+("bikk"	"Z")
+("bioi"	"")
+("bipc"	"")
+("bipf"	"")
+("bir"	"L")
+("biypu"	"~")
+("bjb"	"")
+("bjbd"	"")
+("bjbj"	"v")
+("bjcg"	"")
+("bjcm"	"")
+("bjdhe"	"")
+("bje"	"")
+("bjhaf"	"y")
+("bjii"	"@")
+("bjlmi"	"")
+("bjmbc"	"")
+("bjmc"	"")
+("bjmu"	"E")
+("bjnl"	"P")
+("bjnu"	"")
+("bjtc"	"")
+("bjti"	"")
+("bjv"	"i")
+("bjwj"	"x")
+("bkcf"	"")
+("bkcor"	"")
+("bkf"	"M")
+("bkhaf"	"")
+("bki"	"")
+("bkk"	"I")
+("bklu"	"")
+("bkms"	"")
+("bkn"	"")
+("bkni"	"w")
+("bknl"	"V")
+("bkog"	"")
+("bkoo"	"F")
+("bks"	"")
+("blbk"	"f")
+("blln"	"W")
+("blmo"	"m")
+("blmy"	"")
+("bln"	"G")
+("blwl"	"[")
+("blwv"	"B")
+("blxh"	"d")
+("bm"	"BzI")
+("bmbb"	"}")
+("bmbg"	"")
+("bmbl"	"k")
+("bmfm"	"F")
+("bmig"	"l")
+("bmj"	"x")
+("bmke"	"")
+("bmks"	"U")
+("bmln"	"m")
+("bmmc"	"")
+("bmmo"	"")
+("bmmu"	"")
+("bmmv"	"")
+("bmog"	"")
+("bmr"	"P")
+("bmrb"	"J")
+("bmrt"	"")
+("bmrw"	"t")
+("bmso"	"b")
+("bmui"	"a")
+("bmvm"	"H")
+("bmwf"	"")
+("bmwv"	"y")
+("bn"	"ɩ")
+("bnau"	"N")
+("bncr"	"x")
+("bnd"	"")
+("bnii"	"C")
+("bnkg"	"M")
+("bnkq"	"x")
+("bnlii"	"F")
+("bnmu"	"")
+("bnui"	"")
+("boae"	"")
+("bob"	"Ͱ")
+("bobo"	"")
+("bodi"	"b")
+("bog"	"O")
+("bogf"	"")
+("bogs"	"")
+("bohh"	"e")
+("boin"	"ͭ")
+("boip"	"P")
+("boma"	"z")
+("bommf"	"")
+("bomn"	"}")
+("bomo"	"y")
+("bomrt"	"S")
+("bon"	"v")
+("boog"	"L")
+("bopd"	"^")
+("botf"	"")
+("bowy"	"Q")
+("bpa"	"")
+("bpr"	"a")
+("bpru"	"M")
+("bpu"	"")
+("bpuk"	"")
+("bq"	"")
+("bqkk"	"s")
+("bqmf"	"")
+("bqu"	"")
+("brc"	"Y")
+("brhaf"	"")
+("brhg"	"I")
+("brhhh"	"n")
+("bri"	"ѯ")
+("brog"	"J")
+("brrd"	"")
+("brsmm"	"{")
+("bsd"	"")
+("bsef"	"")
+("bshh"	"ˤ")
+("bshi"	"t")
+("bsjr"	"L")
+("bsle"	"A")
+("bsmg"	"w")
+("bsmh"	"")
+("bsmv"	"")
+("bss"	"Y")
+("bt"	"U")
+("bta"	"K")
+("btab"	"")
+("btak"	"")
+("btbc"	"")
+("btbo"	"a")
+("btct"	"")
+("btgr"	"")
+("btis"	"Ŧ")
+("btk"	"")
+("btlf"	"")
+("btlk"	"")
+("btln"	"R")
+("btmbc"	"Z")
+("btmd"	"u")
+("btoe"	"~")
+("btt"	"")
+("btu"	"")
+("btwv"	"w")
+("btyj"	"")
+("btyv"	"")
+("bu"	"")
+("buamj"	"ھ")
+("buamo"	"")
+("buana"	"}")
+("buank"	"")
+("buav"	"")
+("bubac"	"P")
+("bubbq"	"")
+("bubd"	"B")
+("bubgr"	"")
+("bubsd"	"C")
+("bubuk"	"")
+("bubuu"	"ڽF")
+("buc"	"")
+("buce"	"z")
+("bucim"	"")
+("bucms"	"")
+("bucnh"	"ڻ")
+("bucsh"	"")
+("budoo"	"")
+("bufb"	"ڼ")
+("bufbf"	"")
+("bufbg"	"e")
+("bufd"	"֩")
+("bufdq"	"z")
+("buff"	"")
+("bufh"	"")
+("bufqu"	"")
+("bugce"	"")
+("bugcg"	"")
+("bugg"	"֪")
+("bugit"	"O")
+("buhaf"	"c")
+("buhdf"	"")
+("buhe"	"")
+("buhgf"	"{")
+("buhhj"	"D")
+("buhhv"	"֯")
+("buhio"	"w")
+("buhjm"	"")
+("buhju"	"")
+("buhml"	"")
+("buhni"	"")
+("buhok"	"")
+("buhoo"	"z")
+("buhpa"	"")
+("buhqi"	"")
+("buhqo"	"")
+("buhqu"	"")
+("buhsk"	"")
+("buhu"	"")
+("buhus"	"v")
+("buhvf"	"")
+("buhxe"	"")
+("buhxu"	"E")
+("buihq"	"")
+("buik"	"Ͼ")
+("buir"	"")
+("buitc"	"t")
+("buiv"	"")
+("bujbc"	"Q")
+("bujd"	"")
+("bujka"	"@")
+("bujlo"	"")
+("bujmc"	"vy")
+("bujmn"	"")
+("bujmu"	"ں")
+("bujnu"	"")
+("bujqr"	"M")
+("bukcf"	"A")
+("bukkb"	"")
+("bukn"	"֫")
+("bulbu"	"")
+("bullp"	"|")
+("bulmc"	"~")
+("bulmi"	"")
+("bulmo"	"")
+("buln"	"")
+("bulwl"	"")
+("bulwv"	"y")
+("bumbg"	"")
+("bumd"	"w")
+("bumgg"	"")
+("bumj"	"x")
+("bumjk"	"")
+("bumls"	"")
+("bummi"	"")
+("bumn"	"n")
+("bumwf"	"g")
+("bumwj"	"{")
+("bumym"	"")
+("bunau"	"")
+("bunbe"	"u")
+("buncr"	"¤")
+("bunhb"	"|")
+("bunin"	"ֲ")
+("bunir"	"֮")
+("bunok"	"")
+("bunot"	"")
+("buog"	"F£D")
+("buoge"	"w")
+("buogf"	"@")
+("buohh"	"")
+("buoma"	"U")
+("buomb"	"")
+("buomn"	"")
+("buomo"	"¥")
+("buon"	"y")
+("buotf"	"")
+("bupa"	"֭")
+("bupim"	"")
+("bupu"	"")
+("buqmb"	"")
+("buqou"	"x")
+("burb"	"ڿ")
+("burrd"	"T")
+("burvp"	"v")
+("bushr"	"")
+("busj"	"֬")
+("busmg"	"")
+("busyi"	"f")
+("butak"	"~")
+("butbo"	"é")
+("butco"	"")
+("butk"	"֨")
+("butlb"	"f")
+("butmj"	"")
+("butq"	"ֱ")
+("butrg"	"")
+("butw"	"")
+("buu"	"\")
+("buvfb"	"z")
+("buvis"	"")
+("buvml"	"")
+("buvne"	"")
+("buwd"	"t")
+("buybp"	"")
+("buyfd"	"N")
+("buyoj"	"")
+("buytg"	"")
+("buytj"	"}")
+("buyub"	"w")
+("buyv"	"v")
+("buyvi"	"t")
+("bv"	"")
+("bvg"	"")
+("bvhaf"	"x")
+("bvhl"	"")
+("bvik"	"O")
+("bvnl"	"W")
+("bvno"	"{")
+("bvp"	"")
+("bvvv"	"þ")
+("bvvw"	"")
+("bwim"	"A")
+("bwk"	"")
+("bwl"	"K")
+("bwlb"	"x")
+("bwli"	"")
+("bwmv"	"y")
+("bwot"	"")
+("bwp"	"|")
+("by"	"")
+("byav"	"L")
+("bybb"	"")
+("bybp"	"g")
+("bybs"	"H")
+("byhaf"	"")
+("byhhh"	"")
+("byhn"	"ͬ")
+("byhr"	"")
+("byhs"	"")
+("byia"	"")
+("byij"	"")
+("byln"	"ɿ")
+("byoj"	"Q")
+("byok"	"")
+("bypo"	"")
+("bypt"	"Ĥ")
+("byrn"	"P")
+("byta"	"r")
+("bytg"	"")
+("bytoe"	"t")
+("bytp"	"r")
+("byvg"	"s")
+("byvi"	"V")
+("byvo"	"j")
+("bywm"	"")
+("byx"	"")
+("c"	"")
+("ca"	"s")
+("caa"	"")
+("cafu"	"g")
+("cam"	"")
+("camh"	"")
+("camj"	"Z")
+("camo"	"")
+("camvn"	"p")
+("can"	"")
+("canl"	"U")
+("canw"	"S")
+("caph"	"")
+("capp"	"")
+("capv"	"")
+("casm"	"Y")
+("cate"	"")
+("cau"	"j")
+("cav"	"")
+("cawe"	"")
+("cb"	"v")
+("cbb"	"@")
+("cbbe"	"i")
+("cbbr"	"")
+("cbcn"	"")
+("cbdi"	"n")
+("cbgr"	"")
+("cbjj"	"")
+("cbm"	"")
+("cbme"	"")
+("cbmr"	"")
+("cbms"	"S")
+("cbsd"	"")
+("cbu"	"")
+("cbuc"	"X")
+("cbue"	"")
+("cbuu"	"|")
+("ccc"	"")
+("cci"	"n")
+("ccnh"	"O")
+("ccor"	"s")
+("ccr"	"]")
+("ccru"	"U")
+("ccsh"	"w")
+("cdh"	"C")
+("cdhe"	"e")
+("cdk"	"i")
+("cdl"	"y")
+("cdmq"	"")
+("cdoo"	"")
+("cdwf"	"")
+("cea"	"")
+("ceah"	"")
+("ceed"	"b")
+("ceee"	"")
+("cehv"	"")
+("cei"	"")
+("cf"	"d")
+("cfb"	"P")
+("cfbc"	"")
+("cfbd"	"")
+("cfbf"	"")
+("cfbg"	"")
+("cfbr"	"")
+("cfbu"	"f")
+("cfbw"	"L")
+("cfd"	"w")
+("cfdq"	"")
+("cff"	"")
+("cffd"	"m")
+("cffs"	"")
+("cfh"	"r")
+("cfmu"	"")
+("cfq"	"")
+("cfqu"	"")
+("cg"	"A")
+("cgce"	"")
+("cgcg"	"")
+("cgg"	"")
+("cggu"	"")
+("cgi"	"")
+("cgit"	"e")
+("cgni"	"ű")
+("cgp"	"x")
+("cgr"	"")
+("cgrv"	"d")
+("cha"	"`")
+("chab"	"A")
+("chag"	"")
+("chd"	"")
+("chdb"	"@")
+("chdf"	"")
+("chdh"	"")
+("chdn"	"~")
+("chdw"	"")
+("che"	"z")
+("chej"	"W")
+("cher"	"")
+("chey"	"")
+("chgi"	"")
+("chgr"	"p")
+("chgu"	"")
+("chhaf"	"")
+("chhe"	"M")
+("chhh"	"")
+("chhj"	"")
+("chhl"	"g")
+("chhw"	"^")
+("chjd"	"")
+("chje"	"")
+("chjg"	"")
+("chjm"	"")
+("chjr"	"y")
+("chju"	"")
+("chjx"	"")
+("chlc"	"K")
+("chln"	"c")
+("chlo"	"m")
+("chmbc"	"{")
+("chml"	"l")
+("chmr"	"")
+("chni"	"")
+("chnl"	"ˬ")
+("chok"	"")
+("choo"	"k")
+("chpa"	"B")
+("chqi"	"r")
+("chqm"	"")
+("chrf"	"")
+("chuc"	"p")
+("chud"	"")
+("chup"	"i")
+("chvo"	"")
+("chwp"	"]")
+("chxe"	"\")
+("chxh"	"")
+("ci"	"")
+("ciav"	"c")
+("cibi"	"W")
+("cice"	"}")
+("cihf"	"d")
+("cihm"	"")
+("cihq"	"")
+("cihr"	"")
+("cihs"	"")
+("cihu"	"u")
+("cii"	"")
+("ciih"	"t")
+("ciil"	"")
+("cijb"	"Q")
+("cijc"	"")
+("cije"	"g")
+("cikk"	"Y")
+("cilb"	"`")
+("cile"	"n")
+("cill"	"")
+("cilr"	"_")
+("cimbc"	"|")
+("cimn"	"")
+("cine"	"")
+("cip"	"")
+("cipf"	"")
+("cipm"	"")
+("cipp"	"i")
+("cir"	"")
+("cism"	"")
+("citc"	"I")
+("cite"	"")
+("citf"	"o")
+("civ"	"")
+("cixp"	"p")
+("cj"	"w")
+("cjbc"	"")
+("cjbd"	"w")
+("cjbf"	"c")
+("cjcr"	"")
+("cjig"	"K")
+("cjii"	"q")
+("cjip"	"")
+("cjka"	"")
+("cjki"	"b")
+("cjkp"	"{")
+("cjks"	"R")
+("cjmc"	"mg")
+("cjmf"	"")
+("cjmm"	"")
+("cjmo"	"S")
+("cjmu"	"u")
+("cjnu"	"")
+("cjp"	"")
+("cjpn"	"k")
+("cjr"	"W")
+("cjrr"	"")
+("cjtc"	"c")
+("cjto"	"V")
+("cjv"	"")
+("ck"	"")
+("ckau"	"")
+("ckb"	"}")
+("ckce"	"j")
+("ckcf"	"")
+("ckgg"	"")
+("ckhml"	"")
+("cki"	"gr")
+("ckjt"	"")
+("cklb"	"Z")
+("ckld"	"")
+("ckmf"	"")
+("ckmgc"	"y")
+("ckmr"	"B")
+("ckms"	"")
+("ckn"	"D")
+("cknin"	"R")
+("ckoo"	"h")
+("cksjl"	"")
+("clbk"	"")
+("clbu"	"q")
+("clll"	"")
+("clmc"	"")
+("clmo"	"")
+("cln"	"x")
+("clnc"	"")
+("clw"	"\")
+("clwv"	"")
+("clx"	"")
+("cm"	"")
+("cma"	"")
+("cmbb"	"h")
+("cmbc"	"H")
+("cmbw"	"J")
+("cmd"	"")
+("cmfb"	"n")
+("cmfe"	"d")
+("cmfj"	"|")
+("cmgi"	"")
+("cmgr"	"")
+("cmhaf"	"")
+("cmig"	"~")
+("cmj"	"")
+("cmlm"	"")
+("cmmr"	"f")
+("cmms"	"@")
+("cmmv"	"z")
+("cmn"	"v")
+("cmnr"	"")
+("cmp"	"")
+("cmr"	"")
+("cmrb"	"")
+("cmrt"	"e")
+("cmt"	"e")
+("cmtn"	"x")
+("cmua"	"")
+("cmvi"	"U")
+("cmvm"	"{")
+("cmvs"	"")
+("cmwf"	"")
+("cmwj"	"")
+("cmym"	"")
+("cmys"	"t")
+("cn"	"")
+("cnao"	"A")
+("cnau"	"")
+("cnd"	"B")
+("cndt"	"")
+("cng"	"s")
+("cnhb"	"")
+("cnhd"	"")
+("cnhe"	"k")
+("cnhs"	"C")
+("cnhx"	"")
+("cni"	"")
+("cnii"	"f")
+("cnin"	"")
+("cnir"	"")
+("cnkg"	"o")
+("cnkm"	"")
+("cnkq"	"")
+("cnl"	"h")
+("cnlh"	"")
+("cnlr"	"")
+("cnn"	"B")
+("cno"	"")
+("cnoe"	"")
+("cnot"	"")
+("cnri"	"U")
+("coae"	"")
+("cob"	"u")
+("cod"	"")
+("cog"	"@")
+("cogd"	"B")
+("cogf"	"")
+("cogj"	"h")
+("cogs"	"O")
+("cohg"	"")
+("coii"	"a")
+("coim"	"T")
+("coin"	"x")
+("coir"	"")
+("colb"	"")
+("colh"	"")
+("colmi"	"m")
+("comb"	"_C")
+("comg"	"")
+("como"	"j")
+("comr"	"")
+("con"	"")
+("cond"	"[")
+("conk"	"")
+("coog"	"V")
+("cop"	"")
+("cor"	"")
+("cowy"	"q")
+("cp"	"c")
+("cph"	"c")
+("cpi"	"")
+("cpim"	"v")
+("cpou"	"A")
+("cpp"	"f")
+("cppa"	"")
+("cpr"	"_")
+("cpru"	"^")
+("cptd"	"")
+("cpu"	"w")
+("cpyr"	"")
+("cqd"	"")
+("cqhk"	"")
+("cqjm"	"b")
+("cqmb"	"")
+("cqmv"	"")
+("cqo"	"y")
+("cr"	"")
+("crb"	"m")
+("crhaf"	"")
+("crhr"	"T")
+("crhu"	"I")
+("crjcm"	"")
+("crki"	"")
+("crmjk"	"D")
+("crnl"	"")
+("crno"	"")
+("crnq"	"")
+("croir"	"P")
+("crp"	"")
+("crrd"	"d")
+("crrs"	"")
+("crsl"	"o")
+("crsmh"	"")
+("crtc"	"R")
+("cruc"	"")
+("crvk"	"k")
+("crvp"	"")
+("crybp"	"D")
+("crye"	"")
+("cseg"	"")
+("csh"	"")
+("cshc"	"h")
+("cshf"	"Z")
+("cshg"	"ʬ")
+("cshp"	"")
+("cshr"	"")
+("csht"	"")
+("cshu"	"")
+("csit"	"Ų")
+("csj"	"z")
+("csje"	"")
+("csjj"	"h")
+("csjr"	"")
+("cslb"	"")
+("csme"	"j")
+("csmh"	"e")
+("csmr"	"")
+("csmv"	"")
+("csp"	"")
+("csqf"	"V")
+("csrr"	"c")
+("css"	"d")
+("cssr"	"v")
+("csyi"	"")
+("cta"	"")
+("ctak"	"h")
+("ctbc"	"")
+("ctbk"	"")
+("ctca"	"")
+("ctco"	"")
+("ctct"	"")
+("ctei"	"R")
+("ctgi"	"p")
+("ctgk"	"")
+("ctgt"	"o")
+("ctgu"	"")
+("ctis"	"t")
+("ctm"	"X")
+("ctmc"	"")
+("ctmj"	"")
+("ctmv"	"")
+("ctoe"	"i")
+("ctop"	"")
+("ctor"	"X")
+("ctpd"	"g")
+("ctqm"	"`")
+("ctrg"	"u")
+("ctsr"	"")
+("ctt"	"")
+("ctub"	"a")
+("ctvi"	"")
+("ctw"	"")
+("ctwi"	"")
+("ctxc"	"T")
+("ctyj"	"L")
+("ctyv"	"l")
+("cu"	"")
+("cuce"	"")
+("cuhqu"	"")
+("cumj"	"")
+("cumt"	"Z")
+("cuob"	"r")
+("cuog"	"i")
+("cuok"	"է")
+("cv"	"")
+("cvfr"	"C")
+("cvid"	"")
+("cvii"	"")
+("cvio"	"")
+("cvmi"	"")
+("cvne"	"")
+("cvr"	"")
+("cvvv"	"N")
+("cvvw"	"E")
+("cw"	"f")
+("cwa"	"")
+("cwd"	"")
+("cwg"	"Y")
+("cwjr"	"D")
+("cwk"	"")
+("cwl"	"[")
+("cwlg"	"r")
+("cwli"	"N")
+("cwlj"	"M")
+("cwlv"	"`")
+("cwmv"	"")
+("cwp"	"")
+("cwtj"	"r")
+("cwvf"	"")
+("cwwg"	"s")
+("cwyi"	"")
+("cy"	"z")
+("cybb"	"e")
+("cybc"	"")
+("cybk"	"")
+("cybp"	"")
+("cybs"	"")
+("cycb"	"")
+("cyck"	"")
+("cydk"	"")
+("cye"	"t")
+("cyg"	"")
+("cygq"	"b")
+("cyhm"	"")
+("cyhn"	"p")
+("cyhr"	"")
+("cyhs"	"b")
+("cyhv"	"v")
+("cyib"	"")
+("cyiu"	"")
+("cyj"	"o")
+("cyjj"	"")
+("cylb"	"")
+("cymb"	"")
+("cymh"	"h")
+("cymy"	"")
+("cypd"	"g")
+("cypo"	"_")
+("cypp"	"J")
+("cyps"	"f")
+("cypt"	"D")
+("cyr"	"")
+("cyrb"	"")
+("cyrd"	"")
+("cyrv"	"^")
+("cysk"	"")
+("cyso"	"a")
+("cytg"	"")
+("cytj"	"N")
+("cyto"	"a")
+("cytp"	"^")
+("cytu"	"")
+("cyvi"	"b")
+("cywi"	"s")
+("cyx"	"l")
+("d"	"")
+("da"	"H")
+("dafu"	"a")
+("dagi"	"M")
+("dahu"	"")
+("dail"	"ո")
+("daiu"	"")
+("dam"	"d\")
+("damh"	"")
+("damj"	"")
+("dang"	"")
+("danr"	"q")
+("danw"	"")
+("dapp"	"")
+("dapv"	"")
+("dasm"	"f")
+("dau"	"I")
+("dav"	"")
+("dawe"	"")
+("db"	"")
+("dbac"	"@")
+("dbb"	"")
+("dbbb"	"L")
+("dbcd"	"")
+("dbcv"	"")
+("dbd"	"ٽ")
+("dbdb"	"ƴ")
+("dbgr"	"")
+("dbhx"	"O")
+("dbjj"	"")
+("dbkf"	"")
+("dbln"	"")
+("dbm"	"H")
+("dbmc"	"ټ")
+("dbme"	"")
+("dbmr"	"")
+("dbnd"	"վ")
+("dbo"	"")
+("dbou"	"o")
+("dbsd"	"")
+("dbse"	"")
+("dbt"	"]")
+("dbtu"	"ٻ")
+("dbu"	"")
+("dbuc"	"")
+("dbug"	"")
+("dbv"	"ս")
+("dbvk"	"P")
+("dc"	"")
+("dcav"	"")
+("dchd"	"")
+("dci"	"Q")
+("dcip"	"")
+("dcms"	"")
+("dcnh"	"")
+("dcru"	"տ")
+("dcsh"	"")
+("dcwa"	"")
+("dd"	"L")
+("ddam"	"")
+("ddb"	"")
+("ddbuh"	"{")
+("ddcsh"	"")
+("ddd"	"")
+("dddo"	"G")
+("ddec"	"")
+("ddf"	"I")
+("ddg"	"Ա")
+("ddh"	"")
+("ddhe"	"D")
+("ddhh"	"l")
+("ddhni"	"J")
+("ddi"	"")
+("ddixp"	"S")
+("ddj"	"")
+("ddk"	"")
+("ddkli"	"E")
+("ddkmr"	"s")
+("ddkq"	"k")
+("ddl"	"")
+("ddln"	"")
+("ddlo"	"")
+("ddmmf"	"T")
+("ddmq"	"")
+("ddnl"	"")
+("ddnyo"	"")
+("ddoin"	"")
+("ddoo"	"ٷ")
+("ddp"	"")
+("ddv"	"")
+("ddw"	"޽")
+("ddwf"	"")
+("deee"	"ٺ")
+("defh"	"")
+("dei"	"C")
+("deid"	"")
+("dembc"	"")
+("demj"	"u")
+("depru"	"p")
+("df"	"N")
+("dfb"	"")
+("dfbd"	"")
+("dfbf"	"")
+("dfbg"	"")
+("dfbh"	"")
+("dfbw"	"")
+("dfdq"	"")
+("dff"	"ٰ")
+("dffn"	"")
+("dffs"	"")
+("dfh"	"W")
+("dfle"	"")
+("dfmu"	"")
+("dfq"	"")
+("dfqu"	"ٯ")
+("dg"	"")
+("dgb"	"I")
+("dgce"	"ٱ")
+("dgg"	"")
+("dggi"	"")
+("dggu"	"")
+("dgit"	"E")
+("dgni"	"h")
+("dgov"	"")
+("dgow"	"")
+("dgr"	"")
+("dgrg"	"i")
+("dgrv"	"D")
+("dgti"	"")
+("dgwc"	"p")
+("dh"	"~")
+("dha"	"f")
+("dhab"	"")
+("dhag"	"")
+("dhaj"	"R")
+("dhal"	"")
+("dhbul"	"")
+("dhcq"	"")
+("dhdf"	"")
+("dhdw"	"")
+("dhe"	"֪O")
+("dhej"	"")
+("dher"	"")
+("dhey"	"`")
+("dhge"	"")
+("dhgr"	"")
+("dhhaf"	"")
+("dhhh"	"")
+("dhhi"	"k")
+("dhhj"	"")
+("dhhl"	"h")
+("dhhw"	"h")
+("dhi"	"i")
+("dhij"	"")
+("dhio"	"_")
+("dhja"	"")
+("dhjd"	"")
+("dhje"	"")
+("dhjm"	"")
+("dhjr"	"")
+("dhju"	"")
+("dhkb"	"")
+("dhlb"	"")
+("dhlc"	"W")
+("dhml"	"R")
+("dhmu"	"")
+("dhmy"	"l")
+("dhn"	"")
+("dhne"	"")
+("dhni"	"G")
+("dhon"	"")
+("dhoo"	"")
+("dhpa"	"")
+("dhpm"	"k")
+("dhqo"	"P")
+("dhqu"	"")
+("dhs"	"g")
+("dhsb"	"")
+("dhsk"	"")
+("dhsu"	"")
+("dhuc"	"")
+("dhus"	"Q")
+("dhuu"	"")
+("dhvo"	"T")
+("dhxo"	"ٿ")
+("dhyg"	"")
+("dhyu"	"S")
+("di"	"o")
+("diav"	"հ")
+("dibi"	"F")
+("dice"	"")
+("digi"	"o")
+("dihf"	"")
+("dihr"	"")
+("dii"	"")
+("diih"	"")
+("diil"	"}")
+("dije"	"")
+("dikk"	"Y")
+("dilb"	"")
+("dill"	"")
+("diln"	"k")
+("dilr"	"")
+("dimo"	"")
+("dine"	"M")
+("ding"	"W")
+("dip"	"@")
+("dipc"	"")
+("dipm"	"")
+("dirm"	"ٵ")
+("dit"	"")
+("dj"	"")
+("djbc"	"\")
+("djbd"	"")
+("djbj"	"")
+("djbm"	"")
+("djc"	"W")
+("djcm"	"٪")
+("djcr"	"_")
+("djcs"	"^")
+("dje"	"K")
+("djhr"	"")
+("djii"	"")
+("djip"	"")
+("djji"	"")
+("djk"	"")
+("djka"	"")
+("djkp"	"")
+("djks"	"")
+("djlv"	"")
+("djmc"	"b")
+("djmf"	"")
+("djmm"	"")
+("djmo"	"")
+("djmu"	"")
+("djp"	"")
+("djpa"	"C")
+("djpn"	"f")
+("djr"	"\")
+("djrb"	"")
+("djrj"	"")
+("djrr"	"")
+("djtc"	"")
+("djv"	"")
+("dk"	"[A")
+("dkb"	"")
+("dkce"	"")
+("dkcf"	"")
+("dkgg"	"")
+("dkhaf"	"")
+("dkhf"	"")
+("dkkb"	"")
+("dkkk"	"")
+("dkld"	"")
+("dkmr"	"")
+("dkms"	"")
+("dkmym"	"")
+("dkn"	"")
+("dkok"	"")
+("dkoo"	"ճ")
+("dkp"	"x")
+("dks"	"")
+("dkso"	"")
+("dksr"	"E")
+("dl"	"")
+("dlbk"	"K")
+("dlbu"	"E")
+("dld"	"")
+("dle"	"")
+("dlksf"	"{")
+("dllmi"	"")
+("dlln"	"fG")
+("dlmc"	"")
+("dlmo"	"")
+("dlmy"	"")
+("dlno"	"")
+("dlok"	"")
+("dlp"	"I")
+("dlshc"	"")
+("dlw"	"c")
+("dlwl"	"]")
+("dlws"	"ջ")
+("dlwv"	"")
+("dlx"	"")
+("dlxl"	"")
+("dm"	"")
+("dmam"	"")
+("dmbb"	"")
+("dmbc"	"b")
+("dmbe"	"N")
+("dmbl"	"")
+("dmbm"	"")
+("dmbr"	"")
+("dmbs"	"")
+("dmbw"	"D")
+("dmcw"	"")
+("dmd"	"")
+("dmdm"	"U")
+("dmem"	"")
+("dmf"	"M")
+("dmfb"	"")
+("dmfj"	"i")
+("dmfm"	"B")
+("dmfn"	"F")
+("dmfr"	"յ")
+("dmg"	"P")
+("dmgr"	"Y")
+("dmgt"	"ձ")
+("dmhf"	"[")
+("dmia"	"]")
+("dmig"	"")
+("dmj"	"")
+("dmjk"	"")
+("dmlk"	"")
+("dmlm"	"ٲ")
+("dmmf"	"U")
+("dmmi"	"")
+("dmmp"	"")
+("dmmr"	"")
+("dmms"	"")
+("dmmu"	"")
+("dmmv"	"մ")
+("dmn"	"")
+("dmnl"	"")
+("dmnn"	"")
+("dmnr"	"_")
+("dmob"	"`")
+("dmr"	"C")
+("dmrq"	"")
+("dmrt"	"")
+("dmrw"	"")
+("dmsmm"	"")
+("dmso"	"ٸ")
+("dmsu"	"")
+("dmt"	"")
+("dmto"	"")
+("dmu"	"B")
+("dmue"	"H")
+("dmvh"	"")
+("dmvm"	"")
+("dmvs"	"")
+("dmvvq"	"ߣ")
+("dmwc"	"")
+("dmwf"	"")
+("dmwj"	"")
+("dmwm"	"E")
+("dnao"	"")
+("dnbg"	"")
+("dnbj"	"")
+("dnbq"	"")
+("dncr"	"")
+("dnd"	"E")
+("dndf"	"_")
+("dnfd"	"Z")
+("dng"	"")
+("dnhb"	"")
+("dnhd"	"")
+("dnhe"	"")
+("dnib"	"")
+("dnin"	"V")
+("dnkg"	"")
+("dnkm"	"")
+("dnkq"	"")
+("dnlb"	"")
+("dnlw"	"")
+("dnmu"	"")
+("dno"	"")
+("dnob"	"")
+("dnok"	"")
+("dnot"	"")
+("dnq"	"ݷ")
+("dnqd"	"Q")
+("dnri"	"")
+("dnst"	"")
+("dnwa"	"r")
+("dob"	"")
+("dobg"	"e")
+("dobuc"	"")
+("doby"	"")
+("dodi"	"S")
+("doe"	"")
+("dog"	"")
+("dogf"	"")
+("dogj"	"g")
+("dogs"	"")
+("dohaf"	"")
+("doii"	"a")
+("doik"	"y")
+("doim"	"")
+("doin"	"")
+("doip"	"")
+("doir"	"j")
+("doj"	"S")
+("dok"	"T")
+("dokr"	"")
+("dolb"	"")
+("doma"	"")
+("domb"	"")
+("domd"	"")
+("domg"	"")
+("domk"	"")
+("domn"	"")
+("domo"	"")
+("don"	"F")
+("donl"	"")
+("doo"	"")
+("doog"	"")
+("dop"	"")
+("dopd"	"Q")
+("dowy"	"")
+("doyb"	"")
+("dp"	"")
+("dpa"	"")
+("dpd"	"D")
+("dpfd"	"پ")
+("dph"	"")
+("dpht"	"X")
+("dpi"	"@")
+("dpim"	"")
+("dpp"	"J")
+("dppa"	"")
+("dppg"	"ղ")
+("dpr"	"e")
+("dpru"	"R")
+("dpt"	"A")
+("dptd"	"")
+("dpu"	"")
+("dq"	"")
+("dqbhx"	"")
+("dqbjj"	"")
+("dqdj"	"")
+("dqgwc"	"")
+("dqhaj"	"")
+("dqhk"	"")
+("dqikk"	"")
+("dqjl"	"")
+("dqjm"	"")
+("dqka"	"")
+("dqkd"	"d")
+("dqkk"	"")
+("dqkq"	"")
+("dqkx"	"")
+("dqmb"	"")
+("dqmc"	"")
+("dqmf"	"Z")
+("dqnhd"	"")
+("dqnl"	"T")
+("dqo"	"")
+("dqomr"	"")
+("dqou"	"")
+("dqptd"	"")
+("dqshi"	"")
+("dqsmv"	"C")
+("dqtmj"	"q")
+("dqttb"	"")
+("dqwli"	"r")
+("dqwot"	"")
+("dqyrd"	"B")
+("dr"	"")
+("drb"	"")
+("drc"	"L")
+("drhg"	"չ")
+("drhr"	"")
+("drhs"	"^")
+("drhu"	"M")
+("drms"	"J")
+("drrd"	"")
+("drrj"	"")
+("drsh"	"b")
+("drsj"	"")
+("drye"	"")
+("dsav"	"")
+("dsfb"	"J")
+("dsit"	"e")
+("dsj"	"")
+("dsje"	"ٴ")
+("dsjl"	"")
+("dsjr"	"ٹ")
+("dskr"	"")
+("dslc"	"d")
+("dsly"	"I")
+("dsma"	"")
+("dsme"	"շ")
+("dsmg"	"g")
+("dsmh"	"")
+("dsmm"	"")
+("dsmr"	"Z")
+("dsmv"	"ٳ")
+("dsnd"	"")
+("dsno"	"^")
+("dsp"	"F")
+("dsqf"	"Y")
+("dsql"	"")
+("dsrg"	"")
+("dsrr"	"")
+("dss"	"@")
+("dssr"	"ն")
+("dstv"	"^")
+("dsu"	"")
+("dswu"	"V")
+("dsyi"	"")
+("dsyq"	"")
+("dta"	"ٶ")
+("dtak"	"")
+("dtaw"	"")
+("dtbo"	"c")
+("dtc"	"")
+("dtce"	"")
+("dtco"	"")
+("dtcw"	"")
+("dtei"	"")
+("dtge"	"")
+("dtgf"	"U")
+("dtgi"	"")
+("dtgo"	"B")
+("dtgr"	"")
+("dthj"	"")
+("dtjr"	"")
+("dtk"	"")
+("dtkr"	"")
+("dtlb"	"")
+("dtlm"	"")
+("dtlx"	"W")
+("dtm"	"a")
+("dtmc"	"Ѿ")
+("dtmj"	"")
+("dtmv"	"")
+("dtoe"	"")
+("dtor"	"G")
+("dtpa"	"b")
+("dtqm"	"A")
+("dtrg"	"v")
+("dtsj"	"`")
+("dtsr"	"P")
+("dtt"	"")
+("dttb"	"c")
+("dttc"	"ٮ")
+("dtwa"	"")
+("dtwi"	"")
+("dtxc"	"V")
+("du"	"")
+("duch"	"")
+("dulmi"	"׬")
+("dumb"	"")
+("dumt"	"N")
+("duob"	"")
+("duon"	"պ")
+("dup"	"Q")
+("duu"	"O")
+("duvif"	"")
+("dvfo"	"X")
+("dvid"	"R")
+("dvii"	"")
+("dvis"	"b")
+("dvl"	"")
+("dvmg"	"")
+("dvno"	"")
+("dvoi"	"")
+("dvvd"	"")
+("dvvw"	"")
+("dw"	"F")
+("dwc"	"N")
+("dwd"	"")
+("dwf"	"Z")
+("dwg"	"ռ")
+("dwhaf"	"")
+("dwhd"	"")
+("dwim"	"")
+("dwjr"	"")
+("dwl"	"j")
+("dwlg"	"")
+("dwlj"	"")
+("dwls"	"")
+("dwly"	"I")
+("dwmv"	"")
+("dwp"	"")
+("dwvf"	"")
+("dww"	"")
+("dwwf"	"")
+("dwww"	"O")
+("dy"	"")
+("dyaj"	"")
+("dybb"	"")
+("dybc"	"")
+("dybp"	"S")
+("dybs"	"]")
+("dycb"	"")
+("dyck"	"")
+("dydk"	"")
+("dydl"	"")
+("dydu"	"h")
+("dyfe"	"")
+("dyg"	"W")
+("dyhh"	"")
+("dyhn"	"C")
+("dyhr"	"l")
+("dyhs"	"D")
+("dyia"	"")
+("dyiu"	"")
+("dyj"	"U")
+("dyjj"	"")
+("dylb"	"U")
+("dymh"	"H")
+("dymu"	"V")
+("dynv"	"")
+("dyoj"	"")
+("dypk"	"K")
+("dypm"	"")
+("dypt"	"V")
+("dyr"	"[")
+("dyra"	"L")
+("dyrb"	"`")
+("dyrf"	"")
+("dyrn"	"")
+("dyro"	"")
+("dyrv"	"")
+("dysd"	"")
+("dysr"	"")
+("dysy"	"٭")
+("dyt"	"X")
+("dytg"	"")
+("dytj"	"")
+("dyto"	"")
+("dytp"	"")
+("dytr"	"٫")
+("dytu"	"C")
+("dytv"	"٬")
+("dyub"	"")
+("dyut"	"")
+("dyvo"	"")
+("dywd"	"")
+("dywm"	"")
+("dywv"	"T")
+("dyx"	"")
+("e"	"")
+("ea"	"QS")
+("eaa"	"@")
+("eafc"	"l")
+("eafu"	"S")
+("eag"	"I")
+("eagi"	"Z")
+("eahm"	"T")
+("eahu"	"D")
+("eaiu"	"@")
+("eam"	"L")
+("eamh"	"")
+("eami"	"")
+("eamj"	"T")
+("eamk"	"")
+("eamo"	"A")
+("eana"	"")
+("eand"	"G")
+("eane"	"i")
+("eang"	"")
+("eanj"	"")
+("eank"	"^")
+("eanw"	"i")
+("eapp"	"V")
+("eapv"	"")
+("eate"	"r")
+("eavf"	"")
+("eawe"	"")
+("eayf"	"Z")
+("ebac"	"H")
+("ebau"	"")
+("ebb"	"")
+("ebbb"	"")
+("ebbr"	"")
+("ebbu"	"")
+("ebcd"	"`")
+("ebci"	"q")
+("ebcn"	"")
+("ebcr"	"f")
+("ebcv"	"_")
+("ebgr"	"E")
+("ebhg"	"]")
+("ebhu"	"I")
+("ebhx"	"")
+("ebjj"	"")
+("ebkf"	"")
+("ebm"	"q")
+("ebme"	"E")
+("ebmp"	"V")
+("ebmr"	"}")
+("ebnd"	"B")
+("ebof"	"")
+("ebp"	"V")
+("ebr"	"")
+("ebsd"	"b")
+("ebuc"	"S")
+("ebug"	"A")
+("ebuh"	"")
+("ebuk"	"@")
+("ebul"	"")
+("ebuu"	"b")
+("ebv"	"g")
+("ebvk"	"")
+("ebwi"	"a")
+("ebyh"	"h")
+("ec"	"hɢ")
+("ecc"	"")
+("ecnh"	"")
+("ecor"	"D")
+("ecr"	"u")
+("ecru"	"X")
+("ecsh"	"W")
+("ecst"	"K")
+("ecwa"	"W")
+("ed"	"N")
+("edam"	"")
+("edbt"	"֧")
+("edbu"	"")
+("edci"	"S")
+("edd"	"O")
+("eddf"	"")
+("eddg"	"")
+("eddh"	"")
+("eddn"	"")
+("eddo"	"")
+("edg"	"")
+("edgg"	"W")
+("edhe"	"i")
+("edhl"	"X")
+("edj"	"j")
+("edk"	"M")
+("edl"	"P")
+("edlc"	"u")
+("edlo"	"")
+("edm"	"I")
+("edmbc"	"")
+("edmf"	"")
+("edmq"	"")
+("edoe"	"")
+("edoo"	"")
+("edw"	"")
+("edwf"	"")
+("ee"	"D")
+("eea"	"")
+("eee"	"")
+("eeed"	"")
+("eeeee"	"t")
+("eeeef"	"")
+("eeeen"	"")
+("eeeeo"	"")
+("eeeeu"	"")
+("eei"	"")
+("eeii"	"R")
+("eemr"	"")
+("eetb"	"")
+("eev"	"C")
+("efb"	"")
+("efbg"	"")
+("efbk"	"v")
+("efbr"	"I")
+("efbw"	"@")
+("efdc"	"\")
+("efdq"	"")
+("eff"	"H")
+("effe"	"P")
+("efff"	"^")
+("effg"	"")
+("effr"	"]")
+("effs"	"")
+("efh"	"F")
+("efhu"	"")
+("efmu"	"")
+("efq"	"")
+("efqf"	"U")
+("eg"	"o")
+("egce"	"")
+("egcg"	"")
+("egde"	"X")
+("egfe"	"`")
+("egg"	"q")
+("eggu"	"")
+("egi"	"k")
+("egit"	"")
+("egj"	"")
+("eglc"	"a")
+("egni"	"")
+("egow"	"")
+("egr"	"ϡ")
+("egrv"	"V")
+("egsk"	"")
+("egth"	"")
+("egti"	"@")
+("egtj"	"")
+("egwc"	"p")
+("eha"	"y")
+("ehag"	"G")
+("ehal"	"")
+("ehar"	"P")
+("ehbk"	"D")
+("ehbn"	"")
+("ehbt"	"")
+("ehbu"	"")
+("ehby"	"|")
+("ehcn"	"s")
+("ehdb"	"L")
+("ehde"	"a")
+("ehdf"	"G")
+("ehdn"	"Y")
+("ehdp"	"_")
+("ehdw"	"")
+("ehe"	"Z")
+("eheq"	"z")
+("eher"	"")
+("ehet"	"")
+("ehf"	"S")
+("ehgr"	"E")
+("ehgu"	"~")
+("ehhl"	"}")
+("ehhv"	"")
+("ehhw"	"")
+("ehio"	"x")
+("ehjd"	"x")
+("ehjg"	"F")
+("ehjr"	"")
+("ehk"	"U")
+("ehkp"	"K")
+("ehlq"	"_")
+("ehmgi"	"f")
+("ehml"	"^")
+("ehmo"	"")
+("ehmr"	"Ϭ")
+("ehmy"	"A")
+("ehni"	"I")
+("ehnn"	"ϩ")
+("ehnwf"	"T")
+("ehoe"	"Q")
+("ehon"	"ϭ")
+("ehoo"	"")
+("ehpa"	"")
+("ehpm"	"|")
+("ehq"	"f")
+("ehqi"	"i")
+("ehqj"	"")
+("ehqm"	"N")
+("ehqo"	"")
+("ehrb"	"`")
+("ehsd"	"")
+("ehsk"	"\E")
+("ehsu"	"")
+("ehuc"	"d")
+("ehuk"	"")
+("ehul"	"W")
+("ehv"	"P")
+("ehvo"	"@")
+("ehvp"	"Y")
+("ehxf"	"")
+("ehxu"	"F")
+("ehyhv"	"")
+("ei"	"e")
+("eiav"	"")
+("eibi"	"")
+("eice"	"C")
+("eid"	"")
+("eidy"	"")
+("eifd"	"d")
+("eihf"	"")
+("eihq"	"Ϩ")
+("eihr"	"")
+("eihu"	"V")
+("eii"	"L")
+("eiih"	"")
+("eijb"	"")
+("eijc"	"")
+("eik"	"Q")
+("eikf"	"")
+("eikk"	"")
+("eiku"	"O")
+("eilb"	"")
+("eile"	"t")
+("eill"	"w")
+("eilmi"	"D")
+("eilr"	"F")
+("eine"	"a")
+("eioc"	"")
+("eiok"	"]")
+("eipf"	"")
+("eir"	"v")
+("eirm"	"")
+("eirp"	"")
+("eitc"	"")
+("eite"	"")
+("eiv"	"")
+("eiwg"	"")
+("eixp"	"u")
+("ej"	"")
+("ejb"	"K")
+("ejbc"	"")
+("ejbd"	"J")
+("ejbj"	"")
+("ejbm"	"")
+("ejbv"	"")
+("ejc"	"")
+("ejcb"	"")
+("ejck"	"L")
+("ejcm"	"")
+("ejco"	"C")
+("ejcr"	"")
+("ejd"	"z_")
+("ejds"	"")
+("eje"	"[")
+("ejhf"	"m")
+("ejhq"	"H")
+("ejhw"	"n")
+("ejic"	"g")
+("ejii"	"w")
+("ejik"	"`")
+("ejip"	"Y")
+("ejir"	"")
+("ejjb"	"")
+("ejjj"	"R")
+("ejjl"	"")
+("ejjm"	"v")
+("ejjn"	"y")
+("ejka"	"Z")
+("ejkd"	"Q")
+("ejki"	"G")
+("ejks"	"Ϣ")
+("ejlv"	"Y")
+("ejmc"	"t")
+("ejme"	"n")
+("ejmf"	"F")
+("ejmm"	"")
+("ejmn"	"F")
+("ejmo"	"")
+("ejmu"	"F")
+("ejnu"	"")
+("ejp"	"b")
+("ejpn"	"")
+("ejpu"	"m")
+("ejqp"	"e")
+("ejr"	"f")
+("ejrb"	"")
+("ejrr"	"")
+("ejtc"	"")
+("ejv"	"}")
+("ejye"	"o")
+("ejyj"	"")
+("ek"	"")
+("ekb"	"")
+("ekc"	"t")
+("ekcf"	"")
+("ekf"	"Ϥ")
+("ekhr"	"")
+("eki"	"OR")
+("ekjt"	"")
+("ekkb"	"cW")
+("ekkk"	"")
+("ekld"	"t")
+("eklu"	"T")
+("ekms"	"r")
+("ekn"	"ɣp")
+("ekni"	"")
+("ekoo"	"H")
+("ekpb"	"")
+("eks"	"ɤ")
+("eksr"	"J")
+("el"	"R")
+("elbk"	"t")
+("elbu"	"H")
+("elg"	"P")
+("elgm"	"E")
+("elhi"	"")
+("elim"	"C")
+("elll"	"@X")
+("elln"	"m")
+("ellp"	"")
+("elmc"	"")
+("elmo"	"")
+("elmt"	"S")
+("elq"	"z")
+("elvu"	"W")
+("elw"	"o")
+("elwp"	"")
+("elws"	"c")
+("elwv"	"~")
+("elx"	"F")
+("elxh"	"")
+("elxl"	"W")
+("em"	"")
+("emam"	"")
+("embb"	"")
+("embe"	"")
+("embg"	"_")
+("embi"	"Xg")
+("embk"	"")
+("embl"	"ϥ")
+("embu"	"f")
+("emcw"	"ss")
+("emd"	"")
+("emdm"	"w")
+("emfb"	"Q")
+("emfj"	"")
+("emg"	"L")
+("emgg"	"P")
+("emgh"	"")
+("emhf"	"E")
+("emia"	"X")
+("emig"	"ϣ")
+("emj"	"")
+("emjk"	"A")
+("emlk"	"N")
+("emls"	"\")
+("emmc"	"")
+("emmf"	"")
+("emmi"	"N")
+("emmp"	"x")
+("emmr"	"O")
+("emms"	"")
+("emmu"	"J")
+("emn"	"")
+("emnn"	"{")
+("emnr"	"e")
+("emoa"	"")
+("emr"	"K")
+("emrb"	"N")
+("emrr"	"O")
+("emrt"	"M")
+("emrw"	"")
+("emso"	"g")
+("emt"	"L")
+("emtb"	"")
+("emua"	"")
+("emub"	"")
+("emvb"	"z")
+("emvg"	"")
+("emvi"	"P")
+("emvm"	"[")
+("emwd"	"")
+("emwf"	"}")
+("emwg"	"R")
+("emwj"	"")
+("emwl"	"B")
+("emyf"	"")
+("enao"	"M")
+("enau"	"Z")
+("enbk"	"A")
+("enbq"	"")
+("enbs"	"")
+("encr"	"F")
+("end"	"V")
+("ene"	"S")
+("enhb"	"D")
+("enhe"	"V")
+("enhx"	"")
+("eni"	"l")
+("enib"	"F")
+("enii"	"|")
+("enin"	"E")
+("enir"	"y")
+("enj"	"")
+("enkm"	"C")
+("enkq"	"Q")
+("enlb"	"a")
+("enlc"	"")
+("enld"	"Q")
+("enls"	"")
+("enmb"	"j")
+("enmm"	"")
+("enmu"	"Ϫ")
+("ennc"	"H")
+("enob"	"")
+("enoe"	"")
+("enok"	"")
+("enot"	"")
+("enqd"	"]")
+("enri"	"d")
+("ensj"	"")
+("ensv"	"")
+("enue"	"[")
+("enwf"	"")
+("eoah"	"")
+("eob"	"U")
+("eobt"	"s")
+("eodi"	"")
+("eodk"	"")
+("eog"	"a")
+("eogd"	"O")
+("eogf"	"N")
+("eohh"	"B")
+("eoii"	"~")
+("eoik"	"{")
+("eoim"	"b")
+("eoip"	"")
+("eoir"	"")
+("eoj"	"\")
+("eokf"	"c")
+("eolb"	"")
+("eold"	"")
+("eolk"	"[")
+("eoma"	"")
+("eomb"	"_e")
+("eomd"	"\")
+("eomm"	"R")
+("eomn"	"T")
+("eomo"	"F")
+("eomr"	"G")
+("eomt"	"J")
+("eon"	"")
+("eond"	"^")
+("eoob"	"a")
+("eook"	"k")
+("eop"	"]")
+("eora"	"`")
+("eosk"	"ϫ")
+("eotf"	"K")
+("eoto"	"")
+("eowy"	"")
+("ep"	"G")
+("epa"	"")
+("epd"	"m")
+("epfd"	"D")
+("eph"	"c")
+("ephh"	"W")
+("ephp"	"")
+("ephr"	"")
+("epi"	"")
+("epl"	"E")
+("epou"	"^")
+("epp"	"]")
+("eppa"	"")
+("epr"	"")
+("epru"	"w")
+("epsh"	"P")
+("ept"	"n")
+("eptd"	"")
+("epu"	"P")
+("epuk"	"")
+("epyr"	"H")
+("eqg"	"س")
+("eqhf"	"")
+("eqhl"	"")
+("eqjr"	"F")
+("eqka"	"P")
+("eqkd"	"L")
+("eqke"	"U")
+("eqkk"	"")
+("eqmb"	"M")
+("eqmc"	"{")
+("eqmf"	"M")
+("eqor"	"")
+("er"	"ʦ")
+("erau"	"J")
+("erb"	"")
+("erbc"	"\")
+("erhg"	"V")
+("erhu"	"p")
+("erji"	"")
+("ermr"	"")
+("erp"	"")
+("erpa"	"C")
+("errd"	"")
+("errj"	"I")
+("ersj"	"S")
+("eru"	"")
+("eruc"	"")
+("ervk"	"d")
+("ervp"	"{")
+("erxu"	"I")
+("eryo"	"U")
+("esbn"	"R")
+("esce"	"")
+("esd"	"")
+("eshr"	"h")
+("eshu"	"L")
+("esim"	"")
+("esip"	"G")
+("esit"	"")
+("esj"	"|")
+("esja"	"")
+("esjj"	"")
+("esjr"	"")
+("eskr"	"K")
+("esll"	"I")
+("esmb"	"|")
+("esmc"	"^")
+("esme"	"")
+("esmg"	"o")
+("esmh"	"{")
+("esmi"	"")
+("esmj"	"Z")
+("esmr"	"G")
+("esnd"	"")
+("esp"	"d")
+("esqf"	"Y")
+("esrj"	"")
+("esrr"	"x")
+("ess"	"H")
+("esu"	"")
+("esuu"	"")
+("eswu"	"")
+("esyi"	"")
+("etak"	"z")
+("etaw"	"")
+("etbc"	"")
+("etbn"	"")
+("etbo"	"")
+("etc"	"x")
+("etca"	"V")
+("etcd"	"E")
+("etcf"	"Y")
+("etcl"	"B")
+("etct"	"")
+("etcu"	"")
+("etge"	"y")
+("etgf"	"J")
+("etgi"	"U")
+("etgk"	"")
+("etgt"	"T")
+("etif"	"h")
+("etit"	"")
+("etk"	"~")
+("etkr"	"")
+("etlb"	"")
+("etlk"	"V")
+("etlo"	"~")
+("etlx"	"t")
+("etm"	"")
+("etmc"	"NC")
+("etmj"	"]")
+("etmr"	"")
+("etmv"	"")
+("etoe"	"")
+("etog"	"y")
+("etov"	"")
+("etpp"	"C")
+("etq"	"v")
+("etqm"	"K")
+("etrg"	"")
+("etst"	"")
+("ett"	"Mn")
+("ettb"	"")
+("ettc"	"")
+("etub"	"")
+("etvi"	"")
+("etvp"	"[")
+("etw"	"ϦU")
+("etwa"	"")
+("etwb"	"B")
+("etwi"	"")
+("etwt"	"C")
+("etwv"	"@")
+("etxc"	"I")
+("etym"	"C")
+("etys"	"B")
+("eu"	"")
+("eubb"	"")
+("euc"	"")
+("eugk"	"J")
+("eujt"	"")
+("eumb"	"")
+("eumf"	"E")
+("euog"	"")
+("euon"	"K")
+("eutt"	"")
+("euu"	"M")
+("ev"	"")
+("evfd"	"e")
+("evfg"	"")
+("evfn"	"W")
+("evid"	"")
+("evis"	"O")
+("evne"	"")
+("evr"	"v")
+("evug"	"")
+("evvd"	"")
+("evvw"	"d")
+("ew"	"")
+("ewb"	"")
+("ewc"	"r")
+("ewd"	"e")
+("ewdq"	"\")
+("ewfq"	"[")
+("ewg"	"@")
+("ewgf"	"H")
+("ewim"	"")
+("ewjr"	"U")
+("ewk"	"ϧ")
+("ewlb"	"B")
+("ewli"	"B")
+("ewlj"	"A")
+("ewln"	"`")
+("ewlo"	"")
+("ewlv"	"J")
+("ewml"	"")
+("ewmo"	"T")
+("ewmv"	"D")
+("ewno"	"Y")
+("ewo"	"s")
+("ewot"	"")
+("ewr"	"w")
+("ewtc"	"[")
+("ewtj"	"}")
+("ewvf"	"")
+("ewwg"	"")
+("eyaj"	"")
+("eybb"	"M")
+("eybc"	"")
+("eybg"	"")
+("eybk"	"")
+("eybp"	"]")
+("eybs"	"")
+("eybu"	"")
+("eycb"	"w")
+("eyck"	"m")
+("eycv"	"u")
+("eydk"	"T")
+("eydl"	"r")
+("eydu"	"\")
+("eyed"	"D")
+("eyem"	"c")
+("eyfe"	"Q")
+("eyg"	"`")
+("eyhc"	"x")
+("eyhm"	"s")
+("eyhn"	"Y")
+("eyhs"	"K")
+("eyib"	"R")
+("eyiu"	"y")
+("eyjc"	"")
+("eyjj"	"")
+("eyk"	"Z")
+("eylc"	"b")
+("eylh"	"A")
+("eylm"	"T")
+("eymh"	"")
+("eymp"	"u")
+("eyoj"	"f")
+("eyok"	"G")
+("eypd"	"")
+("eypk"	"")
+("eypo"	"")
+("eypp"	"o")
+("eypt"	"y")
+("eypu"	"A")
+("eyr"	"g")
+("eyrb"	"E")
+("eyrd"	"E")
+("eyrf"	"D")
+("eyrj"	"q")
+("eyrn"	"s")
+("eyro"	"")
+("eyru"	"N")
+("eyrv"	"[")
+("eysd"	"O")
+("eyso"	"x")
+("eysy"	"J")
+("eyt"	"_")
+("eyta"	"")
+("eytb"	"")
+("eytg"	"")
+("eytj"	"s")
+("eytp"	"")
+("eytr"	"e")
+("eyub"	"v")
+("eyuh"	"")
+("eyv"	"")
+("eyvg"	"")
+("eyvi"	"")
+("eyvw"	"G")
+("eywi"	"")
+("eywm"	"G")
+("eywv"	"Df")
+("eyx"	"")
+("eyy"	"X")
+("f"	"")
+("fab"	"c")
+("fafu"	"")
+("faht"	"d")
+("fahu"	"h")
+("fam"	"ϯ")
+("famh"	"")
+("famj"	"k")
+("fank"	"T")
+("fanp"	"T")
+("fanw"	"")
+("fanx"	"j")
+("fapp"	"O")
+("fate"	"z")
+("fawe"	"r")
+("fayt"	"")
+("fb"	"v")
+("fbac"	"")
+("fbbe"	"a")
+("fbhaf"	"")
+("fbjj"	"b")
+("fbkf"	"U")
+("fbln"	"d")
+("fbme"	"")
+("fbmr"	"u")
+("fbnd"	"N")
+("fbok"	"ʹ")
+("fbr"	"|")
+("fbrbc"	"")
+("fbrd"	"")
+("fbrg"	"")
+("fbrhu"	"")
+("fbrlb"	"`")
+("fbrmh"	"g")
+("fbrmn"	"޹")
+("fbrpa"	"")
+("fbrq"	"x")
+("fbrw"	"")
+("fbrwf"	"")
+("fbryv"	"n")
+("fbwi"	"")
+("fbyh"	"S")
+("fcb"	"")
+("fci"	"X")
+("fcnh"	"I")
+("fcor"	"V")
+("fd"	"V")
+("fdamg"	"³")
+("fdau"	"J")
+("fdbm"	"")
+("fdbmr"	"")
+("fdbt"	"")
+("fdbuu"	"V")
+("fdcsh"	"")
+("fddh"	"")
+("fddi"	"G")
+("fddj"	"")
+("fdeii"	"")
+("fdha"	"")
+("fdhe"	"I")
+("fdhhj"	"a")
+("fdhj"	"I")
+("fdhoa"	"")
+("fdhqu"	"N")
+("fdhuk"	"")
+("fdibi"	"")
+("fdig"	"")
+("fdiih"	"X")
+("fdile"	"R")
+("fdilr"	"}")
+("fdixp"	"")
+("fdj"	"ͨ")
+("fdjk"	"H")
+("fdjmf"	"")
+("fdjrb"	"k")
+("fdk"	"P")
+("fdma"	"")
+("fdmbb"	"z")
+("fdmcw"	"")
+("fdmlk"	"e")
+("fdmq"	"d")
+("fdmtb"	"")
+("fdnd"	"")
+("fdng"	"M")
+("fdnhd"	"")
+("fdnii"	"")
+("fdnj"	"E")
+("fdnl"	"L")
+("fdnmm"	"")
+("fdnob"	"")
+("fdok"	"")
+("fdon"	"D")
+("fdphh"	"O")
+("fdqmb"	"")
+("fdsit"	"")
+("fdsmv"	"^")
+("fdss"	"")
+("fdtak"	"U")
+("fdtaw"	"")
+("fdtbn"	"")
+("fdtgf"	"|")
+("fdthb"	"")
+("fdtwa"	"V")
+("fdv"	"F")
+("fdwd"	"_")
+("fdwf"	"")
+("fdwg"	"U")
+("fdwji"	"{")
+("fdwla"	"")
+("fdwtc"	"T")
+("fdy"	"s")
+("fdyhr"	"W")
+("fdyj"	"")
+("fdyoj"	"")
+("fdyr"	"")
+("fdyt"	"")
+("ff"	"")
+("ffbb"	"")
+("ffbbu"	"{")
+("ffbc"	"j")
+("ffbd"	"a")
+("ffbe"	"l")
+("ffbf"	"")
+("ffbg"	"")
+("ffbhf"	"a")
+("ffbhq"	"")
+("ffbks"	"")
+("ffbli"	"")
+("ffbmf"	"")
+("ffbmg"	"")
+("ffbmn"	"")
+("ffbmw"	"")
+("ffbnj"	"i")
+("ffbou"	"")
+("ffbrr"	"")
+("ffbuu"	"")
+("ffbv"	"")
+("ffbvf"	"")
+("ffbyr"	"")
+("ffbyv"	"t")
+("ffdq"	"M")
+("ffe"	"")
+("fff"	"]")
+("fffd"	"P")
+("ffff"	"W")
+("ffh"	"")
+("ffln"	"")
+("ffmbc"	"J")
+("ffnl"	"")
+("ffno"	"")
+("ffye"	"x")
+("ffypu"	"")
+("ffyr"	"c")
+("fg"	"_")
+("fgg"	"k")
+("fggu"	"N")
+("fgit"	"")
+("fgni"	"")
+("fh"	"")
+("fhag"	"")
+("fhbk"	"")
+("fhbt"	"w")
+("fhbu"	"")
+("fhdf"	"w")
+("fhdn"	"o")
+("fhdw"	"O")
+("fhej"	"l")
+("fher"	"O")
+("fhey"	"ϵ")
+("fhge"	"")
+("fhgf"	"t")
+("fhgu"	"v")
+("fhjg"	"v")
+("fhkb"	"V")
+("fhks"	"H")
+("fhlo"	"\")
+("fhml"	"Q")
+("fhon"	"x")
+("fhs"	"")
+("fhsb"	"k")
+("fhsm"	"")
+("fhsu"	"h")
+("fhup"	"")
+("fhwp"	"p")
+("fiav"	"H")
+("fice"	"M")
+("fihr"	"o")
+("fijb"	"P")
+("filii"	"")
+("filr"	"")
+("fipf"	"j")
+("fipm"	"r")
+("fitc"	"i")
+("fixp"	"j")
+("fjcm"	"`")
+("fjcr"	"")
+("fjhp"	"p")
+("fjks"	"N")
+("fjmu"	"J")
+("fjnu"	"_")
+("fk"	"y")
+("fkb"	"t")
+("fkbu"	"h")
+("fkcf"	"R")
+("fkgg"	"p")
+("fkhaf"	"")
+("fkhqu"	"")
+("fkik"	"u")
+("fkkb"	"m")
+("fklb"	"")
+("fklmi"	"o")
+("fkmbc"	"")
+("fkmnp"	"")
+("fkn"	"")
+("fknwf"	"ž")
+("fkp"	"x")
+("fkrau"	"J")
+("fkryo"	"D")
+("fksb"	"")
+("fksc"	"_")
+("fkt"	"")
+("fkv"	"s")
+("flbk"	"ϴ")
+("flii"	"")
+("flmo"	"l")
+("flmt"	"u")
+("flwv"	"n")
+("flx"	"S")
+("fm"	"^")
+("fmam"	"j")
+("fmbb"	"w")
+("fmbc"	"")
+("fmbm"	"")
+("fmmr"	"Q")
+("fmob"	"")
+("fmso"	"R")
+("fmu"	"")
+("fmua"	"J")
+("fmvm"	"L")
+("fmwf"	"d")
+("fmwg"	"")
+("fmwj"	"H")
+("fmym"	"ϳ")
+("fnbk"	"")
+("fng"	"U")
+("fnhb"	"R")
+("fnhd"	"e")
+("fnhx"	"K")
+("fnkg"	"X")
+("fnkm"	"[")
+("fnkq"	"m")
+("fno"	"")
+("fnot"	"O")
+("fnq"	"x")
+("fo"	"\")
+("fog"	"")
+("fogf"	"N")
+("foii"	"϶")
+("foir"	"U")
+("foma"	"")
+("fomb"	"")
+("fomg"	"y")
+("fomr"	"z")
+("fond"	"")
+("fowy"	"W")
+("fpd"	"_")
+("fpi"	"`")
+("fpru"	"")
+("fptd"	"f")
+("fpu"	"W")
+("fq"	"b")
+("fqbu"	"")
+("fqdmq"	"")
+("fqhe"	"q")
+("fqhq"	"Ң")
+("fqlb"	"β")
+("fqln"	"P")
+("fqmbc"	"")
+("fqmso"	"")
+("fqmvn"	"o")
+("fqn"	"μ")
+("fqnbg"	"A")
+("fqnl"	"F")
+("fqq"	"")
+("fqsh"	"")
+("fqsmm"	"z")
+("fqsu"	"")
+("fqu"	"ܱ")
+("fqvif"	"")
+("fqvv"	"`")
+("fqymu"	"")
+("frb"	"T")
+("frbc"	"")
+("frhu"	"ϰ")
+("frrd"	"")
+("frrj"	"L")
+("frrr"	"r")
+("frye"	"")
+("fseg"	"l")
+("fsh"	"A")
+("fshr"	"")
+("fsit"	"")
+("fsma"	"f")
+("fsmg"	"")
+("fsmi"	"K")
+("fsmt"	"m")
+("fsrr"	"e")
+("fss"	"")
+("fssr"	"K")
+("fswu"	"")
+("fta"	"b")
+("ftc"	"M|")
+("ftcw"	"l")
+("ftgi"	"^")
+("ftgs"	"k")
+("ftlj"	"n")
+("ftlk"	"t")
+("ftlo"	"c")
+("ftmc"	"I")
+("ftmd"	"")
+("ftmj"	"M")
+("ftmv"	"g")
+("ftq"	"L")
+("ftrg"	"")
+("ftwb"	"`")
+("ftwi"	"Q")
+("fubjj"	"")
+("fumb"	"u")
+("fusmg"	"ģ")
+("fvid"	"{")
+("fwb"	"s")
+("fwgg"	"m")
+("fwli"	"")
+("fwlj"	"\")
+("fwmbc"	"X")
+("fwmv"	"")
+("fwot"	"")
+("fwtc"	"U")
+("fwtj"	"g")
+("fyaj"	"Z")
+("fycb"	"i")
+("fydk"	"L")
+("fyed"	"")
+("fyg"	"Ϯ")
+("fyhn"	"")
+("fyia"	"K")
+("fyj"	"S")
+("fyk"	"T")
+("fynb"	"k")
+("fyoj"	"X")
+("fyok"	"a")
+("fypt"	"l")
+("fyrb"	"")
+("fyrd"	"Y")
+("fyrv"	"")
+("fyto"	"")
+("fytp"	"]")
+("fytr"	"H")
+("fyvi"	"")
+("fyvo"	"q")
+("g"	"g")
+("gagi"	"")
+("gahu"	"ث")
+("gam"	"Z")
+("gamh"	"")
+("gamo"	"")
+("ganx"	"")
+("gaph"	"Է")
+("gapv"	"إ")
+("gasm"	"")
+("gav"	"")
+("gawe"	"[")
+("gb"	"T")
+("gbac"	"")
+("gbb"	"Ը")
+("gbbr"	"")
+("gbcd"	"Ԯ")
+("gbd"	"")
+("gbdi"	"M")
+("gbhne"	"}")
+("gblm"	"")
+("gbmc"	"")
+("gbmm"	"")
+("gbmo"	"")
+("gbmr"	"T")
+("gbmt"	"")
+("gbnd"	"N")
+("gbr"	"")
+("gbsd"	"")
+("gbtu"	"Զ")
+("gby"	"~")
+("gcbuu"	"S")
+("gcdhe"	"r")
+("gcg"	"")
+("gcglc"	"")
+("gche"	"B")
+("gcilr"	"")
+("gcim"	"")
+("gcjka"	"")
+("gclmi"	"\")
+("gcnau"	"]")
+("gcnl"	"q")
+("gcok"	"j")
+("gcrxu"	"")
+("gcrye"	"")
+("gcsh"	"ʮ")
+("gcsle"	"i")
+("gcwa"	"W")
+("gcybc"	"")
+("gdhe"	"Y")
+("gdhne"	"\B")
+("gdi"	"x")
+("gdw"	"")
+("gdwf"	"ة")
+("gebu"	"¢")
+("gec"	"u")
+("gee"	"S")
+("geeii"	"y")
+("gefbg"	"")
+("gehda"	"")
+("gehey"	"]")
+("gehhj"	"g")
+("gehkb"	"")
+("gehor"	"")
+("gelmi"	"m")
+("gelxl"	"")
+("gemr"	"k")
+("geoju"	"j")
+("gep"	"")
+("gesj"	"n")
+("gesmv"	"")
+("geymr"	"")
+("geyta"	"M")
+("gfcb"	"")
+("gff"	"Լ")
+("gfhne"	"")
+("gfmu"	"[")
+("gfno"	"")
+("gfq"	"")
+("gfqu"	"ԯ")
+("gg"	"c")
+("ggce"	"")
+("ggdi"	"")
+("ggff"	"G")
+("ggg"	"]")
+("gggu"	"K")
+("gghaf"	"")
+("ggkni"	"԰")
+("ggln"	"")
+("ggni"	"")
+("ggnl"	"и")
+("ggow"	"")
+("ggp"	"}")
+("ggy"	"")
+("ghag"	"ر")
+("ghbk"	"M")
+("ghdw"	"\")
+("ghfd"	"")
+("ghgf"	"")
+("ghhj"	"")
+("ghhw"	"")
+("ghi"	"")
+("ghjg"	"د")
+("ghjm"	"ئ")
+("ghml"	"")
+("ghmr"	"")
+("ghmvn"	"r")
+("ghmy"	"\")
+("ghnd"	"W")
+("ghni"	"ذ")
+("ghpm"	"")
+("ghrf"	"")
+("ghrj"	"")
+("ghsk"	"J")
+("ghvp"	"ʪ")
+("ghxu"	"")
+("gi"	"h")
+("giapv"	"")
+("giav"	"J")
+("gibt"	"r")
+("gibuc"	"")
+("gid"	"")
+("gif"	"")
+("gig"	"")
+("gihab"	"")
+("gihaf"	"")
+("gihq"	"~")
+("gihr"	"ج")
+("gihs"	"")
+("giih"	"^")
+("gijb"	"H")
+("giks"	"T")
+("gilb"	"V")
+("gilmi"	"h")
+("gilr"	"")
+("ginl"	"й")
+("ginn"	"T")
+("giok"	"J")
+("gip"	"z")
+("giq"	"")
+("girm"	"")
+("girxu"	"")
+("gismm"	"")
+("gisqf"	"~")
+("gitc"	"R")
+("gitlj"	"}")
+("givif"	"")
+("gixp"	"c")
+("giymr"	"")
+("gjbc"	"")
+("gjbm"	"Բ")
+("gjcr"	"")
+("gjhne"	"")
+("gjhp"	"Q")
+("gjhvo"	"޶")
+("gjii"	"W")
+("gjjn"	"Y")
+("gjka"	"")
+("gjkni"	"")
+("gjmu"	"R")
+("gjp"	"@")
+("gjsle"	"")
+("gjtc"	"X")
+("gjv"	"P")
+("gkbt"	"y")
+("gkbuc"	"")
+("gkc"	"l")
+("gkf"	"")
+("gkik"	"v")
+("gkkk"	"")
+("gklmi"	"g")
+("gkmb"	"ح")
+("gkmr"	"")
+("gkms"	"")
+("gknwf"	"")
+("gkpb"	"Z")
+("gkq"	"")
+("gkrxu"	"R")
+("gksj"	"m")
+("gksqf"	"}")
+("gkymr"	"")
+("glbk"	"")
+("gle"	"Դ")
+("glll"	"`")
+("glln"	"")
+("glmo"	"U")
+("glnc"	"")
+("glq"	"Z")
+("glwl"	"[")
+("glwv"	"\")
+("gmam"	"")
+("gmbb"	"")
+("gmbk"	"أ")
+("gmc"	"")
+("gmd"	"f")
+("gmdm"	"c")
+("gmf"	"")
+("gmfj"	"W")
+("gmfm"	"")
+("gmgg"	"")
+("gmig"	"S")
+("gmlk"	"G")
+("gmlm"	"")
+("gmms"	"d")
+("gmn"	"n")
+("gmnr"	"V")
+("gmrb"	"")
+("gmrw"	"ت")
+("gmwd"	"")
+("gmwf"	"d")
+("gmwg"	"ء")
+("gnbg"	"O")
+("gnhe"	"")
+("gnhne"	"b")
+("gnhx"	"Թ")
+("gnib"	"U")
+("gnkm"	"Ժ")
+("gnmf"	"v")
+("gnmi"	"")
+("gnmu"	"V")
+("gno"	"")
+("gnot"	"L")
+("gnui"	"")
+("goamj"	"")
+("goamo"	"")
+("gobm"	"")
+("goc"	"")
+("godk"	"")
+("gofb"	"")
+("gofbr"	"")
+("gofh"	"")
+("gog"	"")
+("goggu"	"K")
+("gogr"	"_")
+("gohjd"	"`")
+("gohjr"	"a")
+("gohkb"	"N")
+("gohnd"	"c")
+("gohne"	"")
+("gohuc"	"o")
+("goii"	"A")
+("goik"	"Y")
+("goimo"	"^")
+("goin"	"ʫ")
+("goiv"	"V")
+("goks"	"в")
+("golmo"	"f")
+("golxh"	"")
+("gom"	"")
+("gomj"	"")
+("gomn"	"ز")
+("gomnn"	"d")
+("gomr"	"\")
+("gon"	"")
+("gonin"	"b")
+("gonk"	"")
+("goog"	"")
+("googf"	"M")
+("goohh"	"X")
+("gooog"	"V")
+("gopfd"	"")
+("gopim"	"")
+("gopuu"	"")
+("gorrd"	"")
+("goru"	"_")
+("goshr"	"W")
+("gosje"	"")
+("gosmg"	"T")
+("gosmm"	"e")
+("gotcw"	"")
+("gotmc"	"L")
+("gou"	"")
+("gouu"	"")
+("govl"	"v")
+("gowr"	"")
+("goy"	"u")
+("goyaj"	"")
+("gp"	"")
+("gpbuu"	"E")
+("gpd"	"a")
+("gpi"	"")
+("gpim"	"")
+("gpmm"	"}")
+("gptd"	"آ")
+("gpu"	"ʭ")
+("gqjl"	"W")
+("gqkq"	"Ծ")
+("gqmb"	"Կ")
+("gr"	"N")
+("grbc"	"")
+("grbg"	"O")
+("grgrr"	"")
+("grhaf"	"y")
+("grhg"	"L")
+("grhne"	"")
+("grhv"	"K")
+("grks"	"")
+("grmbc"	"e")
+("grmfr"	"")
+("grno"	"")
+("grrj"	"M")
+("grrk"	"")
+("grrs"	"خ")
+("grrv"	"")
+("grt"	"_")
+("grtf"	"Q")
+("grtr"	"߹")
+("gru"	"e")
+("grye"	"")
+("gsav"	"")
+("gsit"	"")
+("gsjt"	"B")
+("gsmb"	"Ե")
+("gsme"	"V")
+("gsok"	"")
+("gsp"	"")
+("gsu"	"")
+("gsuu"	"Գ")
+("gsyq"	"U")
+("gtak"	"f")
+("gtco"	"N")
+("gtcp"	"")
+("gtdi"	"")
+("gtgr"	"R")
+("gtgt"	"")
+("gthhh"	"^")
+("gtiop"	"t")
+("gtj"	"")
+("gtje"	"")
+("gtlm"	"X")
+("gtm"	"X")
+("gtmv"	"")
+("gtor"	"")
+("gtq"	"R")
+("gtss"	"i")
+("gtu"	"ܲ")
+("gtvs"	"e")
+("gtwi"	"JS")
+("gu"	"Y")
+("gubb"	"]")
+("guhne"	"")
+("gumbc"	"r")
+("gumt"	"")
+("guog"	"g")
+("guon"	"X")
+("gusmm"	"¼")
+("gvis"	"")
+("gwd"	"")
+("gwg"	"I")
+("gwj"	"H")
+("gwjr"	"")
+("gwlb"	"ؤ")
+("gwlc"	"")
+("gwlj"	"L")
+("gwlm"	"")
+("gwot"	"")
+("gwyi"	"")
+("gybs"	"")
+("gycb"	"a")
+("gydk"	"[")
+("gydl"	"b")
+("gyfe"	"")
+("gyhn"	"|")
+("gyhs"	"{")
+("gyib"	"K")
+("gylc"	"")
+("gylm"	"}")
+("gyo"	"")
+("gyoj"	"Խ")
+("gypm"	"V")
+("gypo"	"K")
+("gypt"	"")
+("gyr"	"")
+("gyrb"	"")
+("gyrd"	"ԭ")
+("gyro"	"")
+("gyrv"	"[")
+("gyt"	"U")
+("gyta"	"~")
+("gytg"	"Q")
+("gytj"	"S`")
+("gytr"	"")
+("gytu"	"")
+("gyvo"	"")
+("gywd"	"I")
+("gywm"	"")
+("gywv"	"a")
+("h"	"")
+("ha"	"")
+("habwi"	"")
+("hae"	"u")
+("hahaa"	"")
+("hahaj"	"")
+("hahdw"	"x")
+("hahe"	"")
+("hahgr"	"q")
+("hahi"	"z")
+("hahqi"	"ڸ")
+("hahsk"	"Q")
+("hail"	"`")
+("haipf"	"p")
+("haj"	"q")
+("hajbd"	"`")
+("hajmu"	"p")
+("hakj"	"o")
+("haklu"	"V")
+("halb"	"")
+("halmy"	"W")
+("ham"	"")
+("hamg"	"")
+("hamj"	"Q")
+("hana"	"²")
+("hank"	"j")
+("hanw"	"")
+("haoae"	"L")
+("haoii"	"")
+("hap"	"m")
+("haph"	"")
+("hapi"	"")
+("hasp"	"")
+("hatt"	"֥")
+("hatxc"	"")
+("hau"	"G")
+("haumt"	"J")
+("havid"	"q")
+("havt"	"")
+("hawot"	"")
+("hayck"	"")
+("hayd"	"")
+("hayf"	"")
+("haymp"	"֦")
+("hayrb"	"")
+("hayu"	"q")
+("hayv"	"")
+("hbbm"	"")
+("hbbuu"	"ı")
+("hbddf"	"y")
+("hbe"	"O")
+("hbf"	"bl")
+("hbfe"	"")
+("hbg"	"P")
+("hbhaf"	"j")
+("hbhgr"	"A")
+("hbk"	"")
+("hbks"	"")
+("hbln"	"")
+("hbmbc"	"I")
+("hbmch"	"]")
+("hbmgi"	"o")
+("hbmr"	"[")
+("hbmvn"	"")
+("hbnbg"	"")
+("hbnd"	"")
+("hbnl"	"[")
+("hbnwf"	"M")
+("hbok"	"")
+("hbq"	"F")
+("hbr"	"V")
+("hbsd"	"")
+("hbse"	"[")
+("hbsmm"	"")
+("hbt"	"")
+("hbtmc"	"d")
+("hbu"	"f")
+("hbuf"	"ġ")
+("hbuh"	"")
+("hbui"	"y")
+("hbut"	"")
+("hbuu"	"c")
+("hbyi"	"")
+("hchaf"	"a")
+("hchg"	"")
+("hcii"	"")
+("hcjwj"	"Y")
+("hcln"	"B")
+("hcmr"	"")
+("hcnl"	"Zf")
+("hcno"	"j")
+("hcq"	"|")
+("hcv"	"Y")
+("hcve"	"")
+("hcymr"	"A")
+("hd"	"")
+("hda"	"")
+("hdaiu"	"E")
+("hdamj"	"z")
+("hdb"	"")
+("hdbgb"	"")
+("hdbgr"	"Y")
+("hdbhx"	"_")
+("hdbm"	"")
+("hdbmp"	"í")
+("hdbnd"	"")
+("hdbof"	"")
+("hdbt"	"")
+("hdbu"	"c")
+("hdbwi"	"")
+("hdcnh"	"")
+("hdcru"	"|")
+("hdcsh"	"")
+("hdd"	"S")
+("hddj"	"")
+("hddmq"	"I")
+("hdf"	"")
+("hdfb"	"y")
+("hdfh"	"")
+("hdgce"	"W")
+("hdgcg"	"")
+("hdggu"	"")
+("hdgow"	"¨")
+("hdgr"	"")
+("hdhaf"	"}")
+("hdhah"	"p")
+("hdhd"	"")
+("hdhhj"	"")
+("hdhjg"	"")
+("hdhkb"	"")
+("hdhne"	"")
+("hdhp"	"ͤ")
+("hdhpm"	"")
+("hdhqo"	"")
+("hdhqu"	"")
+("hdhsb"	"H")
+("hdhu"	"r")
+("hdhvp"	"")
+("hdi"	"p")
+("hdiav"	"")
+("hdice"	"")
+("hdiih"	"")
+("hdijc"	"")
+("hdipf"	"")
+("hdir"	"")
+("hdirm"	"")
+("hditc"	"")
+("hdiua"	"]")
+("hdiuu"	"R")
+("hdjbc"	"")
+("hdjbm"	"")
+("hdjhp"	"")
+("hdjip"	"J")
+("hdjmo"	"[")
+("hdkkb"	"}")
+("hdl"	"")
+("hdlbk"	"")
+("hdlc"	"ţ")
+("hdln"	"Q")
+("hdlo"	"P")
+("hdlp"	"")
+("hdlw"	"V")
+("hdlxh"	"")
+("hdm"	"")
+("hdmfj"	"")
+("hdmfm"	"")
+("hdmig"	"")
+("hdmrw"	"D")
+("hdmvn"	"")
+("hdnd"	"u")
+("hdnhs"	"q")
+("hdnin"	"")
+("hdnl"	"мp")
+("hdnmu"	"")
+("hdnob"	"F")
+("hdnwa"	"")
+("hdoe"	"")
+("hdog"	"X")
+("hdogf"	"")
+("hdoip"	"Z")
+("hdomb"	"A")
+("hdomd"	"")
+("hdoo"	"]")
+("hdp"	"x")
+("hdph"	"")
+("hdpp"	"")
+("hdqmc"	"n")
+("hdr"	"M")
+("hdrhg"	"{")
+("hdsmh"	"r")
+("hdsp"	"")
+("hdss"	"")
+("hdta"	"")
+("hdtmc"	"")
+("hdtoe"	"ì")
+("hdtwv"	"ª")
+("hdu"	"")
+("hduce"	"G")
+("hdv"	"e")
+("hdvii"	"")
+("hdw"	"f")
+("hdwce"	"^")
+("hdwd"	"\")
+("hdwhd"	"@")
+("hdwjr"	"")
+("hdwlj"	"")
+("hdyj"	"")
+("hdymh"	"©")
+("hdyrb"	"Z")
+("hdyrd"	"")
+("hdyrv"	"")
+("hdytg"	"")
+("hdyto"	"`")
+("hdyx"	"")
+("he"	"")
+("heag"	"")
+("heah"	"a")
+("hebt"	"L")
+("hed"	"n")
+("heg"	"Q")
+("heha"	"")
+("hehee"	"")
+("hehw"	"")
+("heii"	"ï")
+("heir"	"N")
+("helb"	"\")
+("hemr"	"Y")
+("henl"	"")
+("hep"	"")
+("heq"	"")
+("heqj"	"ʰ")
+("her"	"U")
+("hesu"	"")
+("hetc"	"")
+("hetlj"	"")
+("hev"	"")
+("hevif"	"")
+("hey"	"V")
+("heyhv"	"x")
+("heyli"	"n")
+("heyr"	"H")
+("heyub"	"u")
+("hfaht"	"")
+("hfate"	"{")
+("hfb"	"K")
+("hfbn"	"")
+("hfbw"	"")
+("hfd"	"G")
+("hfdk"	"")
+("hffs"	"b")
+("hfhaf"	"")
+("hfhn"	"")
+("hfhrb"	"")
+("hfhu"	"")
+("hfhyu"	"")
+("hfice"	"")
+("hfjc"	"")
+("hfjp"	"k")
+("hfks"	"")
+("hflmi"	"")
+("hfmvn"	"")
+("hfn"	"ܯ")
+("hfnl"	"")
+("hfno"	"d")
+("hfog"	"")
+("hfomd"	"")
+("hfp"	"T")
+("hfq"	"y")
+("hfsqf"	"")
+("hftgi"	"")
+("hftmc"	"")
+("hfv"	"")
+("hfydk"	"a")
+("hg"	"")
+("hgcr"	"f")
+("hgdi"	"")
+("hgea"	"N")
+("hgf"	"")
+("hgfmu"	"")
+("hgg"	"")
+("hghne"	"")
+("hghu"	"")
+("hgi"	"")
+("hgit"	"")
+("hgks"	"")
+("hgmbc"	"U")
+("hgni"	"w")
+("hgpm"	"a")
+("hgr"	"i")
+("hgrg"	"")
+("hgrly"	"a")
+("hhag"	"h")
+("hhail"	"")
+("hhbuc"	"T")
+("hhdi"	"g")
+("hhdn"	"S")
+("hhfbr"	"")
+("hhffs"	"U")
+("hhgr"	"R")
+("hhgu"	"")
+("hhhaf"	"")
+("hhhj"	"")
+("hhhnd"	"")
+("hhj"	"")
+("hhjm"	"i")
+("hhjmc"	"")
+("hhjr"	"")
+("hhk"	"")
+("hhkb"	"k")
+("hhlo"	"E")
+("hhmbc"	"")
+("hhn"	"`")
+("hhnwf"	"")
+("hhoe"	"")
+("hhol"	"")
+("hhoo"	"")
+("hhqm"	"")
+("hhrb"	"z")
+("hhs"	"")
+("hhsav"	"")
+("hhsb"	"g")
+("hhsl"	"f")
+("hhslc"	"\")
+("hhsld"	"")
+("hhsle"	"")
+("hhsli"	"Z")
+("hhsrr"	"")
+("hhuc"	"")
+("hhw"	"d")
+("hhwgf"	"")
+("hhwp"	"{")
+("hhxc"	"")
+("hhyu"	"")
+("hi"	"\")
+("hiav"	"G")
+("hibt"	"d")
+("hibtv"	"S")
+("hifb"	"i")
+("hihaf"	"Z")
+("hihml"	"")
+("hihq"	"")
+("hihr"	"e")
+("hii"	"")
+("hiih"	"")
+("hiikk"	"")
+("hiirm"	"")
+("hiiv"	"")
+("hijd"	"y")
+("hije"	"")
+("himlb"	"R")
+("himwf"	"")
+("hino"	"F")
+("hiog"	"")
+("hir"	"")
+("hit"	"")
+("hitc"	"î")
+("hitmc"	"")
+("hivii"	"")
+("hixp"	"")
+("hiyj"	"")
+("hiypm"	"")
+("hiyub"	"^")
+("hj"	"d")
+("hjbu"	"")
+("hjcm"	"O")
+("hjd"	"")
+("hjhaf"	"")
+("hjhne"	"q")
+("hjhx"	"h")
+("hjii"	"c")
+("hjjj"	"")
+("hjjo"	"")
+("hjju"	"d")
+("hjka"	"")
+("hjlo"	"Q")
+("hjlp"	"")
+("hjmbc"	"G")
+("hjmk"	"")
+("hjmu"	"F")
+("hjnl"	"")
+("hjr"	"")
+("hjrr"	"")
+("hjsmm"	"")
+("hjtm"	"")
+("hjwg"	"")
+("hk"	"")
+("hka"	"")
+("hkcf"	"g")
+("hkd"	"")
+("hkhaf"	"")
+("hkk"	"B")
+("hklmi"	"")
+("hklq"	"F")
+("hkoo"	"I")
+("hkp"	"g")
+("hkr"	"]")
+("hkrbr"	"")
+("hks"	"ͧ")
+("hksr"	"")
+("hku"	"j")
+("hkvif"	"v")
+("hkymr"	"")
+("hlapv"	"}")
+("hlbi"	"")
+("hlbuc"	"")
+("hlha"	"")
+("hljbv"	"")
+("hlkn"	"")
+("hlle"	"")
+("hllj"	"l")
+("hlln"	"")
+("hlmbc"	"")
+("hlmc"	"±")
+("hlmj"	"M")
+("hlmmf"	"m")
+("hlmo"	"")
+("hlmvn"	"")
+("hlno"	"Y")
+("hlo"	"")
+("hlpr"	"")
+("hlq"	"")
+("hltwv"	"")
+("hlvk"	"")
+("hlvvu"	"")
+("hlw"	"")
+("hlwli"	"")
+("hlwv"	"M")
+("hlx"	"­")
+("hlxh"	"")
+("hlypm"	"f")
+("hm"	"C")
+("hmbc"	"")
+("hmbg"	"")
+("hmbu"	"")
+("hmd"	"")
+("hmgn"	"U")
+("hmgt"	"H")
+("hmhaf"	"")
+("hmhqm"	"")
+("hmj"	"")
+("hml"	"")
+("hmm"	"")
+("hmmu"	"F")
+("hmmvn"	"")
+("hmnd"	"v")
+("hmnj"	"")
+("hmnl"	"l")
+("hmnq"	"")
+("hmnr"	"")
+("hmoo"	"b")
+("hmr"	"Z")
+("hmrg"	"^")
+("hmsl"	"")
+("hmsmb"	"k")
+("hmsu"	"g")
+("hmt"	"@")
+("hmua"	"¯")
+("hmwd"	"")
+("hmwf"	"")
+("hmwj"	"e")
+("hmwks"	"c")
+("hmy"	"")
+("hn"	"L")
+("hnamh"	"G")
+("hnbmc"	"")
+("hncr"	"ò")
+("hnd"	"")
+("hndo"	"V")
+("hne"	"_")
+("hnef"	"")
+("hneii"	"")
+("hnhag"	"")
+("hnhe"	"D")
+("hnhhh"	"ܭ")
+("hnhhw"	"u")
+("hnhjr"	"h")
+("hnhli"	"")
+("hnhq"	"p")
+("hnhxe"	"B")
+("hni"	"Z")
+("hnib"	"J")
+("hnir"	"")
+("hnkcf"	"s")
+("hnkg"	"M")
+("hnkm"	"")
+("hnld"	"")
+("hnlh"	"")
+("hnmaf"	"")
+("hnmgh"	"u")
+("hnmm"	"x")
+("hnmni"	"g")
+("hnmnn"	"")
+("hnmvh"	"")
+("hnot"	"h")
+("hnp"	"^")
+("hnpru"	"")
+("hnq"	"w")
+("hnryo"	"c")
+("hnsmh"	"S")
+("hnwp"	"")
+("hnyhv"	"s")
+("hnymr"	"Y")
+("hnyr"	"")
+("ho"	"KL")
+("hoa"	"")
+("hoami"	"o")
+("hoamo"	"")
+("hoau"	"")
+("hoaue"	"I")
+("hoav"	"")
+("hobc"	"~")
+("hobg"	"")
+("hobgn"	"")
+("hobgr"	"P")
+("hobm"	"u")
+("hobou"	"d")
+("hobrn"	"")
+("hobvk"	"c")
+("hoci"	"")
+("hocmn"	"")
+("hodhe"	"")
+("hodi"	"")
+("hodmq"	"")
+("hodoo"	"t")
+("hodqn"	"")
+("hoemn"	"l")
+("hof"	"q")
+("hofbk"	"")
+("hofbr"	"u")
+("hogdi"	"")
+("hoggn"	"")
+("hogyo"	"{")
+("hohaf"	"")
+("hohag"	"a")
+("hohgn"	"")
+("hohju"	"`")
+("hohne"	"")
+("hohpm"	"w")
+("hohqo"	"Ҽ")
+("hohs"	"O")
+("hohsk"	"u")
+("hoi"	"")
+("hoicn"	"N")
+("hoii"	"")
+("hoim"	"")
+("hoin"	"H")
+("hojmf"	"O")
+("hojrn"	"")
+("hojwp"	"w")
+("hokmr"	"N")
+("hoks"	"p")
+("hold"	"Q")
+("holii"	"")
+("holk"	"N")
+("holln"	"")
+("holmy"	"r")
+("holq"	"")
+("homb"	"")
+("homcw"	"ξ")
+("homd"	"P")
+("homg"	"")
+("homjn"	"Ы")
+("homk"	"")
+("hommn"	"")
+("homo"	"ñ")
+("homr"	"")
+("homrn"	"")
+("homvm"	"|")
+("homym"	"")
+("honhe"	"")
+("honk"	"j")
+("honkn"	"")
+("hooae"	"_")
+("hooii"	"v")
+("hooma"	"")
+("hoomd"	"}")
+("hooml"	"s")
+("hoooo"	"q")
+("hop"	"")
+("hopa"	"")
+("hopi"	"n")
+("hopru"	"ҽ")
+("hoqb"	"")
+("hor"	"S")
+("horye"	"")
+("hosj"	"q")
+("hosyq"	"w")
+("hotcn"	"")
+("hotq"	"")
+("houfk"	"")
+("hougk"	"x")
+("hourk"	"")
+("houuk"	"L")
+("hovie"	"")
+("howr"	"")
+("hoybk"	"")
+("hoybp"	"@")
+("hoybs"	"K")
+("hoyg"	"")
+("hoyhs"	"")
+("hoyin"	"ױ")
+("hoyj"	"{")
+("hoylo"	"p")
+("hoyrv"	"H")
+("hp"	"G")
+("hpa"	"")
+("hpdk"	"_")
+("hphaf"	"")
+("hphh"	"C")
+("hpim"	"G")
+("hpln"	"")
+("hpm"	"")
+("hpnl"	"")
+("hpp"	"A")
+("hpr"	"")
+("hpru"	"")
+("hpsl"	"L")
+("hpuu"	"")
+("hq"	"")
+("hqate"	"o")
+("hqbmc"	"l")
+("hqbtu"	"k")
+("hqbu"	"")
+("hqbuk"	"|")
+("hqda"	"y")
+("hqfqu"	"h")
+("hqg"	"d")
+("hqgdi"	"S")
+("hqgwc"	"}")
+("hqhdj"	"}")
+("hqhgr"	"_")
+("hqhkb"	"Z")
+("hqhpm"	"")
+("hqhq"	"[")
+("hqhqm"	"")
+("hqhw"	"ó")
+("hqi"	"")
+("hqipf"	"n")
+("hqiuh"	"]")
+("hqjbm"	"j")
+("hqjm"	"")
+("hqjnd"	"~")
+("hqjqr"	"")
+("hqjr"	"")
+("hqkmr"	"Q")
+("hqks"	"B")
+("hqlw"	"ϻ")
+("hqlxh"	"Ϻ")
+("hqm"	"")
+("hqmb"	"R")
+("hqmc"	"")
+("hqmmr"	"\")
+("hqmqj"	"")
+("hqmtb"	"r")
+("hqmvm"	"^")
+("hqnbg"	"")
+("hqnkq"	"z")
+("hqo"	"")
+("hqok"	"")
+("hqomg"	"ҡ")
+("hqp"	"")
+("hqpd"	"e")
+("hqphh"	"")
+("hqpuu"	"")
+("hqr"	"")
+("hqrye"	"{")
+("hqsb"	"T")
+("hqshi"	"`")
+("hqta"	"")
+("hqtb"	"")
+("hqtce"	"")
+("hqtgs"	"")
+("hqthb"	"")
+("hqtm"	"")
+("hqu"	"")
+("hqvvv"	"q")
+("hqwj"	"")
+("hqwlp"	"p")
+("hqwyi"	"ϼ")
+("hqyrb"	"")
+("hqyrd"	"i")
+("hqytg"	"Y")
+("hrbc"	"")
+("hrff"	"")
+("hrgb"	"R")
+("hrhaf"	"[~")
+("hrhkp"	"Q")
+("hrhpm"	"Cгxr")
+("hrhr"	"L")
+("hrhvp"	"")
+("hrj"	"")
+("hrks"	"")
+("hrlb"	"")
+("hrlmi"	"۽")
+("hrln"	"Z")
+("hrmbc"	"")
+("hrmlb"	"v")
+("hrmr"	"")
+("hrnl"	"п")
+("hrog"	"")
+("hrok"	"")
+("hrrj"	"°")
+("hrtm"	"")
+("hru"	"Υ")
+("hruc"	"i")
+("hrvp"	"")
+("hryf"	"Q")
+("hs"	"E")
+("hsb"	"")
+("hsbr"	"")
+("hsbt"	"")
+("hsff"	"Q")
+("hshml"	"")
+("hshne"	"")
+("hshr"	"")
+("hsik"	"")
+("hsit"	"x")
+("hsko"	"")
+("hslmy"	"v")
+("hsly"	"")
+("hsmg"	"")
+("hsmr"	"")
+("hsog"	"")
+("hsp"	"")
+("hsqf"	"w")
+("hsr"	"")
+("hsrau"	"")
+("hsru"	"")
+("hssmm"	"")
+("hsyhs"	"")
+("hsyhv"	"Ѱ")
+("hsyj"	"̲")
+("hsyr"	"")
+("ht"	"")
+("htbn"	"b")
+("htce"	"ð")
+("htcg"	"")
+("hthaf"	"")
+("htkr"	"")
+("htmc"	"®")
+("htmf"	"")
+("htng"	"")
+("htsj"	"")
+("htsl"	"")
+("httb"	"")
+("httwi"	"G")
+("hubuc"	"")
+("hud"	"")
+("huff"	"")
+("huhaf"	"")
+("huhgu"	"@`")
+("huhuu"	"")
+("huij"	"C")
+("huije"	"A")
+("huik"	"")
+("huikk"	"")
+("hulmc"	"")
+("humbc"	"Z")
+("humcw"	"B")
+("hunkq"	"")
+("hunl"	"о")
+("huno"	"e")
+("hunwa"	"[")
+("huooo"	"S")
+("hup"	"")
+("hutak"	"")
+("hutca"	"")
+("huwml"	"")
+("huwp"	"B")
+("huytr"	"")
+("hvbjj"	"")
+("hvbu"	"")
+("hvbuc"	"")
+("hvbuk"	"")
+("hvbuu"	"")
+("hvbvk"	"{")
+("hvcsh"	"")
+("hve"	"")
+("hvfi"	"")
+("hvgdi"	"")
+("hvhey"	"")
+("hvhi"	"Q")
+("hvhqm"	"")
+("hvhu"	"")
+("hvhyu"	"|")
+("hvif"	"t")
+("hvik"	"")
+("hvikk"	"")
+("hvil"	"")
+("hvio"	"")
+("hvjck"	"")
+("hvlw"	"^")
+("hvmmr"	"")
+("hvmr"	"")
+("hvmvn"	"޸")
+("hvnkg"	"")
+("hvno"	"f")
+("hvp"	"")
+("hvpr"	"")
+("hvqmb"	"")
+("hvr"	"")
+("hvsav"	"")
+("hvsl"	"W")
+("hvtxc"	"z")
+("hvyk"	"")
+("hwe"	"")
+("hwgti"	"")
+("hwhaf"	"s")
+("hwhd"	"Y")
+("hwim"	"")
+("hwjr"	"")
+("hwk"	"")
+("hwkk"	"w")
+("hwks"	"D")
+("hwl"	"")
+("hwlg"	"Y")
+("hwli"	"N")
+("hwml"	"X")
+("hwmvs"	"f")
+("hwnl"	"I")
+("hwsmm"	"½")
+("hwtj"	"")
+("hx"	"")
+("hxbc"	"")
+("hxbt"	"d")
+("hxh"	"")
+("hxhu"	"")
+("hxjc"	"")
+("hxlb"	"γ")
+("hxle"	"")
+("hxno"	"")
+("hxo"	"")
+("hxt"	"p")
+("hxvyv"	"")
+("hxwks"	"")
+("hxyc"	"P")
+("hxyf"	"W")
+("hyabu"	"H")
+("hyau"	"r")
+("hybb"	"")
+("hybg"	"X")
+("hybnd"	"ߦ")
+("hybp"	"Ţ")
+("hybs"	"")
+("hyck"	"")
+("hycr"	"")
+("hyfb"	"ߥ")
+("hyfbw"	"")
+("hyha"	"")
+("hyhaf"	"")
+("hyhag"	"J")
+("hyhe"	"")
+("hyhej"	"ߧ")
+("hyheq"	"Y")
+("hyhj"	"O")
+("hyhlo"	"")
+("hyhm"	"")
+("hyhn"	"")
+("hyhne"	"")
+("hyhr"	"")
+("hyhs"	"V")
+("hyhsb"	"K")
+("hyhxe"	"")
+("hyjp"	"")
+("hykms"	"Z")
+("hykpb"	"")
+("hyl"	"q")
+("hylw"	"T")
+("hylwv"	"")
+("hym"	"i")
+("hymnr"	"S")
+("hymo"	"")
+("hyndt"	"S")
+("hynkg"	"")
+("hynri"	"")
+("hyoge"	"")
+("hyoii"	"W")
+("hyoir"	"")
+("hyoj"	"\")
+("hyomd"	"ߨ")
+("hypt"	"")
+("hyptd"	"G")
+("hypu"	"ӸW")
+("hyr"	"")
+("hyrb"	"t")
+("hyrl"	"")
+("hyrn"	"m")
+("hyro"	"")
+("hysd"	"")
+("hysh"	"ͱ")
+("hyshu"	"ߤ")
+("hysit"	"ĥ")
+("hysk"	"L")
+("hysy"	"P")
+("hyt"	"")
+("hytbo"	"")
+("hytc"	"X")
+("hytct"	"")
+("hytgi"	"")
+("hythu"	"F")
+("hytqm"	"")
+("hytwa"	"")
+("hyu"	"Q")
+("hyub"	"")
+("hyuce"	"I")
+("hyv"	"B")
+("hywl"	"U")
+("hywv"	"u")
+("hyybs"	"")
+("hyyhn"	"")
+("hyyhs"	"")
+("hyyo"	"")
+("hyyps"	"")
+("hyypt"	"F")
+("hyytg"	"")
+("hyyvi"	"")
+("hyyx"	"")
+("i"	"")
+("iaie"	"\")
+("iav"	"}")
+("ib"	"ɨ")
+("ibcn"	"Z")
+("ibcv"	"F")
+("ibdi"	"i")
+("ibg"	"")
+("ibhaf"	"")
+("ibnl"	"")
+("ibpp"	"")
+("icnl"	"K")
+("icno"	"t")
+("icp"	"ο")
+("id"	"")
+("idbu"	"[")
+("idfd"	"S")
+("idg"	"_")
+("idhd"	"")
+("idhi"	"]")
+("idhq"	"s")
+("idhqu"	"")
+("idjtc"	"t")
+("idlmy"	"")
+("idlyf"	"")
+("idmr"	"i")
+("idoo"	"J")
+("idq"	"")
+("idsje"	"")
+("idvi"	"")
+("idvif"	"")
+("iea"	"")
+("iebt"	"ڹ")
+("iedhe"	"r")
+("ieln"	"i")
+("ieok"	"")
+("ieyhv"	"")
+("ifamh"	"")
+("ifamo"	"")
+("ifasm"	"")
+("ifbbr"	"")
+("ifbgr"	"")
+("ifbjj"	"A")
+("ifbk"	"t")
+("ifbm"	"")
+("ifbme"	"C")
+("ifbuu"	"")
+("ifdmq"	"")
+("iffkc"	"")
+("ifg"	"")
+("ifgi"	"")
+("ifgni"	"ë")
+("ifgrr"	"H")
+("ifhaf"	"")
+("ifhgr"	"")
+("ifhjd"	"־")
+("ifhk"	"")
+("ifhml"	"")
+("ifhne"	"")
+("ifhpm"	"")
+("ifhqo"	"")
+("ifhs"	"")
+("ifhuc"	"")
+("ifhvp"	"")
+("ifhyu"	"")
+("ifikk"	"")
+("ifit"	"")
+("ifjbc"	"")
+("ifjr"	"")
+("ifkr"	"")
+("ifl"	"")
+("iflmo"	"ֽ")
+("iflwl"	"")
+("ifmbc"	"P")
+("ifmfb"	"")
+("ifmk"	"")
+("ifmmv"	"")
+("ifmr"	"")
+("ifmrw"	"")
+("ifmtb"	"")
+("ifmwg"	"")
+("ifmwj"	"")
+("ifnhs"	"r")
+("ifnl"	"Q")
+("ifnmu"	"ֿ")
+("ifodi"	"")
+("ifohv"	"")
+("ifoll"	"")
+("ifoma"	"_")
+("ifomb"	"")
+("ifomr"	"")
+("ifp"	"")
+("ifpd"	"͢")
+("ifph"	"")
+("ifpi"	"ͣ")
+("ifpou"	"")
+("ifqhk"	"")
+("ifrhu"	"")
+("ifrrj"	"I")
+("ifru"	"")
+("ifryo"	"")
+("ifshr"	"")
+("ifsme"	"")
+("ifsmm"	"ּ")
+("ifsmr"	"")
+("ifsqf"	"")
+("iftgf"	"")
+("iftmc"	"R")
+("iftmd"	"")
+("iftq"	"")
+("iftwt"	"§")
+("ifvii"	"")
+("ifvne"	"S")
+("ifvno"	"B")
+("ifwd"	"")
+("ifwlm"	"")
+("ifwp"	"@")
+("ifybb"	"")
+("ifybc"	"")
+("ifyhs"	"")
+("ifylm"	"")
+("ifyoj"	"")
+("ifyrv"	"š")
+("ifyto"	"^")
+("ig"	"")
+("igb"	"t")
+("igce"	"G")
+("igdi"	"ζ")
+("ighaf"	"N")
+("igit"	"]")
+("igow"	"p")
+("igp"	"")
+("igsk"	"")
+("igti"	"p")
+("ih"	"")
+("ihhi"	"f")
+("ihhj"	"K")
+("ihhqu"	"")
+("ihhw"	"a")
+("ihi"	"_")
+("ihln"	"")
+("ihm"	"")
+("ihml"	"")
+("ihmr"	"w")
+("ihmv"	"")
+("ihpm"	"")
+("ihq"	"")
+("ihs"	"")
+("ihu"	"")
+("ihxe"	"`")
+("ihxo"	"h")
+("ihymf"	"")
+("ii"	"̱")
+("iib"	"")
+("iibt"	"")
+("iiif"	"")
+("iiih"	"")
+("iiil"	"Y")
+("iiln"	"")
+("iinl"	"")
+("iino"	"")
+("iiobo"	"G")
+("iiuh"	"x")
+("iixp"	"")
+("ij"	"")
+("ijb"	"j")
+("ijc"	"")
+("ijcc"	"")
+("ije"	"D")
+("ijjb"	"q")
+("ijkd"	"u")
+("ijwj"	"w")
+("ik"	"")
+("ikbuc"	"")
+("ikhni"	"t")
+("ikikk"	"n")
+("ikjwj"	"J")
+("ikk"	"ɥ")
+("iklu"	"g")
+("iknf"	"")
+("ikno"	"")
+("ikp"	"")
+("ikpb"	"")
+("ikrm"	"{")
+("iku"	"")
+("ikw"	"c")
+("ilb"	"e")
+("ile"	"d")
+("ilil"	"{")
+("ilmo"	"ι")
+("iln"	"E")
+("ilo"	"")
+("iloc"	"")
+("ilr"	"")
+("ilwv"	"")
+("imbgr"	"")
+("imbsd"	"")
+("imc"	"")
+("imcw"	"v")
+("imdw"	"")
+("ime"	"B")
+("imgce"	"")
+("imhgu"	"")
+("imig"	"η")
+("imikk"	"k")
+("imir"	"M")
+("imjlv"	"")
+("immnn"	"")
+("immp"	"")
+("immvm"	"ɼ")
+("immwg"	"h")
+("imno"	"")
+("imog"	"")
+("imoii"	"N")
+("imoir"	"a")
+("imomr"	"")
+("imp"	"b")
+("impko"	"")
+("imqmb"	"")
+("imsll"	"N")
+("imsqf"	"")
+("imsuf"	"")
+("imtcl"	"@")
+("imue"	"H")
+("imuog"	"")
+("imvh"	"")
+("imwjr"	"")
+("imywd"	"")
+("inbq"	"r")
+("ine"	"")
+("infq"	"G")
+("inin"	"")
+("inkg"	"x")
+("inli"	"")
+("ino"	"")
+("inoe"	"o")
+("io"	"z")
+("iobuc"	"")
+("iod"	"κ")
+("iodi"	"")
+("iofd"	"")
+("iohaf"	"")
+("iohd"	"")
+("ioin"	"")
+("iok"	"o")
+("ioma"	"s")
+("iomvn"	"")
+("ioog"	"y")
+("iooiv"	"")
+("iop"	"")
+("ior"	"t")
+("iord"	"")
+("iotf"	"u")
+("iov"	"")
+("ip"	"|y")
+("ipbm"	"")
+("ipbuc"	"")
+("ipc"	"")
+("ipf"	"")
+("ipfd"	"G")
+("ipfdq"	"")
+("ipg"	"")
+("iphaf"	"")
+("iphd"	"")
+("iphhi"	"e")
+("iphn"	"")
+("iphor"	"")
+("iphxu"	"")
+("ipihr"	"")
+("ipipp"	"")
+("iplmi"	"n")
+("ipm"	"")
+("ipmc"	"")
+("ipmmc"	"L")
+("ipmmv"	"")
+("ipmwd"	"")
+("ipmwm"	"")
+("ipnl"	"i")
+("ipnsj"	"")
+("ipog"	"L")
+("ipp"	"ȺA")
+("ipru"	"")
+("iprvk"	"")
+("iprye"	"")
+("iptmc"	"Q")
+("ipu"	"")
+("ipyg"	"")
+("ipyiu"	"")
+("ipyx"	"c")
+("iqhaf"	"")
+("iqhf"	"r")
+("iqje"	"w")
+("ir"	"x")
+("ird"	"V")
+("irf"	"ϱ")
+("irhaf"	"")
+("irm"	"")
+("irmbc"	"")
+("irmvn"	"ҿ")
+("irnbg"	"}")
+("irnl"	"")
+("irp"	"P")
+("isbt"	"")
+("isgp"	"U")
+("isja"	"")
+("ismh"	"")
+("isnl"	"к")
+("isok"	"")
+("isrj"	"q")
+("it"	"")
+("ita"	"H")
+("itcl"	"r")
+("ite"	"")
+("itf"	"f")
+("ithaf"	"")
+("itlb"	"u")
+("itlm"	"")
+("itmc"	"s")
+("itq"	"")
+("itso"	"I")
+("itt"	"ε")
+("itxc"	"G")
+("iuhhh"	"ʾ")
+("iv"	"|")
+("ivug"	"")
+("iwcg"	"s")
+("iwtc"	"")
+("ixe"	"y")
+("ixf"	"^")
+("ixp"	"")
+("iybp"	"e")
+("iydl"	"")
+("iyln"	"")
+("iymp"	"θ")
+("iypt"	"f")
+("iyr"	"")
+("iywd"	"o")
+("j"	"Q")
+("jaf"	"N")
+("jamo"	"")
+("janl"	"")
+("jasmm"	"}")
+("jav"	"b")
+("jb"	"]")
+("jbd"	"")
+("jbhaf"	"")
+("jbhod"	"S")
+("jblli"	"")
+("jbm"	"y")
+("jbmc"	"u")
+("jbmm"	"")
+("jbmrd"	"")
+("jbmri"	"")
+("jbnd"	"")
+("jbof"	"")
+("jbrrv"	"n")
+("jbtj"	"n")
+("jbvif"	"")
+("jbwno"	"")
+("jc"	"")
+("jcbbr"	"")
+("jcbu"	"")
+("jcegg"	"p")
+("jcemd"	"")
+("jcfdj"	"")
+("jcgfo"	"")
+("jcgg"	"")
+("jcgwc"	"u")
+("jchaf"	"")
+("jchdb"	"")
+("jchdp"	"")
+("jchgr"	"")
+("jchhl"	"")
+("jchhn"	"a")
+("jchio"	"")
+("jchk"	"@")
+("jchoo"	"")
+("jchs"	"")
+("jchsk"	"¬")
+("jchuu"	"")
+("jchvo"	"")
+("jchwk"	"")
+("jchxv"	"«")
+("jci"	"")
+("jcik"	"")
+("jcirm"	"C")
+("jcjbc"	"")
+("jcjkd"	"")
+("jckn"	"s")
+("jclb"	"")
+("jclmo"	"")
+("jclwv"	"")
+("jcm"	"")
+("jcmbc"	"A")
+("jcmd"	"ͦ")
+("jcmig"	"")
+("jcmmu"	"")
+("jcmob"	"")
+("jcmvh"	"")
+("jcn"	"H")
+("jcnhx"	"D")
+("jcni"	"ͥ")
+("jcnlm"	"K")
+("jcno"	"")
+("jcold"	"")
+("jcomn"	"L")
+("jcor"	"e")
+("jcpru"	"")
+("jcpu"	"")
+("jcqhk"	"K")
+("jcqou"	"s")
+("jcsjl"	"")
+("jcskr"	"~")
+("jcsmm"	"{")
+("jcsuu"	"]")
+("jctgf"	"`")
+("jcuu"	"")
+("jcvis"	"")
+("jcwd"	"^")
+("jcyck"	"")
+("jcyoj"	"B")
+("jcyta"	"J")
+("jd"	"")
+("jdhaf"	"")
+("jdi"	"u")
+("jdks"	"k")
+("jdnl"	"")
+("jdok"	"")
+("je"	"")
+("jed"	"@")
+("jeg"	"O")
+("jehaf"	"")
+("jejwj"	"")
+("jelmi"	"")
+("jembc"	"")
+("jeoju"	"")
+("jeq"	"")
+("jese"	"H")
+("jesmi"	"")
+("jesmm"	"")
+("jevif"	"ô")
+("jfb"	"d")
+("jhdw"	"f")
+("jher"	"")
+("jhk"	"ʼ")
+("jhoo"	"J")
+("jhp"	"v")
+("jhq"	"c")
+("jhqu"	"ʽ")
+("jhxf"	"g")
+("jibi"	"")
+("jid"	"")
+("jidi"	"M")
+("jihaf"	"")
+("jihs"	"h")
+("jijwj"	"")
+("jikf"	"")
+("jilmi"	"۴")
+("jiln"	"")
+("jimcw"	"s")
+("jimig"	"T")
+("jinl"	"l")
+("jiobo"	"H")
+("jiog"	"I")
+("jip"	"f")
+("jir"	"v")
+("jiwtc"	"")
+("jiyhv"	"")
+("jj"	"{")
+("jjapp"	"@")
+("jjapv"	"")
+("jjb"	"")
+("jjbb"	"L")
+("jjbc"	"I")
+("jjbgr"	"M")
+("jjbtv"	"")
+("jjcor"	"g")
+("jjdmq"	"")
+("jjeee"	"")
+("jjfb"	"f")
+("jjfdq"	"")
+("jjgce"	"I")
+("jjgow"	"")
+("jjgrv"	"")
+("jjhby"	"z")
+("jjhdw"	"Z")
+("jjher"	"x")
+("jjhg"	"")
+("jjhju"	"")
+("jjhkb"	"")
+("jjhml"	"")
+("jjhne"	"")
+("jjhni"	"")
+("jjhpm"	"E")
+("jjhqo"	"c")
+("jjhqu"	"")
+("jjhsn"	"G")
+("jjhvo"	"I")
+("jjhvp"	"")
+("jjhxu"	"N")
+("jji"	"u")
+("jjii"	"J")
+("jjijb"	"")
+("jjikk"	"")
+("jjipm"	"")
+("jjir"	"L")
+("jjirp"	"")
+("jjixp"	"F")
+("jjjii"	"")
+("jjjjj"	"F")
+("jjjmu"	"d")
+("jjjqr"	"")
+("jjjtc"	"V")
+("jjk"	"")
+("jjkcf"	"W")
+("jjkn"	"y")
+("jjlbk"	"B")
+("jjlo"	"")
+("jjlw"	"b")
+("jjmbl"	"w")
+("jjmdm"	"H")
+("jjmfj"	"")
+("jjmig"	"")
+("jjmj"	"a")
+("jjmlb"	"")
+("jjmnr"	"a")
+("jjmrw"	"")
+("jjmsu"	"m")
+("jjmu"	"c")
+("jjmvm"	"")
+("jjnau"	"")
+("jjnhd"	"")
+("jjno"	"n")
+("jjoae"	"")
+("jjob"	"")
+("jjod"	"m")
+("jjodi"	"D")
+("jjohf"	"")
+("jjohh"	"H")
+("jjoii"	"F")
+("jjoin"	"")
+("jjoli"	"_")
+("jjomb"	"")
+("jjomg"	"y")
+("jjomj"	"F")
+("jjomn"	"")
+("jjon"	"")
+("jjoog"	"p")
+("jjosm"	"")
+("jjoyj"	"W")
+("jjpr"	"C")
+("jjpu"	"")
+("jjpyr"	"")
+("jjqkd"	"")
+("jjqkk"	"")
+("jjqmb"	"H")
+("jjrc"	"@")
+("jjrhu"	"A")
+("jjrsj"	"")
+("jjshi"	"b")
+("jjshr"	"")
+("jjsit"	"W")
+("jjsju"	"")
+("jjskr"	"e")
+("jjsmh"	"G")
+("jjsnd"	"X")
+("jjstv"	"")
+("jjtav"	"")
+("jjtc"	"v")
+("jjtco"	"Y")
+("jjtcw"	"")
+("jjtgi"	"X")
+("jjtt"	"u")
+("jju"	"")
+("jjumb"	"")
+("jjvid"	"e")
+("jjvvd"	"H")
+("jjvvw"	"")
+("jjwd"	"K")
+("jjwlv"	"")
+("jjwot"	"")
+("jjwww"	"d")
+("jjybk"	"")
+("jjyck"	"")
+("jjyg"	"K")
+("jjyjj"	"I")
+("jjypt"	"G")
+("jjyrf"	"G")
+("jjyvo"	"t")
+("jk"	"V")
+("jka"	"")
+("jkb"	"")
+("jkcf"	"d")
+("jkhaf"	"w")
+("jki"	"")
+("jkmdo"	"H")
+("jkme"	"")
+("jkmhq"	"")
+("jkmhu"	"")
+("jkmnd"	"}")
+("jkmr"	"H")
+("jkmsh"	"")
+("jkmv"	"u")
+("jkmwg"	"")
+("jkn"	"s")
+("jknd"	"")
+("jkp"	"")
+("jkpr"	"Q")
+("jkss"	"")
+("jkys"	"")
+("jla"	"")
+("jlc"	"")
+("jld"	"")
+("jlg"	"")
+("jlk"	"O")
+("jlln"	"")
+("jlmo"	"w")
+("jlmr"	"")
+("jlryo"	"E")
+("jlv"	"d")
+("jlw"	"z")
+("jlwv"	"~")
+("jlyo"	"s")
+("jm"	"h")
+("jmam"	"")
+("jmc"	"j")
+("jmch"	"")
+("jmd"	"t")
+("jmhc"	"")
+("jmig"	"")
+("jmjmm"	"")
+("jmlc"	"G")
+("jmmc"	"")
+("jmmf"	"v")
+("jmmu"	"")
+("jmmv"	"f")
+("jmn"	"r")
+("jmr"	"X")
+("jmrw"	"I")
+("jmso"	"a")
+("jmuc"	"_")
+("jmue"	"F")
+("jmyo"	"w")
+("jnd"	"r")
+("jngi"	"")
+("jnhaf"	"]")
+("jnihq"	"")
+("jniu"	"{")
+("jnln"	"")
+("jnmwl"	"")
+("jnon"	"")
+("jnpfd"	"T")
+("jnpru"	"")
+("jnqo"	"")
+("jnujt"	"")
+("jnup"	"")
+("jnyub"	"")
+("jogs"	"]")
+("joma"	"J")
+("jombc"	"E")
+("joni"	"")
+("jose"	"")
+("jp"	"")
+("jpa"	"")
+("jpbn"	"")
+("jpbq"	"ڬ")
+("jpbt"	"")
+("jph"	"W")
+("jphi"	"e")
+("jphqu"	"")
+("jphu"	"K")
+("jpko"	"")
+("jpmig"	"")
+("jqmp"	"")
+("jqmr"	"`")
+("jr"	"j")
+("jrb"	"J")
+("jrbhf"	"|")
+("jrcor"	"")
+("jrhaf"	"l")
+("jrhne"	"j")
+("jrhr"	"c")
+("jrhu"	"J")
+("jrln"	"")
+("jrlr"	"x")
+("jrmbc"	"B")
+("jrok"	"G")
+("jrrp"	"")
+("jrrye"	"L")
+("jrytj"	"d")
+("jskr"	"g")
+("jsll"	"f")
+("jsmh"	"")
+("jt"	"c")
+("jtak"	"")
+("jtbc"	"N")
+("jtbi"	"e")
+("jtcc"	"")
+("jtcd"	"")
+("jtcf"	"")
+("jtcg"	"")
+("jtco"	"")
+("jtcq"	"S")
+("jtcr"	"")
+("jtcu"	"")
+("jtcv"	"r")
+("jtcy"	"H")
+("jtge"	"")
+("ju"	"C")
+("juhaf"	"")
+("jujru"	"")
+("juks"	"")
+("juln"	"g")
+("jv"	"w")
+("jvd"	"")
+("jvhaf"	"v")
+("jvmb"	"")
+("jvmbc"	"")
+("jvmd"	"K")
+("jvme"	"")
+("jvmr"	"")
+("jvnl"	"")
+("jwbuu"	"T")
+("jwj"	"")
+("jwjc"	"")
+("jwlb"	"J")
+("jwlv"	"")
+("jybc"	"")
+("jybp"	"d")
+("jyfe"	"I")
+("jytj"	"_")
+("k"	"j@")
+("kam"	"n")
+("kamh"	"")
+("kanb"	"w")
+("karrj"	"")
+("kau"	"")
+("kav"	"")
+("kb"	"N")
+("kbb"	"")
+("kbbr"	"")
+("kbcv"	"")
+("kbhaf"	"")
+("kbhne"	"")
+("kbhqu"	"")
+("kbirm"	"")
+("kbm"	"j")
+("kbmr"	"֢")
+("kbmvn"	"ګ")
+("kbnl"	"")
+("kbno"	"")
+("kbof"	"q")
+("kcano"	"")
+("kchne"	"")
+("kcipm"	"I")
+("kcln"	"b")
+("kdd"	"")
+("kdhe"	"h")
+("kdlc"	"")
+("kdln"	"")
+("ke"	"")
+("kefh"	"گ")
+("keii"	"")
+("kell"	"j")
+("kf"	"Ǭ")
+("kfb"	"ڴ")
+("kfbt"	"")
+("kfcb"	"C")
+("kff"	"")
+("kffs"	"")
+("kfhaf"	"c")
+("kfp"	"R")
+("kgdi"	"")
+("kgg"	"")
+("kghaf"	"")
+("kgp"	"i")
+("khaa"	"s")
+("khahm"	"V")
+("khal"	"K")
+("kham"	"c")
+("khapp"	"c")
+("khapv"	"t")
+("khav"	"")
+("khawe"	"")
+("khbbb"	"")
+("khbbr"	"s")
+("khbm"	"")
+("khbmr"	"")
+("khbn"	"")
+("khbou"	"ޤ")
+("khbsd"	"u")
+("khbtt"	"")
+("khbuc"	"V")
+("khbue"	"")
+("khdc"	"")
+("khdd"	"")
+("khdlc"	"á")
+("khdn"	"g")
+("khdv"	"")
+("khefh"	"ң")
+("khey"	"k")
+("khf"	"f")
+("khfbk"	"~")
+("khggu"	"x")
+("khgr"	"Ͽ")
+("khgrv"	"")
+("khhbn"	"d")
+("khhdn"	"Ҫ")
+("khhg"	"g")
+("khhgf"	"e")
+("khhhj"	"f")
+("khhj"	"")
+("khhkb"	"")
+("khhl"	"C")
+("khhni"	"v")
+("khhqm"	"d")
+("khhrb"	"")
+("khhsb"	"hx")
+("khhsk"	"_")
+("khhvo"	"")
+("khhw"	"F")
+("khhxe"	"ޥ")
+("khhxf"	"|")
+("khhxu"	"e")
+("khi"	"")
+("khiav"	"T")
+("khibi"	"ޡ")
+("khice"	"ҩ")
+("khihu"	"e")
+("khij"	"")
+("khio"	"")
+("khitc"	"x")
+("khiv"	"^")
+("khjc"	"\")
+("khjdi"	"")
+("khjjl"	"")
+("khjkp"	"")
+("khjpn"	"")
+("khjr"	"`")
+("khjrb"	"p")
+("khkcf"	"y")
+("khkkb"	"ҧ")
+("khkmr"	"a")
+("khkn"	"ɦ")
+("khkoo"	"U")
+("khl"	"d")
+("khlln"	"a")
+("khlmo"	"")
+("khmam"	"")
+("khmbb"	"c")
+("khmbe"	"")
+("khmce"	"")
+("khmfb"	"d")
+("khmfm"	"_")
+("khmg"	"g")
+("khmhf"	"ޢ")
+("khmj"	"C")
+("khmmf"	"]")
+("khmto"	"")
+("khmvh"	"b")
+("khnbq"	"^")
+("khndf"	"ޣ")
+("khndt"	"r")
+("khne"	"")
+("khng"	"c")
+("khngu"	"o")
+("khnhb"	"z")
+("khnhd"	"q")
+("khni"	"")
+("khnkm"	"g")
+("khnmb"	"n")
+("khoii"	"e")
+("khoir"	"ަ")
+("khok"	"pN")
+("khoma"	"a")
+("khomd"	"Ҩ")
+("khomo"	"`")
+("khomr"	"i")
+("khon"	"D")
+("khonk"	"U")
+("khoo"	"r")
+("khpa"	"")
+("khppg"	"ҥ")
+("khpr"	"")
+("khqhk"	"o")
+("khqhl"	"Ҧ")
+("khqkd"	"ާ")
+("khqmb"	"q")
+("khrb"	"X")
+("khrrk"	"")
+("khrye"	"r")
+("khs"	"")
+("khsp"	"b")
+("khsu"	"")
+("khtav"	"\")
+("khtco"	"{")
+("khtcw"	"S")
+("khtjl"	"")
+("khtmc"	"}")
+("khtoe"	"")
+("khtrg"	"")
+("khub"	"ç")
+("khuce"	"w")
+("khup"	"")
+("khvno"	"u")
+("khvp"	"")
+("khvvv"	"y")
+("khwd"	"t")
+("khwg"	"W")
+("khwl"	"")
+("khwlg"	"z")
+("khwli"	"W")
+("khwlv"	"]")
+("khwmv"	"T")
+("khxe"	"G")
+("khxo"	"")
+("khxv"	"L")
+("khyck"	"")
+("khye"	"I")
+("khyhn"	"f")
+("khymh"	"[")
+("khymr"	"Ҥ")
+("khyoj"	"`")
+("khypu"	"b")
+("khyrk"	"")
+("khyrv"	"m")
+("khytg"	"w")
+("khytj"	"")
+("khytu"	"")
+("khyy"	"a")
+("ki"	"")
+("kice"	"m")
+("kijb"	"ڱ")
+("kiku"	"")
+("kiog"	"")
+("kismm"	"c")
+("kiuh"	"ڳ")
+("kiv"	"")
+("kjbc"	"")
+("kjcc"	"")
+("kjka"	"޿")
+("kjkd"	"ڰ")
+("kjrr"	"޾")
+("kjt"	"b")
+("kk"	"")
+("kkb"	"~")
+("kkcf"	"")
+("kkhaf"	"b")
+("kkkk"	"n")
+("kklb"	"")
+("kklu"	"")
+("kkn"	"")
+("kkog"	"")
+("kkop"	"m")
+("kkrb"	"a")
+("kks"	"q")
+("kksr"	"m")
+("klb"	"")
+("klg"	"b")
+("klll"	"")
+("klln"	"")
+("klmi"	"֡")
+("klmy"	"")
+("kln"	"")
+("klnd"	"s")
+("klwu"	"a")
+("km"	"t")
+("kmaa"	"]")
+("kmbw"	"O")
+("kmfr"	"l")
+("kmmf"	"`")
+("kmmr"	"ڲ")
+("kmms"	"j")
+("kmn"	"o")
+("kmnr"	"_")
+("kmob"	"f")
+("kmrt"	"k")
+("kmso"	"")
+("kmvm"	"j")
+("kmwf"	"l")
+("kmym"	"g")
+("kn"	"Ei")
+("kna"	"")
+("knbk"	"")
+("kncr"	"P")
+("knfq"	"~")
+("knhaf"	"")
+("kni"	"YX")
+("knib"	"h")
+("knin"	"a֣")
+("knlm"	"t")
+("knlp"	"}")
+("knlr"	"")
+("knmbc"	"N")
+("kno"	"")
+("knoe"	"u")
+("knthu"	"P")
+("knymr"	"а")
+("knypu"	"ӷ")
+("kog"	"")
+("kogi"	"")
+("kogw"	"")
+("kohaf"	"")
+("kohh"	"l")
+("koir"	"H")
+("kok"	"e")
+("kokr"	"")
+("koll"	"")
+("koma"	"M")
+("kombc"	"U")
+("komg"	"")
+("komn"	"")
+("komp"	"¡")
+("kon"	"")
+("konk"	"")
+("konl"	"")
+("koo"	"")
+("koog"	"ڵ")
+("kowy"	"ڶ")
+("kp"	"p")
+("kpblb"	"a")
+("kpko"	"è")
+("kpp"	"")
+("kpr"	"")
+("kpt"	"")
+("kqhk"	"")
+("kqhp"	"")
+("kr"	"k")
+("krbuc"	"P")
+("krc"	"")
+("krd"	"[")
+("krhaf"	"")
+("krhqu"	"j")
+("krje"	"r")
+("krln"	"")
+("krmnr"	"")
+("krno"	"")
+("krrj"	"v")
+("krru"	"")
+("krsqf"	"r")
+("krye"	"s")
+("kryhv"	"P")
+("ks"	"O")
+("ksce"	"J")
+("kshaf"	"z")
+("kshvf"	"c")
+("kshvo"	"}")
+("ksj"	"U")
+("ksksb"	"")
+("kskss"	"")
+("ksksv"	"v")
+("ksln"	"")
+("ksmb"	"b")
+("ksmh"	"o")
+("ksmi"	"M")
+("kspru"	"")
+("ksr"	"[")
+("ksrj"	"}")
+("ksrr"	"")
+("kswp"	"E")
+("ktak"	"p")
+("ktbc"	"")
+("ktjr"	"")
+("ktlm"	"n")
+("ktm"	"i")
+("ktog"	"")
+("ktor"	"D")
+("ktov"	"o")
+("ktq"	"O}")
+("ktqm"	"")
+("ktuo"	"")
+("ktwb"	"~")
+("ku"	"q")
+("kubbb"	"L")
+("kuhaf"	"O")
+("kuhjg"	"")
+("kumg"	"ʿ")
+("kuoll"	"")
+("kupi"	"")
+("kusit"	"")
+("kvfb"	"")
+("kvug"	"")
+("kwjr"	"")
+("kwle"	"")
+("kwml"	"")
+("kwot"	"E")
+("kwr"	"֤")
+("kwvf"	"s")
+("kyg"	"")
+("kymp"	"")
+("kyoj"	"")
+("kypm"	"")
+("kyr"	"")
+("kysk"	"k")
+("kysy"	"")
+("kyta"	"")
+("kytj"	"`")
+("kyvo"	"|")
+("kyx"	"x")
+("l"	"")
+("la"	"")
+("laa"	"")
+("lam"	"R")
+("lamo"	"")
+("lanb"	"")
+("lanw"	"")
+("laph"	"")
+("lapv"	"")
+("lasm"	"|")
+("late"	"J")
+("lav"	"")
+("lb"	"y")
+("lbabu"	"U")
+("lbafu"	"E")
+("lbau"	"")
+("lbawe"	"")
+("lbayf"	"q")
+("lbbac"	"Y")
+("lbbhx"	"[")
+("lbcru"	"t")
+("lbdhe"	"n")
+("lbdmq"	"W")
+("lbfb"	"s")
+("lbgni"	"")
+("lbgr"	"v")
+("lbha"	"")
+("lbhal"	"n")
+("lbhdw"	"n")
+("lbhni"	"|")
+("lbhqo"	"o")
+("lbigi"	"")
+("lbii"	"F")
+("lbiih"	"")
+("lbikk"	"m")
+("lbjj"	"")
+("lbjka"	"E")
+("lbjmo"	"X")
+("lbjqp"	"")
+("lbjtc"	"n")
+("lbk"	"")
+("lblbu"	"")
+("lbm"	"")
+("lbmbc"	"Z")
+("lbme"	"")
+("lbmn"	"x")
+("lbmrw"	"T")
+("lbncr"	"l")
+("lbnl"	"X")
+("lbog"	"c")
+("lbomr"	"α")
+("lbotf"	"p")
+("lbqmc"	"")
+("lbrrd"	"k")
+("lbrrj"	"o")
+("lbsmg"	"")
+("lbsmv"	"b")
+("lbt"	"")
+("lbtak"	"")
+("lbtbo"	"")
+("lbtt"	"ΰ")
+("lbtwi"	"")
+("lbu"	"U")
+("lbwim"	"")
+("lbybc"	"V")
+("lbyia"	"m")
+("lbyr"	"")
+("lbytg"	"l")
+("lbytj"	"")
+("lcnl"	"W")
+("lcor"	"")
+("lcru"	"")
+("lcsh"	"")
+("ldbb"	"")
+("lddf"	"")
+("lddq"	"K")
+("ldhe"	"Q")
+("ldk"	"L")
+("ldmq"	"")
+("leed"	"{")
+("leee"	"@")
+("lei"	"Ю")
+("lfbk"	"v")
+("lfbw"	"")
+("lff"	"")
+("lfq"	"׵")
+("lfqu"	"")
+("lga"	"")
+("lgam"	"")
+("lgb"	"׹")
+("lgce"	"A")
+("lggu"	"")
+("lggy"	"o")
+("lgi"	"׶")
+("lgr"	"")
+("lgrc"	"H")
+("lgwc"	"I")
+("lgwm"	"e")
+("lha"	"׽")
+("lhbk"	"")
+("lheq"	"")
+("lher"	"")
+("lhg"	"M")
+("lhhh"	"m")
+("lhhj"	"t")
+("lhjd"	"")
+("lhoo"	"w")
+("lhpm"	"׾")
+("lhqo"	"׺")
+("lhsb"	"")
+("lhul"	"")
+("lhvp"	"N")
+("lhyu"	"")
+("lia"	"")
+("liabu"	"")
+("liahu"	"")
+("liail"	"")
+("liamh"	"")
+("liamo"	"")
+("liaph"	"i")
+("liapv"	"")
+("liau"	"")
+("liav"	"۸")
+("liavo"	"")
+("liawe"	"c")
+("libac"	"")
+("libbb"	"b")
+("libbr"	"")
+("libcv"	"")
+("libdi"	"")
+("libgr"	"m")
+("libm"	"I")
+("libme"	"")
+("libnd"	"")
+("libp"	"q")
+("libue"	"n")
+("libug"	"")
+("libuu"	"")
+("libvk"	"e")
+("lici"	"G")
+("licim"	"o")
+("lick"	"")
+("licru"	"")
+("licsh"	"")
+("lid"	"Ӿ")
+("lidci"	"")
+("lidhe"	"װ")
+("lidhl"	"h")
+("lidk"	"")
+("lidw"	"")
+("lieee"	"")
+("liesd"	"")
+("lifb"	"")
+("lifbg"	"")
+("lifbw"	"")
+("liffd"	"")
+("liffs"	"")
+("lifqu"	"l")
+("ligb"	"פ")
+("ligg"	"")
+("liggu"	"")
+("ligr"	"۵")
+("ligrr"	"")
+("ligth"	"")
+("lihad"	"d")
+("lihag"	"")
+("lihdj"	"")
+("lihdn"	"")
+("lihdp"	"")
+("lihdv"	"")
+("lihdw"	"")
+("lihej"	"")
+("lihhj"	"")
+("lihi"	"j")
+("lihjd"	"")
+("lihjg"	"")
+("lihjr"	"")
+("lihkb"	"")
+("lihlb"	"")
+("lihml"	"")
+("lihmy"	"ש")
+("lihn"	"")
+("lihp"	"Ч")
+("lihpm"	"ר")
+("lihqi"	"")
+("lihqo"	"צ")
+("lihqu"	"")
+("lihrb"	"k")
+("lihrf"	"h")
+("lihs"	"K")
+("lihsb"	"")
+("lihsk"	"")
+("lihsu"	"")
+("lihuk"	"i")
+("lihup"	"g")
+("lihvo"	"ת")
+("lihvp"	"")
+("lihwp"	"e")
+("lihxu"	"")
+("lihyu"	"l")
+("liiav"	"")
+("liih"	"x")
+("liihq"	"ۿ")
+("liihv"	"")
+("liiil"	"")
+("liijb"	"")
+("liije"	"")
+("liikf"	"")
+("liikk"	"ס")
+("liiku"	"")
+("liilr"	"]")
+("liioc"	"")
+("liirm"	"")
+("liitc"	"")
+("liitf"	"[")
+("liitu"	"")
+("liiuh"	"")
+("liixp"	"\")
+("lijb"	"")
+("lijbj"	"")
+("lijcg"	"p")
+("lije"	"ӽ")
+("lijip"	"")
+("lijj"	"")
+("lijjl"	"^")
+("lijka"	"")
+("lijlo"	"")
+("lijmc"	"X")
+("lijmm"	"")
+("lijnu"	"d")
+("lijp"	"D")
+("lijqr"	"[")
+("lijr"	"G")
+("lijrb"	"")
+("lijtc"	"")
+("likcf"	"")
+("likk"	"׷")
+("likn"	"۳")
+("likok"	"\")
+("likoo"	"")
+("likpb"	"a")
+("lilii"	"")
+("lilit"	"")
+("lille"	"")
+("lilmq"	"")
+("lilw"	"ץ")
+("lilwv"	"")
+("lilxl"	"")
+("lim"	"i")
+("lima"	"۾")
+("limbb"	"į")
+("limbc"	"")
+("limbk"	"")
+("limfm"	"ׯ")
+("limhf"	"`")
+("limig"	"")
+("limj"	"Ц")
+("limmu"	"ӻ")
+("limmv"	"")
+("limn"	"")
+("limnn"	"۶")
+("limnr"	"H")
+("limob"	"׮")
+("limrw"	"")
+("limtb"	"")
+("limvh"	"H")
+("limvm"	"")
+("limwf"	"_")
+("limwj"	"")
+("limwl"	"")
+("linao"	"")
+("linbc"	"")
+("lincr"	"")
+("lindt"	"g")
+("linhd"	"")
+("linhx"	"")
+("linib"	"")
+("linkg"	"")
+("linkm"	"")
+("linl"	"C")
+("linmu"	"۹")
+("linob"	"")
+("linue"	"")
+("lioae"	"")
+("liob"	"")
+("liodi"	"ק")
+("liog"	"")
+("liogf"	"")
+("lioii"	"M")
+("lioin"	"")
+("liokr"	"j")
+("lioll"	"")
+("liom"	"L")
+("liomb"	"")
+("liomd"	"")
+("liomn"	"")
+("liomr"	"")
+("lion"	"Ш")
+("liono"	"")
+("liopc"	"")
+("liosk"	"ۺ")
+("lipi"	"Щ")
+("lipim"	"")
+("lipou"	"")
+("lipp"	"Ӽ")
+("lippa"	"")
+("lippg"	"")
+("lipr"	"׭")
+("liptd"	"")
+("liqj"	"F")
+("liqkd"	"^")
+("liqmb"	"f")
+("liqmy"	"")
+("liqo"	"Ӻ")
+("lirb"	"")
+("lirrj"	"")
+("liruc"	"")
+("lirvk"	"")
+("lirxu"	"")
+("lirye"	"")
+("lisav"	"")
+("lisem"	"")
+("lish"	"")
+("lishr"	"ע")
+("lisjr"	"")
+("lismg"	"")
+("lismh"	"b")
+("lismi"	"")
+("liso"	"ӿ")
+("lisqf"	"")
+("lisrg"	"")
+("liss"	"~")
+("lisyi"	"")
+("lita"	"")
+("litak"	"")
+("litb"	"z")
+("litbo"	"")
+("litcw"	"")
+("litgi"	"")
+("litgu"	"")
+("litit"	"")
+("litlk"	"")
+("litlm"	"`")
+("litlx"	"N")
+("litm"	"F")
+("litmc"	"")
+("litoe"	"")
+("litpd"	"")
+("litq"	"۱")
+("litrg"	"")
+("litt"	"۲")
+("litw"	"")
+("litwa"	"]")
+("litwi"	"B")
+("liuce"	"")
+("liumt"	"c")
+("liuob"	"")
+("livii"	"")
+("livis"	"׫")
+("livl"	"")
+("livno"	"")
+("livvv"	"")
+("liwb"	"")
+("liwd"	"")
+("liwgf"	"")
+("liwhd"	"")
+("liwim"	"")
+("liwli"	"")
+("liwlj"	"")
+("liwlv"	"")
+("liwot"	"d")
+("liwr"	"")
+("liwvf"	"")
+("liwww"	"A")
+("liyav"	"a")
+("liybp"	"M")
+("liybs"	"")
+("liycb"	"Y")
+("liyck"	"")
+("liyg"	"E")
+("liyhn"	"ӹ")
+("liyia"	"")
+("liyij"	"")
+("liyj"	"B")
+("liyk"	"A")
+("liypt"	"O")
+("liyr"	"ף")
+("liyra"	"@")
+("liyrd"	"")
+("liyrn"	"")
+("liyro"	"Į")
+("liyrv"	"")
+("liysd"	"")
+("liytj"	"")
+("liyub"	"Z")
+("liyv"	"j")
+("liyvi"	"}")
+("liywm"	"")
+("liyx"	"")
+("ljc"	"׳")
+("ljcr"	"y")
+("lje"	"")
+("ljic"	"")
+("ljka"	"u")
+("ljp"	"ײ")
+("lk"	"v")
+("lkbt"	"s")
+("lkhaf"	"m")
+("lkld"	"")
+("lklu"	"")
+("lkma"	"K")
+("lkoo"	"")
+("ll"	"")
+("llamh"	"Z")
+("llbu"	"")
+("lldwf"	"")
+("llfq"	"ϸ")
+("llgwc"	"|")
+("llhe"	"")
+("llhhj"	"P")
+("llhsb"	"")
+("llii"	"f")
+("lll"	"t")
+("lllc"	"")
+("llml"	"")
+("llmy"	"")
+("lln"	"")
+("llomn"	"y")
+("llp"	"w")
+("llpb"	"")
+("llptd"	"")
+("llshr"	"Ϲ")
+("llw"	"S")
+("llwv"	"")
+("llww"	"˱")
+("llxl"	"B")
+("llybs"	"")
+("lma"	"")
+("lmbb"	"")
+("lmbuc"	"Q")
+("lmfbc"	"")
+("lmfbt"	"")
+("lmi"	"")
+("lmlb"	"")
+("lmln"	"")
+("lmmm"	"")
+("lmmp"	"H")
+("lmmv"	"")
+("lmp"	"_")
+("lmpnl"	"")
+("lmrt"	"")
+("lmrw"	"")
+("lmuo"	"")
+("lmuoc"	"f")
+("lmuou"	"")
+("lmvi"	"")
+("lmwf"	"t")
+("lmwu"	"s")
+("lmyq"	"")
+("lmyyn"	"")
+("lmyyy"	"D")
+("ln"	"")
+("lnao"	"")
+("lnbuc"	"O")
+("lncr"	"")
+("lnhe"	"")
+("lnhxu"	"")
+("lnii"	"u")
+("lnln"	"l")
+("lnmjk"	"")
+("lnnau"	"X")
+("lnnxu"	"")
+("lnoe"	"")
+("lntc"	"i")
+("lnylb"	"x")
+("loae"	"")
+("lob"	"")
+("lohh"	"׿")
+("loik"	"")
+("loim"	"")
+("loin"	"")
+("loma"	"")
+("lomn"	"")
+("lomo"	"")
+("lomr"	"")
+("lopd"	"׻")
+("lord"	"")
+("lp"	"")
+("lpb"	"I")
+("lpd"	"Э")
+("lpim"	"")
+("lpr"	"׼")
+("lpru"	"T")
+("lptd"	"")
+("lpwtc"	"")
+("lq"	"")
+("lqhk"	"")
+("lqmat"	"")
+("lqmv"	"")
+("lqo"	"")
+("lrb"	"")
+("lrhg"	"")
+("lrrd"	"")
+("lrrj"	"")
+("lsav"	"")
+("lsh"	"")
+("lshr"	"׸")
+("lsit"	"İ")
+("lsjr"	"")
+("lskr"	"")
+("lsma"	"")
+("lsmi"	"")
+("ltbi"	"I")
+("ltco"	"")
+("ltgi"	"J")
+("ltor"	"")
+("ltwi"	"")
+("ltwv"	"")
+("lu"	"I")
+("lue"	"C")
+("luhaf"	"}")
+("lunl"	"˩")
+("lvbu"	"N")
+("lvhaf"	"")
+("lvhqu"	"")
+("lvis"	"")
+("lvno"	"")
+("lvok"	"")
+("lvr"	"")
+("lw"	"")
+("lwb"	"`H")
+("lwd"	"r")
+("lwg"	"")
+("lwk"	"")
+("lwl"	"")
+("lwli"	"")
+("lwlj"	"")
+("lwlp"	"")
+("lwlv"	"")
+("lwmvs"	"n")
+("lwot"	"p")
+("lwp"	"")
+("lx"	"")
+("lxhaf"	"e")
+("lyav"	"")
+("lybb"	"")
+("lybp"	"R")
+("lyd"	"")
+("lydu"	"Ũ")
+("lyiu"	"")
+("lyjj"	"r")
+("lyjwj"	"")
+("lyk"	"")
+("lylmi"	"")
+("lyoiv"	"K")
+("lyp"	"d")
+("lysmm"	"B")
+("lyto"	"")
+("lyub"	"q")
+("lyv"	"")
+("lyvi"	"״")
+("lywm"	"")
+("lyyhv"	"p")
+("lyyk"	"")
+("m"	"@")
+("ma"	"")
+("mabk"	"")
+("mad"	"U")
+("mahr"	"F")
+("mai"	"")
+("mama"	"ڷ")
+("mamr"	"")
+("mand"	"p")
+("manl"	"")
+("mbbhg"	"ŵ")
+("mbbhv"	"w")
+("mbbmo"	"x")
+("mbcsh"	"ܨ")
+("mbdbu"	"")
+("mbdd"	"M")
+("mbddh"	"~")
+("mbdi"	"@")
+("mbebg"	"")
+("mbebr"	"")
+("mbed"	"")
+("mbejb"	"")
+("mbemm"	"")
+("mbeni"	"S")
+("mbetc"	"")
+("mbetv"	"H")
+("mbeyr"	"L")
+("mbfb"	"]")
+("mbhaf"	"{^")
+("mbhfd"	"")
+("mbhhh"	"S")
+("mbhhw"	"")
+("mbhok"	"o")
+("mbhxu"	"O")
+("mbjlv"	"Q")
+("mbk"	"R")
+("mbks"	"y")
+("mblbk"	"")
+("mbll"	"")
+("mblmi"	"")
+("mblmo"	"")
+("mblmy"	"P")
+("mbm"	"")
+("mbmbl"	"")
+("mbmdm"	"E")
+("mbmgi"	"â")
+("mbmmi"	"")
+("mbmms"	"")
+("mbmmv"	"_")
+("mbnhs"	"")
+("mbnhu"	"q")
+("mbnih"	"")
+("mbnkg"	"^")
+("mbnl"	"")
+("mbnot"	"I")
+("mboah"	"")
+("mbog"	"N")
+("mbogg"	"")
+("mboii"	"s")
+("mbowy"	"`")
+("mbp"	"~")
+("mbphe"	"~")
+("mbpru"	"r")
+("mbrbc"	"v")
+("mbrji"	"n")
+("mbrmr"	"S")
+("mbrrm"	"F")
+("mbrrr"	"")
+("mbrye"	"")
+("mbsfi"	"}")
+("mbsm"	"")
+("mbsma"	"{")
+("mbsmm"	"")
+("mbsrj"	"R")
+("mbtbk"	"")
+("mbtjb"	"Q")
+("mbtlk"	"")
+("mbtm"	"")
+("mbuc"	"^")
+("mbuce"	"")
+("mbv"	"A")
+("mbw"	"p")
+("mbwtc"	"|")
+("mbwu"	"q")
+("mbybp"	"")
+("mbydl"	"z")
+("mbyhs"	"ܧ")
+("mbyk"	"")
+("mbymr"	"")
+("mbyrv"	"G")
+("mbytn"	"")
+("mbytv"	"K")
+("mbyx"	"Ŵ")
+("mche"	"")
+("mcw"	"")
+("mcwm"	"")
+("md"	"_")
+("mda"	"")
+("mdbt"	"")
+("mdhaf"	"")
+("mdm"	"")
+("mdmr"	"V")
+("mdnl"	"S")
+("mdylm"	"")
+("me"	"E")
+("mem"	"E")
+("menl"	"M")
+("mf"	"")
+("mfbk"	"")
+("mfbq"	"")
+("mfbt"	"")
+("mfbuc"	"Ŭ")
+("mfbuu"	"C")
+("mfhaf"	"")
+("mfhhh"	"")
+("mfhni"	"")
+("mfhvo"	"]")
+("mfj"	"")
+("mfk"	"ʱ")
+("mfln"	"")
+("mfm"	"A")
+("mfmbc"	"@N")
+("mfmym"	"n")
+("mfnl"	"k")
+("mfp"	"@")
+("mfr"	"_")
+("mfsmm"	"")
+("mfvnd"	"e")
+("mg"	"")
+("mgaa"	"ڨ")
+("mgabu"	"")
+("mgahm"	"޳")
+("mgahu"	"޲")
+("mgamh"	"ޫ")
+("mgapp"	"b")
+("mgau"	"]")
+("mgayf"	"[")
+("mgayk"	"ڧ")
+("mgb"	"A")
+("mgbbe"	"")
+("mgbcd"	"`")
+("mgbcv"	"")
+("mgbgr"	"ڤ")
+("mgbjj"	"")
+("mgbm"	"")
+("mgbme"	"ޭ")
+("mgbnd"	"y")
+("mgbou"	"")
+("mgbsd"	"ڥ")
+("mgbt"	"")
+("mgbuc"	"t")
+("mgbuu"	"{")
+("mgby"	"l")
+("mgcnh"	"k")
+("mgcsh"	"j")
+("mgcwa"	"e")
+("mgdd"	"Y")
+("mgdhe"	"")
+("mgdk"	"i")
+("mgdmq"	"ު")
+("mgegi"	"W")
+("mgeii"	"")
+("mgfbc"	"")
+("mgfbw"	"h")
+("mgfdq"	"Z")
+("mgff"	"|")
+("mgfmu"	"Ү")
+("mggb"	"")
+("mggg"	"^")
+("mggnf"	"")
+("mggsk"	"")
+("mgha"	"")
+("mghae"	"޵")
+("mghaf"	"")
+("mghby"	"Һ")
+("mghdn"	"|")
+("mghds"	"q")
+("mghdw"	"d")
+("mgher"	"_")
+("mghgu"	"ҹ")
+("mghhl"	"")
+("mghi"	"")
+("mghjd"	"]")
+("mghlb"	"ޮ")
+("mghnb"	"\")
+("mghon"	"Ҳ")
+("mghoo"	"")
+("mghqi"	"x")
+("mghuc"	"")
+("mghwp"	"")
+("mghxc"	"B")
+("mgi"	"ɧ")
+("mgiav"	"w")
+("mgihr"	"ީ")
+("mgihs"	"V")
+("mgii"	"~")
+("mgiil"	"")
+("mgije"	"y")
+("mgilg"	"Z")
+("mgilr"	"")
+("mgir"	"")
+("mgisk"	"u")
+("mgjbc"	"")
+("mgjch"	"ޯ")
+("mgjcr"	"")
+("mgjii"	"")
+("mgjmc"	"@")
+("mgjmf"	"z")
+("mgjmm"	"ި")
+("mgjnu"	"{")
+("mgjrb"	"")
+("mgjrr"	"_")
+("mgkb"	"ҵ")
+("mgkkb"	"w")
+("mgkld"	"Ҷ")
+("mgkmr"	"a")
+("mgksr"	"")
+("mglll"	"k")
+("mglmo"	"Ұ")
+("mglmt"	"E")
+("mglmy"	"ڪ")
+("mgln"	"")
+("mglq"	"Ҵ")
+("mglwl"	"")
+("mgm"	"l")
+("mgmbb"	"A")
+("mgmbc"	"z")
+("mgmd"	"i")
+("mgmfj"	"")
+("mgmg"	"")
+("mgmgh"	"l")
+("mgmhl"	"x")
+("mgmig"	"U")
+("mgmj"	"h")
+("mgmmr"	"l")
+("mgmmu"	"")
+("mgmn"	"E")
+("mgmnr"	"")
+("mgmso"	"Z")
+("mgmvh"	"g")
+("mgmvn"	"")
+("mgmwd"	"")
+("mgnbe"	"ã")
+("mgnbk"	"޴")
+("mgnhb"	"c")
+("mgnkg"	"p")
+("mgnl"	"лR")
+("mgno"	"h")
+("mgnot"	"f")
+("mgohh"	"")
+("mgoii"	"")
+("mgoin"	"^")
+("mgoip"	"")
+("mgoir"	"r")
+("mgoj"	"m")
+("mgok"	"P")
+("mgoll"	"k")
+("mgoma"	"n")
+("mgomn"	"")
+("mgomr"	"һ")
+("mgono"	"o")
+("mgpa"	"ұ")
+("mgph"	"")
+("mgpi"	"j")
+("mgpp"	"\h")
+("mgppa"	"ޱ")
+("mgpru"	"")
+("mgpt"	"")
+("mgqj"	"f")
+("mgqkd"	"")
+("mgqkq"	"}")
+("mgrb"	"n")
+("mgrhg"	"m")
+("mgrmr"	"i")
+("mgrr"	"")
+("mgrrd"	"j")
+("mgrye"	"")
+("mgryo"	"u")
+("mgshr"	"")
+("mgsj"	"ҭ")
+("mgsjr"	"ڡ")
+("mgskr"	"s")
+("mgsmh"	"")
+("mgsmi"	"g")
+("mgsmj"	"F")
+("mgsmm"	"ҷ")
+("mgsqf"	"")
+("mgt"	"")
+("mgtbc"	"ک")
+("mgtbn"	"ް")
+("mgtc"	"Ҭ")
+("mgtco"	"\")
+("mgtgt"	"G")
+("mgtlb"	"")
+("mgtlk"	"")
+("mgtlm"	"@")
+("mgtm"	"")
+("mgtmc"	"XX")
+("mgtod"	"")
+("mgtoe"	"C")
+("mgtq"	"ҳ")
+("mgtqm"	"")
+("mgtrg"	"")
+("mgtrk"	"m")
+("mgumb"	"")
+("mguob"	"")
+("mguog"	"A")
+("mguon"	"v")
+("mgvid"	"t")
+("mgvii"	"Y")
+("mgvne"	"ڣ")
+("mgvno"	"ެ")
+("mgvvd"	"")
+("mgvvw"	"")
+("mgwg"	"z")
+("mgwk"	"Ҹ")
+("mgwl"	"")
+("mgwlv"	"")
+("mgwww"	"v")
+("mgybj"	"k")
+("mgybk"	"")
+("mgybp"	"n")
+("mgybu"	"{")
+("mgyck"	"ҫ")
+("mgyed"	"")
+("mgyfe"	"ڢ")
+("mgyiu"	"[")
+("mgyjj"	"")
+("mgyk"	"")
+("mgykg"	"")
+("mgymp"	"ү")
+("mgyog"	"h")
+("mgypo"	"")
+("mgypu"	"[")
+("mgyr"	"")
+("mgyrv"	"")
+("mgyso"	"")
+("mgytj"	"")
+("mgyto"	"g")
+("mgytr"	"ڦ")
+("mgyub"	"")
+("mgyvi"	"")
+("mgyx"	"D")
+("mgyyb"	"s")
+("mh"	"D")
+("mhaf"	"")
+("mhdd"	"d")
+("mhhaf"	"~")
+("mhjm"	"p")
+("mhnl"	"")
+("mhog"	"")
+("mhoiv"	"K")
+("mhpm"	"t")
+("mhs"	"u")
+("mibbe"	"W")
+("mig"	"")
+("mihi"	"")
+("miia"	"")
+("minl"	"")
+("mioin"	"R")
+("miuh"	"")
+("miyle"	"")
+("mj"	"z")
+("mjbc"	"e")
+("mjf"	"{")
+("mjhaf"	"d")
+("mjixp"	"")
+("mjln"	"Z")
+("mjmbc"	"ܬ")
+("mjnl"	"R")
+("mjok"	"")
+("mjwj"	"")
+("mk"	"")
+("mkg"	"")
+("mkhi"	"L")
+("mkhqm"	"d")
+("mkmwl"	"")
+("mknl"	"")
+("mkoiv"	"")
+("mkp"	"w")
+("mks"	"\")
+("mkv"	"")
+("mkwgf"	"}")
+("mkwl"	"")
+("ml"	"F")
+("mlbo"	"")
+("mlby"	"B")
+("mllm"	"")
+("mlm"	"u")
+("mlmy"	"")
+("mlvs"	"M")
+("mlwk"	"")
+("mm"	"G")
+("mmbbp"	"R")
+("mmbc"	"")
+("mmf"	"")
+("mmg"	"")
+("mmhaf"	"M")
+("mmi"	"")
+("mmig"	"")
+("mmks"	"l")
+("mml"	"Q")
+("mmlmi"	"")
+("mmln"	"")
+("mmm"	"T")
+("mmmbc"	"V")
+("mmmv"	"")
+("mmn"	"H")
+("mmnl"	"")
+("mmok"	"F")
+("mmp"	"c")
+("mmr"	"^")
+("mmu"	"")
+("mmuu"	"")
+("mmvh"	"")
+("mmvn"	"o")
+("mmvs"	"")
+("mmyiu"	"W")
+("mmypu"	"X")
+("mn"	"B")
+("mnbm"	"e")
+("mnbnd"	"")
+("mnc"	"")
+("mnf"	"P")
+("mng"	"")
+("mngbt"	"")
+("mngwc"	"Z")
+("mnhaf"	"")
+("mnhbt"	"")
+("mnhjd"	"")
+("mnhk"	"")
+("mnhpa"	"")
+("mnhuk"	"h")
+("mni"	"")
+("mnii"	"")
+("mnije"	"")
+("mnir"	"p")
+("mnjbm"	"")
+("mnjmc"	"l")
+("mnjru"	"")
+("mnklu"	"")
+("mnkoo"	"")
+("mnkpb"	"")
+("mnl"	"T")
+("mnlbk"	"o")
+("mnle"	"")
+("mnlmi"	"ۼ")
+("mnln"	"C")
+("mnlq"	"")
+("mnmbc"	"")
+("mnmem"	"")
+("mnmvm"	"")
+("mnmwm"	"L")
+("mnne"	"\")
+("mnnwf"	"q")
+("mnoah"	"")
+("mnohh"	"f")
+("mnoim"	"")
+("mnomo"	"")
+("mnp"	"")
+("mnpa"	"")
+("mnphh"	"")
+("mnr"	"i")
+("mnrbc"	"f")
+("mnrrj"	"")
+("mnryo"	"r")
+("mntlj"	"d")
+("mntlm"	"")
+("mnv"	"u")
+("mnwot"	"g")
+("mnyfu"	"")
+("mnyhv"	"")
+("mnytr"	"")
+("mo"	"")
+("moau"	"")
+("moav"	"V")
+("mob"	"")
+("mobuu"	"D")
+("mobvk"	"")
+("mof"	"")
+("mogbt"	"E")
+("mohaf"	"n")
+("mohf"	"")
+("mohoo"	"")
+("mohsn"	"")
+("mojka"	"")
+("mojtc"	"F")
+("moju"	"")
+("mok"	"")
+("mokkb"	"Q")
+("molmi"	"")
+("moln"	"")
+("momhf"	"")
+("momso"	"R")
+("momt"	"")
+("moo"	"")
+("moog"	"")
+("morye"	"")
+("mowot"	"")
+("moyvo"	"U")
+("mphaf"	"")
+("mpnl"	"Ű")
+("mpylm"	"Z")
+("mr"	"")
+("mramh"	"")
+("mrapv"	"")
+("mrav"	"ֶ")
+("mrbb"	"N")
+("mrbbr"	"")
+("mrbgr"	"M")
+("mrbj"	"")
+("mrbl"	"")
+("mrbm"	"")
+("mrbmr"	"ֻ")
+("mrbsd"	"")
+("mrbtu"	"")
+("mrbuu"	"x")
+("mrbvk"	"")
+("mrby"	"")
+("mrcsh"	"")
+("mrcwa"	"")
+("mrdam"	"")
+("mrdci"	"")
+("mrdd"	"")
+("mrddo"	"¦")
+("mrdhe"	"}")
+("mrdm"	"")
+("mre"	"")
+("mreed"	"")
+("mresd"	"")
+("mrfb"	"v")
+("mrfbw"	"]")
+("mrfdq"	"C")
+("mrfff"	"")
+("mrfh"	"")
+("mrgg"	"ֺ")
+("mrggu"	"")
+("mrgi"	"|")
+("mrgit"	"W")
+("mrgr"	"ֳ")
+("mrgrr"	"")
+("mrgsk"	"")
+("mrhdw"	"")
+("mrher"	"ָ")
+("mrhgr"	"")
+("mrhhj"	"O")
+("mrhi"	"")
+("mrhio"	"")
+("mrhjd"	"")
+("mrhje"	"")
+("mrhjm"	"")
+("mrhkb"	"")
+("mrhlc"	"~")
+("mrhml"	"H")
+("mrhne"	"")
+("mrhp"	"~")
+("mrhpm"	"")
+("mrhqi"	"")
+("mrhs"	"")
+("mrhsb"	"")
+("mrhsk"	"Z")
+("mrhsn"	"")
+("mrhuc"	"")
+("mrhyu"	"")
+("mriav"	"")
+("mrie"	"")
+("mrihf"	"")
+("mriih"	"")
+("mrilr"	"")
+("mritc"	"q")
+("mriuh"	"")
+("mrjbc"	"")
+("mrjcm"	"Q")
+("mrjii"	"j")
+("mrjmc"	"")
+("mrjmo"	"")
+("mrjnu"	"J")
+("mrjp"	"")
+("mrjqr"	"")
+("mrjwj"	"")
+("mrkkk"	"")
+("mrkmr"	"")
+("mrkoo"	"")
+("mrlln"	"")
+("mrlq"	"ֵ")
+("mrlwl"	"~")
+("mrm"	"{")
+("mrmbb"	"}")
+("mrmbc"	"")
+("mrmbg"	"")
+("mrmbu"	"")
+("mrmbw"	"W")
+("mrmcw"	"ִ")
+("mrmfj"	"y")
+("mrmgi"	"")
+("mrmj"	"z")
+("mrmlk"	"w")
+("mrmnr"	"")
+("mrmpm"	"")
+("mrmr"	"")
+("mrmrr"	"U")
+("mrmt"	"")
+("mrmtb"	"r")
+("mrmtn"	"")
+("mrmu"	"|")
+("mrmvb"	"")
+("mrmvh"	"")
+("mrmvm"	"")
+("mrmwj"	"")
+("mrmwm"	"X")
+("mrnbg"	"")
+("mrnd"	"͡")
+("mrnhe"	"")
+("mrni"	"")
+("mrnl"	"")
+("mrnmu"	"ַ")
+("mrno"	"q")
+("mrnot"	"E")
+("mrnqd"	"")
+("mrnr"	"")
+("mrobg"	"T")
+("mrog"	"P")
+("mrogd"	"")
+("mrogf"	"G")
+("mroii"	"")
+("mrok"	"")
+("mroll"	"")
+("mromb"	"")
+("mromd"	"")
+("mron"	"}")
+("mrpko"	"ê")
+("mrpp"	"")
+("mrpru"	"")
+("mrpsh"	"")
+("mrptd"	"")
+("mrqmb"	"")
+("mrqmc"	"l")
+("mrqmy"	"")
+("mrqo"	"")
+("mrrrj"	"")
+("mrrrk"	"")
+("mrrye"	"")
+("mrsec"	"y")
+("mrsit"	"~")
+("mrslb"	"{")
+("mrsmh"	"")
+("mrsqf"	"X")
+("mrsrj"	"Y")
+("mrstv"	"V")
+("mrt"	"")
+("mrta"	"")
+("mrtbc"	"K")
+("mrtbf"	"}")
+("mrtbo"	"")
+("mrtgi"	"\")
+("mrtii"	"")
+("mrtlk"	"")
+("mrtmc"	"D")
+("mrtmv"	"")
+("mrtqm"	"R")
+("mrttc"	"I")
+("mrtvi"	"")
+("mrtvs"	"")
+("mrtwi"	"z")
+("mrtxc"	"")
+("mrtyv"	"")
+("mrubb"	"")
+("mrumf"	"")
+("mrumt"	"")
+("mruog"	"")
+("mrvid"	"t")
+("mrvii"	"F")
+("mrvne"	"L")
+("mrwd"	"")
+("mrwhd"	"")
+("mrwmv"	"")
+("mrwvf"	"")
+("mrwww"	"{")
+("mrwyi"	"")
+("mrybb"	"")
+("mrybs"	"S")
+("mrydk"	"")
+("mryg"	"")
+("mryiu"	"")
+("mryoj"	"H")
+("mryr"	"z")
+("mryrb"	"")
+("mryrn"	"")
+("mryt"	"")
+("mrytr"	"")
+("mrywi"	"")
+("ms"	"E")
+("msho"	"")
+("msko"	"")
+("msnl"	"j")
+("msok"	"")
+("msu"	"")
+("mt"	"")
+("mta"	"")
+("mthaf"	"")
+("mthhh"	"")
+("mthhj"	"")
+("mtje"	"a")
+("mtjnu"	"")
+("mtln"	"D")
+("mtm"	"")
+("mtmbc"	"Y")
+("mtnl"	"")
+("mtog"	"ܦ")
+("mtq"	"w")
+("mttxc"	"")
+("mtuo"	"")
+("mtwb"	"F")
+("mu"	"aJ")
+("mua"	"٩")
+("muali"	"")
+("mub"	"P")
+("muhe"	"L")
+("mui"	"")
+("mukll"	"ش")
+("mulmi"	"k")
+("muln"	"ɽ")
+("mumbc"	"x")
+("mumrb"	"")
+("mumso"	"")
+("munl"	"˫")
+("munmu"	"")
+("mv"	"C")
+("mvb"	"")
+("mvdh"	"")
+("mvdi"	"d")
+("mvku"	"^")
+("mvlmi"	"")
+("mvni"	"")
+("mvnm"	"")
+("mvphh"	"")
+("mvr"	"B")
+("mvvm"	"")
+("mwahm"	"")
+("mwaj"	"")
+("mwamo"	"")
+("mwbdi"	"t")
+("mwbmr"	"")
+("mwbuc"	"")
+("mwbuu"	"S")
+("mwbwi"	"")
+("mwcsh"	"")
+("mwd"	"")
+("mwdd"	"_")
+("mwdi"	"@")
+("mweee"	"]")
+("mwfd"	"")
+("mwg"	"X")
+("mwhaf"	"z")
+("mwhd"	"p")
+("mwher"	"T")
+("mwhgf"	"H")
+("mwhgr"	"")
+("mwhi"	"")
+("mwhio"	"")
+("mwhne"	"")
+("mwhoe"	"")
+("mwhqu"	"")
+("mwhs"	"`")
+("mwhsk"	"")
+("mwhxe"	"")
+("mwice"	"")
+("mwidd"	"")
+("mwii"	"\")
+("mwijb"	"r")
+("mwill"	"S")
+("mwilr"	"")
+("mwjcs"	"")
+("mwjka"	"")
+("mwjkd"	"")
+("mwjp"	"]")
+("mwjr"	"^")
+("mwjrb"	"")
+("mwklu"	"M")
+("mwkrt"	"")
+("mwlbu"	"")
+("mwlii"	"C")
+("mwlkt"	"")
+("mwln"	"")
+("mwlut"	"")
+("mwmbb"	"]")
+("mwmbr"	"")
+("mwmj"	"")
+("mwmmf"	"")
+("mwmmp"	"q")
+("mwmn"	"")
+("mwmnr"	"a")
+("mwmwf"	"O")
+("mwmwj"	"^")
+("mwnir"	"U")
+("mwnob"	"")
+("mwnoe"	"")
+("mwog"	"a")
+("mwogf"	"")
+("mwomd"	"")
+("mwpa"	"")
+("mwpd"	"A")
+("mwpi"	"u")
+("mwpou"	"`")
+("mwrhg"	"s")
+("mwrrk"	"o")
+("mwsmh"	"R")
+("mwsrr"	"P")
+("mwsu"	"t")
+("mwta"	"L")
+("mwtco"	"_")
+("mwtlf"	"I")
+("mwtm"	"o")
+("mwtog"	"")
+("mwtqm"	"")
+("mwtwt"	"Ŀ")
+("mwtwv"	"")
+("mwuk"	"")
+("mwv"	"n")
+("mwvib"	"u")
+("mwvne"	"^")
+("mwwlj"	"")
+("mwwot"	"")
+("mwyfd"	"")
+("mwyl"	"")
+("mwyoj"	"K")
+("mwypo"	"")
+("mwyr"	"_")
+("mwyrd"	"J")
+("mwyrv"	"C")
+("mwytp"	"")
+("mwytr"	"[")
+("mwyub"	"N")
+("mwyut"	"Q")
+("my"	"U")
+("mylf"	"j")
+("mylm"	"")
+("myp"	"")
+("mytj"	"")
+("myvs"	"")
+("n"	"}")
+("nahu"	"K")
+("napo"	"H")
+("nau"	"")
+("nbam"	"")
+("nbb"	"M")
+("nbbue"	"")
+("nbdk"	"")
+("nbdl"	"H")
+("nbfmu"	"")
+("nbg"	"Z")
+("nbgg"	"")
+("nbhaf"	"f")
+("nbher"	"@")
+("nbhpm"	"")
+("nbhqu"	"")
+("nbhvo"	"")
+("nbhxu"	"")
+("nbije"	"G")
+("nbjka"	"")
+("nbk"	"")
+("nbkmr"	"")
+("nbks"	"io")
+("nblmi"	"D")
+("nbln"	"A")
+("nbme"	"I")
+("nbmgi"	"")
+("nbnbe"	"ũ")
+("nbnhe"	"")
+("nbnmu"	"")
+("nboah"	"")
+("nbop"	"o")
+("nbp"	"v")
+("nbrrj"	"")
+("nbshq"	"")
+("nbtgq"	"|")
+("nbtlf"	"")
+("nbu"	"m")
+("nbuc"	"t")
+("nbue"	"")
+("nbuob"	"L")
+("nbvid"	"U")
+("nbvl"	"Я")
+("nbwli"	"Ĳ")
+("nbyj"	"")
+("nc"	"p")
+("ncymr"	"")
+("nd"	"l")
+("ndbt"	"s")
+("ndhaf"	"")
+("ndhvf"	"]")
+("ndhvo"	"t")
+("ndjmf"	"")
+("ndlmt"	"")
+("ndmbb"	"")
+("ndmlm"	"")
+("ndnd"	"")
+("ndok"	"")
+("ndpru"	"U")
+("ndu"	"")
+("ndyvo"	"")
+("ne"	"ɡ")
+("nem"	"")
+("nemb"	"o")
+("nemf"	"m")
+("nemsu"	"ί")
+("nfaa"	"I")
+("nfagi"	"")
+("nfail"	"V")
+("nfamo"	"l")
+("nfapp"	"")
+("nfasm"	"")
+("nfawe"	"")
+("nfb"	"z")
+("nfbgr"	"K")
+("nfbmr"	"n")
+("nfbof"	"")
+("nfbou"	"")
+("nfcru"	"")
+("nfcsh"	"")
+("nfdn"	"")
+("nfdoo"	"")
+("nffb"	"")
+("nffba"	"Z")
+("nffdq"	"")
+("nffh"	"")
+("nfgce"	"")
+("nfgcg"	"")
+("nfgg"	"D")
+("nfggu"	"^")
+("nfgi"	"v")
+("nfgr"	"j")
+("nfhag"	"v")
+("nfhd"	"q")
+("nfhdd"	"")
+("nfhdf"	"")
+("nfhdw"	"]")
+("nfhe"	"")
+("nfher"	"p")
+("nfhhw"	"")
+("nfhir"	"z")
+("nfhjd"	"s")
+("nfhkb"	"`")
+("nfhor"	"")
+("nfhp"	"")
+("nfhrb"	"")
+("nfhs"	"z")
+("nfhvf"	"X")
+("nfhxc"	"[")
+("nfhxh"	"")
+("nfhxu"	"")
+("nfihr"	"u")
+("nfijb"	"")
+("nfije"	"")
+("nfiku"	"{")
+("nfir"	"|")
+("nfjcr"	"")
+("nfjd"	"u")
+("nfjii"	"")
+("nfjmu"	"")
+("nfjp"	"s")
+("nfjpa"	"_")
+("nfjr"	"~")
+("nfjrb"	"t")
+("nfkb"	"C")
+("nflmo"	"o")
+("nflmy"	"")
+("nflx"	"Y")
+("nfm"	"")
+("nfmbl"	"l")
+("nfmbm"	"")
+("nfmfm"	"w")
+("nfmgr"	"s")
+("nfmlk"	"")
+("nfmmp"	"")
+("nfmmr"	"")
+("nfmnr"	"}")
+("nfmtb"	"y")
+("nfmto"	"")
+("nfmvm"	"")
+("nfmwf"	"")
+("nfnao"	"_")
+("nfnau"	"")
+("nfnhb"	"Z")
+("nfnhd"	"q")
+("nfnkq"	"r")
+("nfnmu"	"t")
+("nfnoe"	"[")
+("nfoae"	"n")
+("nfob"	"")
+("nfodi"	"{")
+("nfoip"	"")
+("nfold"	"")
+("nfoma"	"")
+("nfomd"	"")
+("nfomr"	"u")
+("nfonk"	"o")
+("nfop"	"")
+("nfp"	"")
+("nfpa"	"k")
+("nfph"	"t")
+("nfpi"	"")
+("nfpr"	"")
+("nfpru"	"j")
+("nfptd"	"k")
+("nfpu"	"")
+("nfqka"	"s")
+("nfqmb"	"J")
+("nfqmc"	"")
+("nfrrd"	"")
+("nfrxu"	"")
+("nfsav"	"j")
+("nfseg"	"")
+("nfsh"	"")
+("nfsje"	"")
+("nfsju"	"")
+("nfskr"	"")
+("nfsma"	"")
+("nfsmb"	"")
+("nfsmi"	"X")
+("nftgr"	"")
+("nftjs"	"")
+("nftm"	"")
+("nftmc"	"")
+("nftq"	"A")
+("nftrg"	"")
+("nftwa"	"")
+("nftwi"	"Ww")
+("nftwt"	"")
+("nftxc"	"")
+("nfvid"	"x")
+("nfvvw"	"")
+("nfwg"	"U")
+("nfwl"	"x")
+("nfwlb"	"m")
+("nfwle"	"`")
+("nfwlv"	"")
+("nfwo"	"y")
+("nfwp"	"")
+("nfyck"	"B")
+("nfyhn"	"")
+("nfyhs"	"")
+("nfyjj"	"ſ")
+("nfyk"	"")
+("nfymf"	"m")
+("nfymo"	"")
+("nfypk"	"")
+("nfypm"	"\")
+("nfypt"	"t")
+("nfyrb"	"")
+("nfyrd"	"")
+("nfyrf"	"H")
+("nfytj"	"")
+("nfytv"	"")
+("nfywm"	"")
+("nfyx"	"\")
+("ng"	"")
+("ngmbc"	"[")
+("ngmwm"	"æ")
+("nhbcr"	"")
+("nhd"	"X")
+("nhe"	"")
+("nhli"	"")
+("nhlii"	"i")
+("nhoin"	"")
+("nhoks"	"")
+("nhpm"	"s")
+("nhs"	"D")
+("nhsqf"	"c")
+("nhta"	"")
+("nhvo"	"")
+("ni"	"i")
+("nibq"	"i")
+("nihaf"	"")
+("nijmc"	"")
+("nili"	"j")
+("niln"	"")
+("ninh"	"")
+("nini"	"h")
+("ninl"	"")
+("ninn"	"")
+("nioiv"	"")
+("niq"	"")
+("nir"	"W")
+("nisu"	"p")
+("niy"	"~")
+("niymr"	"")
+("njhaf"	"")
+("njlii"	"")
+("nk"	"S")
+("nkbu"	"")
+("nkc"	"")
+("nkd"	"")
+("nkf"	"")
+("nkg"	"ب")
+("nkhaf"	"")
+("nkhg"	"")
+("nkhml"	"")
+("nkhym"	"")
+("nki"	"t")
+("nklmi"	"")
+("nklq"	"")
+("nknl"	"U")
+("nksqf"	"E")
+("nktlj"	"~")
+("nkv"	"ظ")
+("nl"	"ݤ")
+("nlamh"	"")
+("nlamo"	"")
+("nlav"	"")
+("nlavf"	"")
+("nlbm"	"")
+("nlbmp"	"")
+("nlbof"	"")
+("nlbt"	"")
+("nldhe"	"@")
+("nldw"	"")
+("nldwk"	"")
+("nlfhf"	"")
+("nlgce"	"")
+("nlgcg"	"")
+("nlggu"	"")
+("nlgi"	"")
+("nlgsk"	"")
+("nlgyo"	"~")
+("nlhag"	"")
+("nlhbk"	"O")
+("nlhe"	"")
+("nlhem"	"")
+("nlheq"	"")
+("nlhhj"	"")
+("nlhi"	"")
+("nlhj"	"")
+("nlhjd"	"")
+("nlhjg"	"ܣ")
+("nlhjm"	"")
+("nlhpm"	"")
+("nlhs"	"")
+("nlhtg"	"")
+("nlhxg"	"ܡ")
+("nlihu"	"˰")
+("nlihv"	"|")
+("nljka"	"G")
+("nljmu"	"|")
+("nljp"	"")
+("nljwj"	"}")
+("nlkb"	"")
+("nlkmb"	"")
+("nlkmm"	"")
+("nlkmr"	"H")
+("nlkms"	"")
+("nlkoo"	"E")
+("nlks"	"ɪ")
+("nllmc"	"")
+("nllmy"	"I")
+("nlma"	"")
+("nlmbk"	"}")
+("nlmbl"	"")
+("nlmbv"	"")
+("nlmfb"	"")
+("nlmmu"	"")
+("nlmnr"	"")
+("nlmob"	"")
+("nlmrb"	"j")
+("nlmsu"	"ˮ")
+("nlmu"	"V")
+("nlmvm"	"")
+("nlnhx"	"")
+("nlnin"	"")
+("nlnj"	"X")
+("nlodi"	"")
+("nloii"	"")
+("nlomb"	"K")
+("nlomd"	"")
+("nlomn"	"ܢ")
+("nlomo"	"I")
+("nlon"	"Y")
+("nlpd"	"W")
+("nlpfd"	"J")
+("nlpou"	"")
+("nlpp"	"˭")
+("nlppa"	"")
+("nlppg"	"")
+("nlrbc"	"k")
+("nlsje"	"")
+("nltct"	"i")
+("nltpo"	"")
+("nltt"	"")
+("nltxc"	"")
+("nlumt"	"")
+("nlwlb"	"")
+("nlwmv"	"~")
+("nlybp"	"")
+("nlyhm"	"")
+("nlyhn"	"")
+("nlyhs"	"")
+("nlykb"	"H")
+("nlylh"	"F")
+("nlylm"	"˯")
+("nlyr"	"")
+("nlytj"	"")
+("nlyto"	"G")
+("nlytr"	"")
+("nlyvo"	"")
+("nlyx"	"")
+("nman"	"]")
+("nmfb"	"")
+("nmlmi"	"")
+("nmnim"	"z")
+("nmnmf"	"d")
+("nmsu"	"M")
+("nmvm"	"y")
+("nmwm"	"")
+("nmyiu"	"")
+("nn"	"F")
+("nnm"	"m")
+("nnmbc"	"w")
+("nnmrb"	"")
+("nnnao"	"")
+("nno"	"n")
+("nnpr"	"")
+("nnqo"	"")
+("nnsmm"	"D")
+("nnvvu"	"")
+("no"	"[")
+("nob"	"E")
+("noc"	"D")
+("nodi"	"r")
+("nof"	"b")
+("nog"	"YP")
+("nohne"	"")
+("nohto"	"")
+("nolmi"	"J")
+("nomk"	"")
+("nomrn"	"")
+("nomrt"	"n")
+("nonhe"	"o")
+("npd"	"")
+("nq"	"P")
+("nqd"	"")
+("nqlmi"	"")
+("nrmvn"	"H")
+("nrppi"	"")
+("nrrj"	"u")
+("nsbt"	"")
+("nsbul"	"")
+("nsd"	"A")
+("nse"	"Z")
+("nsf"	"")
+("nshr"	"p")
+("nsj"	"")
+("nsmv"	"i")
+("nsnd"	"")
+("nsp"	"")
+("nsrr"	"")
+("nti"	"v")
+("ntmc"	"v")
+("ntnl"	"H")
+("nu"	"A")
+("nubu"	"")
+("nue"	"q")
+("nuhaf"	"p")
+("nui"	"")
+("nuks"	"j")
+("numbc"	"F")
+("nup"	"")
+("nusqf"	"")
+("nuv"	"S")
+("nwf"	"")
+("nwfa"	"|")
+("nwlmi"	"j")
+("nwlv"	"t")
+("nwtj"	"")
+("nx"	"")
+("nxff"	"V")
+("nxno"	"")
+("nxu"	"t")
+("nyo"	"")
+("nyrf"	"L")
+("nyvi"	"")
+("o"	"H")
+("oaa"	"")
+("oahe"	"`")
+("oaln"	"D")
+("oam"	"")
+("oamo"	"V")
+("oan"	"")
+("oanb"	"")
+("oanl"	"")
+("oapp"	"")
+("oapv"	"U")
+("oasm"	"Z")
+("oate"	"")
+("oav"	"˼")
+("oavf"	"")
+("oawe"	"ܻ")
+("ob"	"ɺ")
+("obau"	"")
+("obb"	"")
+("obbe"	"")
+("obch"	"")
+("obcn"	"")
+("obgb"	"W")
+("obgr"	"")
+("obhaf"	"")
+("obhd"	"")
+("obhu"	"ɯ")
+("obmc"	"")
+("obmr"	"˾")
+("obnd"	"R")
+("obo"	"")
+("obof"	"ܿ")
+("obou"	"\")
+("obp"	"")
+("obppa"	"")
+("obq"	"")
+("obuu"	"")
+("obv"	"")
+("obvk"	"]")
+("oc"	"T")
+("ocb"	"")
+("oci"	"ɱ")
+("ocor"	"U")
+("ocru"	"")
+("ocsh"	"")
+("ocwa"	"")
+("od"	"")
+("odc"	"k")
+("odci"	"")
+("oddf"	"")
+("oddo"	"")
+("odf"	"nj")
+("odg"	"")
+("odhf"	"")
+("odi"	"I")
+("odm"	"^")
+("odmq"	"")
+("odog"	"")
+("odok"	"")
+("odp"	"")
+("odsmg"	"@")
+("odyj"	"")
+("oe"	"")
+("of"	"t")
+("ofb"	"N")
+("ofbc"	"v")
+("ofbf"	"l")
+("ofbr"	"")
+("ofbw"	"")
+("ofdq"	"")
+("off"	"")
+("offs"	"")
+("ofhaf"	"ik")
+("ofhu"	"f")
+("ofln"	"B")
+("ofmvn"	"q")
+("ofnl"	"Y")
+("ofp"	"z")
+("ofq"	"")
+("ofqu"	"")
+("og"	"KA")
+("ogbuc"	"")
+("ogce"	"")
+("ogd"	"")
+("ogdi"	"")
+("oge"	"")
+("ogf"	"J")
+("ogg"	"")
+("oggu"	"")
+("oghaf"	"b")
+("oghq"	"l")
+("ogi"	"]")
+("ogj"	"G")
+("oglms"	"m")
+("ogln"	"")
+("ogni"	"")
+("ogog"	"P")
+("ogogg"	"")
+("ogp"	"ѡ")
+("ogr"	"˸")
+("ogrg"	"")
+("ogrr"	"")
+("ogsk"	"")
+("ogtj"	"")
+("ogwc"	"")
+("ogyrg"	"A")
+("oh"	"J")
+("oha"	"B")
+("ohag"	"]")
+("ohbt"	"")
+("ohby"	"")
+("ohce"	"")
+("ohdf"	"Z")
+("ohdi"	"")
+("ohdn"	"W")
+("ohdp"	"ܾ")
+("ohdv"	"")
+("ohdw"	"")
+("oher"	"")
+("ohey"	"c")
+("ohfp"	"")
+("ohg"	"")
+("ohgu"	"")
+("ohhj"	"")
+("ohi"	"")
+("ohj"	"a")
+("ohjd"	"")
+("ohjg"	"\")
+("ohjm"	"[")
+("ohjr"	"")
+("ohjx"	"X")
+("ohkb"	"")
+("ohlb"	"Y")
+("ohml"	"ɻ")
+("ohn"	"S")
+("ohnb"	"")
+("ohni"	"g")
+("ohoa"	"")
+("ohoi"	"_")
+("ohoo"	"")
+("ohpm"	"C")
+("ohq"	"")
+("ohqi"	"X")
+("ohqo"	"H")
+("ohs"	"@")
+("ohsb"	"")
+("ohsg"	"")
+("ohsk"	"")
+("ohuc"	"")
+("ohvf"	"Y")
+("ohvl"	"")
+("ohwp"	"")
+("ohxu"	"")
+("ohyu"	"^")
+("oi"	"")
+("oiamh"	"O")
+("oiapp"	"_")
+("oiapv"	"P")
+("oiar"	"")
+("oiav"	"")
+("oiawe"	"C")
+("oibi"	"")
+("oibjj"	"L")
+("oibmr"	"")
+("oibv"	"k")
+("oice"	"T")
+("oicyo"	"_")
+("oidl"	"")
+("oieee"	"]")
+("oifbd"	"Y")
+("oiff"	"\")
+("oigbt"	"T")
+("oiggu"	"")
+("oigit"	"")
+("oigrr"	"U")
+("oihaf"	"o")
+("oihag"	"R")
+("oihbr"	"")
+("oihdv"	"^")
+("oihe"	"")
+("oihf"	"")
+("oihg"	"")
+("oihhl"	"")
+("oihhw"	"H")
+("oihi"	"J")
+("oihjr"	"")
+("oihk"	"ܮ")
+("oihn"	"")
+("oihon"	"T")
+("oihp"	"O")
+("oihq"	"")
+("oihqi"	"j")
+("oihuc"	"")
+("oihxe"	"I")
+("oii"	"")
+("oiibi"	"")
+("oiice"	"")
+("oiii"	"^")
+("oiijb"	"")
+("oiir"	"~")
+("oijbd"	"")
+("oije"	"")
+("oijrb"	"M")
+("oijrr"	"]")
+("oijtc"	"V")
+("oik"	"")
+("oikf"	"")
+("oikkb"	"a")
+("oiku"	"ɬ")
+("oilb"	"")
+("oilmc"	"X")
+("oilmi"	"k")
+("oilmm"	"D")
+("oimbc"	"")
+("oimbk"	"N")
+("oimn"	"H")
+("oimo"	"˵")
+("oimrt"	"")
+("oimvn"	"Ҿ")
+("oin"	"")
+("oinc"	"g")
+("oinhx"	"`")
+("oini"	"O")
+("oino"	"")
+("oinp"	"")
+("oinr"	"t")
+("oinri"	"a")
+("oint"	"u")
+("oinv"	"")
+("oinw"	"")
+("oioi"	"")
+("oiok"	"S")
+("oioks"	"")
+("oiolb"	"")
+("oiomd"	"l")
+("oiond"	"")
+("oionk"	"S")
+("oip"	"N")
+("oipf"	"")
+("oiph"	"")
+("oipru"	"")
+("oipu"	"")
+("oir"	"d")
+("oiruc"	"W")
+("oisj"	"")
+("oismm"	"")
+("oismr"	"}")
+("oisrr"	"")
+("oitak"	"")
+("oitbo"	"w")
+("oitk"	"")
+("oitlm"	"D")
+("oitqg"	"")
+("oitt"	"")
+("oiv"	"T")
+("oivii"	"")
+("oivno"	"Q")
+("oiwmv"	"")
+("oiyck"	"")
+("oiymh"	"w")
+("oiyrv"	"Y")
+("oiywm"	"v")
+("oj"	"")
+("ojb"	"ɵ")
+("ojbc"	"Y")
+("ojbm"	"")
+("ojcm"	"")
+("ojcr"	"Q")
+("oje"	"ɫ")
+("ojhp"	"˲")
+("ojii"	"")
+("ojk"	"M")
+("ojkp"	"")
+("ojlk"	"")
+("ojln"	"")
+("ojlo"	"")
+("ojmc"	"")
+("ojmf"	"")
+("ojmmr"	"Ԥ")
+("ojmn"	"")
+("ojmo"	"")
+("ojnu"	"")
+("ojp"	"")
+("ojpn"	"")
+("ojr"	"")
+("ojrk"	"")
+("ojrr"	"")
+("ojtc"	"")
+("ojtg"	"")
+("oju"	"")
+("ojv"	"")
+("ok"	"")
+("okb"	"")
+("okcf"	"")
+("okcwa"	"")
+("okf"	"Z")
+("okhae"	"h")
+("okhaf"	"")
+("okhdv"	"G")
+("okhg"	"")
+("okhk"	"")
+("okhkb"	"B")
+("okkb"	"")
+("okkk"	"")
+("oklb"	"G")
+("oklu"	"")
+("okm"	"")
+("okmf"	"")
+("okmr"	"")
+("okmrt"	"u")
+("okms"	"˺")
+("okn"	"˷")
+("oknl"	"")
+("okog"	"n")
+("okoo"	"L")
+("okoog"	"")
+("okp"	"y")
+("okr"	"")
+("okryo"	"a")
+("oks"	"R")
+("oksr"	"")
+("okss"	"x")
+("oktoe"	"|")
+("okvif"	"c")
+("okwlp"	"x")
+("ol"	"")
+("olbk"	"b")
+("oll"	"")
+("olln"	"")
+("olmc"	"")
+("olmo"	"")
+("olmt"	"")
+("olmy"	"")
+("olnk"	"")
+("olob"	"")
+("olod"	"")
+("olof"	"lW")
+("oloh"	"")
+("oloj"	"U")
+("olok"	"")
+("olom"	"o")
+("olpb"	"S")
+("olwl"	"")
+("olws"	"")
+("olwv"	"ܼ")
+("om"	"Cfi")
+("oma"	"")
+("ombb"	"")
+("ombe"	"u")
+("ombl"	"")
+("ombn"	"\")
+("ombp"	"U")
+("ombt"	"")
+("omc"	"L")
+("omd"	"E")
+("omdm"	"")
+("omdp"	"S")
+("omdu"	"rS")
+("omdw"	"ڮ")
+("omf"	"ɸ")
+("omfj"	"[")
+("omfm"	"`")
+("omfr"	"")
+("omg"	"")
+("omgn"	"")
+("omh"	"")
+("omi"	"")
+("omig"	"˻")
+("omjr"	"")
+("omlb"	"")
+("omlk"	"K")
+("omm"	"")
+("ommf"	"e")
+("ommi"	"ɴ")
+("ommm"	"e")
+("ommp"	"")
+("ommr"	"")
+("ommv"	"")
+("omn"	"a")
+("omnl"	"")
+("omnn"	"")
+("omno"	"")
+("omnr"	"")
+("ompm"	"")
+("omr"	"X")
+("omrb"	"")
+("omrl"	"R")
+("omrm"	"")
+("omro"	"")
+("omrp"	"")
+("omrq"	"")
+("omrr"	"")
+("omrt"	"λ")
+("omrw"	"M{")
+("omsl"	"")
+("omsp"	"k")
+("omtn"	"˶")
+("omu"	"")
+("omua"	"")
+("omvh"	"ɷ")
+("omvm"	"")
+("omvn"	"_")
+("omwa"	"|")
+("omwc"	"")
+("omwd"	"")
+("omwf"	"ܸ")
+("omwl"	"")
+("omwm"	"")
+("omwu"	"ܹ")
+("omwv"	"P")
+("omyf"	"ܵ")
+("on"	"^")
+("onao"	"")
+("onau"	"")
+("onbc"	"^")
+("onbuu"	"")
+("oncr"	"")
+("oncsh"	"^")
+("ond"	"J")
+("onf"	"A")
+("onfd"	"")
+("onff"	"")
+("onhaf"	"")
+("onhb"	"")
+("onhe"	"")
+("onhey"	"l")
+("onhqu"	"@")
+("onhs"	"")
+("onib"	"M")
+("onin"	"")
+("onjru"	"")
+("onjv"	"")
+("onkg"	"")
+("onkl"	"Z")
+("onkq"	"")
+("onl"	"~ɹ")
+("onll"	"")
+("onlll"	"J")
+("onlln"	"t")
+("onln"	"ɾ")
+("onlwl"	"k")
+("onmcw"	"D")
+("onmk"	"J")
+("onmlm"	"")
+("onmu"	"")
+("onmvm"	"B")
+("onnhs"	"")
+("onnl"	"\")
+("onno"	"")
+("onob"	"")
+("onog"	"ܤ")
+("onp"	"y")
+("onqd"	"")
+("onqmb"	"")
+("onri"	"_")
+("ontq"	"")
+("onu"	"I")
+("onvne"	"")
+("onwk"	"")
+("onwot"	"r")
+("onyvo"	"")
+("ooah"	"")
+("oobg"	"R")
+("oobm"	"[")
+("oobo"	"ͫ")
+("oog"	"")
+("ooge"	"Y")
+("oogf"	"")
+("ooic"	"")
+("ooii"	"D")
+("ooin"	"ɰ")
+("ooir"	"")
+("ooj"	"ɮ")
+("ooll"	"ɲ")
+("ooln"	"C")
+("ooma"	"")
+("oomb"	"")
+("oombc"	"t")
+("oomg"	"")
+("oomn"	"")
+("oomo"	"")
+("oomr"	"")
+("oon"	"h")
+("oono"	"K")
+("ooog"	"")
+("oooj"	"")
+("oook"	"")
+("oou"	"i")
+("oowy"	"V")
+("op"	"ɳ")
+("opa"	"")
+("opbuc"	"fU")
+("opd"	"Lc")
+("oph"	"Z")
+("ophq"	"Ͻ")
+("opko"	"")
+("opmc"	"")
+("opok"	"v")
+("opp"	"")
+("oppa"	"")
+("opr"	"F")
+("opt"	"g")
+("optd"	"O")
+("opu"	"ɶ")
+("opwgf"	"L")
+("opyhv"	"U")
+("oq"	"~")
+("oqhk"	"L")
+("oqka"	"b")
+("oqke"	"V")
+("oqkq"	"")
+("oqmb"	"")
+("oqmc"	"")
+("oqmf"	"W")
+("oqmv"	"")
+("oqo"	"")
+("oqoa"	"")
+("ora"	"")
+("orau"	"")
+("orc"	"h")
+("ord"	"O")
+("orhaf"	"F")
+("orhr"	"Q")
+("orhu"	"")
+("ori"	"")
+("orijb"	"E")
+("orln"	"")
+("ormbc"	"gX")
+("ornin"	"")
+("ornl"	"")
+("orno"	"")
+("orrj"	"")
+("orrk"	"k")
+("orsj"	"d")
+("oruc"	"")
+("orvk"	"")
+("orxu"	"")
+("orye"	"")
+("oryo"	"P")
+("osav"	"")
+("oshi"	"Q")
+("osj"	"˹")
+("osjr"	"")
+("osk"	"")
+("osme"	"I")
+("osmg"	"Q")
+("osmh"	"")
+("osmr"	"")
+("osmv"	"")
+("osnd"	"")
+("oso"	"ɭ")
+("osqf"	"X")
+("osrj"	"")
+("osrr"	"ܺ")
+("oss"	"\")
+("ossr"	"]")
+("ostt"	"R")
+("osuu"	"")
+("ota"	"")
+("otbc"	"")
+("otc"	"")
+("otco"	"")
+("otcw"	"a")
+("otdd"	"")
+("otf"	"L")
+("otgi"	"")
+("othb"	"")
+("otif"	"")
+("otkr"	"")
+("otlk"	"c")
+("otlm"	"")
+("otmc"	"")
+("otmv"	"N")
+("otniq"	"R")
+("otog"	"")
+("otq"	"")
+("otqm"	"T")
+("otrk"	"")
+("otsj"	"_")
+("ott"	"")
+("ottb"	"U")
+("otwa"	"ܷ")
+("otwi"	"")
+("otwn"	"")
+("otwv"	"")
+("otxc"	"S")
+("ou"	"Pjw")
+("oubb"	"ܽ")
+("oudk"	"")
+("oudm"	"")
+("ouf"	"o")
+("ouhmr"	"")
+("oum"	"")
+("oumb"	"e")
+("oumwj"	"»")
+("ouog"	"")
+("ouon"	"")
+("outrg"	"")
+("outt"	"")
+("ouypd"	"")
+("ouypt"	"C")
+("ovio"	"")
+("ovr"	"")
+("ovvv"	"")
+("ow"	"")
+("owg"	"Z")
+("owjr"	"")
+("owlb"	"")
+("owlg"	"")
+("owlv"	"")
+("owmv"	"")
+("owp"	"T")
+("owr"	"˿")
+("owwf"	"")
+("owww"	"w")
+("owyi"	"C")
+("owyta"	"L")
+("oy"	"")
+("oyaj"	"")
+("oybc"	"")
+("oybp"	"")
+("oybs"	"")
+("oyck"	"˳")
+("oydu"	"")
+("oyfe"	"")
+("oyfu"	"")
+("oyg"	"")
+("oyhn"	"")
+("oyhs"	"")
+("oyhv"	"")
+("oyjj"	"ܶ")
+("oykk"	"")
+("oylm"	"")
+("oym"	"g")
+("oymp"	"˽")
+("oymr"	"H")
+("oymy"	"a")
+("oyoj"	"")
+("oyok"	"")
+("oypd"	"[")
+("oypp"	"")
+("oyr"	"")
+("oyra"	"x")
+("oyrf"	"")
+("oyrn"	"")
+("oyrv"	"")
+("oysk"	"")
+("oyt"	"")
+("oyta"	"`")
+("oytg"	"")
+("oytj"	"ܴ")
+("oytp"	"")
+("oytr"	"")
+("oyub"	"V")
+("oyvi"	"f")
+("oyvo"	"˴")
+("oywm"	"")
+("oyx"	"")
+("oyyiu"	"")
+("p"	"")
+("pa"	"")
+("pahaf"	"~")
+("pahm"	"i")
+("paiu"	"n")
+("paks"	"n")
+("pam"	"")
+("pamh"	"E")
+("pamj"	"")
+("pamo"	"N")
+("panb"	"")
+("pank"	"")
+("panl"	"н")
+("paph"	"")
+("papp"	"c")
+("papv"	"t")
+("pate"	"")
+("pav"	"")
+("pawe"	"C")
+("payf"	"")
+("pbac"	"o")
+("pbbb"	"k")
+("pbcn"	"l")
+("pbg"	"O")
+("pbgr"	"")
+("pbhx"	"m")
+("pbjj"	"@")
+("pbm"	"̥")
+("pbme"	"P")
+("pbmr"	"")
+("pbou"	"l")
+("pbtv"	"")
+("pbue"	"")
+("pbug"	"")
+("pbvk"	"q")
+("pc"	"d")
+("pci"	"")
+("pcks"	"C")
+("pcnh"	"")
+("pcru"	"")
+("pcwa"	"")
+("pd"	"]")
+("pdd"	"Y")
+("pdhaf"	"")
+("pdi"	"")
+("pdk"	"")
+("pdl"	"")
+("pdlc"	"i")
+("pdmbc"	"o")
+("peee"	"[")
+("peg"	"")
+("peii"	"i")
+("pembc"	"")
+("pfb"	"")
+("pfbf"	"")
+("pfbr"	"\")
+("pfd"	"")
+("pfdq"	"")
+("pff"	"X")
+("pfmbc"	"b")
+("pfmu"	"")
+("pfq"	"̭")
+("pfqu"	"W")
+("pgdi"	"")
+("pggu"	"}")
+("pgi"	"")
+("pgni"	"")
+("pgr"	"")
+("pgth"	"~")
+("pgtj"	"")
+("ph"	"")
+("pha"	"")
+("phag"	"q")
+("phbk"	"")
+("phbq"	"")
+("phbr"	"")
+("phbt"	"")
+("phbuu"	"")
+("phcn"	"")
+("phdb"	"")
+("phdd"	"")
+("phdf"	"s")
+("pher"	"")
+("phgr"	"Ѯ")
+("phgs"	"E")
+("phh"	"")
+("phhn"	"c")
+("phi"	"\")
+("phj"	"")
+("phjr"	"")
+("phkb"	"")
+("phkp"	"b")
+("phlc"	"")
+("phln"	"F")
+("phml"	"")
+("phnl"	"")
+("php"	"")
+("phpa"	"_")
+("phqm"	"")
+("phqo"	"̨")
+("phs"	"̩")
+("phsb"	"G")
+("phsk"	"`")
+("phvp"	"")
+("phyhv"	"")
+("pi"	"Xc")
+("piav"	"Ѣ")
+("pice"	"Ѫ")
+("piih"	"G")
+("pijb"	"m")
+("pijc"	"")
+("pilb"	"H")
+("pile"	"B")
+("pim"	"")
+("pir"	"")
+("pirp"	"")
+("pit"	"ѣ")
+("pitc"	"")
+("piv"	"̡")
+("piyr"	"}")
+("pjbc"	"V")
+("pjbd"	"")
+("pjbo"	"")
+("pjcm"	"T")
+("pje"	"")
+("pjhaf"	"")
+("pjhr"	"K")
+("pjii"	"")
+("pjip"	"")
+("pjjl"	"F")
+("pjkp"	"")
+("pjlv"	"~")
+("pjmf"	"U")
+("pjmm"	"J")
+("pjnu"	"{")
+("pjpn"	"")
+("pjr"	"|")
+("pjrr"	"V")
+("pjsqf"	"")
+("pjtc"	"")
+("pk"	"")
+("pkcf"	"")
+("pkf"	"")
+("pkk"	"^")
+("pkkb"	"ѩ")
+("pkkk"	"")
+("pklb"	"")
+("pklq"	"w")
+("pklu"	"")
+("pkmb"	"k")
+("pkn"	"V")
+("pknio"	"")
+("pksb"	"j")
+("pl"	"")
+("plbk"	"")
+("plbu"	"")
+("plln"	"")
+("plmc"	"")
+("plmo"	"")
+("plmy"	"^")
+("plpc"	"A")
+("plw"	"̦")
+("plwv"	"")
+("pmak"	"")
+("pmam"	"")
+("pmbb"	"")
+("pmbc"	"p")
+("pmbe"	"")
+("pmbm"	"")
+("pmcw"	"")
+("pmf"	"")
+("pmfj"	"q{")
+("pmfm"	"̮")
+("pmmr"	"")
+("pmmu"	"")
+("pmob"	"}")
+("pmrw"	"A")
+("pmua"	"")
+("pmwd"	"X")
+("pmwf"	"")
+("pmwj"	"")
+("pmwl"	"M")
+("pmym"	"")
+("pn"	"A")
+("pnau"	"ѫ")
+("pnbq"	"")
+("pncr"	"~")
+("png"	"")
+("pnhb"	"|")
+("pnhe"	"")
+("pnib"	"Ѥ")
+("pnin"	"")
+("pno"	"")
+("pnyi"	"Z")
+("poae"	"p")
+("pod"	"")
+("pog"	"")
+("poge"	"n")
+("pogf"	"")
+("poii"	"̰")
+("poim"	"b")
+("poin"	"")
+("poir"	"[")
+("poj"	"")
+("poju"	"")
+("pomb"	"e")
+("pomd"	"Ѭ")
+("pomg"	"")
+("pomn"	"r")
+("pomo"	"")
+("pomr"	"")
+("pon"	"")
+("ponbg"	"L")
+("pond"	"Z")
+("potf"	"")
+("powy"	"")
+("pp"	"")
+("ppa"	"")
+("ppad"	"F")
+("ppfd"	"K")
+("ppg"	"ʯ")
+("pph"	"z")
+("ppha"	"")
+("pphp"	"")
+("pphqu"	"")
+("ppp"	"")
+("pppd"	"")
+("pppf"	"u")
+("ppph"	"h")
+("ppr"	"̪")
+("ppru"	"̯")
+("pptd"	"D")
+("ppu"	"")
+("ppuk"	"")
+("pqmb"	"")
+("pqmf"	"h")
+("pr"	"y")
+("prau"	"ѥ")
+("prb"	"Ѧ")
+("prhaf"	"")
+("prhg"	"ѭ")
+("prhml"	"")
+("prhu"	"̤")
+("prks"	"W")
+("prno"	"d")
+("prog"	"o")
+("prrd"	"{")
+("prrj"	"")
+("prrs"	"j")
+("pru"	"]")
+("prvp"	"~")
+("prxu"	"z")
+("psav"	"L")
+("pseg"	"")
+("psh"	"{")
+("pshr"	"̢")
+("psjj"	"")
+("psko"	"g")
+("psma"	"")
+("psmg"	"")
+("psmh"	"")
+("psmi"	"")
+("psmv"	"")
+("psp"	"")
+("psrr"	"")
+("pt"	"@")
+("pta"	"")
+("ptak"	"")
+("ptbo"	"")
+("ptbuc"	"")
+("pthg"	"")
+("ptlb"	"")
+("ptlj"	"C")
+("ptlm"	"")
+("ptmv"	"B")
+("ptor"	"b")
+("ptov"	"")
+("ptrg"	"")
+("ptt"	"")
+("ptwa"	"")
+("ptwi"	"")
+("ptwu"	"j")
+("ptxc"	"g")
+("ptyu"	"W")
+("pu"	"")
+("puce"	"H")
+("pudhe"	"K")
+("puf"	"ϲ")
+("puhaf"	"")
+("puk"	"I")
+("puln"	"S")
+("pumb"	"m")
+("pumbc"	"y")
+("pumt"	"_")
+("punl"	"Q")
+("puog"	"")
+("pupu"	"")
+("pve"	"̬")
+("pvis"	"̫")
+("pvvw"	"o")
+("pw"	"l")
+("pwc"	"̧")
+("pwd"	"Ѩ]")
+("pwg"	"ѧ")
+("pwim"	"")
+("pwjc"	"D")
+("pwlj"	"}")
+("pwls"	"h")
+("pwlv"	"|")
+("pwmv"	"O")
+("pwot"	"Y")
+("pwr"	"")
+("pyaj"	"")
+("pyck"	"")
+("pyfu"	"{")
+("pyhr"	"")
+("pymr"	"б")
+("pyoj"	"|")
+("pypo"	"y")
+("pyr"	"̣")
+("pyrd"	"")
+("pyrf"	"a")
+("pyrv"	"J")
+("pyta"	"")
+("pytg"	"")
+("pytj"	"")
+("pytp"	"")
+("pyv"	"")
+("pyvw"	"f")
+("pywd"	"")
+("pywv"	"h")
+("pyx"	"")
+("pyy"	"")
+("q"	"")
+("qa"	"")
+("qail"	"ѹ")
+("qaiu"	"b")
+("qamh"	"")
+("qamj"	"")
+("qamo"	"")
+("qan"	"")
+("qanb"	"")
+("qang"	"")
+("qank"	"")
+("qanr"	"")
+("qanw"	"d")
+("qapp"	"ե")
+("qapv"	"")
+("qase"	"")
+("qasm"	"ݭ")
+("qau"	"")
+("qav"	"")
+("qb"	"")
+("qbb"	"|")
+("qbbb"	"ݬ")
+("qbbe"	"")
+("qbbsd"	"R")
+("qbbuu"	"")
+("qbcd"	"")
+("qbcv"	"L")
+("qbd"	"")
+("qbdi"	"ѻ")
+("qbhaf"	"")
+("qbhx"	"ݰ")
+("qbjj"	"")
+("qbjmo"	"Q")
+("qbkf"	"")
+("qbm"	"̼")
+("qbme"	"")
+("qbmr"	"")
+("qbnau"	"")
+("qbnd"	"Ѽ")
+("qbnl"	"")
+("qbou"	"n")
+("qbsd"	"")
+("qbue"	"")
+("qbuu"	"")
+("qbv"	"ѽ")
+("qc"	"")
+("qchq"	"T")
+("qcks"	"")
+("qcno"	"")
+("qcru"	"Ѿ")
+("qcsh"	"")
+("qd"	"")
+("qdau"	"")
+("qdb"	"")
+("qdbms"	"q")
+("qdfh"	"f")
+("qdhe"	"")
+("qdhqu"	"")
+("qdir"	"A")
+("qdj"	"")
+("qdk"	"")
+("qdksr"	"@")
+("qdlwv"	"")
+("qdmbc"	"")
+("qdmbe"	"")
+("qdmmi"	"")
+("qdmvi"	"")
+("qdnd"	"T")
+("qdrlr"	"")
+("qdss"	"")
+("qdta"	"")
+("qdtt"	"")
+("qdttb"	"")
+("qdwf"	"z")
+("qdwlb"	"")
+("qdybs"	"")
+("qeed"	"ݺ")
+("qeee"	"s")
+("qei"	"")
+("qeii"	"k")
+("qfb"	"")
+("qfbf"	"")
+("qfbk"	"J")
+("qfbq"	"")
+("qfbw"	"")
+("qff"	"l")
+("qffs"	"")
+("qfh"	"")
+("qfq"	"")
+("qfqu"	"")
+("qgb"	"̾")
+("qgdi"	"")
+("qgg"	"E")
+("qggu"	"")
+("qggy"	"")
+("qgi"	"̶")
+("qgit"	"ݤ")
+("qglc"	"")
+("qgni"	"")
+("qgr"	"")
+("qgrc"	"^")
+("qha"	"")
+("qhag"	"h")
+("qhal"	"")
+("qhau"	"o")
+("qhbf"	"")
+("qhbk"	"")
+("qhbu"	"")
+("qhd"	"")
+("qhdf"	"")
+("qhdv"	"{")
+("qhdw"	"")
+("qhe"	"^")
+("qhej"	"")
+("qher"	"")
+("qhgr"	"ѿ")
+("qhhj"	"y")
+("qhhv"	"")
+("qhio"	"")
+("qhj"	"")
+("qhjg"	"o")
+("qhjm"	"")
+("qhjr"	"A")
+("qhju"	"p")
+("qhjx"	"")
+("qhk"	"")
+("qhkb"	"")
+("qhkp"	"m")
+("qhlmi"	"۷")
+("qhlo"	"")
+("qhml"	"")
+("qhmy"	"")
+("qhnbg"	"B")
+("qhne"	"")
+("qhoa"	"e")
+("qhoo"	"")
+("qhor"	"")
+("qhp"	"|")
+("qhpm"	"")
+("qhq"	"")
+("qhqo"	"̸")
+("qhrf"	"ݳ")
+("qhsb"	"zq")
+("qhsk"	"")
+("qhsm"	"ݵ")
+("qhuc"	"")
+("qhul"	"")
+("qhuo"	"")
+("qhuu"	"")
+("qhvif"	"")
+("qhvl"	"")
+("qhvp"	"")
+("qhwp"	"")
+("qhxe"	"j")
+("qhxm"	"")
+("qhxu"	"x")
+("qhye"	"h")
+("qhymu"	"j")
+("qhyu"	"ݶ")
+("qi"	"")
+("qibi"	"i")
+("qice"	"")
+("qidy"	"")
+("qihf"	"ݩ")
+("qihu"	"")
+("qiih"	"U")
+("qijb"	"")
+("qije"	"ѵ")
+("qikf"	"Z")
+("qikk"	"")
+("qiku"	"")
+("qilr"	"e")
+("qiok"	"")
+("qipd"	"K")
+("qipm"	"")
+("qir"	"")
+("qirm"	"n")
+("qirp"	"")
+("qit"	"")
+("qitc"	"X")
+("qitf"	"T")
+("qixp"	"")
+("qiyr"	"i")
+("qj"	"")
+("qjbc"	"ݧ")
+("qjbd"	"Ѵ")
+("qjbf"	"")
+("qjbj"	"k")
+("qjbv"	"")
+("qjcm"	"")
+("qjcn"	"")
+("qjcs"	"c")
+("qjcv"	"")
+("qje"	"")
+("qjhp"	"")
+("qjhu"	"̳")
+("qjii"	"")
+("qjji"	"")
+("qjjj"	"ݣ")
+("qjjl"	"")
+("qjk"	"")
+("qjks"	"")
+("qjlo"	"")
+("qjmc"	"")
+("qjmm"	"U")
+("qjmo"	"~")
+("qjmr"	"")
+("qjmu"	"ѳ")
+("qjnl"	"L")
+("qjnu"	"g")
+("qjoa"	"")
+("qjpa"	"ݥ")
+("qjpn"	"")
+("qjqp"	"B")
+("qjqr"	"ݡ")
+("qjsm"	"k")
+("qjsmp"	"z")
+("qjto"	"N")
+("qjtv"	"C")
+("qjv"	"")
+("qjwj"	"")
+("qka"	"K")
+("qkali"	"")
+("qkap"	"e")
+("qkce"	"")
+("qkcf"	"")
+("qke"	"")
+("qkf"	"")
+("qkhd"	"")
+("qkhk"	"")
+("qkhx"	"")
+("qkhxp"	"y")
+("qkja"	"")
+("qklb"	"̷")
+("qkld"	"")
+("qklu"	"")
+("qkmf"	"")
+("qkmr"	"q")
+("qkms"	"")
+("qkoo"	"")
+("qkq"	"^")
+("qks"	"}")
+("qksb"	"ݲ")
+("qkso"	"")
+("qkss"	"")
+("qkus"	"")
+("qla"	"ծ")
+("qlbk"	"̿")
+("qlbu"	"")
+("qlc"	"")
+("qle"	"ա")
+("qlf"	"[")
+("qllmi"	"")
+("qlln"	"")
+("qlmc"	"")
+("qlmo"	"D")
+("qlmr"	"")
+("qlmy"	"")
+("qlp"	"Q")
+("qlpb"	"")
+("qlr"	"")
+("qlryo"	"`")
+("qlvk"	"]")
+("qlw"	"")
+("qlwl"	"̽")
+("qlwp"	"")
+("qlwv"	"O")
+("qlyhv"	"")
+("qlymr"	"}")
+("qm"	"")
+("qmak"	"")
+("qmb"	"C")
+("qmbb"	"")
+("qmbc"	"ݢ")
+("qmbe"	"Z")
+("qmbg"	"E")
+("qmbs"	"")
+("qmbuc"	"d")
+("qmbw"	"")
+("qmd"	"")
+("qmf"	"")
+("qmfj"	"")
+("qmgg"	"")
+("qmgn"	"r")
+("qmia"	"ݨ")
+("qmig"	"")
+("qmj"	"")
+("qmjk"	"")
+("qmlk"	"")
+("qmlm"	"o")
+("qmmi"	"")
+("qmmp"	"")
+("qmmr"	"")
+("qmmu"	"")
+("qmmv"	"")
+("qmn"	"")
+("qmr"	"")
+("qmrb"	"ݦ")
+("qmrw"	"\")
+("qmsu"	"")
+("qmto"	"")
+("qmu"	"")
+("qmv"	"")
+("qmvif"	"")
+("qmvm"	"")
+("qmwd"	"ݹ")
+("qmwf"	"")
+("qmwj"	"")
+("qmwyf"	"A")
+("qmwyi"	"r")
+("qnau"	"")
+("qnbg"	"")
+("qnbk"	"")
+("qncr"	"")
+("qndf"	"ݻ")
+("qnem"	"@")
+("qng"	"")
+("qnhd"	"|")
+("qnhe"	"")
+("qnhs"	"")
+("qnhx"	"t")
+("qnib"	"Ѷ")
+("qnin"	"")
+("qnkg"	"")
+("qnkm"	"}")
+("qnkq"	"a")
+("qnlb"	"")
+("qnmm"	"ݫ")
+("qno"	"")
+("qnob"	"c")
+("qnoe"	"")
+("qnok"	"}")
+("qnot"	"")
+("qnri"	"e")
+("qnwa"	"")
+("qo"	"")
+("qoa"	"")
+("qoah"	"")
+("qobg"	"|")
+("qobuu"	"W")
+("qodi"	"̹")
+("qog"	"")
+("qohaf"	"")
+("qohg"	"")
+("qohh"	"̺")
+("qoii"	"")
+("qoim"	"M")
+("qoin"	"")
+("qoip"	"")
+("qoir"	"m")
+("qojwj"	"")
+("qoll"	"")
+("qomb"	"")
+("qomd"	"")
+("qomg"	"C")
+("qomn"	"g")
+("qomo"	"")
+("qomr"	"B")
+("qomt"	"f")
+("qon"	"")
+("qonl"	"˪")
+("qoog"	"")
+("qopd"	"")
+("qorq"	"")
+("qotf"	"")
+("qowy"	"")
+("qoya"	"")
+("qoyb"	"")
+("qpa"	"")
+("qpd"	"")
+("qpfd"	"")
+("qpi"	"")
+("qpko"	"")
+("qpmm"	"X")
+("qpou"	"")
+("qpp"	"")
+("qppa"	"{")
+("qpr"	"")
+("qpru"	"")
+("qpt"	"̴")
+("qptd"	"`")
+("qpu"	"")
+("qpuu"	"ݱ")
+("qpyr"	"n")
+("qqhk"	"[")
+("qqkk"	"~")
+("qqkq"	"")
+("qqmb"	"բ")
+("qqo"	"")
+("qqoj"	"[")
+("qqou"	"")
+("qqq"	"S")
+("qqu"	"")
+("qr"	"")
+("qrau"	"Ѻ")
+("qrb"	"")
+("qrbc"	"l")
+("qrrd"	"")
+("qrrj"	"")
+("qrsh"	"")
+("qrsj"	"")
+("qrsn"	"")
+("qruc"	"")
+("qrvp"	"")
+("qryo"	"")
+("qsav"	"]")
+("qshr"	"")
+("qsj"	"")
+("qsje"	"p")
+("qsjj"	"")
+("qsjl"	"^")
+("qsjr"	"u")
+("qskr"	"Ѹ")
+("qsll"	"")
+("qsma"	"P")
+("qsmb"	"")
+("qsmg"	"")
+("qsmh"	"")
+("qsmi"	"")
+("qsmv"	"գ")
+("qsp"	"̻")
+("qsql"	"")
+("qsrj"	"")
+("qsrr"	"")
+("qss"	"")
+("qssr"	"ѷ")
+("qstt"	"")
+("qstv"	"ݪ")
+("qsuu"	"")
+("qswu"	"")
+("qsyq"	"")
+("qta"	"")
+("qtak"	"N")
+("qtav"	"")
+("qtbc"	"w")
+("qtbf"	"")
+("qtbk"	"")
+("qtbn"	"Y")
+("qtc"	"")
+("qtcl"	"")
+("qtco"	"")
+("qtct"	"~")
+("qtcw"	"j")
+("qtkl"	"Y")
+("qtm"	"̵")
+("qtmc"	"դ")
+("qtmv"	"_")
+("qtod"	"g")
+("qtoe"	"")
+("qtog"	"u")
+("qtor"	"f")
+("qtov"	"")
+("qtpd"	"")
+("qtqm"	"b")
+("qtrk"	"")
+("qtt"	"")
+("qttb"	"p")
+("qttc"	"k")
+("qtub"	"}")
+("qtw"	"y")
+("qtwi"	"")
+("qtwv"	"")
+("qtxc"	"ݸ")
+("qu"	"")
+("qud"	"")
+("qumb"	"")
+("quob"	"")
+("quog"	"R")
+("quu"	"")
+("quv"	"t")
+("qvid"	"")
+("qvis"	"")
+("qvno"	"d")
+("qvoi"	"")
+("qvvd"	"")
+("qvvn"	"")
+("qvvv"	"")
+("qwd"	"զ")
+("qwg"	"")
+("qwhr"	"")
+("qwim"	"Q")
+("qwjc"	"")
+("qwkp"	"ݮ")
+("qwl"	"")
+("qwli"	"")
+("qwlj"	"")
+("qwlp"	"\")
+("qwlv"	"")
+("qwmv"	"m")
+("qwot"	"ݯ")
+("qwp"	"l")
+("qwvf"	"")
+("qwwv"	"F")
+("qwyi"	"")
+("qy"	"")
+("qyaj"	"")
+("qybb"	"V")
+("qybg"	"")
+("qybk"	"M")
+("qybp"	"l")
+("qybs"	"{")
+("qycb"	"K")
+("qyck"	"")
+("qyg"	"")
+("qygq"	"")
+("qyhj"	"")
+("qyhn"	"")
+("qyhr"	"ݴ")
+("qyhv"	"")
+("qyij"	"L")
+("qyj"	"")
+("qyjj"	"")
+("qyk"	"")
+("qylh"	"")
+("qylm"	"")
+("qymb"	"v")
+("qyoj"	"j")
+("qyok"	"")
+("qypo"	"")
+("qypp"	"")
+("qyps"	"")
+("qypt"	"G")
+("qyr"	"")
+("qyrb"	"d")
+("qyrf"	"")
+("qyrn"	"WD")
+("qyrv"	"c")
+("qysd"	"i")
+("qyt"	"")
+("qytg"	"")
+("qytr"	"h")
+("qytu"	"")
+("qytv"	"")
+("qyub"	"")
+("qyvg"	"")
+("qyvw"	"z")
+("qywm"	"")
+("qyx"	"")
+("qyy"	"")
+("qyyb"	"")
+("r"	"f")
+("raa"	"")
+("rail"	"A")
+("ram"	"")
+("ramj"	"A")
+("ranx"	"")
+("rapv"	"")
+("rase"	"D")
+("rate"	"")
+("rau"	"a")
+("rav"	"")
+("raye"	"ݼ")
+("rb"	"u")
+("rbbe"	"")
+("rbbr"	"{")
+("rbcv"	"X")
+("rbd"	"Ԫ")
+("rbdi"	"B")
+("rbgr"	"")
+("rbhaf"	"Y")
+("rbm"	"C")
+("rbmr"	"@")
+("rbou"	"")
+("rbsmr"	"")
+("rbuc"	"")
+("rbv"	"C")
+("rbwi"	"Z")
+("rc"	"uz")
+("rcim"	"")
+("rckn"	"")
+("rcks"	"")
+("rcnl"	"")
+("rcsh"	"h")
+("rcwa"	"")
+("rd"	"b")
+("rdam"	"")
+("rddf"	"")
+("rdhqu"	"M")
+("rdi"	"T")
+("rdk"	"w")
+("rdln"	"")
+("rdlo"	"")
+("rdm"	"")
+("rdmq"	"z")
+("rdnl"	"")
+("rdoo"	"Ԩ")
+("rede"	"q")
+("reed"	"")
+("reee"	"")
+("refh"	"")
+("reoy"	"")
+("rf"	"{")
+("rfb"	"")
+("rfba"	"|")
+("rfbc"	"")
+("rfbw"	"")
+("rfd"	"}")
+("rff"	"")
+("rffs"	"G")
+("rfh"	"n")
+("rg"	"R")
+("rgb"	"")
+("rgbt"	"O")
+("rgcc"	"~")
+("rgg"	"z")
+("rggu"	"")
+("rghaf"	"")
+("rgi"	"")
+("rgit"	"")
+("rgkc"	"")
+("rglc"	"")
+("rgnl"	"r")
+("rgr"	"")
+("rgrr"	"H")
+("rgsk"	"")
+("rgtj"	"Ԧ")
+("rgyo"	"")
+("rhad"	"S")
+("rhaf"	"")
+("rhag"	"t")
+("rhaj"	"")
+("rhbk"	"")
+("rhbu"	"")
+("rhdf"	"")
+("rhdn"	"E")
+("rher"	"")
+("rhey"	"N")
+("rhfd"	"I")
+("rhg"	"e")
+("rhgr"	"D")
+("rhhj"	"")
+("rhjd"	"C")
+("rhjm"	"")
+("rhjr"	"E")
+("rhjx"	"l")
+("rhkb"	"H")
+("rhml"	"v")
+("rhmo"	"")
+("rhoa"	"s")
+("rhp"	"\")
+("rhpm"	"")
+("rhq"	"ʡ")
+("rhqi"	"@")
+("rhr"	"f")
+("rhrf"	"")
+("rhs"	"Q")
+("rhsk"	"C")
+("rht"	"ʢ")
+("rhu"	"S")
+("rhuc"	"")
+("rhuk"	"")
+("rhvo"	"K")
+("rhxe"	"")
+("rhxu"	"Ԣ")
+("rice"	"")
+("rihf"	"N")
+("rihq"	"N")
+("rihr"	"")
+("rihu"	"m")
+("riil"	"j")
+("rijb"	"")
+("rijc"	"")
+("rik"	"p")
+("rikf"	"k")
+("riog"	"")
+("riok"	"")
+("rir"	"")
+("ritc"	"")
+("rite"	"h")
+("riuh"	"")
+("rjal"	"")
+("rjbc"	"")
+("rjbd"	"")
+("rjbf"	"")
+("rjbj"	"")
+("rjbo"	"")
+("rjbv"	"")
+("rjca"	"")
+("rjd"	"")
+("rje"	"s")
+("rjhaf"	"g")
+("rjhr"	"")
+("rji"	"a")
+("rjjb"	"J")
+("rjji"	"")
+("rjkd"	"")
+("rjkp"	"L")
+("rjlo"	"x")
+("rjmm"	"")
+("rjmmv"	"[")
+("rjmo"	"r")
+("rjnl"	"X")
+("rjon"	"M")
+("rjpa"	"")
+("rjpn"	"{")
+("rjpu"	"G")
+("rjqr"	"")
+("rjr"	"B")
+("rjstv"	"")
+("rjtc"	"Q")
+("rka"	"")
+("rkbu"	"")
+("rkcf"	"I")
+("rki"	"vy")
+("rkkb"	"D")
+("rklb"	"")
+("rklu"	"{")
+("rkn"	"x")
+("rkoo"	"@")
+("rkp"	"]")
+("rks"	"t{")
+("rksb"	"")
+("rksr"	"@")
+("rlb"	"Q")
+("rlln"	"")
+("rlmc"	"B")
+("rlmo"	"B")
+("rlmt"	"")
+("rlmy"	"")
+("rlwl"	"D")
+("rlwv"	"")
+("rlx"	"S")
+("rmam"	"")
+("rmamh"	"")
+("rmamo"	"")
+("rmanw"	"")
+("rmaph"	"")
+("rmasm"	"")
+("rmau"	"")
+("rmav"	"")
+("rmbb"	"}")
+("rmbc"	"")
+("rmbd"	"")
+("rmbe"	"")
+("rmbhx"	"")
+("rmbm"	"")
+("rmbt"	"\")
+("rmbue"	"")
+("rmbug"	"Q")
+("rmbvk"	"")
+("rmc"	"w")
+("rmcw"	"{")
+("rmcwa"	"O")
+("rmd"	"S")
+("rmdam"	"")
+("rmdhe"	"_")
+("rmdk"	"")
+("rmdm"	"")
+("rmea"	"")
+("rmf"	"}")
+("rmfb"	"]")
+("rmfbg"	"A")
+("rmfcb"	"")
+("rmfdq"	"P")
+("rmffe"	"")
+("rmfj"	"")
+("rmfm"	"A")
+("rmfq"	"")
+("rmfqu"	"")
+("rmgce"	"D")
+("rmgcg"	"")
+("rmgdi"	"j")
+("rmgg"	"ԩi")
+("rmggu"	"")
+("rmgni"	"C")
+("rmgt"	"")
+("rmgyo"	"Y")
+("rmhdf"	"")
+("rmhdv"	"A")
+("rmhdw"	"S")
+("rmher"	"")
+("rmhgu"	"n")
+("rmhhw"	"")
+("rmhjd"	"")
+("rmhjg"	"")
+("rmhkb"	"T")
+("rmhlb"	"")
+("rmhlc"	"Ů")
+("rmhml"	"")
+("rmhmy"	"")
+("rmhnd"	"")
+("rmhoo"	"C")
+("rmhqo"	"^")
+("rmhsb"	"")
+("rmhsk"	"")
+("rmhuc"	"p")
+("rmiav"	"W")
+("rmice"	"_")
+("rmig"	"")
+("rmigi"	"]")
+("rmii"	"")
+("rmikk"	"[")
+("rmir"	"`")
+("rmite"	"")
+("rmitf"	"")
+("rmiwg"	"^")
+("rmixp"	"")
+("rmiyr"	"")
+("rmjbc"	"")
+("rmjcv"	"O")
+("rmje"	"")
+("rmjk"	"")
+("rmjkd"	"Z")
+("rmjlo"	"")
+("rmjnu"	"")
+("rmjoa"	"")
+("rmjp"	"Y")
+("rmjr"	"")
+("rmkmr"	"")
+("rmkms"	"")
+("rmkn"	"h")
+("rmkpb"	"@")
+("rmksr"	"")
+("rmlb"	"y")
+("rmlk"	"C")
+("rmlm"	"")
+("rmlmc"	"R")
+("rmlmo"	"")
+("rmlwp"	"m")
+("rmmcw"	"s")
+("rmmd"	"")
+("rmmfb"	"U")
+("rmmig"	"k")
+("rmmp"	"")
+("rmmr"	"")
+("rmmrw"	"")
+("rmmt"	"")
+("rmmto"	"")
+("rmn"	"m")
+("rmnbs"	"")
+("rmnhd"	"")
+("rmnhe"	"")
+("rmnib"	"\")
+("rmnin"	"o")
+("rmnmu"	"")
+("rmnn"	"")
+("rmnoe"	"Q")
+("rmnot"	"")
+("rmnr"	"")
+("rmodi"	"")
+("rmog"	"C")
+("rmohh"	"")
+("rmoip"	"E")
+("rmoir"	"")
+("rmokr"	"")
+("rmomb"	"F")
+("rmomg"	"p")
+("rmomn"	"")
+("rmomr"	"q")
+("rmon"	"")
+("rmotq"	"V")
+("rmowy"	"^")
+("rmpfd"	"B")
+("rmpi"	"")
+("rmpmc"	"")
+("rmpru"	"]")
+("rmpt"	"")
+("rmptd"	"")
+("rmqka"	"")
+("rmqkx"	"")
+("rmqmc"	"")
+("rmqo"	"l")
+("rmrb"	"")
+("rmrrd"	"ļ")
+("rmryo"	"b")
+("rmsje"	"")
+("rmsjj"	"\")
+("rmsjr"	"")
+("rmsju"	"X")
+("rmsmg"	"D")
+("rmso"	"")
+("rmsp"	"")
+("rmss"	"Z")
+("rmssr"	"")
+("rmstv"	"")
+("rmsu"	"c")
+("rmsup"	"[")
+("rmta"	"")
+("rmtag"	"n")
+("rmtce"	"")
+("rmtco"	"")
+("rmtja"	"")
+("rmtkl"	"ŭ")
+("rmtlb"	"")
+("rmtmc"	"")
+("rmtmv"	"")
+("rmto"	"")
+("rmtqa"	"P")
+("rmtqm"	"")
+("rmtt"	"g")
+("rmttc"	"")
+("rmtwa"	"")
+("rmtwi"	"")
+("rmua"	"")
+("rmubb"	"")
+("rmue"	"")
+("rmui"	"")
+("rmumb"	"")
+("rmvh"	"r")
+("rmvi"	"")
+("rmvid"	"`")
+("rmvim"	"b")
+("rmvmi"	"B")
+("rmvvv"	"a")
+("rmwd"	"")
+("rmwf"	"I")
+("rmwg"	"")
+("rmwj"	"E")
+("rmwl"	"y")
+("rmwli"	"Ľ")
+("rmwtj"	"")
+("rmwv"	"m")
+("rmyaj"	"@")
+("rmybb"	"")
+("rmybp"	"F")
+("rmycb"	"")
+("rmyck"	"")
+("rmyf"	"H")
+("rmyfe"	"")
+("rmyfu"	"")
+("rmyg"	"")
+("rmygq"	"ľ")
+("rmyjj"	"")
+("rmylc"	"")
+("rmylh"	"c")
+("rmylm"	"k")
+("rmymp"	"l")
+("rmymu"	"_")
+("rmyoj"	"")
+("rmypo"	"")
+("rmyr"	"")
+("rmyrv"	"")
+("rmytr"	"")
+("rmytv"	"")
+("rmyx"	"E")
+("rnbg"	"F")
+("rnbj"	"R")
+("rnbk"	"")
+("rnd"	"")
+("rndu"	"q")
+("rng"	"|")
+("rnhb"	"")
+("rnhe"	"l")
+("rnhx"	"")
+("rnin"	"G")
+("rnkm"	"ԡ")
+("rnlr"	"")
+("rno"	"j")
+("rnri"	"@")
+("rnwa"	"P")
+("rob"	"o")
+("rod"	"")
+("rodi"	"J")
+("rog"	"")
+("roic"	"T")
+("roii"	"")
+("roin"	"u")
+("roip"	"")
+("roir"	"")
+("roj"	"~")
+("roll"	"ʥ")
+("roma"	"D")
+("romd"	"G")
+("roml"	"")
+("romn"	"")
+("romo"	"E")
+("romr"	"ԣ")
+("romt"	"u")
+("ron"	"Y")
+("ronk"	"")
+("roog"	"")
+("rop"	"x")
+("roq"	"D")
+("rosk"	"")
+("rotf"	"F")
+("royb"	"")
+("rp"	"w")
+("rpa"	"O")
+("rph"	"")
+("rphh"	"k")
+("rpim"	"ʣ")
+("rpln"	"n")
+("rpok"	"")
+("rpou"	"")
+("rppa"	"n")
+("rpr"	"")
+("rpru"	"H")
+("rptd"	"")
+("rpu"	"ʤ")
+("rpuc"	"")
+("rpuk"	"F")
+("rqha"	"")
+("rqhk"	"")
+("rqhl"	"")
+("rqhu"	"")
+("rqjm"	"J")
+("rqkq"	"w")
+("rqmc"	"")
+("rqmf"	"")
+("rqmn"	"")
+("rqyt"	"")
+("rrau"	"")
+("rrbyj"	"z")
+("rrf"	"r")
+("rrhaf"	"O")
+("rrhn"	"G")
+("rrik"	"~")
+("rrikr"	"")
+("rrill"	"v")
+("rrmcr"	"")
+("rrmmk"	"Y")
+("rrmms"	"K")
+("rrms"	"")
+("rrnl"	"")
+("rrr"	"~")
+("rrrd"	"")
+("rrrj"	"C")
+("rrrr"	"")
+("rrru"	"w")
+("rrslr"	"")
+("rruc"	"A")
+("rrvlr"	"P")
+("rrvp"	"")
+("rrwj"	"")
+("rrwmu"	"e")
+("rryo"	"")
+("rsbn"	"|")
+("rsh"	"o")
+("rshaf"	"")
+("rsit"	"")
+("rsj"	"H")
+("rsjj"	"")
+("rsl"	"n")
+("rslb"	"")
+("rsln"	"O")
+("rsm"	"p")
+("rsmbc"	"E")
+("rsme"	"")
+("rsmg"	"")
+("rsmh"	"")
+("rsmi"	"@")
+("rsmj"	"")
+("rsnl"	"k")
+("rso"	"`")
+("rsp"	"O")
+("rsqf"	"")
+("rsql"	"")
+("rsrr"	"")
+("rsuu"	"}")
+("rsyi"	"")
+("rsypu"	"")
+("rta"	"z")
+("rtak"	"K")
+("rtav"	"")
+("rtc"	"")
+("rtcl"	"R")
+("rtco"	"P")
+("rtct"	"")
+("rtgi"	"m")
+("rtgu"	"v")
+("rtk"	"u")
+("rtkr"	"o")
+("rtlf"	"`")
+("rtlo"	"")
+("rtm"	"")
+("rtmc"	"ԧ")
+("rtmj"	"M")
+("rtmv"	"x")
+("rtnd"	"")
+("rtod"	"")
+("rtoe"	"")
+("rtor"	"")
+("rtq"	"")
+("rtqm"	"")
+("rtrg"	"")
+("rtub"	"")
+("rtw"	"p")
+("rtwa"	"")
+("rtwi"	"")
+("rtwv"	"")
+("rtxc"	"")
+("rtyb"	"")
+("ru"	"x")
+("rumb"	"")
+("rumi"	"")
+("runl"	"")
+("ruog"	"Q")
+("ruoiv"	"Ź")
+("rutc"	"S")
+("ruu"	"F")
+("rve"	"L")
+("rvfi"	"")
+("rvi"	"[")
+("rvii"	"T")
+("rvis"	"")
+("rvl"	"s")
+("rvnk"	"d")
+("rvno"	"")
+("rvp"	"")
+("rvvu"	"")
+("rwb"	"")
+("rwc"	"")
+("rwg"	"")
+("rwgf"	"K")
+("rwgg"	"")
+("rwim"	"O")
+("rwk"	"|")
+("rwkp"	"")
+("rwl"	"E")
+("rwlb"	"q")
+("rwlc"	"G")
+("rwlg"	"o")
+("rwli"	"B")
+("rwlv"	"")
+("rwmv"	"")
+("rwnl"	"")
+("rwot"	"")
+("rwtj"	"")
+("rwyi"	"")
+("rxu"	"")
+("ryaj"	"~")
+("ryao"	"F")
+("rybb"	"")
+("rybp"	"V")
+("rybs"	"")
+("rycb"	"")
+("ryck"	"r")
+("rydg"	"")
+("rydu"	"")
+("ryfu"	"")
+("rygq"	"")
+("ryhc"	"")
+("ryhh"	"i")
+("ryhn"	"\")
+("ryib"	"")
+("ryjj"	"U")
+("ryk"	"z")
+("rymb"	"")
+("rymh"	"A")
+("rymp"	"M")
+("rymr"	"")
+("rymu"	"")
+("ryo"	"")
+("ryoj"	"u")
+("rypb"	"L")
+("rypd"	"")
+("rypk"	"@")
+("rypm"	"N")
+("rypo"	"")
+("rypt"	"")
+("rypu"	"")
+("ryr"	"")
+("ryrb"	"")
+("ryrd"	"t")
+("ryrn"	"")
+("ryro"	"z")
+("ryru"	"g")
+("ryrv"	"W")
+("rysk"	"")
+("rysy"	"ԥ")
+("ryta"	"f")
+("rytp"	"")
+("rytv"	"s")
+("ryvg"	"")
+("ryvo"	"y")
+("rywe"	"")
+("ryx"	"")
+("s"	"r")
+("sahaf"	"")
+("sahni"	"R")
+("sammu"	"")
+("sav"	"")
+("sbcc"	"")
+("sbhg"	"")
+("sbln"	"")
+("sbug"	"")
+("sc"	"")
+("schaf"	"")
+("schne"	"")
+("scwa"	"h")
+("se"	"")
+("seb"	"v")
+("sebuc"	"")
+("sec"	"D")
+("sed"	"")
+("sef"	"^")
+("seg"	"N")
+("sehaf"	"")
+("selmi"	"")
+("semcw"	"")
+("semgi"	"b")
+("semoo"	"")
+("semr"	"")
+("semrt"	"")
+("seog"	"")
+("seooo"	"E")
+("seq"	"R")
+("sesmm"	"k")
+("sev"	"v")
+("sevif"	"")
+("sewgf"	"w")
+("sfa"	"")
+("sfajv"	"[")
+("sfamj"	"_")
+("sfamo"	"")
+("sfapp"	"")
+("sfapv"	"")
+("sfb"	"h")
+("sfbbr"	"")
+("sfbgr"	"")
+("sfbm"	"")
+("sfbmr"	"i")
+("sfbr"	"")
+("sfbvk"	"\")
+("sfcru"	"a")
+("sfcwa"	"y")
+("sfd"	"")
+("sfdi"	"L")
+("sfdk"	"")
+("sfdl"	"[")
+("sfdoo"	"")
+("sfe"	"")
+("sfeii"	"")
+("sffdq"	"x")
+("sfggu"	"Ż")
+("sfhag"	"")
+("sfhdp"	"]")
+("sfher"	"d")
+("sfhgu"	"g")
+("sfhhw"	"a")
+("sfhi"	"`")
+("sfhkb"	"ź")
+("sfhni"	"")
+("sfhp"	"")
+("sfhsb"	"F")
+("sfhsm"	"b")
+("sfhwp"	"{")
+("sfhxe"	"^")
+("sfiav"	"Y")
+("sfice"	"@")
+("sfihu"	"")
+("sfiih"	"|")
+("sfij"	"c")
+("sfiok"	"c")
+("sfir"	"")
+("sfit"	"Z")
+("sfiuh"	"\")
+("sfjig"	"R")
+("sfjmc"	"")
+("sfjp"	"m")
+("sfk"	"")
+("sfkk"	"")
+("sfkmr"	"M")
+("sfl"	"")
+("sflk"	"p")
+("sflll"	"")
+("sflmo"	"f")
+("sflmy"	"")
+("sflpc"	"k")
+("sflw"	"")
+("sflws"	"")
+("sflx"	"{")
+("sfmbu"	"")
+("sfmfj"	"")
+("sfmfm"	"")
+("sfmhf"	"")
+("sfmig"	"d")
+("sfmj"	"")
+("sfmmp"	"z")
+("sfmwf"	"Y")
+("sfmwj"	"z")
+("sfmwv"	"")
+("sfnhb"	"}")
+("sfnhd"	"")
+("sfnhe"	"")
+("sfnkq"	"")
+("sfnok"	"")
+("sfnoo"	"")
+("sfodi"	"t")
+("sfog"	"")
+("sfohh"	"")
+("sfoii"	"")
+("sfok"	"")
+("sfomd"	"b")
+("sfomg"	"h")
+("sfomo"	"")
+("sfomr"	"")
+("sfpd"	"")
+("sfph"	"")
+("sfpi"	"")
+("sfpou"	"")
+("sfpr"	"s")
+("sfpuu"	"_")
+("sfqjr"	"")
+("sfrb"	"`")
+("sfrrj"	"")
+("sfrye"	"")
+("sfseo"	"J")
+("sfsff"	"")
+("sfshr"	"")
+("sfsj"	"b")
+("sfsma"	"y")
+("sfsme"	"]")
+("sfsnd"	"|")
+("sfsrr"	"X")
+("sfss"	"")
+("sfssr"	"^")
+("sft"	"")
+("sftaj"	"Z")
+("sftbn"	"")
+("sftjd"	"")
+("sftlf"	"v")
+("sftlm"	"x")
+("sftmc"	"")
+("sftmj"	"~")
+("sftrg"	"")
+("sftt"	"c")
+("sfuce"	"")
+("sfuob"	"")
+("sfvne"	"")
+("sfwc"	"o")
+("sfwd"	"")
+("sfwk"	"e")
+("sfwlj"	"")
+("sfwtj"	"z")
+("sfwvf"	"[")
+("sfyck"	"a")
+("sfydk"	"")
+("sfyg"	"n")
+("sfyhv"	"u")
+("sfypm"	"")
+("sfypt"	"j")
+("sfyrv"	"")
+("sfytj"	"X")
+("sfyvo"	"b")
+("sfywm"	"S")
+("sghaf"	"_")
+("sgi"	"W")
+("sgjwp"	"ť")
+("sgks"	"")
+("sgln"	"j")
+("sh"	"M")
+("shaf"	"")
+("shaph"	"")
+("shawe"	"")
+("shbb"	"")
+("shbt"	"")
+("shcwa"	"")
+("shdbn"	"")
+("shdci"	"P")
+("shdhe"	"")
+("shfb"	"e")
+("shfqu"	"")
+("shgb"	"w")
+("shgr"	"g")
+("shhaf"	"")
+("shhdn"	"g")
+("shhej"	"h")
+("shhhc"	"Ž")
+("shhjr"	"o")
+("shhqu"	"")
+("shi"	"b")
+("shiih"	"")
+("shikk"	"v")
+("shjbc"	"h")
+("shjmc"	"K")
+("shjmf"	"O")
+("shjpa"	"g")
+("shjrb"	"G")
+("shkmb"	"")
+("shlbu"	"")
+("shmbc"	"Q")
+("shmfm"	"")
+("shml"	"K")
+("shmu"	"")
+("shnih"	"")
+("shnl"	"m")
+("shob"	"")
+("shod"	"ap")
+("shoe"	"ji")
+("shog"	"y")
+("shoma"	"V")
+("shoo"	"")
+("shoog"	"f")
+("shot"	"P")
+("shov"	"")
+("shpru"	"")
+("shqka"	"")
+("shqu"	"")
+("shr"	"l")
+("shsb"	"")
+("shshr"	"")
+("shsj"	"n")
+("shtak"	"")
+("shtbn"	"")
+("shtlb"	"")
+("shtw"	"q")
+("shtwv"	"T")
+("shtxc"	"i")
+("shvvv"	"c")
+("shwlv"	"U")
+("shyhs"	"")
+("shymp"	"h")
+("shyrv"	"")
+("sibt"	"")
+("sif"	"")
+("sihhh"	"I")
+("sihk"	"D")
+("sihml"	"")
+("sihq"	"t")
+("sihqo"	"x")
+("sikcf"	"v")
+("silq"	"v")
+("sinl"	"V")
+("sip"	"Լ")
+("sisuu"	"")
+("siyhv"	"")
+("sj"	"")
+("sjb"	"u")
+("sjc"	"Y")
+("sjcim"	"")
+("sjd"	"")
+("sje"	"")
+("sjenl"	"")
+("sjf"	"")
+("sjfd"	"")
+("sjg"	"")
+("sjgb"	"C")
+("sjgr"	"G")
+("sjhaf"	"")
+("sjhhl"	"")
+("sjhjr"	"")
+("sjhqu"	"")
+("sjhwp"	"o")
+("sjirm"	"")
+("sjjcm"	"")
+("sjjn"	"o")
+("sjjpn"	"")
+("sjka"	"O")
+("sjkf"	"")
+("sjki"	"g")
+("sjlb"	"m")
+("sjlbu"	"")
+("sjlmc"	"|")
+("sjln"	"")
+("sjlws"	"u")
+("sjmbc"	"")
+("sjmbl"	"F")
+("sjmgi"	"z")
+("sjmn"	"ͪ")
+("sjmvn"	"I")
+("sjmym"	"B")
+("sjncr"	"")
+("sjnl"	"C")
+("sjnok"	"")
+("sjoii"	"")
+("sjoin"	"h")
+("sjp"	"")
+("sjq"	"")
+("sjr"	"~")
+("sjrxu"	"~")
+("sjryo"	"")
+("sjsh"	"A")
+("sjsj"	"E")
+("sjsjj"	"¿")
+("sju"	"s")
+("sjv"	"X")
+("sjvif"	"")
+("sjvis"	"D")
+("sjvit"	"p")
+("sjyhv"	"")
+("sjyia"	"¾")
+("sjymr"	"Ĵ")
+("sjyrn"	"")
+("sk"	"")
+("skn"	"u")
+("skr"	"g")
+("slb"	"`")
+("slmbc"	"[")
+("slmc"	"")
+("slmy"	"Q")
+("slo"	"")
+("slorr"	"{")
+("slqmc"	"")
+("slsl"	"")
+("slsll"	"R")
+("slwv"	"")
+("sm"	"N")
+("smamo"	"")
+("smbjj"	"")
+("smblb"	"")
+("smcsh"	"d")
+("smdhe"	"")
+("smg"	"J")
+("smha"	"")
+("smhaf"	"")
+("smhqo"	"")
+("smhqu"	"A")
+("smig"	"")
+("smikk"	"")
+("smkoo"	"p")
+("sml"	"e")
+("smm"	"P")
+("smmbc"	"")
+("smmri"	"M")
+("smnp"	"")
+("smog"	"C")
+("smohh"	"")
+("smonk"	"")
+("smpr"	"")
+("smr"	"q")
+("smsim"	"")
+("smt"	"")
+("smuce"	"")
+("smv"	"")
+("smwtc"	"l")
+("smyjj"	"")
+("smyoj"	"A")
+("smyrb"	"")
+("smyrf"	"~")
+("smyt"	"")
+("smytv"	"|")
+("sndd"	"G")
+("snlr"	"")
+("so"	"")
+("somr"	"")
+("sonl"	"")
+("sorc"	"")
+("sp"	"")
+("spd"	"l")
+("sphaf"	"")
+("sphh"	"")
+("spp"	"")
+("sqnl"	"")
+("sqsf"	"")
+("sr"	"r")
+("srbt"	"S")
+("srbuu"	"")
+("srf"	"O")
+("srhaf"	"")
+("srhg"	"t")
+("srhne"	"")
+("srks"	"o")
+("srlb"	"x")
+("srmbc"	"Y")
+("srmvn"	"^")
+("srnl"	"p")
+("srno"	"")
+("srp"	"|")
+("srrj"	"E")
+("srrr"	"")
+("srsl"	"s")
+("srtq"	"s")
+("srye"	"")
+("srytj"	"@")
+("ss"	"")
+("ssf"	"X")
+("sskll"	"")
+("sslii"	"k")
+("ssr"	"")
+("ssu"	"W")
+("stkr"	"")
+("stqq"	"")
+("stt"	"")
+("stv"	"i")
+("su"	"vw")
+("suf"	"")
+("sug"	"")
+("suhaf"	"")
+("suhu"	"")
+("sund"	"^")
+("sunl"	"U")
+("suok"	"")
+("sup"	"")
+("sut"	"")
+("suu"	"}")
+("suv"	"G")
+("svhaf"	"")
+("svnl"	"n")
+("sw"	"Z")
+("swbt"	"Q")
+("swbuu"	"")
+("swc"	"ų")
+("swl"	"X")
+("syhn"	"")
+("sytj"	"j")
+("syyi"	"")
+("syyq"	"R")
+("t"	"")
+("ta"	"")
+("taa"	"u")
+("tab"	"")
+("tabu"	"")
+("tadhe"	"")
+("tagi"	"")
+("tahaf"	"N")
+("tahml"	"|")
+("tahs"	"")
+("taiu"	"߽")
+("taj"	"")
+("tak"	"")
+("taka"	"")
+("takb"	"")
+("takf"	"Z")
+("takg"	"")
+("takp"	"}")
+("takq"	"")
+("taks"	"")
+("taln"	"")
+("tan"	"ۯ")
+("tanb"	"F")
+("tang"	"ĩ")
+("tanp"	"E")
+("tanw"	"")
+("tapp"	"t")
+("tapv"	"")
+("tase"	"")
+("tau"	"")
+("tav"	"ӣ")
+("tawe"	"")
+("tbac"	"")
+("tbau"	"x")
+("tbbb"	"")
+("tbbe"	"I")
+("tbbq"	"H")
+("tbbr"	"")
+("tbbu"	"J")
+("tbbuu"	"z")
+("tbc"	"")
+("tbcn"	"")
+("tbcsh"	"")
+("tbcv"	"")
+("tbd"	"T")
+("tbfe"	"")
+("tbg"	"")
+("tbhg"	"")
+("tbhs"	"")
+("tbhu"	"")
+("tbijb"	"")
+("tbikk"	"")
+("tbjj"	"")
+("tbks"	"")
+("tbli"	"õ")
+("tbln"	"e")
+("tbm"	"u")
+("tbmbc"	"O")
+("tbme"	"")
+("tbmo"	"X")
+("tbmr"	"Ӧ")
+("tbms"	"w")
+("tbmw"	"߮")
+("tbnd"	"g")
+("tbnf"	"")
+("tbnh"	"")
+("tbni"	"")
+("tbnm"	"")
+("tbof"	"")
+("tbok"	"")
+("tbp"	"")
+("tbpr"	"")
+("tbse"	"")
+("tbtv"	"v")
+("tbu"	"`")
+("tbud"	"k")
+("tbuk"	"")
+("tbul"	"C")
+("tbut"	"ۮ")
+("tbuu"	"A")
+("tbv"	"h")
+("tbyj"	"")
+("tc"	"@~")
+("tca"	"")
+("tcb"	"")
+("tcbt"	"q")
+("tcfb"	"ܰ")
+("tcg"	"")
+("tchaf"	"o")
+("tche"	"")
+("tchml"	"")
+("tcim"	"c")
+("tcjwj"	"{")
+("tclmi"	"ۻ")
+("tcmr"	"")
+("tcno"	"ۺp")
+("tcp"	"")
+("tcq"	"ѱ")
+("tcru"	"j")
+("tcsd"	"")
+("tcsh"	"")
+("tcst"	"")
+("tctd"	"~")
+("tcte"	"O")
+("tcvif"	"u")
+("tcwm"	"")
+("tcyg"	"")
+("tcyj"	"")
+("tcymr"	"")
+("tdb"	"|")
+("tdbb"	"@")
+("tdbk"	"")
+("tdbn"	"l")
+("tdbu"	"߹")
+("tdci"	"p")
+("tdd"	"۫")
+("tdhaf"	"")
+("tdhl"	"o")
+("tdj"	"[")
+("tdk"	"͸")
+("tdlc"	"")
+("tdlo"	"\")
+("tdm"	"f")
+("tdmq"	"")
+("tdnl"	"")
+("tdoo"	"")
+("tdr"	"c")
+("tdsr"	"")
+("tdw"	"۪")
+("tdwf"	"ߵ")
+("teah"	"")
+("tebm"	"^")
+("tec"	"w")
+("ted"	"q")
+("tede"	"")
+("tefh"	"")
+("tege"	"")
+("tehr"	"ߪ")
+("tehv"	"")
+("tehw"	"ÿ")
+("teib"	"Z")
+("teii"	"")
+("teiv"	"")
+("telu"	"Y")
+("tem"	"s")
+("temf"	"")
+("temj"	"")
+("temr"	"]")
+("tene"	"r")
+("teod"	"")
+("teom"	"")
+("teon"	"")
+("teot"	"Y")
+("terd"	"Ħ")
+("tesd"	"")
+("tesr"	"ۨ")
+("tess"	"ۧ")
+("tesu"	"S")
+("tett"	"ߩ")
+("tewb"	"")
+("tewt"	"")
+("teyb"	"")
+("teye"	"{")
+("teyu"	"")
+("teyv"	"")
+("tf"	"")
+("tfaj"	"U")
+("tfb"	"v")
+("tfbk"	"")
+("tfbn"	"߿")
+("tff"	"e")
+("tfff"	"")
+("tfkc"	"")
+("tfku"	"")
+("tfmc"	"")
+("tfmu"	"Ӥ")
+("tfnl"	"\")
+("tfqu"	"d")
+("tg"	"z")
+("tgb"	"\")
+("tgbuu"	"[")
+("tgce"	"")
+("tgdi"	"")
+("tgeno"	"r")
+("tgf"	"")
+("tgftk"	"ü")
+("tgg"	"x")
+("tggi"	"߱Z")
+("tggu"	"")
+("tghaf"	"|")
+("tghds"	"")
+("tghni"	"")
+("tghqi"	"q")
+("tghu"	"")
+("tgif"	"k")
+("tgii"	"")
+("tgimo"	"C")
+("tgine"	"")
+("tgit"	"\")
+("tgje"	"U")
+("tgji"	"X")
+("tgk"	"")
+("tgks"	"U")
+("tglln"	"")
+("tgmbc"	"")
+("tgni"	"")
+("tgnl"	"[")
+("tgno"	"wNt")
+("tgobo"	"D")
+("tgow"	"")
+("tgp"	"~")
+("tgpm"	"]")
+("tgrg"	"")
+("tgsk"	"W")
+("tgte"	"")
+("tgtr"	"")
+("tgv"	"")
+("tgwc"	"")
+("tgyv"	"")
+("thaf"	"r")
+("thag"	"")
+("thai"	"}")
+("thau"	"")
+("thbh"	"")
+("thbk"	"M")
+("thbu"	"")
+("thcn"	"")
+("thda"	"")
+("thdb"	"K")
+("thde"	"U")
+("thdf"	"")
+("thdh"	"zJ")
+("thdm"	"")
+("thdn"	"")
+("thds"	"")
+("thdv"	"")
+("thdw"	"")
+("ther"	"Ө")
+("they"	"Ф")
+("thgf"	"")
+("thhaf"	"")
+("thhc"	"S")
+("thhd"	"I")
+("thhe"	"")
+("thhj"	"|")
+("thhl"	"g")
+("thi"	"`")
+("thj"	"ˡ")
+("thjd"	"^")
+("thje"	"")
+("thjg"	"")
+("thjm"	"")
+("thjo"	"")
+("thk"	"ͽ")
+("thkb"	"L")
+("thkp"	"۰")
+("thlb"	"")
+("thlf"	"")
+("thmb"	"J")
+("thml"	"")
+("thmr"	"ӭ")
+("thne"	"")
+("thni"	"ˢ")
+("thoe"	"P")
+("thok"	"")
+("thol"	"w")
+("thon"	"Ӯ")
+("thoo"	"uv")
+("thoq"	"")
+("thqi"	"m")
+("thqo"	"y")
+("thqu"	"ͻ")
+("thrj"	"")
+("ths"	"x")
+("thsb"	"ۢ")
+("thse"	"")
+("thsk"	"O")
+("thsu"	"z")
+("thup"	"")
+("thvi"	"L")
+("thwp"	"")
+("thxc"	"")
+("thxf"	"M")
+("thxo"	"")
+("thye"	"")
+("tiav"	"[")
+("tibi"	"")
+("tice"	"o")
+("tidq"	"")
+("tidr"	"Ĩ")
+("tidy"	"")
+("tih"	"Z")
+("tihaf"	"b")
+("tihc"	"A")
+("tihm"	"c")
+("tihr"	"ߺ")
+("tihs"	"u")
+("tihv"	"߻")
+("tiih"	"x")
+("tij"	"v")
+("tijb"	"@")
+("tije"	"\")
+("tikf"	"߯")
+("tikk"	"n")
+("tikt"	"")
+("tilo"	"۩")
+("tilr"	"")
+("timo"	"")
+("tims"	"")
+("tino"	"")
+("tioc"	"")
+("tip"	"{")
+("tipd"	"")
+("tipf"	"")
+("tir"	"a")
+("titb"	"V")
+("titc"	"")
+("titf"	"")
+("tixf"	"")
+("tixp"	"S")
+("tj"	"")
+("tjam"	"")
+("tjamo"	"z")
+("tjapv"	"{")
+("tjau"	"v")
+("tjav"	"")
+("tjavf"	"P")
+("tjb"	"")
+("tjbd"	"")
+("tjbj"	"")
+("tjbm"	"ۦ")
+("tjck"	"߫")
+("tjcn"	"")
+("tjcr"	"T")
+("tjdhe"	"")
+("tjdj"	"")
+("tjds"	"ߴ")
+("tje"	"")
+("tjea"	"")
+("tjef"	"")
+("tjfb"	"T")
+("tjfbr"	"A")
+("tjfq"	"")
+("tjgg"	"c")
+("tjgr"	"")
+("tjgwc"	"")
+("tjhaf"	"r")
+("tjhd"	"")
+("tjhdf"	"")
+("tjhhj"	"@")
+("tjhml"	"")
+("tjii"	"]")
+("tjip"	"")
+("tjjcm"	"")
+("tjjj"	"")
+("tjjl"	"^")
+("tjjv"	"b")
+("tjka"	"")
+("tjkp"	"y")
+("tjks"	"")
+("tjlbk"	"")
+("tjlo"	"g")
+("tjlv"	"")
+("tjlwv"	"K")
+("tjmc"	"P")
+("tjme"	"M")
+("tjmj"	"ܩ")
+("tjmm"	"")
+("tjmn"	"RM")
+("tjmo"	"_")
+("tjmr"	"ۥ")
+("tjmu"	"ܪ")
+("tjmwm"	"ŷ")
+("tjnau"	"V")
+("tjnhd"	"")
+("tjnhe"	"")
+("tjni"	"")
+("tjnkq"	"y")
+("tjnl"	"]")
+("tjnu"	"`")
+("tjoa"	"")
+("tjoin"	"")
+("tjomk"	"@")
+("tjomr"	"")
+("tjomt"	"")
+("tjop"	"u")
+("tjpa"	"")
+("tjpfd"	"")
+("tjpi"	"ܫ")
+("tjpn"	"")
+("tjpru"	"")
+("tjpt"	"")
+("tjptd"	"")
+("tjpu"	"L")
+("tjpyr"	"|")
+("tjqyt"	"")
+("tjr"	"W")
+("tjrb"	"T")
+("tjrr"	"")
+("tjshr"	"")
+("tjtc"	"")
+("tjtif"	"i")
+("tjtoe"	"O")
+("tjtor"	"")
+("tjtq"	"")
+("tjv"	"Ӱ")
+("tjvii"	"p")
+("tjvis"	"")
+("tjwj"	"s")
+("tjydl"	"J")
+("tjygq"	"Ŷ")
+("tjymu"	"H")
+("tk"	"")
+("tkce"	"q")
+("tkd"	"")
+("tke"	"")
+("tkhaf"	"|")
+("tkhf"	"")
+("tkhg"	"p")
+("tkhi"	"")
+("tkhw"	"O")
+("tkkb"	"i")
+("tkld"	"")
+("tklg"	"ӳ")
+("tklmi"	"")
+("tklu"	"")
+("tkms"	"ӡ")
+("tkn"	"Mw")
+("tkni"	"ˣ")
+("tknl"	"Gn")
+("tkok"	"")
+("tkoo"	"")
+("tkp"	"")
+("tkpb"	"`")
+("tkq"	"")
+("tkr"	"Y")
+("tkrp"	"S")
+("tksqf"	"")
+("tksr"	"X")
+("tkss"	"")
+("tkymr"	"ĵ")
+("tlbk"	"^")
+("tlj"	"")
+("tllmi"	"")
+("tlln"	"p")
+("tlmc"	"D")
+("tlmi"	"ӵ")
+("tlmt"	"")
+("tlmy"	"")
+("tlpf"	"Pm")
+("tlqm"	"Ի")
+("tlvk"	"")
+("tlw"	"t")
+("tlwv"	"o")
+("tlx"	"")
+("tm"	"")
+("tmam"	"{")
+("tmbb"	"")
+("tmbg"	"")
+("tmbi"	"S")
+("tmbl"	"Ӵ")
+("tmbr"	"")
+("tmbuu"	"")
+("tmbw"	"")
+("tmcw"	"}_")
+("tmd"	"Y")
+("tmdm"	"")
+("tmf"	"")
+("tmfb"	"")
+("tmff"	"[")
+("tmfj"	"m")
+("tmfm"	"С")
+("tmgf"	"")
+("tmgn"	"q")
+("tmgr"	"")
+("tmhf"	"")
+("tmhg"	"V")
+("tmhml"	"")
+("tmig"	"Ӣ")
+("tmks"	"")
+("tmlm"	"j")
+("tmmc"	"")
+("tmmi"	"")
+("tmms"	"߼")
+("tmmu"	"ʹ")
+("tmmv"	"")
+("tmn"	"K")
+("tmnh"	"")
+("tmnj"	"z")
+("tmnl"	"")
+("tmnm"	"")
+("tmnn"	"~")
+("tmnr"	"V")
+("tmnv"	"߳")
+("tmoa"	"")
+("tmob"	"~")
+("tmom"	"B")
+("tmoo"	"b")
+("tmpt"	"")
+("tmrb"	"")
+("tmrr"	"")
+("tmrt"	"^")
+("tmrw"	"߶")
+("tmtj"	"")
+("tmtn"	"")
+("tmto"	"")
+("tmvh"	"")
+("tmvi"	"")
+("tmvm"	"")
+("tmwc"	"")
+("tmwf"	"[")
+("tmwj"	"")
+("tmwm"	"")
+("tmwv"	"߷")
+("tmy"	"y")
+("tmyf"	"Y")
+("tmymu"	"j")
+("tn"	"|")
+("tnbc"	"")
+("tnbe"	"")
+("tnbq"	"N")
+("tncr"	"L")
+("tnd"	"~")
+("tndf"	"^")
+("tndo"	"")
+("tndu"	"")
+("tnef"	"]")
+("tnfd"	"Ĭ")
+("tnfn"	"")
+("tnfq"	"")
+("tnhd"	"")
+("tnhe"	"Ϳ")
+("tnhs"	"Ng")
+("tnhx"	"y")
+("tni"	"}")
+("tnih"	"T")
+("tnin"	"͹ө")
+("tniq"	"Ӷ")
+("tnir"	"")
+("tniu"	"b")
+("tniv"	"N")
+("tnkg"	"l")
+("tnkm"	"z")
+("tnlc"	"")
+("tnld"	"")
+("tnli"	"")
+("tnlm"	"")
+("tnlp"	"")
+("tnlw"	"}")
+("tnmm"	"")
+("tnmu"	"")
+("tnnc"	"@")
+("tnnl"	"")
+("tno"	"")
+("tnok"	"")
+("tnsj"	"߾")
+("tntg"	"F")
+("tnue"	"r")
+("tnui"	"")
+("tnup"	"")
+("tnus"	"")
+("toav"	"}")
+("tob"	"ͺ")
+("tobg"	"")
+("tod"	"Ӫ")
+("todi"	"{")
+("tof"	"|")
+("tog"	"z{ܥ")
+("togf"	"")
+("togx"	"")
+("tohaf"	"`")
+("tohg"	"")
+("tohqu"	"")
+("tohs"	"n")
+("toi"	"ӫ")
+("toiav"	"i")
+("toie"	"")
+("toii"	"d")
+("toik"	"Ӭ")
+("toin"	"")
+("toir"	"a")
+("tokf"	"")
+("tokg"	"K")
+("tolb"	"t")
+("told"	"s")
+("toll"	"")
+("toma"	"P")
+("tomb"	"ۡ")
+("tomd"	"")
+("tomg"	"")
+("tomm"	"")
+("tomn"	"ͼ")
+("tomo"	"V")
+("tomr"	"ӯ")
+("tonk"	"")
+("tono"	"")
+("tonwf"	"")
+("tooe"	"")
+("toog"	"k")
+("took"	"")
+("toom"	"")
+("top"	"")
+("toqb"	"")
+("tord"	"")
+("tose"	"")
+("totf"	"")
+("touk"	"")
+("towy"	"")
+("toyr"	"_")
+("tp"	"")
+("tpa"	"")
+("tpfd"	"")
+("tph"	"l")
+("tphh"	";")
+("tpi"	"")
+("tpib"	"")
+("tpko"	"")
+("tpmw"	"")
+("tpou"	"")
+("tpp"	"Ͷ")
+("tppp"	"")
+("tpr"	"eA")
+("tpru"	"c")
+("tptd"	"")
+("tpu"	"͵")
+("tpyv"	"")
+("tq"	"")
+("tqapv"	"~")
+("tqcsh"	"b")
+("tqda"	"")
+("tqdb"	"")
+("tqfh"	"a")
+("tqhdw"	"y")
+("tqhne"	"a")
+("tqhpm"	"")
+("tqhr"	"߲")
+("tqib"	"")
+("tqice"	"n")
+("tqihr"	"")
+("tqij"	"A")
+("tqik"	"n")
+("tqixe"	"")
+("tqjm"	"V")
+("tqjmn"	"")
+("tqjmu"	"l")
+("tqjtc"	"x")
+("tqka"	"")
+("tqkd"	"")
+("tqkn"	"B")
+("tqkq"	"f")
+("tqlw"	"۬")
+("tqm"	"t")
+("tqmb"	"")
+("tqmbb"	"")
+("tqmhf"	"")
+("tqmvm"	"m")
+("tqng"	"")
+("tqo"	"")
+("tqog"	"a")
+("tqoii"	"")
+("tqomn"	"")
+("tqomo"	"")
+("tqpu"	"ۭ")
+("tqqo"	"`")
+("tqsmm"	"")
+("tqumf"	"")
+("tqwj"	"")
+("tqyt"	"i")
+("tqywm"	"û")
+("trhr"	"")
+("trjd"	"s")
+("trji"	"D")
+("trjl"	"")
+("trmr"	"F")
+("trnl"	"YT")
+("trog"	"p")
+("trok"	"q")
+("tron"	"y")
+("trrg"	"q")
+("trrj"	"G")
+("trrr"	"G")
+("trrs"	"")
+("trsj"	"")
+("trvp"	"Т")
+("trye"	"")
+("tsem"	"")
+("tseo"	"")
+("tsfi"	"")
+("tsh"	"L")
+("tshr"	"q")
+("tsic"	"")
+("tsip"	"e")
+("tsiq"	"A")
+("tsit"	"")
+("tsj"	"")
+("tsja"	"H")
+("tsjd"	"")
+("tsje"	"h")
+("tsk"	"ͷ")
+("tskr"	"d")
+("tsle"	"k")
+("tsll"	"Ӳ")
+("tsmg"	"")
+("tsmh"	"d")
+("tsmi"	"C")
+("tsmv"	"")
+("tsp"	"o")
+("tsrf"	"e")
+("tsrj"	"")
+("tsrr"	"_")
+("tss"	"U")
+("tsu"	"}")
+("tt"	"}m")
+("ttbn"	"߰")
+("ttc"	"")
+("ttcf"	"")
+("ttcg"	"I")
+("ttgb"	"")
+("ttgf"	"")
+("ttgi"	"")
+("tthaf"	"x")
+("tti"	"d")
+("ttjd"	"")
+("ttlm"	"c")
+("ttmbc"	"")
+("ttmc"	"m")
+("ttmv"	"߸")
+("ttmvn"	"~")
+("ttnau"	"[")
+("ttnl"	"з")
+("ttqm"	"")
+("ttshi"	"")
+("ttt"	"ӱ")
+("ttub"	"")
+("ttvb"	"")
+("ttwli"	"")
+("ttxc"	"")
+("tub"	"")
+("tuirm"	"U")
+("tujt"	"G")
+("tuu"	"_")
+("tvff"	"W")
+("tvfh"	"")
+("tvfi"	"")
+("tvfm"	"")
+("tvft"	"ĭ")
+("tvfu"	"T")
+("tvfy"	"y")
+("tvhl"	"R")
+("tvi"	"`")
+("tvid"	"F")
+("tvif"	"")
+("tvii"	"")
+("tvio"	"w")
+("tvip"	"O")
+("tvis"	"Х")
+("tvjr"	"ۣ")
+("tvks"	"")
+("tvlk"	"ӧ")
+("tvmg"	"")
+("tvmi"	"Q")
+("tvmw"	"")
+("tvne"	"w")
+("tvno"	"")
+("tvr"	"")
+("tvrf"	"Q")
+("tvrq"	"")
+("tvvv"	"")
+("tvvw"	"ۤ")
+("tvyj"	"r")
+("tw"	"]")
+("twa"	"")
+("twbi"	"")
+("twbo"	"Ļ")
+("twcb"	"f")
+("twdi"	"L")
+("twfu"	"j")
+("twhd"	"")
+("twik"	"")
+("twim"	"l")
+("twk"	"")
+("twks"	"x")
+("twla"	"")
+("twlb"	"U")
+("twle"	"")
+("twlg"	"")
+("twli"	"G")
+("twlii"	"D")
+("twln"	"ڿ_")
+("twlp"	"")
+("twlu"	"{")
+("twmmv"	"A")
+("twmrt"	"T")
+("twmv"	"")
+("two"	"v")
+("twp"	"")
+("twr"	"")
+("twtj"	"n")
+("twvf"	"m")
+("twwf"	"E")
+("twwg"	"K")
+("twww"	"")
+("twyi"	"У")
+("txc"	"")
+("tybb"	"H")
+("tybg"	"")
+("tybo"	"")
+("tybp"	"")
+("tybs"	"")
+("tycb"	"N")
+("tyck"	"t")
+("tycu"	"b")
+("tycv"	"R")
+("tydl"	"~")
+("tydo"	"")
+("tydu"	"")
+("tyfe"	"")
+("tygq"	"T")
+("tygv"	"")
+("tyhc"	"ī")
+("tyhj"	"")
+("tyhn"	"ͳ")
+("tyhs"	"")
+("tyiu"	"r")
+("tyjj"	"")
+("tyk"	"Ͳ")
+("tylm"	"")
+("tymh"	"B")
+("tymo"	"b")
+("tymp"	"ӥ")
+("tynb"	"f")
+("tyoe"	"")
+("tyoj"	"")
+("typm"	"h")
+("typp"	"")
+("typt"	"Ī")
+("tyr"	"s")
+("tyra"	"")
+("tyrb"	"U")
+("tyre"	"QE")
+("tyrl"	"O")
+("tyrn"	"߬")
+("tyrp"	"")
+("tyrv"	"ħ")
+("tysd"	"߭")
+("tysk"	"T")
+("tysm"	"")
+("tyso"	"|")
+("tysy"	"")
+("tyt"	"k")
+("tyta"	"")
+("tytg"	"")
+("tytj"	"")
+("tytp"	"")
+("tytr"	"")
+("tytv"	"a")
+("tyv"	"~")
+("tyvg"	"R")
+("tyvo"	"u")
+("tyvp"	"Z")
+("tyvu"	"")
+("tyvw"	"W")
+("tywi"	"i")
+("tywv"	"b")
+("tyx"	"")
+("tyyb"	"")
+("tyyo"	"")
+("u"	"s")
+("uahu"	"")
+("uamh"	"")
+("uamo"	"")
+("uapp"	"X")
+("uapv"	"")
+("uav"	"ά")
+("ubb"	"Y")
+("ubcn"	"")
+("ubln"	"k")
+("ubm"	"`")
+("ubmbc"	"F")
+("ubmr"	"")
+("ubnl"	"\")
+("ubno"	"")
+("ubsd"	"W")
+("ubtu"	"^")
+("ubuu"	"s")
+("uc"	"C")
+("ucno"	"k")
+("ucor"	"n")
+("ucwa"	"e")
+("udci"	"]")
+("udhe"	"i")
+("udoo"	"")
+("udsmg"	"")
+("udw"	"")
+("udyg"	"")
+("ufb"	"k")
+("ufdq"	"b")
+("uffd"	"")
+("uffr"	"D")
+("uffs"	"c")
+("ufgi"	"")
+("ugce"	"")
+("ugdi"	"")
+("uggi"	"")
+("uggu"	"f")
+("ugno"	"r")
+("uh"	"P")
+("uha"	"j")
+("uhag"	"")
+("uhdj"	"")
+("uhdp"	"O")
+("uhdv"	"B")
+("uhdw"	"g")
+("uhej"	"p")
+("uher"	"ΣΪ")
+("uhhj"	"")
+("uhhw"	"U")
+("uhi"	"R")
+("uhk"	"")
+("uhkb"	"i")
+("uhmb"	"")
+("uhml"	"")
+("uhni"	"P")
+("uhoo"	"")
+("uhoq"	"")
+("uhpa"	"")
+("uhqi"	"o")
+("uhrf"	"T")
+("uhrj"	"h")
+("uhs"	"h")
+("uhuc"	"")
+("uhud"	"Q")
+("uhvi"	"")
+("uhxc"	"")
+("uiav"	"q")
+("uice"	"m")
+("uihr"	"")
+("uihs"	"ή")
+("uihv"	"Q")
+("uiih"	"")
+("uijb"	"l")
+("uilr"	"N")
+("uip"	"J")
+("ujc"	"\")
+("ujcc"	"q")
+("ujcm"	"S")
+("ujcr"	"M")
+("ujd"	"X")
+("uje"	"")
+("ujfd"	"A")
+("ujjl"	"")
+("ujkp"	"Ψ")
+("ujlmi"	"Q")
+("ujlo"	"")
+("ujmf"	"R")
+("ujmrt"	"")
+("ujp"	"[")
+("ujr"	"^")
+("ujv"	"Φ")
+("uk"	"")
+("ukb"	"έ")
+("ukcf"	"l")
+("ukg"	"΢")
+("ukhk"	"")
+("ukhu"	"")
+("ukjj"	"|")
+("ukkb"	"\")
+("uklu"	"")
+("ukmr"	"T")
+("ukn"	"Χ")
+("ukoo"	"l")
+("ukpb"	"")
+("uks"	"v")
+("ul"	"K")
+("ulbk"	"b")
+("ulln"	"f")
+("ulw"	"")
+("ulwv"	"")
+("umam"	"z")
+("umbc"	"")
+("umbl"	"BΩ")
+("umbs"	"")
+("umf"	"")
+("umfm"	"_")
+("umgg"	"V")
+("umig"	"{")
+("umli"	"E")
+("ummj"	"")
+("ummr"	"m")
+("ummu"	"")
+("umnc"	"")
+("umnn"	"~")
+("umnr"	"e")
+("umoo"	"")
+("umr"	"")
+("umrt"	"Z")
+("umt"	"")
+("umtj"	"")
+("umto"	"k")
+("umu"	"")
+("umua"	"j")
+("umvh"	"")
+("unbq"	"c")
+("unhe"	"")
+("unii"	"")
+("unmu"	"|Ρ")
+("unot"	"j")
+("unqd"	"P")
+("unri"	"`")
+("uog"	"Z")
+("uogb"	"rs")
+("uogf"	"h")
+("uogs"	"g")
+("uoic"	"")
+("uoii"	"d")
+("uoin"	"")
+("uoir"	"V")
+("uoll"	"")
+("uomb"	"[")
+("uomn"	"")
+("uomo"	"d")
+("uomr"	"ΤΫ")
+("uon"	"z")
+("upa"	"}")
+("uphh"	"")
+("upko"	"")
+("upr"	"c")
+("uqmb"	"")
+("uqog"	"")
+("urji"	"i")
+("urog"	"")
+("urrk"	"")
+("urrs"	"")
+("urvp"	"")
+("ushi"	"")
+("ushr"	"g")
+("usjr"	"")
+("uskr"	"n")
+("usma"	"")
+("usmh"	"")
+("usrr"	"")
+("uss"	"]")
+("usu"	"")
+("usuu"	"U")
+("utav"	"_")
+("utbuu"	"")
+("utcd"	"e")
+("utcw"	"")
+("utgi"	"^")
+("utgit"	"v")
+("uthn"	"")
+("uthni"	"")
+("uthv"	"")
+("utik"	"")
+("utln"	"")
+("utmbc"	"")
+("utmo"	"O")
+("utmv"	"")
+("utnau"	"A")
+("utnl"	"Z")
+("utok"	"")
+("utqm"	"D")
+("utrg"	"")
+("utvi"	"")
+("utwa"	"")
+("utwi"	"d")
+("utwv"	"`")
+("uu"	"XJ")
+("uuce"	"")
+("uummf"	"")
+("uuu"	"j")
+("uuuu"	"\")
+("uvii"	"")
+("uvis"	"k")
+("uvmi"	"")
+("uvvw"	"@")
+("uwjr"	"D")
+("uwl"	"a")
+("uwlb"	"")
+("uwlj"	"a")
+("uwly"	"b")
+("uwp"	"")
+("uybb"	"")
+("uybk"	"")
+("uybp"	"")
+("uyhh"	"")
+("uyhm"	"")
+("uyoj"	"A")
+("uyrb"	"C")
+("uyrd"	"")
+("uyrn"	"")
+("uysd"	"")
+("uyt"	"l")
+("uyti"	"E")
+("uytj"	"p")
+("uyvo"	"y")
+("v"	"k")
+("vaa"	"@")
+("vabu"	"ع")
+("vahu"	"A")
+("vam"	"H")
+("vamh"	"ػ")
+("vamo"	"غ")
+("vand"	"_")
+("vawe"	"p")
+("vbac"	"")
+("vbbe"	"T")
+("vbbr"	"E")
+("vbd"	"")
+("vbgr"	"")
+("vbhg"	"")
+("vbhx"	"E")
+("vbm"	"j")
+("vbme"	"D")
+("vbmr"	"o")
+("vbou"	"")
+("vbt"	"k")
+("vbuu"	"b")
+("vbv"	"c")
+("vci"	"ʸ")
+("vcnh"	"X")
+("vcsh"	"ʷ")
+("vdj"	"E")
+("vdks"	"")
+("vdl"	"_")
+("vdlc"	"")
+("vdlk"	"")
+("vdln"	"")
+("vdnl"	"q")
+("ve"	"")
+("vebt"	"")
+("veks"	"V")
+("velb"	"")
+("veln"	"")
+("vemr"	"")
+("ven"	"")
+("vend"	"V")
+("vep"	"")
+("veq"	"")
+("vesqf"	"q")
+("vfa"	"")
+("vfamo"	"{")
+("vfaph"	"m")
+("vfapp"	"l")
+("vfase"	"w")
+("vfawe"	"g")
+("vfbb"	"")
+("vfbbb"	"")
+("vfbbe"	"")
+("vfbbr"	"")
+("vfbcv"	"")
+("vfbd"	"")
+("vfbgr"	"")
+("vfbhx"	"")
+("vfbjj"	"")
+("vfbm"	"")
+("vfbme"	"w")
+("vfbmr"	"")
+("vfbnd"	"f")
+("vfbof"	"")
+("vfbr"	"")
+("vfbsh"	"a")
+("vfbtu"	"")
+("vfbtv"	"")
+("vfbu"	"")
+("vfbuh"	"z")
+("vfbuo"	"")
+("vfbv"	"k")
+("vfc"	"q")
+("vfcnh"	"W")
+("vfcor"	"b")
+("vfcsh"	"")
+("vfcwa"	"¹")
+("vfd"	"")
+("vfdbu"	"")
+("vfdd"	"j")
+("vfdi"	"")
+("vfdl"	"Y")
+("vfdm"	"")
+("vfdmq"	"n")
+("vfdwf"	"m")
+("vfeed"	"")
+("vfeee"	"")
+("vff"	"")
+("vffb"	"`")
+("vffdq"	"v")
+("vfff"	"d")
+("vffh"	"")
+("vffmu"	"")
+("vffq"	"")
+("vffqu"	"e")
+("vfgce"	"")
+("vfgg"	"")
+("vfggu"	"¶")
+("vfgi"	"")
+("vfgr"	"")
+("vfgrc"	"")
+("vfgwc"	"")
+("vfh"	"")
+("vfhab"	"")
+("vfhae"	"u")
+("vfhaf"	"}")
+("vfhce"	"")
+("vfhdv"	"o")
+("vfhdw"	"º")
+("vfheq"	"")
+("vfher"	"")
+("vfhey"	"")
+("vfhg"	"Q")
+("vfhgf"	"")
+("vfhhj"	"s")
+("vfhjd"	"")
+("vfhje"	"v")
+("vfhjg"	"")
+("vfhjm"	"x")
+("vfhkb"	"t")
+("vfhon"	"")
+("vfhoo"	"a")
+("vfhor"	"q")
+("vfhqo"	"")
+("vfhsb"	"s")
+("vfhsk"	"út")
+("vfhuc"	"@")
+("vfhvp"	"")
+("vfhwp"	"`")
+("vfibi"	"")
+("vfihr"	"p")
+("vfiih"	"h")
+("vfij"	"")
+("vfije"	"[")
+("vfik"	"LS")
+("vfikk"	"")
+("vfiku"	"Z")
+("vfill"	"")
+("vfimo"	"")
+("vfir"	"")
+("vfirm"	"k")
+("vfitc"	"")
+("vfiwg"	"")
+("vfjbc"	"")
+("vfjbd"	"Z")
+("vfjii"	"")
+("vfjip"	"n")
+("vfjka"	"")
+("vfjlo"	"g")
+("vfjlv"	"h")
+("vfjmc"	"i}")
+("vfjmf"	"")
+("vfjmn"	"")
+("vfjmo"	"")
+("vfjmu"	"d")
+("vfjnu"	"w")
+("vfjoa"	"Y")
+("vfjp"	"")
+("vfjqr"	"")
+("vfjrr"	"")
+("vfjyj"	"")
+("vfk"	"")
+("vfkcf"	"·")
+("vfki"	"T")
+("vfkkb"	"]")
+("vfkmr"	"")
+("vfkni"	"K")
+("vflbk"	"")
+("vflbu"	"P")
+("vflgm"	"p")
+("vflll"	"J")
+("vflln"	"")
+("vflmc"	"r")
+("vflmi"	"Z")
+("vflmo"	"")
+("vflmy"	"n")
+("vflw"	"")
+("vflwl"	"")
+("vflwp"	"")
+("vflwv"	"\")
+("vflx"	"¸")
+("vfm"	"")
+("vfma"	"")
+("vfmbb"	"")
+("vfmbe"	"")
+("vfmbk"	"")
+("vfmd"	"")
+("vfmf"	"R")
+("vfmgk"	"o")
+("vfmhf"	"")
+("vfmia"	"")
+("vfmig"	"")
+("vfmlb"	"y")
+("vfmlk"	"X")
+("vfmmi"	"")
+("vfmmp"	"")
+("vfmn"	"ͩ")
+("vfmvi"	"")
+("vfmvm"	"g")
+("vfmwf"	"e")
+("vfmwl"	"q")
+("vfn"	"s")
+("vfnau"	"_")
+("vfnbq"	"")
+("vfnd"	"p")
+("vfng"	"")
+("vfnhb"	"q")
+("vfnhe"	"")
+("vfnii"	"f")
+("vfnin"	"V")
+("vfnkf"	"")
+("vfnkg"	"^")
+("vfnkm"	"r")
+("vfnl"	"U")
+("vfnob"	"")
+("vfnri"	"")
+("vfoae"	"")
+("vfob"	"")
+("vfobo"	"C")
+("vfodi"	"")
+("vfog"	"")
+("vfohh"	"")
+("vfoim"	"")
+("vfoin"	"W")
+("vfok"	"")
+("vfoll"	"X")
+("vfoma"	"ø")
+("vfomb"	"")
+("vfomg"	"")
+("vfomk"	"")
+("vfomn"	"")
+("vfomr"	"")
+("vfon"	"")
+("vfonk"	"")
+("vfopd"	"")
+("vfoto"	"")
+("vfp"	"")
+("vfpa"	"")
+("vfpi"	"")
+("vfpmm"	"")
+("vfpou"	"p")
+("vfpp"	"")
+("vfpr"	"")
+("vfpt"	"")
+("vfpu"	"")
+("vfpuu"	"")
+("vfq"	"r")
+("vfqjl"	"j")
+("vfqkd"	"")
+("vfqmb"	"f")
+("vfqmc"	"Z")
+("vfqmf"	"")
+("vfqu"	"")
+("vfr"	"ů")
+("vfrb"	"h")
+("vfrbc"	"")
+("vfrhr"	"e")
+("vfrpa"	"")
+("vfrrd"	"")
+("vfrrj"	"s")
+("vfrsj"	"r")
+("vfrxu"	"÷")
+("vfshi"	"")
+("vfshr"	"")
+("vfshu"	"")
+("vfsje"	"i")
+("vfsme"	"\")
+("vfsmh"	"[")
+("vfsu"	"")
+("vfswu"	"l")
+("vftak"	"")
+("vftbk"	"o")
+("vftct"	"~")
+("vftcw"	"")
+("vftgr"	"µ")
+("vftlj"	"y")
+("vftm"	"")
+("vftqm"	"")
+("vftt"	"")
+("vftwi"	"m")
+("vftwv"	"")
+("vftxc"	"")
+("vfu"	"r")
+("vfubb"	"^")
+("vfuob"	"")
+("vfuog"	"")
+("vfuu"	"")
+("vfv"	"")
+("vfvif"	"")
+("vfvl"	"")
+("vfvne"	"")
+("vfvno"	"t")
+("vfvvd"	"b")
+("vfvvi"	"~")
+("vfvvw"	"")
+("vfw"	"")
+("vfwd"	"i")
+("vfwgg"	"")
+("vfwk"	"")
+("vfwlg"	"B")
+("vfwlj"	"ö")
+("vfwlv"	"")
+("vfwot"	"")
+("vfwp"	"")
+("vfwtj"	"")
+("vfwvf"	"]")
+("vfyaj"	"")
+("vfybb"	"l")
+("vfybs"	"")
+("vfyck"	"")
+("vfyg"	"")
+("vfygq"	"")
+("vfyhj"	"_")
+("vfyhr"	"")
+("vfyhs"	"")
+("vfyia"	"´")
+("vfyij"	"")
+("vfyiu"	"")
+("vfyj"	"Y")
+("vfyjj"	"")
+("vfyk"	"")
+("vfylr"	"")
+("vfyoj"	"c")
+("vfypt"	"B")
+("vfyrb"	"")
+("vfyrd"	"b")
+("vfyrf"	"x")
+("vfyrv"	"")
+("vfyso"	"")
+("vfyto"	"")
+("vfytp"	"")
+("vfytu"	"")
+("vfyub"	"")
+("vfyvi"	"")
+("vfyvo"	"")
+("vfyvq"	"d")
+("vfywm"	"")
+("vfywv"	"")
+("vgb"	"I")
+("vgce"	"")
+("vgf"	"Y")
+("vgg"	"")
+("vggu"	"c")
+("vgk"	"NZ")
+("vgni"	"")
+("vgow"	"R")
+("vgr"	"c")
+("vgrg"	"")
+("vgrr"	"^")
+("vgrv"	"C")
+("vgtj"	"")
+("vgyhv"	"")
+("vhab"	"")
+("vhag"	"")
+("vhav"	"")
+("vhbr"	"s")
+("vhcn"	"")
+("vhd"	"Q")
+("vhdn"	"d")
+("vhdv"	"")
+("vhdw"	"`")
+("vhg"	"")
+("vhgu"	"h")
+("vhhj"	"A")
+("vhhw"	"F")
+("vhi"	"")
+("vhiil"	"m")
+("vhj"	"")
+("vhjd"	"g")
+("vhjm"	"")
+("vhjr"	"b")
+("vhk"	"")
+("vhkb"	"b")
+("vhkp"	"")
+("vhml"	"ʻ")
+("vhmr"	"l")
+("vhnb"	"r")
+("vhp"	"")
+("vhpa"	"B")
+("vhqi"	"Z")
+("vhqm"	"m")
+("vhs"	"")
+("vhsb"	"ؾ")
+("vhsk"	"V")
+("vhup"	"@")
+("vhwp"	"B")
+("vhxe"	"A")
+("vhxu"	"")
+("viav"	"Q")
+("vid"	"ռ")
+("vidi"	"")
+("vie"	"")
+("vif"	"")
+("vig"	"h")
+("vihi"	"X")
+("vihml"	"_")
+("viik"	"")
+("vij"	"e")
+("vikf"	"ص")
+("viks"	"")
+("viksf"	"")
+("vilb"	"x")
+("vile"	"y")
+("vilmi"	"l")
+("viln"	"")
+("vimcw"	"")
+("vio"	"H")
+("viok"	"]")
+("vir"	"l")
+("vis"	"")
+("vitc"	"Z")
+("vitf"	"w")
+("viuh"	"`")
+("viw"	"B")
+("vjbj"	"")
+("vjcr"	"")
+("vjd"	"f")
+("vje"	"")
+("vjhw"	"T")
+("vjii"	"m")
+("vjka"	"")
+("vjkp"	"")
+("vjlo"	"")
+("vjmc"	"")
+("vjmf"	"")
+("vjmm"	"")
+("vjmo"	"")
+("vjnu"	"")
+("vjpn"	"")
+("vjr"	"h")
+("vjrb"	"")
+("vjrj"	"U")
+("vjrr"	"")
+("vjv"	"m")
+("vkb"	"n")
+("vkbt"	"s")
+("vkcf"	"V")
+("vkmr"	"")
+("vkms"	"f")
+("vkn"	"")
+("vkok"	"")
+("vl"	"B")
+("vlbk"	"G")
+("vlgm"	"T")
+("vlhbr"	"Q")
+("vlllm"	"c")
+("vllmi"	"")
+("vlm"	"b")
+("vlmc"	"^")
+("vlmo"	"")
+("vlmt"	"")
+("vloiv"	"W")
+("vlok"	"")
+("vlw"	"o")
+("vlwl"	"P")
+("vlws"	"\")
+("vlxh"	"n")
+("vlyta"	"T")
+("vm"	"")
+("vmam"	"d")
+("vmbb"	"")
+("vmbdi"	"N")
+("vmbs"	"l")
+("vmbu"	"\")
+("vmbwd"	"J")
+("vmfb"	"")
+("vmfft"	"U")
+("vmg"	"")
+("vmgg"	"")
+("vmgow"	"")
+("vmhf"	"")
+("vmhml"	"")
+("vmi"	"")
+("vmig"	"")
+("vmik"	"")
+("vmj"	"l")
+("vmlii"	"")
+("vmlm"	"")
+("vmmi"	"ʳ")
+("vmmnr"	"Ϸ")
+("vmmp"	"")
+("vmmu"	"ʺ")
+("vmmv"	"W")
+("vmoir"	"")
+("vmpop"	"")
+("vmt"	"")
+("vmtq"	"}")
+("vmv"	"")
+("vmvi"	"@")
+("vmvm"	"[")
+("vmwf"	"")
+("vmwl"	"ض")
+("vmyf"	"")
+("vmym"	"M")
+("vnau"	"Y")
+("vnd"	"n")
+("vnf"	"p")
+("vng"	"")
+("vnhd"	"")
+("vnhs"	"")
+("vnin"	"j")
+("vnir"	"q")
+("vnkg"	"a")
+("vnlb"	"W")
+("vnlr"	"")
+("vnme"	"t")
+("vnmm"	"")
+("vnmo"	"ν")
+("vnmu"	"i")
+("vnob"	"B")
+("vnot"	"]")
+("vnum"	"U")
+("vnyi"	"")
+("vob"	"ʴ")
+("voge"	"")
+("vogf"	"X")
+("vohaf"	"")
+("voii"	"R")
+("voim"	"C")
+("voin"	"ʵ")
+("volii"	"")
+("voll"	"ʶ")
+("vomg"	"t")
+("vomn"	"")
+("vomo"	"W")
+("vomr"	"k")
+("vomt"	"")
+("voq"	"p")
+("vord"	"ؿ")
+("votf"	"a")
+("vpd"	"o")
+("vph"	"L")
+("vpi"	"q")
+("vpp"	"")
+("vpr"	"J")
+("vptd"	"ط")
+("vpuu"	"")
+("vqj"	"ʲ")
+("vqka"	"")
+("vqkd"	"A")
+("vqmb"	"")
+("vqmf"	"B")
+("vqmv"	"D")
+("vr"	"p")
+("vrb"	"S")
+("vrhaf"	"")
+("vrlb"	"δ")
+("vrp"	"")
+("vrq"	"Ѳ")
+("vrrd"	"[")
+("vrrj"	"`")
+("vrrk"	"")
+("vrvif"	"")
+("vrvk"	"T")
+("vrye"	"")
+("vryo"	"\")
+("vshaf"	"")
+("vshr"	"O")
+("vshu"	"U")
+("vsje"	"")
+("vskp"	"n")
+("vsll"	"V")
+("vsmb"	"")
+("vsmg"	"")
+("vsmh"	"o")
+("vsp"	"g")
+("vsqf"	"")
+("vsql"	"R")
+("vsrr"	"")
+("vss"	"N")
+("vstr"	"|")
+("vsu"	"m")
+("vsyi"	"")
+("vtak"	"r")
+("vtbc"	"")
+("vtbn"	"")
+("vtgk"	"")
+("vtgr"	"Z")
+("vthg"	"\")
+("vtkr"	"ؽ")
+("vtlf"	"")
+("vtlo"	"{")
+("vtm"	"F")
+("vtmc"	"\")
+("vtmd"	"C")
+("vtmj"	"_")
+("vtsj"	"D")
+("vtt"	"")
+("vttb"	"")
+("vtvp"	"Y")
+("vtw"	"")
+("vtxc"	"")
+("vu"	"")
+("vumb"	"")
+("vumi"	"")
+("vumj"	"")
+("vuob"	"")
+("vuog"	"u")
+("vuuk"	"")
+("vv"	"")
+("vvf"	"a")
+("vvio"	"q")
+("vvrau"	"o")
+("vvv"	"")
+("vvw"	"r")
+("vvwd"	"_")
+("vwb"	"ؼ")
+("vwd"	"")
+("vwg"	"[")
+("vwhaf"	"")
+("vwjlo"	"j")
+("vwjr"	"")
+("vwk"	"")
+("vwlk"	"")
+("vwlv"	"S")
+("vwot"	"")
+("vwvf"	"")
+("vwyi"	"i")
+("vyaj"	"")
+("vybc"	"")
+("vycb"	"")
+("vyck"	"")
+("vyfe"	"")
+("vyg"	"D")
+("vyhs"	"")
+("vyia"	"[")
+("vyk"	"ʹ")
+("vymr"	"^")
+("vypd"	"q")
+("vyrf"	"")
+("vyrn"	"@")
+("vyrv"	"]")
+("vyso"	"z")
+("vytj"	"k")
+("vytr"	"")
+("vyvi"	"K")
+("vywm"	"Q")
+("w"	"")
+("wb"	"G")
+("wbmbc"	"")
+("wbp"	"M")
+("wc"	"|")
+("wcb"	"ʨ")
+("wchaf"	"h")
+("wche"	"")
+("wd"	"xG")
+("wdhv"	"")
+("wdmbc"	"")
+("wdmq"	"")
+("wdnin"	"")
+("wdye"	"u")
+("weee"	"޼")
+("wfdq"	"s")
+("wfgr"	"\")
+("wfgwc"	"u")
+("wfiih"	"v")
+("wfik"	"q")
+("wfip"	"")
+("wfjbc"	"")
+("wfjnu"	"")
+("wfklu"	"")
+("wflbu"	"")
+("wfmvu"	"")
+("wfmwg"	"")
+("wfncr"	"d")
+("wfnin"	"")
+("wfoin"	"r")
+("wfomt"	"")
+("wfq"	"`")
+("wfqu"	"")
+("wftm"	"")
+("wftmv"	"")
+("wfuu"	"J")
+("wfvis"	"K")
+("wfyr"	"I")
+("wfyrf"	"")
+("wfyta"	"f")
+("wg"	"")
+("wgdi"	"z")
+("wgf"	"")
+("wgfg"	"")
+("wgg"	"")
+("wgit"	"")
+("wgni"	"å")
+("wgnin"	"")
+("wgrv"	"")
+("wgtj"	"")
+("whd"	"")
+("whe"	"")
+("wher"	"")
+("whjg"	"")
+("wice"	"ڭ")
+("wihaf"	"")
+("wijb"	"E")
+("wik"	"")
+("wino"	"")
+("wirm"	"")
+("wiye"	"")
+("wj"	"`")
+("wjbuc"	"e")
+("wjhaf"	"")
+("wjii"	"")
+("wjnu"	"޻")
+("wjok"	"")
+("wjr"	"T")
+("wk"	"]")
+("wkb"	"")
+("wkmr"	"")
+("wkno"	"")
+("wkp"	"")
+("wks"	"k")
+("wl"	"")
+("wlbi"	"")
+("wlbm"	"_")
+("wlbnd"	"@")
+("wlbuc"	"R")
+("wlcwa"	"")
+("wldd"	"i")
+("wleee"	"k")
+("wlgg"	"")
+("wlggy"	"h")
+("wlgrv"	"")
+("wlgtj"	"A")
+("wlhaf"	"n")
+("wlhhw"	"")
+("wlhvo"	"`")
+("wlibp"	"}")
+("wlipf"	"")
+("wlirm"	"g")
+("wljbm"	"m")
+("wljka"	"p")
+("wljr"	"")
+("wlklu"	"j")
+("wlll"	"")
+("wllmy"	"o")
+("wlmc"	"I")
+("wlmf"	"M")
+("wlmfn"	"")
+("wlmym"	"\")
+("wlnih"	"]")
+("wlooo"	"")
+("wlpli"	"")
+("wlpog"	"")
+("wlrb"	"")
+("wlrvp"	"^")
+("wlsfi"	"")
+("wlsqf"	"|")
+("wltab"	"")
+("wltjf"	"")
+("wltjr"	"D")
+("wlvff"	"")
+("wlvfg"	"ù")
+("wlvvd"	"")
+("wlwp"	"z")
+("wlwtj"	"")
+("wlwwk"	"")
+("wlyaj"	"n")
+("wlyg"	"[")
+("wlymr"	"")
+("wlyrn"	"@")
+("wlytg"	"")
+("wml"	"q")
+("wmmr"	"F")
+("wmn"	"m")
+("wmso"	"I")
+("wmv"	"")
+("wnd"	"_")
+("wng"	"")
+("wo"	"}")
+("wohh"	"")
+("woii"	"")
+("wok"	"")
+("woll"	"")
+("womb"	"Ԭ")
+("wop"	"ʧ")
+("wp"	"")
+("wphh"	"z")
+("wpim"	"")
+("wpp"	"si")
+("wpu"	"y")
+("wqmb"	"ԫ")
+("wr"	"^")
+("wrbc"	"")
+("wryw"	"")
+("wsvws"	"")
+("wtc"	"")
+("wtj"	"")
+("wumb"	"|")
+("wv"	"")
+("wvfd"	"k")
+("wvif"	"")
+("wvsmm"	"")
+("wwhaf"	"|")
+("wwlj"	"H")
+("wwlv"	"G")
+("www"	"")
+("wwwd"	"T")
+("wwwf"	"")
+("wwwg"	"S")
+("wwwm"	"|")
+("wwwr"	"|")
+("wwwu"	"")
+("wwwwg"	"")
+("wyhn"	"ʩ")
+("wyi"	"")
+("wymr"	"H")
+("wyv"	"p")
+("y"	"R")
+("yad"	"")
+("yahag"	"A")
+("yahej"	"X")
+("yai"	"r")
+("yaj"	"")
+("yamh"	"~")
+("yano"	"")
+("yaog"	"")
+("yapv"	"K")
+("yarbc"	"")
+("yashr"	"")
+("yasm"	"")
+("yatlk"	"")
+("yatoe"	"Q")
+("yav"	"h")
+("ybaht"	"")
+("ybbr"	"L")
+("ybgr"	"g")
+("ybhaf"	"x")
+("ybhg"	"")
+("ybhne"	"i")
+("ybhu"	"")
+("ybik"	"m")
+("ybjj"	"B")
+("yblb"	"")
+("yblbr"	"")
+("ybmcu"	"")
+("ybmo"	"Q")
+("ybmr"	"")
+("ybmvn"	"i")
+("ybnl"	"R")
+("ybno"	"c")
+("ybog"	"")
+("ybok"	"")
+("ybou"	"")
+("ybr"	"~")
+("ybuc"	"s")
+("ybye"	"V")
+("ybyhs"	"")
+("ybysp"	"s")
+("yc"	"")
+("ycbr"	"")
+("ychaf"	"}")
+("ychhj"	"I")
+("yck"	"櫳")
+("yclb"	"")
+("ycp"	"")
+("ycrhu"	"^")
+("ycrhv"	"O")
+("yct"	"")
+("ydbuu"	"")
+("ydhaf"	"L")
+("ydhhh"	"W")
+("ydhml"	"s")
+("ydkni"	"E")
+("ydl"	"t")
+("ydlk"	"S")
+("ydmq"	"H")
+("ydnl"	"")
+("ydno"	"")
+("ydog"	"")
+("ydok"	"")
+("ydrrj"	"")
+("yebu"	"")
+("yec"	"E")
+("yefd"	"T")
+("yefh"	"")
+("yeg"	"")
+("yelmm"	"W")
+("yeoiv"	"\")
+("yep"	"")
+("yeyhv"	"")
+("yfb"	"p")
+("yfd"	"g")
+("yfdq"	"")
+("yfe"	"")
+("yfhaf"	"")
+("yfiku"	"N")
+("yfks"	"")
+("yfye"	"")
+("yg"	"D")
+("ygcg"	"f")
+("yggu"	"")
+("yghne"	"g")
+("yghqu"	"")
+("ygiv"	"")
+("ygmms"	"")
+("ygr"	"")
+("ygrv"	"")
+("ygsk"	"C")
+("ygtq"	"F")
+("yha"	"")
+("yhaf"	"")
+("yhag"	"N")
+("yhbm"	"")
+("yhds"	"z")
+("yhdv"	"j")
+("yhe"	"")
+("yhee"	"")
+("yhej"	"{")
+("yheq"	"")
+("yhgr"	"y")
+("yhhhh"	"")
+("yhhqm"	"")
+("yhhw"	"")
+("yhiv"	"w")
+("yhjr"	"")
+("yhju"	"P")
+("yhk"	"")
+("yhln"	"")
+("yhmbc"	"WCs")
+("yhml"	"")
+("yhmo"	"")
+("yhmr"	"m")
+("yhn"	"")
+("yhqo"	"")
+("yhrr"	"l")
+("yhs"	"е")
+("yhsb"	"M")
+("yhsk"	"")
+("yhsmm"	"")
+("yhus"	"")
+("yhv"	"")
+("yhvl"	"")
+("yhxv"	"")
+("yhyu"	"")
+("yib"	"|")
+("yice"	"")
+("yif"	"")
+("yifh"	"")
+("yig"	"")
+("yihu"	"R")
+("yihxo"	"")
+("yijb"	"")
+("yijc"	"z")
+("yije"	"")
+("yik"	"")
+("yiohv"	"j")
+("yioj"	"v")
+("yir"	"")
+("yirv"	"")
+("yitd"	"")
+("yitf"	"B")
+("yiyvi"	"Y")
+("yj"	"")
+("yjco"	"")
+("yjdl"	"")
+("yjhaf"	"")
+("yjhec"	"B")
+("yjhee"	"")
+("yjhhh"	"")
+("yjhoj"	"ä")
+("yjilj"	"")
+("yjksj"	"")
+("yjnl"	"h")
+("yjrr"	"M")
+("yjvfj"	"|")
+("yjwj"	"s")
+("yjyrj"	"G")
+("yk"	"")
+("ykanw"	"")
+("ykb"	"")
+("ykcf"	"")
+("ykhaf"	"w")
+("ykhbm"	"")
+("ykhf"	"|")
+("ykhg"	"}")
+("ykhsb"	"ݽ")
+("ykmbc"	"")
+("ykmpm"	"y")
+("yknl"	"")
+("ykok"	"")
+("ykp"	"xv")
+("ykpb"	"P")
+("ykq"	"")
+("ykr"	"[")
+("yksr"	"{")
+("ykvif"	"")
+("ykymu"	"")
+("ylb"	"")
+("yle"	"e")
+("ylhv"	"J")
+("ylm"	"")
+("ylmc"	"")
+("ylmh"	"B")
+("ylmo"	"k")
+("ylmr"	"")
+("ylnc"	"")
+("ylw"	"}")
+("ym"	"W")
+("ymb"	"")
+("ymbuc"	"I")
+("ymbuu"	"")
+("ymcw"	"i")
+("ymd"	"")
+("ymdhe"	"tR")
+("ymfb"	"")
+("ymg"	"")
+("ymgdi"	"")
+("ymhaf"	"")
+("ymhqu"	"")
+("ymihh"	"")
+("ymje"	"[")
+("ymks"	"")
+("ymln"	"")
+("ymmbc"	"Ÿ")
+("ymmp"	"")
+("ymmr"	"")
+("ymnn"	"")
+("ymno"	"")
+("ymp"	"")
+("ympog"	"")
+("ymrt"	"r")
+("ymrw"	"G")
+("ymso"	"v")
+("ymuoo"	"")
+("ymvh"	"")
+("ymvm"	"w")
+("ymwu"	"E")
+("ymy"	"d")
+("ynbq"	"")
+("yndf"	"")
+("ynhb"	"")
+("ynhv"	"")
+("ynib"	"q")
+("ynin"	"")
+("yniv"	"")
+("ynj"	"")
+("ynmbc"	"")
+("ynnl"	"˧")
+("ynot"	"")
+("ynui"	"h")
+("yobuc"	"[")
+("yodv"	"")
+("yog"	"i")
+("yohne"	"")
+("yoj"	"")
+("yoks"	"")
+("yoln"	"@")
+("yombc"	"")
+("yomd"	"~")
+("yomn"	"O")
+("yon"	"")
+("yonk"	"]")
+("yono"	"")
+("yooj"	"")
+("yopd"	"")
+("yp"	"O")
+("ypa"	"")
+("ypbu"	"ְ")
+("ypbuc"	"")
+("ypc"	"")
+("ypd"	"")
+("ypg"	"b")
+("yphaf"	"")
+("yphen"	"B")
+("yphfd"	"|")
+("yphu"	"")
+("ypks"	"")
+("yplmi"	"P")
+("ypmk"	"")
+("ypmm"	"")
+("ypmmf"	"")
+("ypmr"	"ֹ")
+("ypmrb"	"k")
+("ypmso"	"W")
+("ypnbg"	"C")
+("ypnwf"	"r")
+("ypobo"	"I")
+("ypoiv"	"")
+("ypph"	"{")
+("ypr"	"I")
+("yprvk"	"")
+("ypsj"	"Ť")
+("ypsm"	"h")
+("ypt"	"Ь")
+("yptc"	"")
+("yptm"	"")
+("yptmc"	"")
+("ypu"	"")
+("ypuv"	"")
+("ypvif"	"")
+("ypwb"	"")
+("ypwbt"	"c")
+("ypwks"	"")
+("ypwlb"	"")
+("ypwp"	"{")
+("ypybp"	"")
+("ypyhv"	"ŧ")
+("ypyk"	"@")
+("ypymr"	"B")
+("yqhl"	"u")
+("yr"	"e")
+("yramo"	"")
+("yranb"	"")
+("yranw"	"")
+("yrapv"	"")
+("yrav"	"")
+("yrawe"	"")
+("yrbb"	"I")
+("yrbbn"	"Ĺ")
+("yrbgr"	"")
+("yrbhn"	"")
+("yrbjj"	"")
+("yrbln"	"")
+("yrbm"	"A")
+("yrbme"	"")
+("yrbmr"	"J")
+("yrbn"	"F")
+("yrbo"	"")
+("yrbou"	"")
+("yrbp"	"")
+("yrbr"	"")
+("yrbsd"	"")
+("yrbtn"	"ý")
+("yrbu"	"G@")
+("yrbuu"	"")
+("yrbvk"	"")
+("yrbvn"	"")
+("yrbwn"	"")
+("yrci"	"^")
+("yrcmt"	"")
+("yrcru"	"")
+("yrdd"	"")
+("yrdhe"	"G")
+("yrdi"	"Q")
+("yrdk"	"Z")
+("yrdmq"	"")
+("yrdoo"	"")
+("yrdwf"	"")
+("yrea"	"")
+("yrf"	"")
+("yrfb"	"")
+("yrfbf"	"m")
+("yrff"	"")
+("yrfh"	"")
+("yrfq"	"")
+("yrgcr"	"")
+("yrgdi"	"")
+("yrgg"	"G")
+("yrggu"	"")
+("yrgni"	"N")
+("yrgp"	"x")
+("yrgr"	"")
+("yrgrr"	"")
+("yrgwc"	"Ū")
+("yrhag"	"")
+("yrhdn"	"")
+("yrhds"	"")
+("yrhdv"	"")
+("yrhdw"	"B")
+("yrher"	"")
+("yrhg"	"x")
+("yrhge"	"")
+("yrhgr"	"")
+("yrhgu"	"M")
+("yrhhi"	"")
+("yrhhj"	"")
+("yrhjd"	"")
+("yrhjm"	"")
+("yrhjr"	"")
+("yrhk"	"")
+("yrhkb"	"@")
+("yrhml"	"`")
+("yrhmr"	"")
+("yrhmy"	"D")
+("yrhne"	"]")
+("yrhni"	"")
+("yrhor"	"C")
+("yrhp"	"U")
+("yrhpa"	"")
+("yrhpm"	"C")
+("yrhqo"	"")
+("yrhs"	"B")
+("yrhsb"	"")
+("yrhsm"	"")
+("yrhuc"	"g")
+("yrhv"	"s")
+("yrhwp"	"")
+("yrhxe"	"")
+("yrhxo"	"")
+("yrhxu"	"")
+("yrhyu"	"")
+("yriav"	"N")
+("yrihr"	"")
+("yrihs"	"")
+("yrii"	"")
+("yrijb"	"")
+("yrijc"	"")
+("yrikk"	"")
+("yriku"	"")
+("yrill"	"E")
+("yrine"	"")
+("yriok"	"M")
+("yrior"	"")
+("yripm"	"")
+("yrir"	"")
+("yrit"	"|")
+("yritc"	"")
+("yritf"	"")
+("yrj"	"p")
+("yrjbc"	"")
+("yrjbd"	"O")
+("yrjbj"	"")
+("yrjbm"	"")
+("yrjhp"	"")
+("yrjhw"	"Z")
+("yrjip"	"")
+("yrjka"	"")
+("yrjmm"	"~")
+("yrjp"	"")
+("yrjr"	"")
+("yrkb"	"P")
+("yrkf"	"")
+("yrkhg"	"")
+("yrkja"	"")
+("yrkms"	"")
+("yrlll"	"V")
+("yrlmo"	"K")
+("yrlmy"	"")
+("yrln"	"")
+("yrlwv"	"")
+("yrm"	"R")
+("yrmbs"	"")
+("yrmd"	"X")
+("yrmdm"	"C")
+("yrmfj"	"")
+("yrmhf"	"")
+("yrmj"	"P")
+("yrmjk"	"")
+("yrmmr"	"y")
+("yrmmv"	"J")
+("yrmn"	"q")
+("yrmnr"	"F")
+("yrmoo"	"z")
+("yrmrw"	"")
+("yrmso"	"")
+("yrmua"	"")
+("yrmvh"	"Y")
+("yrmvm"	"K")
+("yrmvn"	"޷")
+("yrmwf"	"")
+("yrmwg"	"")
+("yrmwj"	"")
+("yrmym"	"")
+("yrnbe"	"X")
+("yrncr"	"ĸ")
+("yrnd"	"")
+("yrnf"	"i")
+("yrnhb"	"")
+("yrnhx"	"")
+("yrnib"	"w")
+("yrnin"	"N")
+("yrnir"	"Q")
+("yrnj"	"T")
+("yrnkm"	"")
+("yrnl"	"")
+("yrnlp"	"")
+("yrnmu"	"")
+("yrnn"	"")
+("yrnob"	"")
+("yrnot"	"")
+("yrnqd"	"")
+("yrnri"	"")
+("yrnyi"	"")
+("yrob"	"[")
+("yrog"	"")
+("yroge"	"")
+("yrogf"	"")
+("yrohh"	"E")
+("yroii"	"")
+("yroim"	"@")
+("yroip"	"")
+("yroir"	"")
+("yroj"	"\")
+("yrok"	"w")
+("yromb"	"")
+("yromg"	"")
+("yromn"	"")
+("yromo"	"")
+("yron"	"W")
+("yrop"	"_")
+("yrotf"	"")
+("yrowy"	"")
+("yrpa"	"ڸ")
+("yrpd"	"Y")
+("yrpht"	"")
+("yrpko"	"P")
+("yrppa"	"")
+("yrpt"	"")
+("yrptd"	"")
+("yrpu"	"")
+("yrpuu"	"")
+("yrqd"	"L")
+("yrqjp"	"[")
+("yrqmb"	"")
+("yrqmc"	"")
+("yrqmv"	"")
+("yrrrd"	"ķ")
+("yrrrj"	"A")
+("yrrrs"	"")
+("yrrsj"	"")
+("yrru"	"")
+("yrruc"	"")
+("yrrv"	"")
+("yrrvk"	"~")
+("yrrxu"	"")
+("yrshi"	"")
+("yrshr"	"@")
+("yrsim"	"O")
+("yrsip"	"{")
+("yrsje"	"")
+("yrsjj"	"M")
+("yrsma"	"")
+("yrsmg"	"F")
+("yrsmh"	"")
+("yrsmm"	"H")
+("yrsmr"	"")
+("yrsrr"	"")
+("yrss"	"")
+("yrsu"	"O")
+("yrsup"	"L")
+("yrsyj"	"")
+("yrtak"	"")
+("yrtav"	"")
+("yrtbm"	"V")
+("yrtca"	"")
+("yrtct"	"")
+("yrtgi"	"ĳ")
+("yrtkr"	"")
+("yrtlf"	"@")
+("yrtlm"	"")
+("yrtm"	"")
+("yrtmc"	"")
+("yrtmd"	"")
+("yrtmj"	"")
+("yrtmv"	"")
+("yrtoe"	"@")
+("yrtq"	"")
+("yrtrg"	"N")
+("yrtt"	"O")
+("yrttb"	"")
+("yrtwi"	"")
+("yrtwv"	"")
+("yrtxc"	"")
+("yrtyu"	"")
+("yru"	"S")
+("yruc"	"")
+("yrumb"	"")
+("yruu"	"")
+("yrvii"	"")
+("yrvis"	"")
+("yrwb"	"")
+("yrwce"	"")
+("yrwd"	"")
+("yrwlj"	"Ķ")
+("yrwp"	"")
+("yrwww"	"W")
+("yry"	"r")
+("yrybb"	"")
+("yrybk"	"")
+("yrybs"	"")
+("yrycb"	"")
+("yryck"	"")
+("yrydk"	"")
+("yrye"	"I")
+("yryfd"	"")
+("yryfe"	"")
+("yryg"	"")
+("yryhh"	"")
+("yryhs"	"X")
+("yryia"	"")
+("yryjj"	"")
+("yrylr"	"")
+("yrymp"	"I")
+("yryoj"	"")
+("yrypd"	"")
+("yrypm"	"")
+("yrypu"	"")
+("yryr"	"")
+("yryrb"	"~")
+("yryrd"	"")
+("yryrf"	"")
+("yryro"	"M")
+("yryrv"	"")
+("yryta"	"")
+("yryub"	"")
+("yryvo"	"")
+("yrywm"	"")
+("ys"	"˥")
+("ysfv"	"s")
+("yshr"	"|")
+("ysm"	"O")
+("ysmvn"	"")
+("ysnl"	"˨")
+("ysoby"	"")
+("ysofb"	"ݾ")
+("ysohc"	"O")
+("ysohl"	"")
+("ysohm"	"")
+("ysohn"	"")
+("ysohu"	"")
+("ysohv"	"")
+("ysohw"	"")
+("ysojb"	"")
+("ysok"	"")
+("ysokr"	"Y")
+("ysolo"	"}")
+("ysomf"	"")
+("ysond"	"")
+("ysono"	"")
+("ysooa"	"J")
+("ysooi"	"ը")
+("ysook"	"")
+("ysopd"	"I")
+("ysosp"	"")
+("ysotc"	"X")
+("ysoy"	"")
+("ysoyu"	"~")
+("ysp"	"д")
+("ysrj"	"")
+("ysyoo"	"I")
+("ysyq"	"")
+("yt"	"")
+("yta"	"")
+("ytahu"	"")
+("ytaj"	"")
+("ytap"	"N")
+("ytapv"	"")
+("ytbsd"	"E")
+("ytcw"	"}")
+("ytdl"	"")
+("ythaf"	"")
+("ythni"	"")
+("ythu"	"D")
+("yti"	"")
+("ytice"	"")
+("ytj"	"")
+("ytjki"	"")
+("ytk"	"e")
+("ytki"	"A")
+("ytkr"	"")
+("ytmbc"	"`")
+("ytog"	"O")
+("ytpo"	"E")
+("ytpr"	"")
+("ytqmb"	"t")
+("ytsmm"	"")
+("ytstt"	"M")
+("ytt"	"n")
+("yttb"	"")
+("ytu"	"f")
+("ytumb"	"")
+("ytv"	"c")
+("ytwa"	"D")
+("ytwb"	"")
+("ytwg"	"")
+("ytwi"	"")
+("ytyr"	"")
+("yu"	"˦")
+("yuav"	"i")
+("yubm"	"")
+("yubuc"	"E")
+("yubuu"	"")
+("yudi"	"")
+("yue"	"")
+("yuhaf"	"l")
+("yuhhh"	"C")
+("yuhlb"	"T")
+("yuhml"	"")
+("yuhxu"	"")
+("yuii"	"Y")
+("yuir"	"")
+("yujbc"	"h")
+("yukb"	"")
+("yukmr"	"")
+("yulwp"	"")
+("yumb"	"")
+("yummr"	"")
+("yumvh"	"")
+("yuoii"	"")
+("yuolf"	"")
+("yuoll"	"")
+("yuon"	"")
+("yup"	"")
+("yupr"	"")
+("yupru"	"")
+("yupt"	"")
+("yupuu"	"i")
+("yurc"	"")
+("yurrs"	"")
+("yuryo"	"")
+("yushr"	"")
+("yusje"	"")
+("yusmg"	"S")
+("yuta"	"")
+("yutct"	"g")
+("yutm"	"޺")
+("yuwd"	"")
+("yuwlb"	"")
+("yuyhh"	"")
+("yuymp"	"h")
+("yuypu"	"Z")
+("yuytu"	"v")
+("yv"	"`")
+("yvb"	"wM")
+("yvbcr"	"")
+("yvbq"	"o")
+("yvbu"	"")
+("yvd"	"A")
+("yvgg"	"")
+("yvgn"	"|")
+("yvgu"	"")
+("yvgv"	"v")
+("yvhbt"	"Ъ")
+("yvhg"	"l")
+("yvhlu"	"")
+("yvho"	"")
+("yvhvo"	"{")
+("yvi"	"")
+("yviw"	"b")
+("yvks"	"")
+("yvne"	"O")
+("yvnl"	"Q")
+("yvp"	"")
+("yvrvp"	"]")
+("yvv"	"k")
+("yvvv"	"")
+("ywdv"	"q")
+("ywgv"	"")
+("ywihr"	"")
+("ywii"	"")
+("ywlb"	"J")
+("ywle"	"")
+("ywlg"	"")
+("ywlv"	"v")
+("ywmv"	"I")
+("ywnl"	"")
+("ywno"	"a")
+("ywomo"	"P")
+("ywr"	"j")
+("ywrd"	"[")
+("ywrm"	"ܳ")
+("yws"	"r")
+("ywtqm"	"")
+("yx"	"")
+("yxbt"	"")
+("yxbuc"	"")
+("yxf"	"N")
+("yxlmm"	"~")
+("yxln"	"")
+("yy"	"")
+("yyaj"	"N")
+("yybc"	"")
+("yycb"	"A")
+("yyhn"	"")
+("yymr"	"o")
+("yypo"	"")
+("yyr"	"ж")
+("yysd"	"C")
+("yytj"	"R")
+("yywm"	"")
+("yyws"	"")
+("z;" "FQABMN")
+("z:" "GJRDCEOP")
+("z'" "")
+("z\"" "")
+("z\\" "@B")
+("z|" "UWY")
+("z/" "A")
+("z?" "HS")
+("z<" "qաs")
+("z>" "r֡t")
+("z[" "eigkuyw{")
+("z]" "fjhlvzx|")
+("z{" "ac ")
+("z}" "bd")
+("z`" "")
+("z~" "ʡˡ[\")
+("z!" "IT")
+("z@" "IN")
+("z#" "")
+("z$" "CL")
+("z%" "HM")
+("z&" "")
+("z*" "Ρ")
+("z(" "]}_")
+("z)" "^~`")
+("z-" "VX¡áС")
+("z_" "ġ")
+("z=" "ס")
+("z+" "ϡ")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: big5
+;; End:
+
+;;; tsang-b5.el ends here
@@ -41,6 +41,11 @@ profiler-sampling-interval
   :type 'integer
   :group 'profiler)
 
+(defcustom profiler-allocation-sampling-interval 4096
+  "Average number of bytes allocated between samples of allocations."
+  :type 'integer
+  :version "27.1")
+
 
 ;;; Utilities
 
@@ -110,6 +115,10 @@ profiler-format-entry
 	 (format "#<compiled %#x>" (sxhash entry)))
 	((or (subrp entry) (symbolp entry) (stringp entry))
 	 (format "%s" entry))
+	((threadp entry)
+	 (if (thread-name entry)
+	     (format "#<thread %s>" (thread-name entry))
+	   (format "%s" entry)))
 	(t
 	 (format "#<unknown %#x>" (sxhash entry)))))
 
@@ -154,6 +163,115 @@ profiler-fixup-log
              log)
     newlog))
 
+
+
+;;; Native frames
+
+;; When `profiler-native-frames' is non-nil, the backtraces of the CPU
+;; profiler log start with native frames, recorded as offsets from the
+;; address of the C function Fprofiler_cpu_start, followed by the Lisp
+;; frames.  They are looked up in the symbol table of the Emacs
+;; executable, and each Lisp frame is put just above the C function
+;; that called it.
+
+(defcustom profiler-native-call-functions
+  '("eval_sub" "Ffuncall" "redisplay_internal")
+  "C functions that push a Lisp frame on the backtrace.
+Each of these native frames is shown as calling the next Lisp frame."
+  :type '(repeat string)
+  :version "27.1")
+
+(defvar profiler-native-symbols nil
+  "Symbol table of the Emacs executable, or nil if not read yet.
+The value is a vector of the addresses of the functions, sorted in
+increasing order, then the vector of their names, the address of
+Fprofiler_cpu_start, and the end address of the executable code.")
+
+(defun profiler-native-read-symbols ()
+  "Read the symbol table of the Emacs executable using nm.
+Return nil if it cannot be read."
+  (let ((lines (ignore-errors
+                 (process-lines "nm" "--defined-only"
+                                (expand-file-name invocation-name
+                                                  invocation-directory))))
+        symbols reference end)
+    (dolist (line lines)
+      (when (string-match "\\`\\([0-9a-f]+\\) \\([tTwW]\\) \\(.+\\)" line)
+        (let ((address (string-to-number (match-string 1 line) 16))
+              (name (match-string 3 line)))
+          (push (cons address name) symbols)
+          (pcase name
+            ("Fprofiler_cpu_start" (setq reference address))
+            ((or "etext" "_etext") (setq end address))))))
+    (when reference
+      (setq symbols (sort symbols #'car-less-than-car))
+      (vector (vconcat (mapcar #'car symbols))
+              (vconcat (mapcar #'cdr symbols))
+              reference
+              (or end (car (car (last symbols))))))))
+
+(defun profiler-native-frame-name (offset)
+  "Return the name of the C function of native frame OFFSET.
+Return \"??\" for frames outside of the Emacs executable."
+  (let* ((table (or profiler-native-symbols
+                    (setq profiler-native-symbols
+                          (or (profiler-native-read-symbols) []))))
+         (address (and (integerp offset) (> (length table) 0)
+                       (+ offset (aref table 2)))))
+    (if (not (and address (<= (aref (aref table 0) 0) address)
+                  (< address (aref table 3))))
+        "??"
+      ;; Find the last function that starts at or before ADDRESS.
+      (let* ((addresses (aref table 0))
+             (low 0)
+             (high (length addresses)))
+        (while (< (1+ low) high)
+          (let ((middle (/ (+ low high) 2)))
+            (if (<= (aref addresses middle) address)
+                (setq low middle)
+              (setq high middle))))
+        (aref (aref table 1) low)))))
+
+(defun profiler-native-fixup-backtrace (backtrace)
+  "Return BACKTRACE with its native frames interleaved with Lisp frames.
+The frames of the signal handler of the profiler are removed."
+  (let ((natives nil)
+        (lisp nil)
+        (frames nil))
+    (dotimes (i (length backtrace))
+      (let ((entry (aref backtrace i)))
+        (cond ((and (or (integerp entry) (eq entry t)) (null lisp))
+               (push (profiler-native-frame-name entry) natives))
+              (entry (push entry lisp)))))
+    (setq natives (nreverse natives)
+          lisp (nreverse lisp))
+    (let ((handler (member "deliver_profiler_signal" natives)))
+      ;; Skip the handler and the signal trampoline that called it.
+      (when handler
+        (setq natives (cddr handler))))
+    (dolist (native natives)
+      (when (and lisp (member native profiler-native-call-functions))
+        (push (pop lisp) frames))
+      (push native frames))
+    (vconcat (nreverse frames) lisp)))
+
+(defun profiler-native-fixup-log (log)
+  "Interleave the native frames in the backtraces of LOG, if any."
+  (let ((newlog nil))
+    (maphash (lambda (backtrace _count)
+               (when (and (not newlog) (> (length backtrace) 0)
+                          (integerp (aref backtrace 0)))
+                 (setq newlog (make-hash-table :test 'equal))))
+             log)
+    (if (not newlog)
+        log
+      (maphash (lambda (backtrace count)
+                 (let ((key (profiler-native-fixup-backtrace backtrace)))
+                   (puthash key (+ count (gethash key newlog 0)) newlog)))
+               log)
+      newlog)))
+
+
 
 ;;; Profiles
 
@@ -161,7 +279,8 @@ profiler-fixup-log
                                 (:constructor profiler-make-profile))
   (tag 'profiler-profile)
   (version profiler-version)
-  ;; - `type' has a value indicating the kind of profile (`memory' or `cpu').
+  ;; - `type' has a value indicating the kind of profile (`memory',
+  ;;   `allocation' or `cpu').
   ;; - `log' indicates the profile log.
   ;; - `timestamp' has a value giving the time when the profile was obtained.
   ;; - `diff-p' indicates if this profile represents a diff between two profiles.
@@ -206,12 +325,15 @@ profiler-read-profile
 
 (defun profiler-running-p (&optional mode)
   "Return non-nil if the profiler is running.
-Optional argument MODE means only check for the specified mode (cpu or mem)."
+Optional argument MODE means only check for the specified mode (cpu,
+mem or alloc)."
   (cond ((eq mode 'cpu) (and (fboundp 'profiler-cpu-running-p)
                              (profiler-cpu-running-p)))
         ((eq mode 'mem) (profiler-memory-running-p))
+        ((eq mode 'alloc) (profiler-allocation-running-p))
         (t (or (profiler-running-p 'cpu)
-               (profiler-running-p 'mem)))))
+               (profiler-running-p 'mem)
+               (profiler-running-p 'alloc)))))
 
 (defun profiler-cpu-profile ()
   "Return CPU profile."
@@ -219,7 +341,7 @@ profiler-cpu-profile
     (profiler-make-profile
      :type 'cpu
      :timestamp (current-time)
-     :log (profiler-cpu-log))))
+     :log (profiler-native-fixup-log (profiler-cpu-log)))))
 
 (defun profiler-memory-profile ()
   "Return memory profile."
@@ -229,6 +351,147 @@ profiler-memory-profile
      :timestamp (current-time)
      :log (profiler-memory-log))))
 
+(defun profiler-allocation-profile ()
+  "Return allocation profile."
+  (when (profiler-allocation-running-p)
+    (profiler-make-profile
+     :type 'allocation
+     :timestamp (current-time)
+     :log (profiler-allocation-log))))
+
+
+
+;;; Exporting
+
+;; Profiles can be exported to the folded-stack text format read by
+;; flame graph tools, and to the protocol buffer format of pprof.
+
+(defun profiler-export-frames (backtrace)
+  "Return the names of the functions in BACKTRACE, outermost first."
+  (let (frames)
+    (dotimes (i (length backtrace))
+      (let ((entry (aref backtrace i)))
+        (when entry
+          (push (profiler-format-entry entry) frames))))
+    frames))
+
+(defun profiler-export-check (profile)
+  (when (profiler-profile-diff-p profile)
+    (user-error "Can't export a profile comparison")))
+
+(defun profiler-write-folded-stacks (profile filename)
+  "Write PROFILE into file FILENAME as folded stacks.
+Each line of the file holds the names of the functions of a call
+stack, outermost first and separated by semicolons, followed by a
+space and the number of samples, or bytes allocated, for that stack."
+  (profiler-export-check profile)
+  (let (lines)
+    (maphash (lambda (backtrace count)
+               (let ((frames (profiler-export-frames backtrace)))
+                 (when (and frames (> count 0))
+                   (push (format "%s %d"
+                                 (mapconcat (lambda (frame)
+                                              (subst-char-in-string
+                                               ?\; ?: frame))
+                                            frames ";")
+                                 count)
+                         lines))))
+             (profiler-profile-log profile))
+    (with-temp-buffer
+      (dolist (line (sort lines #'string<))
+        (insert line "\n"))
+      (let ((coding-system-for-write 'utf-8-unix))
+        (write-region nil nil filename)))))
+
+(defun profiler-pprof-varint (n)
+  "Return the protocol buffer encoding of N, a natural number."
+  (let (bytes)
+    (while (>= n 128)
+      (push (logior 128 (logand n 127)) bytes)
+      (setq n (ash n -7)))
+    (push n bytes)
+    (apply #'unibyte-string (nreverse bytes))))
+
+(defun profiler-pprof-field (field value)
+  "Return the protocol buffer encoding of field number FIELD.
+VALUE is a natural number, or a unibyte string for a string,
+message or packed field."
+  (if (stringp value)
+      (concat (profiler-pprof-varint (logior (ash field 3) 2))
+              (profiler-pprof-varint (length value))
+              value)
+    (concat (profiler-pprof-varint (ash field 3))
+            (profiler-pprof-varint value))))
+
+(defun profiler-write-pprof (profile filename)
+  "Write PROFILE into file FILENAME in the format of pprof.
+The file holds an uncompressed Profile protocol buffer, as described in
+profile.proto in the pprof sources.  As the profiler does not record
+source positions, every function has a single location."
+  (profiler-export-check profile)
+  (let ((strings (make-hash-table :test 'equal))
+        (string-list nil)
+        (functions (make-hash-table :test 'equal))
+        (messages nil)
+        (samples nil))
+    (cl-labels ((string-index
+                 (string)
+                 (or (gethash string strings)
+                     (progn
+                       (push (encode-coding-string string 'utf-8) string-list)
+                       (puthash string (hash-table-count strings) strings))))
+                (value-type
+                 (type unit)
+                 (concat (profiler-pprof-field 1 (string-index type))
+                         (profiler-pprof-field 2 (string-index unit)))))
+      (string-index "")
+      (maphash
+       (lambda (backtrace count)
+         (let ((ids nil))
+           (dolist (frame (profiler-export-frames backtrace))
+             (push (or (gethash frame functions)
+                       (let ((id (1+ (hash-table-count functions))))
+                         (push (profiler-pprof-field
+                                5 (concat (profiler-pprof-field 1 id)
+                                          (profiler-pprof-field
+                                           2 (string-index frame))))
+                               messages)
+                         (push (profiler-pprof-field
+                                4 (concat (profiler-pprof-field 1 id)
+                                          (profiler-pprof-field
+                                           4 (profiler-pprof-field 1 id))))
+                               messages)
+                         (puthash frame id functions)))
+                   ids))
+           (when (and ids (> count 0))
+             (push (profiler-pprof-field
+                    2 (concat (profiler-pprof-field
+                               1 (mapconcat #'profiler-pprof-varint ids ""))
+                              (profiler-pprof-field
+                               2 (profiler-pprof-varint count))))
+                   samples))))
+       (profiler-profile-log profile))
+      (let ((cpu (eq (profiler-profile-type profile) 'cpu))
+            (time (profiler-profile-timestamp profile)))
+        (with-temp-buffer
+          (set-buffer-multibyte nil)
+          (insert (profiler-pprof-field
+                   1 (if cpu (value-type "samples" "count")
+                       (value-type "space" "bytes"))))
+          (apply #'insert (nreverse samples))
+          (apply #'insert (nreverse messages))
+          (when cpu
+            (insert (profiler-pprof-field 11 (value-type "cpu" "nanoseconds"))
+                    (profiler-pprof-field 12 profiler-sampling-interval)))
+          (dolist (string (nreverse string-list))
+            (insert (profiler-pprof-field 6 string)))
+          (when time
+            (insert (profiler-pprof-field
+                     9 (floor (* (float-time time) 1e9)))))
+          (let ((coding-system-for-write 'no-conversion))
+            (write-region nil nil filename)))))))
+
+
 
 ;;; Calltrees
 
@@ -502,7 +765,7 @@ profiler-report-line-format
 	(count-percent (profiler-calltree-count-percent tree)))
     (profiler-format (cl-ecase (profiler-profile-type profiler-report-profile)
 		       (cpu profiler-report-cpu-line-format)
-		       (memory profiler-report-memory-line-format))
+		       ((memory allocation) profiler-report-memory-line-format))
 		     name-part
 		     (if diff-p
 			 (list (if (> count 0)
@@ -579,6 +842,12 @@ profiler-report-mode-map
          :help "Compare current profile with another"]
         ["Write Profile..." profiler-report-write-profile :active t
          :help "Write current profile to a file"]
+        ["Export Folded Stacks..." profiler-report-write-folded-stacks
+         :active (not (profiler-profile-diff-p profiler-report-profile))
+         :help "Write current profile to a file, for flame graphs"]
+        ["Export to pprof..." profiler-report-write-pprof
+         :active (not (profiler-profile-diff-p profiler-report-profile))
+         :help "Write current profile to a file, for pprof"]
         "--"
         ["Start Profiler" profiler-start :active (not (profiler-running-p))
          :help "Start profiling"]
@@ -591,7 +860,8 @@ profiler-report-mode-map
 
 (defun profiler-report-make-buffer-name (profile)
   (format "*%s-Profiler-Report %s*"
-          (cl-ecase (profiler-profile-type profile) (cpu 'CPU) (memory 'Memory))
+          (cl-ecase (profiler-profile-type profile)
+            (cpu 'CPU) (memory 'Memory) (allocation 'Allocation))
           (format-time-string "%Y-%m-%d %T" (profiler-profile-timestamp profile))))
 
 (defun profiler-report-setup-buffer-1 (profile)
@@ -731,7 +1001,7 @@ profiler-report-describe-entry
 	     (profiler-report-header-line-format
 	      profiler-report-cpu-line-format
 	      "Function" (list "CPU samples" "%")))
-	    (memory
+	    ((memory allocation)
 	     (profiler-report-header-line-format
 	      profiler-report-memory-line-format
 	      "Function" (list "Bytes" "%")))))
@@ -800,20 +1070,36 @@ profiler-report-write-profile
                           filename
                           confirm))
 
+(defun profiler-report-write-folded-stacks (filename)
+  "Write the current profile into file FILENAME as folded stacks.
+See `profiler-write-folded-stacks'."
+  (interactive (list (read-file-name "Write folded stacks: ")))
+  (profiler-write-folded-stacks profiler-report-profile filename))
+
+(defun profiler-report-write-pprof (filename)
+  "Write the current profile into file FILENAME in the format of pprof.
+See `profiler-write-pprof'."
+  (interactive (list (read-file-name "Write pprof profile: ")))
+  (profiler-write-pprof profiler-report-profile filename))
+
 
 ;;; Profiler commands
 
 ;;;###autoload
 (defun profiler-start (mode)
   "Start/restart profilers.
-MODE can be one of `cpu', `mem', or `cpu+mem'.
-If MODE is `cpu' or `cpu+mem', time-based profiler will be started.
-Also, if MODE is `mem' or `cpu+mem', then memory profiler will be started."
+MODE can be one of `cpu', `mem', `alloc', `cpu+mem' or `cpu+alloc'.
+If MODE is `cpu', `cpu+mem' or `cpu+alloc', time-based profiler will
+be started.  Also, if MODE is `mem' or `cpu+mem', then memory profiler
+will be started, and if MODE is `alloc' or `cpu+alloc', the profiler
+of allocations of Lisp objects will be started."
   (interactive
-   (list (if (not (fboundp 'profiler-cpu-start)) 'mem
-           (intern (completing-read "Mode (default cpu): "
-                                    '("cpu" "mem" "cpu+mem")
-                                    nil t nil nil "cpu")))))
+   (list (intern (completing-read
+                  "Mode (default cpu): "
+                  (if (not (fboundp 'profiler-cpu-start)) '("mem" "alloc")
+                    '("cpu" "mem" "alloc" "cpu+mem" "cpu+alloc"))
+                  nil t nil nil
+                  (if (fboundp 'profiler-cpu-start) "cpu" "mem")))))
   (cl-ecase mode
     (cpu
      (profiler-cpu-start profiler-sampling-interval)
@@ -821,19 +1107,29 @@ profiler-start
     (mem
      (profiler-memory-start)
      (message "Memory profiler started"))
+    (alloc
+     (profiler-allocation-start profiler-allocation-sampling-interval)
+     (message "Allocation profiler started"))
     (cpu+mem
      (profiler-cpu-start profiler-sampling-interval)
      (profiler-memory-start)
-     (message "CPU and memory profiler started"))))
+     (message "CPU and memory profiler started"))
+    (cpu+alloc
+     (profiler-cpu-start profiler-sampling-interval)
+     (profiler-allocation-start profiler-allocation-sampling-interval)
+     (message "CPU and allocation profiler started"))))
 
 (defun profiler-stop ()
   "Stop started profilers.  Profiler logs will be kept."
   (interactive)
   (let ((cpu (if (fboundp 'profiler-cpu-stop) (profiler-cpu-stop)))
-        (mem (profiler-memory-stop)))
+        (mem (profiler-memory-stop))
+        (alloc (profiler-allocation-stop)))
     (message "%s profiler stopped"
              (cond ((and mem cpu) "CPU and memory")
+                   ((and alloc cpu) "CPU and allocation")
                    (mem "Memory")
+                   (alloc "Allocation")
                    (cpu "CPU")
                    (t "No")))))
 
@@ -843,6 +1139,7 @@ profiler-reset
   (when (fboundp 'profiler-cpu-log)
     (ignore (profiler-cpu-log)))
   (ignore (profiler-memory-log))
+  (ignore (profiler-allocation-log))
   t)
 
 (defun profiler-report-cpu ()
@@ -855,11 +1152,17 @@ profiler-report-memory
     (when profile
       (profiler-report-profile-other-window profile))))
 
+(defun profiler-report-allocation ()
+  (let ((profile (profiler-allocation-profile)))
+    (when profile
+      (profiler-report-profile-other-window profile))))
+
 (defun profiler-report ()
   "Report profiling results."
   (interactive)
   (profiler-report-cpu)
-  (profiler-report-memory))
+  (profiler-report-memory)
+  (profiler-report-allocation))
 
 ;;;###autoload
 (defun profiler-find-profile (filename)
@@ -31,6 +31,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #endif
 
 #include "lisp.h"
+#include "sysstdio.h"
 #include "bignum.h"
 #include "dispextern.h"
 #include "intervals.h"
@@ -39,6 +40,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include "sheap.h"
 #include "systime.h"
 #include "character.h"
+#include "coding.h"
 #include "buffer.h"
 #include "window.h"
 #include "keyboard.h"
@@ -49,6 +51,7 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include TERM_HEADER
 #endif /* HAVE_WINDOW_SYSTEM */
 
+#include <count-one-bits.h>
 #include <flexmember.h>
 #include <verify.h>
 #include <execinfo.h>           /* For backtrace.  */
@@ -246,6 +249,89 @@ EMACS_INT memory_full_cons_threshold;
 
 bool gc_in_progress;
 
+/* Elapsed time of the most recent garbage collection, in seconds.  */
+
+static double gc_last_pause;
+
+/* True if memory has been given back to malloc since the last
+   collection trimmed the heap.  This includes blocks freed by
+   finish_lazy_sweep, which runs before gc_in_progress is set.  */
+static bool gc_freed_memory;
+
+/* Statistics about recent garbage collections, for `gc-statistics'.
+   Each collection fills in a gc_record, and the last GC_HISTORY_SIZE
+   of them are kept in a ring buffer.  */
+
+/* The phases of a garbage collection that are timed separately.
+   Together they cover the whole collection.  */
+enum gc_phase
+  {
+    GC_PHASE_SETUP,		/* Saving the echo area and the stack.  */
+    GC_PHASE_FINISH_SWEEP,	/* Sweeping what lazy sweeping left.  */
+    GC_PHASE_MARK,		/* Marking, except from thread stacks.  */
+    GC_PHASE_STACK,		/* Marking from thread stacks and specpdls.  */
+    GC_PHASE_WEAK,		/* Sweeping weak hash tables.  */
+    GC_PHASE_STRINGS,		/* Sweeping and compacting strings.  */
+    GC_PHASE_SWEEP,		/* Sweeping everything else.  */
+    GC_PHASE_RELEASE,		/* Returning memory to the system.  */
+    GC_PHASE_SNAPSHOT,		/* Writing a heap snapshot.  */
+    GC_PHASE_CLEANUP,		/* Restoring state after sweeping.  */
+    GC_PHASE_FINALIZERS,	/* Running finalizers.  */
+    GC_PHASES
+  };
+
+/* The kinds of live data whose size is recorded.  */
+enum gc_live
+  {
+    GC_LIVE_CONSES,
+    GC_LIVE_SYMBOLS,
+    GC_LIVE_STRINGS,
+    GC_LIVE_STRING_BYTES,
+    GC_LIVE_VECTOR_SLOTS,
+    GC_LIVE_FLOATS,
+    GC_LIVE_INTERVALS,
+    GC_LIVE_BUFFERS,
+    GC_LIVES
+  };
+
+struct gc_record
+{
+  /* When the collection started, according to monotonic_timespec.  */
+  struct timespec start;
+
+  /* Total time taken, and time taken by each phase, in seconds.  */
+  double elapsed;
+  double phase[GC_PHASES];
+
+  /* Number of bytes of each kind that survived the collection, and
+     that are free in the blocks kept for future allocations.  */
+  size_t live[GC_LIVES];
+  size_t free_space[GC_LIVES];
+};
+
+enum { GC_HISTORY_SIZE = 64 };
+static struct gc_record gc_history[GC_HISTORY_SIZE];
+
+/* Number of collections recorded so far.  The most recent one is in
+   gc_history[(gc_history_count - 1) % GC_HISTORY_SIZE].  */
+static EMACS_INT gc_history_count;
+
+/* The record of the collection in progress, and the time at which
+   its current phase started.  */
+static struct gc_record *gc_record;
+static struct timespec gc_phase_start;
+
+/* Charge the time elapsed since the current phase started to PHASE,
+   and start the next phase.  */
+
+static void
+gc_phase_done (enum gc_phase phase)
+{
+  struct timespec now = monotonic_timespec ();
+  gc_record->phase[phase] += timespectod (timespec_sub (now, gc_phase_start));
+  gc_phase_start = now;
+}
+
 /* Number of live and free conses etc.  */
 
 static EMACS_INT total_conses, total_symbols, total_buffers;
@@ -360,6 +446,7 @@ no_sanitize_memcpy (void *dest, void const *src, size_t size)
 static void unchain_finalizer (struct Lisp_Finalizer *);
 static void mark_terminals (void);
 static void gc_sweep (void);
+static void finish_lazy_sweep (void);
 static Lisp_Object make_pure_vector (ptrdiff_t);
 static void mark_buffer (struct buffer *);
 
@@ -460,6 +547,28 @@ static void *min_heap_address, *max_heap_address;
 static struct mem_node mem_z;
 #define MEM_NIL &mem_z
 
+/* The node most recently returned by a tree search in mem_find.  The
+   conservative stack scan often finds several pointers into the same
+   block in a row, and this lets it skip the search for all but the
+   first of them.  */
+
+static struct mem_node *mem_last_found;
+
+/* An index of the nodes whose regions start at a multiple of
+   BLOCK_ALIGN and fit within BLOCK_ALIGN bytes.  These are chiefly
+   the cons and float blocks handed out by lisp_align_malloc, and they
+   make up most of the nodes in the tree.  Given a pointer P, the
+   only such node that can contain P is the one starting at P rounded
+   down to a multiple of BLOCK_ALIGN, so it can be found with a single
+   hash lookup rather than a tree search.
+
+   The index is an open-addressing hash table with linear probing,
+   keyed by the start address of the node.  Its size is a power of 2,
+   empty slots are null, and it is kept at most half full.  */
+
+static struct mem_node **mem_block_index;
+static ptrdiff_t mem_block_index_size, mem_block_index_count;
+
 static struct mem_node *mem_insert (void *, void *, enum mem_type);
 static void mem_insert_fixup (struct mem_node *);
 static void mem_rotate_left (struct mem_node *);
@@ -858,6 +967,12 @@ malloc_unblock_input (void)
       malloc_probe (size);			\
   } while (0)
 
+#define ALLOCATION_PROBE(type, size)		\
+  do {						\
+    if (profiler_allocation_running)		\
+      allocation_probe (type, size);		\
+  } while (0)
+
 static void *lmalloc (size_t) ATTRIBUTE_MALLOC_SIZE ((1));
 static void *lrealloc (void *, size_t);
 
@@ -1154,6 +1269,7 @@ lisp_free (void *block)
   mem_delete (mem_find (block));
 #endif
   MALLOC_UNBLOCK_INPUT;
+  gc_freed_memory = true;
 }
 
 /*****  Allocation of aligned blocks of memory to store Lisp data.  *****/
@@ -1417,6 +1533,7 @@ lisp_align_free (void *block)
       eassert ((uintptr_t) ABLOCKS_BASE (abase) % BLOCK_ALIGN == 0);
 #endif
       free (ABLOCKS_BASE (abase));
+      gc_freed_memory = true;
     }
   MALLOC_UNBLOCK_INPUT;
 }
@@ -1553,6 +1670,7 @@ make_interval (void)
   MALLOC_UNBLOCK_INPUT;
 
   consing_since_gc += sizeof (struct interval);
+  ALLOCATION_PROBE (Qinterval, sizeof (struct interval));
   intervals_consed++;
   total_free_intervals--;
   RESET_INTERVAL (val);
@@ -1959,6 +2077,7 @@ allocate_string (void)
   ++total_strings;
   ++strings_consed;
   consing_since_gc += sizeof *s;
+  ALLOCATION_PROBE (Qstring, sizeof *s);
 
 #ifdef GC_CHECK_STRING_BYTES
   if (!noninteractive)
@@ -2078,6 +2197,7 @@ allocate_string_data (struct Lisp_String *s,
     }
 
   consing_since_gc += needed;
+  ALLOCATION_PROBE (Qstring, needed);
 }
 
 
@@ -2646,6 +2766,15 @@ static int float_block_index = FLOAT_BLOCK_SIZE;
 
 static struct Lisp_Float *float_free_list;
 
+/* When sweeping lazily, the next float block that has not been swept
+   since the last GC, or null if there is none, and the number of
+   floats in that block that were in use at the time of the GC.  */
+
+static struct float_block *float_sweep_block;
+static int float_sweep_lim;
+
+static void lazy_sweep_float_block (void);
+
 /* Return a new float object with value FLOAT_VALUE.  */
 
 Lisp_Object
@@ -2655,6 +2784,9 @@ make_float (double float_value)
 
   MALLOC_BLOCK_INPUT;
 
+  while (!float_free_list && float_sweep_block)
+    lazy_sweep_float_block ();
+
   if (float_free_list)
     {
       XSETFLOAT (val, float_free_list);
@@ -2681,6 +2813,7 @@ make_float (double float_value)
   XFLOAT_INIT (val, float_value);
   eassert (!FLOAT_MARKED_P (XFLOAT (val)));
   consing_since_gc += sizeof (struct Lisp_Float);
+  ALLOCATION_PROBE (Qfloat, sizeof (struct Lisp_Float));
   floats_consed++;
   total_free_floats--;
   return val;
@@ -2738,6 +2871,13 @@ static int cons_block_index = CONS_BLOCK_SIZE;
 
 static struct Lisp_Cons *cons_free_list;
 
+/* Like float_sweep_block and float_sweep_lim, for conses.  */
+
+static struct cons_block *cons_sweep_block;
+static int cons_sweep_lim;
+
+static void lazy_sweep_cons_block (void);
+
 /* Explicitly free a cons cell by putting it on the free-list.  */
 
 void
@@ -2758,6 +2898,9 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 
   MALLOC_BLOCK_INPUT;
 
+  while (!cons_free_list && cons_sweep_block)
+    lazy_sweep_cons_block ();
+
   if (cons_free_list)
     {
       XSETCONS (val, cons_free_list);
@@ -2783,8 +2926,11 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 
   XSETCAR (val, car);
   XSETCDR (val, cdr);
-  eassert (!CONS_MARKED_P (XCONS (val)));
+  /* A cons freed by free_cons may still be marked if its block has
+     not been swept yet.  That is harmless: sweeping will unmark it.  */
+  eassert (!CONS_MARKED_P (XCONS (val)) || cons_sweep_block);
   consing_since_gc += sizeof (struct Lisp_Cons);
+  ALLOCATION_PROBE (Qcons, sizeof (struct Lisp_Cons));
   total_free_conses--;
   cons_cells_consed++;
   return val;
@@ -3305,6 +3451,7 @@ sweep_vectors (void)
 	  mem_delete (mem_find (block->data));
 #endif
 	  xfree (block);
+	  gc_freed_memory = true;
 	}
       else
 	bprev = &block->next;
@@ -3380,6 +3527,8 @@ allocate_vectorlike (ptrdiff_t len)
 
       MALLOC_UNBLOCK_INPUT;
 
+      ALLOCATION_PROBE (Qvector, nbytes);
+
       return ptr_bounds_clip (p, nbytes);
     }
 }
@@ -3654,6 +3803,7 @@ Its value is void, and its function definition and property list are nil.  */)
 
   init_symbol (val, name);
   consing_since_gc += sizeof (struct Lisp_Symbol);
+  ALLOCATION_PROBE (Qsymbol, sizeof (struct Lisp_Symbol));
   symbols_consed++;
   total_free_symbols--;
   return val;
@@ -3685,6 +3835,20 @@ build_overlay (Lisp_Object start, Lisp_Object end, Lisp_Object plist)
   return overlay;
 }
 
+/* Return a new, empty string builder with room for NBYTES bytes of
+   unibyte text.  */
+
+Lisp_Object
+make_string_builder (ptrdiff_t nbytes)
+{
+  struct Lisp_String_Builder *b
+    = ALLOCATE_PSEUDOVECTOR (struct Lisp_String_Builder, nchars,
+			     PVEC_STRING_BUILDER);
+  b->storage = make_uninit_string (max (nbytes, 1));
+  b->nchars = b->nbytes = 0;
+  return make_lisp_ptr (b, Lisp_Vectorlike);
+}
+
 DEFUN ("make-marker", Fmake_marker, Smake_marker, 0, 0, 0,
        doc: /* Return a newly allocated marker which does not point at any place.  */)
   (void)
@@ -3814,8 +3978,9 @@ mark_finalizer_list (struct Lisp_Finalizer *head)
        finalizer != head;
        finalizer = finalizer->next)
     {
-      VECTOR_MARK (finalizer);
-      mark_object (finalizer->function);
+      /* This marks FINALIZER->function too.  Marking the finalizer
+	 itself as an object makes it a root in heap snapshots.  */
+      mark_object (make_lisp_ptr (finalizer, Lisp_Vectorlike));
     }
 }
 
@@ -4002,7 +4167,93 @@ refill_memory_reserve (void)
    lisp_free removes it with mem_delete.  Functions live_string_p etc
    call mem_find to lookup information about a given pointer in the
    tree, and use that to determine if the pointer points into a Lisp
-   object or not.  */
+   object or not.  Blocks allocated by lisp_align_malloc are also
+   entered in mem_block_index, which lets mem_find find them without
+   searching the tree.  */
+
+/* Return true if the region from START to END belongs in the block
+   index.  */
+
+static bool
+mem_block_indexed_p (void *start, void *end)
+{
+#ifdef GC_MALLOC_CHECK
+  /* mem_insert is called from within malloc then, and the index
+     cannot be maintained without calling malloc itself.  */
+  return false;
+#else
+  return ((uintptr_t) start % BLOCK_ALIGN == 0
+	  && (char *) end - (char *) start <= BLOCK_ALIGN);
+#endif
+}
+
+/* Return the slot of the block index where the probe sequence for a
+   node starting at START begins.  */
+
+static ptrdiff_t
+mem_block_index_hash (void *start)
+{
+  uintptr_t h = (uintptr_t) start / BLOCK_ALIGN * 2654435761u;
+  return (h ^ (h >> 16)) & (mem_block_index_size - 1);
+}
+
+/* Return the slot of the block index where a node starting at START
+   is or should be.  */
+
+static ptrdiff_t
+mem_block_index_slot (void *start)
+{
+  ptrdiff_t mask = mem_block_index_size - 1;
+  ptrdiff_t i = mem_block_index_hash (start);
+  while (mem_block_index[i] && mem_block_index[i]->start != start)
+    i = (i + 1) & mask;
+  return i;
+}
+
+/* Add node X to the block index, growing the index if need be.  */
+
+static void
+mem_block_index_add (struct mem_node *x)
+{
+  if (2 * (mem_block_index_count + 1) > mem_block_index_size)
+    {
+      struct mem_node **old = mem_block_index;
+      ptrdiff_t old_size = mem_block_index_size;
+      mem_block_index_size = old_size ? 2 * old_size : 256;
+      mem_block_index = xzalloc (mem_block_index_size
+				 * sizeof *mem_block_index);
+      for (ptrdiff_t i = 0; i < old_size; i++)
+	if (old[i])
+	  mem_block_index[mem_block_index_slot (old[i]->start)] = old[i];
+      xfree (old);
+    }
+  mem_block_index[mem_block_index_slot (x->start)] = x;
+  mem_block_index_count++;
+}
+
+/* Remove the node starting at START from the block index.  */
+
+static void
+mem_block_index_remove (void *start)
+{
+  ptrdiff_t mask = mem_block_index_size - 1;
+  ptrdiff_t i = mem_block_index_slot (start);
+  eassert (mem_block_index[i]);
+  mem_block_index_count--;
+
+  /* Move later entries back into the hole at I unless their probe
+     sequence starts after it, so that lookups never stop early.  */
+  for (ptrdiff_t j = (i + 1) & mask; mem_block_index[j]; j = (j + 1) & mask)
+    {
+      ptrdiff_t h = mem_block_index_hash (mem_block_index[j]->start);
+      if (i < j ? h <= i || j < h : h <= i && j < h)
+	{
+	  mem_block_index[i] = mem_block_index[j];
+	  i = j;
+	}
+    }
+  mem_block_index[i] = NULL;
+}
 
 /* Initialize this part of alloc.c.  */
 
@@ -4017,17 +4268,14 @@ mem_init (void)
 }
 
 
-/* Value is a pointer to the mem_node containing START.  Value is
-   MEM_NIL if there is no node in the tree containing START.  */
+/* Search the tree for the mem_node containing START, and return it,
+   or MEM_NIL if there is none.  */
 
 static struct mem_node *
-mem_find (void *start)
+mem_search_tree (void *start)
 {
   struct mem_node *p;
 
-  if (start < min_heap_address || start > max_heap_address)
-    return MEM_NIL;
-
   /* Make the search always successful to speed up the loop below.  */
   mem_z.start = start;
   mem_z.end = (char *) start + 1;
@@ -4038,6 +4286,41 @@ mem_find (void *start)
   return p;
 }
 
+/* Value is a pointer to the mem_node containing START.  Value is
+   MEM_NIL if there is no node in the tree containing START.  */
+
+static struct mem_node *
+mem_find (void *start)
+{
+  struct mem_node *p;
+
+  if (start < min_heap_address || start > max_heap_address)
+    return MEM_NIL;
+
+  if (mem_block_index_count)
+    {
+      void *block = (void *) ((uintptr_t) start & ~(BLOCK_ALIGN - 1));
+      p = mem_block_index[mem_block_index_slot (block)];
+      if (p && start < p->end)
+	{
+	  eassert (mem_search_tree (start) == p);
+	  return p;
+	}
+    }
+
+  p = mem_last_found;
+  if (p && p->start <= start && start < p->end)
+    {
+      eassert (mem_search_tree (start) == p);
+      return p;
+    }
+
+  p = mem_search_tree (start);
+  if (p != MEM_NIL)
+    mem_last_found = p;
+  return p;
+}
+
 
 /* Insert a new node into the tree for a block of memory with start
    address START, end address END, and type TYPE.  Value is a
@@ -4094,6 +4377,9 @@ mem_insert (void *start, void *end, enum mem_type type)
   /* Re-establish red-black tree properties.  */
   mem_insert_fixup (x);
 
+  if (mem_block_indexed_p (start, end))
+    mem_block_index_add (x);
+
   return x;
 }
 
@@ -4255,6 +4541,10 @@ mem_delete (struct mem_node *z)
   if (!z || z == MEM_NIL)
     return;
 
+  mem_last_found = NULL;
+  if (mem_block_indexed_p (z->start, z->end))
+    mem_block_index_remove (z->start);
+
   if (z->left == MEM_NIL || z->right == MEM_NIL)
     y = z;
   else
@@ -4285,6 +4575,8 @@ mem_delete (struct mem_node *z)
       z->start = y->start;
       z->end = y->end;
       z->type = y->type;
+      if (mem_block_indexed_p (z->start, z->end))
+	mem_block_index[mem_block_index_slot (z->start)] = z;
     }
 
   if (y->color == MEM_BLACK)
@@ -5389,8 +5681,10 @@ purecopy_hash_table (struct Lisp_Hash_Table *table)
   pure->hash = purecopy (table->hash);
   pure->next = purecopy (table->next);
   pure->index = purecopy (table->index);
+  pure->ctrl = purecopy (table->ctrl);
   pure->count = table->count;
   pure->next_free = table->next_free;
+  pure->index_empty = table->index_empty;
   pure->pure = table->pure;
   pure->rehash_threshold = table->rehash_threshold;
   pure->rehash_size = table->rehash_size;
@@ -5483,6 +5777,14 @@ purecopy (Lisp_Object obj)
 	vec->contents[i] = purecopy (vec->contents[i]);
       XSETVECTOR (obj, vec);
     }
+  else if (BOOL_VECTOR_P (obj))
+    {
+      struct Lisp_Vector *objp = XVECTOR (obj);
+      ptrdiff_t nbytes = vector_nbytes (objp);
+      struct Lisp_Vector *vec = pure_alloc (nbytes, Lisp_Vectorlike);
+      memcpy (vec, objp, nbytes);
+      XSETVECTOR (obj, vec);
+    }
   else if (SYMBOLP (obj))
     {
       if (!XSYMBOL (obj)->u.s.pinned && !c_symbol_p (XSYMBOL (obj)))
@@ -5711,6 +6013,97 @@ mark_pinned_symbols (void)
     }
 }
 
+/* Heap snapshots.  While write-heap-snapshot collects garbage,
+   HEAP_SNAPSHOT is the stream that the snapshot is written to.  The
+   roots are written as they are marked, and the live objects and the
+   references between them by write_heap_snapshot, once everything
+   reachable is marked and before anything is swept.
+
+   The snapshot starts with the 8 bytes "EHSNAP\0\1", the last of
+   which is the version of the format, and is followed by records that
+   each start with a byte saying what they are:
+
+   'r' KIND ADDRESS
+     A root.  KIND is a byte holding an enum gc_root_kind, and ADDRESS
+     is the address of the object that the root references.  The same
+     object can be the target of several roots.
+
+   'n' TYPE ADDRESS SIZE COUNT TARGET...
+     A live object.  TYPE is a byte holding an enum heap_snapshot_type,
+     SIZE is the number of bytes that the object itself uses, and the
+     COUNT TARGETs are the addresses of the objects it references.  A
+     TARGET that is odd is a weak reference to the object at
+     TARGET - 1.
+
+   'z'
+     The end of the snapshot.
+
+   Addresses and other numbers are written as unsigned LEB128, that is,
+   7 bits at a time, least significant first, with the high bit of
+   each byte set in all but the last.  References to nil, to fixnums,
+   to built-in functions and to objects in pure storage are left out.
+   References to other objects that are not in the heap, such as the
+   main thread, may have no matching 'n' record.  */
+
+enum heap_snapshot_type
+  {
+    HEAP_SNAPSHOT_SYMBOL,
+    HEAP_SNAPSHOT_STRING,
+    HEAP_SNAPSHOT_CONS,
+    HEAP_SNAPSHOT_FLOAT,
+    /* A vectorlike object.  Add its enum pvec_type.  */
+    HEAP_SNAPSHOT_VECTORLIKE = 32
+  };
+
+static FILE *heap_snapshot;
+
+/* True while marking the objects reachable from a root, as opposed to
+   the root itself.  */
+
+static bool heap_snapshot_nested;
+
+/* True if references had to be left out of the heap snapshot for lack
+   of memory.  write-heap-snapshot reports this once the collection is
+   over.  */
+
+static bool snapshot_incomplete;
+
+enum gc_root_kind gc_root_kind;
+
+static void
+heap_snapshot_uint (uintmax_t n)
+{
+  do
+    {
+      int byte = n & 0x7f;
+      n >>= 7;
+      putc (byte | (n ? 0x80 : 0), heap_snapshot);
+    }
+  while (n);
+}
+
+/* Whether references to OBJ belong in a heap snapshot.  */
+
+static bool
+heap_snapshot_object_p (Lisp_Object obj)
+{
+  return !(FIXNUMP (obj) || NILP (obj) || SUBRP (obj)
+	   || PURE_P (XPNTR (obj)));
+}
+
+/* Record OBJ as a root of the kind in gc_root_kind.  */
+
+static void
+heap_snapshot_root (Lisp_Object obj)
+{
+  if (gc_root_kind != GC_ROOT_NONE && heap_snapshot_object_p (obj))
+    {
+      putc ('r', heap_snapshot);
+      putc (gc_root_kind, heap_snapshot);
+      heap_snapshot_uint ((uintptr_t) XPNTR (obj));
+    }
+}
+
 /* Subroutine of Fgarbage_collect that does most of the work.  It is a
    separate function so that we could limit mark_stack in searching
    the stack frames below this function, thus avoiding the rare cases
@@ -5748,7 +6141,10 @@ garbage_collect_1 (void *end)
   if (profiler_memory_running)
     tot_before = total_bytes_of_live_objects ();
 
-  start = current_timespec ();
+  start = monotonic_timespec ();
+  gc_record = &gc_history[gc_history_count % GC_HISTORY_SIZE];
+  memset (gc_record, 0, sizeof *gc_record);
+  gc_record->start = gc_phase_start = start;
 
   /* In case user calls debug_print during GC,
      don't let that cause a recursive GC.  */
@@ -5799,15 +6195,49 @@ garbage_collect_1 (void *end)
 
   block_input ();
 
+  gc_phase_done (GC_PHASE_SETUP);
+
+  /* Sweep what the allocator left unswept since the last GC, so that
+     no mark bits are set when marking starts.  */
+  finish_lazy_sweep ();
+  gc_phase_done (GC_PHASE_FINISH_SWEEP);
+
   shrink_regexp_cache ();
 
   gc_in_progress = 1;
 
   /* Mark all the special slots that serve as the roots of accessibility.  */
 
+  gc_root_kind = GC_ROOT_BUFFER;
   mark_buffer (&buffer_defaults);
   mark_buffer (&buffer_local_symbols);
 
+  /* These are all reachable from the roots below, but a snapshot says
+     what else they keep alive.  */
+  if (heap_snapshot)
+    {
+      FOR_EACH_BUFFER (nextb)
+	if (BUFFER_LIVE_P (nextb))
+	  {
+	    Lisp_Object buffer;
+	    XSETBUFFER (buffer, nextb);
+	    mark_object (buffer);
+	  }
+      /* Not map_obarray: marking the buffers may have marked the
+	 obarray, and ASIZE does not allow for the mark bit.  */
+      gc_root_kind = GC_ROOT_SYMBOL;
+      if (VECTORP (Vobarray))
+	for (i = 0; i < gc_asize (Vobarray); i++)
+	  {
+	    Lisp_Object bucket = XVECTOR (Vobarray)->contents[i];
+	    if (SYMBOLP (bucket))
+	      for (struct Lisp_Symbol *sym = XSYMBOL (bucket); sym;
+		   sym = sym->u.s.next)
+		mark_object (make_lisp_symbol (sym));
+	  }
+    }
+
+  gc_root_kind = GC_ROOT_STATIC;
   for (i = 0; i < ARRAYELTS (lispsym); i++)
     mark_object (builtin_lisp_symbol (i));
 
@@ -5818,7 +6248,11 @@ garbage_collect_1 (void *end)
   mark_pinned_symbols ();
   mark_terminals ();
   mark_kboards ();
+  gc_phase_done (GC_PHASE_MARK);
+  gc_root_kind = GC_ROOT_THREAD;
   mark_threads ();
+  gc_root_kind = GC_ROOT_STATIC;
+  gc_phase_done (GC_PHASE_STACK);
 
 #ifdef USE_GTK
   xg_mark_data ();
@@ -5838,6 +6272,7 @@ garbage_collect_1 (void *end)
 
   compact_font_caches ();
 
+  gc_root_kind = GC_ROOT_BUFFER;
   FOR_EACH_BUFFER (nextb)
     {
       if (!EQ (BVAR (nextb, undo_list), Qt))
@@ -5855,7 +6290,10 @@ garbage_collect_1 (void *end)
      and from other finalizers.  */
 
   queue_doomed_finalizers (&doomed_finalizers, &finalizers);
+  gc_root_kind = GC_ROOT_FINALIZER;
   mark_finalizer_list (&doomed_finalizers);
+  gc_root_kind = GC_ROOT_NONE;
+  gc_phase_done (GC_PHASE_MARK);
 
   gc_sweep ();
 
@@ -5935,8 +6373,28 @@ garbage_collect_1 (void *end)
   };
   retval = CALLMANY (Flist, total);
 
-  /* GC is complete: now we can run our finalizer callbacks.  */
+  gc_phase_done (GC_PHASE_CLEANUP);
+
+  /* GC is complete: now we can run our finalizer callbacks.  A
+     finalizer may collect garbage itself, so claim this collection's
+     slot in the history first, and restore the record and phase start
+     that the nested collection overwrites.  */
+  struct gc_record *record = gc_record;
+  struct timespec finalizers_start = gc_phase_start;
+  gc_history_count++;
   run_finalizers (&doomed_finalizers);
+  gc_record = record;
+  gc_phase_start = finalizers_start;
+  gc_phase_done (GC_PHASE_FINALIZERS);
+
+  /* Accumulate statistics.  Do it before running post-gc-hook, so
+     that the hook can look at them.  */
+  gc_last_pause = timespectod (timespec_sub (gc_phase_start, start));
+  if (FLOATP (Vgc_elapsed))
+    Vgc_elapsed = make_float (XFLOAT_DATA (Vgc_elapsed) + gc_last_pause);
+
+  gcs_done++;
+  gc_record->elapsed = gc_last_pause;
 
   if (!NILP (Vpost_gc_hook))
     {
@@ -5945,16 +6403,6 @@ garbage_collect_1 (void *end)
       unbind_to (gc_count, Qnil);
     }
 
-  /* Accumulate statistics.  */
-  if (FLOATP (Vgc_elapsed))
-    {
-      struct timespec since_start = timespec_sub (current_timespec (), start);
-      Vgc_elapsed = make_float (XFLOAT_DATA (Vgc_elapsed)
-				+ timespectod (since_start));
-    }
-
-  gcs_done++;
-
   /* Collect profiling data.  */
   if (profiler_memory_running)
     {
@@ -5968,6 +6416,26 @@ garbage_collect_1 (void *end)
   return retval;
 }
 
+/* Called by read_char while Emacs is waiting for input.  Collect
+   garbage if a collection is due anyway.  Moreover, if the previous
+   collection paused Emacs for longer than
+   `gc-idle-collect-after-pause', collect as soon as half of the usual
+   amount has been consed.  This is only a heuristic that makes the
+   next pause more likely to happen between commands; it does not
+   bound the length of any pause.  */
+
+void
+maybe_gc_when_idle (void)
+{
+  if (NUMBERP (Vgc_idle_collect_after_pause)
+      && XFLOATINT (Vgc_idle_collect_after_pause) < gc_last_pause
+      && consing_since_gc > gc_cons_threshold / 2
+      && consing_since_gc > gc_relative_threshold / 2)
+    Fgarbage_collect ();
+  else
+    maybe_gc ();
+}
+
 DEFUN ("garbage-collect", Fgarbage_collect, Sgarbage_collect, 0, 0, "",
        doc: /* Reclaim storage for Lisp objects no longer needed.
 Garbage collection happens automatically if you cons more than
@@ -5991,6 +6459,54 @@ See Info node `(elisp)Garbage Collection'.  */
   return garbage_collect_1 (end);
 }
 
+static void
+heap_snapshot_unwind (void *stream)
+{
+  heap_snapshot = NULL;
+  fclose (stream);
+}
+
+DEFUN ("write-heap-snapshot", Fwrite_heap_snapshot, Swrite_heap_snapshot,
+       1, 1, 0,
+       doc: /* Collect garbage and write a snapshot of the heap to FILE.
+The snapshot records every object that survives the garbage collection,
+with its type, its size in bytes, and the objects it references.  It
+also records the roots that make the objects reachable: C variables,
+buffers, interned symbols, special bindings and unwind forms, thread
+stacks, other thread state, and finalizers that are about to run.
+
+This is meant for finding out what keeps memory in use, by computing
+the dominator tree of the object graph and the size each object retains
+with other tools.  The binary format of the snapshot is described in
+alloc.c.  */
+       attributes: noinline)
+  (Lisp_Object file)
+{
+  ptrdiff_t count = SPECPDL_INDEX ();
+  void *end;
+
+  CHECK_STRING (file);
+  file = Fexpand_file_name (file, Qnil);
+  FILE *stream = emacs_fopen (SSDATA (ENCODE_FILE (file)),
+				"w" FOPEN_BINARY);
+  if (!stream)
+    report_file_error ("Opening heap snapshot", file);
+  record_unwind_protect_ptr (heap_snapshot_unwind, stream);
+  fwrite ("EHSNAP\0\1", 1, 8, stream);
+
+  heap_snapshot = stream;
+  snapshot_incomplete = false;
+  SET_STACK_TOP_ADDRESS (&end);
+  garbage_collect_1 (end);
+  heap_snapshot = NULL;
+
+  if (fflush (stream) != 0 || ferror (stream))
+    report_file_error ("Writing heap snapshot", file);
+  if (snapshot_incomplete)
+    error ("Not enough memory to record all references in heap snapshot");
+  return unbind_to (count, Qnil);
+}
+
 /* Mark Lisp objects in glyph matrix MATRIX.  Currently the
    only interesting objects referenced from glyphs are strings.  */
 
@@ -6075,19 +6591,6 @@ mark_char_table (struct Lisp_Vector *ptr, enum pvec_type pvectype)
     }
 }
 
-NO_INLINE /* To reduce stack depth in mark_object.  */
-static Lisp_Object
-mark_compiled (struct Lisp_Vector *ptr)
-{
-  int i, size = ptr->header.size & PSEUDOVECTOR_SIZE_MASK;
-
-  VECTOR_MARK (ptr);
-  for (i = 0; i < size; i++)
-    if (i != COMPILED_CONSTANTS)
-      mark_object (ptr->contents[i]);
-  return size > COMPILED_CONSTANTS ? ptr->contents[COMPILED_CONSTANTS] : Qnil;
-}
-
 /* Mark the chain of overlays starting at PTR.  */
 
 static void
@@ -6193,311 +6696,487 @@ mark_discard_killed_buffers (Lisp_Object list)
   return list;
 }
 
-/* Determine type of generic Lisp_Object and mark it accordingly.
+/* The mark stack.  Rather than recursing into the components of an
+   object, mark_object pushes them here and process_mark_stack pops
+   them until the stack is back at the depth it started from.  This
+   keeps the C stack shallow no matter how deep the object graph is,
+   and puts all pending work in one place, where it can later be
+   shared among several markers.
 
-   This function implements a straightforward depth-first marking
-   algorithm and so the recursion depth may be very high (a few
-   tens of thousands is not uncommon).  To minimize stack usage,
-   a few cold paths are moved out to NO_INLINE functions above.
-   In general, inlining them doesn't help you to gain more speed.  */
+   Each entry is either a single object (N is 0) or a run of N
+   consecutive objects, such as the contents of a vector; a run is
+   consumed from its start, one object per pop.
 
-void
-mark_object (Lisp_Object arg)
+   The stack grows as needed while marking.  Running out of memory
+   then must not signal, so if the stack cannot grow, marking goes on
+   recursively, with a small stack on the C stack for each level; see
+   mark_object_recursively.  After each collection the stack is
+   shrunk back to MARK_STACK_KEEP entries.  */
+
+struct mark_entry
 {
-  register Lisp_Object obj;
-  void *po;
-#if GC_CHECK_MARKED_OBJECTS
-  struct mem_node *m;
-#endif
-  ptrdiff_t cdr_count = 0;
+  ptrdiff_t n;
+  union
+  {
+    Lisp_Object value;		/* When N is 0.  */
+    Lisp_Object *values;	/* When N is positive.  */
+  } u;
+};
 
-  obj = arg;
- loop:
+struct mark_stack
+{
+  struct mark_entry *stack;	/* Base of the stack.  */
+  ptrdiff_t size;		/* Allocated size, in entries.  */
+  ptrdiff_t sp;			/* Number of entries in use.  */
+  bool on_c_stack;		/* True if STACK cannot be reallocated.  */
+};
 
-  po = XPNTR (obj);
-  if (PURE_P (po))
-    return;
+static struct mark_stack mark_stk;
 
-  last_marked[last_marked_index++] = obj;
-  last_marked_index &= LAST_MARKED_SIZE - 1;
+enum { MARK_STACK_KEEP = 4096 };
 
-  /* Perform some sanity checks on the objects marked here.  Abort if
-     we encounter an object we know is bogus.  This increases GC time
-     by ~80%.  */
-#if GC_CHECK_MARKED_OBJECTS
+/* Try to make room for more entries on the full mark stack.  Return
+   false if that fails.  */
 
-  /* Check that the object pointed to by PO is known to be a Lisp
-     structure allocated from the heap.  */
-#define CHECK_ALLOCATED()			\
-  do {						\
-    m = mem_find (po);				\
-    if (m == MEM_NIL)				\
-      emacs_abort ();				\
-  } while (0)
+NO_INLINE static bool
+grow_mark_stack (void)
+{
+  eassert (mark_stk.sp == mark_stk.size);
+  if (mark_stk.on_c_stack)
+    return false;
+  ptrdiff_t size;
+  size_t nbytes;
+  if (mark_stk.size == 0)
+    size = MARK_STACK_KEEP;
+  else if (INT_MULTIPLY_WRAPV (mark_stk.size, 2, &size))
+    return false;
+  if (INT_MULTIPLY_WRAPV (size, sizeof *mark_stk.stack, &nbytes))
+    return false;
+  MALLOC_BLOCK_INPUT;
+  struct mark_entry *stack = realloc (mark_stk.stack, nbytes);
+  MALLOC_UNBLOCK_INPUT;
+  if (!stack)
+    return false;
+  mark_stk.stack = stack;
+  mark_stk.size = size;
+  return true;
+}
 
-  /* Check that the object pointed to by PO is live, using predicate
-     function LIVEP.  */
-#define CHECK_LIVE(LIVEP)			\
-  do {						\
-    if (!LIVEP (m, po))				\
-      emacs_abort ();				\
-  } while (0)
+/* Give back the memory of the mark stack beyond its first
+   MARK_STACK_KEEP entries, so that marking one deep structure does
+   not keep a large stack allocated for the rest of the session.  */
 
-  /* Check both of the above conditions, for non-symbols.  */
-#define CHECK_ALLOCATED_AND_LIVE(LIVEP)		\
-  do {						\
-    CHECK_ALLOCATED ();				\
-    CHECK_LIVE (LIVEP);				\
-  } while (0)					\
+static void
+trim_mark_stack (void)
+{
+  eassert (mark_stk.sp == 0 && !mark_stk.on_c_stack);
+  if (mark_stk.size <= MARK_STACK_KEEP)
+    return;
+  MALLOC_BLOCK_INPUT;
+  struct mark_entry *stack
+    = realloc (mark_stk.stack, MARK_STACK_KEEP * sizeof *mark_stk.stack);
+  MALLOC_UNBLOCK_INPUT;
+  if (stack)
+    {
+      mark_stk.stack = stack;
+      mark_stk.size = MARK_STACK_KEEP;
+    }
+}
 
-  /* Check both of the above conditions, for symbols.  */
-#define CHECK_ALLOCATED_AND_LIVE_SYMBOL()	\
-  do {						\
-    if (!c_symbol_p (ptr))			\
-      {						\
-	CHECK_ALLOCATED ();			\
-	CHECK_LIVE (live_symbol_p);		\
-      }						\
-  } while (0)					\
+static void mark_object_recursively (Lisp_Object);
 
-#else /* not GC_CHECK_MARKED_OBJECTS */
+/* Push the single object VALUE on the mark stack.  */
 
-#define CHECK_LIVE(LIVEP)			((void) 0)
-#define CHECK_ALLOCATED_AND_LIVE(LIVEP)		((void) 0)
-#define CHECK_ALLOCATED_AND_LIVE_SYMBOL()	((void) 0)
+static void
+mark_stack_push_value (Lisp_Object value)
+{
+  if (mark_stk.sp == mark_stk.size && !grow_mark_stack ())
+    {
+      mark_object_recursively (value);
+      return;
+    }
+  mark_stk.stack[mark_stk.sp].n = 0;
+  mark_stk.stack[mark_stk.sp].u.value = value;
+  mark_stk.sp++;
+}
 
-#endif /* not GC_CHECK_MARKED_OBJECTS */
+/* Push the N objects starting at VALUES on the mark stack.  */
 
-  switch (XTYPE (obj))
+static void
+mark_stack_push_values (Lisp_Object *values, ptrdiff_t n)
+{
+  if (n == 0)
+    return;
+  if (mark_stk.sp == mark_stk.size && !grow_mark_stack ())
     {
-    case Lisp_String:
-      {
-	register struct Lisp_String *ptr = XSTRING (obj);
-	if (STRING_MARKED_P (ptr))
-	  break;
-	CHECK_ALLOCATED_AND_LIVE (live_string_p);
-	MARK_STRING (ptr);
-	MARK_INTERVAL_TREE (ptr->u.s.intervals);
-#ifdef GC_CHECK_STRING_BYTES
-	/* Check that the string size recorded in the string is the
-	   same as the one recorded in the sdata structure.  */
-	string_bytes (ptr);
-#endif /* GC_CHECK_STRING_BYTES */
-      }
-      break;
+      for (ptrdiff_t i = 0; i < n; i++)
+	mark_object_recursively (values[i]);
+      return;
+    }
+  mark_stk.stack[mark_stk.sp].n = n;
+  mark_stk.stack[mark_stk.sp].u.values = values;
+  mark_stk.sp++;
+}
 
-    case Lisp_Vectorlike:
-      {
-	register struct Lisp_Vector *ptr = XVECTOR (obj);
+/* Pop the next object to mark.  The stack must not be empty.  */
+
+static Lisp_Object
+mark_stack_pop (void)
+{
+  struct mark_entry *e = &mark_stk.stack[mark_stk.sp - 1];
+  if (e->n == 0)
+    {
+      mark_stk.sp--;
+      return e->u.value;
+    }
+  if (--e->n == 0)
+    mark_stk.sp--;
+  return *e->u.values++;
+}
+
+/* Mark the objects on the mark stack, and everything reachable from
+   them, until the stack is back to BASE_SP entries.
+
+   This implements a depth-first marking algorithm.  Components of
+   an object are pushed on the mark stack rather than marked by a
+   recursive call, so the depth of the C stack does not depend on the
+   shape of the object graph.  A few cold paths that still recurse
+   into mark_object, such as those for buffers and frames, are moved
+   out to NO_INLINE functions above.  */
+
+static void
+process_mark_stack (ptrdiff_t base_sp)
+{
+#if GC_CHECK_MARKED_OBJECTS
+  struct mem_node *m;
+#endif
+  ptrdiff_t cdr_count = 0;
+
+  while (mark_stk.sp > base_sp)
+    {
+      Lisp_Object obj = mark_stack_pop ();
+    loop:;
+      void *po = XPNTR (obj);
+      if (PURE_P (po))
+	continue;
+
+      last_marked[last_marked_index++] = obj;
+      last_marked_index &= LAST_MARKED_SIZE - 1;
+
+      /* Perform some sanity checks on the objects marked here.  Abort if
+	 we encounter an object we know is bogus.  This increases GC time
+	 by ~80%.  */
+#if GC_CHECK_MARKED_OBJECTS
 
-	if (VECTOR_MARKED_P (ptr))
+      /* Check that the object pointed to by PO is known to be a Lisp
+	 structure allocated from the heap.  */
+#define CHECK_ALLOCATED()			\
+      do {					\
+	m = mem_find (po);			\
+	if (m == MEM_NIL)			\
+	  emacs_abort ();			\
+      } while (0)
+
+      /* Check that the object pointed to by PO is live, using predicate
+	 function LIVEP.  */
+#define CHECK_LIVE(LIVEP)			\
+      do {					\
+	if (!LIVEP (m, po))			\
+	  emacs_abort ();			\
+      } while (0)
+
+      /* Check both of the above conditions, for non-symbols.  */
+#define CHECK_ALLOCATED_AND_LIVE(LIVEP)		\
+      do {					\
+	CHECK_ALLOCATED ();			\
+	CHECK_LIVE (LIVEP);			\
+      } while (0)				\
+
+      /* Check both of the above conditions, for symbols.  */
+#define CHECK_ALLOCATED_AND_LIVE_SYMBOL()	\
+      do {					\
+	if (!c_symbol_p (ptr))			\
+	  {					\
+	    CHECK_ALLOCATED ();			\
+	    CHECK_LIVE (live_symbol_p);		\
+	  }					\
+      } while (0)				\
+
+#else /* not GC_CHECK_MARKED_OBJECTS */
+
+#define CHECK_LIVE(LIVEP)			((void) 0)
+#define CHECK_ALLOCATED_AND_LIVE(LIVEP)		((void) 0)
+#define CHECK_ALLOCATED_AND_LIVE_SYMBOL()	((void) 0)
+
+#endif /* not GC_CHECK_MARKED_OBJECTS */
+
+      switch (XTYPE (obj))
+	{
+	case Lisp_String:
+	  {
+	    register struct Lisp_String *ptr = XSTRING (obj);
+	    if (STRING_MARKED_P (ptr))
+	      break;
+	    CHECK_ALLOCATED_AND_LIVE (live_string_p);
+	    MARK_STRING (ptr);
+	    MARK_INTERVAL_TREE (ptr->u.s.intervals);
+#ifdef GC_CHECK_STRING_BYTES
+	    /* Check that the string size recorded in the string is the
+	       same as the one recorded in the sdata structure.  */
+	    string_bytes (ptr);
+#endif /* GC_CHECK_STRING_BYTES */
+	  }
 	  break;
 
+	case Lisp_Vectorlike:
+	  {
+	    register struct Lisp_Vector *ptr = XVECTOR (obj);
+
+	    if (VECTOR_MARKED_P (ptr))
+	      break;
+
 #if GC_CHECK_MARKED_OBJECTS
-	m = mem_find (po);
-	if (m == MEM_NIL && !SUBRP (obj) && !main_thread_p (po))
-	  emacs_abort ();
+	    m = mem_find (po);
+	    if (m == MEM_NIL && !SUBRP (obj) && !main_thread_p (po))
+	      emacs_abort ();
 #endif /* GC_CHECK_MARKED_OBJECTS */
 
-        enum pvec_type pvectype
-          = PSEUDOVECTOR_TYPE (ptr);
+	    enum pvec_type pvectype
+	      = PSEUDOVECTOR_TYPE (ptr);
 
-	if (pvectype != PVEC_SUBR
-	    && pvectype != PVEC_BUFFER
-	    && !main_thread_p (po))
-	  CHECK_LIVE (live_vector_p);
+	    if (pvectype != PVEC_SUBR
+		&& pvectype != PVEC_BUFFER
+		&& !main_thread_p (po))
+	      CHECK_LIVE (live_vector_p);
 
-	switch (pvectype)
-	  {
-	  case PVEC_BUFFER:
+	    switch (pvectype)
+	      {
+	      case PVEC_BUFFER:
 #if GC_CHECK_MARKED_OBJECTS
-	    {
-	      struct buffer *b;
-	      FOR_EACH_BUFFER (b)
-		if (b == po)
-		  break;
-	      if (b == NULL)
-		emacs_abort ();
-	    }
+		{
+		  struct buffer *b;
+		  FOR_EACH_BUFFER (b)
+		    if (b == po)
+		      break;
+		  if (b == NULL)
+		    emacs_abort ();
+		}
 #endif /* GC_CHECK_MARKED_OBJECTS */
-	    mark_buffer ((struct buffer *) ptr);
-	    break;
-
-	  case PVEC_COMPILED:
-	    /* Although we could treat this just like a vector, mark_compiled
-	       returns the COMPILED_CONSTANTS element, which is marked at the
-	       next iteration of goto-loop here.  This is done to avoid a few
-	       recursive calls to mark_object.  */
-	    obj = mark_compiled (ptr);
-	    if (!NILP (obj))
-	      goto loop;
-	    break;
-
-	  case PVEC_FRAME:
-	    {
-	      struct frame *f = (struct frame *) ptr;
+		mark_buffer ((struct buffer *) ptr);
+		break;
 
-	      mark_vectorlike (ptr);
-	      mark_face_cache (f->face_cache);
-#ifdef HAVE_WINDOW_SYSTEM
-	      if (FRAME_WINDOW_P (f) && FRAME_X_OUTPUT (f))
+	      case PVEC_FRAME:
 		{
-		  struct font *font = FRAME_FONT (f);
+		  struct frame *f = (struct frame *) ptr;
 
-		  if (font && !VECTOR_MARKED_P (font))
-		    mark_vectorlike ((struct Lisp_Vector *) font);
-		}
+		  mark_vectorlike (ptr);
+		  mark_face_cache (f->face_cache);
+#ifdef HAVE_WINDOW_SYSTEM
+		  if (FRAME_WINDOW_P (f) && FRAME_X_OUTPUT (f))
+		    {
+		      struct font *font = FRAME_FONT (f);
+
+		      if (font && !VECTOR_MARKED_P (font))
+			mark_vectorlike ((struct Lisp_Vector *) font);
+		    }
 #endif
-	    }
-	    break;
+		}
+		break;
 
-	  case PVEC_WINDOW:
-	    {
-	      struct window *w = (struct window *) ptr;
+	      case PVEC_WINDOW:
+		{
+		  struct window *w = (struct window *) ptr;
 
-	      mark_vectorlike (ptr);
+		  mark_vectorlike (ptr);
 
-	      /* Mark glyph matrices, if any.  Marking window
-		 matrices is sufficient because frame matrices
-		 use the same glyph memory.  */
-	      if (w->current_matrix)
-		{
-		  mark_glyph_matrix (w->current_matrix);
-		  mark_glyph_matrix (w->desired_matrix);
-		}
+		  /* Mark glyph matrices, if any.  Marking window
+		     matrices is sufficient because frame matrices
+		     use the same glyph memory.  */
+		  if (w->current_matrix)
+		    {
+		      mark_glyph_matrix (w->current_matrix);
+		      mark_glyph_matrix (w->desired_matrix);
+		    }
 
-	      /* Filter out killed buffers from both buffer lists
-		 in attempt to help GC to reclaim killed buffers faster.
-		 We can do it elsewhere for live windows, but this is the
-		 best place to do it for dead windows.  */
-	      wset_prev_buffers
-		(w, mark_discard_killed_buffers (w->prev_buffers));
-	      wset_next_buffers
-		(w, mark_discard_killed_buffers (w->next_buffers));
-	    }
-	    break;
+		  /* Filter out killed buffers from both buffer lists
+		     in attempt to help GC to reclaim killed buffers faster.
+		     We can do it elsewhere for live windows, but this is the
+		     best place to do it for dead windows.  */
+		  wset_prev_buffers
+		    (w, mark_discard_killed_buffers (w->prev_buffers));
+		  wset_next_buffers
+		    (w, mark_discard_killed_buffers (w->next_buffers));
+		}
+		break;
 
-	  case PVEC_HASH_TABLE:
-	    {
-	      struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) ptr;
-
-	      mark_vectorlike (ptr);
-	      mark_object (h->test.name);
-	      mark_object (h->test.user_hash_function);
-	      mark_object (h->test.user_cmp_function);
-	      /* If hash table is not weak, mark all keys and values.
-		 For weak tables, mark only the vector.  */
-	      if (NILP (h->weak))
-		mark_object (h->key_and_value);
-	      else
-		VECTOR_MARK (XVECTOR (h->key_and_value));
-	    }
-	    break;
+	      case PVEC_HASH_TABLE:
+		{
+		  struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) ptr;
+
+		  mark_vectorlike (ptr);
+		  mark_stack_push_value (h->test.name);
+		  mark_stack_push_value (h->test.user_hash_function);
+		  mark_stack_push_value (h->test.user_cmp_function);
+		  /* If hash table is not weak, mark all keys and values.
+		     For weak tables, mark only the vector.  */
+		  if (NILP (h->weak))
+		    mark_stack_push_value (h->key_and_value);
+		  else
+		    VECTOR_MARK (XVECTOR (h->key_and_value));
+		}
+		break;
 
-	  case PVEC_CHAR_TABLE:
-	  case PVEC_SUB_CHAR_TABLE:
-	    mark_char_table (ptr, (enum pvec_type) pvectype);
-	    break;
+	      case PVEC_CHAR_TABLE:
+	      case PVEC_SUB_CHAR_TABLE:
+		mark_char_table (ptr, (enum pvec_type) pvectype);
+		break;
 
-	  case PVEC_OVERLAY:
-	    mark_overlay (XOVERLAY (obj));
-	    break;
+	      case PVEC_OVERLAY:
+		mark_overlay (XOVERLAY (obj));
+		break;
 
-	  case PVEC_SUBR:
-	    break;
+	      case PVEC_SUBR:
+		break;
 
-	  case PVEC_FREE:
-	    emacs_abort ();
+	      case PVEC_FREE:
+		emacs_abort ();
 
-	  default:
-	    /* A regular vector, or a pseudovector needing no special
-	       treatment.  */
-	    mark_vectorlike (ptr);
+	      default:
+		/* A regular vector, or a pseudovector needing no special
+		   treatment.  Compiled functions are treated this way
+		   too.  */
+		{
+		  ptrdiff_t size = ptr->header.size;
+		  if (size & PSEUDOVECTOR_FLAG)
+		    size &= PSEUDOVECTOR_SIZE_MASK;
+		  VECTOR_MARK (ptr);
+		  mark_stack_push_values (ptr->contents, size);
+		}
+	      }
 	  }
-      }
-      break;
-
-    case Lisp_Symbol:
-      {
-	struct Lisp_Symbol *ptr = XSYMBOL (obj);
-      nextsym:
-	if (ptr->u.s.gcmarkbit)
 	  break;
-	CHECK_ALLOCATED_AND_LIVE_SYMBOL ();
-	ptr->u.s.gcmarkbit = 1;
-	/* Attempt to catch bogus objects.  */
-	eassert (valid_lisp_object_p (ptr->u.s.function));
-	mark_object (ptr->u.s.function);
-	mark_object (ptr->u.s.plist);
-	switch (ptr->u.s.redirect)
+
+	case Lisp_Symbol:
 	  {
-	  case SYMBOL_PLAINVAL: mark_object (SYMBOL_VAL (ptr)); break;
-	  case SYMBOL_VARALIAS:
-	    {
-	      Lisp_Object tem;
-	      XSETSYMBOL (tem, SYMBOL_ALIAS (ptr));
-	      mark_object (tem);
+	    struct Lisp_Symbol *ptr = XSYMBOL (obj);
+	  nextsym:
+	    if (ptr->u.s.gcmarkbit)
 	      break;
-	    }
-	  case SYMBOL_LOCALIZED:
-	    mark_localized_symbol (ptr);
-	    break;
-	  case SYMBOL_FORWARDED:
-	    /* If the value is forwarded to a buffer or keyboard field,
-	       these are marked when we see the corresponding object.
-	       And if it's forwarded to a C variable, either it's not
-	       a Lisp_Object var, or it's staticpro'd already.  */
-	    break;
-	  default: emacs_abort ();
+	    CHECK_ALLOCATED_AND_LIVE_SYMBOL ();
+	    ptr->u.s.gcmarkbit = 1;
+	    /* Attempt to catch bogus objects.  */
+	    eassert (valid_lisp_object_p (ptr->u.s.function));
+	    mark_stack_push_value (ptr->u.s.function);
+	    mark_stack_push_value (ptr->u.s.plist);
+	    switch (ptr->u.s.redirect)
+	      {
+	      case SYMBOL_PLAINVAL:
+		mark_stack_push_value (SYMBOL_VAL (ptr));
+		break;
+	      case SYMBOL_VARALIAS:
+		{
+		  Lisp_Object tem;
+		  XSETSYMBOL (tem, SYMBOL_ALIAS (ptr));
+		  mark_stack_push_value (tem);
+		  break;
+		}
+	      case SYMBOL_LOCALIZED:
+		mark_localized_symbol (ptr);
+		break;
+	      case SYMBOL_FORWARDED:
+		/* If the value is forwarded to a buffer or keyboard field,
+		   these are marked when we see the corresponding object.
+		   And if it's forwarded to a C variable, either it's not
+		   a Lisp_Object var, or it's staticpro'd already.  */
+		break;
+	      default: emacs_abort ();
+	      }
+	    if (!PURE_P (XSTRING (ptr->u.s.name)))
+	      MARK_STRING (XSTRING (ptr->u.s.name));
+	    MARK_INTERVAL_TREE (string_intervals (ptr->u.s.name));
+	    /* Inner loop to mark next symbol in this bucket, if any.  */
+	    po = ptr = ptr->u.s.next;
+	    if (ptr)
+	      goto nextsym;
 	  }
-	if (!PURE_P (XSTRING (ptr->u.s.name)))
-	  MARK_STRING (XSTRING (ptr->u.s.name));
-	MARK_INTERVAL_TREE (string_intervals (ptr->u.s.name));
-	/* Inner loop to mark next symbol in this bucket, if any.  */
-	po = ptr = ptr->u.s.next;
-	if (ptr)
-	  goto nextsym;
-      }
-      break;
-
-    case Lisp_Cons:
-      {
-	struct Lisp_Cons *ptr = XCONS (obj);
-	if (CONS_MARKED_P (ptr))
 	  break;
-	CHECK_ALLOCATED_AND_LIVE (live_cons_p);
-	CONS_MARK (ptr);
-	/* If the cdr is nil, avoid recursion for the car.  */
-	if (NILP (ptr->u.s.u.cdr))
+
+	case Lisp_Cons:
 	  {
+	    struct Lisp_Cons *ptr = XCONS (obj);
+	    if (CONS_MARKED_P (ptr))
+	      break;
+	    CHECK_ALLOCATED_AND_LIVE (live_cons_p);
+	    CONS_MARK (ptr);
+	    /* Leave the cdr for later, unless it is nil, and go on
+	       with the car right away.  Walking down a list therefore
+	       keeps the mark stack from growing.  */
+	    if (!NILP (ptr->u.s.u.cdr))
+	      {
+		mark_stack_push_value (ptr->u.s.u.cdr);
+		cdr_count++;
+		if (cdr_count == mark_object_loop_halt)
+		  emacs_abort ();
+	      }
 	    obj = ptr->u.s.car;
-	    cdr_count = 0;
 	    goto loop;
 	  }
-	mark_object (ptr->u.s.car);
-	obj = ptr->u.s.u.cdr;
-	cdr_count++;
-	if (cdr_count == mark_object_loop_halt)
-	  emacs_abort ();
-	goto loop;
-      }
 
-    case Lisp_Float:
-      CHECK_ALLOCATED_AND_LIVE (live_float_p);
-      FLOAT_MARK (XFLOAT (obj));
-      break;
+	case Lisp_Float:
+	  CHECK_ALLOCATED_AND_LIVE (live_float_p);
+	  FLOAT_MARK (XFLOAT (obj));
+	  break;
 
-    case_Lisp_Int:
-      break;
+	case_Lisp_Int:
+	  break;
 
-    default:
-      emacs_abort ();
+	default:
+	  emacs_abort ();
+	}
     }
 
 #undef CHECK_LIVE
 #undef CHECK_ALLOCATED
 #undef CHECK_ALLOCATED_AND_LIVE
+#undef CHECK_ALLOCATED_AND_LIVE_SYMBOL
+}
+
+/* Mark VALUE and everything reachable from it, when the mark stack
+   is full and cannot grow.  Use a mark stack on the C stack meanwhile;
+   if that fills up too, this is called again for the next level.  */
+
+NO_INLINE static void
+mark_object_recursively (Lisp_Object value)
+{
+  struct mark_entry entries[64];
+  struct mark_stack saved = mark_stk;
+  mark_stk.stack = entries;
+  mark_stk.size = ARRAYELTS (entries);
+  mark_stk.sp = 0;
+  mark_stk.on_c_stack = true;
+  mark_stack_push_value (value);
+  process_mark_stack (0);
+  mark_stk = saved;
+}
+
+/* Mark ARG and everything reachable from it.  */
+
+void
+mark_object (Lisp_Object arg)
+{
+  ptrdiff_t sp = mark_stk.sp;
+  mark_stack_push_value (arg);
+  if (heap_snapshot && !heap_snapshot_nested)
+    {
+      heap_snapshot_root (arg);
+      heap_snapshot_nested = true;
+      process_mark_stack (sp);
+      heap_snapshot_nested = false;
+    }
+  else
+    process_mark_stack (sp);
 }
+
 /* Mark the Lisp pointers in the terminal objects.
    Called by Fgarbage_collect.  */
 
@@ -6514,6 +7193,8 @@ mark_terminals (void)
 	 gets marked.  */
       mark_image_cache (t->image_cache);
 #endif /* HAVE_WINDOW_SYSTEM */
+      if (heap_snapshot)
+	heap_snapshot_root (make_lisp_ptr (t, Lisp_Vectorlike));
       if (!VECTOR_MARKED_P (t))
 	mark_vectorlike ((struct Lisp_Vector *)t);
     }
@@ -6565,6 +7246,92 @@ survives_gc_p (Lisp_Object obj)
 
 
 
+/* Lazy sweeping.  If `gc-lazy-sweep' is non-nil, sweep_conses and
+   sweep_floats merely count the marked objects and leave the blocks
+   as they are.  Fcons and make_float then sweep one block at a time
+   whenever their free list runs dry, and whatever is still unswept
+   when the next GC starts is swept by finish_lazy_sweep before
+   anything is marked, so the mark bits are always clear by then.
+
+   Only blocks that existed at the time of the GC are swept lazily.
+   Blocks allocated since are added at the front of the block list,
+   ahead of cons_sweep_block and float_sweep_block, and the part of
+   the then current block beyond cons_sweep_lim or float_sweep_lim
+   was not in use, so nothing is swept twice.  */
+
+/* Return the number of marked objects recorded in the N words of
+   mark bits starting at BITS.  */
+
+static EMACS_INT
+count_mark_bits (bits_word const *bits, int n)
+{
+  verify (BITS_WORD_MAX <= ULLONG_MAX);
+  EMACS_INT count = 0;
+  for (int i = 0; i < n; i++)
+    count += count_one_bits_ll (bits[i]);
+  return count;
+}
+
+/* Sweep the first LIM conses of CBLK: put the unmarked ones on the
+   free list and unmark the others.  Return the number of conses
+   freed.  */
+
+static int
+sweep_cons_block (struct cons_block *cblk, int lim)
+{
+  int this_free = 0;
+  int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+
+  /* Scan the mark bits an int at a time.  */
+  for (int i = 0; i < ilim; i++)
+    {
+      if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
+	{
+	  /* Fast path - all cons cells for this int are marked.  */
+	  cblk->gcmarkbits[i] = 0;
+	}
+      else
+	{
+	  /* Some cons cells for this int are not marked.
+	     Find which ones, and free them.  */
+	  int start, pos, stop;
+
+	  start = i * BITS_PER_BITS_WORD;
+	  stop = lim - start;
+	  if (stop > BITS_PER_BITS_WORD)
+	    stop = BITS_PER_BITS_WORD;
+	  stop += start;
+
+	  for (pos = start; pos < stop; pos++)
+	    {
+	      struct Lisp_Cons *acons
+		= ptr_bounds_copy (&cblk->conses[pos], cblk);
+	      if (!CONS_MARKED_P (acons))
+		{
+		  this_free++;
+		  cblk->conses[pos].u.s.u.chain = cons_free_list;
+		  cons_free_list = &cblk->conses[pos];
+		  cons_free_list->u.s.car = Vdead;
+		}
+	      else
+		CONS_UNMARK (acons);
+	    }
+	}
+    }
+  return this_free;
+}
+
+/* Sweep the next cons block left unswept by the last GC.  */
+
+static void
+lazy_sweep_cons_block (void)
+{
+  struct cons_block *cblk = cons_sweep_block;
+  sweep_cons_block (cblk, cons_sweep_lim);
+  cons_sweep_block = cblk->next;
+  cons_sweep_lim = CONS_BLOCK_SIZE;
+}
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_conses (void)
@@ -6576,72 +7343,75 @@ sweep_conses (void)
 
   cons_free_list = 0;
 
-  for (cblk = cons_block; cblk; cblk = *cprev)
+  if (gc_lazy_sweep)
     {
-      int i = 0;
-      int this_free = 0;
-      int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
-
-      /* Scan the mark bits an int at a time.  */
-      for (i = 0; i < ilim; i++)
-        {
-          if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
-            {
-              /* Fast path - all cons cells for this int are marked.  */
-              cblk->gcmarkbits[i] = 0;
-              num_used += BITS_PER_BITS_WORD;
-            }
-          else
-            {
-              /* Some cons cells for this int are not marked.
-                 Find which ones, and free them.  */
-              int start, pos, stop;
-
-              start = i * BITS_PER_BITS_WORD;
-              stop = lim - start;
-              if (stop > BITS_PER_BITS_WORD)
-                stop = BITS_PER_BITS_WORD;
-              stop += start;
+      for (cblk = cons_block; cblk; cblk = cblk->next)
+	{
+	  EMACS_INT this_used
+	    = count_mark_bits (cblk->gcmarkbits, ARRAYELTS (cblk->gcmarkbits));
+	  num_used += this_used;
+	  num_free += lim - this_used;
+	  lim = CONS_BLOCK_SIZE;
+	}
+      cons_sweep_block = cons_block;
+      cons_sweep_lim = cons_block_index;
+    }
+  else
+    for (cblk = cons_block; cblk; cblk = *cprev)
+      {
+	int this_free = sweep_cons_block (cblk, lim);
+	num_used += lim - this_free;
+	lim = CONS_BLOCK_SIZE;
+	/* If this block contains only free conses and we have already
+	   seen more than two blocks worth of free conses then deallocate
+	   this block.  */
+	if (this_free == CONS_BLOCK_SIZE && num_free > CONS_BLOCK_SIZE)
+	  {
+	    *cprev = cblk->next;
+	    /* Unhook from the free list.  */
+	    cons_free_list = cblk->conses[0].u.s.u.chain;
+	    lisp_align_free (cblk);
+	  }
+	else
+	  {
+	    num_free += this_free;
+	    cprev = &cblk->next;
+	  }
+      }
+  total_conses = num_used;
+  total_free_conses = num_free;
+}
 
-              for (pos = start; pos < stop; pos++)
-                {
-		  struct Lisp_Cons *acons
-		    = ptr_bounds_copy (&cblk->conses[pos], cblk);
-		  if (!CONS_MARKED_P (acons))
-                    {
-                      this_free++;
-                      cblk->conses[pos].u.s.u.chain = cons_free_list;
-                      cons_free_list = &cblk->conses[pos];
-                      cons_free_list->u.s.car = Vdead;
-                    }
-                  else
-                    {
-                      num_used++;
-		      CONS_UNMARK (acons);
-                    }
-                }
-            }
-        }
+/* Like sweep_cons_block, for floats.  */
 
-      lim = CONS_BLOCK_SIZE;
-      /* If this block contains only free conses and we have already
-         seen more than two blocks worth of free conses then deallocate
-         this block.  */
-      if (this_free == CONS_BLOCK_SIZE && num_free > CONS_BLOCK_SIZE)
-        {
-          *cprev = cblk->next;
-          /* Unhook from the free list.  */
-          cons_free_list = cblk->conses[0].u.s.u.chain;
-          lisp_align_free (cblk);
-        }
+static int
+sweep_float_block (struct float_block *fblk, int lim)
+{
+  int this_free = 0;
+  for (int i = 0; i < lim; i++)
+    {
+      struct Lisp_Float *afloat = ptr_bounds_copy (&fblk->floats[i], fblk);
+      if (!FLOAT_MARKED_P (afloat))
+	{
+	  this_free++;
+	  fblk->floats[i].u.chain = float_free_list;
+	  float_free_list = &fblk->floats[i];
+	}
       else
-        {
-          num_free += this_free;
-          cprev = &cblk->next;
-        }
+	FLOAT_UNMARK (afloat);
     }
-  total_conses = num_used;
-  total_free_conses = num_free;
+  return this_free;
+}
+
+/* Sweep the next float block left unswept by the last GC.  */
+
+static void
+lazy_sweep_float_block (void)
+{
+  struct float_block *fblk = float_sweep_block;
+  sweep_float_block (fblk, float_sweep_lim);
+  float_sweep_block = fblk->next;
+  float_sweep_lim = FLOAT_BLOCK_SIZE;
 }
 
 NO_INLINE /* For better stack traces */
@@ -6655,46 +7425,103 @@ sweep_floats (void)
 
   float_free_list = 0;
 
-  for (fblk = float_block; fblk; fblk = *fprev)
+  if (gc_lazy_sweep)
     {
-      register int i;
-      int this_free = 0;
-      for (i = 0; i < lim; i++)
+      for (fblk = float_block; fblk; fblk = fblk->next)
 	{
-	  struct Lisp_Float *afloat = ptr_bounds_copy (&fblk->floats[i], fblk);
-	  if (!FLOAT_MARKED_P (afloat))
-	    {
-	      this_free++;
-	      fblk->floats[i].u.chain = float_free_list;
-	      float_free_list = &fblk->floats[i];
-	    }
-	  else
-	    {
-	      num_used++;
-	      FLOAT_UNMARK (afloat);
-	    }
+	  EMACS_INT this_used
+	    = count_mark_bits (fblk->gcmarkbits, ARRAYELTS (fblk->gcmarkbits));
+	  num_used += this_used;
+	  num_free += lim - this_used;
+	  lim = FLOAT_BLOCK_SIZE;
 	}
-      lim = FLOAT_BLOCK_SIZE;
-      /* If this block contains only free floats and we have already
-         seen more than two blocks worth of free floats then deallocate
-         this block.  */
-      if (this_free == FLOAT_BLOCK_SIZE && num_free > FLOAT_BLOCK_SIZE)
-        {
-          *fprev = fblk->next;
-          /* Unhook from the free list.  */
-          float_free_list = fblk->floats[0].u.chain;
-          lisp_align_free (fblk);
-        }
-      else
-        {
-          num_free += this_free;
-          fprev = &fblk->next;
-        }
+      float_sweep_block = float_block;
+      float_sweep_lim = float_block_index;
     }
+  else
+    for (fblk = float_block; fblk; fblk = *fprev)
+      {
+	int this_free = sweep_float_block (fblk, lim);
+	num_used += lim - this_free;
+	lim = FLOAT_BLOCK_SIZE;
+	/* If this block contains only free floats and we have already
+	   seen more than two blocks worth of free floats then deallocate
+	   this block.  */
+	if (this_free == FLOAT_BLOCK_SIZE && num_free > FLOAT_BLOCK_SIZE)
+	  {
+	    *fprev = fblk->next;
+	    /* Unhook from the free list.  */
+	    float_free_list = fblk->floats[0].u.chain;
+	    lisp_align_free (fblk);
+	  }
+	else
+	  {
+	    num_free += this_free;
+	    fprev = &fblk->next;
+	  }
+      }
   total_floats = num_used;
   total_free_floats = num_free;
 }
 
+/* Sweep the cons and float blocks that the allocator has not swept
+   since the last GC, freeing those that turn out to be entirely free
+   as sweep_conses and sweep_floats would.  */
+
+static void
+finish_lazy_sweep (void)
+{
+  EMACS_INT num_free = 0;
+  struct cons_block **cprev = &cons_block;
+  while (*cprev != cons_sweep_block)
+    cprev = &(*cprev)->next;
+  while (cons_sweep_block)
+    {
+      struct cons_block *cblk = cons_sweep_block;
+      int this_free = sweep_cons_block (cblk, cons_sweep_lim);
+      cons_sweep_block = cblk->next;
+      cons_sweep_lim = CONS_BLOCK_SIZE;
+      if (this_free == CONS_BLOCK_SIZE && num_free > CONS_BLOCK_SIZE)
+	{
+	  *cprev = cblk->next;
+	  /* Unhook from the free list.  */
+	  cons_free_list = cblk->conses[0].u.s.u.chain;
+	  lisp_align_free (cblk);
+	  total_free_conses -= CONS_BLOCK_SIZE;
+	}
+      else
+	{
+	  num_free += this_free;
+	  cprev = &cblk->next;
+	}
+    }
+
+  num_free = 0;
+  struct float_block **fprev = &float_block;
+  while (*fprev != float_sweep_block)
+    fprev = &(*fprev)->next;
+  while (float_sweep_block)
+    {
+      struct float_block *fblk = float_sweep_block;
+      int this_free = sweep_float_block (fblk, float_sweep_lim);
+      float_sweep_block = fblk->next;
+      float_sweep_lim = FLOAT_BLOCK_SIZE;
+      if (this_free == FLOAT_BLOCK_SIZE && num_free > FLOAT_BLOCK_SIZE)
+	{
+	  *fprev = fblk->next;
+	  /* Unhook from the free list.  */
+	  float_free_list = fblk->floats[0].u.chain;
+	  lisp_align_free (fblk);
+	  total_free_floats -= FLOAT_BLOCK_SIZE;
+	}
+      else
+	{
+	  num_free += this_free;
+	  fprev = &fblk->next;
+	}
+    }
+}
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_intervals (void)
@@ -6856,6 +7683,364 @@ sweep_buffers (void)
       }
 }
 
+/* The targets of the references from the object being written to a
+   heap snapshot.  This array must not be grown with xpalloc, which
+   signals when out of memory: the snapshot is written during GC.
+   References that do not fit are left out instead, and
+   snapshot_incomplete is set.  */
+
+static uintptr_t *snapshot_edges;
+static ptrdiff_t snapshot_nedges, snapshot_edges_size;
+
+/* Record a reference to OBJ from the object being written, as a weak
+   reference if WEAK.  */
+
+static void
+snapshot_edge (Lisp_Object obj, bool weak)
+{
+  if (!heap_snapshot_object_p (obj))
+    return;
+  if (snapshot_nedges == snapshot_edges_size)
+    {
+      ptrdiff_t size;
+      size_t nbytes;
+      uintptr_t *edges = NULL;
+      if (!INT_MULTIPLY_WRAPV (max (snapshot_edges_size, 64), 2, &size)
+	  && !INT_MULTIPLY_WRAPV (size, sizeof *snapshot_edges, &nbytes))
+	{
+	  MALLOC_BLOCK_INPUT;
+	  edges = realloc (snapshot_edges, nbytes);
+	  MALLOC_UNBLOCK_INPUT;
+	}
+      if (!edges)
+	{
+	  snapshot_incomplete = true;
+	  return;
+	}
+      snapshot_edges = edges;
+      snapshot_edges_size = size;
+    }
+  snapshot_edges[snapshot_nedges++] = (uintptr_t) XPNTR (obj) | weak;
+}
+
+/* Write the object at P, of type TYPE and SIZE bytes, along with the
+   references recorded for it so far.  */
+
+static void
+snapshot_node (int type, void *p, uintmax_t size)
+{
+  putc ('n', heap_snapshot);
+  putc (type, heap_snapshot);
+  heap_snapshot_uint ((uintptr_t) p);
+  heap_snapshot_uint (size);
+  heap_snapshot_uint (snapshot_nedges);
+  for (ptrdiff_t i = 0; i < snapshot_nedges; i++)
+    heap_snapshot_uint (snapshot_edges[i]);
+  snapshot_nedges = 0;
+}
+
+/* Count interval I, whose owner is being written, as part of the
+   owner's size, which is at SIZE.  */
+
+static void
+snapshot_interval (INTERVAL i, void *size)
+{
+  *(uintmax_t *) size += sizeof *i;
+  snapshot_edge (i->plist, false);
+}
+
+/* Record the Lisp_Object fields of V, starting with the FROMth.  */
+
+static void
+snapshot_vector_contents (struct Lisp_Vector *v, ptrdiff_t from, bool weak)
+{
+  ptrdiff_t size = v->header.size & ~ARRAY_MARK_FLAG;
+  if (size & PSEUDOVECTOR_FLAG)
+    size &= PSEUDOVECTOR_SIZE_MASK;
+  for (ptrdiff_t i = from; i < size; i++)
+    snapshot_edge (v->contents[i], weak);
+}
+
+static void
+snapshot_glyph_matrix (struct glyph_matrix *matrix)
+{
+  struct glyph_row *row = matrix->rows;
+  struct glyph_row *end = row + matrix->nrows;
+
+  for (; row < end; ++row)
+    if (row->enabled_p)
+      for (int area = LEFT_MARGIN_AREA; area < LAST_AREA; ++area)
+	{
+	  struct glyph *glyph = row->glyphs[area];
+	  struct glyph *end_glyph = glyph + row->used[area];
+
+	  for (; glyph < end_glyph; ++glyph)
+	    if (STRINGP (glyph->object))
+	      snapshot_edge (glyph->object, false);
+	}
+}
+
+/* Write the vectorlike object V to the heap snapshot.  This follows
+   the references that process_mark_stack follows.  */
+
+static void
+snapshot_vector (struct Lisp_Vector *v)
+{
+  enum pvec_type pvectype = PSEUDOVECTOR_TYPE (v);
+  uintmax_t size = vector_nbytes (v);
+
+  switch (pvectype)
+    {
+    case PVEC_BUFFER:
+      {
+	struct buffer *b = (struct buffer *) v;
+
+	size = sizeof *b;
+	if (!b->base_buffer && b->text->beg)
+	  size += BUF_Z_BYTE (b) - BUF_BEG_BYTE (b) + BUF_GAP_SIZE (b);
+	snapshot_vector_contents (v, 0, false);
+	snapshot_edge (BVAR (b, undo_list), false);
+	traverse_intervals_noorder (buffer_intervals (b), snapshot_interval,
+				    &size);
+	for (struct Lisp_Overlay *ov = b->overlays_before; ov; ov = ov->next)
+	  snapshot_edge (make_lisp_ptr (ov, Lisp_Vectorlike), false);
+	for (struct Lisp_Overlay *ov = b->overlays_after; ov; ov = ov->next)
+	  snapshot_edge (make_lisp_ptr (ov, Lisp_Vectorlike), false);
+	if (b->base_buffer)
+	  snapshot_edge (make_lisp_ptr (b->base_buffer, Lisp_Vectorlike),
+			 false);
+      }
+      break;
+
+    case PVEC_FRAME:
+      {
+	struct frame *f = (struct frame *) v;
+	struct face_cache *c = f->face_cache;
+
+	snapshot_vector_contents (v, 0, false);
+	for (int i = 0; c && i < c->used; i++)
+	  {
+	    struct face *face = FACE_FROM_ID_OR_NULL (c->f, i);
+	    if (face)
+	      {
+		if (face->font)
+		  snapshot_edge (make_lisp_ptr (face->font, Lisp_Vectorlike),
+				 false);
+		for (int j = 0; j < LFACE_VECTOR_SIZE; j++)
+		  snapshot_edge (face->lface[j], false);
+	      }
+	  }
+#ifdef HAVE_WINDOW_SYSTEM
+	if (FRAME_WINDOW_P (f) && FRAME_X_OUTPUT (f) && FRAME_FONT (f))
+	  snapshot_edge (make_lisp_ptr (FRAME_FONT (f), Lisp_Vectorlike),
+			 false);
+#endif
+      }
+      break;
+
+    case PVEC_WINDOW:
+      {
+	struct window *w = (struct window *) v;
+
+	snapshot_vector_contents (v, 0, false);
+	if (w->current_matrix)
+	  {
+	    snapshot_glyph_matrix (w->current_matrix);
+	    snapshot_glyph_matrix (w->desired_matrix);
+	  }
+      }
+      break;
+
+    case PVEC_HASH_TABLE:
+      {
+	struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) v;
+
+	snapshot_vector_contents (v, 0, false);
+	snapshot_edge (h->test.name, false);
+	snapshot_edge (h->test.user_hash_function, false);
+	snapshot_edge (h->test.user_cmp_function, false);
+	snapshot_edge (h->key_and_value, false);
+      }
+      break;
+
+    case PVEC_SUB_CHAR_TABLE:
+      snapshot_vector_contents (v, SUB_CHAR_TABLE_OFFSET, false);
+      break;
+
+    default:
+      snapshot_vector_contents (v, 0, false);
+    }
+
+  snapshot_node (HEAP_SNAPSHOT_VECTORLIKE + pvectype, v, size);
+}
+
+/* Write the key_and_value vector of V, if V is a weak hash table, with
+   weak references.  write_heap_snapshot does this before writing the
+   other vectors, so unmark it meanwhile so that it is not written
+   again; snapshot_remark_weak_table marks it again afterwards.  */
+
+static void
+snapshot_weak_table (struct Lisp_Vector *v)
+{
+  if (PSEUDOVECTOR_TYPEP (&v->header, PVEC_HASH_TABLE))
+    {
+      struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) v;
+      struct Lisp_Vector *kv = XVECTOR (h->key_and_value);
+
+      if (!NILP (h->weak) && VECTOR_MARKED_P (kv))
+	{
+	  snapshot_vector_contents (kv, 0, true);
+	  snapshot_node (HEAP_SNAPSHOT_VECTORLIKE + PVEC_NORMAL_VECTOR,
+			 kv, vector_nbytes (kv));
+	  VECTOR_UNMARK (kv);
+	}
+    }
+}
+
+static void
+snapshot_remark_weak_table (struct Lisp_Vector *v)
+{
+  if (PSEUDOVECTOR_TYPEP (&v->header, PVEC_HASH_TABLE))
+    {
+      struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) v;
+      if (!NILP (h->weak))
+	VECTOR_MARK (XVECTOR (h->key_and_value));
+    }
+}
+
+/* Call FN on each marked vector in vector blocks and large vectors.  */
+
+static void
+for_each_marked_vector (void (*fn) (struct Lisp_Vector *))
+{
+  for (struct vector_block *block = vector_blocks; block; block = block->next)
+    for (struct Lisp_Vector *vector = (struct Lisp_Vector *) block->data;
+	 VECTOR_IN_BLOCK (vector, block);
+	 vector = ADVANCE (vector, vector_nbytes (vector)))
+      if (VECTOR_MARKED_P (vector))
+	fn (vector);
+
+  for (struct large_vector *lv = large_vectors; lv; lv = lv->next)
+    {
+      struct Lisp_Vector *vector = large_vector_vec (lv);
+      if (VECTOR_MARKED_P (vector))
+	fn (vector);
+    }
+}
+
+static void
+snapshot_symbol (struct Lisp_Symbol *sym)
+{
+  uintmax_t size = sizeof *sym;
+
+  snapshot_edge (sym->u.s.name, false);
+  snapshot_edge (sym->u.s.function, false);
+  snapshot_edge (sym->u.s.plist, false);
+  switch (sym->u.s.redirect)
+    {
+    case SYMBOL_PLAINVAL:
+      snapshot_edge (SYMBOL_VAL (sym), false);
+      break;
+    case SYMBOL_VARALIAS:
+      snapshot_edge (make_lisp_symbol (SYMBOL_ALIAS (sym)), false);
+      break;
+    case SYMBOL_LOCALIZED:
+      {
+	struct Lisp_Buffer_Local_Value *blv = SYMBOL_BLV (sym);
+	size += sizeof *blv;
+	snapshot_edge (blv->where, false);
+	snapshot_edge (blv->valcell, false);
+	snapshot_edge (blv->defcell, false);
+      }
+      break;
+    case SYMBOL_FORWARDED:
+      break;
+    default: emacs_abort ();
+    }
+  if (sym->u.s.next)
+    snapshot_edge (make_lisp_symbol (sym->u.s.next), false);
+  snapshot_node (HEAP_SNAPSHOT_SYMBOL, sym, size);
+}
+
+/* Write every marked object to the heap snapshot.  This is called
+   after marking is complete, and after weak hash tables are swept so
+   that they hold only entries that survive.  */
+
+static void
+write_heap_snapshot (void)
+{
+  snapshot_nedges = 0;
+
+  for_each_marked_vector (snapshot_weak_table);
+  for_each_marked_vector (snapshot_vector);
+  for_each_marked_vector (snapshot_remark_weak_table);
+
+  for (struct buffer *b = all_buffers; b; b = b->next)
+    if (VECTOR_MARKED_P (b))
+      snapshot_vector ((struct Lisp_Vector *) b);
+
+  for (int i = 0; i < ARRAYELTS (lispsym); i++)
+    if (lispsym[i].u.s.gcmarkbit)
+      snapshot_symbol (&lispsym[i]);
+
+  int lim = symbol_block_index;
+  for (struct symbol_block *sblk = symbol_block; sblk; sblk = sblk->next)
+    {
+      for (int i = 0; i < lim; i++)
+	if (sblk->symbols[i].u.s.gcmarkbit)
+	  snapshot_symbol (&sblk->symbols[i]);
+      lim = SYMBOL_BLOCK_SIZE;
+    }
+
+  lim = cons_block_index;
+  for (struct cons_block *cblk = cons_block; cblk; cblk = cblk->next)
+    {
+      for (int i = 0; i < lim; i++)
+	{
+	  struct Lisp_Cons *c = &cblk->conses[i];
+	  if (CONS_MARKED_P (c))
+	    {
+	      snapshot_edge (c->u.s.car, false);
+	      snapshot_edge (c->u.s.u.cdr, false);
+	      snapshot_node (HEAP_SNAPSHOT_CONS, c, sizeof *c);
+	    }
+	}
+      lim = CONS_BLOCK_SIZE;
+    }
+
+  lim = float_block_index;
+  for (struct float_block *fblk = float_block; fblk; fblk = fblk->next)
+    {
+      for (int i = 0; i < lim; i++)
+	if (FLOAT_MARKED_P (&fblk->floats[i]))
+	  snapshot_node (HEAP_SNAPSHOT_FLOAT, &fblk->floats[i],
+			 sizeof fblk->floats[i]);
+      lim = FLOAT_BLOCK_SIZE;
+    }
+
+  for (struct string_block *b = string_blocks; b; b = b->next)
+    for (int i = 0; i < STRING_BLOCK_SIZE; i++)
+      {
+	struct Lisp_String *s = &b->strings[i];
+	if (s->u.s.data && STRING_MARKED_P (s))
+	  {
+	    ptrdiff_t nbytes = (s->u.s.size_byte < 0
+				? s->u.s.size & ~ARRAY_MARK_FLAG
+				: s->u.s.size_byte);
+	    uintmax_t size = sizeof *s + SDATA_SIZE (nbytes);
+	    traverse_intervals_noorder (s->u.s.intervals, snapshot_interval,
+					&size);
+	    snapshot_node (HEAP_SNAPSHOT_STRING, s, size);
+	  }
+      }
+
+  putc ('z', heap_snapshot);
+
+  free (snapshot_edges);
+  snapshot_edges = NULL;
+  snapshot_edges_size = 0;
+}
+
 /* Sweep: find all structures not marked, and free them.  */
 static void
 gc_sweep (void)
@@ -6863,9 +8048,20 @@ gc_sweep (void)
   /* Remove or mark entries in weak hash tables.
      This must be done before any object is unmarked.  */
   sweep_weak_hash_tables ();
+  gc_phase_done (GC_PHASE_WEAK);
+
+  if (heap_snapshot)
+    {
+      write_heap_snapshot ();
+      /* A collection started by a finalizer or by post-gc-hook must
+	 not append another graph to the snapshot.  */
+      heap_snapshot = NULL;
+      gc_phase_done (GC_PHASE_SNAPSHOT);
+    }
 
   sweep_strings ();
   check_string_bytes (!noninteractive);
+  gc_phase_done (GC_PHASE_STRINGS);
   sweep_conses ();
   sweep_floats ();
   sweep_intervals ();
@@ -6873,8 +8069,155 @@ gc_sweep (void)
   sweep_buffers ();
   sweep_vectors ();
   check_string_bytes (!noninteractive);
+  trim_mark_stack ();
+  gc_phase_done (GC_PHASE_SWEEP);
+
+  size_t *live = gc_record->live;
+  live[GC_LIVE_CONSES] = total_conses * sizeof (struct Lisp_Cons);
+  live[GC_LIVE_SYMBOLS] = total_symbols * sizeof (struct Lisp_Symbol);
+  live[GC_LIVE_STRINGS] = total_strings * sizeof (struct Lisp_String);
+  live[GC_LIVE_STRING_BYTES] = total_string_bytes;
+  live[GC_LIVE_VECTOR_SLOTS] = total_vector_slots * word_size;
+  live[GC_LIVE_FLOATS] = total_floats * sizeof (struct Lisp_Float);
+  live[GC_LIVE_INTERVALS] = total_intervals * sizeof (struct interval);
+  live[GC_LIVE_BUFFERS] = total_buffers * sizeof (struct buffer);
+
+  size_t *free_space = gc_record->free_space;
+  free_space[GC_LIVE_CONSES] = total_free_conses * sizeof (struct Lisp_Cons);
+  free_space[GC_LIVE_SYMBOLS]
+    = total_free_symbols * sizeof (struct Lisp_Symbol);
+  free_space[GC_LIVE_STRINGS]
+    = total_free_strings * sizeof (struct Lisp_String);
+  free_space[GC_LIVE_VECTOR_SLOTS] = total_free_vector_slots * word_size;
+  free_space[GC_LIVE_FLOATS]
+    = total_free_floats * sizeof (struct Lisp_Float);
+  free_space[GC_LIVE_INTERVALS]
+    = total_free_intervals * sizeof (struct interval);
+
+#ifdef HAVE_MALLOC_TRIM
+  /* Freeing blocks only gives them back to malloc, which usually
+     keeps them.  Ask it to give them to the system.  */
+  if (gc_release_memory && gc_freed_memory)
+    {
+      malloc_trim (0);
+      gc_phase_done (GC_PHASE_RELEASE);
+    }
+#endif
+  gc_freed_memory = false;
+}
+
+DEFUN ("gc-statistics", Fgc_statistics, Sgc_statistics, 0, 0, 0,
+       doc: /* Return statistics about recent garbage collections.
+The value is a list with one element for each of the most recent
+garbage collections, up to 64 of them, most recent first.  Each element
+is an alist with the following entries:
+
+- (start . SECONDS): when the collection started, in seconds of a
+  clock that is not affected by changes to the system time, and
+  whose origin is unspecified.  Only differences between these values
+  are meaningful.
+- (elapsed . SECONDS): how long the collection took.
+- (phases . ALIST): how long each phase took, in seconds.  The phases
+  are `setup' (saving the echo area and other state), `finish-sweep'
+  (sweeping what `gc-lazy-sweep' left unswept), `mark' (marking
+  reachable objects, except from the stacks of Lisp threads), `stack'
+  (marking from thread stacks), `weak' (removing dead entries from
+  weak hash tables), `strings' (freeing and compacting strings),
+  `sweep' (freeing all other objects), `release' (returning memory to
+  the system, see `gc-release-memory'), `snapshot' (writing a heap
+  snapshot, see `write-heap-snapshot'), `cleanup' (restoring state
+  after sweeping) and `finalizers' (running finalizers).  They add up
+  to the elapsed time, and a phase that was skipped took no time.
+- (live . ALIST): how many bytes of each kind of object survived the
+  collection.  The kinds are `conses', `symbols', `strings' (string
+  headers), `string-bytes' (string contents), `vector-slots',
+  `floats', `intervals' and `buffers'.
+- (free . ALIST): how many bytes are free for future objects of each
+  kind in the memory blocks that Emacs keeps because they also hold
+  live objects.  The kinds are `conses', `symbols', `strings',
+  `vector-slots', `floats' and `intervals'.  Comparing this with the
+  live bytes shows how fragmented the heap is.  */)
+  (void)
+{
+  Lisp_Object const phase_names[GC_PHASES] =
+    {
+      [GC_PHASE_SETUP] = Qsetup,
+      [GC_PHASE_FINISH_SWEEP] = Qfinish_sweep,
+      [GC_PHASE_MARK] = Qmark,
+      [GC_PHASE_STACK] = Qstack,
+      [GC_PHASE_WEAK] = Qweak,
+      [GC_PHASE_STRINGS] = Qstrings,
+      [GC_PHASE_SWEEP] = Qsweep,
+      [GC_PHASE_RELEASE] = Qrelease,
+      [GC_PHASE_SNAPSHOT] = Qsnapshot,
+      [GC_PHASE_CLEANUP] = Qcleanup,
+      [GC_PHASE_FINALIZERS] = Qfinalizers,
+    };
+  Lisp_Object const live_names[GC_LIVES] =
+    {
+      [GC_LIVE_CONSES] = Qconses,
+      [GC_LIVE_SYMBOLS] = Qsymbols,
+      [GC_LIVE_STRINGS] = Qstrings,
+      [GC_LIVE_STRING_BYTES] = Qstring_bytes,
+      [GC_LIVE_VECTOR_SLOTS] = Qvector_slots,
+      [GC_LIVE_FLOATS] = Qfloats,
+      [GC_LIVE_INTERVALS] = Qintervals,
+      [GC_LIVE_BUFFERS] = Qbuffers,
+    };
+  Lisp_Object result = Qnil;
+  EMACS_INT first = max (0, gc_history_count - GC_HISTORY_SIZE);
+
+  for (EMACS_INT n = first; n < gc_history_count; n++)
+    {
+      struct gc_record *r = &gc_history[n % GC_HISTORY_SIZE];
+      Lisp_Object phases = Qnil, live = Qnil, free_space = Qnil;
+      for (int i = GC_PHASES - 1; 0 <= i; i--)
+	phases = Fcons (Fcons (phase_names[i], make_float (r->phase[i])),
+			phases);
+      for (int i = GC_LIVES - 1; 0 <= i; i--)
+	{
+	  live = Fcons (Fcons (live_names[i], make_uint (r->live[i])), live);
+	  if (i != GC_LIVE_STRING_BYTES && i != GC_LIVE_BUFFERS)
+	    free_space = Fcons (Fcons (live_names[i],
+				       make_uint (r->free_space[i])),
+				free_space);
+	}
+      Lisp_Object start = make_float (timespectod (r->start));
+      result = Fcons (list5 (Fcons (Qstart, start),
+			     Fcons (Qelapsed, make_float (r->elapsed)),
+			     Fcons (Qphases, phases),
+			     Fcons (Qlive, live),
+			     Fcons (Qfree, free_space)),
+		      result);
+    }
+  return result;
 }
 
+#ifdef HAVE_MALLOC_TRIM
+DEFUN ("malloc-trim", Fmalloc_trim, Smalloc_trim, 0, 1, "",
+       doc: /* Return free heap memory to the system.
+Ask the C library to give the memory that it holds but that is not in
+use back to the operating system.  This can make the memory use of
+Emacs go down after a lot of data has become garbage and has been
+collected, but it is not guaranteed to.
+
+LEAVE-PADDING, if non-nil, is how many bytes of free memory to keep at
+the top of the heap.  It defaults to 0.
+
+Return non-nil if some memory was returned, nil otherwise.  */)
+  (Lisp_Object leave_padding)
+{
+  int pad = 0;
+
+  if (!NILP (leave_padding))
+    {
+      CHECK_FIXNAT (leave_padding);
+      pad = min (XFIXNUM (leave_padding), INT_MAX);
+    }
+  return malloc_trim (pad) ? Qt : Qnil;
+}
+#endif
+
 DEFUN ("memory-info", Fmemory_info, Smemory_info, 0, 0, 0,
        doc: /* Return a list of (TOTAL-RAM FREE-RAM TOTAL-SWAP FREE-SWAP).
 All values are in Kbytes.  If there is no swap space,
@@ -7157,6 +8500,7 @@ init_alloc (void)
 {
   Vgc_elapsed = make_float (0.0);
   gcs_done = 0;
+  gc_history_count = 0;
 
 #if USE_VALGRIND
   valgrind_p = RUNNING_ON_VALGRIND != 0;
@@ -7184,6 +8528,44 @@ has been allocated since the last garbage collection.
 If this portion is smaller than `gc-cons-threshold', this is ignored.  */);
   Vgc_cons_percentage = make_float (0.1);
 
+  DEFVAR_LISP ("gc-idle-collect-after-pause", Vgc_idle_collect_after_pause,
+	       doc: /* Collect garbage early while idle after pauses longer than this.
+If this is a number and the most recent garbage collection took longer
+than this many seconds, Emacs collects garbage early while it is idle
+waiting for input, once half of the amount of consing specified by
+`gc-cons-threshold' and `gc-cons-percentage' has been done.  This is
+only a heuristic for when to collect: it does not make any collection
+shorter, and a command that conses enough still collects garbage
+while it runs.  If nil, Emacs collects garbage while idle only when a
+collection is due anyway.  */);
+  Vgc_idle_collect_after_pause = Qnil;
+
+  DEFVAR_BOOL ("gc-lazy-sweep", gc_lazy_sweep,
+	       doc: /* Non-nil means sweep cons cells and floats lazily.
+Normally, garbage collection frees all unreachable cons cells and
+floats before it returns.  If this variable is non-nil, it returns
+right after marking what is reachable, and the space of the
+unreachable cons cells and floats is reclaimed a block at a time when
+new ones are allocated.  This shortens garbage collection pauses, at
+the expense of slightly slower allocation in between.  */);
+  gc_lazy_sweep = false;
+
+  DEFVAR_BOOL ("gc-release-memory", gc_release_memory,
+	       doc: /* Non-nil means return memory freed by GC to the system.
+Garbage collection frees the memory blocks that no longer hold any live
+objects, but the C library usually keeps the memory for itself instead
+of giving it back to the operating system.  If this variable is non-nil,
+every garbage collection that frees blocks asks the C library to give
+back what it can, as `malloc-trim' does.  This makes the memory use of
+a long-running Emacs go down after large amounts of data have become
+garbage, at the expense of slightly longer garbage collections.
+
+Emacs itself does not unmap any memory; this only calls the C library's
+`malloc_trim', and so has no effect if the C library does not provide
+it, as is the case with most C libraries other than the GNU C
+library.  */);
+  gc_release_memory = false;
+
   DEFVAR_INT ("pure-bytes-used", pure_bytes_used,
 	      doc: /* Number of bytes of shareable Lisp data allocated so far.  */);
 
@@ -7241,6 +8623,7 @@ do hash-consing of the objects allocated to pure space.  */);
   DEFSYM (Qstrings, "strings");
   DEFSYM (Qvectors, "vectors");
   DEFSYM (Qfloats, "floats");
+  DEFSYM (Qinterval, "interval");
   DEFSYM (Qintervals, "intervals");
   DEFSYM (Qbuffers, "buffers");
   DEFSYM (Qstring_bytes, "string-bytes");
@@ -7248,6 +8631,22 @@ do hash-consing of the objects allocated to pure space.  */);
   DEFSYM (Qheap, "heap");
   DEFSYM (QAutomatic_GC, "Automatic GC");
 
+  DEFSYM (Qstart, "start");
+  DEFSYM (Qelapsed, "elapsed");
+  DEFSYM (Qphases, "phases");
+  DEFSYM (Qlive, "live");
+  DEFSYM (Qsetup, "setup");
+  DEFSYM (Qfinish_sweep, "finish-sweep");
+  DEFSYM (Qmark, "mark");
+  DEFSYM (Qstack, "stack");
+  DEFSYM (Qweak, "weak");
+  DEFSYM (Qsweep, "sweep");
+  DEFSYM (Qfinalizers, "finalizers");
+  DEFSYM (Qrelease, "release");
+  DEFSYM (Qsnapshot, "snapshot");
+  DEFSYM (Qcleanup, "cleanup");
+  DEFSYM (Qfree, "free");
+
   DEFSYM (Qgc_cons_threshold, "gc-cons-threshold");
   DEFSYM (Qchar_table_extra_slots, "char-table-extra-slots");
 
@@ -7278,6 +8677,11 @@ than 2**N, where N is this variable's value.  N should be nonnegative.  */);
   defsubr (&Smake_finalizer);
   defsubr (&Spurecopy);
   defsubr (&Sgarbage_collect);
+  defsubr (&Swrite_heap_snapshot);
+  defsubr (&Sgc_statistics);
+#ifdef HAVE_MALLOC_TRIM
+  defsubr (&Smalloc_trim);
+#endif
   defsubr (&Smemory_info);
   defsubr (&Smemory_use_counts);
   defsubr (&Ssuspicious_object);
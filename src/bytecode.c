@@ -40,41 +40,13 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 # define BYTE_CODE_SAFE false
 #endif
 
-/* Define BYTE_CODE_METER to generate a byte-op usage histogram.  */
-/* #define BYTE_CODE_METER */
-
 /* If BYTE_CODE_THREADED is defined, then the interpreter will be
    indirect threaded, using GCC's computed goto extension.  This code,
-   as currently implemented, is incompatible with BYTE_CODE_SAFE and
-   BYTE_CODE_METER.  */
+   as currently implemented, is incompatible with BYTE_CODE_SAFE.  */
 #if (defined __GNUC__ && !defined __STRICT_ANSI__ && !defined __CHKP__ \
-     && !BYTE_CODE_SAFE && !defined BYTE_CODE_METER)
+     && !BYTE_CODE_SAFE)
 #define BYTE_CODE_THREADED
 #endif
-
-
-#ifdef BYTE_CODE_METER
-
-#define METER_2(code1, code2) \
-  (*aref_addr (AREF (Vbyte_code_meter, code1), code2))
-#define METER_1(code) METER_2 (0, code)
-
-#define METER_CODE(last_code, this_code)				\
-{									\
-  if (byte_metering_on)							\
-    {									\
-      if (XFIXNAT (METER_1 (this_code)) < MOST_POSITIVE_FIXNUM)	\
-        XSETFASTINT (METER_1 (this_code),				\
-		     XFIXNAT (METER_1 (this_code)) + 1);		\
-      if (last_code							\
-	  && (XFIXNAT (METER_2 (last_code, this_code))			\
-	      < MOST_POSITIVE_FIXNUM))					\
-        XSETFASTINT (METER_2 (last_code, this_code),			\
-		     XFIXNAT (METER_2 (last_code, this_code)) + 1);	\
-    }									\
-}
-
-#endif /* BYTE_CODE_METER */
 
 
 /*  Byte codes: */
@@ -270,6 +242,21 @@ DEFINE (BdiscardN,   0266)						\
 									\
 DEFINE (Bswitch, 0267)                                                  \
                                                                         \
+/* Fused instructions, new in version 27.  Each does the work of the	\
+   pair of instructions it is named after.  */				\
+DEFINE (Bvarref_car_safe, 0270)	/* Variable in following byte.  */	\
+DEFINE (Bstack_ref_cdr, 0271)	/* Stack offset in following byte.  */	\
+DEFINE (Bdup_gotoifnil, 0272)						\
+DEFINE (Bconstant_call1, 0273)	/* Constant in following byte.  */	\
+DEFINE (Bconstant_call2, 0274)	/* Constant in following byte.  */	\
+									\
+/* Like Bcall6, but always followed by Breturn, and the frame may be	\
+   reused for the call.  New in version 27.  */			\
+DEFINE (Btail_call, 0275)	/* Number of args in following byte.  */ \
+/* Does nothing.  As the first instruction of a function, says that	\
+   its &rest list does not escape.  New in version 27.  */		\
+DEFINE (Bstack_rest, 0276)						\
+									\
 DEFINE (Bconstant, 0300)
 
 enum byte_code_op
@@ -283,6 +270,112 @@ enum byte_code_op
     Bset_mark = 0163, /* this loser is no longer generated as of v18 */
 #endif
 };
+
+/* Byte-code metering.  While `byte-metering-on' is non-nil, each
+   function the interpreter enters passes every instruction it
+   executes to meter_op before executing it.  The threaded interpreter
+   does this by dispatching through a table all of whose entries lead
+   to the meter, so metering costs nothing while it is off.  */
+
+/* Increment the count in *SLOT, unless it is not a count.  */
+
+static void
+meter_count (Lisp_Object *slot)
+{
+  if (FIXNATP (*slot) && XFIXNAT (*slot) < MOST_POSITIVE_FIXNUM)
+    *slot = make_fixnum (XFIXNAT (*slot) + 1);
+}
+
+/* Count opcode CODE2 in row CODE1 of `byte-code-meter'.  */
+
+static void
+meter_pair (int code1, int code2)
+{
+  Lisp_Object meter = Vbyte_code_meter, row;
+  if (VECTORP (meter) && ASIZE (meter) == 256
+      && (row = AREF (meter, code1), VECTORP (row)) && ASIZE (row) == 256)
+    meter_count (aref_addr (row, code2));
+}
+
+/* Start metering the function that is being entered, and return
+   it.  */
+
+static Lisp_Object
+meter_start (void)
+{
+  if (! (VECTORP (Vbyte_code_meter) && ASIZE (Vbyte_code_meter) == 256))
+    {
+      Vbyte_code_meter = Fmake_vector (make_fixnum (256), Qnil);
+      for (int i = 0; i < 256; i++)
+	ASET (Vbyte_code_meter, i,
+	      Fmake_vector (make_fixnum (256), make_fixnum (0)));
+    }
+  return backtrace_top_function ();
+}
+
+/* Count an instruction of the function FUN in
+   `byte-code-function-meter'.  *TABLE and *SLOT are the table and the
+   index of FUN's entry in it when it was last looked up.  They are
+   checked before being used, since the code being metered can set the
+   variable, or clear, remove from or grow the table.  */
+
+static void
+meter_function (Lisp_Object fun, Lisp_Object *table, ptrdiff_t *slot)
+{
+  Lisp_Object meter = Vbyte_code_function_meter;
+  if (!HASH_TABLE_P (meter))
+    return;
+  struct Lisp_Hash_Table *h = XHASH_TABLE (meter);
+  ptrdiff_t i = *slot;
+  if (! (EQ (meter, *table) && 0 <= i && i < HASH_TABLE_SIZE (h)
+	 && EQ (HASH_KEY (h, i), fun)))
+    {
+      EMACS_UINT hash;
+      i = hash_lookup (h, fun, &hash);
+      if (i < 0)
+	i = hash_put (h, fun, make_fixnum (0), hash);
+      *table = meter;
+      *slot = i;
+    }
+  Lisp_Object n = HASH_VALUE (h, i);
+  meter_count (&n);
+  set_hash_value_slot (h, i, n);
+}
+
+/* Record that the instruction OP, whose operands start at PC, is
+   about to be executed with stack top TOP, after the instruction PREV
+   (or 0 if OP is the first of its function).  The function being
+   executed is FUN; TABLE and SLOT are as for meter_function.  */
+
+static void
+meter_op (int prev, int op, unsigned char const *pc, Lisp_Object *top,
+	  Lisp_Object fun, Lisp_Object *table, ptrdiff_t *slot)
+{
+  meter_pair (0, op);
+  if (prev)
+    meter_pair (prev, op);
+  meter_function (fun, table, slot);
+
+  /* Count calls to symbols whose `byte-code-meter' property is a
+     number.  NARGS is the number of arguments already on the stack
+     above the function.  */
+  int nargs = -1;
+  if (Bcall <= op && op <= Bcall5)
+    nargs = op - Bcall;
+  else if (op == Bcall6 || op == Btail_call)
+    nargs = pc[0];
+  else if (op == Bcall7)
+    nargs = pc[0] + (pc[1] << 8);
+  else if (op == Bconstant_call1 || op == Bconstant_call2)
+    nargs = op - Bconstant_call1;
+  if (0 <= nargs && SYMBOLP (top[-nargs]))
+    {
+      Lisp_Object v1 = top[-nargs];
+      Lisp_Object v2 = Fget (v1, Qbyte_code_meter);
+      if (FIXNATP (v2) && XFIXNAT (v2) < MOST_POSITIVE_FIXNUM)
+	Fput (v1, Qbyte_code_meter, make_fixnum (XFIXNAT (v2) + 1));
+    }
+}
 
 /* Fetch the next byte from the bytecode stream.  */
 
@@ -340,10 +433,6 @@ Lisp_Object
 exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 		Lisp_Object args_template, ptrdiff_t nargs, Lisp_Object *args)
 {
-#ifdef BYTE_CODE_METER
-  int volatile this_op = 0;
-#endif
-
   CHECK_STRING (bytestr);
   CHECK_VECTOR (vector);
   CHECK_FIXNAT (maxdepth);
@@ -367,6 +456,9 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
   void *alloc;
   SAFE_ALLOCA_LISP_EXTRA (alloc, stack_items, bytestr_length);
   ptrdiff_t item_bytes = stack_items * word_size;
+  /* The room available for the stack and code of tail calls.  */
+  EMACS_INT stack_room = stack_items;
+  ptrdiff_t bytestr_room = bytestr_length;
   Lisp_Object *stack_base = ptr_bounds_clip (alloc, item_bytes);
   Lisp_Object *top = stack_base;
   *top = vector; /* Ensure VECTOR survives GC (Bug#33014).  */
@@ -377,6 +469,12 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
   unsigned char const *pc = bytestr_data;
   ptrdiff_t count = SPECPDL_INDEX ();
 
+  bool metering = byte_metering_on;
+  int volatile meter_prev = 0;
+  Lisp_Object meter_fun = metering ? meter_start () : Qnil;
+  Lisp_Object meter_table = Qnil;
+  ptrdiff_t meter_slot = -1;
+
   if (!NILP (args_template))
     {
       eassert (FIXNUMP (args_template));
@@ -392,11 +490,31 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
       ptrdiff_t pushedargs = min (nonrest, nargs);
       for (ptrdiff_t i = 0; i < pushedargs; i++, args++)
 	PUSH (*args);
-      if (nonrest < nargs)
-	PUSH (Flist (nargs - nonrest, args));
-      else
+      ptrdiff_t nrest = nargs - nonrest;
+      if (nrest <= 0)
 	for (ptrdiff_t i = nargs - rest; i < nonrest; i++)
 	  PUSH (Qnil);
+      else if (USE_STACK_CONS && *pc == Bstack_rest
+	       && nrest <= sa_avail / (ptrdiff_t) sizeof (struct Lisp_Cons)
+	       /* GC marks a stack on the heap precisely, and must
+		  never see conses that it did not allocate.  */
+	       && SPECPDL_INDEX () == sa_count)
+	{
+	  /* The compiler has found that the list does not escape, so
+	     make it of conses that die with this frame.  */
+	  struct Lisp_Cons *conses
+	    = AVAIL_ALLOCA (nrest * sizeof (struct Lisp_Cons));
+	  Lisp_Object list = Qnil;
+	  for (ptrdiff_t i = nrest - 1; 0 <= i; i--)
+	    {
+	      conses[i].u.s.car = args[i];
+	      conses[i].u.s.u.cdr = list;
+	      list = make_lisp_ptr (&conses[i], Lisp_Cons);
+	    }
+	  PUSH (list);
+	}
+      else
+	PUSH (Flist (nrest, args));
     }
 
   while (true)
@@ -407,12 +525,14 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
       if (BYTE_CODE_SAFE && ! (stack_base <= top && top < stack_lim))
 	emacs_abort ();
 
-#ifdef BYTE_CODE_METER
-      int prev_op = this_op;
-      this_op = op = FETCH;
-      METER_CODE (prev_op, op);
-#elif !defined BYTE_CODE_THREADED
+#ifndef BYTE_CODE_THREADED
       op = FETCH;
+      if (metering)
+	{
+	  meter_op (meter_prev, op, pc, top, meter_fun, &meter_table,
+		    &meter_slot);
+	  meter_prev = op;
+	}
 #endif
 
       /* The interpreter can be compiled one of two ways: as an
@@ -428,7 +548,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
       /* NEXT is invoked at the end of an instruction to go to the
 	 next instruction.  It is either a computed goto, or a
 	 plain break.  */
-#define NEXT goto *(targets[op = FETCH])
+#define NEXT goto *(dispatch[op = FETCH])
       /* FIRST is like NEXT, but is only used at the start of the
 	 interpreter body.  In the switch-based interpreter it is the
 	 switch, so the threaded definition must include a semicolon.  */
@@ -467,11 +587,28 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 #undef DEFINE
 	};
 
+      /* While metering, every instruction goes through this table
+	 instead, and from there to its entry in TARGETS.  */
+      static const void *const meter_targets[256] =
+	{
+	  [0 ... 255] = &&insn_meter
+	};
+
+      const void *const *dispatch = metering ? meter_targets : targets;
+
 #endif
 
 
       FIRST
 	{
+#ifdef BYTE_CODE_THREADED
+	insn_meter:
+	  meter_op (meter_prev, op, pc, top, meter_fun, &meter_table,
+		    &meter_slot);
+	  meter_prev = op;
+	  goto *(targets[op]);
+#endif
+
 	CASE (Bvarref7):
 	  op = FETCH2;
 	  goto varref;
@@ -509,6 +646,23 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	    NEXT;
 	  }
 
+	CASE (Bvarref_car_safe):
+	  {
+	    Lisp_Object v1 = vectorp[FETCH], v2;
+	    if (!SYMBOLP (v1)
+		|| XSYMBOL (v1)->u.s.redirect != SYMBOL_PLAINVAL
+		|| (v2 = SYMBOL_VAL (XSYMBOL (v1)), EQ (v2, Qunbound)))
+	      v2 = Fsymbol_value (v1);
+	    PUSH (CAR_SAFE (v2));
+	    NEXT;
+	  }
+
+	CASE (Bdup_gotoifnil):
+	  op = FETCH2;
+	  if (NILP (TOP))
+	    goto op_branch;
+	  NEXT;
+
 	CASE (Bcar):
 	  if (CONSP (TOP))
 	    TOP = XCAR (TOP);
@@ -607,6 +761,72 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	  op = FETCH2;
 	  goto docall;
 
+	CASE (Bconstant_call1):
+	CASE (Bconstant_call2):
+	  PUSH (vectorp[FETCH]);
+	  op -= Bconstant_call1 - 1;
+	  goto docall;
+
+	CASE (Btail_call):
+	  op = FETCH;
+	  {
+	    /* If the function called is byte-compiled with lexical
+	       binding and fits into the room this frame has, run it in
+	       this frame in place of the current function.  Otherwise
+	       make an ordinary call; the Breturn that follows returns
+	       its value.  */
+	    Lisp_Object *fp = top - op;
+	    Lisp_Object fun = *fp;
+	    if (SYMBOLP (fun) && !NILP (fun))
+	      fun = XSYMBOL (fun)->u.s.function;
+	    if (! (COMPILEDP (fun) && !NILP (args_template) && !metering
+		   && SPECPDL_INDEX () == count))
+	      goto docall;
+	    if (CONSP (AREF (fun, COMPILED_BYTECODE)))
+	      Ffetch_bytecode (fun);
+	    Lisp_Object new_template = AREF (fun, COMPILED_ARGLIST);
+	    Lisp_Object new_bytestr = AREF (fun, COMPILED_BYTECODE);
+	    Lisp_Object new_vector = AREF (fun, COMPILED_CONSTANTS);
+	    Lisp_Object new_maxdepth = AREF (fun, COMPILED_STACK_DEPTH);
+	    if (! (FIXNUMP (new_template)
+		   && STRINGP (new_bytestr) && !STRING_MULTIBYTE (new_bytestr)
+		   && SBYTES (new_bytestr) <= bytestr_room
+		   && VECTORP (new_vector)
+		   && FIXNATP (new_maxdepth)
+		   && XFIXNAT (new_maxdepth) < stack_room))
+	      goto docall;
+	    /* Leave calls that are wrong or have to make a list of
+	       arguments to Ffuncall.  */
+	    ptrdiff_t at = XFIXNUM (new_template);
+	    bool rest = (at & 128) != 0;
+	    int mandatory = at & 127;
+	    ptrdiff_t nonrest = at >> 8;
+	    if (! (mandatory <= op && op <= nonrest))
+	      goto docall;
+
+	    maybe_quit ();
+	    maybe_gc ();
+	    if (!backtrace_tail_call (count, *fp, stack_base + 1, op))
+	      goto docall;
+
+	    memmove (stack_base + 1, fp + 1, op * word_size);
+	    top = stack_base + op;
+	    for (ptrdiff_t i = op - rest; i < nonrest; i++)
+	      PUSH (Qnil);
+	    *stack_base = vector = new_vector;
+	    vectorp = XVECTOR (vector)->contents;
+	    const_length = ASIZE (vector);
+	    stack_lim = stack_base + XFIXNAT (new_maxdepth) + 1;
+	    bytestr_length = SBYTES (new_bytestr);
+	    memcpy (bytestr_data, SDATA (new_bytestr), bytestr_length);
+	    pc = bytestr_data;
+	    args_template = new_template;
+	    NEXT;
+	  }
+
+	CASE (Bstack_rest):
+	  NEXT;
+
 	CASE (Bcall):
 	CASE (Bcall1):
 	CASE (Bcall2):
@@ -617,19 +837,6 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	docall:
 	  {
 	    DISCARD (op);
-#ifdef BYTE_CODE_METER
-	    if (byte_metering_on && SYMBOLP (TOP))
-	      {
-		Lisp_Object v1 = TOP;
-		Lisp_Object v2 = Fget (v1, Qbyte_code_meter);
-		if (FIXNUMP (v2)
-		    && XFIXNUM (v2) < MOST_POSITIVE_FIXNUM)
-		  {
-		    XSETINT (v2, XFIXNUM (v2) + 1);
-		    Fput (v1, Qbyte_code_meter, v2);
-		  }
-	      }
-#endif
 	    TOP = Ffuncall (op + 1, &TOP);
 	    NEXT;
 	  }
@@ -1368,6 +1575,16 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	    PUSH (v1);
 	    NEXT;
 	  }
+	CASE (Bstack_ref_cdr):
+	  {
+	    Lisp_Object v1 = top[- FETCH];
+	    if (CONSP (v1))
+	      v1 = XCDR (v1);
+	    else if (!NILP (v1))
+	      wrong_type_argument (Qlistp, v1);
+	    PUSH (v1);
+	    NEXT;
+	  }
 	CASE (Bstack_set):
 	  /* stack-set-0 = discard; stack-set-1 = discard-1-preserve-tos.  */
 	  {
@@ -1477,30 +1694,36 @@ syms_of_bytecode (void)
 {
   defsubr (&Sbyte_code);
 
-#ifdef BYTE_CODE_METER
-
   DEFVAR_LISP ("byte-code-meter", Vbyte_code_meter,
 	       doc: /* A vector of vectors which holds a histogram of byte-code usage.
 \(aref (aref byte-code-meter 0) CODE) indicates how many times the byte
 opcode CODE has been executed.
 \(aref (aref byte-code-meter CODE1) CODE2), where CODE1 is not 0,
 indicates how many times the byte opcodes CODE1 and CODE2 have been
-executed in succession.  */);
+executed in succession.
+The vectors are created when metering is first turned on; see
+`byte-metering-on'.  */);
+  Vbyte_code_meter = Qnil;
+
+  DEFVAR_LISP ("byte-code-function-meter", Vbyte_code_function_meter,
+	       doc: /* A hash table counting the byte-code instructions of each function.
+While `byte-metering-on' is non-nil, each function the byte-code
+interpreter executes is mapped to the number of instructions executed
+on its behalf, not counting those of the functions it calls.  The key
+is the function as it was called, typically a symbol.  Instructions
+executed by top-level forms of compiled files are counted under
+`byte-code'.  If this is not a hash table, no such counts are kept.  */);
+  Vbyte_code_function_meter = CALLN (Fmake_hash_table, QCtest, Qeq);
 
   DEFVAR_BOOL ("byte-metering-on", byte_metering_on,
 	       doc: /* If non-nil, keep profiling information on byte code usage.
-The variable byte-code-meter indicates how often each byte opcode is used.
-If a symbol has a property named `byte-code-meter' whose value is an
-integer, it is incremented each time that symbol's function is called.  */);
-
+The variable `byte-code-meter' indicates how often each byte opcode is
+used, and `byte-code-function-meter' how many instructions each
+function executes.  If a symbol has a property named `byte-code-meter'
+whose value is an integer, it is incremented each time that symbol's
+function is called from byte-code.
+Setting this takes effect for functions entered afterwards.  */);
   byte_metering_on = false;
-  Vbyte_code_meter = Fmake_vector (make_fixnum (256), make_fixnum (0));
+
   DEFSYM (Qbyte_code_meter, "byte-code-meter");
-  {
-    int i = 256;
-    while (i--)
-      ASET (Vbyte_code_meter, i,
-           Fmake_vector (make_fixnum (256), make_fixnum (0)));
-  }
-#endif
 }
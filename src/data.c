@@ -255,6 +255,7 @@ for example, (type-of 1) returns `integer'.  */)
         case PVEC_THREAD: return Qthread;
         case PVEC_MUTEX: return Qmutex;
         case PVEC_CONDVAR: return Qcondition_variable;
+        case PVEC_STRING_BUILDER: return Qstring_builder;
         case PVEC_TERMINAL: return Qterminal;
         case PVEC_RECORD:
           {
@@ -3952,6 +3953,8 @@ syms_of_data (void)
   DEFSYM (Qthread, "thread");
   DEFSYM (Qmutex, "mutex");
   DEFSYM (Qcondition_variable, "condition-variable");
+  DEFSYM (Qstring_builder, "string-builder");
+  DEFSYM (Qstring_builder_p, "string-builder-p");
   DEFSYM (Qfont_spec, "font-spec");
   DEFSYM (Qfont_entity, "font-entity");
   DEFSYM (Qfont_object, "font-object");
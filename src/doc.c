@@ -26,8 +26,14 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include <sys/file.h>	/* Must be after sys/types.h for USG.  */
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/stat.h>
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 
 #include <c-ctype.h>
+#include <stat-time.h>
+#include <timespec.h>
 
 #include "lisp.h"
 #include "character.h"
@@ -59,6 +65,210 @@ read_bytecode_char (bool unreadflag)
   return *read_bytecode_pointer++;
 }
 
+/* Documentation files whose contents are in memory, so that fetching
+   a doc string does not have to open and read the file each time.
+   The contents are mapped if possible, and read otherwise.  */
+
+struct doc_file
+{
+  /* The name the file was opened under, or NULL if this entry is
+     unused.  */
+  char *name;
+
+  char *data;
+  ptrdiff_t size;
+
+  /* True if DATA is mapped from the file rather than read into
+     memory.  */
+  bool mapped;
+
+  /* The positions of the NENDS '\037' characters that end doc strings
+     in the file, in increasing order.  */
+  ptrdiff_t *ends;
+  ptrdiff_t nends;
+
+  /* The identity and modification time of the file when it was
+     mapped, to notice when it is replaced.  */
+  dev_t dev;
+  ino_t ino;
+  struct timespec mtime;
+};
+
+enum { DOC_FILES = 16 };
+static struct doc_file doc_files[DOC_FILES];
+
+/* The entry to reuse next when all are in use.  */
+static int doc_files_next;
+
+static void
+release_doc_file (struct doc_file *df)
+{
+  if (df->name)
+    {
+#ifdef HAVE_MMAP
+      if (df->mapped)
+	munmap (df->data, df->size);
+      else
+#endif
+	xfree (df->data);
+      xfree (df->ends);
+      xfree (df->name);
+      df->name = NULL;
+    }
+}
+
+/* Forget the contents of all documentation files.  This must be done
+   before dumping, so that the dumped Emacs does not refer to them.  */
+
+void
+release_doc_files (void)
+{
+  for (int i = 0; i < DOC_FILES; i++)
+    release_doc_file (&doc_files[i]);
+}
+
+/* Count the '\037' characters in the contents of DF, and store the
+   positions of up to NMAX of them in ENDS.  Return the count, but no
+   more than NMAX if ENDS is not null.  */
+
+static ptrdiff_t
+scan_doc_file (struct doc_file *df, ptrdiff_t *ends, ptrdiff_t nmax)
+{
+  ptrdiff_t n = 0;
+  char const *lim = df->data + df->size;
+  for (char const *p = df->data;
+       (p = memchr (p, '\037', lim - p));
+       p++)
+    {
+      if (ends)
+	{
+	  if (n == nmax)
+	    break;
+	  ends[n] = p - df->data;
+	}
+      n++;
+    }
+  return n;
+}
+
+/* Return the position of the end of the doc string in DF that starts
+   at POSITION: the position of the first '\037' at or after it, or
+   the size of the file if there is none.  */
+
+static ptrdiff_t
+doc_string_end (struct doc_file *df, ptrdiff_t position)
+{
+  ptrdiff_t lo = 0, hi = df->nends;
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      if (df->ends[mid] < position)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo < df->nends ? df->ends[lo] : df->size;
+}
+
+/* Return the contents of the documentation file NAME, or NULL with
+   errno set if it cannot be read.  This costs one stat call if the
+   file has not changed since it was last loaded.  Checking this also
+   keeps a mapping from being accessed past the end of a file that was
+   truncated, for instance when `make' rebuilds DOC.  A file truncated
+   between the check and the access still raises SIGBUS, but that
+   window is a single copy of one doc string.  */
+
+static struct doc_file *
+find_doc_file (char const *name)
+{
+  struct doc_file *df = NULL;
+  struct stat st;
+
+  for (int i = 0; i < DOC_FILES; i++)
+    if (doc_files[i].name && !strcmp (doc_files[i].name, name))
+      {
+	df = &doc_files[i];
+	break;
+      }
+
+  if (df)
+    {
+      if (stat (name, &st) == 0
+	  && st.st_dev == df->dev && st.st_ino == df->ino
+	  && st.st_size == df->size
+	  && timespec_cmp (get_stat_mtime (&st), df->mtime) == 0)
+	return df;
+      release_doc_file (df);
+    }
+  else
+    {
+      df = &doc_files[doc_files_next];
+      doc_files_next = (doc_files_next + 1) % DOC_FILES;
+      release_doc_file (df);
+    }
+
+  int fd = emacs_open (name, O_RDONLY, 0);
+  if (fd < 0)
+    return NULL;
+  if (fstat (fd, &st) != 0 || PTRDIFF_MAX - 1 < st.st_size)
+    {
+      int err = errno;
+      emacs_close (fd);
+      errno = err;
+      return NULL;
+    }
+  ptrdiff_t size = st.st_size;
+  char *data = NULL;
+  bool mapped = false;
+#ifdef HAVE_MMAP
+  /* An empty file cannot be mapped; read it like any other file that
+     cannot be mapped.  */
+  if (size)
+    {
+      data = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED)
+	data = NULL;
+      else
+	mapped = true;
+    }
+#endif
+  if (!data)
+    {
+      data = xmalloc (size + 1);
+      ptrdiff_t nread = emacs_read (fd, data, size);
+      if (nread != size)
+	{
+	  int err = nread < 0 ? errno : EIO;
+	  xfree (data);
+	  emacs_close (fd);
+	  errno = err;
+	  return NULL;
+	}
+    }
+  emacs_close (fd);
+
+  df->name = xstrdup (name);
+  df->data = data;
+  df->size = size;
+  df->mapped = mapped;
+  df->ends = NULL;
+  df->nends = 0;
+  df->dev = st.st_dev;
+  df->ino = st.st_ino;
+  df->mtime = get_stat_mtime (&st);
+
+  /* Index the ends of the doc strings, so that fetching one does not
+     have to search for its end.  */
+  ptrdiff_t nends = scan_doc_file (df, NULL, 0);
+  if (0 < nends)
+    {
+      df->ends = xnmalloc (nends, sizeof *df->ends);
+      nends = scan_doc_file (df, df->ends, nends);
+    }
+  df->nends = nends;
+  return df;
+}
+
 /* Extract a doc string from a file.  FILEPOS says where to get it.
    If it is an integer, use that position in the standard DOC file.
    If it is (FILE . INTEGER), use FILE as the file name
@@ -81,8 +291,7 @@ read_bytecode_char (bool unreadflag)
 Lisp_Object
 get_doc_string (Lisp_Object filepos, bool unibyte, bool definition)
 {
-  char *from, *to, *name, *p, *p1;
-  int fd;
+  char *from, *to, *name, *p;
   int offset;
   EMACS_INT position;
   Lisp_Object file, tem, pos;
@@ -124,8 +333,8 @@ get_doc_string (Lisp_Object filepos, bool unibyte, bool definition)
   name = SAFE_ALLOCA (docdir_sizemax + SBYTES (file));
   lispstpcpy (lispstpcpy (name, docdir), file);
 
-  fd = emacs_open (name, O_RDONLY, 0);
-  if (fd < 0)
+  struct doc_file *df = find_doc_file (name);
+  if (!df)
     {
 #ifndef CANNOT_DUMP
       if (!NILP (Vpurify_flag))
@@ -134,10 +343,10 @@ get_doc_string (Lisp_Object filepos, bool unibyte, bool definition)
 	     So check in ../etc.  */
 	  lispstpcpy (stpcpy (name, sibling_etc), file);
 
-	  fd = emacs_open (name, O_RDONLY, 0);
+	  df = find_doc_file (name);
 	}
 #endif
-      if (fd < 0)
+      if (!df)
 	{
 	  if (errno == EMFILE || errno == ENFILE)
 	    report_file_error ("Read error on documentation file", file);
@@ -148,61 +357,28 @@ get_doc_string (Lisp_Object filepos, bool unibyte, bool definition)
 	  return concat3 (cannot_open, file, quote_nl);
 	}
     }
-  record_unwind_protect_int (close_file_unwind, fd);
-
-  /* Seek only to beginning of disk block.  */
-  /* Make sure we read at least 1024 bytes before `position'
-     so we can check the leading text for consistency.  */
-  offset = min (position, max (1024, position % (8 * 1024)));
-  if (TYPE_MAXIMUM (off_t) < position
-      || lseek (fd, position - offset, 0) < 0)
-    error ("Position %"pI"d out of range in doc string file \"%s\"",
-	   position, name);
 
-  /* Read the doc string into get_doc_string_buffer.
-     P points beyond the data just read.  */
-
-  p = get_doc_string_buffer;
-  while (1)
+  if (df->size < position)
     {
-      ptrdiff_t space_left = (get_doc_string_buffer_size - 1
-			      - (p - get_doc_string_buffer));
-      int nread;
+      release_doc_file (df);
+      error ("Position %"pI"d out of range in doc string file \"%s\"",
+	     position, name);
+    }
 
-      /* Allocate or grow the buffer if we need to.  */
-      if (space_left <= 0)
-	{
-	  ptrdiff_t in_buffer = p - get_doc_string_buffer;
-	  get_doc_string_buffer
-	    = xpalloc (get_doc_string_buffer, &get_doc_string_buffer_size,
-		       16 * 1024, -1, 1);
-	  p = get_doc_string_buffer + in_buffer;
-	  space_left = (get_doc_string_buffer_size - 1
-			- (p - get_doc_string_buffer));
-	}
+  /* Copy the doc string into get_doc_string_buffer, along with up to
+     1024 bytes before it so we can check the leading text for
+     consistency.  P points beyond the data copied.  */
+  offset = min (position, 1024);
+  ptrdiff_t start = position - offset;
+  ptrdiff_t len = doc_string_end (df, position) - start;
+  if (get_doc_string_buffer_size <= len)
+    get_doc_string_buffer
+      = xpalloc (get_doc_string_buffer, &get_doc_string_buffer_size,
+		 len + 1 - get_doc_string_buffer_size, -1, 1);
+  memcpy (get_doc_string_buffer, df->data + start, len);
+  p = get_doc_string_buffer + len;
+  *p = 0;
 
-      /* Read a disk block at a time.
-         If we read the same block last time, maybe skip this?  */
-      if (space_left > 1024 * 8)
-	space_left = 1024 * 8;
-      nread = emacs_read_quit (fd, p, space_left);
-      if (nread < 0)
-	report_file_error ("Read error on documentation file", file);
-      p[nread] = 0;
-      if (!nread)
-	break;
-      if (p == get_doc_string_buffer)
-	p1 = strchr (p + offset, '\037');
-      else
-	p1 = strchr (p, '\037');
-      if (p1)
-	{
-	  *p1 = 0;
-	  p = p1;
-	  break;
-	}
-      p += nread;
-    }
   SAFE_FREE_UNBIND_TO (count, Qnil);
 
   /* Sanity checking.  */
@@ -588,6 +764,7 @@ the same file name is found in the `doc-directory'.  */)
 			 open_errno);
     }
   record_unwind_protect_int (close_file_unwind, fd);
+  release_doc_files ();
   Vdoc_file_name = filename;
   filled = 0;
   pos = 0;
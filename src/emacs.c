@@ -2197,6 +2197,9 @@ You must run Emacs in batch mode in order to dump it.  */)
   tem = Vpurify_flag;
   Vpurify_flag = Qnil;
 
+  /* Do not dump the addresses of documentation files in memory.  */
+  release_doc_files ();
+
 #ifdef HYBRID_MALLOC
   {
     static char const fmt[] = "%d of %d static heap bytes used";
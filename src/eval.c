@@ -2193,9 +2193,53 @@ record_in_backtrace (Lisp_Object function, Lisp_Object *args, ptrdiff_t nargs)
   specpdl_ptr->bt.nargs = nargs;
   grow_specpdl ();
 
+  if (profiler_calls_running)
+    profiler_call_enter (function, count);
   return count;
 }
 
+/* Pop the backtrace entry pushed by record_in_backtrace, which must be
+   on top of the specpdl.  */
+
+static void
+pop_backtrace (void)
+{
+  specpdl_ptr--;
+  if (profiler_calls_running)
+    profiler_call_exit (SPECPDL_INDEX ());
+}
+
+/* Make the backtrace entry just below specpdl index COUNT, which
+   must be that of a byte-compiled function, record a call of FUNCTION
+   with the NARGS arguments at ARGS instead.  The byte-code interpreter
+   uses this when a tail call reuses the frame of that function.
+   Return false, changing nothing, if the debugger is to be entered
+   when the call recorded there exits or the next call is made, or if
+   that call is of a command: `called-interactively-p' looks for it
+   in the backtrace.  */
+
+bool
+backtrace_tail_call (ptrdiff_t count, Lisp_Object function,
+		     Lisp_Object *args, ptrdiff_t nargs)
+{
+  union specbinding *pdl = specpdl + count - 1;
+  if (count == 0 || pdl->kind != SPECPDL_BACKTRACE
+      || backtrace_debug_on_exit (pdl) || debug_on_next_call)
+    return false;
+  Lisp_Object caller = indirect_function (backtrace_function (pdl));
+  if (! (COMPILEDP (caller) && PVSIZE (caller) <= COMPILED_INTERACTIVE))
+    return false;
+
+  if (profiler_calls_running)
+    profiler_call_exit (count - 1);
+  pdl->bt.function = function;
+  set_backtrace_args (pdl, args, nargs);
+  current_thread->stack_top = args;
+  if (profiler_calls_running)
+    profiler_call_enter (function, count - 1);
+  return true;
+}
+
 /* Eval a sub-expression of the current expression (i.e. in the same
    lexical scope).  */
 Lisp_Object
@@ -2300,7 +2344,7 @@ eval_sub (Lisp_Object form)
 	  if (backtrace_debug_on_exit (specpdl + count))
 	    val = call_debugger (list2 (Qexit, val));
 	  SAFE_FREE ();
-	  specpdl_ptr--;
+	  pop_backtrace ();
 	  return val;
 	}
       else
@@ -2405,7 +2449,7 @@ eval_sub (Lisp_Object form)
   lisp_eval_depth--;
   if (backtrace_debug_on_exit (specpdl + count))
     val = call_debugger (list2 (Qexit, val));
-  specpdl_ptr--;
+  pop_backtrace ();
 
   return val;
 }
@@ -2884,7 +2928,7 @@ usage: (funcall FUNCTION &rest ARGUMENTS)  */)
   lisp_eval_depth--;
   if (backtrace_debug_on_exit (specpdl + count))
     val = call_debugger (list2 (Qexit, val));
-  specpdl_ptr--;
+  pop_backtrace ();
   return val;
 }
 
@@ -3001,7 +3045,7 @@ apply_lambda (Lisp_Object fun, Lisp_Object args, ptrdiff_t count)
   if (backtrace_debug_on_exit (specpdl + count))
     tem = call_debugger (list2 (Qexit, tem));
   SAFE_FREE ();
-  specpdl_ptr--;
+  pop_backtrace ();
   return tem;
 }
 
@@ -3630,6 +3674,8 @@ unbind_to (ptrdiff_t count, Lisp_Object value)
       union specbinding this_binding;
       this_binding = *--specpdl_ptr;
 
+      if (this_binding.kind == SPECPDL_BACKTRACE && profiler_calls_running)
+	profiler_call_exit (SPECPDL_INDEX ());
       do_one_unbind (&this_binding, true, SET_INTERNAL_UNBIND);
     }
 
@@ -4054,10 +4100,16 @@ mark_specpdl (union specbinding *first, union specbinding *ptr)
     }
 }
 
+/* Store in ARRAY the functions of the innermost backtrace entries,
+   innermost first, padded with nil.  Leave out the innermost entry
+   unless INNERMOST.  */
+
 void
-get_backtrace (Lisp_Object array)
+get_backtrace (Lisp_Object array, bool innermost)
 {
-  union specbinding *pdl = backtrace_next (backtrace_top ());
+  union specbinding *pdl = backtrace_top ();
+  if (!innermost)
+    pdl = backtrace_next (pdl);
   ptrdiff_t i = 0, asize = ASIZE (array);
 
   /* Copy the backtrace contents into working memory.  */
@@ -26,6 +26,8 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 #include <intprops.h>
 #include <vla.h>
 #include <errno.h>
+#include <byteswap.h>
+#include <count-trailing-zeros.h>
 
 #include "lisp.h"
 #include "bignum.h"
@@ -42,8 +44,6 @@ along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 # define gnutls_rnd w32_gnutls_rnd
 #endif
 
-static void sort_vector_copy (Lisp_Object, ptrdiff_t,
-			      Lisp_Object *restrict, Lisp_Object *restrict);
 enum equal_kind { EQUAL_NO_QUIT, EQUAL_PLAIN, EQUAL_INCLUDING_PROPERTIES };
 static bool internal_equal (Lisp_Object, Lisp_Object,
 			    enum equal_kind, int, Lisp_Object);
@@ -1951,144 +1951,529 @@ See also the function `nreverse', which is used more often.  */)
   return new;
 }
 
-/* Sort LIST using PREDICATE, preserving original order of elements
-   considered as equal.  */
+/* Sorting.  `sort' uses TimSort: it finds the runs that are already
+   in order, extends short runs to a minimum length by binary insertion,
+   and merges the runs so that the merges stay balanced.  Sorting data
+   that is already mostly in order therefore takes close to linear
+   time.
 
-static Lisp_Object
-sort_list (Lisp_Object list, Lisp_Object predicate)
+   The sort keys are in one array, and another array of the same
+   length, if any, is permuted along with them.  This way a list is
+   sorted by sorting its cons cells according to their cars, and a
+   sequence sorted with a key function has the key of each element
+   computed only once.  */
+
+/* How two sort keys are compared.  Common predicates are recognized
+   so that they need not be called through Ffuncall.  */
+
+enum sort_order
+  {
+    SORT_PREDICATE,		/* Call the Lisp predicate.  */
+    SORT_LESS,			/* `<'.  */
+    SORT_GREATER,		/* `>'.  */
+    SORT_STRING_LESS		/* `string<'.  */
+  };
+
+/* A run of keys that is in order, starting at BASE.  */
+
+struct sort_run
 {
-  Lisp_Object front, back;
-  Lisp_Object len, tem;
-  EMACS_INT length;
+  ptrdiff_t base, len;
+};
 
-  front = list;
-  len = Flength (list);
-  length = XFIXNUM (len);
-  if (length < 2)
-    return list;
+/* The run stack never holds more runs than this, because the lengths
+   of the runs on it grow at least as fast as the Fibonacci numbers.  */
+
+enum { SORT_MAX_RUNS = 85 };
+
+struct sort_state
+{
+  enum sort_order order;
+  Lisp_Object predicate;
+
+  /* The keys, and the values permuted along with them, or NULL.  */
+  Lisp_Object *keys, *vals;
+
+  /* Temporary storage for merges, large enough for half the keys.  */
+  Lisp_Object *tmp_keys, *tmp_vals;
+
+  /* The runs waiting to be merged.  */
+  struct sort_run runs[SORT_MAX_RUNS];
+  int nruns;
+};
 
-  XSETINT (len, (length / 2) - 1);
-  tem = Fnthcdr (len, list);
-  back = Fcdr (tem);
-  Fsetcdr (tem, Qnil);
+/* Return the way to compare keys with PREDICATE.  */
 
-  front = Fsort (front, predicate);
-  back = Fsort (back, predicate);
-  return merge (front, back, predicate);
+static enum sort_order
+sort_order (Lisp_Object predicate)
+{
+  Lisp_Object fn = SYMBOLP (predicate) ? indirect_function (predicate)
+					: predicate;
+  if (SUBRP (fn))
+    {
+      struct Lisp_Subr *subr = XSUBR (fn);
+      if (subr->max_args == MANY && subr->function.aMANY == Flss)
+	return SORT_LESS;
+      if (subr->max_args == MANY && subr->function.aMANY == Fgtr)
+	return SORT_GREATER;
+      if (subr->max_args == 2 && subr->function.a2 == Fstring_lessp)
+	return SORT_STRING_LESS;
+    }
+  return SORT_PREDICATE;
 }
 
-/* Using PRED to compare, return whether A and B are in order.
-   Compare stably when A appeared before B in the input.  */
+/* Return true if key A sorts before key B.  */
+
 static bool
-inorder (Lisp_Object pred, Lisp_Object a, Lisp_Object b)
+sort_lessp (struct sort_state *s, Lisp_Object a, Lisp_Object b)
 {
-  return NILP (call2 (pred, b, a));
+  switch (s->order)
+    {
+    case SORT_LESS:
+      if (FIXNUMP (a) && FIXNUMP (b))
+	return XFIXNUM (a) < XFIXNUM (b);
+      return !NILP (arithcompare (a, b, ARITH_LESS));
+    case SORT_GREATER:
+      if (FIXNUMP (a) && FIXNUMP (b))
+	return XFIXNUM (a) > XFIXNUM (b);
+      return !NILP (arithcompare (a, b, ARITH_GRTR));
+    case SORT_STRING_LESS:
+      if (STRINGP (a) && STRINGP (b)
+	  && SCHARS (a) == SBYTES (a) && SCHARS (b) == SBYTES (b))
+	{
+	  /* Each byte is a character, so compare the bytes.  */
+	  ptrdiff_t na = SBYTES (a), nb = SBYTES (b);
+	  int cmp = memcmp (SDATA (a), SDATA (b), min (na, nb));
+	  return cmp < 0 || (cmp == 0 && na < nb);
+	}
+      return !NILP (Fstring_lessp (a, b));
+    default:
+      return !NILP (call2 (s->predicate, a, b));
+    }
 }
 
-/* Using PRED to compare, merge from ALEN-length A and BLEN-length B
-   into DEST.  Argument arrays must be nonempty and must not overlap,
-   except that B might be the last part of DEST.  */
+/* Copy the N keys and values of S starting at FROM to TO.  The
+   ranges may overlap.  */
+
 static void
-merge_vectors (Lisp_Object pred,
-	       ptrdiff_t alen, Lisp_Object const a[restrict VLA_ELEMS (alen)],
-	       ptrdiff_t blen, Lisp_Object const b[VLA_ELEMS (blen)],
-	       Lisp_Object dest[VLA_ELEMS (alen + blen)])
+sort_move (struct sort_state *s, ptrdiff_t to, ptrdiff_t from, ptrdiff_t n)
 {
-  eassume (0 < alen && 0 < blen);
-  Lisp_Object const *alim = a + alen;
-  Lisp_Object const *blim = b + blen;
+  memmove (s->keys + to, s->keys + from, n * sizeof *s->keys);
+  if (s->vals)
+    memmove (s->vals + to, s->vals + from, n * sizeof *s->vals);
+}
+
+/* Copy the N keys and values of S starting at FROM to the start of
+   its temporary storage.  */
+
+static void
+sort_save (struct sort_state *s, ptrdiff_t from, ptrdiff_t n)
+{
+  memcpy (s->tmp_keys, s->keys + from, n * sizeof *s->keys);
+  if (s->vals)
+    memcpy (s->tmp_vals, s->vals + from, n * sizeof *s->vals);
+}
 
-  while (true)
+/* Copy the N keys and values starting at FROM in the temporary
+   storage of S back to TO.  */
+
+static void
+sort_restore (struct sort_state *s, ptrdiff_t to, ptrdiff_t from,
+	      ptrdiff_t n)
+{
+  memcpy (s->keys + to, s->tmp_keys + from, n * sizeof *s->keys);
+  if (s->vals)
+    memcpy (s->vals + to, s->tmp_vals + from, n * sizeof *s->vals);
+}
+
+/* Reverse the keys and values from LO up to HI.  */
+
+static void
+sort_reverse (struct sort_state *s, ptrdiff_t lo, ptrdiff_t hi)
+{
+  for (hi--; lo < hi; lo++, hi--)
     {
-      if (inorder (pred, a[0], b[0]))
+      Lisp_Object tem = s->keys[lo];
+      s->keys[lo] = s->keys[hi];
+      s->keys[hi] = tem;
+      if (s->vals)
 	{
-	  *dest++ = *a++;
-	  if (a == alim)
-	    {
-	      if (dest != b)
-		memcpy (dest, b, (blim - b) * sizeof *dest);
-	      return;
-	    }
+	  tem = s->vals[lo];
+	  s->vals[lo] = s->vals[hi];
+	  s->vals[hi] = tem;
+	}
+    }
+}
+
+/* Return the length of the run that starts at LO and ends at HI at
+   the latest.  If it is descending, reverse it first.  Only strictly
+   descending runs are reversed, so that sorting stays stable.  */
+
+static ptrdiff_t
+sort_count_run (struct sort_state *s, ptrdiff_t lo, ptrdiff_t hi)
+{
+  Lisp_Object *keys = s->keys;
+  ptrdiff_t n = 2;
+
+  if (hi - lo < 2)
+    return hi - lo;
+  if (sort_lessp (s, keys[lo + 1], keys[lo]))
+    {
+      while (lo + n < hi && sort_lessp (s, keys[lo + n], keys[lo + n - 1]))
+	n++;
+      sort_reverse (s, lo, lo + n);
+    }
+  else
+    while (lo + n < hi && !sort_lessp (s, keys[lo + n], keys[lo + n - 1]))
+      n++;
+  return n;
+}
+
+/* Return the number of the N keys at KEYS that do not sort after
+   KEY, which must be a prefix of them.  */
+
+static ptrdiff_t
+sort_bisect_right (struct sort_state *s, Lisp_Object key,
+		   Lisp_Object const *keys, ptrdiff_t n)
+{
+  ptrdiff_t lo = 0, hi = n;
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + ((hi - lo) >> 1);
+      if (sort_lessp (s, key, keys[mid]))
+	hi = mid;
+      else
+	lo = mid + 1;
+    }
+  return lo;
+}
+
+/* Return the number of the N keys at KEYS that sort before KEY,
+   which must be a prefix of them.  */
+
+static ptrdiff_t
+sort_bisect_left (struct sort_state *s, Lisp_Object key,
+		  Lisp_Object const *keys, ptrdiff_t n)
+{
+  ptrdiff_t lo = 0, hi = n;
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + ((hi - lo) >> 1);
+      if (sort_lessp (s, keys[mid], key))
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo;
+}
+
+/* Sort the keys from LO up to HI by binary insertion, given that
+   those before START are already sorted.  */
+
+static void
+sort_insertion (struct sort_state *s, ptrdiff_t lo, ptrdiff_t hi,
+		ptrdiff_t start)
+{
+  Lisp_Object *keys = s->keys, *vals = s->vals;
+
+  for (ptrdiff_t i = start; i < hi; i++)
+    {
+      Lisp_Object key = keys[i];
+      Lisp_Object val = vals ? vals[i] : Qnil;
+      ptrdiff_t pos = lo + sort_bisect_right (s, key, keys + lo, i - lo);
+      sort_move (s, pos + 1, pos, i - pos);
+      keys[pos] = key;
+      if (vals)
+	vals[pos] = val;
+    }
+}
+
+/* Merge the NA keys at A with the NB keys at B, which follow them,
+   where NA <= NB.  */
+
+static void
+sort_merge_lo (struct sort_state *s, ptrdiff_t a, ptrdiff_t na,
+	       ptrdiff_t b, ptrdiff_t nb)
+{
+  Lisp_Object *keys = s->keys, *vals = s->vals;
+  Lisp_Object *tkeys = s->tmp_keys, *tvals = s->tmp_vals;
+  ptrdiff_t dest = a, i = 0, blim = b + nb;
+
+  sort_save (s, a, na);
+  while (i < na && b < blim)
+    {
+      ptrdiff_t from;
+      if (sort_lessp (s, keys[b], tkeys[i]))
+	{
+	  from = b++;
+	  keys[dest] = keys[from];
+	  if (vals)
+	    vals[dest] = vals[from];
 	}
       else
 	{
-	  *dest++ = *b++;
-	  if (b == blim)
-	    {
-	      memcpy (dest, a, (alim - a) * sizeof *dest);
-	      return;
-	    }
+	  from = i++;
+	  keys[dest] = tkeys[from];
+	  if (vals)
+	    vals[dest] = tvals[from];
 	}
+      dest++;
     }
+  sort_restore (s, dest, i, na - i);
 }
 
-/* Using PRED to compare, sort LEN-length VEC in place, using TMP for
-   temporary storage.  LEN must be at least 2.  */
+/* Merge the NA keys at A with the NB keys at B, which follow them,
+   where NA > NB.  */
+
 static void
-sort_vector_inplace (Lisp_Object pred, ptrdiff_t len,
-		     Lisp_Object vec[restrict VLA_ELEMS (len)],
-		     Lisp_Object tmp[restrict VLA_ELEMS (len >> 1)])
+sort_merge_hi (struct sort_state *s, ptrdiff_t a, ptrdiff_t na,
+	       ptrdiff_t b, ptrdiff_t nb)
 {
-  eassume (2 <= len);
-  ptrdiff_t halflen = len >> 1;
-  sort_vector_copy (pred, halflen, vec, tmp);
-  if (1 < len - halflen)
-    sort_vector_inplace (pred, len - halflen, vec + halflen, vec);
-  merge_vectors (pred, halflen, tmp, len - halflen, vec + halflen, vec);
+  Lisp_Object *keys = s->keys, *vals = s->vals;
+  Lisp_Object *tkeys = s->tmp_keys, *tvals = s->tmp_vals;
+  ptrdiff_t dest = b + nb, i = nb, alim = a + na;
+
+  sort_save (s, b, nb);
+  while (0 < i && a < alim)
+    {
+      dest--;
+      if (sort_lessp (s, tkeys[i - 1], keys[alim - 1]))
+	{
+	  alim--;
+	  keys[dest] = keys[alim];
+	  if (vals)
+	    vals[dest] = vals[alim];
+	}
+      else
+	{
+	  i--;
+	  keys[dest] = tkeys[i];
+	  if (vals)
+	    vals[dest] = tvals[i];
+	}
+    }
+  sort_restore (s, a, 0, i);
 }
 
-/* Using PRED to compare, sort from LEN-length SRC into DST.
-   Len must be positive.  */
+/* Merge the runs at positions N and N + 1 of the run stack of S.  */
+
 static void
-sort_vector_copy (Lisp_Object pred, ptrdiff_t len,
-		  Lisp_Object src[restrict VLA_ELEMS (len)],
-		  Lisp_Object dest[restrict VLA_ELEMS (len)])
-{
-  eassume (0 < len);
-  ptrdiff_t halflen = len >> 1;
-  if (halflen < 1)
-    dest[0] = src[0];
+sort_merge_at (struct sort_state *s, int n)
+{
+  ptrdiff_t a = s->runs[n].base, na = s->runs[n].len;
+  ptrdiff_t b = s->runs[n + 1].base, nb = s->runs[n + 1].len;
+
+  s->runs[n].len = na + nb;
+  if (n == s->nruns - 3)
+    s->runs[n + 1] = s->runs[n + 2];
+  s->nruns--;
+
+  /* The keys of A that do not sort after the first key of B, and the
+     keys of B that sort after the last key of A, are in place
+     already.  */
+  ptrdiff_t k = sort_bisect_right (s, s->keys[b], s->keys + a, na);
+  a += k;
+  na -= k;
+  if (na == 0)
+    return;
+  nb = sort_bisect_left (s, s->keys[a + na - 1], s->keys + b, nb);
+  if (nb == 0)
+    return;
+
+  if (na <= nb)
+    sort_merge_lo (s, a, na, b, nb);
   else
+    sort_merge_hi (s, a, na, b, nb);
+}
+
+/* Merge runs of S until the lengths of those on the stack satisfy the
+   TimSort invariants again.  */
+
+static void
+sort_merge_collapse (struct sort_state *s)
+{
+  struct sort_run *runs = s->runs;
+
+  while (1 < s->nruns)
+    {
+      int n = s->nruns - 2;
+      if ((0 < n && runs[n - 1].len <= runs[n].len + runs[n + 1].len)
+	  || (1 < n && runs[n - 2].len <= runs[n - 1].len + runs[n].len))
+	{
+	  if (runs[n - 1].len < runs[n + 1].len)
+	    n--;
+	  sort_merge_at (s, n);
+	}
+      else if (runs[n].len <= runs[n + 1].len)
+	sort_merge_at (s, n);
+      else
+	break;
+    }
+}
+
+/* Return the minimum length of a run for sorting N keys: a number
+   close to 32 that makes N divided by it a power of two or slightly
+   less.  */
+
+static ptrdiff_t
+sort_min_run (ptrdiff_t n)
+{
+  ptrdiff_t r = 0;
+  while (64 <= n)
+    {
+      r |= n & 1;
+      n >>= 1;
+    }
+  return n + r;
+}
+
+/* Using PREDICATE to compare, sort the N keys at KEYS stably,
+   permuting the values at VALS along with them unless VALS is NULL.
+   KEYS and VALS must be protected from GC.  */
+
+static void
+tim_sort (Lisp_Object predicate, Lisp_Object *keys, Lisp_Object *vals,
+	  ptrdiff_t n)
+{
+  struct sort_state s;
+  USE_SAFE_ALLOCA;
+
+  if (n < 2)
+    return;
+
+  s.order = sort_order (predicate);
+  s.predicate = predicate;
+  s.keys = keys;
+  s.vals = vals;
+  s.nruns = 0;
+  ptrdiff_t ntmp = n >> 1;
+  SAFE_ALLOCA_LISP (s.tmp_keys, vals ? 2 * ntmp : ntmp);
+  for (ptrdiff_t i = 0; i < (vals ? 2 * ntmp : ntmp); i++)
+    s.tmp_keys[i] = make_fixnum (0);
+  s.tmp_vals = vals ? s.tmp_keys + ntmp : NULL;
+
+  ptrdiff_t min_run = sort_min_run (n);
+  for (ptrdiff_t lo = 0; lo < n; )
+    {
+      ptrdiff_t len = sort_count_run (&s, lo, n);
+      if (len < min_run)
+	{
+	  ptrdiff_t force = min (min_run, n - lo);
+	  sort_insertion (&s, lo, lo + force, lo + len);
+	  len = force;
+	}
+      eassert (s.nruns < SORT_MAX_RUNS);
+      s.runs[s.nruns].base = lo;
+      s.runs[s.nruns].len = len;
+      s.nruns++;
+      sort_merge_collapse (&s);
+      lo += len;
+      maybe_quit ();
+    }
+
+  while (1 < s.nruns)
     {
-      if (1 < halflen)
-	sort_vector_inplace (pred, halflen, src, dest);
-      if (1 < len - halflen)
-	sort_vector_inplace (pred, len - halflen, src + halflen, dest);
-      merge_vectors (pred, halflen, src, len - halflen, src + halflen, dest);
+      int i = s.nruns - 2;
+      if (0 < i && s.runs[i - 1].len < s.runs[i + 1].len)
+	i--;
+      sort_merge_at (&s, i);
     }
+
+  SAFE_FREE ();
+}
+
+/* Replace each of the N elements at KEYS with the value of KEY for
+   it.  KEYS must be protected from GC.  */
+
+static void
+sort_compute_keys (Lisp_Object key, Lisp_Object *keys, ptrdiff_t n)
+{
+  for (ptrdiff_t i = 0; i < n; i++)
+    keys[i] = call1 (key, keys[i]);
+}
+
+/* Sort LIST using PREDICATE, preserving original order of elements
+   considered as equal.  If KEY is non-nil, compare the values of KEY
+   for the elements instead.  */
+
+static Lisp_Object
+sort_list (Lisp_Object list, Lisp_Object predicate, Lisp_Object key)
+{
+  EMACS_INT length = XFIXNUM (Flength (list));
+  if (length < 2)
+    return list;
+
+  /* Sort the cons cells, so that their cars stay the same.  */
+  Lisp_Object *keys, *cells;
+  USE_SAFE_ALLOCA;
+  SAFE_ALLOCA_LISP (keys, 2 * length);
+  cells = keys + length;
+  Lisp_Object tail = list;
+  for (ptrdiff_t i = 0; i < length; i++, tail = XCDR (tail))
+    {
+      keys[i] = XCAR (tail);
+      cells[i] = tail;
+    }
+  if (!NILP (key))
+    sort_compute_keys (key, keys, length);
+  tim_sort (predicate, keys, cells, length);
+
+  for (ptrdiff_t i = 0; i < length - 1; i++)
+    XSETCDR (cells[i], cells[i + 1]);
+  XSETCDR (cells[length - 1], Qnil);
+  list = cells[0];
+  SAFE_FREE ();
+  return list;
+}
+
+/* Using PRED to compare, return whether A and B are in order.
+   Compare stably when A appeared before B in the input.  */
+static bool
+inorder (Lisp_Object pred, Lisp_Object a, Lisp_Object b)
+{
+  return NILP (call2 (pred, b, a));
 }
 
 /* Sort VECTOR in place using PREDICATE, preserving original order of
-   elements considered as equal.  */
+   elements considered as equal.  If KEY is non-nil, compare the
+   values of KEY for the elements instead.  */
 
 static void
-sort_vector (Lisp_Object vector, Lisp_Object predicate)
+sort_vector (Lisp_Object vector, Lisp_Object predicate, Lisp_Object key)
 {
   ptrdiff_t len = ASIZE (vector);
   if (len < 2)
     return;
-  ptrdiff_t halflen = len >> 1;
-  Lisp_Object *tmp;
-  USE_SAFE_ALLOCA;
-  SAFE_ALLOCA_LISP (tmp, halflen);
-  for (ptrdiff_t i = 0; i < halflen; i++)
-    tmp[i] = make_fixnum (0);
-  sort_vector_inplace (predicate, len, XVECTOR (vector)->contents, tmp);
-  SAFE_FREE ();
+  if (NILP (key))
+    tim_sort (predicate, XVECTOR (vector)->contents, NULL, len);
+  else
+    {
+      Lisp_Object *keys;
+      USE_SAFE_ALLOCA;
+      SAFE_ALLOCA_LISP (keys, len);
+      memcpy (keys, XVECTOR (vector)->contents, len * sizeof *keys);
+      sort_compute_keys (key, keys, len);
+      tim_sort (predicate, keys, XVECTOR (vector)->contents, len);
+      SAFE_FREE ();
+    }
 }
 
-DEFUN ("sort", Fsort, Ssort, 2, 2, 0,
+DEFUN ("sort", Fsort, Ssort, 2, 3, 0,
        doc: /* Sort SEQ, stably, comparing elements using PREDICATE.
 Returns the sorted sequence.  SEQ should be a list or vector.  SEQ is
 modified by side effects.  PREDICATE is called with two elements of
 SEQ, and should return non-nil if the first element should sort before
-the second.  */)
-  (Lisp_Object seq, Lisp_Object predicate)
+the second.
+
+If KEY is non-nil, it should be a function of one argument.  It is
+called once for each element of SEQ, and PREDICATE compares the values
+it returns instead of the elements themselves.  */)
+  (Lisp_Object seq, Lisp_Object predicate, Lisp_Object key)
 {
   if (CONSP (seq))
-    seq = sort_list (seq, predicate);
+    seq = sort_list (seq, predicate, key);
   else if (VECTORP (seq))
-    sort_vector (seq, predicate);
+    sort_vector (seq, predicate, key);
   else if (!NILP (seq))
     wrong_type_argument (Qsequencep, seq);
   return seq;
@@ -2753,6 +3138,196 @@ SEQUENCE may be a list, a vector, a bool-vector, or a string. */)
   return ret;
 }
 
+/* String builders.  */
+
+/* Make room in the string builder B for NBYTES more bytes of text,
+   and make its text multibyte if MULTIBYTE.  This may garbage
+   collect.  */
+
+static void
+string_builder_reserve (struct Lisp_String_Builder *b, ptrdiff_t nbytes,
+			bool multibyte)
+{
+  Lisp_Object storage = b->storage;
+  bool convert = multibyte && !STRING_MULTIBYTE (storage);
+  ptrdiff_t used = (convert
+		    ? count_size_as_multibyte (SDATA (storage), b->nbytes)
+		    : b->nbytes);
+  ptrdiff_t capacity = SBYTES (storage);
+  ptrdiff_t needed;
+
+  if (INT_ADD_WRAPV (used, nbytes, &needed) || STRING_BYTES_BOUND < needed)
+    string_overflow ();
+  if (!convert && needed <= capacity)
+    return;
+
+  /* Grow geometrically, so that appending takes amortized constant
+     time per byte.  */
+  if (capacity < needed)
+    capacity = max (needed, min (capacity, STRING_BYTES_BOUND / 2) * 2);
+  Lisp_Object new = (multibyte
+		     ? make_uninit_multibyte_string (capacity, capacity)
+		     : make_uninit_string (capacity));
+  copy_text (SDATA (b->storage), SDATA (new), b->nbytes,
+	     STRING_MULTIBYTE (b->storage), multibyte);
+  b->storage = new;
+  b->nbytes = used;
+}
+
+/* Append STRING, without its text properties, to the string builder B.
+   As with `concat', the text becomes multibyte if STRING is.  */
+
+static void
+string_builder_append_string (struct Lisp_String_Builder *b,
+			      Lisp_Object string)
+{
+  bool multibyte = STRING_MULTIBYTE (b->storage) || STRING_MULTIBYTE (string);
+  ptrdiff_t nbytes = SBYTES (string);
+  if (multibyte && !STRING_MULTIBYTE (string))
+    nbytes = count_size_as_multibyte (SDATA (string), nbytes);
+  string_builder_reserve (b, nbytes, multibyte);
+  b->nbytes += copy_text (SDATA (string), SDATA (b->storage) + b->nbytes,
+			  SBYTES (string), STRING_MULTIBYTE (string),
+			  multibyte);
+  b->nchars += SCHARS (string);
+}
+
+/* Append the character C to the string builder B.  The text stays
+   unibyte if C is an ASCII character or a raw byte.  */
+
+static void
+string_builder_append_char (struct Lisp_String_Builder *b, int c)
+{
+  unsigned char str[MAX_MULTIBYTE_LENGTH];
+  bool multibyte = (STRING_MULTIBYTE (b->storage)
+		    || ! (ASCII_CHAR_P (c) || CHAR_BYTE8_P (c)));
+  int len;
+
+  if (multibyte)
+    len = CHAR_STRING (c, str);
+  else
+    {
+      str[0] = CHAR_TO_BYTE8 (c);
+      len = 1;
+    }
+  string_builder_reserve (b, len, multibyte);
+  memcpy (SDATA (b->storage) + b->nbytes, str, len);
+  b->nbytes += len;
+  b->nchars++;
+}
+
+DEFUN ("make-string-builder", Fmake_string_builder, Smake_string_builder,
+       0, 1, 0,
+       doc: /* Return a new, empty string builder.
+A string builder accumulates text that is appended to it with
+`string-builder-append'.  Unlike repeated calls to `concat', this takes
+time proportional to the total length of the text.  Use
+`string-builder-string' to get the text as a string, and
+`insert-string-builder' to insert it into a buffer.
+
+CAPACITY, if non-nil, is the number of bytes of text for which to
+reserve room initially.  */)
+  (Lisp_Object capacity)
+{
+  ptrdiff_t nbytes = 64;
+  if (!NILP (capacity))
+    {
+      CHECK_FIXNAT (capacity);
+      if (STRING_BYTES_BOUND < XFIXNAT (capacity))
+	string_overflow ();
+      nbytes = XFIXNAT (capacity);
+    }
+  return make_string_builder (nbytes);
+}
+
+DEFUN ("string-builder-p", Fstring_builder_p, Sstring_builder_p, 1, 1, 0,
+       doc: /* Return t if OBJECT is a string builder.  */)
+  (Lisp_Object object)
+{
+  return STRING_BUILDERP (object) ? Qt : Qnil;
+}
+
+DEFUN ("string-builder-append", Fstring_builder_append,
+       Sstring_builder_append, 1, MANY, 0,
+       doc: /* Append OBJECTS to the text of the string builder BUILDER.
+Each of OBJECTS must be a string or a character.  The text properties
+of strings are not kept.  Return BUILDER.
+usage: (string-builder-append BUILDER &rest OBJECTS)  */)
+  (ptrdiff_t nargs, Lisp_Object *args)
+{
+  Lisp_Object builder = args[0];
+  CHECK_STRING_BUILDER (builder);
+  struct Lisp_String_Builder *b = XSTRING_BUILDER (builder);
+
+  for (ptrdiff_t i = 1; i < nargs; i++)
+    {
+      Lisp_Object obj = args[i];
+      if (STRINGP (obj))
+	string_builder_append_string (b, obj);
+      else if (CHARACTERP (obj))
+	string_builder_append_char (b, XFIXNAT (obj));
+      else
+	wrong_type_argument (Qchar_or_string_p, obj);
+    }
+  return builder;
+}
+
+DEFUN ("string-builder-string", Fstring_builder_string,
+       Sstring_builder_string, 1, 1, 0,
+       doc: /* Return a new string containing the text of BUILDER.
+BUILDER is left unchanged, and more text can be appended to it.  */)
+  (Lisp_Object builder)
+{
+  CHECK_STRING_BUILDER (builder);
+  struct Lisp_String_Builder *b = XSTRING_BUILDER (builder);
+  return make_specified_string ((char *) SDATA (b->storage), b->nchars,
+				b->nbytes, STRING_MULTIBYTE (b->storage));
+}
+
+DEFUN ("string-builder-length", Fstring_builder_length,
+       Sstring_builder_length, 1, 1, 0,
+       doc: /* Return the number of characters in the text of BUILDER.  */)
+  (Lisp_Object builder)
+{
+  CHECK_STRING_BUILDER (builder);
+  return make_fixnum (XSTRING_BUILDER (builder)->nchars);
+}
+
+DEFUN ("string-builder-clear", Fstring_builder_clear,
+       Sstring_builder_clear, 1, 1, 0,
+       doc: /* Make the text of BUILDER empty, and return BUILDER.
+The room reserved for the text is kept, so that BUILDER can be reused
+without allocating memory again.  */)
+  (Lisp_Object builder)
+{
+  CHECK_STRING_BUILDER (builder);
+  struct Lisp_String_Builder *b = XSTRING_BUILDER (builder);
+
+  /* Don't change the multibyteness of the string in place, as it may
+     be in the middle of being inserted by `insert-string-builder'.  */
+  if (STRING_MULTIBYTE (b->storage))
+    b->storage = make_uninit_string (SBYTES (b->storage));
+  b->nchars = b->nbytes = 0;
+  return builder;
+}
+
+DEFUN ("insert-string-builder", Finsert_string_builder,
+       Sinsert_string_builder, 1, 1, 0,
+       doc: /* Insert the text of BUILDER at point in the current buffer.
+Point and after-insertion markers advance as with `insert'.  The text
+is copied directly into the buffer, without making a string first.  */)
+  (Lisp_Object builder)
+{
+  CHECK_STRING_BUILDER (builder);
+  struct Lisp_String_Builder *b = XSTRING_BUILDER (builder);
+
+  /* The storage string has no text properties, and only its first
+     NCHARS characters are inserted.  */
+  if (b->nchars > 0)
+    insert_from_string (b->storage, 0, 0, b->nchars, b->nbytes, false);
+  return Qnil;
+}
+
 /* This is how C code calls `yes-or-no-p' and allows the user
    to redefine it.  */
 
@@ -3705,6 +4280,11 @@ set_hash_index_slot (struct Lisp_Hash_Table *h, ptrdiff_t idx, ptrdiff_t val)
 {
   gc_aset (h->index, idx, make_fixnum (val));
 }
+static void
+set_hash_ctrl (struct Lisp_Hash_Table *h, Lisp_Object ctrl)
+{
+  h->ctrl = ctrl;
+}
 
 /* If OBJ is a Lisp hash table, return a pointer to its struct
    Lisp_Hash_Table.  Otherwise, signal an error.  */
@@ -3809,8 +4389,8 @@ HASH_NEXT (struct Lisp_Hash_Table *h, ptrdiff_t idx)
   return XFIXNUM (AREF (h->next, idx));
 }
 
-/* Return the index of the element in hash table H that is the start
-   of the collision list at index IDX, or -1 if the list is empty.  */
+/* Return the number of the entry stored in slot IDX of the index of
+   hash table H.  The slot must be in use.  */
 
 static ptrdiff_t
 HASH_INDEX (struct Lisp_Hash_Table *h, ptrdiff_t idx)
@@ -3818,6 +4398,261 @@ HASH_INDEX (struct Lisp_Hash_Table *h, ptrdiff_t idx)
   return XFIXNUM (AREF (h->index, idx));
 }
 
+/* The index of a hash table is an open-addressing table whose slots
+   hold entry numbers.  Each slot also has a control byte, and the
+   control bytes of HASH_GROUP_WIDTH consecutive slots are loaded into
+   a single word and compared all at once.  A lookup thus usually
+   touches one word of control bytes, one slot and one key, instead of
+   following a collision chain through the index, next and hash
+   vectors.  */
+
+enum { HASH_GROUP_WIDTH = 8 };
+
+/* Control bytes of empty and deleted slots.  The control byte of a
+   slot in use is in the range 0..127.  */
+
+enum { HASH_CTRL_EMPTY = 0x80, HASH_CTRL_DELETED = 0xfe };
+
+typedef uint64_t hash_group;
+
+static hash_group const hash_group_lsbs = 0x0101010101010101;
+static hash_group const hash_group_msbs = 0x8080808080808080;
+
+/* Return the number of slots in the index of H, a power of two.  This
+   works during GC too.  */
+
+static ptrdiff_t
+hash_index_size (struct Lisp_Hash_Table *h)
+{
+  return gc_asize (h->index);
+}
+
+/* Return the control bytes of H.  */
+
+static unsigned char *
+hash_ctrl (struct Lisp_Hash_Table *h)
+{
+  return bool_vector_uchar_data (h->ctrl);
+}
+
+/* Mix the bits of hash code HASH.  The hash codes of `eq' tables are
+   mostly addresses whose low bits hardly vary, so both the slot where
+   probing starts and the control byte must depend on all bits.  */
+
+static uint64_t
+hash_mix (EMACS_UINT hash)
+{
+  return (uint64_t) hash * 0x9e3779b97f4a7c15;
+}
+
+/* Return the first slot to probe for mixed hash code X in an index
+   with MASK + 1 slots.  */
+
+static ptrdiff_t
+hash_probe_start (uint64_t x, ptrdiff_t mask)
+{
+  return (x ^ (x >> 32)) & mask;
+}
+
+/* Return the control byte for mixed hash code X.  */
+
+static unsigned char
+hash_ctrl_byte (uint64_t x)
+{
+  return x >> 57;
+}
+
+/* Return the group of control bytes starting at CTRL, with the byte
+   at CTRL in the least significant position.  */
+
+static hash_group
+hash_load_group (unsigned char const *ctrl)
+{
+  hash_group g;
+  memcpy (&g, ctrl, sizeof g);
+#ifdef WORDS_BIGENDIAN
+  g = bswap_64 (g);
+#endif
+  return g;
+}
+
+/* Return a mask with the high bit set in each byte of group G that
+   may be equal to control byte C.  There may be false positives, but
+   only for slots in use.  */
+
+static hash_group
+hash_group_match (hash_group g, unsigned char c)
+{
+  hash_group x = g ^ (hash_group_lsbs * c);
+  return (x - hash_group_lsbs) & ~x & hash_group_msbs;
+}
+
+/* Return a mask with the high bit set in each byte of group G that is
+   HASH_CTRL_EMPTY.  */
+
+static hash_group
+hash_group_match_empty (hash_group g)
+{
+  return g & ~(g << 6) & hash_group_msbs;
+}
+
+/* Return a mask with the high bit set in each byte of group G that is
+   HASH_CTRL_EMPTY or HASH_CTRL_DELETED.  */
+
+static hash_group
+hash_group_match_free (hash_group g)
+{
+  return g & ~(g << 7) & hash_group_msbs;
+}
+
+/* Return the offset within its group of the first byte selected by
+   the nonzero mask M.  */
+
+static int
+hash_group_first (hash_group m)
+{
+  verify (sizeof m <= sizeof (unsigned long long));
+  return count_trailing_zeros_ll (m) / CHAR_BIT;
+}
+
+/* Set the control byte of slot IDX of H to C, keeping the copy of the
+   first group at the end of the control bytes up to date.  */
+
+static void
+hash_set_ctrl (struct Lisp_Hash_Table *h, ptrdiff_t idx, unsigned char c)
+{
+  unsigned char *ctrl = hash_ctrl (h);
+  ctrl[idx] = c;
+  if (idx < HASH_GROUP_WIDTH)
+    ctrl[hash_index_size (h) + idx] = c;
+}
+
+/* Return the first empty or deleted slot of H on the probe sequence
+   of mixed hash code X.  */
+
+static ptrdiff_t
+hash_find_free_slot (struct Lisp_Hash_Table *h, uint64_t x)
+{
+  ptrdiff_t mask = hash_index_size (h) - 1;
+  ptrdiff_t start = hash_probe_start (x, mask);
+
+  for (ptrdiff_t step = HASH_GROUP_WIDTH; ; step += HASH_GROUP_WIDTH)
+    {
+      hash_group m = hash_group_match_free (hash_load_group (hash_ctrl (h)
+							      + start));
+      if (m)
+	return (start + hash_group_first (m)) & mask;
+      start = (start + step) & mask;
+    }
+}
+
+/* Return the slot of H that holds entry IDX, which must be in use.  */
+
+static ptrdiff_t
+hash_entry_slot (struct Lisp_Hash_Table *h, ptrdiff_t idx)
+{
+  uint64_t x = hash_mix (XUFIXNUM (HASH_HASH (h, idx)));
+  unsigned char c = hash_ctrl_byte (x);
+  ptrdiff_t mask = hash_index_size (h) - 1;
+  ptrdiff_t start = hash_probe_start (x, mask);
+
+  for (ptrdiff_t step = HASH_GROUP_WIDTH; ; step += HASH_GROUP_WIDTH)
+    {
+      hash_group g = hash_load_group (hash_ctrl (h) + start);
+      for (hash_group m = hash_group_match (g, c); m; m &= m - 1)
+	{
+	  ptrdiff_t slot = (start + hash_group_first (m)) & mask;
+	  if (HASH_INDEX (h, slot) == idx)
+	    return slot;
+	}
+      eassert (!hash_group_match_empty (g));
+      start = (start + step) & mask;
+    }
+}
+
+/* Mark all slots of the index of H as empty.  */
+
+static void
+hash_index_clear (struct Lisp_Hash_Table *h)
+{
+  ptrdiff_t n = hash_index_size (h);
+  memset (hash_ctrl (h), HASH_CTRL_EMPTY, n + HASH_GROUP_WIDTH);
+  h->index_empty = n;
+}
+
+/* Give H a new index with INDEX_SIZE slots.  Its contents are
+   undefined until it is cleared or rebuilt.  */
+
+static void
+hash_index_alloc (struct Lisp_Hash_Table *h, ptrdiff_t index_size)
+{
+  set_hash_index (h, Fmake_vector (make_fixnum (index_size),
+				   make_fixnum (-1)));
+  set_hash_ctrl (h, make_uninit_bool_vector ((index_size + HASH_GROUP_WIDTH)
+					     * BOOL_VECTOR_BITS_PER_CHAR));
+}
+
+/* Recompute the index of H from its entries.  This also gets rid of
+   all deleted slots.  */
+
+static void
+hash_index_rebuild (struct Lisp_Hash_Table *h)
+{
+  ptrdiff_t size = HASH_TABLE_SIZE (h);
+
+  hash_index_clear (h);
+  for (ptrdiff_t i = 0; i < size; ++i)
+    if (!NILP (HASH_HASH (h, i)))
+      {
+	uint64_t x = hash_mix (XUFIXNUM (HASH_HASH (h, i)));
+	ptrdiff_t slot = hash_find_free_slot (h, x);
+	hash_set_ctrl (h, slot, hash_ctrl_byte (x));
+	set_hash_index_slot (h, slot, i);
+	h->index_empty--;
+      }
+  eassert (0 < h->index_empty);
+}
+
+/* Add entry IDX of H, whose hash code HASH is already recorded, to
+   the index of H.  */
+
+static void
+hash_index_insert (struct Lisp_Hash_Table *h, ptrdiff_t idx, EMACS_UINT hash)
+{
+  uint64_t x = hash_mix (hash);
+  ptrdiff_t slot = hash_find_free_slot (h, x);
+
+  if (hash_ctrl (h)[slot] == HASH_CTRL_EMPTY)
+    {
+      /* Keep at least one slot empty.  If this one is the last, the
+	 index is full of deleted slots; rebuilding it adds IDX too.  */
+      if (h->index_empty == 1)
+	{
+	  hash_index_rebuild (h);
+	  return;
+	}
+      h->index_empty--;
+    }
+  hash_set_ctrl (h, slot, hash_ctrl_byte (x));
+  set_hash_index_slot (h, slot, idx);
+}
+
+/* Put entry IDX of H on the free list and clear its key, value and
+   hash code.  The entry must already have been taken out of the
+   index.  */
+
+static void
+hash_free_entry (struct Lisp_Hash_Table *h, ptrdiff_t idx)
+{
+  set_hash_key_slot (h, idx, Qnil);
+  set_hash_value_slot (h, idx, Qnil);
+  set_hash_hash_slot (h, idx, Qnil);
+  set_hash_next_slot (h, idx, h->next_free);
+  h->next_free = idx;
+  h->count--;
+  eassert (h->count >= 0);
+}
+
 /* Compare KEY1 and KEY2 in hash table HT using `eql'.  Value is true
    if KEY1 and KEY2 are the same.  KEY1 and KEY2 must not be eq.  */
 
@@ -3924,6 +4759,26 @@ allocate_hash_table (void)
 #define INDEX_SIZE_BOUND \
   ((ptrdiff_t) min (MOST_POSITIVE_FIXNUM, PTRDIFF_MAX / word_size))
 
+/* Return the number of index slots for a hash table with SIZE entries
+   and rehash threshold THRESHOLD.  This is the smallest power of two
+   that is larger than SIZE and not less than SIZE / THRESHOLD, or
+   INDEX_SIZE_BOUND + 1 if that would be too large.  */
+
+static EMACS_INT
+hash_index_size_for (EMACS_INT size, double threshold)
+{
+  double index_float = size / threshold;
+  EMACS_INT index_size = HASH_GROUP_WIDTH;
+
+  while (index_size <= size || index_size < index_float)
+    {
+      if (INDEX_SIZE_BOUND / 2 < index_size)
+	return INDEX_SIZE_BOUND + 1;
+      index_size *= 2;
+    }
+  return index_size;
+}
+
 /* Create and initialize a new hash table.
 
    TEST specifies the test the hash table will use to compare keys.
@@ -3959,7 +4814,6 @@ make_hash_table (struct hash_table_test test, EMACS_INT size,
   Lisp_Object table;
   EMACS_INT index_size;
   ptrdiff_t i;
-  double index_float;
 
   /* Preconditions.  */
   eassert (SYMBOLP (test.name));
@@ -3970,11 +4824,7 @@ make_hash_table (struct hash_table_test test, EMACS_INT size,
   if (size == 0)
     size = 1;
 
-  double threshold = rehash_threshold;
-  index_float = size / threshold;
-  index_size = (index_float < INDEX_SIZE_BOUND + 1
-		? next_almost_prime (index_float)
-		: INDEX_SIZE_BOUND + 1);
+  index_size = hash_index_size_for (size, rehash_threshold);
   if (INDEX_SIZE_BOUND < max (index_size, 2 * size))
     error ("Hash table too large");
 
@@ -3990,7 +4840,8 @@ make_hash_table (struct hash_table_test test, EMACS_INT size,
   h->key_and_value = Fmake_vector (make_fixnum (2 * size), Qnil);
   h->hash = Fmake_vector (make_fixnum (size), Qnil);
   h->next = Fmake_vector (make_fixnum (size), make_fixnum (-1));
-  h->index = Fmake_vector (make_fixnum (index_size), make_fixnum (-1));
+  hash_index_alloc (h, index_size);
+  hash_index_clear (h);
   h->pure = pure;
 
   /* Set up the free list.  */
@@ -4028,6 +4879,7 @@ copy_hash_table (struct Lisp_Hash_Table *h1)
   h2->hash = Fcopy_sequence (h1->hash);
   h2->next = Fcopy_sequence (h1->next);
   h2->index = Fcopy_sequence (h1->index);
+  h2->ctrl = Fcopy_sequence (h1->ctrl);
   XSET_HASH_TABLE (table, h2);
 
   /* Maybe add this hash table to the list of all weak hash tables.  */
@@ -4053,7 +4905,6 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
       EMACS_INT new_size, index_size, nsize;
       ptrdiff_t i;
       double rehash_size = h->rehash_size;
-      double index_float;
 
       if (rehash_size < 0)
 	new_size = old_size - rehash_size;
@@ -4067,11 +4918,7 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
 	}
       if (new_size <= old_size)
 	new_size = old_size + 1;
-      double threshold = h->rehash_threshold;
-      index_float = new_size / threshold;
-      index_size = (index_float < INDEX_SIZE_BOUND + 1
-		    ? next_almost_prime (index_float)
-		    : INDEX_SIZE_BOUND + 1);
+      index_size = hash_index_size_for (new_size, h->rehash_threshold);
       nsize = max (index_size, 2 * new_size);
       if (INDEX_SIZE_BOUND < nsize)
 	error ("Hash table too large to resize");
@@ -4085,8 +4932,7 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
       set_hash_key_and_value (h, larger_vector (h->key_and_value,
 						2 * (new_size - old_size), -1));
       set_hash_hash (h, larger_vector (h->hash, new_size - old_size, -1));
-      set_hash_index (h, Fmake_vector (make_fixnum (index_size),
-				       make_fixnum (-1)));
+      hash_index_alloc (h, index_size);
       set_hash_next (h, larger_vecalloc (h->next, new_size - old_size, -1));
 
       /* Update the free list.  Do it so that new entries are added at
@@ -4112,15 +4958,49 @@ maybe_resize_hash_table (struct Lisp_Hash_Table *h)
 	}
 
       /* Rehash.  */
-      for (i = 0; i < old_size; ++i)
-	if (!NILP (HASH_HASH (h, i)))
-	  {
-	    EMACS_UINT hash_code = XUFIXNUM (HASH_HASH (h, i));
-	    ptrdiff_t start_of_bucket = hash_code % ASIZE (h->index);
-	    set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-	    set_hash_index_slot (h, start_of_bucket, i);
-	  }
+      hash_index_rebuild (h);
+    }
+}
+
+
+/* Lookup KEY, whose hash code is HASH, in hash table H.  Value is
+   the index of the entry in H matching KEY, or -1 if not found.  If
+   found, set *SLOT to the index slot that holds the entry.  */
+
+static ptrdiff_t
+hash_lookup_1 (struct Lisp_Hash_Table *h, Lisp_Object key, EMACS_UINT hash,
+	       ptrdiff_t *slot)
+{
+  uint64_t x = hash_mix (hash);
+  unsigned char c = hash_ctrl_byte (x);
+  ptrdiff_t mask = hash_index_size (h) - 1;
+  ptrdiff_t start = hash_probe_start (x, mask);
+
+  /* The probe sequence visits every group once.  Bound it all the
+     same, in case a user-defined test modifies the table.  */
+  for (ptrdiff_t step = HASH_GROUP_WIDTH; step <= mask + 1;
+       step += HASH_GROUP_WIDTH)
+    {
+      hash_group g = hash_load_group (hash_ctrl (h) + start);
+      for (hash_group m = hash_group_match (g, c); m; m &= m - 1)
+	{
+	  ptrdiff_t s = (start + hash_group_first (m)) & mask;
+	  ptrdiff_t i = HASH_INDEX (h, s);
+	  if (EQ (key, HASH_KEY (h, i))
+	      || (h->test.cmpfn
+		  && hash == XUFIXNUM (HASH_HASH (h, i))
+		  && h->test.cmpfn (&h->test, key, HASH_KEY (h, i))))
+	    {
+	      *slot = s;
+	      return i;
+	    }
+	}
+      if (hash_group_match_empty (g))
+	break;
+      start = (start + step) & mask;
     }
+
+  return -1;
 }
 
 
@@ -4132,23 +5012,14 @@ ptrdiff_t
 hash_lookup (struct Lisp_Hash_Table *h, Lisp_Object key, EMACS_UINT *hash)
 {
   EMACS_UINT hash_code;
-  ptrdiff_t start_of_bucket, i;
+  ptrdiff_t slot;
 
   hash_code = h->test.hashfn (&h->test, key);
   eassert ((hash_code & ~INTMASK) == 0);
   if (hash)
     *hash = hash_code;
 
-  start_of_bucket = hash_code % ASIZE (h->index);
-
-  for (i = HASH_INDEX (h, start_of_bucket); 0 <= i; i = HASH_NEXT (h, i))
-    if (EQ (key, HASH_KEY (h, i))
-	|| (h->test.cmpfn
-	    && hash_code == XUFIXNUM (HASH_HASH (h, i))
-	    && h->test.cmpfn (&h->test, key, HASH_KEY (h, i))))
-      break;
-
-  return i;
+  return hash_lookup_1 (h, key, hash_code, &slot);
 }
 
 
@@ -4160,7 +5031,7 @@ ptrdiff_t
 hash_put (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object value,
 	  EMACS_UINT hash)
 {
-  ptrdiff_t start_of_bucket, i;
+  ptrdiff_t i;
 
   eassert ((hash & ~INTMASK) == 0);
 
@@ -4171,16 +5042,15 @@ hash_put (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object value,
   /* Store key/value in the key_and_value vector.  */
   i = h->next_free;
   h->next_free = HASH_NEXT (h, i);
+  set_hash_next_slot (h, i, -1);
   set_hash_key_slot (h, i, key);
   set_hash_value_slot (h, i, value);
 
   /* Remember its hash code.  */
   set_hash_hash_slot (h, i, make_fixnum (hash));
 
-  /* Add new entry to its collision chain.  */
-  start_of_bucket = hash % ASIZE (h->index);
-  set_hash_next_slot (h, i, HASH_INDEX (h, start_of_bucket));
-  set_hash_index_slot (h, start_of_bucket, i);
+  /* Add new entry to the index.  */
+  hash_index_insert (h, i, hash);
   return i;
 }
 
@@ -4192,37 +5062,15 @@ hash_remove_from_table (struct Lisp_Hash_Table *h, Lisp_Object key)
 {
   EMACS_UINT hash_code = h->test.hashfn (&h->test, key);
   eassert ((hash_code & ~INTMASK) == 0);
-  ptrdiff_t start_of_bucket = hash_code % ASIZE (h->index);
-  ptrdiff_t prev = -1;
+  ptrdiff_t slot;
+  ptrdiff_t i = hash_lookup_1 (h, key, hash_code, &slot);
 
-  for (ptrdiff_t i = HASH_INDEX (h, start_of_bucket);
-       0 <= i;
-       i = HASH_NEXT (h, i))
+  if (0 <= i)
     {
-      if (EQ (key, HASH_KEY (h, i))
-	  || (h->test.cmpfn
-	      && hash_code == XUFIXNUM (HASH_HASH (h, i))
-	      && h->test.cmpfn (&h->test, key, HASH_KEY (h, i))))
-	{
-	  /* Take entry out of collision chain.  */
-	  if (prev < 0)
-	    set_hash_index_slot (h, start_of_bucket, HASH_NEXT (h, i));
-	  else
-	    set_hash_next_slot (h, prev, HASH_NEXT (h, i));
-
-	  /* Clear slots in key_and_value and add the slots to
-	     the free list.  */
-	  set_hash_key_slot (h, i, Qnil);
-	  set_hash_value_slot (h, i, Qnil);
-	  set_hash_hash_slot (h, i, Qnil);
-	  set_hash_next_slot (h, i, h->next_free);
-	  h->next_free = i;
-	  h->count--;
-	  eassert (h->count >= 0);
-	  break;
-	}
-
-      prev = i;
+      /* Take entry out of the index, and clear its slots in
+	 key_and_value and add them to the free list.  */
+      hash_set_ctrl (h, slot, HASH_CTRL_DELETED);
+      hash_free_entry (h, i);
     }
 }
 
@@ -4244,8 +5092,7 @@ hash_clear (struct Lisp_Hash_Table *h)
 	  set_hash_hash_slot (h, i, Qnil);
 	}
 
-      for (i = 0; i < ASIZE (h->index); ++i)
-	ASET (h->index, i, make_fixnum (-1));
+      hash_index_clear (h);
 
       h->next_free = 0;
       h->count = 0;
@@ -4258,142 +5105,206 @@ hash_clear (struct Lisp_Hash_Table *h)
 			   Weak Hash Tables
  ************************************************************************/
 
-/* Sweep weak hash table H.  REMOVE_ENTRIES_P means remove
-   entries from the table that don't survive the current GC.
-   !REMOVE_ENTRIES_P means mark entries that are in use.  Value is
-   true if anything was marked.  */
+/* Entries of weak hash tables that did not survive the current GC
+   when last looked at.  If this array cannot grow, which must not
+   signal during GC, weak_entries_overflow is set, and the tables in
+   use are looked at as a whole from then on.  */
 
-static bool
-sweep_weak_table (struct Lisp_Hash_Table *h, bool remove_entries_p)
+struct weak_entry
 {
-  ptrdiff_t n = gc_asize (h->index);
-  bool marked = false;
+  struct Lisp_Hash_Table *h;
+  ptrdiff_t idx;
+};
+
+static struct weak_entry *weak_entries;
+static ptrdiff_t weak_entries_count, weak_entries_size;
+static bool weak_entries_overflow;
 
-  for (ptrdiff_t bucket = 0; bucket < n; ++bucket)
+/* Add entry IDX of weak hash table H to weak_entries, or set
+   weak_entries_overflow if there is no room for it.  */
+
+static void
+add_weak_entry (struct Lisp_Hash_Table *h, ptrdiff_t idx)
+{
+  if (weak_entries_overflow)
+    return;
+  if (weak_entries_count == weak_entries_size)
     {
-      /* Follow collision chain, removing entries that
-	 don't survive this garbage collection.  */
-      ptrdiff_t prev = -1;
-      ptrdiff_t next;
-      for (ptrdiff_t i = HASH_INDEX (h, bucket); 0 <= i; i = next)
+      ptrdiff_t size;
+      size_t nbytes;
+      struct weak_entry *entries = NULL;
+      if (!INT_MULTIPLY_WRAPV (max (weak_entries_size, 64), 2, &size)
+	  && !INT_MULTIPLY_WRAPV (size, sizeof *weak_entries, &nbytes))
+	entries = realloc (weak_entries, nbytes);
+      if (!entries)
 	{
-	  bool key_known_to_survive_p = survives_gc_p (HASH_KEY (h, i));
-	  bool value_known_to_survive_p = survives_gc_p (HASH_VALUE (h, i));
-	  bool remove_p;
-
-	  if (EQ (h->weak, Qkey))
-	    remove_p = !key_known_to_survive_p;
-	  else if (EQ (h->weak, Qvalue))
-	    remove_p = !value_known_to_survive_p;
-	  else if (EQ (h->weak, Qkey_or_value))
-	    remove_p = !(key_known_to_survive_p || value_known_to_survive_p);
-	  else if (EQ (h->weak, Qkey_and_value))
-	    remove_p = !(key_known_to_survive_p && value_known_to_survive_p);
-	  else
-	    emacs_abort ();
+	  weak_entries_overflow = true;
+	  return;
+	}
+      weak_entries = entries;
+      weak_entries_size = size;
+    }
+  weak_entries[weak_entries_count].h = h;
+  weak_entries[weak_entries_count].idx = idx;
+  weak_entries_count++;
+}
 
-	  next = HASH_NEXT (h, i);
+/* Return true if entry IDX of weak hash table H is to be kept, given
+   what has been marked so far.  If so, mark its key and value and set
+   *MARKED if either was not yet marked.  */
 
-	  if (remove_entries_p)
-	    {
-	      if (remove_p)
-		{
-		  /* Take out of collision chain.  */
-		  if (prev < 0)
-		    set_hash_index_slot (h, bucket, next);
-		  else
-		    set_hash_next_slot (h, prev, next);
-
-		  /* Add to free list.  */
-		  set_hash_next_slot (h, i, h->next_free);
-		  h->next_free = i;
-
-		  /* Clear key, value, and hash.  */
-		  set_hash_key_slot (h, i, Qnil);
-		  set_hash_value_slot (h, i, Qnil);
-		  set_hash_hash_slot (h, i, Qnil);
-
-		  h->count--;
-		}
-	      else
-		{
-		  prev = i;
-		}
-	    }
-	  else
-	    {
-	      if (!remove_p)
-		{
-		  /* Make sure key and value survive.  */
-		  if (!key_known_to_survive_p)
-		    {
-		      mark_object (HASH_KEY (h, i));
-		      marked = 1;
-		    }
-
-		  if (!value_known_to_survive_p)
-		    {
-		      mark_object (HASH_VALUE (h, i));
-		      marked = 1;
-		    }
-		}
-	    }
-	}
+static bool
+keep_weak_entry (struct Lisp_Hash_Table *h, ptrdiff_t idx, bool *marked)
+{
+  bool key_known_to_survive_p = survives_gc_p (HASH_KEY (h, idx));
+  bool value_known_to_survive_p = survives_gc_p (HASH_VALUE (h, idx));
+  bool remove_p;
+
+  if (EQ (h->weak, Qkey))
+    remove_p = !key_known_to_survive_p;
+  else if (EQ (h->weak, Qvalue))
+    remove_p = !value_known_to_survive_p;
+  else if (EQ (h->weak, Qkey_or_value))
+    remove_p = !(key_known_to_survive_p || value_known_to_survive_p);
+  else if (EQ (h->weak, Qkey_and_value))
+    remove_p = !(key_known_to_survive_p && value_known_to_survive_p);
+  else
+    emacs_abort ();
+
+  if (remove_p)
+    return false;
+
+  /* Make sure key and value survive.  */
+  if (!key_known_to_survive_p)
+    {
+      mark_object (HASH_KEY (h, idx));
+      *marked = true;
+    }
+  if (!value_known_to_survive_p)
+    {
+      mark_object (HASH_VALUE (h, idx));
+      *marked = true;
     }
+  return true;
+}
+
+/* Mark the entries of weak hash table H that are in use, and add the
+   others to weak_entries.  Value is true if anything was marked.  */
+
+static bool
+sweep_weak_table (struct Lisp_Hash_Table *h)
+{
+  ptrdiff_t n = gc_asize (h->next);
+  bool marked = false;
+
+  for (ptrdiff_t i = 0; i < n; ++i)
+    if (!NILP (HASH_HASH (h, i)) && !keep_weak_entry (h, i, &marked))
+      add_weak_entry (h, i);
 
   return marked;
 }
 
 /* Remove elements from weak hash tables that don't survive the
    current garbage collection.  Remove weak tables that don't survive
-   from Vweak_hash_tables.  Called from gc_sweep.  */
+   from Vweak_hash_tables.  Called from gc_sweep.
+
+   Every entry of every weak table that survives is looked at once, so
+   the cost still grows with the total size of those tables.  Only the
+   entries that could not be kept then are looked at again, instead of
+   all the tables until nothing changes.  If there is no memory to
+   record those entries, all entries of the tables in use are looked at
+   again instead.  */
 
 NO_INLINE /* For better stack traces */
 void
 sweep_weak_hash_tables (void)
 {
-  struct Lisp_Hash_Table *h, *used, *next;
+  struct Lisp_Hash_Table *h, *used = NULL, *next;
   bool marked;
 
+  weak_entries_count = 0;
+  weak_entries_overflow = false;
+
   /* Mark all keys and values that are in use.  Keep on marking until
      there is no more change.  This is necessary for cases like
      value-weak table A containing an entry X -> Y, where Y is used in a
      key-weak table B, Z -> Y.  If B comes after A in the list of weak
      tables, X -> Y might be removed from A, although when looking at B
-     one finds that it shouldn't.  */
+     one finds that it shouldn't.  Marking can also make more weak
+     tables reachable.  */
   do
     {
-      marked = 0;
-      for (h = weak_hash_tables; h; h = h->next_weak)
+      marked = false;
+
+      /* Look at the tables that are now known to be in use, and move
+	 them to the list of used weak hash tables.  */
+      struct Lisp_Hash_Table **tail = &weak_hash_tables;
+      for (h = weak_hash_tables; h; h = next)
 	{
+	  next = h->next_weak;
 	  if (h->header.size & ARRAY_MARK_FLAG)
-	    marked |= sweep_weak_table (h, 0);
+	    {
+	      if (h->count > 0)
+		marked |= sweep_weak_table (h);
+	      *tail = next;
+	      h->next_weak = used;
+	      used = h;
+	    }
+	  else
+	    tail = &h->next_weak;
+	}
+
+      /* Look again at the entries that were not kept so far.  */
+      if (weak_entries_overflow)
+	{
+	  for (h = used; h; h = h->next_weak)
+	    for (ptrdiff_t i = 0; i < gc_asize (h->next); i++)
+	      if (!NILP (HASH_HASH (h, i)))
+		keep_weak_entry (h, i, &marked);
+	}
+      else
+	{
+	  ptrdiff_t n = 0;
+	  for (ptrdiff_t i = 0; i < weak_entries_count; i++)
+	    if (!keep_weak_entry (weak_entries[i].h, weak_entries[i].idx,
+				  &marked))
+	      weak_entries[n++] = weak_entries[i];
+	  weak_entries_count = n;
 	}
     }
   while (marked);
 
-  /* Remove tables and entries that aren't used.  */
-  for (h = weak_hash_tables, used = NULL; h; h = next)
+  /* Remove the entries that aren't used.  The tables left on
+     weak_hash_tables aren't used either.  */
+  if (weak_entries_overflow)
     {
-      next = h->next_weak;
-
-      if (h->header.size & ARRAY_MARK_FLAG)
-	{
-	  /* TABLE is marked as used.  Sweep its contents.  */
-	  if (h->count > 0)
-	    sweep_weak_table (h, 1);
-
-	  /* Add table to the list of used weak hash tables.  */
-	  h->next_weak = used;
-	  used = h;
-	}
+      for (h = used; h; h = h->next_weak)
+	for (ptrdiff_t i = 0; i < gc_asize (h->next); i++)
+	  if (!NILP (HASH_HASH (h, i)) && !keep_weak_entry (h, i, &marked))
+	    {
+	      hash_set_ctrl (h, hash_entry_slot (h, i), HASH_CTRL_DELETED);
+	      hash_free_entry (h, i);
+	    }
     }
+  else
+    for (ptrdiff_t i = 0; i < weak_entries_count; i++)
+      {
+	h = weak_entries[i].h;
+	hash_set_ctrl (h, hash_entry_slot (h, weak_entries[i].idx),
+		       HASH_CTRL_DELETED);
+	hash_free_entry (h, weak_entries[i].idx);
+      }
+
+  /* Don't keep the array from one collection to the next.  */
+  free (weak_entries);
+  weak_entries = NULL;
+  weak_entries_count = weak_entries_size = 0;
 
   weak_hash_tables = used;
 }
 
 
-
+
 /***********************************************************************
 			Hash Code Computation
  ***********************************************************************/
@@ -4403,12 +5314,25 @@ sweep_weak_hash_tables (void)
 #define SXHASH_MAX_DEPTH 3
 
 /* Maximum length up to which to take list and vector elements into
-   account.  */
+   account.  The elements of a list or vector that is not itself inside
+   another one count up to SXHASH_MAX_TOP_LEN instead, so that long
+   lists that differ only towards their end do not all collide.  */
 
 #define SXHASH_MAX_LEN   7
+#define SXHASH_MAX_TOP_LEN 64
+
+/* Return the number of elements to take into account for a list or
+   vector at depth DEPTH.  */
+
+static int
+sxhash_max_len (int depth)
+{
+  return depth == 0 ? SXHASH_MAX_TOP_LEN : SXHASH_MAX_LEN;
+}
 
 /* Return a hash for string PTR which has length LEN.  The hash value
-   can be any EMACS_UINT value.  */
+   can be any EMACS_UINT value.  Obarrays use this, so changing it
+   changes the order in which `mapatoms' visits symbols.  */
 
 EMACS_UINT
 hash_string (char const *ptr, ptrdiff_t len)
@@ -4427,14 +5351,87 @@ hash_string (char const *ptr, ptrdiff_t len)
   return hash;
 }
 
-/* Return a hash for string PTR which has length LEN.  The hash
-   code returned is guaranteed to fit in a Lisp integer.  */
+/* Mix the 64 bits of W into the hash state H.  Unlike
+   sxhash_combine, this makes every bit of H and W affect the upper
+   half of the result, and folds that back into the lower half.  W is
+   multiplied before it is combined with H, so that swapping H and W,
+   or changing both in the same bits, changes the result.  */
+
+static uint64_t
+sxhash_mix (uint64_t h, uint64_t w)
+{
+  h ^= w * 0x9e3779b97f4a7c15;
+  h = ((h << 31) | (h >> 33)) * 0xff51afd7ed558ccd;
+  return h ^ (h >> 32);
+}
+
+/* Return the 64 bits starting at P.  */
+
+static uint64_t
+sxhash_word (char const *p)
+{
+  uint64_t w;
+  memcpy (&w, p, sizeof w);
+  return w;
+}
+
+/* Return a hash for the LEN bytes at PTR, for `sxhash-equal'.
+
+   The bytes are read a 64-bit word at a time, and long strings are
+   read into four independent lanes so that the multiplications for
+   consecutive words can overlap.  Every byte affects every bit of the
+   result, so strings that differ in a single byte, or only in the
+   order of their bytes, get unrelated hash codes.  */
+
+static uint64_t
+hash_bytes (char const *ptr, ptrdiff_t len)
+{
+  char const *p = ptr;
+  char const *end = p + len;
+  uint64_t hash = len;
+  int const wordsize = sizeof (uint64_t);
+
+  if (4 * wordsize <= end - p)
+    {
+      uint64_t lane0 = hash, lane1 = sxhash_mix (hash, 1);
+      uint64_t lane2 = sxhash_mix (hash, 2), lane3 = sxhash_mix (hash, 3);
+      do
+	{
+	  lane0 = sxhash_mix (lane0, sxhash_word (p));
+	  lane1 = sxhash_mix (lane1, sxhash_word (p + wordsize));
+	  lane2 = sxhash_mix (lane2, sxhash_word (p + 2 * wordsize));
+	  lane3 = sxhash_mix (lane3, sxhash_word (p + 3 * wordsize));
+	  p += 4 * wordsize;
+	}
+      while (4 * wordsize <= end - p);
+      hash = sxhash_mix (sxhash_mix (sxhash_mix (lane0, lane1), lane2),
+			 lane3);
+    }
+
+  for (; wordsize <= end - p; p += wordsize)
+    hash = sxhash_mix (hash, sxhash_word (p));
+
+  if (p < end)
+    {
+      uint64_t w = 0;
+      memcpy (&w, p, end - p);
+      hash = sxhash_mix (hash, w);
+    }
+
+  /* Make the high bits depend on the low bits too.  */
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/* Return a hash for string STRING.  The hash code returned is
+   guaranteed to fit in a Lisp integer.  */
 
 static EMACS_UINT
-sxhash_string (char const *ptr, ptrdiff_t len)
+sxhash_string (Lisp_Object string)
 {
-  EMACS_UINT hash = hash_string (ptr, len);
-  return SXHASH_REDUCE (hash);
+  return SXHASH_REDUCE (hash_bytes (SSDATA (string), SBYTES (string)));
 }
 
 /* Return a hash for the floating point value VAL.  */
@@ -4445,7 +5442,7 @@ sxhash_float (double val)
   EMACS_UINT hash = 0;
   union double_and_words u = { .val = val };
   for (int i = 0; i < WORDS_PER_DOUBLE; i++)
-    hash = sxhash_combine (hash, u.word[i]);
+    hash = sxhash_mix (hash, u.word[i]);
   return SXHASH_REDUCE (hash);
 }
 
@@ -4460,17 +5457,17 @@ sxhash_list (Lisp_Object list, int depth)
 
   if (depth < SXHASH_MAX_DEPTH)
     for (i = 0;
-	 CONSP (list) && i < SXHASH_MAX_LEN;
+	 CONSP (list) && i < sxhash_max_len (depth);
 	 list = XCDR (list), ++i)
       {
 	EMACS_UINT hash2 = sxhash (XCAR (list), depth + 1);
-	hash = sxhash_combine (hash, hash2);
+	hash = sxhash_mix (hash, hash2);
       }
 
   if (!NILP (list))
     {
       EMACS_UINT hash2 = sxhash (list, depth + 1);
-      hash = sxhash_combine (hash, hash2);
+      hash = sxhash_mix (hash, hash2);
     }
 
   return SXHASH_REDUCE (hash);
@@ -4486,11 +5483,12 @@ sxhash_vector (Lisp_Object vec, int depth)
   EMACS_UINT hash = ASIZE (vec);
   int i, n;
 
-  n = min (SXHASH_MAX_LEN, hash & PSEUDOVECTOR_FLAG ? PVSIZE (vec) : hash);
+  n = min (sxhash_max_len (depth),
+	   hash & PSEUDOVECTOR_FLAG ? PVSIZE (vec) : hash);
   for (i = 0; i < n; ++i)
     {
       EMACS_UINT hash2 = sxhash (AREF (vec, i), depth + 1);
-      hash = sxhash_combine (hash, hash2);
+      hash = sxhash_mix (hash, hash2);
     }
 
   return SXHASH_REDUCE (hash);
@@ -4507,7 +5505,7 @@ sxhash_bool_vector (Lisp_Object vec)
 
   n = min (SXHASH_MAX_LEN, bool_vector_words (size));
   for (i = 0; i < n; ++i)
-    hash = sxhash_combine (hash, bool_vector_data (vec)[i]);
+    hash = sxhash_mix (hash, bool_vector_data (vec)[i]);
 
   return SXHASH_REDUCE (hash);
 }
@@ -4521,7 +5519,7 @@ sxhash_bignum (struct Lisp_Bignum *bignum)
   EMACS_UINT hash = 0;
 
   for (i = 0; i < nlimbs; ++i)
-    hash = sxhash_combine (hash, mpz_getlimbn (bignum->value, i));
+    hash = sxhash_mix (hash, mpz_getlimbn (bignum->value, i));
 
   return SXHASH_REDUCE (hash);
 }
@@ -4549,7 +5547,7 @@ sxhash (Lisp_Object obj, int depth)
       break;
 
     case Lisp_String:
-      hash = sxhash_string (SSDATA (obj), SBYTES (obj));
+      hash = sxhash_string (obj);
       break;
 
       /* This can be everything from a vector to an overlay.  */
@@ -5464,6 +6462,13 @@ this variable.  */);
   defsubr (&Smapc);
   defsubr (&Smapcan);
   defsubr (&Smapconcat);
+  defsubr (&Smake_string_builder);
+  defsubr (&Sstring_builder_p);
+  defsubr (&Sstring_builder_append);
+  defsubr (&Sstring_builder_string);
+  defsubr (&Sstring_builder_length);
+  defsubr (&Sstring_builder_clear);
+  defsubr (&Sinsert_string_builder);
   defsubr (&Syes_or_no_p);
   defsubr (&Sload_average);
   defsubr (&Sfeaturep);
@@ -997,6 +997,7 @@ enum pvec_type
   PVEC_MUTEX,
   PVEC_CONDVAR,
   PVEC_MODULE_FUNCTION,
+  PVEC_STRING_BUILDER,
 
   /* These should be last, check internal_equal to see why.  */
   PVEC_COMPILED,
@@ -2179,18 +2180,23 @@ struct Lisp_Hash_Table
      I-th entry is unused.  */
   Lisp_Object hash;
 
-  /* Vector used to chain entries.  If entry I is free, next[I] is the
-     entry number of the next free item.  If entry I is non-free,
-     next[I] is the index of the next entry in the collision chain,
-     or -1 if there is such entry.  */
+  /* Vector used to chain free entries.  If entry I is free, next[I]
+     is the entry number of the next free item, or -1 if there is no
+     such item.  If entry I is non-free, next[I] is -1.  */
   Lisp_Object next;
 
-  /* Bucket vector.  An entry of -1 indicates no item is present,
-     and a nonnegative entry is the index of the first item in
-     a collision chain.  This vector's size can be larger than the
-     hash table size to reduce collisions.  */
+  /* Open-addressing index vector.  Its size is a power of two larger
+     than the hash table size.  If slot S is in use according to
+     CTRL, index[S] is the number of the entry stored in it.  */
   Lisp_Object index;
 
+  /* Bool vector used as an array of control bytes, one for each slot
+     of INDEX, followed by a copy of the first HASH_GROUP_WIDTH ones so
+     that a whole group of slots can be probed with a single load.  A
+     control byte is HASH_CTRL_EMPTY, HASH_CTRL_DELETED, or the low 7
+     bits of the mixed hash code of the entry in that slot.  */
+  Lisp_Object ctrl;
+
   /* Only the fields above are traced normally by the GC.  The ones below
      `count' are special and are either ignored by the GC or traced in
      a special way (e.g. because of weakness).  */
@@ -2201,6 +2207,10 @@ struct Lisp_Hash_Table
   /* Index of first free entry in free list, or -1 if none.  */
   ptrdiff_t next_free;
 
+  /* Number of empty slots in INDEX.  Deleted slots do not count.  At
+     least one slot is always kept empty so that probing terminates.  */
+  ptrdiff_t index_empty;
+
   /* True if the table can be purecopied.  The table cannot be
      changed afterwards.  */
   bool pure;
@@ -2454,6 +2464,43 @@ XFINALIZER (Lisp_Object a)
   return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Finalizer);
 }
 
+/* A string builder accumulates text in a string that is longer than
+   the text, so that appending to it takes amortized constant time
+   per byte.  */
+struct Lisp_String_Builder
+  {
+    union vectorlike_header header;
+
+    /* The string holding the text.  Its own length is the capacity of
+       the builder, and only its first NBYTES bytes are in use.  It is
+       multibyte if and only if the text is.  It has no text
+       properties.  */
+    Lisp_Object storage;
+
+    /* The number of characters and bytes of the text.  */
+    ptrdiff_t nchars;
+    ptrdiff_t nbytes;
+  } GCALIGNED_STRUCT;
+
+INLINE bool
+STRING_BUILDERP (Lisp_Object x)
+{
+  return PSEUDOVECTORP (x, PVEC_STRING_BUILDER);
+}
+
+INLINE struct Lisp_String_Builder *
+XSTRING_BUILDER (Lisp_Object a)
+{
+  eassert (STRING_BUILDERP (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_String_Builder);
+}
+
+INLINE void
+CHECK_STRING_BUILDER (Lisp_Object x)
+{
+  CHECK_TYPE (STRING_BUILDERP (x), Qstring_builder_p, x);
+}
+
 INLINE bool
 MARKERP (Lisp_Object x)
 {
@@ -3607,6 +3654,21 @@ extern _Noreturn void memory_full (size_t);
 extern _Noreturn void buffer_memory_full (ptrdiff_t);
 extern bool survives_gc_p (Lisp_Object);
 extern void mark_object (Lisp_Object);
+
+/* What the objects being marked are reachable from.  Only heap
+   snapshots use this.  */
+enum gc_root_kind
+  {
+    GC_ROOT_NONE,		/* Nothing: they are not roots.  */
+    GC_ROOT_STATIC,		/* C variables and other global state.  */
+    GC_ROOT_BUFFER,		/* A buffer, or the buffer defaults.  */
+    GC_ROOT_SYMBOL,		/* An interned symbol.  */
+    GC_ROOT_SPECPDL,		/* A binding or unwind form of a thread.  */
+    GC_ROOT_STACK,		/* The C stack of a thread.  */
+    GC_ROOT_THREAD,		/* Other per-thread state.  */
+    GC_ROOT_FINALIZER		/* A finalizer that is about to run.  */
+  };
+extern enum gc_root_kind gc_root_kind;
 #if defined REL_ALLOC && !defined SYSTEM_MALLOC && !defined HYBRID_MALLOC
 extern void refill_memory_reserve (void);
 #endif
@@ -3754,7 +3816,9 @@ extern bool gc_in_progress;
 extern Lisp_Object make_float (double);
 extern void display_malloc_warning (void);
 extern ptrdiff_t inhibit_garbage_collection (void);
+extern void maybe_gc_when_idle (void);
 extern Lisp_Object build_overlay (Lisp_Object, Lisp_Object, Lisp_Object);
+extern Lisp_Object make_string_builder (ptrdiff_t);
 extern void free_cons (struct Lisp_Cons *);
 extern void init_alloc_once (void);
 extern void init_alloc (void);
@@ -3946,8 +4010,10 @@ extern void init_eval (void);
 extern void syms_of_eval (void);
 extern void prog_ignore (Lisp_Object);
 extern ptrdiff_t record_in_backtrace (Lisp_Object, Lisp_Object *, ptrdiff_t);
+extern bool backtrace_tail_call (ptrdiff_t, Lisp_Object,
+				Lisp_Object *, ptrdiff_t);
 extern void mark_specpdl (union specbinding *first, union specbinding *ptr);
-extern void get_backtrace (Lisp_Object array);
+extern void get_backtrace (Lisp_Object, bool);
 Lisp_Object backtrace_top_function (void);
 extern bool let_shadows_buffer_binding_p (struct Lisp_Symbol *symbol);
 
@@ -4287,6 +4353,7 @@ enum text_quoting_style
 extern enum text_quoting_style text_quoting_style (void);
 extern Lisp_Object read_doc_string (Lisp_Object);
 extern Lisp_Object get_doc_string (Lisp_Object, bool, bool);
+extern void release_doc_files (void);
 extern void syms_of_doc (void);
 extern int read_bytecode_char (bool);
 
@@ -4486,6 +4553,11 @@ void syms_of_dbusbind (void);
 /* Defined in profiler.c.  */
 extern bool profiler_memory_running;
 extern void malloc_probe (size_t);
+extern bool profiler_allocation_running;
+extern void allocation_probe (Lisp_Object, size_t);
+extern bool profiler_calls_running;
+extern void profiler_call_enter (Lisp_Object, ptrdiff_t);
+extern void profiler_call_exit (ptrdiff_t);
 extern void syms_of_profiler (void);
 
 
@@ -1044,7 +1044,7 @@ load_warn_unescaped_character_literals (Lisp_Object file)
          format, file,
          Fmapconcat (list3 (Qlambda, list1 (Qchar),
                             list3 (Qformat, inner_format, Qchar)),
-                     Fsort (Vlread_unescaped_character_literals, Qlss),
+                     Fsort (Vlread_unescaped_character_literals, Qlss, Qnil),
                      separator));
 }
 
@@ -1702,6 +1702,14 @@ print_vectorlike (Lisp_Object obj, Lisp_Object printcharfun, bool escapeflag,
       printchar ('>', printcharfun);
       break;
 
+    case PVEC_STRING_BUILDER:
+      {
+	int len = sprintf (buf, "#<string-builder %"pD"d>",
+			   XSTRING_BUILDER (obj)->nchars);
+	strout (buf, len, len, printcharfun);
+      }
+      break;
+
     case PVEC_RECORD:
       {
 	ptrdiff_t size = PVSIZE (obj);
@@ -18,6 +18,10 @@ You should have received a copy of the GNU General Public License
 along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
 
 #include <config.h>
+
+#include <errno.h>
+#include <execinfo.h>
+
 #include "lisp.h"
 #include "syssignal.h"
 #include "systime.h"
@@ -128,12 +132,44 @@ static void evict_lower_half (log_t *log)
       }
 }
 
+#ifdef PROFILER_CPU_SUPPORT
+
+/* Return addresses of the native frames of the current sample, and how
+   many of them fit.  */
+static void **native_frames;
+static int native_frames_size;
+
+/* Prepend to BT the return addresses of the innermost native frames,
+   as the offsets of the addresses from Fprofiler_cpu_start.  This
+   drops as many of the outermost elements of BT.  */
+
+static void
+record_native_frames (Lisp_Object bt)
+{
+  ptrdiff_t asize = ASIZE (bt);
+  int n = backtrace (native_frames, native_frames_size);
+  n = min (n, asize);
+  for (ptrdiff_t i = asize - 1; i >= n; i--)
+    ASET (bt, i, AREF (bt, i - n));
+  for (int i = 0; i < n; i++)
+    {
+      intptr_t offset = ((intptr_t) native_frames[i]
+			 - (intptr_t) Fprofiler_cpu_start);
+      ASET (bt, i, FIXNUM_OVERFLOW_P (offset) ? Qt : make_fixnum (offset));
+    }
+}
+
+#endif /* PROFILER_CPU_SUPPORT */
+
 /* Record the current backtrace in LOG.  COUNT is the weight of this
    current backtrace: interrupt counts for CPU, and the allocation
-   size for memory.  */
+   size for memory.  If NATIVE, also record the native frames.  If
+   LEAF is non-nil, record it as if the innermost function called it.
+   The innermost function is left out unless it is needed: the native
+   frames belong to it, and the allocations of LEAF are made by it.  */
 
 static void
-record_backtrace (log_t *log, EMACS_INT count)
+record_backtrace (log_t *log, EMACS_INT count, bool native, Lisp_Object leaf)
 {
   Lisp_Object backtrace;
   ptrdiff_t index;
@@ -146,7 +182,36 @@ record_backtrace (log_t *log, EMACS_INT count)
 
   /* Get a "working memory" vector.  */
   backtrace = HASH_KEY (log, index);
-  get_backtrace (backtrace);
+  get_backtrace (backtrace, native || !NILP (leaf));
+
+#ifdef PROFILER_CPU_SUPPORT
+  if (native)
+    record_native_frames (backtrace);
+#endif
+
+  if (!NILP (leaf))
+    {
+      ptrdiff_t asize = ASIZE (backtrace);
+      for (ptrdiff_t i = asize - 1; i > 0; i--)
+	ASET (backtrace, i, AREF (backtrace, i - 1));
+      if (asize > 0)
+	ASET (backtrace, 0, leaf);
+    }
+
+  /* Attribute samples taken in other threads than the main thread to
+     their thread, which is recorded as if it called the outermost
+     function.  This is done last, so that the frames added above do
+     not push the thread out of the backtrace; if there is no room
+     left, the thread replaces the outermost frame.  */
+  if (!main_thread_p (current_thread))
+    {
+      ptrdiff_t i = 0, asize = ASIZE (backtrace);
+      while (i < asize - 1 && !NILP (AREF (backtrace, i)))
+	i++;
+      Lisp_Object thread;
+      XSETTHREAD (thread, current_thread);
+      ASET (backtrace, i, thread);
+    }
 
   { /* We basically do a `gethash+puthash' here, except that we have to be
        careful to avoid memory allocation since we're in a signal
@@ -217,6 +282,17 @@ static EMACS_INT cpu_gc_count;
 /* The current sampling interval in nanoseconds.  */
 static EMACS_INT current_sampling_interval;
 
+/* True if the CPU profiler records native frames.  */
+static bool cpu_native;
+
+/* Return the size of the backtraces of the CPU profiler log, which
+   has room for as many native frames as Lisp frames if needed.  */
+static EMACS_INT
+cpu_log_depth (void)
+{
+  return profiler_max_stack_depth * (cpu_native ? 2 : 1);
+}
+
 /* Signal handler for sampling profiler.  */
 
 /* timer_getoverrun is not implemented on Cygwin, but the following
@@ -248,14 +324,51 @@ handle_profiler_signal (int signal)
 	}
 #endif
       eassert (HASH_TABLE_P (cpu_log));
-      record_backtrace (XHASH_TABLE (cpu_log), count);
+      record_backtrace (XHASH_TABLE (cpu_log), count, cpu_native, Qnil);
     }
 }
 
+#ifdef FORWARD_SIGNAL_TO_MAIN_THREAD
+/* True if a profiler signal was forwarded to the thread holding the
+   global lock and has not arrived yet.  */
+static volatile sig_atomic_t profiler_signal_forwarded;
+#endif
+
+/* Sample the Lisp thread that is running, which is the thread holding
+   the global lock, so that its stack cannot change under our feet.  If
+   the signal arrives in another thread, forward it there, but only
+   once: if the lock has changed hands again by the time a forwarded
+   signal arrives, drop the sample rather than chase the lock from
+   thread to thread.  */
 static void
 deliver_profiler_signal (int signal)
 {
-  deliver_process_signal (signal, handle_profiler_signal);
+  int old_errno = errno;
+  struct thread_state *self = current_thread;
+
+  if (!self)
+    ;
+#ifdef FORWARD_SIGNAL_TO_MAIN_THREAD
+  else if (! pthread_equal (pthread_self (), self->thread_id))
+    {
+      if (profiler_signal_forwarded)
+	profiler_signal_forwarded = false;
+      else
+	{
+	  profiler_signal_forwarded = true;
+	  pthread_kill (self->thread_id, signal);
+	}
+    }
+#endif
+  else
+    {
+#ifdef FORWARD_SIGNAL_TO_MAIN_THREAD
+      profiler_signal_forwarded = false;
+#endif
+      handle_profiler_signal (signal);
+    }
+
+  errno = old_errno;
 }
 
 static int
@@ -282,14 +395,17 @@ setup_cpu_timer (Lisp_Object sampling_interval)
 #ifdef HAVE_ITIMERSPEC
   if (! profiler_timer_ok)
     {
-      /* System clocks to try, in decreasing order of desirability.  */
+      /* System clocks to try, in decreasing order of desirability.
+	 The CPU time of the whole process comes first, as that of the
+	 calling thread would not advance while other Lisp threads
+	 run.  */
       static clockid_t const system_clock[] = {
-#ifdef CLOCK_THREAD_CPUTIME_ID
-	CLOCK_THREAD_CPUTIME_ID,
-#endif
 #ifdef CLOCK_PROCESS_CPUTIME_ID
 	CLOCK_PROCESS_CPUTIME_ID,
 #endif
+#ifdef CLOCK_THREAD_CPUTIME_ID
+	CLOCK_THREAD_CPUTIME_ID,
+#endif
 #ifdef CLOCK_MONOTONIC
 	CLOCK_MONOTONIC,
 #endif
@@ -337,11 +453,26 @@ See also `profiler-log-size' and `profiler-max-stack-depth'.  */)
   if (profiler_cpu_running)
     error ("CPU profiler is already running");
 
+  /* Samples with and without native frames do not fit in the same
+     log, so discard those of a previous run that had the other
+     setting.  */
+  if (cpu_native != profiler_native_frames)
+    cpu_log = Qnil;
+  cpu_native = profiler_native_frames;
+  if (cpu_native)
+    {
+      native_frames_size = min (profiler_max_stack_depth, INT_MAX);
+      native_frames = xnrealloc (native_frames, native_frames_size,
+				 sizeof *native_frames);
+      /* The first call of `backtrace' may allocate memory, which must
+	 not happen in the signal handler.  */
+      backtrace (native_frames, 1);
+    }
+
   if (NILP (cpu_log))
     {
       cpu_gc_count = 0;
-      cpu_log = make_log (profiler_log_size,
-			  profiler_max_stack_depth);
+      cpu_log = make_log (profiler_log_size, cpu_log_depth ());
     }
 
   int status = setup_cpu_timer (sampling_interval);
@@ -412,6 +543,8 @@ DEFUN ("profiler-cpu-log", Fprofiler_cpu_log, Sprofiler_cpu_log,
 The log is a hash-table mapping backtraces to counters which represent
 the amount of time spent at those points.  Every backtrace is a vector
 of functions, where the last few elements may be nil.
+Samples taken while another thread than the main thread was running
+end with the thread object after the outermost function.
 Before returning, a new log is allocated for future samples.  */)
   (void)
 {
@@ -420,7 +553,7 @@ Before returning, a new log is allocated for future samples.  */)
      more for our use afterwards since we can't rely on its special
      pre-allocated keys anymore.  So we have to allocate a new one.  */
   cpu_log = (profiler_cpu_running
-	     ? make_log (profiler_log_size, profiler_max_stack_depth)
+	     ? make_log (profiler_log_size, cpu_log_depth ())
 	     : Qnil);
   Fputhash (Fmake_vector (make_fixnum (1), QAutomatic_GC),
 	    make_fixnum (cpu_gc_count),
@@ -487,6 +620,8 @@ DEFUN ("profiler-memory-log",
 The log is a hash-table mapping backtraces to counters which represent
 the amount of memory allocated at those points.  Every backtrace is a vector
 of functions, where the last few elements may be nil.
+Allocations made by other threads than the main thread end with the
+thread object after the outermost function.
 Before returning, a new log is allocated for future samples.  */)
   (void)
 {
@@ -500,6 +635,347 @@ Before returning, a new log is allocated for future samples.  */)
   return result;
 }
 
+/* Allocation profiler.  */
+
+/* True if the allocation profiler is running.  */
+bool profiler_allocation_running;
+
+static Lisp_Object allocation_log;
+
+/* Bytes to allocate between samples on average, and bytes left until
+   the next sample.  */
+static EMACS_INT allocation_interval, allocation_countdown;
+
+/* The value of allocation_countdown after the previous sample.  */
+static EMACS_INT allocation_last_countdown;
+
+/* The state of the xorshift generator of the random intervals between
+   samples.  It is separate from get_random, so that profiling does not
+   change the numbers that `random' returns.  Never zero.  */
+static uint64_t allocation_random;
+
+/* Return the number of bytes to allocate until the next sample.  It
+   is random, as regular intervals could keep sampling the same kind of
+   allocation in loops that allocate objects of different types.  */
+static EMACS_INT
+allocation_next_countdown (void)
+{
+  uint64_t x = allocation_random;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  allocation_random = x;
+  EMACS_INT range = min (allocation_interval, MOST_POSITIVE_FIXNUM / 2) * 2;
+  return 1 + x % range;
+}
+
+DEFUN ("profiler-allocation-start", Fprofiler_allocation_start,
+       Sprofiler_allocation_start, 1, 1, 0,
+       doc: /* Start/restart the allocation profiler.
+The allocation profiler samples the allocations of Lisp objects: conses,
+floats, strings, vectors and other vector-like objects, symbols and
+text property intervals.  Whenever about SAMPLING-INTERVAL bytes have
+been allocated on average, it records the call-stack and the type of the object
+being allocated.  Unlike the memory profiler, it sees the objects that
+are carved out of blocks that were allocated earlier.
+See also `profiler-log-size' and `profiler-max-stack-depth'.  */)
+  (Lisp_Object sampling_interval)
+{
+  if (profiler_allocation_running)
+    error ("Allocation profiler is already running");
+  if (! RANGED_FIXNUMP (1, sampling_interval, MOST_POSITIVE_FIXNUM))
+    error ("Invalid sampling interval");
+
+  if (NILP (allocation_log))
+    allocation_log = make_log (profiler_log_size,
+			       profiler_max_stack_depth + 1);
+
+  allocation_interval = XFIXNUM (sampling_interval);
+  if (!allocation_random)
+    {
+      struct timespec now = current_timespec ();
+      allocation_random = ((uint64_t) now.tv_sec * 1000000000 + now.tv_nsec
+			   + getpid ());
+      if (!allocation_random)
+	allocation_random = 1;
+    }
+  allocation_countdown = allocation_last_countdown
+    = allocation_next_countdown ();
+  profiler_allocation_running = true;
+  return Qt;
+}
+
+DEFUN ("profiler-allocation-stop",
+       Fprofiler_allocation_stop, Sprofiler_allocation_stop,
+       0, 0, 0,
+       doc: /* Stop the allocation profiler.  The profiler log is not affected.
+Return non-nil if the profiler was running.  */)
+  (void)
+{
+  if (!profiler_allocation_running)
+    return Qnil;
+  profiler_allocation_running = false;
+  return Qt;
+}
+
+DEFUN ("profiler-allocation-running-p",
+       Fprofiler_allocation_running_p, Sprofiler_allocation_running_p,
+       0, 0, 0,
+       doc: /* Return non-nil if the allocation profiler is running.  */)
+  (void)
+{
+  return profiler_allocation_running ? Qt : Qnil;
+}
+
+DEFUN ("profiler-allocation-log",
+       Fprofiler_allocation_log, Sprofiler_allocation_log,
+       0, 0, 0,
+       doc: /* Return the current allocation profiler log.
+The log is a hash-table mapping backtraces to the number of bytes
+allocated at those points, as estimated from the samples.  Every
+backtrace is a vector whose first element is the type of the objects
+allocated: `cons', `float', `string', `vector', `symbol' or `interval'.
+The functions that allocated them follow, innermost first, and the last
+few elements may be nil.
+Before returning, a new log is allocated for future samples.  */)
+  (void)
+{
+  Lisp_Object result = allocation_log;
+  allocation_log = (profiler_allocation_running
+		    ? make_log (profiler_log_size,
+				profiler_max_stack_depth + 1)
+		    : Qnil);
+  return result;
+}
+
+/* Call profiler.  */
+
+/* True if the call profiler is running.  */
+bool profiler_calls_running;
+
+/* Hash table mapping each function called while the call profiler was
+   running to a vector of counters, indexed by the following.  The
+   vectors are updated in place, and the call stack below refers to
+   them, so they are never removed from the table while it runs.  */
+static Lisp_Object calls_log;
+
+enum
+  {
+    CALLS_COUNT,		/* Number of calls.  */
+    CALLS_INCLUSIVE,		/* Nanoseconds spent in the function.  */
+    CALLS_EXCLUSIVE,		/* Same, minus time spent in callees.  */
+    CALLS_GC,			/* Nanoseconds of GC during the calls.  */
+    CALLS_ACTIVE,		/* Number of activations on the stack.  */
+    CALLS_SIZE
+  };
+
+/* An activation of a function that the call profiler saw start.  */
+struct call_frame
+{
+  /* The counters of the function.  */
+  Lisp_Object counters;
+  /* The specpdl index of its backtrace entry.  */
+  ptrdiff_t count;
+  /* When it started, the time spent in its callees so far, and the
+     value of calls_gc_time when it started.  */
+  intmax_t start, children, gc;
+  /* True if this is a garbage collection.  */
+  bool is_gc;
+};
+
+static struct call_frame *call_stack;
+static ptrdiff_t call_stack_size, call_depth;
+
+/* The thread whose calls are being profiled.  */
+static struct thread_state *calls_thread;
+
+/* Total nanoseconds spent in garbage collection while profiling.  */
+static intmax_t calls_gc_time;
+
+static intmax_t
+calls_now (void)
+{
+  struct timespec t = monotonic_timespec ();
+  return t.tv_sec * (intmax_t) 1000000000 + t.tv_nsec;
+}
+
+/* Add N to counter I of COUNTERS, saturating.  N may be negative only
+   for CALLS_ACTIVE.  */
+static void
+calls_add (Lisp_Object counters, int i, intmax_t n)
+{
+  EMACS_INT old = XFIXNUM (AREF (counters, i));
+  ASET (counters, i,
+	make_fixnum (n < 0 ? old + n
+		     : saturated_add (old, min (n, MOST_POSITIVE_FIXNUM))));
+}
+
+/* Record that FUNCTION was called, its backtrace entry being at
+   specpdl index COUNT.  Called by record_in_backtrace.  */
+void
+profiler_call_enter (Lisp_Object function, ptrdiff_t count)
+{
+  if (current_thread != calls_thread)
+    return;
+
+  struct Lisp_Hash_Table *log = XHASH_TABLE (calls_log);
+  EMACS_UINT hash;
+  ptrdiff_t i = hash_lookup (log, function, &hash);
+  Lisp_Object counters;
+  if (i >= 0)
+    counters = HASH_VALUE (log, i);
+  else
+    {
+      counters = Fmake_vector (make_fixnum (CALLS_SIZE), make_fixnum (0));
+      hash_put (log, function, counters, hash);
+    }
+  calls_add (counters, CALLS_COUNT, 1);
+  calls_add (counters, CALLS_ACTIVE, 1);
+
+  if (call_depth == call_stack_size)
+    call_stack = xpalloc (call_stack, &call_stack_size, 1, -1,
+			  sizeof *call_stack);
+  struct call_frame *f = &call_stack[call_depth++];
+  f->counters = counters;
+  f->count = count;
+  f->children = 0;
+  f->gc = calls_gc_time;
+  f->is_gc = EQ (function, QAutomatic_GC);
+  f->start = calls_now ();
+}
+
+/* Record that the backtrace entry at specpdl index COUNT was popped,
+   normally or by a nonlocal exit.  Activations that started before the
+   profiler have no frame here and are ignored.  */
+void
+profiler_call_exit (ptrdiff_t count)
+{
+  if (current_thread != calls_thread)
+    return;
+
+  while (call_depth > 0 && call_stack[call_depth - 1].count >= count)
+    {
+      struct call_frame *f = &call_stack[--call_depth];
+      intmax_t elapsed = calls_now () - f->start;
+      Lisp_Object counters = f->counters;
+
+      /* Only the outermost activation of a recursive function counts
+	 towards its inclusive and GC times, so that they never exceed
+	 the time that actually elapsed.  */
+      calls_add (counters, CALLS_ACTIVE, -1);
+      if (XFIXNUM (AREF (counters, CALLS_ACTIVE)) == 0)
+	{
+	  calls_add (counters, CALLS_INCLUSIVE, elapsed);
+	  calls_add (counters, CALLS_GC, calls_gc_time - f->gc);
+	}
+      calls_add (counters, CALLS_EXCLUSIVE, elapsed - f->children);
+      if (call_depth > 0)
+	call_stack[call_depth - 1].children += elapsed;
+      if (f->is_gc)
+	calls_gc_time += elapsed;
+    }
+}
+
+DEFUN ("profiler-calls-start", Fprofiler_calls_start, Sprofiler_calls_start,
+       0, 0, 0,
+       doc: /* Start/restart the call profiler.
+The call profiler records every call of a function made by the current
+thread from now on, how long the calls took, and how much of that time
+was spent in garbage collection.  Unlike the CPU profiler, it does not
+sample: the counts are exact, but every call is slowed down a little.
+Use `profiler-calls-log' to get the results.  */)
+  (void)
+{
+  if (profiler_calls_running)
+    error ("Call profiler is already running");
+
+  if (NILP (calls_log))
+    calls_log = make_hash_table (hashtest_eq, DEFAULT_HASH_SIZE,
+				 DEFAULT_REHASH_SIZE,
+				 DEFAULT_REHASH_THRESHOLD,
+				 Qnil, false);
+  call_depth = 0;
+  calls_thread = current_thread;
+  profiler_calls_running = true;
+  return Qt;
+}
+
+DEFUN ("profiler-calls-stop", Fprofiler_calls_stop, Sprofiler_calls_stop,
+       0, 0, 0,
+       doc: /* Stop the call profiler.  The profiler log is not affected.
+Calls that are still in progress are not counted in the times.
+Return non-nil if the profiler was running.  */)
+  (void)
+{
+  if (!profiler_calls_running)
+    return Qnil;
+  profiler_calls_running = false;
+  while (call_depth > 0)
+    calls_add (call_stack[--call_depth].counters, CALLS_ACTIVE, -1);
+  return Qt;
+}
+
+DEFUN ("profiler-calls-running-p",
+       Fprofiler_calls_running_p, Sprofiler_calls_running_p,
+       0, 0, 0,
+       doc: /* Return non-nil if the call profiler is running.  */)
+  (void)
+{
+  return profiler_calls_running ? Qt : Qnil;
+}
+
+DEFUN ("profiler-calls-log",
+       Fprofiler_calls_log, Sprofiler_calls_log,
+       0, 0, 0,
+       doc: /* Return the current call profiler log.
+The log is a hash-table mapping each function that was called to a
+vector [CALLS INCLUSIVE EXCLUSIVE GC].  CALLS is the number of calls,
+INCLUSIVE the number of seconds spent in the function and its callees,
+EXCLUSIVE the number of seconds spent in the function itself, and GC
+the number of seconds spent in garbage collection during the calls.
+Garbage collections are themselves recorded under `Automatic GC'.
+Before returning, the counters are reset for future calls.  */)
+  (void)
+{
+  if (NILP (calls_log))
+    return Qnil;
+
+  struct Lisp_Hash_Table *log = XHASH_TABLE (calls_log);
+  Lisp_Object result = make_hash_table (hashtest_eq, log->count,
+					DEFAULT_REHASH_SIZE,
+					DEFAULT_REHASH_THRESHOLD,
+					Qnil, false);
+  struct Lisp_Hash_Table *h = XHASH_TABLE (result);
+  for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (log); i++)
+    {
+      if (NILP (HASH_HASH (log, i)))
+	continue;
+      Lisp_Object key = HASH_KEY (log, i);
+      Lisp_Object counters = HASH_VALUE (log, i);
+      if (XFIXNUM (AREF (counters, CALLS_COUNT)) == 0)
+	continue;
+      EMACS_UINT hash;
+      hash_lookup (h, key, &hash);
+      hash_put (h, key,
+		CALLN (Fvector, AREF (counters, CALLS_COUNT),
+		       make_float (XFIXNUM (AREF (counters, CALLS_INCLUSIVE))
+				   / 1e9),
+		       make_float (XFIXNUM (AREF (counters, CALLS_EXCLUSIVE))
+				   / 1e9),
+		       make_float (XFIXNUM (AREF (counters, CALLS_GC))
+				   / 1e9)),
+		hash);
+      for (int j = 0; j < CALLS_ACTIVE; j++)
+	ASET (counters, j, make_fixnum (0));
+    }
+
+  /* The stack still refers to the counters while the profiler runs,
+     so only drop them once it has stopped.  */
+  if (!profiler_calls_running)
+    calls_log = Qnil;
+  return result;
+}
+
 
 /* Signals and probes.  */
 
@@ -508,7 +984,25 @@ void
 malloc_probe (size_t size)
 {
   eassert (HASH_TABLE_P (memory_log));
-  record_backtrace (XHASH_TABLE (memory_log), min (size, MOST_POSITIVE_FIXNUM));
+  record_backtrace (XHASH_TABLE (memory_log), min (size, MOST_POSITIVE_FIXNUM),
+		    false, Qnil);
+}
+
+/* Record that a Lisp object of type TYPE and SIZE bytes is being
+   allocated.  Take a sample when the interval has elapsed, weighted
+   by the bytes allocated since the previous sample.  */
+void
+allocation_probe (Lisp_Object type, size_t size)
+{
+  allocation_countdown -= min (size, MOST_POSITIVE_FIXNUM);
+  if (allocation_countdown > 0 || gc_in_progress)
+    return;
+  EMACS_INT weight = allocation_last_countdown - allocation_countdown;
+  allocation_countdown = allocation_last_countdown
+    = allocation_next_countdown ();
+  eassert (HASH_TABLE_P (allocation_log));
+  record_backtrace (XHASH_TABLE (allocation_log),
+		    min (weight, MOST_POSITIVE_FIXNUM), false, type);
 }
 
 DEFUN ("function-equal", Ffunction_equal, Sfunction_equal, 2, 2, 0,
@@ -594,6 +1088,19 @@ to make room for new entries.  */);
   defsubr (&Sfunction_equal);
 
 #ifdef PROFILER_CPU_SUPPORT
+  DEFVAR_BOOL ("profiler-native-frames", profiler_native_frames,
+	       doc: /* Non-nil means the CPU profiler also records native frames.
+Every backtrace of the log then starts with the return addresses of the
+innermost C functions that were running, up to `profiler-max-stack-depth'
+of them, followed by the Lisp functions.  The addresses are recorded as
+integers, their offsets from the address of the C function
+`Fprofiler_cpu_start', so that they can be looked up in the symbol table
+of the Emacs executable; `profiler-cpu-profile' does that.  The value
+takes effect when the profiler starts.  If it has changed since the
+profiler was last started, the samples of that run that were not yet
+returned by `profiler-cpu-log' are discarded.  */);
+  profiler_native_frames = false;
+
   profiler_cpu_running = NOT_RUNNING;
   cpu_log = Qnil;
   staticpro (&cpu_log);
@@ -609,4 +1116,20 @@ to make room for new entries.  */);
   defsubr (&Sprofiler_memory_stop);
   defsubr (&Sprofiler_memory_running_p);
   defsubr (&Sprofiler_memory_log);
+
+  profiler_allocation_running = false;
+  allocation_log = Qnil;
+  staticpro (&allocation_log);
+  defsubr (&Sprofiler_allocation_start);
+  defsubr (&Sprofiler_allocation_stop);
+  defsubr (&Sprofiler_allocation_running_p);
+  defsubr (&Sprofiler_allocation_log);
+
+  profiler_calls_running = false;
+  calls_log = Qnil;
+  staticpro (&calls_log);
+  defsubr (&Sprofiler_calls_start);
+  defsubr (&Sprofiler_calls_stop);
+  defsubr (&Sprofiler_calls_running_p);
+  defsubr (&Sprofiler_calls_log);
 }
@@ -1816,7 +1816,7 @@ handle_arith_signal (int sig)
 
 /* Alternate stack used by SIGSEGV handler below.  */
 
-static unsigned char sigsegv_stack[SIGSTKSZ];
+static unsigned char sigsegv_stack[64 * 1024];
 
 
 /* Return true if SIGINFO indicates a stack overflow.  */
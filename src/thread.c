@@ -618,10 +618,13 @@ mark_one_thread (struct thread_state *thread)
   /* Get the stack top now, in case mark_specpdl changes it.  */
   void *stack_top = thread->stack_top;
 
+  gc_root_kind = GC_ROOT_SPECPDL;
   mark_specpdl (thread->m_specpdl, thread->m_specpdl_ptr);
 
+  gc_root_kind = GC_ROOT_STACK;
   mark_stack (thread->m_stack_bottom, stack_top);
 
+  gc_root_kind = GC_ROOT_THREAD;
   for (struct handler *handler = thread->m_handlerlist;
        handler; handler = handler->next)
     {
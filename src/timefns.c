@@ -122,6 +122,20 @@ make_timeval (struct timespec t)
   return tv;
 }
 
+/* Return the current time of a clock that is not affected by changes
+   to the system time, for measuring elapsed time.  Use the system
+   time if there is no such clock.  */
+struct timespec
+monotonic_timespec (void)
+{
+#if defined CLOCK_MONOTONIC && defined HAVE_CLOCK_GETTIME
+  struct timespec t;
+  if (clock_gettime (CLOCK_MONOTONIC, &t) == 0)
+    return t;
+#endif
+  return current_timespec ();
+}
+
 /* Yield A's UTC offset, or an unspecified value if unknown.  */
 static long int
 tm_gmtoff (struct tm *a)
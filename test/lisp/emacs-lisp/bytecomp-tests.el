@@ -611,6 +611,172 @@ bytecomp-tests--with-temp-file
       (if (buffer-live-p byte-compile-log-buffer)
           (kill-buffer byte-compile-log-buffer)))))
 
+(defvar bytecomp-tests--fused-var '(1 2))
+
+(defconst bytecomp-tests--fused-fun
+  '(lambda (l)
+     (let ((n 0) (m l))
+       (while m
+         (setq n (+ n (car m)))
+         (setq m (cdr m)))
+       (list n (cdr l) (car-safe bytecomp-tests--fused-var)
+             (format "%s" 'a) (symbol-name 'b))))
+  "Function whose compiled code contains each fused instruction.")
+
+(ert-deftest bytecomp-tests--fused-instructions ()
+  "Check that fused instructions behave like the pairs they replace."
+  (let* ((lexical-binding t)
+         (plain (let ((byte-compile-fuse-instructions nil))
+                  (byte-compile bytecomp-tests--fused-fun)))
+         (fused (let ((byte-compile-fuse-instructions t))
+                  (byte-compile bytecomp-tests--fused-fun))))
+    (should (< (length (aref fused 1)) (length (aref plain 1))))
+    (dolist (op (list byte-varref-car-safe byte-stack-ref-cdr
+                      byte-dup-goto-if-nil byte-constant-call2))
+      (should (memq op (append (aref fused 1) nil))))
+    (dolist (arg '(nil (1) (1 2 3)))
+      (should (equal (funcall fused arg) (funcall plain arg))))
+    (should-error (funcall fused '(1 . 2)) :type 'wrong-type-argument)
+    ;; Inlining decompiles the function, which must undo the fusion.
+    (let ((caller (byte-compile `(lambda (l) (,fused (cons 0 l))))))
+      (should-not (memq t (mapcar #'byte-code-function-p (aref caller 2))))
+      (should (equal (funcall caller '(1 2)) (funcall plain '(0 1 2)))))))
+
+;; Functions recurring through each other in tail position.
+(defconst bytecomp-tests--tail-funs
+  '((bytecomp-tests--even
+     . (lambda (n) (if (= n 0) t (bytecomp-tests--odd (1- n)))))
+    (bytecomp-tests--odd
+     . (lambda (n) (if (= n 0) nil (bytecomp-tests--even (1- n)))))
+    (bytecomp-tests--count
+     . (lambda (n &optional acc)
+         (if (= n 0) acc (bytecomp-tests--count (1- n) (1+ (or acc 0))))))))
+
+(ert-deftest bytecomp-tests--tail-calls ()
+  "Check that tail calls recur without limit and can be inlined."
+  (let ((lexical-binding t)
+        (byte-compile-tail-calls t)
+        (n (* 10 max-lisp-eval-depth)))
+    (unwind-protect
+        (progn
+          (dolist (f bytecomp-tests--tail-funs)
+            (defalias (car f) (byte-compile (cdr f))))
+          (should (memq byte-tail-call
+                        (append (aref (symbol-function 'bytecomp-tests--odd)
+                                      1)
+                                nil)))
+          (should (eq (bytecomp-tests--even n) t))
+          (should (eq (bytecomp-tests--odd n) nil))
+          (should (= (bytecomp-tests--count n) n))
+          (should-error (funcall (byte-compile
+                                  '(lambda () (bytecomp-tests--odd))))
+                        :type 'wrong-number-of-arguments)
+          ;; Inlining decompiles the function, which must turn its tail
+          ;; call back into an ordinary one.
+          (let* ((even (symbol-function 'bytecomp-tests--even))
+                 (caller (byte-compile `(lambda (n) (not (,even n))))))
+            (should-not (memq t (mapcar #'byte-code-function-p
+                                        (aref caller 2))))
+            (should (eq (funcall caller 3) t)))
+          (let ((byte-compile-tail-calls nil))
+            (defalias 'bytecomp-tests--even
+              (byte-compile (cdr (assq 'bytecomp-tests--even
+                                       bytecomp-tests--tail-funs)))))
+          (should-error (bytecomp-tests--even n)))
+      (dolist (f bytecomp-tests--tail-funs)
+        (fmakunbound (car f))))))
+
+(defconst bytecomp-tests--rest-funs
+  '(((lambda (&rest l)
+       (let ((s 0))
+         (dolist (x l)
+           (garbage-collect)
+           (setq s (+ s x)))
+         s))
+     . t)
+    ((lambda (a &rest l) (list a (car-safe (cdr l)) (length l))) . t)
+    ((lambda (&rest l) (if (memq 2 l) (nth 2 l))) . t)
+    ((lambda (&rest l) l) . nil)
+    ((lambda (&rest l) (cdr l)) . nil)
+    ((lambda (&rest l) (let ((x (cdr l))) x)) . nil)
+    ((lambda (&rest l) (list (memq 2 l))) . nil)
+    ((lambda (&rest l) (apply #'+ l)) . nil)
+    ((lambda (&rest l) (lambda () l)) . nil))
+  "Functions with &rest lists, and whether these stay in the function.")
+
+(ert-deftest bytecomp-tests--stack-rest ()
+  "Check the &rest lists that are allocated on the stack."
+  (let ((lexical-binding t))
+    (dolist (f bytecomp-tests--rest-funs)
+      (let ((compiled (byte-compile (car f)))
+            (interpreted (eval (car f) t)))
+        (should (eq (eq (aref (aref compiled 1) 0) byte-stack-rest)
+                    (cdr f)))
+        (let ((value (funcall compiled 1 2 3)))
+          (should (equal (if (functionp value) (funcall value) value)
+                         (let ((value (funcall interpreted 1 2 3)))
+                           (if (functionp value) (funcall value) value)))))))))
+
+(defun bytecomp-tests--metered (n)
+  (let ((sum 0))
+    (dotimes (i n)
+      (setq sum (+ sum (bytecomp-tests--metered-1 i))))
+    sum))
+
+(defun bytecomp-tests--metered-1 (i)
+  (* i 2))
+
+(ert-deftest bytecomp-tests--meter ()
+  "Check the counts kept while `byte-metering-on' is set."
+  (let ((lexical-binding t)
+        (byte-code-meter nil)
+        (byte-code-function-meter (make-hash-table :test 'eq))
+        (return-count 0))
+    (byte-compile 'bytecomp-tests--metered)
+    (byte-compile 'bytecomp-tests--metered-1)
+    (put 'bytecomp-tests--metered-1 'byte-code-meter 0)
+    (unwind-protect
+        (progn
+          (setq byte-metering-on t)
+          (should (= (bytecomp-tests--metered 10) 90))
+          (setq byte-metering-on nil)
+          (setq return-count (aref (aref byte-code-meter 0) byte-return))
+          ;; Metering off adds nothing.
+          (bytecomp-tests--metered 10)
+          (should (= (aref (aref byte-code-meter 0) byte-return)
+                     return-count))
+          (should (= (get 'bytecomp-tests--metered-1 'byte-code-meter) 10)))
+      (setq byte-metering-on nil)
+      (put 'bytecomp-tests--metered-1 'byte-code-meter nil))
+    (should (>= return-count 11))
+    (should (= (gethash 'bytecomp-tests--metered-1 byte-code-function-meter)
+               (* 10 (length (aref (symbol-function
+                                    'bytecomp-tests--metered-1)
+                                   1)))))
+    (should (> (gethash 'bytecomp-tests--metered byte-code-function-meter)
+               0))))
+
+(defun bytecomp-tests--metered-clear (n)
+  (clrhash byte-code-function-meter)
+  (puthash 'bytecomp-tests--other 0 byte-code-function-meter)
+  (* n 2))
+
+(ert-deftest bytecomp-tests--meter-cleared ()
+  "Check that a function that clears `byte-code-function-meter' is counted."
+  (let ((lexical-binding t)
+        (byte-code-meter nil)
+        (byte-code-function-meter (make-hash-table :test 'eq)))
+    (byte-compile 'bytecomp-tests--metered-clear)
+    (unwind-protect
+        (progn
+          (setq byte-metering-on t)
+          (should (= (bytecomp-tests--metered-clear 5) 10)))
+      (setq byte-metering-on nil))
+    (should (= (gethash 'bytecomp-tests--other byte-code-function-meter) 0))
+    (should (> (gethash 'bytecomp-tests--metered-clear
+                        byte-code-function-meter)
+               0))))
+
 ;; Local Variables:
 ;; no-byte-compile: t
 ;; End:
@@ -0,0 +1,75 @@
+;;; profiler-tests.el --- tests for profiler.el -*- lexical-binding: t -*-
+
+;; Copyright (C) 2018 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+(require 'profiler)
+
+(defun profiler-tests--profile ()
+  (let ((log (make-hash-table :test 'equal)))
+    (puthash [c b a nil] 3 log)
+    (puthash [b a nil nil] 2 log)
+    (puthash ["x;y" nil nil nil] 1 log)
+    (profiler-make-profile :type 'cpu :log log)))
+
+(ert-deftest profiler-tests-folded-stacks ()
+  (let ((file (make-temp-file "profiler-tests")))
+    (unwind-protect
+        (progn
+          (profiler-write-folded-stacks (profiler-tests--profile) file)
+          (with-temp-buffer
+            (insert-file-contents file)
+            (should (equal (buffer-string) "a;b 2\na;b;c 3\nx:y 1\n"))))
+      (delete-file file))))
+
+(ert-deftest profiler-tests-pprof ()
+  (let ((file (make-temp-file "profiler-tests")))
+    (unwind-protect
+        (progn
+          (profiler-write-pprof (profiler-tests--profile) file)
+          (with-temp-buffer
+            (set-buffer-multibyte nil)
+            (insert-file-contents-literally file)
+            ;; The sample type, whose strings come after the function
+            ;; names, then the sample for [c b a], made of its
+            ;; location IDs, leaf first, and its count.
+            (should (string-prefix-p
+                     (unibyte-string 10 4 8 5 16 6
+                                     18 8 10 3 3 2 1 18 1 3)
+                     (buffer-string)))
+            (dolist (name '("a" "b" "c" "x;y" "samples" "nanoseconds"))
+              (should (search-forward (concat (string (length name)) name)
+                                      nil t))
+              (goto-char (point-min)))))
+      (delete-file file))))
+
+(ert-deftest profiler-tests-native-frames ()
+  (cl-letf (((symbol-function 'profiler-native-frame-name)
+             (lambda (offset)
+               (aref ["record_backtrace" "deliver_profiler_signal" "??"
+                      "re_search_2" "Fre_search_forward" "Ffuncall"
+                      "exec_byte_code" "Ffuncall"]
+                     offset))))
+    (should (equal (profiler-native-fixup-backtrace
+                    [0 1 2 3 4 5 6 7 re-search-forward foo bar nil])
+                   ["re_search_2" "Fre_search_forward" re-search-forward
+                    "Ffuncall" "exec_byte_code" foo "Ffuncall" bar]))))
+
+;;; profiler-tests.el ends here
@@ -51,3 +51,291 @@
     (should-not (eq x y))
     (dotimes (i 4)
       (should (eql (aref x i) (aref y i))))))
+
+(ert-deftest alloc-tests--deep-structure ()
+  "Marking deeply nested objects must not overflow the C stack."
+  (let ((l nil) (v nil))
+    (dotimes (i 1000000)
+      (setq l (list l i))
+      (setq v (vector v i)))
+    (garbage-collect)
+    (should (eql (cadr l) 999999))
+    (should (eql (aref v 1) 999999))))
+
+(ert-deftest alloc-tests--mem-find-after-free ()
+  "Objects referenced only from the stack must survive garbage
+collections that free cons and float blocks."
+  (let ((f (byte-compile
+            (lambda (n)
+              (let ((a (list 1 2 3))
+                    (b (float n)))
+                ;; Fill many cons and float blocks and free them
+                ;; again, so that mem_find has to cope with blocks
+                ;; removed from its index.
+                (dotimes (_ 3)
+                  (let ((junk nil))
+                    (dotimes (i n)
+                      (setq junk (cons (float i) junk)))
+                    (setq junk nil))
+                  (garbage-collect))
+                (let ((c (list (float n) 'x)))
+                  (dotimes (i n)
+                    (list i (float i)))
+                  (garbage-collect)
+                  (dotimes (i n)
+                    (list i (float i)))
+                  (list a b c)))))))
+    (should (equal (funcall f 200000)
+                   '((1 2 3) 200000.0 (200000.0 x))))))
+
+(ert-deftest alloc-tests--lazy-sweep ()
+  (let ((gc-lazy-sweep t)
+        (keep nil))
+    (dotimes (i 100000)
+      (let ((garbage (list i (float i))))
+        (when (zerop (% i 100))
+          (push garbage keep))))
+    (garbage-collect)
+    ;; Allocate from the blocks that have not been swept yet.
+    (let ((fresh (make-list 200000 'x)))
+      (garbage-collect)
+      (should (eql (length fresh) 200000)))
+    (should (eql (length keep) 1000))
+    (let ((i 99900))
+      (dolist (elt keep)
+        (should (equal elt (list i (float i))))
+        (setq i (- i 100))))))
+
+(ert-deftest alloc-tests--gc-statistics ()
+  (garbage-collect)
+  (let* ((before (gc-statistics))
+         (gcs gcs-done))
+    (garbage-collect)
+    (let ((stats (gc-statistics)))
+      (should (eql gcs-done (1+ gcs)))
+      (should (eql (length stats) (min 64 (1+ (length before)))))
+      (let ((last (car stats)))
+        (should (<= 0 (alist-get 'elapsed last)))
+        (should (< (alist-get 'start (cadr stats)) (alist-get 'start last)))
+        ;; The phases cover the whole collection.
+        (should (< (abs (- (alist-get 'elapsed last)
+                           (apply #'+ (mapcar #'cdr
+                                              (alist-get 'phases last)))))
+                   1e-6))
+        (should (< 0 (alist-get 'conses (alist-get 'live last))))
+        (should (<= 0 (alist-get 'conses (alist-get 'free last))))))))
+
+;; This is a separate function so that no pointer to the finalizers is
+;; left in the caller's stack frame.  Stale pointers elsewhere on the C
+;; stack, which is scanned conservatively, can still keep a few of them
+;; alive, so make many.
+(defun alloc-tests--drop-finalizers (function)
+  (dotimes (_ 100)
+    (make-finalizer function))
+  nil)
+
+(ert-deftest alloc-tests--gc-statistics-finalizer ()
+  "A collection started by a finalizer gets a record of its own."
+  (let ((ran nil))
+    (garbage-collect)
+    (alloc-tests--drop-finalizers (lambda ()
+                                    (unless ran
+                                      (setq ran t)
+                                      (garbage-collect))))
+    (let ((gcs gcs-done))
+      (garbage-collect)
+      (should ran)
+      (should (eql gcs-done (+ gcs 2)))
+      (let* ((stats (gc-statistics))
+             (inner (car stats))
+             (outer (cadr stats)))
+        (should (< (alist-get 'start outer) (alist-get 'start inner)))
+        (should (<= (alist-get 'elapsed inner) (alist-get 'elapsed outer)))
+        (should (<= (alist-get 'elapsed inner)
+                    (alist-get 'finalizers (alist-get 'phases outer))))
+        (dolist (r (list inner outer))
+          (should (< (abs (- (alist-get 'elapsed r)
+                             (apply #'+ (mapcar #'cdr
+                                                (alist-get 'phases r)))))
+                     1e-6)))))))
+
+(defun alloc-tests--make-garbage ()
+  "Allocate about 32 MB of conses and drop them.
+This is a separate function so that no pointer to them is left in
+the caller's stack frame."
+  (length (make-list 2000000 nil)))
+
+(defun alloc-tests--free-conses ()
+  "Return how many bytes of conses the last collection kept free."
+  (alist-get 'conses (alist-get 'free (car (gc-statistics)))))
+
+;; How much memory the system reports as resident depends on the C
+;; library and on the rest of the process, so these tests check what
+;; Emacs itself reports instead: the blocks that held the garbage are
+;; no longer kept as free space, and the release phase runs only when
+;; it should.
+
+(defun alloc-tests--release-time (gcs)
+  "Return how long the collections since GCS spent releasing memory.
+GCS is a previous value of `gcs-done'.  The garbage may be freed by
+a collection that starts before the one that is asked for."
+  (cl-loop for record in (gc-statistics)
+           repeat (- gcs-done gcs)
+           sum (alist-get 'release (alist-get 'phases record))))
+
+(ert-deftest alloc-tests--release-memory ()
+  (garbage-collect)
+  (let ((gc-release-memory nil)
+        (gcs gcs-done))
+    (alloc-tests--make-garbage)
+    (garbage-collect)
+    (should (= (alloc-tests--release-time gcs) 0)))
+  (let ((gc-release-memory t)
+        (gcs gcs-done))
+    (alloc-tests--make-garbage)
+    (garbage-collect)
+    (if (fboundp 'malloc-trim)
+        (should (> (alloc-tests--release-time gcs) 0))
+      (should (= (alloc-tests--release-time gcs) 0)))
+    ;; Nothing is freed, so nothing is released.
+    (setq gcs gcs-done)
+    (garbage-collect)
+    (should (= (alloc-tests--release-time gcs) 0))))
+
+(ert-deftest alloc-tests--malloc-trim ()
+  (skip-unless (fboundp 'malloc-trim))
+  (let ((gc-release-memory nil)
+        (gc-lazy-sweep nil))
+    (garbage-collect)
+    (alloc-tests--make-garbage)
+    (garbage-collect)
+    (should (< (alloc-tests--free-conses) 4000000))
+    ;; Whether the C library finds memory to return depends on its
+    ;; version and settings.
+    (should (booleanp (malloc-trim)))
+    (should (booleanp (malloc-trim 4096)))
+    (should-error (malloc-trim -1) :type 'wrong-type-argument)))
+
+(ert-deftest alloc-tests--release-memory-lazy-sweep ()
+  "Blocks freed by the sweep that finishes a lazy sweep are released."
+  (let ((gc-release-memory t)
+        (gc-lazy-sweep t))
+    (garbage-collect)
+    ;; The collections triggered while the garbage is being allocated
+    ;; leave its blocks unswept, so the next collection frees them
+    ;; before it starts marking.
+    (let ((gcs gcs-done))
+      (alloc-tests--make-garbage)
+      (garbage-collect)
+      (should (< (alloc-tests--free-conses) 4000000))
+      (when (fboundp 'malloc-trim)
+        (should (> (alloc-tests--release-time gcs) 0))))))
+
+(defun alloc-tests--snapshot-uint ()
+  "Read an unsigned LEB128 number at point and move past it."
+  (let ((n 0) (shift 0) byte)
+    (while (progn (setq byte (char-after))
+                  (forward-char)
+                  (setq n (+ n (ash (logand byte 127) shift)))
+                  (setq shift (+ shift 7))
+                  (>= byte 128)))
+    n))
+
+(defun alloc-tests--read-snapshot ()
+  "Parse the heap snapshot in the current buffer.
+Return (NODES . ROOTS), where NODES is a hash table mapping each
+address to (TYPE SIZE TARGETS...), and ROOTS is a list of (KIND
+. ADDRESS).  Signal an error if the snapshot is malformed."
+  (let ((nodes (make-hash-table)) (roots nil))
+    (goto-char 9)
+    (while (not (eq (char-after) ?z))
+      (pcase (prog1 (char-after) (forward-char))
+        (?r (let ((kind (prog1 (char-after) (forward-char))))
+              (push (cons kind (alloc-tests--snapshot-uint)) roots)))
+        (?n (let* ((type (prog1 (char-after) (forward-char)))
+                   (address (alloc-tests--snapshot-uint))
+                   (size (alloc-tests--snapshot-uint))
+                   (targets (let ((count (alloc-tests--snapshot-uint)))
+                              (mapcar (lambda (_)
+                                        (alloc-tests--snapshot-uint))
+                                      (number-sequence 1 count)))))
+              (puthash address (cons type (cons size targets)) nodes)))
+        (c (error "Bad heap snapshot record %S" c))))
+    (forward-char)
+    (should (eobp))
+    (cons nodes roots)))
+
+(ert-deftest alloc-tests--heap-snapshot ()
+  (let ((file (make-temp-file "alloc-tests"))
+        (cell (list 'alloc-tests))
+        (vec nil))
+    (setq vec (make-vector 4321 nil))
+    (fillarray vec cell)
+    (unwind-protect
+        (let ((gcs gcs-done))
+          (write-heap-snapshot file)
+          (should (eql gcs-done (1+ gcs)))
+          (with-temp-buffer
+            (set-buffer-multibyte nil)
+            (insert-file-contents-literally file)
+            (should (> (buffer-size) 8))
+            (should (equal (buffer-substring 1 9) "EHSNAP\0\1"))
+            (let* ((snapshot (alloc-tests--read-snapshot))
+                   (nodes (car snapshot))
+                   (roots (cdr snapshot))
+                   (found nil))
+              (should roots)
+              ;; Find VEC: the only vector with 4321 references, all to
+              ;; the same object, which is CELL.
+              (maphash (lambda (address node)
+                         (when (and (= (car node) 32)
+                                    (= (length (cddr node)) 4321))
+                           (push (cons address node) found)))
+                       nodes)
+              (should (= (length found) 1))
+              (let* ((node (cdar found))
+                     (target (nth 2 node)))
+                (should (> (cadr node) (* 4 4321)))
+                (should (equal (delete-dups (copy-sequence (cddr node)))
+                               (list target)))
+                ;; CELL is a cons whose only reference is to the symbol
+                ;; alloc-tests.
+                (let ((cons (gethash target nodes)))
+                  (should (= (car cons) 2))
+                  (should (= (length (cddr cons)) 1))
+                  (should (= (car (gethash (nth 2 cons) nodes)) 0))))
+              ;; VEC is reachable from the roots.
+              (let ((seen (make-hash-table))
+                    (queue (mapcar #'cdr roots)))
+                (while queue
+                  (let ((address (logand (pop queue) -2)))
+                    (unless (gethash address seen)
+                      (puthash address t seen)
+                      (setq queue (append (cddr (gethash address nodes))
+                                          queue)))))
+                (should (gethash (caar found) seen))))))
+      (delete-file file))
+    (should (eq (aref vec 4320) cell))))
+
+(ert-deftest alloc-tests--heap-snapshot-nested-gc ()
+  "A collection run by a finalizer does not write to the snapshot."
+  (let ((file (make-temp-file "alloc-tests"))
+        (ran nil))
+    (unwind-protect
+        (progn
+          (garbage-collect)
+          (alloc-tests--drop-finalizers (lambda ()
+                                          (unless ran
+                                            (setq ran t)
+                                            (garbage-collect))))
+          (let ((gcs gcs-done))
+            (write-heap-snapshot file)
+            (should ran)
+            (should (eql gcs-done (+ gcs 2))))
+          (with-temp-buffer
+            (set-buffer-multibyte nil)
+            (insert-file-contents-literally file)
+            ;; This checks that the file ends right after the first
+            ;; terminator.
+            (should (car (alloc-tests--read-snapshot)))))
+      (delete-file file))))
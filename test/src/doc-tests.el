@@ -88,5 +88,50 @@
   (should (string= (substitute-command-keys "\\=") "\\="))
   )
 
+(ert-deftest doc-test-dynamic-docstring ()
+  "Doc strings are fetched again from a recompiled file."
+  (require 'bytecomp)
+  (let* ((dir (make-temp-file "doc-tests" t))
+         (file (expand-file-name "doc-tests-dyn.el" dir))
+         (byte-compile-dynamic-docstrings t)
+         (load-force-doc-strings nil))
+    (unwind-protect
+        (dolist (doc '("First doc string." "Second, longer doc string."))
+          (with-temp-file file
+            (insert ";;; -*- lexical-binding: t -*-\n"
+                    (format "(defun doc-tests--dyn () %S nil)\n" doc)))
+          (byte-compile-file file)
+          (load (concat file "c") nil t)
+          (should (consp (aref (symbol-function 'doc-tests--dyn) 4)))
+          (should (equal (documentation 'doc-tests--dyn t) doc))
+          (should (equal (documentation 'doc-tests--dyn t) doc)))
+      (fmakunbound 'doc-tests--dyn)
+      (delete-directory dir t))))
+
+;; Return the doc string at position POS in FILE.
+(defun doc-tests--file-doc (file pos)
+  (put 'doc-tests--var 'variable-documentation (cons file pos))
+  (documentation-property 'doc-tests--var 'variable-documentation t))
+
+(ert-deftest doc-test-doc-file-cache ()
+  "Doc strings are fetched from the contents of a doc file in memory."
+  (let ((file (make-temp-file "doc-tests")))
+    (unwind-protect
+        (progn
+          ;; An empty file cannot be mapped.
+          (should-error (doc-tests--file-doc file 1))
+          (with-temp-file file
+            (insert "#@26 First doc.\037Second doc.\037Last"))
+          (should (equal (doc-tests--file-doc file 5) "First doc."))
+          (should (equal (doc-tests--file-doc file 16) "Second doc."))
+          (should (equal (doc-tests--file-doc file 28) "Last"))
+          ;; A file rewritten with new contents is read again.
+          (with-temp-file file
+            (insert "#@12 Other doc.\037"))
+          (should (equal (doc-tests--file-doc file 5) "Other doc."))
+          (should-error (doc-tests--file-doc file 28)))
+      (put 'doc-tests--var 'variable-documentation nil)
+      (delete-file file))))
+
 (provide 'doc-tests)
 ;;; doc-tests.el ends here
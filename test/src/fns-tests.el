@@ -163,6 +163,125 @@ fns-tests--collate-enabled-p
 	   [(8 . "xxx") (8 . "bbb") (8 . "ttt") (8 . "eee")
 	    (9 . "aaa") (9 . "zzz") (9 . "ppp") (9 . "fff")])))
 
+;; Return a copy of LIST sorted by a plain insertion sort, as a
+;; reference for the stability of `sort'.
+(defun fns-tests--insertion-sort (list pred)
+  (let ((result nil))
+    (dolist (x list)
+      (let ((tail result) (prev nil))
+        (while (and tail (not (funcall pred x (car tail))))
+          (setq prev tail tail (cdr tail)))
+        (if prev
+            (setcdr prev (cons x tail))
+          (setq result (cons x result)))))
+    result))
+
+(ert-deftest fns-tests-sort-runs ()
+  (let* ((n 1000)
+         (rising (number-sequence 0 (1- n)))
+         (falling (reverse rising)))
+    (should (equal (sort (copy-sequence falling) #'<) rising))
+    (should (equal (sort (copy-sequence rising) #'>) falling))
+    (should (equal (sort (vconcat falling) #'<) (vconcat rising)))
+    ;; Equal elements in a falling run must keep their order.
+    (let ((l (mapcar (lambda (i) (cons (/ (- n i) 3) i)) rising)))
+      (should (equal (sort (copy-sequence l) #'car-less-than-car)
+                     (fns-tests--insertion-sort l #'car-less-than-car))))
+    (dotimes (_ 10)
+      (let ((l (mapcar (lambda (_) (cons (random 50) (random))) rising)))
+        (should (equal (sort (copy-sequence l) #'car-less-than-car)
+                       (fns-tests--insertion-sort
+                        l #'car-less-than-car)))))))
+
+(ert-deftest fns-tests-sort-key ()
+  (should (equal (sort '("xyzzy" "foo" "quux" "bar") #'< #'length)
+                 '("foo" "bar" "quux" "xyzzy")))
+  (should (equal (sort ["xyzzy" "foo" "quux" "bar"] #'> #'length)
+                 ["xyzzy" "quux" "foo" "bar"]))
+  (should (equal (sort '((b . 2) (a . 3) (c . 1)) #'string< #'car)
+                 '((a . 3) (b . 2) (c . 1))))
+  ;; KEY is called once per element.
+  (let ((calls 0))
+    (sort (number-sequence 1 100) #'<
+          (lambda (x) (setq calls (1+ calls)) (- x)))
+    (should (= calls 100)))
+  ;; Sorting a list changes the cdrs, not the cars.
+  (let* ((l (list 3 1 2))
+         (cell (cdr l)))
+    (setq l (sort l #'< #'-))
+    (should (equal l '(3 2 1)))
+    (should (eq (car cell) 1))))
+
+(ert-deftest fns-tests-sort-fast-paths ()
+  (should (equal (sort (list 3 1.5 (expt 2 70) -2 1) #'<)
+                 (list -2 1 1.5 3 (expt 2 70))))
+  (should (equal (sort (list "b" "ab" "a" "é" 'c) #'string<)
+                 (list "a" "ab" "b" 'c "é")))
+  (should-error (sort (list 2 'a 1) #'<) :type 'wrong-type-argument))
+
+(ert-deftest fns-tests-string-builder ()
+  (let ((b (make-string-builder 1)))
+    (should (string-builder-p b))
+    (should-not (string-builder-p "abc"))
+    (should (equal (string-builder-string b) ""))
+    (dotimes (i 1000)
+      (should (eq (string-builder-append b (number-to-string i) ?\s) b)))
+    (should (equal (string-builder-string b)
+                   (mapconcat (lambda (i) (format "%d " i))
+                              (number-sequence 0 999) "")))
+    (should-not (multibyte-string-p (string-builder-string b)))
+    ;; Text properties are dropped.
+    (string-builder-clear b)
+    (string-builder-append b (propertize "x" 'face 'bold))
+    (should (equal-including-properties (string-builder-string b) "x"))
+    (should-error (string-builder-append b 'x) :type 'wrong-type-argument)
+    (should-error (string-builder-append "x" "y")
+                  :type 'wrong-type-argument)))
+
+(ert-deftest fns-tests-string-builder-multibyte ()
+  ;; The text follows the same rules as `concat'.
+  (dolist (args (list (list "abc" ?d)
+                      (list "a\377" (unibyte-string 200))
+                      (list "a" (string-to-multibyte "b") "\377")
+                      (list "\377" ?é "c")
+                      (list ?a (unibyte-string 255) ?\N{SNOWMAN})
+                      (list (unibyte-string 255) ?\xff)))
+    (let ((b (make-string-builder)))
+      (apply #'string-builder-append b args)
+      (let ((expected (apply #'concat
+                             (mapcar (lambda (x)
+                                       (if (stringp x) x (string x)))
+                                     args)))
+            (s (string-builder-string b)))
+        (should (equal s expected))
+        (should (eq (multibyte-string-p s) (multibyte-string-p expected)))
+        (should (= (string-builder-length b) (length expected))))))
+  (let ((b (make-string-builder)))
+    (string-builder-append b "é")
+    (string-builder-clear b)
+    (string-builder-append b "abc")
+    (should-not (multibyte-string-p (string-builder-string b)))))
+
+(ert-deftest fns-tests-insert-string-builder ()
+  (let ((b (make-string-builder)))
+    (string-builder-append b "foo" ?é "bar")
+    (with-temp-buffer
+      (insert "<>")
+      (goto-char 2)
+      (let ((m (copy-marker (point) t)))
+        (insert-string-builder b)
+        (should (equal (buffer-string) "<fooébar>"))
+        (should (= (point) 9))
+        (should (= m 9))))
+    (with-temp-buffer
+      (set-buffer-multibyte nil)
+      (insert-string-builder (string-builder-append (make-string-builder)
+                                                    "a\377"))
+      (should (equal (buffer-string) "a\377")))
+    (with-temp-buffer
+      (insert-string-builder (make-string-builder))
+      (should (equal (buffer-string) "")))))
+
 (ert-deftest fns-tests-collate-sort ()
   (skip-unless (fns-tests--collate-enabled-p))
 
@@ -624,6 +743,82 @@ dot2
         (should (eq (gethash b2 hash)
                     (funcall test b1 b2)))))))
 
+(ert-deftest fns-tests-hash-table-churn ()
+  "Test hash tables with many insertions and removals."
+  (define-hash-table-test 'fns-tests--string-ci
+    (lambda (a b) (string= (downcase a) (downcase b)))
+    (lambda (a) (sxhash (downcase a))))
+  (dolist (test '(eq eql equal fns-tests--string-ci))
+    (let ((h (make-hash-table :test test :size 1))
+          (alist nil))
+      (dotimes (i 3000)
+        (let ((key (format "k%d" (% (* i 7) 300))))
+          (unless (eq test 'fns-tests--string-ci)
+            (setq key (% (* i 7) 300)))
+          (if (zerop (% i 3))
+              (progn (remhash key h)
+                     (setq alist (delete (assoc key alist) alist)))
+            (puthash key i h)
+            (setq alist (cons (cons key i)
+                              (delete (assoc key alist) alist))))))
+      (should (= (hash-table-count h) (length alist)))
+      (dolist (entry alist)
+        (should (eql (gethash (car entry) h) (cdr entry))))
+      (let ((copy (copy-hash-table h)))
+        (clrhash h)
+        (should (= (hash-table-count h) 0))
+        (dolist (entry alist)
+          (should (eq (gethash (car entry) h 'none) 'none))
+          (should (eql (gethash (car entry) copy) (cdr entry))))))))
+
+(ert-deftest fns-tests-hash-table-order ()
+  "Test that `maphash' visits entries in insertion order."
+  (let ((h (make-hash-table))
+        (keys nil))
+    (dotimes (i 100)
+      (puthash i t h))
+    (maphash (lambda (k _) (push k keys)) h)
+    (should (equal (nreverse keys) (number-sequence 0 99)))))
+
+(ert-deftest fns-tests-weak-hash-table-chain ()
+  "Test weak hash table entries kept alive through other weak tables."
+  (let ((z (list 'z))
+        (a (make-hash-table :weakness 'value :test 'eq))
+        (b (make-hash-table :weakness 'key :test 'eq))
+        (c (make-hash-table :weakness 'key :test 'eq)))
+    (let ((y (list 'y))
+          (inner (make-hash-table :weakness 'key :test 'eq)))
+      (puthash (list 'x) y a)
+      (puthash z y b)
+      (puthash z inner c)
+      (puthash z (list 'w) inner)
+      (dotimes (i 1000)
+        (puthash (list i) i b)))
+    (garbage-collect)
+    (should (= (hash-table-count a) 1))
+    (should (< (hash-table-count b) 1000))
+    (should (equal (gethash z b) '(y)))
+    (should (equal (gethash z (gethash z c)) '(w)))))
+
+(ert-deftest fns-tests-sxhash-string ()
+  "Test that strings differing in one byte or in byte order hash differently."
+  (dolist (len '(1 7 8 9 31 32 33 64 100 1000))
+    ;; The strings with a ?b at each position are permutations of each
+    ;; other, and each differs from the string of ?a in one byte.
+    (let ((hashes (list (sxhash-equal (make-string len ?a)))))
+      (dotimes (i len)
+        (let ((s (make-string len ?a)))
+          (aset s i ?b)
+          (push (sxhash-equal s) hashes)))
+      (should (= (length (delete-dups hashes)) (1+ len))))))
+
+(ert-deftest fns-tests-sxhash-long-list ()
+  "Test that lists differing after their 7th element hash differently."
+  (let ((hashes (mapcar (lambda (i)
+                          (sxhash-equal (append (make-list 20 0) (list i))))
+                        (number-sequence 1 50))))
+    (should (= (length (delete-dups hashes)) 50))))
+
 (ert-deftest test-nthcdr-simple ()
   (should (eq (nthcdr 0 'x) 'x))
   (should (eq (nthcdr 1 '(x . y)) 'y))
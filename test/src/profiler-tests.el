@@ -0,0 +1,181 @@
+;;; profiler-tests.el --- tests for profiler.c functions -*- lexical-binding: t -*-
+
+;; Copyright (C) 2018 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+
+(defun profiler-tests--fib (n)
+  (if (< n 2) n
+    (+ (profiler-tests--fib (- n 1)) (profiler-tests--fib (- n 2)))))
+
+(defun profiler-tests--throw ()
+  (throw 'profiler-tests nil))
+
+(ert-deftest profiler-tests-calls ()
+  "Check the counts and times recorded by the call profiler."
+  (should-not (profiler-calls-running-p))
+  (let (log)
+    (unwind-protect
+        (progn
+          (profiler-calls-start)
+          (should (profiler-calls-running-p))
+          (should-error (profiler-calls-start))
+          (profiler-tests--fib 10)
+          ;; Nonlocal exits pop the profiler's frames too.
+          (dotimes (_ 5)
+            (catch 'profiler-tests (profiler-tests--throw)))
+          (garbage-collect)
+          (setq log (profiler-calls-log)))
+      (profiler-calls-stop))
+    (should-not (profiler-calls-running-p))
+    (should-not (profiler-calls-stop))
+    (let ((fib (gethash 'profiler-tests--fib log)))
+      (should (= (aref fib 0) 177))
+      ;; Recursive calls are counted once in the inclusive time.
+      (should (<= (aref fib 2) (aref fib 1)))
+      (should (< (aref fib 1) 10)))
+    (should (= (aref (gethash 'profiler-tests--throw log) 0) 5))
+    (should (= (aref (gethash 'garbage-collect log) 0) 1))
+    (let ((gc (gethash 'garbage-collect log)))
+      (should (<= (aref gc 2) (aref gc 3) (aref gc 1))))
+    ;; The log was reset when it was returned.
+    (let ((log (profiler-calls-log)))
+      (should-not (and log (gethash 'profiler-tests--fib log))))
+    (should-not (profiler-calls-log))))
+
+(ert-deftest profiler-tests-native-frames ()
+  "Check that the CPU profiler records native frames on request."
+  (skip-unless (fboundp 'profiler-cpu-start))
+  (let ((profiler-native-frames t)
+        (found ()))
+    (unwind-protect
+        (progn
+          (profiler-cpu-start 1000000)
+          (let ((end (+ (float-time) 0.2)))
+            (while (< (float-time) end)
+              (profiler-tests--fib 15))))
+      (profiler-cpu-stop))
+    (maphash (lambda (backtrace _count)
+               (when (integerp (aref backtrace 0))
+                 (push backtrace found)))
+             (profiler-cpu-log))
+    ;; Some systems cannot unwind the native stack.
+    (skip-unless found)
+    ;; The native frames are followed by the innermost Lisp function.
+    (dolist (backtrace found)
+      (let ((i 0))
+        (while (integerp (aref backtrace i))
+          (setq i (1+ i)))
+        (should (or (symbolp (aref backtrace i))
+                    (functionp (aref backtrace i))))))))
+
+(ert-deftest profiler-tests-native-frames-thread ()
+  "Check that native frames do not hide the thread of a sample."
+  (skip-unless (and (fboundp 'profiler-cpu-start) (featurep 'threads)))
+  (let ((profiler-native-frames t)
+        (thread nil)
+        (native nil)
+        (found nil))
+    (unwind-protect
+        (progn
+          (profiler-cpu-start 1000000)
+          (setq thread
+                (make-thread
+                 (lambda ()
+                   (let ((end (+ (float-time) 0.3)))
+                     (while (< (float-time) end)
+                       (profiler-tests--fib 15))))))
+          (thread-join thread))
+      (profiler-cpu-stop))
+    (maphash (lambda (backtrace _count)
+               (when (integerp (aref backtrace 0))
+                 (setq native t))
+               (when (memq thread (append backtrace nil))
+                 (setq found t)))
+             (profiler-cpu-log))
+    ;; Some systems cannot unwind the native stack.
+    (skip-unless native)
+    (should found)))
+
+(ert-deftest profiler-tests-native-frames-change ()
+  "Check that changing `profiler-native-frames' starts a new log."
+  (skip-unless (fboundp 'profiler-cpu-start))
+  (let ((depth profiler-max-stack-depth))
+    (dolist (native '(t nil))
+      (let ((profiler-native-frames native))
+        (unwind-protect
+            (progn
+              (profiler-cpu-start 1000000)
+              (let ((end (+ (float-time) 0.1)))
+                (while (< (float-time) end)
+                  (profiler-tests--fib 15))))
+          (profiler-cpu-stop))))
+    ;; Only the samples of the last run are left.
+    (maphash (lambda (backtrace _count)
+               (unless (equal backtrace [Automatic\ GC])
+                 (should (= (length backtrace) depth))))
+             (profiler-cpu-log))))
+
+(defun profiler-tests--cons (n)
+  (let (l)
+    (dotimes (i n)
+      (push (* 1.5 i) l))
+    l))
+
+(ert-deftest profiler-tests-allocation ()
+  "Check that the allocation profiler attributes conses and floats."
+  (should-not (profiler-allocation-running-p))
+  (byte-compile 'profiler-tests--cons)
+  (let ((bytes (make-hash-table :test 'eq))
+        log)
+    (unwind-protect
+        (progn
+          (profiler-allocation-start 256)
+          (should (profiler-allocation-running-p))
+          (profiler-tests--cons 100000)
+          (setq log (profiler-allocation-log)))
+      (profiler-allocation-stop))
+    (maphash (lambda (backtrace count)
+               (when (eq (aref backtrace 1) 'profiler-tests--cons)
+                 (puthash (aref backtrace 0)
+                          (+ count (gethash (aref backtrace 0) bytes 0))
+                          bytes)))
+             log)
+    ;; The samples are random, but the estimates should be close.
+    (let* ((sizes (garbage-collect))
+           (conses (* 100000 (nth 1 (assq 'conses sizes))))
+           (floats (* 100000 (nth 1 (assq 'floats sizes)))))
+      (should (< (* 0.8 conses) (gethash 'cons bytes 0) (* 1.2 conses)))
+      (should (< (* 0.8 floats) (gethash 'float bytes 0) (* 1.2 floats))))))
+
+(ert-deftest profiler-tests-allocation-random ()
+  "Check that the allocation profiler does not change `random'."
+  (random "profiler-tests")
+  (let ((expected (list (random 1000000) (random 1000000))))
+    (random "profiler-tests")
+    (unwind-protect
+        (progn
+          (profiler-allocation-start 256)
+          (profiler-tests--cons 10000))
+      (profiler-allocation-stop)
+      (profiler-allocation-log))
+    (should (equal (list (random 1000000) (random 1000000)) expected))))
+
+;;; profiler-tests.el ends here.